@@ -0,0 +1,147 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    HL_can.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  NONE
+ *
+ * @brief   CAN driver of the HALCoGen HAL for the software-in-the-loop build
+ *
+ * @details Replaces the HALCoGen generated header of the same name on the host.
+ *          The functions are implemented by the virtual CAN bus in sil_can.c.
+ *
+ */
+
+#ifndef FOXBMS__HL_CAN_H_
+#define FOXBMS__HL_CAN_H_
+
+/*========== Includes =======================================================*/
+#include "HL_sys_common.h"
+
+/*========== Macros and Definitions =========================================*/
+/** number of message boxes of a CAN node */
+#define SIL_CAN_NR_OF_MESSAGE_BOXES (64u)
+
+/** number of CAN nodes */
+#define SIL_CAN_NR_OF_NODES (4u)
+
+/** simulated register set of a CAN node */
+typedef struct canBase {
+    uint32 CTL; /*!< control register */
+    uint32 ES;  /*!< error and status register */
+} canBASE_t;
+
+/** @{
+ * simulated CAN nodes
+ */
+#define canREG1 (&sil_canRegisters[0u])
+#define canREG2 (&sil_canRegisters[1u])
+#define canREG3 (&sil_canRegisters[2u])
+#define canREG4 (&sil_canRegisters[3u])
+/** @} */
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** register sets of the simulated CAN nodes */
+extern canBASE_t sil_canRegisters[SIL_CAN_NR_OF_NODES];
+
+/*========== Extern Function Prototypes =====================================*/
+/** initializes the CAN nodes */
+extern void canInit(void);
+
+/**
+ * @brief   transmits the data of a message box on the virtual CAN bus
+ * @param   node        CAN node
+ * @param   messageBox  message box (1 to 64)
+ * @param   data        pointer to the eight data bytes
+ * @return  1 if the message has been transmitted, otherwise 0
+ */
+extern uint32 canTransmit(canBASE_t *node, uint32 messageBox, const uint8 *data);
+
+/**
+ * @brief   copies the data of a message box
+ * @param   node        CAN node
+ * @param   messageBox  message box (1 to 64)
+ * @param   data        pointer to the buffer for the eight data bytes
+ * @return  1 if new data has been copied, otherwise 0
+ */
+extern uint32 canGetData(canBASE_t *node, uint32 messageBox, uint8 *const data);
+
+/**
+ * @brief   checks if a message box has a pending transmission
+ * @details Transmissions complete immediately on the virtual bus.
+ * @param   node        CAN node
+ * @param   messageBox  message box (1 to 64)
+ * @return  always 0
+ */
+extern uint32 canIsTxMessagePending(canBASE_t *node, uint32 messageBox);
+
+/**
+ * @brief   sets the arbitration value (identifier) of a message box
+ * @param   node            CAN node
+ * @param   messageBox      message box (1 to 64)
+ * @param   msgBoxArbitVal  arbitration value, the standard identifier is
+ *                          stored in bits 28 to 18
+ */
+extern void canUpdateID(canBASE_t *node, uint32 messageBox, uint32 msgBoxArbitVal);
+
+/**
+ * @brief   returns the arbitration value (identifier) of a message box
+ * @param   node        CAN node
+ * @param   messageBox  message box (1 to 64)
+ * @return  arbitration value of the message box
+ */
+extern uint32 canGetID(canBASE_t *node, uint32 messageBox);
+
+/**
+ * @brief   notification of a transmitted or received message
+ * @details Implemented by the application, called by the virtual CAN bus.
+ * @param   node        CAN node
+ * @param   messageBox  message box (1 to 64)
+ */
+extern void canMessageNotification(canBASE_t *node, uint32 messageBox);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__HL_CAN_H_ */
@@ -0,0 +1,117 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    HL_gio.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  NONE
+ *
+ * @brief   GIO driver of the HALCoGen HAL for the software-in-the-loop build
+ *
+ * @details Replaces the HALCoGen generated header of the same name on the host.
+ *          The ports are plain variables: the outputs of the application are not
+ *          connected to anything and inputs read back the value of the port.
+ *
+ */
+
+#ifndef FOXBMS__HL_GIO_H_
+#define FOXBMS__HL_GIO_H_
+
+/*========== Includes =======================================================*/
+#include "HL_sys_common.h"
+
+/*========== Macros and Definitions =========================================*/
+/** simulated register set of a GIO port */
+typedef volatile struct gioPort {
+    uint32 DIR;    /*!< data direction register */
+    uint32 DIN;    /*!< data input register */
+    uint32 DOUT;   /*!< data output register */
+    uint32 DSET;   /*!< data output set register */
+    uint32 DCLR;   /*!< data output clear register */
+    uint32 PDR;    /*!< open drain register */
+    uint32 PULDIS; /*!< pull disable register */
+    uint32 PSL;    /*!< pull up/down selection register */
+} gioPORT_t;
+
+/** @{
+ * simulated GIO ports
+ */
+#define gioPORTA (&sil_gioPorts[0u])
+#define gioPORTB (&sil_gioPorts[1u])
+/** @} */
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** register sets of the simulated GIO ports */
+extern gioPORT_t sil_gioPorts[2u];
+
+/*========== Extern Function Prototypes =====================================*/
+/** initializes the GIO ports */
+extern void gioInit(void);
+
+/**
+ * @brief   sets the output of a pin
+ * @param   port    GIO port
+ * @param   bit     pin of the port
+ * @param   value   output value (0 or 1)
+ */
+extern void gioSetBit(gioPORT_t *port, uint32 bit, uint32 value);
+
+/**
+ * @brief   reads the value of a pin
+ * @param   port    GIO port
+ * @param   bit     pin of the port
+ * @return  value of the pin (0 or 1)
+ */
+extern uint32 gioGetBit(gioPORT_t *port, uint32 bit);
+
+/**
+ * @brief   toggles the output of a pin
+ * @param   port    GIO port
+ * @param   bit     pin of the port
+ */
+extern void gioToggleBit(gioPORT_t *port, uint32 bit);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__HL_GIO_H_ */
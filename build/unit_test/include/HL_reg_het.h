@@ -0,0 +1,101 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    HL_reg_het.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  NONE
+ *
+ * @brief   HET registers of the HALCoGen HAL for the software-in-the-loop build
+ *
+ * @details Replaces the HALCoGen generated header of the same name on the host.
+ *          Only the GIO part of the HET is simulated.
+ *
+ */
+
+#ifndef FOXBMS__HL_REG_HET_H_
+#define FOXBMS__HL_REG_HET_H_
+
+/*========== Includes =======================================================*/
+#include "HL_sys_common.h"
+
+#include "HL_gio.h"
+
+/*========== Macros and Definitions =========================================*/
+/** simulated register set of a HET, the GIO registers have the layout of #gioPORT_t */
+typedef volatile struct hetBase {
+    uint32 GCR;    /*!< global configuration register */
+    uint32 DIR;    /*!< data direction register */
+    uint32 DIN;    /*!< data input register */
+    uint32 DOUT;   /*!< data output register */
+    uint32 DSET;   /*!< data output set register */
+    uint32 DCLR;   /*!< data output clear register */
+    uint32 PDR;    /*!< open drain register */
+    uint32 PULDIS; /*!< pull disable register */
+    uint32 PSL;    /*!< pull up/down selection register */
+} hetBASE_t;
+
+/** @{
+ * simulated HETs
+ */
+#define hetREG1 (&sil_hetRegisters[0u])
+#define hetREG2 (&sil_hetRegisters[1u])
+/** @} */
+
+/** @{
+ * GIO ports of the simulated HETs
+ */
+#define hetPORT1 ((gioPORT_t *)&hetREG1->DIR)
+#define hetPORT2 ((gioPORT_t *)&hetREG2->DIR)
+/** @} */
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** register sets of the simulated HETs */
+extern hetBASE_t sil_hetRegisters[2u];
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__HL_REG_HET_H_ */
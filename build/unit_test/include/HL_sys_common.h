@@ -0,0 +1,99 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    HL_sys_common.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  NONE
+ *
+ * @brief   Basic types of the HALCoGen HAL for the software-in-the-loop build
+ *
+ * @details Replaces the HALCoGen generated header of the same name on the host.
+ *
+ */
+
+#ifndef FOXBMS__HL_SYS_COMMON_H_
+#define FOXBMS__HL_SYS_COMMON_H_
+
+/*========== Includes =======================================================*/
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/** boolean values of the HALCoGen HAL */
+#ifndef TRUE
+#define TRUE (true)
+#endif
+#ifndef FALSE
+#define FALSE (false)
+#endif
+
+/** return values of the HALCoGen HAL */
+#define E_OK     (0u)
+#define E_NOT_OK (1u)
+
+/** @{
+ * basic types of the HALCoGen HAL
+ */
+typedef uint64_t uint64;
+typedef uint32_t uint32;
+typedef uint16_t uint16;
+typedef uint8_t uint8;
+typedef int64_t sint64;
+typedef int32_t sint32;
+typedef int16_t sint16;
+typedef int8_t sint8;
+typedef float float32;
+typedef double float64;
+typedef bool boolean;
+/** @} */
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__HL_SYS_COMMON_H_ */
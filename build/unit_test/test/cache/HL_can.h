@@ -0,0 +1,58 @@
+#include "include/HL_sys_common.h"
+typedef struct canBase {
+
+    uint32 CTL;
+
+    uint32 ES;
+
+} canBASE_t;
+
+extern canBASE_t sil_canRegisters[(4u)];
+
+
+
+
+
+
+
+extern void canInit(void);
+
+extern uint32 canTransmit(canBASE_t *node, uint32 messageBox, const uint8 *data);
+
+extern uint32 canGetData(canBASE_t *node, uint32 messageBox, uint8 *const data);
+
+extern uint32 canIsTxMessagePending(canBASE_t *node, uint32 messageBox);
+
+extern void canUpdateID(canBASE_t *node, uint32 messageBox, uint32 msgBoxArbitVal);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern uint32 canGetID(canBASE_t *node, uint32 messageBox);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void canMessageNotification(canBASE_t *node, uint32 messageBox);
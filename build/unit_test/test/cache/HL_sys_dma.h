@@ -0,0 +1,196 @@
+#include "include/HL_sys_common.h"
+
+
+
+
+
+
+
+
+
+
+
+
+typedef uint32 dmaChannel_t;
+
+
+
+typedef uint32 dmaRequest_t;
+
+
+
+typedef uint32 dmaInterrupt_t;
+
+
+
+typedef uint32 dmaIntGroup_t;
+
+
+
+typedef uint32 dmaTriggerType_t;
+
+typedef struct dmaCTRLPKT {
+
+    uint32 SADD;
+
+    uint32 DADD;
+
+    uint32 CHCTRL;
+
+    uint32 FRCNT;
+
+    uint32 ELCNT;
+
+    uint32 ELDOFFSET;
+
+    uint32 ELSOFFSET;
+
+    uint32 FRDOFFSET;
+
+    uint32 FRSOFFSET;
+
+    uint32 PORTASGN;
+
+    uint32 RDSIZE;
+
+    uint32 WRSIZE;
+
+    uint32 TTYPE;
+
+    uint32 ADDMODERD;
+
+    uint32 ADDMODEWR;
+
+    uint32 AUTOINIT;
+
+} g_dmaCTRL;
+
+
+
+
+
+typedef volatile struct {
+
+    uint32 ISADDR;
+
+    uint32 IDADDR;
+
+    uint32 ITCOUNT;
+
+    uint32 rsvd1;
+
+    uint32 CHCTRL;
+
+    uint32 EIOFF;
+
+    uint32 FIOFF;
+
+    uint32 rsvd2;
+
+} dmaPCP_t;
+
+
+
+
+
+typedef volatile struct dmaRamBase {
+
+    dmaPCP_t PCP[(32u)];
+
+} dmaRAMBASE_t;
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern dmaRAMBASE_t sil_dmaRam;
+
+
+
+
+
+
+
+extern void dmaEnable(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void dmaReqAssign(dmaChannel_t channel, dmaRequest_t reqline);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void dmaSetCtrlPacket(dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void dmaSetChEnable(dmaChannel_t channel, dmaTriggerType_t type);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void dmaEnableInterrupt(dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void dmaGroupANotification(dmaInterrupt_t inttype, uint32 channel);
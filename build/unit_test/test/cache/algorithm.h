@@ -0,0 +1,44 @@
+#include "../../src/app/application/algorithm/config/algorithm_cfg.h"
+extern void ALGO_UnlockInitialization(void);
+
+extern void ALGO_MainFunction(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void ALGO_MonitorExecutionTime(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void ALGO_GetStatistics(uint16_t algorithmIndex, ALGO_STATISTICS_s *pStatistics);
+
+
+
+
+
+
+
+extern void TEST_ALGO_ResetInitializationRequest(void);
+
+extern void TEST_ALGO_ResetScheduler(void);
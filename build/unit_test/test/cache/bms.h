@@ -0,0 +1,460 @@
+#include "../../src/app/engine/database/database.h"
+#include "../../src/app/application/config/bms_cfg.h"
+#include "../../src/app/application/config/battery_system_cfg.h"
+
+
+
+
+
+
+
+
+typedef enum BMS_CURRENT_FLOW_STATE {
+
+    BMS_CHARGING,
+
+    BMS_DISCHARGING,
+
+    BMS_RELAXATION,
+
+    BMS_AT_REST,
+
+} BMS_CURRENT_FLOW_STATE_e;
+
+
+
+
+
+typedef enum BMS_CHECK {
+
+    BMS_CHECK_OK,
+
+    BMS_CHECK_BUSY,
+
+    BMS_CHECK_NOT_OK,
+
+} BMS_CHECK_e;
+
+
+
+
+
+typedef enum BMS_CONSIDER_PRECHARGE {
+
+    BMS_DO_NOT_TAKE_PRECHARGE_INTO_ACCCOUNT,
+
+    BMS_TAKE_PRECHARGE_INTO_ACCCOUNT,
+
+} BMS_CONSIDER_PRECHARGE_e;
+
+
+
+
+
+typedef enum BMS_STATEMACH {
+
+
+
+    BMS_STATEMACH_UNINITIALIZED,
+
+    BMS_STATEMACH_INITIALIZATION,
+
+    BMS_STATEMACH_INITIALIZED,
+
+    BMS_STATEMACH_IDLE,
+
+    BMS_STATEMACH_OPENCONTACTORS,
+
+    BMS_STATEMACH_STANDBY,
+
+    BMS_STATEMACH_PRECHARGE,
+
+    BMS_STATEMACH_NORMAL,
+
+    BMS_STATEMACH_DISCHARGE,
+
+    BMS_STATEMACH_CHARGE,
+
+    BMS_STATEMACH_ERROR,
+
+    BMS_STATEMACH_UNDEFINED,
+
+    BMS_STATEMACH_RESERVED1,
+
+} BMS_STATEMACH_e;
+
+
+
+
+
+typedef enum BMS_CANSTATE {
+
+
+
+    BMS_CANSTATE_UNINITIALIZED,
+
+    BMS_CANSTATE_INITIALIZATION,
+
+    BMS_CANSTATE_INITIALIZED,
+
+    BMS_CANSTATE_IDLE,
+
+    BMS_CANSTATE_OPENCONTACTORS,
+
+    BMS_CANSTATE_STANDBY,
+
+    BMS_CANSTATE_PRECHARGE,
+
+    BMS_CANSTATE_NORMAL,
+
+    BMS_CANSTATE_CHARGE,
+
+    BMS_CANSTATE_ERROR,
+
+} BMS_CANSTATE_e;
+
+
+
+
+
+typedef enum BMS_STATEMACH_SUB {
+
+    BMS_ENTRY,
+
+    BMS_CHECK_ERROR_FLAGS_INTERLOCK,
+
+    BMS_INTERLOCK_CHECKED,
+
+    BMS_CHECK_STATE_REQUESTS,
+
+    BMS_CHECK_BALANCING_REQUESTS,
+
+    BMS_CHECK_ERROR_FLAGS,
+
+    BMS_CHECK_CONTACTOR_NORMAL_STATE,
+
+    BMS_CHECK_CONTACTOR_CHARGE_STATE,
+
+    BMS_OPEN_INTERLOCK,
+
+    BMS_CHECK_INTERLOCK_CLOSE_AFTER_ERROR,
+
+    BMS_PRECHARGE_CLOSE_MINUS,
+
+    BMS_PRECHARGE_CLOSE_PRECHARGE,
+
+    BMS_PRECHARGE_CHECK_VOLTAGES,
+
+    BMS_PRECHARGE_OPEN_PRECHARGE,
+
+    BMS_OPEN_FIRST_CONTACTOR,
+
+    BMS_OPEN_SECOND_CONTACTOR_MINUS,
+
+    BMS_OPEN_SECOND_CONTACTOR_PLUS,
+
+    BMS_CLOSE_FIRST_STRING_PRECHARGE_STATE,
+
+    BMS_CHECK_CLOSE_FIRST_STRING_PRECHARGE_STATE,
+
+    BMS_CHECK_ERROR_FLAGS_PRECHARGE,
+
+    BMS_CHECK_ERROR_FLAGS_PRECHARGE_FIRST_STRING,
+
+    BMS_PRECHARGE_CLOSE_NEXT_STRING,
+
+    BMS_CHECK_STRING_CLOSED,
+
+    BMS_CHECK_ERROR_FLAGS_PRECHARGE_CLOSINGSTRINGS,
+
+    BMS_CHECK_ERROR_FLAGS_CLOSINGPRECHARGE,
+
+    BMS_NORMAL_CLOSE_NEXT_STRING,
+
+    BMS_OPEN_ALL_PRECHARGES,
+
+    BMS_CHECK_ALL_PRECHARGES_OPEN,
+
+    BMS_OPEN_STRINGS_ENTRY,
+
+    BMS_OPEN_STRINGS,
+
+    BMS_CHECK_STRING_OPEN,
+
+    BMS_OPEN_STRINGS_EXIT,
+
+} BMS_STATEMACH_SUB_e;
+
+
+
+
+
+typedef enum BMS_STATE_REQUEST {
+
+    BMS_STATE_INIT_REQUEST,
+
+    BMS_STATE_ERROR_REQUEST,
+
+    BMS_STATE_NO_REQUEST,
+
+} BMS_STATE_REQUEST_e;
+
+
+
+
+
+
+
+
+
+typedef enum BMS_RETURN_TYPE {
+
+    BMS_OK,
+
+    BMS_BUSY_OK,
+
+    BMS_REQUEST_PENDING,
+
+    BMS_ILLEGAL_REQUEST,
+
+    BMS_ALREADY_INITIALIZED,
+
+    BMS_ILLEGAL_TASK_TYPE,
+
+} BMS_RETURN_TYPE_e;
+
+
+
+
+
+typedef enum BMS_POWERLINE_TYPE {
+
+    BMS_PL_OPEN,
+
+    BMS_PL_0,
+
+    BMS_PL_1,
+
+} BMS_POWERLINE_TYPE_e;
+
+
+
+
+
+
+
+
+
+
+
+
+
+typedef struct BMS_STATE {
+
+    uint16_t timer;
+
+    BMS_STATE_REQUEST_e stateRequest;
+
+    BMS_STATEMACH_e state;
+
+    BMS_STATEMACH_SUB_e substate;
+
+    BMS_STATEMACH_e laststate;
+
+    BMS_STATEMACH_SUB_e lastsubstate;
+
+    uint32_t ErrRequestCounter;
+
+    STD_RETURN_TYPE_e initFinished;
+
+    uint8_t triggerentry;
+
+    uint8_t counter;
+
+    BMS_CURRENT_FLOW_STATE_e currentFlowState;
+
+    uint32_t restTimer_10ms;
+
+    uint16_t OscillationTimeout;
+
+    uint8_t PrechargeTryCounter;
+
+    BMS_POWERLINE_TYPE_e powerline;
+
+    uint8_t numberOfClosedStrings;
+
+    uint16_t stringOpenTimeout;
+
+    uint32_t nextstringclosedtimer;
+
+    uint16_t stringCloseTimeout;
+
+    BMS_STATEMACH_e nextstate;
+
+    uint8_t firstClosedString;
+
+    uint16_t prechargeOpenTimeout;
+
+    uint16_t prechargeCloseTimeout;
+
+    uint8_t closedPrechargeContactors[(3u)];
+
+    uint8_t closedStrings[(3u)];
+
+    uint8_t deactivatedStrings[(3u)];
+
+} BMS_STATE_s;
+
+extern BMS_RETURN_TYPE_e BMS_SetStateRequest(BMS_STATE_REQUEST_e statereq);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern BMS_STATEMACH_e BMS_GetState(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e BMS_GetInitializationState(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void BMS_Trigger(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern BMS_CURRENT_FLOW_STATE_e BMS_GetBatterySystemState(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern BMS_CURRENT_FLOW_STATE_e BMS_GetCurrentFlowDirection(int32_t current_mA);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           BMS_IsStringClosed(uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           BMS_IsStringPrecharging(uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern BMS_RETURN_TYPE_e TEST_BMS_CheckStateRequest(BMS_STATE_REQUEST_e statereq);
+
+extern BMS_STATE_REQUEST_e TEST_BMS_TransferStateRequest(void);
+
+extern uint8_t TEST_BMS_CheckReEntrance(void);
+
+extern uint8_t TEST_BMS_CheckCanRequests(void);
+
+extern STD_RETURN_TYPE_e TEST_BMS_CheckAnyErrorFlagSet(void);
+
+extern void TEST_BMS_GetMeasurementValues(void);
+
+extern void TEST_BMS_CheckOpenSenseWire(void);
+
+extern STD_RETURN_TYPE_e TEST_BMS_CheckPrecharge(uint8_t stringNumber, DATA_BLOCK_PACK_VALUES_s *pPackValues);
+
+extern uint8_t TEST_BMS_GetHighestString(BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s *pPackValues);
+
+extern uint8_t TEST_BMS_GetClosestString(BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s *pPackValues);
+
+extern uint8_t TEST_BMS_GetLowestString(BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s *pPackValues);
+
+extern int32_t TEST_BMS_GetStringVoltageDifference(uint8_t string, DATA_BLOCK_PACK_VALUES_s *pPackValues);
+
+extern int32_t TEST_BMS_GetAverageStringCurrent(DATA_BLOCK_PACK_VALUES_s *pPackValues);
+
+extern void TEST_BMS_UpdateBatsysState(DATA_BLOCK_PACK_VALUES_s *pPackValues);
@@ -0,0 +1,234 @@
+#include "../../src/app/main/include/general.h"
+
+
+
+
+typedef struct CAN_RX_BUFFER {
+
+    volatile uint8_t readIndex;
+
+    volatile uint8_t writeIndex;
+
+    uint8_t length;
+
+    volatile uint32_t receivedMessages;
+
+    volatile uint32_t overflowCounter;
+
+    volatile uint32_t droppedLowPriorityFrames;
+
+    volatile uint8_t highWaterMark;
+
+} CAN_RX_BUFFER_s;
+
+
+
+
+
+typedef struct CAN_STATE {
+
+    
+
+   _Bool 
+
+        periodicEnable;
+
+    
+
+   _Bool 
+
+        currentSensorPresent[(3u)];
+
+    
+
+   _Bool 
+
+        currentSensorCCPresent[(3u)];
+
+    
+
+   _Bool 
+
+        currentSensorECPresent[(3u)];
+
+} CAN_STATE_s;
+
+
+
+
+
+
+
+
+
+
+
+
+
+typedef struct CAN_TX_SCHEDULE {
+
+    uint16_t slotStart[(100u) + 1u];
+
+    uint8_t entries[(512u)];
+
+    uint32_t maximumBitsPerSlot;
+
+} CAN_TX_SCHEDULE_s;
+
+
+
+
+
+
+
+
+
+
+
+typedef struct CAN_RX_DISPATCH_TABLE {
+
+    uint8_t numberOfEntries;
+
+    uint32_t id[(64u)];
+
+    uint8_t message[(64u)];
+
+} CAN_RX_DISPATCH_TABLE_s;
+
+extern STD_RETURN_TYPE_e CAN_DataSend(canBASE_t *pNode, uint32_t id, uint8 *pData);
+
+extern STD_RETURN_TYPE_e CAN_BuildTxSchedule(
+
+    const CAN_MSG_TX_TYPE_s *pMessages,
+
+    uint8_t numberOfMessages,
+
+    CAN_TX_SCHEDULE_s *pSchedule);
+
+extern STD_RETURN_TYPE_e CAN_BuildRxDispatchTable(
+
+    const CAN_MSG_RX_TYPE_s *pMessages,
+
+    uint8_t numberOfMessages,
+
+    CAN_RX_DISPATCH_TABLE_s *pTable);
+
+extern uint8_t CAN_FindRxHandlers(const CAN_RX_DISPATCH_TABLE_s *pTable, uint32_t id, uint8_t *pFirstEntry);
+
+
+
+
+
+
+
+
+
+
+
+extern void CAN_MainFunction(void);
+
+extern void CAN_ReadRxBuffer(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void CAN_Initialize(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void CAN_EnablePeriodic(
+
+                              _Bool 
+
+                                   command);
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           CAN_IsCurrentSensorPresent(uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           CAN_IsCurrentSensorCcPresent(uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           CAN_IsCurrentSensorEcPresent(uint8_t stringNumber);
+
+
+
+
+
+
+
+extern CAN_STATE_s *TEST_CAN_GetCANState(void);
+
+extern CAN_RX_BUFFER_s *TEST_CAN_GetRxBuffer(void);
+
+extern CAN_RX_DISPATCH_TABLE_s *TEST_CAN_GetRxDispatchTable(void);
+
+extern uint32_t TEST_CAN_GetWorstCaseFrameBits(uint8_t dlc);
+
+extern STD_RETURN_TYPE_e TEST_CAN_StoreRxMessage(uint32_t id, const uint8_t *pData);
+
+extern void TEST_CAN_UpdateRxStatistics(void);
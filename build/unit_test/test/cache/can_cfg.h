@@ -0,0 +1,263 @@
+#include "../../src/app/engine/database/database.h"
+#include "../../src/app/main/include/general.h"
+
+
+typedef struct CAN_BUFFERELEMENT {
+
+    uint32_t id;
+
+    uint8_t data[8];
+
+} CAN_BUFFERELEMENT_s;
+
+typedef enum {
+
+    littleEndian,
+
+    bigEndian,
+
+} CAN_byteOrder_e;
+
+
+
+
+
+typedef enum {
+
+    CAN_RX_PRIORITY_LOW,
+
+    CAN_RX_PRIORITY_HIGH,
+
+} CAN_RX_PRIORITY_e;
+
+
+
+
+
+typedef uint32_t (
+
+    *can_callback_funcPtr)(uint32_t ID, uint8_t DLC, CAN_byteOrder_e byteorder, uint8_t *candata, uint32_t *pMuxId);
+
+
+
+
+
+typedef struct CAN_MSG_TX_TYPE {
+
+    uint32_t id;
+
+    uint8_t dlc;
+
+    uint32_t repetitionTime;
+
+    uint32_t repetitionPhase;
+
+    CAN_byteOrder_e byteOrder;
+
+    can_callback_funcPtr callbackFunction;
+
+    uint32_t *pMuxId;
+
+} CAN_MSG_TX_TYPE_s;
+
+
+
+
+
+typedef struct CAN_MSG_RX_TYPE {
+
+    uint32_t id;
+
+    uint8_t dlc;
+
+    uint8_t rtr;
+
+    CAN_byteOrder_e byteOrder;
+
+    can_callback_funcPtr callbackFunction;
+
+    CAN_RX_PRIORITY_e priority;
+
+} CAN_MSG_RX_TYPE_s;
+
+
+
+
+
+extern const CAN_MSG_TX_TYPE_s can_txMessages[];
+
+extern const CAN_MSG_RX_TYPE_s can_rxMessages[];
+
+
+
+
+
+extern const uint8_t can_txLength;
+
+extern const uint8_t can_rxLength;
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern DATA_BLOCK_CELL_VOLTAGE_s *TEST_CAN_GetCellvoltageTab(void);
+
+
+
+
+
+extern uint32_t TEST_CAN_TxVoltage(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_TxPcbTemperature(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_TxExternalTemperature(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_TxVoltageMinMax(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_TxAlgorithmStatistics(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_TxProfilingTimes(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_TxProfilingHistogram(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+
+
+
+
+extern uint32_t TEST_CAN_RxRequest(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_RxSwReset(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_RxCurrentSensor(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_RxDebug(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
+
+extern uint32_t TEST_CAN_RxSwVersion(
+
+    uint32_t id,
+
+    uint8_t dlc,
+
+    CAN_byteOrder_e byteOrder,
+
+    uint8_t *pCanData,
+
+    uint32_t *pMuxId);
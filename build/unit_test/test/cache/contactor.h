@@ -0,0 +1,160 @@
+#include "../../src/app/driver/config/contactor_cfg.h"
+extern CONT_ELECTRICAL_STATE_TYPE_e CONT_GetContactorSetValue(const CONT_NAMES_e name);
+
+void CONT_GetContactorFeedback(void);
+
+extern STD_RETURN_TYPE_e CONT_SetContactorState(
+
+    const CONT_NAMES_e name,
+
+    CONT_ELECTRICAL_STATE_TYPE_e requestedContactorState);
+
+
+
+
+
+typedef enum {
+
+    CONT_ENTRY,
+
+    CONT_SET_EDGE_LOW_INIT,
+
+    CONT_SET_EDGE_HIGH,
+
+    CONT_SET_EDGE_LOW,
+
+    CONT_CHECK_REQUESTS,
+
+} CONT_STATEMACH_SUB_e;
+
+
+
+
+
+typedef enum CONT_POWER_LINE_e {
+
+    CONT_POWER_LINE_NONE,
+
+    CONT_POWER_LINE_0,
+
+
+
+    CONT_POWER_LINE_1,
+
+
+
+} CONT_POWER_LINE_e;
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern CONT_ELECTRICAL_STATE_TYPE_e CONT_GetState(uint8_t contactorNumber);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e CONT_CloseString(uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e CONT_OpenString(uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e CONT_ClosePrecharge(uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e CONT_OpenPrecharge(uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void CONT_CheckFeedback(void);
+
+
+
+
+
+
+
+
+
+extern void CONT_Initialize(void);
+
+
+
+
+
+
+
+extern void TEST_CONT_InitializationCheckOfContactorRegistry(void);
+
+extern CONT_CONTACTOR_INDEX TEST_CONT_ResolveContactorName(const CONT_NAMES_e name);
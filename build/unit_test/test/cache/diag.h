@@ -0,0 +1,100 @@
+#include "../../src/app/engine/config/diag_cfg.h"
+
+
+
+
+
+
+
+
+typedef enum DIAG_RETURNTYPE {
+
+    DIAG_HANDLER_RETURN_OK,
+
+    DIAG_HANDLER_RETURN_ERR_OCCURRED,
+
+    DIAG_HANDLER_RETURN_WARNING_OCCURRED,
+
+    DIAG_HANDLER_RETURN_WRONG_ID,
+
+    DIAG_HANDLER_RETURN_UNKNOWN,
+
+    DIAG_HANDLER_INVALID_TYPE,
+
+    DIAG_HANDLER_INVALID_DATA,
+
+    DIAG_HANDLER_INVALID_ERR_IMPACT,
+
+    DIAG_HANDLER_RETURN_NOT_READY,
+
+} DIAG_RETURNTYPE_e;
+
+
+
+
+
+
+
+
+
+typedef enum {
+
+    DIAG_STATE_UNINITIALIZED,
+
+    DIAG_STATE_INITIALIZED,
+
+} DIAG_STATE_e;
+
+
+
+
+
+typedef struct DIAG {
+
+    DIAG_STATE_e state;
+
+    uint16_t errcnttotal;
+
+    uint16_t errcntreported;
+
+    uint32_t entry_event[DIAG_ID_MAX];
+
+    uint8_t entry_cnt[DIAG_ID_MAX];
+
+    uint16_t occurrenceCounter[(3u)][DIAG_ID_MAX];
+
+    uint8_t id2ch[DIAG_ID_MAX];
+
+    uint8_t nr_of_ch;
+
+    uint32_t errflag[(DIAG_ID_MAX + 31) / 32];
+
+    uint32_t warnflag[(DIAG_ID_MAX + 31) / 32];
+
+    uint32_t err_enableflag[(DIAG_ID_MAX + 31) / 32];
+
+} DIAG_s;
+
+extern DIAG_RETURNTYPE_e DIAG_Handler(DIAG_ID_e diag_id, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data);
+
+extern STD_RETURN_TYPE_e DIAG_CheckEvent(
+
+    STD_RETURN_TYPE_e cond,
+
+    DIAG_ID_e diag_id,
+
+    DIAG_IMPACT_LEVEL_e impact,
+
+    uint32_t data);
+
+extern STD_RETURN_TYPE_e DIAG_Initialize(DIAG_DEV_s *diag_dev_pointer);
+
+
+
+
+
+
+
+
+
+extern void DIAG_PrintErrors(void);
@@ -0,0 +1,194 @@
+#include "../../src/app/driver/config/dma_cfg.h"
+
+
+
+
+
+
+
+
+
+
+extern g_dmaCTRL g_dmaCTRLPKT_TX;
+
+
+
+extern g_dmaCTRL g_dmaCTRLPKT_RX;
+
+
+
+
+
+extern g_dmaCTRL dma_n775DmaControlPacketTx;
+
+
+
+extern g_dmaCTRL dma_n775DmaControlPacketRx;
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void DMA_Initialize(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void DMA_ReInit(void);
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e DMA_TransmitReceive_SPIwithDMA(void);
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           DMA_IsTransmitOngoing(void);
+
+
+
+
+
+
+
+
+
+extern void DMA_SetTransmitOngoing(void);
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           DMA_IsTxTransmitOngoingN775(void);
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           DMA_IsRxTransmitOngoingN775(void);
+
+
+
+
+
+
+
+
+
+extern void DMA_SetTxTransmitOngoingN775(void);
+
+
+
+
+
+
+
+
+
+extern void DMA_SetRxTransmitOngoingN775(void);
+
+
+
+
+
+
+
+
+
+
+
+void DMA_InitN775(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+void DMA_ReInitN775Tx(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+void DMA_ReInitN775Rx(void);
+
+
+
+
+
+
+
+
+
+STD_RETURN_TYPE_e DMA_TransmitSPiWithDmaN775(void);
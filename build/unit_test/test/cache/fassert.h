@@ -0,0 +1,36 @@
+#include "/root/repo/tools/vendor/ceedling/vendor/c_exception/lib/CException.h"
+#pragma SWI_ALIAS(FAS_DisableInterrupts, 5)
+
+
+
+extern void FAS_DisableInterrupts(void);
+
+typedef struct ASSERT_LOC {
+
+    uint32_t *pc;
+
+    uint32_t line;
+
+} ASSERT_LOC_s;
+
+
+
+
+
+
+
+
+
+extern ASSERT_LOC_s fas_assertLocation;
+
+extern void fas_storeAssertLoc(uint32_t *pc, uint32_t line);
+
+static inline void FAS_infiniteLoop() {
+
+}
+
+static inline uint32_t __curpc(void) {
+
+    return 0u;
+
+}
@@ -0,0 +1,184 @@
+#include "../../src/app/driver/config/interlock_cfg.h"
+
+
+
+
+
+
+
+
+
+
+
+
+typedef enum {
+
+
+
+    ILCK_STATEMACH_UNINITIALIZED,
+
+    ILCK_STATEMACH_INITIALIZATION,
+
+    ILCK_STATEMACH_INITIALIZED,
+
+    ILCK_STATEMACH_WAIT_FIRST_REQUEST,
+
+    ILCK_STATEMACH_OPEN,
+
+    ILCK_STATEMACH_CLOSED,
+
+    ILCK_STATEMACH_UNDEFINED,
+
+    ILCK_STATEMACH_ERROR,
+
+} ILCK_STATEMACH_e;
+
+
+
+
+
+
+
+
+
+typedef enum {
+
+    ILCK_ENTRY,
+
+} ILCK_STATEMACH_SUB_e;
+
+
+
+
+
+
+
+
+
+typedef enum {
+
+    ILCK_STATE_INIT_REQUEST,
+
+    ILCK_STATE_OPEN_REQUEST,
+
+    ILCK_STATE_CLOSE_REQUEST,
+
+    ILCK_STATE_ERROR_REQUEST,
+
+    ILCK_STATE_NO_REQUEST,
+
+} ILCK_STATE_REQUEST_e;
+
+
+
+
+
+
+
+
+
+typedef enum {
+
+    ILCK_OK,
+
+    ILCK_BUSY_OK,
+
+    ILCK_REQUEST_PENDING,
+
+    ILCK_ILLEGAL_REQUEST,
+
+    ILCK_INIT_ERROR,
+
+    ILCK_ERROR,
+
+    ILCK_ALREADY_INITIALIZED,
+
+    ILCK_ILLEGAL_TASK_TYPE,
+
+} ILCK_RETURN_TYPE_e;
+
+
+
+
+
+
+
+
+
+
+
+typedef struct {
+
+    uint16_t timer;
+
+    ILCK_STATE_REQUEST_e
+
+        statereq;
+
+    ILCK_STATEMACH_e
+
+        state;
+
+    ILCK_STATEMACH_SUB_e
+
+        substate;
+
+    ILCK_STATEMACH_e
+
+        laststate;
+
+    ILCK_STATEMACH_SUB_e
+
+        lastsubstate;
+
+    uint32_t ErrRequestCounter;
+
+    uint8_t triggerentry;
+
+    uint8_t counter;
+
+} ILCK_STATE_s;
+
+extern STD_RETURN_TYPE_e ILCK_Init(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern ILCK_ELECTRICAL_STATE_TYPE_e ILCK_GetInterlockFeedback(void);
+
+extern ILCK_RETURN_TYPE_e ILCK_SetStateRequest(ILCK_STATE_REQUEST_e statereq);
+
+extern ILCK_STATEMACH_e ILCK_GetState(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void ILCK_Trigger(void);
+
+
+
+
+
+
+
+extern void TEST_ILCK_SetStateStruct(ILCK_STATE_s state);
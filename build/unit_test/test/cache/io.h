@@ -0,0 +1,6 @@
+#include "../../src/app/main/include/general.h"
+extern void IO_PinSet(uint32_t *pRegisterAddress, uint32_t pin);
+
+extern void IO_PinReset(uint32_t *pRegisterAddress, uint32_t pin);
+
+extern uint8_t IO_PinGet(const uint32_t *pRegisterAddress, uint32_t pin);
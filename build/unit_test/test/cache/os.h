@@ -0,0 +1,232 @@
+#include "../../src/os/freertos/include/task.h"
+#include "../../src/os/freertos/include/semphr.h"
+#include "../../src/os/freertos/include/event_groups.h"
+#include "../../src/os/freertos/include/FreeRTOS.h"
+#include "../../src/app/main/include/general.h"
+
+
+typedef enum OS_PRIORITY {
+
+    OS_PRIORITY_IDLE,
+
+    OS_PRIORITY_LOW,
+
+    OS_PRIORITY_BELOW_NORMAL,
+
+    OS_PRIORITY_NORMAL,
+
+    OS_PRIORITY_ABOVE_NORMAL,
+
+    OS_PRIORITY_HIGH,
+
+    OS_PRIORITY_ABOVE_HIGH,
+
+    OS_PRIORITY_VERY_HIGH,
+
+    OS_PRIORITY_BELOW_REALTIME,
+
+    OS_PRIORITY_REAL_TIME,
+
+} OS_PRIORITY_e;
+
+
+
+
+
+typedef enum OS_BOOT_STATE {
+
+    OS_OFF,
+
+    OS_CREATE_QUEUES,
+
+    OS_CREATE_MUTEX,
+
+    OS_CREATE_EVENT,
+
+    OS_CREATE_TASKS,
+
+    OS_INIT_PRE_OS,
+
+    OS_SCHEDULER_RUNNING,
+
+    OS_ENGINE_RUNNING,
+
+    OS_PRECYCLIC_INIT_HAS_FINISHED,
+
+    OS_SYSTEM_RUNNING,
+
+    OS_INIT_OS_FATALERROR_SCHEDULER,
+
+    OS_INIT_OS_FATALERROR,
+
+    OS_BOOT_STATE_MAX,
+
+} OS_BOOT_STATE_e;
+
+
+
+
+
+typedef struct OS_TIMER {
+
+    uint8_t timer_1ms;
+
+    uint8_t timer_10ms;
+
+    uint8_t timer_100ms;
+
+    uint8_t timer_sec;
+
+    uint8_t timer_min;
+
+    uint8_t timer_h;
+
+    uint16_t timer_d;
+
+} OS_TIMER_s;
+
+
+
+
+
+typedef struct OS_TASK_DEFINITION {
+
+    uint32_t phase;
+
+    uint32_t cycleTime;
+
+    UBaseType_t priority;
+
+    uint16_t stackSize;
+
+
+
+} OS_TASK_DEFINITION_s;
+
+
+
+
+
+
+
+extern volatile OS_BOOT_STATE_e os_boot;
+
+
+
+extern volatile OS_TIMER_s os_timer;
+
+
+
+
+
+extern uint32_t os_schedulerStartTime;
+
+
+
+
+
+extern SemaphoreHandle_t os_mutexes[];
+
+extern EventGroupHandle_t os_events[];
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void OS_StartScheduler(void);
+
+
+
+
+
+
+
+
+
+
+
+extern void OS_InitializeTasks(void);
+
+extern void vApplicationGetIdleTaskMemory(
+
+    StaticTask_t **ppxIdleTaskTCBBuffer,
+
+    StackType_t **ppxIdleTaskStackBuffer,
+
+    uint32_t *pulIdleTaskStackSize);
+
+extern void vApplicationIdleHook(void);
+
+extern void vApplicationStackOverflowHook(TaskHandle_t xTask, signed char *pcTaskName);
+
+extern void OS_EnterTaskCritical(void);
+
+extern void OS_ExitTaskCritical(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void OS_TriggerTimer(volatile OS_TIMER_s *timer);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern uint32_t OS_GetTickCount(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void OS_DelayTask(uint32_t delay_ms);
+
+extern void OS_DelayTaskUntil(uint32_t *pPreviousWakeTime, uint32_t milliseconds);
+
+
+
+
+
+
+
+
+
+
+
+extern void OS_SystemTickHandler(void);
@@ -0,0 +1,119 @@
+#include "../../src/app/engine/config/database_cfg.h"
+#include "../../src/app/application/algorithm/state_estimation/sof/trapezoid/sof_cfg.h"
+
+
+typedef struct SOF_CURRENT_LIMITS {
+
+    int32_t continuousChargeCurrent_mA;
+
+    int32_t peakChargeCurrent_mA;
+
+    int32_t continuousDischargeCurrent_mA;
+
+    int32_t peakDischargeCurrent_mA;
+
+} SOF_CURRENT_LIMITS_s;
+
+
+
+
+
+
+
+
+
+
+
+typedef struct SOF_SCALED_CURVE {
+
+    uint8_t nrOfBreakpoints;
+
+    int16_t input[(8u)];
+
+    int32_t current_mA[(8u)];
+
+    int32_t slope[(8u) - 1u];
+
+} SOF_SCALED_CURVE_s;
+
+
+
+
+
+
+
+
+
+
+
+typedef struct SOF_CURVE {
+
+    SOF_SCALED_CURVE_s dischargeCurrentOverCellVoltage;
+
+    SOF_SCALED_CURVE_s chargeCurrentOverCellVoltage;
+
+    SOF_SCALED_CURVE_s dischargeCurrentOverTemperature;
+
+    SOF_SCALED_CURVE_s chargeCurrentOverTemperature;
+
+} SOF_CURVE_s;
+
+extern void SOF_Init(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void SOF_Calculation(void);
+
+
+
+
+
+
+
+extern void TEST_SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CURVE_s *pCalculatedSofCurves);
+
+extern int32_t TEST_SOF_EvaluateCurve(const SOF_SCALED_CURVE_s *pCurve, int16_t input);
+
+extern void TEST_SOF_CalculateVoltageBasedCurrentLimit(
+
+    int16_t minimumCellVoltage_mV,
+
+    int16_t maximumCellVoltage_mV,
+
+    SOF_CURRENT_LIMITS_s *pAllowedVoltageBasedCurrent,
+
+    const SOF_CURVE_s *pCalculatedSofCurves);
+
+extern void TEST_SOF_CalculateTemperatureBasedCurrentLimit(
+
+    int16_t minimumCellTemperature_ddegC,
+
+    int16_t maximumCellTemperature_ddegC,
+
+    SOF_CURRENT_LIMITS_s *pAllowedTemperatureBasedCurrent,
+
+    const SOF_CURVE_s *pCalculatedSofCurves);
+
+extern SOF_CURRENT_LIMITS_s TEST_SOF_MinimumOfTwoSofValues(
+
+    SOF_CURRENT_LIMITS_s voltageBasedLimits,
+
+    SOF_CURRENT_LIMITS_s temperatureBasedLimits);
+
+extern 
+
+      _Bool 
+
+           TEST_SOF_UpdateStringInputs(uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s *pMinimumMaximumValues);
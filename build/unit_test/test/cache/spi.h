@@ -0,0 +1,104 @@
+#include "../../src/app/driver/config/spi_cfg.h"
+extern STD_RETURN_TYPE_e SPI_TransmitDummyByte(SPI_INTERFACE_CONFIG_s *pSpiInterface, uint32_t delay);
+
+extern STD_RETURN_TYPE_e SPI_TransmitDataWithDummy(
+
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+
+    uint32_t delay,
+
+    uint32_t wakeUpValidity_us,
+
+    uint16_t *pTxBuff,
+
+    uint32_t frameLength);
+
+extern STD_RETURN_TYPE_e SPI_TransmitData(
+
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+
+    uint16_t *pTxBuff,
+
+    uint32_t frameLength);
+
+extern STD_RETURN_TYPE_e SPI_TransmitReceiveData(
+
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+
+    uint16 *pTxBuff,
+
+    uint16 *pRxBuff,
+
+    uint32 frameLength);
+
+extern STD_RETURN_TYPE_e SPI_DirectlyTransmitReceiveData(
+
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+
+    uint16 *pTxBuff,
+
+    uint16 *pRxBuff,
+
+    uint32 frameLength);
+
+extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma(
+
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+
+    uint16_t *pTxBuff,
+
+    uint16_t *pRxBuff,
+
+    uint32_t frameLength);
+
+extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataWithDummyDma(
+
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+
+    uint32_t delay,
+
+    uint32_t wakeUpValidity_us,
+
+    uint16_t *pTxBuff,
+
+    uint16_t *pRxBuff,
+
+    uint32_t frameLength);
+
+extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaLocked(
+
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+
+    uint16_t *pTxBuff,
+
+    uint16_t *pRxBuff,
+
+    uint32_t frameLength);
+
+extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaFromIsr(
+
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+
+    uint16_t *pTxBuff,
+
+    uint16_t *pRxBuff,
+
+    uint32_t frameLength);
+
+extern STD_RETURN_TYPE_e SPI_Lock(uint8_t spi);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void SPI_Unlock(uint8_t spi);
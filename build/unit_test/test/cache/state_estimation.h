@@ -0,0 +1,68 @@
+#include "../../src/app/main/include/general.h"
+extern void SOC_Init(
+
+                    _Bool 
+
+                         cc_present, uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+extern void SOC_Calculation(void);
+
+extern float SOC_GetFromVoltage(int16_t voltage_mV);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void SOE_Init(
+
+                    _Bool 
+
+                         ec_present, uint8_t stringNumber);
+
+
+
+
+
+
+
+
+
+extern void SOE_Calculation(void);
+
+
+
+
+
+
+
+
+
+extern void SOH_Init(void);
+
+
+
+
+
+
+
+
+
+extern void SOH_Calculation(void);
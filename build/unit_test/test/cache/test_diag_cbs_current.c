@@ -0,0 +1,326 @@
+#include "../../src/app/engine/diag/cbs/diag_cbs_current.c"
+#include "../../tests/unit/support/test_assert_helper.h"
+#include "../../src/app/engine/diag/cbs/diag_cbs.h"
+#include "Mockdiag_cfg.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+static DATA_BLOCK_ERRORSTATE_s test_tableErrorFlags = {.header.uniqueId = DATA_BLOCK_ID_ERRORSTATE};
+
+
+
+
+
+static DATA_BLOCK_MOL_FLAG_s test_tableMolFlags = {.header.uniqueId = DATA_BLOCK_ID_MOL_FLAG};
+
+
+
+
+
+static DATA_BLOCK_RSL_FLAG_s test_tableRslFlags = {.header.uniqueId = DATA_BLOCK_ID_RSL_FLAG};
+
+
+
+
+
+static DATA_BLOCK_MSL_FLAG_s test_tableMslFlags = {.header.uniqueId = DATA_BLOCK_ID_MSL_FLAG};
+
+
+
+const DIAG_DATABASE_SHIM_s diag_kpkDatabaseShim = {
+
+    .pTableError = &test_tableErrorFlags,
+
+    .pTableMol = &test_tableMolFlags,
+
+    .pTableRsl = &test_tableRslFlags,
+
+    .pTableMsl = &test_tableMslFlags,
+
+};
+
+
+
+
+
+void setUp(void) {
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+
+
+void testDIAG_ErrorOvercurrentChargeInvalidInput(void) {
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorOvercurrentCharge(DIAG_ID_MAX, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(93)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorOvercurrentCharge(DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL, 42, &diag_kpkDatabaseShim, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(94)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                        ;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorOvercurrentCharge(DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL, DIAG_EVENT_OK, ((void *)(0)), 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(96)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                      ;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorOvercurrentCharge( DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL, DIAG_EVENT_OK, &diag_kpkDatabaseShim, (3u)); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(98)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                     ;
+
+}
+
+
+
+
+
+void testDIAG_ErrorOvercurrentDischargeInvalidInput(void) {
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorOvercurrentDischarge(DIAG_ID_MAX, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(104)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorOvercurrentDischarge(DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL, 42, &diag_kpkDatabaseShim, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(105)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                              ;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorOvercurrentDischarge(DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL, DIAG_EVENT_OK, ((void *)(0)), 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(107)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                            ;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorOvercurrentDischarge( DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL, DIAG_EVENT_OK, &diag_kpkDatabaseShim, (3u)); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(109)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                        ;
+
+}
+
+
+
+
+
+void testDIAG_ErrorCurrentMeasurementInvalidInput(void) {
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorCurrentMeasurement(DIAG_ID_MAX, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(115)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorCurrentMeasurement(DIAG_ID_CURRENT_MEASUREMENT_TIMEOUT, 42, &diag_kpkDatabaseShim, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(116)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                         ;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorCurrentMeasurement(DIAG_ID_CURRENT_MEASUREMENT_TIMEOUT, DIAG_EVENT_OK, ((void *)(0)), 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(118)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                       ;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorCurrentMeasurement( DIAG_ID_CURRENT_MEASUREMENT_TIMEOUT, DIAG_EVENT_OK, &diag_kpkDatabaseShim, (3u)); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(120)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                     ;
+
+}
+
+
+
+
+
+void testDIAG_ErrorCurrentOnOpenStringInvalidInput(void) {
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorCurrentOnOpenString(DIAG_ID_MAX, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(126)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_MEASUREMENT_TIMEOUT, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(127)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                                     ;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, 42, &diag_kpkDatabaseShim, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(129)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                     ;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_OK, ((void *)(0)), 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(131)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                   ;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { DIAG_ErrorCurrentOnOpenString( DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_OK, &diag_kpkDatabaseShim, (3u)); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(133)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} }
+
+                                                                                                ;
+
+}
+
+
+
+
+
+void testDIAG_ErrorCurrentOnOpenString(void) {
+
+    DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_NOT_OK, &diag_kpkDatabaseShim, 1u);
+
+    UnityAssertEqualNumber((UNITY_INT)((1u)), (UNITY_INT)((test_tableErrorFlags.currentOnOpenString[1u])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(140), UNITY_DISPLAY_STYLE_INT);
+
+    DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 1u);
+
+    UnityAssertEqualNumber((UNITY_INT)((1u)), (UNITY_INT)((test_tableErrorFlags.currentOnOpenString[1u])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(142), UNITY_DISPLAY_STYLE_INT);
+
+    DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_RESET, &diag_kpkDatabaseShim, 1u);
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((test_tableErrorFlags.currentOnOpenString[1u])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(144), UNITY_DISPLAY_STYLE_INT);
+
+}
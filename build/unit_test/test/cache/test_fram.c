@@ -0,0 +1,396 @@
+#include "../../src/app/driver/fram/fram.h"
+#include "../../src/app/main/include/fassert.h"
+#include "../../src/app/driver/config/spi_cfg.h"
+#include "../../src/app/driver/config/fram_cfg.h"
+#include "test/mocks/Mockspi.h"
+#include "test/mocks/Mockos.h"
+#include "test/mocks/Mockmcu.h"
+#include "test/mocks/Mockio.h"
+#include "test/mocks/Mockfram_journal.h"
+#include "test/mocks/MockHL_spi.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+void setUp(void) {
+
+    OS_EnterTaskCritical_CMockIgnore();
+
+    OS_ExitTaskCritical_CMockIgnore();
+
+    IO_PinSet_CMockIgnore();
+
+    IO_PinReset_CMockIgnore();
+
+    MCU_delay_us_CMockIgnore();
+
+    SPI_DirectlyTransmitReceiveData_CMockIgnoreAndReturn(78, STD_OK);
+
+    SPI_Unlock_CMockIgnore();
+
+
+
+    fram_soc = (FRAM_SOC_s){0};
+
+    FRAM_JOURNAL_Initialize_CMockExpectAndReturn(82, 0u);
+
+    SPI_Lock_CMockExpectAndReturn(83, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_Scan_CMockIgnore();
+
+    FRAM_Initialize();
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+
+
+
+
+void testRequestWriteCoalescesRequests(void) {
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+
+    do {if ((FRAM_IsWritePending(FRAM_BLOCK_ID_SOC))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(97)));}} while(0);
+
+
+
+    SPI_Lock_CMockExpectAndReturn(99, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(100, 
+
+   0
+
+   );
+
+    FRAM_JOURNAL_EncodeRecord_CMockExpectAndReturn(101, FRAM_BLOCK_ID_SOC, ((void *)(0)), ((void *)(0)), ((void *)(0)), 20u);
+
+    FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pData(102);
+
+    FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pRecord(103);
+
+    FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pAddress(104);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockExpectAndReturn(105, &spi_framInterface, ((void *)(0)), ((void *)(0)), 4u + 20u, STD_OK);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pTxBuff(106);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pRxBuff(107);
+
+    FRAM_JOURNAL_CommitRecord_CMockExpect(108, FRAM_BLOCK_ID_SOC);
+
+    FRAM_ProcessWriteRequests();
+
+    do {if (!(FRAM_IsWritePending(FRAM_BLOCK_ID_SOC))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(110)));}} while(0);
+
+
+
+
+
+    SPI_Lock_CMockExpectAndReturn(113, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(114, 
+
+   0
+
+   );
+
+    FRAM_ProcessWriteRequests();
+
+}
+
+
+
+
+
+void testProcessWriteRequestsSkipsUnchangedData(void) {
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+
+    SPI_Lock_CMockExpectAndReturn(121, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(122, 
+
+   0
+
+   );
+
+    FRAM_JOURNAL_EncodeRecord_CMockIgnoreAndReturn(123, 20u);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreAndReturn(124, STD_OK);
+
+    FRAM_JOURNAL_CommitRecord_CMockExpect(125, FRAM_BLOCK_ID_SOC);
+
+    FRAM_ProcessWriteRequests();
+
+
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+
+    SPI_Lock_CMockExpectAndReturn(129, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(130, 
+
+   1
+
+   );
+
+    FRAM_JOURNAL_EncodeIndex_CMockIgnoreAndReturn(131, 31u);
+
+    FRAM_JOURNAL_CommitIndex_CMockExpect(132);
+
+    FRAM_ProcessWriteRequests();
+
+    do {if ((FRAM_IsWritePending(FRAM_BLOCK_ID_SOC))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(134)));}} while(0);
+
+
+
+    SPI_Lock_CMockExpectAndReturn(136, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(137, 
+
+   0
+
+   );
+
+    FRAM_ProcessWriteRequests();
+
+    do {if (!(FRAM_IsWritePending(FRAM_BLOCK_ID_SOC))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(139)));}} while(0);
+
+}
+
+
+
+
+
+
+
+void testProcessWriteRequestsHoldsLockUntilTransferIsStarted(void) {
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+
+    SPI_Unlock_CMockStopIgnore();
+
+    SPI_Lock_CMockExpectAndReturn(147, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(148, 
+
+   0
+
+   );
+
+    FRAM_JOURNAL_EncodeRecord_CMockIgnoreAndReturn(149, 20u);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreAndReturn(150, STD_OK);
+
+    FRAM_JOURNAL_CommitRecord_CMockExpect(151, FRAM_BLOCK_ID_SOC);
+
+    FRAM_ProcessWriteRequests();
+
+    do {if (!(FRAM_IsWritePending(FRAM_BLOCK_ID_SOC))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(153)));}} while(0);
+
+}
+
+
+
+
+
+
+
+void testProcessWriteRequestsRetriesFailedTransfer(void) {
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOE);
+
+    SPI_Unlock_CMockStopIgnore();
+
+    SPI_Lock_CMockExpectAndReturn(161, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(162, 
+
+   0
+
+   );
+
+    FRAM_JOURNAL_EncodeRecord_CMockIgnoreAndReturn(163, 20u);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockExpectAndReturn(164, &spi_framInterface, ((void *)(0)), ((void *)(0)), 4u + 20u, STD_NOT_OK);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pTxBuff(165);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pRxBuff(166);
+
+    SPI_Unlock_CMockExpect(167, SPI_Interface3);
+
+    FRAM_ProcessWriteRequests();
+
+    do {if ((FRAM_IsWritePending(FRAM_BLOCK_ID_SOE))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(169)));}} while(0);
+
+
+
+    SPI_Lock_CMockExpectAndReturn(171, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(172, 
+
+   0
+
+   );
+
+    SPI_TransmitReceiveDataDmaLocked_CMockExpectAndReturn(173, &spi_framInterface, ((void *)(0)), ((void *)(0)), 4u + 20u, STD_OK);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pTxBuff(174);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pRxBuff(175);
+
+    FRAM_JOURNAL_CommitRecord_CMockExpect(176, FRAM_BLOCK_ID_SOE);
+
+    FRAM_ProcessWriteRequests();
+
+    do {if (!(FRAM_IsWritePending(FRAM_BLOCK_ID_SOE))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(178)));}} while(0);
+
+}
+
+
+
+
+
+void testProcessWriteRequestsDoesNotCommitIndexOfFailedTransfer(void) {
+
+    SPI_Unlock_CMockStopIgnore();
+
+    SPI_Lock_CMockExpectAndReturn(184, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(185, 
+
+   1
+
+   );
+
+    FRAM_JOURNAL_EncodeIndex_CMockIgnoreAndReturn(186, 31u);
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreAndReturn(187, STD_NOT_OK);
+
+    SPI_Unlock_CMockExpect(188, SPI_Interface3);
+
+    FRAM_ProcessWriteRequests();
+
+
+
+    SPI_Lock_CMockExpectAndReturn(191, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(192, 
+
+   1
+
+   );
+
+    SPI_TransmitReceiveDataDmaLocked_CMockIgnoreAndReturn(193, STD_OK);
+
+    FRAM_JOURNAL_CommitIndex_CMockExpect(194);
+
+    FRAM_ProcessWriteRequests();
+
+}
+
+
+
+
+
+void testProcessWriteRequestsWaitsForInterface(void) {
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOE);
+
+
+
+    SPI_Lock_CMockExpectAndReturn(202, SPI_Interface3, STD_NOT_OK);
+
+    FRAM_ProcessWriteRequests();
+
+    do {if ((FRAM_IsWritePending(FRAM_BLOCK_ID_SOE))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(204)));}} while(0);
+
+
+
+    SPI_Lock_CMockExpectAndReturn(206, SPI_Interface3, STD_NOT_OK);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((FRAM_Flush())), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(207), UNITY_DISPLAY_STYLE_INT);
+
+    do {if ((FRAM_IsWritePending(FRAM_BLOCK_ID_SOE))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(208)));}} while(0);
+
+
+
+    SPI_Lock_CMockExpectAndReturn(210, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_EncodeRecord_CMockIgnoreAndReturn(211, 20u);
+
+    FRAM_JOURNAL_CommitRecord_CMockExpect(212, FRAM_BLOCK_ID_SOE);
+
+    FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(213, 
+
+   0
+
+   );
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((FRAM_Flush())), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(214), UNITY_DISPLAY_STYLE_INT);
+
+    do {if (!(FRAM_IsWritePending(FRAM_BLOCK_ID_SOE))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(215)));}} while(0);
+
+}
+
+
+
+
+
+void testReadWithoutRecordKeepsDefault(void) {
+
+    fram_soc.averageSoc_perc[0] = 50.0f;
+
+    SPI_Lock_CMockExpectAndReturn(221, SPI_Interface3, STD_OK);
+
+    FRAM_JOURNAL_ReadLatest_CMockExpectAndReturn(222, FRAM_BLOCK_ID_SOC, ((void *)(0)), (uint8_t *)&fram_soc, STD_NOT_OK);
+
+    FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_readFunction(223);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((FRAM_Read(FRAM_BLOCK_ID_SOC))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(224), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((50.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((50.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((fram_soc.averageSoc_perc[0]))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(225)));
+
+}
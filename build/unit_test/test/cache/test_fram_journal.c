@@ -0,0 +1,673 @@
+#include "../../tests/unit/support/test_assert_helper.h"
+#include "../../src/app/driver/fram/fram_journal.h"
+#include "../../src/app/driver/config/fram_cfg.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static FILE *testFram_file = 
+
+                            ((void *)0)
+
+                                ;
+
+
+
+
+
+static uint32_t testFram_bytesRead = 0u;
+
+
+
+
+
+static uint32_t testFram_writeBudget = 
+
+                                      (4294967295U)
+
+                                                ;
+
+
+
+
+
+static uint32_t testFram_random = 0x12345678u;
+
+
+
+static uint32_t TEST_FramNextRandom(void) {
+
+
+
+    testFram_random ^= testFram_random << 13u;
+
+    testFram_random ^= testFram_random >> 17u;
+
+    testFram_random ^= testFram_random << 5u;
+
+    return testFram_random;
+
+}
+
+
+
+static void TEST_FramFileRead(uint32_t address, uint8_t *pData, uint16_t size) {
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((fseek(testFram_file, (long)address, 
+
+   0
+
+   ))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(94), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((size)), (UNITY_INT)((fread(pData, 1u, size, testFram_file))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(95), UNITY_DISPLAY_STYLE_INT);
+
+    testFram_bytesRead += size;
+
+}
+
+
+
+static 
+
+      _Bool 
+
+           TEST_FramFileWrite(uint32_t address, const uint8_t *pData, uint16_t size) {
+
+    const uint32_t written = (size < testFram_writeBudget) ? size : testFram_writeBudget;
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((fseek(testFram_file, (long)address, 
+
+   0
+
+   ))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(101), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((written)), (UNITY_INT)((fwrite(pData, 1u, written, testFram_file))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(102), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((fflush(testFram_file))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(103), UNITY_DISPLAY_STYLE_INT);
+
+    testFram_writeBudget -= written;
+
+    return (written == size);
+
+}
+
+
+
+
+
+static 
+
+      _Bool 
+
+           TEST_FramWriteBlock(FRAM_BLOCK_ID_e blockId, const void *pData) {
+
+    uint8_t buffer[(192u)] = {0};
+
+    uint32_t address = 0u;
+
+
+
+    uint16_t length = FRAM_JOURNAL_EncodeRecord(blockId, (const uint8_t *)pData, buffer, &address);
+
+    
+
+   _Bool 
+
+        isComplete = TEST_FramFileWrite(address, buffer, length);
+
+    if (isComplete == 
+
+                     1
+
+                         ) {
+
+        FRAM_JOURNAL_CommitRecord(blockId);
+
+        if (FRAM_JOURNAL_IsIndexUpdateDue() == 
+
+                                              1
+
+                                                  ) {
+
+            length = FRAM_JOURNAL_EncodeIndex(buffer, &address);
+
+            isComplete = TEST_FramFileWrite(address, buffer, length);
+
+            if (isComplete == 
+
+                             1
+
+                                 ) {
+
+                FRAM_JOURNAL_CommitIndex();
+
+            }
+
+        }
+
+    }
+
+    return isComplete;
+
+}
+
+
+
+
+
+static uint32_t TEST_FramRestart(void) {
+
+    testFram_writeBudget = 
+
+                          (4294967295U)
+
+                                    ;
+
+    (void)FRAM_JOURNAL_Initialize();
+
+    testFram_bytesRead = 0u;
+
+    FRAM_JOURNAL_Scan(&TEST_FramFileRead);
+
+    return testFram_bytesRead;
+
+}
+
+
+
+static void TEST_FramOverwrite(uint32_t address, uint8_t value, uint32_t size) {
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((fseek(testFram_file, (long)address, 
+
+   0
+
+   ))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(138), UNITY_DISPLAY_STYLE_INT);
+
+    for (uint32_t i = 0u; i < size; i++) {
+
+        UnityAssertEqualNumber((UNITY_INT)((value)), (UNITY_INT)((fputc(value, testFram_file))), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(140), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((fflush(testFram_file))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(142), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+
+
+void setUp(void) {
+
+    testFram_file = tmpfile();
+
+    do {if ((((testFram_file)) != 
+
+   ((void *)0)
+
+   )) {} else {UnityFail( (((" Expected Non-NULL"))), (UNITY_UINT)((UNITY_UINT)((UNITY_UINT)(148))));}} while(0);
+
+
+
+    TEST_FramOverwrite(0u, 0u, FRAM_JOURNAL_Initialize());
+
+    testFram_random = 0x12345678u;
+
+    (void)TEST_FramRestart();
+
+}
+
+
+
+void tearDown(void) {
+
+    (void)fclose(testFram_file);
+
+    testFram_file = 
+
+                   ((void *)0)
+
+                       ;
+
+}
+
+
+
+
+
+
+
+void testCrcOfCheckSequence(void) {
+
+
+
+    const uint8_t sequence[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((0x29B1u)), (UNITY_INT)(UNITY_INT16)((TEST_FRAM_JOURNAL_CalculateCrc(sequence, 9u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(165), UNITY_DISPLAY_STYLE_HEX16);
+
+}
+
+
+
+void testEmptyFramHasNoRecords(void) {
+
+    FRAM_SOC_s soc = {.averageSoc_perc = {42.0f}};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(170), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((42.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((42.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((soc.averageSoc_perc[0]))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(171)));
+
+    do {if ((FRAM_JOURNAL_IsIndexUpdateDue())) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(172)));}} while(0);
+
+}
+
+
+
+void testNewestRecordIsFoundAfterRestart(void) {
+
+    FRAM_SOC_s soc = {0};
+
+    for (uint16_t i = 1u; i <= 20u; i++) {
+
+        soc.averageSoc_perc[0] = (float)i;
+
+        do {if ((TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(179)));}} while(0);
+
+    }
+
+
+
+    (void)TEST_FramRestart();
+
+    soc = (FRAM_SOC_s){0};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(184), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((20.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((20.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((soc.averageSoc_perc[0]))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(185)));
+
+
+
+
+
+    soc.averageSoc_perc[0] = 21.0f;
+
+    do {if ((TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(189)));}} while(0);
+
+    (void)TEST_FramRestart();
+
+    soc = (FRAM_SOC_s){0};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(192), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((21.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((21.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((soc.averageSoc_perc[0]))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(193)));
+
+
+
+
+
+    FRAM_SOE_s soe = {0};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOE, &TEST_FramFileRead, (uint8_t *)&soe))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(197), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testFailedWriteIsNotCommitted(void) {
+
+    uint8_t buffer[(192u)] = {0};
+
+    uint32_t failedAddress = 0u;
+
+    uint32_t address = 0u;
+
+    FRAM_SOC_s soc = {.averageSoc_perc = {1.0f}};
+
+    do {if ((TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(205)));}} while(0);
+
+
+
+
+
+
+
+    soc.averageSoc_perc[0] = 2.0f;
+
+    (void)FRAM_JOURNAL_EncodeRecord(FRAM_BLOCK_ID_SOC, (const uint8_t *)&soc, buffer, &failedAddress);
+
+    (void)TEST_FramRestart();
+
+    soc = (FRAM_SOC_s){0};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(213), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((1.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((1.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((soc.averageSoc_perc[0]))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(214)));
+
+
+
+
+
+    soc.averageSoc_perc[0] = 3.0f;
+
+    (void)FRAM_JOURNAL_EncodeRecord(FRAM_BLOCK_ID_SOC, (const uint8_t *)&soc, buffer, &address);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT32)((failedAddress)), (UNITY_INT)(UNITY_UINT32)((address)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(219), UNITY_DISPLAY_STYLE_UINT32);
+
+    do {if ((TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(220)));}} while(0);
+
+    (void)TEST_FramRestart();
+
+    soc = (FRAM_SOC_s){0};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(223), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((3.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((3.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((soc.averageSoc_perc[0]))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(224)));
+
+}
+
+
+
+void testIndexAvoidsReadingAllSlots(void) {
+
+    FRAM_SOC_s soc = {0};
+
+    FRAM_SOE_s soe = {0};
+
+    for (uint16_t i = 1u; i <= 30u; i++) {
+
+        soc.averageSoc_perc[0] = (float)i;
+
+        soe.averageSoe_perc[0] = (float)i;
+
+        do {if ((TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(233)));}} while(0);
+
+        do {if ((TEST_FramWriteBlock(FRAM_BLOCK_ID_SOE, &soe))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(234)));}} while(0);
+
+    }
+
+
+
+    (void)TEST_FramRestart();
+
+    do {if ((TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(238)));}} while(0);
+
+    const uint32_t bytesReadWithIndex = TEST_FramRestart();
+
+
+
+
+
+    TEST_FramOverwrite(0u, 0xFFu, 2u * (4u + (5u * (uint16_t)FRAM_BLOCK_MAX) + (2u)));
+
+    const uint32_t bytesReadWithoutIndex = TEST_FramRestart();
+
+    UnityAssertGreaterOrLessOrEqualNumber((UNITY_INT)(UNITY_UINT32)((bytesReadWithoutIndex / 2u)), (UNITY_INT)(UNITY_UINT32)((bytesReadWithIndex)), UNITY_SMALLER_THAN, (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(244), UNITY_DISPLAY_STYLE_UINT32);
+
+
+
+    soc = (FRAM_SOC_s){0};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(247), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((30.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((30.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((soc.averageSoc_perc[0]))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(248)));
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOE, &TEST_FramFileRead, (uint8_t *)&soe))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(249), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((30.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((30.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((soe.averageSoe_perc[0]))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(250)));
+
+}
+
+
+
+void testPowerCutsNeverLoseTheLastCompleteRecord(void) {
+
+    float lastValue[FRAM_BLOCK_MAX] = {0.0f};
+
+    
+
+   _Bool 
+
+        isStored[FRAM_BLOCK_MAX] = {
+
+                                      0
+
+                                           };
+
+    FRAM_SOC_s data = {0};
+
+    const uint16_t recordLength = (8u) + sizeof(FRAM_SOC_s) + (2u);
+
+
+
+    for (uint32_t cut = 0u; cut < (2000u); cut++) {
+
+
+
+        const FRAM_BLOCK_ID_e blockId = ((TEST_FramNextRandom() & 1u) == 0u) ? FRAM_BLOCK_ID_SOC : FRAM_BLOCK_ID_SOE;
+
+        const uint32_t writes = TEST_FramNextRandom() % 6u;
+
+
+
+
+
+
+
+        for (uint32_t i = 0u; i <= writes; i++) {
+
+            const float value = (float)((cut * 8u) + i + 1u);
+
+            data.averageSoc_perc[0] = value;
+
+            data.minimumSoc_perc[1] = -value;
+
+            if (i == writes) {
+
+                testFram_writeBudget = TEST_FramNextRandom() % (recordLength + (4u + (5u * (uint16_t)FRAM_BLOCK_MAX) + (2u)));
+
+            }
+
+            const 
+
+                 _Bool 
+
+                      isRecordComplete = (testFram_writeBudget >= recordLength);
+
+            (void)TEST_FramWriteBlock(blockId, &data);
+
+            if (isRecordComplete == 
+
+                                   1
+
+                                       ) {
+
+                lastValue[blockId] = value;
+
+                isStored[blockId] = 
+
+                                    1
+
+                                        ;
+
+            }
+
+        }
+
+
+
+        (void)TEST_FramRestart();
+
+        for (uint8_t b = 0u; b < (uint8_t)FRAM_BLOCK_MAX; b++) {
+
+            if ((b == (uint8_t)FRAM_BLOCK_ID_SOC) || (b == (uint8_t)FRAM_BLOCK_ID_SOE)) {
+
+                data = (FRAM_SOC_s){0};
+
+                if (isStored[b] == 
+
+                                  1
+
+                                      ) {
+
+                    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest((FRAM_BLOCK_ID_e)b, &TEST_FramFileRead, (uint8_t *)&data))), (
+
+                   ((void *)0)
+
+                   ), (UNITY_UINT)(286), UNITY_DISPLAY_STYLE_INT)
+
+                                                                                                                  ;
+
+                    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((lastValue[b])) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((lastValue[b]))), (UNITY_FLOAT)((UNITY_FLOAT)((data.averageSoc_perc[0]))), ((
+
+                   ((void *)0)
+
+                   )), (UNITY_UINT)((UNITY_UINT)(288)));
+
+                    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((-lastValue[b])) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((-lastValue[b]))), (UNITY_FLOAT)((UNITY_FLOAT)((data.minimumSoc_perc[1]))), ((
+
+                   ((void *)0)
+
+                   )), (UNITY_UINT)((UNITY_UINT)(289)));
+
+                } else {
+
+                    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((FRAM_JOURNAL_ReadLatest((FRAM_BLOCK_ID_e)b, &TEST_FramFileRead, (uint8_t *)&data))), (
+
+                   ((void *)0)
+
+                   ), (UNITY_UINT)(291), UNITY_DISPLAY_STYLE_INT)
+
+                                                                                                                      ;
+
+                }
+
+            }
+
+        }
+
+    }
+
+}
@@ -0,0 +1,166 @@
+#include "../../src/app/driver/mic/ltc/6806/ltc_6806.c"
+#include "../../src/app/driver/mic/ltc/common/ltc.h"
+#include "../../src/app/driver/foxmath/cell_statistics.h"
+#include "../../src/app/driver/mic/ltc/6806/config/ltc_6806_cfg.h"
+#include "test/mocks/Mockspi.h"
+#include "test/mocks/Mockos.h"
+#include "test/mocks/Mockmic_plausibility.h"
+#include "test/mocks/Mockltc_pec.h"
+#include "test/mocks/Mockltc_mic_dma.h"
+#include "test/mocks/Mockio.h"
+#include "test/mocks/Mockfassert.h"
+#include "test/mocks/Mockdma.h"
+#include "test/mocks/Mockdiag.h"
+#include "test/mocks/Mockdatabase.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static const spiDAT1_t spi_kLtcDataConfig = {
+
+
+
+    .CS_HOLD = (
+
+              0
+
+              ),
+
+    .WDEL = (
+
+              1
+
+              ),
+
+    .DFSEL = SPI_FMT_0,
+
+    .CSNR = 0x0,
+
+};
+
+
+
+
+
+SPI_INTERFACE_CONFIG_s spi_ltcInterface[(3u)] = {
+
+    {
+
+        .channel = SPI_Interface1,
+
+        .pConfig = &spi_kLtcDataConfig,
+
+        .pNode = (&sil_spiRegisters[0u]),
+
+        .pGioPort = &((&sil_spiRegisters[0u])->PC3),
+
+        .csPin = 2u,
+
+    },
+
+    {
+
+        .channel = SPI_Interface1,
+
+        .pConfig = &spi_kLtcDataConfig,
+
+        .pNode = (&sil_spiRegisters[0u]),
+
+        .pGioPort = &((&sil_spiRegisters[0u])->PC3),
+
+        .csPin = 2u,
+
+    },
+
+    {
+
+        .channel = SPI_Interface1,
+
+        .pConfig = &spi_kLtcDataConfig,
+
+        .pNode = (&sil_spiRegisters[0u]),
+
+        .pGioPort = &((&sil_spiRegisters[0u])->PC3),
+
+        .csPin = 2u,
+
+    },
+
+};
+
+
+
+SPI_INTERFACE_CONFIG_s spi_ltcInterfaceSecondary[(3u)] = {
+
+    {
+
+        .channel = SPI_Interface1,
+
+        .pConfig = &spi_kLtcDataConfig,
+
+        .pNode = (&sil_spiRegisters[0u]),
+
+        .pGioPort = &((&sil_spiRegisters[0u])->PC3),
+
+        .csPin = 2u,
+
+    },
+
+};
+
+
+
+
+
+void setUp(void) {
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+void testLTC_SetFirstMeasurementCycleFinished(void) {
+
+    OS_EnterTaskCritical_CMockExpect(128);
+
+    OS_ExitTaskCritical_CMockExpect(129);
+
+    static LTC_STATE_s test_ltc_state = {0};
+
+    test_ltc_state.first_measurement_made = 
+
+                                           0
+
+                                                ;
+
+    TEST_LTC_SetFirstMeasurementCycleFinished(&test_ltc_state);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((
+
+   1
+
+   )), (UNITY_INT)(UNITY_UINT8 )((test_ltc_state.first_measurement_made)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(133), UNITY_DISPLAY_STYLE_UINT8);
+
+}
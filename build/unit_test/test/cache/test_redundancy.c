@@ -0,0 +1,623 @@
+#include "../../tests/unit/support/test_assert_helper.h"
+#include "../../src/app/application/redundancy/redundancy.h"
+#include "../../src/app/driver/foxmath/foxmath.h"
+#include "../../src/app/driver/foxmath/cell_statistics.h"
+#include "test/mocks/Mockplausibility.h"
+#include "test/mocks/Mockos.h"
+#include "test/mocks/Mockdiag.h"
+#include "test/mocks/Mockdatabase.h"
+#include "test/mocks/Mockbms.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+DATA_BLOCK_CELL_VOLTAGE_s testCellvoltageBase = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+
+DATA_BLOCK_CELL_VOLTAGE_s testCellvoltageRedundancy0 = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0};
+
+
+
+DATA_BLOCK_CELL_TEMPERATURE_s testCelltemperatureBase = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE_BASE};
+
+DATA_BLOCK_CELL_TEMPERATURE_s testCelltemperatureRedundancy0 = {
+
+    .header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE_REDUNDANCY0};
+
+
+
+static inline void injectDatabaseEntries(void) {
+
+    DATA_Read_4_DataBlocks_CMockExpectAndReturn(77, &testCellvoltageBase, &testCellvoltageRedundancy0, &testCelltemperatureBase, &testCelltemperatureRedundancy0, STD_OK)
+
+
+
+
+
+
+
+
+
+               ;
+
+    DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver0(83);
+
+    DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver1(84);
+
+    DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver2(85);
+
+    DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver3(86);
+
+    DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(87, &testCellvoltageBase, sizeof(void));
+
+    DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(88, &testCellvoltageRedundancy0, sizeof(void));
+
+    DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(89, &testCelltemperatureBase, sizeof(void));
+
+    DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver3(90, &testCelltemperatureRedundancy0, sizeof(void));
+
+}
+
+
+
+
+
+void setUp(void) {
+
+    testCellvoltageBase.header.timestamp = 0;
+
+    testCellvoltageRedundancy0.header.timestamp = 0;
+
+    testCelltemperatureBase.header.timestamp = 0;
+
+    testCelltemperatureRedundancy0.header.timestamp = 0;
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+
+
+
+
+void testMRC_MeasurementUpdatedAtLeastOnce(void) {
+
+
+
+    uint32_t timestamp = 10u;
+
+    uint32_t previousTimestamp = 0u;
+
+    do {if ((TEST_MRC_MeasurementUpdatedAtLeastOnce(timestamp, previousTimestamp))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(111)));}} while(0);
+
+
+
+
+
+    timestamp = 60u;
+
+    previousTimestamp = 10u;
+
+    do {if ((TEST_MRC_MeasurementUpdatedAtLeastOnce(timestamp, previousTimestamp))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(116)));}} while(0);
+
+
+
+
+
+    timestamp = 70u;
+
+    previousTimestamp = 60u;
+
+    do {if ((TEST_MRC_MeasurementUpdatedAtLeastOnce(timestamp, previousTimestamp))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(121)));}} while(0);
+
+
+
+
+
+    timestamp = 0u;
+
+    previousTimestamp = 0u;
+
+    do {if (!(TEST_MRC_MeasurementUpdatedAtLeastOnce(timestamp, previousTimestamp))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(126)));}} while(0);
+
+}
+
+
+
+void testMRC_MeasurementUpdatedRecently(void) {
+
+
+
+    uint32_t timeDifference = 100u;
+
+
+
+
+
+    uint32_t timestamp = 50u;
+
+    uint32_t previousTimestamp = 0u;
+
+    OS_GetTickCount_CMockExpectAndReturn(136, 100u);
+
+    UnityAssertEqualNumber((UNITY_INT)((TEST_MRC_MeasurementUpdatedRecently(timestamp, previousTimestamp, timeDifference))), (UNITY_INT)((STD_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(137), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    timestamp = 0u;
+
+    OS_GetTickCount_CMockExpectAndReturn(141, 100u);
+
+    UnityAssertEqualNumber((UNITY_INT)((TEST_MRC_MeasurementUpdatedRecently(timestamp, previousTimestamp, timeDifference))), (UNITY_INT)((STD_NOT_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(142), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    timestamp = 0u;
+
+    OS_GetTickCount_CMockExpectAndReturn(146, 101u);
+
+    UnityAssertEqualNumber((UNITY_INT)((TEST_MRC_MeasurementUpdatedRecently(timestamp, previousTimestamp, timeDifference))), (UNITY_INT)((STD_NOT_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(147), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    timestamp = 4937u;
+
+    OS_GetTickCount_CMockExpectAndReturn(151, 5000u);
+
+    UnityAssertEqualNumber((UNITY_INT)((TEST_MRC_MeasurementUpdatedRecently(timestamp, previousTimestamp, timeDifference))), (UNITY_INT)((STD_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(152), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    timestamp = 
+
+               (4294967295U)
+
+                         ;
+
+    OS_GetTickCount_CMockExpectAndReturn(156, 50u);
+
+    UnityAssertEqualNumber((UNITY_INT)((TEST_MRC_MeasurementUpdatedRecently(timestamp, previousTimestamp, timeDifference))), (UNITY_INT)((STD_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(157), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    timestamp = 
+
+               (4294967295U) 
+
+                          - 50u;
+
+    OS_GetTickCount_CMockExpectAndReturn(161, 49u);
+
+    UnityAssertEqualNumber((UNITY_INT)((TEST_MRC_MeasurementUpdatedRecently(timestamp, previousTimestamp, timeDifference))), (UNITY_INT)((STD_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(162), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    timestamp = 
+
+               (4294967295U) 
+
+                          - 50u;
+
+    OS_GetTickCount_CMockExpectAndReturn(166, 50u);
+
+    UnityAssertEqualNumber((UNITY_INT)((TEST_MRC_MeasurementUpdatedRecently(timestamp, previousTimestamp, timeDifference))), (UNITY_INT)((STD_NOT_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(167), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    timestamp = 50u;
+
+    OS_GetTickCount_CMockExpectAndReturn(171, 
+
+   (4294967295U)
+
+   );
+
+    UnityAssertEqualNumber((UNITY_INT)((TEST_MRC_MeasurementUpdatedRecently(timestamp, previousTimestamp, timeDifference))), (UNITY_INT)((STD_NOT_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(172), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testMRC_CalculateCellVoltageMinMaxAverageNullPointer(void) {
+
+    DATA_BLOCK_MIN_MAX_s dummy0 = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_CalculateCellVoltageMinMaxAverage(((void *)(0)), &dummy0); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(177)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    DATA_BLOCK_CELL_VOLTAGE_s dummy1 = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_CalculateCellVoltageMinMaxAverage(&dummy1, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(179)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testMRC_CalculateCellTemperatureMinMaxAverageNullPointer(void) {
+
+    DATA_BLOCK_MIN_MAX_s dummy0 = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_CalculateCellTemperatureMinMaxAverage(((void *)(0)), &dummy0); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(184)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    DATA_BLOCK_CELL_TEMPERATURE_s dummy1 = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_CalculateCellTemperatureMinMaxAverage(&dummy1, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(186)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testMRC_CalculateCellVoltageMinMaxAverage(void) {
+
+    static DATA_BLOCK_CELL_VOLTAGE_s cellVoltages = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+    static DATA_BLOCK_MIN_MAX_s minMaxAverage = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+
+    for (uint8_t s = 0u; s < (3u); s++) {
+
+        for (uint16_t c = 0u; c < ((1u) * (18u)); c++) {
+
+            cellVoltages.cellVoltage_mV[s][c] = 3000;
+
+        }
+
+        for (uint8_t m = 0u; m < (1u); m++) {
+
+            cellVoltages.invalidCellVoltage[s][m] = 0u;
+
+        }
+
+    }
+
+
+
+    cellVoltages.cellVoltage_mV[0][0] = 1000;
+
+    cellVoltages.invalidCellVoltage[0][0] = 0x01u;
+
+    cellVoltages.cellVoltage_mV[0][1] = 2900;
+
+    cellVoltages.cellVoltage_mV[0][2] = 3100;
+
+    cellVoltages.cellVoltage_mV[0][3] = 2900;
+
+    const int32_t sum_mV = (3000 * (((1u) * (18u)) - 4)) + 2900 + 3100 + 2900;
+
+
+
+    for (uint8_t m = 0u; m < (1u); m++) {
+
+        cellVoltages.invalidCellVoltage[(3u) - 1u][m] = 
+
+                                                                   (18446744073709551615UL)
+
+                                                                             ;
+
+    }
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((TEST_MRC_CalculateCellVoltageMinMaxAverage(&cellVoltages, &minMaxAverage))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(212), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((2900)), (UNITY_INT)(UNITY_INT16)((minMaxAverage.minimumCellVoltage_mV[0])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(213), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((1u)), (UNITY_INT)(UNITY_UINT16)((minMaxAverage.nrCellMinimumCellVoltage[0])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(214), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((0u)), (UNITY_INT)(UNITY_UINT16)((minMaxAverage.nrModuleMinimumCellVoltage[0])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(215), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((3100)), (UNITY_INT)(UNITY_INT16)((minMaxAverage.maximumCellVoltage_mV[0])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(216), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((2u)), (UNITY_INT)(UNITY_UINT16)((minMaxAverage.nrCellMaximumCellVoltage[0])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(217), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((sum_mV / (((1u) * (18u)) - 1))), (UNITY_INT)(UNITY_INT16)((minMaxAverage.averageCellVoltage_mV[0])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(218), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((0)), (UNITY_INT)(UNITY_INT16)((minMaxAverage.averageCellVoltage_mV[(3u) - 1u])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(219), UNITY_DISPLAY_STYLE_INT16);
+
+}
+
+
+
+void testMRC_ValidateCellVoltageNullPointer(void) {
+
+    DATA_BLOCK_CELL_VOLTAGE_s dummy = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_ValidateCellVoltage(((void *)(0)), &dummy, &dummy); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(224)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_ValidateCellVoltage(&dummy, ((void *)(0)), &dummy); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(225)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_ValidateCellVoltage(&dummy, &dummy, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(226)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testMRC_UpdateCellVoltageValidationNullPointer(void) {
+
+    DATA_BLOCK_CELL_VOLTAGE_s dummy = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_UpdateCellVoltageValidation(((void *)(0)), &dummy); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(231)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_UpdateCellVoltageValidation(&dummy, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(232)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testMRC_ValidateCellTemperatureNullPointer(void) {
+
+    DATA_BLOCK_CELL_TEMPERATURE_s dummy = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_ValidateCellTemperature(((void *)(0)), &dummy, &dummy); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(237)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_ValidateCellTemperature(&dummy, ((void *)(0)), &dummy); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(238)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_ValidateCellTemperature(&dummy, &dummy, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(239)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testMRC_UpdateCellTemperatureValidationNullPointer(void) {
+
+    DATA_BLOCK_CELL_TEMPERATURE_s dummy = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_UpdateCellTemperatureValidation(((void *)(0)), &dummy); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(244)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_MRC_UpdateCellTemperatureValidation(&dummy, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(245)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+
+
+void testMRC_MicMeasurementValidationTickZeroNothingToDo(void) {
+
+
+
+    injectDatabaseEntries();
+
+
+
+
+
+    DATA_DatabaseEntryUpdatedRecently_CMockIgnoreAndReturn(254, 
+
+   0
+
+   );
+
+    DATA_DatabaseEntryUpdatedAtLeastOnce_CMockIgnoreAndReturn(255, 
+
+   0
+
+   );
+
+
+
+
+
+    OS_GetTickCount_CMockIgnoreAndReturn(258, 0);
+
+
+
+    DIAG_Handler_CMockIgnoreAndReturn(260, STD_OK);
+
+
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((MRC_ValidateMicMeasurement())), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(262), UNITY_DISPLAY_STYLE_INT); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) { UnityFail( (("Code under test failed an assertion")), (UNITY_UINT)(262)); } };
+
+}
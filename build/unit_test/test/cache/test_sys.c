@@ -0,0 +1,51 @@
+#include "../../src/app/engine/sys/sys.h"
+#include "../../src/app/driver/config/fram_cfg.h"
+#include "Mocksys_cfg.h"
+#include "Mockstate_estimation.h"
+#include "Mocksof.h"
+#include "Mocksbc.h"
+#include "test/mocks/Mockos.h"
+#include "Mockmic.h"
+#include "Mockmeas.h"
+#include "Mockinterlock.h"
+#include "Mockimd.h"
+#include "test/mocks/Mockfram.h"
+#include "test/mocks/Mockfassert.h"
+#include "test/mocks/Mockdiag.h"
+#include "Mockcontactor.h"
+#include "Mockcan.h"
+#include "test/mocks/Mockbms.h"
+#include "Mockbal.h"
+#include "Mockalgorithm.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+SBC_STATE_s sbc_stateMcuSupervisor;
+
+
+
+
+
+void setUp(void) {
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+void testDummy(void) {
+
+}
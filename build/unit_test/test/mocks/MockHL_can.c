@@ -0,0 +1,1337 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "MockHL_can.h"
+
+static const char* CMockString_canGetData = "canGetData";
+static const char* CMockString_canGetID = "canGetID";
+static const char* CMockString_canInit = "canInit";
+static const char* CMockString_canIsTxMessagePending = "canIsTxMessagePending";
+static const char* CMockString_canMessageNotification = "canMessageNotification";
+static const char* CMockString_canTransmit = "canTransmit";
+static const char* CMockString_canUpdateID = "canUpdateID";
+static const char* CMockString_data = "data";
+static const char* CMockString_messageBox = "messageBox";
+static const char* CMockString_msgBoxArbitVal = "msgBoxArbitVal";
+static const char* CMockString_node = "node";
+
+typedef struct _CMOCK_canInit_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_canInit_CALL_INSTANCE;
+
+typedef struct _CMOCK_canTransmit_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32 ReturnVal;
+  int CallOrder;
+  canBASE_t* Expected_node;
+  uint32 Expected_messageBox;
+  const uint8* Expected_data;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_node_Used;
+  canBASE_t* ReturnThruPtr_node_Val;
+  size_t ReturnThruPtr_node_Size;
+  char IgnoreArg_node;
+  char IgnoreArg_messageBox;
+  char IgnoreArg_data;
+
+} CMOCK_canTransmit_CALL_INSTANCE;
+
+typedef struct _CMOCK_canGetData_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32 ReturnVal;
+  int CallOrder;
+  canBASE_t* Expected_node;
+  uint32 Expected_messageBox;
+  uint8* Expected_data;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_node_Used;
+  canBASE_t* ReturnThruPtr_node_Val;
+  size_t ReturnThruPtr_node_Size;
+  char ReturnThruPtr_data_Used;
+  uint8* ReturnThruPtr_data_Val;
+  size_t ReturnThruPtr_data_Size;
+  char IgnoreArg_node;
+  char IgnoreArg_messageBox;
+  char IgnoreArg_data;
+
+} CMOCK_canGetData_CALL_INSTANCE;
+
+typedef struct _CMOCK_canIsTxMessagePending_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32 ReturnVal;
+  int CallOrder;
+  canBASE_t* Expected_node;
+  uint32 Expected_messageBox;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_node_Used;
+  canBASE_t* ReturnThruPtr_node_Val;
+  size_t ReturnThruPtr_node_Size;
+  char IgnoreArg_node;
+  char IgnoreArg_messageBox;
+
+} CMOCK_canIsTxMessagePending_CALL_INSTANCE;
+
+typedef struct _CMOCK_canUpdateID_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  canBASE_t* Expected_node;
+  uint32 Expected_messageBox;
+  uint32 Expected_msgBoxArbitVal;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_node_Used;
+  canBASE_t* ReturnThruPtr_node_Val;
+  size_t ReturnThruPtr_node_Size;
+  char IgnoreArg_node;
+  char IgnoreArg_messageBox;
+  char IgnoreArg_msgBoxArbitVal;
+
+} CMOCK_canUpdateID_CALL_INSTANCE;
+
+typedef struct _CMOCK_canGetID_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32 ReturnVal;
+  int CallOrder;
+  canBASE_t* Expected_node;
+  uint32 Expected_messageBox;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_node_Used;
+  canBASE_t* ReturnThruPtr_node_Val;
+  size_t ReturnThruPtr_node_Size;
+  char IgnoreArg_node;
+  char IgnoreArg_messageBox;
+
+} CMOCK_canGetID_CALL_INSTANCE;
+
+typedef struct _CMOCK_canMessageNotification_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  canBASE_t* Expected_node;
+  uint32 Expected_messageBox;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_node_Used;
+  canBASE_t* ReturnThruPtr_node_Val;
+  size_t ReturnThruPtr_node_Size;
+  char IgnoreArg_node;
+  char IgnoreArg_messageBox;
+
+} CMOCK_canMessageNotification_CALL_INSTANCE;
+
+static struct MockHL_canInstance
+{
+  char canInit_IgnoreBool;
+  char canInit_CallbackBool;
+  CMOCK_canInit_CALLBACK canInit_CallbackFunctionPointer;
+  int canInit_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE canInit_CallInstance;
+  char canTransmit_IgnoreBool;
+  uint32 canTransmit_FinalReturn;
+  char canTransmit_CallbackBool;
+  CMOCK_canTransmit_CALLBACK canTransmit_CallbackFunctionPointer;
+  int canTransmit_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE canTransmit_CallInstance;
+  char canGetData_IgnoreBool;
+  uint32 canGetData_FinalReturn;
+  char canGetData_CallbackBool;
+  CMOCK_canGetData_CALLBACK canGetData_CallbackFunctionPointer;
+  int canGetData_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE canGetData_CallInstance;
+  char canIsTxMessagePending_IgnoreBool;
+  uint32 canIsTxMessagePending_FinalReturn;
+  char canIsTxMessagePending_CallbackBool;
+  CMOCK_canIsTxMessagePending_CALLBACK canIsTxMessagePending_CallbackFunctionPointer;
+  int canIsTxMessagePending_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE canIsTxMessagePending_CallInstance;
+  char canUpdateID_IgnoreBool;
+  char canUpdateID_CallbackBool;
+  CMOCK_canUpdateID_CALLBACK canUpdateID_CallbackFunctionPointer;
+  int canUpdateID_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE canUpdateID_CallInstance;
+  char canGetID_IgnoreBool;
+  uint32 canGetID_FinalReturn;
+  char canGetID_CallbackBool;
+  CMOCK_canGetID_CALLBACK canGetID_CallbackFunctionPointer;
+  int canGetID_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE canGetID_CallInstance;
+  char canMessageNotification_IgnoreBool;
+  char canMessageNotification_CallbackBool;
+  CMOCK_canMessageNotification_CALLBACK canMessageNotification_CallbackFunctionPointer;
+  int canMessageNotification_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE canMessageNotification_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void MockHL_can_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.canInit_CallInstance;
+  if (Mock.canInit_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_canInit);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.canInit_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.canTransmit_CallInstance;
+  if (Mock.canTransmit_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_canTransmit);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.canTransmit_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.canGetData_CallInstance;
+  if (Mock.canGetData_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_canGetData);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.canGetData_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.canIsTxMessagePending_CallInstance;
+  if (Mock.canIsTxMessagePending_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_canIsTxMessagePending);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.canIsTxMessagePending_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.canUpdateID_CallInstance;
+  if (Mock.canUpdateID_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_canUpdateID);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.canUpdateID_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.canGetID_CallInstance;
+  if (Mock.canGetID_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_canGetID);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.canGetID_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.canMessageNotification_CallInstance;
+  if (Mock.canMessageNotification_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_canMessageNotification);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.canMessageNotification_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void MockHL_can_Init(void)
+{
+  MockHL_can_Destroy();
+}
+
+void MockHL_can_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void canInit(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_canInit_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_canInit);
+  cmock_call_instance = (CMOCK_canInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.canInit_CallInstance);
+  Mock.canInit_CallInstance = CMock_Guts_MemNext(Mock.canInit_CallInstance);
+  if (Mock.canInit_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.canInit_CallbackBool &&
+      Mock.canInit_CallbackFunctionPointer != NULL)
+  {
+    Mock.canInit_CallbackFunctionPointer(Mock.canInit_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.canInit_CallbackFunctionPointer != NULL)
+  {
+    Mock.canInit_CallbackFunctionPointer(Mock.canInit_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void canInit_CMockIgnore(void)
+{
+  Mock.canInit_IgnoreBool = (char)1;
+}
+
+void canInit_CMockStopIgnore(void)
+{
+  Mock.canInit_IgnoreBool = (char)0;
+}
+
+void canInit_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canInit_CALL_INSTANCE));
+  CMOCK_canInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_canInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canInit_CallInstance = CMock_Guts_MemChain(Mock.canInit_CallInstance, cmock_guts_index);
+  Mock.canInit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void canInit_AddCallback(CMOCK_canInit_CALLBACK Callback)
+{
+  Mock.canInit_IgnoreBool = (char)0;
+  Mock.canInit_CallbackBool = (char)1;
+  Mock.canInit_CallbackFunctionPointer = Callback;
+}
+
+void canInit_Stub(CMOCK_canInit_CALLBACK Callback)
+{
+  Mock.canInit_IgnoreBool = (char)0;
+  Mock.canInit_CallbackBool = (char)0;
+  Mock.canInit_CallbackFunctionPointer = Callback;
+}
+
+void canInit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canInit_CALL_INSTANCE));
+  CMOCK_canInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_canInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canInit_CallInstance = CMock_Guts_MemChain(Mock.canInit_CallInstance, cmock_guts_index);
+  Mock.canInit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint32 canTransmit(canBASE_t* node, uint32 messageBox, const uint8* data)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_canTransmit);
+  cmock_call_instance = (CMOCK_canTransmit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.canTransmit_CallInstance);
+  Mock.canTransmit_CallInstance = CMock_Guts_MemNext(Mock.canTransmit_CallInstance);
+  if (Mock.canTransmit_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.canTransmit_FinalReturn;
+    Mock.canTransmit_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.canTransmit_CallbackBool &&
+      Mock.canTransmit_CallbackFunctionPointer != NULL)
+  {
+    uint32 cmock_cb_ret = Mock.canTransmit_CallbackFunctionPointer(node, messageBox, data, Mock.canTransmit_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_node)
+  {
+    UNITY_SET_DETAILS(CMockString_canTransmit,CMockString_node);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_node), (void*)(node), sizeof(canBASE_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_messageBox)
+  {
+    UNITY_SET_DETAILS(CMockString_canTransmit,CMockString_messageBox);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_messageBox, messageBox, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_canTransmit,CMockString_data);
+    if (cmock_call_instance->Expected_data == NULL)
+      { UNITY_TEST_ASSERT_NULL(data, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_data, data, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.canTransmit_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.canTransmit_CallbackFunctionPointer(node, messageBox, data, Mock.canTransmit_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_node_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(node, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)node, (void*)cmock_call_instance->ReturnThruPtr_node_Val,
+      cmock_call_instance->ReturnThruPtr_node_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_canTransmit(CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox, const uint8* data);
+void CMockExpectParameters_canTransmit(CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox, const uint8* data)
+{
+  cmock_call_instance->Expected_node = node;
+  cmock_call_instance->IgnoreArg_node = 0;
+  cmock_call_instance->ReturnThruPtr_node_Used = 0;
+  cmock_call_instance->Expected_messageBox = messageBox;
+  cmock_call_instance->IgnoreArg_messageBox = 0;
+  cmock_call_instance->Expected_data = data;
+  cmock_call_instance->IgnoreArg_data = 0;
+}
+
+void canTransmit_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canTransmit_CALL_INSTANCE));
+  CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance = (CMOCK_canTransmit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canTransmit_CallInstance = CMock_Guts_MemChain(Mock.canTransmit_CallInstance, cmock_guts_index);
+  Mock.canTransmit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.canTransmit_IgnoreBool = (char)1;
+}
+
+void canTransmit_CMockStopIgnore(void)
+{
+  if(Mock.canTransmit_IgnoreBool)
+    Mock.canTransmit_CallInstance = CMock_Guts_MemNext(Mock.canTransmit_CallInstance);
+  Mock.canTransmit_IgnoreBool = (char)0;
+}
+
+void canTransmit_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, const uint8* data, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canTransmit_CALL_INSTANCE));
+  CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance = (CMOCK_canTransmit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canTransmit_CallInstance = CMock_Guts_MemChain(Mock.canTransmit_CallInstance, cmock_guts_index);
+  Mock.canTransmit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canTransmit(cmock_call_instance, node, messageBox, data);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void canTransmit_AddCallback(CMOCK_canTransmit_CALLBACK Callback)
+{
+  Mock.canTransmit_IgnoreBool = (char)0;
+  Mock.canTransmit_CallbackBool = (char)1;
+  Mock.canTransmit_CallbackFunctionPointer = Callback;
+}
+
+void canTransmit_Stub(CMOCK_canTransmit_CALLBACK Callback)
+{
+  Mock.canTransmit_IgnoreBool = (char)0;
+  Mock.canTransmit_CallbackBool = (char)0;
+  Mock.canTransmit_CallbackFunctionPointer = Callback;
+}
+
+void canTransmit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, const uint8* data, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canTransmit_CALL_INSTANCE));
+  CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance = (CMOCK_canTransmit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canTransmit_CallInstance = CMock_Guts_MemChain(Mock.canTransmit_CallInstance, cmock_guts_index);
+  Mock.canTransmit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canTransmit(cmock_call_instance, node, messageBox, data);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void canTransmit_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size)
+{
+  CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance = (CMOCK_canTransmit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canTransmit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_node_Used = 1;
+  cmock_call_instance->ReturnThruPtr_node_Val = node;
+  cmock_call_instance->ReturnThruPtr_node_Size = cmock_size;
+}
+
+void canTransmit_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance = (CMOCK_canTransmit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canTransmit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_node = 1;
+}
+
+void canTransmit_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance = (CMOCK_canTransmit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canTransmit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_messageBox = 1;
+}
+
+void canTransmit_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canTransmit_CALL_INSTANCE* cmock_call_instance = (CMOCK_canTransmit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canTransmit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+uint32 canGetData(canBASE_t* node, uint32 messageBox, uint8* const data)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_canGetData);
+  cmock_call_instance = (CMOCK_canGetData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.canGetData_CallInstance);
+  Mock.canGetData_CallInstance = CMock_Guts_MemNext(Mock.canGetData_CallInstance);
+  if (Mock.canGetData_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.canGetData_FinalReturn;
+    Mock.canGetData_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.canGetData_CallbackBool &&
+      Mock.canGetData_CallbackFunctionPointer != NULL)
+  {
+    uint32 cmock_cb_ret = Mock.canGetData_CallbackFunctionPointer(node, messageBox, data, Mock.canGetData_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_node)
+  {
+    UNITY_SET_DETAILS(CMockString_canGetData,CMockString_node);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_node), (void*)(node), sizeof(canBASE_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_messageBox)
+  {
+    UNITY_SET_DETAILS(CMockString_canGetData,CMockString_messageBox);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_messageBox, messageBox, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_canGetData,CMockString_data);
+    if (cmock_call_instance->Expected_data == NULL)
+      { UNITY_TEST_ASSERT_NULL(data, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_data, data, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.canGetData_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.canGetData_CallbackFunctionPointer(node, messageBox, data, Mock.canGetData_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_node_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(node, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)node, (void*)cmock_call_instance->ReturnThruPtr_node_Val,
+      cmock_call_instance->ReturnThruPtr_node_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_data_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(data, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)data, (void*)cmock_call_instance->ReturnThruPtr_data_Val,
+      cmock_call_instance->ReturnThruPtr_data_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_canGetData(CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox, uint8* const data);
+void CMockExpectParameters_canGetData(CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox, uint8* const data)
+{
+  cmock_call_instance->Expected_node = node;
+  cmock_call_instance->IgnoreArg_node = 0;
+  cmock_call_instance->ReturnThruPtr_node_Used = 0;
+  cmock_call_instance->Expected_messageBox = messageBox;
+  cmock_call_instance->IgnoreArg_messageBox = 0;
+  cmock_call_instance->Expected_data = data;
+  cmock_call_instance->IgnoreArg_data = 0;
+  cmock_call_instance->ReturnThruPtr_data_Used = 0;
+}
+
+void canGetData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canGetData_CALL_INSTANCE));
+  CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canGetData_CallInstance = CMock_Guts_MemChain(Mock.canGetData_CallInstance, cmock_guts_index);
+  Mock.canGetData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.canGetData_IgnoreBool = (char)1;
+}
+
+void canGetData_CMockStopIgnore(void)
+{
+  if(Mock.canGetData_IgnoreBool)
+    Mock.canGetData_CallInstance = CMock_Guts_MemNext(Mock.canGetData_CallInstance);
+  Mock.canGetData_IgnoreBool = (char)0;
+}
+
+void canGetData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint8* const data, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canGetData_CALL_INSTANCE));
+  CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canGetData_CallInstance = CMock_Guts_MemChain(Mock.canGetData_CallInstance, cmock_guts_index);
+  Mock.canGetData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canGetData(cmock_call_instance, node, messageBox, data);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void canGetData_AddCallback(CMOCK_canGetData_CALLBACK Callback)
+{
+  Mock.canGetData_IgnoreBool = (char)0;
+  Mock.canGetData_CallbackBool = (char)1;
+  Mock.canGetData_CallbackFunctionPointer = Callback;
+}
+
+void canGetData_Stub(CMOCK_canGetData_CALLBACK Callback)
+{
+  Mock.canGetData_IgnoreBool = (char)0;
+  Mock.canGetData_CallbackBool = (char)0;
+  Mock.canGetData_CallbackFunctionPointer = Callback;
+}
+
+void canGetData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint8* const data, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canGetData_CALL_INSTANCE));
+  CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canGetData_CallInstance = CMock_Guts_MemChain(Mock.canGetData_CallInstance, cmock_guts_index);
+  Mock.canGetData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canGetData(cmock_call_instance, node, messageBox, data);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void canGetData_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size)
+{
+  CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canGetData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_node_Used = 1;
+  cmock_call_instance->ReturnThruPtr_node_Val = node;
+  cmock_call_instance->ReturnThruPtr_node_Size = cmock_size;
+}
+
+void canGetData_CMockReturnMemThruPtr_data(UNITY_LINE_TYPE cmock_line, uint8* data, size_t cmock_size)
+{
+  CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canGetData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_data_Used = 1;
+  cmock_call_instance->ReturnThruPtr_data_Val = data;
+  cmock_call_instance->ReturnThruPtr_data_Size = cmock_size;
+}
+
+void canGetData_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canGetData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_node = 1;
+}
+
+void canGetData_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canGetData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_messageBox = 1;
+}
+
+void canGetData_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canGetData_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canGetData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+uint32 canIsTxMessagePending(canBASE_t* node, uint32 messageBox)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_canIsTxMessagePending_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_canIsTxMessagePending);
+  cmock_call_instance = (CMOCK_canIsTxMessagePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.canIsTxMessagePending_CallInstance);
+  Mock.canIsTxMessagePending_CallInstance = CMock_Guts_MemNext(Mock.canIsTxMessagePending_CallInstance);
+  if (Mock.canIsTxMessagePending_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.canIsTxMessagePending_FinalReturn;
+    Mock.canIsTxMessagePending_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.canIsTxMessagePending_CallbackBool &&
+      Mock.canIsTxMessagePending_CallbackFunctionPointer != NULL)
+  {
+    uint32 cmock_cb_ret = Mock.canIsTxMessagePending_CallbackFunctionPointer(node, messageBox, Mock.canIsTxMessagePending_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_node)
+  {
+    UNITY_SET_DETAILS(CMockString_canIsTxMessagePending,CMockString_node);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_node), (void*)(node), sizeof(canBASE_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_messageBox)
+  {
+    UNITY_SET_DETAILS(CMockString_canIsTxMessagePending,CMockString_messageBox);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_messageBox, messageBox, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.canIsTxMessagePending_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.canIsTxMessagePending_CallbackFunctionPointer(node, messageBox, Mock.canIsTxMessagePending_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_node_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(node, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)node, (void*)cmock_call_instance->ReturnThruPtr_node_Val,
+      cmock_call_instance->ReturnThruPtr_node_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_canIsTxMessagePending(CMOCK_canIsTxMessagePending_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox);
+void CMockExpectParameters_canIsTxMessagePending(CMOCK_canIsTxMessagePending_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox)
+{
+  cmock_call_instance->Expected_node = node;
+  cmock_call_instance->IgnoreArg_node = 0;
+  cmock_call_instance->ReturnThruPtr_node_Used = 0;
+  cmock_call_instance->Expected_messageBox = messageBox;
+  cmock_call_instance->IgnoreArg_messageBox = 0;
+}
+
+void canIsTxMessagePending_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canIsTxMessagePending_CALL_INSTANCE));
+  CMOCK_canIsTxMessagePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_canIsTxMessagePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canIsTxMessagePending_CallInstance = CMock_Guts_MemChain(Mock.canIsTxMessagePending_CallInstance, cmock_guts_index);
+  Mock.canIsTxMessagePending_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.canIsTxMessagePending_IgnoreBool = (char)1;
+}
+
+void canIsTxMessagePending_CMockStopIgnore(void)
+{
+  if(Mock.canIsTxMessagePending_IgnoreBool)
+    Mock.canIsTxMessagePending_CallInstance = CMock_Guts_MemNext(Mock.canIsTxMessagePending_CallInstance);
+  Mock.canIsTxMessagePending_IgnoreBool = (char)0;
+}
+
+void canIsTxMessagePending_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canIsTxMessagePending_CALL_INSTANCE));
+  CMOCK_canIsTxMessagePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_canIsTxMessagePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canIsTxMessagePending_CallInstance = CMock_Guts_MemChain(Mock.canIsTxMessagePending_CallInstance, cmock_guts_index);
+  Mock.canIsTxMessagePending_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canIsTxMessagePending(cmock_call_instance, node, messageBox);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void canIsTxMessagePending_AddCallback(CMOCK_canIsTxMessagePending_CALLBACK Callback)
+{
+  Mock.canIsTxMessagePending_IgnoreBool = (char)0;
+  Mock.canIsTxMessagePending_CallbackBool = (char)1;
+  Mock.canIsTxMessagePending_CallbackFunctionPointer = Callback;
+}
+
+void canIsTxMessagePending_Stub(CMOCK_canIsTxMessagePending_CALLBACK Callback)
+{
+  Mock.canIsTxMessagePending_IgnoreBool = (char)0;
+  Mock.canIsTxMessagePending_CallbackBool = (char)0;
+  Mock.canIsTxMessagePending_CallbackFunctionPointer = Callback;
+}
+
+void canIsTxMessagePending_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canIsTxMessagePending_CALL_INSTANCE));
+  CMOCK_canIsTxMessagePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_canIsTxMessagePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canIsTxMessagePending_CallInstance = CMock_Guts_MemChain(Mock.canIsTxMessagePending_CallInstance, cmock_guts_index);
+  Mock.canIsTxMessagePending_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canIsTxMessagePending(cmock_call_instance, node, messageBox);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void canIsTxMessagePending_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size)
+{
+  CMOCK_canIsTxMessagePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_canIsTxMessagePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canIsTxMessagePending_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_node_Used = 1;
+  cmock_call_instance->ReturnThruPtr_node_Val = node;
+  cmock_call_instance->ReturnThruPtr_node_Size = cmock_size;
+}
+
+void canIsTxMessagePending_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canIsTxMessagePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_canIsTxMessagePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canIsTxMessagePending_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_node = 1;
+}
+
+void canIsTxMessagePending_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canIsTxMessagePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_canIsTxMessagePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canIsTxMessagePending_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_messageBox = 1;
+}
+
+void canUpdateID(canBASE_t* node, uint32 messageBox, uint32 msgBoxArbitVal)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_canUpdateID_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_canUpdateID);
+  cmock_call_instance = (CMOCK_canUpdateID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.canUpdateID_CallInstance);
+  Mock.canUpdateID_CallInstance = CMock_Guts_MemNext(Mock.canUpdateID_CallInstance);
+  if (Mock.canUpdateID_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.canUpdateID_CallbackBool &&
+      Mock.canUpdateID_CallbackFunctionPointer != NULL)
+  {
+    Mock.canUpdateID_CallbackFunctionPointer(node, messageBox, msgBoxArbitVal, Mock.canUpdateID_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_node)
+  {
+    UNITY_SET_DETAILS(CMockString_canUpdateID,CMockString_node);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_node), (void*)(node), sizeof(canBASE_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_messageBox)
+  {
+    UNITY_SET_DETAILS(CMockString_canUpdateID,CMockString_messageBox);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_messageBox, messageBox, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_msgBoxArbitVal)
+  {
+    UNITY_SET_DETAILS(CMockString_canUpdateID,CMockString_msgBoxArbitVal);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_msgBoxArbitVal, msgBoxArbitVal, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.canUpdateID_CallbackFunctionPointer != NULL)
+  {
+    Mock.canUpdateID_CallbackFunctionPointer(node, messageBox, msgBoxArbitVal, Mock.canUpdateID_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_node_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(node, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)node, (void*)cmock_call_instance->ReturnThruPtr_node_Val,
+      cmock_call_instance->ReturnThruPtr_node_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_canUpdateID(CMOCK_canUpdateID_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox, uint32 msgBoxArbitVal);
+void CMockExpectParameters_canUpdateID(CMOCK_canUpdateID_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox, uint32 msgBoxArbitVal)
+{
+  cmock_call_instance->Expected_node = node;
+  cmock_call_instance->IgnoreArg_node = 0;
+  cmock_call_instance->ReturnThruPtr_node_Used = 0;
+  cmock_call_instance->Expected_messageBox = messageBox;
+  cmock_call_instance->IgnoreArg_messageBox = 0;
+  cmock_call_instance->Expected_msgBoxArbitVal = msgBoxArbitVal;
+  cmock_call_instance->IgnoreArg_msgBoxArbitVal = 0;
+}
+
+void canUpdateID_CMockIgnore(void)
+{
+  Mock.canUpdateID_IgnoreBool = (char)1;
+}
+
+void canUpdateID_CMockStopIgnore(void)
+{
+  Mock.canUpdateID_IgnoreBool = (char)0;
+}
+
+void canUpdateID_CMockExpect(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint32 msgBoxArbitVal)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canUpdateID_CALL_INSTANCE));
+  CMOCK_canUpdateID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canUpdateID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canUpdateID_CallInstance = CMock_Guts_MemChain(Mock.canUpdateID_CallInstance, cmock_guts_index);
+  Mock.canUpdateID_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canUpdateID(cmock_call_instance, node, messageBox, msgBoxArbitVal);
+}
+
+void canUpdateID_AddCallback(CMOCK_canUpdateID_CALLBACK Callback)
+{
+  Mock.canUpdateID_IgnoreBool = (char)0;
+  Mock.canUpdateID_CallbackBool = (char)1;
+  Mock.canUpdateID_CallbackFunctionPointer = Callback;
+}
+
+void canUpdateID_Stub(CMOCK_canUpdateID_CALLBACK Callback)
+{
+  Mock.canUpdateID_IgnoreBool = (char)0;
+  Mock.canUpdateID_CallbackBool = (char)0;
+  Mock.canUpdateID_CallbackFunctionPointer = Callback;
+}
+
+void canUpdateID_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint32 msgBoxArbitVal, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canUpdateID_CALL_INSTANCE));
+  CMOCK_canUpdateID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canUpdateID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canUpdateID_CallInstance = CMock_Guts_MemChain(Mock.canUpdateID_CallInstance, cmock_guts_index);
+  Mock.canUpdateID_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canUpdateID(cmock_call_instance, node, messageBox, msgBoxArbitVal);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void canUpdateID_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size)
+{
+  CMOCK_canUpdateID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canUpdateID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canUpdateID_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_node_Used = 1;
+  cmock_call_instance->ReturnThruPtr_node_Val = node;
+  cmock_call_instance->ReturnThruPtr_node_Size = cmock_size;
+}
+
+void canUpdateID_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canUpdateID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canUpdateID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canUpdateID_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_node = 1;
+}
+
+void canUpdateID_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canUpdateID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canUpdateID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canUpdateID_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_messageBox = 1;
+}
+
+void canUpdateID_CMockIgnoreArg_msgBoxArbitVal(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canUpdateID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canUpdateID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canUpdateID_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_msgBoxArbitVal = 1;
+}
+
+uint32 canGetID(canBASE_t* node, uint32 messageBox)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_canGetID_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_canGetID);
+  cmock_call_instance = (CMOCK_canGetID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.canGetID_CallInstance);
+  Mock.canGetID_CallInstance = CMock_Guts_MemNext(Mock.canGetID_CallInstance);
+  if (Mock.canGetID_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.canGetID_FinalReturn;
+    Mock.canGetID_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.canGetID_CallbackBool &&
+      Mock.canGetID_CallbackFunctionPointer != NULL)
+  {
+    uint32 cmock_cb_ret = Mock.canGetID_CallbackFunctionPointer(node, messageBox, Mock.canGetID_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_node)
+  {
+    UNITY_SET_DETAILS(CMockString_canGetID,CMockString_node);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_node), (void*)(node), sizeof(canBASE_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_messageBox)
+  {
+    UNITY_SET_DETAILS(CMockString_canGetID,CMockString_messageBox);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_messageBox, messageBox, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.canGetID_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.canGetID_CallbackFunctionPointer(node, messageBox, Mock.canGetID_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_node_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(node, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)node, (void*)cmock_call_instance->ReturnThruPtr_node_Val,
+      cmock_call_instance->ReturnThruPtr_node_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_canGetID(CMOCK_canGetID_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox);
+void CMockExpectParameters_canGetID(CMOCK_canGetID_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox)
+{
+  cmock_call_instance->Expected_node = node;
+  cmock_call_instance->IgnoreArg_node = 0;
+  cmock_call_instance->ReturnThruPtr_node_Used = 0;
+  cmock_call_instance->Expected_messageBox = messageBox;
+  cmock_call_instance->IgnoreArg_messageBox = 0;
+}
+
+void canGetID_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canGetID_CALL_INSTANCE));
+  CMOCK_canGetID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canGetID_CallInstance = CMock_Guts_MemChain(Mock.canGetID_CallInstance, cmock_guts_index);
+  Mock.canGetID_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.canGetID_IgnoreBool = (char)1;
+}
+
+void canGetID_CMockStopIgnore(void)
+{
+  if(Mock.canGetID_IgnoreBool)
+    Mock.canGetID_CallInstance = CMock_Guts_MemNext(Mock.canGetID_CallInstance);
+  Mock.canGetID_IgnoreBool = (char)0;
+}
+
+void canGetID_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canGetID_CALL_INSTANCE));
+  CMOCK_canGetID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canGetID_CallInstance = CMock_Guts_MemChain(Mock.canGetID_CallInstance, cmock_guts_index);
+  Mock.canGetID_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canGetID(cmock_call_instance, node, messageBox);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void canGetID_AddCallback(CMOCK_canGetID_CALLBACK Callback)
+{
+  Mock.canGetID_IgnoreBool = (char)0;
+  Mock.canGetID_CallbackBool = (char)1;
+  Mock.canGetID_CallbackFunctionPointer = Callback;
+}
+
+void canGetID_Stub(CMOCK_canGetID_CALLBACK Callback)
+{
+  Mock.canGetID_IgnoreBool = (char)0;
+  Mock.canGetID_CallbackBool = (char)0;
+  Mock.canGetID_CallbackFunctionPointer = Callback;
+}
+
+void canGetID_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canGetID_CALL_INSTANCE));
+  CMOCK_canGetID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canGetID_CallInstance = CMock_Guts_MemChain(Mock.canGetID_CallInstance, cmock_guts_index);
+  Mock.canGetID_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canGetID(cmock_call_instance, node, messageBox);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void canGetID_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size)
+{
+  CMOCK_canGetID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canGetID_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_node_Used = 1;
+  cmock_call_instance->ReturnThruPtr_node_Val = node;
+  cmock_call_instance->ReturnThruPtr_node_Size = cmock_size;
+}
+
+void canGetID_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canGetID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canGetID_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_node = 1;
+}
+
+void canGetID_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canGetID_CALL_INSTANCE* cmock_call_instance = (CMOCK_canGetID_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canGetID_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_messageBox = 1;
+}
+
+void canMessageNotification(canBASE_t* node, uint32 messageBox)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_canMessageNotification_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_canMessageNotification);
+  cmock_call_instance = (CMOCK_canMessageNotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.canMessageNotification_CallInstance);
+  Mock.canMessageNotification_CallInstance = CMock_Guts_MemNext(Mock.canMessageNotification_CallInstance);
+  if (Mock.canMessageNotification_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.canMessageNotification_CallbackBool &&
+      Mock.canMessageNotification_CallbackFunctionPointer != NULL)
+  {
+    Mock.canMessageNotification_CallbackFunctionPointer(node, messageBox, Mock.canMessageNotification_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_node)
+  {
+    UNITY_SET_DETAILS(CMockString_canMessageNotification,CMockString_node);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_node), (void*)(node), sizeof(canBASE_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_messageBox)
+  {
+    UNITY_SET_DETAILS(CMockString_canMessageNotification,CMockString_messageBox);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_messageBox, messageBox, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.canMessageNotification_CallbackFunctionPointer != NULL)
+  {
+    Mock.canMessageNotification_CallbackFunctionPointer(node, messageBox, Mock.canMessageNotification_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_node_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(node, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)node, (void*)cmock_call_instance->ReturnThruPtr_node_Val,
+      cmock_call_instance->ReturnThruPtr_node_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_canMessageNotification(CMOCK_canMessageNotification_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox);
+void CMockExpectParameters_canMessageNotification(CMOCK_canMessageNotification_CALL_INSTANCE* cmock_call_instance, canBASE_t* node, uint32 messageBox)
+{
+  cmock_call_instance->Expected_node = node;
+  cmock_call_instance->IgnoreArg_node = 0;
+  cmock_call_instance->ReturnThruPtr_node_Used = 0;
+  cmock_call_instance->Expected_messageBox = messageBox;
+  cmock_call_instance->IgnoreArg_messageBox = 0;
+}
+
+void canMessageNotification_CMockIgnore(void)
+{
+  Mock.canMessageNotification_IgnoreBool = (char)1;
+}
+
+void canMessageNotification_CMockStopIgnore(void)
+{
+  Mock.canMessageNotification_IgnoreBool = (char)0;
+}
+
+void canMessageNotification_CMockExpect(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canMessageNotification_CALL_INSTANCE));
+  CMOCK_canMessageNotification_CALL_INSTANCE* cmock_call_instance = (CMOCK_canMessageNotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canMessageNotification_CallInstance = CMock_Guts_MemChain(Mock.canMessageNotification_CallInstance, cmock_guts_index);
+  Mock.canMessageNotification_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canMessageNotification(cmock_call_instance, node, messageBox);
+}
+
+void canMessageNotification_AddCallback(CMOCK_canMessageNotification_CALLBACK Callback)
+{
+  Mock.canMessageNotification_IgnoreBool = (char)0;
+  Mock.canMessageNotification_CallbackBool = (char)1;
+  Mock.canMessageNotification_CallbackFunctionPointer = Callback;
+}
+
+void canMessageNotification_Stub(CMOCK_canMessageNotification_CALLBACK Callback)
+{
+  Mock.canMessageNotification_IgnoreBool = (char)0;
+  Mock.canMessageNotification_CallbackBool = (char)0;
+  Mock.canMessageNotification_CallbackFunctionPointer = Callback;
+}
+
+void canMessageNotification_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_canMessageNotification_CALL_INSTANCE));
+  CMOCK_canMessageNotification_CALL_INSTANCE* cmock_call_instance = (CMOCK_canMessageNotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.canMessageNotification_CallInstance = CMock_Guts_MemChain(Mock.canMessageNotification_CallInstance, cmock_guts_index);
+  Mock.canMessageNotification_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_canMessageNotification(cmock_call_instance, node, messageBox);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void canMessageNotification_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size)
+{
+  CMOCK_canMessageNotification_CALL_INSTANCE* cmock_call_instance = (CMOCK_canMessageNotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canMessageNotification_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_node_Used = 1;
+  cmock_call_instance->ReturnThruPtr_node_Val = node;
+  cmock_call_instance->ReturnThruPtr_node_Size = cmock_size;
+}
+
+void canMessageNotification_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canMessageNotification_CALL_INSTANCE* cmock_call_instance = (CMOCK_canMessageNotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canMessageNotification_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_node = 1;
+}
+
+void canMessageNotification_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_canMessageNotification_CALL_INSTANCE* cmock_call_instance = (CMOCK_canMessageNotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.canMessageNotification_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_messageBox = 1;
+}
+
@@ -0,0 +1,188 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKHL_CAN_H
+#define _MOCKHL_CAN_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "HL_can.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void MockHL_can_Init(void);
+void MockHL_can_Destroy(void);
+void MockHL_can_Verify(void);
+
+
+
+
+#define canInit_Ignore() canInit_CMockIgnore()
+void canInit_CMockIgnore(void);
+#define canInit_StopIgnore() canInit_CMockStopIgnore()
+void canInit_CMockStopIgnore(void);
+#define canInit_Expect() canInit_CMockExpect(__LINE__)
+void canInit_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_canInit_CALLBACK)(int cmock_num_calls);
+void canInit_AddCallback(CMOCK_canInit_CALLBACK Callback);
+void canInit_Stub(CMOCK_canInit_CALLBACK Callback);
+#define canInit_StubWithCallback canInit_Stub
+#define canInit_ExpectAndThrow(cmock_to_throw) canInit_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void canInit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define canTransmit_IgnoreAndReturn(cmock_retval) canTransmit_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void canTransmit_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return);
+#define canTransmit_StopIgnore() canTransmit_CMockStopIgnore()
+void canTransmit_CMockStopIgnore(void);
+#define canTransmit_ExpectAndReturn(node, messageBox, data, cmock_retval) canTransmit_CMockExpectAndReturn(__LINE__, node, messageBox, data, cmock_retval)
+void canTransmit_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, const uint8* data, uint32 cmock_to_return);
+typedef uint32 (* CMOCK_canTransmit_CALLBACK)(canBASE_t* node, uint32 messageBox, const uint8* data, int cmock_num_calls);
+void canTransmit_AddCallback(CMOCK_canTransmit_CALLBACK Callback);
+void canTransmit_Stub(CMOCK_canTransmit_CALLBACK Callback);
+#define canTransmit_StubWithCallback canTransmit_Stub
+#define canTransmit_ExpectAndThrow(node, messageBox, data, cmock_to_throw) canTransmit_CMockExpectAndThrow(__LINE__, node, messageBox, data, cmock_to_throw)
+void canTransmit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, const uint8* data, CEXCEPTION_T cmock_to_throw);
+#define canTransmit_ReturnThruPtr_node(node) canTransmit_CMockReturnMemThruPtr_node(__LINE__, node, sizeof(canBASE_t))
+#define canTransmit_ReturnArrayThruPtr_node(node, cmock_len) canTransmit_CMockReturnMemThruPtr_node(__LINE__, node, cmock_len * sizeof(*node))
+#define canTransmit_ReturnMemThruPtr_node(node, cmock_size) canTransmit_CMockReturnMemThruPtr_node(__LINE__, node, cmock_size)
+void canTransmit_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size);
+#define canTransmit_IgnoreArg_node() canTransmit_CMockIgnoreArg_node(__LINE__)
+void canTransmit_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line);
+#define canTransmit_IgnoreArg_messageBox() canTransmit_CMockIgnoreArg_messageBox(__LINE__)
+void canTransmit_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line);
+#define canTransmit_IgnoreArg_data() canTransmit_CMockIgnoreArg_data(__LINE__)
+void canTransmit_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define canGetData_IgnoreAndReturn(cmock_retval) canGetData_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void canGetData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return);
+#define canGetData_StopIgnore() canGetData_CMockStopIgnore()
+void canGetData_CMockStopIgnore(void);
+#define canGetData_ExpectAndReturn(node, messageBox, data, cmock_retval) canGetData_CMockExpectAndReturn(__LINE__, node, messageBox, data, cmock_retval)
+void canGetData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint8* const data, uint32 cmock_to_return);
+typedef uint32 (* CMOCK_canGetData_CALLBACK)(canBASE_t* node, uint32 messageBox, uint8* const data, int cmock_num_calls);
+void canGetData_AddCallback(CMOCK_canGetData_CALLBACK Callback);
+void canGetData_Stub(CMOCK_canGetData_CALLBACK Callback);
+#define canGetData_StubWithCallback canGetData_Stub
+#define canGetData_ExpectAndThrow(node, messageBox, data, cmock_to_throw) canGetData_CMockExpectAndThrow(__LINE__, node, messageBox, data, cmock_to_throw)
+void canGetData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint8* const data, CEXCEPTION_T cmock_to_throw);
+#define canGetData_ReturnThruPtr_node(node) canGetData_CMockReturnMemThruPtr_node(__LINE__, node, sizeof(canBASE_t))
+#define canGetData_ReturnArrayThruPtr_node(node, cmock_len) canGetData_CMockReturnMemThruPtr_node(__LINE__, node, cmock_len * sizeof(*node))
+#define canGetData_ReturnMemThruPtr_node(node, cmock_size) canGetData_CMockReturnMemThruPtr_node(__LINE__, node, cmock_size)
+void canGetData_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size);
+#define canGetData_ReturnThruPtr_data(data) canGetData_CMockReturnMemThruPtr_data(__LINE__, data, sizeof(uint8))
+#define canGetData_ReturnArrayThruPtr_data(data, cmock_len) canGetData_CMockReturnMemThruPtr_data(__LINE__, data, cmock_len * sizeof(*data))
+#define canGetData_ReturnMemThruPtr_data(data, cmock_size) canGetData_CMockReturnMemThruPtr_data(__LINE__, data, cmock_size)
+void canGetData_CMockReturnMemThruPtr_data(UNITY_LINE_TYPE cmock_line, uint8* data, size_t cmock_size);
+#define canGetData_IgnoreArg_node() canGetData_CMockIgnoreArg_node(__LINE__)
+void canGetData_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line);
+#define canGetData_IgnoreArg_messageBox() canGetData_CMockIgnoreArg_messageBox(__LINE__)
+void canGetData_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line);
+#define canGetData_IgnoreArg_data() canGetData_CMockIgnoreArg_data(__LINE__)
+void canGetData_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define canIsTxMessagePending_IgnoreAndReturn(cmock_retval) canIsTxMessagePending_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void canIsTxMessagePending_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return);
+#define canIsTxMessagePending_StopIgnore() canIsTxMessagePending_CMockStopIgnore()
+void canIsTxMessagePending_CMockStopIgnore(void);
+#define canIsTxMessagePending_ExpectAndReturn(node, messageBox, cmock_retval) canIsTxMessagePending_CMockExpectAndReturn(__LINE__, node, messageBox, cmock_retval)
+void canIsTxMessagePending_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint32 cmock_to_return);
+typedef uint32 (* CMOCK_canIsTxMessagePending_CALLBACK)(canBASE_t* node, uint32 messageBox, int cmock_num_calls);
+void canIsTxMessagePending_AddCallback(CMOCK_canIsTxMessagePending_CALLBACK Callback);
+void canIsTxMessagePending_Stub(CMOCK_canIsTxMessagePending_CALLBACK Callback);
+#define canIsTxMessagePending_StubWithCallback canIsTxMessagePending_Stub
+#define canIsTxMessagePending_ExpectAndThrow(node, messageBox, cmock_to_throw) canIsTxMessagePending_CMockExpectAndThrow(__LINE__, node, messageBox, cmock_to_throw)
+void canIsTxMessagePending_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, CEXCEPTION_T cmock_to_throw);
+#define canIsTxMessagePending_ReturnThruPtr_node(node) canIsTxMessagePending_CMockReturnMemThruPtr_node(__LINE__, node, sizeof(canBASE_t))
+#define canIsTxMessagePending_ReturnArrayThruPtr_node(node, cmock_len) canIsTxMessagePending_CMockReturnMemThruPtr_node(__LINE__, node, cmock_len * sizeof(*node))
+#define canIsTxMessagePending_ReturnMemThruPtr_node(node, cmock_size) canIsTxMessagePending_CMockReturnMemThruPtr_node(__LINE__, node, cmock_size)
+void canIsTxMessagePending_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size);
+#define canIsTxMessagePending_IgnoreArg_node() canIsTxMessagePending_CMockIgnoreArg_node(__LINE__)
+void canIsTxMessagePending_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line);
+#define canIsTxMessagePending_IgnoreArg_messageBox() canIsTxMessagePending_CMockIgnoreArg_messageBox(__LINE__)
+void canIsTxMessagePending_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line);
+#define canUpdateID_Ignore() canUpdateID_CMockIgnore()
+void canUpdateID_CMockIgnore(void);
+#define canUpdateID_StopIgnore() canUpdateID_CMockStopIgnore()
+void canUpdateID_CMockStopIgnore(void);
+#define canUpdateID_Expect(node, messageBox, msgBoxArbitVal) canUpdateID_CMockExpect(__LINE__, node, messageBox, msgBoxArbitVal)
+void canUpdateID_CMockExpect(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint32 msgBoxArbitVal);
+typedef void (* CMOCK_canUpdateID_CALLBACK)(canBASE_t* node, uint32 messageBox, uint32 msgBoxArbitVal, int cmock_num_calls);
+void canUpdateID_AddCallback(CMOCK_canUpdateID_CALLBACK Callback);
+void canUpdateID_Stub(CMOCK_canUpdateID_CALLBACK Callback);
+#define canUpdateID_StubWithCallback canUpdateID_Stub
+#define canUpdateID_ExpectAndThrow(node, messageBox, msgBoxArbitVal, cmock_to_throw) canUpdateID_CMockExpectAndThrow(__LINE__, node, messageBox, msgBoxArbitVal, cmock_to_throw)
+void canUpdateID_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint32 msgBoxArbitVal, CEXCEPTION_T cmock_to_throw);
+#define canUpdateID_ReturnThruPtr_node(node) canUpdateID_CMockReturnMemThruPtr_node(__LINE__, node, sizeof(canBASE_t))
+#define canUpdateID_ReturnArrayThruPtr_node(node, cmock_len) canUpdateID_CMockReturnMemThruPtr_node(__LINE__, node, cmock_len * sizeof(*node))
+#define canUpdateID_ReturnMemThruPtr_node(node, cmock_size) canUpdateID_CMockReturnMemThruPtr_node(__LINE__, node, cmock_size)
+void canUpdateID_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size);
+#define canUpdateID_IgnoreArg_node() canUpdateID_CMockIgnoreArg_node(__LINE__)
+void canUpdateID_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line);
+#define canUpdateID_IgnoreArg_messageBox() canUpdateID_CMockIgnoreArg_messageBox(__LINE__)
+void canUpdateID_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line);
+#define canUpdateID_IgnoreArg_msgBoxArbitVal() canUpdateID_CMockIgnoreArg_msgBoxArbitVal(__LINE__)
+void canUpdateID_CMockIgnoreArg_msgBoxArbitVal(UNITY_LINE_TYPE cmock_line);
+#define canGetID_IgnoreAndReturn(cmock_retval) canGetID_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void canGetID_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return);
+#define canGetID_StopIgnore() canGetID_CMockStopIgnore()
+void canGetID_CMockStopIgnore(void);
+#define canGetID_ExpectAndReturn(node, messageBox, cmock_retval) canGetID_CMockExpectAndReturn(__LINE__, node, messageBox, cmock_retval)
+void canGetID_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, uint32 cmock_to_return);
+typedef uint32 (* CMOCK_canGetID_CALLBACK)(canBASE_t* node, uint32 messageBox, int cmock_num_calls);
+void canGetID_AddCallback(CMOCK_canGetID_CALLBACK Callback);
+void canGetID_Stub(CMOCK_canGetID_CALLBACK Callback);
+#define canGetID_StubWithCallback canGetID_Stub
+#define canGetID_ExpectAndThrow(node, messageBox, cmock_to_throw) canGetID_CMockExpectAndThrow(__LINE__, node, messageBox, cmock_to_throw)
+void canGetID_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, CEXCEPTION_T cmock_to_throw);
+#define canGetID_ReturnThruPtr_node(node) canGetID_CMockReturnMemThruPtr_node(__LINE__, node, sizeof(canBASE_t))
+#define canGetID_ReturnArrayThruPtr_node(node, cmock_len) canGetID_CMockReturnMemThruPtr_node(__LINE__, node, cmock_len * sizeof(*node))
+#define canGetID_ReturnMemThruPtr_node(node, cmock_size) canGetID_CMockReturnMemThruPtr_node(__LINE__, node, cmock_size)
+void canGetID_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size);
+#define canGetID_IgnoreArg_node() canGetID_CMockIgnoreArg_node(__LINE__)
+void canGetID_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line);
+#define canGetID_IgnoreArg_messageBox() canGetID_CMockIgnoreArg_messageBox(__LINE__)
+void canGetID_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line);
+#define canMessageNotification_Ignore() canMessageNotification_CMockIgnore()
+void canMessageNotification_CMockIgnore(void);
+#define canMessageNotification_StopIgnore() canMessageNotification_CMockStopIgnore()
+void canMessageNotification_CMockStopIgnore(void);
+#define canMessageNotification_Expect(node, messageBox) canMessageNotification_CMockExpect(__LINE__, node, messageBox)
+void canMessageNotification_CMockExpect(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox);
+typedef void (* CMOCK_canMessageNotification_CALLBACK)(canBASE_t* node, uint32 messageBox, int cmock_num_calls);
+void canMessageNotification_AddCallback(CMOCK_canMessageNotification_CALLBACK Callback);
+void canMessageNotification_Stub(CMOCK_canMessageNotification_CALLBACK Callback);
+#define canMessageNotification_StubWithCallback canMessageNotification_Stub
+#define canMessageNotification_ExpectAndThrow(node, messageBox, cmock_to_throw) canMessageNotification_CMockExpectAndThrow(__LINE__, node, messageBox, cmock_to_throw)
+void canMessageNotification_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* node, uint32 messageBox, CEXCEPTION_T cmock_to_throw);
+#define canMessageNotification_ReturnThruPtr_node(node) canMessageNotification_CMockReturnMemThruPtr_node(__LINE__, node, sizeof(canBASE_t))
+#define canMessageNotification_ReturnArrayThruPtr_node(node, cmock_len) canMessageNotification_CMockReturnMemThruPtr_node(__LINE__, node, cmock_len * sizeof(*node))
+#define canMessageNotification_ReturnMemThruPtr_node(node, cmock_size) canMessageNotification_CMockReturnMemThruPtr_node(__LINE__, node, cmock_size)
+void canMessageNotification_CMockReturnMemThruPtr_node(UNITY_LINE_TYPE cmock_line, canBASE_t* node, size_t cmock_size);
+#define canMessageNotification_IgnoreArg_node() canMessageNotification_CMockIgnoreArg_node(__LINE__)
+void canMessageNotification_CMockIgnoreArg_node(UNITY_LINE_TYPE cmock_line);
+#define canMessageNotification_IgnoreArg_messageBox() canMessageNotification_CMockIgnoreArg_messageBox(__LINE__)
+void canMessageNotification_CMockIgnoreArg_messageBox(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
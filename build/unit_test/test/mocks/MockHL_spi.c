@@ -0,0 +1,721 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "MockHL_spi.h"
+
+static const char* CMockString_blocksize = "blocksize";
+static const char* CMockString_dataconfig = "dataconfig";
+static const char* CMockString_destbuff = "destbuff";
+static const char* CMockString_spi = "spi";
+static const char* CMockString_spiInit = "spiInit";
+static const char* CMockString_spiTransmitAndReceiveData = "spiTransmitAndReceiveData";
+static const char* CMockString_spiTransmitData = "spiTransmitData";
+static const char* CMockString_srcbuff = "srcbuff";
+
+typedef struct _CMOCK_spiInit_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_spiInit_CALL_INSTANCE;
+
+typedef struct _CMOCK_spiTransmitData_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32 ReturnVal;
+  int CallOrder;
+  spiBASE_t* Expected_spi;
+  spiDAT1_t* Expected_dataconfig;
+  uint32 Expected_blocksize;
+  uint16* Expected_srcbuff;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_spi_Used;
+  spiBASE_t* ReturnThruPtr_spi_Val;
+  size_t ReturnThruPtr_spi_Size;
+  char ReturnThruPtr_dataconfig_Used;
+  spiDAT1_t* ReturnThruPtr_dataconfig_Val;
+  size_t ReturnThruPtr_dataconfig_Size;
+  char ReturnThruPtr_srcbuff_Used;
+  uint16* ReturnThruPtr_srcbuff_Val;
+  size_t ReturnThruPtr_srcbuff_Size;
+  char IgnoreArg_spi;
+  char IgnoreArg_dataconfig;
+  char IgnoreArg_blocksize;
+  char IgnoreArg_srcbuff;
+
+} CMOCK_spiTransmitData_CALL_INSTANCE;
+
+typedef struct _CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32 ReturnVal;
+  int CallOrder;
+  spiBASE_t* Expected_spi;
+  spiDAT1_t* Expected_dataconfig;
+  uint32 Expected_blocksize;
+  uint16* Expected_srcbuff;
+  uint16* Expected_destbuff;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_spi_Used;
+  spiBASE_t* ReturnThruPtr_spi_Val;
+  size_t ReturnThruPtr_spi_Size;
+  char ReturnThruPtr_dataconfig_Used;
+  spiDAT1_t* ReturnThruPtr_dataconfig_Val;
+  size_t ReturnThruPtr_dataconfig_Size;
+  char ReturnThruPtr_srcbuff_Used;
+  uint16* ReturnThruPtr_srcbuff_Val;
+  size_t ReturnThruPtr_srcbuff_Size;
+  char ReturnThruPtr_destbuff_Used;
+  uint16* ReturnThruPtr_destbuff_Val;
+  size_t ReturnThruPtr_destbuff_Size;
+  char IgnoreArg_spi;
+  char IgnoreArg_dataconfig;
+  char IgnoreArg_blocksize;
+  char IgnoreArg_srcbuff;
+  char IgnoreArg_destbuff;
+
+} CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE;
+
+static struct MockHL_spiInstance
+{
+  char spiInit_IgnoreBool;
+  char spiInit_CallbackBool;
+  CMOCK_spiInit_CALLBACK spiInit_CallbackFunctionPointer;
+  int spiInit_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE spiInit_CallInstance;
+  char spiTransmitData_IgnoreBool;
+  uint32 spiTransmitData_FinalReturn;
+  char spiTransmitData_CallbackBool;
+  CMOCK_spiTransmitData_CALLBACK spiTransmitData_CallbackFunctionPointer;
+  int spiTransmitData_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE spiTransmitData_CallInstance;
+  char spiTransmitAndReceiveData_IgnoreBool;
+  uint32 spiTransmitAndReceiveData_FinalReturn;
+  char spiTransmitAndReceiveData_CallbackBool;
+  CMOCK_spiTransmitAndReceiveData_CALLBACK spiTransmitAndReceiveData_CallbackFunctionPointer;
+  int spiTransmitAndReceiveData_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE spiTransmitAndReceiveData_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void MockHL_spi_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.spiInit_CallInstance;
+  if (Mock.spiInit_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_spiInit);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.spiInit_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.spiTransmitData_CallInstance;
+  if (Mock.spiTransmitData_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_spiTransmitData);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.spiTransmitData_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.spiTransmitAndReceiveData_CallInstance;
+  if (Mock.spiTransmitAndReceiveData_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_spiTransmitAndReceiveData);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.spiTransmitAndReceiveData_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void MockHL_spi_Init(void)
+{
+  MockHL_spi_Destroy();
+}
+
+void MockHL_spi_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void spiInit(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_spiInit_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_spiInit);
+  cmock_call_instance = (CMOCK_spiInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.spiInit_CallInstance);
+  Mock.spiInit_CallInstance = CMock_Guts_MemNext(Mock.spiInit_CallInstance);
+  if (Mock.spiInit_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.spiInit_CallbackBool &&
+      Mock.spiInit_CallbackFunctionPointer != NULL)
+  {
+    Mock.spiInit_CallbackFunctionPointer(Mock.spiInit_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.spiInit_CallbackFunctionPointer != NULL)
+  {
+    Mock.spiInit_CallbackFunctionPointer(Mock.spiInit_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void spiInit_CMockIgnore(void)
+{
+  Mock.spiInit_IgnoreBool = (char)1;
+}
+
+void spiInit_CMockStopIgnore(void)
+{
+  Mock.spiInit_IgnoreBool = (char)0;
+}
+
+void spiInit_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_spiInit_CALL_INSTANCE));
+  CMOCK_spiInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.spiInit_CallInstance = CMock_Guts_MemChain(Mock.spiInit_CallInstance, cmock_guts_index);
+  Mock.spiInit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void spiInit_AddCallback(CMOCK_spiInit_CALLBACK Callback)
+{
+  Mock.spiInit_IgnoreBool = (char)0;
+  Mock.spiInit_CallbackBool = (char)1;
+  Mock.spiInit_CallbackFunctionPointer = Callback;
+}
+
+void spiInit_Stub(CMOCK_spiInit_CALLBACK Callback)
+{
+  Mock.spiInit_IgnoreBool = (char)0;
+  Mock.spiInit_CallbackBool = (char)0;
+  Mock.spiInit_CallbackFunctionPointer = Callback;
+}
+
+void spiInit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_spiInit_CALL_INSTANCE));
+  CMOCK_spiInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.spiInit_CallInstance = CMock_Guts_MemChain(Mock.spiInit_CallInstance, cmock_guts_index);
+  Mock.spiInit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint32 spiTransmitData(spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_spiTransmitData);
+  cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.spiTransmitData_CallInstance);
+  Mock.spiTransmitData_CallInstance = CMock_Guts_MemNext(Mock.spiTransmitData_CallInstance);
+  if (Mock.spiTransmitData_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.spiTransmitData_FinalReturn;
+    Mock.spiTransmitData_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.spiTransmitData_CallbackBool &&
+      Mock.spiTransmitData_CallbackFunctionPointer != NULL)
+  {
+    uint32 cmock_cb_ret = Mock.spiTransmitData_CallbackFunctionPointer(spi, dataconfig, blocksize, srcbuff, Mock.spiTransmitData_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_spi)
+  {
+    UNITY_SET_DETAILS(CMockString_spiTransmitData,CMockString_spi);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_spi), (void*)(spi), sizeof(spiBASE_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dataconfig)
+  {
+    UNITY_SET_DETAILS(CMockString_spiTransmitData,CMockString_dataconfig);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_dataconfig), (void*)(dataconfig), sizeof(spiDAT1_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_blocksize)
+  {
+    UNITY_SET_DETAILS(CMockString_spiTransmitData,CMockString_blocksize);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_blocksize, blocksize, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_srcbuff)
+  {
+    UNITY_SET_DETAILS(CMockString_spiTransmitData,CMockString_srcbuff);
+    if (cmock_call_instance->Expected_srcbuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(srcbuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_srcbuff, srcbuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.spiTransmitData_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.spiTransmitData_CallbackFunctionPointer(spi, dataconfig, blocksize, srcbuff, Mock.spiTransmitData_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_spi_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(spi, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)spi, (void*)cmock_call_instance->ReturnThruPtr_spi_Val,
+      cmock_call_instance->ReturnThruPtr_spi_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_dataconfig_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(dataconfig, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)dataconfig, (void*)cmock_call_instance->ReturnThruPtr_dataconfig_Val,
+      cmock_call_instance->ReturnThruPtr_dataconfig_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_srcbuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(srcbuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)srcbuff, (void*)cmock_call_instance->ReturnThruPtr_srcbuff_Val,
+      cmock_call_instance->ReturnThruPtr_srcbuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_spiTransmitData(CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff);
+void CMockExpectParameters_spiTransmitData(CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff)
+{
+  cmock_call_instance->Expected_spi = spi;
+  cmock_call_instance->IgnoreArg_spi = 0;
+  cmock_call_instance->ReturnThruPtr_spi_Used = 0;
+  cmock_call_instance->Expected_dataconfig = dataconfig;
+  cmock_call_instance->IgnoreArg_dataconfig = 0;
+  cmock_call_instance->ReturnThruPtr_dataconfig_Used = 0;
+  cmock_call_instance->Expected_blocksize = blocksize;
+  cmock_call_instance->IgnoreArg_blocksize = 0;
+  cmock_call_instance->Expected_srcbuff = srcbuff;
+  cmock_call_instance->IgnoreArg_srcbuff = 0;
+  cmock_call_instance->ReturnThruPtr_srcbuff_Used = 0;
+}
+
+void spiTransmitData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_spiTransmitData_CALL_INSTANCE));
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.spiTransmitData_CallInstance = CMock_Guts_MemChain(Mock.spiTransmitData_CallInstance, cmock_guts_index);
+  Mock.spiTransmitData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.spiTransmitData_IgnoreBool = (char)1;
+}
+
+void spiTransmitData_CMockStopIgnore(void)
+{
+  if(Mock.spiTransmitData_IgnoreBool)
+    Mock.spiTransmitData_CallInstance = CMock_Guts_MemNext(Mock.spiTransmitData_CallInstance);
+  Mock.spiTransmitData_IgnoreBool = (char)0;
+}
+
+void spiTransmitData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_spiTransmitData_CALL_INSTANCE));
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.spiTransmitData_CallInstance = CMock_Guts_MemChain(Mock.spiTransmitData_CallInstance, cmock_guts_index);
+  Mock.spiTransmitData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_spiTransmitData(cmock_call_instance, spi, dataconfig, blocksize, srcbuff);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void spiTransmitData_AddCallback(CMOCK_spiTransmitData_CALLBACK Callback)
+{
+  Mock.spiTransmitData_IgnoreBool = (char)0;
+  Mock.spiTransmitData_CallbackBool = (char)1;
+  Mock.spiTransmitData_CallbackFunctionPointer = Callback;
+}
+
+void spiTransmitData_Stub(CMOCK_spiTransmitData_CALLBACK Callback)
+{
+  Mock.spiTransmitData_IgnoreBool = (char)0;
+  Mock.spiTransmitData_CallbackBool = (char)0;
+  Mock.spiTransmitData_CallbackFunctionPointer = Callback;
+}
+
+void spiTransmitData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_spiTransmitData_CALL_INSTANCE));
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.spiTransmitData_CallInstance = CMock_Guts_MemChain(Mock.spiTransmitData_CallInstance, cmock_guts_index);
+  Mock.spiTransmitData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_spiTransmitData(cmock_call_instance, spi, dataconfig, blocksize, srcbuff);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void spiTransmitData_CMockReturnMemThruPtr_spi(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, size_t cmock_size)
+{
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_spi_Used = 1;
+  cmock_call_instance->ReturnThruPtr_spi_Val = spi;
+  cmock_call_instance->ReturnThruPtr_spi_Size = cmock_size;
+}
+
+void spiTransmitData_CMockReturnMemThruPtr_dataconfig(UNITY_LINE_TYPE cmock_line, spiDAT1_t* dataconfig, size_t cmock_size)
+{
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_dataconfig_Used = 1;
+  cmock_call_instance->ReturnThruPtr_dataconfig_Val = dataconfig;
+  cmock_call_instance->ReturnThruPtr_dataconfig_Size = cmock_size;
+}
+
+void spiTransmitData_CMockReturnMemThruPtr_srcbuff(UNITY_LINE_TYPE cmock_line, uint16* srcbuff, size_t cmock_size)
+{
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_srcbuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_srcbuff_Val = srcbuff;
+  cmock_call_instance->ReturnThruPtr_srcbuff_Size = cmock_size;
+}
+
+void spiTransmitData_CMockIgnoreArg_spi(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_spi = 1;
+}
+
+void spiTransmitData_CMockIgnoreArg_dataconfig(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dataconfig = 1;
+}
+
+void spiTransmitData_CMockIgnoreArg_blocksize(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blocksize = 1;
+}
+
+void spiTransmitData_CMockIgnoreArg_srcbuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_spiTransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_srcbuff = 1;
+}
+
+uint32 spiTransmitAndReceiveData(spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint16* destbuff)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_spiTransmitAndReceiveData);
+  cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.spiTransmitAndReceiveData_CallInstance);
+  Mock.spiTransmitAndReceiveData_CallInstance = CMock_Guts_MemNext(Mock.spiTransmitAndReceiveData_CallInstance);
+  if (Mock.spiTransmitAndReceiveData_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.spiTransmitAndReceiveData_FinalReturn;
+    Mock.spiTransmitAndReceiveData_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.spiTransmitAndReceiveData_CallbackBool &&
+      Mock.spiTransmitAndReceiveData_CallbackFunctionPointer != NULL)
+  {
+    uint32 cmock_cb_ret = Mock.spiTransmitAndReceiveData_CallbackFunctionPointer(spi, dataconfig, blocksize, srcbuff, destbuff, Mock.spiTransmitAndReceiveData_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_spi)
+  {
+    UNITY_SET_DETAILS(CMockString_spiTransmitAndReceiveData,CMockString_spi);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_spi), (void*)(spi), sizeof(spiBASE_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dataconfig)
+  {
+    UNITY_SET_DETAILS(CMockString_spiTransmitAndReceiveData,CMockString_dataconfig);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_dataconfig), (void*)(dataconfig), sizeof(spiDAT1_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_blocksize)
+  {
+    UNITY_SET_DETAILS(CMockString_spiTransmitAndReceiveData,CMockString_blocksize);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_blocksize, blocksize, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_srcbuff)
+  {
+    UNITY_SET_DETAILS(CMockString_spiTransmitAndReceiveData,CMockString_srcbuff);
+    if (cmock_call_instance->Expected_srcbuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(srcbuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_srcbuff, srcbuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_destbuff)
+  {
+    UNITY_SET_DETAILS(CMockString_spiTransmitAndReceiveData,CMockString_destbuff);
+    if (cmock_call_instance->Expected_destbuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(destbuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_destbuff, destbuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.spiTransmitAndReceiveData_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.spiTransmitAndReceiveData_CallbackFunctionPointer(spi, dataconfig, blocksize, srcbuff, destbuff, Mock.spiTransmitAndReceiveData_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_spi_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(spi, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)spi, (void*)cmock_call_instance->ReturnThruPtr_spi_Val,
+      cmock_call_instance->ReturnThruPtr_spi_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_dataconfig_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(dataconfig, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)dataconfig, (void*)cmock_call_instance->ReturnThruPtr_dataconfig_Val,
+      cmock_call_instance->ReturnThruPtr_dataconfig_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_srcbuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(srcbuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)srcbuff, (void*)cmock_call_instance->ReturnThruPtr_srcbuff_Val,
+      cmock_call_instance->ReturnThruPtr_srcbuff_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_destbuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(destbuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)destbuff, (void*)cmock_call_instance->ReturnThruPtr_destbuff_Val,
+      cmock_call_instance->ReturnThruPtr_destbuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_spiTransmitAndReceiveData(CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint16* destbuff);
+void CMockExpectParameters_spiTransmitAndReceiveData(CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint16* destbuff)
+{
+  cmock_call_instance->Expected_spi = spi;
+  cmock_call_instance->IgnoreArg_spi = 0;
+  cmock_call_instance->ReturnThruPtr_spi_Used = 0;
+  cmock_call_instance->Expected_dataconfig = dataconfig;
+  cmock_call_instance->IgnoreArg_dataconfig = 0;
+  cmock_call_instance->ReturnThruPtr_dataconfig_Used = 0;
+  cmock_call_instance->Expected_blocksize = blocksize;
+  cmock_call_instance->IgnoreArg_blocksize = 0;
+  cmock_call_instance->Expected_srcbuff = srcbuff;
+  cmock_call_instance->IgnoreArg_srcbuff = 0;
+  cmock_call_instance->ReturnThruPtr_srcbuff_Used = 0;
+  cmock_call_instance->Expected_destbuff = destbuff;
+  cmock_call_instance->IgnoreArg_destbuff = 0;
+  cmock_call_instance->ReturnThruPtr_destbuff_Used = 0;
+}
+
+void spiTransmitAndReceiveData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE));
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.spiTransmitAndReceiveData_CallInstance = CMock_Guts_MemChain(Mock.spiTransmitAndReceiveData_CallInstance, cmock_guts_index);
+  Mock.spiTransmitAndReceiveData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.spiTransmitAndReceiveData_IgnoreBool = (char)1;
+}
+
+void spiTransmitAndReceiveData_CMockStopIgnore(void)
+{
+  if(Mock.spiTransmitAndReceiveData_IgnoreBool)
+    Mock.spiTransmitAndReceiveData_CallInstance = CMock_Guts_MemNext(Mock.spiTransmitAndReceiveData_CallInstance);
+  Mock.spiTransmitAndReceiveData_IgnoreBool = (char)0;
+}
+
+void spiTransmitAndReceiveData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint16* destbuff, uint32 cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE));
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.spiTransmitAndReceiveData_CallInstance = CMock_Guts_MemChain(Mock.spiTransmitAndReceiveData_CallInstance, cmock_guts_index);
+  Mock.spiTransmitAndReceiveData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_spiTransmitAndReceiveData(cmock_call_instance, spi, dataconfig, blocksize, srcbuff, destbuff);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void spiTransmitAndReceiveData_AddCallback(CMOCK_spiTransmitAndReceiveData_CALLBACK Callback)
+{
+  Mock.spiTransmitAndReceiveData_IgnoreBool = (char)0;
+  Mock.spiTransmitAndReceiveData_CallbackBool = (char)1;
+  Mock.spiTransmitAndReceiveData_CallbackFunctionPointer = Callback;
+}
+
+void spiTransmitAndReceiveData_Stub(CMOCK_spiTransmitAndReceiveData_CALLBACK Callback)
+{
+  Mock.spiTransmitAndReceiveData_IgnoreBool = (char)0;
+  Mock.spiTransmitAndReceiveData_CallbackBool = (char)0;
+  Mock.spiTransmitAndReceiveData_CallbackFunctionPointer = Callback;
+}
+
+void spiTransmitAndReceiveData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint16* destbuff, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE));
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.spiTransmitAndReceiveData_CallInstance = CMock_Guts_MemChain(Mock.spiTransmitAndReceiveData_CallInstance, cmock_guts_index);
+  Mock.spiTransmitAndReceiveData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_spiTransmitAndReceiveData(cmock_call_instance, spi, dataconfig, blocksize, srcbuff, destbuff);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void spiTransmitAndReceiveData_CMockReturnMemThruPtr_spi(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, size_t cmock_size)
+{
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitAndReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_spi_Used = 1;
+  cmock_call_instance->ReturnThruPtr_spi_Val = spi;
+  cmock_call_instance->ReturnThruPtr_spi_Size = cmock_size;
+}
+
+void spiTransmitAndReceiveData_CMockReturnMemThruPtr_dataconfig(UNITY_LINE_TYPE cmock_line, spiDAT1_t* dataconfig, size_t cmock_size)
+{
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitAndReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_dataconfig_Used = 1;
+  cmock_call_instance->ReturnThruPtr_dataconfig_Val = dataconfig;
+  cmock_call_instance->ReturnThruPtr_dataconfig_Size = cmock_size;
+}
+
+void spiTransmitAndReceiveData_CMockReturnMemThruPtr_srcbuff(UNITY_LINE_TYPE cmock_line, uint16* srcbuff, size_t cmock_size)
+{
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitAndReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_srcbuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_srcbuff_Val = srcbuff;
+  cmock_call_instance->ReturnThruPtr_srcbuff_Size = cmock_size;
+}
+
+void spiTransmitAndReceiveData_CMockReturnMemThruPtr_destbuff(UNITY_LINE_TYPE cmock_line, uint16* destbuff, size_t cmock_size)
+{
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitAndReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_destbuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_destbuff_Val = destbuff;
+  cmock_call_instance->ReturnThruPtr_destbuff_Size = cmock_size;
+}
+
+void spiTransmitAndReceiveData_CMockIgnoreArg_spi(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitAndReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_spi = 1;
+}
+
+void spiTransmitAndReceiveData_CMockIgnoreArg_dataconfig(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitAndReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dataconfig = 1;
+}
+
+void spiTransmitAndReceiveData_CMockIgnoreArg_blocksize(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitAndReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blocksize = 1;
+}
+
+void spiTransmitAndReceiveData_CMockIgnoreArg_srcbuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitAndReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_srcbuff = 1;
+}
+
+void spiTransmitAndReceiveData_CMockIgnoreArg_destbuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_spiTransmitAndReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.spiTransmitAndReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_destbuff = 1;
+}
+
@@ -0,0 +1,128 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKHL_SPI_H
+#define _MOCKHL_SPI_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "HL_spi.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void MockHL_spi_Init(void);
+void MockHL_spi_Destroy(void);
+void MockHL_spi_Verify(void);
+
+
+
+
+#define spiInit_Ignore() spiInit_CMockIgnore()
+void spiInit_CMockIgnore(void);
+#define spiInit_StopIgnore() spiInit_CMockStopIgnore()
+void spiInit_CMockStopIgnore(void);
+#define spiInit_Expect() spiInit_CMockExpect(__LINE__)
+void spiInit_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_spiInit_CALLBACK)(int cmock_num_calls);
+void spiInit_AddCallback(CMOCK_spiInit_CALLBACK Callback);
+void spiInit_Stub(CMOCK_spiInit_CALLBACK Callback);
+#define spiInit_StubWithCallback spiInit_Stub
+#define spiInit_ExpectAndThrow(cmock_to_throw) spiInit_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void spiInit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define spiTransmitData_IgnoreAndReturn(cmock_retval) spiTransmitData_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void spiTransmitData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return);
+#define spiTransmitData_StopIgnore() spiTransmitData_CMockStopIgnore()
+void spiTransmitData_CMockStopIgnore(void);
+#define spiTransmitData_ExpectAndReturn(spi, dataconfig, blocksize, srcbuff, cmock_retval) spiTransmitData_CMockExpectAndReturn(__LINE__, spi, dataconfig, blocksize, srcbuff, cmock_retval)
+void spiTransmitData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint32 cmock_to_return);
+typedef uint32 (* CMOCK_spiTransmitData_CALLBACK)(spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, int cmock_num_calls);
+void spiTransmitData_AddCallback(CMOCK_spiTransmitData_CALLBACK Callback);
+void spiTransmitData_Stub(CMOCK_spiTransmitData_CALLBACK Callback);
+#define spiTransmitData_StubWithCallback spiTransmitData_Stub
+#define spiTransmitData_ExpectAndThrow(spi, dataconfig, blocksize, srcbuff, cmock_to_throw) spiTransmitData_CMockExpectAndThrow(__LINE__, spi, dataconfig, blocksize, srcbuff, cmock_to_throw)
+void spiTransmitData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, CEXCEPTION_T cmock_to_throw);
+#define spiTransmitData_ReturnThruPtr_spi(spi) spiTransmitData_CMockReturnMemThruPtr_spi(__LINE__, spi, sizeof(spiBASE_t))
+#define spiTransmitData_ReturnArrayThruPtr_spi(spi, cmock_len) spiTransmitData_CMockReturnMemThruPtr_spi(__LINE__, spi, cmock_len * sizeof(*spi))
+#define spiTransmitData_ReturnMemThruPtr_spi(spi, cmock_size) spiTransmitData_CMockReturnMemThruPtr_spi(__LINE__, spi, cmock_size)
+void spiTransmitData_CMockReturnMemThruPtr_spi(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, size_t cmock_size);
+#define spiTransmitData_ReturnThruPtr_dataconfig(dataconfig) spiTransmitData_CMockReturnMemThruPtr_dataconfig(__LINE__, dataconfig, sizeof(spiDAT1_t))
+#define spiTransmitData_ReturnArrayThruPtr_dataconfig(dataconfig, cmock_len) spiTransmitData_CMockReturnMemThruPtr_dataconfig(__LINE__, dataconfig, cmock_len * sizeof(*dataconfig))
+#define spiTransmitData_ReturnMemThruPtr_dataconfig(dataconfig, cmock_size) spiTransmitData_CMockReturnMemThruPtr_dataconfig(__LINE__, dataconfig, cmock_size)
+void spiTransmitData_CMockReturnMemThruPtr_dataconfig(UNITY_LINE_TYPE cmock_line, spiDAT1_t* dataconfig, size_t cmock_size);
+#define spiTransmitData_ReturnThruPtr_srcbuff(srcbuff) spiTransmitData_CMockReturnMemThruPtr_srcbuff(__LINE__, srcbuff, sizeof(uint16))
+#define spiTransmitData_ReturnArrayThruPtr_srcbuff(srcbuff, cmock_len) spiTransmitData_CMockReturnMemThruPtr_srcbuff(__LINE__, srcbuff, cmock_len * sizeof(*srcbuff))
+#define spiTransmitData_ReturnMemThruPtr_srcbuff(srcbuff, cmock_size) spiTransmitData_CMockReturnMemThruPtr_srcbuff(__LINE__, srcbuff, cmock_size)
+void spiTransmitData_CMockReturnMemThruPtr_srcbuff(UNITY_LINE_TYPE cmock_line, uint16* srcbuff, size_t cmock_size);
+#define spiTransmitData_IgnoreArg_spi() spiTransmitData_CMockIgnoreArg_spi(__LINE__)
+void spiTransmitData_CMockIgnoreArg_spi(UNITY_LINE_TYPE cmock_line);
+#define spiTransmitData_IgnoreArg_dataconfig() spiTransmitData_CMockIgnoreArg_dataconfig(__LINE__)
+void spiTransmitData_CMockIgnoreArg_dataconfig(UNITY_LINE_TYPE cmock_line);
+#define spiTransmitData_IgnoreArg_blocksize() spiTransmitData_CMockIgnoreArg_blocksize(__LINE__)
+void spiTransmitData_CMockIgnoreArg_blocksize(UNITY_LINE_TYPE cmock_line);
+#define spiTransmitData_IgnoreArg_srcbuff() spiTransmitData_CMockIgnoreArg_srcbuff(__LINE__)
+void spiTransmitData_CMockIgnoreArg_srcbuff(UNITY_LINE_TYPE cmock_line);
+#define spiTransmitAndReceiveData_IgnoreAndReturn(cmock_retval) spiTransmitAndReceiveData_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void spiTransmitAndReceiveData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32 cmock_to_return);
+#define spiTransmitAndReceiveData_StopIgnore() spiTransmitAndReceiveData_CMockStopIgnore()
+void spiTransmitAndReceiveData_CMockStopIgnore(void);
+#define spiTransmitAndReceiveData_ExpectAndReturn(spi, dataconfig, blocksize, srcbuff, destbuff, cmock_retval) spiTransmitAndReceiveData_CMockExpectAndReturn(__LINE__, spi, dataconfig, blocksize, srcbuff, destbuff, cmock_retval)
+void spiTransmitAndReceiveData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint16* destbuff, uint32 cmock_to_return);
+typedef uint32 (* CMOCK_spiTransmitAndReceiveData_CALLBACK)(spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint16* destbuff, int cmock_num_calls);
+void spiTransmitAndReceiveData_AddCallback(CMOCK_spiTransmitAndReceiveData_CALLBACK Callback);
+void spiTransmitAndReceiveData_Stub(CMOCK_spiTransmitAndReceiveData_CALLBACK Callback);
+#define spiTransmitAndReceiveData_StubWithCallback spiTransmitAndReceiveData_Stub
+#define spiTransmitAndReceiveData_ExpectAndThrow(spi, dataconfig, blocksize, srcbuff, destbuff, cmock_to_throw) spiTransmitAndReceiveData_CMockExpectAndThrow(__LINE__, spi, dataconfig, blocksize, srcbuff, destbuff, cmock_to_throw)
+void spiTransmitAndReceiveData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, spiDAT1_t* dataconfig, uint32 blocksize, uint16* srcbuff, uint16* destbuff, CEXCEPTION_T cmock_to_throw);
+#define spiTransmitAndReceiveData_ReturnThruPtr_spi(spi) spiTransmitAndReceiveData_CMockReturnMemThruPtr_spi(__LINE__, spi, sizeof(spiBASE_t))
+#define spiTransmitAndReceiveData_ReturnArrayThruPtr_spi(spi, cmock_len) spiTransmitAndReceiveData_CMockReturnMemThruPtr_spi(__LINE__, spi, cmock_len * sizeof(*spi))
+#define spiTransmitAndReceiveData_ReturnMemThruPtr_spi(spi, cmock_size) spiTransmitAndReceiveData_CMockReturnMemThruPtr_spi(__LINE__, spi, cmock_size)
+void spiTransmitAndReceiveData_CMockReturnMemThruPtr_spi(UNITY_LINE_TYPE cmock_line, spiBASE_t* spi, size_t cmock_size);
+#define spiTransmitAndReceiveData_ReturnThruPtr_dataconfig(dataconfig) spiTransmitAndReceiveData_CMockReturnMemThruPtr_dataconfig(__LINE__, dataconfig, sizeof(spiDAT1_t))
+#define spiTransmitAndReceiveData_ReturnArrayThruPtr_dataconfig(dataconfig, cmock_len) spiTransmitAndReceiveData_CMockReturnMemThruPtr_dataconfig(__LINE__, dataconfig, cmock_len * sizeof(*dataconfig))
+#define spiTransmitAndReceiveData_ReturnMemThruPtr_dataconfig(dataconfig, cmock_size) spiTransmitAndReceiveData_CMockReturnMemThruPtr_dataconfig(__LINE__, dataconfig, cmock_size)
+void spiTransmitAndReceiveData_CMockReturnMemThruPtr_dataconfig(UNITY_LINE_TYPE cmock_line, spiDAT1_t* dataconfig, size_t cmock_size);
+#define spiTransmitAndReceiveData_ReturnThruPtr_srcbuff(srcbuff) spiTransmitAndReceiveData_CMockReturnMemThruPtr_srcbuff(__LINE__, srcbuff, sizeof(uint16))
+#define spiTransmitAndReceiveData_ReturnArrayThruPtr_srcbuff(srcbuff, cmock_len) spiTransmitAndReceiveData_CMockReturnMemThruPtr_srcbuff(__LINE__, srcbuff, cmock_len * sizeof(*srcbuff))
+#define spiTransmitAndReceiveData_ReturnMemThruPtr_srcbuff(srcbuff, cmock_size) spiTransmitAndReceiveData_CMockReturnMemThruPtr_srcbuff(__LINE__, srcbuff, cmock_size)
+void spiTransmitAndReceiveData_CMockReturnMemThruPtr_srcbuff(UNITY_LINE_TYPE cmock_line, uint16* srcbuff, size_t cmock_size);
+#define spiTransmitAndReceiveData_ReturnThruPtr_destbuff(destbuff) spiTransmitAndReceiveData_CMockReturnMemThruPtr_destbuff(__LINE__, destbuff, sizeof(uint16))
+#define spiTransmitAndReceiveData_ReturnArrayThruPtr_destbuff(destbuff, cmock_len) spiTransmitAndReceiveData_CMockReturnMemThruPtr_destbuff(__LINE__, destbuff, cmock_len * sizeof(*destbuff))
+#define spiTransmitAndReceiveData_ReturnMemThruPtr_destbuff(destbuff, cmock_size) spiTransmitAndReceiveData_CMockReturnMemThruPtr_destbuff(__LINE__, destbuff, cmock_size)
+void spiTransmitAndReceiveData_CMockReturnMemThruPtr_destbuff(UNITY_LINE_TYPE cmock_line, uint16* destbuff, size_t cmock_size);
+#define spiTransmitAndReceiveData_IgnoreArg_spi() spiTransmitAndReceiveData_CMockIgnoreArg_spi(__LINE__)
+void spiTransmitAndReceiveData_CMockIgnoreArg_spi(UNITY_LINE_TYPE cmock_line);
+#define spiTransmitAndReceiveData_IgnoreArg_dataconfig() spiTransmitAndReceiveData_CMockIgnoreArg_dataconfig(__LINE__)
+void spiTransmitAndReceiveData_CMockIgnoreArg_dataconfig(UNITY_LINE_TYPE cmock_line);
+#define spiTransmitAndReceiveData_IgnoreArg_blocksize() spiTransmitAndReceiveData_CMockIgnoreArg_blocksize(__LINE__)
+void spiTransmitAndReceiveData_CMockIgnoreArg_blocksize(UNITY_LINE_TYPE cmock_line);
+#define spiTransmitAndReceiveData_IgnoreArg_srcbuff() spiTransmitAndReceiveData_CMockIgnoreArg_srcbuff(__LINE__)
+void spiTransmitAndReceiveData_CMockIgnoreArg_srcbuff(UNITY_LINE_TYPE cmock_line);
+#define spiTransmitAndReceiveData_IgnoreArg_destbuff() spiTransmitAndReceiveData_CMockIgnoreArg_destbuff(__LINE__)
+void spiTransmitAndReceiveData_CMockIgnoreArg_destbuff(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
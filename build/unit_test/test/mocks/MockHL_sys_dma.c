@@ -0,0 +1,952 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "MockHL_sys_dma.h"
+
+static const char* CMockString_channel = "channel";
+static const char* CMockString_dmaEnable = "dmaEnable";
+static const char* CMockString_dmaEnableInterrupt = "dmaEnableInterrupt";
+static const char* CMockString_dmaGroupANotification = "dmaGroupANotification";
+static const char* CMockString_dmaReqAssign = "dmaReqAssign";
+static const char* CMockString_dmaSetChEnable = "dmaSetChEnable";
+static const char* CMockString_dmaSetCtrlPacket = "dmaSetCtrlPacket";
+static const char* CMockString_g_dmaCTRLPKT = "g_dmaCTRLPKT";
+static const char* CMockString_group = "group";
+static const char* CMockString_inttype = "inttype";
+static const char* CMockString_reqline = "reqline";
+static const char* CMockString_type = "type";
+
+typedef struct _CMOCK_dmaEnable_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_dmaEnable_CALL_INSTANCE;
+
+typedef struct _CMOCK_dmaReqAssign_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  dmaChannel_t Expected_channel;
+  dmaRequest_t Expected_reqline;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_channel;
+  char IgnoreArg_reqline;
+
+} CMOCK_dmaReqAssign_CALL_INSTANCE;
+
+typedef struct _CMOCK_dmaSetCtrlPacket_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  dmaChannel_t Expected_channel;
+  g_dmaCTRL Expected_g_dmaCTRLPKT;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_channel;
+  char IgnoreArg_g_dmaCTRLPKT;
+
+} CMOCK_dmaSetCtrlPacket_CALL_INSTANCE;
+
+typedef struct _CMOCK_dmaSetChEnable_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  dmaChannel_t Expected_channel;
+  dmaTriggerType_t Expected_type;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_channel;
+  char IgnoreArg_type;
+
+} CMOCK_dmaSetChEnable_CALL_INSTANCE;
+
+typedef struct _CMOCK_dmaEnableInterrupt_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  dmaChannel_t Expected_channel;
+  dmaInterrupt_t Expected_inttype;
+  dmaIntGroup_t Expected_group;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_channel;
+  char IgnoreArg_inttype;
+  char IgnoreArg_group;
+
+} CMOCK_dmaEnableInterrupt_CALL_INSTANCE;
+
+typedef struct _CMOCK_dmaGroupANotification_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  dmaInterrupt_t Expected_inttype;
+  uint32 Expected_channel;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_inttype;
+  char IgnoreArg_channel;
+
+} CMOCK_dmaGroupANotification_CALL_INSTANCE;
+
+static struct MockHL_sys_dmaInstance
+{
+  char dmaEnable_IgnoreBool;
+  char dmaEnable_CallbackBool;
+  CMOCK_dmaEnable_CALLBACK dmaEnable_CallbackFunctionPointer;
+  int dmaEnable_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dmaEnable_CallInstance;
+  char dmaReqAssign_IgnoreBool;
+  char dmaReqAssign_CallbackBool;
+  CMOCK_dmaReqAssign_CALLBACK dmaReqAssign_CallbackFunctionPointer;
+  int dmaReqAssign_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dmaReqAssign_CallInstance;
+  char dmaSetCtrlPacket_IgnoreBool;
+  char dmaSetCtrlPacket_CallbackBool;
+  CMOCK_dmaSetCtrlPacket_CALLBACK dmaSetCtrlPacket_CallbackFunctionPointer;
+  int dmaSetCtrlPacket_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dmaSetCtrlPacket_CallInstance;
+  char dmaSetChEnable_IgnoreBool;
+  char dmaSetChEnable_CallbackBool;
+  CMOCK_dmaSetChEnable_CALLBACK dmaSetChEnable_CallbackFunctionPointer;
+  int dmaSetChEnable_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dmaSetChEnable_CallInstance;
+  char dmaEnableInterrupt_IgnoreBool;
+  char dmaEnableInterrupt_CallbackBool;
+  CMOCK_dmaEnableInterrupt_CALLBACK dmaEnableInterrupt_CallbackFunctionPointer;
+  int dmaEnableInterrupt_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dmaEnableInterrupt_CallInstance;
+  char dmaGroupANotification_IgnoreBool;
+  char dmaGroupANotification_CallbackBool;
+  CMOCK_dmaGroupANotification_CALLBACK dmaGroupANotification_CallbackFunctionPointer;
+  int dmaGroupANotification_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE dmaGroupANotification_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void MockHL_sys_dma_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.dmaEnable_CallInstance;
+  if (Mock.dmaEnable_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_dmaEnable);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.dmaEnable_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.dmaReqAssign_CallInstance;
+  if (Mock.dmaReqAssign_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_dmaReqAssign);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.dmaReqAssign_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.dmaSetCtrlPacket_CallInstance;
+  if (Mock.dmaSetCtrlPacket_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_dmaSetCtrlPacket);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.dmaSetCtrlPacket_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.dmaSetChEnable_CallInstance;
+  if (Mock.dmaSetChEnable_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_dmaSetChEnable);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.dmaSetChEnable_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.dmaEnableInterrupt_CallInstance;
+  if (Mock.dmaEnableInterrupt_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_dmaEnableInterrupt);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.dmaEnableInterrupt_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.dmaGroupANotification_CallInstance;
+  if (Mock.dmaGroupANotification_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_dmaGroupANotification);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.dmaGroupANotification_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void MockHL_sys_dma_Init(void)
+{
+  MockHL_sys_dma_Destroy();
+}
+
+void MockHL_sys_dma_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void dmaEnable(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dmaEnable_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dmaEnable);
+  cmock_call_instance = (CMOCK_dmaEnable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dmaEnable_CallInstance);
+  Mock.dmaEnable_CallInstance = CMock_Guts_MemNext(Mock.dmaEnable_CallInstance);
+  if (Mock.dmaEnable_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dmaEnable_CallbackBool &&
+      Mock.dmaEnable_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaEnable_CallbackFunctionPointer(Mock.dmaEnable_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.dmaEnable_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaEnable_CallbackFunctionPointer(Mock.dmaEnable_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void dmaEnable_CMockIgnore(void)
+{
+  Mock.dmaEnable_IgnoreBool = (char)1;
+}
+
+void dmaEnable_CMockStopIgnore(void)
+{
+  Mock.dmaEnable_IgnoreBool = (char)0;
+}
+
+void dmaEnable_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaEnable_CALL_INSTANCE));
+  CMOCK_dmaEnable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaEnable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaEnable_CallInstance = CMock_Guts_MemChain(Mock.dmaEnable_CallInstance, cmock_guts_index);
+  Mock.dmaEnable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void dmaEnable_AddCallback(CMOCK_dmaEnable_CALLBACK Callback)
+{
+  Mock.dmaEnable_IgnoreBool = (char)0;
+  Mock.dmaEnable_CallbackBool = (char)1;
+  Mock.dmaEnable_CallbackFunctionPointer = Callback;
+}
+
+void dmaEnable_Stub(CMOCK_dmaEnable_CALLBACK Callback)
+{
+  Mock.dmaEnable_IgnoreBool = (char)0;
+  Mock.dmaEnable_CallbackBool = (char)0;
+  Mock.dmaEnable_CallbackFunctionPointer = Callback;
+}
+
+void dmaEnable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaEnable_CALL_INSTANCE));
+  CMOCK_dmaEnable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaEnable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaEnable_CallInstance = CMock_Guts_MemChain(Mock.dmaEnable_CallInstance, cmock_guts_index);
+  Mock.dmaEnable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dmaReqAssign(dmaChannel_t channel, dmaRequest_t reqline)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dmaReqAssign_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dmaReqAssign);
+  cmock_call_instance = (CMOCK_dmaReqAssign_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dmaReqAssign_CallInstance);
+  Mock.dmaReqAssign_CallInstance = CMock_Guts_MemNext(Mock.dmaReqAssign_CallInstance);
+  if (Mock.dmaReqAssign_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dmaReqAssign_CallbackBool &&
+      Mock.dmaReqAssign_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaReqAssign_CallbackFunctionPointer(channel, reqline, Mock.dmaReqAssign_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_channel)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaReqAssign,CMockString_channel);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_channel), (void*)(&channel), sizeof(dmaChannel_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_reqline)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaReqAssign,CMockString_reqline);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_reqline), (void*)(&reqline), sizeof(dmaRequest_t), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.dmaReqAssign_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaReqAssign_CallbackFunctionPointer(channel, reqline, Mock.dmaReqAssign_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dmaReqAssign(CMOCK_dmaReqAssign_CALL_INSTANCE* cmock_call_instance, dmaChannel_t channel, dmaRequest_t reqline);
+void CMockExpectParameters_dmaReqAssign(CMOCK_dmaReqAssign_CALL_INSTANCE* cmock_call_instance, dmaChannel_t channel, dmaRequest_t reqline)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_channel), (void*)(&channel),
+         sizeof(dmaChannel_t[sizeof(channel) == sizeof(dmaChannel_t) ? 1 : -1])); /* add dmaChannel_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_channel = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_reqline), (void*)(&reqline),
+         sizeof(dmaRequest_t[sizeof(reqline) == sizeof(dmaRequest_t) ? 1 : -1])); /* add dmaRequest_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_reqline = 0;
+}
+
+void dmaReqAssign_CMockIgnore(void)
+{
+  Mock.dmaReqAssign_IgnoreBool = (char)1;
+}
+
+void dmaReqAssign_CMockStopIgnore(void)
+{
+  Mock.dmaReqAssign_IgnoreBool = (char)0;
+}
+
+void dmaReqAssign_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaRequest_t reqline)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaReqAssign_CALL_INSTANCE));
+  CMOCK_dmaReqAssign_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaReqAssign_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaReqAssign_CallInstance = CMock_Guts_MemChain(Mock.dmaReqAssign_CallInstance, cmock_guts_index);
+  Mock.dmaReqAssign_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaReqAssign(cmock_call_instance, channel, reqline);
+}
+
+void dmaReqAssign_AddCallback(CMOCK_dmaReqAssign_CALLBACK Callback)
+{
+  Mock.dmaReqAssign_IgnoreBool = (char)0;
+  Mock.dmaReqAssign_CallbackBool = (char)1;
+  Mock.dmaReqAssign_CallbackFunctionPointer = Callback;
+}
+
+void dmaReqAssign_Stub(CMOCK_dmaReqAssign_CALLBACK Callback)
+{
+  Mock.dmaReqAssign_IgnoreBool = (char)0;
+  Mock.dmaReqAssign_CallbackBool = (char)0;
+  Mock.dmaReqAssign_CallbackFunctionPointer = Callback;
+}
+
+void dmaReqAssign_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaRequest_t reqline, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaReqAssign_CALL_INSTANCE));
+  CMOCK_dmaReqAssign_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaReqAssign_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaReqAssign_CallInstance = CMock_Guts_MemChain(Mock.dmaReqAssign_CallInstance, cmock_guts_index);
+  Mock.dmaReqAssign_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaReqAssign(cmock_call_instance, channel, reqline);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dmaReqAssign_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaReqAssign_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaReqAssign_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaReqAssign_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_channel = 1;
+}
+
+void dmaReqAssign_CMockIgnoreArg_reqline(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaReqAssign_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaReqAssign_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaReqAssign_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_reqline = 1;
+}
+
+void dmaSetCtrlPacket(dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dmaSetCtrlPacket_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dmaSetCtrlPacket);
+  cmock_call_instance = (CMOCK_dmaSetCtrlPacket_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dmaSetCtrlPacket_CallInstance);
+  Mock.dmaSetCtrlPacket_CallInstance = CMock_Guts_MemNext(Mock.dmaSetCtrlPacket_CallInstance);
+  if (Mock.dmaSetCtrlPacket_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dmaSetCtrlPacket_CallbackBool &&
+      Mock.dmaSetCtrlPacket_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaSetCtrlPacket_CallbackFunctionPointer(channel, g_dmaCTRLPKT, Mock.dmaSetCtrlPacket_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_channel)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaSetCtrlPacket,CMockString_channel);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_channel), (void*)(&channel), sizeof(dmaChannel_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_g_dmaCTRLPKT)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaSetCtrlPacket,CMockString_g_dmaCTRLPKT);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_g_dmaCTRLPKT), (void*)(&g_dmaCTRLPKT), sizeof(g_dmaCTRL), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.dmaSetCtrlPacket_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaSetCtrlPacket_CallbackFunctionPointer(channel, g_dmaCTRLPKT, Mock.dmaSetCtrlPacket_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dmaSetCtrlPacket(CMOCK_dmaSetCtrlPacket_CALL_INSTANCE* cmock_call_instance, dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT);
+void CMockExpectParameters_dmaSetCtrlPacket(CMOCK_dmaSetCtrlPacket_CALL_INSTANCE* cmock_call_instance, dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_channel), (void*)(&channel),
+         sizeof(dmaChannel_t[sizeof(channel) == sizeof(dmaChannel_t) ? 1 : -1])); /* add dmaChannel_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_channel = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_g_dmaCTRLPKT), (void*)(&g_dmaCTRLPKT),
+         sizeof(g_dmaCTRL[sizeof(g_dmaCTRLPKT) == sizeof(g_dmaCTRL) ? 1 : -1])); /* add g_dmaCTRL to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_g_dmaCTRLPKT = 0;
+}
+
+void dmaSetCtrlPacket_CMockIgnore(void)
+{
+  Mock.dmaSetCtrlPacket_IgnoreBool = (char)1;
+}
+
+void dmaSetCtrlPacket_CMockStopIgnore(void)
+{
+  Mock.dmaSetCtrlPacket_IgnoreBool = (char)0;
+}
+
+void dmaSetCtrlPacket_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaSetCtrlPacket_CALL_INSTANCE));
+  CMOCK_dmaSetCtrlPacket_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaSetCtrlPacket_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaSetCtrlPacket_CallInstance = CMock_Guts_MemChain(Mock.dmaSetCtrlPacket_CallInstance, cmock_guts_index);
+  Mock.dmaSetCtrlPacket_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaSetCtrlPacket(cmock_call_instance, channel, g_dmaCTRLPKT);
+}
+
+void dmaSetCtrlPacket_AddCallback(CMOCK_dmaSetCtrlPacket_CALLBACK Callback)
+{
+  Mock.dmaSetCtrlPacket_IgnoreBool = (char)0;
+  Mock.dmaSetCtrlPacket_CallbackBool = (char)1;
+  Mock.dmaSetCtrlPacket_CallbackFunctionPointer = Callback;
+}
+
+void dmaSetCtrlPacket_Stub(CMOCK_dmaSetCtrlPacket_CALLBACK Callback)
+{
+  Mock.dmaSetCtrlPacket_IgnoreBool = (char)0;
+  Mock.dmaSetCtrlPacket_CallbackBool = (char)0;
+  Mock.dmaSetCtrlPacket_CallbackFunctionPointer = Callback;
+}
+
+void dmaSetCtrlPacket_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaSetCtrlPacket_CALL_INSTANCE));
+  CMOCK_dmaSetCtrlPacket_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaSetCtrlPacket_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaSetCtrlPacket_CallInstance = CMock_Guts_MemChain(Mock.dmaSetCtrlPacket_CallInstance, cmock_guts_index);
+  Mock.dmaSetCtrlPacket_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaSetCtrlPacket(cmock_call_instance, channel, g_dmaCTRLPKT);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dmaSetCtrlPacket_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaSetCtrlPacket_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaSetCtrlPacket_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaSetCtrlPacket_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_channel = 1;
+}
+
+void dmaSetCtrlPacket_CMockIgnoreArg_g_dmaCTRLPKT(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaSetCtrlPacket_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaSetCtrlPacket_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaSetCtrlPacket_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_g_dmaCTRLPKT = 1;
+}
+
+void dmaSetChEnable(dmaChannel_t channel, dmaTriggerType_t type)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dmaSetChEnable_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dmaSetChEnable);
+  cmock_call_instance = (CMOCK_dmaSetChEnable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dmaSetChEnable_CallInstance);
+  Mock.dmaSetChEnable_CallInstance = CMock_Guts_MemNext(Mock.dmaSetChEnable_CallInstance);
+  if (Mock.dmaSetChEnable_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dmaSetChEnable_CallbackBool &&
+      Mock.dmaSetChEnable_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaSetChEnable_CallbackFunctionPointer(channel, type, Mock.dmaSetChEnable_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_channel)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaSetChEnable,CMockString_channel);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_channel), (void*)(&channel), sizeof(dmaChannel_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_type)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaSetChEnable,CMockString_type);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_type), (void*)(&type), sizeof(dmaTriggerType_t), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.dmaSetChEnable_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaSetChEnable_CallbackFunctionPointer(channel, type, Mock.dmaSetChEnable_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dmaSetChEnable(CMOCK_dmaSetChEnable_CALL_INSTANCE* cmock_call_instance, dmaChannel_t channel, dmaTriggerType_t type);
+void CMockExpectParameters_dmaSetChEnable(CMOCK_dmaSetChEnable_CALL_INSTANCE* cmock_call_instance, dmaChannel_t channel, dmaTriggerType_t type)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_channel), (void*)(&channel),
+         sizeof(dmaChannel_t[sizeof(channel) == sizeof(dmaChannel_t) ? 1 : -1])); /* add dmaChannel_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_channel = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_type), (void*)(&type),
+         sizeof(dmaTriggerType_t[sizeof(type) == sizeof(dmaTriggerType_t) ? 1 : -1])); /* add dmaTriggerType_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_type = 0;
+}
+
+void dmaSetChEnable_CMockIgnore(void)
+{
+  Mock.dmaSetChEnable_IgnoreBool = (char)1;
+}
+
+void dmaSetChEnable_CMockStopIgnore(void)
+{
+  Mock.dmaSetChEnable_IgnoreBool = (char)0;
+}
+
+void dmaSetChEnable_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaTriggerType_t type)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaSetChEnable_CALL_INSTANCE));
+  CMOCK_dmaSetChEnable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaSetChEnable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaSetChEnable_CallInstance = CMock_Guts_MemChain(Mock.dmaSetChEnable_CallInstance, cmock_guts_index);
+  Mock.dmaSetChEnable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaSetChEnable(cmock_call_instance, channel, type);
+}
+
+void dmaSetChEnable_AddCallback(CMOCK_dmaSetChEnable_CALLBACK Callback)
+{
+  Mock.dmaSetChEnable_IgnoreBool = (char)0;
+  Mock.dmaSetChEnable_CallbackBool = (char)1;
+  Mock.dmaSetChEnable_CallbackFunctionPointer = Callback;
+}
+
+void dmaSetChEnable_Stub(CMOCK_dmaSetChEnable_CALLBACK Callback)
+{
+  Mock.dmaSetChEnable_IgnoreBool = (char)0;
+  Mock.dmaSetChEnable_CallbackBool = (char)0;
+  Mock.dmaSetChEnable_CallbackFunctionPointer = Callback;
+}
+
+void dmaSetChEnable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaTriggerType_t type, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaSetChEnable_CALL_INSTANCE));
+  CMOCK_dmaSetChEnable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaSetChEnable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaSetChEnable_CallInstance = CMock_Guts_MemChain(Mock.dmaSetChEnable_CallInstance, cmock_guts_index);
+  Mock.dmaSetChEnable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaSetChEnable(cmock_call_instance, channel, type);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dmaSetChEnable_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaSetChEnable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaSetChEnable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaSetChEnable_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_channel = 1;
+}
+
+void dmaSetChEnable_CMockIgnoreArg_type(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaSetChEnable_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaSetChEnable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaSetChEnable_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_type = 1;
+}
+
+void dmaEnableInterrupt(dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dmaEnableInterrupt_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dmaEnableInterrupt);
+  cmock_call_instance = (CMOCK_dmaEnableInterrupt_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dmaEnableInterrupt_CallInstance);
+  Mock.dmaEnableInterrupt_CallInstance = CMock_Guts_MemNext(Mock.dmaEnableInterrupt_CallInstance);
+  if (Mock.dmaEnableInterrupt_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dmaEnableInterrupt_CallbackBool &&
+      Mock.dmaEnableInterrupt_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaEnableInterrupt_CallbackFunctionPointer(channel, inttype, group, Mock.dmaEnableInterrupt_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_channel)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaEnableInterrupt,CMockString_channel);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_channel), (void*)(&channel), sizeof(dmaChannel_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_inttype)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaEnableInterrupt,CMockString_inttype);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_inttype), (void*)(&inttype), sizeof(dmaInterrupt_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_group)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaEnableInterrupt,CMockString_group);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_group), (void*)(&group), sizeof(dmaIntGroup_t), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.dmaEnableInterrupt_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaEnableInterrupt_CallbackFunctionPointer(channel, inttype, group, Mock.dmaEnableInterrupt_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dmaEnableInterrupt(CMOCK_dmaEnableInterrupt_CALL_INSTANCE* cmock_call_instance, dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group);
+void CMockExpectParameters_dmaEnableInterrupt(CMOCK_dmaEnableInterrupt_CALL_INSTANCE* cmock_call_instance, dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_channel), (void*)(&channel),
+         sizeof(dmaChannel_t[sizeof(channel) == sizeof(dmaChannel_t) ? 1 : -1])); /* add dmaChannel_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_channel = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_inttype), (void*)(&inttype),
+         sizeof(dmaInterrupt_t[sizeof(inttype) == sizeof(dmaInterrupt_t) ? 1 : -1])); /* add dmaInterrupt_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_inttype = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_group), (void*)(&group),
+         sizeof(dmaIntGroup_t[sizeof(group) == sizeof(dmaIntGroup_t) ? 1 : -1])); /* add dmaIntGroup_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_group = 0;
+}
+
+void dmaEnableInterrupt_CMockIgnore(void)
+{
+  Mock.dmaEnableInterrupt_IgnoreBool = (char)1;
+}
+
+void dmaEnableInterrupt_CMockStopIgnore(void)
+{
+  Mock.dmaEnableInterrupt_IgnoreBool = (char)0;
+}
+
+void dmaEnableInterrupt_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaEnableInterrupt_CALL_INSTANCE));
+  CMOCK_dmaEnableInterrupt_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaEnableInterrupt_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaEnableInterrupt_CallInstance = CMock_Guts_MemChain(Mock.dmaEnableInterrupt_CallInstance, cmock_guts_index);
+  Mock.dmaEnableInterrupt_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaEnableInterrupt(cmock_call_instance, channel, inttype, group);
+}
+
+void dmaEnableInterrupt_AddCallback(CMOCK_dmaEnableInterrupt_CALLBACK Callback)
+{
+  Mock.dmaEnableInterrupt_IgnoreBool = (char)0;
+  Mock.dmaEnableInterrupt_CallbackBool = (char)1;
+  Mock.dmaEnableInterrupt_CallbackFunctionPointer = Callback;
+}
+
+void dmaEnableInterrupt_Stub(CMOCK_dmaEnableInterrupt_CALLBACK Callback)
+{
+  Mock.dmaEnableInterrupt_IgnoreBool = (char)0;
+  Mock.dmaEnableInterrupt_CallbackBool = (char)0;
+  Mock.dmaEnableInterrupt_CallbackFunctionPointer = Callback;
+}
+
+void dmaEnableInterrupt_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaEnableInterrupt_CALL_INSTANCE));
+  CMOCK_dmaEnableInterrupt_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaEnableInterrupt_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaEnableInterrupt_CallInstance = CMock_Guts_MemChain(Mock.dmaEnableInterrupt_CallInstance, cmock_guts_index);
+  Mock.dmaEnableInterrupt_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaEnableInterrupt(cmock_call_instance, channel, inttype, group);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dmaEnableInterrupt_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaEnableInterrupt_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaEnableInterrupt_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaEnableInterrupt_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_channel = 1;
+}
+
+void dmaEnableInterrupt_CMockIgnoreArg_inttype(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaEnableInterrupt_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaEnableInterrupt_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaEnableInterrupt_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_inttype = 1;
+}
+
+void dmaEnableInterrupt_CMockIgnoreArg_group(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaEnableInterrupt_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaEnableInterrupt_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaEnableInterrupt_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_group = 1;
+}
+
+void dmaGroupANotification(dmaInterrupt_t inttype, uint32 channel)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_dmaGroupANotification_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_dmaGroupANotification);
+  cmock_call_instance = (CMOCK_dmaGroupANotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.dmaGroupANotification_CallInstance);
+  Mock.dmaGroupANotification_CallInstance = CMock_Guts_MemNext(Mock.dmaGroupANotification_CallInstance);
+  if (Mock.dmaGroupANotification_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.dmaGroupANotification_CallbackBool &&
+      Mock.dmaGroupANotification_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaGroupANotification_CallbackFunctionPointer(inttype, channel, Mock.dmaGroupANotification_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_inttype)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaGroupANotification,CMockString_inttype);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_inttype), (void*)(&inttype), sizeof(dmaInterrupt_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_channel)
+  {
+    UNITY_SET_DETAILS(CMockString_dmaGroupANotification,CMockString_channel);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_channel, channel, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.dmaGroupANotification_CallbackFunctionPointer != NULL)
+  {
+    Mock.dmaGroupANotification_CallbackFunctionPointer(inttype, channel, Mock.dmaGroupANotification_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_dmaGroupANotification(CMOCK_dmaGroupANotification_CALL_INSTANCE* cmock_call_instance, dmaInterrupt_t inttype, uint32 channel);
+void CMockExpectParameters_dmaGroupANotification(CMOCK_dmaGroupANotification_CALL_INSTANCE* cmock_call_instance, dmaInterrupt_t inttype, uint32 channel)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_inttype), (void*)(&inttype),
+         sizeof(dmaInterrupt_t[sizeof(inttype) == sizeof(dmaInterrupt_t) ? 1 : -1])); /* add dmaInterrupt_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_inttype = 0;
+  cmock_call_instance->Expected_channel = channel;
+  cmock_call_instance->IgnoreArg_channel = 0;
+}
+
+void dmaGroupANotification_CMockIgnore(void)
+{
+  Mock.dmaGroupANotification_IgnoreBool = (char)1;
+}
+
+void dmaGroupANotification_CMockStopIgnore(void)
+{
+  Mock.dmaGroupANotification_IgnoreBool = (char)0;
+}
+
+void dmaGroupANotification_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaInterrupt_t inttype, uint32 channel)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaGroupANotification_CALL_INSTANCE));
+  CMOCK_dmaGroupANotification_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaGroupANotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaGroupANotification_CallInstance = CMock_Guts_MemChain(Mock.dmaGroupANotification_CallInstance, cmock_guts_index);
+  Mock.dmaGroupANotification_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaGroupANotification(cmock_call_instance, inttype, channel);
+}
+
+void dmaGroupANotification_AddCallback(CMOCK_dmaGroupANotification_CALLBACK Callback)
+{
+  Mock.dmaGroupANotification_IgnoreBool = (char)0;
+  Mock.dmaGroupANotification_CallbackBool = (char)1;
+  Mock.dmaGroupANotification_CallbackFunctionPointer = Callback;
+}
+
+void dmaGroupANotification_Stub(CMOCK_dmaGroupANotification_CALLBACK Callback)
+{
+  Mock.dmaGroupANotification_IgnoreBool = (char)0;
+  Mock.dmaGroupANotification_CallbackBool = (char)0;
+  Mock.dmaGroupANotification_CallbackFunctionPointer = Callback;
+}
+
+void dmaGroupANotification_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaInterrupt_t inttype, uint32 channel, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_dmaGroupANotification_CALL_INSTANCE));
+  CMOCK_dmaGroupANotification_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaGroupANotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.dmaGroupANotification_CallInstance = CMock_Guts_MemChain(Mock.dmaGroupANotification_CallInstance, cmock_guts_index);
+  Mock.dmaGroupANotification_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_dmaGroupANotification(cmock_call_instance, inttype, channel);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void dmaGroupANotification_CMockIgnoreArg_inttype(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaGroupANotification_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaGroupANotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaGroupANotification_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_inttype = 1;
+}
+
+void dmaGroupANotification_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_dmaGroupANotification_CALL_INSTANCE* cmock_call_instance = (CMOCK_dmaGroupANotification_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.dmaGroupANotification_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_channel = 1;
+}
+
@@ -0,0 +1,140 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKHL_SYS_DMA_H
+#define _MOCKHL_SYS_DMA_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "HL_sys_dma.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void MockHL_sys_dma_Init(void);
+void MockHL_sys_dma_Destroy(void);
+void MockHL_sys_dma_Verify(void);
+
+
+
+
+#define dmaEnable_Ignore() dmaEnable_CMockIgnore()
+void dmaEnable_CMockIgnore(void);
+#define dmaEnable_StopIgnore() dmaEnable_CMockStopIgnore()
+void dmaEnable_CMockStopIgnore(void);
+#define dmaEnable_Expect() dmaEnable_CMockExpect(__LINE__)
+void dmaEnable_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_dmaEnable_CALLBACK)(int cmock_num_calls);
+void dmaEnable_AddCallback(CMOCK_dmaEnable_CALLBACK Callback);
+void dmaEnable_Stub(CMOCK_dmaEnable_CALLBACK Callback);
+#define dmaEnable_StubWithCallback dmaEnable_Stub
+#define dmaEnable_ExpectAndThrow(cmock_to_throw) dmaEnable_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void dmaEnable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define dmaReqAssign_Ignore() dmaReqAssign_CMockIgnore()
+void dmaReqAssign_CMockIgnore(void);
+#define dmaReqAssign_StopIgnore() dmaReqAssign_CMockStopIgnore()
+void dmaReqAssign_CMockStopIgnore(void);
+#define dmaReqAssign_Expect(channel, reqline) dmaReqAssign_CMockExpect(__LINE__, channel, reqline)
+void dmaReqAssign_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaRequest_t reqline);
+typedef void (* CMOCK_dmaReqAssign_CALLBACK)(dmaChannel_t channel, dmaRequest_t reqline, int cmock_num_calls);
+void dmaReqAssign_AddCallback(CMOCK_dmaReqAssign_CALLBACK Callback);
+void dmaReqAssign_Stub(CMOCK_dmaReqAssign_CALLBACK Callback);
+#define dmaReqAssign_StubWithCallback dmaReqAssign_Stub
+#define dmaReqAssign_ExpectAndThrow(channel, reqline, cmock_to_throw) dmaReqAssign_CMockExpectAndThrow(__LINE__, channel, reqline, cmock_to_throw)
+void dmaReqAssign_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaRequest_t reqline, CEXCEPTION_T cmock_to_throw);
+#define dmaReqAssign_IgnoreArg_channel() dmaReqAssign_CMockIgnoreArg_channel(__LINE__)
+void dmaReqAssign_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line);
+#define dmaReqAssign_IgnoreArg_reqline() dmaReqAssign_CMockIgnoreArg_reqline(__LINE__)
+void dmaReqAssign_CMockIgnoreArg_reqline(UNITY_LINE_TYPE cmock_line);
+#define dmaSetCtrlPacket_Ignore() dmaSetCtrlPacket_CMockIgnore()
+void dmaSetCtrlPacket_CMockIgnore(void);
+#define dmaSetCtrlPacket_StopIgnore() dmaSetCtrlPacket_CMockStopIgnore()
+void dmaSetCtrlPacket_CMockStopIgnore(void);
+#define dmaSetCtrlPacket_Expect(channel, g_dmaCTRLPKT) dmaSetCtrlPacket_CMockExpect(__LINE__, channel, g_dmaCTRLPKT)
+void dmaSetCtrlPacket_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT);
+typedef void (* CMOCK_dmaSetCtrlPacket_CALLBACK)(dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT, int cmock_num_calls);
+void dmaSetCtrlPacket_AddCallback(CMOCK_dmaSetCtrlPacket_CALLBACK Callback);
+void dmaSetCtrlPacket_Stub(CMOCK_dmaSetCtrlPacket_CALLBACK Callback);
+#define dmaSetCtrlPacket_StubWithCallback dmaSetCtrlPacket_Stub
+#define dmaSetCtrlPacket_ExpectAndThrow(channel, g_dmaCTRLPKT, cmock_to_throw) dmaSetCtrlPacket_CMockExpectAndThrow(__LINE__, channel, g_dmaCTRLPKT, cmock_to_throw)
+void dmaSetCtrlPacket_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT, CEXCEPTION_T cmock_to_throw);
+#define dmaSetCtrlPacket_IgnoreArg_channel() dmaSetCtrlPacket_CMockIgnoreArg_channel(__LINE__)
+void dmaSetCtrlPacket_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line);
+#define dmaSetCtrlPacket_IgnoreArg_g_dmaCTRLPKT() dmaSetCtrlPacket_CMockIgnoreArg_g_dmaCTRLPKT(__LINE__)
+void dmaSetCtrlPacket_CMockIgnoreArg_g_dmaCTRLPKT(UNITY_LINE_TYPE cmock_line);
+#define dmaSetChEnable_Ignore() dmaSetChEnable_CMockIgnore()
+void dmaSetChEnable_CMockIgnore(void);
+#define dmaSetChEnable_StopIgnore() dmaSetChEnable_CMockStopIgnore()
+void dmaSetChEnable_CMockStopIgnore(void);
+#define dmaSetChEnable_Expect(channel, type) dmaSetChEnable_CMockExpect(__LINE__, channel, type)
+void dmaSetChEnable_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaTriggerType_t type);
+typedef void (* CMOCK_dmaSetChEnable_CALLBACK)(dmaChannel_t channel, dmaTriggerType_t type, int cmock_num_calls);
+void dmaSetChEnable_AddCallback(CMOCK_dmaSetChEnable_CALLBACK Callback);
+void dmaSetChEnable_Stub(CMOCK_dmaSetChEnable_CALLBACK Callback);
+#define dmaSetChEnable_StubWithCallback dmaSetChEnable_Stub
+#define dmaSetChEnable_ExpectAndThrow(channel, type, cmock_to_throw) dmaSetChEnable_CMockExpectAndThrow(__LINE__, channel, type, cmock_to_throw)
+void dmaSetChEnable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaTriggerType_t type, CEXCEPTION_T cmock_to_throw);
+#define dmaSetChEnable_IgnoreArg_channel() dmaSetChEnable_CMockIgnoreArg_channel(__LINE__)
+void dmaSetChEnable_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line);
+#define dmaSetChEnable_IgnoreArg_type() dmaSetChEnable_CMockIgnoreArg_type(__LINE__)
+void dmaSetChEnable_CMockIgnoreArg_type(UNITY_LINE_TYPE cmock_line);
+#define dmaEnableInterrupt_Ignore() dmaEnableInterrupt_CMockIgnore()
+void dmaEnableInterrupt_CMockIgnore(void);
+#define dmaEnableInterrupt_StopIgnore() dmaEnableInterrupt_CMockStopIgnore()
+void dmaEnableInterrupt_CMockStopIgnore(void);
+#define dmaEnableInterrupt_Expect(channel, inttype, group) dmaEnableInterrupt_CMockExpect(__LINE__, channel, inttype, group)
+void dmaEnableInterrupt_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group);
+typedef void (* CMOCK_dmaEnableInterrupt_CALLBACK)(dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group, int cmock_num_calls);
+void dmaEnableInterrupt_AddCallback(CMOCK_dmaEnableInterrupt_CALLBACK Callback);
+void dmaEnableInterrupt_Stub(CMOCK_dmaEnableInterrupt_CALLBACK Callback);
+#define dmaEnableInterrupt_StubWithCallback dmaEnableInterrupt_Stub
+#define dmaEnableInterrupt_ExpectAndThrow(channel, inttype, group, cmock_to_throw) dmaEnableInterrupt_CMockExpectAndThrow(__LINE__, channel, inttype, group, cmock_to_throw)
+void dmaEnableInterrupt_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group, CEXCEPTION_T cmock_to_throw);
+#define dmaEnableInterrupt_IgnoreArg_channel() dmaEnableInterrupt_CMockIgnoreArg_channel(__LINE__)
+void dmaEnableInterrupt_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line);
+#define dmaEnableInterrupt_IgnoreArg_inttype() dmaEnableInterrupt_CMockIgnoreArg_inttype(__LINE__)
+void dmaEnableInterrupt_CMockIgnoreArg_inttype(UNITY_LINE_TYPE cmock_line);
+#define dmaEnableInterrupt_IgnoreArg_group() dmaEnableInterrupt_CMockIgnoreArg_group(__LINE__)
+void dmaEnableInterrupt_CMockIgnoreArg_group(UNITY_LINE_TYPE cmock_line);
+#define dmaGroupANotification_Ignore() dmaGroupANotification_CMockIgnore()
+void dmaGroupANotification_CMockIgnore(void);
+#define dmaGroupANotification_StopIgnore() dmaGroupANotification_CMockStopIgnore()
+void dmaGroupANotification_CMockStopIgnore(void);
+#define dmaGroupANotification_Expect(inttype, channel) dmaGroupANotification_CMockExpect(__LINE__, inttype, channel)
+void dmaGroupANotification_CMockExpect(UNITY_LINE_TYPE cmock_line, dmaInterrupt_t inttype, uint32 channel);
+typedef void (* CMOCK_dmaGroupANotification_CALLBACK)(dmaInterrupt_t inttype, uint32 channel, int cmock_num_calls);
+void dmaGroupANotification_AddCallback(CMOCK_dmaGroupANotification_CALLBACK Callback);
+void dmaGroupANotification_Stub(CMOCK_dmaGroupANotification_CALLBACK Callback);
+#define dmaGroupANotification_StubWithCallback dmaGroupANotification_Stub
+#define dmaGroupANotification_ExpectAndThrow(inttype, channel, cmock_to_throw) dmaGroupANotification_CMockExpectAndThrow(__LINE__, inttype, channel, cmock_to_throw)
+void dmaGroupANotification_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, dmaInterrupt_t inttype, uint32 channel, CEXCEPTION_T cmock_to_throw);
+#define dmaGroupANotification_IgnoreArg_inttype() dmaGroupANotification_CMockIgnoreArg_inttype(__LINE__)
+void dmaGroupANotification_CMockIgnoreArg_inttype(UNITY_LINE_TYPE cmock_line);
+#define dmaGroupANotification_IgnoreArg_channel() dmaGroupANotification_CMockIgnoreArg_channel(__LINE__)
+void dmaGroupANotification_CMockIgnoreArg_channel(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
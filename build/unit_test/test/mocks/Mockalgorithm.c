@@ -0,0 +1,785 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockalgorithm.h"
+
+static const char* CMockString_ALGO_GetStatistics = "ALGO_GetStatistics";
+static const char* CMockString_ALGO_MainFunction = "ALGO_MainFunction";
+static const char* CMockString_ALGO_MonitorExecutionTime = "ALGO_MonitorExecutionTime";
+static const char* CMockString_ALGO_UnlockInitialization = "ALGO_UnlockInitialization";
+static const char* CMockString_TEST_ALGO_ResetInitializationRequest = "TEST_ALGO_ResetInitializationRequest";
+static const char* CMockString_TEST_ALGO_ResetScheduler = "TEST_ALGO_ResetScheduler";
+static const char* CMockString_algorithmIndex = "algorithmIndex";
+static const char* CMockString_pStatistics = "pStatistics";
+
+typedef struct _CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE;
+
+typedef struct _CMOCK_ALGO_MainFunction_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_ALGO_MainFunction_CALL_INSTANCE;
+
+typedef struct _CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE;
+
+typedef struct _CMOCK_ALGO_GetStatistics_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint16_t Expected_algorithmIndex;
+  ALGO_STATISTICS_s* Expected_pStatistics;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pStatistics_Used;
+  ALGO_STATISTICS_s* ReturnThruPtr_pStatistics_Val;
+  size_t ReturnThruPtr_pStatistics_Size;
+  char IgnoreArg_algorithmIndex;
+  char IgnoreArg_pStatistics;
+
+} CMOCK_ALGO_GetStatistics_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE;
+
+static struct MockalgorithmInstance
+{
+  char ALGO_UnlockInitialization_IgnoreBool;
+  char ALGO_UnlockInitialization_CallbackBool;
+  CMOCK_ALGO_UnlockInitialization_CALLBACK ALGO_UnlockInitialization_CallbackFunctionPointer;
+  int ALGO_UnlockInitialization_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE ALGO_UnlockInitialization_CallInstance;
+  char ALGO_MainFunction_IgnoreBool;
+  char ALGO_MainFunction_CallbackBool;
+  CMOCK_ALGO_MainFunction_CALLBACK ALGO_MainFunction_CallbackFunctionPointer;
+  int ALGO_MainFunction_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE ALGO_MainFunction_CallInstance;
+  char ALGO_MonitorExecutionTime_IgnoreBool;
+  char ALGO_MonitorExecutionTime_CallbackBool;
+  CMOCK_ALGO_MonitorExecutionTime_CALLBACK ALGO_MonitorExecutionTime_CallbackFunctionPointer;
+  int ALGO_MonitorExecutionTime_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE ALGO_MonitorExecutionTime_CallInstance;
+  char ALGO_GetStatistics_IgnoreBool;
+  char ALGO_GetStatistics_CallbackBool;
+  CMOCK_ALGO_GetStatistics_CALLBACK ALGO_GetStatistics_CallbackFunctionPointer;
+  int ALGO_GetStatistics_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE ALGO_GetStatistics_CallInstance;
+  char TEST_ALGO_ResetInitializationRequest_IgnoreBool;
+  char TEST_ALGO_ResetInitializationRequest_CallbackBool;
+  CMOCK_TEST_ALGO_ResetInitializationRequest_CALLBACK TEST_ALGO_ResetInitializationRequest_CallbackFunctionPointer;
+  int TEST_ALGO_ResetInitializationRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_ALGO_ResetInitializationRequest_CallInstance;
+  char TEST_ALGO_ResetScheduler_IgnoreBool;
+  char TEST_ALGO_ResetScheduler_CallbackBool;
+  CMOCK_TEST_ALGO_ResetScheduler_CALLBACK TEST_ALGO_ResetScheduler_CallbackFunctionPointer;
+  int TEST_ALGO_ResetScheduler_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_ALGO_ResetScheduler_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockalgorithm_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.ALGO_UnlockInitialization_CallInstance;
+  if (Mock.ALGO_UnlockInitialization_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_ALGO_UnlockInitialization);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.ALGO_UnlockInitialization_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.ALGO_MainFunction_CallInstance;
+  if (Mock.ALGO_MainFunction_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_ALGO_MainFunction);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.ALGO_MainFunction_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.ALGO_MonitorExecutionTime_CallInstance;
+  if (Mock.ALGO_MonitorExecutionTime_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_ALGO_MonitorExecutionTime);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.ALGO_MonitorExecutionTime_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.ALGO_GetStatistics_CallInstance;
+  if (Mock.ALGO_GetStatistics_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_ALGO_GetStatistics);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.ALGO_GetStatistics_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_ALGO_ResetInitializationRequest_CallInstance;
+  if (Mock.TEST_ALGO_ResetInitializationRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_ALGO_ResetInitializationRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_ALGO_ResetInitializationRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_ALGO_ResetScheduler_CallInstance;
+  if (Mock.TEST_ALGO_ResetScheduler_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_ALGO_ResetScheduler);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_ALGO_ResetScheduler_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockalgorithm_Init(void)
+{
+  Mockalgorithm_Destroy();
+}
+
+void Mockalgorithm_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void ALGO_UnlockInitialization(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_ALGO_UnlockInitialization);
+  cmock_call_instance = (CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.ALGO_UnlockInitialization_CallInstance);
+  Mock.ALGO_UnlockInitialization_CallInstance = CMock_Guts_MemNext(Mock.ALGO_UnlockInitialization_CallInstance);
+  if (Mock.ALGO_UnlockInitialization_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.ALGO_UnlockInitialization_CallbackBool &&
+      Mock.ALGO_UnlockInitialization_CallbackFunctionPointer != NULL)
+  {
+    Mock.ALGO_UnlockInitialization_CallbackFunctionPointer(Mock.ALGO_UnlockInitialization_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.ALGO_UnlockInitialization_CallbackFunctionPointer != NULL)
+  {
+    Mock.ALGO_UnlockInitialization_CallbackFunctionPointer(Mock.ALGO_UnlockInitialization_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void ALGO_UnlockInitialization_CMockIgnore(void)
+{
+  Mock.ALGO_UnlockInitialization_IgnoreBool = (char)1;
+}
+
+void ALGO_UnlockInitialization_CMockStopIgnore(void)
+{
+  Mock.ALGO_UnlockInitialization_IgnoreBool = (char)0;
+}
+
+void ALGO_UnlockInitialization_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE));
+  CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ALGO_UnlockInitialization_CallInstance = CMock_Guts_MemChain(Mock.ALGO_UnlockInitialization_CallInstance, cmock_guts_index);
+  Mock.ALGO_UnlockInitialization_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void ALGO_UnlockInitialization_AddCallback(CMOCK_ALGO_UnlockInitialization_CALLBACK Callback)
+{
+  Mock.ALGO_UnlockInitialization_IgnoreBool = (char)0;
+  Mock.ALGO_UnlockInitialization_CallbackBool = (char)1;
+  Mock.ALGO_UnlockInitialization_CallbackFunctionPointer = Callback;
+}
+
+void ALGO_UnlockInitialization_Stub(CMOCK_ALGO_UnlockInitialization_CALLBACK Callback)
+{
+  Mock.ALGO_UnlockInitialization_IgnoreBool = (char)0;
+  Mock.ALGO_UnlockInitialization_CallbackBool = (char)0;
+  Mock.ALGO_UnlockInitialization_CallbackFunctionPointer = Callback;
+}
+
+void ALGO_UnlockInitialization_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE));
+  CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_UnlockInitialization_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ALGO_UnlockInitialization_CallInstance = CMock_Guts_MemChain(Mock.ALGO_UnlockInitialization_CallInstance, cmock_guts_index);
+  Mock.ALGO_UnlockInitialization_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void ALGO_MainFunction(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_ALGO_MainFunction_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_ALGO_MainFunction);
+  cmock_call_instance = (CMOCK_ALGO_MainFunction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.ALGO_MainFunction_CallInstance);
+  Mock.ALGO_MainFunction_CallInstance = CMock_Guts_MemNext(Mock.ALGO_MainFunction_CallInstance);
+  if (Mock.ALGO_MainFunction_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.ALGO_MainFunction_CallbackBool &&
+      Mock.ALGO_MainFunction_CallbackFunctionPointer != NULL)
+  {
+    Mock.ALGO_MainFunction_CallbackFunctionPointer(Mock.ALGO_MainFunction_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.ALGO_MainFunction_CallbackFunctionPointer != NULL)
+  {
+    Mock.ALGO_MainFunction_CallbackFunctionPointer(Mock.ALGO_MainFunction_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void ALGO_MainFunction_CMockIgnore(void)
+{
+  Mock.ALGO_MainFunction_IgnoreBool = (char)1;
+}
+
+void ALGO_MainFunction_CMockStopIgnore(void)
+{
+  Mock.ALGO_MainFunction_IgnoreBool = (char)0;
+}
+
+void ALGO_MainFunction_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ALGO_MainFunction_CALL_INSTANCE));
+  CMOCK_ALGO_MainFunction_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_MainFunction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ALGO_MainFunction_CallInstance = CMock_Guts_MemChain(Mock.ALGO_MainFunction_CallInstance, cmock_guts_index);
+  Mock.ALGO_MainFunction_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void ALGO_MainFunction_AddCallback(CMOCK_ALGO_MainFunction_CALLBACK Callback)
+{
+  Mock.ALGO_MainFunction_IgnoreBool = (char)0;
+  Mock.ALGO_MainFunction_CallbackBool = (char)1;
+  Mock.ALGO_MainFunction_CallbackFunctionPointer = Callback;
+}
+
+void ALGO_MainFunction_Stub(CMOCK_ALGO_MainFunction_CALLBACK Callback)
+{
+  Mock.ALGO_MainFunction_IgnoreBool = (char)0;
+  Mock.ALGO_MainFunction_CallbackBool = (char)0;
+  Mock.ALGO_MainFunction_CallbackFunctionPointer = Callback;
+}
+
+void ALGO_MainFunction_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ALGO_MainFunction_CALL_INSTANCE));
+  CMOCK_ALGO_MainFunction_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_MainFunction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ALGO_MainFunction_CallInstance = CMock_Guts_MemChain(Mock.ALGO_MainFunction_CallInstance, cmock_guts_index);
+  Mock.ALGO_MainFunction_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void ALGO_MonitorExecutionTime(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_ALGO_MonitorExecutionTime);
+  cmock_call_instance = (CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.ALGO_MonitorExecutionTime_CallInstance);
+  Mock.ALGO_MonitorExecutionTime_CallInstance = CMock_Guts_MemNext(Mock.ALGO_MonitorExecutionTime_CallInstance);
+  if (Mock.ALGO_MonitorExecutionTime_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.ALGO_MonitorExecutionTime_CallbackBool &&
+      Mock.ALGO_MonitorExecutionTime_CallbackFunctionPointer != NULL)
+  {
+    Mock.ALGO_MonitorExecutionTime_CallbackFunctionPointer(Mock.ALGO_MonitorExecutionTime_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.ALGO_MonitorExecutionTime_CallbackFunctionPointer != NULL)
+  {
+    Mock.ALGO_MonitorExecutionTime_CallbackFunctionPointer(Mock.ALGO_MonitorExecutionTime_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void ALGO_MonitorExecutionTime_CMockIgnore(void)
+{
+  Mock.ALGO_MonitorExecutionTime_IgnoreBool = (char)1;
+}
+
+void ALGO_MonitorExecutionTime_CMockStopIgnore(void)
+{
+  Mock.ALGO_MonitorExecutionTime_IgnoreBool = (char)0;
+}
+
+void ALGO_MonitorExecutionTime_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE));
+  CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ALGO_MonitorExecutionTime_CallInstance = CMock_Guts_MemChain(Mock.ALGO_MonitorExecutionTime_CallInstance, cmock_guts_index);
+  Mock.ALGO_MonitorExecutionTime_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void ALGO_MonitorExecutionTime_AddCallback(CMOCK_ALGO_MonitorExecutionTime_CALLBACK Callback)
+{
+  Mock.ALGO_MonitorExecutionTime_IgnoreBool = (char)0;
+  Mock.ALGO_MonitorExecutionTime_CallbackBool = (char)1;
+  Mock.ALGO_MonitorExecutionTime_CallbackFunctionPointer = Callback;
+}
+
+void ALGO_MonitorExecutionTime_Stub(CMOCK_ALGO_MonitorExecutionTime_CALLBACK Callback)
+{
+  Mock.ALGO_MonitorExecutionTime_IgnoreBool = (char)0;
+  Mock.ALGO_MonitorExecutionTime_CallbackBool = (char)0;
+  Mock.ALGO_MonitorExecutionTime_CallbackFunctionPointer = Callback;
+}
+
+void ALGO_MonitorExecutionTime_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE));
+  CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_MonitorExecutionTime_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ALGO_MonitorExecutionTime_CallInstance = CMock_Guts_MemChain(Mock.ALGO_MonitorExecutionTime_CallInstance, cmock_guts_index);
+  Mock.ALGO_MonitorExecutionTime_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void ALGO_GetStatistics(uint16_t algorithmIndex, ALGO_STATISTICS_s* pStatistics)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_ALGO_GetStatistics_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_ALGO_GetStatistics);
+  cmock_call_instance = (CMOCK_ALGO_GetStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.ALGO_GetStatistics_CallInstance);
+  Mock.ALGO_GetStatistics_CallInstance = CMock_Guts_MemNext(Mock.ALGO_GetStatistics_CallInstance);
+  if (Mock.ALGO_GetStatistics_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.ALGO_GetStatistics_CallbackBool &&
+      Mock.ALGO_GetStatistics_CallbackFunctionPointer != NULL)
+  {
+    Mock.ALGO_GetStatistics_CallbackFunctionPointer(algorithmIndex, pStatistics, Mock.ALGO_GetStatistics_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_algorithmIndex)
+  {
+    UNITY_SET_DETAILS(CMockString_ALGO_GetStatistics,CMockString_algorithmIndex);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_algorithmIndex, algorithmIndex, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pStatistics)
+  {
+    UNITY_SET_DETAILS(CMockString_ALGO_GetStatistics,CMockString_pStatistics);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pStatistics), (void*)(pStatistics), sizeof(ALGO_STATISTICS_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.ALGO_GetStatistics_CallbackFunctionPointer != NULL)
+  {
+    Mock.ALGO_GetStatistics_CallbackFunctionPointer(algorithmIndex, pStatistics, Mock.ALGO_GetStatistics_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pStatistics_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pStatistics, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pStatistics, (void*)cmock_call_instance->ReturnThruPtr_pStatistics_Val,
+      cmock_call_instance->ReturnThruPtr_pStatistics_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_ALGO_GetStatistics(CMOCK_ALGO_GetStatistics_CALL_INSTANCE* cmock_call_instance, uint16_t algorithmIndex, ALGO_STATISTICS_s* pStatistics);
+void CMockExpectParameters_ALGO_GetStatistics(CMOCK_ALGO_GetStatistics_CALL_INSTANCE* cmock_call_instance, uint16_t algorithmIndex, ALGO_STATISTICS_s* pStatistics)
+{
+  cmock_call_instance->Expected_algorithmIndex = algorithmIndex;
+  cmock_call_instance->IgnoreArg_algorithmIndex = 0;
+  cmock_call_instance->Expected_pStatistics = pStatistics;
+  cmock_call_instance->IgnoreArg_pStatistics = 0;
+  cmock_call_instance->ReturnThruPtr_pStatistics_Used = 0;
+}
+
+void ALGO_GetStatistics_CMockIgnore(void)
+{
+  Mock.ALGO_GetStatistics_IgnoreBool = (char)1;
+}
+
+void ALGO_GetStatistics_CMockStopIgnore(void)
+{
+  Mock.ALGO_GetStatistics_IgnoreBool = (char)0;
+}
+
+void ALGO_GetStatistics_CMockExpect(UNITY_LINE_TYPE cmock_line, uint16_t algorithmIndex, ALGO_STATISTICS_s* pStatistics)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ALGO_GetStatistics_CALL_INSTANCE));
+  CMOCK_ALGO_GetStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_GetStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ALGO_GetStatistics_CallInstance = CMock_Guts_MemChain(Mock.ALGO_GetStatistics_CallInstance, cmock_guts_index);
+  Mock.ALGO_GetStatistics_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_ALGO_GetStatistics(cmock_call_instance, algorithmIndex, pStatistics);
+}
+
+void ALGO_GetStatistics_AddCallback(CMOCK_ALGO_GetStatistics_CALLBACK Callback)
+{
+  Mock.ALGO_GetStatistics_IgnoreBool = (char)0;
+  Mock.ALGO_GetStatistics_CallbackBool = (char)1;
+  Mock.ALGO_GetStatistics_CallbackFunctionPointer = Callback;
+}
+
+void ALGO_GetStatistics_Stub(CMOCK_ALGO_GetStatistics_CALLBACK Callback)
+{
+  Mock.ALGO_GetStatistics_IgnoreBool = (char)0;
+  Mock.ALGO_GetStatistics_CallbackBool = (char)0;
+  Mock.ALGO_GetStatistics_CallbackFunctionPointer = Callback;
+}
+
+void ALGO_GetStatistics_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t algorithmIndex, ALGO_STATISTICS_s* pStatistics, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ALGO_GetStatistics_CALL_INSTANCE));
+  CMOCK_ALGO_GetStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_GetStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ALGO_GetStatistics_CallInstance = CMock_Guts_MemChain(Mock.ALGO_GetStatistics_CallInstance, cmock_guts_index);
+  Mock.ALGO_GetStatistics_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_ALGO_GetStatistics(cmock_call_instance, algorithmIndex, pStatistics);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void ALGO_GetStatistics_CMockReturnMemThruPtr_pStatistics(UNITY_LINE_TYPE cmock_line, ALGO_STATISTICS_s* pStatistics, size_t cmock_size)
+{
+  CMOCK_ALGO_GetStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_GetStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.ALGO_GetStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pStatistics_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pStatistics_Val = pStatistics;
+  cmock_call_instance->ReturnThruPtr_pStatistics_Size = cmock_size;
+}
+
+void ALGO_GetStatistics_CMockIgnoreArg_algorithmIndex(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_ALGO_GetStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_GetStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.ALGO_GetStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_algorithmIndex = 1;
+}
+
+void ALGO_GetStatistics_CMockIgnoreArg_pStatistics(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_ALGO_GetStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_ALGO_GetStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.ALGO_GetStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pStatistics = 1;
+}
+
+void TEST_ALGO_ResetInitializationRequest(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_ALGO_ResetInitializationRequest);
+  cmock_call_instance = (CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_ALGO_ResetInitializationRequest_CallInstance);
+  Mock.TEST_ALGO_ResetInitializationRequest_CallInstance = CMock_Guts_MemNext(Mock.TEST_ALGO_ResetInitializationRequest_CallInstance);
+  if (Mock.TEST_ALGO_ResetInitializationRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_ALGO_ResetInitializationRequest_CallbackBool &&
+      Mock.TEST_ALGO_ResetInitializationRequest_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_ALGO_ResetInitializationRequest_CallbackFunctionPointer(Mock.TEST_ALGO_ResetInitializationRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_ALGO_ResetInitializationRequest_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_ALGO_ResetInitializationRequest_CallbackFunctionPointer(Mock.TEST_ALGO_ResetInitializationRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void TEST_ALGO_ResetInitializationRequest_CMockIgnore(void)
+{
+  Mock.TEST_ALGO_ResetInitializationRequest_IgnoreBool = (char)1;
+}
+
+void TEST_ALGO_ResetInitializationRequest_CMockStopIgnore(void)
+{
+  Mock.TEST_ALGO_ResetInitializationRequest_IgnoreBool = (char)0;
+}
+
+void TEST_ALGO_ResetInitializationRequest_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE));
+  CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_ALGO_ResetInitializationRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_ALGO_ResetInitializationRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_ALGO_ResetInitializationRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void TEST_ALGO_ResetInitializationRequest_AddCallback(CMOCK_TEST_ALGO_ResetInitializationRequest_CALLBACK Callback)
+{
+  Mock.TEST_ALGO_ResetInitializationRequest_IgnoreBool = (char)0;
+  Mock.TEST_ALGO_ResetInitializationRequest_CallbackBool = (char)1;
+  Mock.TEST_ALGO_ResetInitializationRequest_CallbackFunctionPointer = Callback;
+}
+
+void TEST_ALGO_ResetInitializationRequest_Stub(CMOCK_TEST_ALGO_ResetInitializationRequest_CALLBACK Callback)
+{
+  Mock.TEST_ALGO_ResetInitializationRequest_IgnoreBool = (char)0;
+  Mock.TEST_ALGO_ResetInitializationRequest_CallbackBool = (char)0;
+  Mock.TEST_ALGO_ResetInitializationRequest_CallbackFunctionPointer = Callback;
+}
+
+void TEST_ALGO_ResetInitializationRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE));
+  CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_ALGO_ResetInitializationRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_ALGO_ResetInitializationRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_ALGO_ResetInitializationRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_ALGO_ResetInitializationRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_ALGO_ResetScheduler(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_ALGO_ResetScheduler);
+  cmock_call_instance = (CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_ALGO_ResetScheduler_CallInstance);
+  Mock.TEST_ALGO_ResetScheduler_CallInstance = CMock_Guts_MemNext(Mock.TEST_ALGO_ResetScheduler_CallInstance);
+  if (Mock.TEST_ALGO_ResetScheduler_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_ALGO_ResetScheduler_CallbackBool &&
+      Mock.TEST_ALGO_ResetScheduler_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_ALGO_ResetScheduler_CallbackFunctionPointer(Mock.TEST_ALGO_ResetScheduler_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_ALGO_ResetScheduler_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_ALGO_ResetScheduler_CallbackFunctionPointer(Mock.TEST_ALGO_ResetScheduler_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void TEST_ALGO_ResetScheduler_CMockIgnore(void)
+{
+  Mock.TEST_ALGO_ResetScheduler_IgnoreBool = (char)1;
+}
+
+void TEST_ALGO_ResetScheduler_CMockStopIgnore(void)
+{
+  Mock.TEST_ALGO_ResetScheduler_IgnoreBool = (char)0;
+}
+
+void TEST_ALGO_ResetScheduler_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE));
+  CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_ALGO_ResetScheduler_CallInstance = CMock_Guts_MemChain(Mock.TEST_ALGO_ResetScheduler_CallInstance, cmock_guts_index);
+  Mock.TEST_ALGO_ResetScheduler_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void TEST_ALGO_ResetScheduler_AddCallback(CMOCK_TEST_ALGO_ResetScheduler_CALLBACK Callback)
+{
+  Mock.TEST_ALGO_ResetScheduler_IgnoreBool = (char)0;
+  Mock.TEST_ALGO_ResetScheduler_CallbackBool = (char)1;
+  Mock.TEST_ALGO_ResetScheduler_CallbackFunctionPointer = Callback;
+}
+
+void TEST_ALGO_ResetScheduler_Stub(CMOCK_TEST_ALGO_ResetScheduler_CALLBACK Callback)
+{
+  Mock.TEST_ALGO_ResetScheduler_IgnoreBool = (char)0;
+  Mock.TEST_ALGO_ResetScheduler_CallbackBool = (char)0;
+  Mock.TEST_ALGO_ResetScheduler_CallbackFunctionPointer = Callback;
+}
+
+void TEST_ALGO_ResetScheduler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE));
+  CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_ALGO_ResetScheduler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_ALGO_ResetScheduler_CallInstance = CMock_Guts_MemChain(Mock.TEST_ALGO_ResetScheduler_CallInstance, cmock_guts_index);
+  Mock.TEST_ALGO_ResetScheduler_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
@@ -0,0 +1,126 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKALGORITHM_H
+#define _MOCKALGORITHM_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "algorithm.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockalgorithm_Init(void);
+void Mockalgorithm_Destroy(void);
+void Mockalgorithm_Verify(void);
+
+
+
+
+#define ALGO_UnlockInitialization_Ignore() ALGO_UnlockInitialization_CMockIgnore()
+void ALGO_UnlockInitialization_CMockIgnore(void);
+#define ALGO_UnlockInitialization_StopIgnore() ALGO_UnlockInitialization_CMockStopIgnore()
+void ALGO_UnlockInitialization_CMockStopIgnore(void);
+#define ALGO_UnlockInitialization_Expect() ALGO_UnlockInitialization_CMockExpect(__LINE__)
+void ALGO_UnlockInitialization_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_ALGO_UnlockInitialization_CALLBACK)(int cmock_num_calls);
+void ALGO_UnlockInitialization_AddCallback(CMOCK_ALGO_UnlockInitialization_CALLBACK Callback);
+void ALGO_UnlockInitialization_Stub(CMOCK_ALGO_UnlockInitialization_CALLBACK Callback);
+#define ALGO_UnlockInitialization_StubWithCallback ALGO_UnlockInitialization_Stub
+#define ALGO_UnlockInitialization_ExpectAndThrow(cmock_to_throw) ALGO_UnlockInitialization_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void ALGO_UnlockInitialization_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define ALGO_MainFunction_Ignore() ALGO_MainFunction_CMockIgnore()
+void ALGO_MainFunction_CMockIgnore(void);
+#define ALGO_MainFunction_StopIgnore() ALGO_MainFunction_CMockStopIgnore()
+void ALGO_MainFunction_CMockStopIgnore(void);
+#define ALGO_MainFunction_Expect() ALGO_MainFunction_CMockExpect(__LINE__)
+void ALGO_MainFunction_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_ALGO_MainFunction_CALLBACK)(int cmock_num_calls);
+void ALGO_MainFunction_AddCallback(CMOCK_ALGO_MainFunction_CALLBACK Callback);
+void ALGO_MainFunction_Stub(CMOCK_ALGO_MainFunction_CALLBACK Callback);
+#define ALGO_MainFunction_StubWithCallback ALGO_MainFunction_Stub
+#define ALGO_MainFunction_ExpectAndThrow(cmock_to_throw) ALGO_MainFunction_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void ALGO_MainFunction_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define ALGO_MonitorExecutionTime_Ignore() ALGO_MonitorExecutionTime_CMockIgnore()
+void ALGO_MonitorExecutionTime_CMockIgnore(void);
+#define ALGO_MonitorExecutionTime_StopIgnore() ALGO_MonitorExecutionTime_CMockStopIgnore()
+void ALGO_MonitorExecutionTime_CMockStopIgnore(void);
+#define ALGO_MonitorExecutionTime_Expect() ALGO_MonitorExecutionTime_CMockExpect(__LINE__)
+void ALGO_MonitorExecutionTime_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_ALGO_MonitorExecutionTime_CALLBACK)(int cmock_num_calls);
+void ALGO_MonitorExecutionTime_AddCallback(CMOCK_ALGO_MonitorExecutionTime_CALLBACK Callback);
+void ALGO_MonitorExecutionTime_Stub(CMOCK_ALGO_MonitorExecutionTime_CALLBACK Callback);
+#define ALGO_MonitorExecutionTime_StubWithCallback ALGO_MonitorExecutionTime_Stub
+#define ALGO_MonitorExecutionTime_ExpectAndThrow(cmock_to_throw) ALGO_MonitorExecutionTime_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void ALGO_MonitorExecutionTime_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define ALGO_GetStatistics_Ignore() ALGO_GetStatistics_CMockIgnore()
+void ALGO_GetStatistics_CMockIgnore(void);
+#define ALGO_GetStatistics_StopIgnore() ALGO_GetStatistics_CMockStopIgnore()
+void ALGO_GetStatistics_CMockStopIgnore(void);
+#define ALGO_GetStatistics_Expect(algorithmIndex, pStatistics) ALGO_GetStatistics_CMockExpect(__LINE__, algorithmIndex, pStatistics)
+void ALGO_GetStatistics_CMockExpect(UNITY_LINE_TYPE cmock_line, uint16_t algorithmIndex, ALGO_STATISTICS_s* pStatistics);
+typedef void (* CMOCK_ALGO_GetStatistics_CALLBACK)(uint16_t algorithmIndex, ALGO_STATISTICS_s* pStatistics, int cmock_num_calls);
+void ALGO_GetStatistics_AddCallback(CMOCK_ALGO_GetStatistics_CALLBACK Callback);
+void ALGO_GetStatistics_Stub(CMOCK_ALGO_GetStatistics_CALLBACK Callback);
+#define ALGO_GetStatistics_StubWithCallback ALGO_GetStatistics_Stub
+#define ALGO_GetStatistics_ExpectAndThrow(algorithmIndex, pStatistics, cmock_to_throw) ALGO_GetStatistics_CMockExpectAndThrow(__LINE__, algorithmIndex, pStatistics, cmock_to_throw)
+void ALGO_GetStatistics_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t algorithmIndex, ALGO_STATISTICS_s* pStatistics, CEXCEPTION_T cmock_to_throw);
+#define ALGO_GetStatistics_ReturnThruPtr_pStatistics(pStatistics) ALGO_GetStatistics_CMockReturnMemThruPtr_pStatistics(__LINE__, pStatistics, sizeof(ALGO_STATISTICS_s))
+#define ALGO_GetStatistics_ReturnArrayThruPtr_pStatistics(pStatistics, cmock_len) ALGO_GetStatistics_CMockReturnMemThruPtr_pStatistics(__LINE__, pStatistics, cmock_len * sizeof(*pStatistics))
+#define ALGO_GetStatistics_ReturnMemThruPtr_pStatistics(pStatistics, cmock_size) ALGO_GetStatistics_CMockReturnMemThruPtr_pStatistics(__LINE__, pStatistics, cmock_size)
+void ALGO_GetStatistics_CMockReturnMemThruPtr_pStatistics(UNITY_LINE_TYPE cmock_line, ALGO_STATISTICS_s* pStatistics, size_t cmock_size);
+#define ALGO_GetStatistics_IgnoreArg_algorithmIndex() ALGO_GetStatistics_CMockIgnoreArg_algorithmIndex(__LINE__)
+void ALGO_GetStatistics_CMockIgnoreArg_algorithmIndex(UNITY_LINE_TYPE cmock_line);
+#define ALGO_GetStatistics_IgnoreArg_pStatistics() ALGO_GetStatistics_CMockIgnoreArg_pStatistics(__LINE__)
+void ALGO_GetStatistics_CMockIgnoreArg_pStatistics(UNITY_LINE_TYPE cmock_line);
+#define TEST_ALGO_ResetInitializationRequest_Ignore() TEST_ALGO_ResetInitializationRequest_CMockIgnore()
+void TEST_ALGO_ResetInitializationRequest_CMockIgnore(void);
+#define TEST_ALGO_ResetInitializationRequest_StopIgnore() TEST_ALGO_ResetInitializationRequest_CMockStopIgnore()
+void TEST_ALGO_ResetInitializationRequest_CMockStopIgnore(void);
+#define TEST_ALGO_ResetInitializationRequest_Expect() TEST_ALGO_ResetInitializationRequest_CMockExpect(__LINE__)
+void TEST_ALGO_ResetInitializationRequest_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_TEST_ALGO_ResetInitializationRequest_CALLBACK)(int cmock_num_calls);
+void TEST_ALGO_ResetInitializationRequest_AddCallback(CMOCK_TEST_ALGO_ResetInitializationRequest_CALLBACK Callback);
+void TEST_ALGO_ResetInitializationRequest_Stub(CMOCK_TEST_ALGO_ResetInitializationRequest_CALLBACK Callback);
+#define TEST_ALGO_ResetInitializationRequest_StubWithCallback TEST_ALGO_ResetInitializationRequest_Stub
+#define TEST_ALGO_ResetInitializationRequest_ExpectAndThrow(cmock_to_throw) TEST_ALGO_ResetInitializationRequest_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_ALGO_ResetInitializationRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_ALGO_ResetScheduler_Ignore() TEST_ALGO_ResetScheduler_CMockIgnore()
+void TEST_ALGO_ResetScheduler_CMockIgnore(void);
+#define TEST_ALGO_ResetScheduler_StopIgnore() TEST_ALGO_ResetScheduler_CMockStopIgnore()
+void TEST_ALGO_ResetScheduler_CMockStopIgnore(void);
+#define TEST_ALGO_ResetScheduler_Expect() TEST_ALGO_ResetScheduler_CMockExpect(__LINE__)
+void TEST_ALGO_ResetScheduler_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_TEST_ALGO_ResetScheduler_CALLBACK)(int cmock_num_calls);
+void TEST_ALGO_ResetScheduler_AddCallback(CMOCK_TEST_ALGO_ResetScheduler_CALLBACK Callback);
+void TEST_ALGO_ResetScheduler_Stub(CMOCK_TEST_ALGO_ResetScheduler_CALLBACK Callback);
+#define TEST_ALGO_ResetScheduler_StubWithCallback TEST_ALGO_ResetScheduler_Stub
+#define TEST_ALGO_ResetScheduler_ExpectAndThrow(cmock_to_throw) TEST_ALGO_ResetScheduler_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_ALGO_ResetScheduler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,2218 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockbal.h"
+
+static const char* CMockString_BAL_CheckReEntrance = "BAL_CheckReEntrance";
+static const char* CMockString_BAL_CheckStateRequest = "BAL_CheckStateRequest";
+static const char* CMockString_BAL_GetInitializationState = "BAL_GetInitializationState";
+static const char* CMockString_BAL_GetState = "BAL_GetState";
+static const char* CMockString_BAL_Init = "BAL_Init";
+static const char* CMockString_BAL_ProcessStateInitialization = "BAL_ProcessStateInitialization";
+static const char* CMockString_BAL_ProcessStateInitialized = "BAL_ProcessStateInitialized";
+static const char* CMockString_BAL_ProcessStateUninitalized = "BAL_ProcessStateUninitalized";
+static const char* CMockString_BAL_SaveLastStates = "BAL_SaveLastStates";
+static const char* CMockString_BAL_SetStateRequest = "BAL_SetStateRequest";
+static const char* CMockString_BAL_TransferStateRequest = "BAL_TransferStateRequest";
+static const char* CMockString_BAL_Trigger = "BAL_Trigger";
+static const char* CMockString_TEST_BAL_GetBalancingControl = "TEST_BAL_GetBalancingControl";
+static const char* CMockString_TEST_BAL_GetBalancingState = "TEST_BAL_GetBalancingState";
+static const char* CMockString_currentState = "currentState";
+static const char* CMockString_pBalancingState = "pBalancingState";
+static const char* CMockString_pControl = "pControl";
+static const char* CMockString_pCurrentState = "pCurrentState";
+static const char* CMockString_stateRequest = "stateRequest";
+
+typedef struct _CMOCK_BAL_SaveLastStates_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  BAL_STATE_s* Expected_pBalancingState;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pBalancingState_Used;
+  BAL_STATE_s* ReturnThruPtr_pBalancingState_Val;
+  size_t ReturnThruPtr_pBalancingState_Size;
+  char IgnoreArg_pBalancingState;
+
+} CMOCK_BAL_SaveLastStates_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_CheckReEntrance_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  BAL_STATE_s* Expected_currentState;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_currentState_Used;
+  BAL_STATE_s* ReturnThruPtr_currentState_Val;
+  size_t ReturnThruPtr_currentState_Size;
+  char IgnoreArg_currentState;
+
+} CMOCK_BAL_CheckReEntrance_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_TransferStateRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BAL_STATE_REQUEST_e ReturnVal;
+  int CallOrder;
+  BAL_STATE_s* Expected_currentState;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_currentState_Used;
+  BAL_STATE_s* ReturnThruPtr_currentState_Val;
+  size_t ReturnThruPtr_currentState_Size;
+  char IgnoreArg_currentState;
+
+} CMOCK_BAL_TransferStateRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_CheckStateRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BAL_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  BAL_STATE_s* Expected_pCurrentState;
+  BAL_STATE_REQUEST_e Expected_stateRequest;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCurrentState_Used;
+  BAL_STATE_s* ReturnThruPtr_pCurrentState_Val;
+  size_t ReturnThruPtr_pCurrentState_Size;
+  char IgnoreArg_pCurrentState;
+  char IgnoreArg_stateRequest;
+
+} CMOCK_BAL_CheckStateRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  BAL_STATE_s* Expected_pCurrentState;
+  BAL_STATE_REQUEST_e Expected_stateRequest;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCurrentState_Used;
+  BAL_STATE_s* ReturnThruPtr_pCurrentState_Val;
+  size_t ReturnThruPtr_pCurrentState_Size;
+  char IgnoreArg_pCurrentState;
+  char IgnoreArg_stateRequest;
+
+} CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  BAL_STATE_s* Expected_currentState;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_currentState_Used;
+  BAL_STATE_s* ReturnThruPtr_currentState_Val;
+  size_t ReturnThruPtr_currentState_Size;
+  char IgnoreArg_currentState;
+
+} CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  BAL_STATE_s* Expected_currentState;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_currentState_Used;
+  BAL_STATE_s* ReturnThruPtr_currentState_Val;
+  size_t ReturnThruPtr_currentState_Size;
+  char IgnoreArg_currentState;
+
+} CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_Init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  DATA_BLOCK_BALANCING_CONTROL_s* Expected_pControl;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pControl_Used;
+  DATA_BLOCK_BALANCING_CONTROL_s* ReturnThruPtr_pControl_Val;
+  size_t ReturnThruPtr_pControl_Size;
+  char IgnoreArg_pControl;
+
+} CMOCK_BAL_Init_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_SetStateRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BAL_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  BAL_STATE_REQUEST_e Expected_stateRequest;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stateRequest;
+
+} CMOCK_BAL_SetStateRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_GetInitializationState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_BAL_GetInitializationState_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_Trigger_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_BAL_Trigger_CALL_INSTANCE;
+
+typedef struct _CMOCK_BAL_GetState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BAL_STATEMACH_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_BAL_GetState_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  DATA_BLOCK_BALANCING_CONTROL_s* ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BAL_STATE_s* ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE;
+
+static struct MockbalInstance
+{
+  char BAL_SaveLastStates_IgnoreBool;
+  char BAL_SaveLastStates_CallbackBool;
+  CMOCK_BAL_SaveLastStates_CALLBACK BAL_SaveLastStates_CallbackFunctionPointer;
+  int BAL_SaveLastStates_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_SaveLastStates_CallInstance;
+  char BAL_CheckReEntrance_IgnoreBool;
+  uint8_t BAL_CheckReEntrance_FinalReturn;
+  char BAL_CheckReEntrance_CallbackBool;
+  CMOCK_BAL_CheckReEntrance_CALLBACK BAL_CheckReEntrance_CallbackFunctionPointer;
+  int BAL_CheckReEntrance_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_CheckReEntrance_CallInstance;
+  char BAL_TransferStateRequest_IgnoreBool;
+  BAL_STATE_REQUEST_e BAL_TransferStateRequest_FinalReturn;
+  char BAL_TransferStateRequest_CallbackBool;
+  CMOCK_BAL_TransferStateRequest_CALLBACK BAL_TransferStateRequest_CallbackFunctionPointer;
+  int BAL_TransferStateRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_TransferStateRequest_CallInstance;
+  char BAL_CheckStateRequest_IgnoreBool;
+  BAL_RETURN_TYPE_e BAL_CheckStateRequest_FinalReturn;
+  char BAL_CheckStateRequest_CallbackBool;
+  CMOCK_BAL_CheckStateRequest_CALLBACK BAL_CheckStateRequest_CallbackFunctionPointer;
+  int BAL_CheckStateRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_CheckStateRequest_CallInstance;
+  char BAL_ProcessStateUninitalized_IgnoreBool;
+  char BAL_ProcessStateUninitalized_CallbackBool;
+  CMOCK_BAL_ProcessStateUninitalized_CALLBACK BAL_ProcessStateUninitalized_CallbackFunctionPointer;
+  int BAL_ProcessStateUninitalized_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_ProcessStateUninitalized_CallInstance;
+  char BAL_ProcessStateInitialization_IgnoreBool;
+  char BAL_ProcessStateInitialization_CallbackBool;
+  CMOCK_BAL_ProcessStateInitialization_CALLBACK BAL_ProcessStateInitialization_CallbackFunctionPointer;
+  int BAL_ProcessStateInitialization_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_ProcessStateInitialization_CallInstance;
+  char BAL_ProcessStateInitialized_IgnoreBool;
+  char BAL_ProcessStateInitialized_CallbackBool;
+  CMOCK_BAL_ProcessStateInitialized_CALLBACK BAL_ProcessStateInitialized_CallbackFunctionPointer;
+  int BAL_ProcessStateInitialized_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_ProcessStateInitialized_CallInstance;
+  char BAL_Init_IgnoreBool;
+  STD_RETURN_TYPE_e BAL_Init_FinalReturn;
+  char BAL_Init_CallbackBool;
+  CMOCK_BAL_Init_CALLBACK BAL_Init_CallbackFunctionPointer;
+  int BAL_Init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_Init_CallInstance;
+  char BAL_SetStateRequest_IgnoreBool;
+  BAL_RETURN_TYPE_e BAL_SetStateRequest_FinalReturn;
+  char BAL_SetStateRequest_CallbackBool;
+  CMOCK_BAL_SetStateRequest_CALLBACK BAL_SetStateRequest_CallbackFunctionPointer;
+  int BAL_SetStateRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_SetStateRequest_CallInstance;
+  char BAL_GetInitializationState_IgnoreBool;
+  STD_RETURN_TYPE_e BAL_GetInitializationState_FinalReturn;
+  char BAL_GetInitializationState_CallbackBool;
+  CMOCK_BAL_GetInitializationState_CALLBACK BAL_GetInitializationState_CallbackFunctionPointer;
+  int BAL_GetInitializationState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_GetInitializationState_CallInstance;
+  char BAL_Trigger_IgnoreBool;
+  char BAL_Trigger_CallbackBool;
+  CMOCK_BAL_Trigger_CALLBACK BAL_Trigger_CallbackFunctionPointer;
+  int BAL_Trigger_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_Trigger_CallInstance;
+  char BAL_GetState_IgnoreBool;
+  BAL_STATEMACH_e BAL_GetState_FinalReturn;
+  char BAL_GetState_CallbackBool;
+  CMOCK_BAL_GetState_CALLBACK BAL_GetState_CallbackFunctionPointer;
+  int BAL_GetState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BAL_GetState_CallInstance;
+  char TEST_BAL_GetBalancingControl_IgnoreBool;
+  DATA_BLOCK_BALANCING_CONTROL_s* TEST_BAL_GetBalancingControl_FinalReturn;
+  char TEST_BAL_GetBalancingControl_CallbackBool;
+  CMOCK_TEST_BAL_GetBalancingControl_CALLBACK TEST_BAL_GetBalancingControl_CallbackFunctionPointer;
+  int TEST_BAL_GetBalancingControl_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BAL_GetBalancingControl_CallInstance;
+  char TEST_BAL_GetBalancingState_IgnoreBool;
+  BAL_STATE_s* TEST_BAL_GetBalancingState_FinalReturn;
+  char TEST_BAL_GetBalancingState_CallbackBool;
+  CMOCK_TEST_BAL_GetBalancingState_CALLBACK TEST_BAL_GetBalancingState_CallbackFunctionPointer;
+  int TEST_BAL_GetBalancingState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BAL_GetBalancingState_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockbal_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.BAL_SaveLastStates_CallInstance;
+  if (Mock.BAL_SaveLastStates_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_SaveLastStates);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_SaveLastStates_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_CheckReEntrance_CallInstance;
+  if (Mock.BAL_CheckReEntrance_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_CheckReEntrance);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_CheckReEntrance_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_TransferStateRequest_CallInstance;
+  if (Mock.BAL_TransferStateRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_TransferStateRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_TransferStateRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_CheckStateRequest_CallInstance;
+  if (Mock.BAL_CheckStateRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_CheckStateRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_CheckStateRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_ProcessStateUninitalized_CallInstance;
+  if (Mock.BAL_ProcessStateUninitalized_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_ProcessStateUninitalized);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_ProcessStateUninitalized_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_ProcessStateInitialization_CallInstance;
+  if (Mock.BAL_ProcessStateInitialization_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_ProcessStateInitialization);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_ProcessStateInitialization_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_ProcessStateInitialized_CallInstance;
+  if (Mock.BAL_ProcessStateInitialized_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_ProcessStateInitialized);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_ProcessStateInitialized_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_Init_CallInstance;
+  if (Mock.BAL_Init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_Init);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_Init_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_SetStateRequest_CallInstance;
+  if (Mock.BAL_SetStateRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_SetStateRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_GetInitializationState_CallInstance;
+  if (Mock.BAL_GetInitializationState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_GetInitializationState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_GetInitializationState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_Trigger_CallInstance;
+  if (Mock.BAL_Trigger_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_Trigger);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_Trigger_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BAL_GetState_CallInstance;
+  if (Mock.BAL_GetState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BAL_GetState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BAL_GetState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BAL_GetBalancingControl_CallInstance;
+  if (Mock.TEST_BAL_GetBalancingControl_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BAL_GetBalancingControl);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BAL_GetBalancingControl_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BAL_GetBalancingState_CallInstance;
+  if (Mock.TEST_BAL_GetBalancingState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BAL_GetBalancingState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BAL_GetBalancingState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockbal_Init(void)
+{
+  Mockbal_Destroy();
+}
+
+void Mockbal_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void BAL_SaveLastStates(BAL_STATE_s* pBalancingState)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_SaveLastStates_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_SaveLastStates);
+  cmock_call_instance = (CMOCK_BAL_SaveLastStates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_SaveLastStates_CallInstance);
+  Mock.BAL_SaveLastStates_CallInstance = CMock_Guts_MemNext(Mock.BAL_SaveLastStates_CallInstance);
+  if (Mock.BAL_SaveLastStates_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.BAL_SaveLastStates_CallbackBool &&
+      Mock.BAL_SaveLastStates_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_SaveLastStates_CallbackFunctionPointer(pBalancingState, Mock.BAL_SaveLastStates_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pBalancingState)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_SaveLastStates,CMockString_pBalancingState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pBalancingState), (void*)(pBalancingState), sizeof(BAL_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BAL_SaveLastStates_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_SaveLastStates_CallbackFunctionPointer(pBalancingState, Mock.BAL_SaveLastStates_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pBalancingState_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pBalancingState, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pBalancingState, (void*)cmock_call_instance->ReturnThruPtr_pBalancingState_Val,
+      cmock_call_instance->ReturnThruPtr_pBalancingState_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_BAL_SaveLastStates(CMOCK_BAL_SaveLastStates_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* pBalancingState);
+void CMockExpectParameters_BAL_SaveLastStates(CMOCK_BAL_SaveLastStates_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* pBalancingState)
+{
+  cmock_call_instance->Expected_pBalancingState = pBalancingState;
+  cmock_call_instance->IgnoreArg_pBalancingState = 0;
+  cmock_call_instance->ReturnThruPtr_pBalancingState_Used = 0;
+}
+
+void BAL_SaveLastStates_CMockIgnore(void)
+{
+  Mock.BAL_SaveLastStates_IgnoreBool = (char)1;
+}
+
+void BAL_SaveLastStates_CMockStopIgnore(void)
+{
+  Mock.BAL_SaveLastStates_IgnoreBool = (char)0;
+}
+
+void BAL_SaveLastStates_CMockExpect(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pBalancingState)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_SaveLastStates_CALL_INSTANCE));
+  CMOCK_BAL_SaveLastStates_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_SaveLastStates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_SaveLastStates_CallInstance = CMock_Guts_MemChain(Mock.BAL_SaveLastStates_CallInstance, cmock_guts_index);
+  Mock.BAL_SaveLastStates_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_SaveLastStates(cmock_call_instance, pBalancingState);
+}
+
+void BAL_SaveLastStates_AddCallback(CMOCK_BAL_SaveLastStates_CALLBACK Callback)
+{
+  Mock.BAL_SaveLastStates_IgnoreBool = (char)0;
+  Mock.BAL_SaveLastStates_CallbackBool = (char)1;
+  Mock.BAL_SaveLastStates_CallbackFunctionPointer = Callback;
+}
+
+void BAL_SaveLastStates_Stub(CMOCK_BAL_SaveLastStates_CALLBACK Callback)
+{
+  Mock.BAL_SaveLastStates_IgnoreBool = (char)0;
+  Mock.BAL_SaveLastStates_CallbackBool = (char)0;
+  Mock.BAL_SaveLastStates_CallbackFunctionPointer = Callback;
+}
+
+void BAL_SaveLastStates_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pBalancingState, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_SaveLastStates_CALL_INSTANCE));
+  CMOCK_BAL_SaveLastStates_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_SaveLastStates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_SaveLastStates_CallInstance = CMock_Guts_MemChain(Mock.BAL_SaveLastStates_CallInstance, cmock_guts_index);
+  Mock.BAL_SaveLastStates_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_SaveLastStates(cmock_call_instance, pBalancingState);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_SaveLastStates_CMockReturnMemThruPtr_pBalancingState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pBalancingState, size_t cmock_size)
+{
+  CMOCK_BAL_SaveLastStates_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_SaveLastStates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_SaveLastStates_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pBalancingState_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pBalancingState_Val = pBalancingState;
+  cmock_call_instance->ReturnThruPtr_pBalancingState_Size = cmock_size;
+}
+
+void BAL_SaveLastStates_CMockIgnoreArg_pBalancingState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_SaveLastStates_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_SaveLastStates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_SaveLastStates_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pBalancingState = 1;
+}
+
+uint8_t BAL_CheckReEntrance(BAL_STATE_s* currentState)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_CheckReEntrance_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_CheckReEntrance);
+  cmock_call_instance = (CMOCK_BAL_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_CheckReEntrance_CallInstance);
+  Mock.BAL_CheckReEntrance_CallInstance = CMock_Guts_MemNext(Mock.BAL_CheckReEntrance_CallInstance);
+  if (Mock.BAL_CheckReEntrance_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BAL_CheckReEntrance_FinalReturn;
+    Mock.BAL_CheckReEntrance_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BAL_CheckReEntrance_CallbackBool &&
+      Mock.BAL_CheckReEntrance_CallbackFunctionPointer != NULL)
+  {
+    uint8_t cmock_cb_ret = Mock.BAL_CheckReEntrance_CallbackFunctionPointer(currentState, Mock.BAL_CheckReEntrance_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_currentState)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_CheckReEntrance,CMockString_currentState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_currentState), (void*)(currentState), sizeof(BAL_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BAL_CheckReEntrance_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BAL_CheckReEntrance_CallbackFunctionPointer(currentState, Mock.BAL_CheckReEntrance_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_currentState_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(currentState, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)currentState, (void*)cmock_call_instance->ReturnThruPtr_currentState_Val,
+      cmock_call_instance->ReturnThruPtr_currentState_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_BAL_CheckReEntrance(CMOCK_BAL_CheckReEntrance_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* currentState);
+void CMockExpectParameters_BAL_CheckReEntrance(CMOCK_BAL_CheckReEntrance_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* currentState)
+{
+  cmock_call_instance->Expected_currentState = currentState;
+  cmock_call_instance->IgnoreArg_currentState = 0;
+  cmock_call_instance->ReturnThruPtr_currentState_Used = 0;
+}
+
+void BAL_CheckReEntrance_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_CheckReEntrance_CALL_INSTANCE));
+  CMOCK_BAL_CheckReEntrance_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_CheckReEntrance_CallInstance = CMock_Guts_MemChain(Mock.BAL_CheckReEntrance_CallInstance, cmock_guts_index);
+  Mock.BAL_CheckReEntrance_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BAL_CheckReEntrance_IgnoreBool = (char)1;
+}
+
+void BAL_CheckReEntrance_CMockStopIgnore(void)
+{
+  if(Mock.BAL_CheckReEntrance_IgnoreBool)
+    Mock.BAL_CheckReEntrance_CallInstance = CMock_Guts_MemNext(Mock.BAL_CheckReEntrance_CallInstance);
+  Mock.BAL_CheckReEntrance_IgnoreBool = (char)0;
+}
+
+void BAL_CheckReEntrance_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_CheckReEntrance_CALL_INSTANCE));
+  CMOCK_BAL_CheckReEntrance_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_CheckReEntrance_CallInstance = CMock_Guts_MemChain(Mock.BAL_CheckReEntrance_CallInstance, cmock_guts_index);
+  Mock.BAL_CheckReEntrance_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_CheckReEntrance(cmock_call_instance, currentState);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void BAL_CheckReEntrance_AddCallback(CMOCK_BAL_CheckReEntrance_CALLBACK Callback)
+{
+  Mock.BAL_CheckReEntrance_IgnoreBool = (char)0;
+  Mock.BAL_CheckReEntrance_CallbackBool = (char)1;
+  Mock.BAL_CheckReEntrance_CallbackFunctionPointer = Callback;
+}
+
+void BAL_CheckReEntrance_Stub(CMOCK_BAL_CheckReEntrance_CALLBACK Callback)
+{
+  Mock.BAL_CheckReEntrance_IgnoreBool = (char)0;
+  Mock.BAL_CheckReEntrance_CallbackBool = (char)0;
+  Mock.BAL_CheckReEntrance_CallbackFunctionPointer = Callback;
+}
+
+void BAL_CheckReEntrance_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_CheckReEntrance_CALL_INSTANCE));
+  CMOCK_BAL_CheckReEntrance_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_CheckReEntrance_CallInstance = CMock_Guts_MemChain(Mock.BAL_CheckReEntrance_CallInstance, cmock_guts_index);
+  Mock.BAL_CheckReEntrance_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_CheckReEntrance(cmock_call_instance, currentState);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_CheckReEntrance_CMockReturnMemThruPtr_currentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, size_t cmock_size)
+{
+  CMOCK_BAL_CheckReEntrance_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_CheckReEntrance_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_currentState_Used = 1;
+  cmock_call_instance->ReturnThruPtr_currentState_Val = currentState;
+  cmock_call_instance->ReturnThruPtr_currentState_Size = cmock_size;
+}
+
+void BAL_CheckReEntrance_CMockIgnoreArg_currentState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_CheckReEntrance_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_CheckReEntrance_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_currentState = 1;
+}
+
+BAL_STATE_REQUEST_e BAL_TransferStateRequest(BAL_STATE_s* currentState)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_TransferStateRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_TransferStateRequest);
+  cmock_call_instance = (CMOCK_BAL_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_TransferStateRequest_CallInstance);
+  Mock.BAL_TransferStateRequest_CallInstance = CMock_Guts_MemNext(Mock.BAL_TransferStateRequest_CallInstance);
+  if (Mock.BAL_TransferStateRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BAL_TransferStateRequest_FinalReturn;
+    memcpy((void*)(&Mock.BAL_TransferStateRequest_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BAL_STATE_REQUEST_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BAL_STATE_REQUEST_e) ? 1 : -1])); /* add BAL_STATE_REQUEST_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BAL_TransferStateRequest_CallbackBool &&
+      Mock.BAL_TransferStateRequest_CallbackFunctionPointer != NULL)
+  {
+    BAL_STATE_REQUEST_e cmock_cb_ret = Mock.BAL_TransferStateRequest_CallbackFunctionPointer(currentState, Mock.BAL_TransferStateRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_currentState)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_TransferStateRequest,CMockString_currentState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_currentState), (void*)(currentState), sizeof(BAL_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BAL_TransferStateRequest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BAL_TransferStateRequest_CallbackFunctionPointer(currentState, Mock.BAL_TransferStateRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_currentState_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(currentState, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)currentState, (void*)cmock_call_instance->ReturnThruPtr_currentState_Val,
+      cmock_call_instance->ReturnThruPtr_currentState_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_BAL_TransferStateRequest(CMOCK_BAL_TransferStateRequest_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* currentState);
+void CMockExpectParameters_BAL_TransferStateRequest(CMOCK_BAL_TransferStateRequest_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* currentState)
+{
+  cmock_call_instance->Expected_currentState = currentState;
+  cmock_call_instance->IgnoreArg_currentState = 0;
+  cmock_call_instance->ReturnThruPtr_currentState_Used = 0;
+}
+
+void BAL_TransferStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_REQUEST_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_TransferStateRequest_CALL_INSTANCE));
+  CMOCK_BAL_TransferStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_TransferStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BAL_TransferStateRequest_CallInstance, cmock_guts_index);
+  Mock.BAL_TransferStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BAL_TransferStateRequest_IgnoreBool = (char)1;
+}
+
+void BAL_TransferStateRequest_CMockStopIgnore(void)
+{
+  if(Mock.BAL_TransferStateRequest_IgnoreBool)
+    Mock.BAL_TransferStateRequest_CallInstance = CMock_Guts_MemNext(Mock.BAL_TransferStateRequest_CallInstance);
+  Mock.BAL_TransferStateRequest_IgnoreBool = (char)0;
+}
+
+void BAL_TransferStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, BAL_STATE_REQUEST_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_TransferStateRequest_CALL_INSTANCE));
+  CMOCK_BAL_TransferStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_TransferStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BAL_TransferStateRequest_CallInstance, cmock_guts_index);
+  Mock.BAL_TransferStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_TransferStateRequest(cmock_call_instance, currentState);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BAL_STATE_REQUEST_e[sizeof(cmock_to_return) == sizeof(BAL_STATE_REQUEST_e) ? 1 : -1])); /* add BAL_STATE_REQUEST_e to :treat_as_array if this causes an error */
+}
+
+void BAL_TransferStateRequest_AddCallback(CMOCK_BAL_TransferStateRequest_CALLBACK Callback)
+{
+  Mock.BAL_TransferStateRequest_IgnoreBool = (char)0;
+  Mock.BAL_TransferStateRequest_CallbackBool = (char)1;
+  Mock.BAL_TransferStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void BAL_TransferStateRequest_Stub(CMOCK_BAL_TransferStateRequest_CALLBACK Callback)
+{
+  Mock.BAL_TransferStateRequest_IgnoreBool = (char)0;
+  Mock.BAL_TransferStateRequest_CallbackBool = (char)0;
+  Mock.BAL_TransferStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void BAL_TransferStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_TransferStateRequest_CALL_INSTANCE));
+  CMOCK_BAL_TransferStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_TransferStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BAL_TransferStateRequest_CallInstance, cmock_guts_index);
+  Mock.BAL_TransferStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_TransferStateRequest(cmock_call_instance, currentState);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_TransferStateRequest_CMockReturnMemThruPtr_currentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, size_t cmock_size)
+{
+  CMOCK_BAL_TransferStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_TransferStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_currentState_Used = 1;
+  cmock_call_instance->ReturnThruPtr_currentState_Val = currentState;
+  cmock_call_instance->ReturnThruPtr_currentState_Size = cmock_size;
+}
+
+void BAL_TransferStateRequest_CMockIgnoreArg_currentState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_TransferStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_TransferStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_currentState = 1;
+}
+
+BAL_RETURN_TYPE_e BAL_CheckStateRequest(BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_CheckStateRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_CheckStateRequest);
+  cmock_call_instance = (CMOCK_BAL_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_CheckStateRequest_CallInstance);
+  Mock.BAL_CheckStateRequest_CallInstance = CMock_Guts_MemNext(Mock.BAL_CheckStateRequest_CallInstance);
+  if (Mock.BAL_CheckStateRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BAL_CheckStateRequest_FinalReturn;
+    memcpy((void*)(&Mock.BAL_CheckStateRequest_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BAL_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BAL_RETURN_TYPE_e) ? 1 : -1])); /* add BAL_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BAL_CheckStateRequest_CallbackBool &&
+      Mock.BAL_CheckStateRequest_CallbackFunctionPointer != NULL)
+  {
+    BAL_RETURN_TYPE_e cmock_cb_ret = Mock.BAL_CheckStateRequest_CallbackFunctionPointer(pCurrentState, stateRequest, Mock.BAL_CheckStateRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pCurrentState)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_CheckStateRequest,CMockString_pCurrentState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pCurrentState), (void*)(pCurrentState), sizeof(BAL_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_stateRequest)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_CheckStateRequest,CMockString_stateRequest);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stateRequest), (void*)(&stateRequest), sizeof(BAL_STATE_REQUEST_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BAL_CheckStateRequest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BAL_CheckStateRequest_CallbackFunctionPointer(pCurrentState, stateRequest, Mock.BAL_CheckStateRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCurrentState_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCurrentState, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCurrentState, (void*)cmock_call_instance->ReturnThruPtr_pCurrentState_Val,
+      cmock_call_instance->ReturnThruPtr_pCurrentState_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_BAL_CheckStateRequest(CMOCK_BAL_CheckStateRequest_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest);
+void CMockExpectParameters_BAL_CheckStateRequest(CMOCK_BAL_CheckStateRequest_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest)
+{
+  cmock_call_instance->Expected_pCurrentState = pCurrentState;
+  cmock_call_instance->IgnoreArg_pCurrentState = 0;
+  cmock_call_instance->ReturnThruPtr_pCurrentState_Used = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_stateRequest), (void*)(&stateRequest),
+         sizeof(BAL_STATE_REQUEST_e[sizeof(stateRequest) == sizeof(BAL_STATE_REQUEST_e) ? 1 : -1])); /* add BAL_STATE_REQUEST_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_stateRequest = 0;
+}
+
+void BAL_CheckStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_CheckStateRequest_CALL_INSTANCE));
+  CMOCK_BAL_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_CheckStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BAL_CheckStateRequest_CallInstance, cmock_guts_index);
+  Mock.BAL_CheckStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BAL_CheckStateRequest_IgnoreBool = (char)1;
+}
+
+void BAL_CheckStateRequest_CMockStopIgnore(void)
+{
+  if(Mock.BAL_CheckStateRequest_IgnoreBool)
+    Mock.BAL_CheckStateRequest_CallInstance = CMock_Guts_MemNext(Mock.BAL_CheckStateRequest_CallInstance);
+  Mock.BAL_CheckStateRequest_IgnoreBool = (char)0;
+}
+
+void BAL_CheckStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest, BAL_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_CheckStateRequest_CALL_INSTANCE));
+  CMOCK_BAL_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_CheckStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BAL_CheckStateRequest_CallInstance, cmock_guts_index);
+  Mock.BAL_CheckStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_CheckStateRequest(cmock_call_instance, pCurrentState, stateRequest);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BAL_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(BAL_RETURN_TYPE_e) ? 1 : -1])); /* add BAL_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void BAL_CheckStateRequest_AddCallback(CMOCK_BAL_CheckStateRequest_CALLBACK Callback)
+{
+  Mock.BAL_CheckStateRequest_IgnoreBool = (char)0;
+  Mock.BAL_CheckStateRequest_CallbackBool = (char)1;
+  Mock.BAL_CheckStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void BAL_CheckStateRequest_Stub(CMOCK_BAL_CheckStateRequest_CALLBACK Callback)
+{
+  Mock.BAL_CheckStateRequest_IgnoreBool = (char)0;
+  Mock.BAL_CheckStateRequest_CallbackBool = (char)0;
+  Mock.BAL_CheckStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void BAL_CheckStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_CheckStateRequest_CALL_INSTANCE));
+  CMOCK_BAL_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_CheckStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BAL_CheckStateRequest_CallInstance, cmock_guts_index);
+  Mock.BAL_CheckStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_CheckStateRequest(cmock_call_instance, pCurrentState, stateRequest);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_CheckStateRequest_CMockReturnMemThruPtr_pCurrentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, size_t cmock_size)
+{
+  CMOCK_BAL_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_CheckStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCurrentState_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCurrentState_Val = pCurrentState;
+  cmock_call_instance->ReturnThruPtr_pCurrentState_Size = cmock_size;
+}
+
+void BAL_CheckStateRequest_CMockIgnoreArg_pCurrentState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_CheckStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCurrentState = 1;
+}
+
+void BAL_CheckStateRequest_CMockIgnoreArg_stateRequest(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_CheckStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stateRequest = 1;
+}
+
+void BAL_ProcessStateUninitalized(BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_ProcessStateUninitalized);
+  cmock_call_instance = (CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_ProcessStateUninitalized_CallInstance);
+  Mock.BAL_ProcessStateUninitalized_CallInstance = CMock_Guts_MemNext(Mock.BAL_ProcessStateUninitalized_CallInstance);
+  if (Mock.BAL_ProcessStateUninitalized_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.BAL_ProcessStateUninitalized_CallbackBool &&
+      Mock.BAL_ProcessStateUninitalized_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_ProcessStateUninitalized_CallbackFunctionPointer(pCurrentState, stateRequest, Mock.BAL_ProcessStateUninitalized_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pCurrentState)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_ProcessStateUninitalized,CMockString_pCurrentState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pCurrentState), (void*)(pCurrentState), sizeof(BAL_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_stateRequest)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_ProcessStateUninitalized,CMockString_stateRequest);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stateRequest), (void*)(&stateRequest), sizeof(BAL_STATE_REQUEST_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BAL_ProcessStateUninitalized_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_ProcessStateUninitalized_CallbackFunctionPointer(pCurrentState, stateRequest, Mock.BAL_ProcessStateUninitalized_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCurrentState_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCurrentState, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCurrentState, (void*)cmock_call_instance->ReturnThruPtr_pCurrentState_Val,
+      cmock_call_instance->ReturnThruPtr_pCurrentState_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_BAL_ProcessStateUninitalized(CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest);
+void CMockExpectParameters_BAL_ProcessStateUninitalized(CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest)
+{
+  cmock_call_instance->Expected_pCurrentState = pCurrentState;
+  cmock_call_instance->IgnoreArg_pCurrentState = 0;
+  cmock_call_instance->ReturnThruPtr_pCurrentState_Used = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_stateRequest), (void*)(&stateRequest),
+         sizeof(BAL_STATE_REQUEST_e[sizeof(stateRequest) == sizeof(BAL_STATE_REQUEST_e) ? 1 : -1])); /* add BAL_STATE_REQUEST_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_stateRequest = 0;
+}
+
+void BAL_ProcessStateUninitalized_CMockIgnore(void)
+{
+  Mock.BAL_ProcessStateUninitalized_IgnoreBool = (char)1;
+}
+
+void BAL_ProcessStateUninitalized_CMockStopIgnore(void)
+{
+  Mock.BAL_ProcessStateUninitalized_IgnoreBool = (char)0;
+}
+
+void BAL_ProcessStateUninitalized_CMockExpect(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE));
+  CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_ProcessStateUninitalized_CallInstance = CMock_Guts_MemChain(Mock.BAL_ProcessStateUninitalized_CallInstance, cmock_guts_index);
+  Mock.BAL_ProcessStateUninitalized_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_ProcessStateUninitalized(cmock_call_instance, pCurrentState, stateRequest);
+}
+
+void BAL_ProcessStateUninitalized_AddCallback(CMOCK_BAL_ProcessStateUninitalized_CALLBACK Callback)
+{
+  Mock.BAL_ProcessStateUninitalized_IgnoreBool = (char)0;
+  Mock.BAL_ProcessStateUninitalized_CallbackBool = (char)1;
+  Mock.BAL_ProcessStateUninitalized_CallbackFunctionPointer = Callback;
+}
+
+void BAL_ProcessStateUninitalized_Stub(CMOCK_BAL_ProcessStateUninitalized_CALLBACK Callback)
+{
+  Mock.BAL_ProcessStateUninitalized_IgnoreBool = (char)0;
+  Mock.BAL_ProcessStateUninitalized_CallbackBool = (char)0;
+  Mock.BAL_ProcessStateUninitalized_CallbackFunctionPointer = Callback;
+}
+
+void BAL_ProcessStateUninitalized_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE));
+  CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_ProcessStateUninitalized_CallInstance = CMock_Guts_MemChain(Mock.BAL_ProcessStateUninitalized_CallInstance, cmock_guts_index);
+  Mock.BAL_ProcessStateUninitalized_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_ProcessStateUninitalized(cmock_call_instance, pCurrentState, stateRequest);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_ProcessStateUninitalized_CMockReturnMemThruPtr_pCurrentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, size_t cmock_size)
+{
+  CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_ProcessStateUninitalized_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCurrentState_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCurrentState_Val = pCurrentState;
+  cmock_call_instance->ReturnThruPtr_pCurrentState_Size = cmock_size;
+}
+
+void BAL_ProcessStateUninitalized_CMockIgnoreArg_pCurrentState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_ProcessStateUninitalized_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCurrentState = 1;
+}
+
+void BAL_ProcessStateUninitalized_CMockIgnoreArg_stateRequest(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateUninitalized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_ProcessStateUninitalized_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stateRequest = 1;
+}
+
+void BAL_ProcessStateInitialization(BAL_STATE_s* currentState)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_ProcessStateInitialization);
+  cmock_call_instance = (CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_ProcessStateInitialization_CallInstance);
+  Mock.BAL_ProcessStateInitialization_CallInstance = CMock_Guts_MemNext(Mock.BAL_ProcessStateInitialization_CallInstance);
+  if (Mock.BAL_ProcessStateInitialization_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.BAL_ProcessStateInitialization_CallbackBool &&
+      Mock.BAL_ProcessStateInitialization_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_ProcessStateInitialization_CallbackFunctionPointer(currentState, Mock.BAL_ProcessStateInitialization_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_currentState)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_ProcessStateInitialization,CMockString_currentState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_currentState), (void*)(currentState), sizeof(BAL_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BAL_ProcessStateInitialization_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_ProcessStateInitialization_CallbackFunctionPointer(currentState, Mock.BAL_ProcessStateInitialization_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_currentState_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(currentState, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)currentState, (void*)cmock_call_instance->ReturnThruPtr_currentState_Val,
+      cmock_call_instance->ReturnThruPtr_currentState_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_BAL_ProcessStateInitialization(CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* currentState);
+void CMockExpectParameters_BAL_ProcessStateInitialization(CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* currentState)
+{
+  cmock_call_instance->Expected_currentState = currentState;
+  cmock_call_instance->IgnoreArg_currentState = 0;
+  cmock_call_instance->ReturnThruPtr_currentState_Used = 0;
+}
+
+void BAL_ProcessStateInitialization_CMockIgnore(void)
+{
+  Mock.BAL_ProcessStateInitialization_IgnoreBool = (char)1;
+}
+
+void BAL_ProcessStateInitialization_CMockStopIgnore(void)
+{
+  Mock.BAL_ProcessStateInitialization_IgnoreBool = (char)0;
+}
+
+void BAL_ProcessStateInitialization_CMockExpect(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE));
+  CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_ProcessStateInitialization_CallInstance = CMock_Guts_MemChain(Mock.BAL_ProcessStateInitialization_CallInstance, cmock_guts_index);
+  Mock.BAL_ProcessStateInitialization_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_ProcessStateInitialization(cmock_call_instance, currentState);
+}
+
+void BAL_ProcessStateInitialization_AddCallback(CMOCK_BAL_ProcessStateInitialization_CALLBACK Callback)
+{
+  Mock.BAL_ProcessStateInitialization_IgnoreBool = (char)0;
+  Mock.BAL_ProcessStateInitialization_CallbackBool = (char)1;
+  Mock.BAL_ProcessStateInitialization_CallbackFunctionPointer = Callback;
+}
+
+void BAL_ProcessStateInitialization_Stub(CMOCK_BAL_ProcessStateInitialization_CALLBACK Callback)
+{
+  Mock.BAL_ProcessStateInitialization_IgnoreBool = (char)0;
+  Mock.BAL_ProcessStateInitialization_CallbackBool = (char)0;
+  Mock.BAL_ProcessStateInitialization_CallbackFunctionPointer = Callback;
+}
+
+void BAL_ProcessStateInitialization_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE));
+  CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_ProcessStateInitialization_CallInstance = CMock_Guts_MemChain(Mock.BAL_ProcessStateInitialization_CallInstance, cmock_guts_index);
+  Mock.BAL_ProcessStateInitialization_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_ProcessStateInitialization(cmock_call_instance, currentState);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_ProcessStateInitialization_CMockReturnMemThruPtr_currentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, size_t cmock_size)
+{
+  CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_ProcessStateInitialization_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_currentState_Used = 1;
+  cmock_call_instance->ReturnThruPtr_currentState_Val = currentState;
+  cmock_call_instance->ReturnThruPtr_currentState_Size = cmock_size;
+}
+
+void BAL_ProcessStateInitialization_CMockIgnoreArg_currentState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateInitialization_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_ProcessStateInitialization_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_currentState = 1;
+}
+
+void BAL_ProcessStateInitialized(BAL_STATE_s* currentState)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_ProcessStateInitialized);
+  cmock_call_instance = (CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_ProcessStateInitialized_CallInstance);
+  Mock.BAL_ProcessStateInitialized_CallInstance = CMock_Guts_MemNext(Mock.BAL_ProcessStateInitialized_CallInstance);
+  if (Mock.BAL_ProcessStateInitialized_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.BAL_ProcessStateInitialized_CallbackBool &&
+      Mock.BAL_ProcessStateInitialized_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_ProcessStateInitialized_CallbackFunctionPointer(currentState, Mock.BAL_ProcessStateInitialized_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_currentState)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_ProcessStateInitialized,CMockString_currentState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_currentState), (void*)(currentState), sizeof(BAL_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BAL_ProcessStateInitialized_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_ProcessStateInitialized_CallbackFunctionPointer(currentState, Mock.BAL_ProcessStateInitialized_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_currentState_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(currentState, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)currentState, (void*)cmock_call_instance->ReturnThruPtr_currentState_Val,
+      cmock_call_instance->ReturnThruPtr_currentState_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_BAL_ProcessStateInitialized(CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* currentState);
+void CMockExpectParameters_BAL_ProcessStateInitialized(CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE* cmock_call_instance, BAL_STATE_s* currentState)
+{
+  cmock_call_instance->Expected_currentState = currentState;
+  cmock_call_instance->IgnoreArg_currentState = 0;
+  cmock_call_instance->ReturnThruPtr_currentState_Used = 0;
+}
+
+void BAL_ProcessStateInitialized_CMockIgnore(void)
+{
+  Mock.BAL_ProcessStateInitialized_IgnoreBool = (char)1;
+}
+
+void BAL_ProcessStateInitialized_CMockStopIgnore(void)
+{
+  Mock.BAL_ProcessStateInitialized_IgnoreBool = (char)0;
+}
+
+void BAL_ProcessStateInitialized_CMockExpect(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE));
+  CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_ProcessStateInitialized_CallInstance = CMock_Guts_MemChain(Mock.BAL_ProcessStateInitialized_CallInstance, cmock_guts_index);
+  Mock.BAL_ProcessStateInitialized_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_ProcessStateInitialized(cmock_call_instance, currentState);
+}
+
+void BAL_ProcessStateInitialized_AddCallback(CMOCK_BAL_ProcessStateInitialized_CALLBACK Callback)
+{
+  Mock.BAL_ProcessStateInitialized_IgnoreBool = (char)0;
+  Mock.BAL_ProcessStateInitialized_CallbackBool = (char)1;
+  Mock.BAL_ProcessStateInitialized_CallbackFunctionPointer = Callback;
+}
+
+void BAL_ProcessStateInitialized_Stub(CMOCK_BAL_ProcessStateInitialized_CALLBACK Callback)
+{
+  Mock.BAL_ProcessStateInitialized_IgnoreBool = (char)0;
+  Mock.BAL_ProcessStateInitialized_CallbackBool = (char)0;
+  Mock.BAL_ProcessStateInitialized_CallbackFunctionPointer = Callback;
+}
+
+void BAL_ProcessStateInitialized_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE));
+  CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_ProcessStateInitialized_CallInstance = CMock_Guts_MemChain(Mock.BAL_ProcessStateInitialized_CallInstance, cmock_guts_index);
+  Mock.BAL_ProcessStateInitialized_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_ProcessStateInitialized(cmock_call_instance, currentState);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_ProcessStateInitialized_CMockReturnMemThruPtr_currentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, size_t cmock_size)
+{
+  CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_ProcessStateInitialized_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_currentState_Used = 1;
+  cmock_call_instance->ReturnThruPtr_currentState_Val = currentState;
+  cmock_call_instance->ReturnThruPtr_currentState_Size = cmock_size;
+}
+
+void BAL_ProcessStateInitialized_CMockIgnoreArg_currentState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_ProcessStateInitialized_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_ProcessStateInitialized_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_currentState = 1;
+}
+
+STD_RETURN_TYPE_e BAL_Init(DATA_BLOCK_BALANCING_CONTROL_s* pControl)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_Init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_Init);
+  cmock_call_instance = (CMOCK_BAL_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_Init_CallInstance);
+  Mock.BAL_Init_CallInstance = CMock_Guts_MemNext(Mock.BAL_Init_CallInstance);
+  if (Mock.BAL_Init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BAL_Init_FinalReturn;
+    memcpy((void*)(&Mock.BAL_Init_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BAL_Init_CallbackBool &&
+      Mock.BAL_Init_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.BAL_Init_CallbackFunctionPointer(pControl, Mock.BAL_Init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pControl)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_Init,CMockString_pControl);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pControl), (void*)(pControl), sizeof(DATA_BLOCK_BALANCING_CONTROL_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BAL_Init_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BAL_Init_CallbackFunctionPointer(pControl, Mock.BAL_Init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pControl_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pControl, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pControl, (void*)cmock_call_instance->ReturnThruPtr_pControl_Val,
+      cmock_call_instance->ReturnThruPtr_pControl_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_BAL_Init(CMOCK_BAL_Init_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_BALANCING_CONTROL_s* pControl);
+void CMockExpectParameters_BAL_Init(CMOCK_BAL_Init_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_BALANCING_CONTROL_s* pControl)
+{
+  cmock_call_instance->Expected_pControl = pControl;
+  cmock_call_instance->IgnoreArg_pControl = 0;
+  cmock_call_instance->ReturnThruPtr_pControl_Used = 0;
+}
+
+void BAL_Init_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_Init_CALL_INSTANCE));
+  CMOCK_BAL_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_Init_CallInstance = CMock_Guts_MemChain(Mock.BAL_Init_CallInstance, cmock_guts_index);
+  Mock.BAL_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BAL_Init_IgnoreBool = (char)1;
+}
+
+void BAL_Init_CMockStopIgnore(void)
+{
+  if(Mock.BAL_Init_IgnoreBool)
+    Mock.BAL_Init_CallInstance = CMock_Guts_MemNext(Mock.BAL_Init_CallInstance);
+  Mock.BAL_Init_IgnoreBool = (char)0;
+}
+
+void BAL_Init_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* pControl, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_Init_CALL_INSTANCE));
+  CMOCK_BAL_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_Init_CallInstance = CMock_Guts_MemChain(Mock.BAL_Init_CallInstance, cmock_guts_index);
+  Mock.BAL_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_Init(cmock_call_instance, pControl);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void BAL_Init_AddCallback(CMOCK_BAL_Init_CALLBACK Callback)
+{
+  Mock.BAL_Init_IgnoreBool = (char)0;
+  Mock.BAL_Init_CallbackBool = (char)1;
+  Mock.BAL_Init_CallbackFunctionPointer = Callback;
+}
+
+void BAL_Init_Stub(CMOCK_BAL_Init_CALLBACK Callback)
+{
+  Mock.BAL_Init_IgnoreBool = (char)0;
+  Mock.BAL_Init_CallbackBool = (char)0;
+  Mock.BAL_Init_CallbackFunctionPointer = Callback;
+}
+
+void BAL_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* pControl, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_Init_CALL_INSTANCE));
+  CMOCK_BAL_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_Init_CallInstance = CMock_Guts_MemChain(Mock.BAL_Init_CallInstance, cmock_guts_index);
+  Mock.BAL_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_Init(cmock_call_instance, pControl);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_Init_CMockReturnMemThruPtr_pControl(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* pControl, size_t cmock_size)
+{
+  CMOCK_BAL_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_Init_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pControl_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pControl_Val = pControl;
+  cmock_call_instance->ReturnThruPtr_pControl_Size = cmock_size;
+}
+
+void BAL_Init_CMockIgnoreArg_pControl(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_Init_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pControl = 1;
+}
+
+BAL_RETURN_TYPE_e BAL_SetStateRequest(BAL_STATE_REQUEST_e stateRequest)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_SetStateRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_SetStateRequest);
+  cmock_call_instance = (CMOCK_BAL_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_SetStateRequest_CallInstance);
+  Mock.BAL_SetStateRequest_CallInstance = CMock_Guts_MemNext(Mock.BAL_SetStateRequest_CallInstance);
+  if (Mock.BAL_SetStateRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BAL_SetStateRequest_FinalReturn;
+    memcpy((void*)(&Mock.BAL_SetStateRequest_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BAL_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BAL_RETURN_TYPE_e) ? 1 : -1])); /* add BAL_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BAL_SetStateRequest_CallbackBool &&
+      Mock.BAL_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    BAL_RETURN_TYPE_e cmock_cb_ret = Mock.BAL_SetStateRequest_CallbackFunctionPointer(stateRequest, Mock.BAL_SetStateRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stateRequest)
+  {
+    UNITY_SET_DETAILS(CMockString_BAL_SetStateRequest,CMockString_stateRequest);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stateRequest), (void*)(&stateRequest), sizeof(BAL_STATE_REQUEST_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BAL_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BAL_SetStateRequest_CallbackFunctionPointer(stateRequest, Mock.BAL_SetStateRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_BAL_SetStateRequest(CMOCK_BAL_SetStateRequest_CALL_INSTANCE* cmock_call_instance, BAL_STATE_REQUEST_e stateRequest);
+void CMockExpectParameters_BAL_SetStateRequest(CMOCK_BAL_SetStateRequest_CALL_INSTANCE* cmock_call_instance, BAL_STATE_REQUEST_e stateRequest)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_stateRequest), (void*)(&stateRequest),
+         sizeof(BAL_STATE_REQUEST_e[sizeof(stateRequest) == sizeof(BAL_STATE_REQUEST_e) ? 1 : -1])); /* add BAL_STATE_REQUEST_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_stateRequest = 0;
+}
+
+void BAL_SetStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_SetStateRequest_CALL_INSTANCE));
+  CMOCK_BAL_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BAL_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.BAL_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BAL_SetStateRequest_IgnoreBool = (char)1;
+}
+
+void BAL_SetStateRequest_CMockStopIgnore(void)
+{
+  if(Mock.BAL_SetStateRequest_IgnoreBool)
+    Mock.BAL_SetStateRequest_CallInstance = CMock_Guts_MemNext(Mock.BAL_SetStateRequest_CallInstance);
+  Mock.BAL_SetStateRequest_IgnoreBool = (char)0;
+}
+
+void BAL_SetStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_REQUEST_e stateRequest, BAL_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_SetStateRequest_CALL_INSTANCE));
+  CMOCK_BAL_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BAL_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.BAL_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_SetStateRequest(cmock_call_instance, stateRequest);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BAL_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(BAL_RETURN_TYPE_e) ? 1 : -1])); /* add BAL_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void BAL_SetStateRequest_AddCallback(CMOCK_BAL_SetStateRequest_CALLBACK Callback)
+{
+  Mock.BAL_SetStateRequest_IgnoreBool = (char)0;
+  Mock.BAL_SetStateRequest_CallbackBool = (char)1;
+  Mock.BAL_SetStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void BAL_SetStateRequest_Stub(CMOCK_BAL_SetStateRequest_CALLBACK Callback)
+{
+  Mock.BAL_SetStateRequest_IgnoreBool = (char)0;
+  Mock.BAL_SetStateRequest_CallbackBool = (char)0;
+  Mock.BAL_SetStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void BAL_SetStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_REQUEST_e stateRequest, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_SetStateRequest_CALL_INSTANCE));
+  CMOCK_BAL_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BAL_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.BAL_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BAL_SetStateRequest(cmock_call_instance, stateRequest);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_SetStateRequest_CMockIgnoreArg_stateRequest(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BAL_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BAL_SetStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stateRequest = 1;
+}
+
+STD_RETURN_TYPE_e BAL_GetInitializationState(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_GetInitializationState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_GetInitializationState);
+  cmock_call_instance = (CMOCK_BAL_GetInitializationState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_GetInitializationState_CallInstance);
+  Mock.BAL_GetInitializationState_CallInstance = CMock_Guts_MemNext(Mock.BAL_GetInitializationState_CallInstance);
+  if (Mock.BAL_GetInitializationState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BAL_GetInitializationState_FinalReturn;
+    memcpy((void*)(&Mock.BAL_GetInitializationState_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BAL_GetInitializationState_CallbackBool &&
+      Mock.BAL_GetInitializationState_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.BAL_GetInitializationState_CallbackFunctionPointer(Mock.BAL_GetInitializationState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.BAL_GetInitializationState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BAL_GetInitializationState_CallbackFunctionPointer(Mock.BAL_GetInitializationState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void BAL_GetInitializationState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_GetInitializationState_CALL_INSTANCE));
+  CMOCK_BAL_GetInitializationState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_GetInitializationState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_GetInitializationState_CallInstance = CMock_Guts_MemChain(Mock.BAL_GetInitializationState_CallInstance, cmock_guts_index);
+  Mock.BAL_GetInitializationState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BAL_GetInitializationState_IgnoreBool = (char)1;
+}
+
+void BAL_GetInitializationState_CMockStopIgnore(void)
+{
+  if(Mock.BAL_GetInitializationState_IgnoreBool)
+    Mock.BAL_GetInitializationState_CallInstance = CMock_Guts_MemNext(Mock.BAL_GetInitializationState_CallInstance);
+  Mock.BAL_GetInitializationState_IgnoreBool = (char)0;
+}
+
+void BAL_GetInitializationState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_GetInitializationState_CALL_INSTANCE));
+  CMOCK_BAL_GetInitializationState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_GetInitializationState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_GetInitializationState_CallInstance = CMock_Guts_MemChain(Mock.BAL_GetInitializationState_CallInstance, cmock_guts_index);
+  Mock.BAL_GetInitializationState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void BAL_GetInitializationState_AddCallback(CMOCK_BAL_GetInitializationState_CALLBACK Callback)
+{
+  Mock.BAL_GetInitializationState_IgnoreBool = (char)0;
+  Mock.BAL_GetInitializationState_CallbackBool = (char)1;
+  Mock.BAL_GetInitializationState_CallbackFunctionPointer = Callback;
+}
+
+void BAL_GetInitializationState_Stub(CMOCK_BAL_GetInitializationState_CALLBACK Callback)
+{
+  Mock.BAL_GetInitializationState_IgnoreBool = (char)0;
+  Mock.BAL_GetInitializationState_CallbackBool = (char)0;
+  Mock.BAL_GetInitializationState_CallbackFunctionPointer = Callback;
+}
+
+void BAL_GetInitializationState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_GetInitializationState_CALL_INSTANCE));
+  CMOCK_BAL_GetInitializationState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_GetInitializationState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_GetInitializationState_CallInstance = CMock_Guts_MemChain(Mock.BAL_GetInitializationState_CallInstance, cmock_guts_index);
+  Mock.BAL_GetInitializationState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BAL_Trigger(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_Trigger_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_Trigger);
+  cmock_call_instance = (CMOCK_BAL_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_Trigger_CallInstance);
+  Mock.BAL_Trigger_CallInstance = CMock_Guts_MemNext(Mock.BAL_Trigger_CallInstance);
+  if (Mock.BAL_Trigger_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.BAL_Trigger_CallbackBool &&
+      Mock.BAL_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_Trigger_CallbackFunctionPointer(Mock.BAL_Trigger_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.BAL_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.BAL_Trigger_CallbackFunctionPointer(Mock.BAL_Trigger_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void BAL_Trigger_CMockIgnore(void)
+{
+  Mock.BAL_Trigger_IgnoreBool = (char)1;
+}
+
+void BAL_Trigger_CMockStopIgnore(void)
+{
+  Mock.BAL_Trigger_IgnoreBool = (char)0;
+}
+
+void BAL_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_Trigger_CALL_INSTANCE));
+  CMOCK_BAL_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_Trigger_CallInstance = CMock_Guts_MemChain(Mock.BAL_Trigger_CallInstance, cmock_guts_index);
+  Mock.BAL_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void BAL_Trigger_AddCallback(CMOCK_BAL_Trigger_CALLBACK Callback)
+{
+  Mock.BAL_Trigger_IgnoreBool = (char)0;
+  Mock.BAL_Trigger_CallbackBool = (char)1;
+  Mock.BAL_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void BAL_Trigger_Stub(CMOCK_BAL_Trigger_CALLBACK Callback)
+{
+  Mock.BAL_Trigger_IgnoreBool = (char)0;
+  Mock.BAL_Trigger_CallbackBool = (char)0;
+  Mock.BAL_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void BAL_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_Trigger_CALL_INSTANCE));
+  CMOCK_BAL_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_Trigger_CallInstance = CMock_Guts_MemChain(Mock.BAL_Trigger_CallInstance, cmock_guts_index);
+  Mock.BAL_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+BAL_STATEMACH_e BAL_GetState(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BAL_GetState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BAL_GetState);
+  cmock_call_instance = (CMOCK_BAL_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BAL_GetState_CallInstance);
+  Mock.BAL_GetState_CallInstance = CMock_Guts_MemNext(Mock.BAL_GetState_CallInstance);
+  if (Mock.BAL_GetState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BAL_GetState_FinalReturn;
+    memcpy((void*)(&Mock.BAL_GetState_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BAL_STATEMACH_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BAL_STATEMACH_e) ? 1 : -1])); /* add BAL_STATEMACH_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BAL_GetState_CallbackBool &&
+      Mock.BAL_GetState_CallbackFunctionPointer != NULL)
+  {
+    BAL_STATEMACH_e cmock_cb_ret = Mock.BAL_GetState_CallbackFunctionPointer(Mock.BAL_GetState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.BAL_GetState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BAL_GetState_CallbackFunctionPointer(Mock.BAL_GetState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void BAL_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATEMACH_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_GetState_CALL_INSTANCE));
+  CMOCK_BAL_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_GetState_CallInstance = CMock_Guts_MemChain(Mock.BAL_GetState_CallInstance, cmock_guts_index);
+  Mock.BAL_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BAL_GetState_IgnoreBool = (char)1;
+}
+
+void BAL_GetState_CMockStopIgnore(void)
+{
+  if(Mock.BAL_GetState_IgnoreBool)
+    Mock.BAL_GetState_CallInstance = CMock_Guts_MemNext(Mock.BAL_GetState_CallInstance);
+  Mock.BAL_GetState_IgnoreBool = (char)0;
+}
+
+void BAL_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATEMACH_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_GetState_CALL_INSTANCE));
+  CMOCK_BAL_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_GetState_CallInstance = CMock_Guts_MemChain(Mock.BAL_GetState_CallInstance, cmock_guts_index);
+  Mock.BAL_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BAL_STATEMACH_e[sizeof(cmock_to_return) == sizeof(BAL_STATEMACH_e) ? 1 : -1])); /* add BAL_STATEMACH_e to :treat_as_array if this causes an error */
+}
+
+void BAL_GetState_AddCallback(CMOCK_BAL_GetState_CALLBACK Callback)
+{
+  Mock.BAL_GetState_IgnoreBool = (char)0;
+  Mock.BAL_GetState_CallbackBool = (char)1;
+  Mock.BAL_GetState_CallbackFunctionPointer = Callback;
+}
+
+void BAL_GetState_Stub(CMOCK_BAL_GetState_CALLBACK Callback)
+{
+  Mock.BAL_GetState_IgnoreBool = (char)0;
+  Mock.BAL_GetState_CallbackBool = (char)0;
+  Mock.BAL_GetState_CallbackFunctionPointer = Callback;
+}
+
+void BAL_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BAL_GetState_CALL_INSTANCE));
+  CMOCK_BAL_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BAL_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BAL_GetState_CallInstance = CMock_Guts_MemChain(Mock.BAL_GetState_CallInstance, cmock_guts_index);
+  Mock.BAL_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+DATA_BLOCK_BALANCING_CONTROL_s* TEST_BAL_GetBalancingControl(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BAL_GetBalancingControl);
+  cmock_call_instance = (CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BAL_GetBalancingControl_CallInstance);
+  Mock.TEST_BAL_GetBalancingControl_CallInstance = CMock_Guts_MemNext(Mock.TEST_BAL_GetBalancingControl_CallInstance);
+  if (Mock.TEST_BAL_GetBalancingControl_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BAL_GetBalancingControl_FinalReturn;
+    Mock.TEST_BAL_GetBalancingControl_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BAL_GetBalancingControl_CallbackBool &&
+      Mock.TEST_BAL_GetBalancingControl_CallbackFunctionPointer != NULL)
+  {
+    DATA_BLOCK_BALANCING_CONTROL_s* cmock_cb_ret = Mock.TEST_BAL_GetBalancingControl_CallbackFunctionPointer(Mock.TEST_BAL_GetBalancingControl_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_BAL_GetBalancingControl_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BAL_GetBalancingControl_CallbackFunctionPointer(Mock.TEST_BAL_GetBalancingControl_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_BAL_GetBalancingControl_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE));
+  CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BAL_GetBalancingControl_CallInstance = CMock_Guts_MemChain(Mock.TEST_BAL_GetBalancingControl_CallInstance, cmock_guts_index);
+  Mock.TEST_BAL_GetBalancingControl_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BAL_GetBalancingControl_IgnoreBool = (char)1;
+}
+
+void TEST_BAL_GetBalancingControl_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BAL_GetBalancingControl_IgnoreBool)
+    Mock.TEST_BAL_GetBalancingControl_CallInstance = CMock_Guts_MemNext(Mock.TEST_BAL_GetBalancingControl_CallInstance);
+  Mock.TEST_BAL_GetBalancingControl_IgnoreBool = (char)0;
+}
+
+void TEST_BAL_GetBalancingControl_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE));
+  CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BAL_GetBalancingControl_CallInstance = CMock_Guts_MemChain(Mock.TEST_BAL_GetBalancingControl_CallInstance, cmock_guts_index);
+  Mock.TEST_BAL_GetBalancingControl_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_BAL_GetBalancingControl_AddCallback(CMOCK_TEST_BAL_GetBalancingControl_CALLBACK Callback)
+{
+  Mock.TEST_BAL_GetBalancingControl_IgnoreBool = (char)0;
+  Mock.TEST_BAL_GetBalancingControl_CallbackBool = (char)1;
+  Mock.TEST_BAL_GetBalancingControl_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BAL_GetBalancingControl_Stub(CMOCK_TEST_BAL_GetBalancingControl_CALLBACK Callback)
+{
+  Mock.TEST_BAL_GetBalancingControl_IgnoreBool = (char)0;
+  Mock.TEST_BAL_GetBalancingControl_CallbackBool = (char)0;
+  Mock.TEST_BAL_GetBalancingControl_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BAL_GetBalancingControl_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE));
+  CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BAL_GetBalancingControl_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BAL_GetBalancingControl_CallInstance = CMock_Guts_MemChain(Mock.TEST_BAL_GetBalancingControl_CallInstance, cmock_guts_index);
+  Mock.TEST_BAL_GetBalancingControl_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+BAL_STATE_s* TEST_BAL_GetBalancingState(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BAL_GetBalancingState);
+  cmock_call_instance = (CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BAL_GetBalancingState_CallInstance);
+  Mock.TEST_BAL_GetBalancingState_CallInstance = CMock_Guts_MemNext(Mock.TEST_BAL_GetBalancingState_CallInstance);
+  if (Mock.TEST_BAL_GetBalancingState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BAL_GetBalancingState_FinalReturn;
+    Mock.TEST_BAL_GetBalancingState_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BAL_GetBalancingState_CallbackBool &&
+      Mock.TEST_BAL_GetBalancingState_CallbackFunctionPointer != NULL)
+  {
+    BAL_STATE_s* cmock_cb_ret = Mock.TEST_BAL_GetBalancingState_CallbackFunctionPointer(Mock.TEST_BAL_GetBalancingState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_BAL_GetBalancingState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BAL_GetBalancingState_CallbackFunctionPointer(Mock.TEST_BAL_GetBalancingState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_BAL_GetBalancingState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE));
+  CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BAL_GetBalancingState_CallInstance = CMock_Guts_MemChain(Mock.TEST_BAL_GetBalancingState_CallInstance, cmock_guts_index);
+  Mock.TEST_BAL_GetBalancingState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BAL_GetBalancingState_IgnoreBool = (char)1;
+}
+
+void TEST_BAL_GetBalancingState_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BAL_GetBalancingState_IgnoreBool)
+    Mock.TEST_BAL_GetBalancingState_CallInstance = CMock_Guts_MemNext(Mock.TEST_BAL_GetBalancingState_CallInstance);
+  Mock.TEST_BAL_GetBalancingState_IgnoreBool = (char)0;
+}
+
+void TEST_BAL_GetBalancingState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE));
+  CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BAL_GetBalancingState_CallInstance = CMock_Guts_MemChain(Mock.TEST_BAL_GetBalancingState_CallInstance, cmock_guts_index);
+  Mock.TEST_BAL_GetBalancingState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_BAL_GetBalancingState_AddCallback(CMOCK_TEST_BAL_GetBalancingState_CALLBACK Callback)
+{
+  Mock.TEST_BAL_GetBalancingState_IgnoreBool = (char)0;
+  Mock.TEST_BAL_GetBalancingState_CallbackBool = (char)1;
+  Mock.TEST_BAL_GetBalancingState_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BAL_GetBalancingState_Stub(CMOCK_TEST_BAL_GetBalancingState_CALLBACK Callback)
+{
+  Mock.TEST_BAL_GetBalancingState_IgnoreBool = (char)0;
+  Mock.TEST_BAL_GetBalancingState_CallbackBool = (char)0;
+  Mock.TEST_BAL_GetBalancingState_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BAL_GetBalancingState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE));
+  CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BAL_GetBalancingState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BAL_GetBalancingState_CallInstance = CMock_Guts_MemChain(Mock.TEST_BAL_GetBalancingState_CallInstance, cmock_guts_index);
+  Mock.TEST_BAL_GetBalancingState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
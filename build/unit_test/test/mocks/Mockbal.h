@@ -0,0 +1,268 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKBAL_H
+#define _MOCKBAL_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "bal.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockbal_Init(void);
+void Mockbal_Destroy(void);
+void Mockbal_Verify(void);
+
+
+
+
+#define BAL_SaveLastStates_Ignore() BAL_SaveLastStates_CMockIgnore()
+void BAL_SaveLastStates_CMockIgnore(void);
+#define BAL_SaveLastStates_StopIgnore() BAL_SaveLastStates_CMockStopIgnore()
+void BAL_SaveLastStates_CMockStopIgnore(void);
+#define BAL_SaveLastStates_Expect(pBalancingState) BAL_SaveLastStates_CMockExpect(__LINE__, pBalancingState)
+void BAL_SaveLastStates_CMockExpect(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pBalancingState);
+typedef void (* CMOCK_BAL_SaveLastStates_CALLBACK)(BAL_STATE_s* pBalancingState, int cmock_num_calls);
+void BAL_SaveLastStates_AddCallback(CMOCK_BAL_SaveLastStates_CALLBACK Callback);
+void BAL_SaveLastStates_Stub(CMOCK_BAL_SaveLastStates_CALLBACK Callback);
+#define BAL_SaveLastStates_StubWithCallback BAL_SaveLastStates_Stub
+#define BAL_SaveLastStates_ExpectAndThrow(pBalancingState, cmock_to_throw) BAL_SaveLastStates_CMockExpectAndThrow(__LINE__, pBalancingState, cmock_to_throw)
+void BAL_SaveLastStates_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pBalancingState, CEXCEPTION_T cmock_to_throw);
+#define BAL_SaveLastStates_ReturnThruPtr_pBalancingState(pBalancingState) BAL_SaveLastStates_CMockReturnMemThruPtr_pBalancingState(__LINE__, pBalancingState, sizeof(BAL_STATE_s))
+#define BAL_SaveLastStates_ReturnArrayThruPtr_pBalancingState(pBalancingState, cmock_len) BAL_SaveLastStates_CMockReturnMemThruPtr_pBalancingState(__LINE__, pBalancingState, cmock_len * sizeof(*pBalancingState))
+#define BAL_SaveLastStates_ReturnMemThruPtr_pBalancingState(pBalancingState, cmock_size) BAL_SaveLastStates_CMockReturnMemThruPtr_pBalancingState(__LINE__, pBalancingState, cmock_size)
+void BAL_SaveLastStates_CMockReturnMemThruPtr_pBalancingState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pBalancingState, size_t cmock_size);
+#define BAL_SaveLastStates_IgnoreArg_pBalancingState() BAL_SaveLastStates_CMockIgnoreArg_pBalancingState(__LINE__)
+void BAL_SaveLastStates_CMockIgnoreArg_pBalancingState(UNITY_LINE_TYPE cmock_line);
+#define BAL_CheckReEntrance_IgnoreAndReturn(cmock_retval) BAL_CheckReEntrance_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BAL_CheckReEntrance_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define BAL_CheckReEntrance_StopIgnore() BAL_CheckReEntrance_CMockStopIgnore()
+void BAL_CheckReEntrance_CMockStopIgnore(void);
+#define BAL_CheckReEntrance_ExpectAndReturn(currentState, cmock_retval) BAL_CheckReEntrance_CMockExpectAndReturn(__LINE__, currentState, cmock_retval)
+void BAL_CheckReEntrance_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_BAL_CheckReEntrance_CALLBACK)(BAL_STATE_s* currentState, int cmock_num_calls);
+void BAL_CheckReEntrance_AddCallback(CMOCK_BAL_CheckReEntrance_CALLBACK Callback);
+void BAL_CheckReEntrance_Stub(CMOCK_BAL_CheckReEntrance_CALLBACK Callback);
+#define BAL_CheckReEntrance_StubWithCallback BAL_CheckReEntrance_Stub
+#define BAL_CheckReEntrance_ExpectAndThrow(currentState, cmock_to_throw) BAL_CheckReEntrance_CMockExpectAndThrow(__LINE__, currentState, cmock_to_throw)
+void BAL_CheckReEntrance_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, CEXCEPTION_T cmock_to_throw);
+#define BAL_CheckReEntrance_ReturnThruPtr_currentState(currentState) BAL_CheckReEntrance_CMockReturnMemThruPtr_currentState(__LINE__, currentState, sizeof(BAL_STATE_s))
+#define BAL_CheckReEntrance_ReturnArrayThruPtr_currentState(currentState, cmock_len) BAL_CheckReEntrance_CMockReturnMemThruPtr_currentState(__LINE__, currentState, cmock_len * sizeof(*currentState))
+#define BAL_CheckReEntrance_ReturnMemThruPtr_currentState(currentState, cmock_size) BAL_CheckReEntrance_CMockReturnMemThruPtr_currentState(__LINE__, currentState, cmock_size)
+void BAL_CheckReEntrance_CMockReturnMemThruPtr_currentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, size_t cmock_size);
+#define BAL_CheckReEntrance_IgnoreArg_currentState() BAL_CheckReEntrance_CMockIgnoreArg_currentState(__LINE__)
+void BAL_CheckReEntrance_CMockIgnoreArg_currentState(UNITY_LINE_TYPE cmock_line);
+#define BAL_TransferStateRequest_IgnoreAndReturn(cmock_retval) BAL_TransferStateRequest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BAL_TransferStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_REQUEST_e cmock_to_return);
+#define BAL_TransferStateRequest_StopIgnore() BAL_TransferStateRequest_CMockStopIgnore()
+void BAL_TransferStateRequest_CMockStopIgnore(void);
+#define BAL_TransferStateRequest_ExpectAndReturn(currentState, cmock_retval) BAL_TransferStateRequest_CMockExpectAndReturn(__LINE__, currentState, cmock_retval)
+void BAL_TransferStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, BAL_STATE_REQUEST_e cmock_to_return);
+typedef BAL_STATE_REQUEST_e (* CMOCK_BAL_TransferStateRequest_CALLBACK)(BAL_STATE_s* currentState, int cmock_num_calls);
+void BAL_TransferStateRequest_AddCallback(CMOCK_BAL_TransferStateRequest_CALLBACK Callback);
+void BAL_TransferStateRequest_Stub(CMOCK_BAL_TransferStateRequest_CALLBACK Callback);
+#define BAL_TransferStateRequest_StubWithCallback BAL_TransferStateRequest_Stub
+#define BAL_TransferStateRequest_ExpectAndThrow(currentState, cmock_to_throw) BAL_TransferStateRequest_CMockExpectAndThrow(__LINE__, currentState, cmock_to_throw)
+void BAL_TransferStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, CEXCEPTION_T cmock_to_throw);
+#define BAL_TransferStateRequest_ReturnThruPtr_currentState(currentState) BAL_TransferStateRequest_CMockReturnMemThruPtr_currentState(__LINE__, currentState, sizeof(BAL_STATE_s))
+#define BAL_TransferStateRequest_ReturnArrayThruPtr_currentState(currentState, cmock_len) BAL_TransferStateRequest_CMockReturnMemThruPtr_currentState(__LINE__, currentState, cmock_len * sizeof(*currentState))
+#define BAL_TransferStateRequest_ReturnMemThruPtr_currentState(currentState, cmock_size) BAL_TransferStateRequest_CMockReturnMemThruPtr_currentState(__LINE__, currentState, cmock_size)
+void BAL_TransferStateRequest_CMockReturnMemThruPtr_currentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, size_t cmock_size);
+#define BAL_TransferStateRequest_IgnoreArg_currentState() BAL_TransferStateRequest_CMockIgnoreArg_currentState(__LINE__)
+void BAL_TransferStateRequest_CMockIgnoreArg_currentState(UNITY_LINE_TYPE cmock_line);
+#define BAL_CheckStateRequest_IgnoreAndReturn(cmock_retval) BAL_CheckStateRequest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BAL_CheckStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_RETURN_TYPE_e cmock_to_return);
+#define BAL_CheckStateRequest_StopIgnore() BAL_CheckStateRequest_CMockStopIgnore()
+void BAL_CheckStateRequest_CMockStopIgnore(void);
+#define BAL_CheckStateRequest_ExpectAndReturn(pCurrentState, stateRequest, cmock_retval) BAL_CheckStateRequest_CMockExpectAndReturn(__LINE__, pCurrentState, stateRequest, cmock_retval)
+void BAL_CheckStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest, BAL_RETURN_TYPE_e cmock_to_return);
+typedef BAL_RETURN_TYPE_e (* CMOCK_BAL_CheckStateRequest_CALLBACK)(BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest, int cmock_num_calls);
+void BAL_CheckStateRequest_AddCallback(CMOCK_BAL_CheckStateRequest_CALLBACK Callback);
+void BAL_CheckStateRequest_Stub(CMOCK_BAL_CheckStateRequest_CALLBACK Callback);
+#define BAL_CheckStateRequest_StubWithCallback BAL_CheckStateRequest_Stub
+#define BAL_CheckStateRequest_ExpectAndThrow(pCurrentState, stateRequest, cmock_to_throw) BAL_CheckStateRequest_CMockExpectAndThrow(__LINE__, pCurrentState, stateRequest, cmock_to_throw)
+void BAL_CheckStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest, CEXCEPTION_T cmock_to_throw);
+#define BAL_CheckStateRequest_ReturnThruPtr_pCurrentState(pCurrentState) BAL_CheckStateRequest_CMockReturnMemThruPtr_pCurrentState(__LINE__, pCurrentState, sizeof(BAL_STATE_s))
+#define BAL_CheckStateRequest_ReturnArrayThruPtr_pCurrentState(pCurrentState, cmock_len) BAL_CheckStateRequest_CMockReturnMemThruPtr_pCurrentState(__LINE__, pCurrentState, cmock_len * sizeof(*pCurrentState))
+#define BAL_CheckStateRequest_ReturnMemThruPtr_pCurrentState(pCurrentState, cmock_size) BAL_CheckStateRequest_CMockReturnMemThruPtr_pCurrentState(__LINE__, pCurrentState, cmock_size)
+void BAL_CheckStateRequest_CMockReturnMemThruPtr_pCurrentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, size_t cmock_size);
+#define BAL_CheckStateRequest_IgnoreArg_pCurrentState() BAL_CheckStateRequest_CMockIgnoreArg_pCurrentState(__LINE__)
+void BAL_CheckStateRequest_CMockIgnoreArg_pCurrentState(UNITY_LINE_TYPE cmock_line);
+#define BAL_CheckStateRequest_IgnoreArg_stateRequest() BAL_CheckStateRequest_CMockIgnoreArg_stateRequest(__LINE__)
+void BAL_CheckStateRequest_CMockIgnoreArg_stateRequest(UNITY_LINE_TYPE cmock_line);
+#define BAL_ProcessStateUninitalized_Ignore() BAL_ProcessStateUninitalized_CMockIgnore()
+void BAL_ProcessStateUninitalized_CMockIgnore(void);
+#define BAL_ProcessStateUninitalized_StopIgnore() BAL_ProcessStateUninitalized_CMockStopIgnore()
+void BAL_ProcessStateUninitalized_CMockStopIgnore(void);
+#define BAL_ProcessStateUninitalized_Expect(pCurrentState, stateRequest) BAL_ProcessStateUninitalized_CMockExpect(__LINE__, pCurrentState, stateRequest)
+void BAL_ProcessStateUninitalized_CMockExpect(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest);
+typedef void (* CMOCK_BAL_ProcessStateUninitalized_CALLBACK)(BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest, int cmock_num_calls);
+void BAL_ProcessStateUninitalized_AddCallback(CMOCK_BAL_ProcessStateUninitalized_CALLBACK Callback);
+void BAL_ProcessStateUninitalized_Stub(CMOCK_BAL_ProcessStateUninitalized_CALLBACK Callback);
+#define BAL_ProcessStateUninitalized_StubWithCallback BAL_ProcessStateUninitalized_Stub
+#define BAL_ProcessStateUninitalized_ExpectAndThrow(pCurrentState, stateRequest, cmock_to_throw) BAL_ProcessStateUninitalized_CMockExpectAndThrow(__LINE__, pCurrentState, stateRequest, cmock_to_throw)
+void BAL_ProcessStateUninitalized_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, BAL_STATE_REQUEST_e stateRequest, CEXCEPTION_T cmock_to_throw);
+#define BAL_ProcessStateUninitalized_ReturnThruPtr_pCurrentState(pCurrentState) BAL_ProcessStateUninitalized_CMockReturnMemThruPtr_pCurrentState(__LINE__, pCurrentState, sizeof(BAL_STATE_s))
+#define BAL_ProcessStateUninitalized_ReturnArrayThruPtr_pCurrentState(pCurrentState, cmock_len) BAL_ProcessStateUninitalized_CMockReturnMemThruPtr_pCurrentState(__LINE__, pCurrentState, cmock_len * sizeof(*pCurrentState))
+#define BAL_ProcessStateUninitalized_ReturnMemThruPtr_pCurrentState(pCurrentState, cmock_size) BAL_ProcessStateUninitalized_CMockReturnMemThruPtr_pCurrentState(__LINE__, pCurrentState, cmock_size)
+void BAL_ProcessStateUninitalized_CMockReturnMemThruPtr_pCurrentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* pCurrentState, size_t cmock_size);
+#define BAL_ProcessStateUninitalized_IgnoreArg_pCurrentState() BAL_ProcessStateUninitalized_CMockIgnoreArg_pCurrentState(__LINE__)
+void BAL_ProcessStateUninitalized_CMockIgnoreArg_pCurrentState(UNITY_LINE_TYPE cmock_line);
+#define BAL_ProcessStateUninitalized_IgnoreArg_stateRequest() BAL_ProcessStateUninitalized_CMockIgnoreArg_stateRequest(__LINE__)
+void BAL_ProcessStateUninitalized_CMockIgnoreArg_stateRequest(UNITY_LINE_TYPE cmock_line);
+#define BAL_ProcessStateInitialization_Ignore() BAL_ProcessStateInitialization_CMockIgnore()
+void BAL_ProcessStateInitialization_CMockIgnore(void);
+#define BAL_ProcessStateInitialization_StopIgnore() BAL_ProcessStateInitialization_CMockStopIgnore()
+void BAL_ProcessStateInitialization_CMockStopIgnore(void);
+#define BAL_ProcessStateInitialization_Expect(currentState) BAL_ProcessStateInitialization_CMockExpect(__LINE__, currentState)
+void BAL_ProcessStateInitialization_CMockExpect(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState);
+typedef void (* CMOCK_BAL_ProcessStateInitialization_CALLBACK)(BAL_STATE_s* currentState, int cmock_num_calls);
+void BAL_ProcessStateInitialization_AddCallback(CMOCK_BAL_ProcessStateInitialization_CALLBACK Callback);
+void BAL_ProcessStateInitialization_Stub(CMOCK_BAL_ProcessStateInitialization_CALLBACK Callback);
+#define BAL_ProcessStateInitialization_StubWithCallback BAL_ProcessStateInitialization_Stub
+#define BAL_ProcessStateInitialization_ExpectAndThrow(currentState, cmock_to_throw) BAL_ProcessStateInitialization_CMockExpectAndThrow(__LINE__, currentState, cmock_to_throw)
+void BAL_ProcessStateInitialization_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, CEXCEPTION_T cmock_to_throw);
+#define BAL_ProcessStateInitialization_ReturnThruPtr_currentState(currentState) BAL_ProcessStateInitialization_CMockReturnMemThruPtr_currentState(__LINE__, currentState, sizeof(BAL_STATE_s))
+#define BAL_ProcessStateInitialization_ReturnArrayThruPtr_currentState(currentState, cmock_len) BAL_ProcessStateInitialization_CMockReturnMemThruPtr_currentState(__LINE__, currentState, cmock_len * sizeof(*currentState))
+#define BAL_ProcessStateInitialization_ReturnMemThruPtr_currentState(currentState, cmock_size) BAL_ProcessStateInitialization_CMockReturnMemThruPtr_currentState(__LINE__, currentState, cmock_size)
+void BAL_ProcessStateInitialization_CMockReturnMemThruPtr_currentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, size_t cmock_size);
+#define BAL_ProcessStateInitialization_IgnoreArg_currentState() BAL_ProcessStateInitialization_CMockIgnoreArg_currentState(__LINE__)
+void BAL_ProcessStateInitialization_CMockIgnoreArg_currentState(UNITY_LINE_TYPE cmock_line);
+#define BAL_ProcessStateInitialized_Ignore() BAL_ProcessStateInitialized_CMockIgnore()
+void BAL_ProcessStateInitialized_CMockIgnore(void);
+#define BAL_ProcessStateInitialized_StopIgnore() BAL_ProcessStateInitialized_CMockStopIgnore()
+void BAL_ProcessStateInitialized_CMockStopIgnore(void);
+#define BAL_ProcessStateInitialized_Expect(currentState) BAL_ProcessStateInitialized_CMockExpect(__LINE__, currentState)
+void BAL_ProcessStateInitialized_CMockExpect(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState);
+typedef void (* CMOCK_BAL_ProcessStateInitialized_CALLBACK)(BAL_STATE_s* currentState, int cmock_num_calls);
+void BAL_ProcessStateInitialized_AddCallback(CMOCK_BAL_ProcessStateInitialized_CALLBACK Callback);
+void BAL_ProcessStateInitialized_Stub(CMOCK_BAL_ProcessStateInitialized_CALLBACK Callback);
+#define BAL_ProcessStateInitialized_StubWithCallback BAL_ProcessStateInitialized_Stub
+#define BAL_ProcessStateInitialized_ExpectAndThrow(currentState, cmock_to_throw) BAL_ProcessStateInitialized_CMockExpectAndThrow(__LINE__, currentState, cmock_to_throw)
+void BAL_ProcessStateInitialized_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, CEXCEPTION_T cmock_to_throw);
+#define BAL_ProcessStateInitialized_ReturnThruPtr_currentState(currentState) BAL_ProcessStateInitialized_CMockReturnMemThruPtr_currentState(__LINE__, currentState, sizeof(BAL_STATE_s))
+#define BAL_ProcessStateInitialized_ReturnArrayThruPtr_currentState(currentState, cmock_len) BAL_ProcessStateInitialized_CMockReturnMemThruPtr_currentState(__LINE__, currentState, cmock_len * sizeof(*currentState))
+#define BAL_ProcessStateInitialized_ReturnMemThruPtr_currentState(currentState, cmock_size) BAL_ProcessStateInitialized_CMockReturnMemThruPtr_currentState(__LINE__, currentState, cmock_size)
+void BAL_ProcessStateInitialized_CMockReturnMemThruPtr_currentState(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* currentState, size_t cmock_size);
+#define BAL_ProcessStateInitialized_IgnoreArg_currentState() BAL_ProcessStateInitialized_CMockIgnoreArg_currentState(__LINE__)
+void BAL_ProcessStateInitialized_CMockIgnoreArg_currentState(UNITY_LINE_TYPE cmock_line);
+#define BAL_Init_IgnoreAndReturn(cmock_retval) BAL_Init_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BAL_Init_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define BAL_Init_StopIgnore() BAL_Init_CMockStopIgnore()
+void BAL_Init_CMockStopIgnore(void);
+#define BAL_Init_ExpectAndReturn(pControl, cmock_retval) BAL_Init_CMockExpectAndReturn(__LINE__, pControl, cmock_retval)
+void BAL_Init_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* pControl, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_BAL_Init_CALLBACK)(DATA_BLOCK_BALANCING_CONTROL_s* pControl, int cmock_num_calls);
+void BAL_Init_AddCallback(CMOCK_BAL_Init_CALLBACK Callback);
+void BAL_Init_Stub(CMOCK_BAL_Init_CALLBACK Callback);
+#define BAL_Init_StubWithCallback BAL_Init_Stub
+#define BAL_Init_ExpectAndThrow(pControl, cmock_to_throw) BAL_Init_CMockExpectAndThrow(__LINE__, pControl, cmock_to_throw)
+void BAL_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* pControl, CEXCEPTION_T cmock_to_throw);
+#define BAL_Init_ReturnThruPtr_pControl(pControl) BAL_Init_CMockReturnMemThruPtr_pControl(__LINE__, pControl, sizeof(DATA_BLOCK_BALANCING_CONTROL_s))
+#define BAL_Init_ReturnArrayThruPtr_pControl(pControl, cmock_len) BAL_Init_CMockReturnMemThruPtr_pControl(__LINE__, pControl, cmock_len * sizeof(*pControl))
+#define BAL_Init_ReturnMemThruPtr_pControl(pControl, cmock_size) BAL_Init_CMockReturnMemThruPtr_pControl(__LINE__, pControl, cmock_size)
+void BAL_Init_CMockReturnMemThruPtr_pControl(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* pControl, size_t cmock_size);
+#define BAL_Init_IgnoreArg_pControl() BAL_Init_CMockIgnoreArg_pControl(__LINE__)
+void BAL_Init_CMockIgnoreArg_pControl(UNITY_LINE_TYPE cmock_line);
+#define BAL_SetStateRequest_IgnoreAndReturn(cmock_retval) BAL_SetStateRequest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BAL_SetStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_RETURN_TYPE_e cmock_to_return);
+#define BAL_SetStateRequest_StopIgnore() BAL_SetStateRequest_CMockStopIgnore()
+void BAL_SetStateRequest_CMockStopIgnore(void);
+#define BAL_SetStateRequest_ExpectAndReturn(stateRequest, cmock_retval) BAL_SetStateRequest_CMockExpectAndReturn(__LINE__, stateRequest, cmock_retval)
+void BAL_SetStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_REQUEST_e stateRequest, BAL_RETURN_TYPE_e cmock_to_return);
+typedef BAL_RETURN_TYPE_e (* CMOCK_BAL_SetStateRequest_CALLBACK)(BAL_STATE_REQUEST_e stateRequest, int cmock_num_calls);
+void BAL_SetStateRequest_AddCallback(CMOCK_BAL_SetStateRequest_CALLBACK Callback);
+void BAL_SetStateRequest_Stub(CMOCK_BAL_SetStateRequest_CALLBACK Callback);
+#define BAL_SetStateRequest_StubWithCallback BAL_SetStateRequest_Stub
+#define BAL_SetStateRequest_ExpectAndThrow(stateRequest, cmock_to_throw) BAL_SetStateRequest_CMockExpectAndThrow(__LINE__, stateRequest, cmock_to_throw)
+void BAL_SetStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BAL_STATE_REQUEST_e stateRequest, CEXCEPTION_T cmock_to_throw);
+#define BAL_SetStateRequest_IgnoreArg_stateRequest() BAL_SetStateRequest_CMockIgnoreArg_stateRequest(__LINE__)
+void BAL_SetStateRequest_CMockIgnoreArg_stateRequest(UNITY_LINE_TYPE cmock_line);
+#define BAL_GetInitializationState_IgnoreAndReturn(cmock_retval) BAL_GetInitializationState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BAL_GetInitializationState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define BAL_GetInitializationState_StopIgnore() BAL_GetInitializationState_CMockStopIgnore()
+void BAL_GetInitializationState_CMockStopIgnore(void);
+#define BAL_GetInitializationState_ExpectAndReturn(cmock_retval) BAL_GetInitializationState_CMockExpectAndReturn(__LINE__, cmock_retval)
+void BAL_GetInitializationState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_BAL_GetInitializationState_CALLBACK)(int cmock_num_calls);
+void BAL_GetInitializationState_AddCallback(CMOCK_BAL_GetInitializationState_CALLBACK Callback);
+void BAL_GetInitializationState_Stub(CMOCK_BAL_GetInitializationState_CALLBACK Callback);
+#define BAL_GetInitializationState_StubWithCallback BAL_GetInitializationState_Stub
+#define BAL_GetInitializationState_ExpectAndThrow(cmock_to_throw) BAL_GetInitializationState_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void BAL_GetInitializationState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define BAL_Trigger_Ignore() BAL_Trigger_CMockIgnore()
+void BAL_Trigger_CMockIgnore(void);
+#define BAL_Trigger_StopIgnore() BAL_Trigger_CMockStopIgnore()
+void BAL_Trigger_CMockStopIgnore(void);
+#define BAL_Trigger_Expect() BAL_Trigger_CMockExpect(__LINE__)
+void BAL_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_BAL_Trigger_CALLBACK)(int cmock_num_calls);
+void BAL_Trigger_AddCallback(CMOCK_BAL_Trigger_CALLBACK Callback);
+void BAL_Trigger_Stub(CMOCK_BAL_Trigger_CALLBACK Callback);
+#define BAL_Trigger_StubWithCallback BAL_Trigger_Stub
+#define BAL_Trigger_ExpectAndThrow(cmock_to_throw) BAL_Trigger_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void BAL_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define BAL_GetState_IgnoreAndReturn(cmock_retval) BAL_GetState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BAL_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATEMACH_e cmock_to_return);
+#define BAL_GetState_StopIgnore() BAL_GetState_CMockStopIgnore()
+void BAL_GetState_CMockStopIgnore(void);
+#define BAL_GetState_ExpectAndReturn(cmock_retval) BAL_GetState_CMockExpectAndReturn(__LINE__, cmock_retval)
+void BAL_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATEMACH_e cmock_to_return);
+typedef BAL_STATEMACH_e (* CMOCK_BAL_GetState_CALLBACK)(int cmock_num_calls);
+void BAL_GetState_AddCallback(CMOCK_BAL_GetState_CALLBACK Callback);
+void BAL_GetState_Stub(CMOCK_BAL_GetState_CALLBACK Callback);
+#define BAL_GetState_StubWithCallback BAL_GetState_Stub
+#define BAL_GetState_ExpectAndThrow(cmock_to_throw) BAL_GetState_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void BAL_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_BAL_GetBalancingControl_IgnoreAndReturn(cmock_retval) TEST_BAL_GetBalancingControl_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BAL_GetBalancingControl_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* cmock_to_return);
+#define TEST_BAL_GetBalancingControl_StopIgnore() TEST_BAL_GetBalancingControl_CMockStopIgnore()
+void TEST_BAL_GetBalancingControl_CMockStopIgnore(void);
+#define TEST_BAL_GetBalancingControl_ExpectAndReturn(cmock_retval) TEST_BAL_GetBalancingControl_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_BAL_GetBalancingControl_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_BALANCING_CONTROL_s* cmock_to_return);
+typedef DATA_BLOCK_BALANCING_CONTROL_s* (* CMOCK_TEST_BAL_GetBalancingControl_CALLBACK)(int cmock_num_calls);
+void TEST_BAL_GetBalancingControl_AddCallback(CMOCK_TEST_BAL_GetBalancingControl_CALLBACK Callback);
+void TEST_BAL_GetBalancingControl_Stub(CMOCK_TEST_BAL_GetBalancingControl_CALLBACK Callback);
+#define TEST_BAL_GetBalancingControl_StubWithCallback TEST_BAL_GetBalancingControl_Stub
+#define TEST_BAL_GetBalancingControl_ExpectAndThrow(cmock_to_throw) TEST_BAL_GetBalancingControl_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_BAL_GetBalancingControl_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_BAL_GetBalancingState_IgnoreAndReturn(cmock_retval) TEST_BAL_GetBalancingState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BAL_GetBalancingState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* cmock_to_return);
+#define TEST_BAL_GetBalancingState_StopIgnore() TEST_BAL_GetBalancingState_CMockStopIgnore()
+void TEST_BAL_GetBalancingState_CMockStopIgnore(void);
+#define TEST_BAL_GetBalancingState_ExpectAndReturn(cmock_retval) TEST_BAL_GetBalancingState_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_BAL_GetBalancingState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BAL_STATE_s* cmock_to_return);
+typedef BAL_STATE_s* (* CMOCK_TEST_BAL_GetBalancingState_CALLBACK)(int cmock_num_calls);
+void TEST_BAL_GetBalancingState_AddCallback(CMOCK_TEST_BAL_GetBalancingState_CALLBACK Callback);
+void TEST_BAL_GetBalancingState_Stub(CMOCK_TEST_BAL_GetBalancingState_CALLBACK Callback);
+#define TEST_BAL_GetBalancingState_StubWithCallback TEST_BAL_GetBalancingState_Stub
+#define TEST_BAL_GetBalancingState_ExpectAndThrow(cmock_to_throw) TEST_BAL_GetBalancingState_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_BAL_GetBalancingState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,3411 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockbms.h"
+
+static const char* CMockString_BMS_GetBatterySystemState = "BMS_GetBatterySystemState";
+static const char* CMockString_BMS_GetCurrentFlowDirection = "BMS_GetCurrentFlowDirection";
+static const char* CMockString_BMS_GetInitializationState = "BMS_GetInitializationState";
+static const char* CMockString_BMS_GetState = "BMS_GetState";
+static const char* CMockString_BMS_IsStringClosed = "BMS_IsStringClosed";
+static const char* CMockString_BMS_IsStringPrecharging = "BMS_IsStringPrecharging";
+static const char* CMockString_BMS_SetStateRequest = "BMS_SetStateRequest";
+static const char* CMockString_BMS_Trigger = "BMS_Trigger";
+static const char* CMockString_TEST_BMS_CheckAnyErrorFlagSet = "TEST_BMS_CheckAnyErrorFlagSet";
+static const char* CMockString_TEST_BMS_CheckCanRequests = "TEST_BMS_CheckCanRequests";
+static const char* CMockString_TEST_BMS_CheckOpenSenseWire = "TEST_BMS_CheckOpenSenseWire";
+static const char* CMockString_TEST_BMS_CheckPrecharge = "TEST_BMS_CheckPrecharge";
+static const char* CMockString_TEST_BMS_CheckReEntrance = "TEST_BMS_CheckReEntrance";
+static const char* CMockString_TEST_BMS_CheckStateRequest = "TEST_BMS_CheckStateRequest";
+static const char* CMockString_TEST_BMS_GetAverageStringCurrent = "TEST_BMS_GetAverageStringCurrent";
+static const char* CMockString_TEST_BMS_GetClosestString = "TEST_BMS_GetClosestString";
+static const char* CMockString_TEST_BMS_GetHighestString = "TEST_BMS_GetHighestString";
+static const char* CMockString_TEST_BMS_GetLowestString = "TEST_BMS_GetLowestString";
+static const char* CMockString_TEST_BMS_GetMeasurementValues = "TEST_BMS_GetMeasurementValues";
+static const char* CMockString_TEST_BMS_GetStringVoltageDifference = "TEST_BMS_GetStringVoltageDifference";
+static const char* CMockString_TEST_BMS_TransferStateRequest = "TEST_BMS_TransferStateRequest";
+static const char* CMockString_TEST_BMS_UpdateBatsysState = "TEST_BMS_UpdateBatsysState";
+static const char* CMockString_current_mA = "current_mA";
+static const char* CMockString_pPackValues = "pPackValues";
+static const char* CMockString_precharge = "precharge";
+static const char* CMockString_statereq = "statereq";
+static const char* CMockString_string = "string";
+static const char* CMockString_stringNumber = "stringNumber";
+
+typedef struct _CMOCK_BMS_SetStateRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BMS_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  BMS_STATE_REQUEST_e Expected_statereq;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_statereq;
+
+} CMOCK_BMS_SetStateRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_BMS_GetState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BMS_STATEMACH_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_BMS_GetState_CALL_INSTANCE;
+
+typedef struct _CMOCK_BMS_GetInitializationState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_BMS_GetInitializationState_CALL_INSTANCE;
+
+typedef struct _CMOCK_BMS_Trigger_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_BMS_Trigger_CALL_INSTANCE;
+
+typedef struct _CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BMS_CURRENT_FLOW_STATE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE;
+
+typedef struct _CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BMS_CURRENT_FLOW_STATE_e ReturnVal;
+  int CallOrder;
+  int32_t Expected_current_mA;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_current_mA;
+
+} CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE;
+
+typedef struct _CMOCK_BMS_IsStringClosed_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_BMS_IsStringClosed_CALL_INSTANCE;
+
+typedef struct _CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BMS_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  BMS_STATE_REQUEST_e Expected_statereq;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_statereq;
+
+} CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  BMS_STATE_REQUEST_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  DATA_BLOCK_PACK_VALUES_s* Expected_pPackValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pPackValues_Used;
+  DATA_BLOCK_PACK_VALUES_s* ReturnThruPtr_pPackValues_Val;
+  size_t ReturnThruPtr_pPackValues_Size;
+  char IgnoreArg_stringNumber;
+  char IgnoreArg_pPackValues;
+
+} CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  BMS_CONSIDER_PRECHARGE_e Expected_precharge;
+  DATA_BLOCK_PACK_VALUES_s* Expected_pPackValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pPackValues_Used;
+  DATA_BLOCK_PACK_VALUES_s* ReturnThruPtr_pPackValues_Val;
+  size_t ReturnThruPtr_pPackValues_Size;
+  char IgnoreArg_precharge;
+  char IgnoreArg_pPackValues;
+
+} CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  BMS_CONSIDER_PRECHARGE_e Expected_precharge;
+  DATA_BLOCK_PACK_VALUES_s* Expected_pPackValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pPackValues_Used;
+  DATA_BLOCK_PACK_VALUES_s* ReturnThruPtr_pPackValues_Val;
+  size_t ReturnThruPtr_pPackValues_Size;
+  char IgnoreArg_precharge;
+  char IgnoreArg_pPackValues;
+
+} CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  BMS_CONSIDER_PRECHARGE_e Expected_precharge;
+  DATA_BLOCK_PACK_VALUES_s* Expected_pPackValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pPackValues_Used;
+  DATA_BLOCK_PACK_VALUES_s* ReturnThruPtr_pPackValues_Val;
+  size_t ReturnThruPtr_pPackValues_Size;
+  char IgnoreArg_precharge;
+  char IgnoreArg_pPackValues;
+
+} CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int32_t ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  DATA_BLOCK_PACK_VALUES_s* Expected_pPackValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pPackValues_Used;
+  DATA_BLOCK_PACK_VALUES_s* ReturnThruPtr_pPackValues_Val;
+  size_t ReturnThruPtr_pPackValues_Size;
+  char IgnoreArg_string;
+  char IgnoreArg_pPackValues;
+
+} CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int32_t ReturnVal;
+  int CallOrder;
+  DATA_BLOCK_PACK_VALUES_s* Expected_pPackValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pPackValues_Used;
+  DATA_BLOCK_PACK_VALUES_s* ReturnThruPtr_pPackValues_Val;
+  size_t ReturnThruPtr_pPackValues_Size;
+  char IgnoreArg_pPackValues;
+
+} CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  DATA_BLOCK_PACK_VALUES_s* Expected_pPackValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pPackValues_Used;
+  DATA_BLOCK_PACK_VALUES_s* ReturnThruPtr_pPackValues_Val;
+  size_t ReturnThruPtr_pPackValues_Size;
+  char IgnoreArg_pPackValues;
+
+} CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE;
+
+static struct MockbmsInstance
+{
+  char BMS_SetStateRequest_IgnoreBool;
+  BMS_RETURN_TYPE_e BMS_SetStateRequest_FinalReturn;
+  char BMS_SetStateRequest_CallbackBool;
+  CMOCK_BMS_SetStateRequest_CALLBACK BMS_SetStateRequest_CallbackFunctionPointer;
+  int BMS_SetStateRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BMS_SetStateRequest_CallInstance;
+  char BMS_GetState_IgnoreBool;
+  BMS_STATEMACH_e BMS_GetState_FinalReturn;
+  char BMS_GetState_CallbackBool;
+  CMOCK_BMS_GetState_CALLBACK BMS_GetState_CallbackFunctionPointer;
+  int BMS_GetState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BMS_GetState_CallInstance;
+  char BMS_GetInitializationState_IgnoreBool;
+  STD_RETURN_TYPE_e BMS_GetInitializationState_FinalReturn;
+  char BMS_GetInitializationState_CallbackBool;
+  CMOCK_BMS_GetInitializationState_CALLBACK BMS_GetInitializationState_CallbackFunctionPointer;
+  int BMS_GetInitializationState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BMS_GetInitializationState_CallInstance;
+  char BMS_Trigger_IgnoreBool;
+  char BMS_Trigger_CallbackBool;
+  CMOCK_BMS_Trigger_CALLBACK BMS_Trigger_CallbackFunctionPointer;
+  int BMS_Trigger_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BMS_Trigger_CallInstance;
+  char BMS_GetBatterySystemState_IgnoreBool;
+  BMS_CURRENT_FLOW_STATE_e BMS_GetBatterySystemState_FinalReturn;
+  char BMS_GetBatterySystemState_CallbackBool;
+  CMOCK_BMS_GetBatterySystemState_CALLBACK BMS_GetBatterySystemState_CallbackFunctionPointer;
+  int BMS_GetBatterySystemState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BMS_GetBatterySystemState_CallInstance;
+  char BMS_GetCurrentFlowDirection_IgnoreBool;
+  BMS_CURRENT_FLOW_STATE_e BMS_GetCurrentFlowDirection_FinalReturn;
+  char BMS_GetCurrentFlowDirection_CallbackBool;
+  CMOCK_BMS_GetCurrentFlowDirection_CALLBACK BMS_GetCurrentFlowDirection_CallbackFunctionPointer;
+  int BMS_GetCurrentFlowDirection_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BMS_GetCurrentFlowDirection_CallInstance;
+  char BMS_IsStringClosed_IgnoreBool;
+  _Bool BMS_IsStringClosed_FinalReturn;
+  char BMS_IsStringClosed_CallbackBool;
+  CMOCK_BMS_IsStringClosed_CALLBACK BMS_IsStringClosed_CallbackFunctionPointer;
+  int BMS_IsStringClosed_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BMS_IsStringClosed_CallInstance;
+  char BMS_IsStringPrecharging_IgnoreBool;
+  _Bool BMS_IsStringPrecharging_FinalReturn;
+  char BMS_IsStringPrecharging_CallbackBool;
+  CMOCK_BMS_IsStringPrecharging_CALLBACK BMS_IsStringPrecharging_CallbackFunctionPointer;
+  int BMS_IsStringPrecharging_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE BMS_IsStringPrecharging_CallInstance;
+  char TEST_BMS_CheckStateRequest_IgnoreBool;
+  BMS_RETURN_TYPE_e TEST_BMS_CheckStateRequest_FinalReturn;
+  char TEST_BMS_CheckStateRequest_CallbackBool;
+  CMOCK_TEST_BMS_CheckStateRequest_CALLBACK TEST_BMS_CheckStateRequest_CallbackFunctionPointer;
+  int TEST_BMS_CheckStateRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_CheckStateRequest_CallInstance;
+  char TEST_BMS_TransferStateRequest_IgnoreBool;
+  BMS_STATE_REQUEST_e TEST_BMS_TransferStateRequest_FinalReturn;
+  char TEST_BMS_TransferStateRequest_CallbackBool;
+  CMOCK_TEST_BMS_TransferStateRequest_CALLBACK TEST_BMS_TransferStateRequest_CallbackFunctionPointer;
+  int TEST_BMS_TransferStateRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_TransferStateRequest_CallInstance;
+  char TEST_BMS_CheckReEntrance_IgnoreBool;
+  uint8_t TEST_BMS_CheckReEntrance_FinalReturn;
+  char TEST_BMS_CheckReEntrance_CallbackBool;
+  CMOCK_TEST_BMS_CheckReEntrance_CALLBACK TEST_BMS_CheckReEntrance_CallbackFunctionPointer;
+  int TEST_BMS_CheckReEntrance_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_CheckReEntrance_CallInstance;
+  char TEST_BMS_CheckCanRequests_IgnoreBool;
+  uint8_t TEST_BMS_CheckCanRequests_FinalReturn;
+  char TEST_BMS_CheckCanRequests_CallbackBool;
+  CMOCK_TEST_BMS_CheckCanRequests_CALLBACK TEST_BMS_CheckCanRequests_CallbackFunctionPointer;
+  int TEST_BMS_CheckCanRequests_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_CheckCanRequests_CallInstance;
+  char TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool;
+  STD_RETURN_TYPE_e TEST_BMS_CheckAnyErrorFlagSet_FinalReturn;
+  char TEST_BMS_CheckAnyErrorFlagSet_CallbackBool;
+  CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALLBACK TEST_BMS_CheckAnyErrorFlagSet_CallbackFunctionPointer;
+  int TEST_BMS_CheckAnyErrorFlagSet_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_CheckAnyErrorFlagSet_CallInstance;
+  char TEST_BMS_GetMeasurementValues_IgnoreBool;
+  char TEST_BMS_GetMeasurementValues_CallbackBool;
+  CMOCK_TEST_BMS_GetMeasurementValues_CALLBACK TEST_BMS_GetMeasurementValues_CallbackFunctionPointer;
+  int TEST_BMS_GetMeasurementValues_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_GetMeasurementValues_CallInstance;
+  char TEST_BMS_CheckOpenSenseWire_IgnoreBool;
+  char TEST_BMS_CheckOpenSenseWire_CallbackBool;
+  CMOCK_TEST_BMS_CheckOpenSenseWire_CALLBACK TEST_BMS_CheckOpenSenseWire_CallbackFunctionPointer;
+  int TEST_BMS_CheckOpenSenseWire_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_CheckOpenSenseWire_CallInstance;
+  char TEST_BMS_CheckPrecharge_IgnoreBool;
+  STD_RETURN_TYPE_e TEST_BMS_CheckPrecharge_FinalReturn;
+  char TEST_BMS_CheckPrecharge_CallbackBool;
+  CMOCK_TEST_BMS_CheckPrecharge_CALLBACK TEST_BMS_CheckPrecharge_CallbackFunctionPointer;
+  int TEST_BMS_CheckPrecharge_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_CheckPrecharge_CallInstance;
+  char TEST_BMS_GetHighestString_IgnoreBool;
+  uint8_t TEST_BMS_GetHighestString_FinalReturn;
+  char TEST_BMS_GetHighestString_CallbackBool;
+  CMOCK_TEST_BMS_GetHighestString_CALLBACK TEST_BMS_GetHighestString_CallbackFunctionPointer;
+  int TEST_BMS_GetHighestString_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_GetHighestString_CallInstance;
+  char TEST_BMS_GetClosestString_IgnoreBool;
+  uint8_t TEST_BMS_GetClosestString_FinalReturn;
+  char TEST_BMS_GetClosestString_CallbackBool;
+  CMOCK_TEST_BMS_GetClosestString_CALLBACK TEST_BMS_GetClosestString_CallbackFunctionPointer;
+  int TEST_BMS_GetClosestString_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_GetClosestString_CallInstance;
+  char TEST_BMS_GetLowestString_IgnoreBool;
+  uint8_t TEST_BMS_GetLowestString_FinalReturn;
+  char TEST_BMS_GetLowestString_CallbackBool;
+  CMOCK_TEST_BMS_GetLowestString_CALLBACK TEST_BMS_GetLowestString_CallbackFunctionPointer;
+  int TEST_BMS_GetLowestString_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_GetLowestString_CallInstance;
+  char TEST_BMS_GetStringVoltageDifference_IgnoreBool;
+  int32_t TEST_BMS_GetStringVoltageDifference_FinalReturn;
+  char TEST_BMS_GetStringVoltageDifference_CallbackBool;
+  CMOCK_TEST_BMS_GetStringVoltageDifference_CALLBACK TEST_BMS_GetStringVoltageDifference_CallbackFunctionPointer;
+  int TEST_BMS_GetStringVoltageDifference_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_GetStringVoltageDifference_CallInstance;
+  char TEST_BMS_GetAverageStringCurrent_IgnoreBool;
+  int32_t TEST_BMS_GetAverageStringCurrent_FinalReturn;
+  char TEST_BMS_GetAverageStringCurrent_CallbackBool;
+  CMOCK_TEST_BMS_GetAverageStringCurrent_CALLBACK TEST_BMS_GetAverageStringCurrent_CallbackFunctionPointer;
+  int TEST_BMS_GetAverageStringCurrent_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_GetAverageStringCurrent_CallInstance;
+  char TEST_BMS_UpdateBatsysState_IgnoreBool;
+  char TEST_BMS_UpdateBatsysState_CallbackBool;
+  CMOCK_TEST_BMS_UpdateBatsysState_CALLBACK TEST_BMS_UpdateBatsysState_CallbackFunctionPointer;
+  int TEST_BMS_UpdateBatsysState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_BMS_UpdateBatsysState_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockbms_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.BMS_SetStateRequest_CallInstance;
+  if (Mock.BMS_SetStateRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BMS_SetStateRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BMS_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BMS_GetState_CallInstance;
+  if (Mock.BMS_GetState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BMS_GetState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BMS_GetState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BMS_GetInitializationState_CallInstance;
+  if (Mock.BMS_GetInitializationState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BMS_GetInitializationState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BMS_GetInitializationState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BMS_Trigger_CallInstance;
+  if (Mock.BMS_Trigger_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BMS_Trigger);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BMS_Trigger_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BMS_GetBatterySystemState_CallInstance;
+  if (Mock.BMS_GetBatterySystemState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BMS_GetBatterySystemState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BMS_GetBatterySystemState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BMS_GetCurrentFlowDirection_CallInstance;
+  if (Mock.BMS_GetCurrentFlowDirection_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BMS_GetCurrentFlowDirection);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BMS_GetCurrentFlowDirection_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BMS_IsStringClosed_CallInstance;
+  if (Mock.BMS_IsStringClosed_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BMS_IsStringClosed);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BMS_IsStringClosed_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.BMS_IsStringPrecharging_CallInstance;
+  if (Mock.BMS_IsStringPrecharging_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_BMS_IsStringPrecharging);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.BMS_IsStringPrecharging_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_CheckStateRequest_CallInstance;
+  if (Mock.TEST_BMS_CheckStateRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckStateRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_CheckStateRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_TransferStateRequest_CallInstance;
+  if (Mock.TEST_BMS_TransferStateRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_TransferStateRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_TransferStateRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_CheckReEntrance_CallInstance;
+  if (Mock.TEST_BMS_CheckReEntrance_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckReEntrance);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_CheckReEntrance_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_CheckCanRequests_CallInstance;
+  if (Mock.TEST_BMS_CheckCanRequests_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckCanRequests);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_CheckCanRequests_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance;
+  if (Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckAnyErrorFlagSet);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_GetMeasurementValues_CallInstance;
+  if (Mock.TEST_BMS_GetMeasurementValues_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_GetMeasurementValues);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_GetMeasurementValues_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_CheckOpenSenseWire_CallInstance;
+  if (Mock.TEST_BMS_CheckOpenSenseWire_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckOpenSenseWire);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_CheckOpenSenseWire_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_CheckPrecharge_CallInstance;
+  if (Mock.TEST_BMS_CheckPrecharge_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckPrecharge);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_CheckPrecharge_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_GetHighestString_CallInstance;
+  if (Mock.TEST_BMS_GetHighestString_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_GetHighestString);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_GetHighestString_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_GetClosestString_CallInstance;
+  if (Mock.TEST_BMS_GetClosestString_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_GetClosestString);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_GetClosestString_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_GetLowestString_CallInstance;
+  if (Mock.TEST_BMS_GetLowestString_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_GetLowestString);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_GetLowestString_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_GetStringVoltageDifference_CallInstance;
+  if (Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_GetStringVoltageDifference);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_GetStringVoltageDifference_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_GetAverageStringCurrent_CallInstance;
+  if (Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_GetAverageStringCurrent);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_GetAverageStringCurrent_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_BMS_UpdateBatsysState_CallInstance;
+  if (Mock.TEST_BMS_UpdateBatsysState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_BMS_UpdateBatsysState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_BMS_UpdateBatsysState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockbms_Init(void)
+{
+  Mockbms_Destroy();
+}
+
+void Mockbms_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+BMS_RETURN_TYPE_e BMS_SetStateRequest(BMS_STATE_REQUEST_e statereq)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BMS_SetStateRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BMS_SetStateRequest);
+  cmock_call_instance = (CMOCK_BMS_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BMS_SetStateRequest_CallInstance);
+  Mock.BMS_SetStateRequest_CallInstance = CMock_Guts_MemNext(Mock.BMS_SetStateRequest_CallInstance);
+  if (Mock.BMS_SetStateRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BMS_SetStateRequest_FinalReturn;
+    memcpy((void*)(&Mock.BMS_SetStateRequest_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BMS_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BMS_RETURN_TYPE_e) ? 1 : -1])); /* add BMS_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BMS_SetStateRequest_CallbackBool &&
+      Mock.BMS_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    BMS_RETURN_TYPE_e cmock_cb_ret = Mock.BMS_SetStateRequest_CallbackFunctionPointer(statereq, Mock.BMS_SetStateRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_statereq)
+  {
+    UNITY_SET_DETAILS(CMockString_BMS_SetStateRequest,CMockString_statereq);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_statereq), (void*)(&statereq), sizeof(BMS_STATE_REQUEST_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BMS_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BMS_SetStateRequest_CallbackFunctionPointer(statereq, Mock.BMS_SetStateRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_BMS_SetStateRequest(CMOCK_BMS_SetStateRequest_CALL_INSTANCE* cmock_call_instance, BMS_STATE_REQUEST_e statereq);
+void CMockExpectParameters_BMS_SetStateRequest(CMOCK_BMS_SetStateRequest_CALL_INSTANCE* cmock_call_instance, BMS_STATE_REQUEST_e statereq)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_statereq), (void*)(&statereq),
+         sizeof(BMS_STATE_REQUEST_e[sizeof(statereq) == sizeof(BMS_STATE_REQUEST_e) ? 1 : -1])); /* add BMS_STATE_REQUEST_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_statereq = 0;
+}
+
+void BMS_SetStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_SetStateRequest_CALL_INSTANCE));
+  CMOCK_BMS_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BMS_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.BMS_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BMS_SetStateRequest_IgnoreBool = (char)1;
+}
+
+void BMS_SetStateRequest_CMockStopIgnore(void)
+{
+  if(Mock.BMS_SetStateRequest_IgnoreBool)
+    Mock.BMS_SetStateRequest_CallInstance = CMock_Guts_MemNext(Mock.BMS_SetStateRequest_CallInstance);
+  Mock.BMS_SetStateRequest_IgnoreBool = (char)0;
+}
+
+void BMS_SetStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e statereq, BMS_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_SetStateRequest_CALL_INSTANCE));
+  CMOCK_BMS_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BMS_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.BMS_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BMS_SetStateRequest(cmock_call_instance, statereq);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BMS_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(BMS_RETURN_TYPE_e) ? 1 : -1])); /* add BMS_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void BMS_SetStateRequest_AddCallback(CMOCK_BMS_SetStateRequest_CALLBACK Callback)
+{
+  Mock.BMS_SetStateRequest_IgnoreBool = (char)0;
+  Mock.BMS_SetStateRequest_CallbackBool = (char)1;
+  Mock.BMS_SetStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void BMS_SetStateRequest_Stub(CMOCK_BMS_SetStateRequest_CALLBACK Callback)
+{
+  Mock.BMS_SetStateRequest_IgnoreBool = (char)0;
+  Mock.BMS_SetStateRequest_CallbackBool = (char)0;
+  Mock.BMS_SetStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void BMS_SetStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e statereq, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_SetStateRequest_CALL_INSTANCE));
+  CMOCK_BMS_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.BMS_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.BMS_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BMS_SetStateRequest(cmock_call_instance, statereq);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BMS_SetStateRequest_CMockIgnoreArg_statereq(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BMS_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BMS_SetStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_statereq = 1;
+}
+
+BMS_STATEMACH_e BMS_GetState(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BMS_GetState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BMS_GetState);
+  cmock_call_instance = (CMOCK_BMS_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BMS_GetState_CallInstance);
+  Mock.BMS_GetState_CallInstance = CMock_Guts_MemNext(Mock.BMS_GetState_CallInstance);
+  if (Mock.BMS_GetState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BMS_GetState_FinalReturn;
+    memcpy((void*)(&Mock.BMS_GetState_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BMS_STATEMACH_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BMS_STATEMACH_e) ? 1 : -1])); /* add BMS_STATEMACH_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BMS_GetState_CallbackBool &&
+      Mock.BMS_GetState_CallbackFunctionPointer != NULL)
+  {
+    BMS_STATEMACH_e cmock_cb_ret = Mock.BMS_GetState_CallbackFunctionPointer(Mock.BMS_GetState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.BMS_GetState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BMS_GetState_CallbackFunctionPointer(Mock.BMS_GetState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void BMS_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATEMACH_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetState_CALL_INSTANCE));
+  CMOCK_BMS_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetState_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetState_CallInstance, cmock_guts_index);
+  Mock.BMS_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BMS_GetState_IgnoreBool = (char)1;
+}
+
+void BMS_GetState_CMockStopIgnore(void)
+{
+  if(Mock.BMS_GetState_IgnoreBool)
+    Mock.BMS_GetState_CallInstance = CMock_Guts_MemNext(Mock.BMS_GetState_CallInstance);
+  Mock.BMS_GetState_IgnoreBool = (char)0;
+}
+
+void BMS_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATEMACH_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetState_CALL_INSTANCE));
+  CMOCK_BMS_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetState_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetState_CallInstance, cmock_guts_index);
+  Mock.BMS_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BMS_STATEMACH_e[sizeof(cmock_to_return) == sizeof(BMS_STATEMACH_e) ? 1 : -1])); /* add BMS_STATEMACH_e to :treat_as_array if this causes an error */
+}
+
+void BMS_GetState_AddCallback(CMOCK_BMS_GetState_CALLBACK Callback)
+{
+  Mock.BMS_GetState_IgnoreBool = (char)0;
+  Mock.BMS_GetState_CallbackBool = (char)1;
+  Mock.BMS_GetState_CallbackFunctionPointer = Callback;
+}
+
+void BMS_GetState_Stub(CMOCK_BMS_GetState_CALLBACK Callback)
+{
+  Mock.BMS_GetState_IgnoreBool = (char)0;
+  Mock.BMS_GetState_CallbackBool = (char)0;
+  Mock.BMS_GetState_CallbackFunctionPointer = Callback;
+}
+
+void BMS_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetState_CALL_INSTANCE));
+  CMOCK_BMS_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetState_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetState_CallInstance, cmock_guts_index);
+  Mock.BMS_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e BMS_GetInitializationState(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BMS_GetInitializationState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BMS_GetInitializationState);
+  cmock_call_instance = (CMOCK_BMS_GetInitializationState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BMS_GetInitializationState_CallInstance);
+  Mock.BMS_GetInitializationState_CallInstance = CMock_Guts_MemNext(Mock.BMS_GetInitializationState_CallInstance);
+  if (Mock.BMS_GetInitializationState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BMS_GetInitializationState_FinalReturn;
+    memcpy((void*)(&Mock.BMS_GetInitializationState_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BMS_GetInitializationState_CallbackBool &&
+      Mock.BMS_GetInitializationState_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.BMS_GetInitializationState_CallbackFunctionPointer(Mock.BMS_GetInitializationState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.BMS_GetInitializationState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BMS_GetInitializationState_CallbackFunctionPointer(Mock.BMS_GetInitializationState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void BMS_GetInitializationState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetInitializationState_CALL_INSTANCE));
+  CMOCK_BMS_GetInitializationState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetInitializationState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetInitializationState_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetInitializationState_CallInstance, cmock_guts_index);
+  Mock.BMS_GetInitializationState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BMS_GetInitializationState_IgnoreBool = (char)1;
+}
+
+void BMS_GetInitializationState_CMockStopIgnore(void)
+{
+  if(Mock.BMS_GetInitializationState_IgnoreBool)
+    Mock.BMS_GetInitializationState_CallInstance = CMock_Guts_MemNext(Mock.BMS_GetInitializationState_CallInstance);
+  Mock.BMS_GetInitializationState_IgnoreBool = (char)0;
+}
+
+void BMS_GetInitializationState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetInitializationState_CALL_INSTANCE));
+  CMOCK_BMS_GetInitializationState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetInitializationState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetInitializationState_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetInitializationState_CallInstance, cmock_guts_index);
+  Mock.BMS_GetInitializationState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void BMS_GetInitializationState_AddCallback(CMOCK_BMS_GetInitializationState_CALLBACK Callback)
+{
+  Mock.BMS_GetInitializationState_IgnoreBool = (char)0;
+  Mock.BMS_GetInitializationState_CallbackBool = (char)1;
+  Mock.BMS_GetInitializationState_CallbackFunctionPointer = Callback;
+}
+
+void BMS_GetInitializationState_Stub(CMOCK_BMS_GetInitializationState_CALLBACK Callback)
+{
+  Mock.BMS_GetInitializationState_IgnoreBool = (char)0;
+  Mock.BMS_GetInitializationState_CallbackBool = (char)0;
+  Mock.BMS_GetInitializationState_CallbackFunctionPointer = Callback;
+}
+
+void BMS_GetInitializationState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetInitializationState_CALL_INSTANCE));
+  CMOCK_BMS_GetInitializationState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetInitializationState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetInitializationState_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetInitializationState_CallInstance, cmock_guts_index);
+  Mock.BMS_GetInitializationState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BMS_Trigger(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BMS_Trigger_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BMS_Trigger);
+  cmock_call_instance = (CMOCK_BMS_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BMS_Trigger_CallInstance);
+  Mock.BMS_Trigger_CallInstance = CMock_Guts_MemNext(Mock.BMS_Trigger_CallInstance);
+  if (Mock.BMS_Trigger_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.BMS_Trigger_CallbackBool &&
+      Mock.BMS_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.BMS_Trigger_CallbackFunctionPointer(Mock.BMS_Trigger_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.BMS_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.BMS_Trigger_CallbackFunctionPointer(Mock.BMS_Trigger_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void BMS_Trigger_CMockIgnore(void)
+{
+  Mock.BMS_Trigger_IgnoreBool = (char)1;
+}
+
+void BMS_Trigger_CMockStopIgnore(void)
+{
+  Mock.BMS_Trigger_IgnoreBool = (char)0;
+}
+
+void BMS_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_Trigger_CALL_INSTANCE));
+  CMOCK_BMS_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_Trigger_CallInstance = CMock_Guts_MemChain(Mock.BMS_Trigger_CallInstance, cmock_guts_index);
+  Mock.BMS_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void BMS_Trigger_AddCallback(CMOCK_BMS_Trigger_CALLBACK Callback)
+{
+  Mock.BMS_Trigger_IgnoreBool = (char)0;
+  Mock.BMS_Trigger_CallbackBool = (char)1;
+  Mock.BMS_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void BMS_Trigger_Stub(CMOCK_BMS_Trigger_CALLBACK Callback)
+{
+  Mock.BMS_Trigger_IgnoreBool = (char)0;
+  Mock.BMS_Trigger_CallbackBool = (char)0;
+  Mock.BMS_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void BMS_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_Trigger_CALL_INSTANCE));
+  CMOCK_BMS_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_Trigger_CallInstance = CMock_Guts_MemChain(Mock.BMS_Trigger_CallInstance, cmock_guts_index);
+  Mock.BMS_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+BMS_CURRENT_FLOW_STATE_e BMS_GetBatterySystemState(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BMS_GetBatterySystemState);
+  cmock_call_instance = (CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BMS_GetBatterySystemState_CallInstance);
+  Mock.BMS_GetBatterySystemState_CallInstance = CMock_Guts_MemNext(Mock.BMS_GetBatterySystemState_CallInstance);
+  if (Mock.BMS_GetBatterySystemState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BMS_GetBatterySystemState_FinalReturn;
+    memcpy((void*)(&Mock.BMS_GetBatterySystemState_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BMS_CURRENT_FLOW_STATE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BMS_CURRENT_FLOW_STATE_e) ? 1 : -1])); /* add BMS_CURRENT_FLOW_STATE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BMS_GetBatterySystemState_CallbackBool &&
+      Mock.BMS_GetBatterySystemState_CallbackFunctionPointer != NULL)
+  {
+    BMS_CURRENT_FLOW_STATE_e cmock_cb_ret = Mock.BMS_GetBatterySystemState_CallbackFunctionPointer(Mock.BMS_GetBatterySystemState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.BMS_GetBatterySystemState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BMS_GetBatterySystemState_CallbackFunctionPointer(Mock.BMS_GetBatterySystemState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void BMS_GetBatterySystemState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CURRENT_FLOW_STATE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE));
+  CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetBatterySystemState_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetBatterySystemState_CallInstance, cmock_guts_index);
+  Mock.BMS_GetBatterySystemState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BMS_GetBatterySystemState_IgnoreBool = (char)1;
+}
+
+void BMS_GetBatterySystemState_CMockStopIgnore(void)
+{
+  if(Mock.BMS_GetBatterySystemState_IgnoreBool)
+    Mock.BMS_GetBatterySystemState_CallInstance = CMock_Guts_MemNext(Mock.BMS_GetBatterySystemState_CallInstance);
+  Mock.BMS_GetBatterySystemState_IgnoreBool = (char)0;
+}
+
+void BMS_GetBatterySystemState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CURRENT_FLOW_STATE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE));
+  CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetBatterySystemState_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetBatterySystemState_CallInstance, cmock_guts_index);
+  Mock.BMS_GetBatterySystemState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BMS_CURRENT_FLOW_STATE_e[sizeof(cmock_to_return) == sizeof(BMS_CURRENT_FLOW_STATE_e) ? 1 : -1])); /* add BMS_CURRENT_FLOW_STATE_e to :treat_as_array if this causes an error */
+}
+
+void BMS_GetBatterySystemState_AddCallback(CMOCK_BMS_GetBatterySystemState_CALLBACK Callback)
+{
+  Mock.BMS_GetBatterySystemState_IgnoreBool = (char)0;
+  Mock.BMS_GetBatterySystemState_CallbackBool = (char)1;
+  Mock.BMS_GetBatterySystemState_CallbackFunctionPointer = Callback;
+}
+
+void BMS_GetBatterySystemState_Stub(CMOCK_BMS_GetBatterySystemState_CALLBACK Callback)
+{
+  Mock.BMS_GetBatterySystemState_IgnoreBool = (char)0;
+  Mock.BMS_GetBatterySystemState_CallbackBool = (char)0;
+  Mock.BMS_GetBatterySystemState_CallbackFunctionPointer = Callback;
+}
+
+void BMS_GetBatterySystemState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE));
+  CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetBatterySystemState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetBatterySystemState_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetBatterySystemState_CallInstance, cmock_guts_index);
+  Mock.BMS_GetBatterySystemState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+BMS_CURRENT_FLOW_STATE_e BMS_GetCurrentFlowDirection(int32_t current_mA)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BMS_GetCurrentFlowDirection);
+  cmock_call_instance = (CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BMS_GetCurrentFlowDirection_CallInstance);
+  Mock.BMS_GetCurrentFlowDirection_CallInstance = CMock_Guts_MemNext(Mock.BMS_GetCurrentFlowDirection_CallInstance);
+  if (Mock.BMS_GetCurrentFlowDirection_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BMS_GetCurrentFlowDirection_FinalReturn;
+    memcpy((void*)(&Mock.BMS_GetCurrentFlowDirection_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BMS_CURRENT_FLOW_STATE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BMS_CURRENT_FLOW_STATE_e) ? 1 : -1])); /* add BMS_CURRENT_FLOW_STATE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BMS_GetCurrentFlowDirection_CallbackBool &&
+      Mock.BMS_GetCurrentFlowDirection_CallbackFunctionPointer != NULL)
+  {
+    BMS_CURRENT_FLOW_STATE_e cmock_cb_ret = Mock.BMS_GetCurrentFlowDirection_CallbackFunctionPointer(current_mA, Mock.BMS_GetCurrentFlowDirection_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_current_mA)
+  {
+    UNITY_SET_DETAILS(CMockString_BMS_GetCurrentFlowDirection,CMockString_current_mA);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_current_mA, current_mA, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BMS_GetCurrentFlowDirection_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BMS_GetCurrentFlowDirection_CallbackFunctionPointer(current_mA, Mock.BMS_GetCurrentFlowDirection_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_BMS_GetCurrentFlowDirection(CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE* cmock_call_instance, int32_t current_mA);
+void CMockExpectParameters_BMS_GetCurrentFlowDirection(CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE* cmock_call_instance, int32_t current_mA)
+{
+  cmock_call_instance->Expected_current_mA = current_mA;
+  cmock_call_instance->IgnoreArg_current_mA = 0;
+}
+
+void BMS_GetCurrentFlowDirection_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CURRENT_FLOW_STATE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE));
+  CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetCurrentFlowDirection_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetCurrentFlowDirection_CallInstance, cmock_guts_index);
+  Mock.BMS_GetCurrentFlowDirection_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BMS_GetCurrentFlowDirection_IgnoreBool = (char)1;
+}
+
+void BMS_GetCurrentFlowDirection_CMockStopIgnore(void)
+{
+  if(Mock.BMS_GetCurrentFlowDirection_IgnoreBool)
+    Mock.BMS_GetCurrentFlowDirection_CallInstance = CMock_Guts_MemNext(Mock.BMS_GetCurrentFlowDirection_CallInstance);
+  Mock.BMS_GetCurrentFlowDirection_IgnoreBool = (char)0;
+}
+
+void BMS_GetCurrentFlowDirection_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int32_t current_mA, BMS_CURRENT_FLOW_STATE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE));
+  CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetCurrentFlowDirection_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetCurrentFlowDirection_CallInstance, cmock_guts_index);
+  Mock.BMS_GetCurrentFlowDirection_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BMS_GetCurrentFlowDirection(cmock_call_instance, current_mA);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BMS_CURRENT_FLOW_STATE_e[sizeof(cmock_to_return) == sizeof(BMS_CURRENT_FLOW_STATE_e) ? 1 : -1])); /* add BMS_CURRENT_FLOW_STATE_e to :treat_as_array if this causes an error */
+}
+
+void BMS_GetCurrentFlowDirection_AddCallback(CMOCK_BMS_GetCurrentFlowDirection_CALLBACK Callback)
+{
+  Mock.BMS_GetCurrentFlowDirection_IgnoreBool = (char)0;
+  Mock.BMS_GetCurrentFlowDirection_CallbackBool = (char)1;
+  Mock.BMS_GetCurrentFlowDirection_CallbackFunctionPointer = Callback;
+}
+
+void BMS_GetCurrentFlowDirection_Stub(CMOCK_BMS_GetCurrentFlowDirection_CALLBACK Callback)
+{
+  Mock.BMS_GetCurrentFlowDirection_IgnoreBool = (char)0;
+  Mock.BMS_GetCurrentFlowDirection_CallbackBool = (char)0;
+  Mock.BMS_GetCurrentFlowDirection_CallbackFunctionPointer = Callback;
+}
+
+void BMS_GetCurrentFlowDirection_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int32_t current_mA, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE));
+  CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_GetCurrentFlowDirection_CallInstance = CMock_Guts_MemChain(Mock.BMS_GetCurrentFlowDirection_CallInstance, cmock_guts_index);
+  Mock.BMS_GetCurrentFlowDirection_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BMS_GetCurrentFlowDirection(cmock_call_instance, current_mA);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BMS_GetCurrentFlowDirection_CMockIgnoreArg_current_mA(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_GetCurrentFlowDirection_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BMS_GetCurrentFlowDirection_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_current_mA = 1;
+}
+
+_Bool BMS_IsStringClosed(uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BMS_IsStringClosed_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BMS_IsStringClosed);
+  cmock_call_instance = (CMOCK_BMS_IsStringClosed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BMS_IsStringClosed_CallInstance);
+  Mock.BMS_IsStringClosed_CallInstance = CMock_Guts_MemNext(Mock.BMS_IsStringClosed_CallInstance);
+  if (Mock.BMS_IsStringClosed_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BMS_IsStringClosed_FinalReturn;
+    memcpy((void*)(&Mock.BMS_IsStringClosed_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BMS_IsStringClosed_CallbackBool &&
+      Mock.BMS_IsStringClosed_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.BMS_IsStringClosed_CallbackFunctionPointer(stringNumber, Mock.BMS_IsStringClosed_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_BMS_IsStringClosed,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BMS_IsStringClosed_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BMS_IsStringClosed_CallbackFunctionPointer(stringNumber, Mock.BMS_IsStringClosed_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_BMS_IsStringClosed(CMOCK_BMS_IsStringClosed_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber);
+void CMockExpectParameters_BMS_IsStringClosed(CMOCK_BMS_IsStringClosed_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void BMS_IsStringClosed_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_IsStringClosed_CALL_INSTANCE));
+  CMOCK_BMS_IsStringClosed_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_IsStringClosed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_IsStringClosed_CallInstance = CMock_Guts_MemChain(Mock.BMS_IsStringClosed_CallInstance, cmock_guts_index);
+  Mock.BMS_IsStringClosed_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BMS_IsStringClosed_IgnoreBool = (char)1;
+}
+
+void BMS_IsStringClosed_CMockStopIgnore(void)
+{
+  if(Mock.BMS_IsStringClosed_IgnoreBool)
+    Mock.BMS_IsStringClosed_CallInstance = CMock_Guts_MemNext(Mock.BMS_IsStringClosed_CallInstance);
+  Mock.BMS_IsStringClosed_IgnoreBool = (char)0;
+}
+
+void BMS_IsStringClosed_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_IsStringClosed_CALL_INSTANCE));
+  CMOCK_BMS_IsStringClosed_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_IsStringClosed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_IsStringClosed_CallInstance = CMock_Guts_MemChain(Mock.BMS_IsStringClosed_CallInstance, cmock_guts_index);
+  Mock.BMS_IsStringClosed_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BMS_IsStringClosed(cmock_call_instance, stringNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void BMS_IsStringClosed_AddCallback(CMOCK_BMS_IsStringClosed_CALLBACK Callback)
+{
+  Mock.BMS_IsStringClosed_IgnoreBool = (char)0;
+  Mock.BMS_IsStringClosed_CallbackBool = (char)1;
+  Mock.BMS_IsStringClosed_CallbackFunctionPointer = Callback;
+}
+
+void BMS_IsStringClosed_Stub(CMOCK_BMS_IsStringClosed_CALLBACK Callback)
+{
+  Mock.BMS_IsStringClosed_IgnoreBool = (char)0;
+  Mock.BMS_IsStringClosed_CallbackBool = (char)0;
+  Mock.BMS_IsStringClosed_CallbackFunctionPointer = Callback;
+}
+
+void BMS_IsStringClosed_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_IsStringClosed_CALL_INSTANCE));
+  CMOCK_BMS_IsStringClosed_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_IsStringClosed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_IsStringClosed_CallInstance = CMock_Guts_MemChain(Mock.BMS_IsStringClosed_CallInstance, cmock_guts_index);
+  Mock.BMS_IsStringClosed_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BMS_IsStringClosed(cmock_call_instance, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BMS_IsStringClosed_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BMS_IsStringClosed_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_IsStringClosed_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BMS_IsStringClosed_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+_Bool BMS_IsStringPrecharging(uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_BMS_IsStringPrecharging);
+  cmock_call_instance = (CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.BMS_IsStringPrecharging_CallInstance);
+  Mock.BMS_IsStringPrecharging_CallInstance = CMock_Guts_MemNext(Mock.BMS_IsStringPrecharging_CallInstance);
+  if (Mock.BMS_IsStringPrecharging_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.BMS_IsStringPrecharging_FinalReturn;
+    memcpy((void*)(&Mock.BMS_IsStringPrecharging_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.BMS_IsStringPrecharging_CallbackBool &&
+      Mock.BMS_IsStringPrecharging_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.BMS_IsStringPrecharging_CallbackFunctionPointer(stringNumber, Mock.BMS_IsStringPrecharging_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_BMS_IsStringPrecharging,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.BMS_IsStringPrecharging_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.BMS_IsStringPrecharging_CallbackFunctionPointer(stringNumber, Mock.BMS_IsStringPrecharging_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_BMS_IsStringPrecharging(CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber);
+void CMockExpectParameters_BMS_IsStringPrecharging(CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void BMS_IsStringPrecharging_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE));
+  CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_IsStringPrecharging_CallInstance = CMock_Guts_MemChain(Mock.BMS_IsStringPrecharging_CallInstance, cmock_guts_index);
+  Mock.BMS_IsStringPrecharging_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.BMS_IsStringPrecharging_IgnoreBool = (char)1;
+}
+
+void BMS_IsStringPrecharging_CMockStopIgnore(void)
+{
+  if(Mock.BMS_IsStringPrecharging_IgnoreBool)
+    Mock.BMS_IsStringPrecharging_CallInstance = CMock_Guts_MemNext(Mock.BMS_IsStringPrecharging_CallInstance);
+  Mock.BMS_IsStringPrecharging_IgnoreBool = (char)0;
+}
+
+void BMS_IsStringPrecharging_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE));
+  CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_IsStringPrecharging_CallInstance = CMock_Guts_MemChain(Mock.BMS_IsStringPrecharging_CallInstance, cmock_guts_index);
+  Mock.BMS_IsStringPrecharging_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BMS_IsStringPrecharging(cmock_call_instance, stringNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void BMS_IsStringPrecharging_AddCallback(CMOCK_BMS_IsStringPrecharging_CALLBACK Callback)
+{
+  Mock.BMS_IsStringPrecharging_IgnoreBool = (char)0;
+  Mock.BMS_IsStringPrecharging_CallbackBool = (char)1;
+  Mock.BMS_IsStringPrecharging_CallbackFunctionPointer = Callback;
+}
+
+void BMS_IsStringPrecharging_Stub(CMOCK_BMS_IsStringPrecharging_CALLBACK Callback)
+{
+  Mock.BMS_IsStringPrecharging_IgnoreBool = (char)0;
+  Mock.BMS_IsStringPrecharging_CallbackBool = (char)0;
+  Mock.BMS_IsStringPrecharging_CallbackFunctionPointer = Callback;
+}
+
+void BMS_IsStringPrecharging_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE));
+  CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.BMS_IsStringPrecharging_CallInstance = CMock_Guts_MemChain(Mock.BMS_IsStringPrecharging_CallInstance, cmock_guts_index);
+  Mock.BMS_IsStringPrecharging_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_BMS_IsStringPrecharging(cmock_call_instance, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void BMS_IsStringPrecharging_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE* cmock_call_instance = (CMOCK_BMS_IsStringPrecharging_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.BMS_IsStringPrecharging_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+BMS_RETURN_TYPE_e TEST_BMS_CheckStateRequest(BMS_STATE_REQUEST_e statereq)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckStateRequest);
+  cmock_call_instance = (CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_CheckStateRequest_CallInstance);
+  Mock.TEST_BMS_CheckStateRequest_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckStateRequest_CallInstance);
+  if (Mock.TEST_BMS_CheckStateRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_CheckStateRequest_FinalReturn;
+    memcpy((void*)(&Mock.TEST_BMS_CheckStateRequest_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BMS_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BMS_RETURN_TYPE_e) ? 1 : -1])); /* add BMS_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_CheckStateRequest_CallbackBool &&
+      Mock.TEST_BMS_CheckStateRequest_CallbackFunctionPointer != NULL)
+  {
+    BMS_RETURN_TYPE_e cmock_cb_ret = Mock.TEST_BMS_CheckStateRequest_CallbackFunctionPointer(statereq, Mock.TEST_BMS_CheckStateRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_statereq)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_CheckStateRequest,CMockString_statereq);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_statereq), (void*)(&statereq), sizeof(BMS_STATE_REQUEST_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_BMS_CheckStateRequest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_CheckStateRequest_CallbackFunctionPointer(statereq, Mock.TEST_BMS_CheckStateRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_BMS_CheckStateRequest(CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE* cmock_call_instance, BMS_STATE_REQUEST_e statereq);
+void CMockExpectParameters_TEST_BMS_CheckStateRequest(CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE* cmock_call_instance, BMS_STATE_REQUEST_e statereq)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_statereq), (void*)(&statereq),
+         sizeof(BMS_STATE_REQUEST_e[sizeof(statereq) == sizeof(BMS_STATE_REQUEST_e) ? 1 : -1])); /* add BMS_STATE_REQUEST_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_statereq = 0;
+}
+
+void TEST_BMS_CheckStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckStateRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckStateRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_CheckStateRequest_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_CheckStateRequest_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_CheckStateRequest_IgnoreBool)
+    Mock.TEST_BMS_CheckStateRequest_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckStateRequest_CallInstance);
+  Mock.TEST_BMS_CheckStateRequest_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_CheckStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e statereq, BMS_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckStateRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckStateRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_CheckStateRequest(cmock_call_instance, statereq);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BMS_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(BMS_RETURN_TYPE_e) ? 1 : -1])); /* add BMS_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void TEST_BMS_CheckStateRequest_AddCallback(CMOCK_TEST_BMS_CheckStateRequest_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckStateRequest_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckStateRequest_CallbackBool = (char)1;
+  Mock.TEST_BMS_CheckStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckStateRequest_Stub(CMOCK_TEST_BMS_CheckStateRequest_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckStateRequest_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckStateRequest_CallbackBool = (char)0;
+  Mock.TEST_BMS_CheckStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e statereq, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckStateRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckStateRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_CheckStateRequest(cmock_call_instance, statereq);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_CheckStateRequest_CMockIgnoreArg_statereq(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_CheckStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_statereq = 1;
+}
+
+BMS_STATE_REQUEST_e TEST_BMS_TransferStateRequest(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_TransferStateRequest);
+  cmock_call_instance = (CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_TransferStateRequest_CallInstance);
+  Mock.TEST_BMS_TransferStateRequest_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_TransferStateRequest_CallInstance);
+  if (Mock.TEST_BMS_TransferStateRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_TransferStateRequest_FinalReturn;
+    memcpy((void*)(&Mock.TEST_BMS_TransferStateRequest_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(BMS_STATE_REQUEST_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(BMS_STATE_REQUEST_e) ? 1 : -1])); /* add BMS_STATE_REQUEST_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_TransferStateRequest_CallbackBool &&
+      Mock.TEST_BMS_TransferStateRequest_CallbackFunctionPointer != NULL)
+  {
+    BMS_STATE_REQUEST_e cmock_cb_ret = Mock.TEST_BMS_TransferStateRequest_CallbackFunctionPointer(Mock.TEST_BMS_TransferStateRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_BMS_TransferStateRequest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_TransferStateRequest_CallbackFunctionPointer(Mock.TEST_BMS_TransferStateRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_BMS_TransferStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE));
+  CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_TransferStateRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_TransferStateRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_TransferStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_TransferStateRequest_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_TransferStateRequest_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_TransferStateRequest_IgnoreBool)
+    Mock.TEST_BMS_TransferStateRequest_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_TransferStateRequest_CallInstance);
+  Mock.TEST_BMS_TransferStateRequest_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_TransferStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE));
+  CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_TransferStateRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_TransferStateRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_TransferStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(BMS_STATE_REQUEST_e[sizeof(cmock_to_return) == sizeof(BMS_STATE_REQUEST_e) ? 1 : -1])); /* add BMS_STATE_REQUEST_e to :treat_as_array if this causes an error */
+}
+
+void TEST_BMS_TransferStateRequest_AddCallback(CMOCK_TEST_BMS_TransferStateRequest_CALLBACK Callback)
+{
+  Mock.TEST_BMS_TransferStateRequest_IgnoreBool = (char)0;
+  Mock.TEST_BMS_TransferStateRequest_CallbackBool = (char)1;
+  Mock.TEST_BMS_TransferStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_TransferStateRequest_Stub(CMOCK_TEST_BMS_TransferStateRequest_CALLBACK Callback)
+{
+  Mock.TEST_BMS_TransferStateRequest_IgnoreBool = (char)0;
+  Mock.TEST_BMS_TransferStateRequest_CallbackBool = (char)0;
+  Mock.TEST_BMS_TransferStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_TransferStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE));
+  CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_TransferStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_TransferStateRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_TransferStateRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_TransferStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint8_t TEST_BMS_CheckReEntrance(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckReEntrance);
+  cmock_call_instance = (CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_CheckReEntrance_CallInstance);
+  Mock.TEST_BMS_CheckReEntrance_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckReEntrance_CallInstance);
+  if (Mock.TEST_BMS_CheckReEntrance_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_CheckReEntrance_FinalReturn;
+    Mock.TEST_BMS_CheckReEntrance_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_CheckReEntrance_CallbackBool &&
+      Mock.TEST_BMS_CheckReEntrance_CallbackFunctionPointer != NULL)
+  {
+    uint8_t cmock_cb_ret = Mock.TEST_BMS_CheckReEntrance_CallbackFunctionPointer(Mock.TEST_BMS_CheckReEntrance_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_BMS_CheckReEntrance_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_CheckReEntrance_CallbackFunctionPointer(Mock.TEST_BMS_CheckReEntrance_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_BMS_CheckReEntrance_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckReEntrance_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckReEntrance_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckReEntrance_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_CheckReEntrance_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_CheckReEntrance_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_CheckReEntrance_IgnoreBool)
+    Mock.TEST_BMS_CheckReEntrance_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckReEntrance_CallInstance);
+  Mock.TEST_BMS_CheckReEntrance_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_CheckReEntrance_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckReEntrance_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckReEntrance_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckReEntrance_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_BMS_CheckReEntrance_AddCallback(CMOCK_TEST_BMS_CheckReEntrance_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckReEntrance_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckReEntrance_CallbackBool = (char)1;
+  Mock.TEST_BMS_CheckReEntrance_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckReEntrance_Stub(CMOCK_TEST_BMS_CheckReEntrance_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckReEntrance_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckReEntrance_CallbackBool = (char)0;
+  Mock.TEST_BMS_CheckReEntrance_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckReEntrance_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckReEntrance_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckReEntrance_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckReEntrance_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckReEntrance_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint8_t TEST_BMS_CheckCanRequests(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckCanRequests);
+  cmock_call_instance = (CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_CheckCanRequests_CallInstance);
+  Mock.TEST_BMS_CheckCanRequests_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckCanRequests_CallInstance);
+  if (Mock.TEST_BMS_CheckCanRequests_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_CheckCanRequests_FinalReturn;
+    Mock.TEST_BMS_CheckCanRequests_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_CheckCanRequests_CallbackBool &&
+      Mock.TEST_BMS_CheckCanRequests_CallbackFunctionPointer != NULL)
+  {
+    uint8_t cmock_cb_ret = Mock.TEST_BMS_CheckCanRequests_CallbackFunctionPointer(Mock.TEST_BMS_CheckCanRequests_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_BMS_CheckCanRequests_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_CheckCanRequests_CallbackFunctionPointer(Mock.TEST_BMS_CheckCanRequests_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_BMS_CheckCanRequests_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckCanRequests_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckCanRequests_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckCanRequests_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_CheckCanRequests_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_CheckCanRequests_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_CheckCanRequests_IgnoreBool)
+    Mock.TEST_BMS_CheckCanRequests_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckCanRequests_CallInstance);
+  Mock.TEST_BMS_CheckCanRequests_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_CheckCanRequests_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckCanRequests_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckCanRequests_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckCanRequests_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_BMS_CheckCanRequests_AddCallback(CMOCK_TEST_BMS_CheckCanRequests_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckCanRequests_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckCanRequests_CallbackBool = (char)1;
+  Mock.TEST_BMS_CheckCanRequests_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckCanRequests_Stub(CMOCK_TEST_BMS_CheckCanRequests_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckCanRequests_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckCanRequests_CallbackBool = (char)0;
+  Mock.TEST_BMS_CheckCanRequests_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckCanRequests_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckCanRequests_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckCanRequests_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckCanRequests_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckCanRequests_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e TEST_BMS_CheckAnyErrorFlagSet(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckAnyErrorFlagSet);
+  cmock_call_instance = (CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance);
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance);
+  if (Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_CheckAnyErrorFlagSet_FinalReturn;
+    memcpy((void*)(&Mock.TEST_BMS_CheckAnyErrorFlagSet_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackBool &&
+      Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackFunctionPointer(Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackFunctionPointer(Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_BMS_CheckAnyErrorFlagSet_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_CheckAnyErrorFlagSet_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool)
+    Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance);
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_CheckAnyErrorFlagSet_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void TEST_BMS_CheckAnyErrorFlagSet_AddCallback(CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackBool = (char)1;
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckAnyErrorFlagSet_Stub(CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackBool = (char)0;
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckAnyErrorFlagSet_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckAnyErrorFlagSet_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckAnyErrorFlagSet_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_GetMeasurementValues(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_GetMeasurementValues);
+  cmock_call_instance = (CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_GetMeasurementValues_CallInstance);
+  Mock.TEST_BMS_GetMeasurementValues_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetMeasurementValues_CallInstance);
+  if (Mock.TEST_BMS_GetMeasurementValues_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_BMS_GetMeasurementValues_CallbackBool &&
+      Mock.TEST_BMS_GetMeasurementValues_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_BMS_GetMeasurementValues_CallbackFunctionPointer(Mock.TEST_BMS_GetMeasurementValues_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_BMS_GetMeasurementValues_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_BMS_GetMeasurementValues_CallbackFunctionPointer(Mock.TEST_BMS_GetMeasurementValues_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void TEST_BMS_GetMeasurementValues_CMockIgnore(void)
+{
+  Mock.TEST_BMS_GetMeasurementValues_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_GetMeasurementValues_CMockStopIgnore(void)
+{
+  Mock.TEST_BMS_GetMeasurementValues_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_GetMeasurementValues_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetMeasurementValues_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetMeasurementValues_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetMeasurementValues_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void TEST_BMS_GetMeasurementValues_AddCallback(CMOCK_TEST_BMS_GetMeasurementValues_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetMeasurementValues_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetMeasurementValues_CallbackBool = (char)1;
+  Mock.TEST_BMS_GetMeasurementValues_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetMeasurementValues_Stub(CMOCK_TEST_BMS_GetMeasurementValues_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetMeasurementValues_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetMeasurementValues_CallbackBool = (char)0;
+  Mock.TEST_BMS_GetMeasurementValues_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetMeasurementValues_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetMeasurementValues_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetMeasurementValues_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetMeasurementValues_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetMeasurementValues_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_CheckOpenSenseWire(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckOpenSenseWire);
+  cmock_call_instance = (CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_CheckOpenSenseWire_CallInstance);
+  Mock.TEST_BMS_CheckOpenSenseWire_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckOpenSenseWire_CallInstance);
+  if (Mock.TEST_BMS_CheckOpenSenseWire_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_BMS_CheckOpenSenseWire_CallbackBool &&
+      Mock.TEST_BMS_CheckOpenSenseWire_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_BMS_CheckOpenSenseWire_CallbackFunctionPointer(Mock.TEST_BMS_CheckOpenSenseWire_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_BMS_CheckOpenSenseWire_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_BMS_CheckOpenSenseWire_CallbackFunctionPointer(Mock.TEST_BMS_CheckOpenSenseWire_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void TEST_BMS_CheckOpenSenseWire_CMockIgnore(void)
+{
+  Mock.TEST_BMS_CheckOpenSenseWire_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_CheckOpenSenseWire_CMockStopIgnore(void)
+{
+  Mock.TEST_BMS_CheckOpenSenseWire_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_CheckOpenSenseWire_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckOpenSenseWire_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckOpenSenseWire_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckOpenSenseWire_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void TEST_BMS_CheckOpenSenseWire_AddCallback(CMOCK_TEST_BMS_CheckOpenSenseWire_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckOpenSenseWire_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckOpenSenseWire_CallbackBool = (char)1;
+  Mock.TEST_BMS_CheckOpenSenseWire_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckOpenSenseWire_Stub(CMOCK_TEST_BMS_CheckOpenSenseWire_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckOpenSenseWire_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckOpenSenseWire_CallbackBool = (char)0;
+  Mock.TEST_BMS_CheckOpenSenseWire_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckOpenSenseWire_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckOpenSenseWire_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckOpenSenseWire_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckOpenSenseWire_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckOpenSenseWire_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e TEST_BMS_CheckPrecharge(uint8_t stringNumber, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_CheckPrecharge);
+  cmock_call_instance = (CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_CheckPrecharge_CallInstance);
+  Mock.TEST_BMS_CheckPrecharge_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckPrecharge_CallInstance);
+  if (Mock.TEST_BMS_CheckPrecharge_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_CheckPrecharge_FinalReturn;
+    memcpy((void*)(&Mock.TEST_BMS_CheckPrecharge_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_CheckPrecharge_CallbackBool &&
+      Mock.TEST_BMS_CheckPrecharge_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.TEST_BMS_CheckPrecharge_CallbackFunctionPointer(stringNumber, pPackValues, Mock.TEST_BMS_CheckPrecharge_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_CheckPrecharge,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pPackValues)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_CheckPrecharge,CMockString_pPackValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pPackValues), (void*)(pPackValues), sizeof(DATA_BLOCK_PACK_VALUES_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_BMS_CheckPrecharge_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_CheckPrecharge_CallbackFunctionPointer(stringNumber, pPackValues, Mock.TEST_BMS_CheckPrecharge_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pPackValues_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pPackValues, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pPackValues, (void*)cmock_call_instance->ReturnThruPtr_pPackValues_Val,
+      cmock_call_instance->ReturnThruPtr_pPackValues_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_BMS_CheckPrecharge(CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber, DATA_BLOCK_PACK_VALUES_s* pPackValues);
+void CMockExpectParameters_TEST_BMS_CheckPrecharge(CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+  cmock_call_instance->Expected_pPackValues = pPackValues;
+  cmock_call_instance->IgnoreArg_pPackValues = 0;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 0;
+}
+
+void TEST_BMS_CheckPrecharge_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckPrecharge_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckPrecharge_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckPrecharge_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_CheckPrecharge_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_CheckPrecharge_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_CheckPrecharge_IgnoreBool)
+    Mock.TEST_BMS_CheckPrecharge_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_CheckPrecharge_CallInstance);
+  Mock.TEST_BMS_CheckPrecharge_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_CheckPrecharge_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, DATA_BLOCK_PACK_VALUES_s* pPackValues, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckPrecharge_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckPrecharge_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckPrecharge_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_CheckPrecharge(cmock_call_instance, stringNumber, pPackValues);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void TEST_BMS_CheckPrecharge_AddCallback(CMOCK_TEST_BMS_CheckPrecharge_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckPrecharge_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckPrecharge_CallbackBool = (char)1;
+  Mock.TEST_BMS_CheckPrecharge_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckPrecharge_Stub(CMOCK_TEST_BMS_CheckPrecharge_CALLBACK Callback)
+{
+  Mock.TEST_BMS_CheckPrecharge_IgnoreBool = (char)0;
+  Mock.TEST_BMS_CheckPrecharge_CallbackBool = (char)0;
+  Mock.TEST_BMS_CheckPrecharge_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_CheckPrecharge_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE));
+  CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_CheckPrecharge_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_CheckPrecharge_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_CheckPrecharge_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_CheckPrecharge(cmock_call_instance, stringNumber, pPackValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_CheckPrecharge_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size)
+{
+  CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_CheckPrecharge_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Val = pPackValues;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Size = cmock_size;
+}
+
+void TEST_BMS_CheckPrecharge_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_CheckPrecharge_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+void TEST_BMS_CheckPrecharge_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_CheckPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_CheckPrecharge_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pPackValues = 1;
+}
+
+uint8_t TEST_BMS_GetHighestString(BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_GetHighestString);
+  cmock_call_instance = (CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_GetHighestString_CallInstance);
+  Mock.TEST_BMS_GetHighestString_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetHighestString_CallInstance);
+  if (Mock.TEST_BMS_GetHighestString_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_GetHighestString_FinalReturn;
+    Mock.TEST_BMS_GetHighestString_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_GetHighestString_CallbackBool &&
+      Mock.TEST_BMS_GetHighestString_CallbackFunctionPointer != NULL)
+  {
+    uint8_t cmock_cb_ret = Mock.TEST_BMS_GetHighestString_CallbackFunctionPointer(precharge, pPackValues, Mock.TEST_BMS_GetHighestString_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_precharge)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_GetHighestString,CMockString_precharge);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_precharge), (void*)(&precharge), sizeof(BMS_CONSIDER_PRECHARGE_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pPackValues)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_GetHighestString,CMockString_pPackValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pPackValues), (void*)(pPackValues), sizeof(DATA_BLOCK_PACK_VALUES_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_BMS_GetHighestString_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_GetHighestString_CallbackFunctionPointer(precharge, pPackValues, Mock.TEST_BMS_GetHighestString_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pPackValues_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pPackValues, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pPackValues, (void*)cmock_call_instance->ReturnThruPtr_pPackValues_Val,
+      cmock_call_instance->ReturnThruPtr_pPackValues_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_BMS_GetHighestString(CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE* cmock_call_instance, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues);
+void CMockExpectParameters_TEST_BMS_GetHighestString(CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE* cmock_call_instance, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_precharge), (void*)(&precharge),
+         sizeof(BMS_CONSIDER_PRECHARGE_e[sizeof(precharge) == sizeof(BMS_CONSIDER_PRECHARGE_e) ? 1 : -1])); /* add BMS_CONSIDER_PRECHARGE_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_precharge = 0;
+  cmock_call_instance->Expected_pPackValues = pPackValues;
+  cmock_call_instance->IgnoreArg_pPackValues = 0;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 0;
+}
+
+void TEST_BMS_GetHighestString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetHighestString_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetHighestString_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetHighestString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_GetHighestString_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_GetHighestString_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_GetHighestString_IgnoreBool)
+    Mock.TEST_BMS_GetHighestString_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetHighestString_CallInstance);
+  Mock.TEST_BMS_GetHighestString_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_GetHighestString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetHighestString_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetHighestString_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetHighestString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetHighestString(cmock_call_instance, precharge, pPackValues);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_BMS_GetHighestString_AddCallback(CMOCK_TEST_BMS_GetHighestString_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetHighestString_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetHighestString_CallbackBool = (char)1;
+  Mock.TEST_BMS_GetHighestString_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetHighestString_Stub(CMOCK_TEST_BMS_GetHighestString_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetHighestString_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetHighestString_CallbackBool = (char)0;
+  Mock.TEST_BMS_GetHighestString_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetHighestString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetHighestString_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetHighestString_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetHighestString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetHighestString(cmock_call_instance, precharge, pPackValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_GetHighestString_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size)
+{
+  CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetHighestString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Val = pPackValues;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Size = cmock_size;
+}
+
+void TEST_BMS_GetHighestString_CMockIgnoreArg_precharge(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetHighestString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_precharge = 1;
+}
+
+void TEST_BMS_GetHighestString_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetHighestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetHighestString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pPackValues = 1;
+}
+
+uint8_t TEST_BMS_GetClosestString(BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_GetClosestString);
+  cmock_call_instance = (CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_GetClosestString_CallInstance);
+  Mock.TEST_BMS_GetClosestString_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetClosestString_CallInstance);
+  if (Mock.TEST_BMS_GetClosestString_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_GetClosestString_FinalReturn;
+    Mock.TEST_BMS_GetClosestString_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_GetClosestString_CallbackBool &&
+      Mock.TEST_BMS_GetClosestString_CallbackFunctionPointer != NULL)
+  {
+    uint8_t cmock_cb_ret = Mock.TEST_BMS_GetClosestString_CallbackFunctionPointer(precharge, pPackValues, Mock.TEST_BMS_GetClosestString_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_precharge)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_GetClosestString,CMockString_precharge);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_precharge), (void*)(&precharge), sizeof(BMS_CONSIDER_PRECHARGE_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pPackValues)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_GetClosestString,CMockString_pPackValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pPackValues), (void*)(pPackValues), sizeof(DATA_BLOCK_PACK_VALUES_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_BMS_GetClosestString_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_GetClosestString_CallbackFunctionPointer(precharge, pPackValues, Mock.TEST_BMS_GetClosestString_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pPackValues_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pPackValues, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pPackValues, (void*)cmock_call_instance->ReturnThruPtr_pPackValues_Val,
+      cmock_call_instance->ReturnThruPtr_pPackValues_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_BMS_GetClosestString(CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE* cmock_call_instance, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues);
+void CMockExpectParameters_TEST_BMS_GetClosestString(CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE* cmock_call_instance, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_precharge), (void*)(&precharge),
+         sizeof(BMS_CONSIDER_PRECHARGE_e[sizeof(precharge) == sizeof(BMS_CONSIDER_PRECHARGE_e) ? 1 : -1])); /* add BMS_CONSIDER_PRECHARGE_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_precharge = 0;
+  cmock_call_instance->Expected_pPackValues = pPackValues;
+  cmock_call_instance->IgnoreArg_pPackValues = 0;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 0;
+}
+
+void TEST_BMS_GetClosestString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetClosestString_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetClosestString_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetClosestString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_GetClosestString_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_GetClosestString_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_GetClosestString_IgnoreBool)
+    Mock.TEST_BMS_GetClosestString_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetClosestString_CallInstance);
+  Mock.TEST_BMS_GetClosestString_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_GetClosestString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetClosestString_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetClosestString_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetClosestString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetClosestString(cmock_call_instance, precharge, pPackValues);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_BMS_GetClosestString_AddCallback(CMOCK_TEST_BMS_GetClosestString_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetClosestString_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetClosestString_CallbackBool = (char)1;
+  Mock.TEST_BMS_GetClosestString_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetClosestString_Stub(CMOCK_TEST_BMS_GetClosestString_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetClosestString_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetClosestString_CallbackBool = (char)0;
+  Mock.TEST_BMS_GetClosestString_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetClosestString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetClosestString_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetClosestString_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetClosestString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetClosestString(cmock_call_instance, precharge, pPackValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_GetClosestString_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size)
+{
+  CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetClosestString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Val = pPackValues;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Size = cmock_size;
+}
+
+void TEST_BMS_GetClosestString_CMockIgnoreArg_precharge(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetClosestString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_precharge = 1;
+}
+
+void TEST_BMS_GetClosestString_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetClosestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetClosestString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pPackValues = 1;
+}
+
+uint8_t TEST_BMS_GetLowestString(BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_GetLowestString);
+  cmock_call_instance = (CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_GetLowestString_CallInstance);
+  Mock.TEST_BMS_GetLowestString_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetLowestString_CallInstance);
+  if (Mock.TEST_BMS_GetLowestString_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_GetLowestString_FinalReturn;
+    Mock.TEST_BMS_GetLowestString_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_GetLowestString_CallbackBool &&
+      Mock.TEST_BMS_GetLowestString_CallbackFunctionPointer != NULL)
+  {
+    uint8_t cmock_cb_ret = Mock.TEST_BMS_GetLowestString_CallbackFunctionPointer(precharge, pPackValues, Mock.TEST_BMS_GetLowestString_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_precharge)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_GetLowestString,CMockString_precharge);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_precharge), (void*)(&precharge), sizeof(BMS_CONSIDER_PRECHARGE_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pPackValues)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_GetLowestString,CMockString_pPackValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pPackValues), (void*)(pPackValues), sizeof(DATA_BLOCK_PACK_VALUES_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_BMS_GetLowestString_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_GetLowestString_CallbackFunctionPointer(precharge, pPackValues, Mock.TEST_BMS_GetLowestString_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pPackValues_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pPackValues, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pPackValues, (void*)cmock_call_instance->ReturnThruPtr_pPackValues_Val,
+      cmock_call_instance->ReturnThruPtr_pPackValues_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_BMS_GetLowestString(CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE* cmock_call_instance, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues);
+void CMockExpectParameters_TEST_BMS_GetLowestString(CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE* cmock_call_instance, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_precharge), (void*)(&precharge),
+         sizeof(BMS_CONSIDER_PRECHARGE_e[sizeof(precharge) == sizeof(BMS_CONSIDER_PRECHARGE_e) ? 1 : -1])); /* add BMS_CONSIDER_PRECHARGE_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_precharge = 0;
+  cmock_call_instance->Expected_pPackValues = pPackValues;
+  cmock_call_instance->IgnoreArg_pPackValues = 0;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 0;
+}
+
+void TEST_BMS_GetLowestString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetLowestString_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetLowestString_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetLowestString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_GetLowestString_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_GetLowestString_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_GetLowestString_IgnoreBool)
+    Mock.TEST_BMS_GetLowestString_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetLowestString_CallInstance);
+  Mock.TEST_BMS_GetLowestString_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_GetLowestString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetLowestString_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetLowestString_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetLowestString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetLowestString(cmock_call_instance, precharge, pPackValues);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_BMS_GetLowestString_AddCallback(CMOCK_TEST_BMS_GetLowestString_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetLowestString_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetLowestString_CallbackBool = (char)1;
+  Mock.TEST_BMS_GetLowestString_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetLowestString_Stub(CMOCK_TEST_BMS_GetLowestString_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetLowestString_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetLowestString_CallbackBool = (char)0;
+  Mock.TEST_BMS_GetLowestString_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetLowestString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetLowestString_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetLowestString_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetLowestString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetLowestString(cmock_call_instance, precharge, pPackValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_GetLowestString_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size)
+{
+  CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetLowestString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Val = pPackValues;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Size = cmock_size;
+}
+
+void TEST_BMS_GetLowestString_CMockIgnoreArg_precharge(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetLowestString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_precharge = 1;
+}
+
+void TEST_BMS_GetLowestString_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetLowestString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetLowestString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pPackValues = 1;
+}
+
+int32_t TEST_BMS_GetStringVoltageDifference(uint8_t string, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_GetStringVoltageDifference);
+  cmock_call_instance = (CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_GetStringVoltageDifference_CallInstance);
+  Mock.TEST_BMS_GetStringVoltageDifference_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetStringVoltageDifference_CallInstance);
+  if (Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_GetStringVoltageDifference_FinalReturn;
+    Mock.TEST_BMS_GetStringVoltageDifference_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_GetStringVoltageDifference_CallbackBool &&
+      Mock.TEST_BMS_GetStringVoltageDifference_CallbackFunctionPointer != NULL)
+  {
+    int32_t cmock_cb_ret = Mock.TEST_BMS_GetStringVoltageDifference_CallbackFunctionPointer(string, pPackValues, Mock.TEST_BMS_GetStringVoltageDifference_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_GetStringVoltageDifference,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pPackValues)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_GetStringVoltageDifference,CMockString_pPackValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pPackValues), (void*)(pPackValues), sizeof(DATA_BLOCK_PACK_VALUES_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_BMS_GetStringVoltageDifference_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_GetStringVoltageDifference_CallbackFunctionPointer(string, pPackValues, Mock.TEST_BMS_GetStringVoltageDifference_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pPackValues_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pPackValues, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pPackValues, (void*)cmock_call_instance->ReturnThruPtr_pPackValues_Val,
+      cmock_call_instance->ReturnThruPtr_pPackValues_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_BMS_GetStringVoltageDifference(CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE* cmock_call_instance, uint8_t string, DATA_BLOCK_PACK_VALUES_s* pPackValues);
+void CMockExpectParameters_TEST_BMS_GetStringVoltageDifference(CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE* cmock_call_instance, uint8_t string, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+  cmock_call_instance->Expected_pPackValues = pPackValues;
+  cmock_call_instance->IgnoreArg_pPackValues = 0;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 0;
+}
+
+void TEST_BMS_GetStringVoltageDifference_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetStringVoltageDifference_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetStringVoltageDifference_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_GetStringVoltageDifference_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool)
+    Mock.TEST_BMS_GetStringVoltageDifference_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetStringVoltageDifference_CallInstance);
+  Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_GetStringVoltageDifference_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, DATA_BLOCK_PACK_VALUES_s* pPackValues, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetStringVoltageDifference_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetStringVoltageDifference_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetStringVoltageDifference(cmock_call_instance, string, pPackValues);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_BMS_GetStringVoltageDifference_AddCallback(CMOCK_TEST_BMS_GetStringVoltageDifference_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetStringVoltageDifference_CallbackBool = (char)1;
+  Mock.TEST_BMS_GetStringVoltageDifference_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetStringVoltageDifference_Stub(CMOCK_TEST_BMS_GetStringVoltageDifference_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetStringVoltageDifference_CallbackBool = (char)0;
+  Mock.TEST_BMS_GetStringVoltageDifference_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetStringVoltageDifference_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetStringVoltageDifference_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetStringVoltageDifference_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetStringVoltageDifference_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetStringVoltageDifference(cmock_call_instance, string, pPackValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_GetStringVoltageDifference_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size)
+{
+  CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetStringVoltageDifference_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Val = pPackValues;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Size = cmock_size;
+}
+
+void TEST_BMS_GetStringVoltageDifference_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetStringVoltageDifference_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+void TEST_BMS_GetStringVoltageDifference_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetStringVoltageDifference_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetStringVoltageDifference_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pPackValues = 1;
+}
+
+int32_t TEST_BMS_GetAverageStringCurrent(DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_GetAverageStringCurrent);
+  cmock_call_instance = (CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_GetAverageStringCurrent_CallInstance);
+  Mock.TEST_BMS_GetAverageStringCurrent_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetAverageStringCurrent_CallInstance);
+  if (Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_BMS_GetAverageStringCurrent_FinalReturn;
+    Mock.TEST_BMS_GetAverageStringCurrent_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_BMS_GetAverageStringCurrent_CallbackBool &&
+      Mock.TEST_BMS_GetAverageStringCurrent_CallbackFunctionPointer != NULL)
+  {
+    int32_t cmock_cb_ret = Mock.TEST_BMS_GetAverageStringCurrent_CallbackFunctionPointer(pPackValues, Mock.TEST_BMS_GetAverageStringCurrent_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pPackValues)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_GetAverageStringCurrent,CMockString_pPackValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pPackValues), (void*)(pPackValues), sizeof(DATA_BLOCK_PACK_VALUES_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_BMS_GetAverageStringCurrent_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_BMS_GetAverageStringCurrent_CallbackFunctionPointer(pPackValues, Mock.TEST_BMS_GetAverageStringCurrent_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pPackValues_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pPackValues, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pPackValues, (void*)cmock_call_instance->ReturnThruPtr_pPackValues_Val,
+      cmock_call_instance->ReturnThruPtr_pPackValues_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_BMS_GetAverageStringCurrent(CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_PACK_VALUES_s* pPackValues);
+void CMockExpectParameters_TEST_BMS_GetAverageStringCurrent(CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  cmock_call_instance->Expected_pPackValues = pPackValues;
+  cmock_call_instance->IgnoreArg_pPackValues = 0;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 0;
+}
+
+void TEST_BMS_GetAverageStringCurrent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetAverageStringCurrent_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetAverageStringCurrent_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_GetAverageStringCurrent_CMockStopIgnore(void)
+{
+  if(Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool)
+    Mock.TEST_BMS_GetAverageStringCurrent_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_GetAverageStringCurrent_CallInstance);
+  Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_GetAverageStringCurrent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetAverageStringCurrent_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetAverageStringCurrent_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetAverageStringCurrent(cmock_call_instance, pPackValues);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_BMS_GetAverageStringCurrent_AddCallback(CMOCK_TEST_BMS_GetAverageStringCurrent_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetAverageStringCurrent_CallbackBool = (char)1;
+  Mock.TEST_BMS_GetAverageStringCurrent_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetAverageStringCurrent_Stub(CMOCK_TEST_BMS_GetAverageStringCurrent_CALLBACK Callback)
+{
+  Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool = (char)0;
+  Mock.TEST_BMS_GetAverageStringCurrent_CallbackBool = (char)0;
+  Mock.TEST_BMS_GetAverageStringCurrent_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_GetAverageStringCurrent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE));
+  CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_GetAverageStringCurrent_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_GetAverageStringCurrent_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_GetAverageStringCurrent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_GetAverageStringCurrent(cmock_call_instance, pPackValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_GetAverageStringCurrent_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size)
+{
+  CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetAverageStringCurrent_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Val = pPackValues;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Size = cmock_size;
+}
+
+void TEST_BMS_GetAverageStringCurrent_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_GetAverageStringCurrent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_GetAverageStringCurrent_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pPackValues = 1;
+}
+
+void TEST_BMS_UpdateBatsysState(DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_BMS_UpdateBatsysState);
+  cmock_call_instance = (CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_BMS_UpdateBatsysState_CallInstance);
+  Mock.TEST_BMS_UpdateBatsysState_CallInstance = CMock_Guts_MemNext(Mock.TEST_BMS_UpdateBatsysState_CallInstance);
+  if (Mock.TEST_BMS_UpdateBatsysState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_BMS_UpdateBatsysState_CallbackBool &&
+      Mock.TEST_BMS_UpdateBatsysState_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_BMS_UpdateBatsysState_CallbackFunctionPointer(pPackValues, Mock.TEST_BMS_UpdateBatsysState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pPackValues)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_BMS_UpdateBatsysState,CMockString_pPackValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pPackValues), (void*)(pPackValues), sizeof(DATA_BLOCK_PACK_VALUES_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_BMS_UpdateBatsysState_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_BMS_UpdateBatsysState_CallbackFunctionPointer(pPackValues, Mock.TEST_BMS_UpdateBatsysState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pPackValues_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pPackValues, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pPackValues, (void*)cmock_call_instance->ReturnThruPtr_pPackValues_Val,
+      cmock_call_instance->ReturnThruPtr_pPackValues_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_BMS_UpdateBatsysState(CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_PACK_VALUES_s* pPackValues);
+void CMockExpectParameters_TEST_BMS_UpdateBatsysState(CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  cmock_call_instance->Expected_pPackValues = pPackValues;
+  cmock_call_instance->IgnoreArg_pPackValues = 0;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 0;
+}
+
+void TEST_BMS_UpdateBatsysState_CMockIgnore(void)
+{
+  Mock.TEST_BMS_UpdateBatsysState_IgnoreBool = (char)1;
+}
+
+void TEST_BMS_UpdateBatsysState_CMockStopIgnore(void)
+{
+  Mock.TEST_BMS_UpdateBatsysState_IgnoreBool = (char)0;
+}
+
+void TEST_BMS_UpdateBatsysState_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE));
+  CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_UpdateBatsysState_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_UpdateBatsysState_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_UpdateBatsysState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_UpdateBatsysState(cmock_call_instance, pPackValues);
+}
+
+void TEST_BMS_UpdateBatsysState_AddCallback(CMOCK_TEST_BMS_UpdateBatsysState_CALLBACK Callback)
+{
+  Mock.TEST_BMS_UpdateBatsysState_IgnoreBool = (char)0;
+  Mock.TEST_BMS_UpdateBatsysState_CallbackBool = (char)1;
+  Mock.TEST_BMS_UpdateBatsysState_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_UpdateBatsysState_Stub(CMOCK_TEST_BMS_UpdateBatsysState_CALLBACK Callback)
+{
+  Mock.TEST_BMS_UpdateBatsysState_IgnoreBool = (char)0;
+  Mock.TEST_BMS_UpdateBatsysState_CallbackBool = (char)0;
+  Mock.TEST_BMS_UpdateBatsysState_CallbackFunctionPointer = Callback;
+}
+
+void TEST_BMS_UpdateBatsysState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE));
+  CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_BMS_UpdateBatsysState_CallInstance = CMock_Guts_MemChain(Mock.TEST_BMS_UpdateBatsysState_CallInstance, cmock_guts_index);
+  Mock.TEST_BMS_UpdateBatsysState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_BMS_UpdateBatsysState(cmock_call_instance, pPackValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_BMS_UpdateBatsysState_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size)
+{
+  CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_UpdateBatsysState_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pPackValues_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Val = pPackValues;
+  cmock_call_instance->ReturnThruPtr_pPackValues_Size = cmock_size;
+}
+
+void TEST_BMS_UpdateBatsysState_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_BMS_UpdateBatsysState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_BMS_UpdateBatsysState_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pPackValues = 1;
+}
+
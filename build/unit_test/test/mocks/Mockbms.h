@@ -0,0 +1,372 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKBMS_H
+#define _MOCKBMS_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "bms.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockbms_Init(void);
+void Mockbms_Destroy(void);
+void Mockbms_Verify(void);
+
+
+
+
+#define BMS_SetStateRequest_IgnoreAndReturn(cmock_retval) BMS_SetStateRequest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BMS_SetStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_RETURN_TYPE_e cmock_to_return);
+#define BMS_SetStateRequest_StopIgnore() BMS_SetStateRequest_CMockStopIgnore()
+void BMS_SetStateRequest_CMockStopIgnore(void);
+#define BMS_SetStateRequest_ExpectAndReturn(statereq, cmock_retval) BMS_SetStateRequest_CMockExpectAndReturn(__LINE__, statereq, cmock_retval)
+void BMS_SetStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e statereq, BMS_RETURN_TYPE_e cmock_to_return);
+typedef BMS_RETURN_TYPE_e (* CMOCK_BMS_SetStateRequest_CALLBACK)(BMS_STATE_REQUEST_e statereq, int cmock_num_calls);
+void BMS_SetStateRequest_AddCallback(CMOCK_BMS_SetStateRequest_CALLBACK Callback);
+void BMS_SetStateRequest_Stub(CMOCK_BMS_SetStateRequest_CALLBACK Callback);
+#define BMS_SetStateRequest_StubWithCallback BMS_SetStateRequest_Stub
+#define BMS_SetStateRequest_ExpectAndThrow(statereq, cmock_to_throw) BMS_SetStateRequest_CMockExpectAndThrow(__LINE__, statereq, cmock_to_throw)
+void BMS_SetStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e statereq, CEXCEPTION_T cmock_to_throw);
+#define BMS_SetStateRequest_IgnoreArg_statereq() BMS_SetStateRequest_CMockIgnoreArg_statereq(__LINE__)
+void BMS_SetStateRequest_CMockIgnoreArg_statereq(UNITY_LINE_TYPE cmock_line);
+#define BMS_GetState_IgnoreAndReturn(cmock_retval) BMS_GetState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BMS_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATEMACH_e cmock_to_return);
+#define BMS_GetState_StopIgnore() BMS_GetState_CMockStopIgnore()
+void BMS_GetState_CMockStopIgnore(void);
+#define BMS_GetState_ExpectAndReturn(cmock_retval) BMS_GetState_CMockExpectAndReturn(__LINE__, cmock_retval)
+void BMS_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATEMACH_e cmock_to_return);
+typedef BMS_STATEMACH_e (* CMOCK_BMS_GetState_CALLBACK)(int cmock_num_calls);
+void BMS_GetState_AddCallback(CMOCK_BMS_GetState_CALLBACK Callback);
+void BMS_GetState_Stub(CMOCK_BMS_GetState_CALLBACK Callback);
+#define BMS_GetState_StubWithCallback BMS_GetState_Stub
+#define BMS_GetState_ExpectAndThrow(cmock_to_throw) BMS_GetState_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void BMS_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define BMS_GetInitializationState_IgnoreAndReturn(cmock_retval) BMS_GetInitializationState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BMS_GetInitializationState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define BMS_GetInitializationState_StopIgnore() BMS_GetInitializationState_CMockStopIgnore()
+void BMS_GetInitializationState_CMockStopIgnore(void);
+#define BMS_GetInitializationState_ExpectAndReturn(cmock_retval) BMS_GetInitializationState_CMockExpectAndReturn(__LINE__, cmock_retval)
+void BMS_GetInitializationState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_BMS_GetInitializationState_CALLBACK)(int cmock_num_calls);
+void BMS_GetInitializationState_AddCallback(CMOCK_BMS_GetInitializationState_CALLBACK Callback);
+void BMS_GetInitializationState_Stub(CMOCK_BMS_GetInitializationState_CALLBACK Callback);
+#define BMS_GetInitializationState_StubWithCallback BMS_GetInitializationState_Stub
+#define BMS_GetInitializationState_ExpectAndThrow(cmock_to_throw) BMS_GetInitializationState_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void BMS_GetInitializationState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define BMS_Trigger_Ignore() BMS_Trigger_CMockIgnore()
+void BMS_Trigger_CMockIgnore(void);
+#define BMS_Trigger_StopIgnore() BMS_Trigger_CMockStopIgnore()
+void BMS_Trigger_CMockStopIgnore(void);
+#define BMS_Trigger_Expect() BMS_Trigger_CMockExpect(__LINE__)
+void BMS_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_BMS_Trigger_CALLBACK)(int cmock_num_calls);
+void BMS_Trigger_AddCallback(CMOCK_BMS_Trigger_CALLBACK Callback);
+void BMS_Trigger_Stub(CMOCK_BMS_Trigger_CALLBACK Callback);
+#define BMS_Trigger_StubWithCallback BMS_Trigger_Stub
+#define BMS_Trigger_ExpectAndThrow(cmock_to_throw) BMS_Trigger_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void BMS_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define BMS_GetBatterySystemState_IgnoreAndReturn(cmock_retval) BMS_GetBatterySystemState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BMS_GetBatterySystemState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CURRENT_FLOW_STATE_e cmock_to_return);
+#define BMS_GetBatterySystemState_StopIgnore() BMS_GetBatterySystemState_CMockStopIgnore()
+void BMS_GetBatterySystemState_CMockStopIgnore(void);
+#define BMS_GetBatterySystemState_ExpectAndReturn(cmock_retval) BMS_GetBatterySystemState_CMockExpectAndReturn(__LINE__, cmock_retval)
+void BMS_GetBatterySystemState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CURRENT_FLOW_STATE_e cmock_to_return);
+typedef BMS_CURRENT_FLOW_STATE_e (* CMOCK_BMS_GetBatterySystemState_CALLBACK)(int cmock_num_calls);
+void BMS_GetBatterySystemState_AddCallback(CMOCK_BMS_GetBatterySystemState_CALLBACK Callback);
+void BMS_GetBatterySystemState_Stub(CMOCK_BMS_GetBatterySystemState_CALLBACK Callback);
+#define BMS_GetBatterySystemState_StubWithCallback BMS_GetBatterySystemState_Stub
+#define BMS_GetBatterySystemState_ExpectAndThrow(cmock_to_throw) BMS_GetBatterySystemState_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void BMS_GetBatterySystemState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define BMS_GetCurrentFlowDirection_IgnoreAndReturn(cmock_retval) BMS_GetCurrentFlowDirection_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BMS_GetCurrentFlowDirection_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CURRENT_FLOW_STATE_e cmock_to_return);
+#define BMS_GetCurrentFlowDirection_StopIgnore() BMS_GetCurrentFlowDirection_CMockStopIgnore()
+void BMS_GetCurrentFlowDirection_CMockStopIgnore(void);
+#define BMS_GetCurrentFlowDirection_ExpectAndReturn(current_mA, cmock_retval) BMS_GetCurrentFlowDirection_CMockExpectAndReturn(__LINE__, current_mA, cmock_retval)
+void BMS_GetCurrentFlowDirection_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int32_t current_mA, BMS_CURRENT_FLOW_STATE_e cmock_to_return);
+typedef BMS_CURRENT_FLOW_STATE_e (* CMOCK_BMS_GetCurrentFlowDirection_CALLBACK)(int32_t current_mA, int cmock_num_calls);
+void BMS_GetCurrentFlowDirection_AddCallback(CMOCK_BMS_GetCurrentFlowDirection_CALLBACK Callback);
+void BMS_GetCurrentFlowDirection_Stub(CMOCK_BMS_GetCurrentFlowDirection_CALLBACK Callback);
+#define BMS_GetCurrentFlowDirection_StubWithCallback BMS_GetCurrentFlowDirection_Stub
+#define BMS_GetCurrentFlowDirection_ExpectAndThrow(current_mA, cmock_to_throw) BMS_GetCurrentFlowDirection_CMockExpectAndThrow(__LINE__, current_mA, cmock_to_throw)
+void BMS_GetCurrentFlowDirection_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int32_t current_mA, CEXCEPTION_T cmock_to_throw);
+#define BMS_GetCurrentFlowDirection_IgnoreArg_current_mA() BMS_GetCurrentFlowDirection_CMockIgnoreArg_current_mA(__LINE__)
+void BMS_GetCurrentFlowDirection_CMockIgnoreArg_current_mA(UNITY_LINE_TYPE cmock_line);
+#define BMS_IsStringClosed_IgnoreAndReturn(cmock_retval) BMS_IsStringClosed_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BMS_IsStringClosed_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define BMS_IsStringClosed_StopIgnore() BMS_IsStringClosed_CMockStopIgnore()
+void BMS_IsStringClosed_CMockStopIgnore(void);
+#define BMS_IsStringClosed_ExpectAndReturn(stringNumber, cmock_retval) BMS_IsStringClosed_CMockExpectAndReturn(__LINE__, stringNumber, cmock_retval)
+void BMS_IsStringClosed_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_BMS_IsStringClosed_CALLBACK)(uint8_t stringNumber, int cmock_num_calls);
+void BMS_IsStringClosed_AddCallback(CMOCK_BMS_IsStringClosed_CALLBACK Callback);
+void BMS_IsStringClosed_Stub(CMOCK_BMS_IsStringClosed_CALLBACK Callback);
+#define BMS_IsStringClosed_StubWithCallback BMS_IsStringClosed_Stub
+#define BMS_IsStringClosed_ExpectAndThrow(stringNumber, cmock_to_throw) BMS_IsStringClosed_CMockExpectAndThrow(__LINE__, stringNumber, cmock_to_throw)
+void BMS_IsStringClosed_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define BMS_IsStringClosed_IgnoreArg_stringNumber() BMS_IsStringClosed_CMockIgnoreArg_stringNumber(__LINE__)
+void BMS_IsStringClosed_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define BMS_IsStringPrecharging_IgnoreAndReturn(cmock_retval) BMS_IsStringPrecharging_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void BMS_IsStringPrecharging_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define BMS_IsStringPrecharging_StopIgnore() BMS_IsStringPrecharging_CMockStopIgnore()
+void BMS_IsStringPrecharging_CMockStopIgnore(void);
+#define BMS_IsStringPrecharging_ExpectAndReturn(stringNumber, cmock_retval) BMS_IsStringPrecharging_CMockExpectAndReturn(__LINE__, stringNumber, cmock_retval)
+void BMS_IsStringPrecharging_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_BMS_IsStringPrecharging_CALLBACK)(uint8_t stringNumber, int cmock_num_calls);
+void BMS_IsStringPrecharging_AddCallback(CMOCK_BMS_IsStringPrecharging_CALLBACK Callback);
+void BMS_IsStringPrecharging_Stub(CMOCK_BMS_IsStringPrecharging_CALLBACK Callback);
+#define BMS_IsStringPrecharging_StubWithCallback BMS_IsStringPrecharging_Stub
+#define BMS_IsStringPrecharging_ExpectAndThrow(stringNumber, cmock_to_throw) BMS_IsStringPrecharging_CMockExpectAndThrow(__LINE__, stringNumber, cmock_to_throw)
+void BMS_IsStringPrecharging_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define BMS_IsStringPrecharging_IgnoreArg_stringNumber() BMS_IsStringPrecharging_CMockIgnoreArg_stringNumber(__LINE__)
+void BMS_IsStringPrecharging_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_CheckStateRequest_IgnoreAndReturn(cmock_retval) TEST_BMS_CheckStateRequest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_CheckStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_RETURN_TYPE_e cmock_to_return);
+#define TEST_BMS_CheckStateRequest_StopIgnore() TEST_BMS_CheckStateRequest_CMockStopIgnore()
+void TEST_BMS_CheckStateRequest_CMockStopIgnore(void);
+#define TEST_BMS_CheckStateRequest_ExpectAndReturn(statereq, cmock_retval) TEST_BMS_CheckStateRequest_CMockExpectAndReturn(__LINE__, statereq, cmock_retval)
+void TEST_BMS_CheckStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e statereq, BMS_RETURN_TYPE_e cmock_to_return);
+typedef BMS_RETURN_TYPE_e (* CMOCK_TEST_BMS_CheckStateRequest_CALLBACK)(BMS_STATE_REQUEST_e statereq, int cmock_num_calls);
+void TEST_BMS_CheckStateRequest_AddCallback(CMOCK_TEST_BMS_CheckStateRequest_CALLBACK Callback);
+void TEST_BMS_CheckStateRequest_Stub(CMOCK_TEST_BMS_CheckStateRequest_CALLBACK Callback);
+#define TEST_BMS_CheckStateRequest_StubWithCallback TEST_BMS_CheckStateRequest_Stub
+#define TEST_BMS_CheckStateRequest_ExpectAndThrow(statereq, cmock_to_throw) TEST_BMS_CheckStateRequest_CMockExpectAndThrow(__LINE__, statereq, cmock_to_throw)
+void TEST_BMS_CheckStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e statereq, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_CheckStateRequest_IgnoreArg_statereq() TEST_BMS_CheckStateRequest_CMockIgnoreArg_statereq(__LINE__)
+void TEST_BMS_CheckStateRequest_CMockIgnoreArg_statereq(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_TransferStateRequest_IgnoreAndReturn(cmock_retval) TEST_BMS_TransferStateRequest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_TransferStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e cmock_to_return);
+#define TEST_BMS_TransferStateRequest_StopIgnore() TEST_BMS_TransferStateRequest_CMockStopIgnore()
+void TEST_BMS_TransferStateRequest_CMockStopIgnore(void);
+#define TEST_BMS_TransferStateRequest_ExpectAndReturn(cmock_retval) TEST_BMS_TransferStateRequest_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_TransferStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_STATE_REQUEST_e cmock_to_return);
+typedef BMS_STATE_REQUEST_e (* CMOCK_TEST_BMS_TransferStateRequest_CALLBACK)(int cmock_num_calls);
+void TEST_BMS_TransferStateRequest_AddCallback(CMOCK_TEST_BMS_TransferStateRequest_CALLBACK Callback);
+void TEST_BMS_TransferStateRequest_Stub(CMOCK_TEST_BMS_TransferStateRequest_CALLBACK Callback);
+#define TEST_BMS_TransferStateRequest_StubWithCallback TEST_BMS_TransferStateRequest_Stub
+#define TEST_BMS_TransferStateRequest_ExpectAndThrow(cmock_to_throw) TEST_BMS_TransferStateRequest_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_BMS_TransferStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_CheckReEntrance_IgnoreAndReturn(cmock_retval) TEST_BMS_CheckReEntrance_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_CheckReEntrance_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define TEST_BMS_CheckReEntrance_StopIgnore() TEST_BMS_CheckReEntrance_CMockStopIgnore()
+void TEST_BMS_CheckReEntrance_CMockStopIgnore(void);
+#define TEST_BMS_CheckReEntrance_ExpectAndReturn(cmock_retval) TEST_BMS_CheckReEntrance_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_CheckReEntrance_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_TEST_BMS_CheckReEntrance_CALLBACK)(int cmock_num_calls);
+void TEST_BMS_CheckReEntrance_AddCallback(CMOCK_TEST_BMS_CheckReEntrance_CALLBACK Callback);
+void TEST_BMS_CheckReEntrance_Stub(CMOCK_TEST_BMS_CheckReEntrance_CALLBACK Callback);
+#define TEST_BMS_CheckReEntrance_StubWithCallback TEST_BMS_CheckReEntrance_Stub
+#define TEST_BMS_CheckReEntrance_ExpectAndThrow(cmock_to_throw) TEST_BMS_CheckReEntrance_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_BMS_CheckReEntrance_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_CheckCanRequests_IgnoreAndReturn(cmock_retval) TEST_BMS_CheckCanRequests_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_CheckCanRequests_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define TEST_BMS_CheckCanRequests_StopIgnore() TEST_BMS_CheckCanRequests_CMockStopIgnore()
+void TEST_BMS_CheckCanRequests_CMockStopIgnore(void);
+#define TEST_BMS_CheckCanRequests_ExpectAndReturn(cmock_retval) TEST_BMS_CheckCanRequests_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_CheckCanRequests_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_TEST_BMS_CheckCanRequests_CALLBACK)(int cmock_num_calls);
+void TEST_BMS_CheckCanRequests_AddCallback(CMOCK_TEST_BMS_CheckCanRequests_CALLBACK Callback);
+void TEST_BMS_CheckCanRequests_Stub(CMOCK_TEST_BMS_CheckCanRequests_CALLBACK Callback);
+#define TEST_BMS_CheckCanRequests_StubWithCallback TEST_BMS_CheckCanRequests_Stub
+#define TEST_BMS_CheckCanRequests_ExpectAndThrow(cmock_to_throw) TEST_BMS_CheckCanRequests_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_BMS_CheckCanRequests_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_CheckAnyErrorFlagSet_IgnoreAndReturn(cmock_retval) TEST_BMS_CheckAnyErrorFlagSet_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_CheckAnyErrorFlagSet_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define TEST_BMS_CheckAnyErrorFlagSet_StopIgnore() TEST_BMS_CheckAnyErrorFlagSet_CMockStopIgnore()
+void TEST_BMS_CheckAnyErrorFlagSet_CMockStopIgnore(void);
+#define TEST_BMS_CheckAnyErrorFlagSet_ExpectAndReturn(cmock_retval) TEST_BMS_CheckAnyErrorFlagSet_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_CheckAnyErrorFlagSet_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALLBACK)(int cmock_num_calls);
+void TEST_BMS_CheckAnyErrorFlagSet_AddCallback(CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALLBACK Callback);
+void TEST_BMS_CheckAnyErrorFlagSet_Stub(CMOCK_TEST_BMS_CheckAnyErrorFlagSet_CALLBACK Callback);
+#define TEST_BMS_CheckAnyErrorFlagSet_StubWithCallback TEST_BMS_CheckAnyErrorFlagSet_Stub
+#define TEST_BMS_CheckAnyErrorFlagSet_ExpectAndThrow(cmock_to_throw) TEST_BMS_CheckAnyErrorFlagSet_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_BMS_CheckAnyErrorFlagSet_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_GetMeasurementValues_Ignore() TEST_BMS_GetMeasurementValues_CMockIgnore()
+void TEST_BMS_GetMeasurementValues_CMockIgnore(void);
+#define TEST_BMS_GetMeasurementValues_StopIgnore() TEST_BMS_GetMeasurementValues_CMockStopIgnore()
+void TEST_BMS_GetMeasurementValues_CMockStopIgnore(void);
+#define TEST_BMS_GetMeasurementValues_Expect() TEST_BMS_GetMeasurementValues_CMockExpect(__LINE__)
+void TEST_BMS_GetMeasurementValues_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_TEST_BMS_GetMeasurementValues_CALLBACK)(int cmock_num_calls);
+void TEST_BMS_GetMeasurementValues_AddCallback(CMOCK_TEST_BMS_GetMeasurementValues_CALLBACK Callback);
+void TEST_BMS_GetMeasurementValues_Stub(CMOCK_TEST_BMS_GetMeasurementValues_CALLBACK Callback);
+#define TEST_BMS_GetMeasurementValues_StubWithCallback TEST_BMS_GetMeasurementValues_Stub
+#define TEST_BMS_GetMeasurementValues_ExpectAndThrow(cmock_to_throw) TEST_BMS_GetMeasurementValues_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_BMS_GetMeasurementValues_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_CheckOpenSenseWire_Ignore() TEST_BMS_CheckOpenSenseWire_CMockIgnore()
+void TEST_BMS_CheckOpenSenseWire_CMockIgnore(void);
+#define TEST_BMS_CheckOpenSenseWire_StopIgnore() TEST_BMS_CheckOpenSenseWire_CMockStopIgnore()
+void TEST_BMS_CheckOpenSenseWire_CMockStopIgnore(void);
+#define TEST_BMS_CheckOpenSenseWire_Expect() TEST_BMS_CheckOpenSenseWire_CMockExpect(__LINE__)
+void TEST_BMS_CheckOpenSenseWire_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_TEST_BMS_CheckOpenSenseWire_CALLBACK)(int cmock_num_calls);
+void TEST_BMS_CheckOpenSenseWire_AddCallback(CMOCK_TEST_BMS_CheckOpenSenseWire_CALLBACK Callback);
+void TEST_BMS_CheckOpenSenseWire_Stub(CMOCK_TEST_BMS_CheckOpenSenseWire_CALLBACK Callback);
+#define TEST_BMS_CheckOpenSenseWire_StubWithCallback TEST_BMS_CheckOpenSenseWire_Stub
+#define TEST_BMS_CheckOpenSenseWire_ExpectAndThrow(cmock_to_throw) TEST_BMS_CheckOpenSenseWire_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_BMS_CheckOpenSenseWire_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_CheckPrecharge_IgnoreAndReturn(cmock_retval) TEST_BMS_CheckPrecharge_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_CheckPrecharge_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define TEST_BMS_CheckPrecharge_StopIgnore() TEST_BMS_CheckPrecharge_CMockStopIgnore()
+void TEST_BMS_CheckPrecharge_CMockStopIgnore(void);
+#define TEST_BMS_CheckPrecharge_ExpectAndReturn(stringNumber, pPackValues, cmock_retval) TEST_BMS_CheckPrecharge_CMockExpectAndReturn(__LINE__, stringNumber, pPackValues, cmock_retval)
+void TEST_BMS_CheckPrecharge_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, DATA_BLOCK_PACK_VALUES_s* pPackValues, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_TEST_BMS_CheckPrecharge_CALLBACK)(uint8_t stringNumber, DATA_BLOCK_PACK_VALUES_s* pPackValues, int cmock_num_calls);
+void TEST_BMS_CheckPrecharge_AddCallback(CMOCK_TEST_BMS_CheckPrecharge_CALLBACK Callback);
+void TEST_BMS_CheckPrecharge_Stub(CMOCK_TEST_BMS_CheckPrecharge_CALLBACK Callback);
+#define TEST_BMS_CheckPrecharge_StubWithCallback TEST_BMS_CheckPrecharge_Stub
+#define TEST_BMS_CheckPrecharge_ExpectAndThrow(stringNumber, pPackValues, cmock_to_throw) TEST_BMS_CheckPrecharge_CMockExpectAndThrow(__LINE__, stringNumber, pPackValues, cmock_to_throw)
+void TEST_BMS_CheckPrecharge_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_CheckPrecharge_ReturnThruPtr_pPackValues(pPackValues) TEST_BMS_CheckPrecharge_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, sizeof(DATA_BLOCK_PACK_VALUES_s))
+#define TEST_BMS_CheckPrecharge_ReturnArrayThruPtr_pPackValues(pPackValues, cmock_len) TEST_BMS_CheckPrecharge_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_len * sizeof(*pPackValues))
+#define TEST_BMS_CheckPrecharge_ReturnMemThruPtr_pPackValues(pPackValues, cmock_size) TEST_BMS_CheckPrecharge_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_size)
+void TEST_BMS_CheckPrecharge_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size);
+#define TEST_BMS_CheckPrecharge_IgnoreArg_stringNumber() TEST_BMS_CheckPrecharge_CMockIgnoreArg_stringNumber(__LINE__)
+void TEST_BMS_CheckPrecharge_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_CheckPrecharge_IgnoreArg_pPackValues() TEST_BMS_CheckPrecharge_CMockIgnoreArg_pPackValues(__LINE__)
+void TEST_BMS_CheckPrecharge_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_GetHighestString_IgnoreAndReturn(cmock_retval) TEST_BMS_GetHighestString_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_GetHighestString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define TEST_BMS_GetHighestString_StopIgnore() TEST_BMS_GetHighestString_CMockStopIgnore()
+void TEST_BMS_GetHighestString_CMockStopIgnore(void);
+#define TEST_BMS_GetHighestString_ExpectAndReturn(precharge, pPackValues, cmock_retval) TEST_BMS_GetHighestString_CMockExpectAndReturn(__LINE__, precharge, pPackValues, cmock_retval)
+void TEST_BMS_GetHighestString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_TEST_BMS_GetHighestString_CALLBACK)(BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, int cmock_num_calls);
+void TEST_BMS_GetHighestString_AddCallback(CMOCK_TEST_BMS_GetHighestString_CALLBACK Callback);
+void TEST_BMS_GetHighestString_Stub(CMOCK_TEST_BMS_GetHighestString_CALLBACK Callback);
+#define TEST_BMS_GetHighestString_StubWithCallback TEST_BMS_GetHighestString_Stub
+#define TEST_BMS_GetHighestString_ExpectAndThrow(precharge, pPackValues, cmock_to_throw) TEST_BMS_GetHighestString_CMockExpectAndThrow(__LINE__, precharge, pPackValues, cmock_to_throw)
+void TEST_BMS_GetHighestString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_GetHighestString_ReturnThruPtr_pPackValues(pPackValues) TEST_BMS_GetHighestString_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, sizeof(DATA_BLOCK_PACK_VALUES_s))
+#define TEST_BMS_GetHighestString_ReturnArrayThruPtr_pPackValues(pPackValues, cmock_len) TEST_BMS_GetHighestString_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_len * sizeof(*pPackValues))
+#define TEST_BMS_GetHighestString_ReturnMemThruPtr_pPackValues(pPackValues, cmock_size) TEST_BMS_GetHighestString_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_size)
+void TEST_BMS_GetHighestString_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size);
+#define TEST_BMS_GetHighestString_IgnoreArg_precharge() TEST_BMS_GetHighestString_CMockIgnoreArg_precharge(__LINE__)
+void TEST_BMS_GetHighestString_CMockIgnoreArg_precharge(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_GetHighestString_IgnoreArg_pPackValues() TEST_BMS_GetHighestString_CMockIgnoreArg_pPackValues(__LINE__)
+void TEST_BMS_GetHighestString_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_GetClosestString_IgnoreAndReturn(cmock_retval) TEST_BMS_GetClosestString_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_GetClosestString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define TEST_BMS_GetClosestString_StopIgnore() TEST_BMS_GetClosestString_CMockStopIgnore()
+void TEST_BMS_GetClosestString_CMockStopIgnore(void);
+#define TEST_BMS_GetClosestString_ExpectAndReturn(precharge, pPackValues, cmock_retval) TEST_BMS_GetClosestString_CMockExpectAndReturn(__LINE__, precharge, pPackValues, cmock_retval)
+void TEST_BMS_GetClosestString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_TEST_BMS_GetClosestString_CALLBACK)(BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, int cmock_num_calls);
+void TEST_BMS_GetClosestString_AddCallback(CMOCK_TEST_BMS_GetClosestString_CALLBACK Callback);
+void TEST_BMS_GetClosestString_Stub(CMOCK_TEST_BMS_GetClosestString_CALLBACK Callback);
+#define TEST_BMS_GetClosestString_StubWithCallback TEST_BMS_GetClosestString_Stub
+#define TEST_BMS_GetClosestString_ExpectAndThrow(precharge, pPackValues, cmock_to_throw) TEST_BMS_GetClosestString_CMockExpectAndThrow(__LINE__, precharge, pPackValues, cmock_to_throw)
+void TEST_BMS_GetClosestString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_GetClosestString_ReturnThruPtr_pPackValues(pPackValues) TEST_BMS_GetClosestString_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, sizeof(DATA_BLOCK_PACK_VALUES_s))
+#define TEST_BMS_GetClosestString_ReturnArrayThruPtr_pPackValues(pPackValues, cmock_len) TEST_BMS_GetClosestString_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_len * sizeof(*pPackValues))
+#define TEST_BMS_GetClosestString_ReturnMemThruPtr_pPackValues(pPackValues, cmock_size) TEST_BMS_GetClosestString_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_size)
+void TEST_BMS_GetClosestString_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size);
+#define TEST_BMS_GetClosestString_IgnoreArg_precharge() TEST_BMS_GetClosestString_CMockIgnoreArg_precharge(__LINE__)
+void TEST_BMS_GetClosestString_CMockIgnoreArg_precharge(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_GetClosestString_IgnoreArg_pPackValues() TEST_BMS_GetClosestString_CMockIgnoreArg_pPackValues(__LINE__)
+void TEST_BMS_GetClosestString_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_GetLowestString_IgnoreAndReturn(cmock_retval) TEST_BMS_GetLowestString_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_GetLowestString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define TEST_BMS_GetLowestString_StopIgnore() TEST_BMS_GetLowestString_CMockStopIgnore()
+void TEST_BMS_GetLowestString_CMockStopIgnore(void);
+#define TEST_BMS_GetLowestString_ExpectAndReturn(precharge, pPackValues, cmock_retval) TEST_BMS_GetLowestString_CMockExpectAndReturn(__LINE__, precharge, pPackValues, cmock_retval)
+void TEST_BMS_GetLowestString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_TEST_BMS_GetLowestString_CALLBACK)(BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, int cmock_num_calls);
+void TEST_BMS_GetLowestString_AddCallback(CMOCK_TEST_BMS_GetLowestString_CALLBACK Callback);
+void TEST_BMS_GetLowestString_Stub(CMOCK_TEST_BMS_GetLowestString_CALLBACK Callback);
+#define TEST_BMS_GetLowestString_StubWithCallback TEST_BMS_GetLowestString_Stub
+#define TEST_BMS_GetLowestString_ExpectAndThrow(precharge, pPackValues, cmock_to_throw) TEST_BMS_GetLowestString_CMockExpectAndThrow(__LINE__, precharge, pPackValues, cmock_to_throw)
+void TEST_BMS_GetLowestString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, BMS_CONSIDER_PRECHARGE_e precharge, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_GetLowestString_ReturnThruPtr_pPackValues(pPackValues) TEST_BMS_GetLowestString_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, sizeof(DATA_BLOCK_PACK_VALUES_s))
+#define TEST_BMS_GetLowestString_ReturnArrayThruPtr_pPackValues(pPackValues, cmock_len) TEST_BMS_GetLowestString_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_len * sizeof(*pPackValues))
+#define TEST_BMS_GetLowestString_ReturnMemThruPtr_pPackValues(pPackValues, cmock_size) TEST_BMS_GetLowestString_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_size)
+void TEST_BMS_GetLowestString_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size);
+#define TEST_BMS_GetLowestString_IgnoreArg_precharge() TEST_BMS_GetLowestString_CMockIgnoreArg_precharge(__LINE__)
+void TEST_BMS_GetLowestString_CMockIgnoreArg_precharge(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_GetLowestString_IgnoreArg_pPackValues() TEST_BMS_GetLowestString_CMockIgnoreArg_pPackValues(__LINE__)
+void TEST_BMS_GetLowestString_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_GetStringVoltageDifference_IgnoreAndReturn(cmock_retval) TEST_BMS_GetStringVoltageDifference_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_GetStringVoltageDifference_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return);
+#define TEST_BMS_GetStringVoltageDifference_StopIgnore() TEST_BMS_GetStringVoltageDifference_CMockStopIgnore()
+void TEST_BMS_GetStringVoltageDifference_CMockStopIgnore(void);
+#define TEST_BMS_GetStringVoltageDifference_ExpectAndReturn(string, pPackValues, cmock_retval) TEST_BMS_GetStringVoltageDifference_CMockExpectAndReturn(__LINE__, string, pPackValues, cmock_retval)
+void TEST_BMS_GetStringVoltageDifference_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, DATA_BLOCK_PACK_VALUES_s* pPackValues, int32_t cmock_to_return);
+typedef int32_t (* CMOCK_TEST_BMS_GetStringVoltageDifference_CALLBACK)(uint8_t string, DATA_BLOCK_PACK_VALUES_s* pPackValues, int cmock_num_calls);
+void TEST_BMS_GetStringVoltageDifference_AddCallback(CMOCK_TEST_BMS_GetStringVoltageDifference_CALLBACK Callback);
+void TEST_BMS_GetStringVoltageDifference_Stub(CMOCK_TEST_BMS_GetStringVoltageDifference_CALLBACK Callback);
+#define TEST_BMS_GetStringVoltageDifference_StubWithCallback TEST_BMS_GetStringVoltageDifference_Stub
+#define TEST_BMS_GetStringVoltageDifference_ExpectAndThrow(string, pPackValues, cmock_to_throw) TEST_BMS_GetStringVoltageDifference_CMockExpectAndThrow(__LINE__, string, pPackValues, cmock_to_throw)
+void TEST_BMS_GetStringVoltageDifference_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_GetStringVoltageDifference_ReturnThruPtr_pPackValues(pPackValues) TEST_BMS_GetStringVoltageDifference_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, sizeof(DATA_BLOCK_PACK_VALUES_s))
+#define TEST_BMS_GetStringVoltageDifference_ReturnArrayThruPtr_pPackValues(pPackValues, cmock_len) TEST_BMS_GetStringVoltageDifference_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_len * sizeof(*pPackValues))
+#define TEST_BMS_GetStringVoltageDifference_ReturnMemThruPtr_pPackValues(pPackValues, cmock_size) TEST_BMS_GetStringVoltageDifference_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_size)
+void TEST_BMS_GetStringVoltageDifference_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size);
+#define TEST_BMS_GetStringVoltageDifference_IgnoreArg_string() TEST_BMS_GetStringVoltageDifference_CMockIgnoreArg_string(__LINE__)
+void TEST_BMS_GetStringVoltageDifference_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_GetStringVoltageDifference_IgnoreArg_pPackValues() TEST_BMS_GetStringVoltageDifference_CMockIgnoreArg_pPackValues(__LINE__)
+void TEST_BMS_GetStringVoltageDifference_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_GetAverageStringCurrent_IgnoreAndReturn(cmock_retval) TEST_BMS_GetAverageStringCurrent_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_BMS_GetAverageStringCurrent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return);
+#define TEST_BMS_GetAverageStringCurrent_StopIgnore() TEST_BMS_GetAverageStringCurrent_CMockStopIgnore()
+void TEST_BMS_GetAverageStringCurrent_CMockStopIgnore(void);
+#define TEST_BMS_GetAverageStringCurrent_ExpectAndReturn(pPackValues, cmock_retval) TEST_BMS_GetAverageStringCurrent_CMockExpectAndReturn(__LINE__, pPackValues, cmock_retval)
+void TEST_BMS_GetAverageStringCurrent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, int32_t cmock_to_return);
+typedef int32_t (* CMOCK_TEST_BMS_GetAverageStringCurrent_CALLBACK)(DATA_BLOCK_PACK_VALUES_s* pPackValues, int cmock_num_calls);
+void TEST_BMS_GetAverageStringCurrent_AddCallback(CMOCK_TEST_BMS_GetAverageStringCurrent_CALLBACK Callback);
+void TEST_BMS_GetAverageStringCurrent_Stub(CMOCK_TEST_BMS_GetAverageStringCurrent_CALLBACK Callback);
+#define TEST_BMS_GetAverageStringCurrent_StubWithCallback TEST_BMS_GetAverageStringCurrent_Stub
+#define TEST_BMS_GetAverageStringCurrent_ExpectAndThrow(pPackValues, cmock_to_throw) TEST_BMS_GetAverageStringCurrent_CMockExpectAndThrow(__LINE__, pPackValues, cmock_to_throw)
+void TEST_BMS_GetAverageStringCurrent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_GetAverageStringCurrent_ReturnThruPtr_pPackValues(pPackValues) TEST_BMS_GetAverageStringCurrent_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, sizeof(DATA_BLOCK_PACK_VALUES_s))
+#define TEST_BMS_GetAverageStringCurrent_ReturnArrayThruPtr_pPackValues(pPackValues, cmock_len) TEST_BMS_GetAverageStringCurrent_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_len * sizeof(*pPackValues))
+#define TEST_BMS_GetAverageStringCurrent_ReturnMemThruPtr_pPackValues(pPackValues, cmock_size) TEST_BMS_GetAverageStringCurrent_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_size)
+void TEST_BMS_GetAverageStringCurrent_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size);
+#define TEST_BMS_GetAverageStringCurrent_IgnoreArg_pPackValues() TEST_BMS_GetAverageStringCurrent_CMockIgnoreArg_pPackValues(__LINE__)
+void TEST_BMS_GetAverageStringCurrent_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line);
+#define TEST_BMS_UpdateBatsysState_Ignore() TEST_BMS_UpdateBatsysState_CMockIgnore()
+void TEST_BMS_UpdateBatsysState_CMockIgnore(void);
+#define TEST_BMS_UpdateBatsysState_StopIgnore() TEST_BMS_UpdateBatsysState_CMockStopIgnore()
+void TEST_BMS_UpdateBatsysState_CMockStopIgnore(void);
+#define TEST_BMS_UpdateBatsysState_Expect(pPackValues) TEST_BMS_UpdateBatsysState_CMockExpect(__LINE__, pPackValues)
+void TEST_BMS_UpdateBatsysState_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues);
+typedef void (* CMOCK_TEST_BMS_UpdateBatsysState_CALLBACK)(DATA_BLOCK_PACK_VALUES_s* pPackValues, int cmock_num_calls);
+void TEST_BMS_UpdateBatsysState_AddCallback(CMOCK_TEST_BMS_UpdateBatsysState_CALLBACK Callback);
+void TEST_BMS_UpdateBatsysState_Stub(CMOCK_TEST_BMS_UpdateBatsysState_CALLBACK Callback);
+#define TEST_BMS_UpdateBatsysState_StubWithCallback TEST_BMS_UpdateBatsysState_Stub
+#define TEST_BMS_UpdateBatsysState_ExpectAndThrow(pPackValues, cmock_to_throw) TEST_BMS_UpdateBatsysState_CMockExpectAndThrow(__LINE__, pPackValues, cmock_to_throw)
+void TEST_BMS_UpdateBatsysState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, CEXCEPTION_T cmock_to_throw);
+#define TEST_BMS_UpdateBatsysState_ReturnThruPtr_pPackValues(pPackValues) TEST_BMS_UpdateBatsysState_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, sizeof(DATA_BLOCK_PACK_VALUES_s))
+#define TEST_BMS_UpdateBatsysState_ReturnArrayThruPtr_pPackValues(pPackValues, cmock_len) TEST_BMS_UpdateBatsysState_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_len * sizeof(*pPackValues))
+#define TEST_BMS_UpdateBatsysState_ReturnMemThruPtr_pPackValues(pPackValues, cmock_size) TEST_BMS_UpdateBatsysState_CMockReturnMemThruPtr_pPackValues(__LINE__, pPackValues, cmock_size)
+void TEST_BMS_UpdateBatsysState_CMockReturnMemThruPtr_pPackValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_PACK_VALUES_s* pPackValues, size_t cmock_size);
+#define TEST_BMS_UpdateBatsysState_IgnoreArg_pPackValues() TEST_BMS_UpdateBatsysState_CMockIgnoreArg_pPackValues(__LINE__)
+void TEST_BMS_UpdateBatsysState_CMockIgnoreArg_pPackValues(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,2710 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockcan.h"
+
+static const char* CMockString_CAN_BuildRxDispatchTable = "CAN_BuildRxDispatchTable";
+static const char* CMockString_CAN_BuildTxSchedule = "CAN_BuildTxSchedule";
+static const char* CMockString_CAN_DataSend = "CAN_DataSend";
+static const char* CMockString_CAN_EnablePeriodic = "CAN_EnablePeriodic";
+static const char* CMockString_CAN_FindRxHandlers = "CAN_FindRxHandlers";
+static const char* CMockString_CAN_Initialize = "CAN_Initialize";
+static const char* CMockString_CAN_IsCurrentSensorCcPresent = "CAN_IsCurrentSensorCcPresent";
+static const char* CMockString_CAN_IsCurrentSensorEcPresent = "CAN_IsCurrentSensorEcPresent";
+static const char* CMockString_CAN_IsCurrentSensorPresent = "CAN_IsCurrentSensorPresent";
+static const char* CMockString_CAN_MainFunction = "CAN_MainFunction";
+static const char* CMockString_CAN_ReadRxBuffer = "CAN_ReadRxBuffer";
+static const char* CMockString_TEST_CAN_GetCANState = "TEST_CAN_GetCANState";
+static const char* CMockString_TEST_CAN_GetRxBuffer = "TEST_CAN_GetRxBuffer";
+static const char* CMockString_TEST_CAN_GetRxDispatchTable = "TEST_CAN_GetRxDispatchTable";
+static const char* CMockString_TEST_CAN_GetWorstCaseFrameBits = "TEST_CAN_GetWorstCaseFrameBits";
+static const char* CMockString_TEST_CAN_StoreRxMessage = "TEST_CAN_StoreRxMessage";
+static const char* CMockString_TEST_CAN_UpdateRxStatistics = "TEST_CAN_UpdateRxStatistics";
+static const char* CMockString_command = "command";
+static const char* CMockString_dlc = "dlc";
+static const char* CMockString_id = "id";
+static const char* CMockString_numberOfMessages = "numberOfMessages";
+static const char* CMockString_pData = "pData";
+static const char* CMockString_pFirstEntry = "pFirstEntry";
+static const char* CMockString_pMessages = "pMessages";
+static const char* CMockString_pNode = "pNode";
+static const char* CMockString_pSchedule = "pSchedule";
+static const char* CMockString_pTable = "pTable";
+static const char* CMockString_stringNumber = "stringNumber";
+
+typedef struct _CMOCK_CAN_DataSend_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  canBASE_t* Expected_pNode;
+  uint32_t Expected_id;
+  uint8* Expected_pData;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pNode_Used;
+  canBASE_t* ReturnThruPtr_pNode_Val;
+  size_t ReturnThruPtr_pNode_Size;
+  char ReturnThruPtr_pData_Used;
+  uint8* ReturnThruPtr_pData_Val;
+  size_t ReturnThruPtr_pData_Size;
+  char IgnoreArg_pNode;
+  char IgnoreArg_id;
+  char IgnoreArg_pData;
+
+} CMOCK_CAN_DataSend_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  const CAN_MSG_TX_TYPE_s* Expected_pMessages;
+  uint8_t Expected_numberOfMessages;
+  CAN_TX_SCHEDULE_s* Expected_pSchedule;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSchedule_Used;
+  CAN_TX_SCHEDULE_s* ReturnThruPtr_pSchedule_Val;
+  size_t ReturnThruPtr_pSchedule_Size;
+  char IgnoreArg_pMessages;
+  char IgnoreArg_numberOfMessages;
+  char IgnoreArg_pSchedule;
+
+} CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  const CAN_MSG_RX_TYPE_s* Expected_pMessages;
+  uint8_t Expected_numberOfMessages;
+  CAN_RX_DISPATCH_TABLE_s* Expected_pTable;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pTable_Used;
+  CAN_RX_DISPATCH_TABLE_s* ReturnThruPtr_pTable_Val;
+  size_t ReturnThruPtr_pTable_Size;
+  char IgnoreArg_pMessages;
+  char IgnoreArg_numberOfMessages;
+  char IgnoreArg_pTable;
+
+} CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_FindRxHandlers_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  const CAN_RX_DISPATCH_TABLE_s* Expected_pTable;
+  uint32_t Expected_id;
+  uint8_t* Expected_pFirstEntry;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pFirstEntry_Used;
+  uint8_t* ReturnThruPtr_pFirstEntry_Val;
+  size_t ReturnThruPtr_pFirstEntry_Size;
+  char IgnoreArg_pTable;
+  char IgnoreArg_id;
+  char IgnoreArg_pFirstEntry;
+
+} CMOCK_CAN_FindRxHandlers_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_MainFunction_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_CAN_MainFunction_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_Initialize_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_CAN_Initialize_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_EnablePeriodic_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  _Bool Expected_command;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_command;
+
+} CMOCK_CAN_EnablePeriodic_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE;
+
+typedef struct _CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  CAN_STATE_s* ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  CAN_RX_BUFFER_s* ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  CAN_RX_DISPATCH_TABLE_s* ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint8_t Expected_dlc;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_dlc;
+
+} CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  const uint8_t* Expected_pData;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_id;
+  char IgnoreArg_pData;
+
+} CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE;
+
+static struct MockcanInstance
+{
+  char CAN_DataSend_IgnoreBool;
+  STD_RETURN_TYPE_e CAN_DataSend_FinalReturn;
+  char CAN_DataSend_CallbackBool;
+  CMOCK_CAN_DataSend_CALLBACK CAN_DataSend_CallbackFunctionPointer;
+  int CAN_DataSend_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_DataSend_CallInstance;
+  char CAN_BuildTxSchedule_IgnoreBool;
+  STD_RETURN_TYPE_e CAN_BuildTxSchedule_FinalReturn;
+  char CAN_BuildTxSchedule_CallbackBool;
+  CMOCK_CAN_BuildTxSchedule_CALLBACK CAN_BuildTxSchedule_CallbackFunctionPointer;
+  int CAN_BuildTxSchedule_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_BuildTxSchedule_CallInstance;
+  char CAN_BuildRxDispatchTable_IgnoreBool;
+  STD_RETURN_TYPE_e CAN_BuildRxDispatchTable_FinalReturn;
+  char CAN_BuildRxDispatchTable_CallbackBool;
+  CMOCK_CAN_BuildRxDispatchTable_CALLBACK CAN_BuildRxDispatchTable_CallbackFunctionPointer;
+  int CAN_BuildRxDispatchTable_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_BuildRxDispatchTable_CallInstance;
+  char CAN_FindRxHandlers_IgnoreBool;
+  uint8_t CAN_FindRxHandlers_FinalReturn;
+  char CAN_FindRxHandlers_CallbackBool;
+  CMOCK_CAN_FindRxHandlers_CALLBACK CAN_FindRxHandlers_CallbackFunctionPointer;
+  int CAN_FindRxHandlers_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_FindRxHandlers_CallInstance;
+  char CAN_MainFunction_IgnoreBool;
+  char CAN_MainFunction_CallbackBool;
+  CMOCK_CAN_MainFunction_CALLBACK CAN_MainFunction_CallbackFunctionPointer;
+  int CAN_MainFunction_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_MainFunction_CallInstance;
+  char CAN_ReadRxBuffer_IgnoreBool;
+  char CAN_ReadRxBuffer_CallbackBool;
+  CMOCK_CAN_ReadRxBuffer_CALLBACK CAN_ReadRxBuffer_CallbackFunctionPointer;
+  int CAN_ReadRxBuffer_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_ReadRxBuffer_CallInstance;
+  char CAN_Initialize_IgnoreBool;
+  char CAN_Initialize_CallbackBool;
+  CMOCK_CAN_Initialize_CALLBACK CAN_Initialize_CallbackFunctionPointer;
+  int CAN_Initialize_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_Initialize_CallInstance;
+  char CAN_EnablePeriodic_IgnoreBool;
+  char CAN_EnablePeriodic_CallbackBool;
+  CMOCK_CAN_EnablePeriodic_CALLBACK CAN_EnablePeriodic_CallbackFunctionPointer;
+  int CAN_EnablePeriodic_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_EnablePeriodic_CallInstance;
+  char CAN_IsCurrentSensorPresent_IgnoreBool;
+  _Bool CAN_IsCurrentSensorPresent_FinalReturn;
+  char CAN_IsCurrentSensorPresent_CallbackBool;
+  CMOCK_CAN_IsCurrentSensorPresent_CALLBACK CAN_IsCurrentSensorPresent_CallbackFunctionPointer;
+  int CAN_IsCurrentSensorPresent_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_IsCurrentSensorPresent_CallInstance;
+  char CAN_IsCurrentSensorCcPresent_IgnoreBool;
+  _Bool CAN_IsCurrentSensorCcPresent_FinalReturn;
+  char CAN_IsCurrentSensorCcPresent_CallbackBool;
+  CMOCK_CAN_IsCurrentSensorCcPresent_CALLBACK CAN_IsCurrentSensorCcPresent_CallbackFunctionPointer;
+  int CAN_IsCurrentSensorCcPresent_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_IsCurrentSensorCcPresent_CallInstance;
+  char CAN_IsCurrentSensorEcPresent_IgnoreBool;
+  _Bool CAN_IsCurrentSensorEcPresent_FinalReturn;
+  char CAN_IsCurrentSensorEcPresent_CallbackBool;
+  CMOCK_CAN_IsCurrentSensorEcPresent_CALLBACK CAN_IsCurrentSensorEcPresent_CallbackFunctionPointer;
+  int CAN_IsCurrentSensorEcPresent_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CAN_IsCurrentSensorEcPresent_CallInstance;
+  char TEST_CAN_GetCANState_IgnoreBool;
+  CAN_STATE_s* TEST_CAN_GetCANState_FinalReturn;
+  char TEST_CAN_GetCANState_CallbackBool;
+  CMOCK_TEST_CAN_GetCANState_CALLBACK TEST_CAN_GetCANState_CallbackFunctionPointer;
+  int TEST_CAN_GetCANState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_GetCANState_CallInstance;
+  char TEST_CAN_GetRxBuffer_IgnoreBool;
+  CAN_RX_BUFFER_s* TEST_CAN_GetRxBuffer_FinalReturn;
+  char TEST_CAN_GetRxBuffer_CallbackBool;
+  CMOCK_TEST_CAN_GetRxBuffer_CALLBACK TEST_CAN_GetRxBuffer_CallbackFunctionPointer;
+  int TEST_CAN_GetRxBuffer_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_GetRxBuffer_CallInstance;
+  char TEST_CAN_GetRxDispatchTable_IgnoreBool;
+  CAN_RX_DISPATCH_TABLE_s* TEST_CAN_GetRxDispatchTable_FinalReturn;
+  char TEST_CAN_GetRxDispatchTable_CallbackBool;
+  CMOCK_TEST_CAN_GetRxDispatchTable_CALLBACK TEST_CAN_GetRxDispatchTable_CallbackFunctionPointer;
+  int TEST_CAN_GetRxDispatchTable_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_GetRxDispatchTable_CallInstance;
+  char TEST_CAN_GetWorstCaseFrameBits_IgnoreBool;
+  uint32_t TEST_CAN_GetWorstCaseFrameBits_FinalReturn;
+  char TEST_CAN_GetWorstCaseFrameBits_CallbackBool;
+  CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALLBACK TEST_CAN_GetWorstCaseFrameBits_CallbackFunctionPointer;
+  int TEST_CAN_GetWorstCaseFrameBits_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_GetWorstCaseFrameBits_CallInstance;
+  char TEST_CAN_StoreRxMessage_IgnoreBool;
+  STD_RETURN_TYPE_e TEST_CAN_StoreRxMessage_FinalReturn;
+  char TEST_CAN_StoreRxMessage_CallbackBool;
+  CMOCK_TEST_CAN_StoreRxMessage_CALLBACK TEST_CAN_StoreRxMessage_CallbackFunctionPointer;
+  int TEST_CAN_StoreRxMessage_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_StoreRxMessage_CallInstance;
+  char TEST_CAN_UpdateRxStatistics_IgnoreBool;
+  char TEST_CAN_UpdateRxStatistics_CallbackBool;
+  CMOCK_TEST_CAN_UpdateRxStatistics_CALLBACK TEST_CAN_UpdateRxStatistics_CallbackFunctionPointer;
+  int TEST_CAN_UpdateRxStatistics_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_UpdateRxStatistics_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockcan_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.CAN_DataSend_CallInstance;
+  if (Mock.CAN_DataSend_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_DataSend);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_DataSend_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_BuildTxSchedule_CallInstance;
+  if (Mock.CAN_BuildTxSchedule_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_BuildTxSchedule);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_BuildTxSchedule_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_BuildRxDispatchTable_CallInstance;
+  if (Mock.CAN_BuildRxDispatchTable_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_BuildRxDispatchTable);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_BuildRxDispatchTable_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_FindRxHandlers_CallInstance;
+  if (Mock.CAN_FindRxHandlers_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_FindRxHandlers);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_FindRxHandlers_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_MainFunction_CallInstance;
+  if (Mock.CAN_MainFunction_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_MainFunction);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_MainFunction_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_ReadRxBuffer_CallInstance;
+  if (Mock.CAN_ReadRxBuffer_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_ReadRxBuffer);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_ReadRxBuffer_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_Initialize_CallInstance;
+  if (Mock.CAN_Initialize_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_Initialize);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_Initialize_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_EnablePeriodic_CallInstance;
+  if (Mock.CAN_EnablePeriodic_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_EnablePeriodic);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_EnablePeriodic_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_IsCurrentSensorPresent_CallInstance;
+  if (Mock.CAN_IsCurrentSensorPresent_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_IsCurrentSensorPresent);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_IsCurrentSensorPresent_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_IsCurrentSensorCcPresent_CallInstance;
+  if (Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_IsCurrentSensorCcPresent);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_IsCurrentSensorCcPresent_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CAN_IsCurrentSensorEcPresent_CallInstance;
+  if (Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CAN_IsCurrentSensorEcPresent);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CAN_IsCurrentSensorEcPresent_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_GetCANState_CallInstance;
+  if (Mock.TEST_CAN_GetCANState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_GetCANState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_GetCANState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_GetRxBuffer_CallInstance;
+  if (Mock.TEST_CAN_GetRxBuffer_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_GetRxBuffer);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_GetRxBuffer_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_GetRxDispatchTable_CallInstance;
+  if (Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_GetRxDispatchTable);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_GetRxDispatchTable_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance;
+  if (Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_GetWorstCaseFrameBits);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_StoreRxMessage_CallInstance;
+  if (Mock.TEST_CAN_StoreRxMessage_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_StoreRxMessage);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_StoreRxMessage_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_UpdateRxStatistics_CallInstance;
+  if (Mock.TEST_CAN_UpdateRxStatistics_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_UpdateRxStatistics);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_UpdateRxStatistics_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockcan_Init(void)
+{
+  Mockcan_Destroy();
+}
+
+void Mockcan_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+STD_RETURN_TYPE_e CAN_DataSend(canBASE_t* pNode, uint32_t id, uint8* pData)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_DataSend);
+  cmock_call_instance = (CMOCK_CAN_DataSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_DataSend_CallInstance);
+  Mock.CAN_DataSend_CallInstance = CMock_Guts_MemNext(Mock.CAN_DataSend_CallInstance);
+  if (Mock.CAN_DataSend_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CAN_DataSend_FinalReturn;
+    memcpy((void*)(&Mock.CAN_DataSend_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CAN_DataSend_CallbackBool &&
+      Mock.CAN_DataSend_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.CAN_DataSend_CallbackFunctionPointer(pNode, id, pData, Mock.CAN_DataSend_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pNode)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_DataSend,CMockString_pNode);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pNode), (void*)(pNode), sizeof(canBASE_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_DataSend,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pData)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_DataSend,CMockString_pData);
+    if (cmock_call_instance->Expected_pData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pData, pData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.CAN_DataSend_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CAN_DataSend_CallbackFunctionPointer(pNode, id, pData, Mock.CAN_DataSend_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pNode_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pNode, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pNode, (void*)cmock_call_instance->ReturnThruPtr_pNode_Val,
+      cmock_call_instance->ReturnThruPtr_pNode_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pData, (void*)cmock_call_instance->ReturnThruPtr_pData_Val,
+      cmock_call_instance->ReturnThruPtr_pData_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CAN_DataSend(CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance, canBASE_t* pNode, uint32_t id, uint8* pData);
+void CMockExpectParameters_CAN_DataSend(CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance, canBASE_t* pNode, uint32_t id, uint8* pData)
+{
+  cmock_call_instance->Expected_pNode = pNode;
+  cmock_call_instance->IgnoreArg_pNode = 0;
+  cmock_call_instance->ReturnThruPtr_pNode_Used = 0;
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_pData = pData;
+  cmock_call_instance->IgnoreArg_pData = 0;
+  cmock_call_instance->ReturnThruPtr_pData_Used = 0;
+}
+
+void CAN_DataSend_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_DataSend_CALL_INSTANCE));
+  CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_DataSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_DataSend_CallInstance = CMock_Guts_MemChain(Mock.CAN_DataSend_CallInstance, cmock_guts_index);
+  Mock.CAN_DataSend_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CAN_DataSend_IgnoreBool = (char)1;
+}
+
+void CAN_DataSend_CMockStopIgnore(void)
+{
+  if(Mock.CAN_DataSend_IgnoreBool)
+    Mock.CAN_DataSend_CallInstance = CMock_Guts_MemNext(Mock.CAN_DataSend_CallInstance);
+  Mock.CAN_DataSend_IgnoreBool = (char)0;
+}
+
+void CAN_DataSend_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* pNode, uint32_t id, uint8* pData, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_DataSend_CALL_INSTANCE));
+  CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_DataSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_DataSend_CallInstance = CMock_Guts_MemChain(Mock.CAN_DataSend_CallInstance, cmock_guts_index);
+  Mock.CAN_DataSend_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_DataSend(cmock_call_instance, pNode, id, pData);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CAN_DataSend_AddCallback(CMOCK_CAN_DataSend_CALLBACK Callback)
+{
+  Mock.CAN_DataSend_IgnoreBool = (char)0;
+  Mock.CAN_DataSend_CallbackBool = (char)1;
+  Mock.CAN_DataSend_CallbackFunctionPointer = Callback;
+}
+
+void CAN_DataSend_Stub(CMOCK_CAN_DataSend_CALLBACK Callback)
+{
+  Mock.CAN_DataSend_IgnoreBool = (char)0;
+  Mock.CAN_DataSend_CallbackBool = (char)0;
+  Mock.CAN_DataSend_CallbackFunctionPointer = Callback;
+}
+
+void CAN_DataSend_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* pNode, uint32_t id, uint8* pData, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_DataSend_CALL_INSTANCE));
+  CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_DataSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_DataSend_CallInstance = CMock_Guts_MemChain(Mock.CAN_DataSend_CallInstance, cmock_guts_index);
+  Mock.CAN_DataSend_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_DataSend(cmock_call_instance, pNode, id, pData);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_DataSend_CMockReturnMemThruPtr_pNode(UNITY_LINE_TYPE cmock_line, canBASE_t* pNode, size_t cmock_size)
+{
+  CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_DataSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_DataSend_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pNode_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pNode_Val = pNode;
+  cmock_call_instance->ReturnThruPtr_pNode_Size = cmock_size;
+}
+
+void CAN_DataSend_CMockReturnMemThruPtr_pData(UNITY_LINE_TYPE cmock_line, uint8* pData, size_t cmock_size)
+{
+  CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_DataSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_DataSend_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pData_Val = pData;
+  cmock_call_instance->ReturnThruPtr_pData_Size = cmock_size;
+}
+
+void CAN_DataSend_CMockIgnoreArg_pNode(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_DataSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_DataSend_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pNode = 1;
+}
+
+void CAN_DataSend_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_DataSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_DataSend_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void CAN_DataSend_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_DataSend_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_DataSend_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_DataSend_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pData = 1;
+}
+
+STD_RETURN_TYPE_e CAN_BuildTxSchedule(const CAN_MSG_TX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_TX_SCHEDULE_s* pSchedule)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_BuildTxSchedule);
+  cmock_call_instance = (CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_BuildTxSchedule_CallInstance);
+  Mock.CAN_BuildTxSchedule_CallInstance = CMock_Guts_MemNext(Mock.CAN_BuildTxSchedule_CallInstance);
+  if (Mock.CAN_BuildTxSchedule_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CAN_BuildTxSchedule_FinalReturn;
+    memcpy((void*)(&Mock.CAN_BuildTxSchedule_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CAN_BuildTxSchedule_CallbackBool &&
+      Mock.CAN_BuildTxSchedule_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.CAN_BuildTxSchedule_CallbackFunctionPointer(pMessages, numberOfMessages, pSchedule, Mock.CAN_BuildTxSchedule_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pMessages)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_BuildTxSchedule,CMockString_pMessages);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pMessages), (void*)(pMessages), sizeof(const CAN_MSG_TX_TYPE_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_numberOfMessages)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_BuildTxSchedule,CMockString_numberOfMessages);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_numberOfMessages, numberOfMessages, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pSchedule)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_BuildTxSchedule,CMockString_pSchedule);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSchedule), (void*)(pSchedule), sizeof(CAN_TX_SCHEDULE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CAN_BuildTxSchedule_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CAN_BuildTxSchedule_CallbackFunctionPointer(pMessages, numberOfMessages, pSchedule, Mock.CAN_BuildTxSchedule_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSchedule_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSchedule, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSchedule, (void*)cmock_call_instance->ReturnThruPtr_pSchedule_Val,
+      cmock_call_instance->ReturnThruPtr_pSchedule_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CAN_BuildTxSchedule(CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance, const CAN_MSG_TX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_TX_SCHEDULE_s* pSchedule);
+void CMockExpectParameters_CAN_BuildTxSchedule(CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance, const CAN_MSG_TX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_TX_SCHEDULE_s* pSchedule)
+{
+  cmock_call_instance->Expected_pMessages = pMessages;
+  cmock_call_instance->IgnoreArg_pMessages = 0;
+  cmock_call_instance->Expected_numberOfMessages = numberOfMessages;
+  cmock_call_instance->IgnoreArg_numberOfMessages = 0;
+  cmock_call_instance->Expected_pSchedule = pSchedule;
+  cmock_call_instance->IgnoreArg_pSchedule = 0;
+  cmock_call_instance->ReturnThruPtr_pSchedule_Used = 0;
+}
+
+void CAN_BuildTxSchedule_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE));
+  CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_BuildTxSchedule_CallInstance = CMock_Guts_MemChain(Mock.CAN_BuildTxSchedule_CallInstance, cmock_guts_index);
+  Mock.CAN_BuildTxSchedule_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CAN_BuildTxSchedule_IgnoreBool = (char)1;
+}
+
+void CAN_BuildTxSchedule_CMockStopIgnore(void)
+{
+  if(Mock.CAN_BuildTxSchedule_IgnoreBool)
+    Mock.CAN_BuildTxSchedule_CallInstance = CMock_Guts_MemNext(Mock.CAN_BuildTxSchedule_CallInstance);
+  Mock.CAN_BuildTxSchedule_IgnoreBool = (char)0;
+}
+
+void CAN_BuildTxSchedule_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CAN_MSG_TX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_TX_SCHEDULE_s* pSchedule, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE));
+  CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_BuildTxSchedule_CallInstance = CMock_Guts_MemChain(Mock.CAN_BuildTxSchedule_CallInstance, cmock_guts_index);
+  Mock.CAN_BuildTxSchedule_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_BuildTxSchedule(cmock_call_instance, pMessages, numberOfMessages, pSchedule);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CAN_BuildTxSchedule_AddCallback(CMOCK_CAN_BuildTxSchedule_CALLBACK Callback)
+{
+  Mock.CAN_BuildTxSchedule_IgnoreBool = (char)0;
+  Mock.CAN_BuildTxSchedule_CallbackBool = (char)1;
+  Mock.CAN_BuildTxSchedule_CallbackFunctionPointer = Callback;
+}
+
+void CAN_BuildTxSchedule_Stub(CMOCK_CAN_BuildTxSchedule_CALLBACK Callback)
+{
+  Mock.CAN_BuildTxSchedule_IgnoreBool = (char)0;
+  Mock.CAN_BuildTxSchedule_CallbackBool = (char)0;
+  Mock.CAN_BuildTxSchedule_CallbackFunctionPointer = Callback;
+}
+
+void CAN_BuildTxSchedule_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CAN_MSG_TX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_TX_SCHEDULE_s* pSchedule, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE));
+  CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_BuildTxSchedule_CallInstance = CMock_Guts_MemChain(Mock.CAN_BuildTxSchedule_CallInstance, cmock_guts_index);
+  Mock.CAN_BuildTxSchedule_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_BuildTxSchedule(cmock_call_instance, pMessages, numberOfMessages, pSchedule);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_BuildTxSchedule_CMockReturnMemThruPtr_pSchedule(UNITY_LINE_TYPE cmock_line, CAN_TX_SCHEDULE_s* pSchedule, size_t cmock_size)
+{
+  CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_BuildTxSchedule_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSchedule_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSchedule_Val = pSchedule;
+  cmock_call_instance->ReturnThruPtr_pSchedule_Size = cmock_size;
+}
+
+void CAN_BuildTxSchedule_CMockIgnoreArg_pMessages(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_BuildTxSchedule_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMessages = 1;
+}
+
+void CAN_BuildTxSchedule_CMockIgnoreArg_numberOfMessages(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_BuildTxSchedule_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_numberOfMessages = 1;
+}
+
+void CAN_BuildTxSchedule_CMockIgnoreArg_pSchedule(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildTxSchedule_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_BuildTxSchedule_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSchedule = 1;
+}
+
+STD_RETURN_TYPE_e CAN_BuildRxDispatchTable(const CAN_MSG_RX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_RX_DISPATCH_TABLE_s* pTable)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_BuildRxDispatchTable);
+  cmock_call_instance = (CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_BuildRxDispatchTable_CallInstance);
+  Mock.CAN_BuildRxDispatchTable_CallInstance = CMock_Guts_MemNext(Mock.CAN_BuildRxDispatchTable_CallInstance);
+  if (Mock.CAN_BuildRxDispatchTable_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CAN_BuildRxDispatchTable_FinalReturn;
+    memcpy((void*)(&Mock.CAN_BuildRxDispatchTable_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CAN_BuildRxDispatchTable_CallbackBool &&
+      Mock.CAN_BuildRxDispatchTable_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.CAN_BuildRxDispatchTable_CallbackFunctionPointer(pMessages, numberOfMessages, pTable, Mock.CAN_BuildRxDispatchTable_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pMessages)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_BuildRxDispatchTable,CMockString_pMessages);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pMessages), (void*)(pMessages), sizeof(const CAN_MSG_RX_TYPE_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_numberOfMessages)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_BuildRxDispatchTable,CMockString_numberOfMessages);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_numberOfMessages, numberOfMessages, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTable)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_BuildRxDispatchTable,CMockString_pTable);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pTable), (void*)(pTable), sizeof(CAN_RX_DISPATCH_TABLE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CAN_BuildRxDispatchTable_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CAN_BuildRxDispatchTable_CallbackFunctionPointer(pMessages, numberOfMessages, pTable, Mock.CAN_BuildRxDispatchTable_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTable_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTable, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTable, (void*)cmock_call_instance->ReturnThruPtr_pTable_Val,
+      cmock_call_instance->ReturnThruPtr_pTable_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CAN_BuildRxDispatchTable(CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance, const CAN_MSG_RX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_RX_DISPATCH_TABLE_s* pTable);
+void CMockExpectParameters_CAN_BuildRxDispatchTable(CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance, const CAN_MSG_RX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_RX_DISPATCH_TABLE_s* pTable)
+{
+  cmock_call_instance->Expected_pMessages = pMessages;
+  cmock_call_instance->IgnoreArg_pMessages = 0;
+  cmock_call_instance->Expected_numberOfMessages = numberOfMessages;
+  cmock_call_instance->IgnoreArg_numberOfMessages = 0;
+  cmock_call_instance->Expected_pTable = pTable;
+  cmock_call_instance->IgnoreArg_pTable = 0;
+  cmock_call_instance->ReturnThruPtr_pTable_Used = 0;
+}
+
+void CAN_BuildRxDispatchTable_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE));
+  CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_BuildRxDispatchTable_CallInstance = CMock_Guts_MemChain(Mock.CAN_BuildRxDispatchTable_CallInstance, cmock_guts_index);
+  Mock.CAN_BuildRxDispatchTable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CAN_BuildRxDispatchTable_IgnoreBool = (char)1;
+}
+
+void CAN_BuildRxDispatchTable_CMockStopIgnore(void)
+{
+  if(Mock.CAN_BuildRxDispatchTable_IgnoreBool)
+    Mock.CAN_BuildRxDispatchTable_CallInstance = CMock_Guts_MemNext(Mock.CAN_BuildRxDispatchTable_CallInstance);
+  Mock.CAN_BuildRxDispatchTable_IgnoreBool = (char)0;
+}
+
+void CAN_BuildRxDispatchTable_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CAN_MSG_RX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_RX_DISPATCH_TABLE_s* pTable, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE));
+  CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_BuildRxDispatchTable_CallInstance = CMock_Guts_MemChain(Mock.CAN_BuildRxDispatchTable_CallInstance, cmock_guts_index);
+  Mock.CAN_BuildRxDispatchTable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_BuildRxDispatchTable(cmock_call_instance, pMessages, numberOfMessages, pTable);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CAN_BuildRxDispatchTable_AddCallback(CMOCK_CAN_BuildRxDispatchTable_CALLBACK Callback)
+{
+  Mock.CAN_BuildRxDispatchTable_IgnoreBool = (char)0;
+  Mock.CAN_BuildRxDispatchTable_CallbackBool = (char)1;
+  Mock.CAN_BuildRxDispatchTable_CallbackFunctionPointer = Callback;
+}
+
+void CAN_BuildRxDispatchTable_Stub(CMOCK_CAN_BuildRxDispatchTable_CALLBACK Callback)
+{
+  Mock.CAN_BuildRxDispatchTable_IgnoreBool = (char)0;
+  Mock.CAN_BuildRxDispatchTable_CallbackBool = (char)0;
+  Mock.CAN_BuildRxDispatchTable_CallbackFunctionPointer = Callback;
+}
+
+void CAN_BuildRxDispatchTable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CAN_MSG_RX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_RX_DISPATCH_TABLE_s* pTable, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE));
+  CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_BuildRxDispatchTable_CallInstance = CMock_Guts_MemChain(Mock.CAN_BuildRxDispatchTable_CallInstance, cmock_guts_index);
+  Mock.CAN_BuildRxDispatchTable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_BuildRxDispatchTable(cmock_call_instance, pMessages, numberOfMessages, pTable);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_BuildRxDispatchTable_CMockReturnMemThruPtr_pTable(UNITY_LINE_TYPE cmock_line, CAN_RX_DISPATCH_TABLE_s* pTable, size_t cmock_size)
+{
+  CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_BuildRxDispatchTable_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTable_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTable_Val = pTable;
+  cmock_call_instance->ReturnThruPtr_pTable_Size = cmock_size;
+}
+
+void CAN_BuildRxDispatchTable_CMockIgnoreArg_pMessages(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_BuildRxDispatchTable_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMessages = 1;
+}
+
+void CAN_BuildRxDispatchTable_CMockIgnoreArg_numberOfMessages(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_BuildRxDispatchTable_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_numberOfMessages = 1;
+}
+
+void CAN_BuildRxDispatchTable_CMockIgnoreArg_pTable(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_BuildRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_BuildRxDispatchTable_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTable = 1;
+}
+
+uint8_t CAN_FindRxHandlers(const CAN_RX_DISPATCH_TABLE_s* pTable, uint32_t id, uint8_t* pFirstEntry)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_FindRxHandlers);
+  cmock_call_instance = (CMOCK_CAN_FindRxHandlers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_FindRxHandlers_CallInstance);
+  Mock.CAN_FindRxHandlers_CallInstance = CMock_Guts_MemNext(Mock.CAN_FindRxHandlers_CallInstance);
+  if (Mock.CAN_FindRxHandlers_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CAN_FindRxHandlers_FinalReturn;
+    Mock.CAN_FindRxHandlers_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CAN_FindRxHandlers_CallbackBool &&
+      Mock.CAN_FindRxHandlers_CallbackFunctionPointer != NULL)
+  {
+    uint8_t cmock_cb_ret = Mock.CAN_FindRxHandlers_CallbackFunctionPointer(pTable, id, pFirstEntry, Mock.CAN_FindRxHandlers_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pTable)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_FindRxHandlers,CMockString_pTable);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pTable), (void*)(pTable), sizeof(const CAN_RX_DISPATCH_TABLE_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_FindRxHandlers,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pFirstEntry)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_FindRxHandlers,CMockString_pFirstEntry);
+    if (cmock_call_instance->Expected_pFirstEntry == NULL)
+      { UNITY_TEST_ASSERT_NULL(pFirstEntry, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pFirstEntry, pFirstEntry, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.CAN_FindRxHandlers_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CAN_FindRxHandlers_CallbackFunctionPointer(pTable, id, pFirstEntry, Mock.CAN_FindRxHandlers_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pFirstEntry_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pFirstEntry, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pFirstEntry, (void*)cmock_call_instance->ReturnThruPtr_pFirstEntry_Val,
+      cmock_call_instance->ReturnThruPtr_pFirstEntry_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CAN_FindRxHandlers(CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance, const CAN_RX_DISPATCH_TABLE_s* pTable, uint32_t id, uint8_t* pFirstEntry);
+void CMockExpectParameters_CAN_FindRxHandlers(CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance, const CAN_RX_DISPATCH_TABLE_s* pTable, uint32_t id, uint8_t* pFirstEntry)
+{
+  cmock_call_instance->Expected_pTable = pTable;
+  cmock_call_instance->IgnoreArg_pTable = 0;
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_pFirstEntry = pFirstEntry;
+  cmock_call_instance->IgnoreArg_pFirstEntry = 0;
+  cmock_call_instance->ReturnThruPtr_pFirstEntry_Used = 0;
+}
+
+void CAN_FindRxHandlers_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_FindRxHandlers_CALL_INSTANCE));
+  CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_FindRxHandlers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_FindRxHandlers_CallInstance = CMock_Guts_MemChain(Mock.CAN_FindRxHandlers_CallInstance, cmock_guts_index);
+  Mock.CAN_FindRxHandlers_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CAN_FindRxHandlers_IgnoreBool = (char)1;
+}
+
+void CAN_FindRxHandlers_CMockStopIgnore(void)
+{
+  if(Mock.CAN_FindRxHandlers_IgnoreBool)
+    Mock.CAN_FindRxHandlers_CallInstance = CMock_Guts_MemNext(Mock.CAN_FindRxHandlers_CallInstance);
+  Mock.CAN_FindRxHandlers_IgnoreBool = (char)0;
+}
+
+void CAN_FindRxHandlers_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CAN_RX_DISPATCH_TABLE_s* pTable, uint32_t id, uint8_t* pFirstEntry, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_FindRxHandlers_CALL_INSTANCE));
+  CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_FindRxHandlers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_FindRxHandlers_CallInstance = CMock_Guts_MemChain(Mock.CAN_FindRxHandlers_CallInstance, cmock_guts_index);
+  Mock.CAN_FindRxHandlers_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_FindRxHandlers(cmock_call_instance, pTable, id, pFirstEntry);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void CAN_FindRxHandlers_AddCallback(CMOCK_CAN_FindRxHandlers_CALLBACK Callback)
+{
+  Mock.CAN_FindRxHandlers_IgnoreBool = (char)0;
+  Mock.CAN_FindRxHandlers_CallbackBool = (char)1;
+  Mock.CAN_FindRxHandlers_CallbackFunctionPointer = Callback;
+}
+
+void CAN_FindRxHandlers_Stub(CMOCK_CAN_FindRxHandlers_CALLBACK Callback)
+{
+  Mock.CAN_FindRxHandlers_IgnoreBool = (char)0;
+  Mock.CAN_FindRxHandlers_CallbackBool = (char)0;
+  Mock.CAN_FindRxHandlers_CallbackFunctionPointer = Callback;
+}
+
+void CAN_FindRxHandlers_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CAN_RX_DISPATCH_TABLE_s* pTable, uint32_t id, uint8_t* pFirstEntry, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_FindRxHandlers_CALL_INSTANCE));
+  CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_FindRxHandlers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_FindRxHandlers_CallInstance = CMock_Guts_MemChain(Mock.CAN_FindRxHandlers_CallInstance, cmock_guts_index);
+  Mock.CAN_FindRxHandlers_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_FindRxHandlers(cmock_call_instance, pTable, id, pFirstEntry);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_FindRxHandlers_CMockReturnMemThruPtr_pFirstEntry(UNITY_LINE_TYPE cmock_line, uint8_t* pFirstEntry, size_t cmock_size)
+{
+  CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_FindRxHandlers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_FindRxHandlers_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pFirstEntry_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pFirstEntry_Val = pFirstEntry;
+  cmock_call_instance->ReturnThruPtr_pFirstEntry_Size = cmock_size;
+}
+
+void CAN_FindRxHandlers_CMockIgnoreArg_pTable(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_FindRxHandlers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_FindRxHandlers_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTable = 1;
+}
+
+void CAN_FindRxHandlers_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_FindRxHandlers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_FindRxHandlers_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void CAN_FindRxHandlers_CMockIgnoreArg_pFirstEntry(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_FindRxHandlers_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_FindRxHandlers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_FindRxHandlers_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pFirstEntry = 1;
+}
+
+void CAN_MainFunction(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_MainFunction_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_MainFunction);
+  cmock_call_instance = (CMOCK_CAN_MainFunction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_MainFunction_CallInstance);
+  Mock.CAN_MainFunction_CallInstance = CMock_Guts_MemNext(Mock.CAN_MainFunction_CallInstance);
+  if (Mock.CAN_MainFunction_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.CAN_MainFunction_CallbackBool &&
+      Mock.CAN_MainFunction_CallbackFunctionPointer != NULL)
+  {
+    Mock.CAN_MainFunction_CallbackFunctionPointer(Mock.CAN_MainFunction_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.CAN_MainFunction_CallbackFunctionPointer != NULL)
+  {
+    Mock.CAN_MainFunction_CallbackFunctionPointer(Mock.CAN_MainFunction_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CAN_MainFunction_CMockIgnore(void)
+{
+  Mock.CAN_MainFunction_IgnoreBool = (char)1;
+}
+
+void CAN_MainFunction_CMockStopIgnore(void)
+{
+  Mock.CAN_MainFunction_IgnoreBool = (char)0;
+}
+
+void CAN_MainFunction_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_MainFunction_CALL_INSTANCE));
+  CMOCK_CAN_MainFunction_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_MainFunction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_MainFunction_CallInstance = CMock_Guts_MemChain(Mock.CAN_MainFunction_CallInstance, cmock_guts_index);
+  Mock.CAN_MainFunction_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void CAN_MainFunction_AddCallback(CMOCK_CAN_MainFunction_CALLBACK Callback)
+{
+  Mock.CAN_MainFunction_IgnoreBool = (char)0;
+  Mock.CAN_MainFunction_CallbackBool = (char)1;
+  Mock.CAN_MainFunction_CallbackFunctionPointer = Callback;
+}
+
+void CAN_MainFunction_Stub(CMOCK_CAN_MainFunction_CALLBACK Callback)
+{
+  Mock.CAN_MainFunction_IgnoreBool = (char)0;
+  Mock.CAN_MainFunction_CallbackBool = (char)0;
+  Mock.CAN_MainFunction_CallbackFunctionPointer = Callback;
+}
+
+void CAN_MainFunction_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_MainFunction_CALL_INSTANCE));
+  CMOCK_CAN_MainFunction_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_MainFunction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_MainFunction_CallInstance = CMock_Guts_MemChain(Mock.CAN_MainFunction_CallInstance, cmock_guts_index);
+  Mock.CAN_MainFunction_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_ReadRxBuffer(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_ReadRxBuffer);
+  cmock_call_instance = (CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_ReadRxBuffer_CallInstance);
+  Mock.CAN_ReadRxBuffer_CallInstance = CMock_Guts_MemNext(Mock.CAN_ReadRxBuffer_CallInstance);
+  if (Mock.CAN_ReadRxBuffer_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.CAN_ReadRxBuffer_CallbackBool &&
+      Mock.CAN_ReadRxBuffer_CallbackFunctionPointer != NULL)
+  {
+    Mock.CAN_ReadRxBuffer_CallbackFunctionPointer(Mock.CAN_ReadRxBuffer_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.CAN_ReadRxBuffer_CallbackFunctionPointer != NULL)
+  {
+    Mock.CAN_ReadRxBuffer_CallbackFunctionPointer(Mock.CAN_ReadRxBuffer_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CAN_ReadRxBuffer_CMockIgnore(void)
+{
+  Mock.CAN_ReadRxBuffer_IgnoreBool = (char)1;
+}
+
+void CAN_ReadRxBuffer_CMockStopIgnore(void)
+{
+  Mock.CAN_ReadRxBuffer_IgnoreBool = (char)0;
+}
+
+void CAN_ReadRxBuffer_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE));
+  CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_ReadRxBuffer_CallInstance = CMock_Guts_MemChain(Mock.CAN_ReadRxBuffer_CallInstance, cmock_guts_index);
+  Mock.CAN_ReadRxBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void CAN_ReadRxBuffer_AddCallback(CMOCK_CAN_ReadRxBuffer_CALLBACK Callback)
+{
+  Mock.CAN_ReadRxBuffer_IgnoreBool = (char)0;
+  Mock.CAN_ReadRxBuffer_CallbackBool = (char)1;
+  Mock.CAN_ReadRxBuffer_CallbackFunctionPointer = Callback;
+}
+
+void CAN_ReadRxBuffer_Stub(CMOCK_CAN_ReadRxBuffer_CALLBACK Callback)
+{
+  Mock.CAN_ReadRxBuffer_IgnoreBool = (char)0;
+  Mock.CAN_ReadRxBuffer_CallbackBool = (char)0;
+  Mock.CAN_ReadRxBuffer_CallbackFunctionPointer = Callback;
+}
+
+void CAN_ReadRxBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE));
+  CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_ReadRxBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_ReadRxBuffer_CallInstance = CMock_Guts_MemChain(Mock.CAN_ReadRxBuffer_CallInstance, cmock_guts_index);
+  Mock.CAN_ReadRxBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_Initialize(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_Initialize_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_Initialize);
+  cmock_call_instance = (CMOCK_CAN_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_Initialize_CallInstance);
+  Mock.CAN_Initialize_CallInstance = CMock_Guts_MemNext(Mock.CAN_Initialize_CallInstance);
+  if (Mock.CAN_Initialize_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.CAN_Initialize_CallbackBool &&
+      Mock.CAN_Initialize_CallbackFunctionPointer != NULL)
+  {
+    Mock.CAN_Initialize_CallbackFunctionPointer(Mock.CAN_Initialize_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.CAN_Initialize_CallbackFunctionPointer != NULL)
+  {
+    Mock.CAN_Initialize_CallbackFunctionPointer(Mock.CAN_Initialize_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CAN_Initialize_CMockIgnore(void)
+{
+  Mock.CAN_Initialize_IgnoreBool = (char)1;
+}
+
+void CAN_Initialize_CMockStopIgnore(void)
+{
+  Mock.CAN_Initialize_IgnoreBool = (char)0;
+}
+
+void CAN_Initialize_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_Initialize_CALL_INSTANCE));
+  CMOCK_CAN_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_Initialize_CallInstance = CMock_Guts_MemChain(Mock.CAN_Initialize_CallInstance, cmock_guts_index);
+  Mock.CAN_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void CAN_Initialize_AddCallback(CMOCK_CAN_Initialize_CALLBACK Callback)
+{
+  Mock.CAN_Initialize_IgnoreBool = (char)0;
+  Mock.CAN_Initialize_CallbackBool = (char)1;
+  Mock.CAN_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void CAN_Initialize_Stub(CMOCK_CAN_Initialize_CALLBACK Callback)
+{
+  Mock.CAN_Initialize_IgnoreBool = (char)0;
+  Mock.CAN_Initialize_CallbackBool = (char)0;
+  Mock.CAN_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void CAN_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_Initialize_CALL_INSTANCE));
+  CMOCK_CAN_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_Initialize_CallInstance = CMock_Guts_MemChain(Mock.CAN_Initialize_CallInstance, cmock_guts_index);
+  Mock.CAN_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_EnablePeriodic(_Bool command)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_EnablePeriodic_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_EnablePeriodic);
+  cmock_call_instance = (CMOCK_CAN_EnablePeriodic_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_EnablePeriodic_CallInstance);
+  Mock.CAN_EnablePeriodic_CallInstance = CMock_Guts_MemNext(Mock.CAN_EnablePeriodic_CallInstance);
+  if (Mock.CAN_EnablePeriodic_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.CAN_EnablePeriodic_CallbackBool &&
+      Mock.CAN_EnablePeriodic_CallbackFunctionPointer != NULL)
+  {
+    Mock.CAN_EnablePeriodic_CallbackFunctionPointer(command, Mock.CAN_EnablePeriodic_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_command)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_EnablePeriodic,CMockString_command);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_command), (void*)(&command), sizeof(_Bool), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CAN_EnablePeriodic_CallbackFunctionPointer != NULL)
+  {
+    Mock.CAN_EnablePeriodic_CallbackFunctionPointer(command, Mock.CAN_EnablePeriodic_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_CAN_EnablePeriodic(CMOCK_CAN_EnablePeriodic_CALL_INSTANCE* cmock_call_instance, _Bool command);
+void CMockExpectParameters_CAN_EnablePeriodic(CMOCK_CAN_EnablePeriodic_CALL_INSTANCE* cmock_call_instance, _Bool command)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_command), (void*)(&command),
+         sizeof(_Bool[sizeof(command) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_command = 0;
+}
+
+void CAN_EnablePeriodic_CMockIgnore(void)
+{
+  Mock.CAN_EnablePeriodic_IgnoreBool = (char)1;
+}
+
+void CAN_EnablePeriodic_CMockStopIgnore(void)
+{
+  Mock.CAN_EnablePeriodic_IgnoreBool = (char)0;
+}
+
+void CAN_EnablePeriodic_CMockExpect(UNITY_LINE_TYPE cmock_line, _Bool command)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_EnablePeriodic_CALL_INSTANCE));
+  CMOCK_CAN_EnablePeriodic_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_EnablePeriodic_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_EnablePeriodic_CallInstance = CMock_Guts_MemChain(Mock.CAN_EnablePeriodic_CallInstance, cmock_guts_index);
+  Mock.CAN_EnablePeriodic_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_EnablePeriodic(cmock_call_instance, command);
+}
+
+void CAN_EnablePeriodic_AddCallback(CMOCK_CAN_EnablePeriodic_CALLBACK Callback)
+{
+  Mock.CAN_EnablePeriodic_IgnoreBool = (char)0;
+  Mock.CAN_EnablePeriodic_CallbackBool = (char)1;
+  Mock.CAN_EnablePeriodic_CallbackFunctionPointer = Callback;
+}
+
+void CAN_EnablePeriodic_Stub(CMOCK_CAN_EnablePeriodic_CALLBACK Callback)
+{
+  Mock.CAN_EnablePeriodic_IgnoreBool = (char)0;
+  Mock.CAN_EnablePeriodic_CallbackBool = (char)0;
+  Mock.CAN_EnablePeriodic_CallbackFunctionPointer = Callback;
+}
+
+void CAN_EnablePeriodic_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, _Bool command, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_EnablePeriodic_CALL_INSTANCE));
+  CMOCK_CAN_EnablePeriodic_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_EnablePeriodic_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_EnablePeriodic_CallInstance = CMock_Guts_MemChain(Mock.CAN_EnablePeriodic_CallInstance, cmock_guts_index);
+  Mock.CAN_EnablePeriodic_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_EnablePeriodic(cmock_call_instance, command);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_EnablePeriodic_CMockIgnoreArg_command(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_EnablePeriodic_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_EnablePeriodic_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_EnablePeriodic_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_command = 1;
+}
+
+_Bool CAN_IsCurrentSensorPresent(uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_IsCurrentSensorPresent);
+  cmock_call_instance = (CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_IsCurrentSensorPresent_CallInstance);
+  Mock.CAN_IsCurrentSensorPresent_CallInstance = CMock_Guts_MemNext(Mock.CAN_IsCurrentSensorPresent_CallInstance);
+  if (Mock.CAN_IsCurrentSensorPresent_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CAN_IsCurrentSensorPresent_FinalReturn;
+    memcpy((void*)(&Mock.CAN_IsCurrentSensorPresent_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CAN_IsCurrentSensorPresent_CallbackBool &&
+      Mock.CAN_IsCurrentSensorPresent_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.CAN_IsCurrentSensorPresent_CallbackFunctionPointer(stringNumber, Mock.CAN_IsCurrentSensorPresent_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_IsCurrentSensorPresent,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CAN_IsCurrentSensorPresent_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CAN_IsCurrentSensorPresent_CallbackFunctionPointer(stringNumber, Mock.CAN_IsCurrentSensorPresent_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CAN_IsCurrentSensorPresent(CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber);
+void CMockExpectParameters_CAN_IsCurrentSensorPresent(CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void CAN_IsCurrentSensorPresent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE));
+  CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_IsCurrentSensorPresent_CallInstance = CMock_Guts_MemChain(Mock.CAN_IsCurrentSensorPresent_CallInstance, cmock_guts_index);
+  Mock.CAN_IsCurrentSensorPresent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CAN_IsCurrentSensorPresent_IgnoreBool = (char)1;
+}
+
+void CAN_IsCurrentSensorPresent_CMockStopIgnore(void)
+{
+  if(Mock.CAN_IsCurrentSensorPresent_IgnoreBool)
+    Mock.CAN_IsCurrentSensorPresent_CallInstance = CMock_Guts_MemNext(Mock.CAN_IsCurrentSensorPresent_CallInstance);
+  Mock.CAN_IsCurrentSensorPresent_IgnoreBool = (char)0;
+}
+
+void CAN_IsCurrentSensorPresent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE));
+  CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_IsCurrentSensorPresent_CallInstance = CMock_Guts_MemChain(Mock.CAN_IsCurrentSensorPresent_CallInstance, cmock_guts_index);
+  Mock.CAN_IsCurrentSensorPresent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_IsCurrentSensorPresent(cmock_call_instance, stringNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void CAN_IsCurrentSensorPresent_AddCallback(CMOCK_CAN_IsCurrentSensorPresent_CALLBACK Callback)
+{
+  Mock.CAN_IsCurrentSensorPresent_IgnoreBool = (char)0;
+  Mock.CAN_IsCurrentSensorPresent_CallbackBool = (char)1;
+  Mock.CAN_IsCurrentSensorPresent_CallbackFunctionPointer = Callback;
+}
+
+void CAN_IsCurrentSensorPresent_Stub(CMOCK_CAN_IsCurrentSensorPresent_CALLBACK Callback)
+{
+  Mock.CAN_IsCurrentSensorPresent_IgnoreBool = (char)0;
+  Mock.CAN_IsCurrentSensorPresent_CallbackBool = (char)0;
+  Mock.CAN_IsCurrentSensorPresent_CallbackFunctionPointer = Callback;
+}
+
+void CAN_IsCurrentSensorPresent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE));
+  CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_IsCurrentSensorPresent_CallInstance = CMock_Guts_MemChain(Mock.CAN_IsCurrentSensorPresent_CallInstance, cmock_guts_index);
+  Mock.CAN_IsCurrentSensorPresent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_IsCurrentSensorPresent(cmock_call_instance, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_IsCurrentSensorPresent_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_IsCurrentSensorPresent_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+_Bool CAN_IsCurrentSensorCcPresent(uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_IsCurrentSensorCcPresent);
+  cmock_call_instance = (CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_IsCurrentSensorCcPresent_CallInstance);
+  Mock.CAN_IsCurrentSensorCcPresent_CallInstance = CMock_Guts_MemNext(Mock.CAN_IsCurrentSensorCcPresent_CallInstance);
+  if (Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CAN_IsCurrentSensorCcPresent_FinalReturn;
+    memcpy((void*)(&Mock.CAN_IsCurrentSensorCcPresent_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CAN_IsCurrentSensorCcPresent_CallbackBool &&
+      Mock.CAN_IsCurrentSensorCcPresent_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.CAN_IsCurrentSensorCcPresent_CallbackFunctionPointer(stringNumber, Mock.CAN_IsCurrentSensorCcPresent_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_IsCurrentSensorCcPresent,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CAN_IsCurrentSensorCcPresent_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CAN_IsCurrentSensorCcPresent_CallbackFunctionPointer(stringNumber, Mock.CAN_IsCurrentSensorCcPresent_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CAN_IsCurrentSensorCcPresent(CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber);
+void CMockExpectParameters_CAN_IsCurrentSensorCcPresent(CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void CAN_IsCurrentSensorCcPresent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE));
+  CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_IsCurrentSensorCcPresent_CallInstance = CMock_Guts_MemChain(Mock.CAN_IsCurrentSensorCcPresent_CallInstance, cmock_guts_index);
+  Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool = (char)1;
+}
+
+void CAN_IsCurrentSensorCcPresent_CMockStopIgnore(void)
+{
+  if(Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool)
+    Mock.CAN_IsCurrentSensorCcPresent_CallInstance = CMock_Guts_MemNext(Mock.CAN_IsCurrentSensorCcPresent_CallInstance);
+  Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool = (char)0;
+}
+
+void CAN_IsCurrentSensorCcPresent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE));
+  CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_IsCurrentSensorCcPresent_CallInstance = CMock_Guts_MemChain(Mock.CAN_IsCurrentSensorCcPresent_CallInstance, cmock_guts_index);
+  Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_IsCurrentSensorCcPresent(cmock_call_instance, stringNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void CAN_IsCurrentSensorCcPresent_AddCallback(CMOCK_CAN_IsCurrentSensorCcPresent_CALLBACK Callback)
+{
+  Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool = (char)0;
+  Mock.CAN_IsCurrentSensorCcPresent_CallbackBool = (char)1;
+  Mock.CAN_IsCurrentSensorCcPresent_CallbackFunctionPointer = Callback;
+}
+
+void CAN_IsCurrentSensorCcPresent_Stub(CMOCK_CAN_IsCurrentSensorCcPresent_CALLBACK Callback)
+{
+  Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool = (char)0;
+  Mock.CAN_IsCurrentSensorCcPresent_CallbackBool = (char)0;
+  Mock.CAN_IsCurrentSensorCcPresent_CallbackFunctionPointer = Callback;
+}
+
+void CAN_IsCurrentSensorCcPresent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE));
+  CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_IsCurrentSensorCcPresent_CallInstance = CMock_Guts_MemChain(Mock.CAN_IsCurrentSensorCcPresent_CallInstance, cmock_guts_index);
+  Mock.CAN_IsCurrentSensorCcPresent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_IsCurrentSensorCcPresent(cmock_call_instance, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_IsCurrentSensorCcPresent_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorCcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_IsCurrentSensorCcPresent_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+_Bool CAN_IsCurrentSensorEcPresent(uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CAN_IsCurrentSensorEcPresent);
+  cmock_call_instance = (CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CAN_IsCurrentSensorEcPresent_CallInstance);
+  Mock.CAN_IsCurrentSensorEcPresent_CallInstance = CMock_Guts_MemNext(Mock.CAN_IsCurrentSensorEcPresent_CallInstance);
+  if (Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CAN_IsCurrentSensorEcPresent_FinalReturn;
+    memcpy((void*)(&Mock.CAN_IsCurrentSensorEcPresent_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CAN_IsCurrentSensorEcPresent_CallbackBool &&
+      Mock.CAN_IsCurrentSensorEcPresent_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.CAN_IsCurrentSensorEcPresent_CallbackFunctionPointer(stringNumber, Mock.CAN_IsCurrentSensorEcPresent_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_CAN_IsCurrentSensorEcPresent,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CAN_IsCurrentSensorEcPresent_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CAN_IsCurrentSensorEcPresent_CallbackFunctionPointer(stringNumber, Mock.CAN_IsCurrentSensorEcPresent_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CAN_IsCurrentSensorEcPresent(CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber);
+void CMockExpectParameters_CAN_IsCurrentSensorEcPresent(CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void CAN_IsCurrentSensorEcPresent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE));
+  CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_IsCurrentSensorEcPresent_CallInstance = CMock_Guts_MemChain(Mock.CAN_IsCurrentSensorEcPresent_CallInstance, cmock_guts_index);
+  Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool = (char)1;
+}
+
+void CAN_IsCurrentSensorEcPresent_CMockStopIgnore(void)
+{
+  if(Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool)
+    Mock.CAN_IsCurrentSensorEcPresent_CallInstance = CMock_Guts_MemNext(Mock.CAN_IsCurrentSensorEcPresent_CallInstance);
+  Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool = (char)0;
+}
+
+void CAN_IsCurrentSensorEcPresent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE));
+  CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_IsCurrentSensorEcPresent_CallInstance = CMock_Guts_MemChain(Mock.CAN_IsCurrentSensorEcPresent_CallInstance, cmock_guts_index);
+  Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_IsCurrentSensorEcPresent(cmock_call_instance, stringNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void CAN_IsCurrentSensorEcPresent_AddCallback(CMOCK_CAN_IsCurrentSensorEcPresent_CALLBACK Callback)
+{
+  Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool = (char)0;
+  Mock.CAN_IsCurrentSensorEcPresent_CallbackBool = (char)1;
+  Mock.CAN_IsCurrentSensorEcPresent_CallbackFunctionPointer = Callback;
+}
+
+void CAN_IsCurrentSensorEcPresent_Stub(CMOCK_CAN_IsCurrentSensorEcPresent_CALLBACK Callback)
+{
+  Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool = (char)0;
+  Mock.CAN_IsCurrentSensorEcPresent_CallbackBool = (char)0;
+  Mock.CAN_IsCurrentSensorEcPresent_CallbackFunctionPointer = Callback;
+}
+
+void CAN_IsCurrentSensorEcPresent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE));
+  CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CAN_IsCurrentSensorEcPresent_CallInstance = CMock_Guts_MemChain(Mock.CAN_IsCurrentSensorEcPresent_CallInstance, cmock_guts_index);
+  Mock.CAN_IsCurrentSensorEcPresent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CAN_IsCurrentSensorEcPresent(cmock_call_instance, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CAN_IsCurrentSensorEcPresent_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE* cmock_call_instance = (CMOCK_CAN_IsCurrentSensorEcPresent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CAN_IsCurrentSensorEcPresent_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+CAN_STATE_s* TEST_CAN_GetCANState(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_GetCANState);
+  cmock_call_instance = (CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_GetCANState_CallInstance);
+  Mock.TEST_CAN_GetCANState_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetCANState_CallInstance);
+  if (Mock.TEST_CAN_GetCANState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_GetCANState_FinalReturn;
+    Mock.TEST_CAN_GetCANState_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_GetCANState_CallbackBool &&
+      Mock.TEST_CAN_GetCANState_CallbackFunctionPointer != NULL)
+  {
+    CAN_STATE_s* cmock_cb_ret = Mock.TEST_CAN_GetCANState_CallbackFunctionPointer(Mock.TEST_CAN_GetCANState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_CAN_GetCANState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_GetCANState_CallbackFunctionPointer(Mock.TEST_CAN_GetCANState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_CAN_GetCANState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CAN_STATE_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetCANState_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetCANState_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetCANState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_GetCANState_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_GetCANState_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_GetCANState_IgnoreBool)
+    Mock.TEST_CAN_GetCANState_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetCANState_CallInstance);
+  Mock.TEST_CAN_GetCANState_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_GetCANState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, CAN_STATE_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetCANState_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetCANState_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetCANState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_GetCANState_AddCallback(CMOCK_TEST_CAN_GetCANState_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetCANState_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetCANState_CallbackBool = (char)1;
+  Mock.TEST_CAN_GetCANState_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetCANState_Stub(CMOCK_TEST_CAN_GetCANState_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetCANState_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetCANState_CallbackBool = (char)0;
+  Mock.TEST_CAN_GetCANState_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetCANState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetCANState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetCANState_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetCANState_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetCANState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+CAN_RX_BUFFER_s* TEST_CAN_GetRxBuffer(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_GetRxBuffer);
+  cmock_call_instance = (CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_GetRxBuffer_CallInstance);
+  Mock.TEST_CAN_GetRxBuffer_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetRxBuffer_CallInstance);
+  if (Mock.TEST_CAN_GetRxBuffer_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_GetRxBuffer_FinalReturn;
+    Mock.TEST_CAN_GetRxBuffer_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_GetRxBuffer_CallbackBool &&
+      Mock.TEST_CAN_GetRxBuffer_CallbackFunctionPointer != NULL)
+  {
+    CAN_RX_BUFFER_s* cmock_cb_ret = Mock.TEST_CAN_GetRxBuffer_CallbackFunctionPointer(Mock.TEST_CAN_GetRxBuffer_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_CAN_GetRxBuffer_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_GetRxBuffer_CallbackFunctionPointer(Mock.TEST_CAN_GetRxBuffer_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_CAN_GetRxBuffer_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CAN_RX_BUFFER_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetRxBuffer_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetRxBuffer_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetRxBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_GetRxBuffer_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_GetRxBuffer_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_GetRxBuffer_IgnoreBool)
+    Mock.TEST_CAN_GetRxBuffer_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetRxBuffer_CallInstance);
+  Mock.TEST_CAN_GetRxBuffer_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_GetRxBuffer_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, CAN_RX_BUFFER_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetRxBuffer_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetRxBuffer_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetRxBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_GetRxBuffer_AddCallback(CMOCK_TEST_CAN_GetRxBuffer_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetRxBuffer_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetRxBuffer_CallbackBool = (char)1;
+  Mock.TEST_CAN_GetRxBuffer_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetRxBuffer_Stub(CMOCK_TEST_CAN_GetRxBuffer_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetRxBuffer_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetRxBuffer_CallbackBool = (char)0;
+  Mock.TEST_CAN_GetRxBuffer_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetRxBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetRxBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetRxBuffer_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetRxBuffer_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetRxBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+CAN_RX_DISPATCH_TABLE_s* TEST_CAN_GetRxDispatchTable(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_GetRxDispatchTable);
+  cmock_call_instance = (CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_GetRxDispatchTable_CallInstance);
+  Mock.TEST_CAN_GetRxDispatchTable_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetRxDispatchTable_CallInstance);
+  if (Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_GetRxDispatchTable_FinalReturn;
+    Mock.TEST_CAN_GetRxDispatchTable_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_GetRxDispatchTable_CallbackBool &&
+      Mock.TEST_CAN_GetRxDispatchTable_CallbackFunctionPointer != NULL)
+  {
+    CAN_RX_DISPATCH_TABLE_s* cmock_cb_ret = Mock.TEST_CAN_GetRxDispatchTable_CallbackFunctionPointer(Mock.TEST_CAN_GetRxDispatchTable_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_CAN_GetRxDispatchTable_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_GetRxDispatchTable_CallbackFunctionPointer(Mock.TEST_CAN_GetRxDispatchTable_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_CAN_GetRxDispatchTable_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CAN_RX_DISPATCH_TABLE_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetRxDispatchTable_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetRxDispatchTable_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_GetRxDispatchTable_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool)
+    Mock.TEST_CAN_GetRxDispatchTable_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetRxDispatchTable_CallInstance);
+  Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_GetRxDispatchTable_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, CAN_RX_DISPATCH_TABLE_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetRxDispatchTable_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetRxDispatchTable_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_GetRxDispatchTable_AddCallback(CMOCK_TEST_CAN_GetRxDispatchTable_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetRxDispatchTable_CallbackBool = (char)1;
+  Mock.TEST_CAN_GetRxDispatchTable_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetRxDispatchTable_Stub(CMOCK_TEST_CAN_GetRxDispatchTable_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetRxDispatchTable_CallbackBool = (char)0;
+  Mock.TEST_CAN_GetRxDispatchTable_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetRxDispatchTable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetRxDispatchTable_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetRxDispatchTable_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetRxDispatchTable_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetRxDispatchTable_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint32_t TEST_CAN_GetWorstCaseFrameBits(uint8_t dlc)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_GetWorstCaseFrameBits);
+  cmock_call_instance = (CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance);
+  Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance);
+  if (Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_GetWorstCaseFrameBits_FinalReturn;
+    Mock.TEST_CAN_GetWorstCaseFrameBits_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackBool &&
+      Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackFunctionPointer(dlc, Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_GetWorstCaseFrameBits,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackFunctionPointer(dlc, Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_GetWorstCaseFrameBits(CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE* cmock_call_instance, uint8_t dlc);
+void CMockExpectParameters_TEST_CAN_GetWorstCaseFrameBits(CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE* cmock_call_instance, uint8_t dlc)
+{
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+}
+
+void TEST_CAN_GetWorstCaseFrameBits_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_GetWorstCaseFrameBits_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool)
+    Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance);
+  Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_GetWorstCaseFrameBits_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t dlc, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_GetWorstCaseFrameBits(cmock_call_instance, dlc);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_GetWorstCaseFrameBits_AddCallback(CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackBool = (char)1;
+  Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetWorstCaseFrameBits_Stub(CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackBool = (char)0;
+  Mock.TEST_CAN_GetWorstCaseFrameBits_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetWorstCaseFrameBits_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t dlc, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetWorstCaseFrameBits_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_GetWorstCaseFrameBits(cmock_call_instance, dlc);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_GetWorstCaseFrameBits_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_GetWorstCaseFrameBits_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+STD_RETURN_TYPE_e TEST_CAN_StoreRxMessage(uint32_t id, const uint8_t* pData)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_StoreRxMessage);
+  cmock_call_instance = (CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_StoreRxMessage_CallInstance);
+  Mock.TEST_CAN_StoreRxMessage_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_StoreRxMessage_CallInstance);
+  if (Mock.TEST_CAN_StoreRxMessage_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_StoreRxMessage_FinalReturn;
+    memcpy((void*)(&Mock.TEST_CAN_StoreRxMessage_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_StoreRxMessage_CallbackBool &&
+      Mock.TEST_CAN_StoreRxMessage_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.TEST_CAN_StoreRxMessage_CallbackFunctionPointer(id, pData, Mock.TEST_CAN_StoreRxMessage_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_StoreRxMessage,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_StoreRxMessage,CMockString_pData);
+    if (cmock_call_instance->Expected_pData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pData, pData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_StoreRxMessage_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_StoreRxMessage_CallbackFunctionPointer(id, pData, Mock.TEST_CAN_StoreRxMessage_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_StoreRxMessage(CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE* cmock_call_instance, uint32_t id, const uint8_t* pData);
+void CMockExpectParameters_TEST_CAN_StoreRxMessage(CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE* cmock_call_instance, uint32_t id, const uint8_t* pData)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_pData = pData;
+  cmock_call_instance->IgnoreArg_pData = 0;
+}
+
+void TEST_CAN_StoreRxMessage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE));
+  CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_StoreRxMessage_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_StoreRxMessage_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_StoreRxMessage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_StoreRxMessage_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_StoreRxMessage_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_StoreRxMessage_IgnoreBool)
+    Mock.TEST_CAN_StoreRxMessage_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_StoreRxMessage_CallInstance);
+  Mock.TEST_CAN_StoreRxMessage_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_StoreRxMessage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, const uint8_t* pData, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE));
+  CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_StoreRxMessage_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_StoreRxMessage_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_StoreRxMessage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_StoreRxMessage(cmock_call_instance, id, pData);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void TEST_CAN_StoreRxMessage_AddCallback(CMOCK_TEST_CAN_StoreRxMessage_CALLBACK Callback)
+{
+  Mock.TEST_CAN_StoreRxMessage_IgnoreBool = (char)0;
+  Mock.TEST_CAN_StoreRxMessage_CallbackBool = (char)1;
+  Mock.TEST_CAN_StoreRxMessage_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_StoreRxMessage_Stub(CMOCK_TEST_CAN_StoreRxMessage_CALLBACK Callback)
+{
+  Mock.TEST_CAN_StoreRxMessage_IgnoreBool = (char)0;
+  Mock.TEST_CAN_StoreRxMessage_CallbackBool = (char)0;
+  Mock.TEST_CAN_StoreRxMessage_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_StoreRxMessage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, const uint8_t* pData, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE));
+  CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_StoreRxMessage_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_StoreRxMessage_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_StoreRxMessage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_StoreRxMessage(cmock_call_instance, id, pData);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_StoreRxMessage_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_StoreRxMessage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_StoreRxMessage_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_StoreRxMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_StoreRxMessage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pData = 1;
+}
+
+void TEST_CAN_UpdateRxStatistics(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_UpdateRxStatistics);
+  cmock_call_instance = (CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_UpdateRxStatistics_CallInstance);
+  Mock.TEST_CAN_UpdateRxStatistics_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_UpdateRxStatistics_CallInstance);
+  if (Mock.TEST_CAN_UpdateRxStatistics_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_CAN_UpdateRxStatistics_CallbackBool &&
+      Mock.TEST_CAN_UpdateRxStatistics_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_CAN_UpdateRxStatistics_CallbackFunctionPointer(Mock.TEST_CAN_UpdateRxStatistics_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_CAN_UpdateRxStatistics_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_CAN_UpdateRxStatistics_CallbackFunctionPointer(Mock.TEST_CAN_UpdateRxStatistics_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void TEST_CAN_UpdateRxStatistics_CMockIgnore(void)
+{
+  Mock.TEST_CAN_UpdateRxStatistics_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_UpdateRxStatistics_CMockStopIgnore(void)
+{
+  Mock.TEST_CAN_UpdateRxStatistics_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_UpdateRxStatistics_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE));
+  CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_UpdateRxStatistics_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_UpdateRxStatistics_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_UpdateRxStatistics_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void TEST_CAN_UpdateRxStatistics_AddCallback(CMOCK_TEST_CAN_UpdateRxStatistics_CALLBACK Callback)
+{
+  Mock.TEST_CAN_UpdateRxStatistics_IgnoreBool = (char)0;
+  Mock.TEST_CAN_UpdateRxStatistics_CallbackBool = (char)1;
+  Mock.TEST_CAN_UpdateRxStatistics_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_UpdateRxStatistics_Stub(CMOCK_TEST_CAN_UpdateRxStatistics_CALLBACK Callback)
+{
+  Mock.TEST_CAN_UpdateRxStatistics_IgnoreBool = (char)0;
+  Mock.TEST_CAN_UpdateRxStatistics_CallbackBool = (char)0;
+  Mock.TEST_CAN_UpdateRxStatistics_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_UpdateRxStatistics_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE));
+  CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_UpdateRxStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_UpdateRxStatistics_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_UpdateRxStatistics_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_UpdateRxStatistics_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
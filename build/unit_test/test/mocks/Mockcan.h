@@ -0,0 +1,308 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKCAN_H
+#define _MOCKCAN_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "can.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockcan_Init(void);
+void Mockcan_Destroy(void);
+void Mockcan_Verify(void);
+
+
+
+
+#define CAN_DataSend_IgnoreAndReturn(cmock_retval) CAN_DataSend_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CAN_DataSend_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define CAN_DataSend_StopIgnore() CAN_DataSend_CMockStopIgnore()
+void CAN_DataSend_CMockStopIgnore(void);
+#define CAN_DataSend_ExpectAndReturn(pNode, id, pData, cmock_retval) CAN_DataSend_CMockExpectAndReturn(__LINE__, pNode, id, pData, cmock_retval)
+void CAN_DataSend_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, canBASE_t* pNode, uint32_t id, uint8* pData, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_CAN_DataSend_CALLBACK)(canBASE_t* pNode, uint32_t id, uint8* pData, int cmock_num_calls);
+void CAN_DataSend_AddCallback(CMOCK_CAN_DataSend_CALLBACK Callback);
+void CAN_DataSend_Stub(CMOCK_CAN_DataSend_CALLBACK Callback);
+#define CAN_DataSend_StubWithCallback CAN_DataSend_Stub
+#define CAN_DataSend_ExpectAndThrow(pNode, id, pData, cmock_to_throw) CAN_DataSend_CMockExpectAndThrow(__LINE__, pNode, id, pData, cmock_to_throw)
+void CAN_DataSend_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, canBASE_t* pNode, uint32_t id, uint8* pData, CEXCEPTION_T cmock_to_throw);
+#define CAN_DataSend_ReturnThruPtr_pNode(pNode) CAN_DataSend_CMockReturnMemThruPtr_pNode(__LINE__, pNode, sizeof(canBASE_t))
+#define CAN_DataSend_ReturnArrayThruPtr_pNode(pNode, cmock_len) CAN_DataSend_CMockReturnMemThruPtr_pNode(__LINE__, pNode, cmock_len * sizeof(*pNode))
+#define CAN_DataSend_ReturnMemThruPtr_pNode(pNode, cmock_size) CAN_DataSend_CMockReturnMemThruPtr_pNode(__LINE__, pNode, cmock_size)
+void CAN_DataSend_CMockReturnMemThruPtr_pNode(UNITY_LINE_TYPE cmock_line, canBASE_t* pNode, size_t cmock_size);
+#define CAN_DataSend_ReturnThruPtr_pData(pData) CAN_DataSend_CMockReturnMemThruPtr_pData(__LINE__, pData, sizeof(uint8))
+#define CAN_DataSend_ReturnArrayThruPtr_pData(pData, cmock_len) CAN_DataSend_CMockReturnMemThruPtr_pData(__LINE__, pData, cmock_len * sizeof(*pData))
+#define CAN_DataSend_ReturnMemThruPtr_pData(pData, cmock_size) CAN_DataSend_CMockReturnMemThruPtr_pData(__LINE__, pData, cmock_size)
+void CAN_DataSend_CMockReturnMemThruPtr_pData(UNITY_LINE_TYPE cmock_line, uint8* pData, size_t cmock_size);
+#define CAN_DataSend_IgnoreArg_pNode() CAN_DataSend_CMockIgnoreArg_pNode(__LINE__)
+void CAN_DataSend_CMockIgnoreArg_pNode(UNITY_LINE_TYPE cmock_line);
+#define CAN_DataSend_IgnoreArg_id() CAN_DataSend_CMockIgnoreArg_id(__LINE__)
+void CAN_DataSend_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define CAN_DataSend_IgnoreArg_pData() CAN_DataSend_CMockIgnoreArg_pData(__LINE__)
+void CAN_DataSend_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line);
+#define CAN_BuildTxSchedule_IgnoreAndReturn(cmock_retval) CAN_BuildTxSchedule_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CAN_BuildTxSchedule_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define CAN_BuildTxSchedule_StopIgnore() CAN_BuildTxSchedule_CMockStopIgnore()
+void CAN_BuildTxSchedule_CMockStopIgnore(void);
+#define CAN_BuildTxSchedule_ExpectAndReturn(pMessages, numberOfMessages, pSchedule, cmock_retval) CAN_BuildTxSchedule_CMockExpectAndReturn(__LINE__, pMessages, numberOfMessages, pSchedule, cmock_retval)
+void CAN_BuildTxSchedule_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CAN_MSG_TX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_TX_SCHEDULE_s* pSchedule, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_CAN_BuildTxSchedule_CALLBACK)(const CAN_MSG_TX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_TX_SCHEDULE_s* pSchedule, int cmock_num_calls);
+void CAN_BuildTxSchedule_AddCallback(CMOCK_CAN_BuildTxSchedule_CALLBACK Callback);
+void CAN_BuildTxSchedule_Stub(CMOCK_CAN_BuildTxSchedule_CALLBACK Callback);
+#define CAN_BuildTxSchedule_StubWithCallback CAN_BuildTxSchedule_Stub
+#define CAN_BuildTxSchedule_ExpectAndThrow(pMessages, numberOfMessages, pSchedule, cmock_to_throw) CAN_BuildTxSchedule_CMockExpectAndThrow(__LINE__, pMessages, numberOfMessages, pSchedule, cmock_to_throw)
+void CAN_BuildTxSchedule_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CAN_MSG_TX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_TX_SCHEDULE_s* pSchedule, CEXCEPTION_T cmock_to_throw);
+#define CAN_BuildTxSchedule_ReturnThruPtr_pSchedule(pSchedule) CAN_BuildTxSchedule_CMockReturnMemThruPtr_pSchedule(__LINE__, pSchedule, sizeof(CAN_TX_SCHEDULE_s))
+#define CAN_BuildTxSchedule_ReturnArrayThruPtr_pSchedule(pSchedule, cmock_len) CAN_BuildTxSchedule_CMockReturnMemThruPtr_pSchedule(__LINE__, pSchedule, cmock_len * sizeof(*pSchedule))
+#define CAN_BuildTxSchedule_ReturnMemThruPtr_pSchedule(pSchedule, cmock_size) CAN_BuildTxSchedule_CMockReturnMemThruPtr_pSchedule(__LINE__, pSchedule, cmock_size)
+void CAN_BuildTxSchedule_CMockReturnMemThruPtr_pSchedule(UNITY_LINE_TYPE cmock_line, CAN_TX_SCHEDULE_s* pSchedule, size_t cmock_size);
+#define CAN_BuildTxSchedule_IgnoreArg_pMessages() CAN_BuildTxSchedule_CMockIgnoreArg_pMessages(__LINE__)
+void CAN_BuildTxSchedule_CMockIgnoreArg_pMessages(UNITY_LINE_TYPE cmock_line);
+#define CAN_BuildTxSchedule_IgnoreArg_numberOfMessages() CAN_BuildTxSchedule_CMockIgnoreArg_numberOfMessages(__LINE__)
+void CAN_BuildTxSchedule_CMockIgnoreArg_numberOfMessages(UNITY_LINE_TYPE cmock_line);
+#define CAN_BuildTxSchedule_IgnoreArg_pSchedule() CAN_BuildTxSchedule_CMockIgnoreArg_pSchedule(__LINE__)
+void CAN_BuildTxSchedule_CMockIgnoreArg_pSchedule(UNITY_LINE_TYPE cmock_line);
+#define CAN_BuildRxDispatchTable_IgnoreAndReturn(cmock_retval) CAN_BuildRxDispatchTable_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CAN_BuildRxDispatchTable_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define CAN_BuildRxDispatchTable_StopIgnore() CAN_BuildRxDispatchTable_CMockStopIgnore()
+void CAN_BuildRxDispatchTable_CMockStopIgnore(void);
+#define CAN_BuildRxDispatchTable_ExpectAndReturn(pMessages, numberOfMessages, pTable, cmock_retval) CAN_BuildRxDispatchTable_CMockExpectAndReturn(__LINE__, pMessages, numberOfMessages, pTable, cmock_retval)
+void CAN_BuildRxDispatchTable_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CAN_MSG_RX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_RX_DISPATCH_TABLE_s* pTable, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_CAN_BuildRxDispatchTable_CALLBACK)(const CAN_MSG_RX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_RX_DISPATCH_TABLE_s* pTable, int cmock_num_calls);
+void CAN_BuildRxDispatchTable_AddCallback(CMOCK_CAN_BuildRxDispatchTable_CALLBACK Callback);
+void CAN_BuildRxDispatchTable_Stub(CMOCK_CAN_BuildRxDispatchTable_CALLBACK Callback);
+#define CAN_BuildRxDispatchTable_StubWithCallback CAN_BuildRxDispatchTable_Stub
+#define CAN_BuildRxDispatchTable_ExpectAndThrow(pMessages, numberOfMessages, pTable, cmock_to_throw) CAN_BuildRxDispatchTable_CMockExpectAndThrow(__LINE__, pMessages, numberOfMessages, pTable, cmock_to_throw)
+void CAN_BuildRxDispatchTable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CAN_MSG_RX_TYPE_s* pMessages, uint8_t numberOfMessages, CAN_RX_DISPATCH_TABLE_s* pTable, CEXCEPTION_T cmock_to_throw);
+#define CAN_BuildRxDispatchTable_ReturnThruPtr_pTable(pTable) CAN_BuildRxDispatchTable_CMockReturnMemThruPtr_pTable(__LINE__, pTable, sizeof(CAN_RX_DISPATCH_TABLE_s))
+#define CAN_BuildRxDispatchTable_ReturnArrayThruPtr_pTable(pTable, cmock_len) CAN_BuildRxDispatchTable_CMockReturnMemThruPtr_pTable(__LINE__, pTable, cmock_len * sizeof(*pTable))
+#define CAN_BuildRxDispatchTable_ReturnMemThruPtr_pTable(pTable, cmock_size) CAN_BuildRxDispatchTable_CMockReturnMemThruPtr_pTable(__LINE__, pTable, cmock_size)
+void CAN_BuildRxDispatchTable_CMockReturnMemThruPtr_pTable(UNITY_LINE_TYPE cmock_line, CAN_RX_DISPATCH_TABLE_s* pTable, size_t cmock_size);
+#define CAN_BuildRxDispatchTable_IgnoreArg_pMessages() CAN_BuildRxDispatchTable_CMockIgnoreArg_pMessages(__LINE__)
+void CAN_BuildRxDispatchTable_CMockIgnoreArg_pMessages(UNITY_LINE_TYPE cmock_line);
+#define CAN_BuildRxDispatchTable_IgnoreArg_numberOfMessages() CAN_BuildRxDispatchTable_CMockIgnoreArg_numberOfMessages(__LINE__)
+void CAN_BuildRxDispatchTable_CMockIgnoreArg_numberOfMessages(UNITY_LINE_TYPE cmock_line);
+#define CAN_BuildRxDispatchTable_IgnoreArg_pTable() CAN_BuildRxDispatchTable_CMockIgnoreArg_pTable(__LINE__)
+void CAN_BuildRxDispatchTable_CMockIgnoreArg_pTable(UNITY_LINE_TYPE cmock_line);
+#define CAN_FindRxHandlers_IgnoreAndReturn(cmock_retval) CAN_FindRxHandlers_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CAN_FindRxHandlers_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define CAN_FindRxHandlers_StopIgnore() CAN_FindRxHandlers_CMockStopIgnore()
+void CAN_FindRxHandlers_CMockStopIgnore(void);
+#define CAN_FindRxHandlers_ExpectAndReturn(pTable, id, pFirstEntry, cmock_retval) CAN_FindRxHandlers_CMockExpectAndReturn(__LINE__, pTable, id, pFirstEntry, cmock_retval)
+void CAN_FindRxHandlers_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CAN_RX_DISPATCH_TABLE_s* pTable, uint32_t id, uint8_t* pFirstEntry, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_CAN_FindRxHandlers_CALLBACK)(const CAN_RX_DISPATCH_TABLE_s* pTable, uint32_t id, uint8_t* pFirstEntry, int cmock_num_calls);
+void CAN_FindRxHandlers_AddCallback(CMOCK_CAN_FindRxHandlers_CALLBACK Callback);
+void CAN_FindRxHandlers_Stub(CMOCK_CAN_FindRxHandlers_CALLBACK Callback);
+#define CAN_FindRxHandlers_StubWithCallback CAN_FindRxHandlers_Stub
+#define CAN_FindRxHandlers_ExpectAndThrow(pTable, id, pFirstEntry, cmock_to_throw) CAN_FindRxHandlers_CMockExpectAndThrow(__LINE__, pTable, id, pFirstEntry, cmock_to_throw)
+void CAN_FindRxHandlers_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CAN_RX_DISPATCH_TABLE_s* pTable, uint32_t id, uint8_t* pFirstEntry, CEXCEPTION_T cmock_to_throw);
+#define CAN_FindRxHandlers_ReturnThruPtr_pFirstEntry(pFirstEntry) CAN_FindRxHandlers_CMockReturnMemThruPtr_pFirstEntry(__LINE__, pFirstEntry, sizeof(uint8_t))
+#define CAN_FindRxHandlers_ReturnArrayThruPtr_pFirstEntry(pFirstEntry, cmock_len) CAN_FindRxHandlers_CMockReturnMemThruPtr_pFirstEntry(__LINE__, pFirstEntry, cmock_len * sizeof(*pFirstEntry))
+#define CAN_FindRxHandlers_ReturnMemThruPtr_pFirstEntry(pFirstEntry, cmock_size) CAN_FindRxHandlers_CMockReturnMemThruPtr_pFirstEntry(__LINE__, pFirstEntry, cmock_size)
+void CAN_FindRxHandlers_CMockReturnMemThruPtr_pFirstEntry(UNITY_LINE_TYPE cmock_line, uint8_t* pFirstEntry, size_t cmock_size);
+#define CAN_FindRxHandlers_IgnoreArg_pTable() CAN_FindRxHandlers_CMockIgnoreArg_pTable(__LINE__)
+void CAN_FindRxHandlers_CMockIgnoreArg_pTable(UNITY_LINE_TYPE cmock_line);
+#define CAN_FindRxHandlers_IgnoreArg_id() CAN_FindRxHandlers_CMockIgnoreArg_id(__LINE__)
+void CAN_FindRxHandlers_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define CAN_FindRxHandlers_IgnoreArg_pFirstEntry() CAN_FindRxHandlers_CMockIgnoreArg_pFirstEntry(__LINE__)
+void CAN_FindRxHandlers_CMockIgnoreArg_pFirstEntry(UNITY_LINE_TYPE cmock_line);
+#define CAN_MainFunction_Ignore() CAN_MainFunction_CMockIgnore()
+void CAN_MainFunction_CMockIgnore(void);
+#define CAN_MainFunction_StopIgnore() CAN_MainFunction_CMockStopIgnore()
+void CAN_MainFunction_CMockStopIgnore(void);
+#define CAN_MainFunction_Expect() CAN_MainFunction_CMockExpect(__LINE__)
+void CAN_MainFunction_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_CAN_MainFunction_CALLBACK)(int cmock_num_calls);
+void CAN_MainFunction_AddCallback(CMOCK_CAN_MainFunction_CALLBACK Callback);
+void CAN_MainFunction_Stub(CMOCK_CAN_MainFunction_CALLBACK Callback);
+#define CAN_MainFunction_StubWithCallback CAN_MainFunction_Stub
+#define CAN_MainFunction_ExpectAndThrow(cmock_to_throw) CAN_MainFunction_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void CAN_MainFunction_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define CAN_ReadRxBuffer_Ignore() CAN_ReadRxBuffer_CMockIgnore()
+void CAN_ReadRxBuffer_CMockIgnore(void);
+#define CAN_ReadRxBuffer_StopIgnore() CAN_ReadRxBuffer_CMockStopIgnore()
+void CAN_ReadRxBuffer_CMockStopIgnore(void);
+#define CAN_ReadRxBuffer_Expect() CAN_ReadRxBuffer_CMockExpect(__LINE__)
+void CAN_ReadRxBuffer_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_CAN_ReadRxBuffer_CALLBACK)(int cmock_num_calls);
+void CAN_ReadRxBuffer_AddCallback(CMOCK_CAN_ReadRxBuffer_CALLBACK Callback);
+void CAN_ReadRxBuffer_Stub(CMOCK_CAN_ReadRxBuffer_CALLBACK Callback);
+#define CAN_ReadRxBuffer_StubWithCallback CAN_ReadRxBuffer_Stub
+#define CAN_ReadRxBuffer_ExpectAndThrow(cmock_to_throw) CAN_ReadRxBuffer_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void CAN_ReadRxBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define CAN_Initialize_Ignore() CAN_Initialize_CMockIgnore()
+void CAN_Initialize_CMockIgnore(void);
+#define CAN_Initialize_StopIgnore() CAN_Initialize_CMockStopIgnore()
+void CAN_Initialize_CMockStopIgnore(void);
+#define CAN_Initialize_Expect() CAN_Initialize_CMockExpect(__LINE__)
+void CAN_Initialize_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_CAN_Initialize_CALLBACK)(int cmock_num_calls);
+void CAN_Initialize_AddCallback(CMOCK_CAN_Initialize_CALLBACK Callback);
+void CAN_Initialize_Stub(CMOCK_CAN_Initialize_CALLBACK Callback);
+#define CAN_Initialize_StubWithCallback CAN_Initialize_Stub
+#define CAN_Initialize_ExpectAndThrow(cmock_to_throw) CAN_Initialize_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void CAN_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define CAN_EnablePeriodic_Ignore() CAN_EnablePeriodic_CMockIgnore()
+void CAN_EnablePeriodic_CMockIgnore(void);
+#define CAN_EnablePeriodic_StopIgnore() CAN_EnablePeriodic_CMockStopIgnore()
+void CAN_EnablePeriodic_CMockStopIgnore(void);
+#define CAN_EnablePeriodic_Expect(command) CAN_EnablePeriodic_CMockExpect(__LINE__, command)
+void CAN_EnablePeriodic_CMockExpect(UNITY_LINE_TYPE cmock_line, _Bool command);
+typedef void (* CMOCK_CAN_EnablePeriodic_CALLBACK)(_Bool command, int cmock_num_calls);
+void CAN_EnablePeriodic_AddCallback(CMOCK_CAN_EnablePeriodic_CALLBACK Callback);
+void CAN_EnablePeriodic_Stub(CMOCK_CAN_EnablePeriodic_CALLBACK Callback);
+#define CAN_EnablePeriodic_StubWithCallback CAN_EnablePeriodic_Stub
+#define CAN_EnablePeriodic_ExpectAndThrow(command, cmock_to_throw) CAN_EnablePeriodic_CMockExpectAndThrow(__LINE__, command, cmock_to_throw)
+void CAN_EnablePeriodic_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, _Bool command, CEXCEPTION_T cmock_to_throw);
+#define CAN_EnablePeriodic_IgnoreArg_command() CAN_EnablePeriodic_CMockIgnoreArg_command(__LINE__)
+void CAN_EnablePeriodic_CMockIgnoreArg_command(UNITY_LINE_TYPE cmock_line);
+#define CAN_IsCurrentSensorPresent_IgnoreAndReturn(cmock_retval) CAN_IsCurrentSensorPresent_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CAN_IsCurrentSensorPresent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define CAN_IsCurrentSensorPresent_StopIgnore() CAN_IsCurrentSensorPresent_CMockStopIgnore()
+void CAN_IsCurrentSensorPresent_CMockStopIgnore(void);
+#define CAN_IsCurrentSensorPresent_ExpectAndReturn(stringNumber, cmock_retval) CAN_IsCurrentSensorPresent_CMockExpectAndReturn(__LINE__, stringNumber, cmock_retval)
+void CAN_IsCurrentSensorPresent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_CAN_IsCurrentSensorPresent_CALLBACK)(uint8_t stringNumber, int cmock_num_calls);
+void CAN_IsCurrentSensorPresent_AddCallback(CMOCK_CAN_IsCurrentSensorPresent_CALLBACK Callback);
+void CAN_IsCurrentSensorPresent_Stub(CMOCK_CAN_IsCurrentSensorPresent_CALLBACK Callback);
+#define CAN_IsCurrentSensorPresent_StubWithCallback CAN_IsCurrentSensorPresent_Stub
+#define CAN_IsCurrentSensorPresent_ExpectAndThrow(stringNumber, cmock_to_throw) CAN_IsCurrentSensorPresent_CMockExpectAndThrow(__LINE__, stringNumber, cmock_to_throw)
+void CAN_IsCurrentSensorPresent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define CAN_IsCurrentSensorPresent_IgnoreArg_stringNumber() CAN_IsCurrentSensorPresent_CMockIgnoreArg_stringNumber(__LINE__)
+void CAN_IsCurrentSensorPresent_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define CAN_IsCurrentSensorCcPresent_IgnoreAndReturn(cmock_retval) CAN_IsCurrentSensorCcPresent_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CAN_IsCurrentSensorCcPresent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define CAN_IsCurrentSensorCcPresent_StopIgnore() CAN_IsCurrentSensorCcPresent_CMockStopIgnore()
+void CAN_IsCurrentSensorCcPresent_CMockStopIgnore(void);
+#define CAN_IsCurrentSensorCcPresent_ExpectAndReturn(stringNumber, cmock_retval) CAN_IsCurrentSensorCcPresent_CMockExpectAndReturn(__LINE__, stringNumber, cmock_retval)
+void CAN_IsCurrentSensorCcPresent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_CAN_IsCurrentSensorCcPresent_CALLBACK)(uint8_t stringNumber, int cmock_num_calls);
+void CAN_IsCurrentSensorCcPresent_AddCallback(CMOCK_CAN_IsCurrentSensorCcPresent_CALLBACK Callback);
+void CAN_IsCurrentSensorCcPresent_Stub(CMOCK_CAN_IsCurrentSensorCcPresent_CALLBACK Callback);
+#define CAN_IsCurrentSensorCcPresent_StubWithCallback CAN_IsCurrentSensorCcPresent_Stub
+#define CAN_IsCurrentSensorCcPresent_ExpectAndThrow(stringNumber, cmock_to_throw) CAN_IsCurrentSensorCcPresent_CMockExpectAndThrow(__LINE__, stringNumber, cmock_to_throw)
+void CAN_IsCurrentSensorCcPresent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define CAN_IsCurrentSensorCcPresent_IgnoreArg_stringNumber() CAN_IsCurrentSensorCcPresent_CMockIgnoreArg_stringNumber(__LINE__)
+void CAN_IsCurrentSensorCcPresent_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define CAN_IsCurrentSensorEcPresent_IgnoreAndReturn(cmock_retval) CAN_IsCurrentSensorEcPresent_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CAN_IsCurrentSensorEcPresent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define CAN_IsCurrentSensorEcPresent_StopIgnore() CAN_IsCurrentSensorEcPresent_CMockStopIgnore()
+void CAN_IsCurrentSensorEcPresent_CMockStopIgnore(void);
+#define CAN_IsCurrentSensorEcPresent_ExpectAndReturn(stringNumber, cmock_retval) CAN_IsCurrentSensorEcPresent_CMockExpectAndReturn(__LINE__, stringNumber, cmock_retval)
+void CAN_IsCurrentSensorEcPresent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_CAN_IsCurrentSensorEcPresent_CALLBACK)(uint8_t stringNumber, int cmock_num_calls);
+void CAN_IsCurrentSensorEcPresent_AddCallback(CMOCK_CAN_IsCurrentSensorEcPresent_CALLBACK Callback);
+void CAN_IsCurrentSensorEcPresent_Stub(CMOCK_CAN_IsCurrentSensorEcPresent_CALLBACK Callback);
+#define CAN_IsCurrentSensorEcPresent_StubWithCallback CAN_IsCurrentSensorEcPresent_Stub
+#define CAN_IsCurrentSensorEcPresent_ExpectAndThrow(stringNumber, cmock_to_throw) CAN_IsCurrentSensorEcPresent_CMockExpectAndThrow(__LINE__, stringNumber, cmock_to_throw)
+void CAN_IsCurrentSensorEcPresent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define CAN_IsCurrentSensorEcPresent_IgnoreArg_stringNumber() CAN_IsCurrentSensorEcPresent_CMockIgnoreArg_stringNumber(__LINE__)
+void CAN_IsCurrentSensorEcPresent_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_GetCANState_IgnoreAndReturn(cmock_retval) TEST_CAN_GetCANState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_GetCANState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CAN_STATE_s* cmock_to_return);
+#define TEST_CAN_GetCANState_StopIgnore() TEST_CAN_GetCANState_CMockStopIgnore()
+void TEST_CAN_GetCANState_CMockStopIgnore(void);
+#define TEST_CAN_GetCANState_ExpectAndReturn(cmock_retval) TEST_CAN_GetCANState_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_GetCANState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, CAN_STATE_s* cmock_to_return);
+typedef CAN_STATE_s* (* CMOCK_TEST_CAN_GetCANState_CALLBACK)(int cmock_num_calls);
+void TEST_CAN_GetCANState_AddCallback(CMOCK_TEST_CAN_GetCANState_CALLBACK Callback);
+void TEST_CAN_GetCANState_Stub(CMOCK_TEST_CAN_GetCANState_CALLBACK Callback);
+#define TEST_CAN_GetCANState_StubWithCallback TEST_CAN_GetCANState_Stub
+#define TEST_CAN_GetCANState_ExpectAndThrow(cmock_to_throw) TEST_CAN_GetCANState_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_CAN_GetCANState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_GetRxBuffer_IgnoreAndReturn(cmock_retval) TEST_CAN_GetRxBuffer_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_GetRxBuffer_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CAN_RX_BUFFER_s* cmock_to_return);
+#define TEST_CAN_GetRxBuffer_StopIgnore() TEST_CAN_GetRxBuffer_CMockStopIgnore()
+void TEST_CAN_GetRxBuffer_CMockStopIgnore(void);
+#define TEST_CAN_GetRxBuffer_ExpectAndReturn(cmock_retval) TEST_CAN_GetRxBuffer_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_GetRxBuffer_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, CAN_RX_BUFFER_s* cmock_to_return);
+typedef CAN_RX_BUFFER_s* (* CMOCK_TEST_CAN_GetRxBuffer_CALLBACK)(int cmock_num_calls);
+void TEST_CAN_GetRxBuffer_AddCallback(CMOCK_TEST_CAN_GetRxBuffer_CALLBACK Callback);
+void TEST_CAN_GetRxBuffer_Stub(CMOCK_TEST_CAN_GetRxBuffer_CALLBACK Callback);
+#define TEST_CAN_GetRxBuffer_StubWithCallback TEST_CAN_GetRxBuffer_Stub
+#define TEST_CAN_GetRxBuffer_ExpectAndThrow(cmock_to_throw) TEST_CAN_GetRxBuffer_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_CAN_GetRxBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_GetRxDispatchTable_IgnoreAndReturn(cmock_retval) TEST_CAN_GetRxDispatchTable_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_GetRxDispatchTable_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CAN_RX_DISPATCH_TABLE_s* cmock_to_return);
+#define TEST_CAN_GetRxDispatchTable_StopIgnore() TEST_CAN_GetRxDispatchTable_CMockStopIgnore()
+void TEST_CAN_GetRxDispatchTable_CMockStopIgnore(void);
+#define TEST_CAN_GetRxDispatchTable_ExpectAndReturn(cmock_retval) TEST_CAN_GetRxDispatchTable_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_GetRxDispatchTable_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, CAN_RX_DISPATCH_TABLE_s* cmock_to_return);
+typedef CAN_RX_DISPATCH_TABLE_s* (* CMOCK_TEST_CAN_GetRxDispatchTable_CALLBACK)(int cmock_num_calls);
+void TEST_CAN_GetRxDispatchTable_AddCallback(CMOCK_TEST_CAN_GetRxDispatchTable_CALLBACK Callback);
+void TEST_CAN_GetRxDispatchTable_Stub(CMOCK_TEST_CAN_GetRxDispatchTable_CALLBACK Callback);
+#define TEST_CAN_GetRxDispatchTable_StubWithCallback TEST_CAN_GetRxDispatchTable_Stub
+#define TEST_CAN_GetRxDispatchTable_ExpectAndThrow(cmock_to_throw) TEST_CAN_GetRxDispatchTable_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_CAN_GetRxDispatchTable_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_GetWorstCaseFrameBits_IgnoreAndReturn(cmock_retval) TEST_CAN_GetWorstCaseFrameBits_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_GetWorstCaseFrameBits_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_GetWorstCaseFrameBits_StopIgnore() TEST_CAN_GetWorstCaseFrameBits_CMockStopIgnore()
+void TEST_CAN_GetWorstCaseFrameBits_CMockStopIgnore(void);
+#define TEST_CAN_GetWorstCaseFrameBits_ExpectAndReturn(dlc, cmock_retval) TEST_CAN_GetWorstCaseFrameBits_CMockExpectAndReturn(__LINE__, dlc, cmock_retval)
+void TEST_CAN_GetWorstCaseFrameBits_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t dlc, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALLBACK)(uint8_t dlc, int cmock_num_calls);
+void TEST_CAN_GetWorstCaseFrameBits_AddCallback(CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALLBACK Callback);
+void TEST_CAN_GetWorstCaseFrameBits_Stub(CMOCK_TEST_CAN_GetWorstCaseFrameBits_CALLBACK Callback);
+#define TEST_CAN_GetWorstCaseFrameBits_StubWithCallback TEST_CAN_GetWorstCaseFrameBits_Stub
+#define TEST_CAN_GetWorstCaseFrameBits_ExpectAndThrow(dlc, cmock_to_throw) TEST_CAN_GetWorstCaseFrameBits_CMockExpectAndThrow(__LINE__, dlc, cmock_to_throw)
+void TEST_CAN_GetWorstCaseFrameBits_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t dlc, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_GetWorstCaseFrameBits_IgnoreArg_dlc() TEST_CAN_GetWorstCaseFrameBits_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_GetWorstCaseFrameBits_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_StoreRxMessage_IgnoreAndReturn(cmock_retval) TEST_CAN_StoreRxMessage_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_StoreRxMessage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define TEST_CAN_StoreRxMessage_StopIgnore() TEST_CAN_StoreRxMessage_CMockStopIgnore()
+void TEST_CAN_StoreRxMessage_CMockStopIgnore(void);
+#define TEST_CAN_StoreRxMessage_ExpectAndReturn(id, pData, cmock_retval) TEST_CAN_StoreRxMessage_CMockExpectAndReturn(__LINE__, id, pData, cmock_retval)
+void TEST_CAN_StoreRxMessage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, const uint8_t* pData, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_TEST_CAN_StoreRxMessage_CALLBACK)(uint32_t id, const uint8_t* pData, int cmock_num_calls);
+void TEST_CAN_StoreRxMessage_AddCallback(CMOCK_TEST_CAN_StoreRxMessage_CALLBACK Callback);
+void TEST_CAN_StoreRxMessage_Stub(CMOCK_TEST_CAN_StoreRxMessage_CALLBACK Callback);
+#define TEST_CAN_StoreRxMessage_StubWithCallback TEST_CAN_StoreRxMessage_Stub
+#define TEST_CAN_StoreRxMessage_ExpectAndThrow(id, pData, cmock_to_throw) TEST_CAN_StoreRxMessage_CMockExpectAndThrow(__LINE__, id, pData, cmock_to_throw)
+void TEST_CAN_StoreRxMessage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, const uint8_t* pData, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_StoreRxMessage_IgnoreArg_id() TEST_CAN_StoreRxMessage_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_StoreRxMessage_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_StoreRxMessage_IgnoreArg_pData() TEST_CAN_StoreRxMessage_CMockIgnoreArg_pData(__LINE__)
+void TEST_CAN_StoreRxMessage_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_UpdateRxStatistics_Ignore() TEST_CAN_UpdateRxStatistics_CMockIgnore()
+void TEST_CAN_UpdateRxStatistics_CMockIgnore(void);
+#define TEST_CAN_UpdateRxStatistics_StopIgnore() TEST_CAN_UpdateRxStatistics_CMockStopIgnore()
+void TEST_CAN_UpdateRxStatistics_CMockStopIgnore(void);
+#define TEST_CAN_UpdateRxStatistics_Expect() TEST_CAN_UpdateRxStatistics_CMockExpect(__LINE__)
+void TEST_CAN_UpdateRxStatistics_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_TEST_CAN_UpdateRxStatistics_CALLBACK)(int cmock_num_calls);
+void TEST_CAN_UpdateRxStatistics_AddCallback(CMOCK_TEST_CAN_UpdateRxStatistics_CALLBACK Callback);
+void TEST_CAN_UpdateRxStatistics_Stub(CMOCK_TEST_CAN_UpdateRxStatistics_CALLBACK Callback);
+#define TEST_CAN_UpdateRxStatistics_StubWithCallback TEST_CAN_UpdateRxStatistics_Stub
+#define TEST_CAN_UpdateRxStatistics_ExpectAndThrow(cmock_to_throw) TEST_CAN_UpdateRxStatistics_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_CAN_UpdateRxStatistics_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
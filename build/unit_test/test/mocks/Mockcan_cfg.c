@@ -0,0 +1,3353 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockcan_cfg.h"
+
+static const char* CMockString_TEST_CAN_GetCellvoltageTab = "TEST_CAN_GetCellvoltageTab";
+static const char* CMockString_TEST_CAN_RxCurrentSensor = "TEST_CAN_RxCurrentSensor";
+static const char* CMockString_TEST_CAN_RxDebug = "TEST_CAN_RxDebug";
+static const char* CMockString_TEST_CAN_RxRequest = "TEST_CAN_RxRequest";
+static const char* CMockString_TEST_CAN_RxSwReset = "TEST_CAN_RxSwReset";
+static const char* CMockString_TEST_CAN_RxSwVersion = "TEST_CAN_RxSwVersion";
+static const char* CMockString_TEST_CAN_TxAlgorithmStatistics = "TEST_CAN_TxAlgorithmStatistics";
+static const char* CMockString_TEST_CAN_TxExternalTemperature = "TEST_CAN_TxExternalTemperature";
+static const char* CMockString_TEST_CAN_TxPcbTemperature = "TEST_CAN_TxPcbTemperature";
+static const char* CMockString_TEST_CAN_TxProfilingHistogram = "TEST_CAN_TxProfilingHistogram";
+static const char* CMockString_TEST_CAN_TxProfilingTimes = "TEST_CAN_TxProfilingTimes";
+static const char* CMockString_TEST_CAN_TxVoltage = "TEST_CAN_TxVoltage";
+static const char* CMockString_TEST_CAN_TxVoltageMinMax = "TEST_CAN_TxVoltageMinMax";
+static const char* CMockString_byteOrder = "byteOrder";
+static const char* CMockString_dlc = "dlc";
+static const char* CMockString_id = "id";
+static const char* CMockString_pCanData = "pCanData";
+static const char* CMockString_pMuxId = "pMuxId";
+
+typedef struct _CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  DATA_BLOCK_CELL_VOLTAGE_s* ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_id;
+  uint8_t Expected_dlc;
+  CAN_byteOrder_e Expected_byteOrder;
+  uint8_t* Expected_pCanData;
+  uint32_t* Expected_pMuxId;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCanData_Used;
+  uint8_t* ReturnThruPtr_pCanData_Val;
+  size_t ReturnThruPtr_pCanData_Size;
+  char ReturnThruPtr_pMuxId_Used;
+  uint32_t* ReturnThruPtr_pMuxId_Val;
+  size_t ReturnThruPtr_pMuxId_Size;
+  char IgnoreArg_id;
+  char IgnoreArg_dlc;
+  char IgnoreArg_byteOrder;
+  char IgnoreArg_pCanData;
+  char IgnoreArg_pMuxId;
+
+} CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE;
+
+static struct Mockcan_cfgInstance
+{
+  char TEST_CAN_GetCellvoltageTab_IgnoreBool;
+  DATA_BLOCK_CELL_VOLTAGE_s* TEST_CAN_GetCellvoltageTab_FinalReturn;
+  char TEST_CAN_GetCellvoltageTab_CallbackBool;
+  CMOCK_TEST_CAN_GetCellvoltageTab_CALLBACK TEST_CAN_GetCellvoltageTab_CallbackFunctionPointer;
+  int TEST_CAN_GetCellvoltageTab_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_GetCellvoltageTab_CallInstance;
+  char TEST_CAN_TxVoltage_IgnoreBool;
+  uint32_t TEST_CAN_TxVoltage_FinalReturn;
+  char TEST_CAN_TxVoltage_CallbackBool;
+  CMOCK_TEST_CAN_TxVoltage_CALLBACK TEST_CAN_TxVoltage_CallbackFunctionPointer;
+  int TEST_CAN_TxVoltage_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_TxVoltage_CallInstance;
+  char TEST_CAN_TxPcbTemperature_IgnoreBool;
+  uint32_t TEST_CAN_TxPcbTemperature_FinalReturn;
+  char TEST_CAN_TxPcbTemperature_CallbackBool;
+  CMOCK_TEST_CAN_TxPcbTemperature_CALLBACK TEST_CAN_TxPcbTemperature_CallbackFunctionPointer;
+  int TEST_CAN_TxPcbTemperature_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_TxPcbTemperature_CallInstance;
+  char TEST_CAN_TxExternalTemperature_IgnoreBool;
+  uint32_t TEST_CAN_TxExternalTemperature_FinalReturn;
+  char TEST_CAN_TxExternalTemperature_CallbackBool;
+  CMOCK_TEST_CAN_TxExternalTemperature_CALLBACK TEST_CAN_TxExternalTemperature_CallbackFunctionPointer;
+  int TEST_CAN_TxExternalTemperature_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_TxExternalTemperature_CallInstance;
+  char TEST_CAN_TxVoltageMinMax_IgnoreBool;
+  uint32_t TEST_CAN_TxVoltageMinMax_FinalReturn;
+  char TEST_CAN_TxVoltageMinMax_CallbackBool;
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALLBACK TEST_CAN_TxVoltageMinMax_CallbackFunctionPointer;
+  int TEST_CAN_TxVoltageMinMax_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_TxVoltageMinMax_CallInstance;
+  char TEST_CAN_TxAlgorithmStatistics_IgnoreBool;
+  uint32_t TEST_CAN_TxAlgorithmStatistics_FinalReturn;
+  char TEST_CAN_TxAlgorithmStatistics_CallbackBool;
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALLBACK TEST_CAN_TxAlgorithmStatistics_CallbackFunctionPointer;
+  int TEST_CAN_TxAlgorithmStatistics_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_TxAlgorithmStatistics_CallInstance;
+  char TEST_CAN_TxProfilingTimes_IgnoreBool;
+  uint32_t TEST_CAN_TxProfilingTimes_FinalReturn;
+  char TEST_CAN_TxProfilingTimes_CallbackBool;
+  CMOCK_TEST_CAN_TxProfilingTimes_CALLBACK TEST_CAN_TxProfilingTimes_CallbackFunctionPointer;
+  int TEST_CAN_TxProfilingTimes_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_TxProfilingTimes_CallInstance;
+  char TEST_CAN_TxProfilingHistogram_IgnoreBool;
+  uint32_t TEST_CAN_TxProfilingHistogram_FinalReturn;
+  char TEST_CAN_TxProfilingHistogram_CallbackBool;
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALLBACK TEST_CAN_TxProfilingHistogram_CallbackFunctionPointer;
+  int TEST_CAN_TxProfilingHistogram_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_TxProfilingHistogram_CallInstance;
+  char TEST_CAN_RxRequest_IgnoreBool;
+  uint32_t TEST_CAN_RxRequest_FinalReturn;
+  char TEST_CAN_RxRequest_CallbackBool;
+  CMOCK_TEST_CAN_RxRequest_CALLBACK TEST_CAN_RxRequest_CallbackFunctionPointer;
+  int TEST_CAN_RxRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_RxRequest_CallInstance;
+  char TEST_CAN_RxSwReset_IgnoreBool;
+  uint32_t TEST_CAN_RxSwReset_FinalReturn;
+  char TEST_CAN_RxSwReset_CallbackBool;
+  CMOCK_TEST_CAN_RxSwReset_CALLBACK TEST_CAN_RxSwReset_CallbackFunctionPointer;
+  int TEST_CAN_RxSwReset_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_RxSwReset_CallInstance;
+  char TEST_CAN_RxCurrentSensor_IgnoreBool;
+  uint32_t TEST_CAN_RxCurrentSensor_FinalReturn;
+  char TEST_CAN_RxCurrentSensor_CallbackBool;
+  CMOCK_TEST_CAN_RxCurrentSensor_CALLBACK TEST_CAN_RxCurrentSensor_CallbackFunctionPointer;
+  int TEST_CAN_RxCurrentSensor_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_RxCurrentSensor_CallInstance;
+  char TEST_CAN_RxDebug_IgnoreBool;
+  uint32_t TEST_CAN_RxDebug_FinalReturn;
+  char TEST_CAN_RxDebug_CallbackBool;
+  CMOCK_TEST_CAN_RxDebug_CALLBACK TEST_CAN_RxDebug_CallbackFunctionPointer;
+  int TEST_CAN_RxDebug_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_RxDebug_CallInstance;
+  char TEST_CAN_RxSwVersion_IgnoreBool;
+  uint32_t TEST_CAN_RxSwVersion_FinalReturn;
+  char TEST_CAN_RxSwVersion_CallbackBool;
+  CMOCK_TEST_CAN_RxSwVersion_CALLBACK TEST_CAN_RxSwVersion_CallbackFunctionPointer;
+  int TEST_CAN_RxSwVersion_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CAN_RxSwVersion_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockcan_cfg_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.TEST_CAN_GetCellvoltageTab_CallInstance;
+  if (Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_GetCellvoltageTab);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_GetCellvoltageTab_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_TxVoltage_CallInstance;
+  if (Mock.TEST_CAN_TxVoltage_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_TxVoltage);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_TxVoltage_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_TxPcbTemperature_CallInstance;
+  if (Mock.TEST_CAN_TxPcbTemperature_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_TxPcbTemperature);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_TxPcbTemperature_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_TxExternalTemperature_CallInstance;
+  if (Mock.TEST_CAN_TxExternalTemperature_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_TxExternalTemperature);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_TxExternalTemperature_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_TxVoltageMinMax_CallInstance;
+  if (Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_TxVoltageMinMax);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_TxVoltageMinMax_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance;
+  if (Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_TxAlgorithmStatistics);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_TxAlgorithmStatistics_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_TxProfilingTimes_CallInstance;
+  if (Mock.TEST_CAN_TxProfilingTimes_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_TxProfilingTimes);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_TxProfilingTimes_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_TxProfilingHistogram_CallInstance;
+  if (Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_TxProfilingHistogram);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_TxProfilingHistogram_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_RxRequest_CallInstance;
+  if (Mock.TEST_CAN_RxRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_RxRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_RxRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_RxSwReset_CallInstance;
+  if (Mock.TEST_CAN_RxSwReset_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_RxSwReset);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_RxSwReset_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_RxCurrentSensor_CallInstance;
+  if (Mock.TEST_CAN_RxCurrentSensor_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_RxCurrentSensor);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_RxCurrentSensor_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_RxDebug_CallInstance;
+  if (Mock.TEST_CAN_RxDebug_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_RxDebug);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_RxDebug_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CAN_RxSwVersion_CallInstance;
+  if (Mock.TEST_CAN_RxSwVersion_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CAN_RxSwVersion);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CAN_RxSwVersion_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockcan_cfg_Init(void)
+{
+  Mockcan_cfg_Destroy();
+}
+
+void Mockcan_cfg_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+DATA_BLOCK_CELL_VOLTAGE_s* TEST_CAN_GetCellvoltageTab(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_GetCellvoltageTab);
+  cmock_call_instance = (CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_GetCellvoltageTab_CallInstance);
+  Mock.TEST_CAN_GetCellvoltageTab_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetCellvoltageTab_CallInstance);
+  if (Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_GetCellvoltageTab_FinalReturn;
+    Mock.TEST_CAN_GetCellvoltageTab_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_GetCellvoltageTab_CallbackBool &&
+      Mock.TEST_CAN_GetCellvoltageTab_CallbackFunctionPointer != NULL)
+  {
+    DATA_BLOCK_CELL_VOLTAGE_s* cmock_cb_ret = Mock.TEST_CAN_GetCellvoltageTab_CallbackFunctionPointer(Mock.TEST_CAN_GetCellvoltageTab_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_CAN_GetCellvoltageTab_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_GetCellvoltageTab_CallbackFunctionPointer(Mock.TEST_CAN_GetCellvoltageTab_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TEST_CAN_GetCellvoltageTab_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetCellvoltageTab_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetCellvoltageTab_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_GetCellvoltageTab_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool)
+    Mock.TEST_CAN_GetCellvoltageTab_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_GetCellvoltageTab_CallInstance);
+  Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_GetCellvoltageTab_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetCellvoltageTab_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetCellvoltageTab_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_GetCellvoltageTab_AddCallback(CMOCK_TEST_CAN_GetCellvoltageTab_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetCellvoltageTab_CallbackBool = (char)1;
+  Mock.TEST_CAN_GetCellvoltageTab_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetCellvoltageTab_Stub(CMOCK_TEST_CAN_GetCellvoltageTab_CALLBACK Callback)
+{
+  Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool = (char)0;
+  Mock.TEST_CAN_GetCellvoltageTab_CallbackBool = (char)0;
+  Mock.TEST_CAN_GetCellvoltageTab_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_GetCellvoltageTab_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE));
+  CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_GetCellvoltageTab_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_GetCellvoltageTab_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_GetCellvoltageTab_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_GetCellvoltageTab_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint32_t TEST_CAN_TxVoltage(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_TxVoltage);
+  cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_TxVoltage_CallInstance);
+  Mock.TEST_CAN_TxVoltage_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxVoltage_CallInstance);
+  if (Mock.TEST_CAN_TxVoltage_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_TxVoltage_FinalReturn;
+    Mock.TEST_CAN_TxVoltage_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_TxVoltage_CallbackBool &&
+      Mock.TEST_CAN_TxVoltage_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_TxVoltage_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxVoltage_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltage,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltage,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltage,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltage,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltage,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_TxVoltage_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_TxVoltage_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxVoltage_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_TxVoltage(CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_TxVoltage(CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_TxVoltage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxVoltage_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxVoltage_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxVoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_TxVoltage_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_TxVoltage_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_TxVoltage_IgnoreBool)
+    Mock.TEST_CAN_TxVoltage_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxVoltage_CallInstance);
+  Mock.TEST_CAN_TxVoltage_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_TxVoltage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxVoltage_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxVoltage_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxVoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxVoltage(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_TxVoltage_AddCallback(CMOCK_TEST_CAN_TxVoltage_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxVoltage_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxVoltage_CallbackBool = (char)1;
+  Mock.TEST_CAN_TxVoltage_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxVoltage_Stub(CMOCK_TEST_CAN_TxVoltage_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxVoltage_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxVoltage_CallbackBool = (char)0;
+  Mock.TEST_CAN_TxVoltage_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxVoltage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxVoltage_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxVoltage_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxVoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxVoltage(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_TxVoltage_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_TxVoltage_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_TxVoltage_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_TxVoltage_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_TxVoltage_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_TxPcbTemperature(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_TxPcbTemperature);
+  cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_TxPcbTemperature_CallInstance);
+  Mock.TEST_CAN_TxPcbTemperature_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxPcbTemperature_CallInstance);
+  if (Mock.TEST_CAN_TxPcbTemperature_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_TxPcbTemperature_FinalReturn;
+    Mock.TEST_CAN_TxPcbTemperature_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_TxPcbTemperature_CallbackBool &&
+      Mock.TEST_CAN_TxPcbTemperature_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_TxPcbTemperature_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxPcbTemperature_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxPcbTemperature,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxPcbTemperature,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxPcbTemperature,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxPcbTemperature,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxPcbTemperature,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_TxPcbTemperature_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_TxPcbTemperature_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxPcbTemperature_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_TxPcbTemperature(CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_TxPcbTemperature(CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxPcbTemperature_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxPcbTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_TxPcbTemperature_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_TxPcbTemperature_IgnoreBool)
+    Mock.TEST_CAN_TxPcbTemperature_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxPcbTemperature_CallInstance);
+  Mock.TEST_CAN_TxPcbTemperature_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxPcbTemperature_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxPcbTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxPcbTemperature(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_TxPcbTemperature_AddCallback(CMOCK_TEST_CAN_TxPcbTemperature_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxPcbTemperature_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxPcbTemperature_CallbackBool = (char)1;
+  Mock.TEST_CAN_TxPcbTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxPcbTemperature_Stub(CMOCK_TEST_CAN_TxPcbTemperature_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxPcbTemperature_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxPcbTemperature_CallbackBool = (char)0;
+  Mock.TEST_CAN_TxPcbTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxPcbTemperature_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxPcbTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxPcbTemperature(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxPcbTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxPcbTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_TxExternalTemperature(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_TxExternalTemperature);
+  cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_TxExternalTemperature_CallInstance);
+  Mock.TEST_CAN_TxExternalTemperature_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxExternalTemperature_CallInstance);
+  if (Mock.TEST_CAN_TxExternalTemperature_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_TxExternalTemperature_FinalReturn;
+    Mock.TEST_CAN_TxExternalTemperature_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_TxExternalTemperature_CallbackBool &&
+      Mock.TEST_CAN_TxExternalTemperature_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_TxExternalTemperature_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxExternalTemperature_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxExternalTemperature,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxExternalTemperature,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxExternalTemperature,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxExternalTemperature,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxExternalTemperature,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_TxExternalTemperature_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_TxExternalTemperature_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxExternalTemperature_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_TxExternalTemperature(CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_TxExternalTemperature(CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxExternalTemperature_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxExternalTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_TxExternalTemperature_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_TxExternalTemperature_IgnoreBool)
+    Mock.TEST_CAN_TxExternalTemperature_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxExternalTemperature_CallInstance);
+  Mock.TEST_CAN_TxExternalTemperature_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxExternalTemperature_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxExternalTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxExternalTemperature(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_TxExternalTemperature_AddCallback(CMOCK_TEST_CAN_TxExternalTemperature_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxExternalTemperature_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxExternalTemperature_CallbackBool = (char)1;
+  Mock.TEST_CAN_TxExternalTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxExternalTemperature_Stub(CMOCK_TEST_CAN_TxExternalTemperature_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxExternalTemperature_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxExternalTemperature_CallbackBool = (char)0;
+  Mock.TEST_CAN_TxExternalTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxExternalTemperature_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxExternalTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxExternalTemperature(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxExternalTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxExternalTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_TxVoltageMinMax(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_TxVoltageMinMax);
+  cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_TxVoltageMinMax_CallInstance);
+  Mock.TEST_CAN_TxVoltageMinMax_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxVoltageMinMax_CallInstance);
+  if (Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_TxVoltageMinMax_FinalReturn;
+    Mock.TEST_CAN_TxVoltageMinMax_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_TxVoltageMinMax_CallbackBool &&
+      Mock.TEST_CAN_TxVoltageMinMax_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_TxVoltageMinMax_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxVoltageMinMax_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltageMinMax,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltageMinMax,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltageMinMax,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltageMinMax,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxVoltageMinMax,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_TxVoltageMinMax_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_TxVoltageMinMax_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxVoltageMinMax_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_TxVoltageMinMax(CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_TxVoltageMinMax(CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxVoltageMinMax_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool)
+    Mock.TEST_CAN_TxVoltageMinMax_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxVoltageMinMax_CallInstance);
+  Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxVoltageMinMax_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxVoltageMinMax(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_TxVoltageMinMax_AddCallback(CMOCK_TEST_CAN_TxVoltageMinMax_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxVoltageMinMax_CallbackBool = (char)1;
+  Mock.TEST_CAN_TxVoltageMinMax_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxVoltageMinMax_Stub(CMOCK_TEST_CAN_TxVoltageMinMax_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxVoltageMinMax_CallbackBool = (char)0;
+  Mock.TEST_CAN_TxVoltageMinMax_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxVoltageMinMax_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxVoltageMinMax_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxVoltageMinMax(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxVoltageMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxVoltageMinMax_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_TxAlgorithmStatistics(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_TxAlgorithmStatistics);
+  cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance);
+  Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance);
+  if (Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_TxAlgorithmStatistics_FinalReturn;
+    Mock.TEST_CAN_TxAlgorithmStatistics_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_TxAlgorithmStatistics_CallbackBool &&
+      Mock.TEST_CAN_TxAlgorithmStatistics_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_TxAlgorithmStatistics_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxAlgorithmStatistics_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxAlgorithmStatistics,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxAlgorithmStatistics,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxAlgorithmStatistics,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxAlgorithmStatistics,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxAlgorithmStatistics,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_TxAlgorithmStatistics_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_TxAlgorithmStatistics_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxAlgorithmStatistics_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_TxAlgorithmStatistics(CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_TxAlgorithmStatistics(CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool)
+    Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance);
+  Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxAlgorithmStatistics(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_AddCallback(CMOCK_TEST_CAN_TxAlgorithmStatistics_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxAlgorithmStatistics_CallbackBool = (char)1;
+  Mock.TEST_CAN_TxAlgorithmStatistics_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_Stub(CMOCK_TEST_CAN_TxAlgorithmStatistics_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxAlgorithmStatistics_CallbackBool = (char)0;
+  Mock.TEST_CAN_TxAlgorithmStatistics_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxAlgorithmStatistics_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxAlgorithmStatistics(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxAlgorithmStatistics_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxAlgorithmStatistics_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_TxProfilingTimes(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_TxProfilingTimes);
+  cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_TxProfilingTimes_CallInstance);
+  Mock.TEST_CAN_TxProfilingTimes_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxProfilingTimes_CallInstance);
+  if (Mock.TEST_CAN_TxProfilingTimes_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_TxProfilingTimes_FinalReturn;
+    Mock.TEST_CAN_TxProfilingTimes_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_TxProfilingTimes_CallbackBool &&
+      Mock.TEST_CAN_TxProfilingTimes_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_TxProfilingTimes_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxProfilingTimes_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingTimes,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingTimes,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingTimes,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingTimes,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingTimes,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_TxProfilingTimes_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_TxProfilingTimes_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxProfilingTimes_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_TxProfilingTimes(CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_TxProfilingTimes(CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxProfilingTimes_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxProfilingTimes_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_TxProfilingTimes_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_TxProfilingTimes_IgnoreBool)
+    Mock.TEST_CAN_TxProfilingTimes_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxProfilingTimes_CallInstance);
+  Mock.TEST_CAN_TxProfilingTimes_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxProfilingTimes_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxProfilingTimes_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxProfilingTimes(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_TxProfilingTimes_AddCallback(CMOCK_TEST_CAN_TxProfilingTimes_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxProfilingTimes_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxProfilingTimes_CallbackBool = (char)1;
+  Mock.TEST_CAN_TxProfilingTimes_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxProfilingTimes_Stub(CMOCK_TEST_CAN_TxProfilingTimes_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxProfilingTimes_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxProfilingTimes_CallbackBool = (char)0;
+  Mock.TEST_CAN_TxProfilingTimes_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxProfilingTimes_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxProfilingTimes_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxProfilingTimes(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingTimes_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingTimes_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_TxProfilingHistogram(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_TxProfilingHistogram);
+  cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_TxProfilingHistogram_CallInstance);
+  Mock.TEST_CAN_TxProfilingHistogram_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxProfilingHistogram_CallInstance);
+  if (Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_TxProfilingHistogram_FinalReturn;
+    Mock.TEST_CAN_TxProfilingHistogram_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_TxProfilingHistogram_CallbackBool &&
+      Mock.TEST_CAN_TxProfilingHistogram_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_TxProfilingHistogram_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxProfilingHistogram_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingHistogram,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingHistogram,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingHistogram,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingHistogram,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_TxProfilingHistogram,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_TxProfilingHistogram_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_TxProfilingHistogram_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_TxProfilingHistogram_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_TxProfilingHistogram(CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_TxProfilingHistogram(CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxProfilingHistogram_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool)
+    Mock.TEST_CAN_TxProfilingHistogram_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_TxProfilingHistogram_CallInstance);
+  Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxProfilingHistogram_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxProfilingHistogram(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_TxProfilingHistogram_AddCallback(CMOCK_TEST_CAN_TxProfilingHistogram_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxProfilingHistogram_CallbackBool = (char)1;
+  Mock.TEST_CAN_TxProfilingHistogram_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxProfilingHistogram_Stub(CMOCK_TEST_CAN_TxProfilingHistogram_CALLBACK Callback)
+{
+  Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool = (char)0;
+  Mock.TEST_CAN_TxProfilingHistogram_CallbackBool = (char)0;
+  Mock.TEST_CAN_TxProfilingHistogram_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE));
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_TxProfilingHistogram_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_TxProfilingHistogram_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_TxProfilingHistogram(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_TxProfilingHistogram_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_TxProfilingHistogram_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_RxRequest(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_RxRequest);
+  cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_RxRequest_CallInstance);
+  Mock.TEST_CAN_RxRequest_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxRequest_CallInstance);
+  if (Mock.TEST_CAN_RxRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_RxRequest_FinalReturn;
+    Mock.TEST_CAN_RxRequest_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_RxRequest_CallbackBool &&
+      Mock.TEST_CAN_RxRequest_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_RxRequest_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxRequest,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxRequest,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxRequest,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxRequest,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxRequest,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_RxRequest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_RxRequest_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_RxRequest(CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_RxRequest(CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_RxRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_RxRequest_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_RxRequest_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_RxRequest_IgnoreBool)
+    Mock.TEST_CAN_RxRequest_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxRequest_CallInstance);
+  Mock.TEST_CAN_RxRequest_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_RxRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxRequest(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_RxRequest_AddCallback(CMOCK_TEST_CAN_RxRequest_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxRequest_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxRequest_CallbackBool = (char)1;
+  Mock.TEST_CAN_RxRequest_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxRequest_Stub(CMOCK_TEST_CAN_RxRequest_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxRequest_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxRequest_CallbackBool = (char)0;
+  Mock.TEST_CAN_RxRequest_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxRequest_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxRequest_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxRequest(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_RxRequest_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_RxRequest_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_RxRequest_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_RxRequest_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_RxRequest_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_RxRequest_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_RxRequest_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_RxSwReset(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_RxSwReset);
+  cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_RxSwReset_CallInstance);
+  Mock.TEST_CAN_RxSwReset_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxSwReset_CallInstance);
+  if (Mock.TEST_CAN_RxSwReset_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_RxSwReset_FinalReturn;
+    Mock.TEST_CAN_RxSwReset_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_RxSwReset_CallbackBool &&
+      Mock.TEST_CAN_RxSwReset_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_RxSwReset_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxSwReset_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwReset,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwReset,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwReset,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwReset,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwReset,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_RxSwReset_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_RxSwReset_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxSwReset_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_RxSwReset(CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_RxSwReset(CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_RxSwReset_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxSwReset_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxSwReset_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxSwReset_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_RxSwReset_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_RxSwReset_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_RxSwReset_IgnoreBool)
+    Mock.TEST_CAN_RxSwReset_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxSwReset_CallInstance);
+  Mock.TEST_CAN_RxSwReset_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_RxSwReset_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxSwReset_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxSwReset_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxSwReset_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxSwReset(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_RxSwReset_AddCallback(CMOCK_TEST_CAN_RxSwReset_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxSwReset_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxSwReset_CallbackBool = (char)1;
+  Mock.TEST_CAN_RxSwReset_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxSwReset_Stub(CMOCK_TEST_CAN_RxSwReset_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxSwReset_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxSwReset_CallbackBool = (char)0;
+  Mock.TEST_CAN_RxSwReset_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxSwReset_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxSwReset_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxSwReset_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxSwReset_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxSwReset(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_RxSwReset_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_RxSwReset_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_RxSwReset_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_RxSwReset_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_RxSwReset_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_RxCurrentSensor(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_RxCurrentSensor);
+  cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_RxCurrentSensor_CallInstance);
+  Mock.TEST_CAN_RxCurrentSensor_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxCurrentSensor_CallInstance);
+  if (Mock.TEST_CAN_RxCurrentSensor_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_RxCurrentSensor_FinalReturn;
+    Mock.TEST_CAN_RxCurrentSensor_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_RxCurrentSensor_CallbackBool &&
+      Mock.TEST_CAN_RxCurrentSensor_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_RxCurrentSensor_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxCurrentSensor_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxCurrentSensor,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxCurrentSensor,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxCurrentSensor,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxCurrentSensor,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxCurrentSensor,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_RxCurrentSensor_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_RxCurrentSensor_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxCurrentSensor_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_RxCurrentSensor(CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_RxCurrentSensor(CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxCurrentSensor_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxCurrentSensor_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_RxCurrentSensor_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_RxCurrentSensor_IgnoreBool)
+    Mock.TEST_CAN_RxCurrentSensor_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxCurrentSensor_CallInstance);
+  Mock.TEST_CAN_RxCurrentSensor_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxCurrentSensor_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxCurrentSensor_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxCurrentSensor(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_RxCurrentSensor_AddCallback(CMOCK_TEST_CAN_RxCurrentSensor_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxCurrentSensor_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxCurrentSensor_CallbackBool = (char)1;
+  Mock.TEST_CAN_RxCurrentSensor_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxCurrentSensor_Stub(CMOCK_TEST_CAN_RxCurrentSensor_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxCurrentSensor_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxCurrentSensor_CallbackBool = (char)0;
+  Mock.TEST_CAN_RxCurrentSensor_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxCurrentSensor_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxCurrentSensor_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxCurrentSensor(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxCurrentSensor_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxCurrentSensor_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_RxDebug(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_RxDebug);
+  cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_RxDebug_CallInstance);
+  Mock.TEST_CAN_RxDebug_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxDebug_CallInstance);
+  if (Mock.TEST_CAN_RxDebug_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_RxDebug_FinalReturn;
+    Mock.TEST_CAN_RxDebug_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_RxDebug_CallbackBool &&
+      Mock.TEST_CAN_RxDebug_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_RxDebug_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxDebug_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxDebug,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxDebug,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxDebug,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxDebug,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxDebug,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_RxDebug_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_RxDebug_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxDebug_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_RxDebug(CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_RxDebug(CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_RxDebug_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxDebug_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxDebug_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxDebug_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_RxDebug_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_RxDebug_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_RxDebug_IgnoreBool)
+    Mock.TEST_CAN_RxDebug_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxDebug_CallInstance);
+  Mock.TEST_CAN_RxDebug_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_RxDebug_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxDebug_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxDebug_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxDebug_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxDebug(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_RxDebug_AddCallback(CMOCK_TEST_CAN_RxDebug_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxDebug_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxDebug_CallbackBool = (char)1;
+  Mock.TEST_CAN_RxDebug_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxDebug_Stub(CMOCK_TEST_CAN_RxDebug_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxDebug_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxDebug_CallbackBool = (char)0;
+  Mock.TEST_CAN_RxDebug_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxDebug_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxDebug_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxDebug_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxDebug_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxDebug(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_RxDebug_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxDebug_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_RxDebug_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxDebug_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_RxDebug_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxDebug_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_RxDebug_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxDebug_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_RxDebug_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxDebug_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_RxDebug_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxDebug_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_RxDebug_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxDebug_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxDebug_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
+uint32_t TEST_CAN_RxSwVersion(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CAN_RxSwVersion);
+  cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CAN_RxSwVersion_CallInstance);
+  Mock.TEST_CAN_RxSwVersion_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxSwVersion_CallInstance);
+  if (Mock.TEST_CAN_RxSwVersion_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CAN_RxSwVersion_FinalReturn;
+    Mock.TEST_CAN_RxSwVersion_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CAN_RxSwVersion_CallbackBool &&
+      Mock.TEST_CAN_RxSwVersion_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_CAN_RxSwVersion_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxSwVersion_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_id)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwVersion,CMockString_id);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_id, id, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_dlc)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwVersion,CMockString_dlc);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_dlc, dlc, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_byteOrder)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwVersion,CMockString_byteOrder);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder), sizeof(CAN_byteOrder_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCanData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwVersion,CMockString_pCanData);
+    if (cmock_call_instance->Expected_pCanData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCanData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pCanData, pCanData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pMuxId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CAN_RxSwVersion,CMockString_pMuxId);
+    if (cmock_call_instance->Expected_pMuxId == NULL)
+      { UNITY_TEST_ASSERT_NULL(pMuxId, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pMuxId, pMuxId, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_CAN_RxSwVersion_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CAN_RxSwVersion_CallbackFunctionPointer(id, dlc, byteOrder, pCanData, pMuxId, Mock.TEST_CAN_RxSwVersion_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCanData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCanData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCanData, (void*)cmock_call_instance->ReturnThruPtr_pCanData_Val,
+      cmock_call_instance->ReturnThruPtr_pCanData_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMuxId_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMuxId, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMuxId, (void*)cmock_call_instance->ReturnThruPtr_pMuxId_Val,
+      cmock_call_instance->ReturnThruPtr_pMuxId_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CAN_RxSwVersion(CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId);
+void CMockExpectParameters_TEST_CAN_RxSwVersion(CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId)
+{
+  cmock_call_instance->Expected_id = id;
+  cmock_call_instance->IgnoreArg_id = 0;
+  cmock_call_instance->Expected_dlc = dlc;
+  cmock_call_instance->IgnoreArg_dlc = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_byteOrder), (void*)(&byteOrder),
+         sizeof(CAN_byteOrder_e[sizeof(byteOrder) == sizeof(CAN_byteOrder_e) ? 1 : -1])); /* add CAN_byteOrder_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_byteOrder = 0;
+  cmock_call_instance->Expected_pCanData = pCanData;
+  cmock_call_instance->IgnoreArg_pCanData = 0;
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 0;
+  cmock_call_instance->Expected_pMuxId = pMuxId;
+  cmock_call_instance->IgnoreArg_pMuxId = 0;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 0;
+}
+
+void TEST_CAN_RxSwVersion_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxSwVersion_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxSwVersion_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxSwVersion_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CAN_RxSwVersion_IgnoreBool = (char)1;
+}
+
+void TEST_CAN_RxSwVersion_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CAN_RxSwVersion_IgnoreBool)
+    Mock.TEST_CAN_RxSwVersion_CallInstance = CMock_Guts_MemNext(Mock.TEST_CAN_RxSwVersion_CallInstance);
+  Mock.TEST_CAN_RxSwVersion_IgnoreBool = (char)0;
+}
+
+void TEST_CAN_RxSwVersion_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxSwVersion_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxSwVersion_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxSwVersion_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxSwVersion(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_CAN_RxSwVersion_AddCallback(CMOCK_TEST_CAN_RxSwVersion_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxSwVersion_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxSwVersion_CallbackBool = (char)1;
+  Mock.TEST_CAN_RxSwVersion_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxSwVersion_Stub(CMOCK_TEST_CAN_RxSwVersion_CALLBACK Callback)
+{
+  Mock.TEST_CAN_RxSwVersion_IgnoreBool = (char)0;
+  Mock.TEST_CAN_RxSwVersion_CallbackBool = (char)0;
+  Mock.TEST_CAN_RxSwVersion_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CAN_RxSwVersion_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE));
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CAN_RxSwVersion_CallInstance = CMock_Guts_MemChain(Mock.TEST_CAN_RxSwVersion_CallInstance, cmock_guts_index);
+  Mock.TEST_CAN_RxSwVersion_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CAN_RxSwVersion(cmock_call_instance, id, dlc, byteOrder, pCanData, pMuxId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwVersion_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCanData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCanData_Val = pCanData;
+  cmock_call_instance->ReturnThruPtr_pCanData_Size = cmock_size;
+}
+
+void TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size)
+{
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwVersion_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMuxId_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Val = pMuxId;
+  cmock_call_instance->ReturnThruPtr_pMuxId_Size = cmock_size;
+}
+
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwVersion_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_id = 1;
+}
+
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwVersion_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_dlc = 1;
+}
+
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwVersion_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_byteOrder = 1;
+}
+
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwVersion_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCanData = 1;
+}
+
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CAN_RxSwVersion_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CAN_RxSwVersion_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMuxId = 1;
+}
+
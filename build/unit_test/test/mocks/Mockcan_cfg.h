@@ -0,0 +1,418 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKCAN_CFG_H
+#define _MOCKCAN_CFG_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "can_cfg.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockcan_cfg_Init(void);
+void Mockcan_cfg_Destroy(void);
+void Mockcan_cfg_Verify(void);
+
+
+
+
+#define TEST_CAN_GetCellvoltageTab_IgnoreAndReturn(cmock_retval) TEST_CAN_GetCellvoltageTab_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_GetCellvoltageTab_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* cmock_to_return);
+#define TEST_CAN_GetCellvoltageTab_StopIgnore() TEST_CAN_GetCellvoltageTab_CMockStopIgnore()
+void TEST_CAN_GetCellvoltageTab_CMockStopIgnore(void);
+#define TEST_CAN_GetCellvoltageTab_ExpectAndReturn(cmock_retval) TEST_CAN_GetCellvoltageTab_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_GetCellvoltageTab_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* cmock_to_return);
+typedef DATA_BLOCK_CELL_VOLTAGE_s* (* CMOCK_TEST_CAN_GetCellvoltageTab_CALLBACK)(int cmock_num_calls);
+void TEST_CAN_GetCellvoltageTab_AddCallback(CMOCK_TEST_CAN_GetCellvoltageTab_CALLBACK Callback);
+void TEST_CAN_GetCellvoltageTab_Stub(CMOCK_TEST_CAN_GetCellvoltageTab_CALLBACK Callback);
+#define TEST_CAN_GetCellvoltageTab_StubWithCallback TEST_CAN_GetCellvoltageTab_Stub
+#define TEST_CAN_GetCellvoltageTab_ExpectAndThrow(cmock_to_throw) TEST_CAN_GetCellvoltageTab_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_CAN_GetCellvoltageTab_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_TxVoltage_IgnoreAndReturn(cmock_retval) TEST_CAN_TxVoltage_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_TxVoltage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_TxVoltage_StopIgnore() TEST_CAN_TxVoltage_CMockStopIgnore()
+void TEST_CAN_TxVoltage_CMockStopIgnore(void);
+#define TEST_CAN_TxVoltage_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_TxVoltage_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_TxVoltage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_TxVoltage_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_TxVoltage_AddCallback(CMOCK_TEST_CAN_TxVoltage_CALLBACK Callback);
+void TEST_CAN_TxVoltage_Stub(CMOCK_TEST_CAN_TxVoltage_CALLBACK Callback);
+#define TEST_CAN_TxVoltage_StubWithCallback TEST_CAN_TxVoltage_Stub
+#define TEST_CAN_TxVoltage_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_TxVoltage_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_TxVoltage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_TxVoltage_ReturnThruPtr_pCanData(pCanData) TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_TxVoltage_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_TxVoltage_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_TxVoltage_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_TxVoltage_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_TxVoltage_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_TxVoltage_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_TxVoltage_IgnoreArg_id() TEST_CAN_TxVoltage_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_TxVoltage_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxVoltage_IgnoreArg_dlc() TEST_CAN_TxVoltage_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_TxVoltage_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxVoltage_IgnoreArg_byteOrder() TEST_CAN_TxVoltage_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_TxVoltage_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxVoltage_IgnoreArg_pCanData() TEST_CAN_TxVoltage_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_TxVoltage_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxVoltage_IgnoreArg_pMuxId() TEST_CAN_TxVoltage_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_TxVoltage_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxPcbTemperature_IgnoreAndReturn(cmock_retval) TEST_CAN_TxPcbTemperature_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_TxPcbTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_TxPcbTemperature_StopIgnore() TEST_CAN_TxPcbTemperature_CMockStopIgnore()
+void TEST_CAN_TxPcbTemperature_CMockStopIgnore(void);
+#define TEST_CAN_TxPcbTemperature_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_TxPcbTemperature_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_TxPcbTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_TxPcbTemperature_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_TxPcbTemperature_AddCallback(CMOCK_TEST_CAN_TxPcbTemperature_CALLBACK Callback);
+void TEST_CAN_TxPcbTemperature_Stub(CMOCK_TEST_CAN_TxPcbTemperature_CALLBACK Callback);
+#define TEST_CAN_TxPcbTemperature_StubWithCallback TEST_CAN_TxPcbTemperature_Stub
+#define TEST_CAN_TxPcbTemperature_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_TxPcbTemperature_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_TxPcbTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_TxPcbTemperature_ReturnThruPtr_pCanData(pCanData) TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_TxPcbTemperature_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_TxPcbTemperature_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_TxPcbTemperature_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_TxPcbTemperature_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_TxPcbTemperature_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_TxPcbTemperature_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_TxPcbTemperature_IgnoreArg_id() TEST_CAN_TxPcbTemperature_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxPcbTemperature_IgnoreArg_dlc() TEST_CAN_TxPcbTemperature_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxPcbTemperature_IgnoreArg_byteOrder() TEST_CAN_TxPcbTemperature_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxPcbTemperature_IgnoreArg_pCanData() TEST_CAN_TxPcbTemperature_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxPcbTemperature_IgnoreArg_pMuxId() TEST_CAN_TxPcbTemperature_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_TxPcbTemperature_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxExternalTemperature_IgnoreAndReturn(cmock_retval) TEST_CAN_TxExternalTemperature_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_TxExternalTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_TxExternalTemperature_StopIgnore() TEST_CAN_TxExternalTemperature_CMockStopIgnore()
+void TEST_CAN_TxExternalTemperature_CMockStopIgnore(void);
+#define TEST_CAN_TxExternalTemperature_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_TxExternalTemperature_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_TxExternalTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_TxExternalTemperature_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_TxExternalTemperature_AddCallback(CMOCK_TEST_CAN_TxExternalTemperature_CALLBACK Callback);
+void TEST_CAN_TxExternalTemperature_Stub(CMOCK_TEST_CAN_TxExternalTemperature_CALLBACK Callback);
+#define TEST_CAN_TxExternalTemperature_StubWithCallback TEST_CAN_TxExternalTemperature_Stub
+#define TEST_CAN_TxExternalTemperature_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_TxExternalTemperature_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_TxExternalTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_TxExternalTemperature_ReturnThruPtr_pCanData(pCanData) TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_TxExternalTemperature_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_TxExternalTemperature_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_TxExternalTemperature_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_TxExternalTemperature_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_TxExternalTemperature_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_TxExternalTemperature_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_TxExternalTemperature_IgnoreArg_id() TEST_CAN_TxExternalTemperature_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxExternalTemperature_IgnoreArg_dlc() TEST_CAN_TxExternalTemperature_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxExternalTemperature_IgnoreArg_byteOrder() TEST_CAN_TxExternalTemperature_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxExternalTemperature_IgnoreArg_pCanData() TEST_CAN_TxExternalTemperature_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxExternalTemperature_IgnoreArg_pMuxId() TEST_CAN_TxExternalTemperature_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_TxExternalTemperature_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxVoltageMinMax_IgnoreAndReturn(cmock_retval) TEST_CAN_TxVoltageMinMax_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_TxVoltageMinMax_StopIgnore() TEST_CAN_TxVoltageMinMax_CMockStopIgnore()
+void TEST_CAN_TxVoltageMinMax_CMockStopIgnore(void);
+#define TEST_CAN_TxVoltageMinMax_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_TxVoltageMinMax_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_TxVoltageMinMax_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_TxVoltageMinMax_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_TxVoltageMinMax_AddCallback(CMOCK_TEST_CAN_TxVoltageMinMax_CALLBACK Callback);
+void TEST_CAN_TxVoltageMinMax_Stub(CMOCK_TEST_CAN_TxVoltageMinMax_CALLBACK Callback);
+#define TEST_CAN_TxVoltageMinMax_StubWithCallback TEST_CAN_TxVoltageMinMax_Stub
+#define TEST_CAN_TxVoltageMinMax_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_TxVoltageMinMax_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_TxVoltageMinMax_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_TxVoltageMinMax_ReturnThruPtr_pCanData(pCanData) TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_TxVoltageMinMax_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_TxVoltageMinMax_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_TxVoltageMinMax_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_TxVoltageMinMax_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_TxVoltageMinMax_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_TxVoltageMinMax_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_TxVoltageMinMax_IgnoreArg_id() TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxVoltageMinMax_IgnoreArg_dlc() TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxVoltageMinMax_IgnoreArg_byteOrder() TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxVoltageMinMax_IgnoreArg_pCanData() TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxVoltageMinMax_IgnoreArg_pMuxId() TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_TxVoltageMinMax_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxAlgorithmStatistics_IgnoreAndReturn(cmock_retval) TEST_CAN_TxAlgorithmStatistics_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_TxAlgorithmStatistics_StopIgnore() TEST_CAN_TxAlgorithmStatistics_CMockStopIgnore()
+void TEST_CAN_TxAlgorithmStatistics_CMockStopIgnore(void);
+#define TEST_CAN_TxAlgorithmStatistics_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_TxAlgorithmStatistics_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_TxAlgorithmStatistics_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_TxAlgorithmStatistics_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_TxAlgorithmStatistics_AddCallback(CMOCK_TEST_CAN_TxAlgorithmStatistics_CALLBACK Callback);
+void TEST_CAN_TxAlgorithmStatistics_Stub(CMOCK_TEST_CAN_TxAlgorithmStatistics_CALLBACK Callback);
+#define TEST_CAN_TxAlgorithmStatistics_StubWithCallback TEST_CAN_TxAlgorithmStatistics_Stub
+#define TEST_CAN_TxAlgorithmStatistics_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_TxAlgorithmStatistics_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_TxAlgorithmStatistics_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_TxAlgorithmStatistics_ReturnThruPtr_pCanData(pCanData) TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_TxAlgorithmStatistics_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_TxAlgorithmStatistics_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_TxAlgorithmStatistics_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_TxAlgorithmStatistics_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_TxAlgorithmStatistics_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_TxAlgorithmStatistics_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_TxAlgorithmStatistics_IgnoreArg_id() TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxAlgorithmStatistics_IgnoreArg_dlc() TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxAlgorithmStatistics_IgnoreArg_byteOrder() TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxAlgorithmStatistics_IgnoreArg_pCanData() TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxAlgorithmStatistics_IgnoreArg_pMuxId() TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_TxAlgorithmStatistics_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingTimes_IgnoreAndReturn(cmock_retval) TEST_CAN_TxProfilingTimes_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_TxProfilingTimes_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_TxProfilingTimes_StopIgnore() TEST_CAN_TxProfilingTimes_CMockStopIgnore()
+void TEST_CAN_TxProfilingTimes_CMockStopIgnore(void);
+#define TEST_CAN_TxProfilingTimes_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_TxProfilingTimes_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_TxProfilingTimes_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_TxProfilingTimes_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_TxProfilingTimes_AddCallback(CMOCK_TEST_CAN_TxProfilingTimes_CALLBACK Callback);
+void TEST_CAN_TxProfilingTimes_Stub(CMOCK_TEST_CAN_TxProfilingTimes_CALLBACK Callback);
+#define TEST_CAN_TxProfilingTimes_StubWithCallback TEST_CAN_TxProfilingTimes_Stub
+#define TEST_CAN_TxProfilingTimes_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_TxProfilingTimes_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_TxProfilingTimes_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_TxProfilingTimes_ReturnThruPtr_pCanData(pCanData) TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_TxProfilingTimes_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_TxProfilingTimes_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_TxProfilingTimes_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_TxProfilingTimes_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_TxProfilingTimes_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_TxProfilingTimes_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_TxProfilingTimes_IgnoreArg_id() TEST_CAN_TxProfilingTimes_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingTimes_IgnoreArg_dlc() TEST_CAN_TxProfilingTimes_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingTimes_IgnoreArg_byteOrder() TEST_CAN_TxProfilingTimes_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingTimes_IgnoreArg_pCanData() TEST_CAN_TxProfilingTimes_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingTimes_IgnoreArg_pMuxId() TEST_CAN_TxProfilingTimes_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_TxProfilingTimes_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingHistogram_IgnoreAndReturn(cmock_retval) TEST_CAN_TxProfilingHistogram_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_TxProfilingHistogram_StopIgnore() TEST_CAN_TxProfilingHistogram_CMockStopIgnore()
+void TEST_CAN_TxProfilingHistogram_CMockStopIgnore(void);
+#define TEST_CAN_TxProfilingHistogram_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_TxProfilingHistogram_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_TxProfilingHistogram_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_TxProfilingHistogram_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_TxProfilingHistogram_AddCallback(CMOCK_TEST_CAN_TxProfilingHistogram_CALLBACK Callback);
+void TEST_CAN_TxProfilingHistogram_Stub(CMOCK_TEST_CAN_TxProfilingHistogram_CALLBACK Callback);
+#define TEST_CAN_TxProfilingHistogram_StubWithCallback TEST_CAN_TxProfilingHistogram_Stub
+#define TEST_CAN_TxProfilingHistogram_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_TxProfilingHistogram_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_TxProfilingHistogram_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_TxProfilingHistogram_ReturnThruPtr_pCanData(pCanData) TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_TxProfilingHistogram_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_TxProfilingHistogram_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_TxProfilingHistogram_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_TxProfilingHistogram_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_TxProfilingHistogram_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_TxProfilingHistogram_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_TxProfilingHistogram_IgnoreArg_id() TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingHistogram_IgnoreArg_dlc() TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingHistogram_IgnoreArg_byteOrder() TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingHistogram_IgnoreArg_pCanData() TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_TxProfilingHistogram_IgnoreArg_pMuxId() TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_TxProfilingHistogram_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxRequest_IgnoreAndReturn(cmock_retval) TEST_CAN_RxRequest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_RxRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_RxRequest_StopIgnore() TEST_CAN_RxRequest_CMockStopIgnore()
+void TEST_CAN_RxRequest_CMockStopIgnore(void);
+#define TEST_CAN_RxRequest_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_RxRequest_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_RxRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_RxRequest_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_RxRequest_AddCallback(CMOCK_TEST_CAN_RxRequest_CALLBACK Callback);
+void TEST_CAN_RxRequest_Stub(CMOCK_TEST_CAN_RxRequest_CALLBACK Callback);
+#define TEST_CAN_RxRequest_StubWithCallback TEST_CAN_RxRequest_Stub
+#define TEST_CAN_RxRequest_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_RxRequest_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_RxRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_RxRequest_ReturnThruPtr_pCanData(pCanData) TEST_CAN_RxRequest_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_RxRequest_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_RxRequest_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_RxRequest_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_RxRequest_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_RxRequest_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_RxRequest_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_RxRequest_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_RxRequest_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_RxRequest_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_RxRequest_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_RxRequest_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_RxRequest_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_RxRequest_IgnoreArg_id() TEST_CAN_RxRequest_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_RxRequest_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxRequest_IgnoreArg_dlc() TEST_CAN_RxRequest_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_RxRequest_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxRequest_IgnoreArg_byteOrder() TEST_CAN_RxRequest_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_RxRequest_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxRequest_IgnoreArg_pCanData() TEST_CAN_RxRequest_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_RxRequest_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxRequest_IgnoreArg_pMuxId() TEST_CAN_RxRequest_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_RxRequest_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwReset_IgnoreAndReturn(cmock_retval) TEST_CAN_RxSwReset_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_RxSwReset_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_RxSwReset_StopIgnore() TEST_CAN_RxSwReset_CMockStopIgnore()
+void TEST_CAN_RxSwReset_CMockStopIgnore(void);
+#define TEST_CAN_RxSwReset_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_RxSwReset_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_RxSwReset_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_RxSwReset_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_RxSwReset_AddCallback(CMOCK_TEST_CAN_RxSwReset_CALLBACK Callback);
+void TEST_CAN_RxSwReset_Stub(CMOCK_TEST_CAN_RxSwReset_CALLBACK Callback);
+#define TEST_CAN_RxSwReset_StubWithCallback TEST_CAN_RxSwReset_Stub
+#define TEST_CAN_RxSwReset_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_RxSwReset_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_RxSwReset_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_RxSwReset_ReturnThruPtr_pCanData(pCanData) TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_RxSwReset_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_RxSwReset_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_RxSwReset_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_RxSwReset_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_RxSwReset_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_RxSwReset_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_RxSwReset_IgnoreArg_id() TEST_CAN_RxSwReset_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_RxSwReset_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwReset_IgnoreArg_dlc() TEST_CAN_RxSwReset_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_RxSwReset_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwReset_IgnoreArg_byteOrder() TEST_CAN_RxSwReset_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_RxSwReset_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwReset_IgnoreArg_pCanData() TEST_CAN_RxSwReset_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_RxSwReset_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwReset_IgnoreArg_pMuxId() TEST_CAN_RxSwReset_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_RxSwReset_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxCurrentSensor_IgnoreAndReturn(cmock_retval) TEST_CAN_RxCurrentSensor_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_RxCurrentSensor_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_RxCurrentSensor_StopIgnore() TEST_CAN_RxCurrentSensor_CMockStopIgnore()
+void TEST_CAN_RxCurrentSensor_CMockStopIgnore(void);
+#define TEST_CAN_RxCurrentSensor_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_RxCurrentSensor_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_RxCurrentSensor_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_RxCurrentSensor_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_RxCurrentSensor_AddCallback(CMOCK_TEST_CAN_RxCurrentSensor_CALLBACK Callback);
+void TEST_CAN_RxCurrentSensor_Stub(CMOCK_TEST_CAN_RxCurrentSensor_CALLBACK Callback);
+#define TEST_CAN_RxCurrentSensor_StubWithCallback TEST_CAN_RxCurrentSensor_Stub
+#define TEST_CAN_RxCurrentSensor_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_RxCurrentSensor_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_RxCurrentSensor_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_RxCurrentSensor_ReturnThruPtr_pCanData(pCanData) TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_RxCurrentSensor_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_RxCurrentSensor_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_RxCurrentSensor_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_RxCurrentSensor_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_RxCurrentSensor_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_RxCurrentSensor_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_RxCurrentSensor_IgnoreArg_id() TEST_CAN_RxCurrentSensor_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxCurrentSensor_IgnoreArg_dlc() TEST_CAN_RxCurrentSensor_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxCurrentSensor_IgnoreArg_byteOrder() TEST_CAN_RxCurrentSensor_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxCurrentSensor_IgnoreArg_pCanData() TEST_CAN_RxCurrentSensor_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxCurrentSensor_IgnoreArg_pMuxId() TEST_CAN_RxCurrentSensor_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_RxCurrentSensor_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxDebug_IgnoreAndReturn(cmock_retval) TEST_CAN_RxDebug_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_RxDebug_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_RxDebug_StopIgnore() TEST_CAN_RxDebug_CMockStopIgnore()
+void TEST_CAN_RxDebug_CMockStopIgnore(void);
+#define TEST_CAN_RxDebug_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_RxDebug_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_RxDebug_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_RxDebug_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_RxDebug_AddCallback(CMOCK_TEST_CAN_RxDebug_CALLBACK Callback);
+void TEST_CAN_RxDebug_Stub(CMOCK_TEST_CAN_RxDebug_CALLBACK Callback);
+#define TEST_CAN_RxDebug_StubWithCallback TEST_CAN_RxDebug_Stub
+#define TEST_CAN_RxDebug_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_RxDebug_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_RxDebug_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_RxDebug_ReturnThruPtr_pCanData(pCanData) TEST_CAN_RxDebug_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_RxDebug_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_RxDebug_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_RxDebug_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_RxDebug_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_RxDebug_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_RxDebug_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_RxDebug_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_RxDebug_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_RxDebug_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_RxDebug_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_RxDebug_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_RxDebug_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_RxDebug_IgnoreArg_id() TEST_CAN_RxDebug_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_RxDebug_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxDebug_IgnoreArg_dlc() TEST_CAN_RxDebug_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_RxDebug_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxDebug_IgnoreArg_byteOrder() TEST_CAN_RxDebug_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_RxDebug_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxDebug_IgnoreArg_pCanData() TEST_CAN_RxDebug_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_RxDebug_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxDebug_IgnoreArg_pMuxId() TEST_CAN_RxDebug_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_RxDebug_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwVersion_IgnoreAndReturn(cmock_retval) TEST_CAN_RxSwVersion_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CAN_RxSwVersion_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_CAN_RxSwVersion_StopIgnore() TEST_CAN_RxSwVersion_CMockStopIgnore()
+void TEST_CAN_RxSwVersion_CMockStopIgnore(void);
+#define TEST_CAN_RxSwVersion_ExpectAndReturn(id, dlc, byteOrder, pCanData, pMuxId, cmock_retval) TEST_CAN_RxSwVersion_CMockExpectAndReturn(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_retval)
+void TEST_CAN_RxSwVersion_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_CAN_RxSwVersion_CALLBACK)(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, int cmock_num_calls);
+void TEST_CAN_RxSwVersion_AddCallback(CMOCK_TEST_CAN_RxSwVersion_CALLBACK Callback);
+void TEST_CAN_RxSwVersion_Stub(CMOCK_TEST_CAN_RxSwVersion_CALLBACK Callback);
+#define TEST_CAN_RxSwVersion_StubWithCallback TEST_CAN_RxSwVersion_Stub
+#define TEST_CAN_RxSwVersion_ExpectAndThrow(id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw) TEST_CAN_RxSwVersion_CMockExpectAndThrow(__LINE__, id, dlc, byteOrder, pCanData, pMuxId, cmock_to_throw)
+void TEST_CAN_RxSwVersion_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t* pCanData, uint32_t* pMuxId, CEXCEPTION_T cmock_to_throw);
+#define TEST_CAN_RxSwVersion_ReturnThruPtr_pCanData(pCanData) TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, sizeof(uint8_t))
+#define TEST_CAN_RxSwVersion_ReturnArrayThruPtr_pCanData(pCanData, cmock_len) TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_len * sizeof(*pCanData))
+#define TEST_CAN_RxSwVersion_ReturnMemThruPtr_pCanData(pCanData, cmock_size) TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pCanData(__LINE__, pCanData, cmock_size)
+void TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pCanData(UNITY_LINE_TYPE cmock_line, uint8_t* pCanData, size_t cmock_size);
+#define TEST_CAN_RxSwVersion_ReturnThruPtr_pMuxId(pMuxId) TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, sizeof(uint32_t))
+#define TEST_CAN_RxSwVersion_ReturnArrayThruPtr_pMuxId(pMuxId, cmock_len) TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_len * sizeof(*pMuxId))
+#define TEST_CAN_RxSwVersion_ReturnMemThruPtr_pMuxId(pMuxId, cmock_size) TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pMuxId(__LINE__, pMuxId, cmock_size)
+void TEST_CAN_RxSwVersion_CMockReturnMemThruPtr_pMuxId(UNITY_LINE_TYPE cmock_line, uint32_t* pMuxId, size_t cmock_size);
+#define TEST_CAN_RxSwVersion_IgnoreArg_id() TEST_CAN_RxSwVersion_CMockIgnoreArg_id(__LINE__)
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_id(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwVersion_IgnoreArg_dlc() TEST_CAN_RxSwVersion_CMockIgnoreArg_dlc(__LINE__)
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_dlc(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwVersion_IgnoreArg_byteOrder() TEST_CAN_RxSwVersion_CMockIgnoreArg_byteOrder(__LINE__)
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_byteOrder(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwVersion_IgnoreArg_pCanData() TEST_CAN_RxSwVersion_CMockIgnoreArg_pCanData(__LINE__)
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_pCanData(UNITY_LINE_TYPE cmock_line);
+#define TEST_CAN_RxSwVersion_IgnoreArg_pMuxId() TEST_CAN_RxSwVersion_CMockIgnoreArg_pMuxId(__LINE__)
+void TEST_CAN_RxSwVersion_CMockIgnoreArg_pMuxId(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
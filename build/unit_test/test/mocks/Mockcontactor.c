@@ -0,0 +1,1783 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockcontactor.h"
+
+static const char* CMockString_CONT_CheckFeedback = "CONT_CheckFeedback";
+static const char* CMockString_CONT_ClosePrecharge = "CONT_ClosePrecharge";
+static const char* CMockString_CONT_CloseString = "CONT_CloseString";
+static const char* CMockString_CONT_GetContactorFeedback = "CONT_GetContactorFeedback";
+static const char* CMockString_CONT_GetContactorSetValue = "CONT_GetContactorSetValue";
+static const char* CMockString_CONT_GetState = "CONT_GetState";
+static const char* CMockString_CONT_Initialize = "CONT_Initialize";
+static const char* CMockString_CONT_OpenPrecharge = "CONT_OpenPrecharge";
+static const char* CMockString_CONT_OpenString = "CONT_OpenString";
+static const char* CMockString_CONT_SetContactorState = "CONT_SetContactorState";
+static const char* CMockString_TEST_CONT_InitializationCheckOfContactorRegistry = "TEST_CONT_InitializationCheckOfContactorRegistry";
+static const char* CMockString_TEST_CONT_ResolveContactorName = "TEST_CONT_ResolveContactorName";
+static const char* CMockString_contactorNumber = "contactorNumber";
+static const char* CMockString_name = "name";
+static const char* CMockString_requestedContactorState = "requestedContactorState";
+static const char* CMockString_stringNumber = "stringNumber";
+
+typedef struct _CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  CONT_ELECTRICAL_STATE_TYPE_e ReturnVal;
+  int CallOrder;
+  CONT_NAMES_e Expected_name;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_name;
+
+} CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE;
+
+typedef struct _CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE;
+
+typedef struct _CMOCK_CONT_SetContactorState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CONT_NAMES_e Expected_name;
+  CONT_ELECTRICAL_STATE_TYPE_e Expected_requestedContactorState;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_name;
+  char IgnoreArg_requestedContactorState;
+
+} CMOCK_CONT_SetContactorState_CALL_INSTANCE;
+
+typedef struct _CMOCK_CONT_GetState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  CONT_ELECTRICAL_STATE_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_contactorNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_contactorNumber;
+
+} CMOCK_CONT_GetState_CALL_INSTANCE;
+
+typedef struct _CMOCK_CONT_CloseString_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_CONT_CloseString_CALL_INSTANCE;
+
+typedef struct _CMOCK_CONT_OpenString_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_CONT_OpenString_CALL_INSTANCE;
+
+typedef struct _CMOCK_CONT_ClosePrecharge_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_CONT_ClosePrecharge_CALL_INSTANCE;
+
+typedef struct _CMOCK_CONT_OpenPrecharge_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_CONT_OpenPrecharge_CALL_INSTANCE;
+
+typedef struct _CMOCK_CONT_CheckFeedback_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_CONT_CheckFeedback_CALL_INSTANCE;
+
+typedef struct _CMOCK_CONT_Initialize_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_CONT_Initialize_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  CONT_CONTACTOR_INDEX ReturnVal;
+  int CallOrder;
+  CONT_NAMES_e Expected_name;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_name;
+
+} CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE;
+
+static struct MockcontactorInstance
+{
+  char CONT_GetContactorSetValue_IgnoreBool;
+  CONT_ELECTRICAL_STATE_TYPE_e CONT_GetContactorSetValue_FinalReturn;
+  char CONT_GetContactorSetValue_CallbackBool;
+  CMOCK_CONT_GetContactorSetValue_CALLBACK CONT_GetContactorSetValue_CallbackFunctionPointer;
+  int CONT_GetContactorSetValue_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_GetContactorSetValue_CallInstance;
+  char CONT_GetContactorFeedback_IgnoreBool;
+  char CONT_GetContactorFeedback_CallbackBool;
+  CMOCK_CONT_GetContactorFeedback_CALLBACK CONT_GetContactorFeedback_CallbackFunctionPointer;
+  int CONT_GetContactorFeedback_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_GetContactorFeedback_CallInstance;
+  char CONT_SetContactorState_IgnoreBool;
+  STD_RETURN_TYPE_e CONT_SetContactorState_FinalReturn;
+  char CONT_SetContactorState_CallbackBool;
+  CMOCK_CONT_SetContactorState_CALLBACK CONT_SetContactorState_CallbackFunctionPointer;
+  int CONT_SetContactorState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_SetContactorState_CallInstance;
+  char CONT_GetState_IgnoreBool;
+  CONT_ELECTRICAL_STATE_TYPE_e CONT_GetState_FinalReturn;
+  char CONT_GetState_CallbackBool;
+  CMOCK_CONT_GetState_CALLBACK CONT_GetState_CallbackFunctionPointer;
+  int CONT_GetState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_GetState_CallInstance;
+  char CONT_CloseString_IgnoreBool;
+  STD_RETURN_TYPE_e CONT_CloseString_FinalReturn;
+  char CONT_CloseString_CallbackBool;
+  CMOCK_CONT_CloseString_CALLBACK CONT_CloseString_CallbackFunctionPointer;
+  int CONT_CloseString_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_CloseString_CallInstance;
+  char CONT_OpenString_IgnoreBool;
+  STD_RETURN_TYPE_e CONT_OpenString_FinalReturn;
+  char CONT_OpenString_CallbackBool;
+  CMOCK_CONT_OpenString_CALLBACK CONT_OpenString_CallbackFunctionPointer;
+  int CONT_OpenString_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_OpenString_CallInstance;
+  char CONT_ClosePrecharge_IgnoreBool;
+  STD_RETURN_TYPE_e CONT_ClosePrecharge_FinalReturn;
+  char CONT_ClosePrecharge_CallbackBool;
+  CMOCK_CONT_ClosePrecharge_CALLBACK CONT_ClosePrecharge_CallbackFunctionPointer;
+  int CONT_ClosePrecharge_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_ClosePrecharge_CallInstance;
+  char CONT_OpenPrecharge_IgnoreBool;
+  STD_RETURN_TYPE_e CONT_OpenPrecharge_FinalReturn;
+  char CONT_OpenPrecharge_CallbackBool;
+  CMOCK_CONT_OpenPrecharge_CALLBACK CONT_OpenPrecharge_CallbackFunctionPointer;
+  int CONT_OpenPrecharge_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_OpenPrecharge_CallInstance;
+  char CONT_CheckFeedback_IgnoreBool;
+  char CONT_CheckFeedback_CallbackBool;
+  CMOCK_CONT_CheckFeedback_CALLBACK CONT_CheckFeedback_CallbackFunctionPointer;
+  int CONT_CheckFeedback_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_CheckFeedback_CallInstance;
+  char CONT_Initialize_IgnoreBool;
+  char CONT_Initialize_CallbackBool;
+  CMOCK_CONT_Initialize_CALLBACK CONT_Initialize_CallbackFunctionPointer;
+  int CONT_Initialize_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE CONT_Initialize_CallInstance;
+  char TEST_CONT_InitializationCheckOfContactorRegistry_IgnoreBool;
+  char TEST_CONT_InitializationCheckOfContactorRegistry_CallbackBool;
+  CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALLBACK TEST_CONT_InitializationCheckOfContactorRegistry_CallbackFunctionPointer;
+  int TEST_CONT_InitializationCheckOfContactorRegistry_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CONT_InitializationCheckOfContactorRegistry_CallInstance;
+  char TEST_CONT_ResolveContactorName_IgnoreBool;
+  CONT_CONTACTOR_INDEX TEST_CONT_ResolveContactorName_FinalReturn;
+  char TEST_CONT_ResolveContactorName_CallbackBool;
+  CMOCK_TEST_CONT_ResolveContactorName_CALLBACK TEST_CONT_ResolveContactorName_CallbackFunctionPointer;
+  int TEST_CONT_ResolveContactorName_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_CONT_ResolveContactorName_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockcontactor_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.CONT_GetContactorSetValue_CallInstance;
+  if (Mock.CONT_GetContactorSetValue_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_GetContactorSetValue);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_GetContactorSetValue_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CONT_GetContactorFeedback_CallInstance;
+  if (Mock.CONT_GetContactorFeedback_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_GetContactorFeedback);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_GetContactorFeedback_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CONT_SetContactorState_CallInstance;
+  if (Mock.CONT_SetContactorState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_SetContactorState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_SetContactorState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CONT_GetState_CallInstance;
+  if (Mock.CONT_GetState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_GetState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_GetState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CONT_CloseString_CallInstance;
+  if (Mock.CONT_CloseString_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_CloseString);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_CloseString_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CONT_OpenString_CallInstance;
+  if (Mock.CONT_OpenString_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_OpenString);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_OpenString_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CONT_ClosePrecharge_CallInstance;
+  if (Mock.CONT_ClosePrecharge_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_ClosePrecharge);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_ClosePrecharge_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CONT_OpenPrecharge_CallInstance;
+  if (Mock.CONT_OpenPrecharge_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_OpenPrecharge);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_OpenPrecharge_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CONT_CheckFeedback_CallInstance;
+  if (Mock.CONT_CheckFeedback_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_CheckFeedback);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_CheckFeedback_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.CONT_Initialize_CallInstance;
+  if (Mock.CONT_Initialize_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_CONT_Initialize);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.CONT_Initialize_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallInstance;
+  if (Mock.TEST_CONT_InitializationCheckOfContactorRegistry_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CONT_InitializationCheckOfContactorRegistry);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_CONT_ResolveContactorName_CallInstance;
+  if (Mock.TEST_CONT_ResolveContactorName_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_CONT_ResolveContactorName);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_CONT_ResolveContactorName_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockcontactor_Init(void)
+{
+  Mockcontactor_Destroy();
+}
+
+void Mockcontactor_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+CONT_ELECTRICAL_STATE_TYPE_e CONT_GetContactorSetValue(const CONT_NAMES_e name)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_GetContactorSetValue);
+  cmock_call_instance = (CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_GetContactorSetValue_CallInstance);
+  Mock.CONT_GetContactorSetValue_CallInstance = CMock_Guts_MemNext(Mock.CONT_GetContactorSetValue_CallInstance);
+  if (Mock.CONT_GetContactorSetValue_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CONT_GetContactorSetValue_FinalReturn;
+    memcpy((void*)(&Mock.CONT_GetContactorSetValue_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(CONT_ELECTRICAL_STATE_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(CONT_ELECTRICAL_STATE_TYPE_e) ? 1 : -1])); /* add CONT_ELECTRICAL_STATE_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CONT_GetContactorSetValue_CallbackBool &&
+      Mock.CONT_GetContactorSetValue_CallbackFunctionPointer != NULL)
+  {
+    CONT_ELECTRICAL_STATE_TYPE_e cmock_cb_ret = Mock.CONT_GetContactorSetValue_CallbackFunctionPointer(name, Mock.CONT_GetContactorSetValue_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_name)
+  {
+    UNITY_SET_DETAILS(CMockString_CONT_GetContactorSetValue,CMockString_name);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_name), (void*)(&name), sizeof(CONT_NAMES_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CONT_GetContactorSetValue_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CONT_GetContactorSetValue_CallbackFunctionPointer(name, Mock.CONT_GetContactorSetValue_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CONT_GetContactorSetValue(CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE* cmock_call_instance, const CONT_NAMES_e name);
+void CMockExpectParameters_CONT_GetContactorSetValue(CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE* cmock_call_instance, const CONT_NAMES_e name)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_name), (void*)(&name),
+         sizeof(CONT_NAMES_e[sizeof(name) == sizeof(CONT_NAMES_e) ? 1 : -1])); /* add CONT_NAMES_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_name = 0;
+}
+
+void CONT_GetContactorSetValue_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CONT_ELECTRICAL_STATE_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE));
+  CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_GetContactorSetValue_CallInstance = CMock_Guts_MemChain(Mock.CONT_GetContactorSetValue_CallInstance, cmock_guts_index);
+  Mock.CONT_GetContactorSetValue_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CONT_GetContactorSetValue_IgnoreBool = (char)1;
+}
+
+void CONT_GetContactorSetValue_CMockStopIgnore(void)
+{
+  if(Mock.CONT_GetContactorSetValue_IgnoreBool)
+    Mock.CONT_GetContactorSetValue_CallInstance = CMock_Guts_MemNext(Mock.CONT_GetContactorSetValue_CallInstance);
+  Mock.CONT_GetContactorSetValue_IgnoreBool = (char)0;
+}
+
+void CONT_GetContactorSetValue_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE));
+  CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_GetContactorSetValue_CallInstance = CMock_Guts_MemChain(Mock.CONT_GetContactorSetValue_CallInstance, cmock_guts_index);
+  Mock.CONT_GetContactorSetValue_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_GetContactorSetValue(cmock_call_instance, name);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(CONT_ELECTRICAL_STATE_TYPE_e[sizeof(cmock_to_return) == sizeof(CONT_ELECTRICAL_STATE_TYPE_e) ? 1 : -1])); /* add CONT_ELECTRICAL_STATE_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CONT_GetContactorSetValue_AddCallback(CMOCK_CONT_GetContactorSetValue_CALLBACK Callback)
+{
+  Mock.CONT_GetContactorSetValue_IgnoreBool = (char)0;
+  Mock.CONT_GetContactorSetValue_CallbackBool = (char)1;
+  Mock.CONT_GetContactorSetValue_CallbackFunctionPointer = Callback;
+}
+
+void CONT_GetContactorSetValue_Stub(CMOCK_CONT_GetContactorSetValue_CALLBACK Callback)
+{
+  Mock.CONT_GetContactorSetValue_IgnoreBool = (char)0;
+  Mock.CONT_GetContactorSetValue_CallbackBool = (char)0;
+  Mock.CONT_GetContactorSetValue_CallbackFunctionPointer = Callback;
+}
+
+void CONT_GetContactorSetValue_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE));
+  CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_GetContactorSetValue_CallInstance = CMock_Guts_MemChain(Mock.CONT_GetContactorSetValue_CallInstance, cmock_guts_index);
+  Mock.CONT_GetContactorSetValue_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_GetContactorSetValue(cmock_call_instance, name);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CONT_GetContactorSetValue_CMockIgnoreArg_name(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetContactorSetValue_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CONT_GetContactorSetValue_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_name = 1;
+}
+
+void CONT_GetContactorFeedback(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_GetContactorFeedback);
+  cmock_call_instance = (CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_GetContactorFeedback_CallInstance);
+  Mock.CONT_GetContactorFeedback_CallInstance = CMock_Guts_MemNext(Mock.CONT_GetContactorFeedback_CallInstance);
+  if (Mock.CONT_GetContactorFeedback_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.CONT_GetContactorFeedback_CallbackBool &&
+      Mock.CONT_GetContactorFeedback_CallbackFunctionPointer != NULL)
+  {
+    Mock.CONT_GetContactorFeedback_CallbackFunctionPointer(Mock.CONT_GetContactorFeedback_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.CONT_GetContactorFeedback_CallbackFunctionPointer != NULL)
+  {
+    Mock.CONT_GetContactorFeedback_CallbackFunctionPointer(Mock.CONT_GetContactorFeedback_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CONT_GetContactorFeedback_CMockIgnore(void)
+{
+  Mock.CONT_GetContactorFeedback_IgnoreBool = (char)1;
+}
+
+void CONT_GetContactorFeedback_CMockStopIgnore(void)
+{
+  Mock.CONT_GetContactorFeedback_IgnoreBool = (char)0;
+}
+
+void CONT_GetContactorFeedback_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE));
+  CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_GetContactorFeedback_CallInstance = CMock_Guts_MemChain(Mock.CONT_GetContactorFeedback_CallInstance, cmock_guts_index);
+  Mock.CONT_GetContactorFeedback_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void CONT_GetContactorFeedback_AddCallback(CMOCK_CONT_GetContactorFeedback_CALLBACK Callback)
+{
+  Mock.CONT_GetContactorFeedback_IgnoreBool = (char)0;
+  Mock.CONT_GetContactorFeedback_CallbackBool = (char)1;
+  Mock.CONT_GetContactorFeedback_CallbackFunctionPointer = Callback;
+}
+
+void CONT_GetContactorFeedback_Stub(CMOCK_CONT_GetContactorFeedback_CALLBACK Callback)
+{
+  Mock.CONT_GetContactorFeedback_IgnoreBool = (char)0;
+  Mock.CONT_GetContactorFeedback_CallbackBool = (char)0;
+  Mock.CONT_GetContactorFeedback_CallbackFunctionPointer = Callback;
+}
+
+void CONT_GetContactorFeedback_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE));
+  CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetContactorFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_GetContactorFeedback_CallInstance = CMock_Guts_MemChain(Mock.CONT_GetContactorFeedback_CallInstance, cmock_guts_index);
+  Mock.CONT_GetContactorFeedback_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e CONT_SetContactorState(const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e requestedContactorState)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_SetContactorState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_SetContactorState);
+  cmock_call_instance = (CMOCK_CONT_SetContactorState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_SetContactorState_CallInstance);
+  Mock.CONT_SetContactorState_CallInstance = CMock_Guts_MemNext(Mock.CONT_SetContactorState_CallInstance);
+  if (Mock.CONT_SetContactorState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CONT_SetContactorState_FinalReturn;
+    memcpy((void*)(&Mock.CONT_SetContactorState_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CONT_SetContactorState_CallbackBool &&
+      Mock.CONT_SetContactorState_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.CONT_SetContactorState_CallbackFunctionPointer(name, requestedContactorState, Mock.CONT_SetContactorState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_name)
+  {
+    UNITY_SET_DETAILS(CMockString_CONT_SetContactorState,CMockString_name);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_name), (void*)(&name), sizeof(CONT_NAMES_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_requestedContactorState)
+  {
+    UNITY_SET_DETAILS(CMockString_CONT_SetContactorState,CMockString_requestedContactorState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_requestedContactorState), (void*)(&requestedContactorState), sizeof(CONT_ELECTRICAL_STATE_TYPE_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CONT_SetContactorState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CONT_SetContactorState_CallbackFunctionPointer(name, requestedContactorState, Mock.CONT_SetContactorState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CONT_SetContactorState(CMOCK_CONT_SetContactorState_CALL_INSTANCE* cmock_call_instance, const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e requestedContactorState);
+void CMockExpectParameters_CONT_SetContactorState(CMOCK_CONT_SetContactorState_CALL_INSTANCE* cmock_call_instance, const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e requestedContactorState)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_name), (void*)(&name),
+         sizeof(CONT_NAMES_e[sizeof(name) == sizeof(CONT_NAMES_e) ? 1 : -1])); /* add CONT_NAMES_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_name = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_requestedContactorState), (void*)(&requestedContactorState),
+         sizeof(CONT_ELECTRICAL_STATE_TYPE_e[sizeof(requestedContactorState) == sizeof(CONT_ELECTRICAL_STATE_TYPE_e) ? 1 : -1])); /* add CONT_ELECTRICAL_STATE_TYPE_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_requestedContactorState = 0;
+}
+
+void CONT_SetContactorState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_SetContactorState_CALL_INSTANCE));
+  CMOCK_CONT_SetContactorState_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_SetContactorState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_SetContactorState_CallInstance = CMock_Guts_MemChain(Mock.CONT_SetContactorState_CallInstance, cmock_guts_index);
+  Mock.CONT_SetContactorState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CONT_SetContactorState_IgnoreBool = (char)1;
+}
+
+void CONT_SetContactorState_CMockStopIgnore(void)
+{
+  if(Mock.CONT_SetContactorState_IgnoreBool)
+    Mock.CONT_SetContactorState_CallInstance = CMock_Guts_MemNext(Mock.CONT_SetContactorState_CallInstance);
+  Mock.CONT_SetContactorState_IgnoreBool = (char)0;
+}
+
+void CONT_SetContactorState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e requestedContactorState, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_SetContactorState_CALL_INSTANCE));
+  CMOCK_CONT_SetContactorState_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_SetContactorState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_SetContactorState_CallInstance = CMock_Guts_MemChain(Mock.CONT_SetContactorState_CallInstance, cmock_guts_index);
+  Mock.CONT_SetContactorState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_SetContactorState(cmock_call_instance, name, requestedContactorState);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CONT_SetContactorState_AddCallback(CMOCK_CONT_SetContactorState_CALLBACK Callback)
+{
+  Mock.CONT_SetContactorState_IgnoreBool = (char)0;
+  Mock.CONT_SetContactorState_CallbackBool = (char)1;
+  Mock.CONT_SetContactorState_CallbackFunctionPointer = Callback;
+}
+
+void CONT_SetContactorState_Stub(CMOCK_CONT_SetContactorState_CALLBACK Callback)
+{
+  Mock.CONT_SetContactorState_IgnoreBool = (char)0;
+  Mock.CONT_SetContactorState_CallbackBool = (char)0;
+  Mock.CONT_SetContactorState_CallbackFunctionPointer = Callback;
+}
+
+void CONT_SetContactorState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e requestedContactorState, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_SetContactorState_CALL_INSTANCE));
+  CMOCK_CONT_SetContactorState_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_SetContactorState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_SetContactorState_CallInstance = CMock_Guts_MemChain(Mock.CONT_SetContactorState_CallInstance, cmock_guts_index);
+  Mock.CONT_SetContactorState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_SetContactorState(cmock_call_instance, name, requestedContactorState);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CONT_SetContactorState_CMockIgnoreArg_name(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CONT_SetContactorState_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_SetContactorState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CONT_SetContactorState_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_name = 1;
+}
+
+void CONT_SetContactorState_CMockIgnoreArg_requestedContactorState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CONT_SetContactorState_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_SetContactorState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CONT_SetContactorState_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_requestedContactorState = 1;
+}
+
+CONT_ELECTRICAL_STATE_TYPE_e CONT_GetState(uint8_t contactorNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_GetState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_GetState);
+  cmock_call_instance = (CMOCK_CONT_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_GetState_CallInstance);
+  Mock.CONT_GetState_CallInstance = CMock_Guts_MemNext(Mock.CONT_GetState_CallInstance);
+  if (Mock.CONT_GetState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CONT_GetState_FinalReturn;
+    memcpy((void*)(&Mock.CONT_GetState_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(CONT_ELECTRICAL_STATE_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(CONT_ELECTRICAL_STATE_TYPE_e) ? 1 : -1])); /* add CONT_ELECTRICAL_STATE_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CONT_GetState_CallbackBool &&
+      Mock.CONT_GetState_CallbackFunctionPointer != NULL)
+  {
+    CONT_ELECTRICAL_STATE_TYPE_e cmock_cb_ret = Mock.CONT_GetState_CallbackFunctionPointer(contactorNumber, Mock.CONT_GetState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_contactorNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_CONT_GetState,CMockString_contactorNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_contactorNumber, contactorNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CONT_GetState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CONT_GetState_CallbackFunctionPointer(contactorNumber, Mock.CONT_GetState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CONT_GetState(CMOCK_CONT_GetState_CALL_INSTANCE* cmock_call_instance, uint8_t contactorNumber);
+void CMockExpectParameters_CONT_GetState(CMOCK_CONT_GetState_CALL_INSTANCE* cmock_call_instance, uint8_t contactorNumber)
+{
+  cmock_call_instance->Expected_contactorNumber = contactorNumber;
+  cmock_call_instance->IgnoreArg_contactorNumber = 0;
+}
+
+void CONT_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CONT_ELECTRICAL_STATE_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_GetState_CALL_INSTANCE));
+  CMOCK_CONT_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_GetState_CallInstance = CMock_Guts_MemChain(Mock.CONT_GetState_CallInstance, cmock_guts_index);
+  Mock.CONT_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CONT_GetState_IgnoreBool = (char)1;
+}
+
+void CONT_GetState_CMockStopIgnore(void)
+{
+  if(Mock.CONT_GetState_IgnoreBool)
+    Mock.CONT_GetState_CallInstance = CMock_Guts_MemNext(Mock.CONT_GetState_CallInstance);
+  Mock.CONT_GetState_IgnoreBool = (char)0;
+}
+
+void CONT_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t contactorNumber, CONT_ELECTRICAL_STATE_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_GetState_CALL_INSTANCE));
+  CMOCK_CONT_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_GetState_CallInstance = CMock_Guts_MemChain(Mock.CONT_GetState_CallInstance, cmock_guts_index);
+  Mock.CONT_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_GetState(cmock_call_instance, contactorNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(CONT_ELECTRICAL_STATE_TYPE_e[sizeof(cmock_to_return) == sizeof(CONT_ELECTRICAL_STATE_TYPE_e) ? 1 : -1])); /* add CONT_ELECTRICAL_STATE_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CONT_GetState_AddCallback(CMOCK_CONT_GetState_CALLBACK Callback)
+{
+  Mock.CONT_GetState_IgnoreBool = (char)0;
+  Mock.CONT_GetState_CallbackBool = (char)1;
+  Mock.CONT_GetState_CallbackFunctionPointer = Callback;
+}
+
+void CONT_GetState_Stub(CMOCK_CONT_GetState_CALLBACK Callback)
+{
+  Mock.CONT_GetState_IgnoreBool = (char)0;
+  Mock.CONT_GetState_CallbackBool = (char)0;
+  Mock.CONT_GetState_CallbackFunctionPointer = Callback;
+}
+
+void CONT_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t contactorNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_GetState_CALL_INSTANCE));
+  CMOCK_CONT_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_GetState_CallInstance = CMock_Guts_MemChain(Mock.CONT_GetState_CallInstance, cmock_guts_index);
+  Mock.CONT_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_GetState(cmock_call_instance, contactorNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CONT_GetState_CMockIgnoreArg_contactorNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CONT_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CONT_GetState_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_contactorNumber = 1;
+}
+
+STD_RETURN_TYPE_e CONT_CloseString(uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_CloseString_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_CloseString);
+  cmock_call_instance = (CMOCK_CONT_CloseString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_CloseString_CallInstance);
+  Mock.CONT_CloseString_CallInstance = CMock_Guts_MemNext(Mock.CONT_CloseString_CallInstance);
+  if (Mock.CONT_CloseString_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CONT_CloseString_FinalReturn;
+    memcpy((void*)(&Mock.CONT_CloseString_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CONT_CloseString_CallbackBool &&
+      Mock.CONT_CloseString_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.CONT_CloseString_CallbackFunctionPointer(stringNumber, Mock.CONT_CloseString_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_CONT_CloseString,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CONT_CloseString_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CONT_CloseString_CallbackFunctionPointer(stringNumber, Mock.CONT_CloseString_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CONT_CloseString(CMOCK_CONT_CloseString_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber);
+void CMockExpectParameters_CONT_CloseString(CMOCK_CONT_CloseString_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void CONT_CloseString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_CloseString_CALL_INSTANCE));
+  CMOCK_CONT_CloseString_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_CloseString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_CloseString_CallInstance = CMock_Guts_MemChain(Mock.CONT_CloseString_CallInstance, cmock_guts_index);
+  Mock.CONT_CloseString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CONT_CloseString_IgnoreBool = (char)1;
+}
+
+void CONT_CloseString_CMockStopIgnore(void)
+{
+  if(Mock.CONT_CloseString_IgnoreBool)
+    Mock.CONT_CloseString_CallInstance = CMock_Guts_MemNext(Mock.CONT_CloseString_CallInstance);
+  Mock.CONT_CloseString_IgnoreBool = (char)0;
+}
+
+void CONT_CloseString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_CloseString_CALL_INSTANCE));
+  CMOCK_CONT_CloseString_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_CloseString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_CloseString_CallInstance = CMock_Guts_MemChain(Mock.CONT_CloseString_CallInstance, cmock_guts_index);
+  Mock.CONT_CloseString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_CloseString(cmock_call_instance, stringNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CONT_CloseString_AddCallback(CMOCK_CONT_CloseString_CALLBACK Callback)
+{
+  Mock.CONT_CloseString_IgnoreBool = (char)0;
+  Mock.CONT_CloseString_CallbackBool = (char)1;
+  Mock.CONT_CloseString_CallbackFunctionPointer = Callback;
+}
+
+void CONT_CloseString_Stub(CMOCK_CONT_CloseString_CALLBACK Callback)
+{
+  Mock.CONT_CloseString_IgnoreBool = (char)0;
+  Mock.CONT_CloseString_CallbackBool = (char)0;
+  Mock.CONT_CloseString_CallbackFunctionPointer = Callback;
+}
+
+void CONT_CloseString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_CloseString_CALL_INSTANCE));
+  CMOCK_CONT_CloseString_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_CloseString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_CloseString_CallInstance = CMock_Guts_MemChain(Mock.CONT_CloseString_CallInstance, cmock_guts_index);
+  Mock.CONT_CloseString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_CloseString(cmock_call_instance, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CONT_CloseString_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CONT_CloseString_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_CloseString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CONT_CloseString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+STD_RETURN_TYPE_e CONT_OpenString(uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_OpenString_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_OpenString);
+  cmock_call_instance = (CMOCK_CONT_OpenString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_OpenString_CallInstance);
+  Mock.CONT_OpenString_CallInstance = CMock_Guts_MemNext(Mock.CONT_OpenString_CallInstance);
+  if (Mock.CONT_OpenString_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CONT_OpenString_FinalReturn;
+    memcpy((void*)(&Mock.CONT_OpenString_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CONT_OpenString_CallbackBool &&
+      Mock.CONT_OpenString_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.CONT_OpenString_CallbackFunctionPointer(stringNumber, Mock.CONT_OpenString_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_CONT_OpenString,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CONT_OpenString_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CONT_OpenString_CallbackFunctionPointer(stringNumber, Mock.CONT_OpenString_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CONT_OpenString(CMOCK_CONT_OpenString_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber);
+void CMockExpectParameters_CONT_OpenString(CMOCK_CONT_OpenString_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void CONT_OpenString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_OpenString_CALL_INSTANCE));
+  CMOCK_CONT_OpenString_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_OpenString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_OpenString_CallInstance = CMock_Guts_MemChain(Mock.CONT_OpenString_CallInstance, cmock_guts_index);
+  Mock.CONT_OpenString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CONT_OpenString_IgnoreBool = (char)1;
+}
+
+void CONT_OpenString_CMockStopIgnore(void)
+{
+  if(Mock.CONT_OpenString_IgnoreBool)
+    Mock.CONT_OpenString_CallInstance = CMock_Guts_MemNext(Mock.CONT_OpenString_CallInstance);
+  Mock.CONT_OpenString_IgnoreBool = (char)0;
+}
+
+void CONT_OpenString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_OpenString_CALL_INSTANCE));
+  CMOCK_CONT_OpenString_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_OpenString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_OpenString_CallInstance = CMock_Guts_MemChain(Mock.CONT_OpenString_CallInstance, cmock_guts_index);
+  Mock.CONT_OpenString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_OpenString(cmock_call_instance, stringNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CONT_OpenString_AddCallback(CMOCK_CONT_OpenString_CALLBACK Callback)
+{
+  Mock.CONT_OpenString_IgnoreBool = (char)0;
+  Mock.CONT_OpenString_CallbackBool = (char)1;
+  Mock.CONT_OpenString_CallbackFunctionPointer = Callback;
+}
+
+void CONT_OpenString_Stub(CMOCK_CONT_OpenString_CALLBACK Callback)
+{
+  Mock.CONT_OpenString_IgnoreBool = (char)0;
+  Mock.CONT_OpenString_CallbackBool = (char)0;
+  Mock.CONT_OpenString_CallbackFunctionPointer = Callback;
+}
+
+void CONT_OpenString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_OpenString_CALL_INSTANCE));
+  CMOCK_CONT_OpenString_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_OpenString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_OpenString_CallInstance = CMock_Guts_MemChain(Mock.CONT_OpenString_CallInstance, cmock_guts_index);
+  Mock.CONT_OpenString_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_OpenString(cmock_call_instance, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CONT_OpenString_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CONT_OpenString_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_OpenString_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CONT_OpenString_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+STD_RETURN_TYPE_e CONT_ClosePrecharge(uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_ClosePrecharge_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_ClosePrecharge);
+  cmock_call_instance = (CMOCK_CONT_ClosePrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_ClosePrecharge_CallInstance);
+  Mock.CONT_ClosePrecharge_CallInstance = CMock_Guts_MemNext(Mock.CONT_ClosePrecharge_CallInstance);
+  if (Mock.CONT_ClosePrecharge_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CONT_ClosePrecharge_FinalReturn;
+    memcpy((void*)(&Mock.CONT_ClosePrecharge_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CONT_ClosePrecharge_CallbackBool &&
+      Mock.CONT_ClosePrecharge_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.CONT_ClosePrecharge_CallbackFunctionPointer(stringNumber, Mock.CONT_ClosePrecharge_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_CONT_ClosePrecharge,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CONT_ClosePrecharge_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CONT_ClosePrecharge_CallbackFunctionPointer(stringNumber, Mock.CONT_ClosePrecharge_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CONT_ClosePrecharge(CMOCK_CONT_ClosePrecharge_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber);
+void CMockExpectParameters_CONT_ClosePrecharge(CMOCK_CONT_ClosePrecharge_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void CONT_ClosePrecharge_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_ClosePrecharge_CALL_INSTANCE));
+  CMOCK_CONT_ClosePrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_ClosePrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_ClosePrecharge_CallInstance = CMock_Guts_MemChain(Mock.CONT_ClosePrecharge_CallInstance, cmock_guts_index);
+  Mock.CONT_ClosePrecharge_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CONT_ClosePrecharge_IgnoreBool = (char)1;
+}
+
+void CONT_ClosePrecharge_CMockStopIgnore(void)
+{
+  if(Mock.CONT_ClosePrecharge_IgnoreBool)
+    Mock.CONT_ClosePrecharge_CallInstance = CMock_Guts_MemNext(Mock.CONT_ClosePrecharge_CallInstance);
+  Mock.CONT_ClosePrecharge_IgnoreBool = (char)0;
+}
+
+void CONT_ClosePrecharge_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_ClosePrecharge_CALL_INSTANCE));
+  CMOCK_CONT_ClosePrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_ClosePrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_ClosePrecharge_CallInstance = CMock_Guts_MemChain(Mock.CONT_ClosePrecharge_CallInstance, cmock_guts_index);
+  Mock.CONT_ClosePrecharge_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_ClosePrecharge(cmock_call_instance, stringNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CONT_ClosePrecharge_AddCallback(CMOCK_CONT_ClosePrecharge_CALLBACK Callback)
+{
+  Mock.CONT_ClosePrecharge_IgnoreBool = (char)0;
+  Mock.CONT_ClosePrecharge_CallbackBool = (char)1;
+  Mock.CONT_ClosePrecharge_CallbackFunctionPointer = Callback;
+}
+
+void CONT_ClosePrecharge_Stub(CMOCK_CONT_ClosePrecharge_CALLBACK Callback)
+{
+  Mock.CONT_ClosePrecharge_IgnoreBool = (char)0;
+  Mock.CONT_ClosePrecharge_CallbackBool = (char)0;
+  Mock.CONT_ClosePrecharge_CallbackFunctionPointer = Callback;
+}
+
+void CONT_ClosePrecharge_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_ClosePrecharge_CALL_INSTANCE));
+  CMOCK_CONT_ClosePrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_ClosePrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_ClosePrecharge_CallInstance = CMock_Guts_MemChain(Mock.CONT_ClosePrecharge_CallInstance, cmock_guts_index);
+  Mock.CONT_ClosePrecharge_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_ClosePrecharge(cmock_call_instance, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CONT_ClosePrecharge_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CONT_ClosePrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_ClosePrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CONT_ClosePrecharge_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+STD_RETURN_TYPE_e CONT_OpenPrecharge(uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_OpenPrecharge_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_OpenPrecharge);
+  cmock_call_instance = (CMOCK_CONT_OpenPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_OpenPrecharge_CallInstance);
+  Mock.CONT_OpenPrecharge_CallInstance = CMock_Guts_MemNext(Mock.CONT_OpenPrecharge_CallInstance);
+  if (Mock.CONT_OpenPrecharge_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.CONT_OpenPrecharge_FinalReturn;
+    memcpy((void*)(&Mock.CONT_OpenPrecharge_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.CONT_OpenPrecharge_CallbackBool &&
+      Mock.CONT_OpenPrecharge_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.CONT_OpenPrecharge_CallbackFunctionPointer(stringNumber, Mock.CONT_OpenPrecharge_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_CONT_OpenPrecharge,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.CONT_OpenPrecharge_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.CONT_OpenPrecharge_CallbackFunctionPointer(stringNumber, Mock.CONT_OpenPrecharge_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_CONT_OpenPrecharge(CMOCK_CONT_OpenPrecharge_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber);
+void CMockExpectParameters_CONT_OpenPrecharge(CMOCK_CONT_OpenPrecharge_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void CONT_OpenPrecharge_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_OpenPrecharge_CALL_INSTANCE));
+  CMOCK_CONT_OpenPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_OpenPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_OpenPrecharge_CallInstance = CMock_Guts_MemChain(Mock.CONT_OpenPrecharge_CallInstance, cmock_guts_index);
+  Mock.CONT_OpenPrecharge_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.CONT_OpenPrecharge_IgnoreBool = (char)1;
+}
+
+void CONT_OpenPrecharge_CMockStopIgnore(void)
+{
+  if(Mock.CONT_OpenPrecharge_IgnoreBool)
+    Mock.CONT_OpenPrecharge_CallInstance = CMock_Guts_MemNext(Mock.CONT_OpenPrecharge_CallInstance);
+  Mock.CONT_OpenPrecharge_IgnoreBool = (char)0;
+}
+
+void CONT_OpenPrecharge_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_OpenPrecharge_CALL_INSTANCE));
+  CMOCK_CONT_OpenPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_OpenPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_OpenPrecharge_CallInstance = CMock_Guts_MemChain(Mock.CONT_OpenPrecharge_CallInstance, cmock_guts_index);
+  Mock.CONT_OpenPrecharge_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_OpenPrecharge(cmock_call_instance, stringNumber);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void CONT_OpenPrecharge_AddCallback(CMOCK_CONT_OpenPrecharge_CALLBACK Callback)
+{
+  Mock.CONT_OpenPrecharge_IgnoreBool = (char)0;
+  Mock.CONT_OpenPrecharge_CallbackBool = (char)1;
+  Mock.CONT_OpenPrecharge_CallbackFunctionPointer = Callback;
+}
+
+void CONT_OpenPrecharge_Stub(CMOCK_CONT_OpenPrecharge_CALLBACK Callback)
+{
+  Mock.CONT_OpenPrecharge_IgnoreBool = (char)0;
+  Mock.CONT_OpenPrecharge_CallbackBool = (char)0;
+  Mock.CONT_OpenPrecharge_CallbackFunctionPointer = Callback;
+}
+
+void CONT_OpenPrecharge_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_OpenPrecharge_CALL_INSTANCE));
+  CMOCK_CONT_OpenPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_OpenPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_OpenPrecharge_CallInstance = CMock_Guts_MemChain(Mock.CONT_OpenPrecharge_CallInstance, cmock_guts_index);
+  Mock.CONT_OpenPrecharge_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_CONT_OpenPrecharge(cmock_call_instance, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CONT_OpenPrecharge_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_CONT_OpenPrecharge_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_OpenPrecharge_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.CONT_OpenPrecharge_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+void CONT_CheckFeedback(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_CheckFeedback_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_CheckFeedback);
+  cmock_call_instance = (CMOCK_CONT_CheckFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_CheckFeedback_CallInstance);
+  Mock.CONT_CheckFeedback_CallInstance = CMock_Guts_MemNext(Mock.CONT_CheckFeedback_CallInstance);
+  if (Mock.CONT_CheckFeedback_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.CONT_CheckFeedback_CallbackBool &&
+      Mock.CONT_CheckFeedback_CallbackFunctionPointer != NULL)
+  {
+    Mock.CONT_CheckFeedback_CallbackFunctionPointer(Mock.CONT_CheckFeedback_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.CONT_CheckFeedback_CallbackFunctionPointer != NULL)
+  {
+    Mock.CONT_CheckFeedback_CallbackFunctionPointer(Mock.CONT_CheckFeedback_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CONT_CheckFeedback_CMockIgnore(void)
+{
+  Mock.CONT_CheckFeedback_IgnoreBool = (char)1;
+}
+
+void CONT_CheckFeedback_CMockStopIgnore(void)
+{
+  Mock.CONT_CheckFeedback_IgnoreBool = (char)0;
+}
+
+void CONT_CheckFeedback_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_CheckFeedback_CALL_INSTANCE));
+  CMOCK_CONT_CheckFeedback_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_CheckFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_CheckFeedback_CallInstance = CMock_Guts_MemChain(Mock.CONT_CheckFeedback_CallInstance, cmock_guts_index);
+  Mock.CONT_CheckFeedback_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void CONT_CheckFeedback_AddCallback(CMOCK_CONT_CheckFeedback_CALLBACK Callback)
+{
+  Mock.CONT_CheckFeedback_IgnoreBool = (char)0;
+  Mock.CONT_CheckFeedback_CallbackBool = (char)1;
+  Mock.CONT_CheckFeedback_CallbackFunctionPointer = Callback;
+}
+
+void CONT_CheckFeedback_Stub(CMOCK_CONT_CheckFeedback_CALLBACK Callback)
+{
+  Mock.CONT_CheckFeedback_IgnoreBool = (char)0;
+  Mock.CONT_CheckFeedback_CallbackBool = (char)0;
+  Mock.CONT_CheckFeedback_CallbackFunctionPointer = Callback;
+}
+
+void CONT_CheckFeedback_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_CheckFeedback_CALL_INSTANCE));
+  CMOCK_CONT_CheckFeedback_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_CheckFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_CheckFeedback_CallInstance = CMock_Guts_MemChain(Mock.CONT_CheckFeedback_CallInstance, cmock_guts_index);
+  Mock.CONT_CheckFeedback_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void CONT_Initialize(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_CONT_Initialize_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_CONT_Initialize);
+  cmock_call_instance = (CMOCK_CONT_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.CONT_Initialize_CallInstance);
+  Mock.CONT_Initialize_CallInstance = CMock_Guts_MemNext(Mock.CONT_Initialize_CallInstance);
+  if (Mock.CONT_Initialize_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.CONT_Initialize_CallbackBool &&
+      Mock.CONT_Initialize_CallbackFunctionPointer != NULL)
+  {
+    Mock.CONT_Initialize_CallbackFunctionPointer(Mock.CONT_Initialize_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.CONT_Initialize_CallbackFunctionPointer != NULL)
+  {
+    Mock.CONT_Initialize_CallbackFunctionPointer(Mock.CONT_Initialize_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CONT_Initialize_CMockIgnore(void)
+{
+  Mock.CONT_Initialize_IgnoreBool = (char)1;
+}
+
+void CONT_Initialize_CMockStopIgnore(void)
+{
+  Mock.CONT_Initialize_IgnoreBool = (char)0;
+}
+
+void CONT_Initialize_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_Initialize_CALL_INSTANCE));
+  CMOCK_CONT_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_Initialize_CallInstance = CMock_Guts_MemChain(Mock.CONT_Initialize_CallInstance, cmock_guts_index);
+  Mock.CONT_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void CONT_Initialize_AddCallback(CMOCK_CONT_Initialize_CALLBACK Callback)
+{
+  Mock.CONT_Initialize_IgnoreBool = (char)0;
+  Mock.CONT_Initialize_CallbackBool = (char)1;
+  Mock.CONT_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void CONT_Initialize_Stub(CMOCK_CONT_Initialize_CALLBACK Callback)
+{
+  Mock.CONT_Initialize_IgnoreBool = (char)0;
+  Mock.CONT_Initialize_CallbackBool = (char)0;
+  Mock.CONT_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void CONT_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_CONT_Initialize_CALL_INSTANCE));
+  CMOCK_CONT_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_CONT_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.CONT_Initialize_CallInstance = CMock_Guts_MemChain(Mock.CONT_Initialize_CallInstance, cmock_guts_index);
+  Mock.CONT_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CONT_InitializationCheckOfContactorRegistry(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CONT_InitializationCheckOfContactorRegistry);
+  cmock_call_instance = (CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallInstance);
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallInstance = CMock_Guts_MemNext(Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallInstance);
+  if (Mock.TEST_CONT_InitializationCheckOfContactorRegistry_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackBool &&
+      Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackFunctionPointer(Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackFunctionPointer(Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void TEST_CONT_InitializationCheckOfContactorRegistry_CMockIgnore(void)
+{
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_IgnoreBool = (char)1;
+}
+
+void TEST_CONT_InitializationCheckOfContactorRegistry_CMockStopIgnore(void)
+{
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_IgnoreBool = (char)0;
+}
+
+void TEST_CONT_InitializationCheckOfContactorRegistry_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE));
+  CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallInstance = CMock_Guts_MemChain(Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallInstance, cmock_guts_index);
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void TEST_CONT_InitializationCheckOfContactorRegistry_AddCallback(CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALLBACK Callback)
+{
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_IgnoreBool = (char)0;
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackBool = (char)1;
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CONT_InitializationCheckOfContactorRegistry_Stub(CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALLBACK Callback)
+{
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_IgnoreBool = (char)0;
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackBool = (char)0;
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CONT_InitializationCheckOfContactorRegistry_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE));
+  CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallInstance = CMock_Guts_MemChain(Mock.TEST_CONT_InitializationCheckOfContactorRegistry_CallInstance, cmock_guts_index);
+  Mock.TEST_CONT_InitializationCheckOfContactorRegistry_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+CONT_CONTACTOR_INDEX TEST_CONT_ResolveContactorName(const CONT_NAMES_e name)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_CONT_ResolveContactorName);
+  cmock_call_instance = (CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_CONT_ResolveContactorName_CallInstance);
+  Mock.TEST_CONT_ResolveContactorName_CallInstance = CMock_Guts_MemNext(Mock.TEST_CONT_ResolveContactorName_CallInstance);
+  if (Mock.TEST_CONT_ResolveContactorName_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_CONT_ResolveContactorName_FinalReturn;
+    memcpy((void*)(&Mock.TEST_CONT_ResolveContactorName_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(CONT_CONTACTOR_INDEX[sizeof(cmock_call_instance->ReturnVal) == sizeof(CONT_CONTACTOR_INDEX) ? 1 : -1])); /* add CONT_CONTACTOR_INDEX to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_CONT_ResolveContactorName_CallbackBool &&
+      Mock.TEST_CONT_ResolveContactorName_CallbackFunctionPointer != NULL)
+  {
+    CONT_CONTACTOR_INDEX cmock_cb_ret = Mock.TEST_CONT_ResolveContactorName_CallbackFunctionPointer(name, Mock.TEST_CONT_ResolveContactorName_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_name)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_CONT_ResolveContactorName,CMockString_name);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_name), (void*)(&name), sizeof(CONT_NAMES_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_CONT_ResolveContactorName_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_CONT_ResolveContactorName_CallbackFunctionPointer(name, Mock.TEST_CONT_ResolveContactorName_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_CONT_ResolveContactorName(CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE* cmock_call_instance, const CONT_NAMES_e name);
+void CMockExpectParameters_TEST_CONT_ResolveContactorName(CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE* cmock_call_instance, const CONT_NAMES_e name)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_name), (void*)(&name),
+         sizeof(CONT_NAMES_e[sizeof(name) == sizeof(CONT_NAMES_e) ? 1 : -1])); /* add CONT_NAMES_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_name = 0;
+}
+
+void TEST_CONT_ResolveContactorName_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CONT_CONTACTOR_INDEX cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE));
+  CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CONT_ResolveContactorName_CallInstance = CMock_Guts_MemChain(Mock.TEST_CONT_ResolveContactorName_CallInstance, cmock_guts_index);
+  Mock.TEST_CONT_ResolveContactorName_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_CONT_ResolveContactorName_IgnoreBool = (char)1;
+}
+
+void TEST_CONT_ResolveContactorName_CMockStopIgnore(void)
+{
+  if(Mock.TEST_CONT_ResolveContactorName_IgnoreBool)
+    Mock.TEST_CONT_ResolveContactorName_CallInstance = CMock_Guts_MemNext(Mock.TEST_CONT_ResolveContactorName_CallInstance);
+  Mock.TEST_CONT_ResolveContactorName_IgnoreBool = (char)0;
+}
+
+void TEST_CONT_ResolveContactorName_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CONT_CONTACTOR_INDEX cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE));
+  CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CONT_ResolveContactorName_CallInstance = CMock_Guts_MemChain(Mock.TEST_CONT_ResolveContactorName_CallInstance, cmock_guts_index);
+  Mock.TEST_CONT_ResolveContactorName_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CONT_ResolveContactorName(cmock_call_instance, name);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(CONT_CONTACTOR_INDEX[sizeof(cmock_to_return) == sizeof(CONT_CONTACTOR_INDEX) ? 1 : -1])); /* add CONT_CONTACTOR_INDEX to :treat_as_array if this causes an error */
+}
+
+void TEST_CONT_ResolveContactorName_AddCallback(CMOCK_TEST_CONT_ResolveContactorName_CALLBACK Callback)
+{
+  Mock.TEST_CONT_ResolveContactorName_IgnoreBool = (char)0;
+  Mock.TEST_CONT_ResolveContactorName_CallbackBool = (char)1;
+  Mock.TEST_CONT_ResolveContactorName_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CONT_ResolveContactorName_Stub(CMOCK_TEST_CONT_ResolveContactorName_CALLBACK Callback)
+{
+  Mock.TEST_CONT_ResolveContactorName_IgnoreBool = (char)0;
+  Mock.TEST_CONT_ResolveContactorName_CallbackBool = (char)0;
+  Mock.TEST_CONT_ResolveContactorName_CallbackFunctionPointer = Callback;
+}
+
+void TEST_CONT_ResolveContactorName_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE));
+  CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_CONT_ResolveContactorName_CallInstance = CMock_Guts_MemChain(Mock.TEST_CONT_ResolveContactorName_CallInstance, cmock_guts_index);
+  Mock.TEST_CONT_ResolveContactorName_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_CONT_ResolveContactorName(cmock_call_instance, name);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_CONT_ResolveContactorName_CMockIgnoreArg_name(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_CONT_ResolveContactorName_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_CONT_ResolveContactorName_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_name = 1;
+}
+
@@ -0,0 +1,208 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKCONTACTOR_H
+#define _MOCKCONTACTOR_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "contactor.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockcontactor_Init(void);
+void Mockcontactor_Destroy(void);
+void Mockcontactor_Verify(void);
+
+
+
+
+#define CONT_GetContactorSetValue_IgnoreAndReturn(cmock_retval) CONT_GetContactorSetValue_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CONT_GetContactorSetValue_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CONT_ELECTRICAL_STATE_TYPE_e cmock_to_return);
+#define CONT_GetContactorSetValue_StopIgnore() CONT_GetContactorSetValue_CMockStopIgnore()
+void CONT_GetContactorSetValue_CMockStopIgnore(void);
+#define CONT_GetContactorSetValue_ExpectAndReturn(name, cmock_retval) CONT_GetContactorSetValue_CMockExpectAndReturn(__LINE__, name, cmock_retval)
+void CONT_GetContactorSetValue_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e cmock_to_return);
+typedef CONT_ELECTRICAL_STATE_TYPE_e (* CMOCK_CONT_GetContactorSetValue_CALLBACK)(const CONT_NAMES_e name, int cmock_num_calls);
+void CONT_GetContactorSetValue_AddCallback(CMOCK_CONT_GetContactorSetValue_CALLBACK Callback);
+void CONT_GetContactorSetValue_Stub(CMOCK_CONT_GetContactorSetValue_CALLBACK Callback);
+#define CONT_GetContactorSetValue_StubWithCallback CONT_GetContactorSetValue_Stub
+#define CONT_GetContactorSetValue_ExpectAndThrow(name, cmock_to_throw) CONT_GetContactorSetValue_CMockExpectAndThrow(__LINE__, name, cmock_to_throw)
+void CONT_GetContactorSetValue_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CEXCEPTION_T cmock_to_throw);
+#define CONT_GetContactorSetValue_IgnoreArg_name() CONT_GetContactorSetValue_CMockIgnoreArg_name(__LINE__)
+void CONT_GetContactorSetValue_CMockIgnoreArg_name(UNITY_LINE_TYPE cmock_line);
+#define CONT_GetContactorFeedback_Ignore() CONT_GetContactorFeedback_CMockIgnore()
+void CONT_GetContactorFeedback_CMockIgnore(void);
+#define CONT_GetContactorFeedback_StopIgnore() CONT_GetContactorFeedback_CMockStopIgnore()
+void CONT_GetContactorFeedback_CMockStopIgnore(void);
+#define CONT_GetContactorFeedback_Expect() CONT_GetContactorFeedback_CMockExpect(__LINE__)
+void CONT_GetContactorFeedback_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_CONT_GetContactorFeedback_CALLBACK)(int cmock_num_calls);
+void CONT_GetContactorFeedback_AddCallback(CMOCK_CONT_GetContactorFeedback_CALLBACK Callback);
+void CONT_GetContactorFeedback_Stub(CMOCK_CONT_GetContactorFeedback_CALLBACK Callback);
+#define CONT_GetContactorFeedback_StubWithCallback CONT_GetContactorFeedback_Stub
+#define CONT_GetContactorFeedback_ExpectAndThrow(cmock_to_throw) CONT_GetContactorFeedback_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void CONT_GetContactorFeedback_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define CONT_SetContactorState_IgnoreAndReturn(cmock_retval) CONT_SetContactorState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CONT_SetContactorState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define CONT_SetContactorState_StopIgnore() CONT_SetContactorState_CMockStopIgnore()
+void CONT_SetContactorState_CMockStopIgnore(void);
+#define CONT_SetContactorState_ExpectAndReturn(name, requestedContactorState, cmock_retval) CONT_SetContactorState_CMockExpectAndReturn(__LINE__, name, requestedContactorState, cmock_retval)
+void CONT_SetContactorState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e requestedContactorState, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_CONT_SetContactorState_CALLBACK)(const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e requestedContactorState, int cmock_num_calls);
+void CONT_SetContactorState_AddCallback(CMOCK_CONT_SetContactorState_CALLBACK Callback);
+void CONT_SetContactorState_Stub(CMOCK_CONT_SetContactorState_CALLBACK Callback);
+#define CONT_SetContactorState_StubWithCallback CONT_SetContactorState_Stub
+#define CONT_SetContactorState_ExpectAndThrow(name, requestedContactorState, cmock_to_throw) CONT_SetContactorState_CMockExpectAndThrow(__LINE__, name, requestedContactorState, cmock_to_throw)
+void CONT_SetContactorState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CONT_ELECTRICAL_STATE_TYPE_e requestedContactorState, CEXCEPTION_T cmock_to_throw);
+#define CONT_SetContactorState_IgnoreArg_name() CONT_SetContactorState_CMockIgnoreArg_name(__LINE__)
+void CONT_SetContactorState_CMockIgnoreArg_name(UNITY_LINE_TYPE cmock_line);
+#define CONT_SetContactorState_IgnoreArg_requestedContactorState() CONT_SetContactorState_CMockIgnoreArg_requestedContactorState(__LINE__)
+void CONT_SetContactorState_CMockIgnoreArg_requestedContactorState(UNITY_LINE_TYPE cmock_line);
+#define CONT_GetState_IgnoreAndReturn(cmock_retval) CONT_GetState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CONT_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CONT_ELECTRICAL_STATE_TYPE_e cmock_to_return);
+#define CONT_GetState_StopIgnore() CONT_GetState_CMockStopIgnore()
+void CONT_GetState_CMockStopIgnore(void);
+#define CONT_GetState_ExpectAndReturn(contactorNumber, cmock_retval) CONT_GetState_CMockExpectAndReturn(__LINE__, contactorNumber, cmock_retval)
+void CONT_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t contactorNumber, CONT_ELECTRICAL_STATE_TYPE_e cmock_to_return);
+typedef CONT_ELECTRICAL_STATE_TYPE_e (* CMOCK_CONT_GetState_CALLBACK)(uint8_t contactorNumber, int cmock_num_calls);
+void CONT_GetState_AddCallback(CMOCK_CONT_GetState_CALLBACK Callback);
+void CONT_GetState_Stub(CMOCK_CONT_GetState_CALLBACK Callback);
+#define CONT_GetState_StubWithCallback CONT_GetState_Stub
+#define CONT_GetState_ExpectAndThrow(contactorNumber, cmock_to_throw) CONT_GetState_CMockExpectAndThrow(__LINE__, contactorNumber, cmock_to_throw)
+void CONT_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t contactorNumber, CEXCEPTION_T cmock_to_throw);
+#define CONT_GetState_IgnoreArg_contactorNumber() CONT_GetState_CMockIgnoreArg_contactorNumber(__LINE__)
+void CONT_GetState_CMockIgnoreArg_contactorNumber(UNITY_LINE_TYPE cmock_line);
+#define CONT_CloseString_IgnoreAndReturn(cmock_retval) CONT_CloseString_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CONT_CloseString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define CONT_CloseString_StopIgnore() CONT_CloseString_CMockStopIgnore()
+void CONT_CloseString_CMockStopIgnore(void);
+#define CONT_CloseString_ExpectAndReturn(stringNumber, cmock_retval) CONT_CloseString_CMockExpectAndReturn(__LINE__, stringNumber, cmock_retval)
+void CONT_CloseString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_CONT_CloseString_CALLBACK)(uint8_t stringNumber, int cmock_num_calls);
+void CONT_CloseString_AddCallback(CMOCK_CONT_CloseString_CALLBACK Callback);
+void CONT_CloseString_Stub(CMOCK_CONT_CloseString_CALLBACK Callback);
+#define CONT_CloseString_StubWithCallback CONT_CloseString_Stub
+#define CONT_CloseString_ExpectAndThrow(stringNumber, cmock_to_throw) CONT_CloseString_CMockExpectAndThrow(__LINE__, stringNumber, cmock_to_throw)
+void CONT_CloseString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define CONT_CloseString_IgnoreArg_stringNumber() CONT_CloseString_CMockIgnoreArg_stringNumber(__LINE__)
+void CONT_CloseString_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define CONT_OpenString_IgnoreAndReturn(cmock_retval) CONT_OpenString_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CONT_OpenString_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define CONT_OpenString_StopIgnore() CONT_OpenString_CMockStopIgnore()
+void CONT_OpenString_CMockStopIgnore(void);
+#define CONT_OpenString_ExpectAndReturn(stringNumber, cmock_retval) CONT_OpenString_CMockExpectAndReturn(__LINE__, stringNumber, cmock_retval)
+void CONT_OpenString_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_CONT_OpenString_CALLBACK)(uint8_t stringNumber, int cmock_num_calls);
+void CONT_OpenString_AddCallback(CMOCK_CONT_OpenString_CALLBACK Callback);
+void CONT_OpenString_Stub(CMOCK_CONT_OpenString_CALLBACK Callback);
+#define CONT_OpenString_StubWithCallback CONT_OpenString_Stub
+#define CONT_OpenString_ExpectAndThrow(stringNumber, cmock_to_throw) CONT_OpenString_CMockExpectAndThrow(__LINE__, stringNumber, cmock_to_throw)
+void CONT_OpenString_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define CONT_OpenString_IgnoreArg_stringNumber() CONT_OpenString_CMockIgnoreArg_stringNumber(__LINE__)
+void CONT_OpenString_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define CONT_ClosePrecharge_IgnoreAndReturn(cmock_retval) CONT_ClosePrecharge_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CONT_ClosePrecharge_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define CONT_ClosePrecharge_StopIgnore() CONT_ClosePrecharge_CMockStopIgnore()
+void CONT_ClosePrecharge_CMockStopIgnore(void);
+#define CONT_ClosePrecharge_ExpectAndReturn(stringNumber, cmock_retval) CONT_ClosePrecharge_CMockExpectAndReturn(__LINE__, stringNumber, cmock_retval)
+void CONT_ClosePrecharge_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_CONT_ClosePrecharge_CALLBACK)(uint8_t stringNumber, int cmock_num_calls);
+void CONT_ClosePrecharge_AddCallback(CMOCK_CONT_ClosePrecharge_CALLBACK Callback);
+void CONT_ClosePrecharge_Stub(CMOCK_CONT_ClosePrecharge_CALLBACK Callback);
+#define CONT_ClosePrecharge_StubWithCallback CONT_ClosePrecharge_Stub
+#define CONT_ClosePrecharge_ExpectAndThrow(stringNumber, cmock_to_throw) CONT_ClosePrecharge_CMockExpectAndThrow(__LINE__, stringNumber, cmock_to_throw)
+void CONT_ClosePrecharge_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define CONT_ClosePrecharge_IgnoreArg_stringNumber() CONT_ClosePrecharge_CMockIgnoreArg_stringNumber(__LINE__)
+void CONT_ClosePrecharge_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define CONT_OpenPrecharge_IgnoreAndReturn(cmock_retval) CONT_OpenPrecharge_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void CONT_OpenPrecharge_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define CONT_OpenPrecharge_StopIgnore() CONT_OpenPrecharge_CMockStopIgnore()
+void CONT_OpenPrecharge_CMockStopIgnore(void);
+#define CONT_OpenPrecharge_ExpectAndReturn(stringNumber, cmock_retval) CONT_OpenPrecharge_CMockExpectAndReturn(__LINE__, stringNumber, cmock_retval)
+void CONT_OpenPrecharge_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_CONT_OpenPrecharge_CALLBACK)(uint8_t stringNumber, int cmock_num_calls);
+void CONT_OpenPrecharge_AddCallback(CMOCK_CONT_OpenPrecharge_CALLBACK Callback);
+void CONT_OpenPrecharge_Stub(CMOCK_CONT_OpenPrecharge_CALLBACK Callback);
+#define CONT_OpenPrecharge_StubWithCallback CONT_OpenPrecharge_Stub
+#define CONT_OpenPrecharge_ExpectAndThrow(stringNumber, cmock_to_throw) CONT_OpenPrecharge_CMockExpectAndThrow(__LINE__, stringNumber, cmock_to_throw)
+void CONT_OpenPrecharge_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define CONT_OpenPrecharge_IgnoreArg_stringNumber() CONT_OpenPrecharge_CMockIgnoreArg_stringNumber(__LINE__)
+void CONT_OpenPrecharge_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define CONT_CheckFeedback_Ignore() CONT_CheckFeedback_CMockIgnore()
+void CONT_CheckFeedback_CMockIgnore(void);
+#define CONT_CheckFeedback_StopIgnore() CONT_CheckFeedback_CMockStopIgnore()
+void CONT_CheckFeedback_CMockStopIgnore(void);
+#define CONT_CheckFeedback_Expect() CONT_CheckFeedback_CMockExpect(__LINE__)
+void CONT_CheckFeedback_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_CONT_CheckFeedback_CALLBACK)(int cmock_num_calls);
+void CONT_CheckFeedback_AddCallback(CMOCK_CONT_CheckFeedback_CALLBACK Callback);
+void CONT_CheckFeedback_Stub(CMOCK_CONT_CheckFeedback_CALLBACK Callback);
+#define CONT_CheckFeedback_StubWithCallback CONT_CheckFeedback_Stub
+#define CONT_CheckFeedback_ExpectAndThrow(cmock_to_throw) CONT_CheckFeedback_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void CONT_CheckFeedback_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define CONT_Initialize_Ignore() CONT_Initialize_CMockIgnore()
+void CONT_Initialize_CMockIgnore(void);
+#define CONT_Initialize_StopIgnore() CONT_Initialize_CMockStopIgnore()
+void CONT_Initialize_CMockStopIgnore(void);
+#define CONT_Initialize_Expect() CONT_Initialize_CMockExpect(__LINE__)
+void CONT_Initialize_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_CONT_Initialize_CALLBACK)(int cmock_num_calls);
+void CONT_Initialize_AddCallback(CMOCK_CONT_Initialize_CALLBACK Callback);
+void CONT_Initialize_Stub(CMOCK_CONT_Initialize_CALLBACK Callback);
+#define CONT_Initialize_StubWithCallback CONT_Initialize_Stub
+#define CONT_Initialize_ExpectAndThrow(cmock_to_throw) CONT_Initialize_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void CONT_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_CONT_InitializationCheckOfContactorRegistry_Ignore() TEST_CONT_InitializationCheckOfContactorRegistry_CMockIgnore()
+void TEST_CONT_InitializationCheckOfContactorRegistry_CMockIgnore(void);
+#define TEST_CONT_InitializationCheckOfContactorRegistry_StopIgnore() TEST_CONT_InitializationCheckOfContactorRegistry_CMockStopIgnore()
+void TEST_CONT_InitializationCheckOfContactorRegistry_CMockStopIgnore(void);
+#define TEST_CONT_InitializationCheckOfContactorRegistry_Expect() TEST_CONT_InitializationCheckOfContactorRegistry_CMockExpect(__LINE__)
+void TEST_CONT_InitializationCheckOfContactorRegistry_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALLBACK)(int cmock_num_calls);
+void TEST_CONT_InitializationCheckOfContactorRegistry_AddCallback(CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALLBACK Callback);
+void TEST_CONT_InitializationCheckOfContactorRegistry_Stub(CMOCK_TEST_CONT_InitializationCheckOfContactorRegistry_CALLBACK Callback);
+#define TEST_CONT_InitializationCheckOfContactorRegistry_StubWithCallback TEST_CONT_InitializationCheckOfContactorRegistry_Stub
+#define TEST_CONT_InitializationCheckOfContactorRegistry_ExpectAndThrow(cmock_to_throw) TEST_CONT_InitializationCheckOfContactorRegistry_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TEST_CONT_InitializationCheckOfContactorRegistry_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_CONT_ResolveContactorName_IgnoreAndReturn(cmock_retval) TEST_CONT_ResolveContactorName_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_CONT_ResolveContactorName_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, CONT_CONTACTOR_INDEX cmock_to_return);
+#define TEST_CONT_ResolveContactorName_StopIgnore() TEST_CONT_ResolveContactorName_CMockStopIgnore()
+void TEST_CONT_ResolveContactorName_CMockStopIgnore(void);
+#define TEST_CONT_ResolveContactorName_ExpectAndReturn(name, cmock_retval) TEST_CONT_ResolveContactorName_CMockExpectAndReturn(__LINE__, name, cmock_retval)
+void TEST_CONT_ResolveContactorName_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CONT_CONTACTOR_INDEX cmock_to_return);
+typedef CONT_CONTACTOR_INDEX (* CMOCK_TEST_CONT_ResolveContactorName_CALLBACK)(const CONT_NAMES_e name, int cmock_num_calls);
+void TEST_CONT_ResolveContactorName_AddCallback(CMOCK_TEST_CONT_ResolveContactorName_CALLBACK Callback);
+void TEST_CONT_ResolveContactorName_Stub(CMOCK_TEST_CONT_ResolveContactorName_CALLBACK Callback);
+#define TEST_CONT_ResolveContactorName_StubWithCallback TEST_CONT_ResolveContactorName_Stub
+#define TEST_CONT_ResolveContactorName_ExpectAndThrow(name, cmock_to_throw) TEST_CONT_ResolveContactorName_CMockExpectAndThrow(__LINE__, name, cmock_to_throw)
+void TEST_CONT_ResolveContactorName_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const CONT_NAMES_e name, CEXCEPTION_T cmock_to_throw);
+#define TEST_CONT_ResolveContactorName_IgnoreArg_name() TEST_CONT_ResolveContactorName_CMockIgnoreArg_name(__LINE__)
+void TEST_CONT_ResolveContactorName_CMockIgnoreArg_name(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
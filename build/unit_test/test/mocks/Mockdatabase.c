@@ -0,0 +1,5237 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockdatabase.h"
+
+static const char* CMockString_DATA_CommitBackBuffer = "DATA_CommitBackBuffer";
+static const char* CMockString_DATA_DatabaseEntryUpdatedAtLeastOnce = "DATA_DatabaseEntryUpdatedAtLeastOnce";
+static const char* CMockString_DATA_DatabaseEntryUpdatedRecently = "DATA_DatabaseEntryUpdatedRecently";
+static const char* CMockString_DATA_DatabaseEntryUpdatedWithinInterval = "DATA_DatabaseEntryUpdatedWithinInterval";
+static const char* CMockString_DATA_DummyFunction = "DATA_DummyFunction";
+static const char* CMockString_DATA_GetBackBuffer = "DATA_GetBackBuffer";
+static const char* CMockString_DATA_GetDataBlockUpdates = "DATA_GetDataBlockUpdates";
+static const char* CMockString_DATA_GetFrontBuffer = "DATA_GetFrontBuffer";
+static const char* CMockString_DATA_GetMaximumNumberOfReadAttempts = "DATA_GetMaximumNumberOfReadAttempts";
+static const char* CMockString_DATA_Init = "DATA_Init";
+static const char* CMockString_DATA_ReadDataBlockRange = "DATA_ReadDataBlockRange";
+static const char* CMockString_DATA_Read_1_DataBlock = "DATA_Read_1_DataBlock";
+static const char* CMockString_DATA_Read_2_DataBlocks = "DATA_Read_2_DataBlocks";
+static const char* CMockString_DATA_Read_3_DataBlocks = "DATA_Read_3_DataBlocks";
+static const char* CMockString_DATA_Read_4_DataBlocks = "DATA_Read_4_DataBlocks";
+static const char* CMockString_DATA_SubscribeToDataBlock = "DATA_SubscribeToDataBlock";
+static const char* CMockString_DATA_Task = "DATA_Task";
+static const char* CMockString_DATA_Write_1_DataBlock = "DATA_Write_1_DataBlock";
+static const char* CMockString_DATA_Write_2_DataBlocks = "DATA_Write_2_DataBlocks";
+static const char* CMockString_DATA_Write_3_DataBlocks = "DATA_Write_3_DataBlocks";
+static const char* CMockString_DATA_Write_4_DataBlocks = "DATA_Write_4_DataBlocks";
+static const char* CMockString_TEST_DATA_CopyRange = "TEST_DATA_CopyRange";
+static const char* CMockString_TEST_DATA_GetSequenceCounter = "TEST_DATA_GetSequenceCounter";
+static const char* CMockString_TEST_DATA_NotifySubscribers = "TEST_DATA_NotifySubscribers";
+static const char* CMockString_TEST_DATA_ReadEntryWithSequenceLock = "TEST_DATA_ReadEntryWithSequenceLock";
+static const char* CMockString_TEST_DATA_ReadRangeWithSequenceLock = "TEST_DATA_ReadRangeWithSequenceLock";
+static const char* CMockString_TEST_DATA_SetSequenceCounter = "TEST_DATA_SetSequenceCounter";
+static const char* CMockString_TEST_DATA_WriteEntryWithSequenceLock = "TEST_DATA_WriteEntryWithSequenceLock";
+static const char* CMockString_blockId = "blockId";
+static const char* CMockString_length = "length";
+static const char* CMockString_notificationBits = "notificationBits";
+static const char* CMockString_offset = "offset";
+static const char* CMockString_pDataFromSender = "pDataFromSender";
+static const char* CMockString_pDataFromSender0 = "pDataFromSender0";
+static const char* CMockString_pDataFromSender1 = "pDataFromSender1";
+static const char* CMockString_pDataFromSender2 = "pDataFromSender2";
+static const char* CMockString_pDataFromSender3 = "pDataFromSender3";
+static const char* CMockString_pDataToReceiver = "pDataToReceiver";
+static const char* CMockString_pDataToReceiver0 = "pDataToReceiver0";
+static const char* CMockString_pDataToReceiver1 = "pDataToReceiver1";
+static const char* CMockString_pDataToReceiver2 = "pDataToReceiver2";
+static const char* CMockString_pDataToReceiver3 = "pDataToReceiver3";
+static const char* CMockString_pDatabaseEntry = "pDatabaseEntry";
+static const char* CMockString_timeInterval = "timeInterval";
+static const char* CMockString_timeout_ms = "timeout_ms";
+static const char* CMockString_value = "value";
+
+typedef struct _CMOCK_DATA_DummyFunction_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DATA_DummyFunction_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DATA_Init_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Task_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DATA_Task_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  void* Expected_pDataFromSender0;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataFromSender0_Used;
+  void* ReturnThruPtr_pDataFromSender0_Val;
+  size_t ReturnThruPtr_pDataFromSender0_Size;
+  char IgnoreArg_pDataFromSender0;
+
+} CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  void* Expected_pDataFromSender0;
+  void* Expected_pDataFromSender1;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataFromSender0_Used;
+  void* ReturnThruPtr_pDataFromSender0_Val;
+  size_t ReturnThruPtr_pDataFromSender0_Size;
+  char ReturnThruPtr_pDataFromSender1_Used;
+  void* ReturnThruPtr_pDataFromSender1_Val;
+  size_t ReturnThruPtr_pDataFromSender1_Size;
+  char IgnoreArg_pDataFromSender0;
+  char IgnoreArg_pDataFromSender1;
+
+} CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  void* Expected_pDataFromSender0;
+  void* Expected_pDataFromSender1;
+  void* Expected_pDataFromSender2;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataFromSender0_Used;
+  void* ReturnThruPtr_pDataFromSender0_Val;
+  size_t ReturnThruPtr_pDataFromSender0_Size;
+  char ReturnThruPtr_pDataFromSender1_Used;
+  void* ReturnThruPtr_pDataFromSender1_Val;
+  size_t ReturnThruPtr_pDataFromSender1_Size;
+  char ReturnThruPtr_pDataFromSender2_Used;
+  void* ReturnThruPtr_pDataFromSender2_Val;
+  size_t ReturnThruPtr_pDataFromSender2_Size;
+  char IgnoreArg_pDataFromSender0;
+  char IgnoreArg_pDataFromSender1;
+  char IgnoreArg_pDataFromSender2;
+
+} CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  void* Expected_pDataFromSender0;
+  void* Expected_pDataFromSender1;
+  void* Expected_pDataFromSender2;
+  void* Expected_pDataFromSender3;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataFromSender0_Used;
+  void* ReturnThruPtr_pDataFromSender0_Val;
+  size_t ReturnThruPtr_pDataFromSender0_Size;
+  char ReturnThruPtr_pDataFromSender1_Used;
+  void* ReturnThruPtr_pDataFromSender1_Val;
+  size_t ReturnThruPtr_pDataFromSender1_Size;
+  char ReturnThruPtr_pDataFromSender2_Used;
+  void* ReturnThruPtr_pDataFromSender2_Val;
+  size_t ReturnThruPtr_pDataFromSender2_Size;
+  char ReturnThruPtr_pDataFromSender3_Used;
+  void* ReturnThruPtr_pDataFromSender3_Val;
+  size_t ReturnThruPtr_pDataFromSender3_Size;
+  char IgnoreArg_pDataFromSender0;
+  char IgnoreArg_pDataFromSender1;
+  char IgnoreArg_pDataFromSender2;
+  char IgnoreArg_pDataFromSender3;
+
+} CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  void* Expected_pDataToReceiver0;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataToReceiver0_Used;
+  void* ReturnThruPtr_pDataToReceiver0_Val;
+  size_t ReturnThruPtr_pDataToReceiver0_Size;
+  char IgnoreArg_pDataToReceiver0;
+
+} CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  void* Expected_pDataToReceiver0;
+  void* Expected_pDataToReceiver1;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataToReceiver0_Used;
+  void* ReturnThruPtr_pDataToReceiver0_Val;
+  size_t ReturnThruPtr_pDataToReceiver0_Size;
+  char ReturnThruPtr_pDataToReceiver1_Used;
+  void* ReturnThruPtr_pDataToReceiver1_Val;
+  size_t ReturnThruPtr_pDataToReceiver1_Size;
+  char IgnoreArg_pDataToReceiver0;
+  char IgnoreArg_pDataToReceiver1;
+
+} CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  void* Expected_pDataToReceiver0;
+  void* Expected_pDataToReceiver1;
+  void* Expected_pDataToReceiver2;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataToReceiver0_Used;
+  void* ReturnThruPtr_pDataToReceiver0_Val;
+  size_t ReturnThruPtr_pDataToReceiver0_Size;
+  char ReturnThruPtr_pDataToReceiver1_Used;
+  void* ReturnThruPtr_pDataToReceiver1_Val;
+  size_t ReturnThruPtr_pDataToReceiver1_Size;
+  char ReturnThruPtr_pDataToReceiver2_Used;
+  void* ReturnThruPtr_pDataToReceiver2_Val;
+  size_t ReturnThruPtr_pDataToReceiver2_Size;
+  char IgnoreArg_pDataToReceiver0;
+  char IgnoreArg_pDataToReceiver1;
+  char IgnoreArg_pDataToReceiver2;
+
+} CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  void* Expected_pDataToReceiver0;
+  void* Expected_pDataToReceiver1;
+  void* Expected_pDataToReceiver2;
+  void* Expected_pDataToReceiver3;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataToReceiver0_Used;
+  void* ReturnThruPtr_pDataToReceiver0_Val;
+  size_t ReturnThruPtr_pDataToReceiver0_Size;
+  char ReturnThruPtr_pDataToReceiver1_Used;
+  void* ReturnThruPtr_pDataToReceiver1_Val;
+  size_t ReturnThruPtr_pDataToReceiver1_Size;
+  char ReturnThruPtr_pDataToReceiver2_Used;
+  void* ReturnThruPtr_pDataToReceiver2_Val;
+  size_t ReturnThruPtr_pDataToReceiver2_Size;
+  char ReturnThruPtr_pDataToReceiver3_Used;
+  void* ReturnThruPtr_pDataToReceiver3_Val;
+  size_t ReturnThruPtr_pDataToReceiver3_Size;
+  char IgnoreArg_pDataToReceiver0;
+  char IgnoreArg_pDataToReceiver1;
+  char IgnoreArg_pDataToReceiver2;
+  char IgnoreArg_pDataToReceiver3;
+
+} CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  void* Expected_pDataToReceiver;
+  uint16_t Expected_offset;
+  uint16_t Expected_length;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataToReceiver_Used;
+  void* ReturnThruPtr_pDataToReceiver_Val;
+  size_t ReturnThruPtr_pDataToReceiver_Size;
+  char IgnoreArg_blockId;
+  char IgnoreArg_pDataToReceiver;
+  char IgnoreArg_offset;
+  char IgnoreArg_length;
+
+} CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  uint32_t Expected_notificationBits;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+  char IgnoreArg_notificationBits;
+
+} CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_notificationBits;
+  uint32_t Expected_timeout_ms;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_notificationBits;
+  char IgnoreArg_timeout_ms;
+
+} CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_GetBackBuffer_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  void* ReturnVal;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_DATA_GetBackBuffer_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  const void* ReturnVal;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  void* Expected_pDatabaseEntry;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDatabaseEntry_Used;
+  void* ReturnThruPtr_pDatabaseEntry_Val;
+  size_t ReturnThruPtr_pDatabaseEntry_Size;
+  char IgnoreArg_pDatabaseEntry;
+
+} CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  void* Expected_pDatabaseEntry;
+  uint32_t Expected_timeInterval;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDatabaseEntry_Used;
+  void* ReturnThruPtr_pDatabaseEntry_Val;
+  size_t ReturnThruPtr_pDatabaseEntry_Size;
+  char IgnoreArg_pDatabaseEntry;
+  char IgnoreArg_timeInterval;
+
+} CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE;
+
+typedef struct _CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  void* Expected_pDatabaseEntry;
+  uint32_t Expected_timeInterval;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDatabaseEntry_Used;
+  void* ReturnThruPtr_pDatabaseEntry_Val;
+  size_t ReturnThruPtr_pDatabaseEntry_Size;
+  char IgnoreArg_pDatabaseEntry;
+  char IgnoreArg_timeInterval;
+
+} CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  void* Expected_pDataFromSender;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataFromSender_Used;
+  void* ReturnThruPtr_pDataFromSender_Val;
+  size_t ReturnThruPtr_pDataFromSender_Size;
+  char IgnoreArg_pDataFromSender;
+
+} CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  void* Expected_pDataToReceiver;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataToReceiver_Used;
+  void* ReturnThruPtr_pDataToReceiver_Val;
+  size_t ReturnThruPtr_pDataToReceiver_Size;
+  char IgnoreArg_pDataToReceiver;
+
+} CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  void* Expected_pDataToReceiver;
+  uint16_t Expected_offset;
+  uint16_t Expected_length;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataToReceiver_Used;
+  void* ReturnThruPtr_pDataToReceiver_Val;
+  size_t ReturnThruPtr_pDataToReceiver_Size;
+  char IgnoreArg_blockId;
+  char IgnoreArg_pDataToReceiver;
+  char IgnoreArg_offset;
+  char IgnoreArg_length;
+
+} CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  void* Expected_pDataToReceiver;
+  uint16_t Expected_offset;
+  uint16_t Expected_length;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pDataToReceiver_Used;
+  void* ReturnThruPtr_pDataToReceiver_Val;
+  size_t ReturnThruPtr_pDataToReceiver_Size;
+  char IgnoreArg_blockId;
+  char IgnoreArg_pDataToReceiver;
+  char IgnoreArg_offset;
+  char IgnoreArg_length;
+
+} CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  DATA_BLOCK_ID_e Expected_blockId;
+  uint32_t Expected_value;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+  char IgnoreArg_value;
+
+} CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE;
+
+static struct MockdatabaseInstance
+{
+  char DATA_DummyFunction_IgnoreBool;
+  char DATA_DummyFunction_CallbackBool;
+  CMOCK_DATA_DummyFunction_CALLBACK DATA_DummyFunction_CallbackFunctionPointer;
+  int DATA_DummyFunction_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_DummyFunction_CallInstance;
+  char DATA_Init_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_Init_FinalReturn;
+  char DATA_Init_CallbackBool;
+  CMOCK_DATA_Init_CALLBACK DATA_Init_CallbackFunctionPointer;
+  int DATA_Init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Init_CallInstance;
+  char DATA_Task_IgnoreBool;
+  char DATA_Task_CallbackBool;
+  CMOCK_DATA_Task_CALLBACK DATA_Task_CallbackFunctionPointer;
+  int DATA_Task_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Task_CallInstance;
+  char DATA_Write_1_DataBlock_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_Write_1_DataBlock_FinalReturn;
+  char DATA_Write_1_DataBlock_CallbackBool;
+  CMOCK_DATA_Write_1_DataBlock_CALLBACK DATA_Write_1_DataBlock_CallbackFunctionPointer;
+  int DATA_Write_1_DataBlock_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Write_1_DataBlock_CallInstance;
+  char DATA_Write_2_DataBlocks_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_Write_2_DataBlocks_FinalReturn;
+  char DATA_Write_2_DataBlocks_CallbackBool;
+  CMOCK_DATA_Write_2_DataBlocks_CALLBACK DATA_Write_2_DataBlocks_CallbackFunctionPointer;
+  int DATA_Write_2_DataBlocks_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Write_2_DataBlocks_CallInstance;
+  char DATA_Write_3_DataBlocks_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_Write_3_DataBlocks_FinalReturn;
+  char DATA_Write_3_DataBlocks_CallbackBool;
+  CMOCK_DATA_Write_3_DataBlocks_CALLBACK DATA_Write_3_DataBlocks_CallbackFunctionPointer;
+  int DATA_Write_3_DataBlocks_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Write_3_DataBlocks_CallInstance;
+  char DATA_Write_4_DataBlocks_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_Write_4_DataBlocks_FinalReturn;
+  char DATA_Write_4_DataBlocks_CallbackBool;
+  CMOCK_DATA_Write_4_DataBlocks_CALLBACK DATA_Write_4_DataBlocks_CallbackFunctionPointer;
+  int DATA_Write_4_DataBlocks_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Write_4_DataBlocks_CallInstance;
+  char DATA_Read_1_DataBlock_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_Read_1_DataBlock_FinalReturn;
+  char DATA_Read_1_DataBlock_CallbackBool;
+  CMOCK_DATA_Read_1_DataBlock_CALLBACK DATA_Read_1_DataBlock_CallbackFunctionPointer;
+  int DATA_Read_1_DataBlock_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Read_1_DataBlock_CallInstance;
+  char DATA_Read_2_DataBlocks_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_Read_2_DataBlocks_FinalReturn;
+  char DATA_Read_2_DataBlocks_CallbackBool;
+  CMOCK_DATA_Read_2_DataBlocks_CALLBACK DATA_Read_2_DataBlocks_CallbackFunctionPointer;
+  int DATA_Read_2_DataBlocks_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Read_2_DataBlocks_CallInstance;
+  char DATA_Read_3_DataBlocks_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_Read_3_DataBlocks_FinalReturn;
+  char DATA_Read_3_DataBlocks_CallbackBool;
+  CMOCK_DATA_Read_3_DataBlocks_CALLBACK DATA_Read_3_DataBlocks_CallbackFunctionPointer;
+  int DATA_Read_3_DataBlocks_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Read_3_DataBlocks_CallInstance;
+  char DATA_Read_4_DataBlocks_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_Read_4_DataBlocks_FinalReturn;
+  char DATA_Read_4_DataBlocks_CallbackBool;
+  CMOCK_DATA_Read_4_DataBlocks_CALLBACK DATA_Read_4_DataBlocks_CallbackFunctionPointer;
+  int DATA_Read_4_DataBlocks_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_Read_4_DataBlocks_CallInstance;
+  char DATA_ReadDataBlockRange_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_ReadDataBlockRange_FinalReturn;
+  char DATA_ReadDataBlockRange_CallbackBool;
+  CMOCK_DATA_ReadDataBlockRange_CALLBACK DATA_ReadDataBlockRange_CallbackFunctionPointer;
+  int DATA_ReadDataBlockRange_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_ReadDataBlockRange_CallInstance;
+  char DATA_SubscribeToDataBlock_IgnoreBool;
+  STD_RETURN_TYPE_e DATA_SubscribeToDataBlock_FinalReturn;
+  char DATA_SubscribeToDataBlock_CallbackBool;
+  CMOCK_DATA_SubscribeToDataBlock_CALLBACK DATA_SubscribeToDataBlock_CallbackFunctionPointer;
+  int DATA_SubscribeToDataBlock_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_SubscribeToDataBlock_CallInstance;
+  char DATA_GetDataBlockUpdates_IgnoreBool;
+  uint32_t DATA_GetDataBlockUpdates_FinalReturn;
+  char DATA_GetDataBlockUpdates_CallbackBool;
+  CMOCK_DATA_GetDataBlockUpdates_CALLBACK DATA_GetDataBlockUpdates_CallbackFunctionPointer;
+  int DATA_GetDataBlockUpdates_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_GetDataBlockUpdates_CallInstance;
+  char DATA_GetBackBuffer_IgnoreBool;
+  void* DATA_GetBackBuffer_FinalReturn;
+  char DATA_GetBackBuffer_CallbackBool;
+  CMOCK_DATA_GetBackBuffer_CALLBACK DATA_GetBackBuffer_CallbackFunctionPointer;
+  int DATA_GetBackBuffer_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_GetBackBuffer_CallInstance;
+  char DATA_CommitBackBuffer_IgnoreBool;
+  char DATA_CommitBackBuffer_CallbackBool;
+  CMOCK_DATA_CommitBackBuffer_CALLBACK DATA_CommitBackBuffer_CallbackFunctionPointer;
+  int DATA_CommitBackBuffer_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_CommitBackBuffer_CallInstance;
+  char DATA_GetFrontBuffer_IgnoreBool;
+  const void* DATA_GetFrontBuffer_FinalReturn;
+  char DATA_GetFrontBuffer_CallbackBool;
+  CMOCK_DATA_GetFrontBuffer_CALLBACK DATA_GetFrontBuffer_CallbackFunctionPointer;
+  int DATA_GetFrontBuffer_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_GetFrontBuffer_CallInstance;
+  char DATA_GetMaximumNumberOfReadAttempts_IgnoreBool;
+  uint8_t DATA_GetMaximumNumberOfReadAttempts_FinalReturn;
+  char DATA_GetMaximumNumberOfReadAttempts_CallbackBool;
+  CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALLBACK DATA_GetMaximumNumberOfReadAttempts_CallbackFunctionPointer;
+  int DATA_GetMaximumNumberOfReadAttempts_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_GetMaximumNumberOfReadAttempts_CallInstance;
+  char DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool;
+  _Bool DATA_DatabaseEntryUpdatedAtLeastOnce_FinalReturn;
+  char DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackBool;
+  CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALLBACK DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackFunctionPointer;
+  int DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance;
+  char DATA_DatabaseEntryUpdatedRecently_IgnoreBool;
+  _Bool DATA_DatabaseEntryUpdatedRecently_FinalReturn;
+  char DATA_DatabaseEntryUpdatedRecently_CallbackBool;
+  CMOCK_DATA_DatabaseEntryUpdatedRecently_CALLBACK DATA_DatabaseEntryUpdatedRecently_CallbackFunctionPointer;
+  int DATA_DatabaseEntryUpdatedRecently_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_DatabaseEntryUpdatedRecently_CallInstance;
+  char DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool;
+  _Bool DATA_DatabaseEntryUpdatedWithinInterval_FinalReturn;
+  char DATA_DatabaseEntryUpdatedWithinInterval_CallbackBool;
+  CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALLBACK DATA_DatabaseEntryUpdatedWithinInterval_CallbackFunctionPointer;
+  int DATA_DatabaseEntryUpdatedWithinInterval_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DATA_DatabaseEntryUpdatedWithinInterval_CallInstance;
+  char TEST_DATA_WriteEntryWithSequenceLock_IgnoreBool;
+  char TEST_DATA_WriteEntryWithSequenceLock_CallbackBool;
+  CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALLBACK TEST_DATA_WriteEntryWithSequenceLock_CallbackFunctionPointer;
+  int TEST_DATA_WriteEntryWithSequenceLock_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_DATA_WriteEntryWithSequenceLock_CallInstance;
+  char TEST_DATA_ReadEntryWithSequenceLock_IgnoreBool;
+  char TEST_DATA_ReadEntryWithSequenceLock_CallbackBool;
+  CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALLBACK TEST_DATA_ReadEntryWithSequenceLock_CallbackFunctionPointer;
+  int TEST_DATA_ReadEntryWithSequenceLock_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_DATA_ReadEntryWithSequenceLock_CallInstance;
+  char TEST_DATA_ReadRangeWithSequenceLock_IgnoreBool;
+  char TEST_DATA_ReadRangeWithSequenceLock_CallbackBool;
+  CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALLBACK TEST_DATA_ReadRangeWithSequenceLock_CallbackFunctionPointer;
+  int TEST_DATA_ReadRangeWithSequenceLock_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_DATA_ReadRangeWithSequenceLock_CallInstance;
+  char TEST_DATA_CopyRange_IgnoreBool;
+  char TEST_DATA_CopyRange_CallbackBool;
+  CMOCK_TEST_DATA_CopyRange_CALLBACK TEST_DATA_CopyRange_CallbackFunctionPointer;
+  int TEST_DATA_CopyRange_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_DATA_CopyRange_CallInstance;
+  char TEST_DATA_NotifySubscribers_IgnoreBool;
+  char TEST_DATA_NotifySubscribers_CallbackBool;
+  CMOCK_TEST_DATA_NotifySubscribers_CALLBACK TEST_DATA_NotifySubscribers_CallbackFunctionPointer;
+  int TEST_DATA_NotifySubscribers_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_DATA_NotifySubscribers_CallInstance;
+  char TEST_DATA_GetSequenceCounter_IgnoreBool;
+  uint32_t TEST_DATA_GetSequenceCounter_FinalReturn;
+  char TEST_DATA_GetSequenceCounter_CallbackBool;
+  CMOCK_TEST_DATA_GetSequenceCounter_CALLBACK TEST_DATA_GetSequenceCounter_CallbackFunctionPointer;
+  int TEST_DATA_GetSequenceCounter_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_DATA_GetSequenceCounter_CallInstance;
+  char TEST_DATA_SetSequenceCounter_IgnoreBool;
+  char TEST_DATA_SetSequenceCounter_CallbackBool;
+  CMOCK_TEST_DATA_SetSequenceCounter_CALLBACK TEST_DATA_SetSequenceCounter_CallbackFunctionPointer;
+  int TEST_DATA_SetSequenceCounter_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_DATA_SetSequenceCounter_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockdatabase_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.DATA_DummyFunction_CallInstance;
+  if (Mock.DATA_DummyFunction_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_DummyFunction);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_DummyFunction_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Init_CallInstance;
+  if (Mock.DATA_Init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Init);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Init_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Task_CallInstance;
+  if (Mock.DATA_Task_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Task);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Task_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Write_1_DataBlock_CallInstance;
+  if (Mock.DATA_Write_1_DataBlock_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Write_1_DataBlock);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Write_1_DataBlock_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Write_2_DataBlocks_CallInstance;
+  if (Mock.DATA_Write_2_DataBlocks_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Write_2_DataBlocks);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Write_2_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Write_3_DataBlocks_CallInstance;
+  if (Mock.DATA_Write_3_DataBlocks_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Write_3_DataBlocks);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Write_3_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Write_4_DataBlocks_CallInstance;
+  if (Mock.DATA_Write_4_DataBlocks_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Write_4_DataBlocks);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Write_4_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Read_1_DataBlock_CallInstance;
+  if (Mock.DATA_Read_1_DataBlock_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Read_1_DataBlock);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Read_1_DataBlock_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Read_2_DataBlocks_CallInstance;
+  if (Mock.DATA_Read_2_DataBlocks_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Read_2_DataBlocks);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Read_2_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Read_3_DataBlocks_CallInstance;
+  if (Mock.DATA_Read_3_DataBlocks_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Read_3_DataBlocks);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Read_3_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_Read_4_DataBlocks_CallInstance;
+  if (Mock.DATA_Read_4_DataBlocks_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_Read_4_DataBlocks);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_Read_4_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_ReadDataBlockRange_CallInstance;
+  if (Mock.DATA_ReadDataBlockRange_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_ReadDataBlockRange);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_ReadDataBlockRange_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_SubscribeToDataBlock_CallInstance;
+  if (Mock.DATA_SubscribeToDataBlock_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_SubscribeToDataBlock);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_SubscribeToDataBlock_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_GetDataBlockUpdates_CallInstance;
+  if (Mock.DATA_GetDataBlockUpdates_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_GetDataBlockUpdates);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_GetDataBlockUpdates_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_GetBackBuffer_CallInstance;
+  if (Mock.DATA_GetBackBuffer_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_GetBackBuffer);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_GetBackBuffer_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_CommitBackBuffer_CallInstance;
+  if (Mock.DATA_CommitBackBuffer_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_CommitBackBuffer);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_CommitBackBuffer_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_GetFrontBuffer_CallInstance;
+  if (Mock.DATA_GetFrontBuffer_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_GetFrontBuffer);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_GetFrontBuffer_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance;
+  if (Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_GetMaximumNumberOfReadAttempts);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance;
+  if (Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_DatabaseEntryUpdatedAtLeastOnce);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance;
+  if (Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_DatabaseEntryUpdatedRecently);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_DatabaseEntryUpdatedRecently_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance;
+  if (Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DATA_DatabaseEntryUpdatedWithinInterval);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance;
+  if (Mock.TEST_DATA_WriteEntryWithSequenceLock_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_DATA_WriteEntryWithSequenceLock);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance;
+  if (Mock.TEST_DATA_ReadEntryWithSequenceLock_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_DATA_ReadEntryWithSequenceLock);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance;
+  if (Mock.TEST_DATA_ReadRangeWithSequenceLock_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_DATA_ReadRangeWithSequenceLock);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_DATA_CopyRange_CallInstance;
+  if (Mock.TEST_DATA_CopyRange_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_DATA_CopyRange);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_DATA_CopyRange_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_DATA_NotifySubscribers_CallInstance;
+  if (Mock.TEST_DATA_NotifySubscribers_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_DATA_NotifySubscribers);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_DATA_NotifySubscribers_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_DATA_GetSequenceCounter_CallInstance;
+  if (Mock.TEST_DATA_GetSequenceCounter_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_DATA_GetSequenceCounter);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_DATA_GetSequenceCounter_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_DATA_SetSequenceCounter_CallInstance;
+  if (Mock.TEST_DATA_SetSequenceCounter_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_DATA_SetSequenceCounter);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_DATA_SetSequenceCounter_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockdatabase_Init(void)
+{
+  Mockdatabase_Destroy();
+}
+
+void Mockdatabase_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void DATA_DummyFunction(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_DummyFunction_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_DummyFunction);
+  cmock_call_instance = (CMOCK_DATA_DummyFunction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_DummyFunction_CallInstance);
+  Mock.DATA_DummyFunction_CallInstance = CMock_Guts_MemNext(Mock.DATA_DummyFunction_CallInstance);
+  if (Mock.DATA_DummyFunction_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DATA_DummyFunction_CallbackBool &&
+      Mock.DATA_DummyFunction_CallbackFunctionPointer != NULL)
+  {
+    Mock.DATA_DummyFunction_CallbackFunctionPointer(Mock.DATA_DummyFunction_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DATA_DummyFunction_CallbackFunctionPointer != NULL)
+  {
+    Mock.DATA_DummyFunction_CallbackFunctionPointer(Mock.DATA_DummyFunction_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DATA_DummyFunction_CMockIgnore(void)
+{
+  Mock.DATA_DummyFunction_IgnoreBool = (char)1;
+}
+
+void DATA_DummyFunction_CMockStopIgnore(void)
+{
+  Mock.DATA_DummyFunction_IgnoreBool = (char)0;
+}
+
+void DATA_DummyFunction_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DummyFunction_CALL_INSTANCE));
+  CMOCK_DATA_DummyFunction_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DummyFunction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DummyFunction_CallInstance = CMock_Guts_MemChain(Mock.DATA_DummyFunction_CallInstance, cmock_guts_index);
+  Mock.DATA_DummyFunction_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DATA_DummyFunction_AddCallback(CMOCK_DATA_DummyFunction_CALLBACK Callback)
+{
+  Mock.DATA_DummyFunction_IgnoreBool = (char)0;
+  Mock.DATA_DummyFunction_CallbackBool = (char)1;
+  Mock.DATA_DummyFunction_CallbackFunctionPointer = Callback;
+}
+
+void DATA_DummyFunction_Stub(CMOCK_DATA_DummyFunction_CALLBACK Callback)
+{
+  Mock.DATA_DummyFunction_IgnoreBool = (char)0;
+  Mock.DATA_DummyFunction_CallbackBool = (char)0;
+  Mock.DATA_DummyFunction_CallbackFunctionPointer = Callback;
+}
+
+void DATA_DummyFunction_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DummyFunction_CALL_INSTANCE));
+  CMOCK_DATA_DummyFunction_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DummyFunction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DummyFunction_CallInstance = CMock_Guts_MemChain(Mock.DATA_DummyFunction_CallInstance, cmock_guts_index);
+  Mock.DATA_DummyFunction_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e DATA_Init(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Init);
+  cmock_call_instance = (CMOCK_DATA_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Init_CallInstance);
+  Mock.DATA_Init_CallInstance = CMock_Guts_MemNext(Mock.DATA_Init_CallInstance);
+  if (Mock.DATA_Init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_Init_FinalReturn;
+    memcpy((void*)(&Mock.DATA_Init_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_Init_CallbackBool &&
+      Mock.DATA_Init_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_Init_CallbackFunctionPointer(Mock.DATA_Init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DATA_Init_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_Init_CallbackFunctionPointer(Mock.DATA_Init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DATA_Init_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Init_CALL_INSTANCE));
+  CMOCK_DATA_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Init_CallInstance = CMock_Guts_MemChain(Mock.DATA_Init_CallInstance, cmock_guts_index);
+  Mock.DATA_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_Init_IgnoreBool = (char)1;
+}
+
+void DATA_Init_CMockStopIgnore(void)
+{
+  if(Mock.DATA_Init_IgnoreBool)
+    Mock.DATA_Init_CallInstance = CMock_Guts_MemNext(Mock.DATA_Init_CallInstance);
+  Mock.DATA_Init_IgnoreBool = (char)0;
+}
+
+void DATA_Init_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Init_CALL_INSTANCE));
+  CMOCK_DATA_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Init_CallInstance = CMock_Guts_MemChain(Mock.DATA_Init_CallInstance, cmock_guts_index);
+  Mock.DATA_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_Init_AddCallback(CMOCK_DATA_Init_CALLBACK Callback)
+{
+  Mock.DATA_Init_IgnoreBool = (char)0;
+  Mock.DATA_Init_CallbackBool = (char)1;
+  Mock.DATA_Init_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Init_Stub(CMOCK_DATA_Init_CALLBACK Callback)
+{
+  Mock.DATA_Init_IgnoreBool = (char)0;
+  Mock.DATA_Init_CallbackBool = (char)0;
+  Mock.DATA_Init_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Init_CALL_INSTANCE));
+  CMOCK_DATA_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Init_CallInstance = CMock_Guts_MemChain(Mock.DATA_Init_CallInstance, cmock_guts_index);
+  Mock.DATA_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_Task(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Task_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Task);
+  cmock_call_instance = (CMOCK_DATA_Task_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Task_CallInstance);
+  Mock.DATA_Task_CallInstance = CMock_Guts_MemNext(Mock.DATA_Task_CallInstance);
+  if (Mock.DATA_Task_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DATA_Task_CallbackBool &&
+      Mock.DATA_Task_CallbackFunctionPointer != NULL)
+  {
+    Mock.DATA_Task_CallbackFunctionPointer(Mock.DATA_Task_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DATA_Task_CallbackFunctionPointer != NULL)
+  {
+    Mock.DATA_Task_CallbackFunctionPointer(Mock.DATA_Task_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DATA_Task_CMockIgnore(void)
+{
+  Mock.DATA_Task_IgnoreBool = (char)1;
+}
+
+void DATA_Task_CMockStopIgnore(void)
+{
+  Mock.DATA_Task_IgnoreBool = (char)0;
+}
+
+void DATA_Task_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Task_CALL_INSTANCE));
+  CMOCK_DATA_Task_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Task_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Task_CallInstance = CMock_Guts_MemChain(Mock.DATA_Task_CallInstance, cmock_guts_index);
+  Mock.DATA_Task_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DATA_Task_AddCallback(CMOCK_DATA_Task_CALLBACK Callback)
+{
+  Mock.DATA_Task_IgnoreBool = (char)0;
+  Mock.DATA_Task_CallbackBool = (char)1;
+  Mock.DATA_Task_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Task_Stub(CMOCK_DATA_Task_CALLBACK Callback)
+{
+  Mock.DATA_Task_IgnoreBool = (char)0;
+  Mock.DATA_Task_CallbackBool = (char)0;
+  Mock.DATA_Task_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Task_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Task_CALL_INSTANCE));
+  CMOCK_DATA_Task_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Task_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Task_CallInstance = CMock_Guts_MemChain(Mock.DATA_Task_CallInstance, cmock_guts_index);
+  Mock.DATA_Task_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e DATA_Write_1_DataBlock(void* pDataFromSender0)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Write_1_DataBlock);
+  cmock_call_instance = (CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Write_1_DataBlock_CallInstance);
+  Mock.DATA_Write_1_DataBlock_CallInstance = CMock_Guts_MemNext(Mock.DATA_Write_1_DataBlock_CallInstance);
+  if (Mock.DATA_Write_1_DataBlock_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_Write_1_DataBlock_FinalReturn;
+    memcpy((void*)(&Mock.DATA_Write_1_DataBlock_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_Write_1_DataBlock_CallbackBool &&
+      Mock.DATA_Write_1_DataBlock_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_Write_1_DataBlock_CallbackFunctionPointer(pDataFromSender0, Mock.DATA_Write_1_DataBlock_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender0)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_1_DataBlock,CMockString_pDataFromSender0);
+    if (cmock_call_instance->Expected_pDataFromSender0 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender0, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender0, pDataFromSender0, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.DATA_Write_1_DataBlock_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_Write_1_DataBlock_CallbackFunctionPointer(pDataFromSender0, Mock.DATA_Write_1_DataBlock_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender0, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender0, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender0_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender0_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_Write_1_DataBlock(CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender0);
+void CMockExpectParameters_DATA_Write_1_DataBlock(CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender0)
+{
+  cmock_call_instance->Expected_pDataFromSender0 = pDataFromSender0;
+  cmock_call_instance->IgnoreArg_pDataFromSender0 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used = 0;
+}
+
+void DATA_Write_1_DataBlock_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE));
+  CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_1_DataBlock_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_1_DataBlock_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_1_DataBlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_Write_1_DataBlock_IgnoreBool = (char)1;
+}
+
+void DATA_Write_1_DataBlock_CMockStopIgnore(void)
+{
+  if(Mock.DATA_Write_1_DataBlock_IgnoreBool)
+    Mock.DATA_Write_1_DataBlock_CallInstance = CMock_Guts_MemNext(Mock.DATA_Write_1_DataBlock_CallInstance);
+  Mock.DATA_Write_1_DataBlock_IgnoreBool = (char)0;
+}
+
+void DATA_Write_1_DataBlock_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE));
+  CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_1_DataBlock_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_1_DataBlock_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_1_DataBlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Write_1_DataBlock(cmock_call_instance, pDataFromSender0);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_Write_1_DataBlock_AddCallback(CMOCK_DATA_Write_1_DataBlock_CALLBACK Callback)
+{
+  Mock.DATA_Write_1_DataBlock_IgnoreBool = (char)0;
+  Mock.DATA_Write_1_DataBlock_CallbackBool = (char)1;
+  Mock.DATA_Write_1_DataBlock_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Write_1_DataBlock_Stub(CMOCK_DATA_Write_1_DataBlock_CALLBACK Callback)
+{
+  Mock.DATA_Write_1_DataBlock_IgnoreBool = (char)0;
+  Mock.DATA_Write_1_DataBlock_CallbackBool = (char)0;
+  Mock.DATA_Write_1_DataBlock_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Write_1_DataBlock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE));
+  CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_1_DataBlock_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_1_DataBlock_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_1_DataBlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Write_1_DataBlock(cmock_call_instance, pDataFromSender0);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_Write_1_DataBlock_CMockReturnMemThruPtr_pDataFromSender0(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, size_t cmock_size)
+{
+  CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_1_DataBlock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Val = pDataFromSender0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Size = cmock_size;
+}
+
+void DATA_Write_1_DataBlock_CMockIgnoreArg_pDataFromSender0(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_1_DataBlock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender0 = 1;
+}
+
+STD_RETURN_TYPE_e DATA_Write_2_DataBlocks(void* pDataFromSender0, void* pDataFromSender1)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Write_2_DataBlocks);
+  cmock_call_instance = (CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Write_2_DataBlocks_CallInstance);
+  Mock.DATA_Write_2_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Write_2_DataBlocks_CallInstance);
+  if (Mock.DATA_Write_2_DataBlocks_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_Write_2_DataBlocks_FinalReturn;
+    memcpy((void*)(&Mock.DATA_Write_2_DataBlocks_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_Write_2_DataBlocks_CallbackBool &&
+      Mock.DATA_Write_2_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_Write_2_DataBlocks_CallbackFunctionPointer(pDataFromSender0, pDataFromSender1, Mock.DATA_Write_2_DataBlocks_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender0)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_2_DataBlocks,CMockString_pDataFromSender0);
+    if (cmock_call_instance->Expected_pDataFromSender0 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender0, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender0, pDataFromSender0, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender1)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_2_DataBlocks,CMockString_pDataFromSender1);
+    if (cmock_call_instance->Expected_pDataFromSender1 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender1, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender1, pDataFromSender1, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.DATA_Write_2_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_Write_2_DataBlocks_CallbackFunctionPointer(pDataFromSender0, pDataFromSender1, Mock.DATA_Write_2_DataBlocks_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender0, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender0, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender0_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender0_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender1_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender1, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender1, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender1_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender1_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_Write_2_DataBlocks(CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender0, void* pDataFromSender1);
+void CMockExpectParameters_DATA_Write_2_DataBlocks(CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender0, void* pDataFromSender1)
+{
+  cmock_call_instance->Expected_pDataFromSender0 = pDataFromSender0;
+  cmock_call_instance->IgnoreArg_pDataFromSender0 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used = 0;
+  cmock_call_instance->Expected_pDataFromSender1 = pDataFromSender1;
+  cmock_call_instance->IgnoreArg_pDataFromSender1 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Used = 0;
+}
+
+void DATA_Write_2_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_2_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_2_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_2_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_Write_2_DataBlocks_IgnoreBool = (char)1;
+}
+
+void DATA_Write_2_DataBlocks_CMockStopIgnore(void)
+{
+  if(Mock.DATA_Write_2_DataBlocks_IgnoreBool)
+    Mock.DATA_Write_2_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Write_2_DataBlocks_CallInstance);
+  Mock.DATA_Write_2_DataBlocks_IgnoreBool = (char)0;
+}
+
+void DATA_Write_2_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_2_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_2_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_2_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Write_2_DataBlocks(cmock_call_instance, pDataFromSender0, pDataFromSender1);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_Write_2_DataBlocks_AddCallback(CMOCK_DATA_Write_2_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Write_2_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Write_2_DataBlocks_CallbackBool = (char)1;
+  Mock.DATA_Write_2_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Write_2_DataBlocks_Stub(CMOCK_DATA_Write_2_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Write_2_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Write_2_DataBlocks_CallbackBool = (char)0;
+  Mock.DATA_Write_2_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Write_2_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_2_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_2_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_2_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Write_2_DataBlocks(cmock_call_instance, pDataFromSender0, pDataFromSender1);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, size_t cmock_size)
+{
+  CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_2_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Val = pDataFromSender0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Size = cmock_size;
+}
+
+void DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(UNITY_LINE_TYPE cmock_line, void* pDataFromSender1, size_t cmock_size)
+{
+  CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_2_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Val = pDataFromSender1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Size = cmock_size;
+}
+
+void DATA_Write_2_DataBlocks_CMockIgnoreArg_pDataFromSender0(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_2_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender0 = 1;
+}
+
+void DATA_Write_2_DataBlocks_CMockIgnoreArg_pDataFromSender1(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_2_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender1 = 1;
+}
+
+STD_RETURN_TYPE_e DATA_Write_3_DataBlocks(void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Write_3_DataBlocks);
+  cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Write_3_DataBlocks_CallInstance);
+  Mock.DATA_Write_3_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Write_3_DataBlocks_CallInstance);
+  if (Mock.DATA_Write_3_DataBlocks_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_Write_3_DataBlocks_FinalReturn;
+    memcpy((void*)(&Mock.DATA_Write_3_DataBlocks_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_Write_3_DataBlocks_CallbackBool &&
+      Mock.DATA_Write_3_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_Write_3_DataBlocks_CallbackFunctionPointer(pDataFromSender0, pDataFromSender1, pDataFromSender2, Mock.DATA_Write_3_DataBlocks_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender0)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_3_DataBlocks,CMockString_pDataFromSender0);
+    if (cmock_call_instance->Expected_pDataFromSender0 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender0, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender0, pDataFromSender0, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender1)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_3_DataBlocks,CMockString_pDataFromSender1);
+    if (cmock_call_instance->Expected_pDataFromSender1 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender1, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender1, pDataFromSender1, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender2)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_3_DataBlocks,CMockString_pDataFromSender2);
+    if (cmock_call_instance->Expected_pDataFromSender2 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender2, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender2, pDataFromSender2, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.DATA_Write_3_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_Write_3_DataBlocks_CallbackFunctionPointer(pDataFromSender0, pDataFromSender1, pDataFromSender2, Mock.DATA_Write_3_DataBlocks_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender0, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender0, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender0_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender0_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender1_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender1, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender1, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender1_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender1_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender2_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender2, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender2, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender2_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender2_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_Write_3_DataBlocks(CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2);
+void CMockExpectParameters_DATA_Write_3_DataBlocks(CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2)
+{
+  cmock_call_instance->Expected_pDataFromSender0 = pDataFromSender0;
+  cmock_call_instance->IgnoreArg_pDataFromSender0 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used = 0;
+  cmock_call_instance->Expected_pDataFromSender1 = pDataFromSender1;
+  cmock_call_instance->IgnoreArg_pDataFromSender1 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Used = 0;
+  cmock_call_instance->Expected_pDataFromSender2 = pDataFromSender2;
+  cmock_call_instance->IgnoreArg_pDataFromSender2 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender2_Used = 0;
+}
+
+void DATA_Write_3_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_3_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_3_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_3_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_Write_3_DataBlocks_IgnoreBool = (char)1;
+}
+
+void DATA_Write_3_DataBlocks_CMockStopIgnore(void)
+{
+  if(Mock.DATA_Write_3_DataBlocks_IgnoreBool)
+    Mock.DATA_Write_3_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Write_3_DataBlocks_CallInstance);
+  Mock.DATA_Write_3_DataBlocks_IgnoreBool = (char)0;
+}
+
+void DATA_Write_3_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_3_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_3_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_3_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Write_3_DataBlocks(cmock_call_instance, pDataFromSender0, pDataFromSender1, pDataFromSender2);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_Write_3_DataBlocks_AddCallback(CMOCK_DATA_Write_3_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Write_3_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Write_3_DataBlocks_CallbackBool = (char)1;
+  Mock.DATA_Write_3_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Write_3_DataBlocks_Stub(CMOCK_DATA_Write_3_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Write_3_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Write_3_DataBlocks_CallbackBool = (char)0;
+  Mock.DATA_Write_3_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Write_3_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_3_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_3_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_3_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Write_3_DataBlocks(cmock_call_instance, pDataFromSender0, pDataFromSender1, pDataFromSender2);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, size_t cmock_size)
+{
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Val = pDataFromSender0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Size = cmock_size;
+}
+
+void DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(UNITY_LINE_TYPE cmock_line, void* pDataFromSender1, size_t cmock_size)
+{
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Val = pDataFromSender1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Size = cmock_size;
+}
+
+void DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(UNITY_LINE_TYPE cmock_line, void* pDataFromSender2, size_t cmock_size)
+{
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender2_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender2_Val = pDataFromSender2;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender2_Size = cmock_size;
+}
+
+void DATA_Write_3_DataBlocks_CMockIgnoreArg_pDataFromSender0(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender0 = 1;
+}
+
+void DATA_Write_3_DataBlocks_CMockIgnoreArg_pDataFromSender1(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender1 = 1;
+}
+
+void DATA_Write_3_DataBlocks_CMockIgnoreArg_pDataFromSender2(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender2 = 1;
+}
+
+STD_RETURN_TYPE_e DATA_Write_4_DataBlocks(void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, void* pDataFromSender3)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Write_4_DataBlocks);
+  cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Write_4_DataBlocks_CallInstance);
+  Mock.DATA_Write_4_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Write_4_DataBlocks_CallInstance);
+  if (Mock.DATA_Write_4_DataBlocks_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_Write_4_DataBlocks_FinalReturn;
+    memcpy((void*)(&Mock.DATA_Write_4_DataBlocks_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_Write_4_DataBlocks_CallbackBool &&
+      Mock.DATA_Write_4_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_Write_4_DataBlocks_CallbackFunctionPointer(pDataFromSender0, pDataFromSender1, pDataFromSender2, pDataFromSender3, Mock.DATA_Write_4_DataBlocks_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender0)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_4_DataBlocks,CMockString_pDataFromSender0);
+    if (cmock_call_instance->Expected_pDataFromSender0 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender0, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender0, pDataFromSender0, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender1)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_4_DataBlocks,CMockString_pDataFromSender1);
+    if (cmock_call_instance->Expected_pDataFromSender1 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender1, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender1, pDataFromSender1, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender2)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_4_DataBlocks,CMockString_pDataFromSender2);
+    if (cmock_call_instance->Expected_pDataFromSender2 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender2, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender2, pDataFromSender2, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender3)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Write_4_DataBlocks,CMockString_pDataFromSender3);
+    if (cmock_call_instance->Expected_pDataFromSender3 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender3, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender3, pDataFromSender3, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.DATA_Write_4_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_Write_4_DataBlocks_CallbackFunctionPointer(pDataFromSender0, pDataFromSender1, pDataFromSender2, pDataFromSender3, Mock.DATA_Write_4_DataBlocks_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender0, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender0, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender0_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender0_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender1_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender1, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender1, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender1_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender1_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender2_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender2, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender2, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender2_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender2_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender3_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender3, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender3, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender3_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender3_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_Write_4_DataBlocks(CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, void* pDataFromSender3);
+void CMockExpectParameters_DATA_Write_4_DataBlocks(CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, void* pDataFromSender3)
+{
+  cmock_call_instance->Expected_pDataFromSender0 = pDataFromSender0;
+  cmock_call_instance->IgnoreArg_pDataFromSender0 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used = 0;
+  cmock_call_instance->Expected_pDataFromSender1 = pDataFromSender1;
+  cmock_call_instance->IgnoreArg_pDataFromSender1 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Used = 0;
+  cmock_call_instance->Expected_pDataFromSender2 = pDataFromSender2;
+  cmock_call_instance->IgnoreArg_pDataFromSender2 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender2_Used = 0;
+  cmock_call_instance->Expected_pDataFromSender3 = pDataFromSender3;
+  cmock_call_instance->IgnoreArg_pDataFromSender3 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender3_Used = 0;
+}
+
+void DATA_Write_4_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_4_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_4_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_4_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_Write_4_DataBlocks_IgnoreBool = (char)1;
+}
+
+void DATA_Write_4_DataBlocks_CMockStopIgnore(void)
+{
+  if(Mock.DATA_Write_4_DataBlocks_IgnoreBool)
+    Mock.DATA_Write_4_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Write_4_DataBlocks_CallInstance);
+  Mock.DATA_Write_4_DataBlocks_IgnoreBool = (char)0;
+}
+
+void DATA_Write_4_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, void* pDataFromSender3, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_4_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_4_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_4_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Write_4_DataBlocks(cmock_call_instance, pDataFromSender0, pDataFromSender1, pDataFromSender2, pDataFromSender3);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_Write_4_DataBlocks_AddCallback(CMOCK_DATA_Write_4_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Write_4_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Write_4_DataBlocks_CallbackBool = (char)1;
+  Mock.DATA_Write_4_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Write_4_DataBlocks_Stub(CMOCK_DATA_Write_4_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Write_4_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Write_4_DataBlocks_CallbackBool = (char)0;
+  Mock.DATA_Write_4_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Write_4_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, void* pDataFromSender3, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Write_4_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Write_4_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Write_4_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Write_4_DataBlocks(cmock_call_instance, pDataFromSender0, pDataFromSender1, pDataFromSender2, pDataFromSender3);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, size_t cmock_size)
+{
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Val = pDataFromSender0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender0_Size = cmock_size;
+}
+
+void DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(UNITY_LINE_TYPE cmock_line, void* pDataFromSender1, size_t cmock_size)
+{
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Val = pDataFromSender1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender1_Size = cmock_size;
+}
+
+void DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(UNITY_LINE_TYPE cmock_line, void* pDataFromSender2, size_t cmock_size)
+{
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender2_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender2_Val = pDataFromSender2;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender2_Size = cmock_size;
+}
+
+void DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender3(UNITY_LINE_TYPE cmock_line, void* pDataFromSender3, size_t cmock_size)
+{
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender3_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender3_Val = pDataFromSender3;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender3_Size = cmock_size;
+}
+
+void DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender0(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender0 = 1;
+}
+
+void DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender1(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender1 = 1;
+}
+
+void DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender2(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender2 = 1;
+}
+
+void DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender3(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Write_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Write_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender3 = 1;
+}
+
+STD_RETURN_TYPE_e DATA_Read_1_DataBlock(void* pDataToReceiver0)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Read_1_DataBlock);
+  cmock_call_instance = (CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Read_1_DataBlock_CallInstance);
+  Mock.DATA_Read_1_DataBlock_CallInstance = CMock_Guts_MemNext(Mock.DATA_Read_1_DataBlock_CallInstance);
+  if (Mock.DATA_Read_1_DataBlock_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_Read_1_DataBlock_FinalReturn;
+    memcpy((void*)(&Mock.DATA_Read_1_DataBlock_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_Read_1_DataBlock_CallbackBool &&
+      Mock.DATA_Read_1_DataBlock_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_Read_1_DataBlock_CallbackFunctionPointer(pDataToReceiver0, Mock.DATA_Read_1_DataBlock_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver0)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_1_DataBlock,CMockString_pDataToReceiver0);
+    if (cmock_call_instance->Expected_pDataToReceiver0 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver0, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver0, pDataToReceiver0, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.DATA_Read_1_DataBlock_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_Read_1_DataBlock_CallbackFunctionPointer(pDataToReceiver0, Mock.DATA_Read_1_DataBlock_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver0, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver0, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_Read_1_DataBlock(CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver0);
+void CMockExpectParameters_DATA_Read_1_DataBlock(CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver0)
+{
+  cmock_call_instance->Expected_pDataToReceiver0 = pDataToReceiver0;
+  cmock_call_instance->IgnoreArg_pDataToReceiver0 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used = 0;
+}
+
+void DATA_Read_1_DataBlock_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE));
+  CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_1_DataBlock_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_1_DataBlock_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_1_DataBlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_Read_1_DataBlock_IgnoreBool = (char)1;
+}
+
+void DATA_Read_1_DataBlock_CMockStopIgnore(void)
+{
+  if(Mock.DATA_Read_1_DataBlock_IgnoreBool)
+    Mock.DATA_Read_1_DataBlock_CallInstance = CMock_Guts_MemNext(Mock.DATA_Read_1_DataBlock_CallInstance);
+  Mock.DATA_Read_1_DataBlock_IgnoreBool = (char)0;
+}
+
+void DATA_Read_1_DataBlock_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE));
+  CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_1_DataBlock_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_1_DataBlock_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_1_DataBlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Read_1_DataBlock(cmock_call_instance, pDataToReceiver0);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_Read_1_DataBlock_AddCallback(CMOCK_DATA_Read_1_DataBlock_CALLBACK Callback)
+{
+  Mock.DATA_Read_1_DataBlock_IgnoreBool = (char)0;
+  Mock.DATA_Read_1_DataBlock_CallbackBool = (char)1;
+  Mock.DATA_Read_1_DataBlock_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Read_1_DataBlock_Stub(CMOCK_DATA_Read_1_DataBlock_CALLBACK Callback)
+{
+  Mock.DATA_Read_1_DataBlock_IgnoreBool = (char)0;
+  Mock.DATA_Read_1_DataBlock_CallbackBool = (char)0;
+  Mock.DATA_Read_1_DataBlock_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Read_1_DataBlock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE));
+  CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_1_DataBlock_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_1_DataBlock_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_1_DataBlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Read_1_DataBlock(cmock_call_instance, pDataToReceiver0);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_Read_1_DataBlock_CMockReturnMemThruPtr_pDataToReceiver0(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, size_t cmock_size)
+{
+  CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_1_DataBlock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Val = pDataToReceiver0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Size = cmock_size;
+}
+
+void DATA_Read_1_DataBlock_CMockIgnoreArg_pDataToReceiver0(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_1_DataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_1_DataBlock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver0 = 1;
+}
+
+STD_RETURN_TYPE_e DATA_Read_2_DataBlocks(void* pDataToReceiver0, void* pDataToReceiver1)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Read_2_DataBlocks);
+  cmock_call_instance = (CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Read_2_DataBlocks_CallInstance);
+  Mock.DATA_Read_2_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Read_2_DataBlocks_CallInstance);
+  if (Mock.DATA_Read_2_DataBlocks_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_Read_2_DataBlocks_FinalReturn;
+    memcpy((void*)(&Mock.DATA_Read_2_DataBlocks_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_Read_2_DataBlocks_CallbackBool &&
+      Mock.DATA_Read_2_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_Read_2_DataBlocks_CallbackFunctionPointer(pDataToReceiver0, pDataToReceiver1, Mock.DATA_Read_2_DataBlocks_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver0)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_2_DataBlocks,CMockString_pDataToReceiver0);
+    if (cmock_call_instance->Expected_pDataToReceiver0 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver0, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver0, pDataToReceiver0, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver1)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_2_DataBlocks,CMockString_pDataToReceiver1);
+    if (cmock_call_instance->Expected_pDataToReceiver1 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver1, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver1, pDataToReceiver1, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.DATA_Read_2_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_Read_2_DataBlocks_CallbackFunctionPointer(pDataToReceiver0, pDataToReceiver1, Mock.DATA_Read_2_DataBlocks_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver0, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver0, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver1, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver1, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_Read_2_DataBlocks(CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver0, void* pDataToReceiver1);
+void CMockExpectParameters_DATA_Read_2_DataBlocks(CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver0, void* pDataToReceiver1)
+{
+  cmock_call_instance->Expected_pDataToReceiver0 = pDataToReceiver0;
+  cmock_call_instance->IgnoreArg_pDataToReceiver0 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used = 0;
+  cmock_call_instance->Expected_pDataToReceiver1 = pDataToReceiver1;
+  cmock_call_instance->IgnoreArg_pDataToReceiver1 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Used = 0;
+}
+
+void DATA_Read_2_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_2_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_2_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_2_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_Read_2_DataBlocks_IgnoreBool = (char)1;
+}
+
+void DATA_Read_2_DataBlocks_CMockStopIgnore(void)
+{
+  if(Mock.DATA_Read_2_DataBlocks_IgnoreBool)
+    Mock.DATA_Read_2_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Read_2_DataBlocks_CallInstance);
+  Mock.DATA_Read_2_DataBlocks_IgnoreBool = (char)0;
+}
+
+void DATA_Read_2_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_2_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_2_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_2_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Read_2_DataBlocks(cmock_call_instance, pDataToReceiver0, pDataToReceiver1);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_Read_2_DataBlocks_AddCallback(CMOCK_DATA_Read_2_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Read_2_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Read_2_DataBlocks_CallbackBool = (char)1;
+  Mock.DATA_Read_2_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Read_2_DataBlocks_Stub(CMOCK_DATA_Read_2_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Read_2_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Read_2_DataBlocks_CallbackBool = (char)0;
+  Mock.DATA_Read_2_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Read_2_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_2_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_2_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_2_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Read_2_DataBlocks(cmock_call_instance, pDataToReceiver0, pDataToReceiver1);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, size_t cmock_size)
+{
+  CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_2_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Val = pDataToReceiver0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Size = cmock_size;
+}
+
+void DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver1, size_t cmock_size)
+{
+  CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_2_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Val = pDataToReceiver1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Size = cmock_size;
+}
+
+void DATA_Read_2_DataBlocks_CMockIgnoreArg_pDataToReceiver0(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_2_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver0 = 1;
+}
+
+void DATA_Read_2_DataBlocks_CMockIgnoreArg_pDataToReceiver1(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_2_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_2_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver1 = 1;
+}
+
+STD_RETURN_TYPE_e DATA_Read_3_DataBlocks(void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Read_3_DataBlocks);
+  cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Read_3_DataBlocks_CallInstance);
+  Mock.DATA_Read_3_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Read_3_DataBlocks_CallInstance);
+  if (Mock.DATA_Read_3_DataBlocks_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_Read_3_DataBlocks_FinalReturn;
+    memcpy((void*)(&Mock.DATA_Read_3_DataBlocks_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_Read_3_DataBlocks_CallbackBool &&
+      Mock.DATA_Read_3_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_Read_3_DataBlocks_CallbackFunctionPointer(pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, Mock.DATA_Read_3_DataBlocks_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver0)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_3_DataBlocks,CMockString_pDataToReceiver0);
+    if (cmock_call_instance->Expected_pDataToReceiver0 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver0, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver0, pDataToReceiver0, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver1)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_3_DataBlocks,CMockString_pDataToReceiver1);
+    if (cmock_call_instance->Expected_pDataToReceiver1 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver1, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver1, pDataToReceiver1, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver2)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_3_DataBlocks,CMockString_pDataToReceiver2);
+    if (cmock_call_instance->Expected_pDataToReceiver2 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver2, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver2, pDataToReceiver2, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.DATA_Read_3_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_Read_3_DataBlocks_CallbackFunctionPointer(pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, Mock.DATA_Read_3_DataBlocks_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver0, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver0, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver1, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver1, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver2, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver2, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_Read_3_DataBlocks(CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2);
+void CMockExpectParameters_DATA_Read_3_DataBlocks(CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2)
+{
+  cmock_call_instance->Expected_pDataToReceiver0 = pDataToReceiver0;
+  cmock_call_instance->IgnoreArg_pDataToReceiver0 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used = 0;
+  cmock_call_instance->Expected_pDataToReceiver1 = pDataToReceiver1;
+  cmock_call_instance->IgnoreArg_pDataToReceiver1 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Used = 0;
+  cmock_call_instance->Expected_pDataToReceiver2 = pDataToReceiver2;
+  cmock_call_instance->IgnoreArg_pDataToReceiver2 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Used = 0;
+}
+
+void DATA_Read_3_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_3_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_3_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_3_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_Read_3_DataBlocks_IgnoreBool = (char)1;
+}
+
+void DATA_Read_3_DataBlocks_CMockStopIgnore(void)
+{
+  if(Mock.DATA_Read_3_DataBlocks_IgnoreBool)
+    Mock.DATA_Read_3_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Read_3_DataBlocks_CallInstance);
+  Mock.DATA_Read_3_DataBlocks_IgnoreBool = (char)0;
+}
+
+void DATA_Read_3_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_3_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_3_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_3_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Read_3_DataBlocks(cmock_call_instance, pDataToReceiver0, pDataToReceiver1, pDataToReceiver2);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_Read_3_DataBlocks_AddCallback(CMOCK_DATA_Read_3_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Read_3_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Read_3_DataBlocks_CallbackBool = (char)1;
+  Mock.DATA_Read_3_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Read_3_DataBlocks_Stub(CMOCK_DATA_Read_3_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Read_3_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Read_3_DataBlocks_CallbackBool = (char)0;
+  Mock.DATA_Read_3_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Read_3_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_3_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_3_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_3_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Read_3_DataBlocks(cmock_call_instance, pDataToReceiver0, pDataToReceiver1, pDataToReceiver2);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, size_t cmock_size)
+{
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Val = pDataToReceiver0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Size = cmock_size;
+}
+
+void DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver1, size_t cmock_size)
+{
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Val = pDataToReceiver1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Size = cmock_size;
+}
+
+void DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver2, size_t cmock_size)
+{
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Val = pDataToReceiver2;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Size = cmock_size;
+}
+
+void DATA_Read_3_DataBlocks_CMockIgnoreArg_pDataToReceiver0(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver0 = 1;
+}
+
+void DATA_Read_3_DataBlocks_CMockIgnoreArg_pDataToReceiver1(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver1 = 1;
+}
+
+void DATA_Read_3_DataBlocks_CMockIgnoreArg_pDataToReceiver2(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_3_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_3_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver2 = 1;
+}
+
+STD_RETURN_TYPE_e DATA_Read_4_DataBlocks(void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, void* pDataToReceiver3)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_Read_4_DataBlocks);
+  cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_Read_4_DataBlocks_CallInstance);
+  Mock.DATA_Read_4_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Read_4_DataBlocks_CallInstance);
+  if (Mock.DATA_Read_4_DataBlocks_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_Read_4_DataBlocks_FinalReturn;
+    memcpy((void*)(&Mock.DATA_Read_4_DataBlocks_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_Read_4_DataBlocks_CallbackBool &&
+      Mock.DATA_Read_4_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_Read_4_DataBlocks_CallbackFunctionPointer(pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, pDataToReceiver3, Mock.DATA_Read_4_DataBlocks_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver0)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_4_DataBlocks,CMockString_pDataToReceiver0);
+    if (cmock_call_instance->Expected_pDataToReceiver0 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver0, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver0, pDataToReceiver0, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver1)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_4_DataBlocks,CMockString_pDataToReceiver1);
+    if (cmock_call_instance->Expected_pDataToReceiver1 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver1, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver1, pDataToReceiver1, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver2)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_4_DataBlocks,CMockString_pDataToReceiver2);
+    if (cmock_call_instance->Expected_pDataToReceiver2 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver2, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver2, pDataToReceiver2, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver3)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_Read_4_DataBlocks,CMockString_pDataToReceiver3);
+    if (cmock_call_instance->Expected_pDataToReceiver3 == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver3, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver3, pDataToReceiver3, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.DATA_Read_4_DataBlocks_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_Read_4_DataBlocks_CallbackFunctionPointer(pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, pDataToReceiver3, Mock.DATA_Read_4_DataBlocks_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver0, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver0, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver1, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver1, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver2, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver2, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver3_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver3, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver3, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver3_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver3_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_Read_4_DataBlocks(CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, void* pDataToReceiver3);
+void CMockExpectParameters_DATA_Read_4_DataBlocks(CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, void* pDataToReceiver3)
+{
+  cmock_call_instance->Expected_pDataToReceiver0 = pDataToReceiver0;
+  cmock_call_instance->IgnoreArg_pDataToReceiver0 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used = 0;
+  cmock_call_instance->Expected_pDataToReceiver1 = pDataToReceiver1;
+  cmock_call_instance->IgnoreArg_pDataToReceiver1 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Used = 0;
+  cmock_call_instance->Expected_pDataToReceiver2 = pDataToReceiver2;
+  cmock_call_instance->IgnoreArg_pDataToReceiver2 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Used = 0;
+  cmock_call_instance->Expected_pDataToReceiver3 = pDataToReceiver3;
+  cmock_call_instance->IgnoreArg_pDataToReceiver3 = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver3_Used = 0;
+}
+
+void DATA_Read_4_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_4_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_4_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_4_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_Read_4_DataBlocks_IgnoreBool = (char)1;
+}
+
+void DATA_Read_4_DataBlocks_CMockStopIgnore(void)
+{
+  if(Mock.DATA_Read_4_DataBlocks_IgnoreBool)
+    Mock.DATA_Read_4_DataBlocks_CallInstance = CMock_Guts_MemNext(Mock.DATA_Read_4_DataBlocks_CallInstance);
+  Mock.DATA_Read_4_DataBlocks_IgnoreBool = (char)0;
+}
+
+void DATA_Read_4_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, void* pDataToReceiver3, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_4_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_4_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_4_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Read_4_DataBlocks(cmock_call_instance, pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, pDataToReceiver3);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_Read_4_DataBlocks_AddCallback(CMOCK_DATA_Read_4_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Read_4_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Read_4_DataBlocks_CallbackBool = (char)1;
+  Mock.DATA_Read_4_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Read_4_DataBlocks_Stub(CMOCK_DATA_Read_4_DataBlocks_CALLBACK Callback)
+{
+  Mock.DATA_Read_4_DataBlocks_IgnoreBool = (char)0;
+  Mock.DATA_Read_4_DataBlocks_CallbackBool = (char)0;
+  Mock.DATA_Read_4_DataBlocks_CallbackFunctionPointer = Callback;
+}
+
+void DATA_Read_4_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, void* pDataToReceiver3, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE));
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_Read_4_DataBlocks_CallInstance = CMock_Guts_MemChain(Mock.DATA_Read_4_DataBlocks_CallInstance, cmock_guts_index);
+  Mock.DATA_Read_4_DataBlocks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_Read_4_DataBlocks(cmock_call_instance, pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, pDataToReceiver3);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, size_t cmock_size)
+{
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Val = pDataToReceiver0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver0_Size = cmock_size;
+}
+
+void DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver1, size_t cmock_size)
+{
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Val = pDataToReceiver1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver1_Size = cmock_size;
+}
+
+void DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver2, size_t cmock_size)
+{
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Val = pDataToReceiver2;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver2_Size = cmock_size;
+}
+
+void DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver3(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver3, size_t cmock_size)
+{
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver3_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver3_Val = pDataToReceiver3;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver3_Size = cmock_size;
+}
+
+void DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver0(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver0 = 1;
+}
+
+void DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver1(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver1 = 1;
+}
+
+void DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver2(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver2 = 1;
+}
+
+void DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver3(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_Read_4_DataBlocks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_Read_4_DataBlocks_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver3 = 1;
+}
+
+STD_RETURN_TYPE_e DATA_ReadDataBlockRange(DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_ReadDataBlockRange);
+  cmock_call_instance = (CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_ReadDataBlockRange_CallInstance);
+  Mock.DATA_ReadDataBlockRange_CallInstance = CMock_Guts_MemNext(Mock.DATA_ReadDataBlockRange_CallInstance);
+  if (Mock.DATA_ReadDataBlockRange_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_ReadDataBlockRange_FinalReturn;
+    memcpy((void*)(&Mock.DATA_ReadDataBlockRange_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_ReadDataBlockRange_CallbackBool &&
+      Mock.DATA_ReadDataBlockRange_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_ReadDataBlockRange_CallbackFunctionPointer(blockId, pDataToReceiver, offset, length, Mock.DATA_ReadDataBlockRange_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_ReadDataBlockRange,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_ReadDataBlockRange,CMockString_pDataToReceiver);
+    if (cmock_call_instance->Expected_pDataToReceiver == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver, pDataToReceiver, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_offset)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_ReadDataBlockRange,CMockString_offset);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_offset, offset, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_length)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_ReadDataBlockRange,CMockString_length);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_length, length, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DATA_ReadDataBlockRange_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_ReadDataBlockRange_CallbackFunctionPointer(blockId, pDataToReceiver, offset, length, Mock.DATA_ReadDataBlockRange_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_ReadDataBlockRange(CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length);
+void CMockExpectParameters_DATA_ReadDataBlockRange(CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+  cmock_call_instance->Expected_pDataToReceiver = pDataToReceiver;
+  cmock_call_instance->IgnoreArg_pDataToReceiver = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used = 0;
+  cmock_call_instance->Expected_offset = offset;
+  cmock_call_instance->IgnoreArg_offset = 0;
+  cmock_call_instance->Expected_length = length;
+  cmock_call_instance->IgnoreArg_length = 0;
+}
+
+void DATA_ReadDataBlockRange_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE));
+  CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_ReadDataBlockRange_CallInstance = CMock_Guts_MemChain(Mock.DATA_ReadDataBlockRange_CallInstance, cmock_guts_index);
+  Mock.DATA_ReadDataBlockRange_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_ReadDataBlockRange_IgnoreBool = (char)1;
+}
+
+void DATA_ReadDataBlockRange_CMockStopIgnore(void)
+{
+  if(Mock.DATA_ReadDataBlockRange_IgnoreBool)
+    Mock.DATA_ReadDataBlockRange_CallInstance = CMock_Guts_MemNext(Mock.DATA_ReadDataBlockRange_CallInstance);
+  Mock.DATA_ReadDataBlockRange_IgnoreBool = (char)0;
+}
+
+void DATA_ReadDataBlockRange_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE));
+  CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_ReadDataBlockRange_CallInstance = CMock_Guts_MemChain(Mock.DATA_ReadDataBlockRange_CallInstance, cmock_guts_index);
+  Mock.DATA_ReadDataBlockRange_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_ReadDataBlockRange(cmock_call_instance, blockId, pDataToReceiver, offset, length);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_ReadDataBlockRange_AddCallback(CMOCK_DATA_ReadDataBlockRange_CALLBACK Callback)
+{
+  Mock.DATA_ReadDataBlockRange_IgnoreBool = (char)0;
+  Mock.DATA_ReadDataBlockRange_CallbackBool = (char)1;
+  Mock.DATA_ReadDataBlockRange_CallbackFunctionPointer = Callback;
+}
+
+void DATA_ReadDataBlockRange_Stub(CMOCK_DATA_ReadDataBlockRange_CALLBACK Callback)
+{
+  Mock.DATA_ReadDataBlockRange_IgnoreBool = (char)0;
+  Mock.DATA_ReadDataBlockRange_CallbackBool = (char)0;
+  Mock.DATA_ReadDataBlockRange_CallbackFunctionPointer = Callback;
+}
+
+void DATA_ReadDataBlockRange_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE));
+  CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_ReadDataBlockRange_CallInstance = CMock_Guts_MemChain(Mock.DATA_ReadDataBlockRange_CallInstance, cmock_guts_index);
+  Mock.DATA_ReadDataBlockRange_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_ReadDataBlockRange(cmock_call_instance, blockId, pDataToReceiver, offset, length);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_ReadDataBlockRange_CMockReturnMemThruPtr_pDataToReceiver(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, size_t cmock_size)
+{
+  CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_ReadDataBlockRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Val = pDataToReceiver;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Size = cmock_size;
+}
+
+void DATA_ReadDataBlockRange_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_ReadDataBlockRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void DATA_ReadDataBlockRange_CMockIgnoreArg_pDataToReceiver(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_ReadDataBlockRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver = 1;
+}
+
+void DATA_ReadDataBlockRange_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_ReadDataBlockRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_offset = 1;
+}
+
+void DATA_ReadDataBlockRange_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_ReadDataBlockRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_ReadDataBlockRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_length = 1;
+}
+
+STD_RETURN_TYPE_e DATA_SubscribeToDataBlock(DATA_BLOCK_ID_e blockId, uint32_t notificationBits)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_SubscribeToDataBlock);
+  cmock_call_instance = (CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_SubscribeToDataBlock_CallInstance);
+  Mock.DATA_SubscribeToDataBlock_CallInstance = CMock_Guts_MemNext(Mock.DATA_SubscribeToDataBlock_CallInstance);
+  if (Mock.DATA_SubscribeToDataBlock_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_SubscribeToDataBlock_FinalReturn;
+    memcpy((void*)(&Mock.DATA_SubscribeToDataBlock_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_SubscribeToDataBlock_CallbackBool &&
+      Mock.DATA_SubscribeToDataBlock_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DATA_SubscribeToDataBlock_CallbackFunctionPointer(blockId, notificationBits, Mock.DATA_SubscribeToDataBlock_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_SubscribeToDataBlock,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_notificationBits)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_SubscribeToDataBlock,CMockString_notificationBits);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_notificationBits, notificationBits, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DATA_SubscribeToDataBlock_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_SubscribeToDataBlock_CallbackFunctionPointer(blockId, notificationBits, Mock.DATA_SubscribeToDataBlock_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_SubscribeToDataBlock(CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, uint32_t notificationBits);
+void CMockExpectParameters_DATA_SubscribeToDataBlock(CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, uint32_t notificationBits)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+  cmock_call_instance->Expected_notificationBits = notificationBits;
+  cmock_call_instance->IgnoreArg_notificationBits = 0;
+}
+
+void DATA_SubscribeToDataBlock_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE));
+  CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_SubscribeToDataBlock_CallInstance = CMock_Guts_MemChain(Mock.DATA_SubscribeToDataBlock_CallInstance, cmock_guts_index);
+  Mock.DATA_SubscribeToDataBlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_SubscribeToDataBlock_IgnoreBool = (char)1;
+}
+
+void DATA_SubscribeToDataBlock_CMockStopIgnore(void)
+{
+  if(Mock.DATA_SubscribeToDataBlock_IgnoreBool)
+    Mock.DATA_SubscribeToDataBlock_CallInstance = CMock_Guts_MemNext(Mock.DATA_SubscribeToDataBlock_CallInstance);
+  Mock.DATA_SubscribeToDataBlock_IgnoreBool = (char)0;
+}
+
+void DATA_SubscribeToDataBlock_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t notificationBits, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE));
+  CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_SubscribeToDataBlock_CallInstance = CMock_Guts_MemChain(Mock.DATA_SubscribeToDataBlock_CallInstance, cmock_guts_index);
+  Mock.DATA_SubscribeToDataBlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_SubscribeToDataBlock(cmock_call_instance, blockId, notificationBits);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DATA_SubscribeToDataBlock_AddCallback(CMOCK_DATA_SubscribeToDataBlock_CALLBACK Callback)
+{
+  Mock.DATA_SubscribeToDataBlock_IgnoreBool = (char)0;
+  Mock.DATA_SubscribeToDataBlock_CallbackBool = (char)1;
+  Mock.DATA_SubscribeToDataBlock_CallbackFunctionPointer = Callback;
+}
+
+void DATA_SubscribeToDataBlock_Stub(CMOCK_DATA_SubscribeToDataBlock_CALLBACK Callback)
+{
+  Mock.DATA_SubscribeToDataBlock_IgnoreBool = (char)0;
+  Mock.DATA_SubscribeToDataBlock_CallbackBool = (char)0;
+  Mock.DATA_SubscribeToDataBlock_CallbackFunctionPointer = Callback;
+}
+
+void DATA_SubscribeToDataBlock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t notificationBits, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE));
+  CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_SubscribeToDataBlock_CallInstance = CMock_Guts_MemChain(Mock.DATA_SubscribeToDataBlock_CallInstance, cmock_guts_index);
+  Mock.DATA_SubscribeToDataBlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_SubscribeToDataBlock(cmock_call_instance, blockId, notificationBits);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_SubscribeToDataBlock_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_SubscribeToDataBlock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void DATA_SubscribeToDataBlock_CMockIgnoreArg_notificationBits(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_SubscribeToDataBlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_SubscribeToDataBlock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_notificationBits = 1;
+}
+
+uint32_t DATA_GetDataBlockUpdates(uint32_t notificationBits, uint32_t timeout_ms)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_GetDataBlockUpdates);
+  cmock_call_instance = (CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_GetDataBlockUpdates_CallInstance);
+  Mock.DATA_GetDataBlockUpdates_CallInstance = CMock_Guts_MemNext(Mock.DATA_GetDataBlockUpdates_CallInstance);
+  if (Mock.DATA_GetDataBlockUpdates_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_GetDataBlockUpdates_FinalReturn;
+    Mock.DATA_GetDataBlockUpdates_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_GetDataBlockUpdates_CallbackBool &&
+      Mock.DATA_GetDataBlockUpdates_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.DATA_GetDataBlockUpdates_CallbackFunctionPointer(notificationBits, timeout_ms, Mock.DATA_GetDataBlockUpdates_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_notificationBits)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_GetDataBlockUpdates,CMockString_notificationBits);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_notificationBits, notificationBits, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_timeout_ms)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_GetDataBlockUpdates,CMockString_timeout_ms);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_timeout_ms, timeout_ms, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DATA_GetDataBlockUpdates_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_GetDataBlockUpdates_CallbackFunctionPointer(notificationBits, timeout_ms, Mock.DATA_GetDataBlockUpdates_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_GetDataBlockUpdates(CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE* cmock_call_instance, uint32_t notificationBits, uint32_t timeout_ms);
+void CMockExpectParameters_DATA_GetDataBlockUpdates(CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE* cmock_call_instance, uint32_t notificationBits, uint32_t timeout_ms)
+{
+  cmock_call_instance->Expected_notificationBits = notificationBits;
+  cmock_call_instance->IgnoreArg_notificationBits = 0;
+  cmock_call_instance->Expected_timeout_ms = timeout_ms;
+  cmock_call_instance->IgnoreArg_timeout_ms = 0;
+}
+
+void DATA_GetDataBlockUpdates_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE));
+  CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetDataBlockUpdates_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetDataBlockUpdates_CallInstance, cmock_guts_index);
+  Mock.DATA_GetDataBlockUpdates_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_GetDataBlockUpdates_IgnoreBool = (char)1;
+}
+
+void DATA_GetDataBlockUpdates_CMockStopIgnore(void)
+{
+  if(Mock.DATA_GetDataBlockUpdates_IgnoreBool)
+    Mock.DATA_GetDataBlockUpdates_CallInstance = CMock_Guts_MemNext(Mock.DATA_GetDataBlockUpdates_CallInstance);
+  Mock.DATA_GetDataBlockUpdates_IgnoreBool = (char)0;
+}
+
+void DATA_GetDataBlockUpdates_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t notificationBits, uint32_t timeout_ms, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE));
+  CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetDataBlockUpdates_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetDataBlockUpdates_CallInstance, cmock_guts_index);
+  Mock.DATA_GetDataBlockUpdates_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_GetDataBlockUpdates(cmock_call_instance, notificationBits, timeout_ms);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void DATA_GetDataBlockUpdates_AddCallback(CMOCK_DATA_GetDataBlockUpdates_CALLBACK Callback)
+{
+  Mock.DATA_GetDataBlockUpdates_IgnoreBool = (char)0;
+  Mock.DATA_GetDataBlockUpdates_CallbackBool = (char)1;
+  Mock.DATA_GetDataBlockUpdates_CallbackFunctionPointer = Callback;
+}
+
+void DATA_GetDataBlockUpdates_Stub(CMOCK_DATA_GetDataBlockUpdates_CALLBACK Callback)
+{
+  Mock.DATA_GetDataBlockUpdates_IgnoreBool = (char)0;
+  Mock.DATA_GetDataBlockUpdates_CallbackBool = (char)0;
+  Mock.DATA_GetDataBlockUpdates_CallbackFunctionPointer = Callback;
+}
+
+void DATA_GetDataBlockUpdates_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t notificationBits, uint32_t timeout_ms, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE));
+  CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetDataBlockUpdates_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetDataBlockUpdates_CallInstance, cmock_guts_index);
+  Mock.DATA_GetDataBlockUpdates_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_GetDataBlockUpdates(cmock_call_instance, notificationBits, timeout_ms);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_GetDataBlockUpdates_CMockIgnoreArg_notificationBits(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_GetDataBlockUpdates_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_notificationBits = 1;
+}
+
+void DATA_GetDataBlockUpdates_CMockIgnoreArg_timeout_ms(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetDataBlockUpdates_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_GetDataBlockUpdates_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_timeout_ms = 1;
+}
+
+void* DATA_GetBackBuffer(DATA_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_GetBackBuffer_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_GetBackBuffer);
+  cmock_call_instance = (CMOCK_DATA_GetBackBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_GetBackBuffer_CallInstance);
+  Mock.DATA_GetBackBuffer_CallInstance = CMock_Guts_MemNext(Mock.DATA_GetBackBuffer_CallInstance);
+  if (Mock.DATA_GetBackBuffer_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_GetBackBuffer_FinalReturn;
+    Mock.DATA_GetBackBuffer_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_GetBackBuffer_CallbackBool &&
+      Mock.DATA_GetBackBuffer_CallbackFunctionPointer != NULL)
+  {
+    void* cmock_cb_ret = Mock.DATA_GetBackBuffer_CallbackFunctionPointer(blockId, Mock.DATA_GetBackBuffer_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_GetBackBuffer,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DATA_GetBackBuffer_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_GetBackBuffer_CallbackFunctionPointer(blockId, Mock.DATA_GetBackBuffer_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_GetBackBuffer(CMOCK_DATA_GetBackBuffer_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId);
+void CMockExpectParameters_DATA_GetBackBuffer(CMOCK_DATA_GetBackBuffer_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void DATA_GetBackBuffer_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, void* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetBackBuffer_CALL_INSTANCE));
+  CMOCK_DATA_GetBackBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetBackBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetBackBuffer_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetBackBuffer_CallInstance, cmock_guts_index);
+  Mock.DATA_GetBackBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_GetBackBuffer_IgnoreBool = (char)1;
+}
+
+void DATA_GetBackBuffer_CMockStopIgnore(void)
+{
+  if(Mock.DATA_GetBackBuffer_IgnoreBool)
+    Mock.DATA_GetBackBuffer_CallInstance = CMock_Guts_MemNext(Mock.DATA_GetBackBuffer_CallInstance);
+  Mock.DATA_GetBackBuffer_IgnoreBool = (char)0;
+}
+
+void DATA_GetBackBuffer_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetBackBuffer_CALL_INSTANCE));
+  CMOCK_DATA_GetBackBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetBackBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetBackBuffer_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetBackBuffer_CallInstance, cmock_guts_index);
+  Mock.DATA_GetBackBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_GetBackBuffer(cmock_call_instance, blockId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void DATA_GetBackBuffer_AddCallback(CMOCK_DATA_GetBackBuffer_CALLBACK Callback)
+{
+  Mock.DATA_GetBackBuffer_IgnoreBool = (char)0;
+  Mock.DATA_GetBackBuffer_CallbackBool = (char)1;
+  Mock.DATA_GetBackBuffer_CallbackFunctionPointer = Callback;
+}
+
+void DATA_GetBackBuffer_Stub(CMOCK_DATA_GetBackBuffer_CALLBACK Callback)
+{
+  Mock.DATA_GetBackBuffer_IgnoreBool = (char)0;
+  Mock.DATA_GetBackBuffer_CallbackBool = (char)0;
+  Mock.DATA_GetBackBuffer_CallbackFunctionPointer = Callback;
+}
+
+void DATA_GetBackBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetBackBuffer_CALL_INSTANCE));
+  CMOCK_DATA_GetBackBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetBackBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetBackBuffer_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetBackBuffer_CallInstance, cmock_guts_index);
+  Mock.DATA_GetBackBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_GetBackBuffer(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_GetBackBuffer_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_GetBackBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetBackBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_GetBackBuffer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void DATA_CommitBackBuffer(DATA_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_CommitBackBuffer);
+  cmock_call_instance = (CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_CommitBackBuffer_CallInstance);
+  Mock.DATA_CommitBackBuffer_CallInstance = CMock_Guts_MemNext(Mock.DATA_CommitBackBuffer_CallInstance);
+  if (Mock.DATA_CommitBackBuffer_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DATA_CommitBackBuffer_CallbackBool &&
+      Mock.DATA_CommitBackBuffer_CallbackFunctionPointer != NULL)
+  {
+    Mock.DATA_CommitBackBuffer_CallbackFunctionPointer(blockId, Mock.DATA_CommitBackBuffer_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_CommitBackBuffer,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DATA_CommitBackBuffer_CallbackFunctionPointer != NULL)
+  {
+    Mock.DATA_CommitBackBuffer_CallbackFunctionPointer(blockId, Mock.DATA_CommitBackBuffer_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_DATA_CommitBackBuffer(CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId);
+void CMockExpectParameters_DATA_CommitBackBuffer(CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void DATA_CommitBackBuffer_CMockIgnore(void)
+{
+  Mock.DATA_CommitBackBuffer_IgnoreBool = (char)1;
+}
+
+void DATA_CommitBackBuffer_CMockStopIgnore(void)
+{
+  Mock.DATA_CommitBackBuffer_IgnoreBool = (char)0;
+}
+
+void DATA_CommitBackBuffer_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE));
+  CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_CommitBackBuffer_CallInstance = CMock_Guts_MemChain(Mock.DATA_CommitBackBuffer_CallInstance, cmock_guts_index);
+  Mock.DATA_CommitBackBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_CommitBackBuffer(cmock_call_instance, blockId);
+}
+
+void DATA_CommitBackBuffer_AddCallback(CMOCK_DATA_CommitBackBuffer_CALLBACK Callback)
+{
+  Mock.DATA_CommitBackBuffer_IgnoreBool = (char)0;
+  Mock.DATA_CommitBackBuffer_CallbackBool = (char)1;
+  Mock.DATA_CommitBackBuffer_CallbackFunctionPointer = Callback;
+}
+
+void DATA_CommitBackBuffer_Stub(CMOCK_DATA_CommitBackBuffer_CALLBACK Callback)
+{
+  Mock.DATA_CommitBackBuffer_IgnoreBool = (char)0;
+  Mock.DATA_CommitBackBuffer_CallbackBool = (char)0;
+  Mock.DATA_CommitBackBuffer_CallbackFunctionPointer = Callback;
+}
+
+void DATA_CommitBackBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE));
+  CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_CommitBackBuffer_CallInstance = CMock_Guts_MemChain(Mock.DATA_CommitBackBuffer_CallInstance, cmock_guts_index);
+  Mock.DATA_CommitBackBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_CommitBackBuffer(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_CommitBackBuffer_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_CommitBackBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_CommitBackBuffer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+const void* DATA_GetFrontBuffer(DATA_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_GetFrontBuffer);
+  cmock_call_instance = (CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_GetFrontBuffer_CallInstance);
+  Mock.DATA_GetFrontBuffer_CallInstance = CMock_Guts_MemNext(Mock.DATA_GetFrontBuffer_CallInstance);
+  if (Mock.DATA_GetFrontBuffer_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_GetFrontBuffer_FinalReturn;
+    Mock.DATA_GetFrontBuffer_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_GetFrontBuffer_CallbackBool &&
+      Mock.DATA_GetFrontBuffer_CallbackFunctionPointer != NULL)
+  {
+    const void* cmock_cb_ret = Mock.DATA_GetFrontBuffer_CallbackFunctionPointer(blockId, Mock.DATA_GetFrontBuffer_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_GetFrontBuffer,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DATA_GetFrontBuffer_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_GetFrontBuffer_CallbackFunctionPointer(blockId, Mock.DATA_GetFrontBuffer_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_GetFrontBuffer(CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId);
+void CMockExpectParameters_DATA_GetFrontBuffer(CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void DATA_GetFrontBuffer_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, const void* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE));
+  CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetFrontBuffer_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetFrontBuffer_CallInstance, cmock_guts_index);
+  Mock.DATA_GetFrontBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_GetFrontBuffer_IgnoreBool = (char)1;
+}
+
+void DATA_GetFrontBuffer_CMockStopIgnore(void)
+{
+  if(Mock.DATA_GetFrontBuffer_IgnoreBool)
+    Mock.DATA_GetFrontBuffer_CallInstance = CMock_Guts_MemNext(Mock.DATA_GetFrontBuffer_CallInstance);
+  Mock.DATA_GetFrontBuffer_IgnoreBool = (char)0;
+}
+
+void DATA_GetFrontBuffer_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, const void* cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE));
+  CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetFrontBuffer_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetFrontBuffer_CallInstance, cmock_guts_index);
+  Mock.DATA_GetFrontBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_GetFrontBuffer(cmock_call_instance, blockId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void DATA_GetFrontBuffer_AddCallback(CMOCK_DATA_GetFrontBuffer_CALLBACK Callback)
+{
+  Mock.DATA_GetFrontBuffer_IgnoreBool = (char)0;
+  Mock.DATA_GetFrontBuffer_CallbackBool = (char)1;
+  Mock.DATA_GetFrontBuffer_CallbackFunctionPointer = Callback;
+}
+
+void DATA_GetFrontBuffer_Stub(CMOCK_DATA_GetFrontBuffer_CALLBACK Callback)
+{
+  Mock.DATA_GetFrontBuffer_IgnoreBool = (char)0;
+  Mock.DATA_GetFrontBuffer_CallbackBool = (char)0;
+  Mock.DATA_GetFrontBuffer_CallbackFunctionPointer = Callback;
+}
+
+void DATA_GetFrontBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE));
+  CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetFrontBuffer_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetFrontBuffer_CallInstance, cmock_guts_index);
+  Mock.DATA_GetFrontBuffer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_GetFrontBuffer(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_GetFrontBuffer_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetFrontBuffer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_GetFrontBuffer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+uint8_t DATA_GetMaximumNumberOfReadAttempts(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_GetMaximumNumberOfReadAttempts);
+  cmock_call_instance = (CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance);
+  Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance = CMock_Guts_MemNext(Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance);
+  if (Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_GetMaximumNumberOfReadAttempts_FinalReturn;
+    Mock.DATA_GetMaximumNumberOfReadAttempts_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackBool &&
+      Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackFunctionPointer != NULL)
+  {
+    uint8_t cmock_cb_ret = Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackFunctionPointer(Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackFunctionPointer(Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DATA_GetMaximumNumberOfReadAttempts_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE));
+  CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance, cmock_guts_index);
+  Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool = (char)1;
+}
+
+void DATA_GetMaximumNumberOfReadAttempts_CMockStopIgnore(void)
+{
+  if(Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool)
+    Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance = CMock_Guts_MemNext(Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance);
+  Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool = (char)0;
+}
+
+void DATA_GetMaximumNumberOfReadAttempts_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE));
+  CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance, cmock_guts_index);
+  Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void DATA_GetMaximumNumberOfReadAttempts_AddCallback(CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALLBACK Callback)
+{
+  Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool = (char)0;
+  Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackBool = (char)1;
+  Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackFunctionPointer = Callback;
+}
+
+void DATA_GetMaximumNumberOfReadAttempts_Stub(CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALLBACK Callback)
+{
+  Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool = (char)0;
+  Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackBool = (char)0;
+  Mock.DATA_GetMaximumNumberOfReadAttempts_CallbackFunctionPointer = Callback;
+}
+
+void DATA_GetMaximumNumberOfReadAttempts_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE));
+  CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance = CMock_Guts_MemChain(Mock.DATA_GetMaximumNumberOfReadAttempts_CallInstance, cmock_guts_index);
+  Mock.DATA_GetMaximumNumberOfReadAttempts_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+_Bool DATA_DatabaseEntryUpdatedAtLeastOnce(void* pDatabaseEntry)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_DatabaseEntryUpdatedAtLeastOnce);
+  cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance);
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance = CMock_Guts_MemNext(Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance);
+  if (Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_FinalReturn;
+    memcpy((void*)(&Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackBool &&
+      Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackFunctionPointer(pDatabaseEntry, Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDatabaseEntry)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_DatabaseEntryUpdatedAtLeastOnce,CMockString_pDatabaseEntry);
+    if (cmock_call_instance->Expected_pDatabaseEntry == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDatabaseEntry, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDatabaseEntry, pDatabaseEntry, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackFunctionPointer(pDatabaseEntry, Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDatabaseEntry, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDatabaseEntry, (void*)cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Val,
+      cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_DatabaseEntryUpdatedAtLeastOnce(CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE* cmock_call_instance, void* pDatabaseEntry);
+void CMockExpectParameters_DATA_DatabaseEntryUpdatedAtLeastOnce(CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE* cmock_call_instance, void* pDatabaseEntry)
+{
+  cmock_call_instance->Expected_pDatabaseEntry = pDatabaseEntry;
+  cmock_call_instance->IgnoreArg_pDatabaseEntry = 0;
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Used = 0;
+}
+
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE));
+  CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance = CMock_Guts_MemChain(Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance, cmock_guts_index);
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool = (char)1;
+}
+
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockStopIgnore(void)
+{
+  if(Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool)
+    Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance = CMock_Guts_MemNext(Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance);
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool = (char)0;
+}
+
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE));
+  CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance = CMock_Guts_MemChain(Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance, cmock_guts_index);
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_DatabaseEntryUpdatedAtLeastOnce(cmock_call_instance, pDatabaseEntry);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void DATA_DatabaseEntryUpdatedAtLeastOnce_AddCallback(CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALLBACK Callback)
+{
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool = (char)0;
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackBool = (char)1;
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackFunctionPointer = Callback;
+}
+
+void DATA_DatabaseEntryUpdatedAtLeastOnce_Stub(CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALLBACK Callback)
+{
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool = (char)0;
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackBool = (char)0;
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallbackFunctionPointer = Callback;
+}
+
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE));
+  CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance = CMock_Guts_MemChain(Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance, cmock_guts_index);
+  Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_DatabaseEntryUpdatedAtLeastOnce(cmock_call_instance, pDatabaseEntry);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockReturnMemThruPtr_pDatabaseEntry(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, size_t cmock_size)
+{
+  CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Val = pDatabaseEntry;
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Size = cmock_size;
+}
+
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockIgnoreArg_pDatabaseEntry(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_DatabaseEntryUpdatedAtLeastOnce_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDatabaseEntry = 1;
+}
+
+_Bool DATA_DatabaseEntryUpdatedRecently(void* pDatabaseEntry, uint32_t timeInterval)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_DatabaseEntryUpdatedRecently);
+  cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance);
+  Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance = CMock_Guts_MemNext(Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance);
+  if (Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_DatabaseEntryUpdatedRecently_FinalReturn;
+    memcpy((void*)(&Mock.DATA_DatabaseEntryUpdatedRecently_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_DatabaseEntryUpdatedRecently_CallbackBool &&
+      Mock.DATA_DatabaseEntryUpdatedRecently_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.DATA_DatabaseEntryUpdatedRecently_CallbackFunctionPointer(pDatabaseEntry, timeInterval, Mock.DATA_DatabaseEntryUpdatedRecently_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDatabaseEntry)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_DatabaseEntryUpdatedRecently,CMockString_pDatabaseEntry);
+    if (cmock_call_instance->Expected_pDatabaseEntry == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDatabaseEntry, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDatabaseEntry, pDatabaseEntry, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_timeInterval)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_DatabaseEntryUpdatedRecently,CMockString_timeInterval);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_timeInterval, timeInterval, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DATA_DatabaseEntryUpdatedRecently_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_DatabaseEntryUpdatedRecently_CallbackFunctionPointer(pDatabaseEntry, timeInterval, Mock.DATA_DatabaseEntryUpdatedRecently_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDatabaseEntry, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDatabaseEntry, (void*)cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Val,
+      cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_DatabaseEntryUpdatedRecently(CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE* cmock_call_instance, void* pDatabaseEntry, uint32_t timeInterval);
+void CMockExpectParameters_DATA_DatabaseEntryUpdatedRecently(CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE* cmock_call_instance, void* pDatabaseEntry, uint32_t timeInterval)
+{
+  cmock_call_instance->Expected_pDatabaseEntry = pDatabaseEntry;
+  cmock_call_instance->IgnoreArg_pDatabaseEntry = 0;
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Used = 0;
+  cmock_call_instance->Expected_timeInterval = timeInterval;
+  cmock_call_instance->IgnoreArg_timeInterval = 0;
+}
+
+void DATA_DatabaseEntryUpdatedRecently_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE));
+  CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance = CMock_Guts_MemChain(Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance, cmock_guts_index);
+  Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool = (char)1;
+}
+
+void DATA_DatabaseEntryUpdatedRecently_CMockStopIgnore(void)
+{
+  if(Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool)
+    Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance = CMock_Guts_MemNext(Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance);
+  Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool = (char)0;
+}
+
+void DATA_DatabaseEntryUpdatedRecently_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, uint32_t timeInterval, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE));
+  CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance = CMock_Guts_MemChain(Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance, cmock_guts_index);
+  Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_DatabaseEntryUpdatedRecently(cmock_call_instance, pDatabaseEntry, timeInterval);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void DATA_DatabaseEntryUpdatedRecently_AddCallback(CMOCK_DATA_DatabaseEntryUpdatedRecently_CALLBACK Callback)
+{
+  Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool = (char)0;
+  Mock.DATA_DatabaseEntryUpdatedRecently_CallbackBool = (char)1;
+  Mock.DATA_DatabaseEntryUpdatedRecently_CallbackFunctionPointer = Callback;
+}
+
+void DATA_DatabaseEntryUpdatedRecently_Stub(CMOCK_DATA_DatabaseEntryUpdatedRecently_CALLBACK Callback)
+{
+  Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool = (char)0;
+  Mock.DATA_DatabaseEntryUpdatedRecently_CallbackBool = (char)0;
+  Mock.DATA_DatabaseEntryUpdatedRecently_CallbackFunctionPointer = Callback;
+}
+
+void DATA_DatabaseEntryUpdatedRecently_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, uint32_t timeInterval, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE));
+  CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance = CMock_Guts_MemChain(Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance, cmock_guts_index);
+  Mock.DATA_DatabaseEntryUpdatedRecently_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_DatabaseEntryUpdatedRecently(cmock_call_instance, pDatabaseEntry, timeInterval);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_DatabaseEntryUpdatedRecently_CMockReturnMemThruPtr_pDatabaseEntry(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, size_t cmock_size)
+{
+  CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Val = pDatabaseEntry;
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Size = cmock_size;
+}
+
+void DATA_DatabaseEntryUpdatedRecently_CMockIgnoreArg_pDatabaseEntry(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDatabaseEntry = 1;
+}
+
+void DATA_DatabaseEntryUpdatedRecently_CMockIgnoreArg_timeInterval(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedRecently_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_DatabaseEntryUpdatedRecently_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_timeInterval = 1;
+}
+
+_Bool DATA_DatabaseEntryUpdatedWithinInterval(void* pDatabaseEntry, uint32_t timeInterval)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DATA_DatabaseEntryUpdatedWithinInterval);
+  cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance);
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance = CMock_Guts_MemNext(Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance);
+  if (Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DATA_DatabaseEntryUpdatedWithinInterval_FinalReturn;
+    memcpy((void*)(&Mock.DATA_DatabaseEntryUpdatedWithinInterval_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackBool &&
+      Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackFunctionPointer(pDatabaseEntry, timeInterval, Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDatabaseEntry)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_DatabaseEntryUpdatedWithinInterval,CMockString_pDatabaseEntry);
+    if (cmock_call_instance->Expected_pDatabaseEntry == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDatabaseEntry, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDatabaseEntry, pDatabaseEntry, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_timeInterval)
+  {
+    UNITY_SET_DETAILS(CMockString_DATA_DatabaseEntryUpdatedWithinInterval,CMockString_timeInterval);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_timeInterval, timeInterval, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackFunctionPointer(pDatabaseEntry, timeInterval, Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDatabaseEntry, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDatabaseEntry, (void*)cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Val,
+      cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DATA_DatabaseEntryUpdatedWithinInterval(CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE* cmock_call_instance, void* pDatabaseEntry, uint32_t timeInterval);
+void CMockExpectParameters_DATA_DatabaseEntryUpdatedWithinInterval(CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE* cmock_call_instance, void* pDatabaseEntry, uint32_t timeInterval)
+{
+  cmock_call_instance->Expected_pDatabaseEntry = pDatabaseEntry;
+  cmock_call_instance->IgnoreArg_pDatabaseEntry = 0;
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Used = 0;
+  cmock_call_instance->Expected_timeInterval = timeInterval;
+  cmock_call_instance->IgnoreArg_timeInterval = 0;
+}
+
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE));
+  CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance = CMock_Guts_MemChain(Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance, cmock_guts_index);
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool = (char)1;
+}
+
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockStopIgnore(void)
+{
+  if(Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool)
+    Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance = CMock_Guts_MemNext(Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance);
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool = (char)0;
+}
+
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, uint32_t timeInterval, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE));
+  CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance = CMock_Guts_MemChain(Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance, cmock_guts_index);
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_DatabaseEntryUpdatedWithinInterval(cmock_call_instance, pDatabaseEntry, timeInterval);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void DATA_DatabaseEntryUpdatedWithinInterval_AddCallback(CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALLBACK Callback)
+{
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool = (char)0;
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackBool = (char)1;
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackFunctionPointer = Callback;
+}
+
+void DATA_DatabaseEntryUpdatedWithinInterval_Stub(CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALLBACK Callback)
+{
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool = (char)0;
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackBool = (char)0;
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallbackFunctionPointer = Callback;
+}
+
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, uint32_t timeInterval, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE));
+  CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance = CMock_Guts_MemChain(Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance, cmock_guts_index);
+  Mock.DATA_DatabaseEntryUpdatedWithinInterval_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DATA_DatabaseEntryUpdatedWithinInterval(cmock_call_instance, pDatabaseEntry, timeInterval);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockReturnMemThruPtr_pDatabaseEntry(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, size_t cmock_size)
+{
+  CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Val = pDatabaseEntry;
+  cmock_call_instance->ReturnThruPtr_pDatabaseEntry_Size = cmock_size;
+}
+
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockIgnoreArg_pDatabaseEntry(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDatabaseEntry = 1;
+}
+
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockIgnoreArg_timeInterval(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE* cmock_call_instance = (CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DATA_DatabaseEntryUpdatedWithinInterval_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_timeInterval = 1;
+}
+
+void TEST_DATA_WriteEntryWithSequenceLock(void* pDataFromSender)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_DATA_WriteEntryWithSequenceLock);
+  cmock_call_instance = (CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance);
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance = CMock_Guts_MemNext(Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance);
+  if (Mock.TEST_DATA_WriteEntryWithSequenceLock_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackBool &&
+      Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackFunctionPointer(pDataFromSender, Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataFromSender)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_WriteEntryWithSequenceLock,CMockString_pDataFromSender);
+    if (cmock_call_instance->Expected_pDataFromSender == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataFromSender, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataFromSender, pDataFromSender, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackFunctionPointer(pDataFromSender, Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataFromSender_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataFromSender, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataFromSender, (void*)cmock_call_instance->ReturnThruPtr_pDataFromSender_Val,
+      cmock_call_instance->ReturnThruPtr_pDataFromSender_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_DATA_WriteEntryWithSequenceLock(CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender);
+void CMockExpectParameters_TEST_DATA_WriteEntryWithSequenceLock(CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance, void* pDataFromSender)
+{
+  cmock_call_instance->Expected_pDataFromSender = pDataFromSender;
+  cmock_call_instance->IgnoreArg_pDataFromSender = 0;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender_Used = 0;
+}
+
+void TEST_DATA_WriteEntryWithSequenceLock_CMockIgnore(void)
+{
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_IgnoreBool = (char)1;
+}
+
+void TEST_DATA_WriteEntryWithSequenceLock_CMockStopIgnore(void)
+{
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_IgnoreBool = (char)0;
+}
+
+void TEST_DATA_WriteEntryWithSequenceLock_CMockExpect(UNITY_LINE_TYPE cmock_line, void* pDataFromSender)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE));
+  CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_WriteEntryWithSequenceLock(cmock_call_instance, pDataFromSender);
+}
+
+void TEST_DATA_WriteEntryWithSequenceLock_AddCallback(CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALLBACK Callback)
+{
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_IgnoreBool = (char)0;
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackBool = (char)1;
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_WriteEntryWithSequenceLock_Stub(CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALLBACK Callback)
+{
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_IgnoreBool = (char)0;
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackBool = (char)0;
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_WriteEntryWithSequenceLock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE));
+  CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_WriteEntryWithSequenceLock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_WriteEntryWithSequenceLock(cmock_call_instance, pDataFromSender);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_DATA_WriteEntryWithSequenceLock_CMockReturnMemThruPtr_pDataFromSender(UNITY_LINE_TYPE cmock_line, void* pDataFromSender, size_t cmock_size)
+{
+  CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataFromSender_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender_Val = pDataFromSender;
+  cmock_call_instance->ReturnThruPtr_pDataFromSender_Size = cmock_size;
+}
+
+void TEST_DATA_WriteEntryWithSequenceLock_CMockIgnoreArg_pDataFromSender(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_WriteEntryWithSequenceLock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataFromSender = 1;
+}
+
+void TEST_DATA_ReadEntryWithSequenceLock(void* pDataToReceiver)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_DATA_ReadEntryWithSequenceLock);
+  cmock_call_instance = (CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance);
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance = CMock_Guts_MemNext(Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance);
+  if (Mock.TEST_DATA_ReadEntryWithSequenceLock_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackBool &&
+      Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackFunctionPointer(pDataToReceiver, Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_ReadEntryWithSequenceLock,CMockString_pDataToReceiver);
+    if (cmock_call_instance->Expected_pDataToReceiver == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver, pDataToReceiver, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackFunctionPointer(pDataToReceiver, Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_DATA_ReadEntryWithSequenceLock(CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver);
+void CMockExpectParameters_TEST_DATA_ReadEntryWithSequenceLock(CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance, void* pDataToReceiver)
+{
+  cmock_call_instance->Expected_pDataToReceiver = pDataToReceiver;
+  cmock_call_instance->IgnoreArg_pDataToReceiver = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used = 0;
+}
+
+void TEST_DATA_ReadEntryWithSequenceLock_CMockIgnore(void)
+{
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_IgnoreBool = (char)1;
+}
+
+void TEST_DATA_ReadEntryWithSequenceLock_CMockStopIgnore(void)
+{
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_IgnoreBool = (char)0;
+}
+
+void TEST_DATA_ReadEntryWithSequenceLock_CMockExpect(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE));
+  CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_ReadEntryWithSequenceLock(cmock_call_instance, pDataToReceiver);
+}
+
+void TEST_DATA_ReadEntryWithSequenceLock_AddCallback(CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALLBACK Callback)
+{
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_IgnoreBool = (char)0;
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackBool = (char)1;
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_ReadEntryWithSequenceLock_Stub(CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALLBACK Callback)
+{
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_IgnoreBool = (char)0;
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackBool = (char)0;
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_ReadEntryWithSequenceLock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE));
+  CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_ReadEntryWithSequenceLock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_ReadEntryWithSequenceLock(cmock_call_instance, pDataToReceiver);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_DATA_ReadEntryWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, size_t cmock_size)
+{
+  CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Val = pDataToReceiver;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Size = cmock_size;
+}
+
+void TEST_DATA_ReadEntryWithSequenceLock_CMockIgnoreArg_pDataToReceiver(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_ReadEntryWithSequenceLock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver = 1;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock(DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_DATA_ReadRangeWithSequenceLock);
+  cmock_call_instance = (CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance);
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance = CMock_Guts_MemNext(Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance);
+  if (Mock.TEST_DATA_ReadRangeWithSequenceLock_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackBool &&
+      Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackFunctionPointer(blockId, pDataToReceiver, offset, length, Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_ReadRangeWithSequenceLock,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_ReadRangeWithSequenceLock,CMockString_pDataToReceiver);
+    if (cmock_call_instance->Expected_pDataToReceiver == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver, pDataToReceiver, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_offset)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_ReadRangeWithSequenceLock,CMockString_offset);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_offset, offset, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_length)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_ReadRangeWithSequenceLock,CMockString_length);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_length, length, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackFunctionPointer(blockId, pDataToReceiver, offset, length, Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_DATA_ReadRangeWithSequenceLock(CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length);
+void CMockExpectParameters_TEST_DATA_ReadRangeWithSequenceLock(CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+  cmock_call_instance->Expected_pDataToReceiver = pDataToReceiver;
+  cmock_call_instance->IgnoreArg_pDataToReceiver = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used = 0;
+  cmock_call_instance->Expected_offset = offset;
+  cmock_call_instance->IgnoreArg_offset = 0;
+  cmock_call_instance->Expected_length = length;
+  cmock_call_instance->IgnoreArg_length = 0;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnore(void)
+{
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_IgnoreBool = (char)1;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_CMockStopIgnore(void)
+{
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_IgnoreBool = (char)0;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE));
+  CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_ReadRangeWithSequenceLock(cmock_call_instance, blockId, pDataToReceiver, offset, length);
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_AddCallback(CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALLBACK Callback)
+{
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_IgnoreBool = (char)0;
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackBool = (char)1;
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_Stub(CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALLBACK Callback)
+{
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_IgnoreBool = (char)0;
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackBool = (char)0;
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE));
+  CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_ReadRangeWithSequenceLock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_ReadRangeWithSequenceLock(cmock_call_instance, blockId, pDataToReceiver, offset, length);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, size_t cmock_size)
+{
+  CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Val = pDataToReceiver;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Size = cmock_size;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_pDataToReceiver(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver = 1;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_offset = 1;
+}
+
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_ReadRangeWithSequenceLock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_length = 1;
+}
+
+void TEST_DATA_CopyRange(DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_DATA_CopyRange);
+  cmock_call_instance = (CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_DATA_CopyRange_CallInstance);
+  Mock.TEST_DATA_CopyRange_CallInstance = CMock_Guts_MemNext(Mock.TEST_DATA_CopyRange_CallInstance);
+  if (Mock.TEST_DATA_CopyRange_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_DATA_CopyRange_CallbackBool &&
+      Mock.TEST_DATA_CopyRange_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_CopyRange_CallbackFunctionPointer(blockId, pDataToReceiver, offset, length, Mock.TEST_DATA_CopyRange_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_CopyRange,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pDataToReceiver)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_CopyRange,CMockString_pDataToReceiver);
+    if (cmock_call_instance->Expected_pDataToReceiver == NULL)
+      { UNITY_TEST_ASSERT_NULL(pDataToReceiver, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pDataToReceiver, pDataToReceiver, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_offset)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_CopyRange,CMockString_offset);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_offset, offset, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_length)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_CopyRange,CMockString_length);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_length, length, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_DATA_CopyRange_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_CopyRange_CallbackFunctionPointer(blockId, pDataToReceiver, offset, length, Mock.TEST_DATA_CopyRange_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pDataToReceiver, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pDataToReceiver, (void*)cmock_call_instance->ReturnThruPtr_pDataToReceiver_Val,
+      cmock_call_instance->ReturnThruPtr_pDataToReceiver_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_DATA_CopyRange(CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length);
+void CMockExpectParameters_TEST_DATA_CopyRange(CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+  cmock_call_instance->Expected_pDataToReceiver = pDataToReceiver;
+  cmock_call_instance->IgnoreArg_pDataToReceiver = 0;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used = 0;
+  cmock_call_instance->Expected_offset = offset;
+  cmock_call_instance->IgnoreArg_offset = 0;
+  cmock_call_instance->Expected_length = length;
+  cmock_call_instance->IgnoreArg_length = 0;
+}
+
+void TEST_DATA_CopyRange_CMockIgnore(void)
+{
+  Mock.TEST_DATA_CopyRange_IgnoreBool = (char)1;
+}
+
+void TEST_DATA_CopyRange_CMockStopIgnore(void)
+{
+  Mock.TEST_DATA_CopyRange_IgnoreBool = (char)0;
+}
+
+void TEST_DATA_CopyRange_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE));
+  CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_CopyRange_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_CopyRange_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_CopyRange_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_CopyRange(cmock_call_instance, blockId, pDataToReceiver, offset, length);
+}
+
+void TEST_DATA_CopyRange_AddCallback(CMOCK_TEST_DATA_CopyRange_CALLBACK Callback)
+{
+  Mock.TEST_DATA_CopyRange_IgnoreBool = (char)0;
+  Mock.TEST_DATA_CopyRange_CallbackBool = (char)1;
+  Mock.TEST_DATA_CopyRange_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_CopyRange_Stub(CMOCK_TEST_DATA_CopyRange_CALLBACK Callback)
+{
+  Mock.TEST_DATA_CopyRange_IgnoreBool = (char)0;
+  Mock.TEST_DATA_CopyRange_CallbackBool = (char)0;
+  Mock.TEST_DATA_CopyRange_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_CopyRange_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE));
+  CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_CopyRange_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_CopyRange_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_CopyRange_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_CopyRange(cmock_call_instance, blockId, pDataToReceiver, offset, length);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_DATA_CopyRange_CMockReturnMemThruPtr_pDataToReceiver(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, size_t cmock_size)
+{
+  CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_CopyRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Val = pDataToReceiver;
+  cmock_call_instance->ReturnThruPtr_pDataToReceiver_Size = cmock_size;
+}
+
+void TEST_DATA_CopyRange_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_CopyRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void TEST_DATA_CopyRange_CMockIgnoreArg_pDataToReceiver(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_CopyRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pDataToReceiver = 1;
+}
+
+void TEST_DATA_CopyRange_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_CopyRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_offset = 1;
+}
+
+void TEST_DATA_CopyRange_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_CopyRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_CopyRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_length = 1;
+}
+
+void TEST_DATA_NotifySubscribers(DATA_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_DATA_NotifySubscribers);
+  cmock_call_instance = (CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_DATA_NotifySubscribers_CallInstance);
+  Mock.TEST_DATA_NotifySubscribers_CallInstance = CMock_Guts_MemNext(Mock.TEST_DATA_NotifySubscribers_CallInstance);
+  if (Mock.TEST_DATA_NotifySubscribers_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_DATA_NotifySubscribers_CallbackBool &&
+      Mock.TEST_DATA_NotifySubscribers_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_NotifySubscribers_CallbackFunctionPointer(blockId, Mock.TEST_DATA_NotifySubscribers_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_NotifySubscribers,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_DATA_NotifySubscribers_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_NotifySubscribers_CallbackFunctionPointer(blockId, Mock.TEST_DATA_NotifySubscribers_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_DATA_NotifySubscribers(CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId);
+void CMockExpectParameters_TEST_DATA_NotifySubscribers(CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void TEST_DATA_NotifySubscribers_CMockIgnore(void)
+{
+  Mock.TEST_DATA_NotifySubscribers_IgnoreBool = (char)1;
+}
+
+void TEST_DATA_NotifySubscribers_CMockStopIgnore(void)
+{
+  Mock.TEST_DATA_NotifySubscribers_IgnoreBool = (char)0;
+}
+
+void TEST_DATA_NotifySubscribers_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE));
+  CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_NotifySubscribers_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_NotifySubscribers_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_NotifySubscribers_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_NotifySubscribers(cmock_call_instance, blockId);
+}
+
+void TEST_DATA_NotifySubscribers_AddCallback(CMOCK_TEST_DATA_NotifySubscribers_CALLBACK Callback)
+{
+  Mock.TEST_DATA_NotifySubscribers_IgnoreBool = (char)0;
+  Mock.TEST_DATA_NotifySubscribers_CallbackBool = (char)1;
+  Mock.TEST_DATA_NotifySubscribers_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_NotifySubscribers_Stub(CMOCK_TEST_DATA_NotifySubscribers_CALLBACK Callback)
+{
+  Mock.TEST_DATA_NotifySubscribers_IgnoreBool = (char)0;
+  Mock.TEST_DATA_NotifySubscribers_CallbackBool = (char)0;
+  Mock.TEST_DATA_NotifySubscribers_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_NotifySubscribers_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE));
+  CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_NotifySubscribers_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_NotifySubscribers_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_NotifySubscribers_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_NotifySubscribers(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_DATA_NotifySubscribers_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_NotifySubscribers_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_NotifySubscribers_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+uint32_t TEST_DATA_GetSequenceCounter(DATA_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_DATA_GetSequenceCounter);
+  cmock_call_instance = (CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_DATA_GetSequenceCounter_CallInstance);
+  Mock.TEST_DATA_GetSequenceCounter_CallInstance = CMock_Guts_MemNext(Mock.TEST_DATA_GetSequenceCounter_CallInstance);
+  if (Mock.TEST_DATA_GetSequenceCounter_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_DATA_GetSequenceCounter_FinalReturn;
+    Mock.TEST_DATA_GetSequenceCounter_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_DATA_GetSequenceCounter_CallbackBool &&
+      Mock.TEST_DATA_GetSequenceCounter_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.TEST_DATA_GetSequenceCounter_CallbackFunctionPointer(blockId, Mock.TEST_DATA_GetSequenceCounter_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_GetSequenceCounter,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_DATA_GetSequenceCounter_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_DATA_GetSequenceCounter_CallbackFunctionPointer(blockId, Mock.TEST_DATA_GetSequenceCounter_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_DATA_GetSequenceCounter(CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId);
+void CMockExpectParameters_TEST_DATA_GetSequenceCounter(CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void TEST_DATA_GetSequenceCounter_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE));
+  CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_GetSequenceCounter_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_GetSequenceCounter_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_GetSequenceCounter_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_DATA_GetSequenceCounter_IgnoreBool = (char)1;
+}
+
+void TEST_DATA_GetSequenceCounter_CMockStopIgnore(void)
+{
+  if(Mock.TEST_DATA_GetSequenceCounter_IgnoreBool)
+    Mock.TEST_DATA_GetSequenceCounter_CallInstance = CMock_Guts_MemNext(Mock.TEST_DATA_GetSequenceCounter_CallInstance);
+  Mock.TEST_DATA_GetSequenceCounter_IgnoreBool = (char)0;
+}
+
+void TEST_DATA_GetSequenceCounter_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE));
+  CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_GetSequenceCounter_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_GetSequenceCounter_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_GetSequenceCounter_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_GetSequenceCounter(cmock_call_instance, blockId);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_DATA_GetSequenceCounter_AddCallback(CMOCK_TEST_DATA_GetSequenceCounter_CALLBACK Callback)
+{
+  Mock.TEST_DATA_GetSequenceCounter_IgnoreBool = (char)0;
+  Mock.TEST_DATA_GetSequenceCounter_CallbackBool = (char)1;
+  Mock.TEST_DATA_GetSequenceCounter_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_GetSequenceCounter_Stub(CMOCK_TEST_DATA_GetSequenceCounter_CALLBACK Callback)
+{
+  Mock.TEST_DATA_GetSequenceCounter_IgnoreBool = (char)0;
+  Mock.TEST_DATA_GetSequenceCounter_CallbackBool = (char)0;
+  Mock.TEST_DATA_GetSequenceCounter_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_GetSequenceCounter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE));
+  CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_GetSequenceCounter_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_GetSequenceCounter_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_GetSequenceCounter_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_GetSequenceCounter(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_DATA_GetSequenceCounter_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_GetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_GetSequenceCounter_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void TEST_DATA_SetSequenceCounter(DATA_BLOCK_ID_e blockId, uint32_t value)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_DATA_SetSequenceCounter);
+  cmock_call_instance = (CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_DATA_SetSequenceCounter_CallInstance);
+  Mock.TEST_DATA_SetSequenceCounter_CallInstance = CMock_Guts_MemNext(Mock.TEST_DATA_SetSequenceCounter_CallInstance);
+  if (Mock.TEST_DATA_SetSequenceCounter_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_DATA_SetSequenceCounter_CallbackBool &&
+      Mock.TEST_DATA_SetSequenceCounter_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_SetSequenceCounter_CallbackFunctionPointer(blockId, value, Mock.TEST_DATA_SetSequenceCounter_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_SetSequenceCounter,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(DATA_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_value)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_DATA_SetSequenceCounter,CMockString_value);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_value, value, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_DATA_SetSequenceCounter_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_DATA_SetSequenceCounter_CallbackFunctionPointer(blockId, value, Mock.TEST_DATA_SetSequenceCounter_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_DATA_SetSequenceCounter(CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, uint32_t value);
+void CMockExpectParameters_TEST_DATA_SetSequenceCounter(CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_ID_e blockId, uint32_t value)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(DATA_BLOCK_ID_e[sizeof(blockId) == sizeof(DATA_BLOCK_ID_e) ? 1 : -1])); /* add DATA_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+  cmock_call_instance->Expected_value = value;
+  cmock_call_instance->IgnoreArg_value = 0;
+}
+
+void TEST_DATA_SetSequenceCounter_CMockIgnore(void)
+{
+  Mock.TEST_DATA_SetSequenceCounter_IgnoreBool = (char)1;
+}
+
+void TEST_DATA_SetSequenceCounter_CMockStopIgnore(void)
+{
+  Mock.TEST_DATA_SetSequenceCounter_IgnoreBool = (char)0;
+}
+
+void TEST_DATA_SetSequenceCounter_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t value)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE));
+  CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_SetSequenceCounter_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_SetSequenceCounter_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_SetSequenceCounter_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_SetSequenceCounter(cmock_call_instance, blockId, value);
+}
+
+void TEST_DATA_SetSequenceCounter_AddCallback(CMOCK_TEST_DATA_SetSequenceCounter_CALLBACK Callback)
+{
+  Mock.TEST_DATA_SetSequenceCounter_IgnoreBool = (char)0;
+  Mock.TEST_DATA_SetSequenceCounter_CallbackBool = (char)1;
+  Mock.TEST_DATA_SetSequenceCounter_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_SetSequenceCounter_Stub(CMOCK_TEST_DATA_SetSequenceCounter_CALLBACK Callback)
+{
+  Mock.TEST_DATA_SetSequenceCounter_IgnoreBool = (char)0;
+  Mock.TEST_DATA_SetSequenceCounter_CallbackBool = (char)0;
+  Mock.TEST_DATA_SetSequenceCounter_CallbackFunctionPointer = Callback;
+}
+
+void TEST_DATA_SetSequenceCounter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t value, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE));
+  CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_DATA_SetSequenceCounter_CallInstance = CMock_Guts_MemChain(Mock.TEST_DATA_SetSequenceCounter_CallInstance, cmock_guts_index);
+  Mock.TEST_DATA_SetSequenceCounter_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_DATA_SetSequenceCounter(cmock_call_instance, blockId, value);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_DATA_SetSequenceCounter_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_SetSequenceCounter_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void TEST_DATA_SetSequenceCounter_CMockIgnoreArg_value(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_DATA_SetSequenceCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_DATA_SetSequenceCounter_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_value = 1;
+}
+
@@ -0,0 +1,594 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKDATABASE_H
+#define _MOCKDATABASE_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "database.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockdatabase_Init(void);
+void Mockdatabase_Destroy(void);
+void Mockdatabase_Verify(void);
+
+
+
+
+#define DATA_DummyFunction_Ignore() DATA_DummyFunction_CMockIgnore()
+void DATA_DummyFunction_CMockIgnore(void);
+#define DATA_DummyFunction_StopIgnore() DATA_DummyFunction_CMockStopIgnore()
+void DATA_DummyFunction_CMockStopIgnore(void);
+#define DATA_DummyFunction_Expect() DATA_DummyFunction_CMockExpect(__LINE__)
+void DATA_DummyFunction_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DATA_DummyFunction_CALLBACK)(int cmock_num_calls);
+void DATA_DummyFunction_AddCallback(CMOCK_DATA_DummyFunction_CALLBACK Callback);
+void DATA_DummyFunction_Stub(CMOCK_DATA_DummyFunction_CALLBACK Callback);
+#define DATA_DummyFunction_StubWithCallback DATA_DummyFunction_Stub
+#define DATA_DummyFunction_ExpectAndThrow(cmock_to_throw) DATA_DummyFunction_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DATA_DummyFunction_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DATA_Init_IgnoreAndReturn(cmock_retval) DATA_Init_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_Init_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_Init_StopIgnore() DATA_Init_CMockStopIgnore()
+void DATA_Init_CMockStopIgnore(void);
+#define DATA_Init_ExpectAndReturn(cmock_retval) DATA_Init_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DATA_Init_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_Init_CALLBACK)(int cmock_num_calls);
+void DATA_Init_AddCallback(CMOCK_DATA_Init_CALLBACK Callback);
+void DATA_Init_Stub(CMOCK_DATA_Init_CALLBACK Callback);
+#define DATA_Init_StubWithCallback DATA_Init_Stub
+#define DATA_Init_ExpectAndThrow(cmock_to_throw) DATA_Init_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DATA_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DATA_Task_Ignore() DATA_Task_CMockIgnore()
+void DATA_Task_CMockIgnore(void);
+#define DATA_Task_StopIgnore() DATA_Task_CMockStopIgnore()
+void DATA_Task_CMockStopIgnore(void);
+#define DATA_Task_Expect() DATA_Task_CMockExpect(__LINE__)
+void DATA_Task_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DATA_Task_CALLBACK)(int cmock_num_calls);
+void DATA_Task_AddCallback(CMOCK_DATA_Task_CALLBACK Callback);
+void DATA_Task_Stub(CMOCK_DATA_Task_CALLBACK Callback);
+#define DATA_Task_StubWithCallback DATA_Task_Stub
+#define DATA_Task_ExpectAndThrow(cmock_to_throw) DATA_Task_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DATA_Task_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DATA_Write_1_DataBlock_IgnoreAndReturn(cmock_retval) DATA_Write_1_DataBlock_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_Write_1_DataBlock_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_Write_1_DataBlock_StopIgnore() DATA_Write_1_DataBlock_CMockStopIgnore()
+void DATA_Write_1_DataBlock_CMockStopIgnore(void);
+#define DATA_Write_1_DataBlock_ExpectAndReturn(pDataFromSender0, cmock_retval) DATA_Write_1_DataBlock_CMockExpectAndReturn(__LINE__, pDataFromSender0, cmock_retval)
+void DATA_Write_1_DataBlock_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_Write_1_DataBlock_CALLBACK)(void* pDataFromSender0, int cmock_num_calls);
+void DATA_Write_1_DataBlock_AddCallback(CMOCK_DATA_Write_1_DataBlock_CALLBACK Callback);
+void DATA_Write_1_DataBlock_Stub(CMOCK_DATA_Write_1_DataBlock_CALLBACK Callback);
+#define DATA_Write_1_DataBlock_StubWithCallback DATA_Write_1_DataBlock_Stub
+#define DATA_Write_1_DataBlock_ExpectAndThrow(pDataFromSender0, cmock_to_throw) DATA_Write_1_DataBlock_CMockExpectAndThrow(__LINE__, pDataFromSender0, cmock_to_throw)
+void DATA_Write_1_DataBlock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, CEXCEPTION_T cmock_to_throw);
+#define DATA_Write_1_DataBlock_ReturnThruPtr_pDataFromSender0(pDataFromSender0) DATA_Write_1_DataBlock_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, sizeof(void))
+#define DATA_Write_1_DataBlock_ReturnArrayThruPtr_pDataFromSender0(pDataFromSender0, cmock_len) DATA_Write_1_DataBlock_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, cmock_len * sizeof(*pDataFromSender0))
+#define DATA_Write_1_DataBlock_ReturnMemThruPtr_pDataFromSender0(pDataFromSender0, cmock_size) DATA_Write_1_DataBlock_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, cmock_size)
+void DATA_Write_1_DataBlock_CMockReturnMemThruPtr_pDataFromSender0(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, size_t cmock_size);
+#define DATA_Write_1_DataBlock_IgnoreArg_pDataFromSender0() DATA_Write_1_DataBlock_CMockIgnoreArg_pDataFromSender0(__LINE__)
+void DATA_Write_1_DataBlock_CMockIgnoreArg_pDataFromSender0(UNITY_LINE_TYPE cmock_line);
+#define DATA_Write_2_DataBlocks_IgnoreAndReturn(cmock_retval) DATA_Write_2_DataBlocks_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_Write_2_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_Write_2_DataBlocks_StopIgnore() DATA_Write_2_DataBlocks_CMockStopIgnore()
+void DATA_Write_2_DataBlocks_CMockStopIgnore(void);
+#define DATA_Write_2_DataBlocks_ExpectAndReturn(pDataFromSender0, pDataFromSender1, cmock_retval) DATA_Write_2_DataBlocks_CMockExpectAndReturn(__LINE__, pDataFromSender0, pDataFromSender1, cmock_retval)
+void DATA_Write_2_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_Write_2_DataBlocks_CALLBACK)(void* pDataFromSender0, void* pDataFromSender1, int cmock_num_calls);
+void DATA_Write_2_DataBlocks_AddCallback(CMOCK_DATA_Write_2_DataBlocks_CALLBACK Callback);
+void DATA_Write_2_DataBlocks_Stub(CMOCK_DATA_Write_2_DataBlocks_CALLBACK Callback);
+#define DATA_Write_2_DataBlocks_StubWithCallback DATA_Write_2_DataBlocks_Stub
+#define DATA_Write_2_DataBlocks_ExpectAndThrow(pDataFromSender0, pDataFromSender1, cmock_to_throw) DATA_Write_2_DataBlocks_CMockExpectAndThrow(__LINE__, pDataFromSender0, pDataFromSender1, cmock_to_throw)
+void DATA_Write_2_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, CEXCEPTION_T cmock_to_throw);
+#define DATA_Write_2_DataBlocks_ReturnThruPtr_pDataFromSender0(pDataFromSender0) DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, sizeof(void))
+#define DATA_Write_2_DataBlocks_ReturnArrayThruPtr_pDataFromSender0(pDataFromSender0, cmock_len) DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, cmock_len * sizeof(*pDataFromSender0))
+#define DATA_Write_2_DataBlocks_ReturnMemThruPtr_pDataFromSender0(pDataFromSender0, cmock_size) DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, cmock_size)
+void DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, size_t cmock_size);
+#define DATA_Write_2_DataBlocks_ReturnThruPtr_pDataFromSender1(pDataFromSender1) DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(__LINE__, pDataFromSender1, sizeof(void))
+#define DATA_Write_2_DataBlocks_ReturnArrayThruPtr_pDataFromSender1(pDataFromSender1, cmock_len) DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(__LINE__, pDataFromSender1, cmock_len * sizeof(*pDataFromSender1))
+#define DATA_Write_2_DataBlocks_ReturnMemThruPtr_pDataFromSender1(pDataFromSender1, cmock_size) DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(__LINE__, pDataFromSender1, cmock_size)
+void DATA_Write_2_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(UNITY_LINE_TYPE cmock_line, void* pDataFromSender1, size_t cmock_size);
+#define DATA_Write_2_DataBlocks_IgnoreArg_pDataFromSender0() DATA_Write_2_DataBlocks_CMockIgnoreArg_pDataFromSender0(__LINE__)
+void DATA_Write_2_DataBlocks_CMockIgnoreArg_pDataFromSender0(UNITY_LINE_TYPE cmock_line);
+#define DATA_Write_2_DataBlocks_IgnoreArg_pDataFromSender1() DATA_Write_2_DataBlocks_CMockIgnoreArg_pDataFromSender1(__LINE__)
+void DATA_Write_2_DataBlocks_CMockIgnoreArg_pDataFromSender1(UNITY_LINE_TYPE cmock_line);
+#define DATA_Write_3_DataBlocks_IgnoreAndReturn(cmock_retval) DATA_Write_3_DataBlocks_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_Write_3_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_Write_3_DataBlocks_StopIgnore() DATA_Write_3_DataBlocks_CMockStopIgnore()
+void DATA_Write_3_DataBlocks_CMockStopIgnore(void);
+#define DATA_Write_3_DataBlocks_ExpectAndReturn(pDataFromSender0, pDataFromSender1, pDataFromSender2, cmock_retval) DATA_Write_3_DataBlocks_CMockExpectAndReturn(__LINE__, pDataFromSender0, pDataFromSender1, pDataFromSender2, cmock_retval)
+void DATA_Write_3_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_Write_3_DataBlocks_CALLBACK)(void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, int cmock_num_calls);
+void DATA_Write_3_DataBlocks_AddCallback(CMOCK_DATA_Write_3_DataBlocks_CALLBACK Callback);
+void DATA_Write_3_DataBlocks_Stub(CMOCK_DATA_Write_3_DataBlocks_CALLBACK Callback);
+#define DATA_Write_3_DataBlocks_StubWithCallback DATA_Write_3_DataBlocks_Stub
+#define DATA_Write_3_DataBlocks_ExpectAndThrow(pDataFromSender0, pDataFromSender1, pDataFromSender2, cmock_to_throw) DATA_Write_3_DataBlocks_CMockExpectAndThrow(__LINE__, pDataFromSender0, pDataFromSender1, pDataFromSender2, cmock_to_throw)
+void DATA_Write_3_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, CEXCEPTION_T cmock_to_throw);
+#define DATA_Write_3_DataBlocks_ReturnThruPtr_pDataFromSender0(pDataFromSender0) DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, sizeof(void))
+#define DATA_Write_3_DataBlocks_ReturnArrayThruPtr_pDataFromSender0(pDataFromSender0, cmock_len) DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, cmock_len * sizeof(*pDataFromSender0))
+#define DATA_Write_3_DataBlocks_ReturnMemThruPtr_pDataFromSender0(pDataFromSender0, cmock_size) DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, cmock_size)
+void DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, size_t cmock_size);
+#define DATA_Write_3_DataBlocks_ReturnThruPtr_pDataFromSender1(pDataFromSender1) DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(__LINE__, pDataFromSender1, sizeof(void))
+#define DATA_Write_3_DataBlocks_ReturnArrayThruPtr_pDataFromSender1(pDataFromSender1, cmock_len) DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(__LINE__, pDataFromSender1, cmock_len * sizeof(*pDataFromSender1))
+#define DATA_Write_3_DataBlocks_ReturnMemThruPtr_pDataFromSender1(pDataFromSender1, cmock_size) DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(__LINE__, pDataFromSender1, cmock_size)
+void DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(UNITY_LINE_TYPE cmock_line, void* pDataFromSender1, size_t cmock_size);
+#define DATA_Write_3_DataBlocks_ReturnThruPtr_pDataFromSender2(pDataFromSender2) DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(__LINE__, pDataFromSender2, sizeof(void))
+#define DATA_Write_3_DataBlocks_ReturnArrayThruPtr_pDataFromSender2(pDataFromSender2, cmock_len) DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(__LINE__, pDataFromSender2, cmock_len * sizeof(*pDataFromSender2))
+#define DATA_Write_3_DataBlocks_ReturnMemThruPtr_pDataFromSender2(pDataFromSender2, cmock_size) DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(__LINE__, pDataFromSender2, cmock_size)
+void DATA_Write_3_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(UNITY_LINE_TYPE cmock_line, void* pDataFromSender2, size_t cmock_size);
+#define DATA_Write_3_DataBlocks_IgnoreArg_pDataFromSender0() DATA_Write_3_DataBlocks_CMockIgnoreArg_pDataFromSender0(__LINE__)
+void DATA_Write_3_DataBlocks_CMockIgnoreArg_pDataFromSender0(UNITY_LINE_TYPE cmock_line);
+#define DATA_Write_3_DataBlocks_IgnoreArg_pDataFromSender1() DATA_Write_3_DataBlocks_CMockIgnoreArg_pDataFromSender1(__LINE__)
+void DATA_Write_3_DataBlocks_CMockIgnoreArg_pDataFromSender1(UNITY_LINE_TYPE cmock_line);
+#define DATA_Write_3_DataBlocks_IgnoreArg_pDataFromSender2() DATA_Write_3_DataBlocks_CMockIgnoreArg_pDataFromSender2(__LINE__)
+void DATA_Write_3_DataBlocks_CMockIgnoreArg_pDataFromSender2(UNITY_LINE_TYPE cmock_line);
+#define DATA_Write_4_DataBlocks_IgnoreAndReturn(cmock_retval) DATA_Write_4_DataBlocks_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_Write_4_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_Write_4_DataBlocks_StopIgnore() DATA_Write_4_DataBlocks_CMockStopIgnore()
+void DATA_Write_4_DataBlocks_CMockStopIgnore(void);
+#define DATA_Write_4_DataBlocks_ExpectAndReturn(pDataFromSender0, pDataFromSender1, pDataFromSender2, pDataFromSender3, cmock_retval) DATA_Write_4_DataBlocks_CMockExpectAndReturn(__LINE__, pDataFromSender0, pDataFromSender1, pDataFromSender2, pDataFromSender3, cmock_retval)
+void DATA_Write_4_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, void* pDataFromSender3, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_Write_4_DataBlocks_CALLBACK)(void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, void* pDataFromSender3, int cmock_num_calls);
+void DATA_Write_4_DataBlocks_AddCallback(CMOCK_DATA_Write_4_DataBlocks_CALLBACK Callback);
+void DATA_Write_4_DataBlocks_Stub(CMOCK_DATA_Write_4_DataBlocks_CALLBACK Callback);
+#define DATA_Write_4_DataBlocks_StubWithCallback DATA_Write_4_DataBlocks_Stub
+#define DATA_Write_4_DataBlocks_ExpectAndThrow(pDataFromSender0, pDataFromSender1, pDataFromSender2, pDataFromSender3, cmock_to_throw) DATA_Write_4_DataBlocks_CMockExpectAndThrow(__LINE__, pDataFromSender0, pDataFromSender1, pDataFromSender2, pDataFromSender3, cmock_to_throw)
+void DATA_Write_4_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, void* pDataFromSender1, void* pDataFromSender2, void* pDataFromSender3, CEXCEPTION_T cmock_to_throw);
+#define DATA_Write_4_DataBlocks_ReturnThruPtr_pDataFromSender0(pDataFromSender0) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, sizeof(void))
+#define DATA_Write_4_DataBlocks_ReturnArrayThruPtr_pDataFromSender0(pDataFromSender0, cmock_len) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, cmock_len * sizeof(*pDataFromSender0))
+#define DATA_Write_4_DataBlocks_ReturnMemThruPtr_pDataFromSender0(pDataFromSender0, cmock_size) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(__LINE__, pDataFromSender0, cmock_size)
+void DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender0(UNITY_LINE_TYPE cmock_line, void* pDataFromSender0, size_t cmock_size);
+#define DATA_Write_4_DataBlocks_ReturnThruPtr_pDataFromSender1(pDataFromSender1) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(__LINE__, pDataFromSender1, sizeof(void))
+#define DATA_Write_4_DataBlocks_ReturnArrayThruPtr_pDataFromSender1(pDataFromSender1, cmock_len) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(__LINE__, pDataFromSender1, cmock_len * sizeof(*pDataFromSender1))
+#define DATA_Write_4_DataBlocks_ReturnMemThruPtr_pDataFromSender1(pDataFromSender1, cmock_size) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(__LINE__, pDataFromSender1, cmock_size)
+void DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender1(UNITY_LINE_TYPE cmock_line, void* pDataFromSender1, size_t cmock_size);
+#define DATA_Write_4_DataBlocks_ReturnThruPtr_pDataFromSender2(pDataFromSender2) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(__LINE__, pDataFromSender2, sizeof(void))
+#define DATA_Write_4_DataBlocks_ReturnArrayThruPtr_pDataFromSender2(pDataFromSender2, cmock_len) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(__LINE__, pDataFromSender2, cmock_len * sizeof(*pDataFromSender2))
+#define DATA_Write_4_DataBlocks_ReturnMemThruPtr_pDataFromSender2(pDataFromSender2, cmock_size) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(__LINE__, pDataFromSender2, cmock_size)
+void DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender2(UNITY_LINE_TYPE cmock_line, void* pDataFromSender2, size_t cmock_size);
+#define DATA_Write_4_DataBlocks_ReturnThruPtr_pDataFromSender3(pDataFromSender3) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender3(__LINE__, pDataFromSender3, sizeof(void))
+#define DATA_Write_4_DataBlocks_ReturnArrayThruPtr_pDataFromSender3(pDataFromSender3, cmock_len) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender3(__LINE__, pDataFromSender3, cmock_len * sizeof(*pDataFromSender3))
+#define DATA_Write_4_DataBlocks_ReturnMemThruPtr_pDataFromSender3(pDataFromSender3, cmock_size) DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender3(__LINE__, pDataFromSender3, cmock_size)
+void DATA_Write_4_DataBlocks_CMockReturnMemThruPtr_pDataFromSender3(UNITY_LINE_TYPE cmock_line, void* pDataFromSender3, size_t cmock_size);
+#define DATA_Write_4_DataBlocks_IgnoreArg_pDataFromSender0() DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender0(__LINE__)
+void DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender0(UNITY_LINE_TYPE cmock_line);
+#define DATA_Write_4_DataBlocks_IgnoreArg_pDataFromSender1() DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender1(__LINE__)
+void DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender1(UNITY_LINE_TYPE cmock_line);
+#define DATA_Write_4_DataBlocks_IgnoreArg_pDataFromSender2() DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender2(__LINE__)
+void DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender2(UNITY_LINE_TYPE cmock_line);
+#define DATA_Write_4_DataBlocks_IgnoreArg_pDataFromSender3() DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender3(__LINE__)
+void DATA_Write_4_DataBlocks_CMockIgnoreArg_pDataFromSender3(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_1_DataBlock_IgnoreAndReturn(cmock_retval) DATA_Read_1_DataBlock_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_Read_1_DataBlock_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_Read_1_DataBlock_StopIgnore() DATA_Read_1_DataBlock_CMockStopIgnore()
+void DATA_Read_1_DataBlock_CMockStopIgnore(void);
+#define DATA_Read_1_DataBlock_ExpectAndReturn(pDataToReceiver0, cmock_retval) DATA_Read_1_DataBlock_CMockExpectAndReturn(__LINE__, pDataToReceiver0, cmock_retval)
+void DATA_Read_1_DataBlock_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_Read_1_DataBlock_CALLBACK)(void* pDataToReceiver0, int cmock_num_calls);
+void DATA_Read_1_DataBlock_AddCallback(CMOCK_DATA_Read_1_DataBlock_CALLBACK Callback);
+void DATA_Read_1_DataBlock_Stub(CMOCK_DATA_Read_1_DataBlock_CALLBACK Callback);
+#define DATA_Read_1_DataBlock_StubWithCallback DATA_Read_1_DataBlock_Stub
+#define DATA_Read_1_DataBlock_ExpectAndThrow(pDataToReceiver0, cmock_to_throw) DATA_Read_1_DataBlock_CMockExpectAndThrow(__LINE__, pDataToReceiver0, cmock_to_throw)
+void DATA_Read_1_DataBlock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, CEXCEPTION_T cmock_to_throw);
+#define DATA_Read_1_DataBlock_ReturnThruPtr_pDataToReceiver0(pDataToReceiver0) DATA_Read_1_DataBlock_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, sizeof(void))
+#define DATA_Read_1_DataBlock_ReturnArrayThruPtr_pDataToReceiver0(pDataToReceiver0, cmock_len) DATA_Read_1_DataBlock_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, cmock_len * sizeof(*pDataToReceiver0))
+#define DATA_Read_1_DataBlock_ReturnMemThruPtr_pDataToReceiver0(pDataToReceiver0, cmock_size) DATA_Read_1_DataBlock_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, cmock_size)
+void DATA_Read_1_DataBlock_CMockReturnMemThruPtr_pDataToReceiver0(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, size_t cmock_size);
+#define DATA_Read_1_DataBlock_IgnoreArg_pDataToReceiver0() DATA_Read_1_DataBlock_CMockIgnoreArg_pDataToReceiver0(__LINE__)
+void DATA_Read_1_DataBlock_CMockIgnoreArg_pDataToReceiver0(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_2_DataBlocks_IgnoreAndReturn(cmock_retval) DATA_Read_2_DataBlocks_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_Read_2_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_Read_2_DataBlocks_StopIgnore() DATA_Read_2_DataBlocks_CMockStopIgnore()
+void DATA_Read_2_DataBlocks_CMockStopIgnore(void);
+#define DATA_Read_2_DataBlocks_ExpectAndReturn(pDataToReceiver0, pDataToReceiver1, cmock_retval) DATA_Read_2_DataBlocks_CMockExpectAndReturn(__LINE__, pDataToReceiver0, pDataToReceiver1, cmock_retval)
+void DATA_Read_2_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_Read_2_DataBlocks_CALLBACK)(void* pDataToReceiver0, void* pDataToReceiver1, int cmock_num_calls);
+void DATA_Read_2_DataBlocks_AddCallback(CMOCK_DATA_Read_2_DataBlocks_CALLBACK Callback);
+void DATA_Read_2_DataBlocks_Stub(CMOCK_DATA_Read_2_DataBlocks_CALLBACK Callback);
+#define DATA_Read_2_DataBlocks_StubWithCallback DATA_Read_2_DataBlocks_Stub
+#define DATA_Read_2_DataBlocks_ExpectAndThrow(pDataToReceiver0, pDataToReceiver1, cmock_to_throw) DATA_Read_2_DataBlocks_CMockExpectAndThrow(__LINE__, pDataToReceiver0, pDataToReceiver1, cmock_to_throw)
+void DATA_Read_2_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, CEXCEPTION_T cmock_to_throw);
+#define DATA_Read_2_DataBlocks_ReturnThruPtr_pDataToReceiver0(pDataToReceiver0) DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, sizeof(void))
+#define DATA_Read_2_DataBlocks_ReturnArrayThruPtr_pDataToReceiver0(pDataToReceiver0, cmock_len) DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, cmock_len * sizeof(*pDataToReceiver0))
+#define DATA_Read_2_DataBlocks_ReturnMemThruPtr_pDataToReceiver0(pDataToReceiver0, cmock_size) DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, cmock_size)
+void DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, size_t cmock_size);
+#define DATA_Read_2_DataBlocks_ReturnThruPtr_pDataToReceiver1(pDataToReceiver1) DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(__LINE__, pDataToReceiver1, sizeof(void))
+#define DATA_Read_2_DataBlocks_ReturnArrayThruPtr_pDataToReceiver1(pDataToReceiver1, cmock_len) DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(__LINE__, pDataToReceiver1, cmock_len * sizeof(*pDataToReceiver1))
+#define DATA_Read_2_DataBlocks_ReturnMemThruPtr_pDataToReceiver1(pDataToReceiver1, cmock_size) DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(__LINE__, pDataToReceiver1, cmock_size)
+void DATA_Read_2_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver1, size_t cmock_size);
+#define DATA_Read_2_DataBlocks_IgnoreArg_pDataToReceiver0() DATA_Read_2_DataBlocks_CMockIgnoreArg_pDataToReceiver0(__LINE__)
+void DATA_Read_2_DataBlocks_CMockIgnoreArg_pDataToReceiver0(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_2_DataBlocks_IgnoreArg_pDataToReceiver1() DATA_Read_2_DataBlocks_CMockIgnoreArg_pDataToReceiver1(__LINE__)
+void DATA_Read_2_DataBlocks_CMockIgnoreArg_pDataToReceiver1(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_3_DataBlocks_IgnoreAndReturn(cmock_retval) DATA_Read_3_DataBlocks_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_Read_3_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_Read_3_DataBlocks_StopIgnore() DATA_Read_3_DataBlocks_CMockStopIgnore()
+void DATA_Read_3_DataBlocks_CMockStopIgnore(void);
+#define DATA_Read_3_DataBlocks_ExpectAndReturn(pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, cmock_retval) DATA_Read_3_DataBlocks_CMockExpectAndReturn(__LINE__, pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, cmock_retval)
+void DATA_Read_3_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_Read_3_DataBlocks_CALLBACK)(void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, int cmock_num_calls);
+void DATA_Read_3_DataBlocks_AddCallback(CMOCK_DATA_Read_3_DataBlocks_CALLBACK Callback);
+void DATA_Read_3_DataBlocks_Stub(CMOCK_DATA_Read_3_DataBlocks_CALLBACK Callback);
+#define DATA_Read_3_DataBlocks_StubWithCallback DATA_Read_3_DataBlocks_Stub
+#define DATA_Read_3_DataBlocks_ExpectAndThrow(pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, cmock_to_throw) DATA_Read_3_DataBlocks_CMockExpectAndThrow(__LINE__, pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, cmock_to_throw)
+void DATA_Read_3_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, CEXCEPTION_T cmock_to_throw);
+#define DATA_Read_3_DataBlocks_ReturnThruPtr_pDataToReceiver0(pDataToReceiver0) DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, sizeof(void))
+#define DATA_Read_3_DataBlocks_ReturnArrayThruPtr_pDataToReceiver0(pDataToReceiver0, cmock_len) DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, cmock_len * sizeof(*pDataToReceiver0))
+#define DATA_Read_3_DataBlocks_ReturnMemThruPtr_pDataToReceiver0(pDataToReceiver0, cmock_size) DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, cmock_size)
+void DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, size_t cmock_size);
+#define DATA_Read_3_DataBlocks_ReturnThruPtr_pDataToReceiver1(pDataToReceiver1) DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(__LINE__, pDataToReceiver1, sizeof(void))
+#define DATA_Read_3_DataBlocks_ReturnArrayThruPtr_pDataToReceiver1(pDataToReceiver1, cmock_len) DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(__LINE__, pDataToReceiver1, cmock_len * sizeof(*pDataToReceiver1))
+#define DATA_Read_3_DataBlocks_ReturnMemThruPtr_pDataToReceiver1(pDataToReceiver1, cmock_size) DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(__LINE__, pDataToReceiver1, cmock_size)
+void DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver1, size_t cmock_size);
+#define DATA_Read_3_DataBlocks_ReturnThruPtr_pDataToReceiver2(pDataToReceiver2) DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(__LINE__, pDataToReceiver2, sizeof(void))
+#define DATA_Read_3_DataBlocks_ReturnArrayThruPtr_pDataToReceiver2(pDataToReceiver2, cmock_len) DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(__LINE__, pDataToReceiver2, cmock_len * sizeof(*pDataToReceiver2))
+#define DATA_Read_3_DataBlocks_ReturnMemThruPtr_pDataToReceiver2(pDataToReceiver2, cmock_size) DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(__LINE__, pDataToReceiver2, cmock_size)
+void DATA_Read_3_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver2, size_t cmock_size);
+#define DATA_Read_3_DataBlocks_IgnoreArg_pDataToReceiver0() DATA_Read_3_DataBlocks_CMockIgnoreArg_pDataToReceiver0(__LINE__)
+void DATA_Read_3_DataBlocks_CMockIgnoreArg_pDataToReceiver0(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_3_DataBlocks_IgnoreArg_pDataToReceiver1() DATA_Read_3_DataBlocks_CMockIgnoreArg_pDataToReceiver1(__LINE__)
+void DATA_Read_3_DataBlocks_CMockIgnoreArg_pDataToReceiver1(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_3_DataBlocks_IgnoreArg_pDataToReceiver2() DATA_Read_3_DataBlocks_CMockIgnoreArg_pDataToReceiver2(__LINE__)
+void DATA_Read_3_DataBlocks_CMockIgnoreArg_pDataToReceiver2(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_4_DataBlocks_IgnoreAndReturn(cmock_retval) DATA_Read_4_DataBlocks_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_Read_4_DataBlocks_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_Read_4_DataBlocks_StopIgnore() DATA_Read_4_DataBlocks_CMockStopIgnore()
+void DATA_Read_4_DataBlocks_CMockStopIgnore(void);
+#define DATA_Read_4_DataBlocks_ExpectAndReturn(pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, pDataToReceiver3, cmock_retval) DATA_Read_4_DataBlocks_CMockExpectAndReturn(__LINE__, pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, pDataToReceiver3, cmock_retval)
+void DATA_Read_4_DataBlocks_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, void* pDataToReceiver3, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_Read_4_DataBlocks_CALLBACK)(void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, void* pDataToReceiver3, int cmock_num_calls);
+void DATA_Read_4_DataBlocks_AddCallback(CMOCK_DATA_Read_4_DataBlocks_CALLBACK Callback);
+void DATA_Read_4_DataBlocks_Stub(CMOCK_DATA_Read_4_DataBlocks_CALLBACK Callback);
+#define DATA_Read_4_DataBlocks_StubWithCallback DATA_Read_4_DataBlocks_Stub
+#define DATA_Read_4_DataBlocks_ExpectAndThrow(pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, pDataToReceiver3, cmock_to_throw) DATA_Read_4_DataBlocks_CMockExpectAndThrow(__LINE__, pDataToReceiver0, pDataToReceiver1, pDataToReceiver2, pDataToReceiver3, cmock_to_throw)
+void DATA_Read_4_DataBlocks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, void* pDataToReceiver1, void* pDataToReceiver2, void* pDataToReceiver3, CEXCEPTION_T cmock_to_throw);
+#define DATA_Read_4_DataBlocks_ReturnThruPtr_pDataToReceiver0(pDataToReceiver0) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, sizeof(void))
+#define DATA_Read_4_DataBlocks_ReturnArrayThruPtr_pDataToReceiver0(pDataToReceiver0, cmock_len) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, cmock_len * sizeof(*pDataToReceiver0))
+#define DATA_Read_4_DataBlocks_ReturnMemThruPtr_pDataToReceiver0(pDataToReceiver0, cmock_size) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(__LINE__, pDataToReceiver0, cmock_size)
+void DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver0(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver0, size_t cmock_size);
+#define DATA_Read_4_DataBlocks_ReturnThruPtr_pDataToReceiver1(pDataToReceiver1) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(__LINE__, pDataToReceiver1, sizeof(void))
+#define DATA_Read_4_DataBlocks_ReturnArrayThruPtr_pDataToReceiver1(pDataToReceiver1, cmock_len) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(__LINE__, pDataToReceiver1, cmock_len * sizeof(*pDataToReceiver1))
+#define DATA_Read_4_DataBlocks_ReturnMemThruPtr_pDataToReceiver1(pDataToReceiver1, cmock_size) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(__LINE__, pDataToReceiver1, cmock_size)
+void DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver1(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver1, size_t cmock_size);
+#define DATA_Read_4_DataBlocks_ReturnThruPtr_pDataToReceiver2(pDataToReceiver2) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(__LINE__, pDataToReceiver2, sizeof(void))
+#define DATA_Read_4_DataBlocks_ReturnArrayThruPtr_pDataToReceiver2(pDataToReceiver2, cmock_len) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(__LINE__, pDataToReceiver2, cmock_len * sizeof(*pDataToReceiver2))
+#define DATA_Read_4_DataBlocks_ReturnMemThruPtr_pDataToReceiver2(pDataToReceiver2, cmock_size) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(__LINE__, pDataToReceiver2, cmock_size)
+void DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver2(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver2, size_t cmock_size);
+#define DATA_Read_4_DataBlocks_ReturnThruPtr_pDataToReceiver3(pDataToReceiver3) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver3(__LINE__, pDataToReceiver3, sizeof(void))
+#define DATA_Read_4_DataBlocks_ReturnArrayThruPtr_pDataToReceiver3(pDataToReceiver3, cmock_len) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver3(__LINE__, pDataToReceiver3, cmock_len * sizeof(*pDataToReceiver3))
+#define DATA_Read_4_DataBlocks_ReturnMemThruPtr_pDataToReceiver3(pDataToReceiver3, cmock_size) DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver3(__LINE__, pDataToReceiver3, cmock_size)
+void DATA_Read_4_DataBlocks_CMockReturnMemThruPtr_pDataToReceiver3(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver3, size_t cmock_size);
+#define DATA_Read_4_DataBlocks_IgnoreArg_pDataToReceiver0() DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver0(__LINE__)
+void DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver0(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_4_DataBlocks_IgnoreArg_pDataToReceiver1() DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver1(__LINE__)
+void DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver1(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_4_DataBlocks_IgnoreArg_pDataToReceiver2() DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver2(__LINE__)
+void DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver2(UNITY_LINE_TYPE cmock_line);
+#define DATA_Read_4_DataBlocks_IgnoreArg_pDataToReceiver3() DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver3(__LINE__)
+void DATA_Read_4_DataBlocks_CMockIgnoreArg_pDataToReceiver3(UNITY_LINE_TYPE cmock_line);
+#define DATA_ReadDataBlockRange_IgnoreAndReturn(cmock_retval) DATA_ReadDataBlockRange_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_ReadDataBlockRange_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_ReadDataBlockRange_StopIgnore() DATA_ReadDataBlockRange_CMockStopIgnore()
+void DATA_ReadDataBlockRange_CMockStopIgnore(void);
+#define DATA_ReadDataBlockRange_ExpectAndReturn(blockId, pDataToReceiver, offset, length, cmock_retval) DATA_ReadDataBlockRange_CMockExpectAndReturn(__LINE__, blockId, pDataToReceiver, offset, length, cmock_retval)
+void DATA_ReadDataBlockRange_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_ReadDataBlockRange_CALLBACK)(DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, int cmock_num_calls);
+void DATA_ReadDataBlockRange_AddCallback(CMOCK_DATA_ReadDataBlockRange_CALLBACK Callback);
+void DATA_ReadDataBlockRange_Stub(CMOCK_DATA_ReadDataBlockRange_CALLBACK Callback);
+#define DATA_ReadDataBlockRange_StubWithCallback DATA_ReadDataBlockRange_Stub
+#define DATA_ReadDataBlockRange_ExpectAndThrow(blockId, pDataToReceiver, offset, length, cmock_to_throw) DATA_ReadDataBlockRange_CMockExpectAndThrow(__LINE__, blockId, pDataToReceiver, offset, length, cmock_to_throw)
+void DATA_ReadDataBlockRange_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, CEXCEPTION_T cmock_to_throw);
+#define DATA_ReadDataBlockRange_ReturnThruPtr_pDataToReceiver(pDataToReceiver) DATA_ReadDataBlockRange_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, sizeof(void))
+#define DATA_ReadDataBlockRange_ReturnArrayThruPtr_pDataToReceiver(pDataToReceiver, cmock_len) DATA_ReadDataBlockRange_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, cmock_len * sizeof(*pDataToReceiver))
+#define DATA_ReadDataBlockRange_ReturnMemThruPtr_pDataToReceiver(pDataToReceiver, cmock_size) DATA_ReadDataBlockRange_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, cmock_size)
+void DATA_ReadDataBlockRange_CMockReturnMemThruPtr_pDataToReceiver(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, size_t cmock_size);
+#define DATA_ReadDataBlockRange_IgnoreArg_blockId() DATA_ReadDataBlockRange_CMockIgnoreArg_blockId(__LINE__)
+void DATA_ReadDataBlockRange_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define DATA_ReadDataBlockRange_IgnoreArg_pDataToReceiver() DATA_ReadDataBlockRange_CMockIgnoreArg_pDataToReceiver(__LINE__)
+void DATA_ReadDataBlockRange_CMockIgnoreArg_pDataToReceiver(UNITY_LINE_TYPE cmock_line);
+#define DATA_ReadDataBlockRange_IgnoreArg_offset() DATA_ReadDataBlockRange_CMockIgnoreArg_offset(__LINE__)
+void DATA_ReadDataBlockRange_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line);
+#define DATA_ReadDataBlockRange_IgnoreArg_length() DATA_ReadDataBlockRange_CMockIgnoreArg_length(__LINE__)
+void DATA_ReadDataBlockRange_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line);
+#define DATA_SubscribeToDataBlock_IgnoreAndReturn(cmock_retval) DATA_SubscribeToDataBlock_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_SubscribeToDataBlock_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DATA_SubscribeToDataBlock_StopIgnore() DATA_SubscribeToDataBlock_CMockStopIgnore()
+void DATA_SubscribeToDataBlock_CMockStopIgnore(void);
+#define DATA_SubscribeToDataBlock_ExpectAndReturn(blockId, notificationBits, cmock_retval) DATA_SubscribeToDataBlock_CMockExpectAndReturn(__LINE__, blockId, notificationBits, cmock_retval)
+void DATA_SubscribeToDataBlock_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t notificationBits, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DATA_SubscribeToDataBlock_CALLBACK)(DATA_BLOCK_ID_e blockId, uint32_t notificationBits, int cmock_num_calls);
+void DATA_SubscribeToDataBlock_AddCallback(CMOCK_DATA_SubscribeToDataBlock_CALLBACK Callback);
+void DATA_SubscribeToDataBlock_Stub(CMOCK_DATA_SubscribeToDataBlock_CALLBACK Callback);
+#define DATA_SubscribeToDataBlock_StubWithCallback DATA_SubscribeToDataBlock_Stub
+#define DATA_SubscribeToDataBlock_ExpectAndThrow(blockId, notificationBits, cmock_to_throw) DATA_SubscribeToDataBlock_CMockExpectAndThrow(__LINE__, blockId, notificationBits, cmock_to_throw)
+void DATA_SubscribeToDataBlock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t notificationBits, CEXCEPTION_T cmock_to_throw);
+#define DATA_SubscribeToDataBlock_IgnoreArg_blockId() DATA_SubscribeToDataBlock_CMockIgnoreArg_blockId(__LINE__)
+void DATA_SubscribeToDataBlock_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define DATA_SubscribeToDataBlock_IgnoreArg_notificationBits() DATA_SubscribeToDataBlock_CMockIgnoreArg_notificationBits(__LINE__)
+void DATA_SubscribeToDataBlock_CMockIgnoreArg_notificationBits(UNITY_LINE_TYPE cmock_line);
+#define DATA_GetDataBlockUpdates_IgnoreAndReturn(cmock_retval) DATA_GetDataBlockUpdates_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_GetDataBlockUpdates_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define DATA_GetDataBlockUpdates_StopIgnore() DATA_GetDataBlockUpdates_CMockStopIgnore()
+void DATA_GetDataBlockUpdates_CMockStopIgnore(void);
+#define DATA_GetDataBlockUpdates_ExpectAndReturn(notificationBits, timeout_ms, cmock_retval) DATA_GetDataBlockUpdates_CMockExpectAndReturn(__LINE__, notificationBits, timeout_ms, cmock_retval)
+void DATA_GetDataBlockUpdates_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t notificationBits, uint32_t timeout_ms, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_DATA_GetDataBlockUpdates_CALLBACK)(uint32_t notificationBits, uint32_t timeout_ms, int cmock_num_calls);
+void DATA_GetDataBlockUpdates_AddCallback(CMOCK_DATA_GetDataBlockUpdates_CALLBACK Callback);
+void DATA_GetDataBlockUpdates_Stub(CMOCK_DATA_GetDataBlockUpdates_CALLBACK Callback);
+#define DATA_GetDataBlockUpdates_StubWithCallback DATA_GetDataBlockUpdates_Stub
+#define DATA_GetDataBlockUpdates_ExpectAndThrow(notificationBits, timeout_ms, cmock_to_throw) DATA_GetDataBlockUpdates_CMockExpectAndThrow(__LINE__, notificationBits, timeout_ms, cmock_to_throw)
+void DATA_GetDataBlockUpdates_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t notificationBits, uint32_t timeout_ms, CEXCEPTION_T cmock_to_throw);
+#define DATA_GetDataBlockUpdates_IgnoreArg_notificationBits() DATA_GetDataBlockUpdates_CMockIgnoreArg_notificationBits(__LINE__)
+void DATA_GetDataBlockUpdates_CMockIgnoreArg_notificationBits(UNITY_LINE_TYPE cmock_line);
+#define DATA_GetDataBlockUpdates_IgnoreArg_timeout_ms() DATA_GetDataBlockUpdates_CMockIgnoreArg_timeout_ms(__LINE__)
+void DATA_GetDataBlockUpdates_CMockIgnoreArg_timeout_ms(UNITY_LINE_TYPE cmock_line);
+#define DATA_GetBackBuffer_IgnoreAndReturn(cmock_retval) DATA_GetBackBuffer_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_GetBackBuffer_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, void* cmock_to_return);
+#define DATA_GetBackBuffer_StopIgnore() DATA_GetBackBuffer_CMockStopIgnore()
+void DATA_GetBackBuffer_CMockStopIgnore(void);
+#define DATA_GetBackBuffer_ExpectAndReturn(blockId, cmock_retval) DATA_GetBackBuffer_CMockExpectAndReturn(__LINE__, blockId, cmock_retval)
+void DATA_GetBackBuffer_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* cmock_to_return);
+typedef void* (* CMOCK_DATA_GetBackBuffer_CALLBACK)(DATA_BLOCK_ID_e blockId, int cmock_num_calls);
+void DATA_GetBackBuffer_AddCallback(CMOCK_DATA_GetBackBuffer_CALLBACK Callback);
+void DATA_GetBackBuffer_Stub(CMOCK_DATA_GetBackBuffer_CALLBACK Callback);
+#define DATA_GetBackBuffer_StubWithCallback DATA_GetBackBuffer_Stub
+#define DATA_GetBackBuffer_ExpectAndThrow(blockId, cmock_to_throw) DATA_GetBackBuffer_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void DATA_GetBackBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define DATA_GetBackBuffer_IgnoreArg_blockId() DATA_GetBackBuffer_CMockIgnoreArg_blockId(__LINE__)
+void DATA_GetBackBuffer_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define DATA_CommitBackBuffer_Ignore() DATA_CommitBackBuffer_CMockIgnore()
+void DATA_CommitBackBuffer_CMockIgnore(void);
+#define DATA_CommitBackBuffer_StopIgnore() DATA_CommitBackBuffer_CMockStopIgnore()
+void DATA_CommitBackBuffer_CMockStopIgnore(void);
+#define DATA_CommitBackBuffer_Expect(blockId) DATA_CommitBackBuffer_CMockExpect(__LINE__, blockId)
+void DATA_CommitBackBuffer_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId);
+typedef void (* CMOCK_DATA_CommitBackBuffer_CALLBACK)(DATA_BLOCK_ID_e blockId, int cmock_num_calls);
+void DATA_CommitBackBuffer_AddCallback(CMOCK_DATA_CommitBackBuffer_CALLBACK Callback);
+void DATA_CommitBackBuffer_Stub(CMOCK_DATA_CommitBackBuffer_CALLBACK Callback);
+#define DATA_CommitBackBuffer_StubWithCallback DATA_CommitBackBuffer_Stub
+#define DATA_CommitBackBuffer_ExpectAndThrow(blockId, cmock_to_throw) DATA_CommitBackBuffer_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void DATA_CommitBackBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define DATA_CommitBackBuffer_IgnoreArg_blockId() DATA_CommitBackBuffer_CMockIgnoreArg_blockId(__LINE__)
+void DATA_CommitBackBuffer_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define DATA_GetFrontBuffer_IgnoreAndReturn(cmock_retval) DATA_GetFrontBuffer_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_GetFrontBuffer_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, const void* cmock_to_return);
+#define DATA_GetFrontBuffer_StopIgnore() DATA_GetFrontBuffer_CMockStopIgnore()
+void DATA_GetFrontBuffer_CMockStopIgnore(void);
+#define DATA_GetFrontBuffer_ExpectAndReturn(blockId, cmock_retval) DATA_GetFrontBuffer_CMockExpectAndReturn(__LINE__, blockId, cmock_retval)
+void DATA_GetFrontBuffer_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, const void* cmock_to_return);
+typedef const void* (* CMOCK_DATA_GetFrontBuffer_CALLBACK)(DATA_BLOCK_ID_e blockId, int cmock_num_calls);
+void DATA_GetFrontBuffer_AddCallback(CMOCK_DATA_GetFrontBuffer_CALLBACK Callback);
+void DATA_GetFrontBuffer_Stub(CMOCK_DATA_GetFrontBuffer_CALLBACK Callback);
+#define DATA_GetFrontBuffer_StubWithCallback DATA_GetFrontBuffer_Stub
+#define DATA_GetFrontBuffer_ExpectAndThrow(blockId, cmock_to_throw) DATA_GetFrontBuffer_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void DATA_GetFrontBuffer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define DATA_GetFrontBuffer_IgnoreArg_blockId() DATA_GetFrontBuffer_CMockIgnoreArg_blockId(__LINE__)
+void DATA_GetFrontBuffer_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define DATA_GetMaximumNumberOfReadAttempts_IgnoreAndReturn(cmock_retval) DATA_GetMaximumNumberOfReadAttempts_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_GetMaximumNumberOfReadAttempts_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define DATA_GetMaximumNumberOfReadAttempts_StopIgnore() DATA_GetMaximumNumberOfReadAttempts_CMockStopIgnore()
+void DATA_GetMaximumNumberOfReadAttempts_CMockStopIgnore(void);
+#define DATA_GetMaximumNumberOfReadAttempts_ExpectAndReturn(cmock_retval) DATA_GetMaximumNumberOfReadAttempts_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DATA_GetMaximumNumberOfReadAttempts_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALLBACK)(int cmock_num_calls);
+void DATA_GetMaximumNumberOfReadAttempts_AddCallback(CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALLBACK Callback);
+void DATA_GetMaximumNumberOfReadAttempts_Stub(CMOCK_DATA_GetMaximumNumberOfReadAttempts_CALLBACK Callback);
+#define DATA_GetMaximumNumberOfReadAttempts_StubWithCallback DATA_GetMaximumNumberOfReadAttempts_Stub
+#define DATA_GetMaximumNumberOfReadAttempts_ExpectAndThrow(cmock_to_throw) DATA_GetMaximumNumberOfReadAttempts_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DATA_GetMaximumNumberOfReadAttempts_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreAndReturn(cmock_retval) DATA_DatabaseEntryUpdatedAtLeastOnce_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define DATA_DatabaseEntryUpdatedAtLeastOnce_StopIgnore() DATA_DatabaseEntryUpdatedAtLeastOnce_CMockStopIgnore()
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockStopIgnore(void);
+#define DATA_DatabaseEntryUpdatedAtLeastOnce_ExpectAndReturn(pDatabaseEntry, cmock_retval) DATA_DatabaseEntryUpdatedAtLeastOnce_CMockExpectAndReturn(__LINE__, pDatabaseEntry, cmock_retval)
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALLBACK)(void* pDatabaseEntry, int cmock_num_calls);
+void DATA_DatabaseEntryUpdatedAtLeastOnce_AddCallback(CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALLBACK Callback);
+void DATA_DatabaseEntryUpdatedAtLeastOnce_Stub(CMOCK_DATA_DatabaseEntryUpdatedAtLeastOnce_CALLBACK Callback);
+#define DATA_DatabaseEntryUpdatedAtLeastOnce_StubWithCallback DATA_DatabaseEntryUpdatedAtLeastOnce_Stub
+#define DATA_DatabaseEntryUpdatedAtLeastOnce_ExpectAndThrow(pDatabaseEntry, cmock_to_throw) DATA_DatabaseEntryUpdatedAtLeastOnce_CMockExpectAndThrow(__LINE__, pDatabaseEntry, cmock_to_throw)
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, CEXCEPTION_T cmock_to_throw);
+#define DATA_DatabaseEntryUpdatedAtLeastOnce_ReturnThruPtr_pDatabaseEntry(pDatabaseEntry) DATA_DatabaseEntryUpdatedAtLeastOnce_CMockReturnMemThruPtr_pDatabaseEntry(__LINE__, pDatabaseEntry, sizeof(void))
+#define DATA_DatabaseEntryUpdatedAtLeastOnce_ReturnArrayThruPtr_pDatabaseEntry(pDatabaseEntry, cmock_len) DATA_DatabaseEntryUpdatedAtLeastOnce_CMockReturnMemThruPtr_pDatabaseEntry(__LINE__, pDatabaseEntry, cmock_len * sizeof(*pDatabaseEntry))
+#define DATA_DatabaseEntryUpdatedAtLeastOnce_ReturnMemThruPtr_pDatabaseEntry(pDatabaseEntry, cmock_size) DATA_DatabaseEntryUpdatedAtLeastOnce_CMockReturnMemThruPtr_pDatabaseEntry(__LINE__, pDatabaseEntry, cmock_size)
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockReturnMemThruPtr_pDatabaseEntry(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, size_t cmock_size);
+#define DATA_DatabaseEntryUpdatedAtLeastOnce_IgnoreArg_pDatabaseEntry() DATA_DatabaseEntryUpdatedAtLeastOnce_CMockIgnoreArg_pDatabaseEntry(__LINE__)
+void DATA_DatabaseEntryUpdatedAtLeastOnce_CMockIgnoreArg_pDatabaseEntry(UNITY_LINE_TYPE cmock_line);
+#define DATA_DatabaseEntryUpdatedRecently_IgnoreAndReturn(cmock_retval) DATA_DatabaseEntryUpdatedRecently_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_DatabaseEntryUpdatedRecently_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define DATA_DatabaseEntryUpdatedRecently_StopIgnore() DATA_DatabaseEntryUpdatedRecently_CMockStopIgnore()
+void DATA_DatabaseEntryUpdatedRecently_CMockStopIgnore(void);
+#define DATA_DatabaseEntryUpdatedRecently_ExpectAndReturn(pDatabaseEntry, timeInterval, cmock_retval) DATA_DatabaseEntryUpdatedRecently_CMockExpectAndReturn(__LINE__, pDatabaseEntry, timeInterval, cmock_retval)
+void DATA_DatabaseEntryUpdatedRecently_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, uint32_t timeInterval, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_DATA_DatabaseEntryUpdatedRecently_CALLBACK)(void* pDatabaseEntry, uint32_t timeInterval, int cmock_num_calls);
+void DATA_DatabaseEntryUpdatedRecently_AddCallback(CMOCK_DATA_DatabaseEntryUpdatedRecently_CALLBACK Callback);
+void DATA_DatabaseEntryUpdatedRecently_Stub(CMOCK_DATA_DatabaseEntryUpdatedRecently_CALLBACK Callback);
+#define DATA_DatabaseEntryUpdatedRecently_StubWithCallback DATA_DatabaseEntryUpdatedRecently_Stub
+#define DATA_DatabaseEntryUpdatedRecently_ExpectAndThrow(pDatabaseEntry, timeInterval, cmock_to_throw) DATA_DatabaseEntryUpdatedRecently_CMockExpectAndThrow(__LINE__, pDatabaseEntry, timeInterval, cmock_to_throw)
+void DATA_DatabaseEntryUpdatedRecently_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, uint32_t timeInterval, CEXCEPTION_T cmock_to_throw);
+#define DATA_DatabaseEntryUpdatedRecently_ReturnThruPtr_pDatabaseEntry(pDatabaseEntry) DATA_DatabaseEntryUpdatedRecently_CMockReturnMemThruPtr_pDatabaseEntry(__LINE__, pDatabaseEntry, sizeof(void))
+#define DATA_DatabaseEntryUpdatedRecently_ReturnArrayThruPtr_pDatabaseEntry(pDatabaseEntry, cmock_len) DATA_DatabaseEntryUpdatedRecently_CMockReturnMemThruPtr_pDatabaseEntry(__LINE__, pDatabaseEntry, cmock_len * sizeof(*pDatabaseEntry))
+#define DATA_DatabaseEntryUpdatedRecently_ReturnMemThruPtr_pDatabaseEntry(pDatabaseEntry, cmock_size) DATA_DatabaseEntryUpdatedRecently_CMockReturnMemThruPtr_pDatabaseEntry(__LINE__, pDatabaseEntry, cmock_size)
+void DATA_DatabaseEntryUpdatedRecently_CMockReturnMemThruPtr_pDatabaseEntry(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, size_t cmock_size);
+#define DATA_DatabaseEntryUpdatedRecently_IgnoreArg_pDatabaseEntry() DATA_DatabaseEntryUpdatedRecently_CMockIgnoreArg_pDatabaseEntry(__LINE__)
+void DATA_DatabaseEntryUpdatedRecently_CMockIgnoreArg_pDatabaseEntry(UNITY_LINE_TYPE cmock_line);
+#define DATA_DatabaseEntryUpdatedRecently_IgnoreArg_timeInterval() DATA_DatabaseEntryUpdatedRecently_CMockIgnoreArg_timeInterval(__LINE__)
+void DATA_DatabaseEntryUpdatedRecently_CMockIgnoreArg_timeInterval(UNITY_LINE_TYPE cmock_line);
+#define DATA_DatabaseEntryUpdatedWithinInterval_IgnoreAndReturn(cmock_retval) DATA_DatabaseEntryUpdatedWithinInterval_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define DATA_DatabaseEntryUpdatedWithinInterval_StopIgnore() DATA_DatabaseEntryUpdatedWithinInterval_CMockStopIgnore()
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockStopIgnore(void);
+#define DATA_DatabaseEntryUpdatedWithinInterval_ExpectAndReturn(pDatabaseEntry, timeInterval, cmock_retval) DATA_DatabaseEntryUpdatedWithinInterval_CMockExpectAndReturn(__LINE__, pDatabaseEntry, timeInterval, cmock_retval)
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, uint32_t timeInterval, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALLBACK)(void* pDatabaseEntry, uint32_t timeInterval, int cmock_num_calls);
+void DATA_DatabaseEntryUpdatedWithinInterval_AddCallback(CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALLBACK Callback);
+void DATA_DatabaseEntryUpdatedWithinInterval_Stub(CMOCK_DATA_DatabaseEntryUpdatedWithinInterval_CALLBACK Callback);
+#define DATA_DatabaseEntryUpdatedWithinInterval_StubWithCallback DATA_DatabaseEntryUpdatedWithinInterval_Stub
+#define DATA_DatabaseEntryUpdatedWithinInterval_ExpectAndThrow(pDatabaseEntry, timeInterval, cmock_to_throw) DATA_DatabaseEntryUpdatedWithinInterval_CMockExpectAndThrow(__LINE__, pDatabaseEntry, timeInterval, cmock_to_throw)
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, uint32_t timeInterval, CEXCEPTION_T cmock_to_throw);
+#define DATA_DatabaseEntryUpdatedWithinInterval_ReturnThruPtr_pDatabaseEntry(pDatabaseEntry) DATA_DatabaseEntryUpdatedWithinInterval_CMockReturnMemThruPtr_pDatabaseEntry(__LINE__, pDatabaseEntry, sizeof(void))
+#define DATA_DatabaseEntryUpdatedWithinInterval_ReturnArrayThruPtr_pDatabaseEntry(pDatabaseEntry, cmock_len) DATA_DatabaseEntryUpdatedWithinInterval_CMockReturnMemThruPtr_pDatabaseEntry(__LINE__, pDatabaseEntry, cmock_len * sizeof(*pDatabaseEntry))
+#define DATA_DatabaseEntryUpdatedWithinInterval_ReturnMemThruPtr_pDatabaseEntry(pDatabaseEntry, cmock_size) DATA_DatabaseEntryUpdatedWithinInterval_CMockReturnMemThruPtr_pDatabaseEntry(__LINE__, pDatabaseEntry, cmock_size)
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockReturnMemThruPtr_pDatabaseEntry(UNITY_LINE_TYPE cmock_line, void* pDatabaseEntry, size_t cmock_size);
+#define DATA_DatabaseEntryUpdatedWithinInterval_IgnoreArg_pDatabaseEntry() DATA_DatabaseEntryUpdatedWithinInterval_CMockIgnoreArg_pDatabaseEntry(__LINE__)
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockIgnoreArg_pDatabaseEntry(UNITY_LINE_TYPE cmock_line);
+#define DATA_DatabaseEntryUpdatedWithinInterval_IgnoreArg_timeInterval() DATA_DatabaseEntryUpdatedWithinInterval_CMockIgnoreArg_timeInterval(__LINE__)
+void DATA_DatabaseEntryUpdatedWithinInterval_CMockIgnoreArg_timeInterval(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_WriteEntryWithSequenceLock_Ignore() TEST_DATA_WriteEntryWithSequenceLock_CMockIgnore()
+void TEST_DATA_WriteEntryWithSequenceLock_CMockIgnore(void);
+#define TEST_DATA_WriteEntryWithSequenceLock_StopIgnore() TEST_DATA_WriteEntryWithSequenceLock_CMockStopIgnore()
+void TEST_DATA_WriteEntryWithSequenceLock_CMockStopIgnore(void);
+#define TEST_DATA_WriteEntryWithSequenceLock_Expect(pDataFromSender) TEST_DATA_WriteEntryWithSequenceLock_CMockExpect(__LINE__, pDataFromSender)
+void TEST_DATA_WriteEntryWithSequenceLock_CMockExpect(UNITY_LINE_TYPE cmock_line, void* pDataFromSender);
+typedef void (* CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALLBACK)(void* pDataFromSender, int cmock_num_calls);
+void TEST_DATA_WriteEntryWithSequenceLock_AddCallback(CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALLBACK Callback);
+void TEST_DATA_WriteEntryWithSequenceLock_Stub(CMOCK_TEST_DATA_WriteEntryWithSequenceLock_CALLBACK Callback);
+#define TEST_DATA_WriteEntryWithSequenceLock_StubWithCallback TEST_DATA_WriteEntryWithSequenceLock_Stub
+#define TEST_DATA_WriteEntryWithSequenceLock_ExpectAndThrow(pDataFromSender, cmock_to_throw) TEST_DATA_WriteEntryWithSequenceLock_CMockExpectAndThrow(__LINE__, pDataFromSender, cmock_to_throw)
+void TEST_DATA_WriteEntryWithSequenceLock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataFromSender, CEXCEPTION_T cmock_to_throw);
+#define TEST_DATA_WriteEntryWithSequenceLock_ReturnThruPtr_pDataFromSender(pDataFromSender) TEST_DATA_WriteEntryWithSequenceLock_CMockReturnMemThruPtr_pDataFromSender(__LINE__, pDataFromSender, sizeof(void))
+#define TEST_DATA_WriteEntryWithSequenceLock_ReturnArrayThruPtr_pDataFromSender(pDataFromSender, cmock_len) TEST_DATA_WriteEntryWithSequenceLock_CMockReturnMemThruPtr_pDataFromSender(__LINE__, pDataFromSender, cmock_len * sizeof(*pDataFromSender))
+#define TEST_DATA_WriteEntryWithSequenceLock_ReturnMemThruPtr_pDataFromSender(pDataFromSender, cmock_size) TEST_DATA_WriteEntryWithSequenceLock_CMockReturnMemThruPtr_pDataFromSender(__LINE__, pDataFromSender, cmock_size)
+void TEST_DATA_WriteEntryWithSequenceLock_CMockReturnMemThruPtr_pDataFromSender(UNITY_LINE_TYPE cmock_line, void* pDataFromSender, size_t cmock_size);
+#define TEST_DATA_WriteEntryWithSequenceLock_IgnoreArg_pDataFromSender() TEST_DATA_WriteEntryWithSequenceLock_CMockIgnoreArg_pDataFromSender(__LINE__)
+void TEST_DATA_WriteEntryWithSequenceLock_CMockIgnoreArg_pDataFromSender(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_ReadEntryWithSequenceLock_Ignore() TEST_DATA_ReadEntryWithSequenceLock_CMockIgnore()
+void TEST_DATA_ReadEntryWithSequenceLock_CMockIgnore(void);
+#define TEST_DATA_ReadEntryWithSequenceLock_StopIgnore() TEST_DATA_ReadEntryWithSequenceLock_CMockStopIgnore()
+void TEST_DATA_ReadEntryWithSequenceLock_CMockStopIgnore(void);
+#define TEST_DATA_ReadEntryWithSequenceLock_Expect(pDataToReceiver) TEST_DATA_ReadEntryWithSequenceLock_CMockExpect(__LINE__, pDataToReceiver)
+void TEST_DATA_ReadEntryWithSequenceLock_CMockExpect(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver);
+typedef void (* CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALLBACK)(void* pDataToReceiver, int cmock_num_calls);
+void TEST_DATA_ReadEntryWithSequenceLock_AddCallback(CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALLBACK Callback);
+void TEST_DATA_ReadEntryWithSequenceLock_Stub(CMOCK_TEST_DATA_ReadEntryWithSequenceLock_CALLBACK Callback);
+#define TEST_DATA_ReadEntryWithSequenceLock_StubWithCallback TEST_DATA_ReadEntryWithSequenceLock_Stub
+#define TEST_DATA_ReadEntryWithSequenceLock_ExpectAndThrow(pDataToReceiver, cmock_to_throw) TEST_DATA_ReadEntryWithSequenceLock_CMockExpectAndThrow(__LINE__, pDataToReceiver, cmock_to_throw)
+void TEST_DATA_ReadEntryWithSequenceLock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, CEXCEPTION_T cmock_to_throw);
+#define TEST_DATA_ReadEntryWithSequenceLock_ReturnThruPtr_pDataToReceiver(pDataToReceiver) TEST_DATA_ReadEntryWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, sizeof(void))
+#define TEST_DATA_ReadEntryWithSequenceLock_ReturnArrayThruPtr_pDataToReceiver(pDataToReceiver, cmock_len) TEST_DATA_ReadEntryWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, cmock_len * sizeof(*pDataToReceiver))
+#define TEST_DATA_ReadEntryWithSequenceLock_ReturnMemThruPtr_pDataToReceiver(pDataToReceiver, cmock_size) TEST_DATA_ReadEntryWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, cmock_size)
+void TEST_DATA_ReadEntryWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, size_t cmock_size);
+#define TEST_DATA_ReadEntryWithSequenceLock_IgnoreArg_pDataToReceiver() TEST_DATA_ReadEntryWithSequenceLock_CMockIgnoreArg_pDataToReceiver(__LINE__)
+void TEST_DATA_ReadEntryWithSequenceLock_CMockIgnoreArg_pDataToReceiver(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_ReadRangeWithSequenceLock_Ignore() TEST_DATA_ReadRangeWithSequenceLock_CMockIgnore()
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnore(void);
+#define TEST_DATA_ReadRangeWithSequenceLock_StopIgnore() TEST_DATA_ReadRangeWithSequenceLock_CMockStopIgnore()
+void TEST_DATA_ReadRangeWithSequenceLock_CMockStopIgnore(void);
+#define TEST_DATA_ReadRangeWithSequenceLock_Expect(blockId, pDataToReceiver, offset, length) TEST_DATA_ReadRangeWithSequenceLock_CMockExpect(__LINE__, blockId, pDataToReceiver, offset, length)
+void TEST_DATA_ReadRangeWithSequenceLock_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length);
+typedef void (* CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALLBACK)(DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, int cmock_num_calls);
+void TEST_DATA_ReadRangeWithSequenceLock_AddCallback(CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALLBACK Callback);
+void TEST_DATA_ReadRangeWithSequenceLock_Stub(CMOCK_TEST_DATA_ReadRangeWithSequenceLock_CALLBACK Callback);
+#define TEST_DATA_ReadRangeWithSequenceLock_StubWithCallback TEST_DATA_ReadRangeWithSequenceLock_Stub
+#define TEST_DATA_ReadRangeWithSequenceLock_ExpectAndThrow(blockId, pDataToReceiver, offset, length, cmock_to_throw) TEST_DATA_ReadRangeWithSequenceLock_CMockExpectAndThrow(__LINE__, blockId, pDataToReceiver, offset, length, cmock_to_throw)
+void TEST_DATA_ReadRangeWithSequenceLock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, CEXCEPTION_T cmock_to_throw);
+#define TEST_DATA_ReadRangeWithSequenceLock_ReturnThruPtr_pDataToReceiver(pDataToReceiver) TEST_DATA_ReadRangeWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, sizeof(void))
+#define TEST_DATA_ReadRangeWithSequenceLock_ReturnArrayThruPtr_pDataToReceiver(pDataToReceiver, cmock_len) TEST_DATA_ReadRangeWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, cmock_len * sizeof(*pDataToReceiver))
+#define TEST_DATA_ReadRangeWithSequenceLock_ReturnMemThruPtr_pDataToReceiver(pDataToReceiver, cmock_size) TEST_DATA_ReadRangeWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, cmock_size)
+void TEST_DATA_ReadRangeWithSequenceLock_CMockReturnMemThruPtr_pDataToReceiver(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, size_t cmock_size);
+#define TEST_DATA_ReadRangeWithSequenceLock_IgnoreArg_blockId() TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_blockId(__LINE__)
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_ReadRangeWithSequenceLock_IgnoreArg_pDataToReceiver() TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_pDataToReceiver(__LINE__)
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_pDataToReceiver(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_ReadRangeWithSequenceLock_IgnoreArg_offset() TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_offset(__LINE__)
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_ReadRangeWithSequenceLock_IgnoreArg_length() TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_length(__LINE__)
+void TEST_DATA_ReadRangeWithSequenceLock_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_CopyRange_Ignore() TEST_DATA_CopyRange_CMockIgnore()
+void TEST_DATA_CopyRange_CMockIgnore(void);
+#define TEST_DATA_CopyRange_StopIgnore() TEST_DATA_CopyRange_CMockStopIgnore()
+void TEST_DATA_CopyRange_CMockStopIgnore(void);
+#define TEST_DATA_CopyRange_Expect(blockId, pDataToReceiver, offset, length) TEST_DATA_CopyRange_CMockExpect(__LINE__, blockId, pDataToReceiver, offset, length)
+void TEST_DATA_CopyRange_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length);
+typedef void (* CMOCK_TEST_DATA_CopyRange_CALLBACK)(DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, int cmock_num_calls);
+void TEST_DATA_CopyRange_AddCallback(CMOCK_TEST_DATA_CopyRange_CALLBACK Callback);
+void TEST_DATA_CopyRange_Stub(CMOCK_TEST_DATA_CopyRange_CALLBACK Callback);
+#define TEST_DATA_CopyRange_StubWithCallback TEST_DATA_CopyRange_Stub
+#define TEST_DATA_CopyRange_ExpectAndThrow(blockId, pDataToReceiver, offset, length, cmock_to_throw) TEST_DATA_CopyRange_CMockExpectAndThrow(__LINE__, blockId, pDataToReceiver, offset, length, cmock_to_throw)
+void TEST_DATA_CopyRange_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, void* pDataToReceiver, uint16_t offset, uint16_t length, CEXCEPTION_T cmock_to_throw);
+#define TEST_DATA_CopyRange_ReturnThruPtr_pDataToReceiver(pDataToReceiver) TEST_DATA_CopyRange_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, sizeof(void))
+#define TEST_DATA_CopyRange_ReturnArrayThruPtr_pDataToReceiver(pDataToReceiver, cmock_len) TEST_DATA_CopyRange_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, cmock_len * sizeof(*pDataToReceiver))
+#define TEST_DATA_CopyRange_ReturnMemThruPtr_pDataToReceiver(pDataToReceiver, cmock_size) TEST_DATA_CopyRange_CMockReturnMemThruPtr_pDataToReceiver(__LINE__, pDataToReceiver, cmock_size)
+void TEST_DATA_CopyRange_CMockReturnMemThruPtr_pDataToReceiver(UNITY_LINE_TYPE cmock_line, void* pDataToReceiver, size_t cmock_size);
+#define TEST_DATA_CopyRange_IgnoreArg_blockId() TEST_DATA_CopyRange_CMockIgnoreArg_blockId(__LINE__)
+void TEST_DATA_CopyRange_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_CopyRange_IgnoreArg_pDataToReceiver() TEST_DATA_CopyRange_CMockIgnoreArg_pDataToReceiver(__LINE__)
+void TEST_DATA_CopyRange_CMockIgnoreArg_pDataToReceiver(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_CopyRange_IgnoreArg_offset() TEST_DATA_CopyRange_CMockIgnoreArg_offset(__LINE__)
+void TEST_DATA_CopyRange_CMockIgnoreArg_offset(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_CopyRange_IgnoreArg_length() TEST_DATA_CopyRange_CMockIgnoreArg_length(__LINE__)
+void TEST_DATA_CopyRange_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_NotifySubscribers_Ignore() TEST_DATA_NotifySubscribers_CMockIgnore()
+void TEST_DATA_NotifySubscribers_CMockIgnore(void);
+#define TEST_DATA_NotifySubscribers_StopIgnore() TEST_DATA_NotifySubscribers_CMockStopIgnore()
+void TEST_DATA_NotifySubscribers_CMockStopIgnore(void);
+#define TEST_DATA_NotifySubscribers_Expect(blockId) TEST_DATA_NotifySubscribers_CMockExpect(__LINE__, blockId)
+void TEST_DATA_NotifySubscribers_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId);
+typedef void (* CMOCK_TEST_DATA_NotifySubscribers_CALLBACK)(DATA_BLOCK_ID_e blockId, int cmock_num_calls);
+void TEST_DATA_NotifySubscribers_AddCallback(CMOCK_TEST_DATA_NotifySubscribers_CALLBACK Callback);
+void TEST_DATA_NotifySubscribers_Stub(CMOCK_TEST_DATA_NotifySubscribers_CALLBACK Callback);
+#define TEST_DATA_NotifySubscribers_StubWithCallback TEST_DATA_NotifySubscribers_Stub
+#define TEST_DATA_NotifySubscribers_ExpectAndThrow(blockId, cmock_to_throw) TEST_DATA_NotifySubscribers_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void TEST_DATA_NotifySubscribers_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define TEST_DATA_NotifySubscribers_IgnoreArg_blockId() TEST_DATA_NotifySubscribers_CMockIgnoreArg_blockId(__LINE__)
+void TEST_DATA_NotifySubscribers_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_GetSequenceCounter_IgnoreAndReturn(cmock_retval) TEST_DATA_GetSequenceCounter_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_DATA_GetSequenceCounter_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define TEST_DATA_GetSequenceCounter_StopIgnore() TEST_DATA_GetSequenceCounter_CMockStopIgnore()
+void TEST_DATA_GetSequenceCounter_CMockStopIgnore(void);
+#define TEST_DATA_GetSequenceCounter_ExpectAndReturn(blockId, cmock_retval) TEST_DATA_GetSequenceCounter_CMockExpectAndReturn(__LINE__, blockId, cmock_retval)
+void TEST_DATA_GetSequenceCounter_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_TEST_DATA_GetSequenceCounter_CALLBACK)(DATA_BLOCK_ID_e blockId, int cmock_num_calls);
+void TEST_DATA_GetSequenceCounter_AddCallback(CMOCK_TEST_DATA_GetSequenceCounter_CALLBACK Callback);
+void TEST_DATA_GetSequenceCounter_Stub(CMOCK_TEST_DATA_GetSequenceCounter_CALLBACK Callback);
+#define TEST_DATA_GetSequenceCounter_StubWithCallback TEST_DATA_GetSequenceCounter_Stub
+#define TEST_DATA_GetSequenceCounter_ExpectAndThrow(blockId, cmock_to_throw) TEST_DATA_GetSequenceCounter_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void TEST_DATA_GetSequenceCounter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define TEST_DATA_GetSequenceCounter_IgnoreArg_blockId() TEST_DATA_GetSequenceCounter_CMockIgnoreArg_blockId(__LINE__)
+void TEST_DATA_GetSequenceCounter_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_SetSequenceCounter_Ignore() TEST_DATA_SetSequenceCounter_CMockIgnore()
+void TEST_DATA_SetSequenceCounter_CMockIgnore(void);
+#define TEST_DATA_SetSequenceCounter_StopIgnore() TEST_DATA_SetSequenceCounter_CMockStopIgnore()
+void TEST_DATA_SetSequenceCounter_CMockStopIgnore(void);
+#define TEST_DATA_SetSequenceCounter_Expect(blockId, value) TEST_DATA_SetSequenceCounter_CMockExpect(__LINE__, blockId, value)
+void TEST_DATA_SetSequenceCounter_CMockExpect(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t value);
+typedef void (* CMOCK_TEST_DATA_SetSequenceCounter_CALLBACK)(DATA_BLOCK_ID_e blockId, uint32_t value, int cmock_num_calls);
+void TEST_DATA_SetSequenceCounter_AddCallback(CMOCK_TEST_DATA_SetSequenceCounter_CALLBACK Callback);
+void TEST_DATA_SetSequenceCounter_Stub(CMOCK_TEST_DATA_SetSequenceCounter_CALLBACK Callback);
+#define TEST_DATA_SetSequenceCounter_StubWithCallback TEST_DATA_SetSequenceCounter_Stub
+#define TEST_DATA_SetSequenceCounter_ExpectAndThrow(blockId, value, cmock_to_throw) TEST_DATA_SetSequenceCounter_CMockExpectAndThrow(__LINE__, blockId, value, cmock_to_throw)
+void TEST_DATA_SetSequenceCounter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_ID_e blockId, uint32_t value, CEXCEPTION_T cmock_to_throw);
+#define TEST_DATA_SetSequenceCounter_IgnoreArg_blockId() TEST_DATA_SetSequenceCounter_CMockIgnoreArg_blockId(__LINE__)
+void TEST_DATA_SetSequenceCounter_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define TEST_DATA_SetSequenceCounter_IgnoreArg_value() TEST_DATA_SetSequenceCounter_CMockIgnoreArg_value(__LINE__)
+void TEST_DATA_SetSequenceCounter_CMockIgnoreArg_value(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
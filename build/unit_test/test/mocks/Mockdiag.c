@@ -0,0 +1,751 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockdiag.h"
+
+static const char* CMockString_DIAG_CheckEvent = "DIAG_CheckEvent";
+static const char* CMockString_DIAG_Handler = "DIAG_Handler";
+static const char* CMockString_DIAG_Initialize = "DIAG_Initialize";
+static const char* CMockString_DIAG_PrintErrors = "DIAG_PrintErrors";
+static const char* CMockString_cond = "cond";
+static const char* CMockString_data = "data";
+static const char* CMockString_diag_dev_pointer = "diag_dev_pointer";
+static const char* CMockString_diag_id = "diag_id";
+static const char* CMockString_event = "event";
+static const char* CMockString_impact = "impact";
+
+typedef struct _CMOCK_DIAG_Handler_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  DIAG_RETURNTYPE_e ReturnVal;
+  int CallOrder;
+  DIAG_ID_e Expected_diag_id;
+  DIAG_EVENT_e Expected_event;
+  DIAG_IMPACT_LEVEL_e Expected_impact;
+  uint32_t Expected_data;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_diag_id;
+  char IgnoreArg_event;
+  char IgnoreArg_impact;
+  char IgnoreArg_data;
+
+} CMOCK_DIAG_Handler_CALL_INSTANCE;
+
+typedef struct _CMOCK_DIAG_CheckEvent_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  STD_RETURN_TYPE_e Expected_cond;
+  DIAG_ID_e Expected_diag_id;
+  DIAG_IMPACT_LEVEL_e Expected_impact;
+  uint32_t Expected_data;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_cond;
+  char IgnoreArg_diag_id;
+  char IgnoreArg_impact;
+  char IgnoreArg_data;
+
+} CMOCK_DIAG_CheckEvent_CALL_INSTANCE;
+
+typedef struct _CMOCK_DIAG_Initialize_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  DIAG_DEV_s* Expected_diag_dev_pointer;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_diag_dev_pointer_Used;
+  DIAG_DEV_s* ReturnThruPtr_diag_dev_pointer_Val;
+  size_t ReturnThruPtr_diag_dev_pointer_Size;
+  char IgnoreArg_diag_dev_pointer;
+
+} CMOCK_DIAG_Initialize_CALL_INSTANCE;
+
+typedef struct _CMOCK_DIAG_PrintErrors_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DIAG_PrintErrors_CALL_INSTANCE;
+
+static struct MockdiagInstance
+{
+  char DIAG_Handler_IgnoreBool;
+  DIAG_RETURNTYPE_e DIAG_Handler_FinalReturn;
+  char DIAG_Handler_CallbackBool;
+  CMOCK_DIAG_Handler_CALLBACK DIAG_Handler_CallbackFunctionPointer;
+  int DIAG_Handler_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DIAG_Handler_CallInstance;
+  char DIAG_CheckEvent_IgnoreBool;
+  STD_RETURN_TYPE_e DIAG_CheckEvent_FinalReturn;
+  char DIAG_CheckEvent_CallbackBool;
+  CMOCK_DIAG_CheckEvent_CALLBACK DIAG_CheckEvent_CallbackFunctionPointer;
+  int DIAG_CheckEvent_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DIAG_CheckEvent_CallInstance;
+  char DIAG_Initialize_IgnoreBool;
+  STD_RETURN_TYPE_e DIAG_Initialize_FinalReturn;
+  char DIAG_Initialize_CallbackBool;
+  CMOCK_DIAG_Initialize_CALLBACK DIAG_Initialize_CallbackFunctionPointer;
+  int DIAG_Initialize_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DIAG_Initialize_CallInstance;
+  char DIAG_PrintErrors_IgnoreBool;
+  char DIAG_PrintErrors_CallbackBool;
+  CMOCK_DIAG_PrintErrors_CALLBACK DIAG_PrintErrors_CallbackFunctionPointer;
+  int DIAG_PrintErrors_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DIAG_PrintErrors_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockdiag_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.DIAG_Handler_CallInstance;
+  if (Mock.DIAG_Handler_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DIAG_Handler);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DIAG_Handler_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DIAG_CheckEvent_CallInstance;
+  if (Mock.DIAG_CheckEvent_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DIAG_CheckEvent);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DIAG_CheckEvent_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DIAG_Initialize_CallInstance;
+  if (Mock.DIAG_Initialize_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DIAG_Initialize);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DIAG_Initialize_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DIAG_PrintErrors_CallInstance;
+  if (Mock.DIAG_PrintErrors_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DIAG_PrintErrors);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DIAG_PrintErrors_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockdiag_Init(void)
+{
+  Mockdiag_Destroy();
+}
+
+void Mockdiag_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+DIAG_RETURNTYPE_e DIAG_Handler(DIAG_ID_e diag_id, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DIAG_Handler);
+  cmock_call_instance = (CMOCK_DIAG_Handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DIAG_Handler_CallInstance);
+  Mock.DIAG_Handler_CallInstance = CMock_Guts_MemNext(Mock.DIAG_Handler_CallInstance);
+  if (Mock.DIAG_Handler_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DIAG_Handler_FinalReturn;
+    memcpy((void*)(&Mock.DIAG_Handler_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(DIAG_RETURNTYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(DIAG_RETURNTYPE_e) ? 1 : -1])); /* add DIAG_RETURNTYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DIAG_Handler_CallbackBool &&
+      Mock.DIAG_Handler_CallbackFunctionPointer != NULL)
+  {
+    DIAG_RETURNTYPE_e cmock_cb_ret = Mock.DIAG_Handler_CallbackFunctionPointer(diag_id, event, impact, data, Mock.DIAG_Handler_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_diag_id)
+  {
+    UNITY_SET_DETAILS(CMockString_DIAG_Handler,CMockString_diag_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_diag_id), (void*)(&diag_id), sizeof(DIAG_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_event)
+  {
+    UNITY_SET_DETAILS(CMockString_DIAG_Handler,CMockString_event);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_event), (void*)(&event), sizeof(DIAG_EVENT_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_impact)
+  {
+    UNITY_SET_DETAILS(CMockString_DIAG_Handler,CMockString_impact);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_impact), (void*)(&impact), sizeof(DIAG_IMPACT_LEVEL_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_DIAG_Handler,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_data, data, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DIAG_Handler_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DIAG_Handler_CallbackFunctionPointer(diag_id, event, impact, data, Mock.DIAG_Handler_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DIAG_Handler(CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance, DIAG_ID_e diag_id, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data);
+void CMockExpectParameters_DIAG_Handler(CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance, DIAG_ID_e diag_id, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_diag_id), (void*)(&diag_id),
+         sizeof(DIAG_ID_e[sizeof(diag_id) == sizeof(DIAG_ID_e) ? 1 : -1])); /* add DIAG_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_diag_id = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_event), (void*)(&event),
+         sizeof(DIAG_EVENT_e[sizeof(event) == sizeof(DIAG_EVENT_e) ? 1 : -1])); /* add DIAG_EVENT_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_event = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_impact), (void*)(&impact),
+         sizeof(DIAG_IMPACT_LEVEL_e[sizeof(impact) == sizeof(DIAG_IMPACT_LEVEL_e) ? 1 : -1])); /* add DIAG_IMPACT_LEVEL_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_impact = 0;
+  cmock_call_instance->Expected_data = data;
+  cmock_call_instance->IgnoreArg_data = 0;
+}
+
+void DIAG_Handler_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, DIAG_RETURNTYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_Handler_CALL_INSTANCE));
+  CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_Handler_CallInstance = CMock_Guts_MemChain(Mock.DIAG_Handler_CallInstance, cmock_guts_index);
+  Mock.DIAG_Handler_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DIAG_Handler_IgnoreBool = (char)1;
+}
+
+void DIAG_Handler_CMockStopIgnore(void)
+{
+  if(Mock.DIAG_Handler_IgnoreBool)
+    Mock.DIAG_Handler_CallInstance = CMock_Guts_MemNext(Mock.DIAG_Handler_CallInstance);
+  Mock.DIAG_Handler_IgnoreBool = (char)0;
+}
+
+void DIAG_Handler_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DIAG_ID_e diag_id, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data, DIAG_RETURNTYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_Handler_CALL_INSTANCE));
+  CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_Handler_CallInstance = CMock_Guts_MemChain(Mock.DIAG_Handler_CallInstance, cmock_guts_index);
+  Mock.DIAG_Handler_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DIAG_Handler(cmock_call_instance, diag_id, event, impact, data);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(DIAG_RETURNTYPE_e[sizeof(cmock_to_return) == sizeof(DIAG_RETURNTYPE_e) ? 1 : -1])); /* add DIAG_RETURNTYPE_e to :treat_as_array if this causes an error */
+}
+
+void DIAG_Handler_AddCallback(CMOCK_DIAG_Handler_CALLBACK Callback)
+{
+  Mock.DIAG_Handler_IgnoreBool = (char)0;
+  Mock.DIAG_Handler_CallbackBool = (char)1;
+  Mock.DIAG_Handler_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_Handler_Stub(CMOCK_DIAG_Handler_CALLBACK Callback)
+{
+  Mock.DIAG_Handler_IgnoreBool = (char)0;
+  Mock.DIAG_Handler_CallbackBool = (char)0;
+  Mock.DIAG_Handler_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_Handler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DIAG_ID_e diag_id, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_Handler_CALL_INSTANCE));
+  CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_Handler_CallInstance = CMock_Guts_MemChain(Mock.DIAG_Handler_CallInstance, cmock_guts_index);
+  Mock.DIAG_Handler_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DIAG_Handler(cmock_call_instance, diag_id, event, impact, data);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DIAG_Handler_CMockIgnoreArg_diag_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_Handler_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_diag_id = 1;
+}
+
+void DIAG_Handler_CMockIgnoreArg_event(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_Handler_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_event = 1;
+}
+
+void DIAG_Handler_CMockIgnoreArg_impact(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_Handler_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_impact = 1;
+}
+
+void DIAG_Handler_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DIAG_Handler_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Handler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_Handler_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+STD_RETURN_TYPE_e DIAG_CheckEvent(STD_RETURN_TYPE_e cond, DIAG_ID_e diag_id, DIAG_IMPACT_LEVEL_e impact, uint32_t data)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DIAG_CheckEvent);
+  cmock_call_instance = (CMOCK_DIAG_CheckEvent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DIAG_CheckEvent_CallInstance);
+  Mock.DIAG_CheckEvent_CallInstance = CMock_Guts_MemNext(Mock.DIAG_CheckEvent_CallInstance);
+  if (Mock.DIAG_CheckEvent_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DIAG_CheckEvent_FinalReturn;
+    memcpy((void*)(&Mock.DIAG_CheckEvent_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DIAG_CheckEvent_CallbackBool &&
+      Mock.DIAG_CheckEvent_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DIAG_CheckEvent_CallbackFunctionPointer(cond, diag_id, impact, data, Mock.DIAG_CheckEvent_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cond)
+  {
+    UNITY_SET_DETAILS(CMockString_DIAG_CheckEvent,CMockString_cond);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_cond), (void*)(&cond), sizeof(STD_RETURN_TYPE_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_diag_id)
+  {
+    UNITY_SET_DETAILS(CMockString_DIAG_CheckEvent,CMockString_diag_id);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_diag_id), (void*)(&diag_id), sizeof(DIAG_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_impact)
+  {
+    UNITY_SET_DETAILS(CMockString_DIAG_CheckEvent,CMockString_impact);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_impact), (void*)(&impact), sizeof(DIAG_IMPACT_LEVEL_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_DIAG_CheckEvent,CMockString_data);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_data, data, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DIAG_CheckEvent_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DIAG_CheckEvent_CallbackFunctionPointer(cond, diag_id, impact, data, Mock.DIAG_CheckEvent_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DIAG_CheckEvent(CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance, STD_RETURN_TYPE_e cond, DIAG_ID_e diag_id, DIAG_IMPACT_LEVEL_e impact, uint32_t data);
+void CMockExpectParameters_DIAG_CheckEvent(CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance, STD_RETURN_TYPE_e cond, DIAG_ID_e diag_id, DIAG_IMPACT_LEVEL_e impact, uint32_t data)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_cond), (void*)(&cond),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cond) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_cond = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_diag_id), (void*)(&diag_id),
+         sizeof(DIAG_ID_e[sizeof(diag_id) == sizeof(DIAG_ID_e) ? 1 : -1])); /* add DIAG_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_diag_id = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_impact), (void*)(&impact),
+         sizeof(DIAG_IMPACT_LEVEL_e[sizeof(impact) == sizeof(DIAG_IMPACT_LEVEL_e) ? 1 : -1])); /* add DIAG_IMPACT_LEVEL_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_impact = 0;
+  cmock_call_instance->Expected_data = data;
+  cmock_call_instance->IgnoreArg_data = 0;
+}
+
+void DIAG_CheckEvent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_CheckEvent_CALL_INSTANCE));
+  CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_CheckEvent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_CheckEvent_CallInstance = CMock_Guts_MemChain(Mock.DIAG_CheckEvent_CallInstance, cmock_guts_index);
+  Mock.DIAG_CheckEvent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DIAG_CheckEvent_IgnoreBool = (char)1;
+}
+
+void DIAG_CheckEvent_CMockStopIgnore(void)
+{
+  if(Mock.DIAG_CheckEvent_IgnoreBool)
+    Mock.DIAG_CheckEvent_CallInstance = CMock_Guts_MemNext(Mock.DIAG_CheckEvent_CallInstance);
+  Mock.DIAG_CheckEvent_IgnoreBool = (char)0;
+}
+
+void DIAG_CheckEvent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cond, DIAG_ID_e diag_id, DIAG_IMPACT_LEVEL_e impact, uint32_t data, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_CheckEvent_CALL_INSTANCE));
+  CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_CheckEvent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_CheckEvent_CallInstance = CMock_Guts_MemChain(Mock.DIAG_CheckEvent_CallInstance, cmock_guts_index);
+  Mock.DIAG_CheckEvent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DIAG_CheckEvent(cmock_call_instance, cond, diag_id, impact, data);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DIAG_CheckEvent_AddCallback(CMOCK_DIAG_CheckEvent_CALLBACK Callback)
+{
+  Mock.DIAG_CheckEvent_IgnoreBool = (char)0;
+  Mock.DIAG_CheckEvent_CallbackBool = (char)1;
+  Mock.DIAG_CheckEvent_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_CheckEvent_Stub(CMOCK_DIAG_CheckEvent_CALLBACK Callback)
+{
+  Mock.DIAG_CheckEvent_IgnoreBool = (char)0;
+  Mock.DIAG_CheckEvent_CallbackBool = (char)0;
+  Mock.DIAG_CheckEvent_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_CheckEvent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cond, DIAG_ID_e diag_id, DIAG_IMPACT_LEVEL_e impact, uint32_t data, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_CheckEvent_CALL_INSTANCE));
+  CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_CheckEvent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_CheckEvent_CallInstance = CMock_Guts_MemChain(Mock.DIAG_CheckEvent_CallInstance, cmock_guts_index);
+  Mock.DIAG_CheckEvent_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DIAG_CheckEvent(cmock_call_instance, cond, diag_id, impact, data);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DIAG_CheckEvent_CMockIgnoreArg_cond(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_CheckEvent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_CheckEvent_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cond = 1;
+}
+
+void DIAG_CheckEvent_CMockIgnoreArg_diag_id(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_CheckEvent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_CheckEvent_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_diag_id = 1;
+}
+
+void DIAG_CheckEvent_CMockIgnoreArg_impact(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_CheckEvent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_CheckEvent_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_impact = 1;
+}
+
+void DIAG_CheckEvent_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DIAG_CheckEvent_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_CheckEvent_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_CheckEvent_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+STD_RETURN_TYPE_e DIAG_Initialize(DIAG_DEV_s* diag_dev_pointer)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DIAG_Initialize_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DIAG_Initialize);
+  cmock_call_instance = (CMOCK_DIAG_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DIAG_Initialize_CallInstance);
+  Mock.DIAG_Initialize_CallInstance = CMock_Guts_MemNext(Mock.DIAG_Initialize_CallInstance);
+  if (Mock.DIAG_Initialize_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DIAG_Initialize_FinalReturn;
+    memcpy((void*)(&Mock.DIAG_Initialize_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DIAG_Initialize_CallbackBool &&
+      Mock.DIAG_Initialize_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DIAG_Initialize_CallbackFunctionPointer(diag_dev_pointer, Mock.DIAG_Initialize_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_diag_dev_pointer)
+  {
+    UNITY_SET_DETAILS(CMockString_DIAG_Initialize,CMockString_diag_dev_pointer);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_diag_dev_pointer), (void*)(diag_dev_pointer), sizeof(DIAG_DEV_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.DIAG_Initialize_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DIAG_Initialize_CallbackFunctionPointer(diag_dev_pointer, Mock.DIAG_Initialize_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_diag_dev_pointer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(diag_dev_pointer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)diag_dev_pointer, (void*)cmock_call_instance->ReturnThruPtr_diag_dev_pointer_Val,
+      cmock_call_instance->ReturnThruPtr_diag_dev_pointer_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_DIAG_Initialize(CMOCK_DIAG_Initialize_CALL_INSTANCE* cmock_call_instance, DIAG_DEV_s* diag_dev_pointer);
+void CMockExpectParameters_DIAG_Initialize(CMOCK_DIAG_Initialize_CALL_INSTANCE* cmock_call_instance, DIAG_DEV_s* diag_dev_pointer)
+{
+  cmock_call_instance->Expected_diag_dev_pointer = diag_dev_pointer;
+  cmock_call_instance->IgnoreArg_diag_dev_pointer = 0;
+  cmock_call_instance->ReturnThruPtr_diag_dev_pointer_Used = 0;
+}
+
+void DIAG_Initialize_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_Initialize_CALL_INSTANCE));
+  CMOCK_DIAG_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_Initialize_CallInstance = CMock_Guts_MemChain(Mock.DIAG_Initialize_CallInstance, cmock_guts_index);
+  Mock.DIAG_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DIAG_Initialize_IgnoreBool = (char)1;
+}
+
+void DIAG_Initialize_CMockStopIgnore(void)
+{
+  if(Mock.DIAG_Initialize_IgnoreBool)
+    Mock.DIAG_Initialize_CallInstance = CMock_Guts_MemNext(Mock.DIAG_Initialize_CallInstance);
+  Mock.DIAG_Initialize_IgnoreBool = (char)0;
+}
+
+void DIAG_Initialize_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DIAG_DEV_s* diag_dev_pointer, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_Initialize_CALL_INSTANCE));
+  CMOCK_DIAG_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_Initialize_CallInstance = CMock_Guts_MemChain(Mock.DIAG_Initialize_CallInstance, cmock_guts_index);
+  Mock.DIAG_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DIAG_Initialize(cmock_call_instance, diag_dev_pointer);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DIAG_Initialize_AddCallback(CMOCK_DIAG_Initialize_CALLBACK Callback)
+{
+  Mock.DIAG_Initialize_IgnoreBool = (char)0;
+  Mock.DIAG_Initialize_CallbackBool = (char)1;
+  Mock.DIAG_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_Initialize_Stub(CMOCK_DIAG_Initialize_CALLBACK Callback)
+{
+  Mock.DIAG_Initialize_IgnoreBool = (char)0;
+  Mock.DIAG_Initialize_CallbackBool = (char)0;
+  Mock.DIAG_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DIAG_DEV_s* diag_dev_pointer, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_Initialize_CALL_INSTANCE));
+  CMOCK_DIAG_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_Initialize_CallInstance = CMock_Guts_MemChain(Mock.DIAG_Initialize_CallInstance, cmock_guts_index);
+  Mock.DIAG_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_DIAG_Initialize(cmock_call_instance, diag_dev_pointer);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DIAG_Initialize_CMockReturnMemThruPtr_diag_dev_pointer(UNITY_LINE_TYPE cmock_line, DIAG_DEV_s* diag_dev_pointer, size_t cmock_size)
+{
+  CMOCK_DIAG_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_Initialize_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_diag_dev_pointer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_diag_dev_pointer_Val = diag_dev_pointer;
+  cmock_call_instance->ReturnThruPtr_diag_dev_pointer_Size = cmock_size;
+}
+
+void DIAG_Initialize_CMockIgnoreArg_diag_dev_pointer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_DIAG_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.DIAG_Initialize_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_diag_dev_pointer = 1;
+}
+
+void DIAG_PrintErrors(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DIAG_PrintErrors_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DIAG_PrintErrors);
+  cmock_call_instance = (CMOCK_DIAG_PrintErrors_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DIAG_PrintErrors_CallInstance);
+  Mock.DIAG_PrintErrors_CallInstance = CMock_Guts_MemNext(Mock.DIAG_PrintErrors_CallInstance);
+  if (Mock.DIAG_PrintErrors_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DIAG_PrintErrors_CallbackBool &&
+      Mock.DIAG_PrintErrors_CallbackFunctionPointer != NULL)
+  {
+    Mock.DIAG_PrintErrors_CallbackFunctionPointer(Mock.DIAG_PrintErrors_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DIAG_PrintErrors_CallbackFunctionPointer != NULL)
+  {
+    Mock.DIAG_PrintErrors_CallbackFunctionPointer(Mock.DIAG_PrintErrors_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DIAG_PrintErrors_CMockIgnore(void)
+{
+  Mock.DIAG_PrintErrors_IgnoreBool = (char)1;
+}
+
+void DIAG_PrintErrors_CMockStopIgnore(void)
+{
+  Mock.DIAG_PrintErrors_IgnoreBool = (char)0;
+}
+
+void DIAG_PrintErrors_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_PrintErrors_CALL_INSTANCE));
+  CMOCK_DIAG_PrintErrors_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_PrintErrors_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_PrintErrors_CallInstance = CMock_Guts_MemChain(Mock.DIAG_PrintErrors_CallInstance, cmock_guts_index);
+  Mock.DIAG_PrintErrors_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DIAG_PrintErrors_AddCallback(CMOCK_DIAG_PrintErrors_CALLBACK Callback)
+{
+  Mock.DIAG_PrintErrors_IgnoreBool = (char)0;
+  Mock.DIAG_PrintErrors_CallbackBool = (char)1;
+  Mock.DIAG_PrintErrors_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_PrintErrors_Stub(CMOCK_DIAG_PrintErrors_CALLBACK Callback)
+{
+  Mock.DIAG_PrintErrors_IgnoreBool = (char)0;
+  Mock.DIAG_PrintErrors_CallbackBool = (char)0;
+  Mock.DIAG_PrintErrors_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_PrintErrors_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_PrintErrors_CALL_INSTANCE));
+  CMOCK_DIAG_PrintErrors_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_PrintErrors_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_PrintErrors_CallInstance = CMock_Guts_MemChain(Mock.DIAG_PrintErrors_CallInstance, cmock_guts_index);
+  Mock.DIAG_PrintErrors_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
@@ -0,0 +1,116 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKDIAG_H
+#define _MOCKDIAG_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "diag.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockdiag_Init(void);
+void Mockdiag_Destroy(void);
+void Mockdiag_Verify(void);
+
+
+
+
+#define DIAG_Handler_IgnoreAndReturn(cmock_retval) DIAG_Handler_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DIAG_Handler_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, DIAG_RETURNTYPE_e cmock_to_return);
+#define DIAG_Handler_StopIgnore() DIAG_Handler_CMockStopIgnore()
+void DIAG_Handler_CMockStopIgnore(void);
+#define DIAG_Handler_ExpectAndReturn(diag_id, event, impact, data, cmock_retval) DIAG_Handler_CMockExpectAndReturn(__LINE__, diag_id, event, impact, data, cmock_retval)
+void DIAG_Handler_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DIAG_ID_e diag_id, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data, DIAG_RETURNTYPE_e cmock_to_return);
+typedef DIAG_RETURNTYPE_e (* CMOCK_DIAG_Handler_CALLBACK)(DIAG_ID_e diag_id, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data, int cmock_num_calls);
+void DIAG_Handler_AddCallback(CMOCK_DIAG_Handler_CALLBACK Callback);
+void DIAG_Handler_Stub(CMOCK_DIAG_Handler_CALLBACK Callback);
+#define DIAG_Handler_StubWithCallback DIAG_Handler_Stub
+#define DIAG_Handler_ExpectAndThrow(diag_id, event, impact, data, cmock_to_throw) DIAG_Handler_CMockExpectAndThrow(__LINE__, diag_id, event, impact, data, cmock_to_throw)
+void DIAG_Handler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DIAG_ID_e diag_id, DIAG_EVENT_e event, DIAG_IMPACT_LEVEL_e impact, uint32_t data, CEXCEPTION_T cmock_to_throw);
+#define DIAG_Handler_IgnoreArg_diag_id() DIAG_Handler_CMockIgnoreArg_diag_id(__LINE__)
+void DIAG_Handler_CMockIgnoreArg_diag_id(UNITY_LINE_TYPE cmock_line);
+#define DIAG_Handler_IgnoreArg_event() DIAG_Handler_CMockIgnoreArg_event(__LINE__)
+void DIAG_Handler_CMockIgnoreArg_event(UNITY_LINE_TYPE cmock_line);
+#define DIAG_Handler_IgnoreArg_impact() DIAG_Handler_CMockIgnoreArg_impact(__LINE__)
+void DIAG_Handler_CMockIgnoreArg_impact(UNITY_LINE_TYPE cmock_line);
+#define DIAG_Handler_IgnoreArg_data() DIAG_Handler_CMockIgnoreArg_data(__LINE__)
+void DIAG_Handler_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define DIAG_CheckEvent_IgnoreAndReturn(cmock_retval) DIAG_CheckEvent_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DIAG_CheckEvent_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DIAG_CheckEvent_StopIgnore() DIAG_CheckEvent_CMockStopIgnore()
+void DIAG_CheckEvent_CMockStopIgnore(void);
+#define DIAG_CheckEvent_ExpectAndReturn(cond, diag_id, impact, data, cmock_retval) DIAG_CheckEvent_CMockExpectAndReturn(__LINE__, cond, diag_id, impact, data, cmock_retval)
+void DIAG_CheckEvent_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cond, DIAG_ID_e diag_id, DIAG_IMPACT_LEVEL_e impact, uint32_t data, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DIAG_CheckEvent_CALLBACK)(STD_RETURN_TYPE_e cond, DIAG_ID_e diag_id, DIAG_IMPACT_LEVEL_e impact, uint32_t data, int cmock_num_calls);
+void DIAG_CheckEvent_AddCallback(CMOCK_DIAG_CheckEvent_CALLBACK Callback);
+void DIAG_CheckEvent_Stub(CMOCK_DIAG_CheckEvent_CALLBACK Callback);
+#define DIAG_CheckEvent_StubWithCallback DIAG_CheckEvent_Stub
+#define DIAG_CheckEvent_ExpectAndThrow(cond, diag_id, impact, data, cmock_to_throw) DIAG_CheckEvent_CMockExpectAndThrow(__LINE__, cond, diag_id, impact, data, cmock_to_throw)
+void DIAG_CheckEvent_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cond, DIAG_ID_e diag_id, DIAG_IMPACT_LEVEL_e impact, uint32_t data, CEXCEPTION_T cmock_to_throw);
+#define DIAG_CheckEvent_IgnoreArg_cond() DIAG_CheckEvent_CMockIgnoreArg_cond(__LINE__)
+void DIAG_CheckEvent_CMockIgnoreArg_cond(UNITY_LINE_TYPE cmock_line);
+#define DIAG_CheckEvent_IgnoreArg_diag_id() DIAG_CheckEvent_CMockIgnoreArg_diag_id(__LINE__)
+void DIAG_CheckEvent_CMockIgnoreArg_diag_id(UNITY_LINE_TYPE cmock_line);
+#define DIAG_CheckEvent_IgnoreArg_impact() DIAG_CheckEvent_CMockIgnoreArg_impact(__LINE__)
+void DIAG_CheckEvent_CMockIgnoreArg_impact(UNITY_LINE_TYPE cmock_line);
+#define DIAG_CheckEvent_IgnoreArg_data() DIAG_CheckEvent_CMockIgnoreArg_data(__LINE__)
+void DIAG_CheckEvent_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define DIAG_Initialize_IgnoreAndReturn(cmock_retval) DIAG_Initialize_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DIAG_Initialize_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DIAG_Initialize_StopIgnore() DIAG_Initialize_CMockStopIgnore()
+void DIAG_Initialize_CMockStopIgnore(void);
+#define DIAG_Initialize_ExpectAndReturn(diag_dev_pointer, cmock_retval) DIAG_Initialize_CMockExpectAndReturn(__LINE__, diag_dev_pointer, cmock_retval)
+void DIAG_Initialize_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DIAG_DEV_s* diag_dev_pointer, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DIAG_Initialize_CALLBACK)(DIAG_DEV_s* diag_dev_pointer, int cmock_num_calls);
+void DIAG_Initialize_AddCallback(CMOCK_DIAG_Initialize_CALLBACK Callback);
+void DIAG_Initialize_Stub(CMOCK_DIAG_Initialize_CALLBACK Callback);
+#define DIAG_Initialize_StubWithCallback DIAG_Initialize_Stub
+#define DIAG_Initialize_ExpectAndThrow(diag_dev_pointer, cmock_to_throw) DIAG_Initialize_CMockExpectAndThrow(__LINE__, diag_dev_pointer, cmock_to_throw)
+void DIAG_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DIAG_DEV_s* diag_dev_pointer, CEXCEPTION_T cmock_to_throw);
+#define DIAG_Initialize_ReturnThruPtr_diag_dev_pointer(diag_dev_pointer) DIAG_Initialize_CMockReturnMemThruPtr_diag_dev_pointer(__LINE__, diag_dev_pointer, sizeof(DIAG_DEV_s))
+#define DIAG_Initialize_ReturnArrayThruPtr_diag_dev_pointer(diag_dev_pointer, cmock_len) DIAG_Initialize_CMockReturnMemThruPtr_diag_dev_pointer(__LINE__, diag_dev_pointer, cmock_len * sizeof(*diag_dev_pointer))
+#define DIAG_Initialize_ReturnMemThruPtr_diag_dev_pointer(diag_dev_pointer, cmock_size) DIAG_Initialize_CMockReturnMemThruPtr_diag_dev_pointer(__LINE__, diag_dev_pointer, cmock_size)
+void DIAG_Initialize_CMockReturnMemThruPtr_diag_dev_pointer(UNITY_LINE_TYPE cmock_line, DIAG_DEV_s* diag_dev_pointer, size_t cmock_size);
+#define DIAG_Initialize_IgnoreArg_diag_dev_pointer() DIAG_Initialize_CMockIgnoreArg_diag_dev_pointer(__LINE__)
+void DIAG_Initialize_CMockIgnoreArg_diag_dev_pointer(UNITY_LINE_TYPE cmock_line);
+#define DIAG_PrintErrors_Ignore() DIAG_PrintErrors_CMockIgnore()
+void DIAG_PrintErrors_CMockIgnore(void);
+#define DIAG_PrintErrors_StopIgnore() DIAG_PrintErrors_CMockStopIgnore()
+void DIAG_PrintErrors_CMockStopIgnore(void);
+#define DIAG_PrintErrors_Expect() DIAG_PrintErrors_CMockExpect(__LINE__)
+void DIAG_PrintErrors_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DIAG_PrintErrors_CALLBACK)(int cmock_num_calls);
+void DIAG_PrintErrors_AddCallback(CMOCK_DIAG_PrintErrors_CALLBACK Callback);
+void DIAG_PrintErrors_Stub(CMOCK_DIAG_PrintErrors_CALLBACK Callback);
+#define DIAG_PrintErrors_StubWithCallback DIAG_PrintErrors_Stub
+#define DIAG_PrintErrors_ExpectAndThrow(cmock_to_throw) DIAG_PrintErrors_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DIAG_PrintErrors_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,150 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockdiag_cfg.h"
+
+static const char* CMockString_DIAG_UpdateFlags = "DIAG_UpdateFlags";
+
+typedef struct _CMOCK_DIAG_UpdateFlags_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DIAG_UpdateFlags_CALL_INSTANCE;
+
+static struct Mockdiag_cfgInstance
+{
+  char DIAG_UpdateFlags_IgnoreBool;
+  char DIAG_UpdateFlags_CallbackBool;
+  CMOCK_DIAG_UpdateFlags_CALLBACK DIAG_UpdateFlags_CallbackFunctionPointer;
+  int DIAG_UpdateFlags_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DIAG_UpdateFlags_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockdiag_cfg_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.DIAG_UpdateFlags_CallInstance;
+  if (Mock.DIAG_UpdateFlags_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DIAG_UpdateFlags);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DIAG_UpdateFlags_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockdiag_cfg_Init(void)
+{
+  Mockdiag_cfg_Destroy();
+}
+
+void Mockdiag_cfg_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void DIAG_UpdateFlags(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DIAG_UpdateFlags_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DIAG_UpdateFlags);
+  cmock_call_instance = (CMOCK_DIAG_UpdateFlags_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DIAG_UpdateFlags_CallInstance);
+  Mock.DIAG_UpdateFlags_CallInstance = CMock_Guts_MemNext(Mock.DIAG_UpdateFlags_CallInstance);
+  if (Mock.DIAG_UpdateFlags_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DIAG_UpdateFlags_CallbackBool &&
+      Mock.DIAG_UpdateFlags_CallbackFunctionPointer != NULL)
+  {
+    Mock.DIAG_UpdateFlags_CallbackFunctionPointer(Mock.DIAG_UpdateFlags_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DIAG_UpdateFlags_CallbackFunctionPointer != NULL)
+  {
+    Mock.DIAG_UpdateFlags_CallbackFunctionPointer(Mock.DIAG_UpdateFlags_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DIAG_UpdateFlags_CMockIgnore(void)
+{
+  Mock.DIAG_UpdateFlags_IgnoreBool = (char)1;
+}
+
+void DIAG_UpdateFlags_CMockStopIgnore(void)
+{
+  Mock.DIAG_UpdateFlags_IgnoreBool = (char)0;
+}
+
+void DIAG_UpdateFlags_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_UpdateFlags_CALL_INSTANCE));
+  CMOCK_DIAG_UpdateFlags_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_UpdateFlags_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_UpdateFlags_CallInstance = CMock_Guts_MemChain(Mock.DIAG_UpdateFlags_CallInstance, cmock_guts_index);
+  Mock.DIAG_UpdateFlags_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DIAG_UpdateFlags_AddCallback(CMOCK_DIAG_UpdateFlags_CALLBACK Callback)
+{
+  Mock.DIAG_UpdateFlags_IgnoreBool = (char)0;
+  Mock.DIAG_UpdateFlags_CallbackBool = (char)1;
+  Mock.DIAG_UpdateFlags_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_UpdateFlags_Stub(CMOCK_DIAG_UpdateFlags_CALLBACK Callback)
+{
+  Mock.DIAG_UpdateFlags_IgnoreBool = (char)0;
+  Mock.DIAG_UpdateFlags_CallbackBool = (char)0;
+  Mock.DIAG_UpdateFlags_CallbackFunctionPointer = Callback;
+}
+
+void DIAG_UpdateFlags_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DIAG_UpdateFlags_CALL_INSTANCE));
+  CMOCK_DIAG_UpdateFlags_CALL_INSTANCE* cmock_call_instance = (CMOCK_DIAG_UpdateFlags_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DIAG_UpdateFlags_CallInstance = CMock_Guts_MemChain(Mock.DIAG_UpdateFlags_CallInstance, cmock_guts_index);
+  Mock.DIAG_UpdateFlags_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
@@ -0,0 +1,58 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKDIAG_CFG_H
+#define _MOCKDIAG_CFG_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "diag_cfg.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockdiag_cfg_Init(void);
+void Mockdiag_cfg_Destroy(void);
+void Mockdiag_cfg_Verify(void);
+
+
+
+
+#define DIAG_UpdateFlags_Ignore() DIAG_UpdateFlags_CMockIgnore()
+void DIAG_UpdateFlags_CMockIgnore(void);
+#define DIAG_UpdateFlags_StopIgnore() DIAG_UpdateFlags_CMockStopIgnore()
+void DIAG_UpdateFlags_CMockStopIgnore(void);
+#define DIAG_UpdateFlags_Expect() DIAG_UpdateFlags_CMockExpect(__LINE__)
+void DIAG_UpdateFlags_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DIAG_UpdateFlags_CALLBACK)(int cmock_num_calls);
+void DIAG_UpdateFlags_AddCallback(CMOCK_DIAG_UpdateFlags_CALLBACK Callback);
+void DIAG_UpdateFlags_Stub(CMOCK_DIAG_UpdateFlags_CALLBACK Callback);
+#define DIAG_UpdateFlags_StubWithCallback DIAG_UpdateFlags_Stub
+#define DIAG_UpdateFlags_ExpectAndThrow(cmock_to_throw) DIAG_UpdateFlags_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DIAG_UpdateFlags_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,1630 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockdma.h"
+
+static const char* CMockString_DMA_InitN775 = "DMA_InitN775";
+static const char* CMockString_DMA_Initialize = "DMA_Initialize";
+static const char* CMockString_DMA_IsRxTransmitOngoingN775 = "DMA_IsRxTransmitOngoingN775";
+static const char* CMockString_DMA_IsTransmitOngoing = "DMA_IsTransmitOngoing";
+static const char* CMockString_DMA_IsTxTransmitOngoingN775 = "DMA_IsTxTransmitOngoingN775";
+static const char* CMockString_DMA_ReInit = "DMA_ReInit";
+static const char* CMockString_DMA_ReInitN775Rx = "DMA_ReInitN775Rx";
+static const char* CMockString_DMA_ReInitN775Tx = "DMA_ReInitN775Tx";
+static const char* CMockString_DMA_SetRxTransmitOngoingN775 = "DMA_SetRxTransmitOngoingN775";
+static const char* CMockString_DMA_SetTransmitOngoing = "DMA_SetTransmitOngoing";
+static const char* CMockString_DMA_SetTxTransmitOngoingN775 = "DMA_SetTxTransmitOngoingN775";
+static const char* CMockString_DMA_TransmitReceive_SPIwithDMA = "DMA_TransmitReceive_SPIwithDMA";
+static const char* CMockString_DMA_TransmitSPiWithDmaN775 = "DMA_TransmitSPiWithDmaN775";
+
+typedef struct _CMOCK_DMA_Initialize_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_Initialize_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_ReInit_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_ReInit_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_InitN775_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_InitN775_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE;
+
+typedef struct _CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE;
+
+static struct MockdmaInstance
+{
+  char DMA_Initialize_IgnoreBool;
+  char DMA_Initialize_CallbackBool;
+  CMOCK_DMA_Initialize_CALLBACK DMA_Initialize_CallbackFunctionPointer;
+  int DMA_Initialize_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_Initialize_CallInstance;
+  char DMA_ReInit_IgnoreBool;
+  char DMA_ReInit_CallbackBool;
+  CMOCK_DMA_ReInit_CALLBACK DMA_ReInit_CallbackFunctionPointer;
+  int DMA_ReInit_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_ReInit_CallInstance;
+  char DMA_TransmitReceive_SPIwithDMA_IgnoreBool;
+  STD_RETURN_TYPE_e DMA_TransmitReceive_SPIwithDMA_FinalReturn;
+  char DMA_TransmitReceive_SPIwithDMA_CallbackBool;
+  CMOCK_DMA_TransmitReceive_SPIwithDMA_CALLBACK DMA_TransmitReceive_SPIwithDMA_CallbackFunctionPointer;
+  int DMA_TransmitReceive_SPIwithDMA_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_TransmitReceive_SPIwithDMA_CallInstance;
+  char DMA_IsTransmitOngoing_IgnoreBool;
+  _Bool DMA_IsTransmitOngoing_FinalReturn;
+  char DMA_IsTransmitOngoing_CallbackBool;
+  CMOCK_DMA_IsTransmitOngoing_CALLBACK DMA_IsTransmitOngoing_CallbackFunctionPointer;
+  int DMA_IsTransmitOngoing_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_IsTransmitOngoing_CallInstance;
+  char DMA_SetTransmitOngoing_IgnoreBool;
+  char DMA_SetTransmitOngoing_CallbackBool;
+  CMOCK_DMA_SetTransmitOngoing_CALLBACK DMA_SetTransmitOngoing_CallbackFunctionPointer;
+  int DMA_SetTransmitOngoing_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_SetTransmitOngoing_CallInstance;
+  char DMA_IsTxTransmitOngoingN775_IgnoreBool;
+  _Bool DMA_IsTxTransmitOngoingN775_FinalReturn;
+  char DMA_IsTxTransmitOngoingN775_CallbackBool;
+  CMOCK_DMA_IsTxTransmitOngoingN775_CALLBACK DMA_IsTxTransmitOngoingN775_CallbackFunctionPointer;
+  int DMA_IsTxTransmitOngoingN775_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_IsTxTransmitOngoingN775_CallInstance;
+  char DMA_IsRxTransmitOngoingN775_IgnoreBool;
+  _Bool DMA_IsRxTransmitOngoingN775_FinalReturn;
+  char DMA_IsRxTransmitOngoingN775_CallbackBool;
+  CMOCK_DMA_IsRxTransmitOngoingN775_CALLBACK DMA_IsRxTransmitOngoingN775_CallbackFunctionPointer;
+  int DMA_IsRxTransmitOngoingN775_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_IsRxTransmitOngoingN775_CallInstance;
+  char DMA_SetTxTransmitOngoingN775_IgnoreBool;
+  char DMA_SetTxTransmitOngoingN775_CallbackBool;
+  CMOCK_DMA_SetTxTransmitOngoingN775_CALLBACK DMA_SetTxTransmitOngoingN775_CallbackFunctionPointer;
+  int DMA_SetTxTransmitOngoingN775_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_SetTxTransmitOngoingN775_CallInstance;
+  char DMA_SetRxTransmitOngoingN775_IgnoreBool;
+  char DMA_SetRxTransmitOngoingN775_CallbackBool;
+  CMOCK_DMA_SetRxTransmitOngoingN775_CALLBACK DMA_SetRxTransmitOngoingN775_CallbackFunctionPointer;
+  int DMA_SetRxTransmitOngoingN775_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_SetRxTransmitOngoingN775_CallInstance;
+  char DMA_InitN775_IgnoreBool;
+  char DMA_InitN775_CallbackBool;
+  CMOCK_DMA_InitN775_CALLBACK DMA_InitN775_CallbackFunctionPointer;
+  int DMA_InitN775_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_InitN775_CallInstance;
+  char DMA_ReInitN775Tx_IgnoreBool;
+  char DMA_ReInitN775Tx_CallbackBool;
+  CMOCK_DMA_ReInitN775Tx_CALLBACK DMA_ReInitN775Tx_CallbackFunctionPointer;
+  int DMA_ReInitN775Tx_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_ReInitN775Tx_CallInstance;
+  char DMA_ReInitN775Rx_IgnoreBool;
+  char DMA_ReInitN775Rx_CallbackBool;
+  CMOCK_DMA_ReInitN775Rx_CALLBACK DMA_ReInitN775Rx_CallbackFunctionPointer;
+  int DMA_ReInitN775Rx_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_ReInitN775Rx_CallInstance;
+  char DMA_TransmitSPiWithDmaN775_IgnoreBool;
+  STD_RETURN_TYPE_e DMA_TransmitSPiWithDmaN775_FinalReturn;
+  char DMA_TransmitSPiWithDmaN775_CallbackBool;
+  CMOCK_DMA_TransmitSPiWithDmaN775_CALLBACK DMA_TransmitSPiWithDmaN775_CallbackFunctionPointer;
+  int DMA_TransmitSPiWithDmaN775_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE DMA_TransmitSPiWithDmaN775_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockdma_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.DMA_Initialize_CallInstance;
+  if (Mock.DMA_Initialize_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_Initialize);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_Initialize_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_ReInit_CallInstance;
+  if (Mock.DMA_ReInit_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_ReInit);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_ReInit_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance;
+  if (Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_TransmitReceive_SPIwithDMA);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_TransmitReceive_SPIwithDMA_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_IsTransmitOngoing_CallInstance;
+  if (Mock.DMA_IsTransmitOngoing_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_IsTransmitOngoing);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_IsTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_SetTransmitOngoing_CallInstance;
+  if (Mock.DMA_SetTransmitOngoing_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_SetTransmitOngoing);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_SetTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_IsTxTransmitOngoingN775_CallInstance;
+  if (Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_IsTxTransmitOngoingN775);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_IsTxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_IsRxTransmitOngoingN775_CallInstance;
+  if (Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_IsRxTransmitOngoingN775);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_IsRxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_SetTxTransmitOngoingN775_CallInstance;
+  if (Mock.DMA_SetTxTransmitOngoingN775_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_SetTxTransmitOngoingN775);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_SetTxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_SetRxTransmitOngoingN775_CallInstance;
+  if (Mock.DMA_SetRxTransmitOngoingN775_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_SetRxTransmitOngoingN775);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_SetRxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_InitN775_CallInstance;
+  if (Mock.DMA_InitN775_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_InitN775);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_InitN775_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_ReInitN775Tx_CallInstance;
+  if (Mock.DMA_ReInitN775Tx_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_ReInitN775Tx);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_ReInitN775Tx_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_ReInitN775Rx_CallInstance;
+  if (Mock.DMA_ReInitN775Rx_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_ReInitN775Rx);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_ReInitN775Rx_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.DMA_TransmitSPiWithDmaN775_CallInstance;
+  if (Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_DMA_TransmitSPiWithDmaN775);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.DMA_TransmitSPiWithDmaN775_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockdma_Init(void)
+{
+  Mockdma_Destroy();
+}
+
+void Mockdma_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void DMA_Initialize(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_Initialize_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_Initialize);
+  cmock_call_instance = (CMOCK_DMA_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_Initialize_CallInstance);
+  Mock.DMA_Initialize_CallInstance = CMock_Guts_MemNext(Mock.DMA_Initialize_CallInstance);
+  if (Mock.DMA_Initialize_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DMA_Initialize_CallbackBool &&
+      Mock.DMA_Initialize_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_Initialize_CallbackFunctionPointer(Mock.DMA_Initialize_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_Initialize_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_Initialize_CallbackFunctionPointer(Mock.DMA_Initialize_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DMA_Initialize_CMockIgnore(void)
+{
+  Mock.DMA_Initialize_IgnoreBool = (char)1;
+}
+
+void DMA_Initialize_CMockStopIgnore(void)
+{
+  Mock.DMA_Initialize_IgnoreBool = (char)0;
+}
+
+void DMA_Initialize_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_Initialize_CALL_INSTANCE));
+  CMOCK_DMA_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_Initialize_CallInstance = CMock_Guts_MemChain(Mock.DMA_Initialize_CallInstance, cmock_guts_index);
+  Mock.DMA_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DMA_Initialize_AddCallback(CMOCK_DMA_Initialize_CALLBACK Callback)
+{
+  Mock.DMA_Initialize_IgnoreBool = (char)0;
+  Mock.DMA_Initialize_CallbackBool = (char)1;
+  Mock.DMA_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void DMA_Initialize_Stub(CMOCK_DMA_Initialize_CALLBACK Callback)
+{
+  Mock.DMA_Initialize_IgnoreBool = (char)0;
+  Mock.DMA_Initialize_CallbackBool = (char)0;
+  Mock.DMA_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void DMA_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_Initialize_CALL_INSTANCE));
+  CMOCK_DMA_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_Initialize_CallInstance = CMock_Guts_MemChain(Mock.DMA_Initialize_CallInstance, cmock_guts_index);
+  Mock.DMA_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DMA_ReInit(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_ReInit_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_ReInit);
+  cmock_call_instance = (CMOCK_DMA_ReInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_ReInit_CallInstance);
+  Mock.DMA_ReInit_CallInstance = CMock_Guts_MemNext(Mock.DMA_ReInit_CallInstance);
+  if (Mock.DMA_ReInit_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DMA_ReInit_CallbackBool &&
+      Mock.DMA_ReInit_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_ReInit_CallbackFunctionPointer(Mock.DMA_ReInit_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_ReInit_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_ReInit_CallbackFunctionPointer(Mock.DMA_ReInit_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DMA_ReInit_CMockIgnore(void)
+{
+  Mock.DMA_ReInit_IgnoreBool = (char)1;
+}
+
+void DMA_ReInit_CMockStopIgnore(void)
+{
+  Mock.DMA_ReInit_IgnoreBool = (char)0;
+}
+
+void DMA_ReInit_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_ReInit_CALL_INSTANCE));
+  CMOCK_DMA_ReInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_ReInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_ReInit_CallInstance = CMock_Guts_MemChain(Mock.DMA_ReInit_CallInstance, cmock_guts_index);
+  Mock.DMA_ReInit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DMA_ReInit_AddCallback(CMOCK_DMA_ReInit_CALLBACK Callback)
+{
+  Mock.DMA_ReInit_IgnoreBool = (char)0;
+  Mock.DMA_ReInit_CallbackBool = (char)1;
+  Mock.DMA_ReInit_CallbackFunctionPointer = Callback;
+}
+
+void DMA_ReInit_Stub(CMOCK_DMA_ReInit_CALLBACK Callback)
+{
+  Mock.DMA_ReInit_IgnoreBool = (char)0;
+  Mock.DMA_ReInit_CallbackBool = (char)0;
+  Mock.DMA_ReInit_CallbackFunctionPointer = Callback;
+}
+
+void DMA_ReInit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_ReInit_CALL_INSTANCE));
+  CMOCK_DMA_ReInit_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_ReInit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_ReInit_CallInstance = CMock_Guts_MemChain(Mock.DMA_ReInit_CallInstance, cmock_guts_index);
+  Mock.DMA_ReInit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e DMA_TransmitReceive_SPIwithDMA(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_TransmitReceive_SPIwithDMA);
+  cmock_call_instance = (CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance);
+  Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance = CMock_Guts_MemNext(Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance);
+  if (Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DMA_TransmitReceive_SPIwithDMA_FinalReturn;
+    memcpy((void*)(&Mock.DMA_TransmitReceive_SPIwithDMA_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DMA_TransmitReceive_SPIwithDMA_CallbackBool &&
+      Mock.DMA_TransmitReceive_SPIwithDMA_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DMA_TransmitReceive_SPIwithDMA_CallbackFunctionPointer(Mock.DMA_TransmitReceive_SPIwithDMA_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_TransmitReceive_SPIwithDMA_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DMA_TransmitReceive_SPIwithDMA_CallbackFunctionPointer(Mock.DMA_TransmitReceive_SPIwithDMA_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DMA_TransmitReceive_SPIwithDMA_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE));
+  CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance = CMock_Guts_MemChain(Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance, cmock_guts_index);
+  Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool = (char)1;
+}
+
+void DMA_TransmitReceive_SPIwithDMA_CMockStopIgnore(void)
+{
+  if(Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool)
+    Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance = CMock_Guts_MemNext(Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance);
+  Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool = (char)0;
+}
+
+void DMA_TransmitReceive_SPIwithDMA_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE));
+  CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance = CMock_Guts_MemChain(Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance, cmock_guts_index);
+  Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DMA_TransmitReceive_SPIwithDMA_AddCallback(CMOCK_DMA_TransmitReceive_SPIwithDMA_CALLBACK Callback)
+{
+  Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool = (char)0;
+  Mock.DMA_TransmitReceive_SPIwithDMA_CallbackBool = (char)1;
+  Mock.DMA_TransmitReceive_SPIwithDMA_CallbackFunctionPointer = Callback;
+}
+
+void DMA_TransmitReceive_SPIwithDMA_Stub(CMOCK_DMA_TransmitReceive_SPIwithDMA_CALLBACK Callback)
+{
+  Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool = (char)0;
+  Mock.DMA_TransmitReceive_SPIwithDMA_CallbackBool = (char)0;
+  Mock.DMA_TransmitReceive_SPIwithDMA_CallbackFunctionPointer = Callback;
+}
+
+void DMA_TransmitReceive_SPIwithDMA_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE));
+  CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_TransmitReceive_SPIwithDMA_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance = CMock_Guts_MemChain(Mock.DMA_TransmitReceive_SPIwithDMA_CallInstance, cmock_guts_index);
+  Mock.DMA_TransmitReceive_SPIwithDMA_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+_Bool DMA_IsTransmitOngoing(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_IsTransmitOngoing);
+  cmock_call_instance = (CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_IsTransmitOngoing_CallInstance);
+  Mock.DMA_IsTransmitOngoing_CallInstance = CMock_Guts_MemNext(Mock.DMA_IsTransmitOngoing_CallInstance);
+  if (Mock.DMA_IsTransmitOngoing_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DMA_IsTransmitOngoing_FinalReturn;
+    memcpy((void*)(&Mock.DMA_IsTransmitOngoing_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DMA_IsTransmitOngoing_CallbackBool &&
+      Mock.DMA_IsTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.DMA_IsTransmitOngoing_CallbackFunctionPointer(Mock.DMA_IsTransmitOngoing_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_IsTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DMA_IsTransmitOngoing_CallbackFunctionPointer(Mock.DMA_IsTransmitOngoing_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DMA_IsTransmitOngoing_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE));
+  CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_IsTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.DMA_IsTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.DMA_IsTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DMA_IsTransmitOngoing_IgnoreBool = (char)1;
+}
+
+void DMA_IsTransmitOngoing_CMockStopIgnore(void)
+{
+  if(Mock.DMA_IsTransmitOngoing_IgnoreBool)
+    Mock.DMA_IsTransmitOngoing_CallInstance = CMock_Guts_MemNext(Mock.DMA_IsTransmitOngoing_CallInstance);
+  Mock.DMA_IsTransmitOngoing_IgnoreBool = (char)0;
+}
+
+void DMA_IsTransmitOngoing_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE));
+  CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_IsTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.DMA_IsTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.DMA_IsTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void DMA_IsTransmitOngoing_AddCallback(CMOCK_DMA_IsTransmitOngoing_CALLBACK Callback)
+{
+  Mock.DMA_IsTransmitOngoing_IgnoreBool = (char)0;
+  Mock.DMA_IsTransmitOngoing_CallbackBool = (char)1;
+  Mock.DMA_IsTransmitOngoing_CallbackFunctionPointer = Callback;
+}
+
+void DMA_IsTransmitOngoing_Stub(CMOCK_DMA_IsTransmitOngoing_CALLBACK Callback)
+{
+  Mock.DMA_IsTransmitOngoing_IgnoreBool = (char)0;
+  Mock.DMA_IsTransmitOngoing_CallbackBool = (char)0;
+  Mock.DMA_IsTransmitOngoing_CallbackFunctionPointer = Callback;
+}
+
+void DMA_IsTransmitOngoing_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE));
+  CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_IsTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.DMA_IsTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.DMA_IsTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DMA_SetTransmitOngoing(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_SetTransmitOngoing);
+  cmock_call_instance = (CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_SetTransmitOngoing_CallInstance);
+  Mock.DMA_SetTransmitOngoing_CallInstance = CMock_Guts_MemNext(Mock.DMA_SetTransmitOngoing_CallInstance);
+  if (Mock.DMA_SetTransmitOngoing_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DMA_SetTransmitOngoing_CallbackBool &&
+      Mock.DMA_SetTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_SetTransmitOngoing_CallbackFunctionPointer(Mock.DMA_SetTransmitOngoing_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_SetTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_SetTransmitOngoing_CallbackFunctionPointer(Mock.DMA_SetTransmitOngoing_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DMA_SetTransmitOngoing_CMockIgnore(void)
+{
+  Mock.DMA_SetTransmitOngoing_IgnoreBool = (char)1;
+}
+
+void DMA_SetTransmitOngoing_CMockStopIgnore(void)
+{
+  Mock.DMA_SetTransmitOngoing_IgnoreBool = (char)0;
+}
+
+void DMA_SetTransmitOngoing_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE));
+  CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_SetTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.DMA_SetTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.DMA_SetTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DMA_SetTransmitOngoing_AddCallback(CMOCK_DMA_SetTransmitOngoing_CALLBACK Callback)
+{
+  Mock.DMA_SetTransmitOngoing_IgnoreBool = (char)0;
+  Mock.DMA_SetTransmitOngoing_CallbackBool = (char)1;
+  Mock.DMA_SetTransmitOngoing_CallbackFunctionPointer = Callback;
+}
+
+void DMA_SetTransmitOngoing_Stub(CMOCK_DMA_SetTransmitOngoing_CALLBACK Callback)
+{
+  Mock.DMA_SetTransmitOngoing_IgnoreBool = (char)0;
+  Mock.DMA_SetTransmitOngoing_CallbackBool = (char)0;
+  Mock.DMA_SetTransmitOngoing_CallbackFunctionPointer = Callback;
+}
+
+void DMA_SetTransmitOngoing_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE));
+  CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_SetTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_SetTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.DMA_SetTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.DMA_SetTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+_Bool DMA_IsTxTransmitOngoingN775(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_IsTxTransmitOngoingN775);
+  cmock_call_instance = (CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_IsTxTransmitOngoingN775_CallInstance);
+  Mock.DMA_IsTxTransmitOngoingN775_CallInstance = CMock_Guts_MemNext(Mock.DMA_IsTxTransmitOngoingN775_CallInstance);
+  if (Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DMA_IsTxTransmitOngoingN775_FinalReturn;
+    memcpy((void*)(&Mock.DMA_IsTxTransmitOngoingN775_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DMA_IsTxTransmitOngoingN775_CallbackBool &&
+      Mock.DMA_IsTxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.DMA_IsTxTransmitOngoingN775_CallbackFunctionPointer(Mock.DMA_IsTxTransmitOngoingN775_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_IsTxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DMA_IsTxTransmitOngoingN775_CallbackFunctionPointer(Mock.DMA_IsTxTransmitOngoingN775_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DMA_IsTxTransmitOngoingN775_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_IsTxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_IsTxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool = (char)1;
+}
+
+void DMA_IsTxTransmitOngoingN775_CMockStopIgnore(void)
+{
+  if(Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool)
+    Mock.DMA_IsTxTransmitOngoingN775_CallInstance = CMock_Guts_MemNext(Mock.DMA_IsTxTransmitOngoingN775_CallInstance);
+  Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool = (char)0;
+}
+
+void DMA_IsTxTransmitOngoingN775_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_IsTxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_IsTxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void DMA_IsTxTransmitOngoingN775_AddCallback(CMOCK_DMA_IsTxTransmitOngoingN775_CALLBACK Callback)
+{
+  Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool = (char)0;
+  Mock.DMA_IsTxTransmitOngoingN775_CallbackBool = (char)1;
+  Mock.DMA_IsTxTransmitOngoingN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_IsTxTransmitOngoingN775_Stub(CMOCK_DMA_IsTxTransmitOngoingN775_CALLBACK Callback)
+{
+  Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool = (char)0;
+  Mock.DMA_IsTxTransmitOngoingN775_CallbackBool = (char)0;
+  Mock.DMA_IsTxTransmitOngoingN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_IsTxTransmitOngoingN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_IsTxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_IsTxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_IsTxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_IsTxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+_Bool DMA_IsRxTransmitOngoingN775(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_IsRxTransmitOngoingN775);
+  cmock_call_instance = (CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_IsRxTransmitOngoingN775_CallInstance);
+  Mock.DMA_IsRxTransmitOngoingN775_CallInstance = CMock_Guts_MemNext(Mock.DMA_IsRxTransmitOngoingN775_CallInstance);
+  if (Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DMA_IsRxTransmitOngoingN775_FinalReturn;
+    memcpy((void*)(&Mock.DMA_IsRxTransmitOngoingN775_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DMA_IsRxTransmitOngoingN775_CallbackBool &&
+      Mock.DMA_IsRxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.DMA_IsRxTransmitOngoingN775_CallbackFunctionPointer(Mock.DMA_IsRxTransmitOngoingN775_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_IsRxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DMA_IsRxTransmitOngoingN775_CallbackFunctionPointer(Mock.DMA_IsRxTransmitOngoingN775_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DMA_IsRxTransmitOngoingN775_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_IsRxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_IsRxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool = (char)1;
+}
+
+void DMA_IsRxTransmitOngoingN775_CMockStopIgnore(void)
+{
+  if(Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool)
+    Mock.DMA_IsRxTransmitOngoingN775_CallInstance = CMock_Guts_MemNext(Mock.DMA_IsRxTransmitOngoingN775_CallInstance);
+  Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool = (char)0;
+}
+
+void DMA_IsRxTransmitOngoingN775_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_IsRxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_IsRxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void DMA_IsRxTransmitOngoingN775_AddCallback(CMOCK_DMA_IsRxTransmitOngoingN775_CALLBACK Callback)
+{
+  Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool = (char)0;
+  Mock.DMA_IsRxTransmitOngoingN775_CallbackBool = (char)1;
+  Mock.DMA_IsRxTransmitOngoingN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_IsRxTransmitOngoingN775_Stub(CMOCK_DMA_IsRxTransmitOngoingN775_CALLBACK Callback)
+{
+  Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool = (char)0;
+  Mock.DMA_IsRxTransmitOngoingN775_CallbackBool = (char)0;
+  Mock.DMA_IsRxTransmitOngoingN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_IsRxTransmitOngoingN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_IsRxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_IsRxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_IsRxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_IsRxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DMA_SetTxTransmitOngoingN775(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_SetTxTransmitOngoingN775);
+  cmock_call_instance = (CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_SetTxTransmitOngoingN775_CallInstance);
+  Mock.DMA_SetTxTransmitOngoingN775_CallInstance = CMock_Guts_MemNext(Mock.DMA_SetTxTransmitOngoingN775_CallInstance);
+  if (Mock.DMA_SetTxTransmitOngoingN775_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DMA_SetTxTransmitOngoingN775_CallbackBool &&
+      Mock.DMA_SetTxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_SetTxTransmitOngoingN775_CallbackFunctionPointer(Mock.DMA_SetTxTransmitOngoingN775_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_SetTxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_SetTxTransmitOngoingN775_CallbackFunctionPointer(Mock.DMA_SetTxTransmitOngoingN775_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DMA_SetTxTransmitOngoingN775_CMockIgnore(void)
+{
+  Mock.DMA_SetTxTransmitOngoingN775_IgnoreBool = (char)1;
+}
+
+void DMA_SetTxTransmitOngoingN775_CMockStopIgnore(void)
+{
+  Mock.DMA_SetTxTransmitOngoingN775_IgnoreBool = (char)0;
+}
+
+void DMA_SetTxTransmitOngoingN775_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_SetTxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_SetTxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_SetTxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DMA_SetTxTransmitOngoingN775_AddCallback(CMOCK_DMA_SetTxTransmitOngoingN775_CALLBACK Callback)
+{
+  Mock.DMA_SetTxTransmitOngoingN775_IgnoreBool = (char)0;
+  Mock.DMA_SetTxTransmitOngoingN775_CallbackBool = (char)1;
+  Mock.DMA_SetTxTransmitOngoingN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_SetTxTransmitOngoingN775_Stub(CMOCK_DMA_SetTxTransmitOngoingN775_CALLBACK Callback)
+{
+  Mock.DMA_SetTxTransmitOngoingN775_IgnoreBool = (char)0;
+  Mock.DMA_SetTxTransmitOngoingN775_CallbackBool = (char)0;
+  Mock.DMA_SetTxTransmitOngoingN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_SetTxTransmitOngoingN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_SetTxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_SetTxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_SetTxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_SetTxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DMA_SetRxTransmitOngoingN775(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_SetRxTransmitOngoingN775);
+  cmock_call_instance = (CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_SetRxTransmitOngoingN775_CallInstance);
+  Mock.DMA_SetRxTransmitOngoingN775_CallInstance = CMock_Guts_MemNext(Mock.DMA_SetRxTransmitOngoingN775_CallInstance);
+  if (Mock.DMA_SetRxTransmitOngoingN775_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DMA_SetRxTransmitOngoingN775_CallbackBool &&
+      Mock.DMA_SetRxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_SetRxTransmitOngoingN775_CallbackFunctionPointer(Mock.DMA_SetRxTransmitOngoingN775_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_SetRxTransmitOngoingN775_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_SetRxTransmitOngoingN775_CallbackFunctionPointer(Mock.DMA_SetRxTransmitOngoingN775_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DMA_SetRxTransmitOngoingN775_CMockIgnore(void)
+{
+  Mock.DMA_SetRxTransmitOngoingN775_IgnoreBool = (char)1;
+}
+
+void DMA_SetRxTransmitOngoingN775_CMockStopIgnore(void)
+{
+  Mock.DMA_SetRxTransmitOngoingN775_IgnoreBool = (char)0;
+}
+
+void DMA_SetRxTransmitOngoingN775_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_SetRxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_SetRxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_SetRxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DMA_SetRxTransmitOngoingN775_AddCallback(CMOCK_DMA_SetRxTransmitOngoingN775_CALLBACK Callback)
+{
+  Mock.DMA_SetRxTransmitOngoingN775_IgnoreBool = (char)0;
+  Mock.DMA_SetRxTransmitOngoingN775_CallbackBool = (char)1;
+  Mock.DMA_SetRxTransmitOngoingN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_SetRxTransmitOngoingN775_Stub(CMOCK_DMA_SetRxTransmitOngoingN775_CALLBACK Callback)
+{
+  Mock.DMA_SetRxTransmitOngoingN775_IgnoreBool = (char)0;
+  Mock.DMA_SetRxTransmitOngoingN775_CallbackBool = (char)0;
+  Mock.DMA_SetRxTransmitOngoingN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_SetRxTransmitOngoingN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE));
+  CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_SetRxTransmitOngoingN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_SetRxTransmitOngoingN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_SetRxTransmitOngoingN775_CallInstance, cmock_guts_index);
+  Mock.DMA_SetRxTransmitOngoingN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DMA_InitN775(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_InitN775_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_InitN775);
+  cmock_call_instance = (CMOCK_DMA_InitN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_InitN775_CallInstance);
+  Mock.DMA_InitN775_CallInstance = CMock_Guts_MemNext(Mock.DMA_InitN775_CallInstance);
+  if (Mock.DMA_InitN775_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DMA_InitN775_CallbackBool &&
+      Mock.DMA_InitN775_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_InitN775_CallbackFunctionPointer(Mock.DMA_InitN775_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_InitN775_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_InitN775_CallbackFunctionPointer(Mock.DMA_InitN775_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DMA_InitN775_CMockIgnore(void)
+{
+  Mock.DMA_InitN775_IgnoreBool = (char)1;
+}
+
+void DMA_InitN775_CMockStopIgnore(void)
+{
+  Mock.DMA_InitN775_IgnoreBool = (char)0;
+}
+
+void DMA_InitN775_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_InitN775_CALL_INSTANCE));
+  CMOCK_DMA_InitN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_InitN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_InitN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_InitN775_CallInstance, cmock_guts_index);
+  Mock.DMA_InitN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DMA_InitN775_AddCallback(CMOCK_DMA_InitN775_CALLBACK Callback)
+{
+  Mock.DMA_InitN775_IgnoreBool = (char)0;
+  Mock.DMA_InitN775_CallbackBool = (char)1;
+  Mock.DMA_InitN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_InitN775_Stub(CMOCK_DMA_InitN775_CALLBACK Callback)
+{
+  Mock.DMA_InitN775_IgnoreBool = (char)0;
+  Mock.DMA_InitN775_CallbackBool = (char)0;
+  Mock.DMA_InitN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_InitN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_InitN775_CALL_INSTANCE));
+  CMOCK_DMA_InitN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_InitN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_InitN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_InitN775_CallInstance, cmock_guts_index);
+  Mock.DMA_InitN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DMA_ReInitN775Tx(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_ReInitN775Tx);
+  cmock_call_instance = (CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_ReInitN775Tx_CallInstance);
+  Mock.DMA_ReInitN775Tx_CallInstance = CMock_Guts_MemNext(Mock.DMA_ReInitN775Tx_CallInstance);
+  if (Mock.DMA_ReInitN775Tx_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DMA_ReInitN775Tx_CallbackBool &&
+      Mock.DMA_ReInitN775Tx_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_ReInitN775Tx_CallbackFunctionPointer(Mock.DMA_ReInitN775Tx_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_ReInitN775Tx_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_ReInitN775Tx_CallbackFunctionPointer(Mock.DMA_ReInitN775Tx_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DMA_ReInitN775Tx_CMockIgnore(void)
+{
+  Mock.DMA_ReInitN775Tx_IgnoreBool = (char)1;
+}
+
+void DMA_ReInitN775Tx_CMockStopIgnore(void)
+{
+  Mock.DMA_ReInitN775Tx_IgnoreBool = (char)0;
+}
+
+void DMA_ReInitN775Tx_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE));
+  CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_ReInitN775Tx_CallInstance = CMock_Guts_MemChain(Mock.DMA_ReInitN775Tx_CallInstance, cmock_guts_index);
+  Mock.DMA_ReInitN775Tx_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DMA_ReInitN775Tx_AddCallback(CMOCK_DMA_ReInitN775Tx_CALLBACK Callback)
+{
+  Mock.DMA_ReInitN775Tx_IgnoreBool = (char)0;
+  Mock.DMA_ReInitN775Tx_CallbackBool = (char)1;
+  Mock.DMA_ReInitN775Tx_CallbackFunctionPointer = Callback;
+}
+
+void DMA_ReInitN775Tx_Stub(CMOCK_DMA_ReInitN775Tx_CALLBACK Callback)
+{
+  Mock.DMA_ReInitN775Tx_IgnoreBool = (char)0;
+  Mock.DMA_ReInitN775Tx_CallbackBool = (char)0;
+  Mock.DMA_ReInitN775Tx_CallbackFunctionPointer = Callback;
+}
+
+void DMA_ReInitN775Tx_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE));
+  CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_ReInitN775Tx_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_ReInitN775Tx_CallInstance = CMock_Guts_MemChain(Mock.DMA_ReInitN775Tx_CallInstance, cmock_guts_index);
+  Mock.DMA_ReInitN775Tx_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void DMA_ReInitN775Rx(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_ReInitN775Rx);
+  cmock_call_instance = (CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_ReInitN775Rx_CallInstance);
+  Mock.DMA_ReInitN775Rx_CallInstance = CMock_Guts_MemNext(Mock.DMA_ReInitN775Rx_CallInstance);
+  if (Mock.DMA_ReInitN775Rx_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.DMA_ReInitN775Rx_CallbackBool &&
+      Mock.DMA_ReInitN775Rx_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_ReInitN775Rx_CallbackFunctionPointer(Mock.DMA_ReInitN775Rx_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_ReInitN775Rx_CallbackFunctionPointer != NULL)
+  {
+    Mock.DMA_ReInitN775Rx_CallbackFunctionPointer(Mock.DMA_ReInitN775Rx_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void DMA_ReInitN775Rx_CMockIgnore(void)
+{
+  Mock.DMA_ReInitN775Rx_IgnoreBool = (char)1;
+}
+
+void DMA_ReInitN775Rx_CMockStopIgnore(void)
+{
+  Mock.DMA_ReInitN775Rx_IgnoreBool = (char)0;
+}
+
+void DMA_ReInitN775Rx_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE));
+  CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_ReInitN775Rx_CallInstance = CMock_Guts_MemChain(Mock.DMA_ReInitN775Rx_CallInstance, cmock_guts_index);
+  Mock.DMA_ReInitN775Rx_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void DMA_ReInitN775Rx_AddCallback(CMOCK_DMA_ReInitN775Rx_CALLBACK Callback)
+{
+  Mock.DMA_ReInitN775Rx_IgnoreBool = (char)0;
+  Mock.DMA_ReInitN775Rx_CallbackBool = (char)1;
+  Mock.DMA_ReInitN775Rx_CallbackFunctionPointer = Callback;
+}
+
+void DMA_ReInitN775Rx_Stub(CMOCK_DMA_ReInitN775Rx_CALLBACK Callback)
+{
+  Mock.DMA_ReInitN775Rx_IgnoreBool = (char)0;
+  Mock.DMA_ReInitN775Rx_CallbackBool = (char)0;
+  Mock.DMA_ReInitN775Rx_CallbackFunctionPointer = Callback;
+}
+
+void DMA_ReInitN775Rx_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE));
+  CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_ReInitN775Rx_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_ReInitN775Rx_CallInstance = CMock_Guts_MemChain(Mock.DMA_ReInitN775Rx_CallInstance, cmock_guts_index);
+  Mock.DMA_ReInitN775Rx_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e DMA_TransmitSPiWithDmaN775(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_DMA_TransmitSPiWithDmaN775);
+  cmock_call_instance = (CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.DMA_TransmitSPiWithDmaN775_CallInstance);
+  Mock.DMA_TransmitSPiWithDmaN775_CallInstance = CMock_Guts_MemNext(Mock.DMA_TransmitSPiWithDmaN775_CallInstance);
+  if (Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.DMA_TransmitSPiWithDmaN775_FinalReturn;
+    memcpy((void*)(&Mock.DMA_TransmitSPiWithDmaN775_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.DMA_TransmitSPiWithDmaN775_CallbackBool &&
+      Mock.DMA_TransmitSPiWithDmaN775_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.DMA_TransmitSPiWithDmaN775_CallbackFunctionPointer(Mock.DMA_TransmitSPiWithDmaN775_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.DMA_TransmitSPiWithDmaN775_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.DMA_TransmitSPiWithDmaN775_CallbackFunctionPointer(Mock.DMA_TransmitSPiWithDmaN775_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void DMA_TransmitSPiWithDmaN775_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE));
+  CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_TransmitSPiWithDmaN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_TransmitSPiWithDmaN775_CallInstance, cmock_guts_index);
+  Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool = (char)1;
+}
+
+void DMA_TransmitSPiWithDmaN775_CMockStopIgnore(void)
+{
+  if(Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool)
+    Mock.DMA_TransmitSPiWithDmaN775_CallInstance = CMock_Guts_MemNext(Mock.DMA_TransmitSPiWithDmaN775_CallInstance);
+  Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool = (char)0;
+}
+
+void DMA_TransmitSPiWithDmaN775_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE));
+  CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_TransmitSPiWithDmaN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_TransmitSPiWithDmaN775_CallInstance, cmock_guts_index);
+  Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void DMA_TransmitSPiWithDmaN775_AddCallback(CMOCK_DMA_TransmitSPiWithDmaN775_CALLBACK Callback)
+{
+  Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool = (char)0;
+  Mock.DMA_TransmitSPiWithDmaN775_CallbackBool = (char)1;
+  Mock.DMA_TransmitSPiWithDmaN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_TransmitSPiWithDmaN775_Stub(CMOCK_DMA_TransmitSPiWithDmaN775_CALLBACK Callback)
+{
+  Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool = (char)0;
+  Mock.DMA_TransmitSPiWithDmaN775_CallbackBool = (char)0;
+  Mock.DMA_TransmitSPiWithDmaN775_CallbackFunctionPointer = Callback;
+}
+
+void DMA_TransmitSPiWithDmaN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE));
+  CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE* cmock_call_instance = (CMOCK_DMA_TransmitSPiWithDmaN775_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.DMA_TransmitSPiWithDmaN775_CallInstance = CMock_Guts_MemChain(Mock.DMA_TransmitSPiWithDmaN775_CallInstance, cmock_guts_index);
+  Mock.DMA_TransmitSPiWithDmaN775_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
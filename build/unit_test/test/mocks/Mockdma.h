@@ -0,0 +1,202 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKDMA_H
+#define _MOCKDMA_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "dma.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockdma_Init(void);
+void Mockdma_Destroy(void);
+void Mockdma_Verify(void);
+
+
+
+
+#define DMA_Initialize_Ignore() DMA_Initialize_CMockIgnore()
+void DMA_Initialize_CMockIgnore(void);
+#define DMA_Initialize_StopIgnore() DMA_Initialize_CMockStopIgnore()
+void DMA_Initialize_CMockStopIgnore(void);
+#define DMA_Initialize_Expect() DMA_Initialize_CMockExpect(__LINE__)
+void DMA_Initialize_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DMA_Initialize_CALLBACK)(int cmock_num_calls);
+void DMA_Initialize_AddCallback(CMOCK_DMA_Initialize_CALLBACK Callback);
+void DMA_Initialize_Stub(CMOCK_DMA_Initialize_CALLBACK Callback);
+#define DMA_Initialize_StubWithCallback DMA_Initialize_Stub
+#define DMA_Initialize_ExpectAndThrow(cmock_to_throw) DMA_Initialize_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_ReInit_Ignore() DMA_ReInit_CMockIgnore()
+void DMA_ReInit_CMockIgnore(void);
+#define DMA_ReInit_StopIgnore() DMA_ReInit_CMockStopIgnore()
+void DMA_ReInit_CMockStopIgnore(void);
+#define DMA_ReInit_Expect() DMA_ReInit_CMockExpect(__LINE__)
+void DMA_ReInit_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DMA_ReInit_CALLBACK)(int cmock_num_calls);
+void DMA_ReInit_AddCallback(CMOCK_DMA_ReInit_CALLBACK Callback);
+void DMA_ReInit_Stub(CMOCK_DMA_ReInit_CALLBACK Callback);
+#define DMA_ReInit_StubWithCallback DMA_ReInit_Stub
+#define DMA_ReInit_ExpectAndThrow(cmock_to_throw) DMA_ReInit_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_ReInit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_TransmitReceive_SPIwithDMA_IgnoreAndReturn(cmock_retval) DMA_TransmitReceive_SPIwithDMA_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DMA_TransmitReceive_SPIwithDMA_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DMA_TransmitReceive_SPIwithDMA_StopIgnore() DMA_TransmitReceive_SPIwithDMA_CMockStopIgnore()
+void DMA_TransmitReceive_SPIwithDMA_CMockStopIgnore(void);
+#define DMA_TransmitReceive_SPIwithDMA_ExpectAndReturn(cmock_retval) DMA_TransmitReceive_SPIwithDMA_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DMA_TransmitReceive_SPIwithDMA_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DMA_TransmitReceive_SPIwithDMA_CALLBACK)(int cmock_num_calls);
+void DMA_TransmitReceive_SPIwithDMA_AddCallback(CMOCK_DMA_TransmitReceive_SPIwithDMA_CALLBACK Callback);
+void DMA_TransmitReceive_SPIwithDMA_Stub(CMOCK_DMA_TransmitReceive_SPIwithDMA_CALLBACK Callback);
+#define DMA_TransmitReceive_SPIwithDMA_StubWithCallback DMA_TransmitReceive_SPIwithDMA_Stub
+#define DMA_TransmitReceive_SPIwithDMA_ExpectAndThrow(cmock_to_throw) DMA_TransmitReceive_SPIwithDMA_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_TransmitReceive_SPIwithDMA_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_IsTransmitOngoing_IgnoreAndReturn(cmock_retval) DMA_IsTransmitOngoing_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DMA_IsTransmitOngoing_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define DMA_IsTransmitOngoing_StopIgnore() DMA_IsTransmitOngoing_CMockStopIgnore()
+void DMA_IsTransmitOngoing_CMockStopIgnore(void);
+#define DMA_IsTransmitOngoing_ExpectAndReturn(cmock_retval) DMA_IsTransmitOngoing_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DMA_IsTransmitOngoing_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_DMA_IsTransmitOngoing_CALLBACK)(int cmock_num_calls);
+void DMA_IsTransmitOngoing_AddCallback(CMOCK_DMA_IsTransmitOngoing_CALLBACK Callback);
+void DMA_IsTransmitOngoing_Stub(CMOCK_DMA_IsTransmitOngoing_CALLBACK Callback);
+#define DMA_IsTransmitOngoing_StubWithCallback DMA_IsTransmitOngoing_Stub
+#define DMA_IsTransmitOngoing_ExpectAndThrow(cmock_to_throw) DMA_IsTransmitOngoing_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_IsTransmitOngoing_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_SetTransmitOngoing_Ignore() DMA_SetTransmitOngoing_CMockIgnore()
+void DMA_SetTransmitOngoing_CMockIgnore(void);
+#define DMA_SetTransmitOngoing_StopIgnore() DMA_SetTransmitOngoing_CMockStopIgnore()
+void DMA_SetTransmitOngoing_CMockStopIgnore(void);
+#define DMA_SetTransmitOngoing_Expect() DMA_SetTransmitOngoing_CMockExpect(__LINE__)
+void DMA_SetTransmitOngoing_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DMA_SetTransmitOngoing_CALLBACK)(int cmock_num_calls);
+void DMA_SetTransmitOngoing_AddCallback(CMOCK_DMA_SetTransmitOngoing_CALLBACK Callback);
+void DMA_SetTransmitOngoing_Stub(CMOCK_DMA_SetTransmitOngoing_CALLBACK Callback);
+#define DMA_SetTransmitOngoing_StubWithCallback DMA_SetTransmitOngoing_Stub
+#define DMA_SetTransmitOngoing_ExpectAndThrow(cmock_to_throw) DMA_SetTransmitOngoing_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_SetTransmitOngoing_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_IsTxTransmitOngoingN775_IgnoreAndReturn(cmock_retval) DMA_IsTxTransmitOngoingN775_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DMA_IsTxTransmitOngoingN775_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define DMA_IsTxTransmitOngoingN775_StopIgnore() DMA_IsTxTransmitOngoingN775_CMockStopIgnore()
+void DMA_IsTxTransmitOngoingN775_CMockStopIgnore(void);
+#define DMA_IsTxTransmitOngoingN775_ExpectAndReturn(cmock_retval) DMA_IsTxTransmitOngoingN775_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DMA_IsTxTransmitOngoingN775_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_DMA_IsTxTransmitOngoingN775_CALLBACK)(int cmock_num_calls);
+void DMA_IsTxTransmitOngoingN775_AddCallback(CMOCK_DMA_IsTxTransmitOngoingN775_CALLBACK Callback);
+void DMA_IsTxTransmitOngoingN775_Stub(CMOCK_DMA_IsTxTransmitOngoingN775_CALLBACK Callback);
+#define DMA_IsTxTransmitOngoingN775_StubWithCallback DMA_IsTxTransmitOngoingN775_Stub
+#define DMA_IsTxTransmitOngoingN775_ExpectAndThrow(cmock_to_throw) DMA_IsTxTransmitOngoingN775_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_IsTxTransmitOngoingN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_IsRxTransmitOngoingN775_IgnoreAndReturn(cmock_retval) DMA_IsRxTransmitOngoingN775_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DMA_IsRxTransmitOngoingN775_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define DMA_IsRxTransmitOngoingN775_StopIgnore() DMA_IsRxTransmitOngoingN775_CMockStopIgnore()
+void DMA_IsRxTransmitOngoingN775_CMockStopIgnore(void);
+#define DMA_IsRxTransmitOngoingN775_ExpectAndReturn(cmock_retval) DMA_IsRxTransmitOngoingN775_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DMA_IsRxTransmitOngoingN775_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_DMA_IsRxTransmitOngoingN775_CALLBACK)(int cmock_num_calls);
+void DMA_IsRxTransmitOngoingN775_AddCallback(CMOCK_DMA_IsRxTransmitOngoingN775_CALLBACK Callback);
+void DMA_IsRxTransmitOngoingN775_Stub(CMOCK_DMA_IsRxTransmitOngoingN775_CALLBACK Callback);
+#define DMA_IsRxTransmitOngoingN775_StubWithCallback DMA_IsRxTransmitOngoingN775_Stub
+#define DMA_IsRxTransmitOngoingN775_ExpectAndThrow(cmock_to_throw) DMA_IsRxTransmitOngoingN775_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_IsRxTransmitOngoingN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_SetTxTransmitOngoingN775_Ignore() DMA_SetTxTransmitOngoingN775_CMockIgnore()
+void DMA_SetTxTransmitOngoingN775_CMockIgnore(void);
+#define DMA_SetTxTransmitOngoingN775_StopIgnore() DMA_SetTxTransmitOngoingN775_CMockStopIgnore()
+void DMA_SetTxTransmitOngoingN775_CMockStopIgnore(void);
+#define DMA_SetTxTransmitOngoingN775_Expect() DMA_SetTxTransmitOngoingN775_CMockExpect(__LINE__)
+void DMA_SetTxTransmitOngoingN775_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DMA_SetTxTransmitOngoingN775_CALLBACK)(int cmock_num_calls);
+void DMA_SetTxTransmitOngoingN775_AddCallback(CMOCK_DMA_SetTxTransmitOngoingN775_CALLBACK Callback);
+void DMA_SetTxTransmitOngoingN775_Stub(CMOCK_DMA_SetTxTransmitOngoingN775_CALLBACK Callback);
+#define DMA_SetTxTransmitOngoingN775_StubWithCallback DMA_SetTxTransmitOngoingN775_Stub
+#define DMA_SetTxTransmitOngoingN775_ExpectAndThrow(cmock_to_throw) DMA_SetTxTransmitOngoingN775_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_SetTxTransmitOngoingN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_SetRxTransmitOngoingN775_Ignore() DMA_SetRxTransmitOngoingN775_CMockIgnore()
+void DMA_SetRxTransmitOngoingN775_CMockIgnore(void);
+#define DMA_SetRxTransmitOngoingN775_StopIgnore() DMA_SetRxTransmitOngoingN775_CMockStopIgnore()
+void DMA_SetRxTransmitOngoingN775_CMockStopIgnore(void);
+#define DMA_SetRxTransmitOngoingN775_Expect() DMA_SetRxTransmitOngoingN775_CMockExpect(__LINE__)
+void DMA_SetRxTransmitOngoingN775_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DMA_SetRxTransmitOngoingN775_CALLBACK)(int cmock_num_calls);
+void DMA_SetRxTransmitOngoingN775_AddCallback(CMOCK_DMA_SetRxTransmitOngoingN775_CALLBACK Callback);
+void DMA_SetRxTransmitOngoingN775_Stub(CMOCK_DMA_SetRxTransmitOngoingN775_CALLBACK Callback);
+#define DMA_SetRxTransmitOngoingN775_StubWithCallback DMA_SetRxTransmitOngoingN775_Stub
+#define DMA_SetRxTransmitOngoingN775_ExpectAndThrow(cmock_to_throw) DMA_SetRxTransmitOngoingN775_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_SetRxTransmitOngoingN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_InitN775_Ignore() DMA_InitN775_CMockIgnore()
+void DMA_InitN775_CMockIgnore(void);
+#define DMA_InitN775_StopIgnore() DMA_InitN775_CMockStopIgnore()
+void DMA_InitN775_CMockStopIgnore(void);
+#define DMA_InitN775_Expect() DMA_InitN775_CMockExpect(__LINE__)
+void DMA_InitN775_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DMA_InitN775_CALLBACK)(int cmock_num_calls);
+void DMA_InitN775_AddCallback(CMOCK_DMA_InitN775_CALLBACK Callback);
+void DMA_InitN775_Stub(CMOCK_DMA_InitN775_CALLBACK Callback);
+#define DMA_InitN775_StubWithCallback DMA_InitN775_Stub
+#define DMA_InitN775_ExpectAndThrow(cmock_to_throw) DMA_InitN775_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_InitN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_ReInitN775Tx_Ignore() DMA_ReInitN775Tx_CMockIgnore()
+void DMA_ReInitN775Tx_CMockIgnore(void);
+#define DMA_ReInitN775Tx_StopIgnore() DMA_ReInitN775Tx_CMockStopIgnore()
+void DMA_ReInitN775Tx_CMockStopIgnore(void);
+#define DMA_ReInitN775Tx_Expect() DMA_ReInitN775Tx_CMockExpect(__LINE__)
+void DMA_ReInitN775Tx_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DMA_ReInitN775Tx_CALLBACK)(int cmock_num_calls);
+void DMA_ReInitN775Tx_AddCallback(CMOCK_DMA_ReInitN775Tx_CALLBACK Callback);
+void DMA_ReInitN775Tx_Stub(CMOCK_DMA_ReInitN775Tx_CALLBACK Callback);
+#define DMA_ReInitN775Tx_StubWithCallback DMA_ReInitN775Tx_Stub
+#define DMA_ReInitN775Tx_ExpectAndThrow(cmock_to_throw) DMA_ReInitN775Tx_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_ReInitN775Tx_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_ReInitN775Rx_Ignore() DMA_ReInitN775Rx_CMockIgnore()
+void DMA_ReInitN775Rx_CMockIgnore(void);
+#define DMA_ReInitN775Rx_StopIgnore() DMA_ReInitN775Rx_CMockStopIgnore()
+void DMA_ReInitN775Rx_CMockStopIgnore(void);
+#define DMA_ReInitN775Rx_Expect() DMA_ReInitN775Rx_CMockExpect(__LINE__)
+void DMA_ReInitN775Rx_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_DMA_ReInitN775Rx_CALLBACK)(int cmock_num_calls);
+void DMA_ReInitN775Rx_AddCallback(CMOCK_DMA_ReInitN775Rx_CALLBACK Callback);
+void DMA_ReInitN775Rx_Stub(CMOCK_DMA_ReInitN775Rx_CALLBACK Callback);
+#define DMA_ReInitN775Rx_StubWithCallback DMA_ReInitN775Rx_Stub
+#define DMA_ReInitN775Rx_ExpectAndThrow(cmock_to_throw) DMA_ReInitN775Rx_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_ReInitN775Rx_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define DMA_TransmitSPiWithDmaN775_IgnoreAndReturn(cmock_retval) DMA_TransmitSPiWithDmaN775_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void DMA_TransmitSPiWithDmaN775_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define DMA_TransmitSPiWithDmaN775_StopIgnore() DMA_TransmitSPiWithDmaN775_CMockStopIgnore()
+void DMA_TransmitSPiWithDmaN775_CMockStopIgnore(void);
+#define DMA_TransmitSPiWithDmaN775_ExpectAndReturn(cmock_retval) DMA_TransmitSPiWithDmaN775_CMockExpectAndReturn(__LINE__, cmock_retval)
+void DMA_TransmitSPiWithDmaN775_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_DMA_TransmitSPiWithDmaN775_CALLBACK)(int cmock_num_calls);
+void DMA_TransmitSPiWithDmaN775_AddCallback(CMOCK_DMA_TransmitSPiWithDmaN775_CALLBACK Callback);
+void DMA_TransmitSPiWithDmaN775_Stub(CMOCK_DMA_TransmitSPiWithDmaN775_CALLBACK Callback);
+#define DMA_TransmitSPiWithDmaN775_StubWithCallback DMA_TransmitSPiWithDmaN775_Stub
+#define DMA_TransmitSPiWithDmaN775_ExpectAndThrow(cmock_to_throw) DMA_TransmitSPiWithDmaN775_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void DMA_TransmitSPiWithDmaN775_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,328 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockfassert.h"
+
+static const char* CMockString_FAS_DisableInterrupts = "FAS_DisableInterrupts";
+static const char* CMockString_fas_storeAssertLoc = "fas_storeAssertLoc";
+static const char* CMockString_line = "line";
+static const char* CMockString_pc = "pc";
+
+typedef struct _CMOCK_FAS_DisableInterrupts_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_FAS_DisableInterrupts_CALL_INSTANCE;
+
+typedef struct _CMOCK_fas_storeAssertLoc_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint32_t* Expected_pc;
+  uint32_t Expected_line;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pc_Used;
+  uint32_t* ReturnThruPtr_pc_Val;
+  size_t ReturnThruPtr_pc_Size;
+  char IgnoreArg_pc;
+  char IgnoreArg_line;
+
+} CMOCK_fas_storeAssertLoc_CALL_INSTANCE;
+
+static struct MockfassertInstance
+{
+  char FAS_DisableInterrupts_IgnoreBool;
+  char FAS_DisableInterrupts_CallbackBool;
+  CMOCK_FAS_DisableInterrupts_CALLBACK FAS_DisableInterrupts_CallbackFunctionPointer;
+  int FAS_DisableInterrupts_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FAS_DisableInterrupts_CallInstance;
+  char fas_storeAssertLoc_IgnoreBool;
+  char fas_storeAssertLoc_CallbackBool;
+  CMOCK_fas_storeAssertLoc_CALLBACK fas_storeAssertLoc_CallbackFunctionPointer;
+  int fas_storeAssertLoc_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE fas_storeAssertLoc_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockfassert_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.FAS_DisableInterrupts_CallInstance;
+  if (Mock.FAS_DisableInterrupts_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FAS_DisableInterrupts);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FAS_DisableInterrupts_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.fas_storeAssertLoc_CallInstance;
+  if (Mock.fas_storeAssertLoc_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_fas_storeAssertLoc);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.fas_storeAssertLoc_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockfassert_Init(void)
+{
+  Mockfassert_Destroy();
+}
+
+void Mockfassert_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void FAS_DisableInterrupts(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FAS_DisableInterrupts_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FAS_DisableInterrupts);
+  cmock_call_instance = (CMOCK_FAS_DisableInterrupts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FAS_DisableInterrupts_CallInstance);
+  Mock.FAS_DisableInterrupts_CallInstance = CMock_Guts_MemNext(Mock.FAS_DisableInterrupts_CallInstance);
+  if (Mock.FAS_DisableInterrupts_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.FAS_DisableInterrupts_CallbackBool &&
+      Mock.FAS_DisableInterrupts_CallbackFunctionPointer != NULL)
+  {
+    Mock.FAS_DisableInterrupts_CallbackFunctionPointer(Mock.FAS_DisableInterrupts_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.FAS_DisableInterrupts_CallbackFunctionPointer != NULL)
+  {
+    Mock.FAS_DisableInterrupts_CallbackFunctionPointer(Mock.FAS_DisableInterrupts_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void FAS_DisableInterrupts_CMockIgnore(void)
+{
+  Mock.FAS_DisableInterrupts_IgnoreBool = (char)1;
+}
+
+void FAS_DisableInterrupts_CMockStopIgnore(void)
+{
+  Mock.FAS_DisableInterrupts_IgnoreBool = (char)0;
+}
+
+void FAS_DisableInterrupts_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FAS_DisableInterrupts_CALL_INSTANCE));
+  CMOCK_FAS_DisableInterrupts_CALL_INSTANCE* cmock_call_instance = (CMOCK_FAS_DisableInterrupts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FAS_DisableInterrupts_CallInstance = CMock_Guts_MemChain(Mock.FAS_DisableInterrupts_CallInstance, cmock_guts_index);
+  Mock.FAS_DisableInterrupts_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void FAS_DisableInterrupts_AddCallback(CMOCK_FAS_DisableInterrupts_CALLBACK Callback)
+{
+  Mock.FAS_DisableInterrupts_IgnoreBool = (char)0;
+  Mock.FAS_DisableInterrupts_CallbackBool = (char)1;
+  Mock.FAS_DisableInterrupts_CallbackFunctionPointer = Callback;
+}
+
+void FAS_DisableInterrupts_Stub(CMOCK_FAS_DisableInterrupts_CALLBACK Callback)
+{
+  Mock.FAS_DisableInterrupts_IgnoreBool = (char)0;
+  Mock.FAS_DisableInterrupts_CallbackBool = (char)0;
+  Mock.FAS_DisableInterrupts_CallbackFunctionPointer = Callback;
+}
+
+void FAS_DisableInterrupts_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FAS_DisableInterrupts_CALL_INSTANCE));
+  CMOCK_FAS_DisableInterrupts_CALL_INSTANCE* cmock_call_instance = (CMOCK_FAS_DisableInterrupts_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FAS_DisableInterrupts_CallInstance = CMock_Guts_MemChain(Mock.FAS_DisableInterrupts_CallInstance, cmock_guts_index);
+  Mock.FAS_DisableInterrupts_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void fas_storeAssertLoc(uint32_t* pc, uint32_t line)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_fas_storeAssertLoc_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_fas_storeAssertLoc);
+  cmock_call_instance = (CMOCK_fas_storeAssertLoc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.fas_storeAssertLoc_CallInstance);
+  Mock.fas_storeAssertLoc_CallInstance = CMock_Guts_MemNext(Mock.fas_storeAssertLoc_CallInstance);
+  if (Mock.fas_storeAssertLoc_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.fas_storeAssertLoc_CallbackBool &&
+      Mock.fas_storeAssertLoc_CallbackFunctionPointer != NULL)
+  {
+    Mock.fas_storeAssertLoc_CallbackFunctionPointer(pc, line, Mock.fas_storeAssertLoc_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pc)
+  {
+    UNITY_SET_DETAILS(CMockString_fas_storeAssertLoc,CMockString_pc);
+    if (cmock_call_instance->Expected_pc == NULL)
+      { UNITY_TEST_ASSERT_NULL(pc, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pc, pc, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_line)
+  {
+    UNITY_SET_DETAILS(CMockString_fas_storeAssertLoc,CMockString_line);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_line, line, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.fas_storeAssertLoc_CallbackFunctionPointer != NULL)
+  {
+    Mock.fas_storeAssertLoc_CallbackFunctionPointer(pc, line, Mock.fas_storeAssertLoc_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pc_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pc, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pc, (void*)cmock_call_instance->ReturnThruPtr_pc_Val,
+      cmock_call_instance->ReturnThruPtr_pc_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_fas_storeAssertLoc(CMOCK_fas_storeAssertLoc_CALL_INSTANCE* cmock_call_instance, uint32_t* pc, uint32_t line);
+void CMockExpectParameters_fas_storeAssertLoc(CMOCK_fas_storeAssertLoc_CALL_INSTANCE* cmock_call_instance, uint32_t* pc, uint32_t line)
+{
+  cmock_call_instance->Expected_pc = pc;
+  cmock_call_instance->IgnoreArg_pc = 0;
+  cmock_call_instance->ReturnThruPtr_pc_Used = 0;
+  cmock_call_instance->Expected_line = line;
+  cmock_call_instance->IgnoreArg_line = 0;
+}
+
+void fas_storeAssertLoc_CMockIgnore(void)
+{
+  Mock.fas_storeAssertLoc_IgnoreBool = (char)1;
+}
+
+void fas_storeAssertLoc_CMockStopIgnore(void)
+{
+  Mock.fas_storeAssertLoc_IgnoreBool = (char)0;
+}
+
+void fas_storeAssertLoc_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t* pc, uint32_t line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_fas_storeAssertLoc_CALL_INSTANCE));
+  CMOCK_fas_storeAssertLoc_CALL_INSTANCE* cmock_call_instance = (CMOCK_fas_storeAssertLoc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.fas_storeAssertLoc_CallInstance = CMock_Guts_MemChain(Mock.fas_storeAssertLoc_CallInstance, cmock_guts_index);
+  Mock.fas_storeAssertLoc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_fas_storeAssertLoc(cmock_call_instance, pc, line);
+}
+
+void fas_storeAssertLoc_AddCallback(CMOCK_fas_storeAssertLoc_CALLBACK Callback)
+{
+  Mock.fas_storeAssertLoc_IgnoreBool = (char)0;
+  Mock.fas_storeAssertLoc_CallbackBool = (char)1;
+  Mock.fas_storeAssertLoc_CallbackFunctionPointer = Callback;
+}
+
+void fas_storeAssertLoc_Stub(CMOCK_fas_storeAssertLoc_CALLBACK Callback)
+{
+  Mock.fas_storeAssertLoc_IgnoreBool = (char)0;
+  Mock.fas_storeAssertLoc_CallbackBool = (char)0;
+  Mock.fas_storeAssertLoc_CallbackFunctionPointer = Callback;
+}
+
+void fas_storeAssertLoc_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t* pc, uint32_t line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_fas_storeAssertLoc_CALL_INSTANCE));
+  CMOCK_fas_storeAssertLoc_CALL_INSTANCE* cmock_call_instance = (CMOCK_fas_storeAssertLoc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.fas_storeAssertLoc_CallInstance = CMock_Guts_MemChain(Mock.fas_storeAssertLoc_CallInstance, cmock_guts_index);
+  Mock.fas_storeAssertLoc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_fas_storeAssertLoc(cmock_call_instance, pc, line);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void fas_storeAssertLoc_CMockReturnMemThruPtr_pc(UNITY_LINE_TYPE cmock_line, uint32_t* pc, size_t cmock_size)
+{
+  CMOCK_fas_storeAssertLoc_CALL_INSTANCE* cmock_call_instance = (CMOCK_fas_storeAssertLoc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.fas_storeAssertLoc_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pc_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pc_Val = pc;
+  cmock_call_instance->ReturnThruPtr_pc_Size = cmock_size;
+}
+
+void fas_storeAssertLoc_CMockIgnoreArg_pc(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_fas_storeAssertLoc_CALL_INSTANCE* cmock_call_instance = (CMOCK_fas_storeAssertLoc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.fas_storeAssertLoc_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pc = 1;
+}
+
+void fas_storeAssertLoc_CMockIgnoreArg_line(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_fas_storeAssertLoc_CALL_INSTANCE* cmock_call_instance = (CMOCK_fas_storeAssertLoc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.fas_storeAssertLoc_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_line = 1;
+}
+
@@ -0,0 +1,78 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKFASSERT_H
+#define _MOCKFASSERT_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "fassert.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockfassert_Init(void);
+void Mockfassert_Destroy(void);
+void Mockfassert_Verify(void);
+
+
+
+
+#define FAS_DisableInterrupts_Ignore() FAS_DisableInterrupts_CMockIgnore()
+void FAS_DisableInterrupts_CMockIgnore(void);
+#define FAS_DisableInterrupts_StopIgnore() FAS_DisableInterrupts_CMockStopIgnore()
+void FAS_DisableInterrupts_CMockStopIgnore(void);
+#define FAS_DisableInterrupts_Expect() FAS_DisableInterrupts_CMockExpect(__LINE__)
+void FAS_DisableInterrupts_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_FAS_DisableInterrupts_CALLBACK)(int cmock_num_calls);
+void FAS_DisableInterrupts_AddCallback(CMOCK_FAS_DisableInterrupts_CALLBACK Callback);
+void FAS_DisableInterrupts_Stub(CMOCK_FAS_DisableInterrupts_CALLBACK Callback);
+#define FAS_DisableInterrupts_StubWithCallback FAS_DisableInterrupts_Stub
+#define FAS_DisableInterrupts_ExpectAndThrow(cmock_to_throw) FAS_DisableInterrupts_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void FAS_DisableInterrupts_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define fas_storeAssertLoc_Ignore() fas_storeAssertLoc_CMockIgnore()
+void fas_storeAssertLoc_CMockIgnore(void);
+#define fas_storeAssertLoc_StopIgnore() fas_storeAssertLoc_CMockStopIgnore()
+void fas_storeAssertLoc_CMockStopIgnore(void);
+#define fas_storeAssertLoc_Expect(pc, line) fas_storeAssertLoc_CMockExpect(__LINE__, pc, line)
+void fas_storeAssertLoc_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t* pc, uint32_t line);
+typedef void (* CMOCK_fas_storeAssertLoc_CALLBACK)(uint32_t* pc, uint32_t line, int cmock_num_calls);
+void fas_storeAssertLoc_AddCallback(CMOCK_fas_storeAssertLoc_CALLBACK Callback);
+void fas_storeAssertLoc_Stub(CMOCK_fas_storeAssertLoc_CALLBACK Callback);
+#define fas_storeAssertLoc_StubWithCallback fas_storeAssertLoc_Stub
+#define fas_storeAssertLoc_ExpectAndThrow(pc, line, cmock_to_throw) fas_storeAssertLoc_CMockExpectAndThrow(__LINE__, pc, line, cmock_to_throw)
+void fas_storeAssertLoc_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t* pc, uint32_t line, CEXCEPTION_T cmock_to_throw);
+#define fas_storeAssertLoc_ReturnThruPtr_pc(pc) fas_storeAssertLoc_CMockReturnMemThruPtr_pc(__LINE__, pc, sizeof(uint32_t))
+#define fas_storeAssertLoc_ReturnArrayThruPtr_pc(pc, cmock_len) fas_storeAssertLoc_CMockReturnMemThruPtr_pc(__LINE__, pc, cmock_len * sizeof(*pc))
+#define fas_storeAssertLoc_ReturnMemThruPtr_pc(pc, cmock_size) fas_storeAssertLoc_CMockReturnMemThruPtr_pc(__LINE__, pc, cmock_size)
+void fas_storeAssertLoc_CMockReturnMemThruPtr_pc(UNITY_LINE_TYPE cmock_line, uint32_t* pc, size_t cmock_size);
+#define fas_storeAssertLoc_IgnoreArg_pc() fas_storeAssertLoc_CMockIgnoreArg_pc(__LINE__)
+void fas_storeAssertLoc_CMockIgnoreArg_pc(UNITY_LINE_TYPE cmock_line);
+#define fas_storeAssertLoc_IgnoreArg_line() fas_storeAssertLoc_CMockIgnoreArg_line(__LINE__)
+void fas_storeAssertLoc_CMockIgnoreArg_line(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
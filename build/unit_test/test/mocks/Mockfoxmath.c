@@ -0,0 +1,1222 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockfoxmath.h"
+
+static const char* CMockString_MATH_AbsInt32 = "MATH_AbsInt32";
+static const char* CMockString_MATH_AbsInt64 = "MATH_AbsInt64";
+static const char* CMockString_MATH_linearInterpolation = "MATH_linearInterpolation";
+static const char* CMockString_MATH_minimumOfTwoFloats = "MATH_minimumOfTwoFloats";
+static const char* CMockString_MATH_swapBytes_uint16_t = "MATH_swapBytes_uint16_t";
+static const char* CMockString_MATH_swapBytes_uint32_t = "MATH_swapBytes_uint32_t";
+static const char* CMockString_MATH_swapBytes_uint64_t = "MATH_swapBytes_uint64_t";
+static const char* CMockString_val = "val";
+static const char* CMockString_value = "value";
+static const char* CMockString_value1 = "value1";
+static const char* CMockString_value2 = "value2";
+static const char* CMockString_x1 = "x1";
+static const char* CMockString_x2 = "x2";
+static const char* CMockString_x_interpolate = "x_interpolate";
+static const char* CMockString_y1 = "y1";
+static const char* CMockString_y2 = "y2";
+
+typedef struct _CMOCK_MATH_linearInterpolation_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  float ReturnVal;
+  int CallOrder;
+  float Expected_x1;
+  float Expected_y1;
+  float Expected_x2;
+  float Expected_y2;
+  float Expected_x_interpolate;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_x1;
+  char IgnoreArg_y1;
+  char IgnoreArg_x2;
+  char IgnoreArg_y2;
+  char IgnoreArg_x_interpolate;
+
+} CMOCK_MATH_linearInterpolation_CALL_INSTANCE;
+
+typedef struct _CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint16_t ReturnVal;
+  int CallOrder;
+  uint16_t Expected_val;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_val;
+
+} CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE;
+
+typedef struct _CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_val;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_val;
+
+} CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE;
+
+typedef struct _CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint64_t ReturnVal;
+  int CallOrder;
+  uint64_t Expected_val;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_val;
+
+} CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE;
+
+typedef struct _CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  float ReturnVal;
+  int CallOrder;
+  float Expected_value1;
+  float Expected_value2;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_value1;
+  char IgnoreArg_value2;
+
+} CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE;
+
+typedef struct _CMOCK_MATH_AbsInt32_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int32_t ReturnVal;
+  int CallOrder;
+  int32_t Expected_value;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_value;
+
+} CMOCK_MATH_AbsInt32_CALL_INSTANCE;
+
+typedef struct _CMOCK_MATH_AbsInt64_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int64_t ReturnVal;
+  int CallOrder;
+  int64_t Expected_value;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_value;
+
+} CMOCK_MATH_AbsInt64_CALL_INSTANCE;
+
+static struct MockfoxmathInstance
+{
+  char MATH_linearInterpolation_IgnoreBool;
+  float MATH_linearInterpolation_FinalReturn;
+  char MATH_linearInterpolation_CallbackBool;
+  CMOCK_MATH_linearInterpolation_CALLBACK MATH_linearInterpolation_CallbackFunctionPointer;
+  int MATH_linearInterpolation_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MATH_linearInterpolation_CallInstance;
+  char MATH_swapBytes_uint16_t_IgnoreBool;
+  uint16_t MATH_swapBytes_uint16_t_FinalReturn;
+  char MATH_swapBytes_uint16_t_CallbackBool;
+  CMOCK_MATH_swapBytes_uint16_t_CALLBACK MATH_swapBytes_uint16_t_CallbackFunctionPointer;
+  int MATH_swapBytes_uint16_t_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MATH_swapBytes_uint16_t_CallInstance;
+  char MATH_swapBytes_uint32_t_IgnoreBool;
+  uint32_t MATH_swapBytes_uint32_t_FinalReturn;
+  char MATH_swapBytes_uint32_t_CallbackBool;
+  CMOCK_MATH_swapBytes_uint32_t_CALLBACK MATH_swapBytes_uint32_t_CallbackFunctionPointer;
+  int MATH_swapBytes_uint32_t_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MATH_swapBytes_uint32_t_CallInstance;
+  char MATH_swapBytes_uint64_t_IgnoreBool;
+  uint64_t MATH_swapBytes_uint64_t_FinalReturn;
+  char MATH_swapBytes_uint64_t_CallbackBool;
+  CMOCK_MATH_swapBytes_uint64_t_CALLBACK MATH_swapBytes_uint64_t_CallbackFunctionPointer;
+  int MATH_swapBytes_uint64_t_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MATH_swapBytes_uint64_t_CallInstance;
+  char MATH_minimumOfTwoFloats_IgnoreBool;
+  float MATH_minimumOfTwoFloats_FinalReturn;
+  char MATH_minimumOfTwoFloats_CallbackBool;
+  CMOCK_MATH_minimumOfTwoFloats_CALLBACK MATH_minimumOfTwoFloats_CallbackFunctionPointer;
+  int MATH_minimumOfTwoFloats_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MATH_minimumOfTwoFloats_CallInstance;
+  char MATH_AbsInt32_IgnoreBool;
+  int32_t MATH_AbsInt32_FinalReturn;
+  char MATH_AbsInt32_CallbackBool;
+  CMOCK_MATH_AbsInt32_CALLBACK MATH_AbsInt32_CallbackFunctionPointer;
+  int MATH_AbsInt32_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MATH_AbsInt32_CallInstance;
+  char MATH_AbsInt64_IgnoreBool;
+  int64_t MATH_AbsInt64_FinalReturn;
+  char MATH_AbsInt64_CallbackBool;
+  CMOCK_MATH_AbsInt64_CALLBACK MATH_AbsInt64_CallbackFunctionPointer;
+  int MATH_AbsInt64_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MATH_AbsInt64_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockfoxmath_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.MATH_linearInterpolation_CallInstance;
+  if (Mock.MATH_linearInterpolation_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MATH_linearInterpolation);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MATH_linearInterpolation_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MATH_swapBytes_uint16_t_CallInstance;
+  if (Mock.MATH_swapBytes_uint16_t_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MATH_swapBytes_uint16_t);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MATH_swapBytes_uint16_t_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MATH_swapBytes_uint32_t_CallInstance;
+  if (Mock.MATH_swapBytes_uint32_t_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MATH_swapBytes_uint32_t);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MATH_swapBytes_uint32_t_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MATH_swapBytes_uint64_t_CallInstance;
+  if (Mock.MATH_swapBytes_uint64_t_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MATH_swapBytes_uint64_t);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MATH_swapBytes_uint64_t_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MATH_minimumOfTwoFloats_CallInstance;
+  if (Mock.MATH_minimumOfTwoFloats_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MATH_minimumOfTwoFloats);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MATH_minimumOfTwoFloats_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MATH_AbsInt32_CallInstance;
+  if (Mock.MATH_AbsInt32_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MATH_AbsInt32);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MATH_AbsInt32_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MATH_AbsInt64_CallInstance;
+  if (Mock.MATH_AbsInt64_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MATH_AbsInt64);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MATH_AbsInt64_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockfoxmath_Init(void)
+{
+  Mockfoxmath_Destroy();
+}
+
+void Mockfoxmath_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+float MATH_linearInterpolation(float x1, float y1, float x2, float y2, float x_interpolate)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MATH_linearInterpolation);
+  cmock_call_instance = (CMOCK_MATH_linearInterpolation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MATH_linearInterpolation_CallInstance);
+  Mock.MATH_linearInterpolation_CallInstance = CMock_Guts_MemNext(Mock.MATH_linearInterpolation_CallInstance);
+  if (Mock.MATH_linearInterpolation_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MATH_linearInterpolation_FinalReturn;
+    Mock.MATH_linearInterpolation_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MATH_linearInterpolation_CallbackBool &&
+      Mock.MATH_linearInterpolation_CallbackFunctionPointer != NULL)
+  {
+    float cmock_cb_ret = Mock.MATH_linearInterpolation_CallbackFunctionPointer(x1, y1, x2, y2, x_interpolate, Mock.MATH_linearInterpolation_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_x1)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_linearInterpolation,CMockString_x1);
+    UNITY_TEST_ASSERT_EQUAL_FLOAT(cmock_call_instance->Expected_x1, x1, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_y1)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_linearInterpolation,CMockString_y1);
+    UNITY_TEST_ASSERT_EQUAL_FLOAT(cmock_call_instance->Expected_y1, y1, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_x2)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_linearInterpolation,CMockString_x2);
+    UNITY_TEST_ASSERT_EQUAL_FLOAT(cmock_call_instance->Expected_x2, x2, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_y2)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_linearInterpolation,CMockString_y2);
+    UNITY_TEST_ASSERT_EQUAL_FLOAT(cmock_call_instance->Expected_y2, y2, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_x_interpolate)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_linearInterpolation,CMockString_x_interpolate);
+    UNITY_TEST_ASSERT_EQUAL_FLOAT(cmock_call_instance->Expected_x_interpolate, x_interpolate, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MATH_linearInterpolation_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MATH_linearInterpolation_CallbackFunctionPointer(x1, y1, x2, y2, x_interpolate, Mock.MATH_linearInterpolation_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MATH_linearInterpolation(CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance, float x1, float y1, float x2, float y2, float x_interpolate);
+void CMockExpectParameters_MATH_linearInterpolation(CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance, float x1, float y1, float x2, float y2, float x_interpolate)
+{
+  cmock_call_instance->Expected_x1 = x1;
+  cmock_call_instance->IgnoreArg_x1 = 0;
+  cmock_call_instance->Expected_y1 = y1;
+  cmock_call_instance->IgnoreArg_y1 = 0;
+  cmock_call_instance->Expected_x2 = x2;
+  cmock_call_instance->IgnoreArg_x2 = 0;
+  cmock_call_instance->Expected_y2 = y2;
+  cmock_call_instance->IgnoreArg_y2 = 0;
+  cmock_call_instance->Expected_x_interpolate = x_interpolate;
+  cmock_call_instance->IgnoreArg_x_interpolate = 0;
+}
+
+void MATH_linearInterpolation_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, float cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_linearInterpolation_CALL_INSTANCE));
+  CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_linearInterpolation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_linearInterpolation_CallInstance = CMock_Guts_MemChain(Mock.MATH_linearInterpolation_CallInstance, cmock_guts_index);
+  Mock.MATH_linearInterpolation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MATH_linearInterpolation_IgnoreBool = (char)1;
+}
+
+void MATH_linearInterpolation_CMockStopIgnore(void)
+{
+  if(Mock.MATH_linearInterpolation_IgnoreBool)
+    Mock.MATH_linearInterpolation_CallInstance = CMock_Guts_MemNext(Mock.MATH_linearInterpolation_CallInstance);
+  Mock.MATH_linearInterpolation_IgnoreBool = (char)0;
+}
+
+void MATH_linearInterpolation_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, float x1, float y1, float x2, float y2, float x_interpolate, float cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_linearInterpolation_CALL_INSTANCE));
+  CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_linearInterpolation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_linearInterpolation_CallInstance = CMock_Guts_MemChain(Mock.MATH_linearInterpolation_CallInstance, cmock_guts_index);
+  Mock.MATH_linearInterpolation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_linearInterpolation(cmock_call_instance, x1, y1, x2, y2, x_interpolate);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void MATH_linearInterpolation_AddCallback(CMOCK_MATH_linearInterpolation_CALLBACK Callback)
+{
+  Mock.MATH_linearInterpolation_IgnoreBool = (char)0;
+  Mock.MATH_linearInterpolation_CallbackBool = (char)1;
+  Mock.MATH_linearInterpolation_CallbackFunctionPointer = Callback;
+}
+
+void MATH_linearInterpolation_Stub(CMOCK_MATH_linearInterpolation_CALLBACK Callback)
+{
+  Mock.MATH_linearInterpolation_IgnoreBool = (char)0;
+  Mock.MATH_linearInterpolation_CallbackBool = (char)0;
+  Mock.MATH_linearInterpolation_CallbackFunctionPointer = Callback;
+}
+
+void MATH_linearInterpolation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, float x1, float y1, float x2, float y2, float x_interpolate, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_linearInterpolation_CALL_INSTANCE));
+  CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_linearInterpolation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_linearInterpolation_CallInstance = CMock_Guts_MemChain(Mock.MATH_linearInterpolation_CallInstance, cmock_guts_index);
+  Mock.MATH_linearInterpolation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_linearInterpolation(cmock_call_instance, x1, y1, x2, y2, x_interpolate);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MATH_linearInterpolation_CMockIgnoreArg_x1(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_linearInterpolation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_linearInterpolation_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_x1 = 1;
+}
+
+void MATH_linearInterpolation_CMockIgnoreArg_y1(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_linearInterpolation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_linearInterpolation_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_y1 = 1;
+}
+
+void MATH_linearInterpolation_CMockIgnoreArg_x2(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_linearInterpolation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_linearInterpolation_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_x2 = 1;
+}
+
+void MATH_linearInterpolation_CMockIgnoreArg_y2(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_linearInterpolation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_linearInterpolation_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_y2 = 1;
+}
+
+void MATH_linearInterpolation_CMockIgnoreArg_x_interpolate(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_linearInterpolation_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_linearInterpolation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_linearInterpolation_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_x_interpolate = 1;
+}
+
+uint16_t MATH_swapBytes_uint16_t(uint16_t val)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MATH_swapBytes_uint16_t);
+  cmock_call_instance = (CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MATH_swapBytes_uint16_t_CallInstance);
+  Mock.MATH_swapBytes_uint16_t_CallInstance = CMock_Guts_MemNext(Mock.MATH_swapBytes_uint16_t_CallInstance);
+  if (Mock.MATH_swapBytes_uint16_t_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MATH_swapBytes_uint16_t_FinalReturn;
+    Mock.MATH_swapBytes_uint16_t_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MATH_swapBytes_uint16_t_CallbackBool &&
+      Mock.MATH_swapBytes_uint16_t_CallbackFunctionPointer != NULL)
+  {
+    uint16_t cmock_cb_ret = Mock.MATH_swapBytes_uint16_t_CallbackFunctionPointer(val, Mock.MATH_swapBytes_uint16_t_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_val)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_swapBytes_uint16_t,CMockString_val);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_val, val, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MATH_swapBytes_uint16_t_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MATH_swapBytes_uint16_t_CallbackFunctionPointer(val, Mock.MATH_swapBytes_uint16_t_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MATH_swapBytes_uint16_t(CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE* cmock_call_instance, uint16_t val);
+void CMockExpectParameters_MATH_swapBytes_uint16_t(CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE* cmock_call_instance, uint16_t val)
+{
+  cmock_call_instance->Expected_val = val;
+  cmock_call_instance->IgnoreArg_val = 0;
+}
+
+void MATH_swapBytes_uint16_t_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE));
+  CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_swapBytes_uint16_t_CallInstance = CMock_Guts_MemChain(Mock.MATH_swapBytes_uint16_t_CallInstance, cmock_guts_index);
+  Mock.MATH_swapBytes_uint16_t_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MATH_swapBytes_uint16_t_IgnoreBool = (char)1;
+}
+
+void MATH_swapBytes_uint16_t_CMockStopIgnore(void)
+{
+  if(Mock.MATH_swapBytes_uint16_t_IgnoreBool)
+    Mock.MATH_swapBytes_uint16_t_CallInstance = CMock_Guts_MemNext(Mock.MATH_swapBytes_uint16_t_CallInstance);
+  Mock.MATH_swapBytes_uint16_t_IgnoreBool = (char)0;
+}
+
+void MATH_swapBytes_uint16_t_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t val, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE));
+  CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_swapBytes_uint16_t_CallInstance = CMock_Guts_MemChain(Mock.MATH_swapBytes_uint16_t_CallInstance, cmock_guts_index);
+  Mock.MATH_swapBytes_uint16_t_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_swapBytes_uint16_t(cmock_call_instance, val);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void MATH_swapBytes_uint16_t_AddCallback(CMOCK_MATH_swapBytes_uint16_t_CALLBACK Callback)
+{
+  Mock.MATH_swapBytes_uint16_t_IgnoreBool = (char)0;
+  Mock.MATH_swapBytes_uint16_t_CallbackBool = (char)1;
+  Mock.MATH_swapBytes_uint16_t_CallbackFunctionPointer = Callback;
+}
+
+void MATH_swapBytes_uint16_t_Stub(CMOCK_MATH_swapBytes_uint16_t_CALLBACK Callback)
+{
+  Mock.MATH_swapBytes_uint16_t_IgnoreBool = (char)0;
+  Mock.MATH_swapBytes_uint16_t_CallbackBool = (char)0;
+  Mock.MATH_swapBytes_uint16_t_CallbackFunctionPointer = Callback;
+}
+
+void MATH_swapBytes_uint16_t_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t val, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE));
+  CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_swapBytes_uint16_t_CallInstance = CMock_Guts_MemChain(Mock.MATH_swapBytes_uint16_t_CallInstance, cmock_guts_index);
+  Mock.MATH_swapBytes_uint16_t_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_swapBytes_uint16_t(cmock_call_instance, val);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MATH_swapBytes_uint16_t_CMockIgnoreArg_val(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint16_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_swapBytes_uint16_t_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_val = 1;
+}
+
+uint32_t MATH_swapBytes_uint32_t(uint32_t val)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MATH_swapBytes_uint32_t);
+  cmock_call_instance = (CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MATH_swapBytes_uint32_t_CallInstance);
+  Mock.MATH_swapBytes_uint32_t_CallInstance = CMock_Guts_MemNext(Mock.MATH_swapBytes_uint32_t_CallInstance);
+  if (Mock.MATH_swapBytes_uint32_t_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MATH_swapBytes_uint32_t_FinalReturn;
+    Mock.MATH_swapBytes_uint32_t_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MATH_swapBytes_uint32_t_CallbackBool &&
+      Mock.MATH_swapBytes_uint32_t_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.MATH_swapBytes_uint32_t_CallbackFunctionPointer(val, Mock.MATH_swapBytes_uint32_t_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_val)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_swapBytes_uint32_t,CMockString_val);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_val, val, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MATH_swapBytes_uint32_t_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MATH_swapBytes_uint32_t_CallbackFunctionPointer(val, Mock.MATH_swapBytes_uint32_t_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MATH_swapBytes_uint32_t(CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE* cmock_call_instance, uint32_t val);
+void CMockExpectParameters_MATH_swapBytes_uint32_t(CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE* cmock_call_instance, uint32_t val)
+{
+  cmock_call_instance->Expected_val = val;
+  cmock_call_instance->IgnoreArg_val = 0;
+}
+
+void MATH_swapBytes_uint32_t_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE));
+  CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_swapBytes_uint32_t_CallInstance = CMock_Guts_MemChain(Mock.MATH_swapBytes_uint32_t_CallInstance, cmock_guts_index);
+  Mock.MATH_swapBytes_uint32_t_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MATH_swapBytes_uint32_t_IgnoreBool = (char)1;
+}
+
+void MATH_swapBytes_uint32_t_CMockStopIgnore(void)
+{
+  if(Mock.MATH_swapBytes_uint32_t_IgnoreBool)
+    Mock.MATH_swapBytes_uint32_t_CallInstance = CMock_Guts_MemNext(Mock.MATH_swapBytes_uint32_t_CallInstance);
+  Mock.MATH_swapBytes_uint32_t_IgnoreBool = (char)0;
+}
+
+void MATH_swapBytes_uint32_t_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t val, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE));
+  CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_swapBytes_uint32_t_CallInstance = CMock_Guts_MemChain(Mock.MATH_swapBytes_uint32_t_CallInstance, cmock_guts_index);
+  Mock.MATH_swapBytes_uint32_t_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_swapBytes_uint32_t(cmock_call_instance, val);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void MATH_swapBytes_uint32_t_AddCallback(CMOCK_MATH_swapBytes_uint32_t_CALLBACK Callback)
+{
+  Mock.MATH_swapBytes_uint32_t_IgnoreBool = (char)0;
+  Mock.MATH_swapBytes_uint32_t_CallbackBool = (char)1;
+  Mock.MATH_swapBytes_uint32_t_CallbackFunctionPointer = Callback;
+}
+
+void MATH_swapBytes_uint32_t_Stub(CMOCK_MATH_swapBytes_uint32_t_CALLBACK Callback)
+{
+  Mock.MATH_swapBytes_uint32_t_IgnoreBool = (char)0;
+  Mock.MATH_swapBytes_uint32_t_CallbackBool = (char)0;
+  Mock.MATH_swapBytes_uint32_t_CallbackFunctionPointer = Callback;
+}
+
+void MATH_swapBytes_uint32_t_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t val, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE));
+  CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_swapBytes_uint32_t_CallInstance = CMock_Guts_MemChain(Mock.MATH_swapBytes_uint32_t_CallInstance, cmock_guts_index);
+  Mock.MATH_swapBytes_uint32_t_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_swapBytes_uint32_t(cmock_call_instance, val);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MATH_swapBytes_uint32_t_CMockIgnoreArg_val(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint32_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_swapBytes_uint32_t_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_val = 1;
+}
+
+uint64_t MATH_swapBytes_uint64_t(uint64_t val)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MATH_swapBytes_uint64_t);
+  cmock_call_instance = (CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MATH_swapBytes_uint64_t_CallInstance);
+  Mock.MATH_swapBytes_uint64_t_CallInstance = CMock_Guts_MemNext(Mock.MATH_swapBytes_uint64_t_CallInstance);
+  if (Mock.MATH_swapBytes_uint64_t_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MATH_swapBytes_uint64_t_FinalReturn;
+    memcpy((void*)(&Mock.MATH_swapBytes_uint64_t_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(uint64_t[sizeof(cmock_call_instance->ReturnVal) == sizeof(uint64_t) ? 1 : -1])); /* add uint64_t to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MATH_swapBytes_uint64_t_CallbackBool &&
+      Mock.MATH_swapBytes_uint64_t_CallbackFunctionPointer != NULL)
+  {
+    uint64_t cmock_cb_ret = Mock.MATH_swapBytes_uint64_t_CallbackFunctionPointer(val, Mock.MATH_swapBytes_uint64_t_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_val)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_swapBytes_uint64_t,CMockString_val);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_val), (void*)(&val), sizeof(uint64_t), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MATH_swapBytes_uint64_t_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MATH_swapBytes_uint64_t_CallbackFunctionPointer(val, Mock.MATH_swapBytes_uint64_t_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MATH_swapBytes_uint64_t(CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE* cmock_call_instance, uint64_t val);
+void CMockExpectParameters_MATH_swapBytes_uint64_t(CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE* cmock_call_instance, uint64_t val)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_val), (void*)(&val),
+         sizeof(uint64_t[sizeof(val) == sizeof(uint64_t) ? 1 : -1])); /* add uint64_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_val = 0;
+}
+
+void MATH_swapBytes_uint64_t_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE));
+  CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_swapBytes_uint64_t_CallInstance = CMock_Guts_MemChain(Mock.MATH_swapBytes_uint64_t_CallInstance, cmock_guts_index);
+  Mock.MATH_swapBytes_uint64_t_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MATH_swapBytes_uint64_t_IgnoreBool = (char)1;
+}
+
+void MATH_swapBytes_uint64_t_CMockStopIgnore(void)
+{
+  if(Mock.MATH_swapBytes_uint64_t_IgnoreBool)
+    Mock.MATH_swapBytes_uint64_t_CallInstance = CMock_Guts_MemNext(Mock.MATH_swapBytes_uint64_t_CallInstance);
+  Mock.MATH_swapBytes_uint64_t_IgnoreBool = (char)0;
+}
+
+void MATH_swapBytes_uint64_t_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t val, uint64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE));
+  CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_swapBytes_uint64_t_CallInstance = CMock_Guts_MemChain(Mock.MATH_swapBytes_uint64_t_CallInstance, cmock_guts_index);
+  Mock.MATH_swapBytes_uint64_t_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_swapBytes_uint64_t(cmock_call_instance, val);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(uint64_t[sizeof(cmock_to_return) == sizeof(uint64_t) ? 1 : -1])); /* add uint64_t to :treat_as_array if this causes an error */
+}
+
+void MATH_swapBytes_uint64_t_AddCallback(CMOCK_MATH_swapBytes_uint64_t_CALLBACK Callback)
+{
+  Mock.MATH_swapBytes_uint64_t_IgnoreBool = (char)0;
+  Mock.MATH_swapBytes_uint64_t_CallbackBool = (char)1;
+  Mock.MATH_swapBytes_uint64_t_CallbackFunctionPointer = Callback;
+}
+
+void MATH_swapBytes_uint64_t_Stub(CMOCK_MATH_swapBytes_uint64_t_CALLBACK Callback)
+{
+  Mock.MATH_swapBytes_uint64_t_IgnoreBool = (char)0;
+  Mock.MATH_swapBytes_uint64_t_CallbackBool = (char)0;
+  Mock.MATH_swapBytes_uint64_t_CallbackFunctionPointer = Callback;
+}
+
+void MATH_swapBytes_uint64_t_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint64_t val, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE));
+  CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_swapBytes_uint64_t_CallInstance = CMock_Guts_MemChain(Mock.MATH_swapBytes_uint64_t_CallInstance, cmock_guts_index);
+  Mock.MATH_swapBytes_uint64_t_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_swapBytes_uint64_t(cmock_call_instance, val);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MATH_swapBytes_uint64_t_CMockIgnoreArg_val(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_swapBytes_uint64_t_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_swapBytes_uint64_t_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_val = 1;
+}
+
+float MATH_minimumOfTwoFloats(float value1, float value2)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MATH_minimumOfTwoFloats);
+  cmock_call_instance = (CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MATH_minimumOfTwoFloats_CallInstance);
+  Mock.MATH_minimumOfTwoFloats_CallInstance = CMock_Guts_MemNext(Mock.MATH_minimumOfTwoFloats_CallInstance);
+  if (Mock.MATH_minimumOfTwoFloats_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MATH_minimumOfTwoFloats_FinalReturn;
+    Mock.MATH_minimumOfTwoFloats_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MATH_minimumOfTwoFloats_CallbackBool &&
+      Mock.MATH_minimumOfTwoFloats_CallbackFunctionPointer != NULL)
+  {
+    float cmock_cb_ret = Mock.MATH_minimumOfTwoFloats_CallbackFunctionPointer(value1, value2, Mock.MATH_minimumOfTwoFloats_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_value1)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_minimumOfTwoFloats,CMockString_value1);
+    UNITY_TEST_ASSERT_EQUAL_FLOAT(cmock_call_instance->Expected_value1, value1, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_value2)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_minimumOfTwoFloats,CMockString_value2);
+    UNITY_TEST_ASSERT_EQUAL_FLOAT(cmock_call_instance->Expected_value2, value2, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MATH_minimumOfTwoFloats_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MATH_minimumOfTwoFloats_CallbackFunctionPointer(value1, value2, Mock.MATH_minimumOfTwoFloats_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MATH_minimumOfTwoFloats(CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE* cmock_call_instance, float value1, float value2);
+void CMockExpectParameters_MATH_minimumOfTwoFloats(CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE* cmock_call_instance, float value1, float value2)
+{
+  cmock_call_instance->Expected_value1 = value1;
+  cmock_call_instance->IgnoreArg_value1 = 0;
+  cmock_call_instance->Expected_value2 = value2;
+  cmock_call_instance->IgnoreArg_value2 = 0;
+}
+
+void MATH_minimumOfTwoFloats_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, float cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE));
+  CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_minimumOfTwoFloats_CallInstance = CMock_Guts_MemChain(Mock.MATH_minimumOfTwoFloats_CallInstance, cmock_guts_index);
+  Mock.MATH_minimumOfTwoFloats_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MATH_minimumOfTwoFloats_IgnoreBool = (char)1;
+}
+
+void MATH_minimumOfTwoFloats_CMockStopIgnore(void)
+{
+  if(Mock.MATH_minimumOfTwoFloats_IgnoreBool)
+    Mock.MATH_minimumOfTwoFloats_CallInstance = CMock_Guts_MemNext(Mock.MATH_minimumOfTwoFloats_CallInstance);
+  Mock.MATH_minimumOfTwoFloats_IgnoreBool = (char)0;
+}
+
+void MATH_minimumOfTwoFloats_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, float value1, float value2, float cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE));
+  CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_minimumOfTwoFloats_CallInstance = CMock_Guts_MemChain(Mock.MATH_minimumOfTwoFloats_CallInstance, cmock_guts_index);
+  Mock.MATH_minimumOfTwoFloats_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_minimumOfTwoFloats(cmock_call_instance, value1, value2);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void MATH_minimumOfTwoFloats_AddCallback(CMOCK_MATH_minimumOfTwoFloats_CALLBACK Callback)
+{
+  Mock.MATH_minimumOfTwoFloats_IgnoreBool = (char)0;
+  Mock.MATH_minimumOfTwoFloats_CallbackBool = (char)1;
+  Mock.MATH_minimumOfTwoFloats_CallbackFunctionPointer = Callback;
+}
+
+void MATH_minimumOfTwoFloats_Stub(CMOCK_MATH_minimumOfTwoFloats_CALLBACK Callback)
+{
+  Mock.MATH_minimumOfTwoFloats_IgnoreBool = (char)0;
+  Mock.MATH_minimumOfTwoFloats_CallbackBool = (char)0;
+  Mock.MATH_minimumOfTwoFloats_CallbackFunctionPointer = Callback;
+}
+
+void MATH_minimumOfTwoFloats_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, float value1, float value2, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE));
+  CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_minimumOfTwoFloats_CallInstance = CMock_Guts_MemChain(Mock.MATH_minimumOfTwoFloats_CallInstance, cmock_guts_index);
+  Mock.MATH_minimumOfTwoFloats_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_minimumOfTwoFloats(cmock_call_instance, value1, value2);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MATH_minimumOfTwoFloats_CMockIgnoreArg_value1(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_minimumOfTwoFloats_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_value1 = 1;
+}
+
+void MATH_minimumOfTwoFloats_CMockIgnoreArg_value2(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_minimumOfTwoFloats_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_minimumOfTwoFloats_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_value2 = 1;
+}
+
+int32_t MATH_AbsInt32(int32_t value)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MATH_AbsInt32_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MATH_AbsInt32);
+  cmock_call_instance = (CMOCK_MATH_AbsInt32_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MATH_AbsInt32_CallInstance);
+  Mock.MATH_AbsInt32_CallInstance = CMock_Guts_MemNext(Mock.MATH_AbsInt32_CallInstance);
+  if (Mock.MATH_AbsInt32_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MATH_AbsInt32_FinalReturn;
+    Mock.MATH_AbsInt32_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MATH_AbsInt32_CallbackBool &&
+      Mock.MATH_AbsInt32_CallbackFunctionPointer != NULL)
+  {
+    int32_t cmock_cb_ret = Mock.MATH_AbsInt32_CallbackFunctionPointer(value, Mock.MATH_AbsInt32_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_value)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_AbsInt32,CMockString_value);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_value, value, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MATH_AbsInt32_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MATH_AbsInt32_CallbackFunctionPointer(value, Mock.MATH_AbsInt32_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MATH_AbsInt32(CMOCK_MATH_AbsInt32_CALL_INSTANCE* cmock_call_instance, int32_t value);
+void CMockExpectParameters_MATH_AbsInt32(CMOCK_MATH_AbsInt32_CALL_INSTANCE* cmock_call_instance, int32_t value)
+{
+  cmock_call_instance->Expected_value = value;
+  cmock_call_instance->IgnoreArg_value = 0;
+}
+
+void MATH_AbsInt32_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_AbsInt32_CALL_INSTANCE));
+  CMOCK_MATH_AbsInt32_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_AbsInt32_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_AbsInt32_CallInstance = CMock_Guts_MemChain(Mock.MATH_AbsInt32_CallInstance, cmock_guts_index);
+  Mock.MATH_AbsInt32_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MATH_AbsInt32_IgnoreBool = (char)1;
+}
+
+void MATH_AbsInt32_CMockStopIgnore(void)
+{
+  if(Mock.MATH_AbsInt32_IgnoreBool)
+    Mock.MATH_AbsInt32_CallInstance = CMock_Guts_MemNext(Mock.MATH_AbsInt32_CallInstance);
+  Mock.MATH_AbsInt32_IgnoreBool = (char)0;
+}
+
+void MATH_AbsInt32_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int32_t value, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_AbsInt32_CALL_INSTANCE));
+  CMOCK_MATH_AbsInt32_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_AbsInt32_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_AbsInt32_CallInstance = CMock_Guts_MemChain(Mock.MATH_AbsInt32_CallInstance, cmock_guts_index);
+  Mock.MATH_AbsInt32_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_AbsInt32(cmock_call_instance, value);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void MATH_AbsInt32_AddCallback(CMOCK_MATH_AbsInt32_CALLBACK Callback)
+{
+  Mock.MATH_AbsInt32_IgnoreBool = (char)0;
+  Mock.MATH_AbsInt32_CallbackBool = (char)1;
+  Mock.MATH_AbsInt32_CallbackFunctionPointer = Callback;
+}
+
+void MATH_AbsInt32_Stub(CMOCK_MATH_AbsInt32_CALLBACK Callback)
+{
+  Mock.MATH_AbsInt32_IgnoreBool = (char)0;
+  Mock.MATH_AbsInt32_CallbackBool = (char)0;
+  Mock.MATH_AbsInt32_CallbackFunctionPointer = Callback;
+}
+
+void MATH_AbsInt32_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int32_t value, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_AbsInt32_CALL_INSTANCE));
+  CMOCK_MATH_AbsInt32_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_AbsInt32_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_AbsInt32_CallInstance = CMock_Guts_MemChain(Mock.MATH_AbsInt32_CallInstance, cmock_guts_index);
+  Mock.MATH_AbsInt32_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_AbsInt32(cmock_call_instance, value);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MATH_AbsInt32_CMockIgnoreArg_value(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_AbsInt32_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_AbsInt32_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_AbsInt32_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_value = 1;
+}
+
+int64_t MATH_AbsInt64(int64_t value)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MATH_AbsInt64_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MATH_AbsInt64);
+  cmock_call_instance = (CMOCK_MATH_AbsInt64_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MATH_AbsInt64_CallInstance);
+  Mock.MATH_AbsInt64_CallInstance = CMock_Guts_MemNext(Mock.MATH_AbsInt64_CallInstance);
+  if (Mock.MATH_AbsInt64_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MATH_AbsInt64_FinalReturn;
+    memcpy((void*)(&Mock.MATH_AbsInt64_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(int64_t[sizeof(cmock_call_instance->ReturnVal) == sizeof(int64_t) ? 1 : -1])); /* add int64_t to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MATH_AbsInt64_CallbackBool &&
+      Mock.MATH_AbsInt64_CallbackFunctionPointer != NULL)
+  {
+    int64_t cmock_cb_ret = Mock.MATH_AbsInt64_CallbackFunctionPointer(value, Mock.MATH_AbsInt64_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_value)
+  {
+    UNITY_SET_DETAILS(CMockString_MATH_AbsInt64,CMockString_value);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_value), (void*)(&value), sizeof(int64_t), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MATH_AbsInt64_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MATH_AbsInt64_CallbackFunctionPointer(value, Mock.MATH_AbsInt64_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MATH_AbsInt64(CMOCK_MATH_AbsInt64_CALL_INSTANCE* cmock_call_instance, int64_t value);
+void CMockExpectParameters_MATH_AbsInt64(CMOCK_MATH_AbsInt64_CALL_INSTANCE* cmock_call_instance, int64_t value)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_value), (void*)(&value),
+         sizeof(int64_t[sizeof(value) == sizeof(int64_t) ? 1 : -1])); /* add int64_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_value = 0;
+}
+
+void MATH_AbsInt64_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_AbsInt64_CALL_INSTANCE));
+  CMOCK_MATH_AbsInt64_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_AbsInt64_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_AbsInt64_CallInstance = CMock_Guts_MemChain(Mock.MATH_AbsInt64_CallInstance, cmock_guts_index);
+  Mock.MATH_AbsInt64_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MATH_AbsInt64_IgnoreBool = (char)1;
+}
+
+void MATH_AbsInt64_CMockStopIgnore(void)
+{
+  if(Mock.MATH_AbsInt64_IgnoreBool)
+    Mock.MATH_AbsInt64_CallInstance = CMock_Guts_MemNext(Mock.MATH_AbsInt64_CallInstance);
+  Mock.MATH_AbsInt64_IgnoreBool = (char)0;
+}
+
+void MATH_AbsInt64_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int64_t value, int64_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_AbsInt64_CALL_INSTANCE));
+  CMOCK_MATH_AbsInt64_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_AbsInt64_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_AbsInt64_CallInstance = CMock_Guts_MemChain(Mock.MATH_AbsInt64_CallInstance, cmock_guts_index);
+  Mock.MATH_AbsInt64_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_AbsInt64(cmock_call_instance, value);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(int64_t[sizeof(cmock_to_return) == sizeof(int64_t) ? 1 : -1])); /* add int64_t to :treat_as_array if this causes an error */
+}
+
+void MATH_AbsInt64_AddCallback(CMOCK_MATH_AbsInt64_CALLBACK Callback)
+{
+  Mock.MATH_AbsInt64_IgnoreBool = (char)0;
+  Mock.MATH_AbsInt64_CallbackBool = (char)1;
+  Mock.MATH_AbsInt64_CallbackFunctionPointer = Callback;
+}
+
+void MATH_AbsInt64_Stub(CMOCK_MATH_AbsInt64_CALLBACK Callback)
+{
+  Mock.MATH_AbsInt64_IgnoreBool = (char)0;
+  Mock.MATH_AbsInt64_CallbackBool = (char)0;
+  Mock.MATH_AbsInt64_CallbackFunctionPointer = Callback;
+}
+
+void MATH_AbsInt64_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int64_t value, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MATH_AbsInt64_CALL_INSTANCE));
+  CMOCK_MATH_AbsInt64_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_AbsInt64_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MATH_AbsInt64_CallInstance = CMock_Guts_MemChain(Mock.MATH_AbsInt64_CallInstance, cmock_guts_index);
+  Mock.MATH_AbsInt64_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MATH_AbsInt64(cmock_call_instance, value);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MATH_AbsInt64_CMockIgnoreArg_value(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MATH_AbsInt64_CALL_INSTANCE* cmock_call_instance = (CMOCK_MATH_AbsInt64_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MATH_AbsInt64_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_value = 1;
+}
+
@@ -0,0 +1,154 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKFOXMATH_H
+#define _MOCKFOXMATH_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "foxmath.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockfoxmath_Init(void);
+void Mockfoxmath_Destroy(void);
+void Mockfoxmath_Verify(void);
+
+
+
+
+#define MATH_linearInterpolation_IgnoreAndReturn(cmock_retval) MATH_linearInterpolation_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MATH_linearInterpolation_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, float cmock_to_return);
+#define MATH_linearInterpolation_StopIgnore() MATH_linearInterpolation_CMockStopIgnore()
+void MATH_linearInterpolation_CMockStopIgnore(void);
+#define MATH_linearInterpolation_ExpectAndReturn(x1, y1, x2, y2, x_interpolate, cmock_retval) MATH_linearInterpolation_CMockExpectAndReturn(__LINE__, x1, y1, x2, y2, x_interpolate, cmock_retval)
+void MATH_linearInterpolation_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, float x1, float y1, float x2, float y2, float x_interpolate, float cmock_to_return);
+typedef float (* CMOCK_MATH_linearInterpolation_CALLBACK)(float x1, float y1, float x2, float y2, float x_interpolate, int cmock_num_calls);
+void MATH_linearInterpolation_AddCallback(CMOCK_MATH_linearInterpolation_CALLBACK Callback);
+void MATH_linearInterpolation_Stub(CMOCK_MATH_linearInterpolation_CALLBACK Callback);
+#define MATH_linearInterpolation_StubWithCallback MATH_linearInterpolation_Stub
+#define MATH_linearInterpolation_ExpectAndThrow(x1, y1, x2, y2, x_interpolate, cmock_to_throw) MATH_linearInterpolation_CMockExpectAndThrow(__LINE__, x1, y1, x2, y2, x_interpolate, cmock_to_throw)
+void MATH_linearInterpolation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, float x1, float y1, float x2, float y2, float x_interpolate, CEXCEPTION_T cmock_to_throw);
+#define MATH_linearInterpolation_IgnoreArg_x1() MATH_linearInterpolation_CMockIgnoreArg_x1(__LINE__)
+void MATH_linearInterpolation_CMockIgnoreArg_x1(UNITY_LINE_TYPE cmock_line);
+#define MATH_linearInterpolation_IgnoreArg_y1() MATH_linearInterpolation_CMockIgnoreArg_y1(__LINE__)
+void MATH_linearInterpolation_CMockIgnoreArg_y1(UNITY_LINE_TYPE cmock_line);
+#define MATH_linearInterpolation_IgnoreArg_x2() MATH_linearInterpolation_CMockIgnoreArg_x2(__LINE__)
+void MATH_linearInterpolation_CMockIgnoreArg_x2(UNITY_LINE_TYPE cmock_line);
+#define MATH_linearInterpolation_IgnoreArg_y2() MATH_linearInterpolation_CMockIgnoreArg_y2(__LINE__)
+void MATH_linearInterpolation_CMockIgnoreArg_y2(UNITY_LINE_TYPE cmock_line);
+#define MATH_linearInterpolation_IgnoreArg_x_interpolate() MATH_linearInterpolation_CMockIgnoreArg_x_interpolate(__LINE__)
+void MATH_linearInterpolation_CMockIgnoreArg_x_interpolate(UNITY_LINE_TYPE cmock_line);
+#define MATH_swapBytes_uint16_t_IgnoreAndReturn(cmock_retval) MATH_swapBytes_uint16_t_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MATH_swapBytes_uint16_t_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return);
+#define MATH_swapBytes_uint16_t_StopIgnore() MATH_swapBytes_uint16_t_CMockStopIgnore()
+void MATH_swapBytes_uint16_t_CMockStopIgnore(void);
+#define MATH_swapBytes_uint16_t_ExpectAndReturn(val, cmock_retval) MATH_swapBytes_uint16_t_CMockExpectAndReturn(__LINE__, val, cmock_retval)
+void MATH_swapBytes_uint16_t_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t val, uint16_t cmock_to_return);
+typedef uint16_t (* CMOCK_MATH_swapBytes_uint16_t_CALLBACK)(uint16_t val, int cmock_num_calls);
+void MATH_swapBytes_uint16_t_AddCallback(CMOCK_MATH_swapBytes_uint16_t_CALLBACK Callback);
+void MATH_swapBytes_uint16_t_Stub(CMOCK_MATH_swapBytes_uint16_t_CALLBACK Callback);
+#define MATH_swapBytes_uint16_t_StubWithCallback MATH_swapBytes_uint16_t_Stub
+#define MATH_swapBytes_uint16_t_ExpectAndThrow(val, cmock_to_throw) MATH_swapBytes_uint16_t_CMockExpectAndThrow(__LINE__, val, cmock_to_throw)
+void MATH_swapBytes_uint16_t_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t val, CEXCEPTION_T cmock_to_throw);
+#define MATH_swapBytes_uint16_t_IgnoreArg_val() MATH_swapBytes_uint16_t_CMockIgnoreArg_val(__LINE__)
+void MATH_swapBytes_uint16_t_CMockIgnoreArg_val(UNITY_LINE_TYPE cmock_line);
+#define MATH_swapBytes_uint32_t_IgnoreAndReturn(cmock_retval) MATH_swapBytes_uint32_t_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MATH_swapBytes_uint32_t_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define MATH_swapBytes_uint32_t_StopIgnore() MATH_swapBytes_uint32_t_CMockStopIgnore()
+void MATH_swapBytes_uint32_t_CMockStopIgnore(void);
+#define MATH_swapBytes_uint32_t_ExpectAndReturn(val, cmock_retval) MATH_swapBytes_uint32_t_CMockExpectAndReturn(__LINE__, val, cmock_retval)
+void MATH_swapBytes_uint32_t_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t val, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_MATH_swapBytes_uint32_t_CALLBACK)(uint32_t val, int cmock_num_calls);
+void MATH_swapBytes_uint32_t_AddCallback(CMOCK_MATH_swapBytes_uint32_t_CALLBACK Callback);
+void MATH_swapBytes_uint32_t_Stub(CMOCK_MATH_swapBytes_uint32_t_CALLBACK Callback);
+#define MATH_swapBytes_uint32_t_StubWithCallback MATH_swapBytes_uint32_t_Stub
+#define MATH_swapBytes_uint32_t_ExpectAndThrow(val, cmock_to_throw) MATH_swapBytes_uint32_t_CMockExpectAndThrow(__LINE__, val, cmock_to_throw)
+void MATH_swapBytes_uint32_t_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t val, CEXCEPTION_T cmock_to_throw);
+#define MATH_swapBytes_uint32_t_IgnoreArg_val() MATH_swapBytes_uint32_t_CMockIgnoreArg_val(__LINE__)
+void MATH_swapBytes_uint32_t_CMockIgnoreArg_val(UNITY_LINE_TYPE cmock_line);
+#define MATH_swapBytes_uint64_t_IgnoreAndReturn(cmock_retval) MATH_swapBytes_uint64_t_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MATH_swapBytes_uint64_t_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t cmock_to_return);
+#define MATH_swapBytes_uint64_t_StopIgnore() MATH_swapBytes_uint64_t_CMockStopIgnore()
+void MATH_swapBytes_uint64_t_CMockStopIgnore(void);
+#define MATH_swapBytes_uint64_t_ExpectAndReturn(val, cmock_retval) MATH_swapBytes_uint64_t_CMockExpectAndReturn(__LINE__, val, cmock_retval)
+void MATH_swapBytes_uint64_t_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint64_t val, uint64_t cmock_to_return);
+typedef uint64_t (* CMOCK_MATH_swapBytes_uint64_t_CALLBACK)(uint64_t val, int cmock_num_calls);
+void MATH_swapBytes_uint64_t_AddCallback(CMOCK_MATH_swapBytes_uint64_t_CALLBACK Callback);
+void MATH_swapBytes_uint64_t_Stub(CMOCK_MATH_swapBytes_uint64_t_CALLBACK Callback);
+#define MATH_swapBytes_uint64_t_StubWithCallback MATH_swapBytes_uint64_t_Stub
+#define MATH_swapBytes_uint64_t_ExpectAndThrow(val, cmock_to_throw) MATH_swapBytes_uint64_t_CMockExpectAndThrow(__LINE__, val, cmock_to_throw)
+void MATH_swapBytes_uint64_t_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint64_t val, CEXCEPTION_T cmock_to_throw);
+#define MATH_swapBytes_uint64_t_IgnoreArg_val() MATH_swapBytes_uint64_t_CMockIgnoreArg_val(__LINE__)
+void MATH_swapBytes_uint64_t_CMockIgnoreArg_val(UNITY_LINE_TYPE cmock_line);
+#define MATH_minimumOfTwoFloats_IgnoreAndReturn(cmock_retval) MATH_minimumOfTwoFloats_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MATH_minimumOfTwoFloats_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, float cmock_to_return);
+#define MATH_minimumOfTwoFloats_StopIgnore() MATH_minimumOfTwoFloats_CMockStopIgnore()
+void MATH_minimumOfTwoFloats_CMockStopIgnore(void);
+#define MATH_minimumOfTwoFloats_ExpectAndReturn(value1, value2, cmock_retval) MATH_minimumOfTwoFloats_CMockExpectAndReturn(__LINE__, value1, value2, cmock_retval)
+void MATH_minimumOfTwoFloats_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, float value1, float value2, float cmock_to_return);
+typedef float (* CMOCK_MATH_minimumOfTwoFloats_CALLBACK)(float value1, float value2, int cmock_num_calls);
+void MATH_minimumOfTwoFloats_AddCallback(CMOCK_MATH_minimumOfTwoFloats_CALLBACK Callback);
+void MATH_minimumOfTwoFloats_Stub(CMOCK_MATH_minimumOfTwoFloats_CALLBACK Callback);
+#define MATH_minimumOfTwoFloats_StubWithCallback MATH_minimumOfTwoFloats_Stub
+#define MATH_minimumOfTwoFloats_ExpectAndThrow(value1, value2, cmock_to_throw) MATH_minimumOfTwoFloats_CMockExpectAndThrow(__LINE__, value1, value2, cmock_to_throw)
+void MATH_minimumOfTwoFloats_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, float value1, float value2, CEXCEPTION_T cmock_to_throw);
+#define MATH_minimumOfTwoFloats_IgnoreArg_value1() MATH_minimumOfTwoFloats_CMockIgnoreArg_value1(__LINE__)
+void MATH_minimumOfTwoFloats_CMockIgnoreArg_value1(UNITY_LINE_TYPE cmock_line);
+#define MATH_minimumOfTwoFloats_IgnoreArg_value2() MATH_minimumOfTwoFloats_CMockIgnoreArg_value2(__LINE__)
+void MATH_minimumOfTwoFloats_CMockIgnoreArg_value2(UNITY_LINE_TYPE cmock_line);
+#define MATH_AbsInt32_IgnoreAndReturn(cmock_retval) MATH_AbsInt32_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MATH_AbsInt32_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return);
+#define MATH_AbsInt32_StopIgnore() MATH_AbsInt32_CMockStopIgnore()
+void MATH_AbsInt32_CMockStopIgnore(void);
+#define MATH_AbsInt32_ExpectAndReturn(value, cmock_retval) MATH_AbsInt32_CMockExpectAndReturn(__LINE__, value, cmock_retval)
+void MATH_AbsInt32_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int32_t value, int32_t cmock_to_return);
+typedef int32_t (* CMOCK_MATH_AbsInt32_CALLBACK)(int32_t value, int cmock_num_calls);
+void MATH_AbsInt32_AddCallback(CMOCK_MATH_AbsInt32_CALLBACK Callback);
+void MATH_AbsInt32_Stub(CMOCK_MATH_AbsInt32_CALLBACK Callback);
+#define MATH_AbsInt32_StubWithCallback MATH_AbsInt32_Stub
+#define MATH_AbsInt32_ExpectAndThrow(value, cmock_to_throw) MATH_AbsInt32_CMockExpectAndThrow(__LINE__, value, cmock_to_throw)
+void MATH_AbsInt32_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int32_t value, CEXCEPTION_T cmock_to_throw);
+#define MATH_AbsInt32_IgnoreArg_value() MATH_AbsInt32_CMockIgnoreArg_value(__LINE__)
+void MATH_AbsInt32_CMockIgnoreArg_value(UNITY_LINE_TYPE cmock_line);
+#define MATH_AbsInt64_IgnoreAndReturn(cmock_retval) MATH_AbsInt64_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MATH_AbsInt64_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int64_t cmock_to_return);
+#define MATH_AbsInt64_StopIgnore() MATH_AbsInt64_CMockStopIgnore()
+void MATH_AbsInt64_CMockStopIgnore(void);
+#define MATH_AbsInt64_ExpectAndReturn(value, cmock_retval) MATH_AbsInt64_CMockExpectAndReturn(__LINE__, value, cmock_retval)
+void MATH_AbsInt64_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int64_t value, int64_t cmock_to_return);
+typedef int64_t (* CMOCK_MATH_AbsInt64_CALLBACK)(int64_t value, int cmock_num_calls);
+void MATH_AbsInt64_AddCallback(CMOCK_MATH_AbsInt64_CALLBACK Callback);
+void MATH_AbsInt64_Stub(CMOCK_MATH_AbsInt64_CALLBACK Callback);
+#define MATH_AbsInt64_StubWithCallback MATH_AbsInt64_Stub
+#define MATH_AbsInt64_ExpectAndThrow(value, cmock_to_throw) MATH_AbsInt64_CMockExpectAndThrow(__LINE__, value, cmock_to_throw)
+void MATH_AbsInt64_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int64_t value, CEXCEPTION_T cmock_to_throw);
+#define MATH_AbsInt64_IgnoreArg_value() MATH_AbsInt64_CMockIgnoreArg_value(__LINE__)
+void MATH_AbsInt64_CMockIgnoreArg_value(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
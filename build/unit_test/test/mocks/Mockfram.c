@@ -0,0 +1,1017 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockfram.h"
+
+static const char* CMockString_FRAM_Flush = "FRAM_Flush";
+static const char* CMockString_FRAM_Initialize = "FRAM_Initialize";
+static const char* CMockString_FRAM_IsWritePending = "FRAM_IsWritePending";
+static const char* CMockString_FRAM_ProcessWriteRequests = "FRAM_ProcessWriteRequests";
+static const char* CMockString_FRAM_Read = "FRAM_Read";
+static const char* CMockString_FRAM_RequestWrite = "FRAM_RequestWrite";
+static const char* CMockString_FRAM_Write = "FRAM_Write";
+static const char* CMockString_blockId = "blockId";
+
+typedef struct _CMOCK_FRAM_Initialize_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_FRAM_Initialize_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_Write_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  FRAM_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_FRAM_Write_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_Read_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  FRAM_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_FRAM_Read_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_RequestWrite_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  FRAM_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_FRAM_RequestWrite_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_Flush_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_FRAM_Flush_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_IsWritePending_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  FRAM_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_FRAM_IsWritePending_CALL_INSTANCE;
+
+static struct MockframInstance
+{
+  char FRAM_Initialize_IgnoreBool;
+  char FRAM_Initialize_CallbackBool;
+  CMOCK_FRAM_Initialize_CALLBACK FRAM_Initialize_CallbackFunctionPointer;
+  int FRAM_Initialize_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_Initialize_CallInstance;
+  char FRAM_Write_IgnoreBool;
+  STD_RETURN_TYPE_e FRAM_Write_FinalReturn;
+  char FRAM_Write_CallbackBool;
+  CMOCK_FRAM_Write_CALLBACK FRAM_Write_CallbackFunctionPointer;
+  int FRAM_Write_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_Write_CallInstance;
+  char FRAM_Read_IgnoreBool;
+  STD_RETURN_TYPE_e FRAM_Read_FinalReturn;
+  char FRAM_Read_CallbackBool;
+  CMOCK_FRAM_Read_CALLBACK FRAM_Read_CallbackFunctionPointer;
+  int FRAM_Read_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_Read_CallInstance;
+  char FRAM_RequestWrite_IgnoreBool;
+  char FRAM_RequestWrite_CallbackBool;
+  CMOCK_FRAM_RequestWrite_CALLBACK FRAM_RequestWrite_CallbackFunctionPointer;
+  int FRAM_RequestWrite_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_RequestWrite_CallInstance;
+  char FRAM_ProcessWriteRequests_IgnoreBool;
+  char FRAM_ProcessWriteRequests_CallbackBool;
+  CMOCK_FRAM_ProcessWriteRequests_CALLBACK FRAM_ProcessWriteRequests_CallbackFunctionPointer;
+  int FRAM_ProcessWriteRequests_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_ProcessWriteRequests_CallInstance;
+  char FRAM_Flush_IgnoreBool;
+  STD_RETURN_TYPE_e FRAM_Flush_FinalReturn;
+  char FRAM_Flush_CallbackBool;
+  CMOCK_FRAM_Flush_CALLBACK FRAM_Flush_CallbackFunctionPointer;
+  int FRAM_Flush_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_Flush_CallInstance;
+  char FRAM_IsWritePending_IgnoreBool;
+  _Bool FRAM_IsWritePending_FinalReturn;
+  char FRAM_IsWritePending_CallbackBool;
+  CMOCK_FRAM_IsWritePending_CALLBACK FRAM_IsWritePending_CallbackFunctionPointer;
+  int FRAM_IsWritePending_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_IsWritePending_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockfram_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.FRAM_Initialize_CallInstance;
+  if (Mock.FRAM_Initialize_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_Initialize);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_Initialize_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_Write_CallInstance;
+  if (Mock.FRAM_Write_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_Write);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_Write_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_Read_CallInstance;
+  if (Mock.FRAM_Read_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_Read);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_Read_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_RequestWrite_CallInstance;
+  if (Mock.FRAM_RequestWrite_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_RequestWrite);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_RequestWrite_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_ProcessWriteRequests_CallInstance;
+  if (Mock.FRAM_ProcessWriteRequests_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_ProcessWriteRequests);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_ProcessWriteRequests_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_Flush_CallInstance;
+  if (Mock.FRAM_Flush_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_Flush);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_Flush_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_IsWritePending_CallInstance;
+  if (Mock.FRAM_IsWritePending_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_IsWritePending);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_IsWritePending_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockfram_Init(void)
+{
+  Mockfram_Destroy();
+}
+
+void Mockfram_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void FRAM_Initialize(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_Initialize_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_Initialize);
+  cmock_call_instance = (CMOCK_FRAM_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_Initialize_CallInstance);
+  Mock.FRAM_Initialize_CallInstance = CMock_Guts_MemNext(Mock.FRAM_Initialize_CallInstance);
+  if (Mock.FRAM_Initialize_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.FRAM_Initialize_CallbackBool &&
+      Mock.FRAM_Initialize_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_Initialize_CallbackFunctionPointer(Mock.FRAM_Initialize_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.FRAM_Initialize_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_Initialize_CallbackFunctionPointer(Mock.FRAM_Initialize_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void FRAM_Initialize_CMockIgnore(void)
+{
+  Mock.FRAM_Initialize_IgnoreBool = (char)1;
+}
+
+void FRAM_Initialize_CMockStopIgnore(void)
+{
+  Mock.FRAM_Initialize_IgnoreBool = (char)0;
+}
+
+void FRAM_Initialize_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Initialize_CALL_INSTANCE));
+  CMOCK_FRAM_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Initialize_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Initialize_CallInstance, cmock_guts_index);
+  Mock.FRAM_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void FRAM_Initialize_AddCallback(CMOCK_FRAM_Initialize_CALLBACK Callback)
+{
+  Mock.FRAM_Initialize_IgnoreBool = (char)0;
+  Mock.FRAM_Initialize_CallbackBool = (char)1;
+  Mock.FRAM_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_Initialize_Stub(CMOCK_FRAM_Initialize_CALLBACK Callback)
+{
+  Mock.FRAM_Initialize_IgnoreBool = (char)0;
+  Mock.FRAM_Initialize_CallbackBool = (char)0;
+  Mock.FRAM_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Initialize_CALL_INSTANCE));
+  CMOCK_FRAM_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Initialize_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Initialize_CallInstance, cmock_guts_index);
+  Mock.FRAM_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e FRAM_Write(FRAM_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_Write_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_Write);
+  cmock_call_instance = (CMOCK_FRAM_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_Write_CallInstance);
+  Mock.FRAM_Write_CallInstance = CMock_Guts_MemNext(Mock.FRAM_Write_CallInstance);
+  if (Mock.FRAM_Write_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.FRAM_Write_FinalReturn;
+    memcpy((void*)(&Mock.FRAM_Write_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.FRAM_Write_CallbackBool &&
+      Mock.FRAM_Write_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.FRAM_Write_CallbackFunctionPointer(blockId, Mock.FRAM_Write_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_Write,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(FRAM_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.FRAM_Write_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.FRAM_Write_CallbackFunctionPointer(blockId, Mock.FRAM_Write_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_FRAM_Write(CMOCK_FRAM_Write_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId);
+void CMockExpectParameters_FRAM_Write(CMOCK_FRAM_Write_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(FRAM_BLOCK_ID_e[sizeof(blockId) == sizeof(FRAM_BLOCK_ID_e) ? 1 : -1])); /* add FRAM_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void FRAM_Write_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Write_CALL_INSTANCE));
+  CMOCK_FRAM_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Write_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Write_CallInstance, cmock_guts_index);
+  Mock.FRAM_Write_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.FRAM_Write_IgnoreBool = (char)1;
+}
+
+void FRAM_Write_CMockStopIgnore(void)
+{
+  if(Mock.FRAM_Write_IgnoreBool)
+    Mock.FRAM_Write_CallInstance = CMock_Guts_MemNext(Mock.FRAM_Write_CallInstance);
+  Mock.FRAM_Write_IgnoreBool = (char)0;
+}
+
+void FRAM_Write_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Write_CALL_INSTANCE));
+  CMOCK_FRAM_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Write_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Write_CallInstance, cmock_guts_index);
+  Mock.FRAM_Write_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_Write(cmock_call_instance, blockId);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void FRAM_Write_AddCallback(CMOCK_FRAM_Write_CALLBACK Callback)
+{
+  Mock.FRAM_Write_IgnoreBool = (char)0;
+  Mock.FRAM_Write_CallbackBool = (char)1;
+  Mock.FRAM_Write_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_Write_Stub(CMOCK_FRAM_Write_CALLBACK Callback)
+{
+  Mock.FRAM_Write_IgnoreBool = (char)0;
+  Mock.FRAM_Write_CallbackBool = (char)0;
+  Mock.FRAM_Write_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_Write_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Write_CALL_INSTANCE));
+  CMOCK_FRAM_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Write_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Write_CallInstance, cmock_guts_index);
+  Mock.FRAM_Write_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_Write(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_Write_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_Write_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Write_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_Write_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+STD_RETURN_TYPE_e FRAM_Read(FRAM_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_Read_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_Read);
+  cmock_call_instance = (CMOCK_FRAM_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_Read_CallInstance);
+  Mock.FRAM_Read_CallInstance = CMock_Guts_MemNext(Mock.FRAM_Read_CallInstance);
+  if (Mock.FRAM_Read_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.FRAM_Read_FinalReturn;
+    memcpy((void*)(&Mock.FRAM_Read_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.FRAM_Read_CallbackBool &&
+      Mock.FRAM_Read_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.FRAM_Read_CallbackFunctionPointer(blockId, Mock.FRAM_Read_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_Read,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(FRAM_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.FRAM_Read_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.FRAM_Read_CallbackFunctionPointer(blockId, Mock.FRAM_Read_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_FRAM_Read(CMOCK_FRAM_Read_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId);
+void CMockExpectParameters_FRAM_Read(CMOCK_FRAM_Read_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(FRAM_BLOCK_ID_e[sizeof(blockId) == sizeof(FRAM_BLOCK_ID_e) ? 1 : -1])); /* add FRAM_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void FRAM_Read_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Read_CALL_INSTANCE));
+  CMOCK_FRAM_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Read_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Read_CallInstance, cmock_guts_index);
+  Mock.FRAM_Read_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.FRAM_Read_IgnoreBool = (char)1;
+}
+
+void FRAM_Read_CMockStopIgnore(void)
+{
+  if(Mock.FRAM_Read_IgnoreBool)
+    Mock.FRAM_Read_CallInstance = CMock_Guts_MemNext(Mock.FRAM_Read_CallInstance);
+  Mock.FRAM_Read_IgnoreBool = (char)0;
+}
+
+void FRAM_Read_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Read_CALL_INSTANCE));
+  CMOCK_FRAM_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Read_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Read_CallInstance, cmock_guts_index);
+  Mock.FRAM_Read_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_Read(cmock_call_instance, blockId);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void FRAM_Read_AddCallback(CMOCK_FRAM_Read_CALLBACK Callback)
+{
+  Mock.FRAM_Read_IgnoreBool = (char)0;
+  Mock.FRAM_Read_CallbackBool = (char)1;
+  Mock.FRAM_Read_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_Read_Stub(CMOCK_FRAM_Read_CALLBACK Callback)
+{
+  Mock.FRAM_Read_IgnoreBool = (char)0;
+  Mock.FRAM_Read_CallbackBool = (char)0;
+  Mock.FRAM_Read_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_Read_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Read_CALL_INSTANCE));
+  CMOCK_FRAM_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Read_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Read_CallInstance, cmock_guts_index);
+  Mock.FRAM_Read_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_Read(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_Read_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_Read_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Read_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_Read_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void FRAM_RequestWrite(FRAM_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_RequestWrite_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_RequestWrite);
+  cmock_call_instance = (CMOCK_FRAM_RequestWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_RequestWrite_CallInstance);
+  Mock.FRAM_RequestWrite_CallInstance = CMock_Guts_MemNext(Mock.FRAM_RequestWrite_CallInstance);
+  if (Mock.FRAM_RequestWrite_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.FRAM_RequestWrite_CallbackBool &&
+      Mock.FRAM_RequestWrite_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_RequestWrite_CallbackFunctionPointer(blockId, Mock.FRAM_RequestWrite_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_RequestWrite,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(FRAM_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.FRAM_RequestWrite_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_RequestWrite_CallbackFunctionPointer(blockId, Mock.FRAM_RequestWrite_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_FRAM_RequestWrite(CMOCK_FRAM_RequestWrite_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId);
+void CMockExpectParameters_FRAM_RequestWrite(CMOCK_FRAM_RequestWrite_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(FRAM_BLOCK_ID_e[sizeof(blockId) == sizeof(FRAM_BLOCK_ID_e) ? 1 : -1])); /* add FRAM_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void FRAM_RequestWrite_CMockIgnore(void)
+{
+  Mock.FRAM_RequestWrite_IgnoreBool = (char)1;
+}
+
+void FRAM_RequestWrite_CMockStopIgnore(void)
+{
+  Mock.FRAM_RequestWrite_IgnoreBool = (char)0;
+}
+
+void FRAM_RequestWrite_CMockExpect(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_RequestWrite_CALL_INSTANCE));
+  CMOCK_FRAM_RequestWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_RequestWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_RequestWrite_CallInstance = CMock_Guts_MemChain(Mock.FRAM_RequestWrite_CallInstance, cmock_guts_index);
+  Mock.FRAM_RequestWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_RequestWrite(cmock_call_instance, blockId);
+}
+
+void FRAM_RequestWrite_AddCallback(CMOCK_FRAM_RequestWrite_CALLBACK Callback)
+{
+  Mock.FRAM_RequestWrite_IgnoreBool = (char)0;
+  Mock.FRAM_RequestWrite_CallbackBool = (char)1;
+  Mock.FRAM_RequestWrite_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_RequestWrite_Stub(CMOCK_FRAM_RequestWrite_CALLBACK Callback)
+{
+  Mock.FRAM_RequestWrite_IgnoreBool = (char)0;
+  Mock.FRAM_RequestWrite_CallbackBool = (char)0;
+  Mock.FRAM_RequestWrite_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_RequestWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_RequestWrite_CALL_INSTANCE));
+  CMOCK_FRAM_RequestWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_RequestWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_RequestWrite_CallInstance = CMock_Guts_MemChain(Mock.FRAM_RequestWrite_CallInstance, cmock_guts_index);
+  Mock.FRAM_RequestWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_RequestWrite(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_RequestWrite_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_RequestWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_RequestWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_RequestWrite_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void FRAM_ProcessWriteRequests(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_ProcessWriteRequests);
+  cmock_call_instance = (CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_ProcessWriteRequests_CallInstance);
+  Mock.FRAM_ProcessWriteRequests_CallInstance = CMock_Guts_MemNext(Mock.FRAM_ProcessWriteRequests_CallInstance);
+  if (Mock.FRAM_ProcessWriteRequests_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.FRAM_ProcessWriteRequests_CallbackBool &&
+      Mock.FRAM_ProcessWriteRequests_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_ProcessWriteRequests_CallbackFunctionPointer(Mock.FRAM_ProcessWriteRequests_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.FRAM_ProcessWriteRequests_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_ProcessWriteRequests_CallbackFunctionPointer(Mock.FRAM_ProcessWriteRequests_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void FRAM_ProcessWriteRequests_CMockIgnore(void)
+{
+  Mock.FRAM_ProcessWriteRequests_IgnoreBool = (char)1;
+}
+
+void FRAM_ProcessWriteRequests_CMockStopIgnore(void)
+{
+  Mock.FRAM_ProcessWriteRequests_IgnoreBool = (char)0;
+}
+
+void FRAM_ProcessWriteRequests_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE));
+  CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_ProcessWriteRequests_CallInstance = CMock_Guts_MemChain(Mock.FRAM_ProcessWriteRequests_CallInstance, cmock_guts_index);
+  Mock.FRAM_ProcessWriteRequests_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void FRAM_ProcessWriteRequests_AddCallback(CMOCK_FRAM_ProcessWriteRequests_CALLBACK Callback)
+{
+  Mock.FRAM_ProcessWriteRequests_IgnoreBool = (char)0;
+  Mock.FRAM_ProcessWriteRequests_CallbackBool = (char)1;
+  Mock.FRAM_ProcessWriteRequests_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_ProcessWriteRequests_Stub(CMOCK_FRAM_ProcessWriteRequests_CALLBACK Callback)
+{
+  Mock.FRAM_ProcessWriteRequests_IgnoreBool = (char)0;
+  Mock.FRAM_ProcessWriteRequests_CallbackBool = (char)0;
+  Mock.FRAM_ProcessWriteRequests_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_ProcessWriteRequests_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE));
+  CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_ProcessWriteRequests_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_ProcessWriteRequests_CallInstance = CMock_Guts_MemChain(Mock.FRAM_ProcessWriteRequests_CallInstance, cmock_guts_index);
+  Mock.FRAM_ProcessWriteRequests_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e FRAM_Flush(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_Flush_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_Flush);
+  cmock_call_instance = (CMOCK_FRAM_Flush_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_Flush_CallInstance);
+  Mock.FRAM_Flush_CallInstance = CMock_Guts_MemNext(Mock.FRAM_Flush_CallInstance);
+  if (Mock.FRAM_Flush_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.FRAM_Flush_FinalReturn;
+    memcpy((void*)(&Mock.FRAM_Flush_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.FRAM_Flush_CallbackBool &&
+      Mock.FRAM_Flush_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.FRAM_Flush_CallbackFunctionPointer(Mock.FRAM_Flush_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.FRAM_Flush_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.FRAM_Flush_CallbackFunctionPointer(Mock.FRAM_Flush_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void FRAM_Flush_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Flush_CALL_INSTANCE));
+  CMOCK_FRAM_Flush_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Flush_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Flush_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Flush_CallInstance, cmock_guts_index);
+  Mock.FRAM_Flush_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.FRAM_Flush_IgnoreBool = (char)1;
+}
+
+void FRAM_Flush_CMockStopIgnore(void)
+{
+  if(Mock.FRAM_Flush_IgnoreBool)
+    Mock.FRAM_Flush_CallInstance = CMock_Guts_MemNext(Mock.FRAM_Flush_CallInstance);
+  Mock.FRAM_Flush_IgnoreBool = (char)0;
+}
+
+void FRAM_Flush_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Flush_CALL_INSTANCE));
+  CMOCK_FRAM_Flush_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Flush_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Flush_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Flush_CallInstance, cmock_guts_index);
+  Mock.FRAM_Flush_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void FRAM_Flush_AddCallback(CMOCK_FRAM_Flush_CALLBACK Callback)
+{
+  Mock.FRAM_Flush_IgnoreBool = (char)0;
+  Mock.FRAM_Flush_CallbackBool = (char)1;
+  Mock.FRAM_Flush_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_Flush_Stub(CMOCK_FRAM_Flush_CALLBACK Callback)
+{
+  Mock.FRAM_Flush_IgnoreBool = (char)0;
+  Mock.FRAM_Flush_CallbackBool = (char)0;
+  Mock.FRAM_Flush_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_Flush_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_Flush_CALL_INSTANCE));
+  CMOCK_FRAM_Flush_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_Flush_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_Flush_CallInstance = CMock_Guts_MemChain(Mock.FRAM_Flush_CallInstance, cmock_guts_index);
+  Mock.FRAM_Flush_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+_Bool FRAM_IsWritePending(FRAM_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_IsWritePending_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_IsWritePending);
+  cmock_call_instance = (CMOCK_FRAM_IsWritePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_IsWritePending_CallInstance);
+  Mock.FRAM_IsWritePending_CallInstance = CMock_Guts_MemNext(Mock.FRAM_IsWritePending_CallInstance);
+  if (Mock.FRAM_IsWritePending_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.FRAM_IsWritePending_FinalReturn;
+    memcpy((void*)(&Mock.FRAM_IsWritePending_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.FRAM_IsWritePending_CallbackBool &&
+      Mock.FRAM_IsWritePending_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.FRAM_IsWritePending_CallbackFunctionPointer(blockId, Mock.FRAM_IsWritePending_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_IsWritePending,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(FRAM_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.FRAM_IsWritePending_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.FRAM_IsWritePending_CallbackFunctionPointer(blockId, Mock.FRAM_IsWritePending_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_FRAM_IsWritePending(CMOCK_FRAM_IsWritePending_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId);
+void CMockExpectParameters_FRAM_IsWritePending(CMOCK_FRAM_IsWritePending_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(FRAM_BLOCK_ID_e[sizeof(blockId) == sizeof(FRAM_BLOCK_ID_e) ? 1 : -1])); /* add FRAM_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void FRAM_IsWritePending_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_IsWritePending_CALL_INSTANCE));
+  CMOCK_FRAM_IsWritePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_IsWritePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_IsWritePending_CallInstance = CMock_Guts_MemChain(Mock.FRAM_IsWritePending_CallInstance, cmock_guts_index);
+  Mock.FRAM_IsWritePending_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.FRAM_IsWritePending_IgnoreBool = (char)1;
+}
+
+void FRAM_IsWritePending_CMockStopIgnore(void)
+{
+  if(Mock.FRAM_IsWritePending_IgnoreBool)
+    Mock.FRAM_IsWritePending_CallInstance = CMock_Guts_MemNext(Mock.FRAM_IsWritePending_CallInstance);
+  Mock.FRAM_IsWritePending_IgnoreBool = (char)0;
+}
+
+void FRAM_IsWritePending_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_IsWritePending_CALL_INSTANCE));
+  CMOCK_FRAM_IsWritePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_IsWritePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_IsWritePending_CallInstance = CMock_Guts_MemChain(Mock.FRAM_IsWritePending_CallInstance, cmock_guts_index);
+  Mock.FRAM_IsWritePending_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_IsWritePending(cmock_call_instance, blockId);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void FRAM_IsWritePending_AddCallback(CMOCK_FRAM_IsWritePending_CALLBACK Callback)
+{
+  Mock.FRAM_IsWritePending_IgnoreBool = (char)0;
+  Mock.FRAM_IsWritePending_CallbackBool = (char)1;
+  Mock.FRAM_IsWritePending_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_IsWritePending_Stub(CMOCK_FRAM_IsWritePending_CALLBACK Callback)
+{
+  Mock.FRAM_IsWritePending_IgnoreBool = (char)0;
+  Mock.FRAM_IsWritePending_CallbackBool = (char)0;
+  Mock.FRAM_IsWritePending_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_IsWritePending_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_IsWritePending_CALL_INSTANCE));
+  CMOCK_FRAM_IsWritePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_IsWritePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_IsWritePending_CallInstance = CMock_Guts_MemChain(Mock.FRAM_IsWritePending_CallInstance, cmock_guts_index);
+  Mock.FRAM_IsWritePending_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_IsWritePending(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_IsWritePending_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_IsWritePending_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_IsWritePending_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_IsWritePending_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
@@ -0,0 +1,138 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKFRAM_H
+#define _MOCKFRAM_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "fram.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockfram_Init(void);
+void Mockfram_Destroy(void);
+void Mockfram_Verify(void);
+
+
+
+
+#define FRAM_Initialize_Ignore() FRAM_Initialize_CMockIgnore()
+void FRAM_Initialize_CMockIgnore(void);
+#define FRAM_Initialize_StopIgnore() FRAM_Initialize_CMockStopIgnore()
+void FRAM_Initialize_CMockStopIgnore(void);
+#define FRAM_Initialize_Expect() FRAM_Initialize_CMockExpect(__LINE__)
+void FRAM_Initialize_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_FRAM_Initialize_CALLBACK)(int cmock_num_calls);
+void FRAM_Initialize_AddCallback(CMOCK_FRAM_Initialize_CALLBACK Callback);
+void FRAM_Initialize_Stub(CMOCK_FRAM_Initialize_CALLBACK Callback);
+#define FRAM_Initialize_StubWithCallback FRAM_Initialize_Stub
+#define FRAM_Initialize_ExpectAndThrow(cmock_to_throw) FRAM_Initialize_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void FRAM_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define FRAM_Write_IgnoreAndReturn(cmock_retval) FRAM_Write_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void FRAM_Write_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define FRAM_Write_StopIgnore() FRAM_Write_CMockStopIgnore()
+void FRAM_Write_CMockStopIgnore(void);
+#define FRAM_Write_ExpectAndReturn(blockId, cmock_retval) FRAM_Write_CMockExpectAndReturn(__LINE__, blockId, cmock_retval)
+void FRAM_Write_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_FRAM_Write_CALLBACK)(FRAM_BLOCK_ID_e blockId, int cmock_num_calls);
+void FRAM_Write_AddCallback(CMOCK_FRAM_Write_CALLBACK Callback);
+void FRAM_Write_Stub(CMOCK_FRAM_Write_CALLBACK Callback);
+#define FRAM_Write_StubWithCallback FRAM_Write_Stub
+#define FRAM_Write_ExpectAndThrow(blockId, cmock_to_throw) FRAM_Write_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void FRAM_Write_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define FRAM_Write_IgnoreArg_blockId() FRAM_Write_CMockIgnoreArg_blockId(__LINE__)
+void FRAM_Write_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define FRAM_Read_IgnoreAndReturn(cmock_retval) FRAM_Read_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void FRAM_Read_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define FRAM_Read_StopIgnore() FRAM_Read_CMockStopIgnore()
+void FRAM_Read_CMockStopIgnore(void);
+#define FRAM_Read_ExpectAndReturn(blockId, cmock_retval) FRAM_Read_CMockExpectAndReturn(__LINE__, blockId, cmock_retval)
+void FRAM_Read_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_FRAM_Read_CALLBACK)(FRAM_BLOCK_ID_e blockId, int cmock_num_calls);
+void FRAM_Read_AddCallback(CMOCK_FRAM_Read_CALLBACK Callback);
+void FRAM_Read_Stub(CMOCK_FRAM_Read_CALLBACK Callback);
+#define FRAM_Read_StubWithCallback FRAM_Read_Stub
+#define FRAM_Read_ExpectAndThrow(blockId, cmock_to_throw) FRAM_Read_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void FRAM_Read_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define FRAM_Read_IgnoreArg_blockId() FRAM_Read_CMockIgnoreArg_blockId(__LINE__)
+void FRAM_Read_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define FRAM_RequestWrite_Ignore() FRAM_RequestWrite_CMockIgnore()
+void FRAM_RequestWrite_CMockIgnore(void);
+#define FRAM_RequestWrite_StopIgnore() FRAM_RequestWrite_CMockStopIgnore()
+void FRAM_RequestWrite_CMockStopIgnore(void);
+#define FRAM_RequestWrite_Expect(blockId) FRAM_RequestWrite_CMockExpect(__LINE__, blockId)
+void FRAM_RequestWrite_CMockExpect(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId);
+typedef void (* CMOCK_FRAM_RequestWrite_CALLBACK)(FRAM_BLOCK_ID_e blockId, int cmock_num_calls);
+void FRAM_RequestWrite_AddCallback(CMOCK_FRAM_RequestWrite_CALLBACK Callback);
+void FRAM_RequestWrite_Stub(CMOCK_FRAM_RequestWrite_CALLBACK Callback);
+#define FRAM_RequestWrite_StubWithCallback FRAM_RequestWrite_Stub
+#define FRAM_RequestWrite_ExpectAndThrow(blockId, cmock_to_throw) FRAM_RequestWrite_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void FRAM_RequestWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define FRAM_RequestWrite_IgnoreArg_blockId() FRAM_RequestWrite_CMockIgnoreArg_blockId(__LINE__)
+void FRAM_RequestWrite_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define FRAM_ProcessWriteRequests_Ignore() FRAM_ProcessWriteRequests_CMockIgnore()
+void FRAM_ProcessWriteRequests_CMockIgnore(void);
+#define FRAM_ProcessWriteRequests_StopIgnore() FRAM_ProcessWriteRequests_CMockStopIgnore()
+void FRAM_ProcessWriteRequests_CMockStopIgnore(void);
+#define FRAM_ProcessWriteRequests_Expect() FRAM_ProcessWriteRequests_CMockExpect(__LINE__)
+void FRAM_ProcessWriteRequests_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_FRAM_ProcessWriteRequests_CALLBACK)(int cmock_num_calls);
+void FRAM_ProcessWriteRequests_AddCallback(CMOCK_FRAM_ProcessWriteRequests_CALLBACK Callback);
+void FRAM_ProcessWriteRequests_Stub(CMOCK_FRAM_ProcessWriteRequests_CALLBACK Callback);
+#define FRAM_ProcessWriteRequests_StubWithCallback FRAM_ProcessWriteRequests_Stub
+#define FRAM_ProcessWriteRequests_ExpectAndThrow(cmock_to_throw) FRAM_ProcessWriteRequests_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void FRAM_ProcessWriteRequests_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define FRAM_Flush_IgnoreAndReturn(cmock_retval) FRAM_Flush_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void FRAM_Flush_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define FRAM_Flush_StopIgnore() FRAM_Flush_CMockStopIgnore()
+void FRAM_Flush_CMockStopIgnore(void);
+#define FRAM_Flush_ExpectAndReturn(cmock_retval) FRAM_Flush_CMockExpectAndReturn(__LINE__, cmock_retval)
+void FRAM_Flush_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_FRAM_Flush_CALLBACK)(int cmock_num_calls);
+void FRAM_Flush_AddCallback(CMOCK_FRAM_Flush_CALLBACK Callback);
+void FRAM_Flush_Stub(CMOCK_FRAM_Flush_CALLBACK Callback);
+#define FRAM_Flush_StubWithCallback FRAM_Flush_Stub
+#define FRAM_Flush_ExpectAndThrow(cmock_to_throw) FRAM_Flush_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void FRAM_Flush_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define FRAM_IsWritePending_IgnoreAndReturn(cmock_retval) FRAM_IsWritePending_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void FRAM_IsWritePending_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define FRAM_IsWritePending_StopIgnore() FRAM_IsWritePending_CMockStopIgnore()
+void FRAM_IsWritePending_CMockStopIgnore(void);
+#define FRAM_IsWritePending_ExpectAndReturn(blockId, cmock_retval) FRAM_IsWritePending_CMockExpectAndReturn(__LINE__, blockId, cmock_retval)
+void FRAM_IsWritePending_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_FRAM_IsWritePending_CALLBACK)(FRAM_BLOCK_ID_e blockId, int cmock_num_calls);
+void FRAM_IsWritePending_AddCallback(CMOCK_FRAM_IsWritePending_CALLBACK Callback);
+void FRAM_IsWritePending_Stub(CMOCK_FRAM_IsWritePending_CALLBACK Callback);
+#define FRAM_IsWritePending_StubWithCallback FRAM_IsWritePending_Stub
+#define FRAM_IsWritePending_ExpectAndThrow(blockId, cmock_to_throw) FRAM_IsWritePending_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void FRAM_IsWritePending_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define FRAM_IsWritePending_IgnoreArg_blockId() FRAM_IsWritePending_CMockIgnoreArg_blockId(__LINE__)
+void FRAM_IsWritePending_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,1560 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockfram_journal.h"
+
+static const char* CMockString_FRAM_JOURNAL_CommitIndex = "FRAM_JOURNAL_CommitIndex";
+static const char* CMockString_FRAM_JOURNAL_CommitRecord = "FRAM_JOURNAL_CommitRecord";
+static const char* CMockString_FRAM_JOURNAL_EncodeIndex = "FRAM_JOURNAL_EncodeIndex";
+static const char* CMockString_FRAM_JOURNAL_EncodeRecord = "FRAM_JOURNAL_EncodeRecord";
+static const char* CMockString_FRAM_JOURNAL_Initialize = "FRAM_JOURNAL_Initialize";
+static const char* CMockString_FRAM_JOURNAL_IsIndexUpdateDue = "FRAM_JOURNAL_IsIndexUpdateDue";
+static const char* CMockString_FRAM_JOURNAL_ReadLatest = "FRAM_JOURNAL_ReadLatest";
+static const char* CMockString_FRAM_JOURNAL_Scan = "FRAM_JOURNAL_Scan";
+static const char* CMockString_TEST_FRAM_JOURNAL_CalculateCrc = "TEST_FRAM_JOURNAL_CalculateCrc";
+static const char* CMockString_blockId = "blockId";
+static const char* CMockString_length = "length";
+static const char* CMockString_pAddress = "pAddress";
+static const char* CMockString_pData = "pData";
+static const char* CMockString_pIndex = "pIndex";
+static const char* CMockString_pRecord = "pRecord";
+static const char* CMockString_readFunction = "readFunction";
+
+typedef struct _CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  FRAM_JOURNAL_READ_f Expected_readFunction;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_readFunction;
+
+} CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  FRAM_BLOCK_ID_e Expected_blockId;
+  FRAM_JOURNAL_READ_f Expected_readFunction;
+  uint8_t* Expected_pData;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pData_Used;
+  uint8_t* ReturnThruPtr_pData_Val;
+  size_t ReturnThruPtr_pData_Size;
+  char IgnoreArg_blockId;
+  char IgnoreArg_readFunction;
+  char IgnoreArg_pData;
+
+} CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint16_t ReturnVal;
+  int CallOrder;
+  FRAM_BLOCK_ID_e Expected_blockId;
+  const uint8_t* Expected_pData;
+  uint8_t* Expected_pRecord;
+  uint32_t* Expected_pAddress;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pRecord_Used;
+  uint8_t* ReturnThruPtr_pRecord_Val;
+  size_t ReturnThruPtr_pRecord_Size;
+  char ReturnThruPtr_pAddress_Used;
+  uint32_t* ReturnThruPtr_pAddress_Val;
+  size_t ReturnThruPtr_pAddress_Size;
+  char IgnoreArg_blockId;
+  char IgnoreArg_pData;
+  char IgnoreArg_pRecord;
+  char IgnoreArg_pAddress;
+
+} CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  FRAM_BLOCK_ID_e Expected_blockId;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_blockId;
+
+} CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint16_t ReturnVal;
+  int CallOrder;
+  uint8_t* Expected_pIndex;
+  uint32_t* Expected_pAddress;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pIndex_Used;
+  uint8_t* ReturnThruPtr_pIndex_Val;
+  size_t ReturnThruPtr_pIndex_Size;
+  char ReturnThruPtr_pAddress_Used;
+  uint32_t* ReturnThruPtr_pAddress_Val;
+  size_t ReturnThruPtr_pAddress_Size;
+  char IgnoreArg_pIndex;
+  char IgnoreArg_pAddress;
+
+} CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE;
+
+typedef struct _CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint16_t ReturnVal;
+  int CallOrder;
+  const uint8_t* Expected_pData;
+  uint16_t Expected_length;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_pData;
+  char IgnoreArg_length;
+
+} CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE;
+
+static struct Mockfram_journalInstance
+{
+  char FRAM_JOURNAL_Initialize_IgnoreBool;
+  uint32_t FRAM_JOURNAL_Initialize_FinalReturn;
+  char FRAM_JOURNAL_Initialize_CallbackBool;
+  CMOCK_FRAM_JOURNAL_Initialize_CALLBACK FRAM_JOURNAL_Initialize_CallbackFunctionPointer;
+  int FRAM_JOURNAL_Initialize_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_JOURNAL_Initialize_CallInstance;
+  char FRAM_JOURNAL_Scan_IgnoreBool;
+  char FRAM_JOURNAL_Scan_CallbackBool;
+  CMOCK_FRAM_JOURNAL_Scan_CALLBACK FRAM_JOURNAL_Scan_CallbackFunctionPointer;
+  int FRAM_JOURNAL_Scan_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_JOURNAL_Scan_CallInstance;
+  char FRAM_JOURNAL_ReadLatest_IgnoreBool;
+  STD_RETURN_TYPE_e FRAM_JOURNAL_ReadLatest_FinalReturn;
+  char FRAM_JOURNAL_ReadLatest_CallbackBool;
+  CMOCK_FRAM_JOURNAL_ReadLatest_CALLBACK FRAM_JOURNAL_ReadLatest_CallbackFunctionPointer;
+  int FRAM_JOURNAL_ReadLatest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_JOURNAL_ReadLatest_CallInstance;
+  char FRAM_JOURNAL_EncodeRecord_IgnoreBool;
+  uint16_t FRAM_JOURNAL_EncodeRecord_FinalReturn;
+  char FRAM_JOURNAL_EncodeRecord_CallbackBool;
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALLBACK FRAM_JOURNAL_EncodeRecord_CallbackFunctionPointer;
+  int FRAM_JOURNAL_EncodeRecord_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_JOURNAL_EncodeRecord_CallInstance;
+  char FRAM_JOURNAL_CommitRecord_IgnoreBool;
+  char FRAM_JOURNAL_CommitRecord_CallbackBool;
+  CMOCK_FRAM_JOURNAL_CommitRecord_CALLBACK FRAM_JOURNAL_CommitRecord_CallbackFunctionPointer;
+  int FRAM_JOURNAL_CommitRecord_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_JOURNAL_CommitRecord_CallInstance;
+  char FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool;
+  _Bool FRAM_JOURNAL_IsIndexUpdateDue_FinalReturn;
+  char FRAM_JOURNAL_IsIndexUpdateDue_CallbackBool;
+  CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALLBACK FRAM_JOURNAL_IsIndexUpdateDue_CallbackFunctionPointer;
+  int FRAM_JOURNAL_IsIndexUpdateDue_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_JOURNAL_IsIndexUpdateDue_CallInstance;
+  char FRAM_JOURNAL_EncodeIndex_IgnoreBool;
+  uint16_t FRAM_JOURNAL_EncodeIndex_FinalReturn;
+  char FRAM_JOURNAL_EncodeIndex_CallbackBool;
+  CMOCK_FRAM_JOURNAL_EncodeIndex_CALLBACK FRAM_JOURNAL_EncodeIndex_CallbackFunctionPointer;
+  int FRAM_JOURNAL_EncodeIndex_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_JOURNAL_EncodeIndex_CallInstance;
+  char FRAM_JOURNAL_CommitIndex_IgnoreBool;
+  char FRAM_JOURNAL_CommitIndex_CallbackBool;
+  CMOCK_FRAM_JOURNAL_CommitIndex_CALLBACK FRAM_JOURNAL_CommitIndex_CallbackFunctionPointer;
+  int FRAM_JOURNAL_CommitIndex_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE FRAM_JOURNAL_CommitIndex_CallInstance;
+  char TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool;
+  uint16_t TEST_FRAM_JOURNAL_CalculateCrc_FinalReturn;
+  char TEST_FRAM_JOURNAL_CalculateCrc_CallbackBool;
+  CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALLBACK TEST_FRAM_JOURNAL_CalculateCrc_CallbackFunctionPointer;
+  int TEST_FRAM_JOURNAL_CalculateCrc_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_FRAM_JOURNAL_CalculateCrc_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockfram_journal_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.FRAM_JOURNAL_Initialize_CallInstance;
+  if (Mock.FRAM_JOURNAL_Initialize_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_Initialize);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_JOURNAL_Initialize_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_JOURNAL_Scan_CallInstance;
+  if (Mock.FRAM_JOURNAL_Scan_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_Scan);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_JOURNAL_Scan_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_JOURNAL_ReadLatest_CallInstance;
+  if (Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_ReadLatest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_JOURNAL_ReadLatest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_JOURNAL_EncodeRecord_CallInstance;
+  if (Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_EncodeRecord);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_JOURNAL_EncodeRecord_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_JOURNAL_CommitRecord_CallInstance;
+  if (Mock.FRAM_JOURNAL_CommitRecord_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_CommitRecord);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_JOURNAL_CommitRecord_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance;
+  if (Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_IsIndexUpdateDue);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_JOURNAL_EncodeIndex_CallInstance;
+  if (Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_EncodeIndex);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_JOURNAL_EncodeIndex_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.FRAM_JOURNAL_CommitIndex_CallInstance;
+  if (Mock.FRAM_JOURNAL_CommitIndex_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_CommitIndex);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.FRAM_JOURNAL_CommitIndex_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance;
+  if (Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_FRAM_JOURNAL_CalculateCrc);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockfram_journal_Init(void)
+{
+  Mockfram_journal_Destroy();
+}
+
+void Mockfram_journal_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+uint32_t FRAM_JOURNAL_Initialize(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_Initialize);
+  cmock_call_instance = (CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_JOURNAL_Initialize_CallInstance);
+  Mock.FRAM_JOURNAL_Initialize_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_Initialize_CallInstance);
+  if (Mock.FRAM_JOURNAL_Initialize_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.FRAM_JOURNAL_Initialize_FinalReturn;
+    Mock.FRAM_JOURNAL_Initialize_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.FRAM_JOURNAL_Initialize_CallbackBool &&
+      Mock.FRAM_JOURNAL_Initialize_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.FRAM_JOURNAL_Initialize_CallbackFunctionPointer(Mock.FRAM_JOURNAL_Initialize_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.FRAM_JOURNAL_Initialize_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.FRAM_JOURNAL_Initialize_CallbackFunctionPointer(Mock.FRAM_JOURNAL_Initialize_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void FRAM_JOURNAL_Initialize_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_Initialize_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_Initialize_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.FRAM_JOURNAL_Initialize_IgnoreBool = (char)1;
+}
+
+void FRAM_JOURNAL_Initialize_CMockStopIgnore(void)
+{
+  if(Mock.FRAM_JOURNAL_Initialize_IgnoreBool)
+    Mock.FRAM_JOURNAL_Initialize_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_Initialize_CallInstance);
+  Mock.FRAM_JOURNAL_Initialize_IgnoreBool = (char)0;
+}
+
+void FRAM_JOURNAL_Initialize_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_Initialize_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_Initialize_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void FRAM_JOURNAL_Initialize_AddCallback(CMOCK_FRAM_JOURNAL_Initialize_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_Initialize_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_Initialize_CallbackBool = (char)1;
+  Mock.FRAM_JOURNAL_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_Initialize_Stub(CMOCK_FRAM_JOURNAL_Initialize_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_Initialize_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_Initialize_CallbackBool = (char)0;
+  Mock.FRAM_JOURNAL_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_Initialize_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_Initialize_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_JOURNAL_Scan(FRAM_JOURNAL_READ_f readFunction)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_Scan);
+  cmock_call_instance = (CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_JOURNAL_Scan_CallInstance);
+  Mock.FRAM_JOURNAL_Scan_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_Scan_CallInstance);
+  if (Mock.FRAM_JOURNAL_Scan_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.FRAM_JOURNAL_Scan_CallbackBool &&
+      Mock.FRAM_JOURNAL_Scan_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_JOURNAL_Scan_CallbackFunctionPointer(readFunction, Mock.FRAM_JOURNAL_Scan_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_readFunction)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_Scan,CMockString_readFunction);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_readFunction), (void*)(&readFunction), sizeof(FRAM_JOURNAL_READ_f), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.FRAM_JOURNAL_Scan_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_JOURNAL_Scan_CallbackFunctionPointer(readFunction, Mock.FRAM_JOURNAL_Scan_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_FRAM_JOURNAL_Scan(CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE* cmock_call_instance, FRAM_JOURNAL_READ_f readFunction);
+void CMockExpectParameters_FRAM_JOURNAL_Scan(CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE* cmock_call_instance, FRAM_JOURNAL_READ_f readFunction)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_readFunction), (void*)(&readFunction),
+         sizeof(FRAM_JOURNAL_READ_f[sizeof(readFunction) == sizeof(FRAM_JOURNAL_READ_f) ? 1 : -1])); /* add FRAM_JOURNAL_READ_f to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_readFunction = 0;
+}
+
+void FRAM_JOURNAL_Scan_CMockIgnore(void)
+{
+  Mock.FRAM_JOURNAL_Scan_IgnoreBool = (char)1;
+}
+
+void FRAM_JOURNAL_Scan_CMockStopIgnore(void)
+{
+  Mock.FRAM_JOURNAL_Scan_IgnoreBool = (char)0;
+}
+
+void FRAM_JOURNAL_Scan_CMockExpect(UNITY_LINE_TYPE cmock_line, FRAM_JOURNAL_READ_f readFunction)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_Scan_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_Scan_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_Scan_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_Scan(cmock_call_instance, readFunction);
+}
+
+void FRAM_JOURNAL_Scan_AddCallback(CMOCK_FRAM_JOURNAL_Scan_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_Scan_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_Scan_CallbackBool = (char)1;
+  Mock.FRAM_JOURNAL_Scan_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_Scan_Stub(CMOCK_FRAM_JOURNAL_Scan_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_Scan_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_Scan_CallbackBool = (char)0;
+  Mock.FRAM_JOURNAL_Scan_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_Scan_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_JOURNAL_READ_f readFunction, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_Scan_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_Scan_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_Scan_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_Scan(cmock_call_instance, readFunction);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_JOURNAL_Scan_CMockIgnoreArg_readFunction(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_Scan_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_Scan_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_readFunction = 1;
+}
+
+STD_RETURN_TYPE_e FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction, uint8_t* pData)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_ReadLatest);
+  cmock_call_instance = (CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_JOURNAL_ReadLatest_CallInstance);
+  Mock.FRAM_JOURNAL_ReadLatest_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_ReadLatest_CallInstance);
+  if (Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.FRAM_JOURNAL_ReadLatest_FinalReturn;
+    memcpy((void*)(&Mock.FRAM_JOURNAL_ReadLatest_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.FRAM_JOURNAL_ReadLatest_CallbackBool &&
+      Mock.FRAM_JOURNAL_ReadLatest_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.FRAM_JOURNAL_ReadLatest_CallbackFunctionPointer(blockId, readFunction, pData, Mock.FRAM_JOURNAL_ReadLatest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_ReadLatest,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(FRAM_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_readFunction)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_ReadLatest,CMockString_readFunction);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_readFunction), (void*)(&readFunction), sizeof(FRAM_JOURNAL_READ_f), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pData)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_ReadLatest,CMockString_pData);
+    if (cmock_call_instance->Expected_pData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pData, pData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.FRAM_JOURNAL_ReadLatest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.FRAM_JOURNAL_ReadLatest_CallbackFunctionPointer(blockId, readFunction, pData, Mock.FRAM_JOURNAL_ReadLatest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pData_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pData, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pData, (void*)cmock_call_instance->ReturnThruPtr_pData_Val,
+      cmock_call_instance->ReturnThruPtr_pData_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_FRAM_JOURNAL_ReadLatest(CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction, uint8_t* pData);
+void CMockExpectParameters_FRAM_JOURNAL_ReadLatest(CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction, uint8_t* pData)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(FRAM_BLOCK_ID_e[sizeof(blockId) == sizeof(FRAM_BLOCK_ID_e) ? 1 : -1])); /* add FRAM_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_readFunction), (void*)(&readFunction),
+         sizeof(FRAM_JOURNAL_READ_f[sizeof(readFunction) == sizeof(FRAM_JOURNAL_READ_f) ? 1 : -1])); /* add FRAM_JOURNAL_READ_f to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_readFunction = 0;
+  cmock_call_instance->Expected_pData = pData;
+  cmock_call_instance->IgnoreArg_pData = 0;
+  cmock_call_instance->ReturnThruPtr_pData_Used = 0;
+}
+
+void FRAM_JOURNAL_ReadLatest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_ReadLatest_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_ReadLatest_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool = (char)1;
+}
+
+void FRAM_JOURNAL_ReadLatest_CMockStopIgnore(void)
+{
+  if(Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool)
+    Mock.FRAM_JOURNAL_ReadLatest_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_ReadLatest_CallInstance);
+  Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool = (char)0;
+}
+
+void FRAM_JOURNAL_ReadLatest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction, uint8_t* pData, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_ReadLatest_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_ReadLatest_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_ReadLatest(cmock_call_instance, blockId, readFunction, pData);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void FRAM_JOURNAL_ReadLatest_AddCallback(CMOCK_FRAM_JOURNAL_ReadLatest_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_ReadLatest_CallbackBool = (char)1;
+  Mock.FRAM_JOURNAL_ReadLatest_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_ReadLatest_Stub(CMOCK_FRAM_JOURNAL_ReadLatest_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_ReadLatest_CallbackBool = (char)0;
+  Mock.FRAM_JOURNAL_ReadLatest_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_ReadLatest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction, uint8_t* pData, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_ReadLatest_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_ReadLatest_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_ReadLatest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_ReadLatest(cmock_call_instance, blockId, readFunction, pData);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_JOURNAL_ReadLatest_CMockReturnMemThruPtr_pData(UNITY_LINE_TYPE cmock_line, uint8_t* pData, size_t cmock_size)
+{
+  CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_ReadLatest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pData_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pData_Val = pData;
+  cmock_call_instance->ReturnThruPtr_pData_Size = cmock_size;
+}
+
+void FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_ReadLatest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_readFunction(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_ReadLatest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_readFunction = 1;
+}
+
+void FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_ReadLatest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_ReadLatest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pData = 1;
+}
+
+uint16_t FRAM_JOURNAL_EncodeRecord(FRAM_BLOCK_ID_e blockId, const uint8_t* pData, uint8_t* pRecord, uint32_t* pAddress)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_EncodeRecord);
+  cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance);
+  Mock.FRAM_JOURNAL_EncodeRecord_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance);
+  if (Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.FRAM_JOURNAL_EncodeRecord_FinalReturn;
+    Mock.FRAM_JOURNAL_EncodeRecord_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.FRAM_JOURNAL_EncodeRecord_CallbackBool &&
+      Mock.FRAM_JOURNAL_EncodeRecord_CallbackFunctionPointer != NULL)
+  {
+    uint16_t cmock_cb_ret = Mock.FRAM_JOURNAL_EncodeRecord_CallbackFunctionPointer(blockId, pData, pRecord, pAddress, Mock.FRAM_JOURNAL_EncodeRecord_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_EncodeRecord,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(FRAM_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pData)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_EncodeRecord,CMockString_pData);
+    if (cmock_call_instance->Expected_pData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pData, pData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pRecord)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_EncodeRecord,CMockString_pRecord);
+    if (cmock_call_instance->Expected_pRecord == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRecord, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pRecord, pRecord, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pAddress)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_EncodeRecord,CMockString_pAddress);
+    if (cmock_call_instance->Expected_pAddress == NULL)
+      { UNITY_TEST_ASSERT_NULL(pAddress, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pAddress, pAddress, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.FRAM_JOURNAL_EncodeRecord_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.FRAM_JOURNAL_EncodeRecord_CallbackFunctionPointer(blockId, pData, pRecord, pAddress, Mock.FRAM_JOURNAL_EncodeRecord_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRecord_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRecord, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRecord, (void*)cmock_call_instance->ReturnThruPtr_pRecord_Val,
+      cmock_call_instance->ReturnThruPtr_pRecord_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pAddress_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pAddress, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pAddress, (void*)cmock_call_instance->ReturnThruPtr_pAddress_Val,
+      cmock_call_instance->ReturnThruPtr_pAddress_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_FRAM_JOURNAL_EncodeRecord(CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId, const uint8_t* pData, uint8_t* pRecord, uint32_t* pAddress);
+void CMockExpectParameters_FRAM_JOURNAL_EncodeRecord(CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId, const uint8_t* pData, uint8_t* pRecord, uint32_t* pAddress)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(FRAM_BLOCK_ID_e[sizeof(blockId) == sizeof(FRAM_BLOCK_ID_e) ? 1 : -1])); /* add FRAM_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+  cmock_call_instance->Expected_pData = pData;
+  cmock_call_instance->IgnoreArg_pData = 0;
+  cmock_call_instance->Expected_pRecord = pRecord;
+  cmock_call_instance->IgnoreArg_pRecord = 0;
+  cmock_call_instance->ReturnThruPtr_pRecord_Used = 0;
+  cmock_call_instance->Expected_pAddress = pAddress;
+  cmock_call_instance->IgnoreArg_pAddress = 0;
+  cmock_call_instance->ReturnThruPtr_pAddress_Used = 0;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_EncodeRecord_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool = (char)1;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockStopIgnore(void)
+{
+  if(Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool)
+    Mock.FRAM_JOURNAL_EncodeRecord_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance);
+  Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool = (char)0;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, const uint8_t* pData, uint8_t* pRecord, uint32_t* pAddress, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_EncodeRecord_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_EncodeRecord(cmock_call_instance, blockId, pData, pRecord, pAddress);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void FRAM_JOURNAL_EncodeRecord_AddCallback(CMOCK_FRAM_JOURNAL_EncodeRecord_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_EncodeRecord_CallbackBool = (char)1;
+  Mock.FRAM_JOURNAL_EncodeRecord_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_EncodeRecord_Stub(CMOCK_FRAM_JOURNAL_EncodeRecord_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_EncodeRecord_CallbackBool = (char)0;
+  Mock.FRAM_JOURNAL_EncodeRecord_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, const uint8_t* pData, uint8_t* pRecord, uint32_t* pAddress, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_EncodeRecord_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_EncodeRecord_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_EncodeRecord(cmock_call_instance, blockId, pData, pRecord, pAddress);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pRecord(UNITY_LINE_TYPE cmock_line, uint8_t* pRecord, size_t cmock_size)
+{
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRecord_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRecord_Val = pRecord;
+  cmock_call_instance->ReturnThruPtr_pRecord_Size = cmock_size;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pAddress(UNITY_LINE_TYPE cmock_line, uint32_t* pAddress, size_t cmock_size)
+{
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pAddress_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pAddress_Val = pAddress;
+  cmock_call_instance->ReturnThruPtr_pAddress_Size = cmock_size;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pData = 1;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pRecord(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRecord = 1;
+}
+
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pAddress(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeRecord_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pAddress = 1;
+}
+
+void FRAM_JOURNAL_CommitRecord(FRAM_BLOCK_ID_e blockId)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_CommitRecord);
+  cmock_call_instance = (CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_JOURNAL_CommitRecord_CallInstance);
+  Mock.FRAM_JOURNAL_CommitRecord_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_CommitRecord_CallInstance);
+  if (Mock.FRAM_JOURNAL_CommitRecord_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.FRAM_JOURNAL_CommitRecord_CallbackBool &&
+      Mock.FRAM_JOURNAL_CommitRecord_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_JOURNAL_CommitRecord_CallbackFunctionPointer(blockId, Mock.FRAM_JOURNAL_CommitRecord_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_blockId)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_CommitRecord,CMockString_blockId);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId), sizeof(FRAM_BLOCK_ID_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.FRAM_JOURNAL_CommitRecord_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_JOURNAL_CommitRecord_CallbackFunctionPointer(blockId, Mock.FRAM_JOURNAL_CommitRecord_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_FRAM_JOURNAL_CommitRecord(CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId);
+void CMockExpectParameters_FRAM_JOURNAL_CommitRecord(CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE* cmock_call_instance, FRAM_BLOCK_ID_e blockId)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_blockId), (void*)(&blockId),
+         sizeof(FRAM_BLOCK_ID_e[sizeof(blockId) == sizeof(FRAM_BLOCK_ID_e) ? 1 : -1])); /* add FRAM_BLOCK_ID_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_blockId = 0;
+}
+
+void FRAM_JOURNAL_CommitRecord_CMockIgnore(void)
+{
+  Mock.FRAM_JOURNAL_CommitRecord_IgnoreBool = (char)1;
+}
+
+void FRAM_JOURNAL_CommitRecord_CMockStopIgnore(void)
+{
+  Mock.FRAM_JOURNAL_CommitRecord_IgnoreBool = (char)0;
+}
+
+void FRAM_JOURNAL_CommitRecord_CMockExpect(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_CommitRecord_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_CommitRecord_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_CommitRecord_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_CommitRecord(cmock_call_instance, blockId);
+}
+
+void FRAM_JOURNAL_CommitRecord_AddCallback(CMOCK_FRAM_JOURNAL_CommitRecord_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_CommitRecord_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_CommitRecord_CallbackBool = (char)1;
+  Mock.FRAM_JOURNAL_CommitRecord_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_CommitRecord_Stub(CMOCK_FRAM_JOURNAL_CommitRecord_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_CommitRecord_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_CommitRecord_CallbackBool = (char)0;
+  Mock.FRAM_JOURNAL_CommitRecord_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_CommitRecord_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_CommitRecord_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_CommitRecord_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_CommitRecord_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_CommitRecord(cmock_call_instance, blockId);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_JOURNAL_CommitRecord_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_CommitRecord_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_CommitRecord_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_blockId = 1;
+}
+
+_Bool FRAM_JOURNAL_IsIndexUpdateDue(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_IsIndexUpdateDue);
+  cmock_call_instance = (CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance);
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance);
+  if (Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.FRAM_JOURNAL_IsIndexUpdateDue_FinalReturn;
+    memcpy((void*)(&Mock.FRAM_JOURNAL_IsIndexUpdateDue_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackBool &&
+      Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackFunctionPointer(Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackFunctionPointer(Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void FRAM_JOURNAL_IsIndexUpdateDue_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool = (char)1;
+}
+
+void FRAM_JOURNAL_IsIndexUpdateDue_CMockStopIgnore(void)
+{
+  if(Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool)
+    Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance);
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool = (char)0;
+}
+
+void FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void FRAM_JOURNAL_IsIndexUpdateDue_AddCallback(CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackBool = (char)1;
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_IsIndexUpdateDue_Stub(CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackBool = (char)0;
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_IsIndexUpdateDue_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_IsIndexUpdateDue_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint16_t FRAM_JOURNAL_EncodeIndex(uint8_t* pIndex, uint32_t* pAddress)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_EncodeIndex);
+  cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance);
+  Mock.FRAM_JOURNAL_EncodeIndex_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance);
+  if (Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.FRAM_JOURNAL_EncodeIndex_FinalReturn;
+    Mock.FRAM_JOURNAL_EncodeIndex_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.FRAM_JOURNAL_EncodeIndex_CallbackBool &&
+      Mock.FRAM_JOURNAL_EncodeIndex_CallbackFunctionPointer != NULL)
+  {
+    uint16_t cmock_cb_ret = Mock.FRAM_JOURNAL_EncodeIndex_CallbackFunctionPointer(pIndex, pAddress, Mock.FRAM_JOURNAL_EncodeIndex_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pIndex)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_EncodeIndex,CMockString_pIndex);
+    if (cmock_call_instance->Expected_pIndex == NULL)
+      { UNITY_TEST_ASSERT_NULL(pIndex, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pIndex, pIndex, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pAddress)
+  {
+    UNITY_SET_DETAILS(CMockString_FRAM_JOURNAL_EncodeIndex,CMockString_pAddress);
+    if (cmock_call_instance->Expected_pAddress == NULL)
+      { UNITY_TEST_ASSERT_NULL(pAddress, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pAddress, pAddress, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.FRAM_JOURNAL_EncodeIndex_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.FRAM_JOURNAL_EncodeIndex_CallbackFunctionPointer(pIndex, pAddress, Mock.FRAM_JOURNAL_EncodeIndex_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pIndex_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pIndex, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pIndex, (void*)cmock_call_instance->ReturnThruPtr_pIndex_Val,
+      cmock_call_instance->ReturnThruPtr_pIndex_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pAddress_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pAddress, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pAddress, (void*)cmock_call_instance->ReturnThruPtr_pAddress_Val,
+      cmock_call_instance->ReturnThruPtr_pAddress_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_FRAM_JOURNAL_EncodeIndex(CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance, uint8_t* pIndex, uint32_t* pAddress);
+void CMockExpectParameters_FRAM_JOURNAL_EncodeIndex(CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance, uint8_t* pIndex, uint32_t* pAddress)
+{
+  cmock_call_instance->Expected_pIndex = pIndex;
+  cmock_call_instance->IgnoreArg_pIndex = 0;
+  cmock_call_instance->ReturnThruPtr_pIndex_Used = 0;
+  cmock_call_instance->Expected_pAddress = pAddress;
+  cmock_call_instance->IgnoreArg_pAddress = 0;
+  cmock_call_instance->ReturnThruPtr_pAddress_Used = 0;
+}
+
+void FRAM_JOURNAL_EncodeIndex_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_EncodeIndex_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool = (char)1;
+}
+
+void FRAM_JOURNAL_EncodeIndex_CMockStopIgnore(void)
+{
+  if(Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool)
+    Mock.FRAM_JOURNAL_EncodeIndex_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance);
+  Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool = (char)0;
+}
+
+void FRAM_JOURNAL_EncodeIndex_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t* pIndex, uint32_t* pAddress, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_EncodeIndex_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_EncodeIndex(cmock_call_instance, pIndex, pAddress);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void FRAM_JOURNAL_EncodeIndex_AddCallback(CMOCK_FRAM_JOURNAL_EncodeIndex_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_EncodeIndex_CallbackBool = (char)1;
+  Mock.FRAM_JOURNAL_EncodeIndex_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_EncodeIndex_Stub(CMOCK_FRAM_JOURNAL_EncodeIndex_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_EncodeIndex_CallbackBool = (char)0;
+  Mock.FRAM_JOURNAL_EncodeIndex_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_EncodeIndex_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t* pIndex, uint32_t* pAddress, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_EncodeIndex_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_EncodeIndex_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_FRAM_JOURNAL_EncodeIndex(cmock_call_instance, pIndex, pAddress);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pIndex(UNITY_LINE_TYPE cmock_line, uint8_t* pIndex, size_t cmock_size)
+{
+  CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pIndex_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pIndex_Val = pIndex;
+  cmock_call_instance->ReturnThruPtr_pIndex_Size = cmock_size;
+}
+
+void FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pAddress(UNITY_LINE_TYPE cmock_line, uint32_t* pAddress, size_t cmock_size)
+{
+  CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pAddress_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pAddress_Val = pAddress;
+  cmock_call_instance->ReturnThruPtr_pAddress_Size = cmock_size;
+}
+
+void FRAM_JOURNAL_EncodeIndex_CMockIgnoreArg_pIndex(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pIndex = 1;
+}
+
+void FRAM_JOURNAL_EncodeIndex_CMockIgnoreArg_pAddress(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_EncodeIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.FRAM_JOURNAL_EncodeIndex_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pAddress = 1;
+}
+
+void FRAM_JOURNAL_CommitIndex(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_FRAM_JOURNAL_CommitIndex);
+  cmock_call_instance = (CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.FRAM_JOURNAL_CommitIndex_CallInstance);
+  Mock.FRAM_JOURNAL_CommitIndex_CallInstance = CMock_Guts_MemNext(Mock.FRAM_JOURNAL_CommitIndex_CallInstance);
+  if (Mock.FRAM_JOURNAL_CommitIndex_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.FRAM_JOURNAL_CommitIndex_CallbackBool &&
+      Mock.FRAM_JOURNAL_CommitIndex_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_JOURNAL_CommitIndex_CallbackFunctionPointer(Mock.FRAM_JOURNAL_CommitIndex_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.FRAM_JOURNAL_CommitIndex_CallbackFunctionPointer != NULL)
+  {
+    Mock.FRAM_JOURNAL_CommitIndex_CallbackFunctionPointer(Mock.FRAM_JOURNAL_CommitIndex_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void FRAM_JOURNAL_CommitIndex_CMockIgnore(void)
+{
+  Mock.FRAM_JOURNAL_CommitIndex_IgnoreBool = (char)1;
+}
+
+void FRAM_JOURNAL_CommitIndex_CMockStopIgnore(void)
+{
+  Mock.FRAM_JOURNAL_CommitIndex_IgnoreBool = (char)0;
+}
+
+void FRAM_JOURNAL_CommitIndex_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_CommitIndex_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_CommitIndex_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_CommitIndex_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void FRAM_JOURNAL_CommitIndex_AddCallback(CMOCK_FRAM_JOURNAL_CommitIndex_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_CommitIndex_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_CommitIndex_CallbackBool = (char)1;
+  Mock.FRAM_JOURNAL_CommitIndex_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_CommitIndex_Stub(CMOCK_FRAM_JOURNAL_CommitIndex_CALLBACK Callback)
+{
+  Mock.FRAM_JOURNAL_CommitIndex_IgnoreBool = (char)0;
+  Mock.FRAM_JOURNAL_CommitIndex_CallbackBool = (char)0;
+  Mock.FRAM_JOURNAL_CommitIndex_CallbackFunctionPointer = Callback;
+}
+
+void FRAM_JOURNAL_CommitIndex_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE));
+  CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE* cmock_call_instance = (CMOCK_FRAM_JOURNAL_CommitIndex_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.FRAM_JOURNAL_CommitIndex_CallInstance = CMock_Guts_MemChain(Mock.FRAM_JOURNAL_CommitIndex_CallInstance, cmock_guts_index);
+  Mock.FRAM_JOURNAL_CommitIndex_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint16_t TEST_FRAM_JOURNAL_CalculateCrc(const uint8_t* pData, uint16_t length)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_FRAM_JOURNAL_CalculateCrc);
+  cmock_call_instance = (CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance);
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance = CMock_Guts_MemNext(Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance);
+  if (Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_FRAM_JOURNAL_CalculateCrc_FinalReturn;
+    Mock.TEST_FRAM_JOURNAL_CalculateCrc_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackBool &&
+      Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackFunctionPointer != NULL)
+  {
+    uint16_t cmock_cb_ret = Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackFunctionPointer(pData, length, Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pData)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_FRAM_JOURNAL_CalculateCrc,CMockString_pData);
+    if (cmock_call_instance->Expected_pData == NULL)
+      { UNITY_TEST_ASSERT_NULL(pData, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_pData, pData, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_length)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_FRAM_JOURNAL_CalculateCrc,CMockString_length);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_length, length, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackFunctionPointer(pData, length, Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_FRAM_JOURNAL_CalculateCrc(CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE* cmock_call_instance, const uint8_t* pData, uint16_t length);
+void CMockExpectParameters_TEST_FRAM_JOURNAL_CalculateCrc(CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE* cmock_call_instance, const uint8_t* pData, uint16_t length)
+{
+  cmock_call_instance->Expected_pData = pData;
+  cmock_call_instance->IgnoreArg_pData = 0;
+  cmock_call_instance->Expected_length = length;
+  cmock_call_instance->IgnoreArg_length = 0;
+}
+
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE));
+  CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance = CMock_Guts_MemChain(Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance, cmock_guts_index);
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool = (char)1;
+}
+
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockStopIgnore(void)
+{
+  if(Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool)
+    Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance = CMock_Guts_MemNext(Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance);
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool = (char)0;
+}
+
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const uint8_t* pData, uint16_t length, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE));
+  CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance = CMock_Guts_MemChain(Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance, cmock_guts_index);
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_FRAM_JOURNAL_CalculateCrc(cmock_call_instance, pData, length);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_FRAM_JOURNAL_CalculateCrc_AddCallback(CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALLBACK Callback)
+{
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool = (char)0;
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackBool = (char)1;
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackFunctionPointer = Callback;
+}
+
+void TEST_FRAM_JOURNAL_CalculateCrc_Stub(CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALLBACK Callback)
+{
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool = (char)0;
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackBool = (char)0;
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallbackFunctionPointer = Callback;
+}
+
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const uint8_t* pData, uint16_t length, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE));
+  CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance = CMock_Guts_MemChain(Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance, cmock_guts_index);
+  Mock.TEST_FRAM_JOURNAL_CalculateCrc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_FRAM_JOURNAL_CalculateCrc(cmock_call_instance, pData, length);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pData = 1;
+}
+
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_FRAM_JOURNAL_CalculateCrc_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_length = 1;
+}
+
@@ -0,0 +1,200 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKFRAM_JOURNAL_H
+#define _MOCKFRAM_JOURNAL_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "fram_journal.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockfram_journal_Init(void);
+void Mockfram_journal_Destroy(void);
+void Mockfram_journal_Verify(void);
+
+
+
+
+#define FRAM_JOURNAL_Initialize_IgnoreAndReturn(cmock_retval) FRAM_JOURNAL_Initialize_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void FRAM_JOURNAL_Initialize_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define FRAM_JOURNAL_Initialize_StopIgnore() FRAM_JOURNAL_Initialize_CMockStopIgnore()
+void FRAM_JOURNAL_Initialize_CMockStopIgnore(void);
+#define FRAM_JOURNAL_Initialize_ExpectAndReturn(cmock_retval) FRAM_JOURNAL_Initialize_CMockExpectAndReturn(__LINE__, cmock_retval)
+void FRAM_JOURNAL_Initialize_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_FRAM_JOURNAL_Initialize_CALLBACK)(int cmock_num_calls);
+void FRAM_JOURNAL_Initialize_AddCallback(CMOCK_FRAM_JOURNAL_Initialize_CALLBACK Callback);
+void FRAM_JOURNAL_Initialize_Stub(CMOCK_FRAM_JOURNAL_Initialize_CALLBACK Callback);
+#define FRAM_JOURNAL_Initialize_StubWithCallback FRAM_JOURNAL_Initialize_Stub
+#define FRAM_JOURNAL_Initialize_ExpectAndThrow(cmock_to_throw) FRAM_JOURNAL_Initialize_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void FRAM_JOURNAL_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define FRAM_JOURNAL_Scan_Ignore() FRAM_JOURNAL_Scan_CMockIgnore()
+void FRAM_JOURNAL_Scan_CMockIgnore(void);
+#define FRAM_JOURNAL_Scan_StopIgnore() FRAM_JOURNAL_Scan_CMockStopIgnore()
+void FRAM_JOURNAL_Scan_CMockStopIgnore(void);
+#define FRAM_JOURNAL_Scan_Expect(readFunction) FRAM_JOURNAL_Scan_CMockExpect(__LINE__, readFunction)
+void FRAM_JOURNAL_Scan_CMockExpect(UNITY_LINE_TYPE cmock_line, FRAM_JOURNAL_READ_f readFunction);
+typedef void (* CMOCK_FRAM_JOURNAL_Scan_CALLBACK)(FRAM_JOURNAL_READ_f readFunction, int cmock_num_calls);
+void FRAM_JOURNAL_Scan_AddCallback(CMOCK_FRAM_JOURNAL_Scan_CALLBACK Callback);
+void FRAM_JOURNAL_Scan_Stub(CMOCK_FRAM_JOURNAL_Scan_CALLBACK Callback);
+#define FRAM_JOURNAL_Scan_StubWithCallback FRAM_JOURNAL_Scan_Stub
+#define FRAM_JOURNAL_Scan_ExpectAndThrow(readFunction, cmock_to_throw) FRAM_JOURNAL_Scan_CMockExpectAndThrow(__LINE__, readFunction, cmock_to_throw)
+void FRAM_JOURNAL_Scan_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_JOURNAL_READ_f readFunction, CEXCEPTION_T cmock_to_throw);
+#define FRAM_JOURNAL_Scan_IgnoreArg_readFunction() FRAM_JOURNAL_Scan_CMockIgnoreArg_readFunction(__LINE__)
+void FRAM_JOURNAL_Scan_CMockIgnoreArg_readFunction(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_ReadLatest_IgnoreAndReturn(cmock_retval) FRAM_JOURNAL_ReadLatest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void FRAM_JOURNAL_ReadLatest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define FRAM_JOURNAL_ReadLatest_StopIgnore() FRAM_JOURNAL_ReadLatest_CMockStopIgnore()
+void FRAM_JOURNAL_ReadLatest_CMockStopIgnore(void);
+#define FRAM_JOURNAL_ReadLatest_ExpectAndReturn(blockId, readFunction, pData, cmock_retval) FRAM_JOURNAL_ReadLatest_CMockExpectAndReturn(__LINE__, blockId, readFunction, pData, cmock_retval)
+void FRAM_JOURNAL_ReadLatest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction, uint8_t* pData, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_FRAM_JOURNAL_ReadLatest_CALLBACK)(FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction, uint8_t* pData, int cmock_num_calls);
+void FRAM_JOURNAL_ReadLatest_AddCallback(CMOCK_FRAM_JOURNAL_ReadLatest_CALLBACK Callback);
+void FRAM_JOURNAL_ReadLatest_Stub(CMOCK_FRAM_JOURNAL_ReadLatest_CALLBACK Callback);
+#define FRAM_JOURNAL_ReadLatest_StubWithCallback FRAM_JOURNAL_ReadLatest_Stub
+#define FRAM_JOURNAL_ReadLatest_ExpectAndThrow(blockId, readFunction, pData, cmock_to_throw) FRAM_JOURNAL_ReadLatest_CMockExpectAndThrow(__LINE__, blockId, readFunction, pData, cmock_to_throw)
+void FRAM_JOURNAL_ReadLatest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction, uint8_t* pData, CEXCEPTION_T cmock_to_throw);
+#define FRAM_JOURNAL_ReadLatest_ReturnThruPtr_pData(pData) FRAM_JOURNAL_ReadLatest_CMockReturnMemThruPtr_pData(__LINE__, pData, sizeof(uint8_t))
+#define FRAM_JOURNAL_ReadLatest_ReturnArrayThruPtr_pData(pData, cmock_len) FRAM_JOURNAL_ReadLatest_CMockReturnMemThruPtr_pData(__LINE__, pData, cmock_len * sizeof(*pData))
+#define FRAM_JOURNAL_ReadLatest_ReturnMemThruPtr_pData(pData, cmock_size) FRAM_JOURNAL_ReadLatest_CMockReturnMemThruPtr_pData(__LINE__, pData, cmock_size)
+void FRAM_JOURNAL_ReadLatest_CMockReturnMemThruPtr_pData(UNITY_LINE_TYPE cmock_line, uint8_t* pData, size_t cmock_size);
+#define FRAM_JOURNAL_ReadLatest_IgnoreArg_blockId() FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_blockId(__LINE__)
+void FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_ReadLatest_IgnoreArg_readFunction() FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_readFunction(__LINE__)
+void FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_readFunction(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_ReadLatest_IgnoreArg_pData() FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_pData(__LINE__)
+void FRAM_JOURNAL_ReadLatest_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_EncodeRecord_IgnoreAndReturn(cmock_retval) FRAM_JOURNAL_EncodeRecord_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return);
+#define FRAM_JOURNAL_EncodeRecord_StopIgnore() FRAM_JOURNAL_EncodeRecord_CMockStopIgnore()
+void FRAM_JOURNAL_EncodeRecord_CMockStopIgnore(void);
+#define FRAM_JOURNAL_EncodeRecord_ExpectAndReturn(blockId, pData, pRecord, pAddress, cmock_retval) FRAM_JOURNAL_EncodeRecord_CMockExpectAndReturn(__LINE__, blockId, pData, pRecord, pAddress, cmock_retval)
+void FRAM_JOURNAL_EncodeRecord_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, const uint8_t* pData, uint8_t* pRecord, uint32_t* pAddress, uint16_t cmock_to_return);
+typedef uint16_t (* CMOCK_FRAM_JOURNAL_EncodeRecord_CALLBACK)(FRAM_BLOCK_ID_e blockId, const uint8_t* pData, uint8_t* pRecord, uint32_t* pAddress, int cmock_num_calls);
+void FRAM_JOURNAL_EncodeRecord_AddCallback(CMOCK_FRAM_JOURNAL_EncodeRecord_CALLBACK Callback);
+void FRAM_JOURNAL_EncodeRecord_Stub(CMOCK_FRAM_JOURNAL_EncodeRecord_CALLBACK Callback);
+#define FRAM_JOURNAL_EncodeRecord_StubWithCallback FRAM_JOURNAL_EncodeRecord_Stub
+#define FRAM_JOURNAL_EncodeRecord_ExpectAndThrow(blockId, pData, pRecord, pAddress, cmock_to_throw) FRAM_JOURNAL_EncodeRecord_CMockExpectAndThrow(__LINE__, blockId, pData, pRecord, pAddress, cmock_to_throw)
+void FRAM_JOURNAL_EncodeRecord_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, const uint8_t* pData, uint8_t* pRecord, uint32_t* pAddress, CEXCEPTION_T cmock_to_throw);
+#define FRAM_JOURNAL_EncodeRecord_ReturnThruPtr_pRecord(pRecord) FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pRecord(__LINE__, pRecord, sizeof(uint8_t))
+#define FRAM_JOURNAL_EncodeRecord_ReturnArrayThruPtr_pRecord(pRecord, cmock_len) FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pRecord(__LINE__, pRecord, cmock_len * sizeof(*pRecord))
+#define FRAM_JOURNAL_EncodeRecord_ReturnMemThruPtr_pRecord(pRecord, cmock_size) FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pRecord(__LINE__, pRecord, cmock_size)
+void FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pRecord(UNITY_LINE_TYPE cmock_line, uint8_t* pRecord, size_t cmock_size);
+#define FRAM_JOURNAL_EncodeRecord_ReturnThruPtr_pAddress(pAddress) FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pAddress(__LINE__, pAddress, sizeof(uint32_t))
+#define FRAM_JOURNAL_EncodeRecord_ReturnArrayThruPtr_pAddress(pAddress, cmock_len) FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pAddress(__LINE__, pAddress, cmock_len * sizeof(*pAddress))
+#define FRAM_JOURNAL_EncodeRecord_ReturnMemThruPtr_pAddress(pAddress, cmock_size) FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pAddress(__LINE__, pAddress, cmock_size)
+void FRAM_JOURNAL_EncodeRecord_CMockReturnMemThruPtr_pAddress(UNITY_LINE_TYPE cmock_line, uint32_t* pAddress, size_t cmock_size);
+#define FRAM_JOURNAL_EncodeRecord_IgnoreArg_blockId() FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_blockId(__LINE__)
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_EncodeRecord_IgnoreArg_pData() FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pData(__LINE__)
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_EncodeRecord_IgnoreArg_pRecord() FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pRecord(__LINE__)
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pRecord(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_EncodeRecord_IgnoreArg_pAddress() FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pAddress(__LINE__)
+void FRAM_JOURNAL_EncodeRecord_CMockIgnoreArg_pAddress(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_CommitRecord_Ignore() FRAM_JOURNAL_CommitRecord_CMockIgnore()
+void FRAM_JOURNAL_CommitRecord_CMockIgnore(void);
+#define FRAM_JOURNAL_CommitRecord_StopIgnore() FRAM_JOURNAL_CommitRecord_CMockStopIgnore()
+void FRAM_JOURNAL_CommitRecord_CMockStopIgnore(void);
+#define FRAM_JOURNAL_CommitRecord_Expect(blockId) FRAM_JOURNAL_CommitRecord_CMockExpect(__LINE__, blockId)
+void FRAM_JOURNAL_CommitRecord_CMockExpect(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId);
+typedef void (* CMOCK_FRAM_JOURNAL_CommitRecord_CALLBACK)(FRAM_BLOCK_ID_e blockId, int cmock_num_calls);
+void FRAM_JOURNAL_CommitRecord_AddCallback(CMOCK_FRAM_JOURNAL_CommitRecord_CALLBACK Callback);
+void FRAM_JOURNAL_CommitRecord_Stub(CMOCK_FRAM_JOURNAL_CommitRecord_CALLBACK Callback);
+#define FRAM_JOURNAL_CommitRecord_StubWithCallback FRAM_JOURNAL_CommitRecord_Stub
+#define FRAM_JOURNAL_CommitRecord_ExpectAndThrow(blockId, cmock_to_throw) FRAM_JOURNAL_CommitRecord_CMockExpectAndThrow(__LINE__, blockId, cmock_to_throw)
+void FRAM_JOURNAL_CommitRecord_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, FRAM_BLOCK_ID_e blockId, CEXCEPTION_T cmock_to_throw);
+#define FRAM_JOURNAL_CommitRecord_IgnoreArg_blockId() FRAM_JOURNAL_CommitRecord_CMockIgnoreArg_blockId(__LINE__)
+void FRAM_JOURNAL_CommitRecord_CMockIgnoreArg_blockId(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_IsIndexUpdateDue_IgnoreAndReturn(cmock_retval) FRAM_JOURNAL_IsIndexUpdateDue_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void FRAM_JOURNAL_IsIndexUpdateDue_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define FRAM_JOURNAL_IsIndexUpdateDue_StopIgnore() FRAM_JOURNAL_IsIndexUpdateDue_CMockStopIgnore()
+void FRAM_JOURNAL_IsIndexUpdateDue_CMockStopIgnore(void);
+#define FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(cmock_retval) FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(__LINE__, cmock_retval)
+void FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALLBACK)(int cmock_num_calls);
+void FRAM_JOURNAL_IsIndexUpdateDue_AddCallback(CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALLBACK Callback);
+void FRAM_JOURNAL_IsIndexUpdateDue_Stub(CMOCK_FRAM_JOURNAL_IsIndexUpdateDue_CALLBACK Callback);
+#define FRAM_JOURNAL_IsIndexUpdateDue_StubWithCallback FRAM_JOURNAL_IsIndexUpdateDue_Stub
+#define FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndThrow(cmock_to_throw) FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void FRAM_JOURNAL_IsIndexUpdateDue_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define FRAM_JOURNAL_EncodeIndex_IgnoreAndReturn(cmock_retval) FRAM_JOURNAL_EncodeIndex_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void FRAM_JOURNAL_EncodeIndex_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return);
+#define FRAM_JOURNAL_EncodeIndex_StopIgnore() FRAM_JOURNAL_EncodeIndex_CMockStopIgnore()
+void FRAM_JOURNAL_EncodeIndex_CMockStopIgnore(void);
+#define FRAM_JOURNAL_EncodeIndex_ExpectAndReturn(pIndex, pAddress, cmock_retval) FRAM_JOURNAL_EncodeIndex_CMockExpectAndReturn(__LINE__, pIndex, pAddress, cmock_retval)
+void FRAM_JOURNAL_EncodeIndex_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t* pIndex, uint32_t* pAddress, uint16_t cmock_to_return);
+typedef uint16_t (* CMOCK_FRAM_JOURNAL_EncodeIndex_CALLBACK)(uint8_t* pIndex, uint32_t* pAddress, int cmock_num_calls);
+void FRAM_JOURNAL_EncodeIndex_AddCallback(CMOCK_FRAM_JOURNAL_EncodeIndex_CALLBACK Callback);
+void FRAM_JOURNAL_EncodeIndex_Stub(CMOCK_FRAM_JOURNAL_EncodeIndex_CALLBACK Callback);
+#define FRAM_JOURNAL_EncodeIndex_StubWithCallback FRAM_JOURNAL_EncodeIndex_Stub
+#define FRAM_JOURNAL_EncodeIndex_ExpectAndThrow(pIndex, pAddress, cmock_to_throw) FRAM_JOURNAL_EncodeIndex_CMockExpectAndThrow(__LINE__, pIndex, pAddress, cmock_to_throw)
+void FRAM_JOURNAL_EncodeIndex_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t* pIndex, uint32_t* pAddress, CEXCEPTION_T cmock_to_throw);
+#define FRAM_JOURNAL_EncodeIndex_ReturnThruPtr_pIndex(pIndex) FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pIndex(__LINE__, pIndex, sizeof(uint8_t))
+#define FRAM_JOURNAL_EncodeIndex_ReturnArrayThruPtr_pIndex(pIndex, cmock_len) FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pIndex(__LINE__, pIndex, cmock_len * sizeof(*pIndex))
+#define FRAM_JOURNAL_EncodeIndex_ReturnMemThruPtr_pIndex(pIndex, cmock_size) FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pIndex(__LINE__, pIndex, cmock_size)
+void FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pIndex(UNITY_LINE_TYPE cmock_line, uint8_t* pIndex, size_t cmock_size);
+#define FRAM_JOURNAL_EncodeIndex_ReturnThruPtr_pAddress(pAddress) FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pAddress(__LINE__, pAddress, sizeof(uint32_t))
+#define FRAM_JOURNAL_EncodeIndex_ReturnArrayThruPtr_pAddress(pAddress, cmock_len) FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pAddress(__LINE__, pAddress, cmock_len * sizeof(*pAddress))
+#define FRAM_JOURNAL_EncodeIndex_ReturnMemThruPtr_pAddress(pAddress, cmock_size) FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pAddress(__LINE__, pAddress, cmock_size)
+void FRAM_JOURNAL_EncodeIndex_CMockReturnMemThruPtr_pAddress(UNITY_LINE_TYPE cmock_line, uint32_t* pAddress, size_t cmock_size);
+#define FRAM_JOURNAL_EncodeIndex_IgnoreArg_pIndex() FRAM_JOURNAL_EncodeIndex_CMockIgnoreArg_pIndex(__LINE__)
+void FRAM_JOURNAL_EncodeIndex_CMockIgnoreArg_pIndex(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_EncodeIndex_IgnoreArg_pAddress() FRAM_JOURNAL_EncodeIndex_CMockIgnoreArg_pAddress(__LINE__)
+void FRAM_JOURNAL_EncodeIndex_CMockIgnoreArg_pAddress(UNITY_LINE_TYPE cmock_line);
+#define FRAM_JOURNAL_CommitIndex_Ignore() FRAM_JOURNAL_CommitIndex_CMockIgnore()
+void FRAM_JOURNAL_CommitIndex_CMockIgnore(void);
+#define FRAM_JOURNAL_CommitIndex_StopIgnore() FRAM_JOURNAL_CommitIndex_CMockStopIgnore()
+void FRAM_JOURNAL_CommitIndex_CMockStopIgnore(void);
+#define FRAM_JOURNAL_CommitIndex_Expect() FRAM_JOURNAL_CommitIndex_CMockExpect(__LINE__)
+void FRAM_JOURNAL_CommitIndex_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_FRAM_JOURNAL_CommitIndex_CALLBACK)(int cmock_num_calls);
+void FRAM_JOURNAL_CommitIndex_AddCallback(CMOCK_FRAM_JOURNAL_CommitIndex_CALLBACK Callback);
+void FRAM_JOURNAL_CommitIndex_Stub(CMOCK_FRAM_JOURNAL_CommitIndex_CALLBACK Callback);
+#define FRAM_JOURNAL_CommitIndex_StubWithCallback FRAM_JOURNAL_CommitIndex_Stub
+#define FRAM_JOURNAL_CommitIndex_ExpectAndThrow(cmock_to_throw) FRAM_JOURNAL_CommitIndex_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void FRAM_JOURNAL_CommitIndex_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_FRAM_JOURNAL_CalculateCrc_IgnoreAndReturn(cmock_retval) TEST_FRAM_JOURNAL_CalculateCrc_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return);
+#define TEST_FRAM_JOURNAL_CalculateCrc_StopIgnore() TEST_FRAM_JOURNAL_CalculateCrc_CMockStopIgnore()
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockStopIgnore(void);
+#define TEST_FRAM_JOURNAL_CalculateCrc_ExpectAndReturn(pData, length, cmock_retval) TEST_FRAM_JOURNAL_CalculateCrc_CMockExpectAndReturn(__LINE__, pData, length, cmock_retval)
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const uint8_t* pData, uint16_t length, uint16_t cmock_to_return);
+typedef uint16_t (* CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALLBACK)(const uint8_t* pData, uint16_t length, int cmock_num_calls);
+void TEST_FRAM_JOURNAL_CalculateCrc_AddCallback(CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALLBACK Callback);
+void TEST_FRAM_JOURNAL_CalculateCrc_Stub(CMOCK_TEST_FRAM_JOURNAL_CalculateCrc_CALLBACK Callback);
+#define TEST_FRAM_JOURNAL_CalculateCrc_StubWithCallback TEST_FRAM_JOURNAL_CalculateCrc_Stub
+#define TEST_FRAM_JOURNAL_CalculateCrc_ExpectAndThrow(pData, length, cmock_to_throw) TEST_FRAM_JOURNAL_CalculateCrc_CMockExpectAndThrow(__LINE__, pData, length, cmock_to_throw)
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const uint8_t* pData, uint16_t length, CEXCEPTION_T cmock_to_throw);
+#define TEST_FRAM_JOURNAL_CalculateCrc_IgnoreArg_pData() TEST_FRAM_JOURNAL_CalculateCrc_CMockIgnoreArg_pData(__LINE__)
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockIgnoreArg_pData(UNITY_LINE_TYPE cmock_line);
+#define TEST_FRAM_JOURNAL_CalculateCrc_IgnoreArg_length() TEST_FRAM_JOURNAL_CalculateCrc_CMockIgnoreArg_length(__LINE__)
+void TEST_FRAM_JOURNAL_CalculateCrc_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
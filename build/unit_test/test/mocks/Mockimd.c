@@ -0,0 +1,150 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockimd.h"
+
+static const char* CMockString_IMD_Trigger = "IMD_Trigger";
+
+typedef struct _CMOCK_IMD_Trigger_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_IMD_Trigger_CALL_INSTANCE;
+
+static struct MockimdInstance
+{
+  char IMD_Trigger_IgnoreBool;
+  char IMD_Trigger_CallbackBool;
+  CMOCK_IMD_Trigger_CALLBACK IMD_Trigger_CallbackFunctionPointer;
+  int IMD_Trigger_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE IMD_Trigger_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockimd_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.IMD_Trigger_CallInstance;
+  if (Mock.IMD_Trigger_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_IMD_Trigger);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.IMD_Trigger_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockimd_Init(void)
+{
+  Mockimd_Destroy();
+}
+
+void Mockimd_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void IMD_Trigger(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_IMD_Trigger_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_IMD_Trigger);
+  cmock_call_instance = (CMOCK_IMD_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.IMD_Trigger_CallInstance);
+  Mock.IMD_Trigger_CallInstance = CMock_Guts_MemNext(Mock.IMD_Trigger_CallInstance);
+  if (Mock.IMD_Trigger_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.IMD_Trigger_CallbackBool &&
+      Mock.IMD_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.IMD_Trigger_CallbackFunctionPointer(Mock.IMD_Trigger_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.IMD_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.IMD_Trigger_CallbackFunctionPointer(Mock.IMD_Trigger_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void IMD_Trigger_CMockIgnore(void)
+{
+  Mock.IMD_Trigger_IgnoreBool = (char)1;
+}
+
+void IMD_Trigger_CMockStopIgnore(void)
+{
+  Mock.IMD_Trigger_IgnoreBool = (char)0;
+}
+
+void IMD_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_IMD_Trigger_CALL_INSTANCE));
+  CMOCK_IMD_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_IMD_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.IMD_Trigger_CallInstance = CMock_Guts_MemChain(Mock.IMD_Trigger_CallInstance, cmock_guts_index);
+  Mock.IMD_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void IMD_Trigger_AddCallback(CMOCK_IMD_Trigger_CALLBACK Callback)
+{
+  Mock.IMD_Trigger_IgnoreBool = (char)0;
+  Mock.IMD_Trigger_CallbackBool = (char)1;
+  Mock.IMD_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void IMD_Trigger_Stub(CMOCK_IMD_Trigger_CALLBACK Callback)
+{
+  Mock.IMD_Trigger_IgnoreBool = (char)0;
+  Mock.IMD_Trigger_CallbackBool = (char)0;
+  Mock.IMD_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void IMD_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_IMD_Trigger_CALL_INSTANCE));
+  CMOCK_IMD_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_IMD_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.IMD_Trigger_CallInstance = CMock_Guts_MemChain(Mock.IMD_Trigger_CallInstance, cmock_guts_index);
+  Mock.IMD_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
@@ -0,0 +1,58 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKIMD_H
+#define _MOCKIMD_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "imd.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockimd_Init(void);
+void Mockimd_Destroy(void);
+void Mockimd_Verify(void);
+
+
+
+
+#define IMD_Trigger_Ignore() IMD_Trigger_CMockIgnore()
+void IMD_Trigger_CMockIgnore(void);
+#define IMD_Trigger_StopIgnore() IMD_Trigger_CMockStopIgnore()
+void IMD_Trigger_CMockStopIgnore(void);
+#define IMD_Trigger_Expect() IMD_Trigger_CMockExpect(__LINE__)
+void IMD_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_IMD_Trigger_CALLBACK)(int cmock_num_calls);
+void IMD_Trigger_AddCallback(CMOCK_IMD_Trigger_CALLBACK Callback);
+void IMD_Trigger_Stub(CMOCK_IMD_Trigger_CALLBACK Callback);
+#define IMD_Trigger_StubWithCallback IMD_Trigger_Stub
+#define IMD_Trigger_ExpectAndThrow(cmock_to_throw) IMD_Trigger_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void IMD_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
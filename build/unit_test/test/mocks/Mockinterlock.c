@@ -0,0 +1,855 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockinterlock.h"
+
+static const char* CMockString_ILCK_GetInterlockFeedback = "ILCK_GetInterlockFeedback";
+static const char* CMockString_ILCK_GetState = "ILCK_GetState";
+static const char* CMockString_ILCK_Init = "ILCK_Init";
+static const char* CMockString_ILCK_SetStateRequest = "ILCK_SetStateRequest";
+static const char* CMockString_ILCK_Trigger = "ILCK_Trigger";
+static const char* CMockString_TEST_ILCK_SetStateStruct = "TEST_ILCK_SetStateStruct";
+static const char* CMockString_state = "state";
+static const char* CMockString_statereq = "statereq";
+
+typedef struct _CMOCK_ILCK_Init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_ILCK_Init_CALL_INSTANCE;
+
+typedef struct _CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  ILCK_ELECTRICAL_STATE_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE;
+
+typedef struct _CMOCK_ILCK_SetStateRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  ILCK_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  ILCK_STATE_REQUEST_e Expected_statereq;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_statereq;
+
+} CMOCK_ILCK_SetStateRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_ILCK_GetState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  ILCK_STATEMACH_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_ILCK_GetState_CALL_INSTANCE;
+
+typedef struct _CMOCK_ILCK_Trigger_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_ILCK_Trigger_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  ILCK_STATE_s Expected_state;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_state;
+
+} CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE;
+
+static struct MockinterlockInstance
+{
+  char ILCK_Init_IgnoreBool;
+  STD_RETURN_TYPE_e ILCK_Init_FinalReturn;
+  char ILCK_Init_CallbackBool;
+  CMOCK_ILCK_Init_CALLBACK ILCK_Init_CallbackFunctionPointer;
+  int ILCK_Init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE ILCK_Init_CallInstance;
+  char ILCK_GetInterlockFeedback_IgnoreBool;
+  ILCK_ELECTRICAL_STATE_TYPE_e ILCK_GetInterlockFeedback_FinalReturn;
+  char ILCK_GetInterlockFeedback_CallbackBool;
+  CMOCK_ILCK_GetInterlockFeedback_CALLBACK ILCK_GetInterlockFeedback_CallbackFunctionPointer;
+  int ILCK_GetInterlockFeedback_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE ILCK_GetInterlockFeedback_CallInstance;
+  char ILCK_SetStateRequest_IgnoreBool;
+  ILCK_RETURN_TYPE_e ILCK_SetStateRequest_FinalReturn;
+  char ILCK_SetStateRequest_CallbackBool;
+  CMOCK_ILCK_SetStateRequest_CALLBACK ILCK_SetStateRequest_CallbackFunctionPointer;
+  int ILCK_SetStateRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE ILCK_SetStateRequest_CallInstance;
+  char ILCK_GetState_IgnoreBool;
+  ILCK_STATEMACH_e ILCK_GetState_FinalReturn;
+  char ILCK_GetState_CallbackBool;
+  CMOCK_ILCK_GetState_CALLBACK ILCK_GetState_CallbackFunctionPointer;
+  int ILCK_GetState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE ILCK_GetState_CallInstance;
+  char ILCK_Trigger_IgnoreBool;
+  char ILCK_Trigger_CallbackBool;
+  CMOCK_ILCK_Trigger_CALLBACK ILCK_Trigger_CallbackFunctionPointer;
+  int ILCK_Trigger_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE ILCK_Trigger_CallInstance;
+  char TEST_ILCK_SetStateStruct_IgnoreBool;
+  char TEST_ILCK_SetStateStruct_CallbackBool;
+  CMOCK_TEST_ILCK_SetStateStruct_CALLBACK TEST_ILCK_SetStateStruct_CallbackFunctionPointer;
+  int TEST_ILCK_SetStateStruct_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_ILCK_SetStateStruct_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockinterlock_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.ILCK_Init_CallInstance;
+  if (Mock.ILCK_Init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_ILCK_Init);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.ILCK_Init_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.ILCK_GetInterlockFeedback_CallInstance;
+  if (Mock.ILCK_GetInterlockFeedback_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_ILCK_GetInterlockFeedback);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.ILCK_GetInterlockFeedback_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.ILCK_SetStateRequest_CallInstance;
+  if (Mock.ILCK_SetStateRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_ILCK_SetStateRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.ILCK_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.ILCK_GetState_CallInstance;
+  if (Mock.ILCK_GetState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_ILCK_GetState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.ILCK_GetState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.ILCK_Trigger_CallInstance;
+  if (Mock.ILCK_Trigger_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_ILCK_Trigger);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.ILCK_Trigger_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_ILCK_SetStateStruct_CallInstance;
+  if (Mock.TEST_ILCK_SetStateStruct_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_ILCK_SetStateStruct);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_ILCK_SetStateStruct_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockinterlock_Init(void)
+{
+  Mockinterlock_Destroy();
+}
+
+void Mockinterlock_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+STD_RETURN_TYPE_e ILCK_Init(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_ILCK_Init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_ILCK_Init);
+  cmock_call_instance = (CMOCK_ILCK_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.ILCK_Init_CallInstance);
+  Mock.ILCK_Init_CallInstance = CMock_Guts_MemNext(Mock.ILCK_Init_CallInstance);
+  if (Mock.ILCK_Init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.ILCK_Init_FinalReturn;
+    memcpy((void*)(&Mock.ILCK_Init_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.ILCK_Init_CallbackBool &&
+      Mock.ILCK_Init_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.ILCK_Init_CallbackFunctionPointer(Mock.ILCK_Init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.ILCK_Init_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.ILCK_Init_CallbackFunctionPointer(Mock.ILCK_Init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void ILCK_Init_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_Init_CALL_INSTANCE));
+  CMOCK_ILCK_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_Init_CallInstance = CMock_Guts_MemChain(Mock.ILCK_Init_CallInstance, cmock_guts_index);
+  Mock.ILCK_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.ILCK_Init_IgnoreBool = (char)1;
+}
+
+void ILCK_Init_CMockStopIgnore(void)
+{
+  if(Mock.ILCK_Init_IgnoreBool)
+    Mock.ILCK_Init_CallInstance = CMock_Guts_MemNext(Mock.ILCK_Init_CallInstance);
+  Mock.ILCK_Init_IgnoreBool = (char)0;
+}
+
+void ILCK_Init_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_Init_CALL_INSTANCE));
+  CMOCK_ILCK_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_Init_CallInstance = CMock_Guts_MemChain(Mock.ILCK_Init_CallInstance, cmock_guts_index);
+  Mock.ILCK_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void ILCK_Init_AddCallback(CMOCK_ILCK_Init_CALLBACK Callback)
+{
+  Mock.ILCK_Init_IgnoreBool = (char)0;
+  Mock.ILCK_Init_CallbackBool = (char)1;
+  Mock.ILCK_Init_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_Init_Stub(CMOCK_ILCK_Init_CALLBACK Callback)
+{
+  Mock.ILCK_Init_IgnoreBool = (char)0;
+  Mock.ILCK_Init_CallbackBool = (char)0;
+  Mock.ILCK_Init_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_Init_CALL_INSTANCE));
+  CMOCK_ILCK_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_Init_CallInstance = CMock_Guts_MemChain(Mock.ILCK_Init_CallInstance, cmock_guts_index);
+  Mock.ILCK_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+ILCK_ELECTRICAL_STATE_TYPE_e ILCK_GetInterlockFeedback(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_ILCK_GetInterlockFeedback);
+  cmock_call_instance = (CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.ILCK_GetInterlockFeedback_CallInstance);
+  Mock.ILCK_GetInterlockFeedback_CallInstance = CMock_Guts_MemNext(Mock.ILCK_GetInterlockFeedback_CallInstance);
+  if (Mock.ILCK_GetInterlockFeedback_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.ILCK_GetInterlockFeedback_FinalReturn;
+    memcpy((void*)(&Mock.ILCK_GetInterlockFeedback_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(ILCK_ELECTRICAL_STATE_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(ILCK_ELECTRICAL_STATE_TYPE_e) ? 1 : -1])); /* add ILCK_ELECTRICAL_STATE_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.ILCK_GetInterlockFeedback_CallbackBool &&
+      Mock.ILCK_GetInterlockFeedback_CallbackFunctionPointer != NULL)
+  {
+    ILCK_ELECTRICAL_STATE_TYPE_e cmock_cb_ret = Mock.ILCK_GetInterlockFeedback_CallbackFunctionPointer(Mock.ILCK_GetInterlockFeedback_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.ILCK_GetInterlockFeedback_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.ILCK_GetInterlockFeedback_CallbackFunctionPointer(Mock.ILCK_GetInterlockFeedback_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void ILCK_GetInterlockFeedback_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_ELECTRICAL_STATE_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE));
+  CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_GetInterlockFeedback_CallInstance = CMock_Guts_MemChain(Mock.ILCK_GetInterlockFeedback_CallInstance, cmock_guts_index);
+  Mock.ILCK_GetInterlockFeedback_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.ILCK_GetInterlockFeedback_IgnoreBool = (char)1;
+}
+
+void ILCK_GetInterlockFeedback_CMockStopIgnore(void)
+{
+  if(Mock.ILCK_GetInterlockFeedback_IgnoreBool)
+    Mock.ILCK_GetInterlockFeedback_CallInstance = CMock_Guts_MemNext(Mock.ILCK_GetInterlockFeedback_CallInstance);
+  Mock.ILCK_GetInterlockFeedback_IgnoreBool = (char)0;
+}
+
+void ILCK_GetInterlockFeedback_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_ELECTRICAL_STATE_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE));
+  CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_GetInterlockFeedback_CallInstance = CMock_Guts_MemChain(Mock.ILCK_GetInterlockFeedback_CallInstance, cmock_guts_index);
+  Mock.ILCK_GetInterlockFeedback_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(ILCK_ELECTRICAL_STATE_TYPE_e[sizeof(cmock_to_return) == sizeof(ILCK_ELECTRICAL_STATE_TYPE_e) ? 1 : -1])); /* add ILCK_ELECTRICAL_STATE_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void ILCK_GetInterlockFeedback_AddCallback(CMOCK_ILCK_GetInterlockFeedback_CALLBACK Callback)
+{
+  Mock.ILCK_GetInterlockFeedback_IgnoreBool = (char)0;
+  Mock.ILCK_GetInterlockFeedback_CallbackBool = (char)1;
+  Mock.ILCK_GetInterlockFeedback_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_GetInterlockFeedback_Stub(CMOCK_ILCK_GetInterlockFeedback_CALLBACK Callback)
+{
+  Mock.ILCK_GetInterlockFeedback_IgnoreBool = (char)0;
+  Mock.ILCK_GetInterlockFeedback_CallbackBool = (char)0;
+  Mock.ILCK_GetInterlockFeedback_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_GetInterlockFeedback_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE));
+  CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_GetInterlockFeedback_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_GetInterlockFeedback_CallInstance = CMock_Guts_MemChain(Mock.ILCK_GetInterlockFeedback_CallInstance, cmock_guts_index);
+  Mock.ILCK_GetInterlockFeedback_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+ILCK_RETURN_TYPE_e ILCK_SetStateRequest(ILCK_STATE_REQUEST_e statereq)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_ILCK_SetStateRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_ILCK_SetStateRequest);
+  cmock_call_instance = (CMOCK_ILCK_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.ILCK_SetStateRequest_CallInstance);
+  Mock.ILCK_SetStateRequest_CallInstance = CMock_Guts_MemNext(Mock.ILCK_SetStateRequest_CallInstance);
+  if (Mock.ILCK_SetStateRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.ILCK_SetStateRequest_FinalReturn;
+    memcpy((void*)(&Mock.ILCK_SetStateRequest_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(ILCK_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(ILCK_RETURN_TYPE_e) ? 1 : -1])); /* add ILCK_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.ILCK_SetStateRequest_CallbackBool &&
+      Mock.ILCK_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    ILCK_RETURN_TYPE_e cmock_cb_ret = Mock.ILCK_SetStateRequest_CallbackFunctionPointer(statereq, Mock.ILCK_SetStateRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_statereq)
+  {
+    UNITY_SET_DETAILS(CMockString_ILCK_SetStateRequest,CMockString_statereq);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_statereq), (void*)(&statereq), sizeof(ILCK_STATE_REQUEST_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.ILCK_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.ILCK_SetStateRequest_CallbackFunctionPointer(statereq, Mock.ILCK_SetStateRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_ILCK_SetStateRequest(CMOCK_ILCK_SetStateRequest_CALL_INSTANCE* cmock_call_instance, ILCK_STATE_REQUEST_e statereq);
+void CMockExpectParameters_ILCK_SetStateRequest(CMOCK_ILCK_SetStateRequest_CALL_INSTANCE* cmock_call_instance, ILCK_STATE_REQUEST_e statereq)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_statereq), (void*)(&statereq),
+         sizeof(ILCK_STATE_REQUEST_e[sizeof(statereq) == sizeof(ILCK_STATE_REQUEST_e) ? 1 : -1])); /* add ILCK_STATE_REQUEST_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_statereq = 0;
+}
+
+void ILCK_SetStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_SetStateRequest_CALL_INSTANCE));
+  CMOCK_ILCK_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.ILCK_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.ILCK_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.ILCK_SetStateRequest_IgnoreBool = (char)1;
+}
+
+void ILCK_SetStateRequest_CMockStopIgnore(void)
+{
+  if(Mock.ILCK_SetStateRequest_IgnoreBool)
+    Mock.ILCK_SetStateRequest_CallInstance = CMock_Guts_MemNext(Mock.ILCK_SetStateRequest_CallInstance);
+  Mock.ILCK_SetStateRequest_IgnoreBool = (char)0;
+}
+
+void ILCK_SetStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_STATE_REQUEST_e statereq, ILCK_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_SetStateRequest_CALL_INSTANCE));
+  CMOCK_ILCK_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.ILCK_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.ILCK_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_ILCK_SetStateRequest(cmock_call_instance, statereq);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(ILCK_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(ILCK_RETURN_TYPE_e) ? 1 : -1])); /* add ILCK_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void ILCK_SetStateRequest_AddCallback(CMOCK_ILCK_SetStateRequest_CALLBACK Callback)
+{
+  Mock.ILCK_SetStateRequest_IgnoreBool = (char)0;
+  Mock.ILCK_SetStateRequest_CallbackBool = (char)1;
+  Mock.ILCK_SetStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_SetStateRequest_Stub(CMOCK_ILCK_SetStateRequest_CALLBACK Callback)
+{
+  Mock.ILCK_SetStateRequest_IgnoreBool = (char)0;
+  Mock.ILCK_SetStateRequest_CallbackBool = (char)0;
+  Mock.ILCK_SetStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_SetStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, ILCK_STATE_REQUEST_e statereq, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_SetStateRequest_CALL_INSTANCE));
+  CMOCK_ILCK_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.ILCK_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.ILCK_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_ILCK_SetStateRequest(cmock_call_instance, statereq);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void ILCK_SetStateRequest_CMockIgnoreArg_statereq(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_ILCK_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.ILCK_SetStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_statereq = 1;
+}
+
+ILCK_STATEMACH_e ILCK_GetState(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_ILCK_GetState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_ILCK_GetState);
+  cmock_call_instance = (CMOCK_ILCK_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.ILCK_GetState_CallInstance);
+  Mock.ILCK_GetState_CallInstance = CMock_Guts_MemNext(Mock.ILCK_GetState_CallInstance);
+  if (Mock.ILCK_GetState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.ILCK_GetState_FinalReturn;
+    memcpy((void*)(&Mock.ILCK_GetState_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(ILCK_STATEMACH_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(ILCK_STATEMACH_e) ? 1 : -1])); /* add ILCK_STATEMACH_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.ILCK_GetState_CallbackBool &&
+      Mock.ILCK_GetState_CallbackFunctionPointer != NULL)
+  {
+    ILCK_STATEMACH_e cmock_cb_ret = Mock.ILCK_GetState_CallbackFunctionPointer(Mock.ILCK_GetState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.ILCK_GetState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.ILCK_GetState_CallbackFunctionPointer(Mock.ILCK_GetState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void ILCK_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_STATEMACH_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_GetState_CALL_INSTANCE));
+  CMOCK_ILCK_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_GetState_CallInstance = CMock_Guts_MemChain(Mock.ILCK_GetState_CallInstance, cmock_guts_index);
+  Mock.ILCK_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.ILCK_GetState_IgnoreBool = (char)1;
+}
+
+void ILCK_GetState_CMockStopIgnore(void)
+{
+  if(Mock.ILCK_GetState_IgnoreBool)
+    Mock.ILCK_GetState_CallInstance = CMock_Guts_MemNext(Mock.ILCK_GetState_CallInstance);
+  Mock.ILCK_GetState_IgnoreBool = (char)0;
+}
+
+void ILCK_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_STATEMACH_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_GetState_CALL_INSTANCE));
+  CMOCK_ILCK_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_GetState_CallInstance = CMock_Guts_MemChain(Mock.ILCK_GetState_CallInstance, cmock_guts_index);
+  Mock.ILCK_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(ILCK_STATEMACH_e[sizeof(cmock_to_return) == sizeof(ILCK_STATEMACH_e) ? 1 : -1])); /* add ILCK_STATEMACH_e to :treat_as_array if this causes an error */
+}
+
+void ILCK_GetState_AddCallback(CMOCK_ILCK_GetState_CALLBACK Callback)
+{
+  Mock.ILCK_GetState_IgnoreBool = (char)0;
+  Mock.ILCK_GetState_CallbackBool = (char)1;
+  Mock.ILCK_GetState_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_GetState_Stub(CMOCK_ILCK_GetState_CALLBACK Callback)
+{
+  Mock.ILCK_GetState_IgnoreBool = (char)0;
+  Mock.ILCK_GetState_CallbackBool = (char)0;
+  Mock.ILCK_GetState_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_GetState_CALL_INSTANCE));
+  CMOCK_ILCK_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_GetState_CallInstance = CMock_Guts_MemChain(Mock.ILCK_GetState_CallInstance, cmock_guts_index);
+  Mock.ILCK_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void ILCK_Trigger(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_ILCK_Trigger_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_ILCK_Trigger);
+  cmock_call_instance = (CMOCK_ILCK_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.ILCK_Trigger_CallInstance);
+  Mock.ILCK_Trigger_CallInstance = CMock_Guts_MemNext(Mock.ILCK_Trigger_CallInstance);
+  if (Mock.ILCK_Trigger_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.ILCK_Trigger_CallbackBool &&
+      Mock.ILCK_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.ILCK_Trigger_CallbackFunctionPointer(Mock.ILCK_Trigger_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.ILCK_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.ILCK_Trigger_CallbackFunctionPointer(Mock.ILCK_Trigger_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void ILCK_Trigger_CMockIgnore(void)
+{
+  Mock.ILCK_Trigger_IgnoreBool = (char)1;
+}
+
+void ILCK_Trigger_CMockStopIgnore(void)
+{
+  Mock.ILCK_Trigger_IgnoreBool = (char)0;
+}
+
+void ILCK_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_Trigger_CALL_INSTANCE));
+  CMOCK_ILCK_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_Trigger_CallInstance = CMock_Guts_MemChain(Mock.ILCK_Trigger_CallInstance, cmock_guts_index);
+  Mock.ILCK_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void ILCK_Trigger_AddCallback(CMOCK_ILCK_Trigger_CALLBACK Callback)
+{
+  Mock.ILCK_Trigger_IgnoreBool = (char)0;
+  Mock.ILCK_Trigger_CallbackBool = (char)1;
+  Mock.ILCK_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_Trigger_Stub(CMOCK_ILCK_Trigger_CALLBACK Callback)
+{
+  Mock.ILCK_Trigger_IgnoreBool = (char)0;
+  Mock.ILCK_Trigger_CallbackBool = (char)0;
+  Mock.ILCK_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void ILCK_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_ILCK_Trigger_CALL_INSTANCE));
+  CMOCK_ILCK_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_ILCK_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.ILCK_Trigger_CallInstance = CMock_Guts_MemChain(Mock.ILCK_Trigger_CallInstance, cmock_guts_index);
+  Mock.ILCK_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_ILCK_SetStateStruct(ILCK_STATE_s state)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_ILCK_SetStateStruct);
+  cmock_call_instance = (CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_ILCK_SetStateStruct_CallInstance);
+  Mock.TEST_ILCK_SetStateStruct_CallInstance = CMock_Guts_MemNext(Mock.TEST_ILCK_SetStateStruct_CallInstance);
+  if (Mock.TEST_ILCK_SetStateStruct_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_ILCK_SetStateStruct_CallbackBool &&
+      Mock.TEST_ILCK_SetStateStruct_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_ILCK_SetStateStruct_CallbackFunctionPointer(state, Mock.TEST_ILCK_SetStateStruct_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_state)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_ILCK_SetStateStruct,CMockString_state);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_state), (void*)(&state), sizeof(ILCK_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_ILCK_SetStateStruct_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_ILCK_SetStateStruct_CallbackFunctionPointer(state, Mock.TEST_ILCK_SetStateStruct_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_ILCK_SetStateStruct(CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE* cmock_call_instance, ILCK_STATE_s state);
+void CMockExpectParameters_TEST_ILCK_SetStateStruct(CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE* cmock_call_instance, ILCK_STATE_s state)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_state), (void*)(&state),
+         sizeof(ILCK_STATE_s[sizeof(state) == sizeof(ILCK_STATE_s) ? 1 : -1])); /* add ILCK_STATE_s to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_state = 0;
+}
+
+void TEST_ILCK_SetStateStruct_CMockIgnore(void)
+{
+  Mock.TEST_ILCK_SetStateStruct_IgnoreBool = (char)1;
+}
+
+void TEST_ILCK_SetStateStruct_CMockStopIgnore(void)
+{
+  Mock.TEST_ILCK_SetStateStruct_IgnoreBool = (char)0;
+}
+
+void TEST_ILCK_SetStateStruct_CMockExpect(UNITY_LINE_TYPE cmock_line, ILCK_STATE_s state)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE));
+  CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_ILCK_SetStateStruct_CallInstance = CMock_Guts_MemChain(Mock.TEST_ILCK_SetStateStruct_CallInstance, cmock_guts_index);
+  Mock.TEST_ILCK_SetStateStruct_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_ILCK_SetStateStruct(cmock_call_instance, state);
+}
+
+void TEST_ILCK_SetStateStruct_AddCallback(CMOCK_TEST_ILCK_SetStateStruct_CALLBACK Callback)
+{
+  Mock.TEST_ILCK_SetStateStruct_IgnoreBool = (char)0;
+  Mock.TEST_ILCK_SetStateStruct_CallbackBool = (char)1;
+  Mock.TEST_ILCK_SetStateStruct_CallbackFunctionPointer = Callback;
+}
+
+void TEST_ILCK_SetStateStruct_Stub(CMOCK_TEST_ILCK_SetStateStruct_CALLBACK Callback)
+{
+  Mock.TEST_ILCK_SetStateStruct_IgnoreBool = (char)0;
+  Mock.TEST_ILCK_SetStateStruct_CallbackBool = (char)0;
+  Mock.TEST_ILCK_SetStateStruct_CallbackFunctionPointer = Callback;
+}
+
+void TEST_ILCK_SetStateStruct_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, ILCK_STATE_s state, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE));
+  CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_ILCK_SetStateStruct_CallInstance = CMock_Guts_MemChain(Mock.TEST_ILCK_SetStateStruct_CallInstance, cmock_guts_index);
+  Mock.TEST_ILCK_SetStateStruct_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_ILCK_SetStateStruct(cmock_call_instance, state);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_ILCK_SetStateStruct_CMockIgnoreArg_state(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_ILCK_SetStateStruct_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_ILCK_SetStateStruct_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_state = 1;
+}
+
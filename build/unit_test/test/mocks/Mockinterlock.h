@@ -0,0 +1,122 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKINTERLOCK_H
+#define _MOCKINTERLOCK_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "interlock.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockinterlock_Init(void);
+void Mockinterlock_Destroy(void);
+void Mockinterlock_Verify(void);
+
+
+
+
+#define ILCK_Init_IgnoreAndReturn(cmock_retval) ILCK_Init_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void ILCK_Init_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define ILCK_Init_StopIgnore() ILCK_Init_CMockStopIgnore()
+void ILCK_Init_CMockStopIgnore(void);
+#define ILCK_Init_ExpectAndReturn(cmock_retval) ILCK_Init_CMockExpectAndReturn(__LINE__, cmock_retval)
+void ILCK_Init_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_ILCK_Init_CALLBACK)(int cmock_num_calls);
+void ILCK_Init_AddCallback(CMOCK_ILCK_Init_CALLBACK Callback);
+void ILCK_Init_Stub(CMOCK_ILCK_Init_CALLBACK Callback);
+#define ILCK_Init_StubWithCallback ILCK_Init_Stub
+#define ILCK_Init_ExpectAndThrow(cmock_to_throw) ILCK_Init_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void ILCK_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define ILCK_GetInterlockFeedback_IgnoreAndReturn(cmock_retval) ILCK_GetInterlockFeedback_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void ILCK_GetInterlockFeedback_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_ELECTRICAL_STATE_TYPE_e cmock_to_return);
+#define ILCK_GetInterlockFeedback_StopIgnore() ILCK_GetInterlockFeedback_CMockStopIgnore()
+void ILCK_GetInterlockFeedback_CMockStopIgnore(void);
+#define ILCK_GetInterlockFeedback_ExpectAndReturn(cmock_retval) ILCK_GetInterlockFeedback_CMockExpectAndReturn(__LINE__, cmock_retval)
+void ILCK_GetInterlockFeedback_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_ELECTRICAL_STATE_TYPE_e cmock_to_return);
+typedef ILCK_ELECTRICAL_STATE_TYPE_e (* CMOCK_ILCK_GetInterlockFeedback_CALLBACK)(int cmock_num_calls);
+void ILCK_GetInterlockFeedback_AddCallback(CMOCK_ILCK_GetInterlockFeedback_CALLBACK Callback);
+void ILCK_GetInterlockFeedback_Stub(CMOCK_ILCK_GetInterlockFeedback_CALLBACK Callback);
+#define ILCK_GetInterlockFeedback_StubWithCallback ILCK_GetInterlockFeedback_Stub
+#define ILCK_GetInterlockFeedback_ExpectAndThrow(cmock_to_throw) ILCK_GetInterlockFeedback_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void ILCK_GetInterlockFeedback_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define ILCK_SetStateRequest_IgnoreAndReturn(cmock_retval) ILCK_SetStateRequest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void ILCK_SetStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_RETURN_TYPE_e cmock_to_return);
+#define ILCK_SetStateRequest_StopIgnore() ILCK_SetStateRequest_CMockStopIgnore()
+void ILCK_SetStateRequest_CMockStopIgnore(void);
+#define ILCK_SetStateRequest_ExpectAndReturn(statereq, cmock_retval) ILCK_SetStateRequest_CMockExpectAndReturn(__LINE__, statereq, cmock_retval)
+void ILCK_SetStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_STATE_REQUEST_e statereq, ILCK_RETURN_TYPE_e cmock_to_return);
+typedef ILCK_RETURN_TYPE_e (* CMOCK_ILCK_SetStateRequest_CALLBACK)(ILCK_STATE_REQUEST_e statereq, int cmock_num_calls);
+void ILCK_SetStateRequest_AddCallback(CMOCK_ILCK_SetStateRequest_CALLBACK Callback);
+void ILCK_SetStateRequest_Stub(CMOCK_ILCK_SetStateRequest_CALLBACK Callback);
+#define ILCK_SetStateRequest_StubWithCallback ILCK_SetStateRequest_Stub
+#define ILCK_SetStateRequest_ExpectAndThrow(statereq, cmock_to_throw) ILCK_SetStateRequest_CMockExpectAndThrow(__LINE__, statereq, cmock_to_throw)
+void ILCK_SetStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, ILCK_STATE_REQUEST_e statereq, CEXCEPTION_T cmock_to_throw);
+#define ILCK_SetStateRequest_IgnoreArg_statereq() ILCK_SetStateRequest_CMockIgnoreArg_statereq(__LINE__)
+void ILCK_SetStateRequest_CMockIgnoreArg_statereq(UNITY_LINE_TYPE cmock_line);
+#define ILCK_GetState_IgnoreAndReturn(cmock_retval) ILCK_GetState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void ILCK_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_STATEMACH_e cmock_to_return);
+#define ILCK_GetState_StopIgnore() ILCK_GetState_CMockStopIgnore()
+void ILCK_GetState_CMockStopIgnore(void);
+#define ILCK_GetState_ExpectAndReturn(cmock_retval) ILCK_GetState_CMockExpectAndReturn(__LINE__, cmock_retval)
+void ILCK_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, ILCK_STATEMACH_e cmock_to_return);
+typedef ILCK_STATEMACH_e (* CMOCK_ILCK_GetState_CALLBACK)(int cmock_num_calls);
+void ILCK_GetState_AddCallback(CMOCK_ILCK_GetState_CALLBACK Callback);
+void ILCK_GetState_Stub(CMOCK_ILCK_GetState_CALLBACK Callback);
+#define ILCK_GetState_StubWithCallback ILCK_GetState_Stub
+#define ILCK_GetState_ExpectAndThrow(cmock_to_throw) ILCK_GetState_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void ILCK_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define ILCK_Trigger_Ignore() ILCK_Trigger_CMockIgnore()
+void ILCK_Trigger_CMockIgnore(void);
+#define ILCK_Trigger_StopIgnore() ILCK_Trigger_CMockStopIgnore()
+void ILCK_Trigger_CMockStopIgnore(void);
+#define ILCK_Trigger_Expect() ILCK_Trigger_CMockExpect(__LINE__)
+void ILCK_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_ILCK_Trigger_CALLBACK)(int cmock_num_calls);
+void ILCK_Trigger_AddCallback(CMOCK_ILCK_Trigger_CALLBACK Callback);
+void ILCK_Trigger_Stub(CMOCK_ILCK_Trigger_CALLBACK Callback);
+#define ILCK_Trigger_StubWithCallback ILCK_Trigger_Stub
+#define ILCK_Trigger_ExpectAndThrow(cmock_to_throw) ILCK_Trigger_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void ILCK_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_ILCK_SetStateStruct_Ignore() TEST_ILCK_SetStateStruct_CMockIgnore()
+void TEST_ILCK_SetStateStruct_CMockIgnore(void);
+#define TEST_ILCK_SetStateStruct_StopIgnore() TEST_ILCK_SetStateStruct_CMockStopIgnore()
+void TEST_ILCK_SetStateStruct_CMockStopIgnore(void);
+#define TEST_ILCK_SetStateStruct_Expect(state) TEST_ILCK_SetStateStruct_CMockExpect(__LINE__, state)
+void TEST_ILCK_SetStateStruct_CMockExpect(UNITY_LINE_TYPE cmock_line, ILCK_STATE_s state);
+typedef void (* CMOCK_TEST_ILCK_SetStateStruct_CALLBACK)(ILCK_STATE_s state, int cmock_num_calls);
+void TEST_ILCK_SetStateStruct_AddCallback(CMOCK_TEST_ILCK_SetStateStruct_CALLBACK Callback);
+void TEST_ILCK_SetStateStruct_Stub(CMOCK_TEST_ILCK_SetStateStruct_CALLBACK Callback);
+#define TEST_ILCK_SetStateStruct_StubWithCallback TEST_ILCK_SetStateStruct_Stub
+#define TEST_ILCK_SetStateStruct_ExpectAndThrow(state, cmock_to_throw) TEST_ILCK_SetStateStruct_CMockExpectAndThrow(__LINE__, state, cmock_to_throw)
+void TEST_ILCK_SetStateStruct_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, ILCK_STATE_s state, CEXCEPTION_T cmock_to_throw);
+#define TEST_ILCK_SetStateStruct_IgnoreArg_state() TEST_ILCK_SetStateStruct_CMockIgnoreArg_state(__LINE__)
+void TEST_ILCK_SetStateStruct_CMockIgnoreArg_state(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
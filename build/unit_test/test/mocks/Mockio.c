@@ -0,0 +1,564 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockio.h"
+
+static const char* CMockString_IO_PinGet = "IO_PinGet";
+static const char* CMockString_IO_PinReset = "IO_PinReset";
+static const char* CMockString_IO_PinSet = "IO_PinSet";
+static const char* CMockString_pRegisterAddress = "pRegisterAddress";
+static const char* CMockString_pin = "pin";
+
+typedef struct _CMOCK_IO_PinSet_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint32_t* Expected_pRegisterAddress;
+  uint32_t Expected_pin;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pRegisterAddress_Used;
+  uint32_t* ReturnThruPtr_pRegisterAddress_Val;
+  size_t ReturnThruPtr_pRegisterAddress_Size;
+  char IgnoreArg_pRegisterAddress;
+  char IgnoreArg_pin;
+
+} CMOCK_IO_PinSet_CALL_INSTANCE;
+
+typedef struct _CMOCK_IO_PinReset_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint32_t* Expected_pRegisterAddress;
+  uint32_t Expected_pin;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pRegisterAddress_Used;
+  uint32_t* ReturnThruPtr_pRegisterAddress_Val;
+  size_t ReturnThruPtr_pRegisterAddress_Size;
+  char IgnoreArg_pRegisterAddress;
+  char IgnoreArg_pin;
+
+} CMOCK_IO_PinReset_CALL_INSTANCE;
+
+typedef struct _CMOCK_IO_PinGet_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint8_t ReturnVal;
+  int CallOrder;
+  const uint32_t* Expected_pRegisterAddress;
+  uint32_t Expected_pin;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_pRegisterAddress;
+  char IgnoreArg_pin;
+
+} CMOCK_IO_PinGet_CALL_INSTANCE;
+
+static struct MockioInstance
+{
+  char IO_PinSet_IgnoreBool;
+  char IO_PinSet_CallbackBool;
+  CMOCK_IO_PinSet_CALLBACK IO_PinSet_CallbackFunctionPointer;
+  int IO_PinSet_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE IO_PinSet_CallInstance;
+  char IO_PinReset_IgnoreBool;
+  char IO_PinReset_CallbackBool;
+  CMOCK_IO_PinReset_CALLBACK IO_PinReset_CallbackFunctionPointer;
+  int IO_PinReset_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE IO_PinReset_CallInstance;
+  char IO_PinGet_IgnoreBool;
+  uint8_t IO_PinGet_FinalReturn;
+  char IO_PinGet_CallbackBool;
+  CMOCK_IO_PinGet_CALLBACK IO_PinGet_CallbackFunctionPointer;
+  int IO_PinGet_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE IO_PinGet_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockio_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.IO_PinSet_CallInstance;
+  if (Mock.IO_PinSet_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_IO_PinSet);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.IO_PinSet_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.IO_PinReset_CallInstance;
+  if (Mock.IO_PinReset_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_IO_PinReset);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.IO_PinReset_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.IO_PinGet_CallInstance;
+  if (Mock.IO_PinGet_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_IO_PinGet);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.IO_PinGet_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockio_Init(void)
+{
+  Mockio_Destroy();
+}
+
+void Mockio_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void IO_PinSet(uint32_t* pRegisterAddress, uint32_t pin)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_IO_PinSet_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_IO_PinSet);
+  cmock_call_instance = (CMOCK_IO_PinSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.IO_PinSet_CallInstance);
+  Mock.IO_PinSet_CallInstance = CMock_Guts_MemNext(Mock.IO_PinSet_CallInstance);
+  if (Mock.IO_PinSet_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.IO_PinSet_CallbackBool &&
+      Mock.IO_PinSet_CallbackFunctionPointer != NULL)
+  {
+    Mock.IO_PinSet_CallbackFunctionPointer(pRegisterAddress, pin, Mock.IO_PinSet_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pRegisterAddress)
+  {
+    UNITY_SET_DETAILS(CMockString_IO_PinSet,CMockString_pRegisterAddress);
+    if (cmock_call_instance->Expected_pRegisterAddress == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRegisterAddress, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pRegisterAddress, pRegisterAddress, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pin)
+  {
+    UNITY_SET_DETAILS(CMockString_IO_PinSet,CMockString_pin);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_pin, pin, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.IO_PinSet_CallbackFunctionPointer != NULL)
+  {
+    Mock.IO_PinSet_CallbackFunctionPointer(pRegisterAddress, pin, Mock.IO_PinSet_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRegisterAddress_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRegisterAddress, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRegisterAddress, (void*)cmock_call_instance->ReturnThruPtr_pRegisterAddress_Val,
+      cmock_call_instance->ReturnThruPtr_pRegisterAddress_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_IO_PinSet(CMOCK_IO_PinSet_CALL_INSTANCE* cmock_call_instance, uint32_t* pRegisterAddress, uint32_t pin);
+void CMockExpectParameters_IO_PinSet(CMOCK_IO_PinSet_CALL_INSTANCE* cmock_call_instance, uint32_t* pRegisterAddress, uint32_t pin)
+{
+  cmock_call_instance->Expected_pRegisterAddress = pRegisterAddress;
+  cmock_call_instance->IgnoreArg_pRegisterAddress = 0;
+  cmock_call_instance->ReturnThruPtr_pRegisterAddress_Used = 0;
+  cmock_call_instance->Expected_pin = pin;
+  cmock_call_instance->IgnoreArg_pin = 0;
+}
+
+void IO_PinSet_CMockIgnore(void)
+{
+  Mock.IO_PinSet_IgnoreBool = (char)1;
+}
+
+void IO_PinSet_CMockStopIgnore(void)
+{
+  Mock.IO_PinSet_IgnoreBool = (char)0;
+}
+
+void IO_PinSet_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, uint32_t pin)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_IO_PinSet_CALL_INSTANCE));
+  CMOCK_IO_PinSet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.IO_PinSet_CallInstance = CMock_Guts_MemChain(Mock.IO_PinSet_CallInstance, cmock_guts_index);
+  Mock.IO_PinSet_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_IO_PinSet(cmock_call_instance, pRegisterAddress, pin);
+}
+
+void IO_PinSet_AddCallback(CMOCK_IO_PinSet_CALLBACK Callback)
+{
+  Mock.IO_PinSet_IgnoreBool = (char)0;
+  Mock.IO_PinSet_CallbackBool = (char)1;
+  Mock.IO_PinSet_CallbackFunctionPointer = Callback;
+}
+
+void IO_PinSet_Stub(CMOCK_IO_PinSet_CALLBACK Callback)
+{
+  Mock.IO_PinSet_IgnoreBool = (char)0;
+  Mock.IO_PinSet_CallbackBool = (char)0;
+  Mock.IO_PinSet_CallbackFunctionPointer = Callback;
+}
+
+void IO_PinSet_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, uint32_t pin, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_IO_PinSet_CALL_INSTANCE));
+  CMOCK_IO_PinSet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.IO_PinSet_CallInstance = CMock_Guts_MemChain(Mock.IO_PinSet_CallInstance, cmock_guts_index);
+  Mock.IO_PinSet_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_IO_PinSet(cmock_call_instance, pRegisterAddress, pin);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void IO_PinSet_CMockReturnMemThruPtr_pRegisterAddress(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, size_t cmock_size)
+{
+  CMOCK_IO_PinSet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.IO_PinSet_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRegisterAddress_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRegisterAddress_Val = pRegisterAddress;
+  cmock_call_instance->ReturnThruPtr_pRegisterAddress_Size = cmock_size;
+}
+
+void IO_PinSet_CMockIgnoreArg_pRegisterAddress(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_IO_PinSet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.IO_PinSet_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRegisterAddress = 1;
+}
+
+void IO_PinSet_CMockIgnoreArg_pin(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_IO_PinSet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinSet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.IO_PinSet_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pin = 1;
+}
+
+void IO_PinReset(uint32_t* pRegisterAddress, uint32_t pin)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_IO_PinReset_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_IO_PinReset);
+  cmock_call_instance = (CMOCK_IO_PinReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.IO_PinReset_CallInstance);
+  Mock.IO_PinReset_CallInstance = CMock_Guts_MemNext(Mock.IO_PinReset_CallInstance);
+  if (Mock.IO_PinReset_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.IO_PinReset_CallbackBool &&
+      Mock.IO_PinReset_CallbackFunctionPointer != NULL)
+  {
+    Mock.IO_PinReset_CallbackFunctionPointer(pRegisterAddress, pin, Mock.IO_PinReset_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pRegisterAddress)
+  {
+    UNITY_SET_DETAILS(CMockString_IO_PinReset,CMockString_pRegisterAddress);
+    if (cmock_call_instance->Expected_pRegisterAddress == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRegisterAddress, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pRegisterAddress, pRegisterAddress, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pin)
+  {
+    UNITY_SET_DETAILS(CMockString_IO_PinReset,CMockString_pin);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_pin, pin, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.IO_PinReset_CallbackFunctionPointer != NULL)
+  {
+    Mock.IO_PinReset_CallbackFunctionPointer(pRegisterAddress, pin, Mock.IO_PinReset_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRegisterAddress_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRegisterAddress, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRegisterAddress, (void*)cmock_call_instance->ReturnThruPtr_pRegisterAddress_Val,
+      cmock_call_instance->ReturnThruPtr_pRegisterAddress_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_IO_PinReset(CMOCK_IO_PinReset_CALL_INSTANCE* cmock_call_instance, uint32_t* pRegisterAddress, uint32_t pin);
+void CMockExpectParameters_IO_PinReset(CMOCK_IO_PinReset_CALL_INSTANCE* cmock_call_instance, uint32_t* pRegisterAddress, uint32_t pin)
+{
+  cmock_call_instance->Expected_pRegisterAddress = pRegisterAddress;
+  cmock_call_instance->IgnoreArg_pRegisterAddress = 0;
+  cmock_call_instance->ReturnThruPtr_pRegisterAddress_Used = 0;
+  cmock_call_instance->Expected_pin = pin;
+  cmock_call_instance->IgnoreArg_pin = 0;
+}
+
+void IO_PinReset_CMockIgnore(void)
+{
+  Mock.IO_PinReset_IgnoreBool = (char)1;
+}
+
+void IO_PinReset_CMockStopIgnore(void)
+{
+  Mock.IO_PinReset_IgnoreBool = (char)0;
+}
+
+void IO_PinReset_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, uint32_t pin)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_IO_PinReset_CALL_INSTANCE));
+  CMOCK_IO_PinReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.IO_PinReset_CallInstance = CMock_Guts_MemChain(Mock.IO_PinReset_CallInstance, cmock_guts_index);
+  Mock.IO_PinReset_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_IO_PinReset(cmock_call_instance, pRegisterAddress, pin);
+}
+
+void IO_PinReset_AddCallback(CMOCK_IO_PinReset_CALLBACK Callback)
+{
+  Mock.IO_PinReset_IgnoreBool = (char)0;
+  Mock.IO_PinReset_CallbackBool = (char)1;
+  Mock.IO_PinReset_CallbackFunctionPointer = Callback;
+}
+
+void IO_PinReset_Stub(CMOCK_IO_PinReset_CALLBACK Callback)
+{
+  Mock.IO_PinReset_IgnoreBool = (char)0;
+  Mock.IO_PinReset_CallbackBool = (char)0;
+  Mock.IO_PinReset_CallbackFunctionPointer = Callback;
+}
+
+void IO_PinReset_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, uint32_t pin, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_IO_PinReset_CALL_INSTANCE));
+  CMOCK_IO_PinReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.IO_PinReset_CallInstance = CMock_Guts_MemChain(Mock.IO_PinReset_CallInstance, cmock_guts_index);
+  Mock.IO_PinReset_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_IO_PinReset(cmock_call_instance, pRegisterAddress, pin);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void IO_PinReset_CMockReturnMemThruPtr_pRegisterAddress(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, size_t cmock_size)
+{
+  CMOCK_IO_PinReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.IO_PinReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRegisterAddress_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRegisterAddress_Val = pRegisterAddress;
+  cmock_call_instance->ReturnThruPtr_pRegisterAddress_Size = cmock_size;
+}
+
+void IO_PinReset_CMockIgnoreArg_pRegisterAddress(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_IO_PinReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.IO_PinReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRegisterAddress = 1;
+}
+
+void IO_PinReset_CMockIgnoreArg_pin(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_IO_PinReset_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinReset_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.IO_PinReset_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pin = 1;
+}
+
+uint8_t IO_PinGet(const uint32_t* pRegisterAddress, uint32_t pin)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_IO_PinGet_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_IO_PinGet);
+  cmock_call_instance = (CMOCK_IO_PinGet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.IO_PinGet_CallInstance);
+  Mock.IO_PinGet_CallInstance = CMock_Guts_MemNext(Mock.IO_PinGet_CallInstance);
+  if (Mock.IO_PinGet_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.IO_PinGet_FinalReturn;
+    Mock.IO_PinGet_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.IO_PinGet_CallbackBool &&
+      Mock.IO_PinGet_CallbackFunctionPointer != NULL)
+  {
+    uint8_t cmock_cb_ret = Mock.IO_PinGet_CallbackFunctionPointer(pRegisterAddress, pin, Mock.IO_PinGet_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pRegisterAddress)
+  {
+    UNITY_SET_DETAILS(CMockString_IO_PinGet,CMockString_pRegisterAddress);
+    if (cmock_call_instance->Expected_pRegisterAddress == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRegisterAddress, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pRegisterAddress, pRegisterAddress, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pin)
+  {
+    UNITY_SET_DETAILS(CMockString_IO_PinGet,CMockString_pin);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_pin, pin, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.IO_PinGet_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.IO_PinGet_CallbackFunctionPointer(pRegisterAddress, pin, Mock.IO_PinGet_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_IO_PinGet(CMOCK_IO_PinGet_CALL_INSTANCE* cmock_call_instance, const uint32_t* pRegisterAddress, uint32_t pin);
+void CMockExpectParameters_IO_PinGet(CMOCK_IO_PinGet_CALL_INSTANCE* cmock_call_instance, const uint32_t* pRegisterAddress, uint32_t pin)
+{
+  cmock_call_instance->Expected_pRegisterAddress = pRegisterAddress;
+  cmock_call_instance->IgnoreArg_pRegisterAddress = 0;
+  cmock_call_instance->Expected_pin = pin;
+  cmock_call_instance->IgnoreArg_pin = 0;
+}
+
+void IO_PinGet_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_IO_PinGet_CALL_INSTANCE));
+  CMOCK_IO_PinGet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinGet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.IO_PinGet_CallInstance = CMock_Guts_MemChain(Mock.IO_PinGet_CallInstance, cmock_guts_index);
+  Mock.IO_PinGet_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.IO_PinGet_IgnoreBool = (char)1;
+}
+
+void IO_PinGet_CMockStopIgnore(void)
+{
+  if(Mock.IO_PinGet_IgnoreBool)
+    Mock.IO_PinGet_CallInstance = CMock_Guts_MemNext(Mock.IO_PinGet_CallInstance);
+  Mock.IO_PinGet_IgnoreBool = (char)0;
+}
+
+void IO_PinGet_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const uint32_t* pRegisterAddress, uint32_t pin, uint8_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_IO_PinGet_CALL_INSTANCE));
+  CMOCK_IO_PinGet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinGet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.IO_PinGet_CallInstance = CMock_Guts_MemChain(Mock.IO_PinGet_CallInstance, cmock_guts_index);
+  Mock.IO_PinGet_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_IO_PinGet(cmock_call_instance, pRegisterAddress, pin);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void IO_PinGet_AddCallback(CMOCK_IO_PinGet_CALLBACK Callback)
+{
+  Mock.IO_PinGet_IgnoreBool = (char)0;
+  Mock.IO_PinGet_CallbackBool = (char)1;
+  Mock.IO_PinGet_CallbackFunctionPointer = Callback;
+}
+
+void IO_PinGet_Stub(CMOCK_IO_PinGet_CALLBACK Callback)
+{
+  Mock.IO_PinGet_IgnoreBool = (char)0;
+  Mock.IO_PinGet_CallbackBool = (char)0;
+  Mock.IO_PinGet_CallbackFunctionPointer = Callback;
+}
+
+void IO_PinGet_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const uint32_t* pRegisterAddress, uint32_t pin, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_IO_PinGet_CALL_INSTANCE));
+  CMOCK_IO_PinGet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinGet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.IO_PinGet_CallInstance = CMock_Guts_MemChain(Mock.IO_PinGet_CallInstance, cmock_guts_index);
+  Mock.IO_PinGet_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_IO_PinGet(cmock_call_instance, pRegisterAddress, pin);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void IO_PinGet_CMockIgnoreArg_pRegisterAddress(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_IO_PinGet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinGet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.IO_PinGet_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRegisterAddress = 1;
+}
+
+void IO_PinGet_CMockIgnoreArg_pin(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_IO_PinGet_CALL_INSTANCE* cmock_call_instance = (CMOCK_IO_PinGet_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.IO_PinGet_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pin = 1;
+}
+
@@ -0,0 +1,102 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKIO_H
+#define _MOCKIO_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "io.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockio_Init(void);
+void Mockio_Destroy(void);
+void Mockio_Verify(void);
+
+
+
+
+#define IO_PinSet_Ignore() IO_PinSet_CMockIgnore()
+void IO_PinSet_CMockIgnore(void);
+#define IO_PinSet_StopIgnore() IO_PinSet_CMockStopIgnore()
+void IO_PinSet_CMockStopIgnore(void);
+#define IO_PinSet_Expect(pRegisterAddress, pin) IO_PinSet_CMockExpect(__LINE__, pRegisterAddress, pin)
+void IO_PinSet_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, uint32_t pin);
+typedef void (* CMOCK_IO_PinSet_CALLBACK)(uint32_t* pRegisterAddress, uint32_t pin, int cmock_num_calls);
+void IO_PinSet_AddCallback(CMOCK_IO_PinSet_CALLBACK Callback);
+void IO_PinSet_Stub(CMOCK_IO_PinSet_CALLBACK Callback);
+#define IO_PinSet_StubWithCallback IO_PinSet_Stub
+#define IO_PinSet_ExpectAndThrow(pRegisterAddress, pin, cmock_to_throw) IO_PinSet_CMockExpectAndThrow(__LINE__, pRegisterAddress, pin, cmock_to_throw)
+void IO_PinSet_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, uint32_t pin, CEXCEPTION_T cmock_to_throw);
+#define IO_PinSet_ReturnThruPtr_pRegisterAddress(pRegisterAddress) IO_PinSet_CMockReturnMemThruPtr_pRegisterAddress(__LINE__, pRegisterAddress, sizeof(uint32_t))
+#define IO_PinSet_ReturnArrayThruPtr_pRegisterAddress(pRegisterAddress, cmock_len) IO_PinSet_CMockReturnMemThruPtr_pRegisterAddress(__LINE__, pRegisterAddress, cmock_len * sizeof(*pRegisterAddress))
+#define IO_PinSet_ReturnMemThruPtr_pRegisterAddress(pRegisterAddress, cmock_size) IO_PinSet_CMockReturnMemThruPtr_pRegisterAddress(__LINE__, pRegisterAddress, cmock_size)
+void IO_PinSet_CMockReturnMemThruPtr_pRegisterAddress(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, size_t cmock_size);
+#define IO_PinSet_IgnoreArg_pRegisterAddress() IO_PinSet_CMockIgnoreArg_pRegisterAddress(__LINE__)
+void IO_PinSet_CMockIgnoreArg_pRegisterAddress(UNITY_LINE_TYPE cmock_line);
+#define IO_PinSet_IgnoreArg_pin() IO_PinSet_CMockIgnoreArg_pin(__LINE__)
+void IO_PinSet_CMockIgnoreArg_pin(UNITY_LINE_TYPE cmock_line);
+#define IO_PinReset_Ignore() IO_PinReset_CMockIgnore()
+void IO_PinReset_CMockIgnore(void);
+#define IO_PinReset_StopIgnore() IO_PinReset_CMockStopIgnore()
+void IO_PinReset_CMockStopIgnore(void);
+#define IO_PinReset_Expect(pRegisterAddress, pin) IO_PinReset_CMockExpect(__LINE__, pRegisterAddress, pin)
+void IO_PinReset_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, uint32_t pin);
+typedef void (* CMOCK_IO_PinReset_CALLBACK)(uint32_t* pRegisterAddress, uint32_t pin, int cmock_num_calls);
+void IO_PinReset_AddCallback(CMOCK_IO_PinReset_CALLBACK Callback);
+void IO_PinReset_Stub(CMOCK_IO_PinReset_CALLBACK Callback);
+#define IO_PinReset_StubWithCallback IO_PinReset_Stub
+#define IO_PinReset_ExpectAndThrow(pRegisterAddress, pin, cmock_to_throw) IO_PinReset_CMockExpectAndThrow(__LINE__, pRegisterAddress, pin, cmock_to_throw)
+void IO_PinReset_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, uint32_t pin, CEXCEPTION_T cmock_to_throw);
+#define IO_PinReset_ReturnThruPtr_pRegisterAddress(pRegisterAddress) IO_PinReset_CMockReturnMemThruPtr_pRegisterAddress(__LINE__, pRegisterAddress, sizeof(uint32_t))
+#define IO_PinReset_ReturnArrayThruPtr_pRegisterAddress(pRegisterAddress, cmock_len) IO_PinReset_CMockReturnMemThruPtr_pRegisterAddress(__LINE__, pRegisterAddress, cmock_len * sizeof(*pRegisterAddress))
+#define IO_PinReset_ReturnMemThruPtr_pRegisterAddress(pRegisterAddress, cmock_size) IO_PinReset_CMockReturnMemThruPtr_pRegisterAddress(__LINE__, pRegisterAddress, cmock_size)
+void IO_PinReset_CMockReturnMemThruPtr_pRegisterAddress(UNITY_LINE_TYPE cmock_line, uint32_t* pRegisterAddress, size_t cmock_size);
+#define IO_PinReset_IgnoreArg_pRegisterAddress() IO_PinReset_CMockIgnoreArg_pRegisterAddress(__LINE__)
+void IO_PinReset_CMockIgnoreArg_pRegisterAddress(UNITY_LINE_TYPE cmock_line);
+#define IO_PinReset_IgnoreArg_pin() IO_PinReset_CMockIgnoreArg_pin(__LINE__)
+void IO_PinReset_CMockIgnoreArg_pin(UNITY_LINE_TYPE cmock_line);
+#define IO_PinGet_IgnoreAndReturn(cmock_retval) IO_PinGet_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void IO_PinGet_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t cmock_to_return);
+#define IO_PinGet_StopIgnore() IO_PinGet_CMockStopIgnore()
+void IO_PinGet_CMockStopIgnore(void);
+#define IO_PinGet_ExpectAndReturn(pRegisterAddress, pin, cmock_retval) IO_PinGet_CMockExpectAndReturn(__LINE__, pRegisterAddress, pin, cmock_retval)
+void IO_PinGet_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const uint32_t* pRegisterAddress, uint32_t pin, uint8_t cmock_to_return);
+typedef uint8_t (* CMOCK_IO_PinGet_CALLBACK)(const uint32_t* pRegisterAddress, uint32_t pin, int cmock_num_calls);
+void IO_PinGet_AddCallback(CMOCK_IO_PinGet_CALLBACK Callback);
+void IO_PinGet_Stub(CMOCK_IO_PinGet_CALLBACK Callback);
+#define IO_PinGet_StubWithCallback IO_PinGet_Stub
+#define IO_PinGet_ExpectAndThrow(pRegisterAddress, pin, cmock_to_throw) IO_PinGet_CMockExpectAndThrow(__LINE__, pRegisterAddress, pin, cmock_to_throw)
+void IO_PinGet_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const uint32_t* pRegisterAddress, uint32_t pin, CEXCEPTION_T cmock_to_throw);
+#define IO_PinGet_IgnoreArg_pRegisterAddress() IO_PinGet_CMockIgnoreArg_pRegisterAddress(__LINE__)
+void IO_PinGet_CMockIgnoreArg_pRegisterAddress(UNITY_LINE_TYPE cmock_line);
+#define IO_PinGet_IgnoreArg_pin() IO_PinGet_CMockIgnoreArg_pin(__LINE__)
+void IO_PinGet_CMockIgnoreArg_pin(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,1129 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockltc_mic_dma.h"
+
+static const char* CMockString_MIC_ClearTransactionList = "MIC_ClearTransactionList";
+static const char* CMockString_MIC_IsTransmitOngoing = "MIC_IsTransmitOngoing";
+static const char* CMockString_MIC_QueueTransaction = "MIC_QueueTransaction";
+static const char* CMockString_MIC_SetTransmitOngoing = "MIC_SetTransmitOngoing";
+static const char* CMockString_MIC_TransmitReceiveSpiWithDma = "MIC_TransmitReceiveSpiWithDma";
+static const char* CMockString_frameLength = "frameLength";
+static const char* CMockString_length = "length";
+static const char* CMockString_pCommand = "pCommand";
+static const char* CMockString_pList = "pList";
+static const char* CMockString_pLtcState = "pLtcState";
+static const char* CMockString_pRxBuffer = "pRxBuffer";
+static const char* CMockString_pSpiInterface = "pSpiInterface";
+static const char* CMockString_pTxBuffer = "pTxBuffer";
+static const char* CMockString_registerSet = "registerSet";
+static const char* CMockString_rx = "rx";
+static const char* CMockString_tx = "tx";
+
+typedef struct _CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint16_t* Expected_tx;
+  uint16_t* Expected_rx;
+  uint32_t Expected_length;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_tx_Used;
+  uint16_t* ReturnThruPtr_tx_Val;
+  size_t ReturnThruPtr_tx_Size;
+  char ReturnThruPtr_rx_Used;
+  uint16_t* ReturnThruPtr_rx_Val;
+  size_t ReturnThruPtr_rx_Size;
+  char IgnoreArg_tx;
+  char IgnoreArg_rx;
+  char IgnoreArg_length;
+
+} CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  LTC_STATE_s* Expected_pLtcState;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pLtcState_Used;
+  LTC_STATE_s* ReturnThruPtr_pLtcState_Val;
+  size_t ReturnThruPtr_pLtcState_Size;
+  char IgnoreArg_pLtcState;
+
+} CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  LTC_STATE_s* Expected_pLtcState;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pLtcState_Used;
+  LTC_STATE_s* ReturnThruPtr_pLtcState_Val;
+  size_t ReturnThruPtr_pLtcState_Size;
+  char IgnoreArg_pLtcState;
+
+} CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_ClearTransactionList_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  LTC_TRANSACTION_LIST_s* Expected_pList;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint16_t* Expected_pTxBuffer;
+  uint32_t Expected_frameLength;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pList_Used;
+  LTC_TRANSACTION_LIST_s* ReturnThruPtr_pList_Val;
+  size_t ReturnThruPtr_pList_Size;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char ReturnThruPtr_pTxBuffer_Used;
+  uint16_t* ReturnThruPtr_pTxBuffer_Val;
+  size_t ReturnThruPtr_pTxBuffer_Size;
+  char IgnoreArg_pList;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_pTxBuffer;
+  char IgnoreArg_frameLength;
+
+} CMOCK_MIC_ClearTransactionList_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_QueueTransaction_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  LTC_TRANSACTION_LIST_s* Expected_pList;
+  uint16_t* Expected_pCommand;
+  uint16_t* Expected_pRxBuffer;
+  uint8_t Expected_registerSet;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pList_Used;
+  LTC_TRANSACTION_LIST_s* ReturnThruPtr_pList_Val;
+  size_t ReturnThruPtr_pList_Size;
+  char ReturnThruPtr_pCommand_Used;
+  uint16_t* ReturnThruPtr_pCommand_Val;
+  size_t ReturnThruPtr_pCommand_Size;
+  char ReturnThruPtr_pRxBuffer_Used;
+  uint16_t* ReturnThruPtr_pRxBuffer_Val;
+  size_t ReturnThruPtr_pRxBuffer_Size;
+  char IgnoreArg_pList;
+  char IgnoreArg_pCommand;
+  char IgnoreArg_pRxBuffer;
+  char IgnoreArg_registerSet;
+
+} CMOCK_MIC_QueueTransaction_CALL_INSTANCE;
+
+static struct Mockltc_mic_dmaInstance
+{
+  char MIC_TransmitReceiveSpiWithDma_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_TransmitReceiveSpiWithDma_FinalReturn;
+  char MIC_TransmitReceiveSpiWithDma_CallbackBool;
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALLBACK MIC_TransmitReceiveSpiWithDma_CallbackFunctionPointer;
+  int MIC_TransmitReceiveSpiWithDma_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_TransmitReceiveSpiWithDma_CallInstance;
+  char MIC_IsTransmitOngoing_IgnoreBool;
+  _Bool MIC_IsTransmitOngoing_FinalReturn;
+  char MIC_IsTransmitOngoing_CallbackBool;
+  CMOCK_MIC_IsTransmitOngoing_CALLBACK MIC_IsTransmitOngoing_CallbackFunctionPointer;
+  int MIC_IsTransmitOngoing_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_IsTransmitOngoing_CallInstance;
+  char MIC_SetTransmitOngoing_IgnoreBool;
+  char MIC_SetTransmitOngoing_CallbackBool;
+  CMOCK_MIC_SetTransmitOngoing_CALLBACK MIC_SetTransmitOngoing_CallbackFunctionPointer;
+  int MIC_SetTransmitOngoing_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_SetTransmitOngoing_CallInstance;
+  char MIC_ClearTransactionList_IgnoreBool;
+  char MIC_ClearTransactionList_CallbackBool;
+  CMOCK_MIC_ClearTransactionList_CALLBACK MIC_ClearTransactionList_CallbackFunctionPointer;
+  int MIC_ClearTransactionList_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_ClearTransactionList_CallInstance;
+  char MIC_QueueTransaction_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_QueueTransaction_FinalReturn;
+  char MIC_QueueTransaction_CallbackBool;
+  CMOCK_MIC_QueueTransaction_CALLBACK MIC_QueueTransaction_CallbackFunctionPointer;
+  int MIC_QueueTransaction_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_QueueTransaction_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockltc_mic_dma_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.MIC_TransmitReceiveSpiWithDma_CallInstance;
+  if (Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_TransmitReceiveSpiWithDma);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_TransmitReceiveSpiWithDma_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_IsTransmitOngoing_CallInstance;
+  if (Mock.MIC_IsTransmitOngoing_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_IsTransmitOngoing);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_IsTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_SetTransmitOngoing_CallInstance;
+  if (Mock.MIC_SetTransmitOngoing_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_SetTransmitOngoing);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_SetTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_ClearTransactionList_CallInstance;
+  if (Mock.MIC_ClearTransactionList_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_ClearTransactionList);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_ClearTransactionList_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_QueueTransaction_CallInstance;
+  if (Mock.MIC_QueueTransaction_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_QueueTransaction);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_QueueTransaction_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockltc_mic_dma_Init(void)
+{
+  Mockltc_mic_dma_Destroy();
+}
+
+void Mockltc_mic_dma_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+STD_RETURN_TYPE_e MIC_TransmitReceiveSpiWithDma(uint16_t* tx, uint16_t* rx, uint32_t length)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_TransmitReceiveSpiWithDma);
+  cmock_call_instance = (CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance);
+  Mock.MIC_TransmitReceiveSpiWithDma_CallInstance = CMock_Guts_MemNext(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance);
+  if (Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_TransmitReceiveSpiWithDma_FinalReturn;
+    memcpy((void*)(&Mock.MIC_TransmitReceiveSpiWithDma_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_TransmitReceiveSpiWithDma_CallbackBool &&
+      Mock.MIC_TransmitReceiveSpiWithDma_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_TransmitReceiveSpiWithDma_CallbackFunctionPointer(tx, rx, length, Mock.MIC_TransmitReceiveSpiWithDma_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_tx)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_TransmitReceiveSpiWithDma,CMockString_tx);
+    if (cmock_call_instance->Expected_tx == NULL)
+      { UNITY_TEST_ASSERT_NULL(tx, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_tx, tx, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_rx)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_TransmitReceiveSpiWithDma,CMockString_rx);
+    if (cmock_call_instance->Expected_rx == NULL)
+      { UNITY_TEST_ASSERT_NULL(rx, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_rx, rx, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_length)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_TransmitReceiveSpiWithDma,CMockString_length);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_length, length, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_TransmitReceiveSpiWithDma_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_TransmitReceiveSpiWithDma_CallbackFunctionPointer(tx, rx, length, Mock.MIC_TransmitReceiveSpiWithDma_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_tx_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(tx, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)tx, (void*)cmock_call_instance->ReturnThruPtr_tx_Val,
+      cmock_call_instance->ReturnThruPtr_tx_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_rx_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(rx, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)rx, (void*)cmock_call_instance->ReturnThruPtr_rx_Val,
+      cmock_call_instance->ReturnThruPtr_rx_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_TransmitReceiveSpiWithDma(CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance, uint16_t* tx, uint16_t* rx, uint32_t length);
+void CMockExpectParameters_MIC_TransmitReceiveSpiWithDma(CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance, uint16_t* tx, uint16_t* rx, uint32_t length)
+{
+  cmock_call_instance->Expected_tx = tx;
+  cmock_call_instance->IgnoreArg_tx = 0;
+  cmock_call_instance->ReturnThruPtr_tx_Used = 0;
+  cmock_call_instance->Expected_rx = rx;
+  cmock_call_instance->IgnoreArg_rx = 0;
+  cmock_call_instance->ReturnThruPtr_rx_Used = 0;
+  cmock_call_instance->Expected_length = length;
+  cmock_call_instance->IgnoreArg_length = 0;
+}
+
+void MIC_TransmitReceiveSpiWithDma_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE));
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_TransmitReceiveSpiWithDma_CallInstance = CMock_Guts_MemChain(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance, cmock_guts_index);
+  Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool = (char)1;
+}
+
+void MIC_TransmitReceiveSpiWithDma_CMockStopIgnore(void)
+{
+  if(Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool)
+    Mock.MIC_TransmitReceiveSpiWithDma_CallInstance = CMock_Guts_MemNext(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance);
+  Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool = (char)0;
+}
+
+void MIC_TransmitReceiveSpiWithDma_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t* tx, uint16_t* rx, uint32_t length, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE));
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_TransmitReceiveSpiWithDma_CallInstance = CMock_Guts_MemChain(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance, cmock_guts_index);
+  Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_TransmitReceiveSpiWithDma(cmock_call_instance, tx, rx, length);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_TransmitReceiveSpiWithDma_AddCallback(CMOCK_MIC_TransmitReceiveSpiWithDma_CALLBACK Callback)
+{
+  Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool = (char)0;
+  Mock.MIC_TransmitReceiveSpiWithDma_CallbackBool = (char)1;
+  Mock.MIC_TransmitReceiveSpiWithDma_CallbackFunctionPointer = Callback;
+}
+
+void MIC_TransmitReceiveSpiWithDma_Stub(CMOCK_MIC_TransmitReceiveSpiWithDma_CALLBACK Callback)
+{
+  Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool = (char)0;
+  Mock.MIC_TransmitReceiveSpiWithDma_CallbackBool = (char)0;
+  Mock.MIC_TransmitReceiveSpiWithDma_CallbackFunctionPointer = Callback;
+}
+
+void MIC_TransmitReceiveSpiWithDma_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t* tx, uint16_t* rx, uint32_t length, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE));
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_TransmitReceiveSpiWithDma_CallInstance = CMock_Guts_MemChain(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance, cmock_guts_index);
+  Mock.MIC_TransmitReceiveSpiWithDma_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_TransmitReceiveSpiWithDma(cmock_call_instance, tx, rx, length);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_tx(UNITY_LINE_TYPE cmock_line, uint16_t* tx, size_t cmock_size)
+{
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_tx_Used = 1;
+  cmock_call_instance->ReturnThruPtr_tx_Val = tx;
+  cmock_call_instance->ReturnThruPtr_tx_Size = cmock_size;
+}
+
+void MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_rx(UNITY_LINE_TYPE cmock_line, uint16_t* rx, size_t cmock_size)
+{
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_rx_Used = 1;
+  cmock_call_instance->ReturnThruPtr_rx_Val = rx;
+  cmock_call_instance->ReturnThruPtr_rx_Size = cmock_size;
+}
+
+void MIC_TransmitReceiveSpiWithDma_CMockIgnoreArg_tx(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_tx = 1;
+}
+
+void MIC_TransmitReceiveSpiWithDma_CMockIgnoreArg_rx(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_rx = 1;
+}
+
+void MIC_TransmitReceiveSpiWithDma_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TransmitReceiveSpiWithDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_TransmitReceiveSpiWithDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_length = 1;
+}
+
+_Bool MIC_IsTransmitOngoing(LTC_STATE_s* pLtcState)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_IsTransmitOngoing);
+  cmock_call_instance = (CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_IsTransmitOngoing_CallInstance);
+  Mock.MIC_IsTransmitOngoing_CallInstance = CMock_Guts_MemNext(Mock.MIC_IsTransmitOngoing_CallInstance);
+  if (Mock.MIC_IsTransmitOngoing_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_IsTransmitOngoing_FinalReturn;
+    memcpy((void*)(&Mock.MIC_IsTransmitOngoing_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_IsTransmitOngoing_CallbackBool &&
+      Mock.MIC_IsTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.MIC_IsTransmitOngoing_CallbackFunctionPointer(pLtcState, Mock.MIC_IsTransmitOngoing_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pLtcState)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_IsTransmitOngoing,CMockString_pLtcState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pLtcState), (void*)(pLtcState), sizeof(LTC_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_IsTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_IsTransmitOngoing_CallbackFunctionPointer(pLtcState, Mock.MIC_IsTransmitOngoing_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pLtcState_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pLtcState, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pLtcState, (void*)cmock_call_instance->ReturnThruPtr_pLtcState_Val,
+      cmock_call_instance->ReturnThruPtr_pLtcState_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_IsTransmitOngoing(CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance, LTC_STATE_s* pLtcState);
+void CMockExpectParameters_MIC_IsTransmitOngoing(CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance, LTC_STATE_s* pLtcState)
+{
+  cmock_call_instance->Expected_pLtcState = pLtcState;
+  cmock_call_instance->IgnoreArg_pLtcState = 0;
+  cmock_call_instance->ReturnThruPtr_pLtcState_Used = 0;
+}
+
+void MIC_IsTransmitOngoing_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE));
+  CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_IsTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.MIC_IsTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.MIC_IsTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_IsTransmitOngoing_IgnoreBool = (char)1;
+}
+
+void MIC_IsTransmitOngoing_CMockStopIgnore(void)
+{
+  if(Mock.MIC_IsTransmitOngoing_IgnoreBool)
+    Mock.MIC_IsTransmitOngoing_CallInstance = CMock_Guts_MemNext(Mock.MIC_IsTransmitOngoing_CallInstance);
+  Mock.MIC_IsTransmitOngoing_IgnoreBool = (char)0;
+}
+
+void MIC_IsTransmitOngoing_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE));
+  CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_IsTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.MIC_IsTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.MIC_IsTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_IsTransmitOngoing(cmock_call_instance, pLtcState);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void MIC_IsTransmitOngoing_AddCallback(CMOCK_MIC_IsTransmitOngoing_CALLBACK Callback)
+{
+  Mock.MIC_IsTransmitOngoing_IgnoreBool = (char)0;
+  Mock.MIC_IsTransmitOngoing_CallbackBool = (char)1;
+  Mock.MIC_IsTransmitOngoing_CallbackFunctionPointer = Callback;
+}
+
+void MIC_IsTransmitOngoing_Stub(CMOCK_MIC_IsTransmitOngoing_CALLBACK Callback)
+{
+  Mock.MIC_IsTransmitOngoing_IgnoreBool = (char)0;
+  Mock.MIC_IsTransmitOngoing_CallbackBool = (char)0;
+  Mock.MIC_IsTransmitOngoing_CallbackFunctionPointer = Callback;
+}
+
+void MIC_IsTransmitOngoing_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE));
+  CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_IsTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.MIC_IsTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.MIC_IsTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_IsTransmitOngoing(cmock_call_instance, pLtcState);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_IsTransmitOngoing_CMockReturnMemThruPtr_pLtcState(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, size_t cmock_size)
+{
+  CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_IsTransmitOngoing_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pLtcState_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pLtcState_Val = pLtcState;
+  cmock_call_instance->ReturnThruPtr_pLtcState_Size = cmock_size;
+}
+
+void MIC_IsTransmitOngoing_CMockIgnoreArg_pLtcState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_IsTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_IsTransmitOngoing_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pLtcState = 1;
+}
+
+void MIC_SetTransmitOngoing(LTC_STATE_s* pLtcState)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_SetTransmitOngoing);
+  cmock_call_instance = (CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_SetTransmitOngoing_CallInstance);
+  Mock.MIC_SetTransmitOngoing_CallInstance = CMock_Guts_MemNext(Mock.MIC_SetTransmitOngoing_CallInstance);
+  if (Mock.MIC_SetTransmitOngoing_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.MIC_SetTransmitOngoing_CallbackBool &&
+      Mock.MIC_SetTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    Mock.MIC_SetTransmitOngoing_CallbackFunctionPointer(pLtcState, Mock.MIC_SetTransmitOngoing_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pLtcState)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_SetTransmitOngoing,CMockString_pLtcState);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pLtcState), (void*)(pLtcState), sizeof(LTC_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_SetTransmitOngoing_CallbackFunctionPointer != NULL)
+  {
+    Mock.MIC_SetTransmitOngoing_CallbackFunctionPointer(pLtcState, Mock.MIC_SetTransmitOngoing_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pLtcState_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pLtcState, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pLtcState, (void*)cmock_call_instance->ReturnThruPtr_pLtcState_Val,
+      cmock_call_instance->ReturnThruPtr_pLtcState_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_MIC_SetTransmitOngoing(CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance, LTC_STATE_s* pLtcState);
+void CMockExpectParameters_MIC_SetTransmitOngoing(CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance, LTC_STATE_s* pLtcState)
+{
+  cmock_call_instance->Expected_pLtcState = pLtcState;
+  cmock_call_instance->IgnoreArg_pLtcState = 0;
+  cmock_call_instance->ReturnThruPtr_pLtcState_Used = 0;
+}
+
+void MIC_SetTransmitOngoing_CMockIgnore(void)
+{
+  Mock.MIC_SetTransmitOngoing_IgnoreBool = (char)1;
+}
+
+void MIC_SetTransmitOngoing_CMockStopIgnore(void)
+{
+  Mock.MIC_SetTransmitOngoing_IgnoreBool = (char)0;
+}
+
+void MIC_SetTransmitOngoing_CMockExpect(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE));
+  CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_SetTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.MIC_SetTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.MIC_SetTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_SetTransmitOngoing(cmock_call_instance, pLtcState);
+}
+
+void MIC_SetTransmitOngoing_AddCallback(CMOCK_MIC_SetTransmitOngoing_CALLBACK Callback)
+{
+  Mock.MIC_SetTransmitOngoing_IgnoreBool = (char)0;
+  Mock.MIC_SetTransmitOngoing_CallbackBool = (char)1;
+  Mock.MIC_SetTransmitOngoing_CallbackFunctionPointer = Callback;
+}
+
+void MIC_SetTransmitOngoing_Stub(CMOCK_MIC_SetTransmitOngoing_CALLBACK Callback)
+{
+  Mock.MIC_SetTransmitOngoing_IgnoreBool = (char)0;
+  Mock.MIC_SetTransmitOngoing_CallbackBool = (char)0;
+  Mock.MIC_SetTransmitOngoing_CallbackFunctionPointer = Callback;
+}
+
+void MIC_SetTransmitOngoing_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE));
+  CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_SetTransmitOngoing_CallInstance = CMock_Guts_MemChain(Mock.MIC_SetTransmitOngoing_CallInstance, cmock_guts_index);
+  Mock.MIC_SetTransmitOngoing_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_SetTransmitOngoing(cmock_call_instance, pLtcState);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_SetTransmitOngoing_CMockReturnMemThruPtr_pLtcState(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, size_t cmock_size)
+{
+  CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_SetTransmitOngoing_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pLtcState_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pLtcState_Val = pLtcState;
+  cmock_call_instance->ReturnThruPtr_pLtcState_Size = cmock_size;
+}
+
+void MIC_SetTransmitOngoing_CMockIgnoreArg_pLtcState(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_SetTransmitOngoing_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_SetTransmitOngoing_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pLtcState = 1;
+}
+
+void MIC_ClearTransactionList(LTC_TRANSACTION_LIST_s* pList, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuffer, uint32_t frameLength)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_ClearTransactionList);
+  cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_ClearTransactionList_CallInstance);
+  Mock.MIC_ClearTransactionList_CallInstance = CMock_Guts_MemNext(Mock.MIC_ClearTransactionList_CallInstance);
+  if (Mock.MIC_ClearTransactionList_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.MIC_ClearTransactionList_CallbackBool &&
+      Mock.MIC_ClearTransactionList_CallbackFunctionPointer != NULL)
+  {
+    Mock.MIC_ClearTransactionList_CallbackFunctionPointer(pList, pSpiInterface, pTxBuffer, frameLength, Mock.MIC_ClearTransactionList_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pList)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_ClearTransactionList,CMockString_pList);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pList), (void*)(pList), sizeof(LTC_TRANSACTION_LIST_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_ClearTransactionList,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTxBuffer)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_ClearTransactionList,CMockString_pTxBuffer);
+    if (cmock_call_instance->Expected_pTxBuffer == NULL)
+      { UNITY_TEST_ASSERT_NULL(pTxBuffer, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pTxBuffer, pTxBuffer, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_frameLength)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_ClearTransactionList,CMockString_frameLength);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_frameLength, frameLength, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_ClearTransactionList_CallbackFunctionPointer != NULL)
+  {
+    Mock.MIC_ClearTransactionList_CallbackFunctionPointer(pList, pSpiInterface, pTxBuffer, frameLength, Mock.MIC_ClearTransactionList_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pList_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pList, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pList, (void*)cmock_call_instance->ReturnThruPtr_pList_Val,
+      cmock_call_instance->ReturnThruPtr_pList_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTxBuffer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTxBuffer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTxBuffer, (void*)cmock_call_instance->ReturnThruPtr_pTxBuffer_Val,
+      cmock_call_instance->ReturnThruPtr_pTxBuffer_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_MIC_ClearTransactionList(CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance, LTC_TRANSACTION_LIST_s* pList, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuffer, uint32_t frameLength);
+void CMockExpectParameters_MIC_ClearTransactionList(CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance, LTC_TRANSACTION_LIST_s* pList, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuffer, uint32_t frameLength)
+{
+  cmock_call_instance->Expected_pList = pList;
+  cmock_call_instance->IgnoreArg_pList = 0;
+  cmock_call_instance->ReturnThruPtr_pList_Used = 0;
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_pTxBuffer = pTxBuffer;
+  cmock_call_instance->IgnoreArg_pTxBuffer = 0;
+  cmock_call_instance->ReturnThruPtr_pTxBuffer_Used = 0;
+  cmock_call_instance->Expected_frameLength = frameLength;
+  cmock_call_instance->IgnoreArg_frameLength = 0;
+}
+
+void MIC_ClearTransactionList_CMockIgnore(void)
+{
+  Mock.MIC_ClearTransactionList_IgnoreBool = (char)1;
+}
+
+void MIC_ClearTransactionList_CMockStopIgnore(void)
+{
+  Mock.MIC_ClearTransactionList_IgnoreBool = (char)0;
+}
+
+void MIC_ClearTransactionList_CMockExpect(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuffer, uint32_t frameLength)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_ClearTransactionList_CALL_INSTANCE));
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_ClearTransactionList_CallInstance = CMock_Guts_MemChain(Mock.MIC_ClearTransactionList_CallInstance, cmock_guts_index);
+  Mock.MIC_ClearTransactionList_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_ClearTransactionList(cmock_call_instance, pList, pSpiInterface, pTxBuffer, frameLength);
+}
+
+void MIC_ClearTransactionList_AddCallback(CMOCK_MIC_ClearTransactionList_CALLBACK Callback)
+{
+  Mock.MIC_ClearTransactionList_IgnoreBool = (char)0;
+  Mock.MIC_ClearTransactionList_CallbackBool = (char)1;
+  Mock.MIC_ClearTransactionList_CallbackFunctionPointer = Callback;
+}
+
+void MIC_ClearTransactionList_Stub(CMOCK_MIC_ClearTransactionList_CALLBACK Callback)
+{
+  Mock.MIC_ClearTransactionList_IgnoreBool = (char)0;
+  Mock.MIC_ClearTransactionList_CallbackBool = (char)0;
+  Mock.MIC_ClearTransactionList_CallbackFunctionPointer = Callback;
+}
+
+void MIC_ClearTransactionList_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuffer, uint32_t frameLength, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_ClearTransactionList_CALL_INSTANCE));
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_ClearTransactionList_CallInstance = CMock_Guts_MemChain(Mock.MIC_ClearTransactionList_CallInstance, cmock_guts_index);
+  Mock.MIC_ClearTransactionList_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_ClearTransactionList(cmock_call_instance, pList, pSpiInterface, pTxBuffer, frameLength);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_ClearTransactionList_CMockReturnMemThruPtr_pList(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, size_t cmock_size)
+{
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_ClearTransactionList_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pList_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pList_Val = pList;
+  cmock_call_instance->ReturnThruPtr_pList_Size = cmock_size;
+}
+
+void MIC_ClearTransactionList_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_ClearTransactionList_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void MIC_ClearTransactionList_CMockReturnMemThruPtr_pTxBuffer(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuffer, size_t cmock_size)
+{
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_ClearTransactionList_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTxBuffer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTxBuffer_Val = pTxBuffer;
+  cmock_call_instance->ReturnThruPtr_pTxBuffer_Size = cmock_size;
+}
+
+void MIC_ClearTransactionList_CMockIgnoreArg_pList(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_ClearTransactionList_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pList = 1;
+}
+
+void MIC_ClearTransactionList_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_ClearTransactionList_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void MIC_ClearTransactionList_CMockIgnoreArg_pTxBuffer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_ClearTransactionList_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTxBuffer = 1;
+}
+
+void MIC_ClearTransactionList_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_ClearTransactionList_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_ClearTransactionList_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_ClearTransactionList_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_frameLength = 1;
+}
+
+STD_RETURN_TYPE_e MIC_QueueTransaction(LTC_TRANSACTION_LIST_s* pList, uint16_t* pCommand, uint16_t* pRxBuffer, uint8_t registerSet)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_QueueTransaction);
+  cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_QueueTransaction_CallInstance);
+  Mock.MIC_QueueTransaction_CallInstance = CMock_Guts_MemNext(Mock.MIC_QueueTransaction_CallInstance);
+  if (Mock.MIC_QueueTransaction_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_QueueTransaction_FinalReturn;
+    memcpy((void*)(&Mock.MIC_QueueTransaction_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_QueueTransaction_CallbackBool &&
+      Mock.MIC_QueueTransaction_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_QueueTransaction_CallbackFunctionPointer(pList, pCommand, pRxBuffer, registerSet, Mock.MIC_QueueTransaction_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pList)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_QueueTransaction,CMockString_pList);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pList), (void*)(pList), sizeof(LTC_TRANSACTION_LIST_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCommand)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_QueueTransaction,CMockString_pCommand);
+    if (cmock_call_instance->Expected_pCommand == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCommand, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pCommand, pCommand, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pRxBuffer)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_QueueTransaction,CMockString_pRxBuffer);
+    if (cmock_call_instance->Expected_pRxBuffer == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRxBuffer, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pRxBuffer, pRxBuffer, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_registerSet)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_QueueTransaction,CMockString_registerSet);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_registerSet, registerSet, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_QueueTransaction_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_QueueTransaction_CallbackFunctionPointer(pList, pCommand, pRxBuffer, registerSet, Mock.MIC_QueueTransaction_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pList_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pList, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pList, (void*)cmock_call_instance->ReturnThruPtr_pList_Val,
+      cmock_call_instance->ReturnThruPtr_pList_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCommand_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCommand, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCommand, (void*)cmock_call_instance->ReturnThruPtr_pCommand_Val,
+      cmock_call_instance->ReturnThruPtr_pCommand_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRxBuffer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRxBuffer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRxBuffer, (void*)cmock_call_instance->ReturnThruPtr_pRxBuffer_Val,
+      cmock_call_instance->ReturnThruPtr_pRxBuffer_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_QueueTransaction(CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance, LTC_TRANSACTION_LIST_s* pList, uint16_t* pCommand, uint16_t* pRxBuffer, uint8_t registerSet);
+void CMockExpectParameters_MIC_QueueTransaction(CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance, LTC_TRANSACTION_LIST_s* pList, uint16_t* pCommand, uint16_t* pRxBuffer, uint8_t registerSet)
+{
+  cmock_call_instance->Expected_pList = pList;
+  cmock_call_instance->IgnoreArg_pList = 0;
+  cmock_call_instance->ReturnThruPtr_pList_Used = 0;
+  cmock_call_instance->Expected_pCommand = pCommand;
+  cmock_call_instance->IgnoreArg_pCommand = 0;
+  cmock_call_instance->ReturnThruPtr_pCommand_Used = 0;
+  cmock_call_instance->Expected_pRxBuffer = pRxBuffer;
+  cmock_call_instance->IgnoreArg_pRxBuffer = 0;
+  cmock_call_instance->ReturnThruPtr_pRxBuffer_Used = 0;
+  cmock_call_instance->Expected_registerSet = registerSet;
+  cmock_call_instance->IgnoreArg_registerSet = 0;
+}
+
+void MIC_QueueTransaction_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_QueueTransaction_CALL_INSTANCE));
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_QueueTransaction_CallInstance = CMock_Guts_MemChain(Mock.MIC_QueueTransaction_CallInstance, cmock_guts_index);
+  Mock.MIC_QueueTransaction_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_QueueTransaction_IgnoreBool = (char)1;
+}
+
+void MIC_QueueTransaction_CMockStopIgnore(void)
+{
+  if(Mock.MIC_QueueTransaction_IgnoreBool)
+    Mock.MIC_QueueTransaction_CallInstance = CMock_Guts_MemNext(Mock.MIC_QueueTransaction_CallInstance);
+  Mock.MIC_QueueTransaction_IgnoreBool = (char)0;
+}
+
+void MIC_QueueTransaction_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, uint16_t* pCommand, uint16_t* pRxBuffer, uint8_t registerSet, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_QueueTransaction_CALL_INSTANCE));
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_QueueTransaction_CallInstance = CMock_Guts_MemChain(Mock.MIC_QueueTransaction_CallInstance, cmock_guts_index);
+  Mock.MIC_QueueTransaction_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_QueueTransaction(cmock_call_instance, pList, pCommand, pRxBuffer, registerSet);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_QueueTransaction_AddCallback(CMOCK_MIC_QueueTransaction_CALLBACK Callback)
+{
+  Mock.MIC_QueueTransaction_IgnoreBool = (char)0;
+  Mock.MIC_QueueTransaction_CallbackBool = (char)1;
+  Mock.MIC_QueueTransaction_CallbackFunctionPointer = Callback;
+}
+
+void MIC_QueueTransaction_Stub(CMOCK_MIC_QueueTransaction_CALLBACK Callback)
+{
+  Mock.MIC_QueueTransaction_IgnoreBool = (char)0;
+  Mock.MIC_QueueTransaction_CallbackBool = (char)0;
+  Mock.MIC_QueueTransaction_CallbackFunctionPointer = Callback;
+}
+
+void MIC_QueueTransaction_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, uint16_t* pCommand, uint16_t* pRxBuffer, uint8_t registerSet, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_QueueTransaction_CALL_INSTANCE));
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_QueueTransaction_CallInstance = CMock_Guts_MemChain(Mock.MIC_QueueTransaction_CallInstance, cmock_guts_index);
+  Mock.MIC_QueueTransaction_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_QueueTransaction(cmock_call_instance, pList, pCommand, pRxBuffer, registerSet);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_QueueTransaction_CMockReturnMemThruPtr_pList(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, size_t cmock_size)
+{
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_QueueTransaction_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pList_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pList_Val = pList;
+  cmock_call_instance->ReturnThruPtr_pList_Size = cmock_size;
+}
+
+void MIC_QueueTransaction_CMockReturnMemThruPtr_pCommand(UNITY_LINE_TYPE cmock_line, uint16_t* pCommand, size_t cmock_size)
+{
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_QueueTransaction_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCommand_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCommand_Val = pCommand;
+  cmock_call_instance->ReturnThruPtr_pCommand_Size = cmock_size;
+}
+
+void MIC_QueueTransaction_CMockReturnMemThruPtr_pRxBuffer(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuffer, size_t cmock_size)
+{
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_QueueTransaction_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRxBuffer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRxBuffer_Val = pRxBuffer;
+  cmock_call_instance->ReturnThruPtr_pRxBuffer_Size = cmock_size;
+}
+
+void MIC_QueueTransaction_CMockIgnoreArg_pList(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_QueueTransaction_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pList = 1;
+}
+
+void MIC_QueueTransaction_CMockIgnoreArg_pCommand(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_QueueTransaction_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCommand = 1;
+}
+
+void MIC_QueueTransaction_CMockIgnoreArg_pRxBuffer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_QueueTransaction_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRxBuffer = 1;
+}
+
+void MIC_QueueTransaction_CMockIgnoreArg_registerSet(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_QueueTransaction_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_QueueTransaction_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_QueueTransaction_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_registerSet = 1;
+}
+
@@ -0,0 +1,172 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKLTC_MIC_DMA_H
+#define _MOCKLTC_MIC_DMA_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "ltc_mic_dma.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockltc_mic_dma_Init(void);
+void Mockltc_mic_dma_Destroy(void);
+void Mockltc_mic_dma_Verify(void);
+
+
+
+
+#define MIC_TransmitReceiveSpiWithDma_IgnoreAndReturn(cmock_retval) MIC_TransmitReceiveSpiWithDma_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_TransmitReceiveSpiWithDma_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_TransmitReceiveSpiWithDma_StopIgnore() MIC_TransmitReceiveSpiWithDma_CMockStopIgnore()
+void MIC_TransmitReceiveSpiWithDma_CMockStopIgnore(void);
+#define MIC_TransmitReceiveSpiWithDma_ExpectAndReturn(tx, rx, length, cmock_retval) MIC_TransmitReceiveSpiWithDma_CMockExpectAndReturn(__LINE__, tx, rx, length, cmock_retval)
+void MIC_TransmitReceiveSpiWithDma_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t* tx, uint16_t* rx, uint32_t length, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_TransmitReceiveSpiWithDma_CALLBACK)(uint16_t* tx, uint16_t* rx, uint32_t length, int cmock_num_calls);
+void MIC_TransmitReceiveSpiWithDma_AddCallback(CMOCK_MIC_TransmitReceiveSpiWithDma_CALLBACK Callback);
+void MIC_TransmitReceiveSpiWithDma_Stub(CMOCK_MIC_TransmitReceiveSpiWithDma_CALLBACK Callback);
+#define MIC_TransmitReceiveSpiWithDma_StubWithCallback MIC_TransmitReceiveSpiWithDma_Stub
+#define MIC_TransmitReceiveSpiWithDma_ExpectAndThrow(tx, rx, length, cmock_to_throw) MIC_TransmitReceiveSpiWithDma_CMockExpectAndThrow(__LINE__, tx, rx, length, cmock_to_throw)
+void MIC_TransmitReceiveSpiWithDma_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t* tx, uint16_t* rx, uint32_t length, CEXCEPTION_T cmock_to_throw);
+#define MIC_TransmitReceiveSpiWithDma_ReturnThruPtr_tx(tx) MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_tx(__LINE__, tx, sizeof(uint16_t))
+#define MIC_TransmitReceiveSpiWithDma_ReturnArrayThruPtr_tx(tx, cmock_len) MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_tx(__LINE__, tx, cmock_len * sizeof(*tx))
+#define MIC_TransmitReceiveSpiWithDma_ReturnMemThruPtr_tx(tx, cmock_size) MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_tx(__LINE__, tx, cmock_size)
+void MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_tx(UNITY_LINE_TYPE cmock_line, uint16_t* tx, size_t cmock_size);
+#define MIC_TransmitReceiveSpiWithDma_ReturnThruPtr_rx(rx) MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_rx(__LINE__, rx, sizeof(uint16_t))
+#define MIC_TransmitReceiveSpiWithDma_ReturnArrayThruPtr_rx(rx, cmock_len) MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_rx(__LINE__, rx, cmock_len * sizeof(*rx))
+#define MIC_TransmitReceiveSpiWithDma_ReturnMemThruPtr_rx(rx, cmock_size) MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_rx(__LINE__, rx, cmock_size)
+void MIC_TransmitReceiveSpiWithDma_CMockReturnMemThruPtr_rx(UNITY_LINE_TYPE cmock_line, uint16_t* rx, size_t cmock_size);
+#define MIC_TransmitReceiveSpiWithDma_IgnoreArg_tx() MIC_TransmitReceiveSpiWithDma_CMockIgnoreArg_tx(__LINE__)
+void MIC_TransmitReceiveSpiWithDma_CMockIgnoreArg_tx(UNITY_LINE_TYPE cmock_line);
+#define MIC_TransmitReceiveSpiWithDma_IgnoreArg_rx() MIC_TransmitReceiveSpiWithDma_CMockIgnoreArg_rx(__LINE__)
+void MIC_TransmitReceiveSpiWithDma_CMockIgnoreArg_rx(UNITY_LINE_TYPE cmock_line);
+#define MIC_TransmitReceiveSpiWithDma_IgnoreArg_length() MIC_TransmitReceiveSpiWithDma_CMockIgnoreArg_length(__LINE__)
+void MIC_TransmitReceiveSpiWithDma_CMockIgnoreArg_length(UNITY_LINE_TYPE cmock_line);
+#define MIC_IsTransmitOngoing_IgnoreAndReturn(cmock_retval) MIC_IsTransmitOngoing_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_IsTransmitOngoing_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define MIC_IsTransmitOngoing_StopIgnore() MIC_IsTransmitOngoing_CMockStopIgnore()
+void MIC_IsTransmitOngoing_CMockStopIgnore(void);
+#define MIC_IsTransmitOngoing_ExpectAndReturn(pLtcState, cmock_retval) MIC_IsTransmitOngoing_CMockExpectAndReturn(__LINE__, pLtcState, cmock_retval)
+void MIC_IsTransmitOngoing_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_MIC_IsTransmitOngoing_CALLBACK)(LTC_STATE_s* pLtcState, int cmock_num_calls);
+void MIC_IsTransmitOngoing_AddCallback(CMOCK_MIC_IsTransmitOngoing_CALLBACK Callback);
+void MIC_IsTransmitOngoing_Stub(CMOCK_MIC_IsTransmitOngoing_CALLBACK Callback);
+#define MIC_IsTransmitOngoing_StubWithCallback MIC_IsTransmitOngoing_Stub
+#define MIC_IsTransmitOngoing_ExpectAndThrow(pLtcState, cmock_to_throw) MIC_IsTransmitOngoing_CMockExpectAndThrow(__LINE__, pLtcState, cmock_to_throw)
+void MIC_IsTransmitOngoing_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, CEXCEPTION_T cmock_to_throw);
+#define MIC_IsTransmitOngoing_ReturnThruPtr_pLtcState(pLtcState) MIC_IsTransmitOngoing_CMockReturnMemThruPtr_pLtcState(__LINE__, pLtcState, sizeof(LTC_STATE_s))
+#define MIC_IsTransmitOngoing_ReturnArrayThruPtr_pLtcState(pLtcState, cmock_len) MIC_IsTransmitOngoing_CMockReturnMemThruPtr_pLtcState(__LINE__, pLtcState, cmock_len * sizeof(*pLtcState))
+#define MIC_IsTransmitOngoing_ReturnMemThruPtr_pLtcState(pLtcState, cmock_size) MIC_IsTransmitOngoing_CMockReturnMemThruPtr_pLtcState(__LINE__, pLtcState, cmock_size)
+void MIC_IsTransmitOngoing_CMockReturnMemThruPtr_pLtcState(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, size_t cmock_size);
+#define MIC_IsTransmitOngoing_IgnoreArg_pLtcState() MIC_IsTransmitOngoing_CMockIgnoreArg_pLtcState(__LINE__)
+void MIC_IsTransmitOngoing_CMockIgnoreArg_pLtcState(UNITY_LINE_TYPE cmock_line);
+#define MIC_SetTransmitOngoing_Ignore() MIC_SetTransmitOngoing_CMockIgnore()
+void MIC_SetTransmitOngoing_CMockIgnore(void);
+#define MIC_SetTransmitOngoing_StopIgnore() MIC_SetTransmitOngoing_CMockStopIgnore()
+void MIC_SetTransmitOngoing_CMockStopIgnore(void);
+#define MIC_SetTransmitOngoing_Expect(pLtcState) MIC_SetTransmitOngoing_CMockExpect(__LINE__, pLtcState)
+void MIC_SetTransmitOngoing_CMockExpect(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState);
+typedef void (* CMOCK_MIC_SetTransmitOngoing_CALLBACK)(LTC_STATE_s* pLtcState, int cmock_num_calls);
+void MIC_SetTransmitOngoing_AddCallback(CMOCK_MIC_SetTransmitOngoing_CALLBACK Callback);
+void MIC_SetTransmitOngoing_Stub(CMOCK_MIC_SetTransmitOngoing_CALLBACK Callback);
+#define MIC_SetTransmitOngoing_StubWithCallback MIC_SetTransmitOngoing_Stub
+#define MIC_SetTransmitOngoing_ExpectAndThrow(pLtcState, cmock_to_throw) MIC_SetTransmitOngoing_CMockExpectAndThrow(__LINE__, pLtcState, cmock_to_throw)
+void MIC_SetTransmitOngoing_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, CEXCEPTION_T cmock_to_throw);
+#define MIC_SetTransmitOngoing_ReturnThruPtr_pLtcState(pLtcState) MIC_SetTransmitOngoing_CMockReturnMemThruPtr_pLtcState(__LINE__, pLtcState, sizeof(LTC_STATE_s))
+#define MIC_SetTransmitOngoing_ReturnArrayThruPtr_pLtcState(pLtcState, cmock_len) MIC_SetTransmitOngoing_CMockReturnMemThruPtr_pLtcState(__LINE__, pLtcState, cmock_len * sizeof(*pLtcState))
+#define MIC_SetTransmitOngoing_ReturnMemThruPtr_pLtcState(pLtcState, cmock_size) MIC_SetTransmitOngoing_CMockReturnMemThruPtr_pLtcState(__LINE__, pLtcState, cmock_size)
+void MIC_SetTransmitOngoing_CMockReturnMemThruPtr_pLtcState(UNITY_LINE_TYPE cmock_line, LTC_STATE_s* pLtcState, size_t cmock_size);
+#define MIC_SetTransmitOngoing_IgnoreArg_pLtcState() MIC_SetTransmitOngoing_CMockIgnoreArg_pLtcState(__LINE__)
+void MIC_SetTransmitOngoing_CMockIgnoreArg_pLtcState(UNITY_LINE_TYPE cmock_line);
+#define MIC_ClearTransactionList_Ignore() MIC_ClearTransactionList_CMockIgnore()
+void MIC_ClearTransactionList_CMockIgnore(void);
+#define MIC_ClearTransactionList_StopIgnore() MIC_ClearTransactionList_CMockStopIgnore()
+void MIC_ClearTransactionList_CMockStopIgnore(void);
+#define MIC_ClearTransactionList_Expect(pList, pSpiInterface, pTxBuffer, frameLength) MIC_ClearTransactionList_CMockExpect(__LINE__, pList, pSpiInterface, pTxBuffer, frameLength)
+void MIC_ClearTransactionList_CMockExpect(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuffer, uint32_t frameLength);
+typedef void (* CMOCK_MIC_ClearTransactionList_CALLBACK)(LTC_TRANSACTION_LIST_s* pList, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuffer, uint32_t frameLength, int cmock_num_calls);
+void MIC_ClearTransactionList_AddCallback(CMOCK_MIC_ClearTransactionList_CALLBACK Callback);
+void MIC_ClearTransactionList_Stub(CMOCK_MIC_ClearTransactionList_CALLBACK Callback);
+#define MIC_ClearTransactionList_StubWithCallback MIC_ClearTransactionList_Stub
+#define MIC_ClearTransactionList_ExpectAndThrow(pList, pSpiInterface, pTxBuffer, frameLength, cmock_to_throw) MIC_ClearTransactionList_CMockExpectAndThrow(__LINE__, pList, pSpiInterface, pTxBuffer, frameLength, cmock_to_throw)
+void MIC_ClearTransactionList_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuffer, uint32_t frameLength, CEXCEPTION_T cmock_to_throw);
+#define MIC_ClearTransactionList_ReturnThruPtr_pList(pList) MIC_ClearTransactionList_CMockReturnMemThruPtr_pList(__LINE__, pList, sizeof(LTC_TRANSACTION_LIST_s))
+#define MIC_ClearTransactionList_ReturnArrayThruPtr_pList(pList, cmock_len) MIC_ClearTransactionList_CMockReturnMemThruPtr_pList(__LINE__, pList, cmock_len * sizeof(*pList))
+#define MIC_ClearTransactionList_ReturnMemThruPtr_pList(pList, cmock_size) MIC_ClearTransactionList_CMockReturnMemThruPtr_pList(__LINE__, pList, cmock_size)
+void MIC_ClearTransactionList_CMockReturnMemThruPtr_pList(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, size_t cmock_size);
+#define MIC_ClearTransactionList_ReturnThruPtr_pSpiInterface(pSpiInterface) MIC_ClearTransactionList_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define MIC_ClearTransactionList_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) MIC_ClearTransactionList_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define MIC_ClearTransactionList_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) MIC_ClearTransactionList_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void MIC_ClearTransactionList_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define MIC_ClearTransactionList_ReturnThruPtr_pTxBuffer(pTxBuffer) MIC_ClearTransactionList_CMockReturnMemThruPtr_pTxBuffer(__LINE__, pTxBuffer, sizeof(uint16_t))
+#define MIC_ClearTransactionList_ReturnArrayThruPtr_pTxBuffer(pTxBuffer, cmock_len) MIC_ClearTransactionList_CMockReturnMemThruPtr_pTxBuffer(__LINE__, pTxBuffer, cmock_len * sizeof(*pTxBuffer))
+#define MIC_ClearTransactionList_ReturnMemThruPtr_pTxBuffer(pTxBuffer, cmock_size) MIC_ClearTransactionList_CMockReturnMemThruPtr_pTxBuffer(__LINE__, pTxBuffer, cmock_size)
+void MIC_ClearTransactionList_CMockReturnMemThruPtr_pTxBuffer(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuffer, size_t cmock_size);
+#define MIC_ClearTransactionList_IgnoreArg_pList() MIC_ClearTransactionList_CMockIgnoreArg_pList(__LINE__)
+void MIC_ClearTransactionList_CMockIgnoreArg_pList(UNITY_LINE_TYPE cmock_line);
+#define MIC_ClearTransactionList_IgnoreArg_pSpiInterface() MIC_ClearTransactionList_CMockIgnoreArg_pSpiInterface(__LINE__)
+void MIC_ClearTransactionList_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define MIC_ClearTransactionList_IgnoreArg_pTxBuffer() MIC_ClearTransactionList_CMockIgnoreArg_pTxBuffer(__LINE__)
+void MIC_ClearTransactionList_CMockIgnoreArg_pTxBuffer(UNITY_LINE_TYPE cmock_line);
+#define MIC_ClearTransactionList_IgnoreArg_frameLength() MIC_ClearTransactionList_CMockIgnoreArg_frameLength(__LINE__)
+void MIC_ClearTransactionList_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line);
+#define MIC_QueueTransaction_IgnoreAndReturn(cmock_retval) MIC_QueueTransaction_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_QueueTransaction_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_QueueTransaction_StopIgnore() MIC_QueueTransaction_CMockStopIgnore()
+void MIC_QueueTransaction_CMockStopIgnore(void);
+#define MIC_QueueTransaction_ExpectAndReturn(pList, pCommand, pRxBuffer, registerSet, cmock_retval) MIC_QueueTransaction_CMockExpectAndReturn(__LINE__, pList, pCommand, pRxBuffer, registerSet, cmock_retval)
+void MIC_QueueTransaction_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, uint16_t* pCommand, uint16_t* pRxBuffer, uint8_t registerSet, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_QueueTransaction_CALLBACK)(LTC_TRANSACTION_LIST_s* pList, uint16_t* pCommand, uint16_t* pRxBuffer, uint8_t registerSet, int cmock_num_calls);
+void MIC_QueueTransaction_AddCallback(CMOCK_MIC_QueueTransaction_CALLBACK Callback);
+void MIC_QueueTransaction_Stub(CMOCK_MIC_QueueTransaction_CALLBACK Callback);
+#define MIC_QueueTransaction_StubWithCallback MIC_QueueTransaction_Stub
+#define MIC_QueueTransaction_ExpectAndThrow(pList, pCommand, pRxBuffer, registerSet, cmock_to_throw) MIC_QueueTransaction_CMockExpectAndThrow(__LINE__, pList, pCommand, pRxBuffer, registerSet, cmock_to_throw)
+void MIC_QueueTransaction_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, uint16_t* pCommand, uint16_t* pRxBuffer, uint8_t registerSet, CEXCEPTION_T cmock_to_throw);
+#define MIC_QueueTransaction_ReturnThruPtr_pList(pList) MIC_QueueTransaction_CMockReturnMemThruPtr_pList(__LINE__, pList, sizeof(LTC_TRANSACTION_LIST_s))
+#define MIC_QueueTransaction_ReturnArrayThruPtr_pList(pList, cmock_len) MIC_QueueTransaction_CMockReturnMemThruPtr_pList(__LINE__, pList, cmock_len * sizeof(*pList))
+#define MIC_QueueTransaction_ReturnMemThruPtr_pList(pList, cmock_size) MIC_QueueTransaction_CMockReturnMemThruPtr_pList(__LINE__, pList, cmock_size)
+void MIC_QueueTransaction_CMockReturnMemThruPtr_pList(UNITY_LINE_TYPE cmock_line, LTC_TRANSACTION_LIST_s* pList, size_t cmock_size);
+#define MIC_QueueTransaction_ReturnThruPtr_pCommand(pCommand) MIC_QueueTransaction_CMockReturnMemThruPtr_pCommand(__LINE__, pCommand, sizeof(uint16_t))
+#define MIC_QueueTransaction_ReturnArrayThruPtr_pCommand(pCommand, cmock_len) MIC_QueueTransaction_CMockReturnMemThruPtr_pCommand(__LINE__, pCommand, cmock_len * sizeof(*pCommand))
+#define MIC_QueueTransaction_ReturnMemThruPtr_pCommand(pCommand, cmock_size) MIC_QueueTransaction_CMockReturnMemThruPtr_pCommand(__LINE__, pCommand, cmock_size)
+void MIC_QueueTransaction_CMockReturnMemThruPtr_pCommand(UNITY_LINE_TYPE cmock_line, uint16_t* pCommand, size_t cmock_size);
+#define MIC_QueueTransaction_ReturnThruPtr_pRxBuffer(pRxBuffer) MIC_QueueTransaction_CMockReturnMemThruPtr_pRxBuffer(__LINE__, pRxBuffer, sizeof(uint16_t))
+#define MIC_QueueTransaction_ReturnArrayThruPtr_pRxBuffer(pRxBuffer, cmock_len) MIC_QueueTransaction_CMockReturnMemThruPtr_pRxBuffer(__LINE__, pRxBuffer, cmock_len * sizeof(*pRxBuffer))
+#define MIC_QueueTransaction_ReturnMemThruPtr_pRxBuffer(pRxBuffer, cmock_size) MIC_QueueTransaction_CMockReturnMemThruPtr_pRxBuffer(__LINE__, pRxBuffer, cmock_size)
+void MIC_QueueTransaction_CMockReturnMemThruPtr_pRxBuffer(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuffer, size_t cmock_size);
+#define MIC_QueueTransaction_IgnoreArg_pList() MIC_QueueTransaction_CMockIgnoreArg_pList(__LINE__)
+void MIC_QueueTransaction_CMockIgnoreArg_pList(UNITY_LINE_TYPE cmock_line);
+#define MIC_QueueTransaction_IgnoreArg_pCommand() MIC_QueueTransaction_CMockIgnoreArg_pCommand(__LINE__)
+void MIC_QueueTransaction_CMockIgnoreArg_pCommand(UNITY_LINE_TYPE cmock_line);
+#define MIC_QueueTransaction_IgnoreArg_pRxBuffer() MIC_QueueTransaction_CMockIgnoreArg_pRxBuffer(__LINE__)
+void MIC_QueueTransaction_CMockIgnoreArg_pRxBuffer(UNITY_LINE_TYPE cmock_line);
+#define MIC_QueueTransaction_IgnoreArg_registerSet() MIC_QueueTransaction_CMockIgnoreArg_registerSet(__LINE__)
+void MIC_QueueTransaction_CMockIgnoreArg_registerSet(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,625 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockltc_pec.h"
+
+static const char* CMockString_LTC_CheckFramePecs = "LTC_CheckFramePecs";
+static const char* CMockString_LTC_SetFramePecs = "LTC_SetFramePecs";
+static const char* CMockString_LTC_pec15_calc = "LTC_pec15_calc";
+static const char* CMockString_data = "data";
+static const char* CMockString_len = "len";
+static const char* CMockString_numberOfDevices = "numberOfDevices";
+static const char* CMockString_pFrame = "pFrame";
+static const char* CMockString_pValidMask = "pValidMask";
+
+typedef struct _CMOCK_LTC_pec15_calc_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint16_t ReturnVal;
+  int CallOrder;
+  uint8_t Expected_len;
+  uint8_t* Expected_data;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_data_Used;
+  uint8_t* ReturnThruPtr_data_Val;
+  size_t ReturnThruPtr_data_Size;
+  char IgnoreArg_len;
+  char IgnoreArg_data;
+
+} CMOCK_LTC_pec15_calc_CALL_INSTANCE;
+
+typedef struct _CMOCK_LTC_SetFramePecs_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint16_t* Expected_pFrame;
+  uint16_t Expected_numberOfDevices;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pFrame_Used;
+  uint16_t* ReturnThruPtr_pFrame_Val;
+  size_t ReturnThruPtr_pFrame_Size;
+  char IgnoreArg_pFrame;
+  char IgnoreArg_numberOfDevices;
+
+} CMOCK_LTC_SetFramePecs_CALL_INSTANCE;
+
+typedef struct _CMOCK_LTC_CheckFramePecs_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  const uint16_t* Expected_pFrame;
+  uint16_t Expected_numberOfDevices;
+  uint32_t* Expected_pValidMask;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pValidMask_Used;
+  uint32_t* ReturnThruPtr_pValidMask_Val;
+  size_t ReturnThruPtr_pValidMask_Size;
+  char IgnoreArg_pFrame;
+  char IgnoreArg_numberOfDevices;
+  char IgnoreArg_pValidMask;
+
+} CMOCK_LTC_CheckFramePecs_CALL_INSTANCE;
+
+static struct Mockltc_pecInstance
+{
+  char LTC_pec15_calc_IgnoreBool;
+  uint16_t LTC_pec15_calc_FinalReturn;
+  char LTC_pec15_calc_CallbackBool;
+  CMOCK_LTC_pec15_calc_CALLBACK LTC_pec15_calc_CallbackFunctionPointer;
+  int LTC_pec15_calc_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LTC_pec15_calc_CallInstance;
+  char LTC_SetFramePecs_IgnoreBool;
+  char LTC_SetFramePecs_CallbackBool;
+  CMOCK_LTC_SetFramePecs_CALLBACK LTC_SetFramePecs_CallbackFunctionPointer;
+  int LTC_SetFramePecs_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LTC_SetFramePecs_CallInstance;
+  char LTC_CheckFramePecs_IgnoreBool;
+  _Bool LTC_CheckFramePecs_FinalReturn;
+  char LTC_CheckFramePecs_CallbackBool;
+  CMOCK_LTC_CheckFramePecs_CALLBACK LTC_CheckFramePecs_CallbackFunctionPointer;
+  int LTC_CheckFramePecs_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE LTC_CheckFramePecs_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockltc_pec_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.LTC_pec15_calc_CallInstance;
+  if (Mock.LTC_pec15_calc_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_LTC_pec15_calc);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.LTC_pec15_calc_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.LTC_SetFramePecs_CallInstance;
+  if (Mock.LTC_SetFramePecs_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_LTC_SetFramePecs);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.LTC_SetFramePecs_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.LTC_CheckFramePecs_CallInstance;
+  if (Mock.LTC_CheckFramePecs_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_LTC_CheckFramePecs);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.LTC_CheckFramePecs_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockltc_pec_Init(void)
+{
+  Mockltc_pec_Destroy();
+}
+
+void Mockltc_pec_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+uint16_t LTC_pec15_calc(uint8_t len, uint8_t* data)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LTC_pec15_calc_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LTC_pec15_calc);
+  cmock_call_instance = (CMOCK_LTC_pec15_calc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LTC_pec15_calc_CallInstance);
+  Mock.LTC_pec15_calc_CallInstance = CMock_Guts_MemNext(Mock.LTC_pec15_calc_CallInstance);
+  if (Mock.LTC_pec15_calc_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LTC_pec15_calc_FinalReturn;
+    Mock.LTC_pec15_calc_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.LTC_pec15_calc_CallbackBool &&
+      Mock.LTC_pec15_calc_CallbackFunctionPointer != NULL)
+  {
+    uint16_t cmock_cb_ret = Mock.LTC_pec15_calc_CallbackFunctionPointer(len, data, Mock.LTC_pec15_calc_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_len)
+  {
+    UNITY_SET_DETAILS(CMockString_LTC_pec15_calc,CMockString_len);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_len, len, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_data)
+  {
+    UNITY_SET_DETAILS(CMockString_LTC_pec15_calc,CMockString_data);
+    if (cmock_call_instance->Expected_data == NULL)
+      { UNITY_TEST_ASSERT_NULL(data, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX8_ARRAY(cmock_call_instance->Expected_data, data, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.LTC_pec15_calc_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.LTC_pec15_calc_CallbackFunctionPointer(len, data, Mock.LTC_pec15_calc_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_data_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(data, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)data, (void*)cmock_call_instance->ReturnThruPtr_data_Val,
+      cmock_call_instance->ReturnThruPtr_data_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LTC_pec15_calc(CMOCK_LTC_pec15_calc_CALL_INSTANCE* cmock_call_instance, uint8_t len, uint8_t* data);
+void CMockExpectParameters_LTC_pec15_calc(CMOCK_LTC_pec15_calc_CALL_INSTANCE* cmock_call_instance, uint8_t len, uint8_t* data)
+{
+  cmock_call_instance->Expected_len = len;
+  cmock_call_instance->IgnoreArg_len = 0;
+  cmock_call_instance->Expected_data = data;
+  cmock_call_instance->IgnoreArg_data = 0;
+  cmock_call_instance->ReturnThruPtr_data_Used = 0;
+}
+
+void LTC_pec15_calc_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LTC_pec15_calc_CALL_INSTANCE));
+  CMOCK_LTC_pec15_calc_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_pec15_calc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LTC_pec15_calc_CallInstance = CMock_Guts_MemChain(Mock.LTC_pec15_calc_CallInstance, cmock_guts_index);
+  Mock.LTC_pec15_calc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LTC_pec15_calc_IgnoreBool = (char)1;
+}
+
+void LTC_pec15_calc_CMockStopIgnore(void)
+{
+  if(Mock.LTC_pec15_calc_IgnoreBool)
+    Mock.LTC_pec15_calc_CallInstance = CMock_Guts_MemNext(Mock.LTC_pec15_calc_CallInstance);
+  Mock.LTC_pec15_calc_IgnoreBool = (char)0;
+}
+
+void LTC_pec15_calc_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t len, uint8_t* data, uint16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LTC_pec15_calc_CALL_INSTANCE));
+  CMOCK_LTC_pec15_calc_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_pec15_calc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LTC_pec15_calc_CallInstance = CMock_Guts_MemChain(Mock.LTC_pec15_calc_CallInstance, cmock_guts_index);
+  Mock.LTC_pec15_calc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_LTC_pec15_calc(cmock_call_instance, len, data);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void LTC_pec15_calc_AddCallback(CMOCK_LTC_pec15_calc_CALLBACK Callback)
+{
+  Mock.LTC_pec15_calc_IgnoreBool = (char)0;
+  Mock.LTC_pec15_calc_CallbackBool = (char)1;
+  Mock.LTC_pec15_calc_CallbackFunctionPointer = Callback;
+}
+
+void LTC_pec15_calc_Stub(CMOCK_LTC_pec15_calc_CALLBACK Callback)
+{
+  Mock.LTC_pec15_calc_IgnoreBool = (char)0;
+  Mock.LTC_pec15_calc_CallbackBool = (char)0;
+  Mock.LTC_pec15_calc_CallbackFunctionPointer = Callback;
+}
+
+void LTC_pec15_calc_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t len, uint8_t* data, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LTC_pec15_calc_CALL_INSTANCE));
+  CMOCK_LTC_pec15_calc_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_pec15_calc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LTC_pec15_calc_CallInstance = CMock_Guts_MemChain(Mock.LTC_pec15_calc_CallInstance, cmock_guts_index);
+  Mock.LTC_pec15_calc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_LTC_pec15_calc(cmock_call_instance, len, data);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void LTC_pec15_calc_CMockReturnMemThruPtr_data(UNITY_LINE_TYPE cmock_line, uint8_t* data, size_t cmock_size)
+{
+  CMOCK_LTC_pec15_calc_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_pec15_calc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_pec15_calc_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_data_Used = 1;
+  cmock_call_instance->ReturnThruPtr_data_Val = data;
+  cmock_call_instance->ReturnThruPtr_data_Size = cmock_size;
+}
+
+void LTC_pec15_calc_CMockIgnoreArg_len(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_LTC_pec15_calc_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_pec15_calc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_pec15_calc_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_len = 1;
+}
+
+void LTC_pec15_calc_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_LTC_pec15_calc_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_pec15_calc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_pec15_calc_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_data = 1;
+}
+
+void LTC_SetFramePecs(uint16_t* pFrame, uint16_t numberOfDevices)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LTC_SetFramePecs_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LTC_SetFramePecs);
+  cmock_call_instance = (CMOCK_LTC_SetFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LTC_SetFramePecs_CallInstance);
+  Mock.LTC_SetFramePecs_CallInstance = CMock_Guts_MemNext(Mock.LTC_SetFramePecs_CallInstance);
+  if (Mock.LTC_SetFramePecs_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.LTC_SetFramePecs_CallbackBool &&
+      Mock.LTC_SetFramePecs_CallbackFunctionPointer != NULL)
+  {
+    Mock.LTC_SetFramePecs_CallbackFunctionPointer(pFrame, numberOfDevices, Mock.LTC_SetFramePecs_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pFrame)
+  {
+    UNITY_SET_DETAILS(CMockString_LTC_SetFramePecs,CMockString_pFrame);
+    if (cmock_call_instance->Expected_pFrame == NULL)
+      { UNITY_TEST_ASSERT_NULL(pFrame, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pFrame, pFrame, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_numberOfDevices)
+  {
+    UNITY_SET_DETAILS(CMockString_LTC_SetFramePecs,CMockString_numberOfDevices);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_numberOfDevices, numberOfDevices, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.LTC_SetFramePecs_CallbackFunctionPointer != NULL)
+  {
+    Mock.LTC_SetFramePecs_CallbackFunctionPointer(pFrame, numberOfDevices, Mock.LTC_SetFramePecs_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pFrame_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pFrame, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pFrame, (void*)cmock_call_instance->ReturnThruPtr_pFrame_Val,
+      cmock_call_instance->ReturnThruPtr_pFrame_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_LTC_SetFramePecs(CMOCK_LTC_SetFramePecs_CALL_INSTANCE* cmock_call_instance, uint16_t* pFrame, uint16_t numberOfDevices);
+void CMockExpectParameters_LTC_SetFramePecs(CMOCK_LTC_SetFramePecs_CALL_INSTANCE* cmock_call_instance, uint16_t* pFrame, uint16_t numberOfDevices)
+{
+  cmock_call_instance->Expected_pFrame = pFrame;
+  cmock_call_instance->IgnoreArg_pFrame = 0;
+  cmock_call_instance->ReturnThruPtr_pFrame_Used = 0;
+  cmock_call_instance->Expected_numberOfDevices = numberOfDevices;
+  cmock_call_instance->IgnoreArg_numberOfDevices = 0;
+}
+
+void LTC_SetFramePecs_CMockIgnore(void)
+{
+  Mock.LTC_SetFramePecs_IgnoreBool = (char)1;
+}
+
+void LTC_SetFramePecs_CMockStopIgnore(void)
+{
+  Mock.LTC_SetFramePecs_IgnoreBool = (char)0;
+}
+
+void LTC_SetFramePecs_CMockExpect(UNITY_LINE_TYPE cmock_line, uint16_t* pFrame, uint16_t numberOfDevices)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LTC_SetFramePecs_CALL_INSTANCE));
+  CMOCK_LTC_SetFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_SetFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LTC_SetFramePecs_CallInstance = CMock_Guts_MemChain(Mock.LTC_SetFramePecs_CallInstance, cmock_guts_index);
+  Mock.LTC_SetFramePecs_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_LTC_SetFramePecs(cmock_call_instance, pFrame, numberOfDevices);
+}
+
+void LTC_SetFramePecs_AddCallback(CMOCK_LTC_SetFramePecs_CALLBACK Callback)
+{
+  Mock.LTC_SetFramePecs_IgnoreBool = (char)0;
+  Mock.LTC_SetFramePecs_CallbackBool = (char)1;
+  Mock.LTC_SetFramePecs_CallbackFunctionPointer = Callback;
+}
+
+void LTC_SetFramePecs_Stub(CMOCK_LTC_SetFramePecs_CALLBACK Callback)
+{
+  Mock.LTC_SetFramePecs_IgnoreBool = (char)0;
+  Mock.LTC_SetFramePecs_CallbackBool = (char)0;
+  Mock.LTC_SetFramePecs_CallbackFunctionPointer = Callback;
+}
+
+void LTC_SetFramePecs_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t* pFrame, uint16_t numberOfDevices, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LTC_SetFramePecs_CALL_INSTANCE));
+  CMOCK_LTC_SetFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_SetFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LTC_SetFramePecs_CallInstance = CMock_Guts_MemChain(Mock.LTC_SetFramePecs_CallInstance, cmock_guts_index);
+  Mock.LTC_SetFramePecs_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_LTC_SetFramePecs(cmock_call_instance, pFrame, numberOfDevices);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void LTC_SetFramePecs_CMockReturnMemThruPtr_pFrame(UNITY_LINE_TYPE cmock_line, uint16_t* pFrame, size_t cmock_size)
+{
+  CMOCK_LTC_SetFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_SetFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_SetFramePecs_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pFrame_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pFrame_Val = pFrame;
+  cmock_call_instance->ReturnThruPtr_pFrame_Size = cmock_size;
+}
+
+void LTC_SetFramePecs_CMockIgnoreArg_pFrame(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_LTC_SetFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_SetFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_SetFramePecs_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pFrame = 1;
+}
+
+void LTC_SetFramePecs_CMockIgnoreArg_numberOfDevices(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_LTC_SetFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_SetFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_SetFramePecs_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_numberOfDevices = 1;
+}
+
+_Bool LTC_CheckFramePecs(const uint16_t* pFrame, uint16_t numberOfDevices, uint32_t* pValidMask)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_LTC_CheckFramePecs);
+  cmock_call_instance = (CMOCK_LTC_CheckFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.LTC_CheckFramePecs_CallInstance);
+  Mock.LTC_CheckFramePecs_CallInstance = CMock_Guts_MemNext(Mock.LTC_CheckFramePecs_CallInstance);
+  if (Mock.LTC_CheckFramePecs_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.LTC_CheckFramePecs_FinalReturn;
+    memcpy((void*)(&Mock.LTC_CheckFramePecs_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.LTC_CheckFramePecs_CallbackBool &&
+      Mock.LTC_CheckFramePecs_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.LTC_CheckFramePecs_CallbackFunctionPointer(pFrame, numberOfDevices, pValidMask, Mock.LTC_CheckFramePecs_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pFrame)
+  {
+    UNITY_SET_DETAILS(CMockString_LTC_CheckFramePecs,CMockString_pFrame);
+    if (cmock_call_instance->Expected_pFrame == NULL)
+      { UNITY_TEST_ASSERT_NULL(pFrame, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pFrame, pFrame, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_numberOfDevices)
+  {
+    UNITY_SET_DETAILS(CMockString_LTC_CheckFramePecs,CMockString_numberOfDevices);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_numberOfDevices, numberOfDevices, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pValidMask)
+  {
+    UNITY_SET_DETAILS(CMockString_LTC_CheckFramePecs,CMockString_pValidMask);
+    if (cmock_call_instance->Expected_pValidMask == NULL)
+      { UNITY_TEST_ASSERT_NULL(pValidMask, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pValidMask, pValidMask, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.LTC_CheckFramePecs_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.LTC_CheckFramePecs_CallbackFunctionPointer(pFrame, numberOfDevices, pValidMask, Mock.LTC_CheckFramePecs_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pValidMask_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pValidMask, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pValidMask, (void*)cmock_call_instance->ReturnThruPtr_pValidMask_Val,
+      cmock_call_instance->ReturnThruPtr_pValidMask_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_LTC_CheckFramePecs(CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance, const uint16_t* pFrame, uint16_t numberOfDevices, uint32_t* pValidMask);
+void CMockExpectParameters_LTC_CheckFramePecs(CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance, const uint16_t* pFrame, uint16_t numberOfDevices, uint32_t* pValidMask)
+{
+  cmock_call_instance->Expected_pFrame = pFrame;
+  cmock_call_instance->IgnoreArg_pFrame = 0;
+  cmock_call_instance->Expected_numberOfDevices = numberOfDevices;
+  cmock_call_instance->IgnoreArg_numberOfDevices = 0;
+  cmock_call_instance->Expected_pValidMask = pValidMask;
+  cmock_call_instance->IgnoreArg_pValidMask = 0;
+  cmock_call_instance->ReturnThruPtr_pValidMask_Used = 0;
+}
+
+void LTC_CheckFramePecs_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LTC_CheckFramePecs_CALL_INSTANCE));
+  CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_CheckFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LTC_CheckFramePecs_CallInstance = CMock_Guts_MemChain(Mock.LTC_CheckFramePecs_CallInstance, cmock_guts_index);
+  Mock.LTC_CheckFramePecs_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.LTC_CheckFramePecs_IgnoreBool = (char)1;
+}
+
+void LTC_CheckFramePecs_CMockStopIgnore(void)
+{
+  if(Mock.LTC_CheckFramePecs_IgnoreBool)
+    Mock.LTC_CheckFramePecs_CallInstance = CMock_Guts_MemNext(Mock.LTC_CheckFramePecs_CallInstance);
+  Mock.LTC_CheckFramePecs_IgnoreBool = (char)0;
+}
+
+void LTC_CheckFramePecs_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const uint16_t* pFrame, uint16_t numberOfDevices, uint32_t* pValidMask, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LTC_CheckFramePecs_CALL_INSTANCE));
+  CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_CheckFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LTC_CheckFramePecs_CallInstance = CMock_Guts_MemChain(Mock.LTC_CheckFramePecs_CallInstance, cmock_guts_index);
+  Mock.LTC_CheckFramePecs_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_LTC_CheckFramePecs(cmock_call_instance, pFrame, numberOfDevices, pValidMask);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void LTC_CheckFramePecs_AddCallback(CMOCK_LTC_CheckFramePecs_CALLBACK Callback)
+{
+  Mock.LTC_CheckFramePecs_IgnoreBool = (char)0;
+  Mock.LTC_CheckFramePecs_CallbackBool = (char)1;
+  Mock.LTC_CheckFramePecs_CallbackFunctionPointer = Callback;
+}
+
+void LTC_CheckFramePecs_Stub(CMOCK_LTC_CheckFramePecs_CALLBACK Callback)
+{
+  Mock.LTC_CheckFramePecs_IgnoreBool = (char)0;
+  Mock.LTC_CheckFramePecs_CallbackBool = (char)0;
+  Mock.LTC_CheckFramePecs_CallbackFunctionPointer = Callback;
+}
+
+void LTC_CheckFramePecs_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const uint16_t* pFrame, uint16_t numberOfDevices, uint32_t* pValidMask, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_LTC_CheckFramePecs_CALL_INSTANCE));
+  CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_CheckFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.LTC_CheckFramePecs_CallInstance = CMock_Guts_MemChain(Mock.LTC_CheckFramePecs_CallInstance, cmock_guts_index);
+  Mock.LTC_CheckFramePecs_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_LTC_CheckFramePecs(cmock_call_instance, pFrame, numberOfDevices, pValidMask);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void LTC_CheckFramePecs_CMockReturnMemThruPtr_pValidMask(UNITY_LINE_TYPE cmock_line, uint32_t* pValidMask, size_t cmock_size)
+{
+  CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_CheckFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_CheckFramePecs_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pValidMask_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pValidMask_Val = pValidMask;
+  cmock_call_instance->ReturnThruPtr_pValidMask_Size = cmock_size;
+}
+
+void LTC_CheckFramePecs_CMockIgnoreArg_pFrame(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_CheckFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_CheckFramePecs_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pFrame = 1;
+}
+
+void LTC_CheckFramePecs_CMockIgnoreArg_numberOfDevices(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_CheckFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_CheckFramePecs_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_numberOfDevices = 1;
+}
+
+void LTC_CheckFramePecs_CMockIgnoreArg_pValidMask(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_LTC_CheckFramePecs_CALL_INSTANCE* cmock_call_instance = (CMOCK_LTC_CheckFramePecs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.LTC_CheckFramePecs_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pValidMask = 1;
+}
+
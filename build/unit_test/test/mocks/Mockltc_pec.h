@@ -0,0 +1,108 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKLTC_PEC_H
+#define _MOCKLTC_PEC_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "ltc_pec.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockltc_pec_Init(void);
+void Mockltc_pec_Destroy(void);
+void Mockltc_pec_Verify(void);
+
+
+
+
+#define LTC_pec15_calc_IgnoreAndReturn(cmock_retval) LTC_pec15_calc_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LTC_pec15_calc_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t cmock_to_return);
+#define LTC_pec15_calc_StopIgnore() LTC_pec15_calc_CMockStopIgnore()
+void LTC_pec15_calc_CMockStopIgnore(void);
+#define LTC_pec15_calc_ExpectAndReturn(len, data, cmock_retval) LTC_pec15_calc_CMockExpectAndReturn(__LINE__, len, data, cmock_retval)
+void LTC_pec15_calc_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t len, uint8_t* data, uint16_t cmock_to_return);
+typedef uint16_t (* CMOCK_LTC_pec15_calc_CALLBACK)(uint8_t len, uint8_t* data, int cmock_num_calls);
+void LTC_pec15_calc_AddCallback(CMOCK_LTC_pec15_calc_CALLBACK Callback);
+void LTC_pec15_calc_Stub(CMOCK_LTC_pec15_calc_CALLBACK Callback);
+#define LTC_pec15_calc_StubWithCallback LTC_pec15_calc_Stub
+#define LTC_pec15_calc_ExpectAndThrow(len, data, cmock_to_throw) LTC_pec15_calc_CMockExpectAndThrow(__LINE__, len, data, cmock_to_throw)
+void LTC_pec15_calc_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t len, uint8_t* data, CEXCEPTION_T cmock_to_throw);
+#define LTC_pec15_calc_ReturnThruPtr_data(data) LTC_pec15_calc_CMockReturnMemThruPtr_data(__LINE__, data, sizeof(uint8_t))
+#define LTC_pec15_calc_ReturnArrayThruPtr_data(data, cmock_len) LTC_pec15_calc_CMockReturnMemThruPtr_data(__LINE__, data, cmock_len * sizeof(*data))
+#define LTC_pec15_calc_ReturnMemThruPtr_data(data, cmock_size) LTC_pec15_calc_CMockReturnMemThruPtr_data(__LINE__, data, cmock_size)
+void LTC_pec15_calc_CMockReturnMemThruPtr_data(UNITY_LINE_TYPE cmock_line, uint8_t* data, size_t cmock_size);
+#define LTC_pec15_calc_IgnoreArg_len() LTC_pec15_calc_CMockIgnoreArg_len(__LINE__)
+void LTC_pec15_calc_CMockIgnoreArg_len(UNITY_LINE_TYPE cmock_line);
+#define LTC_pec15_calc_IgnoreArg_data() LTC_pec15_calc_CMockIgnoreArg_data(__LINE__)
+void LTC_pec15_calc_CMockIgnoreArg_data(UNITY_LINE_TYPE cmock_line);
+#define LTC_SetFramePecs_Ignore() LTC_SetFramePecs_CMockIgnore()
+void LTC_SetFramePecs_CMockIgnore(void);
+#define LTC_SetFramePecs_StopIgnore() LTC_SetFramePecs_CMockStopIgnore()
+void LTC_SetFramePecs_CMockStopIgnore(void);
+#define LTC_SetFramePecs_Expect(pFrame, numberOfDevices) LTC_SetFramePecs_CMockExpect(__LINE__, pFrame, numberOfDevices)
+void LTC_SetFramePecs_CMockExpect(UNITY_LINE_TYPE cmock_line, uint16_t* pFrame, uint16_t numberOfDevices);
+typedef void (* CMOCK_LTC_SetFramePecs_CALLBACK)(uint16_t* pFrame, uint16_t numberOfDevices, int cmock_num_calls);
+void LTC_SetFramePecs_AddCallback(CMOCK_LTC_SetFramePecs_CALLBACK Callback);
+void LTC_SetFramePecs_Stub(CMOCK_LTC_SetFramePecs_CALLBACK Callback);
+#define LTC_SetFramePecs_StubWithCallback LTC_SetFramePecs_Stub
+#define LTC_SetFramePecs_ExpectAndThrow(pFrame, numberOfDevices, cmock_to_throw) LTC_SetFramePecs_CMockExpectAndThrow(__LINE__, pFrame, numberOfDevices, cmock_to_throw)
+void LTC_SetFramePecs_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t* pFrame, uint16_t numberOfDevices, CEXCEPTION_T cmock_to_throw);
+#define LTC_SetFramePecs_ReturnThruPtr_pFrame(pFrame) LTC_SetFramePecs_CMockReturnMemThruPtr_pFrame(__LINE__, pFrame, sizeof(uint16_t))
+#define LTC_SetFramePecs_ReturnArrayThruPtr_pFrame(pFrame, cmock_len) LTC_SetFramePecs_CMockReturnMemThruPtr_pFrame(__LINE__, pFrame, cmock_len * sizeof(*pFrame))
+#define LTC_SetFramePecs_ReturnMemThruPtr_pFrame(pFrame, cmock_size) LTC_SetFramePecs_CMockReturnMemThruPtr_pFrame(__LINE__, pFrame, cmock_size)
+void LTC_SetFramePecs_CMockReturnMemThruPtr_pFrame(UNITY_LINE_TYPE cmock_line, uint16_t* pFrame, size_t cmock_size);
+#define LTC_SetFramePecs_IgnoreArg_pFrame() LTC_SetFramePecs_CMockIgnoreArg_pFrame(__LINE__)
+void LTC_SetFramePecs_CMockIgnoreArg_pFrame(UNITY_LINE_TYPE cmock_line);
+#define LTC_SetFramePecs_IgnoreArg_numberOfDevices() LTC_SetFramePecs_CMockIgnoreArg_numberOfDevices(__LINE__)
+void LTC_SetFramePecs_CMockIgnoreArg_numberOfDevices(UNITY_LINE_TYPE cmock_line);
+#define LTC_CheckFramePecs_IgnoreAndReturn(cmock_retval) LTC_CheckFramePecs_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void LTC_CheckFramePecs_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define LTC_CheckFramePecs_StopIgnore() LTC_CheckFramePecs_CMockStopIgnore()
+void LTC_CheckFramePecs_CMockStopIgnore(void);
+#define LTC_CheckFramePecs_ExpectAndReturn(pFrame, numberOfDevices, pValidMask, cmock_retval) LTC_CheckFramePecs_CMockExpectAndReturn(__LINE__, pFrame, numberOfDevices, pValidMask, cmock_retval)
+void LTC_CheckFramePecs_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const uint16_t* pFrame, uint16_t numberOfDevices, uint32_t* pValidMask, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_LTC_CheckFramePecs_CALLBACK)(const uint16_t* pFrame, uint16_t numberOfDevices, uint32_t* pValidMask, int cmock_num_calls);
+void LTC_CheckFramePecs_AddCallback(CMOCK_LTC_CheckFramePecs_CALLBACK Callback);
+void LTC_CheckFramePecs_Stub(CMOCK_LTC_CheckFramePecs_CALLBACK Callback);
+#define LTC_CheckFramePecs_StubWithCallback LTC_CheckFramePecs_Stub
+#define LTC_CheckFramePecs_ExpectAndThrow(pFrame, numberOfDevices, pValidMask, cmock_to_throw) LTC_CheckFramePecs_CMockExpectAndThrow(__LINE__, pFrame, numberOfDevices, pValidMask, cmock_to_throw)
+void LTC_CheckFramePecs_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const uint16_t* pFrame, uint16_t numberOfDevices, uint32_t* pValidMask, CEXCEPTION_T cmock_to_throw);
+#define LTC_CheckFramePecs_ReturnThruPtr_pValidMask(pValidMask) LTC_CheckFramePecs_CMockReturnMemThruPtr_pValidMask(__LINE__, pValidMask, sizeof(uint32_t))
+#define LTC_CheckFramePecs_ReturnArrayThruPtr_pValidMask(pValidMask, cmock_len) LTC_CheckFramePecs_CMockReturnMemThruPtr_pValidMask(__LINE__, pValidMask, cmock_len * sizeof(*pValidMask))
+#define LTC_CheckFramePecs_ReturnMemThruPtr_pValidMask(pValidMask, cmock_size) LTC_CheckFramePecs_CMockReturnMemThruPtr_pValidMask(__LINE__, pValidMask, cmock_size)
+void LTC_CheckFramePecs_CMockReturnMemThruPtr_pValidMask(UNITY_LINE_TYPE cmock_line, uint32_t* pValidMask, size_t cmock_size);
+#define LTC_CheckFramePecs_IgnoreArg_pFrame() LTC_CheckFramePecs_CMockIgnoreArg_pFrame(__LINE__)
+void LTC_CheckFramePecs_CMockIgnoreArg_pFrame(UNITY_LINE_TYPE cmock_line);
+#define LTC_CheckFramePecs_IgnoreArg_numberOfDevices() LTC_CheckFramePecs_CMockIgnoreArg_numberOfDevices(__LINE__)
+void LTC_CheckFramePecs_CMockIgnoreArg_numberOfDevices(UNITY_LINE_TYPE cmock_line);
+#define LTC_CheckFramePecs_IgnoreArg_pValidMask() LTC_CheckFramePecs_CMockIgnoreArg_pValidMask(__LINE__)
+void LTC_CheckFramePecs_CMockIgnoreArg_pValidMask(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,869 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockmcu.h"
+
+static const char* CMockString_MCU_ConvertCycleDifferenceToTimespan_us = "MCU_ConvertCycleDifferenceToTimespan_us";
+static const char* CMockString_MCU_ConvertFrcDifferenceToTimespan_us = "MCU_ConvertFrcDifferenceToTimespan_us";
+static const char* CMockString_MCU_GetCycleCount = "MCU_GetCycleCount";
+static const char* CMockString_MCU_GetFreeRunningCount = "MCU_GetFreeRunningCount";
+static const char* CMockString_MCU_InitializeCycleCounter = "MCU_InitializeCycleCounter";
+static const char* CMockString_MCU_delay_us = "MCU_delay_us";
+static const char* CMockString_count = "count";
+static const char* CMockString_cycles = "cycles";
+static const char* CMockString_delay_us = "delay_us";
+
+typedef struct _CMOCK_MCU_delay_us_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint32_t Expected_delay_us;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_delay_us;
+
+} CMOCK_MCU_delay_us_CALL_INSTANCE;
+
+typedef struct _CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE;
+
+typedef struct _CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_count;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_count;
+
+} CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE;
+
+typedef struct _CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE;
+
+typedef struct _CMOCK_MCU_GetCycleCount_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MCU_GetCycleCount_CALL_INSTANCE;
+
+typedef struct _CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  uint32_t Expected_cycles;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_cycles;
+
+} CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE;
+
+static struct MockmcuInstance
+{
+  char MCU_delay_us_IgnoreBool;
+  char MCU_delay_us_CallbackBool;
+  CMOCK_MCU_delay_us_CALLBACK MCU_delay_us_CallbackFunctionPointer;
+  int MCU_delay_us_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MCU_delay_us_CallInstance;
+  char MCU_GetFreeRunningCount_IgnoreBool;
+  uint32_t MCU_GetFreeRunningCount_FinalReturn;
+  char MCU_GetFreeRunningCount_CallbackBool;
+  CMOCK_MCU_GetFreeRunningCount_CALLBACK MCU_GetFreeRunningCount_CallbackFunctionPointer;
+  int MCU_GetFreeRunningCount_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MCU_GetFreeRunningCount_CallInstance;
+  char MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool;
+  uint32_t MCU_ConvertFrcDifferenceToTimespan_us_FinalReturn;
+  char MCU_ConvertFrcDifferenceToTimespan_us_CallbackBool;
+  CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALLBACK MCU_ConvertFrcDifferenceToTimespan_us_CallbackFunctionPointer;
+  int MCU_ConvertFrcDifferenceToTimespan_us_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MCU_ConvertFrcDifferenceToTimespan_us_CallInstance;
+  char MCU_InitializeCycleCounter_IgnoreBool;
+  char MCU_InitializeCycleCounter_CallbackBool;
+  CMOCK_MCU_InitializeCycleCounter_CALLBACK MCU_InitializeCycleCounter_CallbackFunctionPointer;
+  int MCU_InitializeCycleCounter_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MCU_InitializeCycleCounter_CallInstance;
+  char MCU_GetCycleCount_IgnoreBool;
+  uint32_t MCU_GetCycleCount_FinalReturn;
+  char MCU_GetCycleCount_CallbackBool;
+  CMOCK_MCU_GetCycleCount_CALLBACK MCU_GetCycleCount_CallbackFunctionPointer;
+  int MCU_GetCycleCount_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MCU_GetCycleCount_CallInstance;
+  char MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool;
+  uint32_t MCU_ConvertCycleDifferenceToTimespan_us_FinalReturn;
+  char MCU_ConvertCycleDifferenceToTimespan_us_CallbackBool;
+  CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALLBACK MCU_ConvertCycleDifferenceToTimespan_us_CallbackFunctionPointer;
+  int MCU_ConvertCycleDifferenceToTimespan_us_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MCU_ConvertCycleDifferenceToTimespan_us_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockmcu_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.MCU_delay_us_CallInstance;
+  if (Mock.MCU_delay_us_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MCU_delay_us);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MCU_delay_us_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MCU_GetFreeRunningCount_CallInstance;
+  if (Mock.MCU_GetFreeRunningCount_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MCU_GetFreeRunningCount);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MCU_GetFreeRunningCount_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance;
+  if (Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MCU_ConvertFrcDifferenceToTimespan_us);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MCU_InitializeCycleCounter_CallInstance;
+  if (Mock.MCU_InitializeCycleCounter_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MCU_InitializeCycleCounter);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MCU_InitializeCycleCounter_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MCU_GetCycleCount_CallInstance;
+  if (Mock.MCU_GetCycleCount_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MCU_GetCycleCount);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MCU_GetCycleCount_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance;
+  if (Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MCU_ConvertCycleDifferenceToTimespan_us);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockmcu_Init(void)
+{
+  Mockmcu_Destroy();
+}
+
+void Mockmcu_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void MCU_delay_us(uint32_t delay_us)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MCU_delay_us_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MCU_delay_us);
+  cmock_call_instance = (CMOCK_MCU_delay_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MCU_delay_us_CallInstance);
+  Mock.MCU_delay_us_CallInstance = CMock_Guts_MemNext(Mock.MCU_delay_us_CallInstance);
+  if (Mock.MCU_delay_us_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.MCU_delay_us_CallbackBool &&
+      Mock.MCU_delay_us_CallbackFunctionPointer != NULL)
+  {
+    Mock.MCU_delay_us_CallbackFunctionPointer(delay_us, Mock.MCU_delay_us_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_delay_us)
+  {
+    UNITY_SET_DETAILS(CMockString_MCU_delay_us,CMockString_delay_us);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_delay_us, delay_us, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MCU_delay_us_CallbackFunctionPointer != NULL)
+  {
+    Mock.MCU_delay_us_CallbackFunctionPointer(delay_us, Mock.MCU_delay_us_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_MCU_delay_us(CMOCK_MCU_delay_us_CALL_INSTANCE* cmock_call_instance, uint32_t delay_us);
+void CMockExpectParameters_MCU_delay_us(CMOCK_MCU_delay_us_CALL_INSTANCE* cmock_call_instance, uint32_t delay_us)
+{
+  cmock_call_instance->Expected_delay_us = delay_us;
+  cmock_call_instance->IgnoreArg_delay_us = 0;
+}
+
+void MCU_delay_us_CMockIgnore(void)
+{
+  Mock.MCU_delay_us_IgnoreBool = (char)1;
+}
+
+void MCU_delay_us_CMockStopIgnore(void)
+{
+  Mock.MCU_delay_us_IgnoreBool = (char)0;
+}
+
+void MCU_delay_us_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t delay_us)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_delay_us_CALL_INSTANCE));
+  CMOCK_MCU_delay_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_delay_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_delay_us_CallInstance = CMock_Guts_MemChain(Mock.MCU_delay_us_CallInstance, cmock_guts_index);
+  Mock.MCU_delay_us_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MCU_delay_us(cmock_call_instance, delay_us);
+}
+
+void MCU_delay_us_AddCallback(CMOCK_MCU_delay_us_CALLBACK Callback)
+{
+  Mock.MCU_delay_us_IgnoreBool = (char)0;
+  Mock.MCU_delay_us_CallbackBool = (char)1;
+  Mock.MCU_delay_us_CallbackFunctionPointer = Callback;
+}
+
+void MCU_delay_us_Stub(CMOCK_MCU_delay_us_CALLBACK Callback)
+{
+  Mock.MCU_delay_us_IgnoreBool = (char)0;
+  Mock.MCU_delay_us_CallbackBool = (char)0;
+  Mock.MCU_delay_us_CallbackFunctionPointer = Callback;
+}
+
+void MCU_delay_us_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t delay_us, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_delay_us_CALL_INSTANCE));
+  CMOCK_MCU_delay_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_delay_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_delay_us_CallInstance = CMock_Guts_MemChain(Mock.MCU_delay_us_CallInstance, cmock_guts_index);
+  Mock.MCU_delay_us_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MCU_delay_us(cmock_call_instance, delay_us);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MCU_delay_us_CMockIgnoreArg_delay_us(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MCU_delay_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_delay_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MCU_delay_us_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_delay_us = 1;
+}
+
+uint32_t MCU_GetFreeRunningCount(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MCU_GetFreeRunningCount);
+  cmock_call_instance = (CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MCU_GetFreeRunningCount_CallInstance);
+  Mock.MCU_GetFreeRunningCount_CallInstance = CMock_Guts_MemNext(Mock.MCU_GetFreeRunningCount_CallInstance);
+  if (Mock.MCU_GetFreeRunningCount_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MCU_GetFreeRunningCount_FinalReturn;
+    Mock.MCU_GetFreeRunningCount_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MCU_GetFreeRunningCount_CallbackBool &&
+      Mock.MCU_GetFreeRunningCount_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.MCU_GetFreeRunningCount_CallbackFunctionPointer(Mock.MCU_GetFreeRunningCount_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MCU_GetFreeRunningCount_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MCU_GetFreeRunningCount_CallbackFunctionPointer(Mock.MCU_GetFreeRunningCount_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void MCU_GetFreeRunningCount_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE));
+  CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_GetFreeRunningCount_CallInstance = CMock_Guts_MemChain(Mock.MCU_GetFreeRunningCount_CallInstance, cmock_guts_index);
+  Mock.MCU_GetFreeRunningCount_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MCU_GetFreeRunningCount_IgnoreBool = (char)1;
+}
+
+void MCU_GetFreeRunningCount_CMockStopIgnore(void)
+{
+  if(Mock.MCU_GetFreeRunningCount_IgnoreBool)
+    Mock.MCU_GetFreeRunningCount_CallInstance = CMock_Guts_MemNext(Mock.MCU_GetFreeRunningCount_CallInstance);
+  Mock.MCU_GetFreeRunningCount_IgnoreBool = (char)0;
+}
+
+void MCU_GetFreeRunningCount_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE));
+  CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_GetFreeRunningCount_CallInstance = CMock_Guts_MemChain(Mock.MCU_GetFreeRunningCount_CallInstance, cmock_guts_index);
+  Mock.MCU_GetFreeRunningCount_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void MCU_GetFreeRunningCount_AddCallback(CMOCK_MCU_GetFreeRunningCount_CALLBACK Callback)
+{
+  Mock.MCU_GetFreeRunningCount_IgnoreBool = (char)0;
+  Mock.MCU_GetFreeRunningCount_CallbackBool = (char)1;
+  Mock.MCU_GetFreeRunningCount_CallbackFunctionPointer = Callback;
+}
+
+void MCU_GetFreeRunningCount_Stub(CMOCK_MCU_GetFreeRunningCount_CALLBACK Callback)
+{
+  Mock.MCU_GetFreeRunningCount_IgnoreBool = (char)0;
+  Mock.MCU_GetFreeRunningCount_CallbackBool = (char)0;
+  Mock.MCU_GetFreeRunningCount_CallbackFunctionPointer = Callback;
+}
+
+void MCU_GetFreeRunningCount_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE));
+  CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_GetFreeRunningCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_GetFreeRunningCount_CallInstance = CMock_Guts_MemChain(Mock.MCU_GetFreeRunningCount_CallInstance, cmock_guts_index);
+  Mock.MCU_GetFreeRunningCount_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint32_t MCU_ConvertFrcDifferenceToTimespan_us(uint32_t count)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MCU_ConvertFrcDifferenceToTimespan_us);
+  cmock_call_instance = (CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance);
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance = CMock_Guts_MemNext(Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance);
+  if (Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MCU_ConvertFrcDifferenceToTimespan_us_FinalReturn;
+    Mock.MCU_ConvertFrcDifferenceToTimespan_us_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackBool &&
+      Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackFunctionPointer(count, Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_count)
+  {
+    UNITY_SET_DETAILS(CMockString_MCU_ConvertFrcDifferenceToTimespan_us,CMockString_count);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_count, count, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackFunctionPointer(count, Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MCU_ConvertFrcDifferenceToTimespan_us(CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance, uint32_t count);
+void CMockExpectParameters_MCU_ConvertFrcDifferenceToTimespan_us(CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance, uint32_t count)
+{
+  cmock_call_instance->Expected_count = count;
+  cmock_call_instance->IgnoreArg_count = 0;
+}
+
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE));
+  CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance = CMock_Guts_MemChain(Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance, cmock_guts_index);
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool = (char)1;
+}
+
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockStopIgnore(void)
+{
+  if(Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool)
+    Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance = CMock_Guts_MemNext(Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance);
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool = (char)0;
+}
+
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t count, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE));
+  CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance = CMock_Guts_MemChain(Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance, cmock_guts_index);
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MCU_ConvertFrcDifferenceToTimespan_us(cmock_call_instance, count);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void MCU_ConvertFrcDifferenceToTimespan_us_AddCallback(CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALLBACK Callback)
+{
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool = (char)0;
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackBool = (char)1;
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackFunctionPointer = Callback;
+}
+
+void MCU_ConvertFrcDifferenceToTimespan_us_Stub(CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALLBACK Callback)
+{
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool = (char)0;
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackBool = (char)0;
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallbackFunctionPointer = Callback;
+}
+
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t count, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE));
+  CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance = CMock_Guts_MemChain(Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance, cmock_guts_index);
+  Mock.MCU_ConvertFrcDifferenceToTimespan_us_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MCU_ConvertFrcDifferenceToTimespan_us(cmock_call_instance, count);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockIgnoreArg_count(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MCU_ConvertFrcDifferenceToTimespan_us_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_count = 1;
+}
+
+void MCU_InitializeCycleCounter(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MCU_InitializeCycleCounter);
+  cmock_call_instance = (CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MCU_InitializeCycleCounter_CallInstance);
+  Mock.MCU_InitializeCycleCounter_CallInstance = CMock_Guts_MemNext(Mock.MCU_InitializeCycleCounter_CallInstance);
+  if (Mock.MCU_InitializeCycleCounter_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.MCU_InitializeCycleCounter_CallbackBool &&
+      Mock.MCU_InitializeCycleCounter_CallbackFunctionPointer != NULL)
+  {
+    Mock.MCU_InitializeCycleCounter_CallbackFunctionPointer(Mock.MCU_InitializeCycleCounter_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MCU_InitializeCycleCounter_CallbackFunctionPointer != NULL)
+  {
+    Mock.MCU_InitializeCycleCounter_CallbackFunctionPointer(Mock.MCU_InitializeCycleCounter_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void MCU_InitializeCycleCounter_CMockIgnore(void)
+{
+  Mock.MCU_InitializeCycleCounter_IgnoreBool = (char)1;
+}
+
+void MCU_InitializeCycleCounter_CMockStopIgnore(void)
+{
+  Mock.MCU_InitializeCycleCounter_IgnoreBool = (char)0;
+}
+
+void MCU_InitializeCycleCounter_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE));
+  CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_InitializeCycleCounter_CallInstance = CMock_Guts_MemChain(Mock.MCU_InitializeCycleCounter_CallInstance, cmock_guts_index);
+  Mock.MCU_InitializeCycleCounter_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void MCU_InitializeCycleCounter_AddCallback(CMOCK_MCU_InitializeCycleCounter_CALLBACK Callback)
+{
+  Mock.MCU_InitializeCycleCounter_IgnoreBool = (char)0;
+  Mock.MCU_InitializeCycleCounter_CallbackBool = (char)1;
+  Mock.MCU_InitializeCycleCounter_CallbackFunctionPointer = Callback;
+}
+
+void MCU_InitializeCycleCounter_Stub(CMOCK_MCU_InitializeCycleCounter_CALLBACK Callback)
+{
+  Mock.MCU_InitializeCycleCounter_IgnoreBool = (char)0;
+  Mock.MCU_InitializeCycleCounter_CallbackBool = (char)0;
+  Mock.MCU_InitializeCycleCounter_CallbackFunctionPointer = Callback;
+}
+
+void MCU_InitializeCycleCounter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE));
+  CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_InitializeCycleCounter_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_InitializeCycleCounter_CallInstance = CMock_Guts_MemChain(Mock.MCU_InitializeCycleCounter_CallInstance, cmock_guts_index);
+  Mock.MCU_InitializeCycleCounter_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint32_t MCU_GetCycleCount(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MCU_GetCycleCount_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MCU_GetCycleCount);
+  cmock_call_instance = (CMOCK_MCU_GetCycleCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MCU_GetCycleCount_CallInstance);
+  Mock.MCU_GetCycleCount_CallInstance = CMock_Guts_MemNext(Mock.MCU_GetCycleCount_CallInstance);
+  if (Mock.MCU_GetCycleCount_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MCU_GetCycleCount_FinalReturn;
+    Mock.MCU_GetCycleCount_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MCU_GetCycleCount_CallbackBool &&
+      Mock.MCU_GetCycleCount_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.MCU_GetCycleCount_CallbackFunctionPointer(Mock.MCU_GetCycleCount_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MCU_GetCycleCount_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MCU_GetCycleCount_CallbackFunctionPointer(Mock.MCU_GetCycleCount_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void MCU_GetCycleCount_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_GetCycleCount_CALL_INSTANCE));
+  CMOCK_MCU_GetCycleCount_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_GetCycleCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_GetCycleCount_CallInstance = CMock_Guts_MemChain(Mock.MCU_GetCycleCount_CallInstance, cmock_guts_index);
+  Mock.MCU_GetCycleCount_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MCU_GetCycleCount_IgnoreBool = (char)1;
+}
+
+void MCU_GetCycleCount_CMockStopIgnore(void)
+{
+  if(Mock.MCU_GetCycleCount_IgnoreBool)
+    Mock.MCU_GetCycleCount_CallInstance = CMock_Guts_MemNext(Mock.MCU_GetCycleCount_CallInstance);
+  Mock.MCU_GetCycleCount_IgnoreBool = (char)0;
+}
+
+void MCU_GetCycleCount_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_GetCycleCount_CALL_INSTANCE));
+  CMOCK_MCU_GetCycleCount_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_GetCycleCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_GetCycleCount_CallInstance = CMock_Guts_MemChain(Mock.MCU_GetCycleCount_CallInstance, cmock_guts_index);
+  Mock.MCU_GetCycleCount_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void MCU_GetCycleCount_AddCallback(CMOCK_MCU_GetCycleCount_CALLBACK Callback)
+{
+  Mock.MCU_GetCycleCount_IgnoreBool = (char)0;
+  Mock.MCU_GetCycleCount_CallbackBool = (char)1;
+  Mock.MCU_GetCycleCount_CallbackFunctionPointer = Callback;
+}
+
+void MCU_GetCycleCount_Stub(CMOCK_MCU_GetCycleCount_CALLBACK Callback)
+{
+  Mock.MCU_GetCycleCount_IgnoreBool = (char)0;
+  Mock.MCU_GetCycleCount_CallbackBool = (char)0;
+  Mock.MCU_GetCycleCount_CallbackFunctionPointer = Callback;
+}
+
+void MCU_GetCycleCount_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_GetCycleCount_CALL_INSTANCE));
+  CMOCK_MCU_GetCycleCount_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_GetCycleCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_GetCycleCount_CallInstance = CMock_Guts_MemChain(Mock.MCU_GetCycleCount_CallInstance, cmock_guts_index);
+  Mock.MCU_GetCycleCount_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+uint32_t MCU_ConvertCycleDifferenceToTimespan_us(uint32_t cycles)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MCU_ConvertCycleDifferenceToTimespan_us);
+  cmock_call_instance = (CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance);
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance = CMock_Guts_MemNext(Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance);
+  if (Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MCU_ConvertCycleDifferenceToTimespan_us_FinalReturn;
+    Mock.MCU_ConvertCycleDifferenceToTimespan_us_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackBool &&
+      Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackFunctionPointer(cycles, Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cycles)
+  {
+    UNITY_SET_DETAILS(CMockString_MCU_ConvertCycleDifferenceToTimespan_us,CMockString_cycles);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_cycles, cycles, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackFunctionPointer(cycles, Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MCU_ConvertCycleDifferenceToTimespan_us(CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance, uint32_t cycles);
+void CMockExpectParameters_MCU_ConvertCycleDifferenceToTimespan_us(CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance, uint32_t cycles)
+{
+  cmock_call_instance->Expected_cycles = cycles;
+  cmock_call_instance->IgnoreArg_cycles = 0;
+}
+
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE));
+  CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance = CMock_Guts_MemChain(Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance, cmock_guts_index);
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool = (char)1;
+}
+
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockStopIgnore(void)
+{
+  if(Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool)
+    Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance = CMock_Guts_MemNext(Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance);
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool = (char)0;
+}
+
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cycles, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE));
+  CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance = CMock_Guts_MemChain(Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance, cmock_guts_index);
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MCU_ConvertCycleDifferenceToTimespan_us(cmock_call_instance, cycles);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void MCU_ConvertCycleDifferenceToTimespan_us_AddCallback(CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALLBACK Callback)
+{
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool = (char)0;
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackBool = (char)1;
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackFunctionPointer = Callback;
+}
+
+void MCU_ConvertCycleDifferenceToTimespan_us_Stub(CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALLBACK Callback)
+{
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool = (char)0;
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackBool = (char)0;
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallbackFunctionPointer = Callback;
+}
+
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t cycles, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE));
+  CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance = CMock_Guts_MemChain(Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance, cmock_guts_index);
+  Mock.MCU_ConvertCycleDifferenceToTimespan_us_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MCU_ConvertCycleDifferenceToTimespan_us(cmock_call_instance, cycles);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockIgnoreArg_cycles(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE* cmock_call_instance = (CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MCU_ConvertCycleDifferenceToTimespan_us_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cycles = 1;
+}
+
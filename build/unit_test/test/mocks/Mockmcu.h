@@ -0,0 +1,124 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKMCU_H
+#define _MOCKMCU_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "mcu.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockmcu_Init(void);
+void Mockmcu_Destroy(void);
+void Mockmcu_Verify(void);
+
+
+
+
+#define MCU_delay_us_Ignore() MCU_delay_us_CMockIgnore()
+void MCU_delay_us_CMockIgnore(void);
+#define MCU_delay_us_StopIgnore() MCU_delay_us_CMockStopIgnore()
+void MCU_delay_us_CMockStopIgnore(void);
+#define MCU_delay_us_Expect(delay_us) MCU_delay_us_CMockExpect(__LINE__, delay_us)
+void MCU_delay_us_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t delay_us);
+typedef void (* CMOCK_MCU_delay_us_CALLBACK)(uint32_t delay_us, int cmock_num_calls);
+void MCU_delay_us_AddCallback(CMOCK_MCU_delay_us_CALLBACK Callback);
+void MCU_delay_us_Stub(CMOCK_MCU_delay_us_CALLBACK Callback);
+#define MCU_delay_us_StubWithCallback MCU_delay_us_Stub
+#define MCU_delay_us_ExpectAndThrow(delay_us, cmock_to_throw) MCU_delay_us_CMockExpectAndThrow(__LINE__, delay_us, cmock_to_throw)
+void MCU_delay_us_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t delay_us, CEXCEPTION_T cmock_to_throw);
+#define MCU_delay_us_IgnoreArg_delay_us() MCU_delay_us_CMockIgnoreArg_delay_us(__LINE__)
+void MCU_delay_us_CMockIgnoreArg_delay_us(UNITY_LINE_TYPE cmock_line);
+#define MCU_GetFreeRunningCount_IgnoreAndReturn(cmock_retval) MCU_GetFreeRunningCount_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MCU_GetFreeRunningCount_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define MCU_GetFreeRunningCount_StopIgnore() MCU_GetFreeRunningCount_CMockStopIgnore()
+void MCU_GetFreeRunningCount_CMockStopIgnore(void);
+#define MCU_GetFreeRunningCount_ExpectAndReturn(cmock_retval) MCU_GetFreeRunningCount_CMockExpectAndReturn(__LINE__, cmock_retval)
+void MCU_GetFreeRunningCount_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_MCU_GetFreeRunningCount_CALLBACK)(int cmock_num_calls);
+void MCU_GetFreeRunningCount_AddCallback(CMOCK_MCU_GetFreeRunningCount_CALLBACK Callback);
+void MCU_GetFreeRunningCount_Stub(CMOCK_MCU_GetFreeRunningCount_CALLBACK Callback);
+#define MCU_GetFreeRunningCount_StubWithCallback MCU_GetFreeRunningCount_Stub
+#define MCU_GetFreeRunningCount_ExpectAndThrow(cmock_to_throw) MCU_GetFreeRunningCount_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MCU_GetFreeRunningCount_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MCU_ConvertFrcDifferenceToTimespan_us_IgnoreAndReturn(cmock_retval) MCU_ConvertFrcDifferenceToTimespan_us_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define MCU_ConvertFrcDifferenceToTimespan_us_StopIgnore() MCU_ConvertFrcDifferenceToTimespan_us_CMockStopIgnore()
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockStopIgnore(void);
+#define MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(count, cmock_retval) MCU_ConvertFrcDifferenceToTimespan_us_CMockExpectAndReturn(__LINE__, count, cmock_retval)
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t count, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALLBACK)(uint32_t count, int cmock_num_calls);
+void MCU_ConvertFrcDifferenceToTimespan_us_AddCallback(CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALLBACK Callback);
+void MCU_ConvertFrcDifferenceToTimespan_us_Stub(CMOCK_MCU_ConvertFrcDifferenceToTimespan_us_CALLBACK Callback);
+#define MCU_ConvertFrcDifferenceToTimespan_us_StubWithCallback MCU_ConvertFrcDifferenceToTimespan_us_Stub
+#define MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndThrow(count, cmock_to_throw) MCU_ConvertFrcDifferenceToTimespan_us_CMockExpectAndThrow(__LINE__, count, cmock_to_throw)
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t count, CEXCEPTION_T cmock_to_throw);
+#define MCU_ConvertFrcDifferenceToTimespan_us_IgnoreArg_count() MCU_ConvertFrcDifferenceToTimespan_us_CMockIgnoreArg_count(__LINE__)
+void MCU_ConvertFrcDifferenceToTimespan_us_CMockIgnoreArg_count(UNITY_LINE_TYPE cmock_line);
+#define MCU_InitializeCycleCounter_Ignore() MCU_InitializeCycleCounter_CMockIgnore()
+void MCU_InitializeCycleCounter_CMockIgnore(void);
+#define MCU_InitializeCycleCounter_StopIgnore() MCU_InitializeCycleCounter_CMockStopIgnore()
+void MCU_InitializeCycleCounter_CMockStopIgnore(void);
+#define MCU_InitializeCycleCounter_Expect() MCU_InitializeCycleCounter_CMockExpect(__LINE__)
+void MCU_InitializeCycleCounter_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_MCU_InitializeCycleCounter_CALLBACK)(int cmock_num_calls);
+void MCU_InitializeCycleCounter_AddCallback(CMOCK_MCU_InitializeCycleCounter_CALLBACK Callback);
+void MCU_InitializeCycleCounter_Stub(CMOCK_MCU_InitializeCycleCounter_CALLBACK Callback);
+#define MCU_InitializeCycleCounter_StubWithCallback MCU_InitializeCycleCounter_Stub
+#define MCU_InitializeCycleCounter_ExpectAndThrow(cmock_to_throw) MCU_InitializeCycleCounter_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MCU_InitializeCycleCounter_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MCU_GetCycleCount_IgnoreAndReturn(cmock_retval) MCU_GetCycleCount_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MCU_GetCycleCount_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define MCU_GetCycleCount_StopIgnore() MCU_GetCycleCount_CMockStopIgnore()
+void MCU_GetCycleCount_CMockStopIgnore(void);
+#define MCU_GetCycleCount_ExpectAndReturn(cmock_retval) MCU_GetCycleCount_CMockExpectAndReturn(__LINE__, cmock_retval)
+void MCU_GetCycleCount_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_MCU_GetCycleCount_CALLBACK)(int cmock_num_calls);
+void MCU_GetCycleCount_AddCallback(CMOCK_MCU_GetCycleCount_CALLBACK Callback);
+void MCU_GetCycleCount_Stub(CMOCK_MCU_GetCycleCount_CALLBACK Callback);
+#define MCU_GetCycleCount_StubWithCallback MCU_GetCycleCount_Stub
+#define MCU_GetCycleCount_ExpectAndThrow(cmock_to_throw) MCU_GetCycleCount_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MCU_GetCycleCount_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MCU_ConvertCycleDifferenceToTimespan_us_IgnoreAndReturn(cmock_retval) MCU_ConvertCycleDifferenceToTimespan_us_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define MCU_ConvertCycleDifferenceToTimespan_us_StopIgnore() MCU_ConvertCycleDifferenceToTimespan_us_CMockStopIgnore()
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockStopIgnore(void);
+#define MCU_ConvertCycleDifferenceToTimespan_us_ExpectAndReturn(cycles, cmock_retval) MCU_ConvertCycleDifferenceToTimespan_us_CMockExpectAndReturn(__LINE__, cycles, cmock_retval)
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cycles, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALLBACK)(uint32_t cycles, int cmock_num_calls);
+void MCU_ConvertCycleDifferenceToTimespan_us_AddCallback(CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALLBACK Callback);
+void MCU_ConvertCycleDifferenceToTimespan_us_Stub(CMOCK_MCU_ConvertCycleDifferenceToTimespan_us_CALLBACK Callback);
+#define MCU_ConvertCycleDifferenceToTimespan_us_StubWithCallback MCU_ConvertCycleDifferenceToTimespan_us_Stub
+#define MCU_ConvertCycleDifferenceToTimespan_us_ExpectAndThrow(cycles, cmock_to_throw) MCU_ConvertCycleDifferenceToTimespan_us_CMockExpectAndThrow(__LINE__, cycles, cmock_to_throw)
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t cycles, CEXCEPTION_T cmock_to_throw);
+#define MCU_ConvertCycleDifferenceToTimespan_us_IgnoreArg_cycles() MCU_ConvertCycleDifferenceToTimespan_us_CMockIgnoreArg_cycles(__LINE__)
+void MCU_ConvertCycleDifferenceToTimespan_us_CMockIgnoreArg_cycles(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,1662 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockmeas.h"
+
+static const char* CMockString_MEAS_Control = "MEAS_Control";
+static const char* CMockString_MEAS_Initialize = "MEAS_Initialize";
+static const char* CMockString_MEAS_IsFirstMeasurementCycleFinished = "MEAS_IsFirstMeasurementCycleFinished";
+static const char* CMockString_MEAS_RequestBalancingFeedbackRead = "MEAS_RequestBalancingFeedbackRead";
+static const char* CMockString_MEAS_RequestEepromRead = "MEAS_RequestEepromRead";
+static const char* CMockString_MEAS_RequestEepromWrite = "MEAS_RequestEepromWrite";
+static const char* CMockString_MEAS_RequestIoRead = "MEAS_RequestIoRead";
+static const char* CMockString_MEAS_RequestIoWrite = "MEAS_RequestIoWrite";
+static const char* CMockString_MEAS_RequestOpenWireCheck = "MEAS_RequestOpenWireCheck";
+static const char* CMockString_MEAS_RequestTemperatureRead = "MEAS_RequestTemperatureRead";
+static const char* CMockString_MEAS_StartMeasurement = "MEAS_StartMeasurement";
+static const char* CMockString_string = "string";
+
+typedef struct _CMOCK_MEAS_Initialize_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MEAS_Initialize_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_Control_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MEAS_Control_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_StartMeasurement_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MEAS_StartMeasurement_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_RequestIoRead_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MEAS_RequestIoRead_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE;
+
+typedef struct _CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE;
+
+static struct MockmeasInstance
+{
+  char MEAS_Initialize_IgnoreBool;
+  STD_RETURN_TYPE_e MEAS_Initialize_FinalReturn;
+  char MEAS_Initialize_CallbackBool;
+  CMOCK_MEAS_Initialize_CALLBACK MEAS_Initialize_CallbackFunctionPointer;
+  int MEAS_Initialize_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_Initialize_CallInstance;
+  char MEAS_Control_IgnoreBool;
+  char MEAS_Control_CallbackBool;
+  CMOCK_MEAS_Control_CALLBACK MEAS_Control_CallbackFunctionPointer;
+  int MEAS_Control_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_Control_CallInstance;
+  char MEAS_IsFirstMeasurementCycleFinished_IgnoreBool;
+  _Bool MEAS_IsFirstMeasurementCycleFinished_FinalReturn;
+  char MEAS_IsFirstMeasurementCycleFinished_CallbackBool;
+  CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALLBACK MEAS_IsFirstMeasurementCycleFinished_CallbackFunctionPointer;
+  int MEAS_IsFirstMeasurementCycleFinished_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_IsFirstMeasurementCycleFinished_CallInstance;
+  char MEAS_StartMeasurement_IgnoreBool;
+  STD_RETURN_TYPE_e MEAS_StartMeasurement_FinalReturn;
+  char MEAS_StartMeasurement_CallbackBool;
+  CMOCK_MEAS_StartMeasurement_CALLBACK MEAS_StartMeasurement_CallbackFunctionPointer;
+  int MEAS_StartMeasurement_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_StartMeasurement_CallInstance;
+  char MEAS_RequestIoWrite_IgnoreBool;
+  STD_RETURN_TYPE_e MEAS_RequestIoWrite_FinalReturn;
+  char MEAS_RequestIoWrite_CallbackBool;
+  CMOCK_MEAS_RequestIoWrite_CALLBACK MEAS_RequestIoWrite_CallbackFunctionPointer;
+  int MEAS_RequestIoWrite_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_RequestIoWrite_CallInstance;
+  char MEAS_RequestIoRead_IgnoreBool;
+  STD_RETURN_TYPE_e MEAS_RequestIoRead_FinalReturn;
+  char MEAS_RequestIoRead_CallbackBool;
+  CMOCK_MEAS_RequestIoRead_CALLBACK MEAS_RequestIoRead_CallbackFunctionPointer;
+  int MEAS_RequestIoRead_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_RequestIoRead_CallInstance;
+  char MEAS_RequestTemperatureRead_IgnoreBool;
+  STD_RETURN_TYPE_e MEAS_RequestTemperatureRead_FinalReturn;
+  char MEAS_RequestTemperatureRead_CallbackBool;
+  CMOCK_MEAS_RequestTemperatureRead_CALLBACK MEAS_RequestTemperatureRead_CallbackFunctionPointer;
+  int MEAS_RequestTemperatureRead_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_RequestTemperatureRead_CallInstance;
+  char MEAS_RequestBalancingFeedbackRead_IgnoreBool;
+  STD_RETURN_TYPE_e MEAS_RequestBalancingFeedbackRead_FinalReturn;
+  char MEAS_RequestBalancingFeedbackRead_CallbackBool;
+  CMOCK_MEAS_RequestBalancingFeedbackRead_CALLBACK MEAS_RequestBalancingFeedbackRead_CallbackFunctionPointer;
+  int MEAS_RequestBalancingFeedbackRead_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_RequestBalancingFeedbackRead_CallInstance;
+  char MEAS_RequestEepromRead_IgnoreBool;
+  STD_RETURN_TYPE_e MEAS_RequestEepromRead_FinalReturn;
+  char MEAS_RequestEepromRead_CallbackBool;
+  CMOCK_MEAS_RequestEepromRead_CALLBACK MEAS_RequestEepromRead_CallbackFunctionPointer;
+  int MEAS_RequestEepromRead_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_RequestEepromRead_CallInstance;
+  char MEAS_RequestEepromWrite_IgnoreBool;
+  STD_RETURN_TYPE_e MEAS_RequestEepromWrite_FinalReturn;
+  char MEAS_RequestEepromWrite_CallbackBool;
+  CMOCK_MEAS_RequestEepromWrite_CALLBACK MEAS_RequestEepromWrite_CallbackFunctionPointer;
+  int MEAS_RequestEepromWrite_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_RequestEepromWrite_CallInstance;
+  char MEAS_RequestOpenWireCheck_IgnoreBool;
+  STD_RETURN_TYPE_e MEAS_RequestOpenWireCheck_FinalReturn;
+  char MEAS_RequestOpenWireCheck_CallbackBool;
+  CMOCK_MEAS_RequestOpenWireCheck_CALLBACK MEAS_RequestOpenWireCheck_CallbackFunctionPointer;
+  int MEAS_RequestOpenWireCheck_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MEAS_RequestOpenWireCheck_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockmeas_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.MEAS_Initialize_CallInstance;
+  if (Mock.MEAS_Initialize_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_Initialize);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_Initialize_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_Control_CallInstance;
+  if (Mock.MEAS_Control_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_Control);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_Control_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance;
+  if (Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_IsFirstMeasurementCycleFinished);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_StartMeasurement_CallInstance;
+  if (Mock.MEAS_StartMeasurement_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_StartMeasurement);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_StartMeasurement_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_RequestIoWrite_CallInstance;
+  if (Mock.MEAS_RequestIoWrite_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_RequestIoWrite);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_RequestIoWrite_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_RequestIoRead_CallInstance;
+  if (Mock.MEAS_RequestIoRead_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_RequestIoRead);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_RequestIoRead_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_RequestTemperatureRead_CallInstance;
+  if (Mock.MEAS_RequestTemperatureRead_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_RequestTemperatureRead);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_RequestTemperatureRead_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_RequestBalancingFeedbackRead_CallInstance;
+  if (Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_RequestBalancingFeedbackRead);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_RequestBalancingFeedbackRead_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_RequestEepromRead_CallInstance;
+  if (Mock.MEAS_RequestEepromRead_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_RequestEepromRead);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_RequestEepromRead_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_RequestEepromWrite_CallInstance;
+  if (Mock.MEAS_RequestEepromWrite_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_RequestEepromWrite);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_RequestEepromWrite_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MEAS_RequestOpenWireCheck_CallInstance;
+  if (Mock.MEAS_RequestOpenWireCheck_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MEAS_RequestOpenWireCheck);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MEAS_RequestOpenWireCheck_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockmeas_Init(void)
+{
+  Mockmeas_Destroy();
+}
+
+void Mockmeas_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+STD_RETURN_TYPE_e MEAS_Initialize(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_Initialize_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_Initialize);
+  cmock_call_instance = (CMOCK_MEAS_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_Initialize_CallInstance);
+  Mock.MEAS_Initialize_CallInstance = CMock_Guts_MemNext(Mock.MEAS_Initialize_CallInstance);
+  if (Mock.MEAS_Initialize_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_Initialize_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_Initialize_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_Initialize_CallbackBool &&
+      Mock.MEAS_Initialize_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MEAS_Initialize_CallbackFunctionPointer(Mock.MEAS_Initialize_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MEAS_Initialize_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_Initialize_CallbackFunctionPointer(Mock.MEAS_Initialize_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void MEAS_Initialize_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_Initialize_CALL_INSTANCE));
+  CMOCK_MEAS_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_Initialize_CallInstance = CMock_Guts_MemChain(Mock.MEAS_Initialize_CallInstance, cmock_guts_index);
+  Mock.MEAS_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_Initialize_IgnoreBool = (char)1;
+}
+
+void MEAS_Initialize_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_Initialize_IgnoreBool)
+    Mock.MEAS_Initialize_CallInstance = CMock_Guts_MemNext(Mock.MEAS_Initialize_CallInstance);
+  Mock.MEAS_Initialize_IgnoreBool = (char)0;
+}
+
+void MEAS_Initialize_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_Initialize_CALL_INSTANCE));
+  CMOCK_MEAS_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_Initialize_CallInstance = CMock_Guts_MemChain(Mock.MEAS_Initialize_CallInstance, cmock_guts_index);
+  Mock.MEAS_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MEAS_Initialize_AddCallback(CMOCK_MEAS_Initialize_CALLBACK Callback)
+{
+  Mock.MEAS_Initialize_IgnoreBool = (char)0;
+  Mock.MEAS_Initialize_CallbackBool = (char)1;
+  Mock.MEAS_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_Initialize_Stub(CMOCK_MEAS_Initialize_CALLBACK Callback)
+{
+  Mock.MEAS_Initialize_IgnoreBool = (char)0;
+  Mock.MEAS_Initialize_CallbackBool = (char)0;
+  Mock.MEAS_Initialize_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_Initialize_CALL_INSTANCE));
+  CMOCK_MEAS_Initialize_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_Initialize_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_Initialize_CallInstance = CMock_Guts_MemChain(Mock.MEAS_Initialize_CallInstance, cmock_guts_index);
+  Mock.MEAS_Initialize_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MEAS_Control(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_Control_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_Control);
+  cmock_call_instance = (CMOCK_MEAS_Control_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_Control_CallInstance);
+  Mock.MEAS_Control_CallInstance = CMock_Guts_MemNext(Mock.MEAS_Control_CallInstance);
+  if (Mock.MEAS_Control_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.MEAS_Control_CallbackBool &&
+      Mock.MEAS_Control_CallbackFunctionPointer != NULL)
+  {
+    Mock.MEAS_Control_CallbackFunctionPointer(Mock.MEAS_Control_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MEAS_Control_CallbackFunctionPointer != NULL)
+  {
+    Mock.MEAS_Control_CallbackFunctionPointer(Mock.MEAS_Control_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void MEAS_Control_CMockIgnore(void)
+{
+  Mock.MEAS_Control_IgnoreBool = (char)1;
+}
+
+void MEAS_Control_CMockStopIgnore(void)
+{
+  Mock.MEAS_Control_IgnoreBool = (char)0;
+}
+
+void MEAS_Control_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_Control_CALL_INSTANCE));
+  CMOCK_MEAS_Control_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_Control_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_Control_CallInstance = CMock_Guts_MemChain(Mock.MEAS_Control_CallInstance, cmock_guts_index);
+  Mock.MEAS_Control_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void MEAS_Control_AddCallback(CMOCK_MEAS_Control_CALLBACK Callback)
+{
+  Mock.MEAS_Control_IgnoreBool = (char)0;
+  Mock.MEAS_Control_CallbackBool = (char)1;
+  Mock.MEAS_Control_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_Control_Stub(CMOCK_MEAS_Control_CALLBACK Callback)
+{
+  Mock.MEAS_Control_IgnoreBool = (char)0;
+  Mock.MEAS_Control_CallbackBool = (char)0;
+  Mock.MEAS_Control_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_Control_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_Control_CALL_INSTANCE));
+  CMOCK_MEAS_Control_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_Control_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_Control_CallInstance = CMock_Guts_MemChain(Mock.MEAS_Control_CallInstance, cmock_guts_index);
+  Mock.MEAS_Control_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+_Bool MEAS_IsFirstMeasurementCycleFinished(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_IsFirstMeasurementCycleFinished);
+  cmock_call_instance = (CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance);
+  Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemNext(Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance);
+  if (Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_IsFirstMeasurementCycleFinished_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_IsFirstMeasurementCycleFinished_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackBool &&
+      Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackFunctionPointer(Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackFunctionPointer(Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void MEAS_IsFirstMeasurementCycleFinished_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE));
+  CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemChain(Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance, cmock_guts_index);
+  Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool = (char)1;
+}
+
+void MEAS_IsFirstMeasurementCycleFinished_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool)
+    Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemNext(Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance);
+  Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+}
+
+void MEAS_IsFirstMeasurementCycleFinished_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE));
+  CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemChain(Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance, cmock_guts_index);
+  Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void MEAS_IsFirstMeasurementCycleFinished_AddCallback(CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALLBACK Callback)
+{
+  Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackBool = (char)1;
+  Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_IsFirstMeasurementCycleFinished_Stub(CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALLBACK Callback)
+{
+  Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackBool = (char)0;
+  Mock.MEAS_IsFirstMeasurementCycleFinished_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_IsFirstMeasurementCycleFinished_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE));
+  CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemChain(Mock.MEAS_IsFirstMeasurementCycleFinished_CallInstance, cmock_guts_index);
+  Mock.MEAS_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e MEAS_StartMeasurement(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_StartMeasurement_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_StartMeasurement);
+  cmock_call_instance = (CMOCK_MEAS_StartMeasurement_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_StartMeasurement_CallInstance);
+  Mock.MEAS_StartMeasurement_CallInstance = CMock_Guts_MemNext(Mock.MEAS_StartMeasurement_CallInstance);
+  if (Mock.MEAS_StartMeasurement_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_StartMeasurement_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_StartMeasurement_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_StartMeasurement_CallbackBool &&
+      Mock.MEAS_StartMeasurement_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MEAS_StartMeasurement_CallbackFunctionPointer(Mock.MEAS_StartMeasurement_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MEAS_StartMeasurement_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_StartMeasurement_CallbackFunctionPointer(Mock.MEAS_StartMeasurement_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void MEAS_StartMeasurement_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_StartMeasurement_CALL_INSTANCE));
+  CMOCK_MEAS_StartMeasurement_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_StartMeasurement_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_StartMeasurement_CallInstance = CMock_Guts_MemChain(Mock.MEAS_StartMeasurement_CallInstance, cmock_guts_index);
+  Mock.MEAS_StartMeasurement_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_StartMeasurement_IgnoreBool = (char)1;
+}
+
+void MEAS_StartMeasurement_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_StartMeasurement_IgnoreBool)
+    Mock.MEAS_StartMeasurement_CallInstance = CMock_Guts_MemNext(Mock.MEAS_StartMeasurement_CallInstance);
+  Mock.MEAS_StartMeasurement_IgnoreBool = (char)0;
+}
+
+void MEAS_StartMeasurement_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_StartMeasurement_CALL_INSTANCE));
+  CMOCK_MEAS_StartMeasurement_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_StartMeasurement_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_StartMeasurement_CallInstance = CMock_Guts_MemChain(Mock.MEAS_StartMeasurement_CallInstance, cmock_guts_index);
+  Mock.MEAS_StartMeasurement_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MEAS_StartMeasurement_AddCallback(CMOCK_MEAS_StartMeasurement_CALLBACK Callback)
+{
+  Mock.MEAS_StartMeasurement_IgnoreBool = (char)0;
+  Mock.MEAS_StartMeasurement_CallbackBool = (char)1;
+  Mock.MEAS_StartMeasurement_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_StartMeasurement_Stub(CMOCK_MEAS_StartMeasurement_CALLBACK Callback)
+{
+  Mock.MEAS_StartMeasurement_IgnoreBool = (char)0;
+  Mock.MEAS_StartMeasurement_CallbackBool = (char)0;
+  Mock.MEAS_StartMeasurement_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_StartMeasurement_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_StartMeasurement_CALL_INSTANCE));
+  CMOCK_MEAS_StartMeasurement_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_StartMeasurement_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_StartMeasurement_CallInstance = CMock_Guts_MemChain(Mock.MEAS_StartMeasurement_CallInstance, cmock_guts_index);
+  Mock.MEAS_StartMeasurement_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e MEAS_RequestIoWrite(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_RequestIoWrite);
+  cmock_call_instance = (CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_RequestIoWrite_CallInstance);
+  Mock.MEAS_RequestIoWrite_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestIoWrite_CallInstance);
+  if (Mock.MEAS_RequestIoWrite_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_RequestIoWrite_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_RequestIoWrite_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_RequestIoWrite_CallbackBool &&
+      Mock.MEAS_RequestIoWrite_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MEAS_RequestIoWrite_CallbackFunctionPointer(string, Mock.MEAS_RequestIoWrite_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MEAS_RequestIoWrite,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MEAS_RequestIoWrite_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_RequestIoWrite_CallbackFunctionPointer(string, Mock.MEAS_RequestIoWrite_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MEAS_RequestIoWrite(CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MEAS_RequestIoWrite(CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MEAS_RequestIoWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE));
+  CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestIoWrite_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestIoWrite_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestIoWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_RequestIoWrite_IgnoreBool = (char)1;
+}
+
+void MEAS_RequestIoWrite_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_RequestIoWrite_IgnoreBool)
+    Mock.MEAS_RequestIoWrite_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestIoWrite_CallInstance);
+  Mock.MEAS_RequestIoWrite_IgnoreBool = (char)0;
+}
+
+void MEAS_RequestIoWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE));
+  CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestIoWrite_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestIoWrite_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestIoWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestIoWrite(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MEAS_RequestIoWrite_AddCallback(CMOCK_MEAS_RequestIoWrite_CALLBACK Callback)
+{
+  Mock.MEAS_RequestIoWrite_IgnoreBool = (char)0;
+  Mock.MEAS_RequestIoWrite_CallbackBool = (char)1;
+  Mock.MEAS_RequestIoWrite_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestIoWrite_Stub(CMOCK_MEAS_RequestIoWrite_CALLBACK Callback)
+{
+  Mock.MEAS_RequestIoWrite_IgnoreBool = (char)0;
+  Mock.MEAS_RequestIoWrite_CallbackBool = (char)0;
+  Mock.MEAS_RequestIoWrite_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestIoWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE));
+  CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestIoWrite_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestIoWrite_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestIoWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestIoWrite(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MEAS_RequestIoWrite_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MEAS_RequestIoWrite_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MEAS_RequestIoRead(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_RequestIoRead_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_RequestIoRead);
+  cmock_call_instance = (CMOCK_MEAS_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_RequestIoRead_CallInstance);
+  Mock.MEAS_RequestIoRead_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestIoRead_CallInstance);
+  if (Mock.MEAS_RequestIoRead_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_RequestIoRead_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_RequestIoRead_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_RequestIoRead_CallbackBool &&
+      Mock.MEAS_RequestIoRead_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MEAS_RequestIoRead_CallbackFunctionPointer(string, Mock.MEAS_RequestIoRead_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MEAS_RequestIoRead,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MEAS_RequestIoRead_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_RequestIoRead_CallbackFunctionPointer(string, Mock.MEAS_RequestIoRead_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MEAS_RequestIoRead(CMOCK_MEAS_RequestIoRead_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MEAS_RequestIoRead(CMOCK_MEAS_RequestIoRead_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MEAS_RequestIoRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestIoRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestIoRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestIoRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestIoRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestIoRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_RequestIoRead_IgnoreBool = (char)1;
+}
+
+void MEAS_RequestIoRead_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_RequestIoRead_IgnoreBool)
+    Mock.MEAS_RequestIoRead_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestIoRead_CallInstance);
+  Mock.MEAS_RequestIoRead_IgnoreBool = (char)0;
+}
+
+void MEAS_RequestIoRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestIoRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestIoRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestIoRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestIoRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestIoRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestIoRead(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MEAS_RequestIoRead_AddCallback(CMOCK_MEAS_RequestIoRead_CALLBACK Callback)
+{
+  Mock.MEAS_RequestIoRead_IgnoreBool = (char)0;
+  Mock.MEAS_RequestIoRead_CallbackBool = (char)1;
+  Mock.MEAS_RequestIoRead_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestIoRead_Stub(CMOCK_MEAS_RequestIoRead_CALLBACK Callback)
+{
+  Mock.MEAS_RequestIoRead_IgnoreBool = (char)0;
+  Mock.MEAS_RequestIoRead_CallbackBool = (char)0;
+  Mock.MEAS_RequestIoRead_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestIoRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestIoRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestIoRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestIoRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestIoRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestIoRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestIoRead(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MEAS_RequestIoRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEAS_RequestIoRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MEAS_RequestIoRead_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MEAS_RequestTemperatureRead(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_RequestTemperatureRead);
+  cmock_call_instance = (CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_RequestTemperatureRead_CallInstance);
+  Mock.MEAS_RequestTemperatureRead_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestTemperatureRead_CallInstance);
+  if (Mock.MEAS_RequestTemperatureRead_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_RequestTemperatureRead_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_RequestTemperatureRead_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_RequestTemperatureRead_CallbackBool &&
+      Mock.MEAS_RequestTemperatureRead_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MEAS_RequestTemperatureRead_CallbackFunctionPointer(string, Mock.MEAS_RequestTemperatureRead_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MEAS_RequestTemperatureRead,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MEAS_RequestTemperatureRead_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_RequestTemperatureRead_CallbackFunctionPointer(string, Mock.MEAS_RequestTemperatureRead_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MEAS_RequestTemperatureRead(CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MEAS_RequestTemperatureRead(CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MEAS_RequestTemperatureRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestTemperatureRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestTemperatureRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestTemperatureRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_RequestTemperatureRead_IgnoreBool = (char)1;
+}
+
+void MEAS_RequestTemperatureRead_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_RequestTemperatureRead_IgnoreBool)
+    Mock.MEAS_RequestTemperatureRead_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestTemperatureRead_CallInstance);
+  Mock.MEAS_RequestTemperatureRead_IgnoreBool = (char)0;
+}
+
+void MEAS_RequestTemperatureRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestTemperatureRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestTemperatureRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestTemperatureRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestTemperatureRead(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MEAS_RequestTemperatureRead_AddCallback(CMOCK_MEAS_RequestTemperatureRead_CALLBACK Callback)
+{
+  Mock.MEAS_RequestTemperatureRead_IgnoreBool = (char)0;
+  Mock.MEAS_RequestTemperatureRead_CallbackBool = (char)1;
+  Mock.MEAS_RequestTemperatureRead_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestTemperatureRead_Stub(CMOCK_MEAS_RequestTemperatureRead_CALLBACK Callback)
+{
+  Mock.MEAS_RequestTemperatureRead_IgnoreBool = (char)0;
+  Mock.MEAS_RequestTemperatureRead_CallbackBool = (char)0;
+  Mock.MEAS_RequestTemperatureRead_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestTemperatureRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestTemperatureRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestTemperatureRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestTemperatureRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestTemperatureRead(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MEAS_RequestTemperatureRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MEAS_RequestTemperatureRead_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MEAS_RequestBalancingFeedbackRead(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_RequestBalancingFeedbackRead);
+  cmock_call_instance = (CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_RequestBalancingFeedbackRead_CallInstance);
+  Mock.MEAS_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestBalancingFeedbackRead_CallInstance);
+  if (Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_RequestBalancingFeedbackRead_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_RequestBalancingFeedbackRead_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_RequestBalancingFeedbackRead_CallbackBool &&
+      Mock.MEAS_RequestBalancingFeedbackRead_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MEAS_RequestBalancingFeedbackRead_CallbackFunctionPointer(string, Mock.MEAS_RequestBalancingFeedbackRead_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MEAS_RequestBalancingFeedbackRead,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MEAS_RequestBalancingFeedbackRead_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_RequestBalancingFeedbackRead_CallbackFunctionPointer(string, Mock.MEAS_RequestBalancingFeedbackRead_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MEAS_RequestBalancingFeedbackRead(CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MEAS_RequestBalancingFeedbackRead(CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MEAS_RequestBalancingFeedbackRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestBalancingFeedbackRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool = (char)1;
+}
+
+void MEAS_RequestBalancingFeedbackRead_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool)
+    Mock.MEAS_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestBalancingFeedbackRead_CallInstance);
+  Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+}
+
+void MEAS_RequestBalancingFeedbackRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestBalancingFeedbackRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestBalancingFeedbackRead(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MEAS_RequestBalancingFeedbackRead_AddCallback(CMOCK_MEAS_RequestBalancingFeedbackRead_CALLBACK Callback)
+{
+  Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  Mock.MEAS_RequestBalancingFeedbackRead_CallbackBool = (char)1;
+  Mock.MEAS_RequestBalancingFeedbackRead_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestBalancingFeedbackRead_Stub(CMOCK_MEAS_RequestBalancingFeedbackRead_CALLBACK Callback)
+{
+  Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  Mock.MEAS_RequestBalancingFeedbackRead_CallbackBool = (char)0;
+  Mock.MEAS_RequestBalancingFeedbackRead_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestBalancingFeedbackRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestBalancingFeedbackRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestBalancingFeedbackRead(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MEAS_RequestBalancingFeedbackRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MEAS_RequestBalancingFeedbackRead_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MEAS_RequestEepromRead(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_RequestEepromRead);
+  cmock_call_instance = (CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_RequestEepromRead_CallInstance);
+  Mock.MEAS_RequestEepromRead_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestEepromRead_CallInstance);
+  if (Mock.MEAS_RequestEepromRead_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_RequestEepromRead_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_RequestEepromRead_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_RequestEepromRead_CallbackBool &&
+      Mock.MEAS_RequestEepromRead_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MEAS_RequestEepromRead_CallbackFunctionPointer(string, Mock.MEAS_RequestEepromRead_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MEAS_RequestEepromRead,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MEAS_RequestEepromRead_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_RequestEepromRead_CallbackFunctionPointer(string, Mock.MEAS_RequestEepromRead_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MEAS_RequestEepromRead(CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MEAS_RequestEepromRead(CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MEAS_RequestEepromRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestEepromRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestEepromRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestEepromRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_RequestEepromRead_IgnoreBool = (char)1;
+}
+
+void MEAS_RequestEepromRead_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_RequestEepromRead_IgnoreBool)
+    Mock.MEAS_RequestEepromRead_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestEepromRead_CallInstance);
+  Mock.MEAS_RequestEepromRead_IgnoreBool = (char)0;
+}
+
+void MEAS_RequestEepromRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestEepromRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestEepromRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestEepromRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestEepromRead(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MEAS_RequestEepromRead_AddCallback(CMOCK_MEAS_RequestEepromRead_CALLBACK Callback)
+{
+  Mock.MEAS_RequestEepromRead_IgnoreBool = (char)0;
+  Mock.MEAS_RequestEepromRead_CallbackBool = (char)1;
+  Mock.MEAS_RequestEepromRead_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestEepromRead_Stub(CMOCK_MEAS_RequestEepromRead_CALLBACK Callback)
+{
+  Mock.MEAS_RequestEepromRead_IgnoreBool = (char)0;
+  Mock.MEAS_RequestEepromRead_CallbackBool = (char)0;
+  Mock.MEAS_RequestEepromRead_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestEepromRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE));
+  CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestEepromRead_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestEepromRead_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestEepromRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestEepromRead(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MEAS_RequestEepromRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MEAS_RequestEepromRead_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MEAS_RequestEepromWrite(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_RequestEepromWrite);
+  cmock_call_instance = (CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_RequestEepromWrite_CallInstance);
+  Mock.MEAS_RequestEepromWrite_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestEepromWrite_CallInstance);
+  if (Mock.MEAS_RequestEepromWrite_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_RequestEepromWrite_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_RequestEepromWrite_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_RequestEepromWrite_CallbackBool &&
+      Mock.MEAS_RequestEepromWrite_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MEAS_RequestEepromWrite_CallbackFunctionPointer(string, Mock.MEAS_RequestEepromWrite_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MEAS_RequestEepromWrite,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MEAS_RequestEepromWrite_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_RequestEepromWrite_CallbackFunctionPointer(string, Mock.MEAS_RequestEepromWrite_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MEAS_RequestEepromWrite(CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MEAS_RequestEepromWrite(CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MEAS_RequestEepromWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE));
+  CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestEepromWrite_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestEepromWrite_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestEepromWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_RequestEepromWrite_IgnoreBool = (char)1;
+}
+
+void MEAS_RequestEepromWrite_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_RequestEepromWrite_IgnoreBool)
+    Mock.MEAS_RequestEepromWrite_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestEepromWrite_CallInstance);
+  Mock.MEAS_RequestEepromWrite_IgnoreBool = (char)0;
+}
+
+void MEAS_RequestEepromWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE));
+  CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestEepromWrite_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestEepromWrite_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestEepromWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestEepromWrite(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MEAS_RequestEepromWrite_AddCallback(CMOCK_MEAS_RequestEepromWrite_CALLBACK Callback)
+{
+  Mock.MEAS_RequestEepromWrite_IgnoreBool = (char)0;
+  Mock.MEAS_RequestEepromWrite_CallbackBool = (char)1;
+  Mock.MEAS_RequestEepromWrite_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestEepromWrite_Stub(CMOCK_MEAS_RequestEepromWrite_CALLBACK Callback)
+{
+  Mock.MEAS_RequestEepromWrite_IgnoreBool = (char)0;
+  Mock.MEAS_RequestEepromWrite_CallbackBool = (char)0;
+  Mock.MEAS_RequestEepromWrite_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestEepromWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE));
+  CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestEepromWrite_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestEepromWrite_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestEepromWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestEepromWrite(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MEAS_RequestEepromWrite_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MEAS_RequestEepromWrite_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MEAS_RequestOpenWireCheck(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MEAS_RequestOpenWireCheck);
+  cmock_call_instance = (CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MEAS_RequestOpenWireCheck_CallInstance);
+  Mock.MEAS_RequestOpenWireCheck_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestOpenWireCheck_CallInstance);
+  if (Mock.MEAS_RequestOpenWireCheck_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MEAS_RequestOpenWireCheck_FinalReturn;
+    memcpy((void*)(&Mock.MEAS_RequestOpenWireCheck_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MEAS_RequestOpenWireCheck_CallbackBool &&
+      Mock.MEAS_RequestOpenWireCheck_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MEAS_RequestOpenWireCheck_CallbackFunctionPointer(string, Mock.MEAS_RequestOpenWireCheck_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MEAS_RequestOpenWireCheck,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MEAS_RequestOpenWireCheck_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MEAS_RequestOpenWireCheck_CallbackFunctionPointer(string, Mock.MEAS_RequestOpenWireCheck_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MEAS_RequestOpenWireCheck(CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MEAS_RequestOpenWireCheck(CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MEAS_RequestOpenWireCheck_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE));
+  CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestOpenWireCheck_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestOpenWireCheck_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestOpenWireCheck_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MEAS_RequestOpenWireCheck_IgnoreBool = (char)1;
+}
+
+void MEAS_RequestOpenWireCheck_CMockStopIgnore(void)
+{
+  if(Mock.MEAS_RequestOpenWireCheck_IgnoreBool)
+    Mock.MEAS_RequestOpenWireCheck_CallInstance = CMock_Guts_MemNext(Mock.MEAS_RequestOpenWireCheck_CallInstance);
+  Mock.MEAS_RequestOpenWireCheck_IgnoreBool = (char)0;
+}
+
+void MEAS_RequestOpenWireCheck_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE));
+  CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestOpenWireCheck_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestOpenWireCheck_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestOpenWireCheck_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestOpenWireCheck(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MEAS_RequestOpenWireCheck_AddCallback(CMOCK_MEAS_RequestOpenWireCheck_CALLBACK Callback)
+{
+  Mock.MEAS_RequestOpenWireCheck_IgnoreBool = (char)0;
+  Mock.MEAS_RequestOpenWireCheck_CallbackBool = (char)1;
+  Mock.MEAS_RequestOpenWireCheck_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestOpenWireCheck_Stub(CMOCK_MEAS_RequestOpenWireCheck_CALLBACK Callback)
+{
+  Mock.MEAS_RequestOpenWireCheck_IgnoreBool = (char)0;
+  Mock.MEAS_RequestOpenWireCheck_CallbackBool = (char)0;
+  Mock.MEAS_RequestOpenWireCheck_CallbackFunctionPointer = Callback;
+}
+
+void MEAS_RequestOpenWireCheck_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE));
+  CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MEAS_RequestOpenWireCheck_CallInstance = CMock_Guts_MemChain(Mock.MEAS_RequestOpenWireCheck_CallInstance, cmock_guts_index);
+  Mock.MEAS_RequestOpenWireCheck_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MEAS_RequestOpenWireCheck(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MEAS_RequestOpenWireCheck_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance = (CMOCK_MEAS_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MEAS_RequestOpenWireCheck_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
@@ -0,0 +1,192 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKMEAS_H
+#define _MOCKMEAS_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "meas.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockmeas_Init(void);
+void Mockmeas_Destroy(void);
+void Mockmeas_Verify(void);
+
+
+
+
+#define MEAS_Initialize_IgnoreAndReturn(cmock_retval) MEAS_Initialize_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_Initialize_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MEAS_Initialize_StopIgnore() MEAS_Initialize_CMockStopIgnore()
+void MEAS_Initialize_CMockStopIgnore(void);
+#define MEAS_Initialize_ExpectAndReturn(cmock_retval) MEAS_Initialize_CMockExpectAndReturn(__LINE__, cmock_retval)
+void MEAS_Initialize_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MEAS_Initialize_CALLBACK)(int cmock_num_calls);
+void MEAS_Initialize_AddCallback(CMOCK_MEAS_Initialize_CALLBACK Callback);
+void MEAS_Initialize_Stub(CMOCK_MEAS_Initialize_CALLBACK Callback);
+#define MEAS_Initialize_StubWithCallback MEAS_Initialize_Stub
+#define MEAS_Initialize_ExpectAndThrow(cmock_to_throw) MEAS_Initialize_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MEAS_Initialize_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MEAS_Control_Ignore() MEAS_Control_CMockIgnore()
+void MEAS_Control_CMockIgnore(void);
+#define MEAS_Control_StopIgnore() MEAS_Control_CMockStopIgnore()
+void MEAS_Control_CMockStopIgnore(void);
+#define MEAS_Control_Expect() MEAS_Control_CMockExpect(__LINE__)
+void MEAS_Control_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_MEAS_Control_CALLBACK)(int cmock_num_calls);
+void MEAS_Control_AddCallback(CMOCK_MEAS_Control_CALLBACK Callback);
+void MEAS_Control_Stub(CMOCK_MEAS_Control_CALLBACK Callback);
+#define MEAS_Control_StubWithCallback MEAS_Control_Stub
+#define MEAS_Control_ExpectAndThrow(cmock_to_throw) MEAS_Control_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MEAS_Control_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MEAS_IsFirstMeasurementCycleFinished_IgnoreAndReturn(cmock_retval) MEAS_IsFirstMeasurementCycleFinished_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_IsFirstMeasurementCycleFinished_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define MEAS_IsFirstMeasurementCycleFinished_StopIgnore() MEAS_IsFirstMeasurementCycleFinished_CMockStopIgnore()
+void MEAS_IsFirstMeasurementCycleFinished_CMockStopIgnore(void);
+#define MEAS_IsFirstMeasurementCycleFinished_ExpectAndReturn(cmock_retval) MEAS_IsFirstMeasurementCycleFinished_CMockExpectAndReturn(__LINE__, cmock_retval)
+void MEAS_IsFirstMeasurementCycleFinished_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALLBACK)(int cmock_num_calls);
+void MEAS_IsFirstMeasurementCycleFinished_AddCallback(CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALLBACK Callback);
+void MEAS_IsFirstMeasurementCycleFinished_Stub(CMOCK_MEAS_IsFirstMeasurementCycleFinished_CALLBACK Callback);
+#define MEAS_IsFirstMeasurementCycleFinished_StubWithCallback MEAS_IsFirstMeasurementCycleFinished_Stub
+#define MEAS_IsFirstMeasurementCycleFinished_ExpectAndThrow(cmock_to_throw) MEAS_IsFirstMeasurementCycleFinished_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MEAS_IsFirstMeasurementCycleFinished_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MEAS_StartMeasurement_IgnoreAndReturn(cmock_retval) MEAS_StartMeasurement_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_StartMeasurement_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MEAS_StartMeasurement_StopIgnore() MEAS_StartMeasurement_CMockStopIgnore()
+void MEAS_StartMeasurement_CMockStopIgnore(void);
+#define MEAS_StartMeasurement_ExpectAndReturn(cmock_retval) MEAS_StartMeasurement_CMockExpectAndReturn(__LINE__, cmock_retval)
+void MEAS_StartMeasurement_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MEAS_StartMeasurement_CALLBACK)(int cmock_num_calls);
+void MEAS_StartMeasurement_AddCallback(CMOCK_MEAS_StartMeasurement_CALLBACK Callback);
+void MEAS_StartMeasurement_Stub(CMOCK_MEAS_StartMeasurement_CALLBACK Callback);
+#define MEAS_StartMeasurement_StubWithCallback MEAS_StartMeasurement_Stub
+#define MEAS_StartMeasurement_ExpectAndThrow(cmock_to_throw) MEAS_StartMeasurement_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MEAS_StartMeasurement_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MEAS_RequestIoWrite_IgnoreAndReturn(cmock_retval) MEAS_RequestIoWrite_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_RequestIoWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MEAS_RequestIoWrite_StopIgnore() MEAS_RequestIoWrite_CMockStopIgnore()
+void MEAS_RequestIoWrite_CMockStopIgnore(void);
+#define MEAS_RequestIoWrite_ExpectAndReturn(string, cmock_retval) MEAS_RequestIoWrite_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MEAS_RequestIoWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MEAS_RequestIoWrite_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MEAS_RequestIoWrite_AddCallback(CMOCK_MEAS_RequestIoWrite_CALLBACK Callback);
+void MEAS_RequestIoWrite_Stub(CMOCK_MEAS_RequestIoWrite_CALLBACK Callback);
+#define MEAS_RequestIoWrite_StubWithCallback MEAS_RequestIoWrite_Stub
+#define MEAS_RequestIoWrite_ExpectAndThrow(string, cmock_to_throw) MEAS_RequestIoWrite_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MEAS_RequestIoWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MEAS_RequestIoWrite_IgnoreArg_string() MEAS_RequestIoWrite_CMockIgnoreArg_string(__LINE__)
+void MEAS_RequestIoWrite_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MEAS_RequestIoRead_IgnoreAndReturn(cmock_retval) MEAS_RequestIoRead_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_RequestIoRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MEAS_RequestIoRead_StopIgnore() MEAS_RequestIoRead_CMockStopIgnore()
+void MEAS_RequestIoRead_CMockStopIgnore(void);
+#define MEAS_RequestIoRead_ExpectAndReturn(string, cmock_retval) MEAS_RequestIoRead_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MEAS_RequestIoRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MEAS_RequestIoRead_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MEAS_RequestIoRead_AddCallback(CMOCK_MEAS_RequestIoRead_CALLBACK Callback);
+void MEAS_RequestIoRead_Stub(CMOCK_MEAS_RequestIoRead_CALLBACK Callback);
+#define MEAS_RequestIoRead_StubWithCallback MEAS_RequestIoRead_Stub
+#define MEAS_RequestIoRead_ExpectAndThrow(string, cmock_to_throw) MEAS_RequestIoRead_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MEAS_RequestIoRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MEAS_RequestIoRead_IgnoreArg_string() MEAS_RequestIoRead_CMockIgnoreArg_string(__LINE__)
+void MEAS_RequestIoRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MEAS_RequestTemperatureRead_IgnoreAndReturn(cmock_retval) MEAS_RequestTemperatureRead_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_RequestTemperatureRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MEAS_RequestTemperatureRead_StopIgnore() MEAS_RequestTemperatureRead_CMockStopIgnore()
+void MEAS_RequestTemperatureRead_CMockStopIgnore(void);
+#define MEAS_RequestTemperatureRead_ExpectAndReturn(string, cmock_retval) MEAS_RequestTemperatureRead_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MEAS_RequestTemperatureRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MEAS_RequestTemperatureRead_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MEAS_RequestTemperatureRead_AddCallback(CMOCK_MEAS_RequestTemperatureRead_CALLBACK Callback);
+void MEAS_RequestTemperatureRead_Stub(CMOCK_MEAS_RequestTemperatureRead_CALLBACK Callback);
+#define MEAS_RequestTemperatureRead_StubWithCallback MEAS_RequestTemperatureRead_Stub
+#define MEAS_RequestTemperatureRead_ExpectAndThrow(string, cmock_to_throw) MEAS_RequestTemperatureRead_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MEAS_RequestTemperatureRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MEAS_RequestTemperatureRead_IgnoreArg_string() MEAS_RequestTemperatureRead_CMockIgnoreArg_string(__LINE__)
+void MEAS_RequestTemperatureRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MEAS_RequestBalancingFeedbackRead_IgnoreAndReturn(cmock_retval) MEAS_RequestBalancingFeedbackRead_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_RequestBalancingFeedbackRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MEAS_RequestBalancingFeedbackRead_StopIgnore() MEAS_RequestBalancingFeedbackRead_CMockStopIgnore()
+void MEAS_RequestBalancingFeedbackRead_CMockStopIgnore(void);
+#define MEAS_RequestBalancingFeedbackRead_ExpectAndReturn(string, cmock_retval) MEAS_RequestBalancingFeedbackRead_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MEAS_RequestBalancingFeedbackRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MEAS_RequestBalancingFeedbackRead_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MEAS_RequestBalancingFeedbackRead_AddCallback(CMOCK_MEAS_RequestBalancingFeedbackRead_CALLBACK Callback);
+void MEAS_RequestBalancingFeedbackRead_Stub(CMOCK_MEAS_RequestBalancingFeedbackRead_CALLBACK Callback);
+#define MEAS_RequestBalancingFeedbackRead_StubWithCallback MEAS_RequestBalancingFeedbackRead_Stub
+#define MEAS_RequestBalancingFeedbackRead_ExpectAndThrow(string, cmock_to_throw) MEAS_RequestBalancingFeedbackRead_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MEAS_RequestBalancingFeedbackRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MEAS_RequestBalancingFeedbackRead_IgnoreArg_string() MEAS_RequestBalancingFeedbackRead_CMockIgnoreArg_string(__LINE__)
+void MEAS_RequestBalancingFeedbackRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MEAS_RequestEepromRead_IgnoreAndReturn(cmock_retval) MEAS_RequestEepromRead_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_RequestEepromRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MEAS_RequestEepromRead_StopIgnore() MEAS_RequestEepromRead_CMockStopIgnore()
+void MEAS_RequestEepromRead_CMockStopIgnore(void);
+#define MEAS_RequestEepromRead_ExpectAndReturn(string, cmock_retval) MEAS_RequestEepromRead_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MEAS_RequestEepromRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MEAS_RequestEepromRead_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MEAS_RequestEepromRead_AddCallback(CMOCK_MEAS_RequestEepromRead_CALLBACK Callback);
+void MEAS_RequestEepromRead_Stub(CMOCK_MEAS_RequestEepromRead_CALLBACK Callback);
+#define MEAS_RequestEepromRead_StubWithCallback MEAS_RequestEepromRead_Stub
+#define MEAS_RequestEepromRead_ExpectAndThrow(string, cmock_to_throw) MEAS_RequestEepromRead_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MEAS_RequestEepromRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MEAS_RequestEepromRead_IgnoreArg_string() MEAS_RequestEepromRead_CMockIgnoreArg_string(__LINE__)
+void MEAS_RequestEepromRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MEAS_RequestEepromWrite_IgnoreAndReturn(cmock_retval) MEAS_RequestEepromWrite_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_RequestEepromWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MEAS_RequestEepromWrite_StopIgnore() MEAS_RequestEepromWrite_CMockStopIgnore()
+void MEAS_RequestEepromWrite_CMockStopIgnore(void);
+#define MEAS_RequestEepromWrite_ExpectAndReturn(string, cmock_retval) MEAS_RequestEepromWrite_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MEAS_RequestEepromWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MEAS_RequestEepromWrite_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MEAS_RequestEepromWrite_AddCallback(CMOCK_MEAS_RequestEepromWrite_CALLBACK Callback);
+void MEAS_RequestEepromWrite_Stub(CMOCK_MEAS_RequestEepromWrite_CALLBACK Callback);
+#define MEAS_RequestEepromWrite_StubWithCallback MEAS_RequestEepromWrite_Stub
+#define MEAS_RequestEepromWrite_ExpectAndThrow(string, cmock_to_throw) MEAS_RequestEepromWrite_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MEAS_RequestEepromWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MEAS_RequestEepromWrite_IgnoreArg_string() MEAS_RequestEepromWrite_CMockIgnoreArg_string(__LINE__)
+void MEAS_RequestEepromWrite_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MEAS_RequestOpenWireCheck_IgnoreAndReturn(cmock_retval) MEAS_RequestOpenWireCheck_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MEAS_RequestOpenWireCheck_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MEAS_RequestOpenWireCheck_StopIgnore() MEAS_RequestOpenWireCheck_CMockStopIgnore()
+void MEAS_RequestOpenWireCheck_CMockStopIgnore(void);
+#define MEAS_RequestOpenWireCheck_ExpectAndReturn(string, cmock_retval) MEAS_RequestOpenWireCheck_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MEAS_RequestOpenWireCheck_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MEAS_RequestOpenWireCheck_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MEAS_RequestOpenWireCheck_AddCallback(CMOCK_MEAS_RequestOpenWireCheck_CALLBACK Callback);
+void MEAS_RequestOpenWireCheck_Stub(CMOCK_MEAS_RequestOpenWireCheck_CALLBACK Callback);
+#define MEAS_RequestOpenWireCheck_StubWithCallback MEAS_RequestOpenWireCheck_Stub
+#define MEAS_RequestOpenWireCheck_ExpectAndThrow(string, cmock_to_throw) MEAS_RequestOpenWireCheck_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MEAS_RequestOpenWireCheck_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MEAS_RequestOpenWireCheck_IgnoreArg_string() MEAS_RequestOpenWireCheck_CMockIgnoreArg_string(__LINE__)
+void MEAS_RequestOpenWireCheck_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
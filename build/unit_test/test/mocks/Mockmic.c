@@ -0,0 +1,1682 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockmic.h"
+
+static const char* CMockString_MIC_Init = "MIC_Init";
+static const char* CMockString_MIC_IsFirstMeasurementCycleFinished = "MIC_IsFirstMeasurementCycleFinished";
+static const char* CMockString_MIC_RequestBalancingFeedbackRead = "MIC_RequestBalancingFeedbackRead";
+static const char* CMockString_MIC_RequestEepromRead = "MIC_RequestEepromRead";
+static const char* CMockString_MIC_RequestEepromWrite = "MIC_RequestEepromWrite";
+static const char* CMockString_MIC_RequestIoRead = "MIC_RequestIoRead";
+static const char* CMockString_MIC_RequestIoWrite = "MIC_RequestIoWrite";
+static const char* CMockString_MIC_RequestOpenWireCheck = "MIC_RequestOpenWireCheck";
+static const char* CMockString_MIC_RequestTemperatureRead = "MIC_RequestTemperatureRead";
+static const char* CMockString_MIC_StartMeasurement = "MIC_StartMeasurement";
+static const char* CMockString_MIC_TriggerIc = "MIC_TriggerIc";
+static const char* CMockString_string = "string";
+
+typedef struct _CMOCK_MIC_TriggerIc_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MIC_TriggerIc_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_Init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MIC_Init_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_StartMeasurement_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MIC_StartMeasurement_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_RequestIoWrite_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MIC_RequestIoWrite_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_RequestIoRead_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MIC_RequestIoRead_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_RequestEepromRead_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MIC_RequestEepromRead_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_string;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_string;
+
+} CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE;
+
+static struct MockmicInstance
+{
+  char MIC_TriggerIc_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_TriggerIc_FinalReturn;
+  char MIC_TriggerIc_CallbackBool;
+  CMOCK_MIC_TriggerIc_CALLBACK MIC_TriggerIc_CallbackFunctionPointer;
+  int MIC_TriggerIc_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_TriggerIc_CallInstance;
+  char MIC_Init_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_Init_FinalReturn;
+  char MIC_Init_CallbackBool;
+  CMOCK_MIC_Init_CALLBACK MIC_Init_CallbackFunctionPointer;
+  int MIC_Init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_Init_CallInstance;
+  char MIC_StartMeasurement_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_StartMeasurement_FinalReturn;
+  char MIC_StartMeasurement_CallbackBool;
+  CMOCK_MIC_StartMeasurement_CALLBACK MIC_StartMeasurement_CallbackFunctionPointer;
+  int MIC_StartMeasurement_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_StartMeasurement_CallInstance;
+  char MIC_IsFirstMeasurementCycleFinished_IgnoreBool;
+  _Bool MIC_IsFirstMeasurementCycleFinished_FinalReturn;
+  char MIC_IsFirstMeasurementCycleFinished_CallbackBool;
+  CMOCK_MIC_IsFirstMeasurementCycleFinished_CALLBACK MIC_IsFirstMeasurementCycleFinished_CallbackFunctionPointer;
+  int MIC_IsFirstMeasurementCycleFinished_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_IsFirstMeasurementCycleFinished_CallInstance;
+  char MIC_RequestIoWrite_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_RequestIoWrite_FinalReturn;
+  char MIC_RequestIoWrite_CallbackBool;
+  CMOCK_MIC_RequestIoWrite_CALLBACK MIC_RequestIoWrite_CallbackFunctionPointer;
+  int MIC_RequestIoWrite_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_RequestIoWrite_CallInstance;
+  char MIC_RequestIoRead_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_RequestIoRead_FinalReturn;
+  char MIC_RequestIoRead_CallbackBool;
+  CMOCK_MIC_RequestIoRead_CALLBACK MIC_RequestIoRead_CallbackFunctionPointer;
+  int MIC_RequestIoRead_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_RequestIoRead_CallInstance;
+  char MIC_RequestTemperatureRead_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_RequestTemperatureRead_FinalReturn;
+  char MIC_RequestTemperatureRead_CallbackBool;
+  CMOCK_MIC_RequestTemperatureRead_CALLBACK MIC_RequestTemperatureRead_CallbackFunctionPointer;
+  int MIC_RequestTemperatureRead_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_RequestTemperatureRead_CallInstance;
+  char MIC_RequestBalancingFeedbackRead_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_RequestBalancingFeedbackRead_FinalReturn;
+  char MIC_RequestBalancingFeedbackRead_CallbackBool;
+  CMOCK_MIC_RequestBalancingFeedbackRead_CALLBACK MIC_RequestBalancingFeedbackRead_CallbackFunctionPointer;
+  int MIC_RequestBalancingFeedbackRead_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_RequestBalancingFeedbackRead_CallInstance;
+  char MIC_RequestEepromRead_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_RequestEepromRead_FinalReturn;
+  char MIC_RequestEepromRead_CallbackBool;
+  CMOCK_MIC_RequestEepromRead_CALLBACK MIC_RequestEepromRead_CallbackFunctionPointer;
+  int MIC_RequestEepromRead_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_RequestEepromRead_CallInstance;
+  char MIC_RequestEepromWrite_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_RequestEepromWrite_FinalReturn;
+  char MIC_RequestEepromWrite_CallbackBool;
+  CMOCK_MIC_RequestEepromWrite_CALLBACK MIC_RequestEepromWrite_CallbackFunctionPointer;
+  int MIC_RequestEepromWrite_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_RequestEepromWrite_CallInstance;
+  char MIC_RequestOpenWireCheck_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_RequestOpenWireCheck_FinalReturn;
+  char MIC_RequestOpenWireCheck_CallbackBool;
+  CMOCK_MIC_RequestOpenWireCheck_CALLBACK MIC_RequestOpenWireCheck_CallbackFunctionPointer;
+  int MIC_RequestOpenWireCheck_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_RequestOpenWireCheck_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockmic_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.MIC_TriggerIc_CallInstance;
+  if (Mock.MIC_TriggerIc_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_TriggerIc);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_TriggerIc_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_Init_CallInstance;
+  if (Mock.MIC_Init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_Init);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_Init_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_StartMeasurement_CallInstance;
+  if (Mock.MIC_StartMeasurement_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_StartMeasurement);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_StartMeasurement_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance;
+  if (Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_IsFirstMeasurementCycleFinished);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_IsFirstMeasurementCycleFinished_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_RequestIoWrite_CallInstance;
+  if (Mock.MIC_RequestIoWrite_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_RequestIoWrite);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_RequestIoWrite_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_RequestIoRead_CallInstance;
+  if (Mock.MIC_RequestIoRead_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_RequestIoRead);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_RequestIoRead_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_RequestTemperatureRead_CallInstance;
+  if (Mock.MIC_RequestTemperatureRead_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_RequestTemperatureRead);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_RequestTemperatureRead_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_RequestBalancingFeedbackRead_CallInstance;
+  if (Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_RequestBalancingFeedbackRead);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_RequestBalancingFeedbackRead_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_RequestEepromRead_CallInstance;
+  if (Mock.MIC_RequestEepromRead_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_RequestEepromRead);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_RequestEepromRead_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_RequestEepromWrite_CallInstance;
+  if (Mock.MIC_RequestEepromWrite_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_RequestEepromWrite);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_RequestEepromWrite_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_RequestOpenWireCheck_CallInstance;
+  if (Mock.MIC_RequestOpenWireCheck_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_RequestOpenWireCheck);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_RequestOpenWireCheck_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockmic_Init(void)
+{
+  Mockmic_Destroy();
+}
+
+void Mockmic_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+STD_RETURN_TYPE_e MIC_TriggerIc(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_TriggerIc_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_TriggerIc);
+  cmock_call_instance = (CMOCK_MIC_TriggerIc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_TriggerIc_CallInstance);
+  Mock.MIC_TriggerIc_CallInstance = CMock_Guts_MemNext(Mock.MIC_TriggerIc_CallInstance);
+  if (Mock.MIC_TriggerIc_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_TriggerIc_FinalReturn;
+    memcpy((void*)(&Mock.MIC_TriggerIc_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_TriggerIc_CallbackBool &&
+      Mock.MIC_TriggerIc_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_TriggerIc_CallbackFunctionPointer(Mock.MIC_TriggerIc_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MIC_TriggerIc_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_TriggerIc_CallbackFunctionPointer(Mock.MIC_TriggerIc_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void MIC_TriggerIc_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_TriggerIc_CALL_INSTANCE));
+  CMOCK_MIC_TriggerIc_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TriggerIc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_TriggerIc_CallInstance = CMock_Guts_MemChain(Mock.MIC_TriggerIc_CallInstance, cmock_guts_index);
+  Mock.MIC_TriggerIc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_TriggerIc_IgnoreBool = (char)1;
+}
+
+void MIC_TriggerIc_CMockStopIgnore(void)
+{
+  if(Mock.MIC_TriggerIc_IgnoreBool)
+    Mock.MIC_TriggerIc_CallInstance = CMock_Guts_MemNext(Mock.MIC_TriggerIc_CallInstance);
+  Mock.MIC_TriggerIc_IgnoreBool = (char)0;
+}
+
+void MIC_TriggerIc_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_TriggerIc_CALL_INSTANCE));
+  CMOCK_MIC_TriggerIc_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TriggerIc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_TriggerIc_CallInstance = CMock_Guts_MemChain(Mock.MIC_TriggerIc_CallInstance, cmock_guts_index);
+  Mock.MIC_TriggerIc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_TriggerIc_AddCallback(CMOCK_MIC_TriggerIc_CALLBACK Callback)
+{
+  Mock.MIC_TriggerIc_IgnoreBool = (char)0;
+  Mock.MIC_TriggerIc_CallbackBool = (char)1;
+  Mock.MIC_TriggerIc_CallbackFunctionPointer = Callback;
+}
+
+void MIC_TriggerIc_Stub(CMOCK_MIC_TriggerIc_CALLBACK Callback)
+{
+  Mock.MIC_TriggerIc_IgnoreBool = (char)0;
+  Mock.MIC_TriggerIc_CallbackBool = (char)0;
+  Mock.MIC_TriggerIc_CallbackFunctionPointer = Callback;
+}
+
+void MIC_TriggerIc_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_TriggerIc_CALL_INSTANCE));
+  CMOCK_MIC_TriggerIc_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_TriggerIc_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_TriggerIc_CallInstance = CMock_Guts_MemChain(Mock.MIC_TriggerIc_CallInstance, cmock_guts_index);
+  Mock.MIC_TriggerIc_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e MIC_Init(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_Init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_Init);
+  cmock_call_instance = (CMOCK_MIC_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_Init_CallInstance);
+  Mock.MIC_Init_CallInstance = CMock_Guts_MemNext(Mock.MIC_Init_CallInstance);
+  if (Mock.MIC_Init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_Init_FinalReturn;
+    memcpy((void*)(&Mock.MIC_Init_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_Init_CallbackBool &&
+      Mock.MIC_Init_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_Init_CallbackFunctionPointer(Mock.MIC_Init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MIC_Init_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_Init_CallbackFunctionPointer(Mock.MIC_Init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void MIC_Init_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_Init_CALL_INSTANCE));
+  CMOCK_MIC_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_Init_CallInstance = CMock_Guts_MemChain(Mock.MIC_Init_CallInstance, cmock_guts_index);
+  Mock.MIC_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_Init_IgnoreBool = (char)1;
+}
+
+void MIC_Init_CMockStopIgnore(void)
+{
+  if(Mock.MIC_Init_IgnoreBool)
+    Mock.MIC_Init_CallInstance = CMock_Guts_MemNext(Mock.MIC_Init_CallInstance);
+  Mock.MIC_Init_IgnoreBool = (char)0;
+}
+
+void MIC_Init_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_Init_CALL_INSTANCE));
+  CMOCK_MIC_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_Init_CallInstance = CMock_Guts_MemChain(Mock.MIC_Init_CallInstance, cmock_guts_index);
+  Mock.MIC_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_Init_AddCallback(CMOCK_MIC_Init_CALLBACK Callback)
+{
+  Mock.MIC_Init_IgnoreBool = (char)0;
+  Mock.MIC_Init_CallbackBool = (char)1;
+  Mock.MIC_Init_CallbackFunctionPointer = Callback;
+}
+
+void MIC_Init_Stub(CMOCK_MIC_Init_CALLBACK Callback)
+{
+  Mock.MIC_Init_IgnoreBool = (char)0;
+  Mock.MIC_Init_CallbackBool = (char)0;
+  Mock.MIC_Init_CallbackFunctionPointer = Callback;
+}
+
+void MIC_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_Init_CALL_INSTANCE));
+  CMOCK_MIC_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_Init_CallInstance = CMock_Guts_MemChain(Mock.MIC_Init_CallInstance, cmock_guts_index);
+  Mock.MIC_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e MIC_StartMeasurement(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_StartMeasurement_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_StartMeasurement);
+  cmock_call_instance = (CMOCK_MIC_StartMeasurement_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_StartMeasurement_CallInstance);
+  Mock.MIC_StartMeasurement_CallInstance = CMock_Guts_MemNext(Mock.MIC_StartMeasurement_CallInstance);
+  if (Mock.MIC_StartMeasurement_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_StartMeasurement_FinalReturn;
+    memcpy((void*)(&Mock.MIC_StartMeasurement_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_StartMeasurement_CallbackBool &&
+      Mock.MIC_StartMeasurement_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_StartMeasurement_CallbackFunctionPointer(Mock.MIC_StartMeasurement_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MIC_StartMeasurement_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_StartMeasurement_CallbackFunctionPointer(Mock.MIC_StartMeasurement_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void MIC_StartMeasurement_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_StartMeasurement_CALL_INSTANCE));
+  CMOCK_MIC_StartMeasurement_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_StartMeasurement_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_StartMeasurement_CallInstance = CMock_Guts_MemChain(Mock.MIC_StartMeasurement_CallInstance, cmock_guts_index);
+  Mock.MIC_StartMeasurement_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_StartMeasurement_IgnoreBool = (char)1;
+}
+
+void MIC_StartMeasurement_CMockStopIgnore(void)
+{
+  if(Mock.MIC_StartMeasurement_IgnoreBool)
+    Mock.MIC_StartMeasurement_CallInstance = CMock_Guts_MemNext(Mock.MIC_StartMeasurement_CallInstance);
+  Mock.MIC_StartMeasurement_IgnoreBool = (char)0;
+}
+
+void MIC_StartMeasurement_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_StartMeasurement_CALL_INSTANCE));
+  CMOCK_MIC_StartMeasurement_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_StartMeasurement_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_StartMeasurement_CallInstance = CMock_Guts_MemChain(Mock.MIC_StartMeasurement_CallInstance, cmock_guts_index);
+  Mock.MIC_StartMeasurement_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_StartMeasurement_AddCallback(CMOCK_MIC_StartMeasurement_CALLBACK Callback)
+{
+  Mock.MIC_StartMeasurement_IgnoreBool = (char)0;
+  Mock.MIC_StartMeasurement_CallbackBool = (char)1;
+  Mock.MIC_StartMeasurement_CallbackFunctionPointer = Callback;
+}
+
+void MIC_StartMeasurement_Stub(CMOCK_MIC_StartMeasurement_CALLBACK Callback)
+{
+  Mock.MIC_StartMeasurement_IgnoreBool = (char)0;
+  Mock.MIC_StartMeasurement_CallbackBool = (char)0;
+  Mock.MIC_StartMeasurement_CallbackFunctionPointer = Callback;
+}
+
+void MIC_StartMeasurement_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_StartMeasurement_CALL_INSTANCE));
+  CMOCK_MIC_StartMeasurement_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_StartMeasurement_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_StartMeasurement_CallInstance = CMock_Guts_MemChain(Mock.MIC_StartMeasurement_CallInstance, cmock_guts_index);
+  Mock.MIC_StartMeasurement_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+_Bool MIC_IsFirstMeasurementCycleFinished(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_IsFirstMeasurementCycleFinished);
+  cmock_call_instance = (CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance);
+  Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemNext(Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance);
+  if (Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_IsFirstMeasurementCycleFinished_FinalReturn;
+    memcpy((void*)(&Mock.MIC_IsFirstMeasurementCycleFinished_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_IsFirstMeasurementCycleFinished_CallbackBool &&
+      Mock.MIC_IsFirstMeasurementCycleFinished_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.MIC_IsFirstMeasurementCycleFinished_CallbackFunctionPointer(Mock.MIC_IsFirstMeasurementCycleFinished_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.MIC_IsFirstMeasurementCycleFinished_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_IsFirstMeasurementCycleFinished_CallbackFunctionPointer(Mock.MIC_IsFirstMeasurementCycleFinished_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void MIC_IsFirstMeasurementCycleFinished_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE));
+  CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemChain(Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance, cmock_guts_index);
+  Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool = (char)1;
+}
+
+void MIC_IsFirstMeasurementCycleFinished_CMockStopIgnore(void)
+{
+  if(Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool)
+    Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemNext(Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance);
+  Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+}
+
+void MIC_IsFirstMeasurementCycleFinished_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE));
+  CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemChain(Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance, cmock_guts_index);
+  Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void MIC_IsFirstMeasurementCycleFinished_AddCallback(CMOCK_MIC_IsFirstMeasurementCycleFinished_CALLBACK Callback)
+{
+  Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  Mock.MIC_IsFirstMeasurementCycleFinished_CallbackBool = (char)1;
+  Mock.MIC_IsFirstMeasurementCycleFinished_CallbackFunctionPointer = Callback;
+}
+
+void MIC_IsFirstMeasurementCycleFinished_Stub(CMOCK_MIC_IsFirstMeasurementCycleFinished_CALLBACK Callback)
+{
+  Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  Mock.MIC_IsFirstMeasurementCycleFinished_CallbackBool = (char)0;
+  Mock.MIC_IsFirstMeasurementCycleFinished_CallbackFunctionPointer = Callback;
+}
+
+void MIC_IsFirstMeasurementCycleFinished_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE));
+  CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_IsFirstMeasurementCycleFinished_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance = CMock_Guts_MemChain(Mock.MIC_IsFirstMeasurementCycleFinished_CallInstance, cmock_guts_index);
+  Mock.MIC_IsFirstMeasurementCycleFinished_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+STD_RETURN_TYPE_e MIC_RequestIoWrite(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_RequestIoWrite_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_RequestIoWrite);
+  cmock_call_instance = (CMOCK_MIC_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_RequestIoWrite_CallInstance);
+  Mock.MIC_RequestIoWrite_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestIoWrite_CallInstance);
+  if (Mock.MIC_RequestIoWrite_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_RequestIoWrite_FinalReturn;
+    memcpy((void*)(&Mock.MIC_RequestIoWrite_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_RequestIoWrite_CallbackBool &&
+      Mock.MIC_RequestIoWrite_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_RequestIoWrite_CallbackFunctionPointer(string, Mock.MIC_RequestIoWrite_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_RequestIoWrite,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_RequestIoWrite_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_RequestIoWrite_CallbackFunctionPointer(string, Mock.MIC_RequestIoWrite_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_RequestIoWrite(CMOCK_MIC_RequestIoWrite_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MIC_RequestIoWrite(CMOCK_MIC_RequestIoWrite_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MIC_RequestIoWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestIoWrite_CALL_INSTANCE));
+  CMOCK_MIC_RequestIoWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestIoWrite_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestIoWrite_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestIoWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_RequestIoWrite_IgnoreBool = (char)1;
+}
+
+void MIC_RequestIoWrite_CMockStopIgnore(void)
+{
+  if(Mock.MIC_RequestIoWrite_IgnoreBool)
+    Mock.MIC_RequestIoWrite_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestIoWrite_CallInstance);
+  Mock.MIC_RequestIoWrite_IgnoreBool = (char)0;
+}
+
+void MIC_RequestIoWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestIoWrite_CALL_INSTANCE));
+  CMOCK_MIC_RequestIoWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestIoWrite_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestIoWrite_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestIoWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestIoWrite(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_RequestIoWrite_AddCallback(CMOCK_MIC_RequestIoWrite_CALLBACK Callback)
+{
+  Mock.MIC_RequestIoWrite_IgnoreBool = (char)0;
+  Mock.MIC_RequestIoWrite_CallbackBool = (char)1;
+  Mock.MIC_RequestIoWrite_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestIoWrite_Stub(CMOCK_MIC_RequestIoWrite_CALLBACK Callback)
+{
+  Mock.MIC_RequestIoWrite_IgnoreBool = (char)0;
+  Mock.MIC_RequestIoWrite_CallbackBool = (char)0;
+  Mock.MIC_RequestIoWrite_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestIoWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestIoWrite_CALL_INSTANCE));
+  CMOCK_MIC_RequestIoWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestIoWrite_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestIoWrite_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestIoWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestIoWrite(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_RequestIoWrite_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_RequestIoWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestIoWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_RequestIoWrite_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MIC_RequestIoRead(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_RequestIoRead_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_RequestIoRead);
+  cmock_call_instance = (CMOCK_MIC_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_RequestIoRead_CallInstance);
+  Mock.MIC_RequestIoRead_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestIoRead_CallInstance);
+  if (Mock.MIC_RequestIoRead_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_RequestIoRead_FinalReturn;
+    memcpy((void*)(&Mock.MIC_RequestIoRead_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_RequestIoRead_CallbackBool &&
+      Mock.MIC_RequestIoRead_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_RequestIoRead_CallbackFunctionPointer(string, Mock.MIC_RequestIoRead_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_RequestIoRead,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_RequestIoRead_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_RequestIoRead_CallbackFunctionPointer(string, Mock.MIC_RequestIoRead_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_RequestIoRead(CMOCK_MIC_RequestIoRead_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MIC_RequestIoRead(CMOCK_MIC_RequestIoRead_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MIC_RequestIoRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestIoRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestIoRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestIoRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestIoRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestIoRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_RequestIoRead_IgnoreBool = (char)1;
+}
+
+void MIC_RequestIoRead_CMockStopIgnore(void)
+{
+  if(Mock.MIC_RequestIoRead_IgnoreBool)
+    Mock.MIC_RequestIoRead_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestIoRead_CallInstance);
+  Mock.MIC_RequestIoRead_IgnoreBool = (char)0;
+}
+
+void MIC_RequestIoRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestIoRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestIoRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestIoRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestIoRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestIoRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestIoRead(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_RequestIoRead_AddCallback(CMOCK_MIC_RequestIoRead_CALLBACK Callback)
+{
+  Mock.MIC_RequestIoRead_IgnoreBool = (char)0;
+  Mock.MIC_RequestIoRead_CallbackBool = (char)1;
+  Mock.MIC_RequestIoRead_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestIoRead_Stub(CMOCK_MIC_RequestIoRead_CALLBACK Callback)
+{
+  Mock.MIC_RequestIoRead_IgnoreBool = (char)0;
+  Mock.MIC_RequestIoRead_CallbackBool = (char)0;
+  Mock.MIC_RequestIoRead_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestIoRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestIoRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestIoRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestIoRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestIoRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestIoRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestIoRead(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_RequestIoRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_RequestIoRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestIoRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_RequestIoRead_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MIC_RequestTemperatureRead(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_RequestTemperatureRead);
+  cmock_call_instance = (CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_RequestTemperatureRead_CallInstance);
+  Mock.MIC_RequestTemperatureRead_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestTemperatureRead_CallInstance);
+  if (Mock.MIC_RequestTemperatureRead_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_RequestTemperatureRead_FinalReturn;
+    memcpy((void*)(&Mock.MIC_RequestTemperatureRead_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_RequestTemperatureRead_CallbackBool &&
+      Mock.MIC_RequestTemperatureRead_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_RequestTemperatureRead_CallbackFunctionPointer(string, Mock.MIC_RequestTemperatureRead_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_RequestTemperatureRead,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_RequestTemperatureRead_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_RequestTemperatureRead_CallbackFunctionPointer(string, Mock.MIC_RequestTemperatureRead_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_RequestTemperatureRead(CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MIC_RequestTemperatureRead(CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MIC_RequestTemperatureRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestTemperatureRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestTemperatureRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestTemperatureRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_RequestTemperatureRead_IgnoreBool = (char)1;
+}
+
+void MIC_RequestTemperatureRead_CMockStopIgnore(void)
+{
+  if(Mock.MIC_RequestTemperatureRead_IgnoreBool)
+    Mock.MIC_RequestTemperatureRead_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestTemperatureRead_CallInstance);
+  Mock.MIC_RequestTemperatureRead_IgnoreBool = (char)0;
+}
+
+void MIC_RequestTemperatureRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestTemperatureRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestTemperatureRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestTemperatureRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestTemperatureRead(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_RequestTemperatureRead_AddCallback(CMOCK_MIC_RequestTemperatureRead_CALLBACK Callback)
+{
+  Mock.MIC_RequestTemperatureRead_IgnoreBool = (char)0;
+  Mock.MIC_RequestTemperatureRead_CallbackBool = (char)1;
+  Mock.MIC_RequestTemperatureRead_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestTemperatureRead_Stub(CMOCK_MIC_RequestTemperatureRead_CALLBACK Callback)
+{
+  Mock.MIC_RequestTemperatureRead_IgnoreBool = (char)0;
+  Mock.MIC_RequestTemperatureRead_CallbackBool = (char)0;
+  Mock.MIC_RequestTemperatureRead_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestTemperatureRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestTemperatureRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestTemperatureRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestTemperatureRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestTemperatureRead(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_RequestTemperatureRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestTemperatureRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_RequestTemperatureRead_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MIC_RequestBalancingFeedbackRead(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_RequestBalancingFeedbackRead);
+  cmock_call_instance = (CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_RequestBalancingFeedbackRead_CallInstance);
+  Mock.MIC_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestBalancingFeedbackRead_CallInstance);
+  if (Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_RequestBalancingFeedbackRead_FinalReturn;
+    memcpy((void*)(&Mock.MIC_RequestBalancingFeedbackRead_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_RequestBalancingFeedbackRead_CallbackBool &&
+      Mock.MIC_RequestBalancingFeedbackRead_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_RequestBalancingFeedbackRead_CallbackFunctionPointer(string, Mock.MIC_RequestBalancingFeedbackRead_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_RequestBalancingFeedbackRead,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_RequestBalancingFeedbackRead_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_RequestBalancingFeedbackRead_CallbackFunctionPointer(string, Mock.MIC_RequestBalancingFeedbackRead_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_RequestBalancingFeedbackRead(CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MIC_RequestBalancingFeedbackRead(CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MIC_RequestBalancingFeedbackRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestBalancingFeedbackRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool = (char)1;
+}
+
+void MIC_RequestBalancingFeedbackRead_CMockStopIgnore(void)
+{
+  if(Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool)
+    Mock.MIC_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestBalancingFeedbackRead_CallInstance);
+  Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+}
+
+void MIC_RequestBalancingFeedbackRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestBalancingFeedbackRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestBalancingFeedbackRead(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_RequestBalancingFeedbackRead_AddCallback(CMOCK_MIC_RequestBalancingFeedbackRead_CALLBACK Callback)
+{
+  Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  Mock.MIC_RequestBalancingFeedbackRead_CallbackBool = (char)1;
+  Mock.MIC_RequestBalancingFeedbackRead_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestBalancingFeedbackRead_Stub(CMOCK_MIC_RequestBalancingFeedbackRead_CALLBACK Callback)
+{
+  Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  Mock.MIC_RequestBalancingFeedbackRead_CallbackBool = (char)0;
+  Mock.MIC_RequestBalancingFeedbackRead_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestBalancingFeedbackRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestBalancingFeedbackRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestBalancingFeedbackRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestBalancingFeedbackRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestBalancingFeedbackRead(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_RequestBalancingFeedbackRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestBalancingFeedbackRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_RequestBalancingFeedbackRead_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MIC_RequestEepromRead(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_RequestEepromRead_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_RequestEepromRead);
+  cmock_call_instance = (CMOCK_MIC_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_RequestEepromRead_CallInstance);
+  Mock.MIC_RequestEepromRead_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestEepromRead_CallInstance);
+  if (Mock.MIC_RequestEepromRead_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_RequestEepromRead_FinalReturn;
+    memcpy((void*)(&Mock.MIC_RequestEepromRead_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_RequestEepromRead_CallbackBool &&
+      Mock.MIC_RequestEepromRead_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_RequestEepromRead_CallbackFunctionPointer(string, Mock.MIC_RequestEepromRead_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_RequestEepromRead,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_RequestEepromRead_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_RequestEepromRead_CallbackFunctionPointer(string, Mock.MIC_RequestEepromRead_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_RequestEepromRead(CMOCK_MIC_RequestEepromRead_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MIC_RequestEepromRead(CMOCK_MIC_RequestEepromRead_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MIC_RequestEepromRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestEepromRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestEepromRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestEepromRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestEepromRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestEepromRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_RequestEepromRead_IgnoreBool = (char)1;
+}
+
+void MIC_RequestEepromRead_CMockStopIgnore(void)
+{
+  if(Mock.MIC_RequestEepromRead_IgnoreBool)
+    Mock.MIC_RequestEepromRead_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestEepromRead_CallInstance);
+  Mock.MIC_RequestEepromRead_IgnoreBool = (char)0;
+}
+
+void MIC_RequestEepromRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestEepromRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestEepromRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestEepromRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestEepromRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestEepromRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestEepromRead(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_RequestEepromRead_AddCallback(CMOCK_MIC_RequestEepromRead_CALLBACK Callback)
+{
+  Mock.MIC_RequestEepromRead_IgnoreBool = (char)0;
+  Mock.MIC_RequestEepromRead_CallbackBool = (char)1;
+  Mock.MIC_RequestEepromRead_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestEepromRead_Stub(CMOCK_MIC_RequestEepromRead_CALLBACK Callback)
+{
+  Mock.MIC_RequestEepromRead_IgnoreBool = (char)0;
+  Mock.MIC_RequestEepromRead_CallbackBool = (char)0;
+  Mock.MIC_RequestEepromRead_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestEepromRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestEepromRead_CALL_INSTANCE));
+  CMOCK_MIC_RequestEepromRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestEepromRead_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestEepromRead_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestEepromRead_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestEepromRead(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_RequestEepromRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_RequestEepromRead_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestEepromRead_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_RequestEepromRead_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MIC_RequestEepromWrite(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_RequestEepromWrite);
+  cmock_call_instance = (CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_RequestEepromWrite_CallInstance);
+  Mock.MIC_RequestEepromWrite_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestEepromWrite_CallInstance);
+  if (Mock.MIC_RequestEepromWrite_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_RequestEepromWrite_FinalReturn;
+    memcpy((void*)(&Mock.MIC_RequestEepromWrite_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_RequestEepromWrite_CallbackBool &&
+      Mock.MIC_RequestEepromWrite_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_RequestEepromWrite_CallbackFunctionPointer(string, Mock.MIC_RequestEepromWrite_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_RequestEepromWrite,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_RequestEepromWrite_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_RequestEepromWrite_CallbackFunctionPointer(string, Mock.MIC_RequestEepromWrite_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_RequestEepromWrite(CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MIC_RequestEepromWrite(CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MIC_RequestEepromWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE));
+  CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestEepromWrite_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestEepromWrite_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestEepromWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_RequestEepromWrite_IgnoreBool = (char)1;
+}
+
+void MIC_RequestEepromWrite_CMockStopIgnore(void)
+{
+  if(Mock.MIC_RequestEepromWrite_IgnoreBool)
+    Mock.MIC_RequestEepromWrite_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestEepromWrite_CallInstance);
+  Mock.MIC_RequestEepromWrite_IgnoreBool = (char)0;
+}
+
+void MIC_RequestEepromWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE));
+  CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestEepromWrite_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestEepromWrite_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestEepromWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestEepromWrite(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_RequestEepromWrite_AddCallback(CMOCK_MIC_RequestEepromWrite_CALLBACK Callback)
+{
+  Mock.MIC_RequestEepromWrite_IgnoreBool = (char)0;
+  Mock.MIC_RequestEepromWrite_CallbackBool = (char)1;
+  Mock.MIC_RequestEepromWrite_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestEepromWrite_Stub(CMOCK_MIC_RequestEepromWrite_CALLBACK Callback)
+{
+  Mock.MIC_RequestEepromWrite_IgnoreBool = (char)0;
+  Mock.MIC_RequestEepromWrite_CallbackBool = (char)0;
+  Mock.MIC_RequestEepromWrite_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestEepromWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE));
+  CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestEepromWrite_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestEepromWrite_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestEepromWrite_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestEepromWrite(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_RequestEepromWrite_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestEepromWrite_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_RequestEepromWrite_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
+STD_RETURN_TYPE_e MIC_RequestOpenWireCheck(uint8_t string)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_RequestOpenWireCheck);
+  cmock_call_instance = (CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_RequestOpenWireCheck_CallInstance);
+  Mock.MIC_RequestOpenWireCheck_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestOpenWireCheck_CallInstance);
+  if (Mock.MIC_RequestOpenWireCheck_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_RequestOpenWireCheck_FinalReturn;
+    memcpy((void*)(&Mock.MIC_RequestOpenWireCheck_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_RequestOpenWireCheck_CallbackBool &&
+      Mock.MIC_RequestOpenWireCheck_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_RequestOpenWireCheck_CallbackFunctionPointer(string, Mock.MIC_RequestOpenWireCheck_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_string)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_RequestOpenWireCheck,CMockString_string);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_string, string, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_RequestOpenWireCheck_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_RequestOpenWireCheck_CallbackFunctionPointer(string, Mock.MIC_RequestOpenWireCheck_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_RequestOpenWireCheck(CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance, uint8_t string);
+void CMockExpectParameters_MIC_RequestOpenWireCheck(CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance, uint8_t string)
+{
+  cmock_call_instance->Expected_string = string;
+  cmock_call_instance->IgnoreArg_string = 0;
+}
+
+void MIC_RequestOpenWireCheck_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE));
+  CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestOpenWireCheck_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestOpenWireCheck_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestOpenWireCheck_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_RequestOpenWireCheck_IgnoreBool = (char)1;
+}
+
+void MIC_RequestOpenWireCheck_CMockStopIgnore(void)
+{
+  if(Mock.MIC_RequestOpenWireCheck_IgnoreBool)
+    Mock.MIC_RequestOpenWireCheck_CallInstance = CMock_Guts_MemNext(Mock.MIC_RequestOpenWireCheck_CallInstance);
+  Mock.MIC_RequestOpenWireCheck_IgnoreBool = (char)0;
+}
+
+void MIC_RequestOpenWireCheck_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE));
+  CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestOpenWireCheck_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestOpenWireCheck_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestOpenWireCheck_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestOpenWireCheck(cmock_call_instance, string);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_RequestOpenWireCheck_AddCallback(CMOCK_MIC_RequestOpenWireCheck_CALLBACK Callback)
+{
+  Mock.MIC_RequestOpenWireCheck_IgnoreBool = (char)0;
+  Mock.MIC_RequestOpenWireCheck_CallbackBool = (char)1;
+  Mock.MIC_RequestOpenWireCheck_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestOpenWireCheck_Stub(CMOCK_MIC_RequestOpenWireCheck_CALLBACK Callback)
+{
+  Mock.MIC_RequestOpenWireCheck_IgnoreBool = (char)0;
+  Mock.MIC_RequestOpenWireCheck_CallbackBool = (char)0;
+  Mock.MIC_RequestOpenWireCheck_CallbackFunctionPointer = Callback;
+}
+
+void MIC_RequestOpenWireCheck_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE));
+  CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_RequestOpenWireCheck_CallInstance = CMock_Guts_MemChain(Mock.MIC_RequestOpenWireCheck_CallInstance, cmock_guts_index);
+  Mock.MIC_RequestOpenWireCheck_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_RequestOpenWireCheck(cmock_call_instance, string);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_RequestOpenWireCheck_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_RequestOpenWireCheck_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_RequestOpenWireCheck_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_string = 1;
+}
+
@@ -0,0 +1,192 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKMIC_H
+#define _MOCKMIC_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "mic.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockmic_Init(void);
+void Mockmic_Destroy(void);
+void Mockmic_Verify(void);
+
+
+
+
+#define MIC_TriggerIc_IgnoreAndReturn(cmock_retval) MIC_TriggerIc_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_TriggerIc_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_TriggerIc_StopIgnore() MIC_TriggerIc_CMockStopIgnore()
+void MIC_TriggerIc_CMockStopIgnore(void);
+#define MIC_TriggerIc_ExpectAndReturn(cmock_retval) MIC_TriggerIc_CMockExpectAndReturn(__LINE__, cmock_retval)
+void MIC_TriggerIc_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_TriggerIc_CALLBACK)(int cmock_num_calls);
+void MIC_TriggerIc_AddCallback(CMOCK_MIC_TriggerIc_CALLBACK Callback);
+void MIC_TriggerIc_Stub(CMOCK_MIC_TriggerIc_CALLBACK Callback);
+#define MIC_TriggerIc_StubWithCallback MIC_TriggerIc_Stub
+#define MIC_TriggerIc_ExpectAndThrow(cmock_to_throw) MIC_TriggerIc_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MIC_TriggerIc_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MIC_Init_IgnoreAndReturn(cmock_retval) MIC_Init_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_Init_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_Init_StopIgnore() MIC_Init_CMockStopIgnore()
+void MIC_Init_CMockStopIgnore(void);
+#define MIC_Init_ExpectAndReturn(cmock_retval) MIC_Init_CMockExpectAndReturn(__LINE__, cmock_retval)
+void MIC_Init_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_Init_CALLBACK)(int cmock_num_calls);
+void MIC_Init_AddCallback(CMOCK_MIC_Init_CALLBACK Callback);
+void MIC_Init_Stub(CMOCK_MIC_Init_CALLBACK Callback);
+#define MIC_Init_StubWithCallback MIC_Init_Stub
+#define MIC_Init_ExpectAndThrow(cmock_to_throw) MIC_Init_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MIC_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MIC_StartMeasurement_IgnoreAndReturn(cmock_retval) MIC_StartMeasurement_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_StartMeasurement_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_StartMeasurement_StopIgnore() MIC_StartMeasurement_CMockStopIgnore()
+void MIC_StartMeasurement_CMockStopIgnore(void);
+#define MIC_StartMeasurement_ExpectAndReturn(cmock_retval) MIC_StartMeasurement_CMockExpectAndReturn(__LINE__, cmock_retval)
+void MIC_StartMeasurement_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_StartMeasurement_CALLBACK)(int cmock_num_calls);
+void MIC_StartMeasurement_AddCallback(CMOCK_MIC_StartMeasurement_CALLBACK Callback);
+void MIC_StartMeasurement_Stub(CMOCK_MIC_StartMeasurement_CALLBACK Callback);
+#define MIC_StartMeasurement_StubWithCallback MIC_StartMeasurement_Stub
+#define MIC_StartMeasurement_ExpectAndThrow(cmock_to_throw) MIC_StartMeasurement_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MIC_StartMeasurement_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MIC_IsFirstMeasurementCycleFinished_IgnoreAndReturn(cmock_retval) MIC_IsFirstMeasurementCycleFinished_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_IsFirstMeasurementCycleFinished_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define MIC_IsFirstMeasurementCycleFinished_StopIgnore() MIC_IsFirstMeasurementCycleFinished_CMockStopIgnore()
+void MIC_IsFirstMeasurementCycleFinished_CMockStopIgnore(void);
+#define MIC_IsFirstMeasurementCycleFinished_ExpectAndReturn(cmock_retval) MIC_IsFirstMeasurementCycleFinished_CMockExpectAndReturn(__LINE__, cmock_retval)
+void MIC_IsFirstMeasurementCycleFinished_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_MIC_IsFirstMeasurementCycleFinished_CALLBACK)(int cmock_num_calls);
+void MIC_IsFirstMeasurementCycleFinished_AddCallback(CMOCK_MIC_IsFirstMeasurementCycleFinished_CALLBACK Callback);
+void MIC_IsFirstMeasurementCycleFinished_Stub(CMOCK_MIC_IsFirstMeasurementCycleFinished_CALLBACK Callback);
+#define MIC_IsFirstMeasurementCycleFinished_StubWithCallback MIC_IsFirstMeasurementCycleFinished_Stub
+#define MIC_IsFirstMeasurementCycleFinished_ExpectAndThrow(cmock_to_throw) MIC_IsFirstMeasurementCycleFinished_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void MIC_IsFirstMeasurementCycleFinished_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define MIC_RequestIoWrite_IgnoreAndReturn(cmock_retval) MIC_RequestIoWrite_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_RequestIoWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_RequestIoWrite_StopIgnore() MIC_RequestIoWrite_CMockStopIgnore()
+void MIC_RequestIoWrite_CMockStopIgnore(void);
+#define MIC_RequestIoWrite_ExpectAndReturn(string, cmock_retval) MIC_RequestIoWrite_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MIC_RequestIoWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_RequestIoWrite_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MIC_RequestIoWrite_AddCallback(CMOCK_MIC_RequestIoWrite_CALLBACK Callback);
+void MIC_RequestIoWrite_Stub(CMOCK_MIC_RequestIoWrite_CALLBACK Callback);
+#define MIC_RequestIoWrite_StubWithCallback MIC_RequestIoWrite_Stub
+#define MIC_RequestIoWrite_ExpectAndThrow(string, cmock_to_throw) MIC_RequestIoWrite_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MIC_RequestIoWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MIC_RequestIoWrite_IgnoreArg_string() MIC_RequestIoWrite_CMockIgnoreArg_string(__LINE__)
+void MIC_RequestIoWrite_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MIC_RequestIoRead_IgnoreAndReturn(cmock_retval) MIC_RequestIoRead_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_RequestIoRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_RequestIoRead_StopIgnore() MIC_RequestIoRead_CMockStopIgnore()
+void MIC_RequestIoRead_CMockStopIgnore(void);
+#define MIC_RequestIoRead_ExpectAndReturn(string, cmock_retval) MIC_RequestIoRead_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MIC_RequestIoRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_RequestIoRead_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MIC_RequestIoRead_AddCallback(CMOCK_MIC_RequestIoRead_CALLBACK Callback);
+void MIC_RequestIoRead_Stub(CMOCK_MIC_RequestIoRead_CALLBACK Callback);
+#define MIC_RequestIoRead_StubWithCallback MIC_RequestIoRead_Stub
+#define MIC_RequestIoRead_ExpectAndThrow(string, cmock_to_throw) MIC_RequestIoRead_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MIC_RequestIoRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MIC_RequestIoRead_IgnoreArg_string() MIC_RequestIoRead_CMockIgnoreArg_string(__LINE__)
+void MIC_RequestIoRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MIC_RequestTemperatureRead_IgnoreAndReturn(cmock_retval) MIC_RequestTemperatureRead_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_RequestTemperatureRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_RequestTemperatureRead_StopIgnore() MIC_RequestTemperatureRead_CMockStopIgnore()
+void MIC_RequestTemperatureRead_CMockStopIgnore(void);
+#define MIC_RequestTemperatureRead_ExpectAndReturn(string, cmock_retval) MIC_RequestTemperatureRead_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MIC_RequestTemperatureRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_RequestTemperatureRead_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MIC_RequestTemperatureRead_AddCallback(CMOCK_MIC_RequestTemperatureRead_CALLBACK Callback);
+void MIC_RequestTemperatureRead_Stub(CMOCK_MIC_RequestTemperatureRead_CALLBACK Callback);
+#define MIC_RequestTemperatureRead_StubWithCallback MIC_RequestTemperatureRead_Stub
+#define MIC_RequestTemperatureRead_ExpectAndThrow(string, cmock_to_throw) MIC_RequestTemperatureRead_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MIC_RequestTemperatureRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MIC_RequestTemperatureRead_IgnoreArg_string() MIC_RequestTemperatureRead_CMockIgnoreArg_string(__LINE__)
+void MIC_RequestTemperatureRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MIC_RequestBalancingFeedbackRead_IgnoreAndReturn(cmock_retval) MIC_RequestBalancingFeedbackRead_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_RequestBalancingFeedbackRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_RequestBalancingFeedbackRead_StopIgnore() MIC_RequestBalancingFeedbackRead_CMockStopIgnore()
+void MIC_RequestBalancingFeedbackRead_CMockStopIgnore(void);
+#define MIC_RequestBalancingFeedbackRead_ExpectAndReturn(string, cmock_retval) MIC_RequestBalancingFeedbackRead_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MIC_RequestBalancingFeedbackRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_RequestBalancingFeedbackRead_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MIC_RequestBalancingFeedbackRead_AddCallback(CMOCK_MIC_RequestBalancingFeedbackRead_CALLBACK Callback);
+void MIC_RequestBalancingFeedbackRead_Stub(CMOCK_MIC_RequestBalancingFeedbackRead_CALLBACK Callback);
+#define MIC_RequestBalancingFeedbackRead_StubWithCallback MIC_RequestBalancingFeedbackRead_Stub
+#define MIC_RequestBalancingFeedbackRead_ExpectAndThrow(string, cmock_to_throw) MIC_RequestBalancingFeedbackRead_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MIC_RequestBalancingFeedbackRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MIC_RequestBalancingFeedbackRead_IgnoreArg_string() MIC_RequestBalancingFeedbackRead_CMockIgnoreArg_string(__LINE__)
+void MIC_RequestBalancingFeedbackRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MIC_RequestEepromRead_IgnoreAndReturn(cmock_retval) MIC_RequestEepromRead_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_RequestEepromRead_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_RequestEepromRead_StopIgnore() MIC_RequestEepromRead_CMockStopIgnore()
+void MIC_RequestEepromRead_CMockStopIgnore(void);
+#define MIC_RequestEepromRead_ExpectAndReturn(string, cmock_retval) MIC_RequestEepromRead_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MIC_RequestEepromRead_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_RequestEepromRead_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MIC_RequestEepromRead_AddCallback(CMOCK_MIC_RequestEepromRead_CALLBACK Callback);
+void MIC_RequestEepromRead_Stub(CMOCK_MIC_RequestEepromRead_CALLBACK Callback);
+#define MIC_RequestEepromRead_StubWithCallback MIC_RequestEepromRead_Stub
+#define MIC_RequestEepromRead_ExpectAndThrow(string, cmock_to_throw) MIC_RequestEepromRead_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MIC_RequestEepromRead_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MIC_RequestEepromRead_IgnoreArg_string() MIC_RequestEepromRead_CMockIgnoreArg_string(__LINE__)
+void MIC_RequestEepromRead_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MIC_RequestEepromWrite_IgnoreAndReturn(cmock_retval) MIC_RequestEepromWrite_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_RequestEepromWrite_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_RequestEepromWrite_StopIgnore() MIC_RequestEepromWrite_CMockStopIgnore()
+void MIC_RequestEepromWrite_CMockStopIgnore(void);
+#define MIC_RequestEepromWrite_ExpectAndReturn(string, cmock_retval) MIC_RequestEepromWrite_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MIC_RequestEepromWrite_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_RequestEepromWrite_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MIC_RequestEepromWrite_AddCallback(CMOCK_MIC_RequestEepromWrite_CALLBACK Callback);
+void MIC_RequestEepromWrite_Stub(CMOCK_MIC_RequestEepromWrite_CALLBACK Callback);
+#define MIC_RequestEepromWrite_StubWithCallback MIC_RequestEepromWrite_Stub
+#define MIC_RequestEepromWrite_ExpectAndThrow(string, cmock_to_throw) MIC_RequestEepromWrite_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MIC_RequestEepromWrite_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MIC_RequestEepromWrite_IgnoreArg_string() MIC_RequestEepromWrite_CMockIgnoreArg_string(__LINE__)
+void MIC_RequestEepromWrite_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+#define MIC_RequestOpenWireCheck_IgnoreAndReturn(cmock_retval) MIC_RequestOpenWireCheck_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_RequestOpenWireCheck_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_RequestOpenWireCheck_StopIgnore() MIC_RequestOpenWireCheck_CMockStopIgnore()
+void MIC_RequestOpenWireCheck_CMockStopIgnore(void);
+#define MIC_RequestOpenWireCheck_ExpectAndReturn(string, cmock_retval) MIC_RequestOpenWireCheck_CMockExpectAndReturn(__LINE__, string, cmock_retval)
+void MIC_RequestOpenWireCheck_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t string, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_RequestOpenWireCheck_CALLBACK)(uint8_t string, int cmock_num_calls);
+void MIC_RequestOpenWireCheck_AddCallback(CMOCK_MIC_RequestOpenWireCheck_CALLBACK Callback);
+void MIC_RequestOpenWireCheck_Stub(CMOCK_MIC_RequestOpenWireCheck_CALLBACK Callback);
+#define MIC_RequestOpenWireCheck_StubWithCallback MIC_RequestOpenWireCheck_Stub
+#define MIC_RequestOpenWireCheck_ExpectAndThrow(string, cmock_to_throw) MIC_RequestOpenWireCheck_CMockExpectAndThrow(__LINE__, string, cmock_to_throw)
+void MIC_RequestOpenWireCheck_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t string, CEXCEPTION_T cmock_to_throw);
+#define MIC_RequestOpenWireCheck_IgnoreArg_string() MIC_RequestOpenWireCheck_CMockIgnoreArg_string(__LINE__)
+void MIC_RequestOpenWireCheck_CMockIgnoreArg_string(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,371 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockmic_plausibility.h"
+
+static const char* CMockString_MIC_PlausibilityCheckTempMinMax = "MIC_PlausibilityCheckTempMinMax";
+static const char* CMockString_MIC_PlausibilityCheckVoltageMeasurementRange = "MIC_PlausibilityCheckVoltageMeasurementRange";
+static const char* CMockString_celltemperature_ddegC = "celltemperature_ddegC";
+static const char* CMockString_cellvoltage_mV = "cellvoltage_mV";
+static const char* CMockString_plausibleValues = "plausibleValues";
+
+typedef struct _CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  int16_t Expected_cellvoltage_mV;
+  MIC_PLAUSIBILITY_VALUES_s Expected_plausibleValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_cellvoltage_mV;
+  char IgnoreArg_plausibleValues;
+
+} CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE;
+
+typedef struct _CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  int16_t Expected_celltemperature_ddegC;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_celltemperature_ddegC;
+
+} CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE;
+
+static struct Mockmic_plausibilityInstance
+{
+  char MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_PlausibilityCheckVoltageMeasurementRange_FinalReturn;
+  char MIC_PlausibilityCheckVoltageMeasurementRange_CallbackBool;
+  CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALLBACK MIC_PlausibilityCheckVoltageMeasurementRange_CallbackFunctionPointer;
+  int MIC_PlausibilityCheckVoltageMeasurementRange_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance;
+  char MIC_PlausibilityCheckTempMinMax_IgnoreBool;
+  STD_RETURN_TYPE_e MIC_PlausibilityCheckTempMinMax_FinalReturn;
+  char MIC_PlausibilityCheckTempMinMax_CallbackBool;
+  CMOCK_MIC_PlausibilityCheckTempMinMax_CALLBACK MIC_PlausibilityCheckTempMinMax_CallbackFunctionPointer;
+  int MIC_PlausibilityCheckTempMinMax_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE MIC_PlausibilityCheckTempMinMax_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockmic_plausibility_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance;
+  if (Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_PlausibilityCheckVoltageMeasurementRange);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.MIC_PlausibilityCheckTempMinMax_CallInstance;
+  if (Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_MIC_PlausibilityCheckTempMinMax);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.MIC_PlausibilityCheckTempMinMax_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockmic_plausibility_Init(void)
+{
+  Mockmic_plausibility_Destroy();
+}
+
+void Mockmic_plausibility_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+STD_RETURN_TYPE_e MIC_PlausibilityCheckVoltageMeasurementRange(const int16_t cellvoltage_mV, const MIC_PLAUSIBILITY_VALUES_s plausibleValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_PlausibilityCheckVoltageMeasurementRange);
+  cmock_call_instance = (CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance);
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance = CMock_Guts_MemNext(Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance);
+  if (Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_PlausibilityCheckVoltageMeasurementRange_FinalReturn;
+    memcpy((void*)(&Mock.MIC_PlausibilityCheckVoltageMeasurementRange_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackBool &&
+      Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackFunctionPointer(cellvoltage_mV, plausibleValues, Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cellvoltage_mV)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_PlausibilityCheckVoltageMeasurementRange,CMockString_cellvoltage_mV);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_cellvoltage_mV, cellvoltage_mV, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_plausibleValues)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_PlausibilityCheckVoltageMeasurementRange,CMockString_plausibleValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_plausibleValues), (void*)(&plausibleValues), sizeof(MIC_PLAUSIBILITY_VALUES_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackFunctionPointer(cellvoltage_mV, plausibleValues, Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_PlausibilityCheckVoltageMeasurementRange(CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE* cmock_call_instance, const int16_t cellvoltage_mV, const MIC_PLAUSIBILITY_VALUES_s plausibleValues);
+void CMockExpectParameters_MIC_PlausibilityCheckVoltageMeasurementRange(CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE* cmock_call_instance, const int16_t cellvoltage_mV, const MIC_PLAUSIBILITY_VALUES_s plausibleValues)
+{
+  cmock_call_instance->Expected_cellvoltage_mV = cellvoltage_mV;
+  cmock_call_instance->IgnoreArg_cellvoltage_mV = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_plausibleValues), (void*)(&plausibleValues),
+         sizeof(MIC_PLAUSIBILITY_VALUES_s[sizeof(plausibleValues) == sizeof(MIC_PLAUSIBILITY_VALUES_s) ? 1 : -1])); /* add MIC_PLAUSIBILITY_VALUES_s to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_plausibleValues = 0;
+}
+
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE));
+  CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance = CMock_Guts_MemChain(Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance, cmock_guts_index);
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool = (char)1;
+}
+
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockStopIgnore(void)
+{
+  if(Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool)
+    Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance = CMock_Guts_MemNext(Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance);
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool = (char)0;
+}
+
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const int16_t cellvoltage_mV, const MIC_PLAUSIBILITY_VALUES_s plausibleValues, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE));
+  CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance = CMock_Guts_MemChain(Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance, cmock_guts_index);
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_PlausibilityCheckVoltageMeasurementRange(cmock_call_instance, cellvoltage_mV, plausibleValues);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_PlausibilityCheckVoltageMeasurementRange_AddCallback(CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALLBACK Callback)
+{
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool = (char)0;
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackBool = (char)1;
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackFunctionPointer = Callback;
+}
+
+void MIC_PlausibilityCheckVoltageMeasurementRange_Stub(CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALLBACK Callback)
+{
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool = (char)0;
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackBool = (char)0;
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallbackFunctionPointer = Callback;
+}
+
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const int16_t cellvoltage_mV, const MIC_PLAUSIBILITY_VALUES_s plausibleValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE));
+  CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance = CMock_Guts_MemChain(Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance, cmock_guts_index);
+  Mock.MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_PlausibilityCheckVoltageMeasurementRange(cmock_call_instance, cellvoltage_mV, plausibleValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockIgnoreArg_cellvoltage_mV(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cellvoltage_mV = 1;
+}
+
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockIgnoreArg_plausibleValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_PlausibilityCheckVoltageMeasurementRange_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_plausibleValues = 1;
+}
+
+STD_RETURN_TYPE_e MIC_PlausibilityCheckTempMinMax(const int16_t celltemperature_ddegC)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_MIC_PlausibilityCheckTempMinMax);
+  cmock_call_instance = (CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.MIC_PlausibilityCheckTempMinMax_CallInstance);
+  Mock.MIC_PlausibilityCheckTempMinMax_CallInstance = CMock_Guts_MemNext(Mock.MIC_PlausibilityCheckTempMinMax_CallInstance);
+  if (Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.MIC_PlausibilityCheckTempMinMax_FinalReturn;
+    memcpy((void*)(&Mock.MIC_PlausibilityCheckTempMinMax_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.MIC_PlausibilityCheckTempMinMax_CallbackBool &&
+      Mock.MIC_PlausibilityCheckTempMinMax_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.MIC_PlausibilityCheckTempMinMax_CallbackFunctionPointer(celltemperature_ddegC, Mock.MIC_PlausibilityCheckTempMinMax_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_celltemperature_ddegC)
+  {
+    UNITY_SET_DETAILS(CMockString_MIC_PlausibilityCheckTempMinMax,CMockString_celltemperature_ddegC);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_celltemperature_ddegC, celltemperature_ddegC, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.MIC_PlausibilityCheckTempMinMax_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.MIC_PlausibilityCheckTempMinMax_CallbackFunctionPointer(celltemperature_ddegC, Mock.MIC_PlausibilityCheckTempMinMax_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_MIC_PlausibilityCheckTempMinMax(CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE* cmock_call_instance, const int16_t celltemperature_ddegC);
+void CMockExpectParameters_MIC_PlausibilityCheckTempMinMax(CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE* cmock_call_instance, const int16_t celltemperature_ddegC)
+{
+  cmock_call_instance->Expected_celltemperature_ddegC = celltemperature_ddegC;
+  cmock_call_instance->IgnoreArg_celltemperature_ddegC = 0;
+}
+
+void MIC_PlausibilityCheckTempMinMax_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE));
+  CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_PlausibilityCheckTempMinMax_CallInstance = CMock_Guts_MemChain(Mock.MIC_PlausibilityCheckTempMinMax_CallInstance, cmock_guts_index);
+  Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool = (char)1;
+}
+
+void MIC_PlausibilityCheckTempMinMax_CMockStopIgnore(void)
+{
+  if(Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool)
+    Mock.MIC_PlausibilityCheckTempMinMax_CallInstance = CMock_Guts_MemNext(Mock.MIC_PlausibilityCheckTempMinMax_CallInstance);
+  Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool = (char)0;
+}
+
+void MIC_PlausibilityCheckTempMinMax_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const int16_t celltemperature_ddegC, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE));
+  CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_PlausibilityCheckTempMinMax_CallInstance = CMock_Guts_MemChain(Mock.MIC_PlausibilityCheckTempMinMax_CallInstance, cmock_guts_index);
+  Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_PlausibilityCheckTempMinMax(cmock_call_instance, celltemperature_ddegC);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void MIC_PlausibilityCheckTempMinMax_AddCallback(CMOCK_MIC_PlausibilityCheckTempMinMax_CALLBACK Callback)
+{
+  Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool = (char)0;
+  Mock.MIC_PlausibilityCheckTempMinMax_CallbackBool = (char)1;
+  Mock.MIC_PlausibilityCheckTempMinMax_CallbackFunctionPointer = Callback;
+}
+
+void MIC_PlausibilityCheckTempMinMax_Stub(CMOCK_MIC_PlausibilityCheckTempMinMax_CALLBACK Callback)
+{
+  Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool = (char)0;
+  Mock.MIC_PlausibilityCheckTempMinMax_CallbackBool = (char)0;
+  Mock.MIC_PlausibilityCheckTempMinMax_CallbackFunctionPointer = Callback;
+}
+
+void MIC_PlausibilityCheckTempMinMax_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const int16_t celltemperature_ddegC, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE));
+  CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.MIC_PlausibilityCheckTempMinMax_CallInstance = CMock_Guts_MemChain(Mock.MIC_PlausibilityCheckTempMinMax_CallInstance, cmock_guts_index);
+  Mock.MIC_PlausibilityCheckTempMinMax_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_MIC_PlausibilityCheckTempMinMax(cmock_call_instance, celltemperature_ddegC);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void MIC_PlausibilityCheckTempMinMax_CMockIgnoreArg_celltemperature_ddegC(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE* cmock_call_instance = (CMOCK_MIC_PlausibilityCheckTempMinMax_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.MIC_PlausibilityCheckTempMinMax_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_celltemperature_ddegC = 1;
+}
+
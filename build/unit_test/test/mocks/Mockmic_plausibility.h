@@ -0,0 +1,76 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKMIC_PLAUSIBILITY_H
+#define _MOCKMIC_PLAUSIBILITY_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "mic_plausibility.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockmic_plausibility_Init(void);
+void Mockmic_plausibility_Destroy(void);
+void Mockmic_plausibility_Verify(void);
+
+
+
+
+#define MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreAndReturn(cmock_retval) MIC_PlausibilityCheckVoltageMeasurementRange_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_PlausibilityCheckVoltageMeasurementRange_StopIgnore() MIC_PlausibilityCheckVoltageMeasurementRange_CMockStopIgnore()
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockStopIgnore(void);
+#define MIC_PlausibilityCheckVoltageMeasurementRange_ExpectAndReturn(cellvoltage_mV, plausibleValues, cmock_retval) MIC_PlausibilityCheckVoltageMeasurementRange_CMockExpectAndReturn(__LINE__, cellvoltage_mV, plausibleValues, cmock_retval)
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const int16_t cellvoltage_mV, const MIC_PLAUSIBILITY_VALUES_s plausibleValues, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALLBACK)(const int16_t cellvoltage_mV, const MIC_PLAUSIBILITY_VALUES_s plausibleValues, int cmock_num_calls);
+void MIC_PlausibilityCheckVoltageMeasurementRange_AddCallback(CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALLBACK Callback);
+void MIC_PlausibilityCheckVoltageMeasurementRange_Stub(CMOCK_MIC_PlausibilityCheckVoltageMeasurementRange_CALLBACK Callback);
+#define MIC_PlausibilityCheckVoltageMeasurementRange_StubWithCallback MIC_PlausibilityCheckVoltageMeasurementRange_Stub
+#define MIC_PlausibilityCheckVoltageMeasurementRange_ExpectAndThrow(cellvoltage_mV, plausibleValues, cmock_to_throw) MIC_PlausibilityCheckVoltageMeasurementRange_CMockExpectAndThrow(__LINE__, cellvoltage_mV, plausibleValues, cmock_to_throw)
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const int16_t cellvoltage_mV, const MIC_PLAUSIBILITY_VALUES_s plausibleValues, CEXCEPTION_T cmock_to_throw);
+#define MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreArg_cellvoltage_mV() MIC_PlausibilityCheckVoltageMeasurementRange_CMockIgnoreArg_cellvoltage_mV(__LINE__)
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockIgnoreArg_cellvoltage_mV(UNITY_LINE_TYPE cmock_line);
+#define MIC_PlausibilityCheckVoltageMeasurementRange_IgnoreArg_plausibleValues() MIC_PlausibilityCheckVoltageMeasurementRange_CMockIgnoreArg_plausibleValues(__LINE__)
+void MIC_PlausibilityCheckVoltageMeasurementRange_CMockIgnoreArg_plausibleValues(UNITY_LINE_TYPE cmock_line);
+#define MIC_PlausibilityCheckTempMinMax_IgnoreAndReturn(cmock_retval) MIC_PlausibilityCheckTempMinMax_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void MIC_PlausibilityCheckTempMinMax_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define MIC_PlausibilityCheckTempMinMax_StopIgnore() MIC_PlausibilityCheckTempMinMax_CMockStopIgnore()
+void MIC_PlausibilityCheckTempMinMax_CMockStopIgnore(void);
+#define MIC_PlausibilityCheckTempMinMax_ExpectAndReturn(celltemperature_ddegC, cmock_retval) MIC_PlausibilityCheckTempMinMax_CMockExpectAndReturn(__LINE__, celltemperature_ddegC, cmock_retval)
+void MIC_PlausibilityCheckTempMinMax_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const int16_t celltemperature_ddegC, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_MIC_PlausibilityCheckTempMinMax_CALLBACK)(const int16_t celltemperature_ddegC, int cmock_num_calls);
+void MIC_PlausibilityCheckTempMinMax_AddCallback(CMOCK_MIC_PlausibilityCheckTempMinMax_CALLBACK Callback);
+void MIC_PlausibilityCheckTempMinMax_Stub(CMOCK_MIC_PlausibilityCheckTempMinMax_CALLBACK Callback);
+#define MIC_PlausibilityCheckTempMinMax_StubWithCallback MIC_PlausibilityCheckTempMinMax_Stub
+#define MIC_PlausibilityCheckTempMinMax_ExpectAndThrow(celltemperature_ddegC, cmock_to_throw) MIC_PlausibilityCheckTempMinMax_CMockExpectAndThrow(__LINE__, celltemperature_ddegC, cmock_to_throw)
+void MIC_PlausibilityCheckTempMinMax_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const int16_t celltemperature_ddegC, CEXCEPTION_T cmock_to_throw);
+#define MIC_PlausibilityCheckTempMinMax_IgnoreArg_celltemperature_ddegC() MIC_PlausibilityCheckTempMinMax_CMockIgnoreArg_celltemperature_ddegC(__LINE__)
+void MIC_PlausibilityCheckTempMinMax_CMockIgnoreArg_celltemperature_ddegC(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
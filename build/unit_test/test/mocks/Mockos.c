@@ -0,0 +1,1743 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockos.h"
+
+static const char* CMockString_OS_DelayTask = "OS_DelayTask";
+static const char* CMockString_OS_DelayTaskUntil = "OS_DelayTaskUntil";
+static const char* CMockString_OS_EnterTaskCritical = "OS_EnterTaskCritical";
+static const char* CMockString_OS_ExitTaskCritical = "OS_ExitTaskCritical";
+static const char* CMockString_OS_GetTickCount = "OS_GetTickCount";
+static const char* CMockString_OS_InitializeTasks = "OS_InitializeTasks";
+static const char* CMockString_OS_StartScheduler = "OS_StartScheduler";
+static const char* CMockString_OS_SystemTickHandler = "OS_SystemTickHandler";
+static const char* CMockString_OS_TriggerTimer = "OS_TriggerTimer";
+static const char* CMockString_delay_ms = "delay_ms";
+static const char* CMockString_milliseconds = "milliseconds";
+static const char* CMockString_pPreviousWakeTime = "pPreviousWakeTime";
+static const char* CMockString_pcTaskName = "pcTaskName";
+static const char* CMockString_ppxIdleTaskStackBuffer = "ppxIdleTaskStackBuffer";
+static const char* CMockString_ppxIdleTaskTCBBuffer = "ppxIdleTaskTCBBuffer";
+static const char* CMockString_pulIdleTaskStackSize = "pulIdleTaskStackSize";
+static const char* CMockString_timer = "timer";
+static const char* CMockString_vApplicationGetIdleTaskMemory = "vApplicationGetIdleTaskMemory";
+static const char* CMockString_vApplicationIdleHook = "vApplicationIdleHook";
+static const char* CMockString_vApplicationStackOverflowHook = "vApplicationStackOverflowHook";
+static const char* CMockString_xTask = "xTask";
+
+typedef struct _CMOCK_OS_StartScheduler_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_OS_StartScheduler_CALL_INSTANCE;
+
+typedef struct _CMOCK_OS_InitializeTasks_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_OS_InitializeTasks_CALL_INSTANCE;
+
+typedef struct _CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  StaticTask_t** Expected_ppxIdleTaskTCBBuffer;
+  StackType_t** Expected_ppxIdleTaskStackBuffer;
+  uint32_t* Expected_pulIdleTaskStackSize;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_ppxIdleTaskTCBBuffer_Used;
+  StaticTask_t** ReturnThruPtr_ppxIdleTaskTCBBuffer_Val;
+  size_t ReturnThruPtr_ppxIdleTaskTCBBuffer_Size;
+  char ReturnThruPtr_ppxIdleTaskStackBuffer_Used;
+  StackType_t** ReturnThruPtr_ppxIdleTaskStackBuffer_Val;
+  size_t ReturnThruPtr_ppxIdleTaskStackBuffer_Size;
+  char ReturnThruPtr_pulIdleTaskStackSize_Used;
+  uint32_t* ReturnThruPtr_pulIdleTaskStackSize_Val;
+  size_t ReturnThruPtr_pulIdleTaskStackSize_Size;
+  char IgnoreArg_ppxIdleTaskTCBBuffer;
+  char IgnoreArg_ppxIdleTaskStackBuffer;
+  char IgnoreArg_pulIdleTaskStackSize;
+
+} CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE;
+
+typedef struct _CMOCK_vApplicationIdleHook_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_vApplicationIdleHook_CALL_INSTANCE;
+
+typedef struct _CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  TaskHandle_t Expected_xTask;
+  signed char* Expected_pcTaskName;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pcTaskName_Used;
+  signed char* ReturnThruPtr_pcTaskName_Val;
+  size_t ReturnThruPtr_pcTaskName_Size;
+  char IgnoreArg_xTask;
+  char IgnoreArg_pcTaskName;
+
+} CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE;
+
+typedef struct _CMOCK_OS_EnterTaskCritical_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_OS_EnterTaskCritical_CALL_INSTANCE;
+
+typedef struct _CMOCK_OS_ExitTaskCritical_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_OS_ExitTaskCritical_CALL_INSTANCE;
+
+typedef struct _CMOCK_OS_TriggerTimer_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  volatile OS_TIMER_s* Expected_timer;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_timer_Used;
+  volatile OS_TIMER_s* ReturnThruPtr_timer_Val;
+  size_t ReturnThruPtr_timer_Size;
+  char IgnoreArg_timer;
+
+} CMOCK_OS_TriggerTimer_CALL_INSTANCE;
+
+typedef struct _CMOCK_OS_GetTickCount_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  uint32_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_OS_GetTickCount_CALL_INSTANCE;
+
+typedef struct _CMOCK_OS_DelayTask_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint32_t Expected_delay_ms;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_delay_ms;
+
+} CMOCK_OS_DelayTask_CALL_INSTANCE;
+
+typedef struct _CMOCK_OS_DelayTaskUntil_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint32_t* Expected_pPreviousWakeTime;
+  uint32_t Expected_milliseconds;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pPreviousWakeTime_Used;
+  uint32_t* ReturnThruPtr_pPreviousWakeTime_Val;
+  size_t ReturnThruPtr_pPreviousWakeTime_Size;
+  char IgnoreArg_pPreviousWakeTime;
+  char IgnoreArg_milliseconds;
+
+} CMOCK_OS_DelayTaskUntil_CALL_INSTANCE;
+
+typedef struct _CMOCK_OS_SystemTickHandler_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_OS_SystemTickHandler_CALL_INSTANCE;
+
+static struct MockosInstance
+{
+  char OS_StartScheduler_IgnoreBool;
+  char OS_StartScheduler_CallbackBool;
+  CMOCK_OS_StartScheduler_CALLBACK OS_StartScheduler_CallbackFunctionPointer;
+  int OS_StartScheduler_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE OS_StartScheduler_CallInstance;
+  char OS_InitializeTasks_IgnoreBool;
+  char OS_InitializeTasks_CallbackBool;
+  CMOCK_OS_InitializeTasks_CALLBACK OS_InitializeTasks_CallbackFunctionPointer;
+  int OS_InitializeTasks_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE OS_InitializeTasks_CallInstance;
+  char vApplicationGetIdleTaskMemory_IgnoreBool;
+  char vApplicationGetIdleTaskMemory_CallbackBool;
+  CMOCK_vApplicationGetIdleTaskMemory_CALLBACK vApplicationGetIdleTaskMemory_CallbackFunctionPointer;
+  int vApplicationGetIdleTaskMemory_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE vApplicationGetIdleTaskMemory_CallInstance;
+  char vApplicationIdleHook_IgnoreBool;
+  char vApplicationIdleHook_CallbackBool;
+  CMOCK_vApplicationIdleHook_CALLBACK vApplicationIdleHook_CallbackFunctionPointer;
+  int vApplicationIdleHook_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE vApplicationIdleHook_CallInstance;
+  char vApplicationStackOverflowHook_IgnoreBool;
+  char vApplicationStackOverflowHook_CallbackBool;
+  CMOCK_vApplicationStackOverflowHook_CALLBACK vApplicationStackOverflowHook_CallbackFunctionPointer;
+  int vApplicationStackOverflowHook_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE vApplicationStackOverflowHook_CallInstance;
+  char OS_EnterTaskCritical_IgnoreBool;
+  char OS_EnterTaskCritical_CallbackBool;
+  CMOCK_OS_EnterTaskCritical_CALLBACK OS_EnterTaskCritical_CallbackFunctionPointer;
+  int OS_EnterTaskCritical_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE OS_EnterTaskCritical_CallInstance;
+  char OS_ExitTaskCritical_IgnoreBool;
+  char OS_ExitTaskCritical_CallbackBool;
+  CMOCK_OS_ExitTaskCritical_CALLBACK OS_ExitTaskCritical_CallbackFunctionPointer;
+  int OS_ExitTaskCritical_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE OS_ExitTaskCritical_CallInstance;
+  char OS_TriggerTimer_IgnoreBool;
+  char OS_TriggerTimer_CallbackBool;
+  CMOCK_OS_TriggerTimer_CALLBACK OS_TriggerTimer_CallbackFunctionPointer;
+  int OS_TriggerTimer_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE OS_TriggerTimer_CallInstance;
+  char OS_GetTickCount_IgnoreBool;
+  uint32_t OS_GetTickCount_FinalReturn;
+  char OS_GetTickCount_CallbackBool;
+  CMOCK_OS_GetTickCount_CALLBACK OS_GetTickCount_CallbackFunctionPointer;
+  int OS_GetTickCount_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE OS_GetTickCount_CallInstance;
+  char OS_DelayTask_IgnoreBool;
+  char OS_DelayTask_CallbackBool;
+  CMOCK_OS_DelayTask_CALLBACK OS_DelayTask_CallbackFunctionPointer;
+  int OS_DelayTask_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE OS_DelayTask_CallInstance;
+  char OS_DelayTaskUntil_IgnoreBool;
+  char OS_DelayTaskUntil_CallbackBool;
+  CMOCK_OS_DelayTaskUntil_CALLBACK OS_DelayTaskUntil_CallbackFunctionPointer;
+  int OS_DelayTaskUntil_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE OS_DelayTaskUntil_CallInstance;
+  char OS_SystemTickHandler_IgnoreBool;
+  char OS_SystemTickHandler_CallbackBool;
+  CMOCK_OS_SystemTickHandler_CALLBACK OS_SystemTickHandler_CallbackFunctionPointer;
+  int OS_SystemTickHandler_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE OS_SystemTickHandler_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockos_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.OS_StartScheduler_CallInstance;
+  if (Mock.OS_StartScheduler_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_OS_StartScheduler);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.OS_StartScheduler_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.OS_InitializeTasks_CallInstance;
+  if (Mock.OS_InitializeTasks_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_OS_InitializeTasks);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.OS_InitializeTasks_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.vApplicationGetIdleTaskMemory_CallInstance;
+  if (Mock.vApplicationGetIdleTaskMemory_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_vApplicationGetIdleTaskMemory);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.vApplicationGetIdleTaskMemory_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.vApplicationIdleHook_CallInstance;
+  if (Mock.vApplicationIdleHook_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_vApplicationIdleHook);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.vApplicationIdleHook_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.vApplicationStackOverflowHook_CallInstance;
+  if (Mock.vApplicationStackOverflowHook_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_vApplicationStackOverflowHook);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.vApplicationStackOverflowHook_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.OS_EnterTaskCritical_CallInstance;
+  if (Mock.OS_EnterTaskCritical_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_OS_EnterTaskCritical);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.OS_EnterTaskCritical_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.OS_ExitTaskCritical_CallInstance;
+  if (Mock.OS_ExitTaskCritical_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_OS_ExitTaskCritical);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.OS_ExitTaskCritical_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.OS_TriggerTimer_CallInstance;
+  if (Mock.OS_TriggerTimer_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_OS_TriggerTimer);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.OS_TriggerTimer_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.OS_GetTickCount_CallInstance;
+  if (Mock.OS_GetTickCount_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_OS_GetTickCount);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.OS_GetTickCount_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.OS_DelayTask_CallInstance;
+  if (Mock.OS_DelayTask_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_OS_DelayTask);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.OS_DelayTask_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.OS_DelayTaskUntil_CallInstance;
+  if (Mock.OS_DelayTaskUntil_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_OS_DelayTaskUntil);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.OS_DelayTaskUntil_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.OS_SystemTickHandler_CallInstance;
+  if (Mock.OS_SystemTickHandler_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_OS_SystemTickHandler);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.OS_SystemTickHandler_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockos_Init(void)
+{
+  Mockos_Destroy();
+}
+
+void Mockos_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void OS_StartScheduler(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_OS_StartScheduler_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_OS_StartScheduler);
+  cmock_call_instance = (CMOCK_OS_StartScheduler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.OS_StartScheduler_CallInstance);
+  Mock.OS_StartScheduler_CallInstance = CMock_Guts_MemNext(Mock.OS_StartScheduler_CallInstance);
+  if (Mock.OS_StartScheduler_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.OS_StartScheduler_CallbackBool &&
+      Mock.OS_StartScheduler_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_StartScheduler_CallbackFunctionPointer(Mock.OS_StartScheduler_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.OS_StartScheduler_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_StartScheduler_CallbackFunctionPointer(Mock.OS_StartScheduler_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void OS_StartScheduler_CMockIgnore(void)
+{
+  Mock.OS_StartScheduler_IgnoreBool = (char)1;
+}
+
+void OS_StartScheduler_CMockStopIgnore(void)
+{
+  Mock.OS_StartScheduler_IgnoreBool = (char)0;
+}
+
+void OS_StartScheduler_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_StartScheduler_CALL_INSTANCE));
+  CMOCK_OS_StartScheduler_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_StartScheduler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_StartScheduler_CallInstance = CMock_Guts_MemChain(Mock.OS_StartScheduler_CallInstance, cmock_guts_index);
+  Mock.OS_StartScheduler_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void OS_StartScheduler_AddCallback(CMOCK_OS_StartScheduler_CALLBACK Callback)
+{
+  Mock.OS_StartScheduler_IgnoreBool = (char)0;
+  Mock.OS_StartScheduler_CallbackBool = (char)1;
+  Mock.OS_StartScheduler_CallbackFunctionPointer = Callback;
+}
+
+void OS_StartScheduler_Stub(CMOCK_OS_StartScheduler_CALLBACK Callback)
+{
+  Mock.OS_StartScheduler_IgnoreBool = (char)0;
+  Mock.OS_StartScheduler_CallbackBool = (char)0;
+  Mock.OS_StartScheduler_CallbackFunctionPointer = Callback;
+}
+
+void OS_StartScheduler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_StartScheduler_CALL_INSTANCE));
+  CMOCK_OS_StartScheduler_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_StartScheduler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_StartScheduler_CallInstance = CMock_Guts_MemChain(Mock.OS_StartScheduler_CallInstance, cmock_guts_index);
+  Mock.OS_StartScheduler_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void OS_InitializeTasks(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_OS_InitializeTasks_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_OS_InitializeTasks);
+  cmock_call_instance = (CMOCK_OS_InitializeTasks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.OS_InitializeTasks_CallInstance);
+  Mock.OS_InitializeTasks_CallInstance = CMock_Guts_MemNext(Mock.OS_InitializeTasks_CallInstance);
+  if (Mock.OS_InitializeTasks_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.OS_InitializeTasks_CallbackBool &&
+      Mock.OS_InitializeTasks_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_InitializeTasks_CallbackFunctionPointer(Mock.OS_InitializeTasks_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.OS_InitializeTasks_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_InitializeTasks_CallbackFunctionPointer(Mock.OS_InitializeTasks_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void OS_InitializeTasks_CMockIgnore(void)
+{
+  Mock.OS_InitializeTasks_IgnoreBool = (char)1;
+}
+
+void OS_InitializeTasks_CMockStopIgnore(void)
+{
+  Mock.OS_InitializeTasks_IgnoreBool = (char)0;
+}
+
+void OS_InitializeTasks_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_InitializeTasks_CALL_INSTANCE));
+  CMOCK_OS_InitializeTasks_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_InitializeTasks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_InitializeTasks_CallInstance = CMock_Guts_MemChain(Mock.OS_InitializeTasks_CallInstance, cmock_guts_index);
+  Mock.OS_InitializeTasks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void OS_InitializeTasks_AddCallback(CMOCK_OS_InitializeTasks_CALLBACK Callback)
+{
+  Mock.OS_InitializeTasks_IgnoreBool = (char)0;
+  Mock.OS_InitializeTasks_CallbackBool = (char)1;
+  Mock.OS_InitializeTasks_CallbackFunctionPointer = Callback;
+}
+
+void OS_InitializeTasks_Stub(CMOCK_OS_InitializeTasks_CALLBACK Callback)
+{
+  Mock.OS_InitializeTasks_IgnoreBool = (char)0;
+  Mock.OS_InitializeTasks_CallbackBool = (char)0;
+  Mock.OS_InitializeTasks_CallbackFunctionPointer = Callback;
+}
+
+void OS_InitializeTasks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_InitializeTasks_CALL_INSTANCE));
+  CMOCK_OS_InitializeTasks_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_InitializeTasks_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_InitializeTasks_CallInstance = CMock_Guts_MemChain(Mock.OS_InitializeTasks_CallInstance, cmock_guts_index);
+  Mock.OS_InitializeTasks_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void vApplicationGetIdleTaskMemory(StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer, uint32_t* pulIdleTaskStackSize)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_vApplicationGetIdleTaskMemory);
+  cmock_call_instance = (CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.vApplicationGetIdleTaskMemory_CallInstance);
+  Mock.vApplicationGetIdleTaskMemory_CallInstance = CMock_Guts_MemNext(Mock.vApplicationGetIdleTaskMemory_CallInstance);
+  if (Mock.vApplicationGetIdleTaskMemory_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.vApplicationGetIdleTaskMemory_CallbackBool &&
+      Mock.vApplicationGetIdleTaskMemory_CallbackFunctionPointer != NULL)
+  {
+    Mock.vApplicationGetIdleTaskMemory_CallbackFunctionPointer(ppxIdleTaskTCBBuffer, ppxIdleTaskStackBuffer, pulIdleTaskStackSize, Mock.vApplicationGetIdleTaskMemory_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_ppxIdleTaskTCBBuffer)
+  {
+    UNITY_SET_DETAILS(CMockString_vApplicationGetIdleTaskMemory,CMockString_ppxIdleTaskTCBBuffer);
+    UNITY_TEST_ASSERT_EQUAL_PTR(cmock_call_instance->Expected_ppxIdleTaskTCBBuffer, ppxIdleTaskTCBBuffer, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_ppxIdleTaskStackBuffer)
+  {
+    UNITY_SET_DETAILS(CMockString_vApplicationGetIdleTaskMemory,CMockString_ppxIdleTaskStackBuffer);
+    UNITY_TEST_ASSERT_EQUAL_PTR(cmock_call_instance->Expected_ppxIdleTaskStackBuffer, ppxIdleTaskStackBuffer, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pulIdleTaskStackSize)
+  {
+    UNITY_SET_DETAILS(CMockString_vApplicationGetIdleTaskMemory,CMockString_pulIdleTaskStackSize);
+    if (cmock_call_instance->Expected_pulIdleTaskStackSize == NULL)
+      { UNITY_TEST_ASSERT_NULL(pulIdleTaskStackSize, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pulIdleTaskStackSize, pulIdleTaskStackSize, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.vApplicationGetIdleTaskMemory_CallbackFunctionPointer != NULL)
+  {
+    Mock.vApplicationGetIdleTaskMemory_CallbackFunctionPointer(ppxIdleTaskTCBBuffer, ppxIdleTaskStackBuffer, pulIdleTaskStackSize, Mock.vApplicationGetIdleTaskMemory_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_ppxIdleTaskTCBBuffer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(ppxIdleTaskTCBBuffer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)ppxIdleTaskTCBBuffer, (void*)cmock_call_instance->ReturnThruPtr_ppxIdleTaskTCBBuffer_Val,
+      cmock_call_instance->ReturnThruPtr_ppxIdleTaskTCBBuffer_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_ppxIdleTaskStackBuffer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(ppxIdleTaskStackBuffer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)ppxIdleTaskStackBuffer, (void*)cmock_call_instance->ReturnThruPtr_ppxIdleTaskStackBuffer_Val,
+      cmock_call_instance->ReturnThruPtr_ppxIdleTaskStackBuffer_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pulIdleTaskStackSize_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pulIdleTaskStackSize, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pulIdleTaskStackSize, (void*)cmock_call_instance->ReturnThruPtr_pulIdleTaskStackSize_Val,
+      cmock_call_instance->ReturnThruPtr_pulIdleTaskStackSize_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_vApplicationGetIdleTaskMemory(CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance, StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer, uint32_t* pulIdleTaskStackSize);
+void CMockExpectParameters_vApplicationGetIdleTaskMemory(CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance, StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer, uint32_t* pulIdleTaskStackSize)
+{
+  cmock_call_instance->Expected_ppxIdleTaskTCBBuffer = ppxIdleTaskTCBBuffer;
+  cmock_call_instance->IgnoreArg_ppxIdleTaskTCBBuffer = 0;
+  cmock_call_instance->ReturnThruPtr_ppxIdleTaskTCBBuffer_Used = 0;
+  cmock_call_instance->Expected_ppxIdleTaskStackBuffer = ppxIdleTaskStackBuffer;
+  cmock_call_instance->IgnoreArg_ppxIdleTaskStackBuffer = 0;
+  cmock_call_instance->ReturnThruPtr_ppxIdleTaskStackBuffer_Used = 0;
+  cmock_call_instance->Expected_pulIdleTaskStackSize = pulIdleTaskStackSize;
+  cmock_call_instance->IgnoreArg_pulIdleTaskStackSize = 0;
+  cmock_call_instance->ReturnThruPtr_pulIdleTaskStackSize_Used = 0;
+}
+
+void vApplicationGetIdleTaskMemory_CMockIgnore(void)
+{
+  Mock.vApplicationGetIdleTaskMemory_IgnoreBool = (char)1;
+}
+
+void vApplicationGetIdleTaskMemory_CMockStopIgnore(void)
+{
+  Mock.vApplicationGetIdleTaskMemory_IgnoreBool = (char)0;
+}
+
+void vApplicationGetIdleTaskMemory_CMockExpect(UNITY_LINE_TYPE cmock_line, StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer, uint32_t* pulIdleTaskStackSize)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE));
+  CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.vApplicationGetIdleTaskMemory_CallInstance = CMock_Guts_MemChain(Mock.vApplicationGetIdleTaskMemory_CallInstance, cmock_guts_index);
+  Mock.vApplicationGetIdleTaskMemory_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_vApplicationGetIdleTaskMemory(cmock_call_instance, ppxIdleTaskTCBBuffer, ppxIdleTaskStackBuffer, pulIdleTaskStackSize);
+}
+
+void vApplicationGetIdleTaskMemory_AddCallback(CMOCK_vApplicationGetIdleTaskMemory_CALLBACK Callback)
+{
+  Mock.vApplicationGetIdleTaskMemory_IgnoreBool = (char)0;
+  Mock.vApplicationGetIdleTaskMemory_CallbackBool = (char)1;
+  Mock.vApplicationGetIdleTaskMemory_CallbackFunctionPointer = Callback;
+}
+
+void vApplicationGetIdleTaskMemory_Stub(CMOCK_vApplicationGetIdleTaskMemory_CALLBACK Callback)
+{
+  Mock.vApplicationGetIdleTaskMemory_IgnoreBool = (char)0;
+  Mock.vApplicationGetIdleTaskMemory_CallbackBool = (char)0;
+  Mock.vApplicationGetIdleTaskMemory_CallbackFunctionPointer = Callback;
+}
+
+void vApplicationGetIdleTaskMemory_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer, uint32_t* pulIdleTaskStackSize, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE));
+  CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.vApplicationGetIdleTaskMemory_CallInstance = CMock_Guts_MemChain(Mock.vApplicationGetIdleTaskMemory_CallInstance, cmock_guts_index);
+  Mock.vApplicationGetIdleTaskMemory_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_vApplicationGetIdleTaskMemory(cmock_call_instance, ppxIdleTaskTCBBuffer, ppxIdleTaskStackBuffer, pulIdleTaskStackSize);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskTCBBuffer(UNITY_LINE_TYPE cmock_line, StaticTask_t** ppxIdleTaskTCBBuffer, size_t cmock_size)
+{
+  CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.vApplicationGetIdleTaskMemory_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_ppxIdleTaskTCBBuffer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_ppxIdleTaskTCBBuffer_Val = ppxIdleTaskTCBBuffer;
+  cmock_call_instance->ReturnThruPtr_ppxIdleTaskTCBBuffer_Size = cmock_size;
+}
+
+void vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskStackBuffer(UNITY_LINE_TYPE cmock_line, StackType_t** ppxIdleTaskStackBuffer, size_t cmock_size)
+{
+  CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.vApplicationGetIdleTaskMemory_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_ppxIdleTaskStackBuffer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_ppxIdleTaskStackBuffer_Val = ppxIdleTaskStackBuffer;
+  cmock_call_instance->ReturnThruPtr_ppxIdleTaskStackBuffer_Size = cmock_size;
+}
+
+void vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_pulIdleTaskStackSize(UNITY_LINE_TYPE cmock_line, uint32_t* pulIdleTaskStackSize, size_t cmock_size)
+{
+  CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.vApplicationGetIdleTaskMemory_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pulIdleTaskStackSize_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pulIdleTaskStackSize_Val = pulIdleTaskStackSize;
+  cmock_call_instance->ReturnThruPtr_pulIdleTaskStackSize_Size = cmock_size;
+}
+
+void vApplicationGetIdleTaskMemory_CMockIgnoreArg_ppxIdleTaskTCBBuffer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.vApplicationGetIdleTaskMemory_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_ppxIdleTaskTCBBuffer = 1;
+}
+
+void vApplicationGetIdleTaskMemory_CMockIgnoreArg_ppxIdleTaskStackBuffer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.vApplicationGetIdleTaskMemory_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_ppxIdleTaskStackBuffer = 1;
+}
+
+void vApplicationGetIdleTaskMemory_CMockIgnoreArg_pulIdleTaskStackSize(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationGetIdleTaskMemory_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.vApplicationGetIdleTaskMemory_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pulIdleTaskStackSize = 1;
+}
+
+void vApplicationIdleHook(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_vApplicationIdleHook_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_vApplicationIdleHook);
+  cmock_call_instance = (CMOCK_vApplicationIdleHook_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.vApplicationIdleHook_CallInstance);
+  Mock.vApplicationIdleHook_CallInstance = CMock_Guts_MemNext(Mock.vApplicationIdleHook_CallInstance);
+  if (Mock.vApplicationIdleHook_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.vApplicationIdleHook_CallbackBool &&
+      Mock.vApplicationIdleHook_CallbackFunctionPointer != NULL)
+  {
+    Mock.vApplicationIdleHook_CallbackFunctionPointer(Mock.vApplicationIdleHook_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.vApplicationIdleHook_CallbackFunctionPointer != NULL)
+  {
+    Mock.vApplicationIdleHook_CallbackFunctionPointer(Mock.vApplicationIdleHook_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void vApplicationIdleHook_CMockIgnore(void)
+{
+  Mock.vApplicationIdleHook_IgnoreBool = (char)1;
+}
+
+void vApplicationIdleHook_CMockStopIgnore(void)
+{
+  Mock.vApplicationIdleHook_IgnoreBool = (char)0;
+}
+
+void vApplicationIdleHook_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_vApplicationIdleHook_CALL_INSTANCE));
+  CMOCK_vApplicationIdleHook_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationIdleHook_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.vApplicationIdleHook_CallInstance = CMock_Guts_MemChain(Mock.vApplicationIdleHook_CallInstance, cmock_guts_index);
+  Mock.vApplicationIdleHook_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void vApplicationIdleHook_AddCallback(CMOCK_vApplicationIdleHook_CALLBACK Callback)
+{
+  Mock.vApplicationIdleHook_IgnoreBool = (char)0;
+  Mock.vApplicationIdleHook_CallbackBool = (char)1;
+  Mock.vApplicationIdleHook_CallbackFunctionPointer = Callback;
+}
+
+void vApplicationIdleHook_Stub(CMOCK_vApplicationIdleHook_CALLBACK Callback)
+{
+  Mock.vApplicationIdleHook_IgnoreBool = (char)0;
+  Mock.vApplicationIdleHook_CallbackBool = (char)0;
+  Mock.vApplicationIdleHook_CallbackFunctionPointer = Callback;
+}
+
+void vApplicationIdleHook_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_vApplicationIdleHook_CALL_INSTANCE));
+  CMOCK_vApplicationIdleHook_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationIdleHook_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.vApplicationIdleHook_CallInstance = CMock_Guts_MemChain(Mock.vApplicationIdleHook_CallInstance, cmock_guts_index);
+  Mock.vApplicationIdleHook_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void vApplicationStackOverflowHook(TaskHandle_t xTask, signed char* pcTaskName)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_vApplicationStackOverflowHook);
+  cmock_call_instance = (CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.vApplicationStackOverflowHook_CallInstance);
+  Mock.vApplicationStackOverflowHook_CallInstance = CMock_Guts_MemNext(Mock.vApplicationStackOverflowHook_CallInstance);
+  if (Mock.vApplicationStackOverflowHook_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.vApplicationStackOverflowHook_CallbackBool &&
+      Mock.vApplicationStackOverflowHook_CallbackFunctionPointer != NULL)
+  {
+    Mock.vApplicationStackOverflowHook_CallbackFunctionPointer(xTask, pcTaskName, Mock.vApplicationStackOverflowHook_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_xTask)
+  {
+    UNITY_SET_DETAILS(CMockString_vApplicationStackOverflowHook,CMockString_xTask);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_xTask), (void*)(&xTask), sizeof(TaskHandle_t), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pcTaskName)
+  {
+    UNITY_SET_DETAILS(CMockString_vApplicationStackOverflowHook,CMockString_pcTaskName);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pcTaskName), (void*)(pcTaskName), sizeof(signed char), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.vApplicationStackOverflowHook_CallbackFunctionPointer != NULL)
+  {
+    Mock.vApplicationStackOverflowHook_CallbackFunctionPointer(xTask, pcTaskName, Mock.vApplicationStackOverflowHook_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pcTaskName_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pcTaskName, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pcTaskName, (void*)cmock_call_instance->ReturnThruPtr_pcTaskName_Val,
+      cmock_call_instance->ReturnThruPtr_pcTaskName_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_vApplicationStackOverflowHook(CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE* cmock_call_instance, TaskHandle_t xTask, signed char* pcTaskName);
+void CMockExpectParameters_vApplicationStackOverflowHook(CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE* cmock_call_instance, TaskHandle_t xTask, signed char* pcTaskName)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_xTask), (void*)(&xTask),
+         sizeof(TaskHandle_t[sizeof(xTask) == sizeof(TaskHandle_t) ? 1 : -1])); /* add TaskHandle_t to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_xTask = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_pcTaskName), (void*)(&pcTaskName),
+         sizeof(signed char*[sizeof(pcTaskName) == sizeof(signed char*) ? 1 : -1])); /* add signed char* to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_pcTaskName = 0;
+  cmock_call_instance->ReturnThruPtr_pcTaskName_Used = 0;
+}
+
+void vApplicationStackOverflowHook_CMockIgnore(void)
+{
+  Mock.vApplicationStackOverflowHook_IgnoreBool = (char)1;
+}
+
+void vApplicationStackOverflowHook_CMockStopIgnore(void)
+{
+  Mock.vApplicationStackOverflowHook_IgnoreBool = (char)0;
+}
+
+void vApplicationStackOverflowHook_CMockExpect(UNITY_LINE_TYPE cmock_line, TaskHandle_t xTask, signed char* pcTaskName)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE));
+  CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.vApplicationStackOverflowHook_CallInstance = CMock_Guts_MemChain(Mock.vApplicationStackOverflowHook_CallInstance, cmock_guts_index);
+  Mock.vApplicationStackOverflowHook_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_vApplicationStackOverflowHook(cmock_call_instance, xTask, pcTaskName);
+}
+
+void vApplicationStackOverflowHook_AddCallback(CMOCK_vApplicationStackOverflowHook_CALLBACK Callback)
+{
+  Mock.vApplicationStackOverflowHook_IgnoreBool = (char)0;
+  Mock.vApplicationStackOverflowHook_CallbackBool = (char)1;
+  Mock.vApplicationStackOverflowHook_CallbackFunctionPointer = Callback;
+}
+
+void vApplicationStackOverflowHook_Stub(CMOCK_vApplicationStackOverflowHook_CALLBACK Callback)
+{
+  Mock.vApplicationStackOverflowHook_IgnoreBool = (char)0;
+  Mock.vApplicationStackOverflowHook_CallbackBool = (char)0;
+  Mock.vApplicationStackOverflowHook_CallbackFunctionPointer = Callback;
+}
+
+void vApplicationStackOverflowHook_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, TaskHandle_t xTask, signed char* pcTaskName, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE));
+  CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.vApplicationStackOverflowHook_CallInstance = CMock_Guts_MemChain(Mock.vApplicationStackOverflowHook_CallInstance, cmock_guts_index);
+  Mock.vApplicationStackOverflowHook_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_vApplicationStackOverflowHook(cmock_call_instance, xTask, pcTaskName);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void vApplicationStackOverflowHook_CMockReturnMemThruPtr_pcTaskName(UNITY_LINE_TYPE cmock_line, signed char* pcTaskName, size_t cmock_size)
+{
+  CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.vApplicationStackOverflowHook_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pcTaskName_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pcTaskName_Val = pcTaskName;
+  cmock_call_instance->ReturnThruPtr_pcTaskName_Size = cmock_size;
+}
+
+void vApplicationStackOverflowHook_CMockIgnoreArg_xTask(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.vApplicationStackOverflowHook_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_xTask = 1;
+}
+
+void vApplicationStackOverflowHook_CMockIgnoreArg_pcTaskName(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE* cmock_call_instance = (CMOCK_vApplicationStackOverflowHook_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.vApplicationStackOverflowHook_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pcTaskName = 1;
+}
+
+void OS_EnterTaskCritical(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_OS_EnterTaskCritical_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_OS_EnterTaskCritical);
+  cmock_call_instance = (CMOCK_OS_EnterTaskCritical_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.OS_EnterTaskCritical_CallInstance);
+  Mock.OS_EnterTaskCritical_CallInstance = CMock_Guts_MemNext(Mock.OS_EnterTaskCritical_CallInstance);
+  if (Mock.OS_EnterTaskCritical_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.OS_EnterTaskCritical_CallbackBool &&
+      Mock.OS_EnterTaskCritical_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_EnterTaskCritical_CallbackFunctionPointer(Mock.OS_EnterTaskCritical_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.OS_EnterTaskCritical_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_EnterTaskCritical_CallbackFunctionPointer(Mock.OS_EnterTaskCritical_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void OS_EnterTaskCritical_CMockIgnore(void)
+{
+  Mock.OS_EnterTaskCritical_IgnoreBool = (char)1;
+}
+
+void OS_EnterTaskCritical_CMockStopIgnore(void)
+{
+  Mock.OS_EnterTaskCritical_IgnoreBool = (char)0;
+}
+
+void OS_EnterTaskCritical_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_EnterTaskCritical_CALL_INSTANCE));
+  CMOCK_OS_EnterTaskCritical_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_EnterTaskCritical_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_EnterTaskCritical_CallInstance = CMock_Guts_MemChain(Mock.OS_EnterTaskCritical_CallInstance, cmock_guts_index);
+  Mock.OS_EnterTaskCritical_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void OS_EnterTaskCritical_AddCallback(CMOCK_OS_EnterTaskCritical_CALLBACK Callback)
+{
+  Mock.OS_EnterTaskCritical_IgnoreBool = (char)0;
+  Mock.OS_EnterTaskCritical_CallbackBool = (char)1;
+  Mock.OS_EnterTaskCritical_CallbackFunctionPointer = Callback;
+}
+
+void OS_EnterTaskCritical_Stub(CMOCK_OS_EnterTaskCritical_CALLBACK Callback)
+{
+  Mock.OS_EnterTaskCritical_IgnoreBool = (char)0;
+  Mock.OS_EnterTaskCritical_CallbackBool = (char)0;
+  Mock.OS_EnterTaskCritical_CallbackFunctionPointer = Callback;
+}
+
+void OS_EnterTaskCritical_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_EnterTaskCritical_CALL_INSTANCE));
+  CMOCK_OS_EnterTaskCritical_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_EnterTaskCritical_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_EnterTaskCritical_CallInstance = CMock_Guts_MemChain(Mock.OS_EnterTaskCritical_CallInstance, cmock_guts_index);
+  Mock.OS_EnterTaskCritical_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void OS_ExitTaskCritical(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_OS_ExitTaskCritical_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_OS_ExitTaskCritical);
+  cmock_call_instance = (CMOCK_OS_ExitTaskCritical_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.OS_ExitTaskCritical_CallInstance);
+  Mock.OS_ExitTaskCritical_CallInstance = CMock_Guts_MemNext(Mock.OS_ExitTaskCritical_CallInstance);
+  if (Mock.OS_ExitTaskCritical_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.OS_ExitTaskCritical_CallbackBool &&
+      Mock.OS_ExitTaskCritical_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_ExitTaskCritical_CallbackFunctionPointer(Mock.OS_ExitTaskCritical_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.OS_ExitTaskCritical_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_ExitTaskCritical_CallbackFunctionPointer(Mock.OS_ExitTaskCritical_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void OS_ExitTaskCritical_CMockIgnore(void)
+{
+  Mock.OS_ExitTaskCritical_IgnoreBool = (char)1;
+}
+
+void OS_ExitTaskCritical_CMockStopIgnore(void)
+{
+  Mock.OS_ExitTaskCritical_IgnoreBool = (char)0;
+}
+
+void OS_ExitTaskCritical_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_ExitTaskCritical_CALL_INSTANCE));
+  CMOCK_OS_ExitTaskCritical_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_ExitTaskCritical_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_ExitTaskCritical_CallInstance = CMock_Guts_MemChain(Mock.OS_ExitTaskCritical_CallInstance, cmock_guts_index);
+  Mock.OS_ExitTaskCritical_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void OS_ExitTaskCritical_AddCallback(CMOCK_OS_ExitTaskCritical_CALLBACK Callback)
+{
+  Mock.OS_ExitTaskCritical_IgnoreBool = (char)0;
+  Mock.OS_ExitTaskCritical_CallbackBool = (char)1;
+  Mock.OS_ExitTaskCritical_CallbackFunctionPointer = Callback;
+}
+
+void OS_ExitTaskCritical_Stub(CMOCK_OS_ExitTaskCritical_CALLBACK Callback)
+{
+  Mock.OS_ExitTaskCritical_IgnoreBool = (char)0;
+  Mock.OS_ExitTaskCritical_CallbackBool = (char)0;
+  Mock.OS_ExitTaskCritical_CallbackFunctionPointer = Callback;
+}
+
+void OS_ExitTaskCritical_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_ExitTaskCritical_CALL_INSTANCE));
+  CMOCK_OS_ExitTaskCritical_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_ExitTaskCritical_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_ExitTaskCritical_CallInstance = CMock_Guts_MemChain(Mock.OS_ExitTaskCritical_CallInstance, cmock_guts_index);
+  Mock.OS_ExitTaskCritical_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void OS_TriggerTimer(volatile OS_TIMER_s* timer)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_OS_TriggerTimer_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_OS_TriggerTimer);
+  cmock_call_instance = (CMOCK_OS_TriggerTimer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.OS_TriggerTimer_CallInstance);
+  Mock.OS_TriggerTimer_CallInstance = CMock_Guts_MemNext(Mock.OS_TriggerTimer_CallInstance);
+  if (Mock.OS_TriggerTimer_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.OS_TriggerTimer_CallbackBool &&
+      Mock.OS_TriggerTimer_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_TriggerTimer_CallbackFunctionPointer(timer, Mock.OS_TriggerTimer_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_timer)
+  {
+    UNITY_SET_DETAILS(CMockString_OS_TriggerTimer,CMockString_timer);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_timer), (void*)(timer), sizeof(volatile OS_TIMER_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.OS_TriggerTimer_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_TriggerTimer_CallbackFunctionPointer(timer, Mock.OS_TriggerTimer_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_timer_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(timer, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)timer, (void*)cmock_call_instance->ReturnThruPtr_timer_Val,
+      cmock_call_instance->ReturnThruPtr_timer_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_OS_TriggerTimer(CMOCK_OS_TriggerTimer_CALL_INSTANCE* cmock_call_instance, volatile OS_TIMER_s* timer);
+void CMockExpectParameters_OS_TriggerTimer(CMOCK_OS_TriggerTimer_CALL_INSTANCE* cmock_call_instance, volatile OS_TIMER_s* timer)
+{
+  cmock_call_instance->Expected_timer = timer;
+  cmock_call_instance->IgnoreArg_timer = 0;
+  cmock_call_instance->ReturnThruPtr_timer_Used = 0;
+}
+
+void OS_TriggerTimer_CMockIgnore(void)
+{
+  Mock.OS_TriggerTimer_IgnoreBool = (char)1;
+}
+
+void OS_TriggerTimer_CMockStopIgnore(void)
+{
+  Mock.OS_TriggerTimer_IgnoreBool = (char)0;
+}
+
+void OS_TriggerTimer_CMockExpect(UNITY_LINE_TYPE cmock_line, volatile OS_TIMER_s* timer)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_TriggerTimer_CALL_INSTANCE));
+  CMOCK_OS_TriggerTimer_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_TriggerTimer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_TriggerTimer_CallInstance = CMock_Guts_MemChain(Mock.OS_TriggerTimer_CallInstance, cmock_guts_index);
+  Mock.OS_TriggerTimer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_OS_TriggerTimer(cmock_call_instance, timer);
+}
+
+void OS_TriggerTimer_AddCallback(CMOCK_OS_TriggerTimer_CALLBACK Callback)
+{
+  Mock.OS_TriggerTimer_IgnoreBool = (char)0;
+  Mock.OS_TriggerTimer_CallbackBool = (char)1;
+  Mock.OS_TriggerTimer_CallbackFunctionPointer = Callback;
+}
+
+void OS_TriggerTimer_Stub(CMOCK_OS_TriggerTimer_CALLBACK Callback)
+{
+  Mock.OS_TriggerTimer_IgnoreBool = (char)0;
+  Mock.OS_TriggerTimer_CallbackBool = (char)0;
+  Mock.OS_TriggerTimer_CallbackFunctionPointer = Callback;
+}
+
+void OS_TriggerTimer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, volatile OS_TIMER_s* timer, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_TriggerTimer_CALL_INSTANCE));
+  CMOCK_OS_TriggerTimer_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_TriggerTimer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_TriggerTimer_CallInstance = CMock_Guts_MemChain(Mock.OS_TriggerTimer_CallInstance, cmock_guts_index);
+  Mock.OS_TriggerTimer_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_OS_TriggerTimer(cmock_call_instance, timer);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void OS_TriggerTimer_CMockReturnMemThruPtr_timer(UNITY_LINE_TYPE cmock_line, volatile OS_TIMER_s* timer, size_t cmock_size)
+{
+  CMOCK_OS_TriggerTimer_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_TriggerTimer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.OS_TriggerTimer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_timer_Used = 1;
+  cmock_call_instance->ReturnThruPtr_timer_Val = timer;
+  cmock_call_instance->ReturnThruPtr_timer_Size = cmock_size;
+}
+
+void OS_TriggerTimer_CMockIgnoreArg_timer(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_OS_TriggerTimer_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_TriggerTimer_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.OS_TriggerTimer_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_timer = 1;
+}
+
+uint32_t OS_GetTickCount(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_OS_GetTickCount_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_OS_GetTickCount);
+  cmock_call_instance = (CMOCK_OS_GetTickCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.OS_GetTickCount_CallInstance);
+  Mock.OS_GetTickCount_CallInstance = CMock_Guts_MemNext(Mock.OS_GetTickCount_CallInstance);
+  if (Mock.OS_GetTickCount_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.OS_GetTickCount_FinalReturn;
+    Mock.OS_GetTickCount_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.OS_GetTickCount_CallbackBool &&
+      Mock.OS_GetTickCount_CallbackFunctionPointer != NULL)
+  {
+    uint32_t cmock_cb_ret = Mock.OS_GetTickCount_CallbackFunctionPointer(Mock.OS_GetTickCount_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.OS_GetTickCount_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.OS_GetTickCount_CallbackFunctionPointer(Mock.OS_GetTickCount_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void OS_GetTickCount_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_GetTickCount_CALL_INSTANCE));
+  CMOCK_OS_GetTickCount_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_GetTickCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_GetTickCount_CallInstance = CMock_Guts_MemChain(Mock.OS_GetTickCount_CallInstance, cmock_guts_index);
+  Mock.OS_GetTickCount_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.OS_GetTickCount_IgnoreBool = (char)1;
+}
+
+void OS_GetTickCount_CMockStopIgnore(void)
+{
+  if(Mock.OS_GetTickCount_IgnoreBool)
+    Mock.OS_GetTickCount_CallInstance = CMock_Guts_MemNext(Mock.OS_GetTickCount_CallInstance);
+  Mock.OS_GetTickCount_IgnoreBool = (char)0;
+}
+
+void OS_GetTickCount_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_GetTickCount_CALL_INSTANCE));
+  CMOCK_OS_GetTickCount_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_GetTickCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_GetTickCount_CallInstance = CMock_Guts_MemChain(Mock.OS_GetTickCount_CallInstance, cmock_guts_index);
+  Mock.OS_GetTickCount_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void OS_GetTickCount_AddCallback(CMOCK_OS_GetTickCount_CALLBACK Callback)
+{
+  Mock.OS_GetTickCount_IgnoreBool = (char)0;
+  Mock.OS_GetTickCount_CallbackBool = (char)1;
+  Mock.OS_GetTickCount_CallbackFunctionPointer = Callback;
+}
+
+void OS_GetTickCount_Stub(CMOCK_OS_GetTickCount_CALLBACK Callback)
+{
+  Mock.OS_GetTickCount_IgnoreBool = (char)0;
+  Mock.OS_GetTickCount_CallbackBool = (char)0;
+  Mock.OS_GetTickCount_CallbackFunctionPointer = Callback;
+}
+
+void OS_GetTickCount_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_GetTickCount_CALL_INSTANCE));
+  CMOCK_OS_GetTickCount_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_GetTickCount_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_GetTickCount_CallInstance = CMock_Guts_MemChain(Mock.OS_GetTickCount_CallInstance, cmock_guts_index);
+  Mock.OS_GetTickCount_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void OS_DelayTask(uint32_t delay_ms)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_OS_DelayTask_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_OS_DelayTask);
+  cmock_call_instance = (CMOCK_OS_DelayTask_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.OS_DelayTask_CallInstance);
+  Mock.OS_DelayTask_CallInstance = CMock_Guts_MemNext(Mock.OS_DelayTask_CallInstance);
+  if (Mock.OS_DelayTask_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.OS_DelayTask_CallbackBool &&
+      Mock.OS_DelayTask_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_DelayTask_CallbackFunctionPointer(delay_ms, Mock.OS_DelayTask_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_delay_ms)
+  {
+    UNITY_SET_DETAILS(CMockString_OS_DelayTask,CMockString_delay_ms);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_delay_ms, delay_ms, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.OS_DelayTask_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_DelayTask_CallbackFunctionPointer(delay_ms, Mock.OS_DelayTask_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_OS_DelayTask(CMOCK_OS_DelayTask_CALL_INSTANCE* cmock_call_instance, uint32_t delay_ms);
+void CMockExpectParameters_OS_DelayTask(CMOCK_OS_DelayTask_CALL_INSTANCE* cmock_call_instance, uint32_t delay_ms)
+{
+  cmock_call_instance->Expected_delay_ms = delay_ms;
+  cmock_call_instance->IgnoreArg_delay_ms = 0;
+}
+
+void OS_DelayTask_CMockIgnore(void)
+{
+  Mock.OS_DelayTask_IgnoreBool = (char)1;
+}
+
+void OS_DelayTask_CMockStopIgnore(void)
+{
+  Mock.OS_DelayTask_IgnoreBool = (char)0;
+}
+
+void OS_DelayTask_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t delay_ms)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_DelayTask_CALL_INSTANCE));
+  CMOCK_OS_DelayTask_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_DelayTask_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_DelayTask_CallInstance = CMock_Guts_MemChain(Mock.OS_DelayTask_CallInstance, cmock_guts_index);
+  Mock.OS_DelayTask_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_OS_DelayTask(cmock_call_instance, delay_ms);
+}
+
+void OS_DelayTask_AddCallback(CMOCK_OS_DelayTask_CALLBACK Callback)
+{
+  Mock.OS_DelayTask_IgnoreBool = (char)0;
+  Mock.OS_DelayTask_CallbackBool = (char)1;
+  Mock.OS_DelayTask_CallbackFunctionPointer = Callback;
+}
+
+void OS_DelayTask_Stub(CMOCK_OS_DelayTask_CALLBACK Callback)
+{
+  Mock.OS_DelayTask_IgnoreBool = (char)0;
+  Mock.OS_DelayTask_CallbackBool = (char)0;
+  Mock.OS_DelayTask_CallbackFunctionPointer = Callback;
+}
+
+void OS_DelayTask_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t delay_ms, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_DelayTask_CALL_INSTANCE));
+  CMOCK_OS_DelayTask_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_DelayTask_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_DelayTask_CallInstance = CMock_Guts_MemChain(Mock.OS_DelayTask_CallInstance, cmock_guts_index);
+  Mock.OS_DelayTask_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_OS_DelayTask(cmock_call_instance, delay_ms);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void OS_DelayTask_CMockIgnoreArg_delay_ms(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_OS_DelayTask_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_DelayTask_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.OS_DelayTask_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_delay_ms = 1;
+}
+
+void OS_DelayTaskUntil(uint32_t* pPreviousWakeTime, uint32_t milliseconds)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_OS_DelayTaskUntil_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_OS_DelayTaskUntil);
+  cmock_call_instance = (CMOCK_OS_DelayTaskUntil_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.OS_DelayTaskUntil_CallInstance);
+  Mock.OS_DelayTaskUntil_CallInstance = CMock_Guts_MemNext(Mock.OS_DelayTaskUntil_CallInstance);
+  if (Mock.OS_DelayTaskUntil_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.OS_DelayTaskUntil_CallbackBool &&
+      Mock.OS_DelayTaskUntil_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_DelayTaskUntil_CallbackFunctionPointer(pPreviousWakeTime, milliseconds, Mock.OS_DelayTaskUntil_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pPreviousWakeTime)
+  {
+    UNITY_SET_DETAILS(CMockString_OS_DelayTaskUntil,CMockString_pPreviousWakeTime);
+    if (cmock_call_instance->Expected_pPreviousWakeTime == NULL)
+      { UNITY_TEST_ASSERT_NULL(pPreviousWakeTime, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX32_ARRAY(cmock_call_instance->Expected_pPreviousWakeTime, pPreviousWakeTime, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_milliseconds)
+  {
+    UNITY_SET_DETAILS(CMockString_OS_DelayTaskUntil,CMockString_milliseconds);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_milliseconds, milliseconds, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.OS_DelayTaskUntil_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_DelayTaskUntil_CallbackFunctionPointer(pPreviousWakeTime, milliseconds, Mock.OS_DelayTaskUntil_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pPreviousWakeTime_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pPreviousWakeTime, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pPreviousWakeTime, (void*)cmock_call_instance->ReturnThruPtr_pPreviousWakeTime_Val,
+      cmock_call_instance->ReturnThruPtr_pPreviousWakeTime_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_OS_DelayTaskUntil(CMOCK_OS_DelayTaskUntil_CALL_INSTANCE* cmock_call_instance, uint32_t* pPreviousWakeTime, uint32_t milliseconds);
+void CMockExpectParameters_OS_DelayTaskUntil(CMOCK_OS_DelayTaskUntil_CALL_INSTANCE* cmock_call_instance, uint32_t* pPreviousWakeTime, uint32_t milliseconds)
+{
+  cmock_call_instance->Expected_pPreviousWakeTime = pPreviousWakeTime;
+  cmock_call_instance->IgnoreArg_pPreviousWakeTime = 0;
+  cmock_call_instance->ReturnThruPtr_pPreviousWakeTime_Used = 0;
+  cmock_call_instance->Expected_milliseconds = milliseconds;
+  cmock_call_instance->IgnoreArg_milliseconds = 0;
+}
+
+void OS_DelayTaskUntil_CMockIgnore(void)
+{
+  Mock.OS_DelayTaskUntil_IgnoreBool = (char)1;
+}
+
+void OS_DelayTaskUntil_CMockStopIgnore(void)
+{
+  Mock.OS_DelayTaskUntil_IgnoreBool = (char)0;
+}
+
+void OS_DelayTaskUntil_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t* pPreviousWakeTime, uint32_t milliseconds)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_DelayTaskUntil_CALL_INSTANCE));
+  CMOCK_OS_DelayTaskUntil_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_DelayTaskUntil_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_DelayTaskUntil_CallInstance = CMock_Guts_MemChain(Mock.OS_DelayTaskUntil_CallInstance, cmock_guts_index);
+  Mock.OS_DelayTaskUntil_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_OS_DelayTaskUntil(cmock_call_instance, pPreviousWakeTime, milliseconds);
+}
+
+void OS_DelayTaskUntil_AddCallback(CMOCK_OS_DelayTaskUntil_CALLBACK Callback)
+{
+  Mock.OS_DelayTaskUntil_IgnoreBool = (char)0;
+  Mock.OS_DelayTaskUntil_CallbackBool = (char)1;
+  Mock.OS_DelayTaskUntil_CallbackFunctionPointer = Callback;
+}
+
+void OS_DelayTaskUntil_Stub(CMOCK_OS_DelayTaskUntil_CALLBACK Callback)
+{
+  Mock.OS_DelayTaskUntil_IgnoreBool = (char)0;
+  Mock.OS_DelayTaskUntil_CallbackBool = (char)0;
+  Mock.OS_DelayTaskUntil_CallbackFunctionPointer = Callback;
+}
+
+void OS_DelayTaskUntil_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t* pPreviousWakeTime, uint32_t milliseconds, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_DelayTaskUntil_CALL_INSTANCE));
+  CMOCK_OS_DelayTaskUntil_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_DelayTaskUntil_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_DelayTaskUntil_CallInstance = CMock_Guts_MemChain(Mock.OS_DelayTaskUntil_CallInstance, cmock_guts_index);
+  Mock.OS_DelayTaskUntil_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_OS_DelayTaskUntil(cmock_call_instance, pPreviousWakeTime, milliseconds);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void OS_DelayTaskUntil_CMockReturnMemThruPtr_pPreviousWakeTime(UNITY_LINE_TYPE cmock_line, uint32_t* pPreviousWakeTime, size_t cmock_size)
+{
+  CMOCK_OS_DelayTaskUntil_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_DelayTaskUntil_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.OS_DelayTaskUntil_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pPreviousWakeTime_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pPreviousWakeTime_Val = pPreviousWakeTime;
+  cmock_call_instance->ReturnThruPtr_pPreviousWakeTime_Size = cmock_size;
+}
+
+void OS_DelayTaskUntil_CMockIgnoreArg_pPreviousWakeTime(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_OS_DelayTaskUntil_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_DelayTaskUntil_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.OS_DelayTaskUntil_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pPreviousWakeTime = 1;
+}
+
+void OS_DelayTaskUntil_CMockIgnoreArg_milliseconds(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_OS_DelayTaskUntil_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_DelayTaskUntil_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.OS_DelayTaskUntil_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_milliseconds = 1;
+}
+
+void OS_SystemTickHandler(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_OS_SystemTickHandler_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_OS_SystemTickHandler);
+  cmock_call_instance = (CMOCK_OS_SystemTickHandler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.OS_SystemTickHandler_CallInstance);
+  Mock.OS_SystemTickHandler_CallInstance = CMock_Guts_MemNext(Mock.OS_SystemTickHandler_CallInstance);
+  if (Mock.OS_SystemTickHandler_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.OS_SystemTickHandler_CallbackBool &&
+      Mock.OS_SystemTickHandler_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_SystemTickHandler_CallbackFunctionPointer(Mock.OS_SystemTickHandler_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.OS_SystemTickHandler_CallbackFunctionPointer != NULL)
+  {
+    Mock.OS_SystemTickHandler_CallbackFunctionPointer(Mock.OS_SystemTickHandler_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void OS_SystemTickHandler_CMockIgnore(void)
+{
+  Mock.OS_SystemTickHandler_IgnoreBool = (char)1;
+}
+
+void OS_SystemTickHandler_CMockStopIgnore(void)
+{
+  Mock.OS_SystemTickHandler_IgnoreBool = (char)0;
+}
+
+void OS_SystemTickHandler_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_SystemTickHandler_CALL_INSTANCE));
+  CMOCK_OS_SystemTickHandler_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_SystemTickHandler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_SystemTickHandler_CallInstance = CMock_Guts_MemChain(Mock.OS_SystemTickHandler_CallInstance, cmock_guts_index);
+  Mock.OS_SystemTickHandler_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void OS_SystemTickHandler_AddCallback(CMOCK_OS_SystemTickHandler_CALLBACK Callback)
+{
+  Mock.OS_SystemTickHandler_IgnoreBool = (char)0;
+  Mock.OS_SystemTickHandler_CallbackBool = (char)1;
+  Mock.OS_SystemTickHandler_CallbackFunctionPointer = Callback;
+}
+
+void OS_SystemTickHandler_Stub(CMOCK_OS_SystemTickHandler_CALLBACK Callback)
+{
+  Mock.OS_SystemTickHandler_IgnoreBool = (char)0;
+  Mock.OS_SystemTickHandler_CallbackBool = (char)0;
+  Mock.OS_SystemTickHandler_CallbackFunctionPointer = Callback;
+}
+
+void OS_SystemTickHandler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_OS_SystemTickHandler_CALL_INSTANCE));
+  CMOCK_OS_SystemTickHandler_CALL_INSTANCE* cmock_call_instance = (CMOCK_OS_SystemTickHandler_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.OS_SystemTickHandler_CallInstance = CMock_Guts_MemChain(Mock.OS_SystemTickHandler_CallInstance, cmock_guts_index);
+  Mock.OS_SystemTickHandler_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
@@ -0,0 +1,232 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKOS_H
+#define _MOCKOS_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "os.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockos_Init(void);
+void Mockos_Destroy(void);
+void Mockos_Verify(void);
+
+
+
+
+#define OS_StartScheduler_Ignore() OS_StartScheduler_CMockIgnore()
+void OS_StartScheduler_CMockIgnore(void);
+#define OS_StartScheduler_StopIgnore() OS_StartScheduler_CMockStopIgnore()
+void OS_StartScheduler_CMockStopIgnore(void);
+#define OS_StartScheduler_Expect() OS_StartScheduler_CMockExpect(__LINE__)
+void OS_StartScheduler_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_OS_StartScheduler_CALLBACK)(int cmock_num_calls);
+void OS_StartScheduler_AddCallback(CMOCK_OS_StartScheduler_CALLBACK Callback);
+void OS_StartScheduler_Stub(CMOCK_OS_StartScheduler_CALLBACK Callback);
+#define OS_StartScheduler_StubWithCallback OS_StartScheduler_Stub
+#define OS_StartScheduler_ExpectAndThrow(cmock_to_throw) OS_StartScheduler_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void OS_StartScheduler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define OS_InitializeTasks_Ignore() OS_InitializeTasks_CMockIgnore()
+void OS_InitializeTasks_CMockIgnore(void);
+#define OS_InitializeTasks_StopIgnore() OS_InitializeTasks_CMockStopIgnore()
+void OS_InitializeTasks_CMockStopIgnore(void);
+#define OS_InitializeTasks_Expect() OS_InitializeTasks_CMockExpect(__LINE__)
+void OS_InitializeTasks_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_OS_InitializeTasks_CALLBACK)(int cmock_num_calls);
+void OS_InitializeTasks_AddCallback(CMOCK_OS_InitializeTasks_CALLBACK Callback);
+void OS_InitializeTasks_Stub(CMOCK_OS_InitializeTasks_CALLBACK Callback);
+#define OS_InitializeTasks_StubWithCallback OS_InitializeTasks_Stub
+#define OS_InitializeTasks_ExpectAndThrow(cmock_to_throw) OS_InitializeTasks_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void OS_InitializeTasks_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define vApplicationGetIdleTaskMemory_Ignore() vApplicationGetIdleTaskMemory_CMockIgnore()
+void vApplicationGetIdleTaskMemory_CMockIgnore(void);
+#define vApplicationGetIdleTaskMemory_StopIgnore() vApplicationGetIdleTaskMemory_CMockStopIgnore()
+void vApplicationGetIdleTaskMemory_CMockStopIgnore(void);
+#define vApplicationGetIdleTaskMemory_Expect(ppxIdleTaskTCBBuffer, ppxIdleTaskStackBuffer, pulIdleTaskStackSize) vApplicationGetIdleTaskMemory_CMockExpect(__LINE__, ppxIdleTaskTCBBuffer, ppxIdleTaskStackBuffer, pulIdleTaskStackSize)
+void vApplicationGetIdleTaskMemory_CMockExpect(UNITY_LINE_TYPE cmock_line, StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer, uint32_t* pulIdleTaskStackSize);
+typedef void (* CMOCK_vApplicationGetIdleTaskMemory_CALLBACK)(StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer, uint32_t* pulIdleTaskStackSize, int cmock_num_calls);
+void vApplicationGetIdleTaskMemory_AddCallback(CMOCK_vApplicationGetIdleTaskMemory_CALLBACK Callback);
+void vApplicationGetIdleTaskMemory_Stub(CMOCK_vApplicationGetIdleTaskMemory_CALLBACK Callback);
+#define vApplicationGetIdleTaskMemory_StubWithCallback vApplicationGetIdleTaskMemory_Stub
+#define vApplicationGetIdleTaskMemory_ExpectAndThrow(ppxIdleTaskTCBBuffer, ppxIdleTaskStackBuffer, pulIdleTaskStackSize, cmock_to_throw) vApplicationGetIdleTaskMemory_CMockExpectAndThrow(__LINE__, ppxIdleTaskTCBBuffer, ppxIdleTaskStackBuffer, pulIdleTaskStackSize, cmock_to_throw)
+void vApplicationGetIdleTaskMemory_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, StaticTask_t** ppxIdleTaskTCBBuffer, StackType_t** ppxIdleTaskStackBuffer, uint32_t* pulIdleTaskStackSize, CEXCEPTION_T cmock_to_throw);
+#define vApplicationGetIdleTaskMemory_ReturnThruPtr_ppxIdleTaskTCBBuffer(ppxIdleTaskTCBBuffer) vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskTCBBuffer(__LINE__, ppxIdleTaskTCBBuffer, sizeof(StaticTask_t*))
+#define vApplicationGetIdleTaskMemory_ReturnArrayThruPtr_ppxIdleTaskTCBBuffer(ppxIdleTaskTCBBuffer, cmock_len) vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskTCBBuffer(__LINE__, ppxIdleTaskTCBBuffer, cmock_len * sizeof(*ppxIdleTaskTCBBuffer))
+#define vApplicationGetIdleTaskMemory_ReturnMemThruPtr_ppxIdleTaskTCBBuffer(ppxIdleTaskTCBBuffer, cmock_size) vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskTCBBuffer(__LINE__, ppxIdleTaskTCBBuffer, cmock_size)
+void vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskTCBBuffer(UNITY_LINE_TYPE cmock_line, StaticTask_t** ppxIdleTaskTCBBuffer, size_t cmock_size);
+#define vApplicationGetIdleTaskMemory_ReturnThruPtr_ppxIdleTaskStackBuffer(ppxIdleTaskStackBuffer) vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskStackBuffer(__LINE__, ppxIdleTaskStackBuffer, sizeof(StackType_t*))
+#define vApplicationGetIdleTaskMemory_ReturnArrayThruPtr_ppxIdleTaskStackBuffer(ppxIdleTaskStackBuffer, cmock_len) vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskStackBuffer(__LINE__, ppxIdleTaskStackBuffer, cmock_len * sizeof(*ppxIdleTaskStackBuffer))
+#define vApplicationGetIdleTaskMemory_ReturnMemThruPtr_ppxIdleTaskStackBuffer(ppxIdleTaskStackBuffer, cmock_size) vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskStackBuffer(__LINE__, ppxIdleTaskStackBuffer, cmock_size)
+void vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_ppxIdleTaskStackBuffer(UNITY_LINE_TYPE cmock_line, StackType_t** ppxIdleTaskStackBuffer, size_t cmock_size);
+#define vApplicationGetIdleTaskMemory_ReturnThruPtr_pulIdleTaskStackSize(pulIdleTaskStackSize) vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_pulIdleTaskStackSize(__LINE__, pulIdleTaskStackSize, sizeof(uint32_t))
+#define vApplicationGetIdleTaskMemory_ReturnArrayThruPtr_pulIdleTaskStackSize(pulIdleTaskStackSize, cmock_len) vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_pulIdleTaskStackSize(__LINE__, pulIdleTaskStackSize, cmock_len * sizeof(*pulIdleTaskStackSize))
+#define vApplicationGetIdleTaskMemory_ReturnMemThruPtr_pulIdleTaskStackSize(pulIdleTaskStackSize, cmock_size) vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_pulIdleTaskStackSize(__LINE__, pulIdleTaskStackSize, cmock_size)
+void vApplicationGetIdleTaskMemory_CMockReturnMemThruPtr_pulIdleTaskStackSize(UNITY_LINE_TYPE cmock_line, uint32_t* pulIdleTaskStackSize, size_t cmock_size);
+#define vApplicationGetIdleTaskMemory_IgnoreArg_ppxIdleTaskTCBBuffer() vApplicationGetIdleTaskMemory_CMockIgnoreArg_ppxIdleTaskTCBBuffer(__LINE__)
+void vApplicationGetIdleTaskMemory_CMockIgnoreArg_ppxIdleTaskTCBBuffer(UNITY_LINE_TYPE cmock_line);
+#define vApplicationGetIdleTaskMemory_IgnoreArg_ppxIdleTaskStackBuffer() vApplicationGetIdleTaskMemory_CMockIgnoreArg_ppxIdleTaskStackBuffer(__LINE__)
+void vApplicationGetIdleTaskMemory_CMockIgnoreArg_ppxIdleTaskStackBuffer(UNITY_LINE_TYPE cmock_line);
+#define vApplicationGetIdleTaskMemory_IgnoreArg_pulIdleTaskStackSize() vApplicationGetIdleTaskMemory_CMockIgnoreArg_pulIdleTaskStackSize(__LINE__)
+void vApplicationGetIdleTaskMemory_CMockIgnoreArg_pulIdleTaskStackSize(UNITY_LINE_TYPE cmock_line);
+#define vApplicationIdleHook_Ignore() vApplicationIdleHook_CMockIgnore()
+void vApplicationIdleHook_CMockIgnore(void);
+#define vApplicationIdleHook_StopIgnore() vApplicationIdleHook_CMockStopIgnore()
+void vApplicationIdleHook_CMockStopIgnore(void);
+#define vApplicationIdleHook_Expect() vApplicationIdleHook_CMockExpect(__LINE__)
+void vApplicationIdleHook_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_vApplicationIdleHook_CALLBACK)(int cmock_num_calls);
+void vApplicationIdleHook_AddCallback(CMOCK_vApplicationIdleHook_CALLBACK Callback);
+void vApplicationIdleHook_Stub(CMOCK_vApplicationIdleHook_CALLBACK Callback);
+#define vApplicationIdleHook_StubWithCallback vApplicationIdleHook_Stub
+#define vApplicationIdleHook_ExpectAndThrow(cmock_to_throw) vApplicationIdleHook_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void vApplicationIdleHook_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define vApplicationStackOverflowHook_Ignore() vApplicationStackOverflowHook_CMockIgnore()
+void vApplicationStackOverflowHook_CMockIgnore(void);
+#define vApplicationStackOverflowHook_StopIgnore() vApplicationStackOverflowHook_CMockStopIgnore()
+void vApplicationStackOverflowHook_CMockStopIgnore(void);
+#define vApplicationStackOverflowHook_Expect(xTask, pcTaskName) vApplicationStackOverflowHook_CMockExpect(__LINE__, xTask, pcTaskName)
+void vApplicationStackOverflowHook_CMockExpect(UNITY_LINE_TYPE cmock_line, TaskHandle_t xTask, signed char* pcTaskName);
+typedef void (* CMOCK_vApplicationStackOverflowHook_CALLBACK)(TaskHandle_t xTask, signed char* pcTaskName, int cmock_num_calls);
+void vApplicationStackOverflowHook_AddCallback(CMOCK_vApplicationStackOverflowHook_CALLBACK Callback);
+void vApplicationStackOverflowHook_Stub(CMOCK_vApplicationStackOverflowHook_CALLBACK Callback);
+#define vApplicationStackOverflowHook_StubWithCallback vApplicationStackOverflowHook_Stub
+#define vApplicationStackOverflowHook_ExpectAndThrow(xTask, pcTaskName, cmock_to_throw) vApplicationStackOverflowHook_CMockExpectAndThrow(__LINE__, xTask, pcTaskName, cmock_to_throw)
+void vApplicationStackOverflowHook_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, TaskHandle_t xTask, signed char* pcTaskName, CEXCEPTION_T cmock_to_throw);
+#define vApplicationStackOverflowHook_ReturnThruPtr_pcTaskName(pcTaskName) vApplicationStackOverflowHook_CMockReturnMemThruPtr_pcTaskName(__LINE__, pcTaskName, sizeof(signed char))
+#define vApplicationStackOverflowHook_ReturnArrayThruPtr_pcTaskName(pcTaskName, cmock_len) vApplicationStackOverflowHook_CMockReturnMemThruPtr_pcTaskName(__LINE__, pcTaskName, cmock_len * sizeof(*pcTaskName))
+#define vApplicationStackOverflowHook_ReturnMemThruPtr_pcTaskName(pcTaskName, cmock_size) vApplicationStackOverflowHook_CMockReturnMemThruPtr_pcTaskName(__LINE__, pcTaskName, cmock_size)
+void vApplicationStackOverflowHook_CMockReturnMemThruPtr_pcTaskName(UNITY_LINE_TYPE cmock_line, signed char* pcTaskName, size_t cmock_size);
+#define vApplicationStackOverflowHook_IgnoreArg_xTask() vApplicationStackOverflowHook_CMockIgnoreArg_xTask(__LINE__)
+void vApplicationStackOverflowHook_CMockIgnoreArg_xTask(UNITY_LINE_TYPE cmock_line);
+#define vApplicationStackOverflowHook_IgnoreArg_pcTaskName() vApplicationStackOverflowHook_CMockIgnoreArg_pcTaskName(__LINE__)
+void vApplicationStackOverflowHook_CMockIgnoreArg_pcTaskName(UNITY_LINE_TYPE cmock_line);
+#define OS_EnterTaskCritical_Ignore() OS_EnterTaskCritical_CMockIgnore()
+void OS_EnterTaskCritical_CMockIgnore(void);
+#define OS_EnterTaskCritical_StopIgnore() OS_EnterTaskCritical_CMockStopIgnore()
+void OS_EnterTaskCritical_CMockStopIgnore(void);
+#define OS_EnterTaskCritical_Expect() OS_EnterTaskCritical_CMockExpect(__LINE__)
+void OS_EnterTaskCritical_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_OS_EnterTaskCritical_CALLBACK)(int cmock_num_calls);
+void OS_EnterTaskCritical_AddCallback(CMOCK_OS_EnterTaskCritical_CALLBACK Callback);
+void OS_EnterTaskCritical_Stub(CMOCK_OS_EnterTaskCritical_CALLBACK Callback);
+#define OS_EnterTaskCritical_StubWithCallback OS_EnterTaskCritical_Stub
+#define OS_EnterTaskCritical_ExpectAndThrow(cmock_to_throw) OS_EnterTaskCritical_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void OS_EnterTaskCritical_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define OS_ExitTaskCritical_Ignore() OS_ExitTaskCritical_CMockIgnore()
+void OS_ExitTaskCritical_CMockIgnore(void);
+#define OS_ExitTaskCritical_StopIgnore() OS_ExitTaskCritical_CMockStopIgnore()
+void OS_ExitTaskCritical_CMockStopIgnore(void);
+#define OS_ExitTaskCritical_Expect() OS_ExitTaskCritical_CMockExpect(__LINE__)
+void OS_ExitTaskCritical_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_OS_ExitTaskCritical_CALLBACK)(int cmock_num_calls);
+void OS_ExitTaskCritical_AddCallback(CMOCK_OS_ExitTaskCritical_CALLBACK Callback);
+void OS_ExitTaskCritical_Stub(CMOCK_OS_ExitTaskCritical_CALLBACK Callback);
+#define OS_ExitTaskCritical_StubWithCallback OS_ExitTaskCritical_Stub
+#define OS_ExitTaskCritical_ExpectAndThrow(cmock_to_throw) OS_ExitTaskCritical_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void OS_ExitTaskCritical_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define OS_TriggerTimer_Ignore() OS_TriggerTimer_CMockIgnore()
+void OS_TriggerTimer_CMockIgnore(void);
+#define OS_TriggerTimer_StopIgnore() OS_TriggerTimer_CMockStopIgnore()
+void OS_TriggerTimer_CMockStopIgnore(void);
+#define OS_TriggerTimer_Expect(timer) OS_TriggerTimer_CMockExpect(__LINE__, timer)
+void OS_TriggerTimer_CMockExpect(UNITY_LINE_TYPE cmock_line, volatile OS_TIMER_s* timer);
+typedef void (* CMOCK_OS_TriggerTimer_CALLBACK)(volatile OS_TIMER_s* timer, int cmock_num_calls);
+void OS_TriggerTimer_AddCallback(CMOCK_OS_TriggerTimer_CALLBACK Callback);
+void OS_TriggerTimer_Stub(CMOCK_OS_TriggerTimer_CALLBACK Callback);
+#define OS_TriggerTimer_StubWithCallback OS_TriggerTimer_Stub
+#define OS_TriggerTimer_ExpectAndThrow(timer, cmock_to_throw) OS_TriggerTimer_CMockExpectAndThrow(__LINE__, timer, cmock_to_throw)
+void OS_TriggerTimer_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, volatile OS_TIMER_s* timer, CEXCEPTION_T cmock_to_throw);
+#define OS_TriggerTimer_ReturnThruPtr_timer(timer) OS_TriggerTimer_CMockReturnMemThruPtr_timer(__LINE__, timer, sizeof(volatile OS_TIMER_s))
+#define OS_TriggerTimer_ReturnArrayThruPtr_timer(timer, cmock_len) OS_TriggerTimer_CMockReturnMemThruPtr_timer(__LINE__, timer, cmock_len * sizeof(*timer))
+#define OS_TriggerTimer_ReturnMemThruPtr_timer(timer, cmock_size) OS_TriggerTimer_CMockReturnMemThruPtr_timer(__LINE__, timer, cmock_size)
+void OS_TriggerTimer_CMockReturnMemThruPtr_timer(UNITY_LINE_TYPE cmock_line, volatile OS_TIMER_s* timer, size_t cmock_size);
+#define OS_TriggerTimer_IgnoreArg_timer() OS_TriggerTimer_CMockIgnoreArg_timer(__LINE__)
+void OS_TriggerTimer_CMockIgnoreArg_timer(UNITY_LINE_TYPE cmock_line);
+#define OS_GetTickCount_IgnoreAndReturn(cmock_retval) OS_GetTickCount_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void OS_GetTickCount_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+#define OS_GetTickCount_StopIgnore() OS_GetTickCount_CMockStopIgnore()
+void OS_GetTickCount_CMockStopIgnore(void);
+#define OS_GetTickCount_ExpectAndReturn(cmock_retval) OS_GetTickCount_CMockExpectAndReturn(__LINE__, cmock_retval)
+void OS_GetTickCount_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint32_t cmock_to_return);
+typedef uint32_t (* CMOCK_OS_GetTickCount_CALLBACK)(int cmock_num_calls);
+void OS_GetTickCount_AddCallback(CMOCK_OS_GetTickCount_CALLBACK Callback);
+void OS_GetTickCount_Stub(CMOCK_OS_GetTickCount_CALLBACK Callback);
+#define OS_GetTickCount_StubWithCallback OS_GetTickCount_Stub
+#define OS_GetTickCount_ExpectAndThrow(cmock_to_throw) OS_GetTickCount_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void OS_GetTickCount_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define OS_DelayTask_Ignore() OS_DelayTask_CMockIgnore()
+void OS_DelayTask_CMockIgnore(void);
+#define OS_DelayTask_StopIgnore() OS_DelayTask_CMockStopIgnore()
+void OS_DelayTask_CMockStopIgnore(void);
+#define OS_DelayTask_Expect(delay_ms) OS_DelayTask_CMockExpect(__LINE__, delay_ms)
+void OS_DelayTask_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t delay_ms);
+typedef void (* CMOCK_OS_DelayTask_CALLBACK)(uint32_t delay_ms, int cmock_num_calls);
+void OS_DelayTask_AddCallback(CMOCK_OS_DelayTask_CALLBACK Callback);
+void OS_DelayTask_Stub(CMOCK_OS_DelayTask_CALLBACK Callback);
+#define OS_DelayTask_StubWithCallback OS_DelayTask_Stub
+#define OS_DelayTask_ExpectAndThrow(delay_ms, cmock_to_throw) OS_DelayTask_CMockExpectAndThrow(__LINE__, delay_ms, cmock_to_throw)
+void OS_DelayTask_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t delay_ms, CEXCEPTION_T cmock_to_throw);
+#define OS_DelayTask_IgnoreArg_delay_ms() OS_DelayTask_CMockIgnoreArg_delay_ms(__LINE__)
+void OS_DelayTask_CMockIgnoreArg_delay_ms(UNITY_LINE_TYPE cmock_line);
+#define OS_DelayTaskUntil_Ignore() OS_DelayTaskUntil_CMockIgnore()
+void OS_DelayTaskUntil_CMockIgnore(void);
+#define OS_DelayTaskUntil_StopIgnore() OS_DelayTaskUntil_CMockStopIgnore()
+void OS_DelayTaskUntil_CMockStopIgnore(void);
+#define OS_DelayTaskUntil_Expect(pPreviousWakeTime, milliseconds) OS_DelayTaskUntil_CMockExpect(__LINE__, pPreviousWakeTime, milliseconds)
+void OS_DelayTaskUntil_CMockExpect(UNITY_LINE_TYPE cmock_line, uint32_t* pPreviousWakeTime, uint32_t milliseconds);
+typedef void (* CMOCK_OS_DelayTaskUntil_CALLBACK)(uint32_t* pPreviousWakeTime, uint32_t milliseconds, int cmock_num_calls);
+void OS_DelayTaskUntil_AddCallback(CMOCK_OS_DelayTaskUntil_CALLBACK Callback);
+void OS_DelayTaskUntil_Stub(CMOCK_OS_DelayTaskUntil_CALLBACK Callback);
+#define OS_DelayTaskUntil_StubWithCallback OS_DelayTaskUntil_Stub
+#define OS_DelayTaskUntil_ExpectAndThrow(pPreviousWakeTime, milliseconds, cmock_to_throw) OS_DelayTaskUntil_CMockExpectAndThrow(__LINE__, pPreviousWakeTime, milliseconds, cmock_to_throw)
+void OS_DelayTaskUntil_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint32_t* pPreviousWakeTime, uint32_t milliseconds, CEXCEPTION_T cmock_to_throw);
+#define OS_DelayTaskUntil_ReturnThruPtr_pPreviousWakeTime(pPreviousWakeTime) OS_DelayTaskUntil_CMockReturnMemThruPtr_pPreviousWakeTime(__LINE__, pPreviousWakeTime, sizeof(uint32_t))
+#define OS_DelayTaskUntil_ReturnArrayThruPtr_pPreviousWakeTime(pPreviousWakeTime, cmock_len) OS_DelayTaskUntil_CMockReturnMemThruPtr_pPreviousWakeTime(__LINE__, pPreviousWakeTime, cmock_len * sizeof(*pPreviousWakeTime))
+#define OS_DelayTaskUntil_ReturnMemThruPtr_pPreviousWakeTime(pPreviousWakeTime, cmock_size) OS_DelayTaskUntil_CMockReturnMemThruPtr_pPreviousWakeTime(__LINE__, pPreviousWakeTime, cmock_size)
+void OS_DelayTaskUntil_CMockReturnMemThruPtr_pPreviousWakeTime(UNITY_LINE_TYPE cmock_line, uint32_t* pPreviousWakeTime, size_t cmock_size);
+#define OS_DelayTaskUntil_IgnoreArg_pPreviousWakeTime() OS_DelayTaskUntil_CMockIgnoreArg_pPreviousWakeTime(__LINE__)
+void OS_DelayTaskUntil_CMockIgnoreArg_pPreviousWakeTime(UNITY_LINE_TYPE cmock_line);
+#define OS_DelayTaskUntil_IgnoreArg_milliseconds() OS_DelayTaskUntil_CMockIgnoreArg_milliseconds(__LINE__)
+void OS_DelayTaskUntil_CMockIgnoreArg_milliseconds(UNITY_LINE_TYPE cmock_line);
+#define OS_SystemTickHandler_Ignore() OS_SystemTickHandler_CMockIgnore()
+void OS_SystemTickHandler_CMockIgnore(void);
+#define OS_SystemTickHandler_StopIgnore() OS_SystemTickHandler_CMockStopIgnore()
+void OS_SystemTickHandler_CMockStopIgnore(void);
+#define OS_SystemTickHandler_Expect() OS_SystemTickHandler_CMockExpect(__LINE__)
+void OS_SystemTickHandler_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_OS_SystemTickHandler_CALLBACK)(int cmock_num_calls);
+void OS_SystemTickHandler_AddCallback(CMOCK_OS_SystemTickHandler_CALLBACK Callback);
+void OS_SystemTickHandler_Stub(CMOCK_OS_SystemTickHandler_CALLBACK Callback);
+#define OS_SystemTickHandler_StubWithCallback OS_SystemTickHandler_Stub
+#define OS_SystemTickHandler_ExpectAndThrow(cmock_to_throw) OS_SystemTickHandler_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void OS_SystemTickHandler_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
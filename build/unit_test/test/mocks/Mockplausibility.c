@@ -0,0 +1,1068 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockplausibility.h"
+
+static const char* CMockString_PL_CheckCelltemperature = "PL_CheckCelltemperature";
+static const char* CMockString_PL_CheckCellvoltage = "PL_CheckCellvoltage";
+static const char* CMockString_PL_CheckStringVoltage = "PL_CheckStringVoltage";
+static const char* CMockString_PL_CheckTemperatureSpread = "PL_CheckTemperatureSpread";
+static const char* CMockString_PL_CheckVoltageSpread = "PL_CheckVoltageSpread";
+static const char* CMockString_baseCellVoltage = "baseCellVoltage";
+static const char* CMockString_baseCelltemperature = "baseCelltemperature";
+static const char* CMockString_pCellTemperatures = "pCellTemperatures";
+static const char* CMockString_pCellVoltage = "pCellVoltage";
+static const char* CMockString_pCelltemperature = "pCelltemperature";
+static const char* CMockString_pCellvoltages = "pCellvoltages";
+static const char* CMockString_pMinMaxAverageValues = "pMinMaxAverageValues";
+static const char* CMockString_redundancy0CellVoltage = "redundancy0CellVoltage";
+static const char* CMockString_redundancy0Celltemperature = "redundancy0Celltemperature";
+static const char* CMockString_voltageCurrentSensor_mV = "voltageCurrentSensor_mV";
+static const char* CMockString_voltageMic_mV = "voltageMic_mV";
+
+typedef struct _CMOCK_PL_CheckStringVoltage_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  int32_t Expected_voltageMic_mV;
+  int32_t Expected_voltageCurrentSensor_mV;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_voltageMic_mV;
+  char IgnoreArg_voltageCurrentSensor_mV;
+
+} CMOCK_PL_CheckStringVoltage_CALL_INSTANCE;
+
+typedef struct _CMOCK_PL_CheckCellvoltage_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  int16_t Expected_baseCellVoltage;
+  int16_t Expected_redundancy0CellVoltage;
+  int16_t* Expected_pCellVoltage;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCellVoltage_Used;
+  int16_t* ReturnThruPtr_pCellVoltage_Val;
+  size_t ReturnThruPtr_pCellVoltage_Size;
+  char IgnoreArg_baseCellVoltage;
+  char IgnoreArg_redundancy0CellVoltage;
+  char IgnoreArg_pCellVoltage;
+
+} CMOCK_PL_CheckCellvoltage_CALL_INSTANCE;
+
+typedef struct _CMOCK_PL_CheckCelltemperature_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  int16_t Expected_baseCelltemperature;
+  int16_t Expected_redundancy0Celltemperature;
+  int16_t* Expected_pCelltemperature;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCelltemperature_Used;
+  int16_t* ReturnThruPtr_pCelltemperature_Val;
+  size_t ReturnThruPtr_pCelltemperature_Size;
+  char IgnoreArg_baseCelltemperature;
+  char IgnoreArg_redundancy0Celltemperature;
+  char IgnoreArg_pCelltemperature;
+
+} CMOCK_PL_CheckCelltemperature_CALL_INSTANCE;
+
+typedef struct _CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  DATA_BLOCK_CELL_VOLTAGE_s* Expected_pCellvoltages;
+  DATA_BLOCK_MIN_MAX_s* Expected_pMinMaxAverageValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCellvoltages_Used;
+  DATA_BLOCK_CELL_VOLTAGE_s* ReturnThruPtr_pCellvoltages_Val;
+  size_t ReturnThruPtr_pCellvoltages_Size;
+  char ReturnThruPtr_pMinMaxAverageValues_Used;
+  DATA_BLOCK_MIN_MAX_s* ReturnThruPtr_pMinMaxAverageValues_Val;
+  size_t ReturnThruPtr_pMinMaxAverageValues_Size;
+  char IgnoreArg_pCellvoltages;
+  char IgnoreArg_pMinMaxAverageValues;
+
+} CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE;
+
+typedef struct _CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  DATA_BLOCK_CELL_TEMPERATURE_s* Expected_pCellTemperatures;
+  DATA_BLOCK_MIN_MAX_s* Expected_pMinMaxAverageValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCellTemperatures_Used;
+  DATA_BLOCK_CELL_TEMPERATURE_s* ReturnThruPtr_pCellTemperatures_Val;
+  size_t ReturnThruPtr_pCellTemperatures_Size;
+  char ReturnThruPtr_pMinMaxAverageValues_Used;
+  DATA_BLOCK_MIN_MAX_s* ReturnThruPtr_pMinMaxAverageValues_Val;
+  size_t ReturnThruPtr_pMinMaxAverageValues_Size;
+  char IgnoreArg_pCellTemperatures;
+  char IgnoreArg_pMinMaxAverageValues;
+
+} CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE;
+
+static struct MockplausibilityInstance
+{
+  char PL_CheckStringVoltage_IgnoreBool;
+  STD_RETURN_TYPE_e PL_CheckStringVoltage_FinalReturn;
+  char PL_CheckStringVoltage_CallbackBool;
+  CMOCK_PL_CheckStringVoltage_CALLBACK PL_CheckStringVoltage_CallbackFunctionPointer;
+  int PL_CheckStringVoltage_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE PL_CheckStringVoltage_CallInstance;
+  char PL_CheckCellvoltage_IgnoreBool;
+  STD_RETURN_TYPE_e PL_CheckCellvoltage_FinalReturn;
+  char PL_CheckCellvoltage_CallbackBool;
+  CMOCK_PL_CheckCellvoltage_CALLBACK PL_CheckCellvoltage_CallbackFunctionPointer;
+  int PL_CheckCellvoltage_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE PL_CheckCellvoltage_CallInstance;
+  char PL_CheckCelltemperature_IgnoreBool;
+  STD_RETURN_TYPE_e PL_CheckCelltemperature_FinalReturn;
+  char PL_CheckCelltemperature_CallbackBool;
+  CMOCK_PL_CheckCelltemperature_CALLBACK PL_CheckCelltemperature_CallbackFunctionPointer;
+  int PL_CheckCelltemperature_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE PL_CheckCelltemperature_CallInstance;
+  char PL_CheckVoltageSpread_IgnoreBool;
+  STD_RETURN_TYPE_e PL_CheckVoltageSpread_FinalReturn;
+  char PL_CheckVoltageSpread_CallbackBool;
+  CMOCK_PL_CheckVoltageSpread_CALLBACK PL_CheckVoltageSpread_CallbackFunctionPointer;
+  int PL_CheckVoltageSpread_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE PL_CheckVoltageSpread_CallInstance;
+  char PL_CheckTemperatureSpread_IgnoreBool;
+  STD_RETURN_TYPE_e PL_CheckTemperatureSpread_FinalReturn;
+  char PL_CheckTemperatureSpread_CallbackBool;
+  CMOCK_PL_CheckTemperatureSpread_CALLBACK PL_CheckTemperatureSpread_CallbackFunctionPointer;
+  int PL_CheckTemperatureSpread_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE PL_CheckTemperatureSpread_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockplausibility_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.PL_CheckStringVoltage_CallInstance;
+  if (Mock.PL_CheckStringVoltage_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_PL_CheckStringVoltage);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.PL_CheckStringVoltage_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.PL_CheckCellvoltage_CallInstance;
+  if (Mock.PL_CheckCellvoltage_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_PL_CheckCellvoltage);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.PL_CheckCellvoltage_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.PL_CheckCelltemperature_CallInstance;
+  if (Mock.PL_CheckCelltemperature_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_PL_CheckCelltemperature);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.PL_CheckCelltemperature_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.PL_CheckVoltageSpread_CallInstance;
+  if (Mock.PL_CheckVoltageSpread_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_PL_CheckVoltageSpread);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.PL_CheckVoltageSpread_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.PL_CheckTemperatureSpread_CallInstance;
+  if (Mock.PL_CheckTemperatureSpread_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_PL_CheckTemperatureSpread);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.PL_CheckTemperatureSpread_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockplausibility_Init(void)
+{
+  Mockplausibility_Destroy();
+}
+
+void Mockplausibility_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+STD_RETURN_TYPE_e PL_CheckStringVoltage(int32_t voltageMic_mV, int32_t voltageCurrentSensor_mV)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_PL_CheckStringVoltage_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_PL_CheckStringVoltage);
+  cmock_call_instance = (CMOCK_PL_CheckStringVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.PL_CheckStringVoltage_CallInstance);
+  Mock.PL_CheckStringVoltage_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckStringVoltage_CallInstance);
+  if (Mock.PL_CheckStringVoltage_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.PL_CheckStringVoltage_FinalReturn;
+    memcpy((void*)(&Mock.PL_CheckStringVoltage_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.PL_CheckStringVoltage_CallbackBool &&
+      Mock.PL_CheckStringVoltage_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.PL_CheckStringVoltage_CallbackFunctionPointer(voltageMic_mV, voltageCurrentSensor_mV, Mock.PL_CheckStringVoltage_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_voltageMic_mV)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckStringVoltage,CMockString_voltageMic_mV);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_voltageMic_mV, voltageMic_mV, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_voltageCurrentSensor_mV)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckStringVoltage,CMockString_voltageCurrentSensor_mV);
+    UNITY_TEST_ASSERT_EQUAL_INT(cmock_call_instance->Expected_voltageCurrentSensor_mV, voltageCurrentSensor_mV, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.PL_CheckStringVoltage_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.PL_CheckStringVoltage_CallbackFunctionPointer(voltageMic_mV, voltageCurrentSensor_mV, Mock.PL_CheckStringVoltage_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_PL_CheckStringVoltage(CMOCK_PL_CheckStringVoltage_CALL_INSTANCE* cmock_call_instance, int32_t voltageMic_mV, int32_t voltageCurrentSensor_mV);
+void CMockExpectParameters_PL_CheckStringVoltage(CMOCK_PL_CheckStringVoltage_CALL_INSTANCE* cmock_call_instance, int32_t voltageMic_mV, int32_t voltageCurrentSensor_mV)
+{
+  cmock_call_instance->Expected_voltageMic_mV = voltageMic_mV;
+  cmock_call_instance->IgnoreArg_voltageMic_mV = 0;
+  cmock_call_instance->Expected_voltageCurrentSensor_mV = voltageCurrentSensor_mV;
+  cmock_call_instance->IgnoreArg_voltageCurrentSensor_mV = 0;
+}
+
+void PL_CheckStringVoltage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckStringVoltage_CALL_INSTANCE));
+  CMOCK_PL_CheckStringVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckStringVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckStringVoltage_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckStringVoltage_CallInstance, cmock_guts_index);
+  Mock.PL_CheckStringVoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.PL_CheckStringVoltage_IgnoreBool = (char)1;
+}
+
+void PL_CheckStringVoltage_CMockStopIgnore(void)
+{
+  if(Mock.PL_CheckStringVoltage_IgnoreBool)
+    Mock.PL_CheckStringVoltage_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckStringVoltage_CallInstance);
+  Mock.PL_CheckStringVoltage_IgnoreBool = (char)0;
+}
+
+void PL_CheckStringVoltage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int32_t voltageMic_mV, int32_t voltageCurrentSensor_mV, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckStringVoltage_CALL_INSTANCE));
+  CMOCK_PL_CheckStringVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckStringVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckStringVoltage_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckStringVoltage_CallInstance, cmock_guts_index);
+  Mock.PL_CheckStringVoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckStringVoltage(cmock_call_instance, voltageMic_mV, voltageCurrentSensor_mV);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void PL_CheckStringVoltage_AddCallback(CMOCK_PL_CheckStringVoltage_CALLBACK Callback)
+{
+  Mock.PL_CheckStringVoltage_IgnoreBool = (char)0;
+  Mock.PL_CheckStringVoltage_CallbackBool = (char)1;
+  Mock.PL_CheckStringVoltage_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckStringVoltage_Stub(CMOCK_PL_CheckStringVoltage_CALLBACK Callback)
+{
+  Mock.PL_CheckStringVoltage_IgnoreBool = (char)0;
+  Mock.PL_CheckStringVoltage_CallbackBool = (char)0;
+  Mock.PL_CheckStringVoltage_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckStringVoltage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int32_t voltageMic_mV, int32_t voltageCurrentSensor_mV, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckStringVoltage_CALL_INSTANCE));
+  CMOCK_PL_CheckStringVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckStringVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckStringVoltage_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckStringVoltage_CallInstance, cmock_guts_index);
+  Mock.PL_CheckStringVoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckStringVoltage(cmock_call_instance, voltageMic_mV, voltageCurrentSensor_mV);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void PL_CheckStringVoltage_CMockIgnoreArg_voltageMic_mV(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckStringVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckStringVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckStringVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_voltageMic_mV = 1;
+}
+
+void PL_CheckStringVoltage_CMockIgnoreArg_voltageCurrentSensor_mV(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckStringVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckStringVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckStringVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_voltageCurrentSensor_mV = 1;
+}
+
+STD_RETURN_TYPE_e PL_CheckCellvoltage(int16_t baseCellVoltage, int16_t redundancy0CellVoltage, int16_t* pCellVoltage)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_PL_CheckCellvoltage);
+  cmock_call_instance = (CMOCK_PL_CheckCellvoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.PL_CheckCellvoltage_CallInstance);
+  Mock.PL_CheckCellvoltage_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckCellvoltage_CallInstance);
+  if (Mock.PL_CheckCellvoltage_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.PL_CheckCellvoltage_FinalReturn;
+    memcpy((void*)(&Mock.PL_CheckCellvoltage_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.PL_CheckCellvoltage_CallbackBool &&
+      Mock.PL_CheckCellvoltage_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.PL_CheckCellvoltage_CallbackFunctionPointer(baseCellVoltage, redundancy0CellVoltage, pCellVoltage, Mock.PL_CheckCellvoltage_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_baseCellVoltage)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckCellvoltage,CMockString_baseCellVoltage);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_baseCellVoltage, baseCellVoltage, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_redundancy0CellVoltage)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckCellvoltage,CMockString_redundancy0CellVoltage);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_redundancy0CellVoltage, redundancy0CellVoltage, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCellVoltage)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckCellvoltage,CMockString_pCellVoltage);
+    if (cmock_call_instance->Expected_pCellVoltage == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCellVoltage, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_INT16_ARRAY(cmock_call_instance->Expected_pCellVoltage, pCellVoltage, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.PL_CheckCellvoltage_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.PL_CheckCellvoltage_CallbackFunctionPointer(baseCellVoltage, redundancy0CellVoltage, pCellVoltage, Mock.PL_CheckCellvoltage_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCellVoltage_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCellVoltage, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCellVoltage, (void*)cmock_call_instance->ReturnThruPtr_pCellVoltage_Val,
+      cmock_call_instance->ReturnThruPtr_pCellVoltage_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_PL_CheckCellvoltage(CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance, int16_t baseCellVoltage, int16_t redundancy0CellVoltage, int16_t* pCellVoltage);
+void CMockExpectParameters_PL_CheckCellvoltage(CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance, int16_t baseCellVoltage, int16_t redundancy0CellVoltage, int16_t* pCellVoltage)
+{
+  cmock_call_instance->Expected_baseCellVoltage = baseCellVoltage;
+  cmock_call_instance->IgnoreArg_baseCellVoltage = 0;
+  cmock_call_instance->Expected_redundancy0CellVoltage = redundancy0CellVoltage;
+  cmock_call_instance->IgnoreArg_redundancy0CellVoltage = 0;
+  cmock_call_instance->Expected_pCellVoltage = pCellVoltage;
+  cmock_call_instance->IgnoreArg_pCellVoltage = 0;
+  cmock_call_instance->ReturnThruPtr_pCellVoltage_Used = 0;
+}
+
+void PL_CheckCellvoltage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckCellvoltage_CALL_INSTANCE));
+  CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCellvoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckCellvoltage_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckCellvoltage_CallInstance, cmock_guts_index);
+  Mock.PL_CheckCellvoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.PL_CheckCellvoltage_IgnoreBool = (char)1;
+}
+
+void PL_CheckCellvoltage_CMockStopIgnore(void)
+{
+  if(Mock.PL_CheckCellvoltage_IgnoreBool)
+    Mock.PL_CheckCellvoltage_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckCellvoltage_CallInstance);
+  Mock.PL_CheckCellvoltage_IgnoreBool = (char)0;
+}
+
+void PL_CheckCellvoltage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t baseCellVoltage, int16_t redundancy0CellVoltage, int16_t* pCellVoltage, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckCellvoltage_CALL_INSTANCE));
+  CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCellvoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckCellvoltage_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckCellvoltage_CallInstance, cmock_guts_index);
+  Mock.PL_CheckCellvoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckCellvoltage(cmock_call_instance, baseCellVoltage, redundancy0CellVoltage, pCellVoltage);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void PL_CheckCellvoltage_AddCallback(CMOCK_PL_CheckCellvoltage_CALLBACK Callback)
+{
+  Mock.PL_CheckCellvoltage_IgnoreBool = (char)0;
+  Mock.PL_CheckCellvoltage_CallbackBool = (char)1;
+  Mock.PL_CheckCellvoltage_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckCellvoltage_Stub(CMOCK_PL_CheckCellvoltage_CALLBACK Callback)
+{
+  Mock.PL_CheckCellvoltage_IgnoreBool = (char)0;
+  Mock.PL_CheckCellvoltage_CallbackBool = (char)0;
+  Mock.PL_CheckCellvoltage_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckCellvoltage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t baseCellVoltage, int16_t redundancy0CellVoltage, int16_t* pCellVoltage, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckCellvoltage_CALL_INSTANCE));
+  CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCellvoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckCellvoltage_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckCellvoltage_CallInstance, cmock_guts_index);
+  Mock.PL_CheckCellvoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckCellvoltage(cmock_call_instance, baseCellVoltage, redundancy0CellVoltage, pCellVoltage);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void PL_CheckCellvoltage_CMockReturnMemThruPtr_pCellVoltage(UNITY_LINE_TYPE cmock_line, int16_t* pCellVoltage, size_t cmock_size)
+{
+  CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCellvoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckCellvoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCellVoltage_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCellVoltage_Val = pCellVoltage;
+  cmock_call_instance->ReturnThruPtr_pCellVoltage_Size = cmock_size;
+}
+
+void PL_CheckCellvoltage_CMockIgnoreArg_baseCellVoltage(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCellvoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckCellvoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_baseCellVoltage = 1;
+}
+
+void PL_CheckCellvoltage_CMockIgnoreArg_redundancy0CellVoltage(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCellvoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckCellvoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_redundancy0CellVoltage = 1;
+}
+
+void PL_CheckCellvoltage_CMockIgnoreArg_pCellVoltage(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckCellvoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCellvoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckCellvoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCellVoltage = 1;
+}
+
+STD_RETURN_TYPE_e PL_CheckCelltemperature(int16_t baseCelltemperature, int16_t redundancy0Celltemperature, int16_t* pCelltemperature)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_PL_CheckCelltemperature);
+  cmock_call_instance = (CMOCK_PL_CheckCelltemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.PL_CheckCelltemperature_CallInstance);
+  Mock.PL_CheckCelltemperature_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckCelltemperature_CallInstance);
+  if (Mock.PL_CheckCelltemperature_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.PL_CheckCelltemperature_FinalReturn;
+    memcpy((void*)(&Mock.PL_CheckCelltemperature_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.PL_CheckCelltemperature_CallbackBool &&
+      Mock.PL_CheckCelltemperature_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.PL_CheckCelltemperature_CallbackFunctionPointer(baseCelltemperature, redundancy0Celltemperature, pCelltemperature, Mock.PL_CheckCelltemperature_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_baseCelltemperature)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckCelltemperature,CMockString_baseCelltemperature);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_baseCelltemperature, baseCelltemperature, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_redundancy0Celltemperature)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckCelltemperature,CMockString_redundancy0Celltemperature);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_redundancy0Celltemperature, redundancy0Celltemperature, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCelltemperature)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckCelltemperature,CMockString_pCelltemperature);
+    if (cmock_call_instance->Expected_pCelltemperature == NULL)
+      { UNITY_TEST_ASSERT_NULL(pCelltemperature, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_INT16_ARRAY(cmock_call_instance->Expected_pCelltemperature, pCelltemperature, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (Mock.PL_CheckCelltemperature_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.PL_CheckCelltemperature_CallbackFunctionPointer(baseCelltemperature, redundancy0Celltemperature, pCelltemperature, Mock.PL_CheckCelltemperature_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCelltemperature_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCelltemperature, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCelltemperature, (void*)cmock_call_instance->ReturnThruPtr_pCelltemperature_Val,
+      cmock_call_instance->ReturnThruPtr_pCelltemperature_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_PL_CheckCelltemperature(CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance, int16_t baseCelltemperature, int16_t redundancy0Celltemperature, int16_t* pCelltemperature);
+void CMockExpectParameters_PL_CheckCelltemperature(CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance, int16_t baseCelltemperature, int16_t redundancy0Celltemperature, int16_t* pCelltemperature)
+{
+  cmock_call_instance->Expected_baseCelltemperature = baseCelltemperature;
+  cmock_call_instance->IgnoreArg_baseCelltemperature = 0;
+  cmock_call_instance->Expected_redundancy0Celltemperature = redundancy0Celltemperature;
+  cmock_call_instance->IgnoreArg_redundancy0Celltemperature = 0;
+  cmock_call_instance->Expected_pCelltemperature = pCelltemperature;
+  cmock_call_instance->IgnoreArg_pCelltemperature = 0;
+  cmock_call_instance->ReturnThruPtr_pCelltemperature_Used = 0;
+}
+
+void PL_CheckCelltemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckCelltemperature_CALL_INSTANCE));
+  CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCelltemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckCelltemperature_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckCelltemperature_CallInstance, cmock_guts_index);
+  Mock.PL_CheckCelltemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.PL_CheckCelltemperature_IgnoreBool = (char)1;
+}
+
+void PL_CheckCelltemperature_CMockStopIgnore(void)
+{
+  if(Mock.PL_CheckCelltemperature_IgnoreBool)
+    Mock.PL_CheckCelltemperature_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckCelltemperature_CallInstance);
+  Mock.PL_CheckCelltemperature_IgnoreBool = (char)0;
+}
+
+void PL_CheckCelltemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t baseCelltemperature, int16_t redundancy0Celltemperature, int16_t* pCelltemperature, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckCelltemperature_CALL_INSTANCE));
+  CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCelltemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckCelltemperature_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckCelltemperature_CallInstance, cmock_guts_index);
+  Mock.PL_CheckCelltemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckCelltemperature(cmock_call_instance, baseCelltemperature, redundancy0Celltemperature, pCelltemperature);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void PL_CheckCelltemperature_AddCallback(CMOCK_PL_CheckCelltemperature_CALLBACK Callback)
+{
+  Mock.PL_CheckCelltemperature_IgnoreBool = (char)0;
+  Mock.PL_CheckCelltemperature_CallbackBool = (char)1;
+  Mock.PL_CheckCelltemperature_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckCelltemperature_Stub(CMOCK_PL_CheckCelltemperature_CALLBACK Callback)
+{
+  Mock.PL_CheckCelltemperature_IgnoreBool = (char)0;
+  Mock.PL_CheckCelltemperature_CallbackBool = (char)0;
+  Mock.PL_CheckCelltemperature_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckCelltemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t baseCelltemperature, int16_t redundancy0Celltemperature, int16_t* pCelltemperature, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckCelltemperature_CALL_INSTANCE));
+  CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCelltemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckCelltemperature_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckCelltemperature_CallInstance, cmock_guts_index);
+  Mock.PL_CheckCelltemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckCelltemperature(cmock_call_instance, baseCelltemperature, redundancy0Celltemperature, pCelltemperature);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void PL_CheckCelltemperature_CMockReturnMemThruPtr_pCelltemperature(UNITY_LINE_TYPE cmock_line, int16_t* pCelltemperature, size_t cmock_size)
+{
+  CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCelltemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckCelltemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCelltemperature_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCelltemperature_Val = pCelltemperature;
+  cmock_call_instance->ReturnThruPtr_pCelltemperature_Size = cmock_size;
+}
+
+void PL_CheckCelltemperature_CMockIgnoreArg_baseCelltemperature(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCelltemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckCelltemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_baseCelltemperature = 1;
+}
+
+void PL_CheckCelltemperature_CMockIgnoreArg_redundancy0Celltemperature(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCelltemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckCelltemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_redundancy0Celltemperature = 1;
+}
+
+void PL_CheckCelltemperature_CMockIgnoreArg_pCelltemperature(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckCelltemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckCelltemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckCelltemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCelltemperature = 1;
+}
+
+STD_RETURN_TYPE_e PL_CheckVoltageSpread(DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_PL_CheckVoltageSpread);
+  cmock_call_instance = (CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.PL_CheckVoltageSpread_CallInstance);
+  Mock.PL_CheckVoltageSpread_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckVoltageSpread_CallInstance);
+  if (Mock.PL_CheckVoltageSpread_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.PL_CheckVoltageSpread_FinalReturn;
+    memcpy((void*)(&Mock.PL_CheckVoltageSpread_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.PL_CheckVoltageSpread_CallbackBool &&
+      Mock.PL_CheckVoltageSpread_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.PL_CheckVoltageSpread_CallbackFunctionPointer(pCellvoltages, pMinMaxAverageValues, Mock.PL_CheckVoltageSpread_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pCellvoltages)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckVoltageSpread,CMockString_pCellvoltages);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pCellvoltages), (void*)(pCellvoltages), sizeof(DATA_BLOCK_CELL_VOLTAGE_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pMinMaxAverageValues)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckVoltageSpread,CMockString_pMinMaxAverageValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pMinMaxAverageValues), (void*)(pMinMaxAverageValues), sizeof(DATA_BLOCK_MIN_MAX_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.PL_CheckVoltageSpread_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.PL_CheckVoltageSpread_CallbackFunctionPointer(pCellvoltages, pMinMaxAverageValues, Mock.PL_CheckVoltageSpread_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCellvoltages_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCellvoltages, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCellvoltages, (void*)cmock_call_instance->ReturnThruPtr_pCellvoltages_Val,
+      cmock_call_instance->ReturnThruPtr_pCellvoltages_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMinMaxAverageValues, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMinMaxAverageValues, (void*)cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Val,
+      cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_PL_CheckVoltageSpread(CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues);
+void CMockExpectParameters_PL_CheckVoltageSpread(CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues)
+{
+  cmock_call_instance->Expected_pCellvoltages = pCellvoltages;
+  cmock_call_instance->IgnoreArg_pCellvoltages = 0;
+  cmock_call_instance->ReturnThruPtr_pCellvoltages_Used = 0;
+  cmock_call_instance->Expected_pMinMaxAverageValues = pMinMaxAverageValues;
+  cmock_call_instance->IgnoreArg_pMinMaxAverageValues = 0;
+  cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Used = 0;
+}
+
+void PL_CheckVoltageSpread_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE));
+  CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckVoltageSpread_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckVoltageSpread_CallInstance, cmock_guts_index);
+  Mock.PL_CheckVoltageSpread_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.PL_CheckVoltageSpread_IgnoreBool = (char)1;
+}
+
+void PL_CheckVoltageSpread_CMockStopIgnore(void)
+{
+  if(Mock.PL_CheckVoltageSpread_IgnoreBool)
+    Mock.PL_CheckVoltageSpread_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckVoltageSpread_CallInstance);
+  Mock.PL_CheckVoltageSpread_IgnoreBool = (char)0;
+}
+
+void PL_CheckVoltageSpread_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE));
+  CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckVoltageSpread_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckVoltageSpread_CallInstance, cmock_guts_index);
+  Mock.PL_CheckVoltageSpread_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckVoltageSpread(cmock_call_instance, pCellvoltages, pMinMaxAverageValues);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void PL_CheckVoltageSpread_AddCallback(CMOCK_PL_CheckVoltageSpread_CALLBACK Callback)
+{
+  Mock.PL_CheckVoltageSpread_IgnoreBool = (char)0;
+  Mock.PL_CheckVoltageSpread_CallbackBool = (char)1;
+  Mock.PL_CheckVoltageSpread_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckVoltageSpread_Stub(CMOCK_PL_CheckVoltageSpread_CALLBACK Callback)
+{
+  Mock.PL_CheckVoltageSpread_IgnoreBool = (char)0;
+  Mock.PL_CheckVoltageSpread_CallbackBool = (char)0;
+  Mock.PL_CheckVoltageSpread_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckVoltageSpread_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE));
+  CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckVoltageSpread_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckVoltageSpread_CallInstance, cmock_guts_index);
+  Mock.PL_CheckVoltageSpread_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckVoltageSpread(cmock_call_instance, pCellvoltages, pMinMaxAverageValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void PL_CheckVoltageSpread_CMockReturnMemThruPtr_pCellvoltages(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, size_t cmock_size)
+{
+  CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckVoltageSpread_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCellvoltages_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCellvoltages_Val = pCellvoltages;
+  cmock_call_instance->ReturnThruPtr_pCellvoltages_Size = cmock_size;
+}
+
+void PL_CheckVoltageSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, size_t cmock_size)
+{
+  CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckVoltageSpread_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Val = pMinMaxAverageValues;
+  cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Size = cmock_size;
+}
+
+void PL_CheckVoltageSpread_CMockIgnoreArg_pCellvoltages(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckVoltageSpread_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCellvoltages = 1;
+}
+
+void PL_CheckVoltageSpread_CMockIgnoreArg_pMinMaxAverageValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckVoltageSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckVoltageSpread_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMinMaxAverageValues = 1;
+}
+
+STD_RETURN_TYPE_e PL_CheckTemperatureSpread(DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_PL_CheckTemperatureSpread);
+  cmock_call_instance = (CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.PL_CheckTemperatureSpread_CallInstance);
+  Mock.PL_CheckTemperatureSpread_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckTemperatureSpread_CallInstance);
+  if (Mock.PL_CheckTemperatureSpread_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.PL_CheckTemperatureSpread_FinalReturn;
+    memcpy((void*)(&Mock.PL_CheckTemperatureSpread_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.PL_CheckTemperatureSpread_CallbackBool &&
+      Mock.PL_CheckTemperatureSpread_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.PL_CheckTemperatureSpread_CallbackFunctionPointer(pCellTemperatures, pMinMaxAverageValues, Mock.PL_CheckTemperatureSpread_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pCellTemperatures)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckTemperatureSpread,CMockString_pCellTemperatures);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pCellTemperatures), (void*)(pCellTemperatures), sizeof(DATA_BLOCK_CELL_TEMPERATURE_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pMinMaxAverageValues)
+  {
+    UNITY_SET_DETAILS(CMockString_PL_CheckTemperatureSpread,CMockString_pMinMaxAverageValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pMinMaxAverageValues), (void*)(pMinMaxAverageValues), sizeof(DATA_BLOCK_MIN_MAX_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.PL_CheckTemperatureSpread_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.PL_CheckTemperatureSpread_CallbackFunctionPointer(pCellTemperatures, pMinMaxAverageValues, Mock.PL_CheckTemperatureSpread_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCellTemperatures_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCellTemperatures, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCellTemperatures, (void*)cmock_call_instance->ReturnThruPtr_pCellTemperatures_Val,
+      cmock_call_instance->ReturnThruPtr_pCellTemperatures_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pMinMaxAverageValues, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pMinMaxAverageValues, (void*)cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Val,
+      cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_PL_CheckTemperatureSpread(CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues);
+void CMockExpectParameters_PL_CheckTemperatureSpread(CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance, DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues)
+{
+  cmock_call_instance->Expected_pCellTemperatures = pCellTemperatures;
+  cmock_call_instance->IgnoreArg_pCellTemperatures = 0;
+  cmock_call_instance->ReturnThruPtr_pCellTemperatures_Used = 0;
+  cmock_call_instance->Expected_pMinMaxAverageValues = pMinMaxAverageValues;
+  cmock_call_instance->IgnoreArg_pMinMaxAverageValues = 0;
+  cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Used = 0;
+}
+
+void PL_CheckTemperatureSpread_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE));
+  CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckTemperatureSpread_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckTemperatureSpread_CallInstance, cmock_guts_index);
+  Mock.PL_CheckTemperatureSpread_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.PL_CheckTemperatureSpread_IgnoreBool = (char)1;
+}
+
+void PL_CheckTemperatureSpread_CMockStopIgnore(void)
+{
+  if(Mock.PL_CheckTemperatureSpread_IgnoreBool)
+    Mock.PL_CheckTemperatureSpread_CallInstance = CMock_Guts_MemNext(Mock.PL_CheckTemperatureSpread_CallInstance);
+  Mock.PL_CheckTemperatureSpread_IgnoreBool = (char)0;
+}
+
+void PL_CheckTemperatureSpread_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE));
+  CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckTemperatureSpread_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckTemperatureSpread_CallInstance, cmock_guts_index);
+  Mock.PL_CheckTemperatureSpread_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckTemperatureSpread(cmock_call_instance, pCellTemperatures, pMinMaxAverageValues);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void PL_CheckTemperatureSpread_AddCallback(CMOCK_PL_CheckTemperatureSpread_CALLBACK Callback)
+{
+  Mock.PL_CheckTemperatureSpread_IgnoreBool = (char)0;
+  Mock.PL_CheckTemperatureSpread_CallbackBool = (char)1;
+  Mock.PL_CheckTemperatureSpread_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckTemperatureSpread_Stub(CMOCK_PL_CheckTemperatureSpread_CALLBACK Callback)
+{
+  Mock.PL_CheckTemperatureSpread_IgnoreBool = (char)0;
+  Mock.PL_CheckTemperatureSpread_CallbackBool = (char)0;
+  Mock.PL_CheckTemperatureSpread_CallbackFunctionPointer = Callback;
+}
+
+void PL_CheckTemperatureSpread_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE));
+  CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.PL_CheckTemperatureSpread_CallInstance = CMock_Guts_MemChain(Mock.PL_CheckTemperatureSpread_CallInstance, cmock_guts_index);
+  Mock.PL_CheckTemperatureSpread_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_PL_CheckTemperatureSpread(cmock_call_instance, pCellTemperatures, pMinMaxAverageValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pCellTemperatures(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, size_t cmock_size)
+{
+  CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckTemperatureSpread_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCellTemperatures_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCellTemperatures_Val = pCellTemperatures;
+  cmock_call_instance->ReturnThruPtr_pCellTemperatures_Size = cmock_size;
+}
+
+void PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, size_t cmock_size)
+{
+  CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckTemperatureSpread_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Val = pMinMaxAverageValues;
+  cmock_call_instance->ReturnThruPtr_pMinMaxAverageValues_Size = cmock_size;
+}
+
+void PL_CheckTemperatureSpread_CMockIgnoreArg_pCellTemperatures(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckTemperatureSpread_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCellTemperatures = 1;
+}
+
+void PL_CheckTemperatureSpread_CMockIgnoreArg_pMinMaxAverageValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE* cmock_call_instance = (CMOCK_PL_CheckTemperatureSpread_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.PL_CheckTemperatureSpread_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMinMaxAverageValues = 1;
+}
+
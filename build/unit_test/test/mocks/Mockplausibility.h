@@ -0,0 +1,154 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKPLAUSIBILITY_H
+#define _MOCKPLAUSIBILITY_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "plausibility.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockplausibility_Init(void);
+void Mockplausibility_Destroy(void);
+void Mockplausibility_Verify(void);
+
+
+
+
+#define PL_CheckStringVoltage_IgnoreAndReturn(cmock_retval) PL_CheckStringVoltage_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void PL_CheckStringVoltage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define PL_CheckStringVoltage_StopIgnore() PL_CheckStringVoltage_CMockStopIgnore()
+void PL_CheckStringVoltage_CMockStopIgnore(void);
+#define PL_CheckStringVoltage_ExpectAndReturn(voltageMic_mV, voltageCurrentSensor_mV, cmock_retval) PL_CheckStringVoltage_CMockExpectAndReturn(__LINE__, voltageMic_mV, voltageCurrentSensor_mV, cmock_retval)
+void PL_CheckStringVoltage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int32_t voltageMic_mV, int32_t voltageCurrentSensor_mV, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_PL_CheckStringVoltage_CALLBACK)(int32_t voltageMic_mV, int32_t voltageCurrentSensor_mV, int cmock_num_calls);
+void PL_CheckStringVoltage_AddCallback(CMOCK_PL_CheckStringVoltage_CALLBACK Callback);
+void PL_CheckStringVoltage_Stub(CMOCK_PL_CheckStringVoltage_CALLBACK Callback);
+#define PL_CheckStringVoltage_StubWithCallback PL_CheckStringVoltage_Stub
+#define PL_CheckStringVoltage_ExpectAndThrow(voltageMic_mV, voltageCurrentSensor_mV, cmock_to_throw) PL_CheckStringVoltage_CMockExpectAndThrow(__LINE__, voltageMic_mV, voltageCurrentSensor_mV, cmock_to_throw)
+void PL_CheckStringVoltage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int32_t voltageMic_mV, int32_t voltageCurrentSensor_mV, CEXCEPTION_T cmock_to_throw);
+#define PL_CheckStringVoltage_IgnoreArg_voltageMic_mV() PL_CheckStringVoltage_CMockIgnoreArg_voltageMic_mV(__LINE__)
+void PL_CheckStringVoltage_CMockIgnoreArg_voltageMic_mV(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckStringVoltage_IgnoreArg_voltageCurrentSensor_mV() PL_CheckStringVoltage_CMockIgnoreArg_voltageCurrentSensor_mV(__LINE__)
+void PL_CheckStringVoltage_CMockIgnoreArg_voltageCurrentSensor_mV(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckCellvoltage_IgnoreAndReturn(cmock_retval) PL_CheckCellvoltage_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void PL_CheckCellvoltage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define PL_CheckCellvoltage_StopIgnore() PL_CheckCellvoltage_CMockStopIgnore()
+void PL_CheckCellvoltage_CMockStopIgnore(void);
+#define PL_CheckCellvoltage_ExpectAndReturn(baseCellVoltage, redundancy0CellVoltage, pCellVoltage, cmock_retval) PL_CheckCellvoltage_CMockExpectAndReturn(__LINE__, baseCellVoltage, redundancy0CellVoltage, pCellVoltage, cmock_retval)
+void PL_CheckCellvoltage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t baseCellVoltage, int16_t redundancy0CellVoltage, int16_t* pCellVoltage, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_PL_CheckCellvoltage_CALLBACK)(int16_t baseCellVoltage, int16_t redundancy0CellVoltage, int16_t* pCellVoltage, int cmock_num_calls);
+void PL_CheckCellvoltage_AddCallback(CMOCK_PL_CheckCellvoltage_CALLBACK Callback);
+void PL_CheckCellvoltage_Stub(CMOCK_PL_CheckCellvoltage_CALLBACK Callback);
+#define PL_CheckCellvoltage_StubWithCallback PL_CheckCellvoltage_Stub
+#define PL_CheckCellvoltage_ExpectAndThrow(baseCellVoltage, redundancy0CellVoltage, pCellVoltage, cmock_to_throw) PL_CheckCellvoltage_CMockExpectAndThrow(__LINE__, baseCellVoltage, redundancy0CellVoltage, pCellVoltage, cmock_to_throw)
+void PL_CheckCellvoltage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t baseCellVoltage, int16_t redundancy0CellVoltage, int16_t* pCellVoltage, CEXCEPTION_T cmock_to_throw);
+#define PL_CheckCellvoltage_ReturnThruPtr_pCellVoltage(pCellVoltage) PL_CheckCellvoltage_CMockReturnMemThruPtr_pCellVoltage(__LINE__, pCellVoltage, sizeof(int16_t))
+#define PL_CheckCellvoltage_ReturnArrayThruPtr_pCellVoltage(pCellVoltage, cmock_len) PL_CheckCellvoltage_CMockReturnMemThruPtr_pCellVoltage(__LINE__, pCellVoltage, cmock_len * sizeof(*pCellVoltage))
+#define PL_CheckCellvoltage_ReturnMemThruPtr_pCellVoltage(pCellVoltage, cmock_size) PL_CheckCellvoltage_CMockReturnMemThruPtr_pCellVoltage(__LINE__, pCellVoltage, cmock_size)
+void PL_CheckCellvoltage_CMockReturnMemThruPtr_pCellVoltage(UNITY_LINE_TYPE cmock_line, int16_t* pCellVoltage, size_t cmock_size);
+#define PL_CheckCellvoltage_IgnoreArg_baseCellVoltage() PL_CheckCellvoltage_CMockIgnoreArg_baseCellVoltage(__LINE__)
+void PL_CheckCellvoltage_CMockIgnoreArg_baseCellVoltage(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckCellvoltage_IgnoreArg_redundancy0CellVoltage() PL_CheckCellvoltage_CMockIgnoreArg_redundancy0CellVoltage(__LINE__)
+void PL_CheckCellvoltage_CMockIgnoreArg_redundancy0CellVoltage(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckCellvoltage_IgnoreArg_pCellVoltage() PL_CheckCellvoltage_CMockIgnoreArg_pCellVoltage(__LINE__)
+void PL_CheckCellvoltage_CMockIgnoreArg_pCellVoltage(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckCelltemperature_IgnoreAndReturn(cmock_retval) PL_CheckCelltemperature_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void PL_CheckCelltemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define PL_CheckCelltemperature_StopIgnore() PL_CheckCelltemperature_CMockStopIgnore()
+void PL_CheckCelltemperature_CMockStopIgnore(void);
+#define PL_CheckCelltemperature_ExpectAndReturn(baseCelltemperature, redundancy0Celltemperature, pCelltemperature, cmock_retval) PL_CheckCelltemperature_CMockExpectAndReturn(__LINE__, baseCelltemperature, redundancy0Celltemperature, pCelltemperature, cmock_retval)
+void PL_CheckCelltemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t baseCelltemperature, int16_t redundancy0Celltemperature, int16_t* pCelltemperature, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_PL_CheckCelltemperature_CALLBACK)(int16_t baseCelltemperature, int16_t redundancy0Celltemperature, int16_t* pCelltemperature, int cmock_num_calls);
+void PL_CheckCelltemperature_AddCallback(CMOCK_PL_CheckCelltemperature_CALLBACK Callback);
+void PL_CheckCelltemperature_Stub(CMOCK_PL_CheckCelltemperature_CALLBACK Callback);
+#define PL_CheckCelltemperature_StubWithCallback PL_CheckCelltemperature_Stub
+#define PL_CheckCelltemperature_ExpectAndThrow(baseCelltemperature, redundancy0Celltemperature, pCelltemperature, cmock_to_throw) PL_CheckCelltemperature_CMockExpectAndThrow(__LINE__, baseCelltemperature, redundancy0Celltemperature, pCelltemperature, cmock_to_throw)
+void PL_CheckCelltemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t baseCelltemperature, int16_t redundancy0Celltemperature, int16_t* pCelltemperature, CEXCEPTION_T cmock_to_throw);
+#define PL_CheckCelltemperature_ReturnThruPtr_pCelltemperature(pCelltemperature) PL_CheckCelltemperature_CMockReturnMemThruPtr_pCelltemperature(__LINE__, pCelltemperature, sizeof(int16_t))
+#define PL_CheckCelltemperature_ReturnArrayThruPtr_pCelltemperature(pCelltemperature, cmock_len) PL_CheckCelltemperature_CMockReturnMemThruPtr_pCelltemperature(__LINE__, pCelltemperature, cmock_len * sizeof(*pCelltemperature))
+#define PL_CheckCelltemperature_ReturnMemThruPtr_pCelltemperature(pCelltemperature, cmock_size) PL_CheckCelltemperature_CMockReturnMemThruPtr_pCelltemperature(__LINE__, pCelltemperature, cmock_size)
+void PL_CheckCelltemperature_CMockReturnMemThruPtr_pCelltemperature(UNITY_LINE_TYPE cmock_line, int16_t* pCelltemperature, size_t cmock_size);
+#define PL_CheckCelltemperature_IgnoreArg_baseCelltemperature() PL_CheckCelltemperature_CMockIgnoreArg_baseCelltemperature(__LINE__)
+void PL_CheckCelltemperature_CMockIgnoreArg_baseCelltemperature(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckCelltemperature_IgnoreArg_redundancy0Celltemperature() PL_CheckCelltemperature_CMockIgnoreArg_redundancy0Celltemperature(__LINE__)
+void PL_CheckCelltemperature_CMockIgnoreArg_redundancy0Celltemperature(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckCelltemperature_IgnoreArg_pCelltemperature() PL_CheckCelltemperature_CMockIgnoreArg_pCelltemperature(__LINE__)
+void PL_CheckCelltemperature_CMockIgnoreArg_pCelltemperature(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckVoltageSpread_IgnoreAndReturn(cmock_retval) PL_CheckVoltageSpread_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void PL_CheckVoltageSpread_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define PL_CheckVoltageSpread_StopIgnore() PL_CheckVoltageSpread_CMockStopIgnore()
+void PL_CheckVoltageSpread_CMockStopIgnore(void);
+#define PL_CheckVoltageSpread_ExpectAndReturn(pCellvoltages, pMinMaxAverageValues, cmock_retval) PL_CheckVoltageSpread_CMockExpectAndReturn(__LINE__, pCellvoltages, pMinMaxAverageValues, cmock_retval)
+void PL_CheckVoltageSpread_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_PL_CheckVoltageSpread_CALLBACK)(DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, int cmock_num_calls);
+void PL_CheckVoltageSpread_AddCallback(CMOCK_PL_CheckVoltageSpread_CALLBACK Callback);
+void PL_CheckVoltageSpread_Stub(CMOCK_PL_CheckVoltageSpread_CALLBACK Callback);
+#define PL_CheckVoltageSpread_StubWithCallback PL_CheckVoltageSpread_Stub
+#define PL_CheckVoltageSpread_ExpectAndThrow(pCellvoltages, pMinMaxAverageValues, cmock_to_throw) PL_CheckVoltageSpread_CMockExpectAndThrow(__LINE__, pCellvoltages, pMinMaxAverageValues, cmock_to_throw)
+void PL_CheckVoltageSpread_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, CEXCEPTION_T cmock_to_throw);
+#define PL_CheckVoltageSpread_ReturnThruPtr_pCellvoltages(pCellvoltages) PL_CheckVoltageSpread_CMockReturnMemThruPtr_pCellvoltages(__LINE__, pCellvoltages, sizeof(DATA_BLOCK_CELL_VOLTAGE_s))
+#define PL_CheckVoltageSpread_ReturnArrayThruPtr_pCellvoltages(pCellvoltages, cmock_len) PL_CheckVoltageSpread_CMockReturnMemThruPtr_pCellvoltages(__LINE__, pCellvoltages, cmock_len * sizeof(*pCellvoltages))
+#define PL_CheckVoltageSpread_ReturnMemThruPtr_pCellvoltages(pCellvoltages, cmock_size) PL_CheckVoltageSpread_CMockReturnMemThruPtr_pCellvoltages(__LINE__, pCellvoltages, cmock_size)
+void PL_CheckVoltageSpread_CMockReturnMemThruPtr_pCellvoltages(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_VOLTAGE_s* pCellvoltages, size_t cmock_size);
+#define PL_CheckVoltageSpread_ReturnThruPtr_pMinMaxAverageValues(pMinMaxAverageValues) PL_CheckVoltageSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(__LINE__, pMinMaxAverageValues, sizeof(DATA_BLOCK_MIN_MAX_s))
+#define PL_CheckVoltageSpread_ReturnArrayThruPtr_pMinMaxAverageValues(pMinMaxAverageValues, cmock_len) PL_CheckVoltageSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(__LINE__, pMinMaxAverageValues, cmock_len * sizeof(*pMinMaxAverageValues))
+#define PL_CheckVoltageSpread_ReturnMemThruPtr_pMinMaxAverageValues(pMinMaxAverageValues, cmock_size) PL_CheckVoltageSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(__LINE__, pMinMaxAverageValues, cmock_size)
+void PL_CheckVoltageSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, size_t cmock_size);
+#define PL_CheckVoltageSpread_IgnoreArg_pCellvoltages() PL_CheckVoltageSpread_CMockIgnoreArg_pCellvoltages(__LINE__)
+void PL_CheckVoltageSpread_CMockIgnoreArg_pCellvoltages(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckVoltageSpread_IgnoreArg_pMinMaxAverageValues() PL_CheckVoltageSpread_CMockIgnoreArg_pMinMaxAverageValues(__LINE__)
+void PL_CheckVoltageSpread_CMockIgnoreArg_pMinMaxAverageValues(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckTemperatureSpread_IgnoreAndReturn(cmock_retval) PL_CheckTemperatureSpread_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void PL_CheckTemperatureSpread_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define PL_CheckTemperatureSpread_StopIgnore() PL_CheckTemperatureSpread_CMockStopIgnore()
+void PL_CheckTemperatureSpread_CMockStopIgnore(void);
+#define PL_CheckTemperatureSpread_ExpectAndReturn(pCellTemperatures, pMinMaxAverageValues, cmock_retval) PL_CheckTemperatureSpread_CMockExpectAndReturn(__LINE__, pCellTemperatures, pMinMaxAverageValues, cmock_retval)
+void PL_CheckTemperatureSpread_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_PL_CheckTemperatureSpread_CALLBACK)(DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, int cmock_num_calls);
+void PL_CheckTemperatureSpread_AddCallback(CMOCK_PL_CheckTemperatureSpread_CALLBACK Callback);
+void PL_CheckTemperatureSpread_Stub(CMOCK_PL_CheckTemperatureSpread_CALLBACK Callback);
+#define PL_CheckTemperatureSpread_StubWithCallback PL_CheckTemperatureSpread_Stub
+#define PL_CheckTemperatureSpread_ExpectAndThrow(pCellTemperatures, pMinMaxAverageValues, cmock_to_throw) PL_CheckTemperatureSpread_CMockExpectAndThrow(__LINE__, pCellTemperatures, pMinMaxAverageValues, cmock_to_throw)
+void PL_CheckTemperatureSpread_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, CEXCEPTION_T cmock_to_throw);
+#define PL_CheckTemperatureSpread_ReturnThruPtr_pCellTemperatures(pCellTemperatures) PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pCellTemperatures(__LINE__, pCellTemperatures, sizeof(DATA_BLOCK_CELL_TEMPERATURE_s))
+#define PL_CheckTemperatureSpread_ReturnArrayThruPtr_pCellTemperatures(pCellTemperatures, cmock_len) PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pCellTemperatures(__LINE__, pCellTemperatures, cmock_len * sizeof(*pCellTemperatures))
+#define PL_CheckTemperatureSpread_ReturnMemThruPtr_pCellTemperatures(pCellTemperatures, cmock_size) PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pCellTemperatures(__LINE__, pCellTemperatures, cmock_size)
+void PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pCellTemperatures(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_CELL_TEMPERATURE_s* pCellTemperatures, size_t cmock_size);
+#define PL_CheckTemperatureSpread_ReturnThruPtr_pMinMaxAverageValues(pMinMaxAverageValues) PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(__LINE__, pMinMaxAverageValues, sizeof(DATA_BLOCK_MIN_MAX_s))
+#define PL_CheckTemperatureSpread_ReturnArrayThruPtr_pMinMaxAverageValues(pMinMaxAverageValues, cmock_len) PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(__LINE__, pMinMaxAverageValues, cmock_len * sizeof(*pMinMaxAverageValues))
+#define PL_CheckTemperatureSpread_ReturnMemThruPtr_pMinMaxAverageValues(pMinMaxAverageValues, cmock_size) PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(__LINE__, pMinMaxAverageValues, cmock_size)
+void PL_CheckTemperatureSpread_CMockReturnMemThruPtr_pMinMaxAverageValues(UNITY_LINE_TYPE cmock_line, DATA_BLOCK_MIN_MAX_s* pMinMaxAverageValues, size_t cmock_size);
+#define PL_CheckTemperatureSpread_IgnoreArg_pCellTemperatures() PL_CheckTemperatureSpread_CMockIgnoreArg_pCellTemperatures(__LINE__)
+void PL_CheckTemperatureSpread_CMockIgnoreArg_pCellTemperatures(UNITY_LINE_TYPE cmock_line);
+#define PL_CheckTemperatureSpread_IgnoreArg_pMinMaxAverageValues() PL_CheckTemperatureSpread_CMockIgnoreArg_pMinMaxAverageValues(__LINE__)
+void PL_CheckTemperatureSpread_CMockIgnoreArg_pMinMaxAverageValues(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
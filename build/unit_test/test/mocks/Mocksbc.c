@@ -0,0 +1,565 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mocksbc.h"
+
+static const char* CMockString_SBC_GetState = "SBC_GetState";
+static const char* CMockString_SBC_SetStateRequest = "SBC_SetStateRequest";
+static const char* CMockString_SBC_Trigger = "SBC_Trigger";
+static const char* CMockString_pInstance = "pInstance";
+static const char* CMockString_stateRequest = "stateRequest";
+
+typedef struct _CMOCK_SBC_SetStateRequest_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  SBC_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SBC_STATE_s* Expected_pInstance;
+  SBC_STATE_REQUEST_e Expected_stateRequest;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pInstance_Used;
+  SBC_STATE_s* ReturnThruPtr_pInstance_Val;
+  size_t ReturnThruPtr_pInstance_Size;
+  char IgnoreArg_pInstance;
+  char IgnoreArg_stateRequest;
+
+} CMOCK_SBC_SetStateRequest_CALL_INSTANCE;
+
+typedef struct _CMOCK_SBC_GetState_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  SBC_STATEMACHINE_e ReturnVal;
+  int CallOrder;
+  SBC_STATE_s* Expected_pInstance;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pInstance_Used;
+  SBC_STATE_s* ReturnThruPtr_pInstance_Val;
+  size_t ReturnThruPtr_pInstance_Size;
+  char IgnoreArg_pInstance;
+
+} CMOCK_SBC_GetState_CALL_INSTANCE;
+
+typedef struct _CMOCK_SBC_Trigger_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  SBC_STATE_s* Expected_pInstance;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pInstance_Used;
+  SBC_STATE_s* ReturnThruPtr_pInstance_Val;
+  size_t ReturnThruPtr_pInstance_Size;
+  char IgnoreArg_pInstance;
+
+} CMOCK_SBC_Trigger_CALL_INSTANCE;
+
+static struct MocksbcInstance
+{
+  char SBC_SetStateRequest_IgnoreBool;
+  SBC_RETURN_TYPE_e SBC_SetStateRequest_FinalReturn;
+  char SBC_SetStateRequest_CallbackBool;
+  CMOCK_SBC_SetStateRequest_CALLBACK SBC_SetStateRequest_CallbackFunctionPointer;
+  int SBC_SetStateRequest_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SBC_SetStateRequest_CallInstance;
+  char SBC_GetState_IgnoreBool;
+  SBC_STATEMACHINE_e SBC_GetState_FinalReturn;
+  char SBC_GetState_CallbackBool;
+  CMOCK_SBC_GetState_CALLBACK SBC_GetState_CallbackFunctionPointer;
+  int SBC_GetState_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SBC_GetState_CallInstance;
+  char SBC_Trigger_IgnoreBool;
+  char SBC_Trigger_CallbackBool;
+  CMOCK_SBC_Trigger_CALLBACK SBC_Trigger_CallbackFunctionPointer;
+  int SBC_Trigger_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SBC_Trigger_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mocksbc_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.SBC_SetStateRequest_CallInstance;
+  if (Mock.SBC_SetStateRequest_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SBC_SetStateRequest);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SBC_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SBC_GetState_CallInstance;
+  if (Mock.SBC_GetState_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SBC_GetState);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SBC_GetState_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SBC_Trigger_CallInstance;
+  if (Mock.SBC_Trigger_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SBC_Trigger);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SBC_Trigger_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mocksbc_Init(void)
+{
+  Mocksbc_Destroy();
+}
+
+void Mocksbc_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+SBC_RETURN_TYPE_e SBC_SetStateRequest(SBC_STATE_s* pInstance, SBC_STATE_REQUEST_e stateRequest)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SBC_SetStateRequest_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SBC_SetStateRequest);
+  cmock_call_instance = (CMOCK_SBC_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SBC_SetStateRequest_CallInstance);
+  Mock.SBC_SetStateRequest_CallInstance = CMock_Guts_MemNext(Mock.SBC_SetStateRequest_CallInstance);
+  if (Mock.SBC_SetStateRequest_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SBC_SetStateRequest_FinalReturn;
+    memcpy((void*)(&Mock.SBC_SetStateRequest_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(SBC_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(SBC_RETURN_TYPE_e) ? 1 : -1])); /* add SBC_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SBC_SetStateRequest_CallbackBool &&
+      Mock.SBC_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    SBC_RETURN_TYPE_e cmock_cb_ret = Mock.SBC_SetStateRequest_CallbackFunctionPointer(pInstance, stateRequest, Mock.SBC_SetStateRequest_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pInstance)
+  {
+    UNITY_SET_DETAILS(CMockString_SBC_SetStateRequest,CMockString_pInstance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pInstance), (void*)(pInstance), sizeof(SBC_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_stateRequest)
+  {
+    UNITY_SET_DETAILS(CMockString_SBC_SetStateRequest,CMockString_stateRequest);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_stateRequest), (void*)(&stateRequest), sizeof(SBC_STATE_REQUEST_e), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SBC_SetStateRequest_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SBC_SetStateRequest_CallbackFunctionPointer(pInstance, stateRequest, Mock.SBC_SetStateRequest_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pInstance_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pInstance, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pInstance, (void*)cmock_call_instance->ReturnThruPtr_pInstance_Val,
+      cmock_call_instance->ReturnThruPtr_pInstance_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SBC_SetStateRequest(CMOCK_SBC_SetStateRequest_CALL_INSTANCE* cmock_call_instance, SBC_STATE_s* pInstance, SBC_STATE_REQUEST_e stateRequest);
+void CMockExpectParameters_SBC_SetStateRequest(CMOCK_SBC_SetStateRequest_CALL_INSTANCE* cmock_call_instance, SBC_STATE_s* pInstance, SBC_STATE_REQUEST_e stateRequest)
+{
+  cmock_call_instance->Expected_pInstance = pInstance;
+  cmock_call_instance->IgnoreArg_pInstance = 0;
+  cmock_call_instance->ReturnThruPtr_pInstance_Used = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_stateRequest), (void*)(&stateRequest),
+         sizeof(SBC_STATE_REQUEST_e[sizeof(stateRequest) == sizeof(SBC_STATE_REQUEST_e) ? 1 : -1])); /* add SBC_STATE_REQUEST_e to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_stateRequest = 0;
+}
+
+void SBC_SetStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, SBC_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SBC_SetStateRequest_CALL_INSTANCE));
+  CMOCK_SBC_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SBC_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.SBC_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.SBC_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SBC_SetStateRequest_IgnoreBool = (char)1;
+}
+
+void SBC_SetStateRequest_CMockStopIgnore(void)
+{
+  if(Mock.SBC_SetStateRequest_IgnoreBool)
+    Mock.SBC_SetStateRequest_CallInstance = CMock_Guts_MemNext(Mock.SBC_SetStateRequest_CallInstance);
+  Mock.SBC_SetStateRequest_IgnoreBool = (char)0;
+}
+
+void SBC_SetStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, SBC_STATE_REQUEST_e stateRequest, SBC_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SBC_SetStateRequest_CALL_INSTANCE));
+  CMOCK_SBC_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SBC_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.SBC_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.SBC_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SBC_SetStateRequest(cmock_call_instance, pInstance, stateRequest);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(SBC_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(SBC_RETURN_TYPE_e) ? 1 : -1])); /* add SBC_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SBC_SetStateRequest_AddCallback(CMOCK_SBC_SetStateRequest_CALLBACK Callback)
+{
+  Mock.SBC_SetStateRequest_IgnoreBool = (char)0;
+  Mock.SBC_SetStateRequest_CallbackBool = (char)1;
+  Mock.SBC_SetStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void SBC_SetStateRequest_Stub(CMOCK_SBC_SetStateRequest_CALLBACK Callback)
+{
+  Mock.SBC_SetStateRequest_IgnoreBool = (char)0;
+  Mock.SBC_SetStateRequest_CallbackBool = (char)0;
+  Mock.SBC_SetStateRequest_CallbackFunctionPointer = Callback;
+}
+
+void SBC_SetStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, SBC_STATE_REQUEST_e stateRequest, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SBC_SetStateRequest_CALL_INSTANCE));
+  CMOCK_SBC_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SBC_SetStateRequest_CallInstance = CMock_Guts_MemChain(Mock.SBC_SetStateRequest_CallInstance, cmock_guts_index);
+  Mock.SBC_SetStateRequest_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SBC_SetStateRequest(cmock_call_instance, pInstance, stateRequest);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SBC_SetStateRequest_CMockReturnMemThruPtr_pInstance(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, size_t cmock_size)
+{
+  CMOCK_SBC_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SBC_SetStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pInstance_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pInstance_Val = pInstance;
+  cmock_call_instance->ReturnThruPtr_pInstance_Size = cmock_size;
+}
+
+void SBC_SetStateRequest_CMockIgnoreArg_pInstance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SBC_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SBC_SetStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pInstance = 1;
+}
+
+void SBC_SetStateRequest_CMockIgnoreArg_stateRequest(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SBC_SetStateRequest_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_SetStateRequest_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SBC_SetStateRequest_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stateRequest = 1;
+}
+
+SBC_STATEMACHINE_e SBC_GetState(SBC_STATE_s* pInstance)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SBC_GetState_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SBC_GetState);
+  cmock_call_instance = (CMOCK_SBC_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SBC_GetState_CallInstance);
+  Mock.SBC_GetState_CallInstance = CMock_Guts_MemNext(Mock.SBC_GetState_CallInstance);
+  if (Mock.SBC_GetState_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SBC_GetState_FinalReturn;
+    memcpy((void*)(&Mock.SBC_GetState_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(SBC_STATEMACHINE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(SBC_STATEMACHINE_e) ? 1 : -1])); /* add SBC_STATEMACHINE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SBC_GetState_CallbackBool &&
+      Mock.SBC_GetState_CallbackFunctionPointer != NULL)
+  {
+    SBC_STATEMACHINE_e cmock_cb_ret = Mock.SBC_GetState_CallbackFunctionPointer(pInstance, Mock.SBC_GetState_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pInstance)
+  {
+    UNITY_SET_DETAILS(CMockString_SBC_GetState,CMockString_pInstance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pInstance), (void*)(pInstance), sizeof(SBC_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SBC_GetState_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SBC_GetState_CallbackFunctionPointer(pInstance, Mock.SBC_GetState_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pInstance_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pInstance, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pInstance, (void*)cmock_call_instance->ReturnThruPtr_pInstance_Val,
+      cmock_call_instance->ReturnThruPtr_pInstance_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SBC_GetState(CMOCK_SBC_GetState_CALL_INSTANCE* cmock_call_instance, SBC_STATE_s* pInstance);
+void CMockExpectParameters_SBC_GetState(CMOCK_SBC_GetState_CALL_INSTANCE* cmock_call_instance, SBC_STATE_s* pInstance)
+{
+  cmock_call_instance->Expected_pInstance = pInstance;
+  cmock_call_instance->IgnoreArg_pInstance = 0;
+  cmock_call_instance->ReturnThruPtr_pInstance_Used = 0;
+}
+
+void SBC_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, SBC_STATEMACHINE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SBC_GetState_CALL_INSTANCE));
+  CMOCK_SBC_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SBC_GetState_CallInstance = CMock_Guts_MemChain(Mock.SBC_GetState_CallInstance, cmock_guts_index);
+  Mock.SBC_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SBC_GetState_IgnoreBool = (char)1;
+}
+
+void SBC_GetState_CMockStopIgnore(void)
+{
+  if(Mock.SBC_GetState_IgnoreBool)
+    Mock.SBC_GetState_CallInstance = CMock_Guts_MemNext(Mock.SBC_GetState_CallInstance);
+  Mock.SBC_GetState_IgnoreBool = (char)0;
+}
+
+void SBC_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, SBC_STATEMACHINE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SBC_GetState_CALL_INSTANCE));
+  CMOCK_SBC_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SBC_GetState_CallInstance = CMock_Guts_MemChain(Mock.SBC_GetState_CallInstance, cmock_guts_index);
+  Mock.SBC_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SBC_GetState(cmock_call_instance, pInstance);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(SBC_STATEMACHINE_e[sizeof(cmock_to_return) == sizeof(SBC_STATEMACHINE_e) ? 1 : -1])); /* add SBC_STATEMACHINE_e to :treat_as_array if this causes an error */
+}
+
+void SBC_GetState_AddCallback(CMOCK_SBC_GetState_CALLBACK Callback)
+{
+  Mock.SBC_GetState_IgnoreBool = (char)0;
+  Mock.SBC_GetState_CallbackBool = (char)1;
+  Mock.SBC_GetState_CallbackFunctionPointer = Callback;
+}
+
+void SBC_GetState_Stub(CMOCK_SBC_GetState_CALLBACK Callback)
+{
+  Mock.SBC_GetState_IgnoreBool = (char)0;
+  Mock.SBC_GetState_CallbackBool = (char)0;
+  Mock.SBC_GetState_CallbackFunctionPointer = Callback;
+}
+
+void SBC_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SBC_GetState_CALL_INSTANCE));
+  CMOCK_SBC_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SBC_GetState_CallInstance = CMock_Guts_MemChain(Mock.SBC_GetState_CallInstance, cmock_guts_index);
+  Mock.SBC_GetState_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SBC_GetState(cmock_call_instance, pInstance);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SBC_GetState_CMockReturnMemThruPtr_pInstance(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, size_t cmock_size)
+{
+  CMOCK_SBC_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SBC_GetState_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pInstance_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pInstance_Val = pInstance;
+  cmock_call_instance->ReturnThruPtr_pInstance_Size = cmock_size;
+}
+
+void SBC_GetState_CMockIgnoreArg_pInstance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SBC_GetState_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_GetState_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SBC_GetState_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pInstance = 1;
+}
+
+void SBC_Trigger(SBC_STATE_s* pInstance)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SBC_Trigger_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SBC_Trigger);
+  cmock_call_instance = (CMOCK_SBC_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SBC_Trigger_CallInstance);
+  Mock.SBC_Trigger_CallInstance = CMock_Guts_MemNext(Mock.SBC_Trigger_CallInstance);
+  if (Mock.SBC_Trigger_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SBC_Trigger_CallbackBool &&
+      Mock.SBC_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.SBC_Trigger_CallbackFunctionPointer(pInstance, Mock.SBC_Trigger_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pInstance)
+  {
+    UNITY_SET_DETAILS(CMockString_SBC_Trigger,CMockString_pInstance);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pInstance), (void*)(pInstance), sizeof(SBC_STATE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SBC_Trigger_CallbackFunctionPointer != NULL)
+  {
+    Mock.SBC_Trigger_CallbackFunctionPointer(pInstance, Mock.SBC_Trigger_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pInstance_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pInstance, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pInstance, (void*)cmock_call_instance->ReturnThruPtr_pInstance_Val,
+      cmock_call_instance->ReturnThruPtr_pInstance_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_SBC_Trigger(CMOCK_SBC_Trigger_CALL_INSTANCE* cmock_call_instance, SBC_STATE_s* pInstance);
+void CMockExpectParameters_SBC_Trigger(CMOCK_SBC_Trigger_CALL_INSTANCE* cmock_call_instance, SBC_STATE_s* pInstance)
+{
+  cmock_call_instance->Expected_pInstance = pInstance;
+  cmock_call_instance->IgnoreArg_pInstance = 0;
+  cmock_call_instance->ReturnThruPtr_pInstance_Used = 0;
+}
+
+void SBC_Trigger_CMockIgnore(void)
+{
+  Mock.SBC_Trigger_IgnoreBool = (char)1;
+}
+
+void SBC_Trigger_CMockStopIgnore(void)
+{
+  Mock.SBC_Trigger_IgnoreBool = (char)0;
+}
+
+void SBC_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SBC_Trigger_CALL_INSTANCE));
+  CMOCK_SBC_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SBC_Trigger_CallInstance = CMock_Guts_MemChain(Mock.SBC_Trigger_CallInstance, cmock_guts_index);
+  Mock.SBC_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SBC_Trigger(cmock_call_instance, pInstance);
+}
+
+void SBC_Trigger_AddCallback(CMOCK_SBC_Trigger_CALLBACK Callback)
+{
+  Mock.SBC_Trigger_IgnoreBool = (char)0;
+  Mock.SBC_Trigger_CallbackBool = (char)1;
+  Mock.SBC_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void SBC_Trigger_Stub(CMOCK_SBC_Trigger_CALLBACK Callback)
+{
+  Mock.SBC_Trigger_IgnoreBool = (char)0;
+  Mock.SBC_Trigger_CallbackBool = (char)0;
+  Mock.SBC_Trigger_CallbackFunctionPointer = Callback;
+}
+
+void SBC_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SBC_Trigger_CALL_INSTANCE));
+  CMOCK_SBC_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SBC_Trigger_CallInstance = CMock_Guts_MemChain(Mock.SBC_Trigger_CallInstance, cmock_guts_index);
+  Mock.SBC_Trigger_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SBC_Trigger(cmock_call_instance, pInstance);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SBC_Trigger_CMockReturnMemThruPtr_pInstance(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, size_t cmock_size)
+{
+  CMOCK_SBC_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SBC_Trigger_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pInstance_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pInstance_Val = pInstance;
+  cmock_call_instance->ReturnThruPtr_pInstance_Size = cmock_size;
+}
+
+void SBC_Trigger_CMockIgnoreArg_pInstance(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SBC_Trigger_CALL_INSTANCE* cmock_call_instance = (CMOCK_SBC_Trigger_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SBC_Trigger_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pInstance = 1;
+}
+
@@ -0,0 +1,102 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKSBC_H
+#define _MOCKSBC_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "sbc.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mocksbc_Init(void);
+void Mocksbc_Destroy(void);
+void Mocksbc_Verify(void);
+
+
+
+
+#define SBC_SetStateRequest_IgnoreAndReturn(cmock_retval) SBC_SetStateRequest_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SBC_SetStateRequest_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, SBC_RETURN_TYPE_e cmock_to_return);
+#define SBC_SetStateRequest_StopIgnore() SBC_SetStateRequest_CMockStopIgnore()
+void SBC_SetStateRequest_CMockStopIgnore(void);
+#define SBC_SetStateRequest_ExpectAndReturn(pInstance, stateRequest, cmock_retval) SBC_SetStateRequest_CMockExpectAndReturn(__LINE__, pInstance, stateRequest, cmock_retval)
+void SBC_SetStateRequest_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, SBC_STATE_REQUEST_e stateRequest, SBC_RETURN_TYPE_e cmock_to_return);
+typedef SBC_RETURN_TYPE_e (* CMOCK_SBC_SetStateRequest_CALLBACK)(SBC_STATE_s* pInstance, SBC_STATE_REQUEST_e stateRequest, int cmock_num_calls);
+void SBC_SetStateRequest_AddCallback(CMOCK_SBC_SetStateRequest_CALLBACK Callback);
+void SBC_SetStateRequest_Stub(CMOCK_SBC_SetStateRequest_CALLBACK Callback);
+#define SBC_SetStateRequest_StubWithCallback SBC_SetStateRequest_Stub
+#define SBC_SetStateRequest_ExpectAndThrow(pInstance, stateRequest, cmock_to_throw) SBC_SetStateRequest_CMockExpectAndThrow(__LINE__, pInstance, stateRequest, cmock_to_throw)
+void SBC_SetStateRequest_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, SBC_STATE_REQUEST_e stateRequest, CEXCEPTION_T cmock_to_throw);
+#define SBC_SetStateRequest_ReturnThruPtr_pInstance(pInstance) SBC_SetStateRequest_CMockReturnMemThruPtr_pInstance(__LINE__, pInstance, sizeof(SBC_STATE_s))
+#define SBC_SetStateRequest_ReturnArrayThruPtr_pInstance(pInstance, cmock_len) SBC_SetStateRequest_CMockReturnMemThruPtr_pInstance(__LINE__, pInstance, cmock_len * sizeof(*pInstance))
+#define SBC_SetStateRequest_ReturnMemThruPtr_pInstance(pInstance, cmock_size) SBC_SetStateRequest_CMockReturnMemThruPtr_pInstance(__LINE__, pInstance, cmock_size)
+void SBC_SetStateRequest_CMockReturnMemThruPtr_pInstance(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, size_t cmock_size);
+#define SBC_SetStateRequest_IgnoreArg_pInstance() SBC_SetStateRequest_CMockIgnoreArg_pInstance(__LINE__)
+void SBC_SetStateRequest_CMockIgnoreArg_pInstance(UNITY_LINE_TYPE cmock_line);
+#define SBC_SetStateRequest_IgnoreArg_stateRequest() SBC_SetStateRequest_CMockIgnoreArg_stateRequest(__LINE__)
+void SBC_SetStateRequest_CMockIgnoreArg_stateRequest(UNITY_LINE_TYPE cmock_line);
+#define SBC_GetState_IgnoreAndReturn(cmock_retval) SBC_GetState_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SBC_GetState_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, SBC_STATEMACHINE_e cmock_to_return);
+#define SBC_GetState_StopIgnore() SBC_GetState_CMockStopIgnore()
+void SBC_GetState_CMockStopIgnore(void);
+#define SBC_GetState_ExpectAndReturn(pInstance, cmock_retval) SBC_GetState_CMockExpectAndReturn(__LINE__, pInstance, cmock_retval)
+void SBC_GetState_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, SBC_STATEMACHINE_e cmock_to_return);
+typedef SBC_STATEMACHINE_e (* CMOCK_SBC_GetState_CALLBACK)(SBC_STATE_s* pInstance, int cmock_num_calls);
+void SBC_GetState_AddCallback(CMOCK_SBC_GetState_CALLBACK Callback);
+void SBC_GetState_Stub(CMOCK_SBC_GetState_CALLBACK Callback);
+#define SBC_GetState_StubWithCallback SBC_GetState_Stub
+#define SBC_GetState_ExpectAndThrow(pInstance, cmock_to_throw) SBC_GetState_CMockExpectAndThrow(__LINE__, pInstance, cmock_to_throw)
+void SBC_GetState_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, CEXCEPTION_T cmock_to_throw);
+#define SBC_GetState_ReturnThruPtr_pInstance(pInstance) SBC_GetState_CMockReturnMemThruPtr_pInstance(__LINE__, pInstance, sizeof(SBC_STATE_s))
+#define SBC_GetState_ReturnArrayThruPtr_pInstance(pInstance, cmock_len) SBC_GetState_CMockReturnMemThruPtr_pInstance(__LINE__, pInstance, cmock_len * sizeof(*pInstance))
+#define SBC_GetState_ReturnMemThruPtr_pInstance(pInstance, cmock_size) SBC_GetState_CMockReturnMemThruPtr_pInstance(__LINE__, pInstance, cmock_size)
+void SBC_GetState_CMockReturnMemThruPtr_pInstance(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, size_t cmock_size);
+#define SBC_GetState_IgnoreArg_pInstance() SBC_GetState_CMockIgnoreArg_pInstance(__LINE__)
+void SBC_GetState_CMockIgnoreArg_pInstance(UNITY_LINE_TYPE cmock_line);
+#define SBC_Trigger_Ignore() SBC_Trigger_CMockIgnore()
+void SBC_Trigger_CMockIgnore(void);
+#define SBC_Trigger_StopIgnore() SBC_Trigger_CMockStopIgnore()
+void SBC_Trigger_CMockStopIgnore(void);
+#define SBC_Trigger_Expect(pInstance) SBC_Trigger_CMockExpect(__LINE__, pInstance)
+void SBC_Trigger_CMockExpect(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance);
+typedef void (* CMOCK_SBC_Trigger_CALLBACK)(SBC_STATE_s* pInstance, int cmock_num_calls);
+void SBC_Trigger_AddCallback(CMOCK_SBC_Trigger_CALLBACK Callback);
+void SBC_Trigger_Stub(CMOCK_SBC_Trigger_CALLBACK Callback);
+#define SBC_Trigger_StubWithCallback SBC_Trigger_Stub
+#define SBC_Trigger_ExpectAndThrow(pInstance, cmock_to_throw) SBC_Trigger_CMockExpectAndThrow(__LINE__, pInstance, cmock_to_throw)
+void SBC_Trigger_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, CEXCEPTION_T cmock_to_throw);
+#define SBC_Trigger_ReturnThruPtr_pInstance(pInstance) SBC_Trigger_CMockReturnMemThruPtr_pInstance(__LINE__, pInstance, sizeof(SBC_STATE_s))
+#define SBC_Trigger_ReturnArrayThruPtr_pInstance(pInstance, cmock_len) SBC_Trigger_CMockReturnMemThruPtr_pInstance(__LINE__, pInstance, cmock_len * sizeof(*pInstance))
+#define SBC_Trigger_ReturnMemThruPtr_pInstance(pInstance, cmock_size) SBC_Trigger_CMockReturnMemThruPtr_pInstance(__LINE__, pInstance, cmock_size)
+void SBC_Trigger_CMockReturnMemThruPtr_pInstance(UNITY_LINE_TYPE cmock_line, SBC_STATE_s* pInstance, size_t cmock_size);
+#define SBC_Trigger_IgnoreArg_pInstance() SBC_Trigger_CMockIgnoreArg_pInstance(__LINE__)
+void SBC_Trigger_CMockIgnoreArg_pInstance(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,1384 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mocksof.h"
+
+static const char* CMockString_SOF_Calculation = "SOF_Calculation";
+static const char* CMockString_SOF_Init = "SOF_Init";
+static const char* CMockString_TEST_SOF_CalculateCurves = "TEST_SOF_CalculateCurves";
+static const char* CMockString_TEST_SOF_CalculateTemperatureBasedCurrentLimit = "TEST_SOF_CalculateTemperatureBasedCurrentLimit";
+static const char* CMockString_TEST_SOF_CalculateVoltageBasedCurrentLimit = "TEST_SOF_CalculateVoltageBasedCurrentLimit";
+static const char* CMockString_TEST_SOF_EvaluateCurve = "TEST_SOF_EvaluateCurve";
+static const char* CMockString_TEST_SOF_MinimumOfTwoSofValues = "TEST_SOF_MinimumOfTwoSofValues";
+static const char* CMockString_TEST_SOF_UpdateStringInputs = "TEST_SOF_UpdateStringInputs";
+static const char* CMockString_input = "input";
+static const char* CMockString_maximumCellTemperature_ddegC = "maximumCellTemperature_ddegC";
+static const char* CMockString_maximumCellVoltage_mV = "maximumCellVoltage_mV";
+static const char* CMockString_minimumCellTemperature_ddegC = "minimumCellTemperature_ddegC";
+static const char* CMockString_minimumCellVoltage_mV = "minimumCellVoltage_mV";
+static const char* CMockString_pAllowedTemperatureBasedCurrent = "pAllowedTemperatureBasedCurrent";
+static const char* CMockString_pAllowedVoltageBasedCurrent = "pAllowedVoltageBasedCurrent";
+static const char* CMockString_pCalculatedSofCurves = "pCalculatedSofCurves";
+static const char* CMockString_pConfigurationValues = "pConfigurationValues";
+static const char* CMockString_pCurve = "pCurve";
+static const char* CMockString_pMinimumMaximumValues = "pMinimumMaximumValues";
+static const char* CMockString_stringNumber = "stringNumber";
+static const char* CMockString_temperatureBasedLimits = "temperatureBasedLimits";
+static const char* CMockString_voltageBasedLimits = "voltageBasedLimits";
+
+typedef struct _CMOCK_SOF_Init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_SOF_Init_CALL_INSTANCE;
+
+typedef struct _CMOCK_SOF_Calculation_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_SOF_Calculation_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  const SOF_CONFIG_s* Expected_pConfigurationValues;
+  SOF_CURVE_s* Expected_pCalculatedSofCurves;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pCalculatedSofCurves_Used;
+  SOF_CURVE_s* ReturnThruPtr_pCalculatedSofCurves_Val;
+  size_t ReturnThruPtr_pCalculatedSofCurves_Size;
+  char IgnoreArg_pConfigurationValues;
+  char IgnoreArg_pCalculatedSofCurves;
+
+} CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int32_t ReturnVal;
+  int CallOrder;
+  const SOF_SCALED_CURVE_s* Expected_pCurve;
+  int16_t Expected_input;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_pCurve;
+  char IgnoreArg_input;
+
+} CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int16_t Expected_minimumCellVoltage_mV;
+  int16_t Expected_maximumCellVoltage_mV;
+  SOF_CURRENT_LIMITS_s* Expected_pAllowedVoltageBasedCurrent;
+  const SOF_CURVE_s* Expected_pCalculatedSofCurves;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pAllowedVoltageBasedCurrent_Used;
+  SOF_CURRENT_LIMITS_s* ReturnThruPtr_pAllowedVoltageBasedCurrent_Val;
+  size_t ReturnThruPtr_pAllowedVoltageBasedCurrent_Size;
+  char IgnoreArg_minimumCellVoltage_mV;
+  char IgnoreArg_maximumCellVoltage_mV;
+  char IgnoreArg_pAllowedVoltageBasedCurrent;
+  char IgnoreArg_pCalculatedSofCurves;
+
+} CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  int16_t Expected_minimumCellTemperature_ddegC;
+  int16_t Expected_maximumCellTemperature_ddegC;
+  SOF_CURRENT_LIMITS_s* Expected_pAllowedTemperatureBasedCurrent;
+  const SOF_CURVE_s* Expected_pCalculatedSofCurves;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pAllowedTemperatureBasedCurrent_Used;
+  SOF_CURRENT_LIMITS_s* ReturnThruPtr_pAllowedTemperatureBasedCurrent_Val;
+  size_t ReturnThruPtr_pAllowedTemperatureBasedCurrent_Size;
+  char IgnoreArg_minimumCellTemperature_ddegC;
+  char IgnoreArg_maximumCellTemperature_ddegC;
+  char IgnoreArg_pAllowedTemperatureBasedCurrent;
+  char IgnoreArg_pCalculatedSofCurves;
+
+} CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  SOF_CURRENT_LIMITS_s ReturnVal;
+  int CallOrder;
+  SOF_CURRENT_LIMITS_s Expected_voltageBasedLimits;
+  SOF_CURRENT_LIMITS_s Expected_temperatureBasedLimits;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_voltageBasedLimits;
+  char IgnoreArg_temperatureBasedLimits;
+
+} CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE;
+
+typedef struct _CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  _Bool ReturnVal;
+  int CallOrder;
+  uint8_t Expected_stringNumber;
+  const DATA_BLOCK_MIN_MAX_s* Expected_pMinimumMaximumValues;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_stringNumber;
+  char IgnoreArg_pMinimumMaximumValues;
+
+} CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE;
+
+static struct MocksofInstance
+{
+  char SOF_Init_IgnoreBool;
+  char SOF_Init_CallbackBool;
+  CMOCK_SOF_Init_CALLBACK SOF_Init_CallbackFunctionPointer;
+  int SOF_Init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SOF_Init_CallInstance;
+  char SOF_Calculation_IgnoreBool;
+  char SOF_Calculation_CallbackBool;
+  CMOCK_SOF_Calculation_CALLBACK SOF_Calculation_CallbackFunctionPointer;
+  int SOF_Calculation_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SOF_Calculation_CallInstance;
+  char TEST_SOF_CalculateCurves_IgnoreBool;
+  char TEST_SOF_CalculateCurves_CallbackBool;
+  CMOCK_TEST_SOF_CalculateCurves_CALLBACK TEST_SOF_CalculateCurves_CallbackFunctionPointer;
+  int TEST_SOF_CalculateCurves_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_SOF_CalculateCurves_CallInstance;
+  char TEST_SOF_EvaluateCurve_IgnoreBool;
+  int32_t TEST_SOF_EvaluateCurve_FinalReturn;
+  char TEST_SOF_EvaluateCurve_CallbackBool;
+  CMOCK_TEST_SOF_EvaluateCurve_CALLBACK TEST_SOF_EvaluateCurve_CallbackFunctionPointer;
+  int TEST_SOF_EvaluateCurve_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_SOF_EvaluateCurve_CallInstance;
+  char TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreBool;
+  char TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackBool;
+  CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALLBACK TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackFunctionPointer;
+  int TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance;
+  char TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreBool;
+  char TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackBool;
+  CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALLBACK TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackFunctionPointer;
+  int TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance;
+  char TEST_SOF_MinimumOfTwoSofValues_IgnoreBool;
+  SOF_CURRENT_LIMITS_s TEST_SOF_MinimumOfTwoSofValues_FinalReturn;
+  char TEST_SOF_MinimumOfTwoSofValues_CallbackBool;
+  CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALLBACK TEST_SOF_MinimumOfTwoSofValues_CallbackFunctionPointer;
+  int TEST_SOF_MinimumOfTwoSofValues_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_SOF_MinimumOfTwoSofValues_CallInstance;
+  char TEST_SOF_UpdateStringInputs_IgnoreBool;
+  _Bool TEST_SOF_UpdateStringInputs_FinalReturn;
+  char TEST_SOF_UpdateStringInputs_CallbackBool;
+  CMOCK_TEST_SOF_UpdateStringInputs_CALLBACK TEST_SOF_UpdateStringInputs_CallbackFunctionPointer;
+  int TEST_SOF_UpdateStringInputs_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TEST_SOF_UpdateStringInputs_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mocksof_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.SOF_Init_CallInstance;
+  if (Mock.SOF_Init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SOF_Init);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SOF_Init_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SOF_Calculation_CallInstance;
+  if (Mock.SOF_Calculation_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SOF_Calculation);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SOF_Calculation_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_SOF_CalculateCurves_CallInstance;
+  if (Mock.TEST_SOF_CalculateCurves_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_SOF_CalculateCurves);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_SOF_CalculateCurves_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_SOF_EvaluateCurve_CallInstance;
+  if (Mock.TEST_SOF_EvaluateCurve_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_SOF_EvaluateCurve);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_SOF_EvaluateCurve_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance;
+  if (Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_SOF_CalculateVoltageBasedCurrentLimit);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance;
+  if (Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_SOF_CalculateTemperatureBasedCurrentLimit);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance;
+  if (Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_SOF_MinimumOfTwoSofValues);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TEST_SOF_UpdateStringInputs_CallInstance;
+  if (Mock.TEST_SOF_UpdateStringInputs_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TEST_SOF_UpdateStringInputs);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TEST_SOF_UpdateStringInputs_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mocksof_Init(void)
+{
+  Mocksof_Destroy();
+}
+
+void Mocksof_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void SOF_Init(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SOF_Init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SOF_Init);
+  cmock_call_instance = (CMOCK_SOF_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SOF_Init_CallInstance);
+  Mock.SOF_Init_CallInstance = CMock_Guts_MemNext(Mock.SOF_Init_CallInstance);
+  if (Mock.SOF_Init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SOF_Init_CallbackBool &&
+      Mock.SOF_Init_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOF_Init_CallbackFunctionPointer(Mock.SOF_Init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.SOF_Init_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOF_Init_CallbackFunctionPointer(Mock.SOF_Init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void SOF_Init_CMockIgnore(void)
+{
+  Mock.SOF_Init_IgnoreBool = (char)1;
+}
+
+void SOF_Init_CMockStopIgnore(void)
+{
+  Mock.SOF_Init_IgnoreBool = (char)0;
+}
+
+void SOF_Init_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOF_Init_CALL_INSTANCE));
+  CMOCK_SOF_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOF_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOF_Init_CallInstance = CMock_Guts_MemChain(Mock.SOF_Init_CallInstance, cmock_guts_index);
+  Mock.SOF_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void SOF_Init_AddCallback(CMOCK_SOF_Init_CALLBACK Callback)
+{
+  Mock.SOF_Init_IgnoreBool = (char)0;
+  Mock.SOF_Init_CallbackBool = (char)1;
+  Mock.SOF_Init_CallbackFunctionPointer = Callback;
+}
+
+void SOF_Init_Stub(CMOCK_SOF_Init_CALLBACK Callback)
+{
+  Mock.SOF_Init_IgnoreBool = (char)0;
+  Mock.SOF_Init_CallbackBool = (char)0;
+  Mock.SOF_Init_CallbackFunctionPointer = Callback;
+}
+
+void SOF_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOF_Init_CALL_INSTANCE));
+  CMOCK_SOF_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOF_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOF_Init_CallInstance = CMock_Guts_MemChain(Mock.SOF_Init_CallInstance, cmock_guts_index);
+  Mock.SOF_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SOF_Calculation(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SOF_Calculation_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SOF_Calculation);
+  cmock_call_instance = (CMOCK_SOF_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SOF_Calculation_CallInstance);
+  Mock.SOF_Calculation_CallInstance = CMock_Guts_MemNext(Mock.SOF_Calculation_CallInstance);
+  if (Mock.SOF_Calculation_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SOF_Calculation_CallbackBool &&
+      Mock.SOF_Calculation_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOF_Calculation_CallbackFunctionPointer(Mock.SOF_Calculation_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.SOF_Calculation_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOF_Calculation_CallbackFunctionPointer(Mock.SOF_Calculation_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void SOF_Calculation_CMockIgnore(void)
+{
+  Mock.SOF_Calculation_IgnoreBool = (char)1;
+}
+
+void SOF_Calculation_CMockStopIgnore(void)
+{
+  Mock.SOF_Calculation_IgnoreBool = (char)0;
+}
+
+void SOF_Calculation_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOF_Calculation_CALL_INSTANCE));
+  CMOCK_SOF_Calculation_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOF_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOF_Calculation_CallInstance = CMock_Guts_MemChain(Mock.SOF_Calculation_CallInstance, cmock_guts_index);
+  Mock.SOF_Calculation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void SOF_Calculation_AddCallback(CMOCK_SOF_Calculation_CALLBACK Callback)
+{
+  Mock.SOF_Calculation_IgnoreBool = (char)0;
+  Mock.SOF_Calculation_CallbackBool = (char)1;
+  Mock.SOF_Calculation_CallbackFunctionPointer = Callback;
+}
+
+void SOF_Calculation_Stub(CMOCK_SOF_Calculation_CALLBACK Callback)
+{
+  Mock.SOF_Calculation_IgnoreBool = (char)0;
+  Mock.SOF_Calculation_CallbackBool = (char)0;
+  Mock.SOF_Calculation_CallbackFunctionPointer = Callback;
+}
+
+void SOF_Calculation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOF_Calculation_CALL_INSTANCE));
+  CMOCK_SOF_Calculation_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOF_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOF_Calculation_CallInstance = CMock_Guts_MemChain(Mock.SOF_Calculation_CallInstance, cmock_guts_index);
+  Mock.SOF_Calculation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_SOF_CalculateCurves(const SOF_CONFIG_s* pConfigurationValues, SOF_CURVE_s* pCalculatedSofCurves)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_SOF_CalculateCurves);
+  cmock_call_instance = (CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_SOF_CalculateCurves_CallInstance);
+  Mock.TEST_SOF_CalculateCurves_CallInstance = CMock_Guts_MemNext(Mock.TEST_SOF_CalculateCurves_CallInstance);
+  if (Mock.TEST_SOF_CalculateCurves_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_SOF_CalculateCurves_CallbackBool &&
+      Mock.TEST_SOF_CalculateCurves_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_SOF_CalculateCurves_CallbackFunctionPointer(pConfigurationValues, pCalculatedSofCurves, Mock.TEST_SOF_CalculateCurves_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pConfigurationValues)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateCurves,CMockString_pConfigurationValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pConfigurationValues), (void*)(pConfigurationValues), sizeof(const SOF_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCalculatedSofCurves)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateCurves,CMockString_pCalculatedSofCurves);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pCalculatedSofCurves), (void*)(pCalculatedSofCurves), sizeof(SOF_CURVE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_SOF_CalculateCurves_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_SOF_CalculateCurves_CallbackFunctionPointer(pConfigurationValues, pCalculatedSofCurves, Mock.TEST_SOF_CalculateCurves_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pCalculatedSofCurves_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pCalculatedSofCurves, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pCalculatedSofCurves, (void*)cmock_call_instance->ReturnThruPtr_pCalculatedSofCurves_Val,
+      cmock_call_instance->ReturnThruPtr_pCalculatedSofCurves_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_SOF_CalculateCurves(CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE* cmock_call_instance, const SOF_CONFIG_s* pConfigurationValues, SOF_CURVE_s* pCalculatedSofCurves);
+void CMockExpectParameters_TEST_SOF_CalculateCurves(CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE* cmock_call_instance, const SOF_CONFIG_s* pConfigurationValues, SOF_CURVE_s* pCalculatedSofCurves)
+{
+  cmock_call_instance->Expected_pConfigurationValues = pConfigurationValues;
+  cmock_call_instance->IgnoreArg_pConfigurationValues = 0;
+  cmock_call_instance->Expected_pCalculatedSofCurves = pCalculatedSofCurves;
+  cmock_call_instance->IgnoreArg_pCalculatedSofCurves = 0;
+  cmock_call_instance->ReturnThruPtr_pCalculatedSofCurves_Used = 0;
+}
+
+void TEST_SOF_CalculateCurves_CMockIgnore(void)
+{
+  Mock.TEST_SOF_CalculateCurves_IgnoreBool = (char)1;
+}
+
+void TEST_SOF_CalculateCurves_CMockStopIgnore(void)
+{
+  Mock.TEST_SOF_CalculateCurves_IgnoreBool = (char)0;
+}
+
+void TEST_SOF_CalculateCurves_CMockExpect(UNITY_LINE_TYPE cmock_line, const SOF_CONFIG_s* pConfigurationValues, SOF_CURVE_s* pCalculatedSofCurves)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE));
+  CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_CalculateCurves_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_CalculateCurves_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_CalculateCurves_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_CalculateCurves(cmock_call_instance, pConfigurationValues, pCalculatedSofCurves);
+}
+
+void TEST_SOF_CalculateCurves_AddCallback(CMOCK_TEST_SOF_CalculateCurves_CALLBACK Callback)
+{
+  Mock.TEST_SOF_CalculateCurves_IgnoreBool = (char)0;
+  Mock.TEST_SOF_CalculateCurves_CallbackBool = (char)1;
+  Mock.TEST_SOF_CalculateCurves_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_CalculateCurves_Stub(CMOCK_TEST_SOF_CalculateCurves_CALLBACK Callback)
+{
+  Mock.TEST_SOF_CalculateCurves_IgnoreBool = (char)0;
+  Mock.TEST_SOF_CalculateCurves_CallbackBool = (char)0;
+  Mock.TEST_SOF_CalculateCurves_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_CalculateCurves_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const SOF_CONFIG_s* pConfigurationValues, SOF_CURVE_s* pCalculatedSofCurves, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE));
+  CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_CalculateCurves_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_CalculateCurves_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_CalculateCurves_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_CalculateCurves(cmock_call_instance, pConfigurationValues, pCalculatedSofCurves);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_SOF_CalculateCurves_CMockReturnMemThruPtr_pCalculatedSofCurves(UNITY_LINE_TYPE cmock_line, SOF_CURVE_s* pCalculatedSofCurves, size_t cmock_size)
+{
+  CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateCurves_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pCalculatedSofCurves_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pCalculatedSofCurves_Val = pCalculatedSofCurves;
+  cmock_call_instance->ReturnThruPtr_pCalculatedSofCurves_Size = cmock_size;
+}
+
+void TEST_SOF_CalculateCurves_CMockIgnoreArg_pConfigurationValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateCurves_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pConfigurationValues = 1;
+}
+
+void TEST_SOF_CalculateCurves_CMockIgnoreArg_pCalculatedSofCurves(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateCurves_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateCurves_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCalculatedSofCurves = 1;
+}
+
+int32_t TEST_SOF_EvaluateCurve(const SOF_SCALED_CURVE_s* pCurve, int16_t input)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_SOF_EvaluateCurve);
+  cmock_call_instance = (CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_SOF_EvaluateCurve_CallInstance);
+  Mock.TEST_SOF_EvaluateCurve_CallInstance = CMock_Guts_MemNext(Mock.TEST_SOF_EvaluateCurve_CallInstance);
+  if (Mock.TEST_SOF_EvaluateCurve_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_SOF_EvaluateCurve_FinalReturn;
+    Mock.TEST_SOF_EvaluateCurve_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_SOF_EvaluateCurve_CallbackBool &&
+      Mock.TEST_SOF_EvaluateCurve_CallbackFunctionPointer != NULL)
+  {
+    int32_t cmock_cb_ret = Mock.TEST_SOF_EvaluateCurve_CallbackFunctionPointer(pCurve, input, Mock.TEST_SOF_EvaluateCurve_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pCurve)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_EvaluateCurve,CMockString_pCurve);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pCurve), (void*)(pCurve), sizeof(const SOF_SCALED_CURVE_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_input)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_EvaluateCurve,CMockString_input);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_input, input, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_SOF_EvaluateCurve_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_SOF_EvaluateCurve_CallbackFunctionPointer(pCurve, input, Mock.TEST_SOF_EvaluateCurve_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_SOF_EvaluateCurve(CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE* cmock_call_instance, const SOF_SCALED_CURVE_s* pCurve, int16_t input);
+void CMockExpectParameters_TEST_SOF_EvaluateCurve(CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE* cmock_call_instance, const SOF_SCALED_CURVE_s* pCurve, int16_t input)
+{
+  cmock_call_instance->Expected_pCurve = pCurve;
+  cmock_call_instance->IgnoreArg_pCurve = 0;
+  cmock_call_instance->Expected_input = input;
+  cmock_call_instance->IgnoreArg_input = 0;
+}
+
+void TEST_SOF_EvaluateCurve_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE));
+  CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_EvaluateCurve_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_EvaluateCurve_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_EvaluateCurve_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_SOF_EvaluateCurve_IgnoreBool = (char)1;
+}
+
+void TEST_SOF_EvaluateCurve_CMockStopIgnore(void)
+{
+  if(Mock.TEST_SOF_EvaluateCurve_IgnoreBool)
+    Mock.TEST_SOF_EvaluateCurve_CallInstance = CMock_Guts_MemNext(Mock.TEST_SOF_EvaluateCurve_CallInstance);
+  Mock.TEST_SOF_EvaluateCurve_IgnoreBool = (char)0;
+}
+
+void TEST_SOF_EvaluateCurve_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const SOF_SCALED_CURVE_s* pCurve, int16_t input, int32_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE));
+  CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_EvaluateCurve_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_EvaluateCurve_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_EvaluateCurve_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_EvaluateCurve(cmock_call_instance, pCurve, input);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TEST_SOF_EvaluateCurve_AddCallback(CMOCK_TEST_SOF_EvaluateCurve_CALLBACK Callback)
+{
+  Mock.TEST_SOF_EvaluateCurve_IgnoreBool = (char)0;
+  Mock.TEST_SOF_EvaluateCurve_CallbackBool = (char)1;
+  Mock.TEST_SOF_EvaluateCurve_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_EvaluateCurve_Stub(CMOCK_TEST_SOF_EvaluateCurve_CALLBACK Callback)
+{
+  Mock.TEST_SOF_EvaluateCurve_IgnoreBool = (char)0;
+  Mock.TEST_SOF_EvaluateCurve_CallbackBool = (char)0;
+  Mock.TEST_SOF_EvaluateCurve_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_EvaluateCurve_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const SOF_SCALED_CURVE_s* pCurve, int16_t input, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE));
+  CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_EvaluateCurve_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_EvaluateCurve_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_EvaluateCurve_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_EvaluateCurve(cmock_call_instance, pCurve, input);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_SOF_EvaluateCurve_CMockIgnoreArg_pCurve(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_EvaluateCurve_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCurve = 1;
+}
+
+void TEST_SOF_EvaluateCurve_CMockIgnoreArg_input(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_EvaluateCurve_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_EvaluateCurve_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_input = 1;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit(int16_t minimumCellVoltage_mV, int16_t maximumCellVoltage_mV, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_SOF_CalculateVoltageBasedCurrentLimit);
+  cmock_call_instance = (CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance);
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance = CMock_Guts_MemNext(Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance);
+  if (Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackBool &&
+      Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackFunctionPointer(minimumCellVoltage_mV, maximumCellVoltage_mV, pAllowedVoltageBasedCurrent, pCalculatedSofCurves, Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_minimumCellVoltage_mV)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateVoltageBasedCurrentLimit,CMockString_minimumCellVoltage_mV);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_minimumCellVoltage_mV, minimumCellVoltage_mV, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_maximumCellVoltage_mV)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateVoltageBasedCurrentLimit,CMockString_maximumCellVoltage_mV);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_maximumCellVoltage_mV, maximumCellVoltage_mV, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pAllowedVoltageBasedCurrent)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateVoltageBasedCurrentLimit,CMockString_pAllowedVoltageBasedCurrent);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pAllowedVoltageBasedCurrent), (void*)(pAllowedVoltageBasedCurrent), sizeof(SOF_CURRENT_LIMITS_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCalculatedSofCurves)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateVoltageBasedCurrentLimit,CMockString_pCalculatedSofCurves);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pCalculatedSofCurves), (void*)(pCalculatedSofCurves), sizeof(const SOF_CURVE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackFunctionPointer(minimumCellVoltage_mV, maximumCellVoltage_mV, pAllowedVoltageBasedCurrent, pCalculatedSofCurves, Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pAllowedVoltageBasedCurrent_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pAllowedVoltageBasedCurrent, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pAllowedVoltageBasedCurrent, (void*)cmock_call_instance->ReturnThruPtr_pAllowedVoltageBasedCurrent_Val,
+      cmock_call_instance->ReturnThruPtr_pAllowedVoltageBasedCurrent_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_SOF_CalculateVoltageBasedCurrentLimit(CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance, int16_t minimumCellVoltage_mV, int16_t maximumCellVoltage_mV, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves);
+void CMockExpectParameters_TEST_SOF_CalculateVoltageBasedCurrentLimit(CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance, int16_t minimumCellVoltage_mV, int16_t maximumCellVoltage_mV, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves)
+{
+  cmock_call_instance->Expected_minimumCellVoltage_mV = minimumCellVoltage_mV;
+  cmock_call_instance->IgnoreArg_minimumCellVoltage_mV = 0;
+  cmock_call_instance->Expected_maximumCellVoltage_mV = maximumCellVoltage_mV;
+  cmock_call_instance->IgnoreArg_maximumCellVoltage_mV = 0;
+  cmock_call_instance->Expected_pAllowedVoltageBasedCurrent = pAllowedVoltageBasedCurrent;
+  cmock_call_instance->IgnoreArg_pAllowedVoltageBasedCurrent = 0;
+  cmock_call_instance->ReturnThruPtr_pAllowedVoltageBasedCurrent_Used = 0;
+  cmock_call_instance->Expected_pCalculatedSofCurves = pCalculatedSofCurves;
+  cmock_call_instance->IgnoreArg_pCalculatedSofCurves = 0;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnore(void)
+{
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreBool = (char)1;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockStopIgnore(void)
+{
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreBool = (char)0;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockExpect(UNITY_LINE_TYPE cmock_line, int16_t minimumCellVoltage_mV, int16_t maximumCellVoltage_mV, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE));
+  CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_CalculateVoltageBasedCurrentLimit(cmock_call_instance, minimumCellVoltage_mV, maximumCellVoltage_mV, pAllowedVoltageBasedCurrent, pCalculatedSofCurves);
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_AddCallback(CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALLBACK Callback)
+{
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreBool = (char)0;
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackBool = (char)1;
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_Stub(CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALLBACK Callback)
+{
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreBool = (char)0;
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackBool = (char)0;
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t minimumCellVoltage_mV, int16_t maximumCellVoltage_mV, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE));
+  CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_CalculateVoltageBasedCurrentLimit(cmock_call_instance, minimumCellVoltage_mV, maximumCellVoltage_mV, pAllowedVoltageBasedCurrent, pCalculatedSofCurves);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedVoltageBasedCurrent(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, size_t cmock_size)
+{
+  CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pAllowedVoltageBasedCurrent_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pAllowedVoltageBasedCurrent_Val = pAllowedVoltageBasedCurrent;
+  cmock_call_instance->ReturnThruPtr_pAllowedVoltageBasedCurrent_Size = cmock_size;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_minimumCellVoltage_mV(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_minimumCellVoltage_mV = 1;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_maximumCellVoltage_mV(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_maximumCellVoltage_mV = 1;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_pAllowedVoltageBasedCurrent(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pAllowedVoltageBasedCurrent = 1;
+}
+
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_pCalculatedSofCurves(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateVoltageBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCalculatedSofCurves = 1;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit(int16_t minimumCellTemperature_ddegC, int16_t maximumCellTemperature_ddegC, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_SOF_CalculateTemperatureBasedCurrentLimit);
+  cmock_call_instance = (CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance);
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance = CMock_Guts_MemNext(Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance);
+  if (Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackBool &&
+      Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackFunctionPointer(minimumCellTemperature_ddegC, maximumCellTemperature_ddegC, pAllowedTemperatureBasedCurrent, pCalculatedSofCurves, Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_minimumCellTemperature_ddegC)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateTemperatureBasedCurrentLimit,CMockString_minimumCellTemperature_ddegC);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_minimumCellTemperature_ddegC, minimumCellTemperature_ddegC, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_maximumCellTemperature_ddegC)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateTemperatureBasedCurrentLimit,CMockString_maximumCellTemperature_ddegC);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_maximumCellTemperature_ddegC, maximumCellTemperature_ddegC, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pAllowedTemperatureBasedCurrent)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateTemperatureBasedCurrentLimit,CMockString_pAllowedTemperatureBasedCurrent);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pAllowedTemperatureBasedCurrent), (void*)(pAllowedTemperatureBasedCurrent), sizeof(SOF_CURRENT_LIMITS_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pCalculatedSofCurves)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_CalculateTemperatureBasedCurrentLimit,CMockString_pCalculatedSofCurves);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pCalculatedSofCurves), (void*)(pCalculatedSofCurves), sizeof(const SOF_CURVE_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackFunctionPointer != NULL)
+  {
+    Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackFunctionPointer(minimumCellTemperature_ddegC, maximumCellTemperature_ddegC, pAllowedTemperatureBasedCurrent, pCalculatedSofCurves, Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pAllowedTemperatureBasedCurrent_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pAllowedTemperatureBasedCurrent, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pAllowedTemperatureBasedCurrent, (void*)cmock_call_instance->ReturnThruPtr_pAllowedTemperatureBasedCurrent_Val,
+      cmock_call_instance->ReturnThruPtr_pAllowedTemperatureBasedCurrent_Size);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_TEST_SOF_CalculateTemperatureBasedCurrentLimit(CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance, int16_t minimumCellTemperature_ddegC, int16_t maximumCellTemperature_ddegC, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves);
+void CMockExpectParameters_TEST_SOF_CalculateTemperatureBasedCurrentLimit(CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance, int16_t minimumCellTemperature_ddegC, int16_t maximumCellTemperature_ddegC, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves)
+{
+  cmock_call_instance->Expected_minimumCellTemperature_ddegC = minimumCellTemperature_ddegC;
+  cmock_call_instance->IgnoreArg_minimumCellTemperature_ddegC = 0;
+  cmock_call_instance->Expected_maximumCellTemperature_ddegC = maximumCellTemperature_ddegC;
+  cmock_call_instance->IgnoreArg_maximumCellTemperature_ddegC = 0;
+  cmock_call_instance->Expected_pAllowedTemperatureBasedCurrent = pAllowedTemperatureBasedCurrent;
+  cmock_call_instance->IgnoreArg_pAllowedTemperatureBasedCurrent = 0;
+  cmock_call_instance->ReturnThruPtr_pAllowedTemperatureBasedCurrent_Used = 0;
+  cmock_call_instance->Expected_pCalculatedSofCurves = pCalculatedSofCurves;
+  cmock_call_instance->IgnoreArg_pCalculatedSofCurves = 0;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnore(void)
+{
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreBool = (char)1;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockStopIgnore(void)
+{
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreBool = (char)0;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockExpect(UNITY_LINE_TYPE cmock_line, int16_t minimumCellTemperature_ddegC, int16_t maximumCellTemperature_ddegC, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE));
+  CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_CalculateTemperatureBasedCurrentLimit(cmock_call_instance, minimumCellTemperature_ddegC, maximumCellTemperature_ddegC, pAllowedTemperatureBasedCurrent, pCalculatedSofCurves);
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_AddCallback(CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALLBACK Callback)
+{
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreBool = (char)0;
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackBool = (char)1;
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_Stub(CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALLBACK Callback)
+{
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreBool = (char)0;
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackBool = (char)0;
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t minimumCellTemperature_ddegC, int16_t maximumCellTemperature_ddegC, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE));
+  CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_CalculateTemperatureBasedCurrentLimit(cmock_call_instance, minimumCellTemperature_ddegC, maximumCellTemperature_ddegC, pAllowedTemperatureBasedCurrent, pCalculatedSofCurves);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedTemperatureBasedCurrent(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, size_t cmock_size)
+{
+  CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pAllowedTemperatureBasedCurrent_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pAllowedTemperatureBasedCurrent_Val = pAllowedTemperatureBasedCurrent;
+  cmock_call_instance->ReturnThruPtr_pAllowedTemperatureBasedCurrent_Size = cmock_size;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_minimumCellTemperature_ddegC(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_minimumCellTemperature_ddegC = 1;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_maximumCellTemperature_ddegC(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_maximumCellTemperature_ddegC = 1;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_pAllowedTemperatureBasedCurrent(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pAllowedTemperatureBasedCurrent = 1;
+}
+
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_pCalculatedSofCurves(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_CalculateTemperatureBasedCurrentLimit_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pCalculatedSofCurves = 1;
+}
+
+SOF_CURRENT_LIMITS_s TEST_SOF_MinimumOfTwoSofValues(SOF_CURRENT_LIMITS_s voltageBasedLimits, SOF_CURRENT_LIMITS_s temperatureBasedLimits)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_SOF_MinimumOfTwoSofValues);
+  cmock_call_instance = (CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance);
+  Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance = CMock_Guts_MemNext(Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance);
+  if (Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_SOF_MinimumOfTwoSofValues_FinalReturn;
+    memcpy((void*)(&Mock.TEST_SOF_MinimumOfTwoSofValues_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(SOF_CURRENT_LIMITS_s[sizeof(cmock_call_instance->ReturnVal) == sizeof(SOF_CURRENT_LIMITS_s) ? 1 : -1])); /* add SOF_CURRENT_LIMITS_s to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackBool &&
+      Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackFunctionPointer != NULL)
+  {
+    SOF_CURRENT_LIMITS_s cmock_cb_ret = Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackFunctionPointer(voltageBasedLimits, temperatureBasedLimits, Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_voltageBasedLimits)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_MinimumOfTwoSofValues,CMockString_voltageBasedLimits);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_voltageBasedLimits), (void*)(&voltageBasedLimits), sizeof(SOF_CURRENT_LIMITS_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_temperatureBasedLimits)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_MinimumOfTwoSofValues,CMockString_temperatureBasedLimits);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_temperatureBasedLimits), (void*)(&temperatureBasedLimits), sizeof(SOF_CURRENT_LIMITS_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackFunctionPointer(voltageBasedLimits, temperatureBasedLimits, Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_SOF_MinimumOfTwoSofValues(CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE* cmock_call_instance, SOF_CURRENT_LIMITS_s voltageBasedLimits, SOF_CURRENT_LIMITS_s temperatureBasedLimits);
+void CMockExpectParameters_TEST_SOF_MinimumOfTwoSofValues(CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE* cmock_call_instance, SOF_CURRENT_LIMITS_s voltageBasedLimits, SOF_CURRENT_LIMITS_s temperatureBasedLimits)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_voltageBasedLimits), (void*)(&voltageBasedLimits),
+         sizeof(SOF_CURRENT_LIMITS_s[sizeof(voltageBasedLimits) == sizeof(SOF_CURRENT_LIMITS_s) ? 1 : -1])); /* add SOF_CURRENT_LIMITS_s to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_voltageBasedLimits = 0;
+  memcpy((void*)(&cmock_call_instance->Expected_temperatureBasedLimits), (void*)(&temperatureBasedLimits),
+         sizeof(SOF_CURRENT_LIMITS_s[sizeof(temperatureBasedLimits) == sizeof(SOF_CURRENT_LIMITS_s) ? 1 : -1])); /* add SOF_CURRENT_LIMITS_s to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_temperatureBasedLimits = 0;
+}
+
+void TEST_SOF_MinimumOfTwoSofValues_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE));
+  CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool = (char)1;
+}
+
+void TEST_SOF_MinimumOfTwoSofValues_CMockStopIgnore(void)
+{
+  if(Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool)
+    Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance = CMock_Guts_MemNext(Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance);
+  Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool = (char)0;
+}
+
+void TEST_SOF_MinimumOfTwoSofValues_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s voltageBasedLimits, SOF_CURRENT_LIMITS_s temperatureBasedLimits, SOF_CURRENT_LIMITS_s cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE));
+  CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_MinimumOfTwoSofValues(cmock_call_instance, voltageBasedLimits, temperatureBasedLimits);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(SOF_CURRENT_LIMITS_s[sizeof(cmock_to_return) == sizeof(SOF_CURRENT_LIMITS_s) ? 1 : -1])); /* add SOF_CURRENT_LIMITS_s to :treat_as_array if this causes an error */
+}
+
+void TEST_SOF_MinimumOfTwoSofValues_AddCallback(CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALLBACK Callback)
+{
+  Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool = (char)0;
+  Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackBool = (char)1;
+  Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_MinimumOfTwoSofValues_Stub(CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALLBACK Callback)
+{
+  Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool = (char)0;
+  Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackBool = (char)0;
+  Mock.TEST_SOF_MinimumOfTwoSofValues_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_MinimumOfTwoSofValues_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s voltageBasedLimits, SOF_CURRENT_LIMITS_s temperatureBasedLimits, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE));
+  CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_MinimumOfTwoSofValues_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_MinimumOfTwoSofValues(cmock_call_instance, voltageBasedLimits, temperatureBasedLimits);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_SOF_MinimumOfTwoSofValues_CMockIgnoreArg_voltageBasedLimits(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_voltageBasedLimits = 1;
+}
+
+void TEST_SOF_MinimumOfTwoSofValues_CMockIgnoreArg_temperatureBasedLimits(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_MinimumOfTwoSofValues_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_temperatureBasedLimits = 1;
+}
+
+_Bool TEST_SOF_UpdateStringInputs(uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s* pMinimumMaximumValues)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TEST_SOF_UpdateStringInputs);
+  cmock_call_instance = (CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TEST_SOF_UpdateStringInputs_CallInstance);
+  Mock.TEST_SOF_UpdateStringInputs_CallInstance = CMock_Guts_MemNext(Mock.TEST_SOF_UpdateStringInputs_CallInstance);
+  if (Mock.TEST_SOF_UpdateStringInputs_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TEST_SOF_UpdateStringInputs_FinalReturn;
+    memcpy((void*)(&Mock.TEST_SOF_UpdateStringInputs_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(_Bool[sizeof(cmock_call_instance->ReturnVal) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TEST_SOF_UpdateStringInputs_CallbackBool &&
+      Mock.TEST_SOF_UpdateStringInputs_CallbackFunctionPointer != NULL)
+  {
+    _Bool cmock_cb_ret = Mock.TEST_SOF_UpdateStringInputs_CallbackFunctionPointer(stringNumber, pMinimumMaximumValues, Mock.TEST_SOF_UpdateStringInputs_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_UpdateStringInputs,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pMinimumMaximumValues)
+  {
+    UNITY_SET_DETAILS(CMockString_TEST_SOF_UpdateStringInputs,CMockString_pMinimumMaximumValues);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pMinimumMaximumValues), (void*)(pMinimumMaximumValues), sizeof(const DATA_BLOCK_MIN_MAX_s), cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TEST_SOF_UpdateStringInputs_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TEST_SOF_UpdateStringInputs_CallbackFunctionPointer(stringNumber, pMinimumMaximumValues, Mock.TEST_SOF_UpdateStringInputs_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TEST_SOF_UpdateStringInputs(CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s* pMinimumMaximumValues);
+void CMockExpectParameters_TEST_SOF_UpdateStringInputs(CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE* cmock_call_instance, uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s* pMinimumMaximumValues)
+{
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+  cmock_call_instance->Expected_pMinimumMaximumValues = pMinimumMaximumValues;
+  cmock_call_instance->IgnoreArg_pMinimumMaximumValues = 0;
+}
+
+void TEST_SOF_UpdateStringInputs_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE));
+  CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_UpdateStringInputs_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_UpdateStringInputs_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_UpdateStringInputs_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TEST_SOF_UpdateStringInputs_IgnoreBool = (char)1;
+}
+
+void TEST_SOF_UpdateStringInputs_CMockStopIgnore(void)
+{
+  if(Mock.TEST_SOF_UpdateStringInputs_IgnoreBool)
+    Mock.TEST_SOF_UpdateStringInputs_CallInstance = CMock_Guts_MemNext(Mock.TEST_SOF_UpdateStringInputs_CallInstance);
+  Mock.TEST_SOF_UpdateStringInputs_IgnoreBool = (char)0;
+}
+
+void TEST_SOF_UpdateStringInputs_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s* pMinimumMaximumValues, _Bool cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE));
+  CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_UpdateStringInputs_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_UpdateStringInputs_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_UpdateStringInputs_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_UpdateStringInputs(cmock_call_instance, stringNumber, pMinimumMaximumValues);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(_Bool[sizeof(cmock_to_return) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+}
+
+void TEST_SOF_UpdateStringInputs_AddCallback(CMOCK_TEST_SOF_UpdateStringInputs_CALLBACK Callback)
+{
+  Mock.TEST_SOF_UpdateStringInputs_IgnoreBool = (char)0;
+  Mock.TEST_SOF_UpdateStringInputs_CallbackBool = (char)1;
+  Mock.TEST_SOF_UpdateStringInputs_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_UpdateStringInputs_Stub(CMOCK_TEST_SOF_UpdateStringInputs_CALLBACK Callback)
+{
+  Mock.TEST_SOF_UpdateStringInputs_IgnoreBool = (char)0;
+  Mock.TEST_SOF_UpdateStringInputs_CallbackBool = (char)0;
+  Mock.TEST_SOF_UpdateStringInputs_CallbackFunctionPointer = Callback;
+}
+
+void TEST_SOF_UpdateStringInputs_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s* pMinimumMaximumValues, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE));
+  CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TEST_SOF_UpdateStringInputs_CallInstance = CMock_Guts_MemChain(Mock.TEST_SOF_UpdateStringInputs_CallInstance, cmock_guts_index);
+  Mock.TEST_SOF_UpdateStringInputs_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TEST_SOF_UpdateStringInputs(cmock_call_instance, stringNumber, pMinimumMaximumValues);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TEST_SOF_UpdateStringInputs_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_UpdateStringInputs_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+void TEST_SOF_UpdateStringInputs_CMockIgnoreArg_pMinimumMaximumValues(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE* cmock_call_instance = (CMOCK_TEST_SOF_UpdateStringInputs_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TEST_SOF_UpdateStringInputs_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pMinimumMaximumValues = 1;
+}
+
@@ -0,0 +1,186 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKSOF_H
+#define _MOCKSOF_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "sof.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mocksof_Init(void);
+void Mocksof_Destroy(void);
+void Mocksof_Verify(void);
+
+
+
+
+#define SOF_Init_Ignore() SOF_Init_CMockIgnore()
+void SOF_Init_CMockIgnore(void);
+#define SOF_Init_StopIgnore() SOF_Init_CMockStopIgnore()
+void SOF_Init_CMockStopIgnore(void);
+#define SOF_Init_Expect() SOF_Init_CMockExpect(__LINE__)
+void SOF_Init_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_SOF_Init_CALLBACK)(int cmock_num_calls);
+void SOF_Init_AddCallback(CMOCK_SOF_Init_CALLBACK Callback);
+void SOF_Init_Stub(CMOCK_SOF_Init_CALLBACK Callback);
+#define SOF_Init_StubWithCallback SOF_Init_Stub
+#define SOF_Init_ExpectAndThrow(cmock_to_throw) SOF_Init_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void SOF_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define SOF_Calculation_Ignore() SOF_Calculation_CMockIgnore()
+void SOF_Calculation_CMockIgnore(void);
+#define SOF_Calculation_StopIgnore() SOF_Calculation_CMockStopIgnore()
+void SOF_Calculation_CMockStopIgnore(void);
+#define SOF_Calculation_Expect() SOF_Calculation_CMockExpect(__LINE__)
+void SOF_Calculation_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_SOF_Calculation_CALLBACK)(int cmock_num_calls);
+void SOF_Calculation_AddCallback(CMOCK_SOF_Calculation_CALLBACK Callback);
+void SOF_Calculation_Stub(CMOCK_SOF_Calculation_CALLBACK Callback);
+#define SOF_Calculation_StubWithCallback SOF_Calculation_Stub
+#define SOF_Calculation_ExpectAndThrow(cmock_to_throw) SOF_Calculation_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void SOF_Calculation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TEST_SOF_CalculateCurves_Ignore() TEST_SOF_CalculateCurves_CMockIgnore()
+void TEST_SOF_CalculateCurves_CMockIgnore(void);
+#define TEST_SOF_CalculateCurves_StopIgnore() TEST_SOF_CalculateCurves_CMockStopIgnore()
+void TEST_SOF_CalculateCurves_CMockStopIgnore(void);
+#define TEST_SOF_CalculateCurves_Expect(pConfigurationValues, pCalculatedSofCurves) TEST_SOF_CalculateCurves_CMockExpect(__LINE__, pConfigurationValues, pCalculatedSofCurves)
+void TEST_SOF_CalculateCurves_CMockExpect(UNITY_LINE_TYPE cmock_line, const SOF_CONFIG_s* pConfigurationValues, SOF_CURVE_s* pCalculatedSofCurves);
+typedef void (* CMOCK_TEST_SOF_CalculateCurves_CALLBACK)(const SOF_CONFIG_s* pConfigurationValues, SOF_CURVE_s* pCalculatedSofCurves, int cmock_num_calls);
+void TEST_SOF_CalculateCurves_AddCallback(CMOCK_TEST_SOF_CalculateCurves_CALLBACK Callback);
+void TEST_SOF_CalculateCurves_Stub(CMOCK_TEST_SOF_CalculateCurves_CALLBACK Callback);
+#define TEST_SOF_CalculateCurves_StubWithCallback TEST_SOF_CalculateCurves_Stub
+#define TEST_SOF_CalculateCurves_ExpectAndThrow(pConfigurationValues, pCalculatedSofCurves, cmock_to_throw) TEST_SOF_CalculateCurves_CMockExpectAndThrow(__LINE__, pConfigurationValues, pCalculatedSofCurves, cmock_to_throw)
+void TEST_SOF_CalculateCurves_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const SOF_CONFIG_s* pConfigurationValues, SOF_CURVE_s* pCalculatedSofCurves, CEXCEPTION_T cmock_to_throw);
+#define TEST_SOF_CalculateCurves_ReturnThruPtr_pCalculatedSofCurves(pCalculatedSofCurves) TEST_SOF_CalculateCurves_CMockReturnMemThruPtr_pCalculatedSofCurves(__LINE__, pCalculatedSofCurves, sizeof(SOF_CURVE_s))
+#define TEST_SOF_CalculateCurves_ReturnArrayThruPtr_pCalculatedSofCurves(pCalculatedSofCurves, cmock_len) TEST_SOF_CalculateCurves_CMockReturnMemThruPtr_pCalculatedSofCurves(__LINE__, pCalculatedSofCurves, cmock_len * sizeof(*pCalculatedSofCurves))
+#define TEST_SOF_CalculateCurves_ReturnMemThruPtr_pCalculatedSofCurves(pCalculatedSofCurves, cmock_size) TEST_SOF_CalculateCurves_CMockReturnMemThruPtr_pCalculatedSofCurves(__LINE__, pCalculatedSofCurves, cmock_size)
+void TEST_SOF_CalculateCurves_CMockReturnMemThruPtr_pCalculatedSofCurves(UNITY_LINE_TYPE cmock_line, SOF_CURVE_s* pCalculatedSofCurves, size_t cmock_size);
+#define TEST_SOF_CalculateCurves_IgnoreArg_pConfigurationValues() TEST_SOF_CalculateCurves_CMockIgnoreArg_pConfigurationValues(__LINE__)
+void TEST_SOF_CalculateCurves_CMockIgnoreArg_pConfigurationValues(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_CalculateCurves_IgnoreArg_pCalculatedSofCurves() TEST_SOF_CalculateCurves_CMockIgnoreArg_pCalculatedSofCurves(__LINE__)
+void TEST_SOF_CalculateCurves_CMockIgnoreArg_pCalculatedSofCurves(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_EvaluateCurve_IgnoreAndReturn(cmock_retval) TEST_SOF_EvaluateCurve_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_SOF_EvaluateCurve_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int32_t cmock_to_return);
+#define TEST_SOF_EvaluateCurve_StopIgnore() TEST_SOF_EvaluateCurve_CMockStopIgnore()
+void TEST_SOF_EvaluateCurve_CMockStopIgnore(void);
+#define TEST_SOF_EvaluateCurve_ExpectAndReturn(pCurve, input, cmock_retval) TEST_SOF_EvaluateCurve_CMockExpectAndReturn(__LINE__, pCurve, input, cmock_retval)
+void TEST_SOF_EvaluateCurve_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, const SOF_SCALED_CURVE_s* pCurve, int16_t input, int32_t cmock_to_return);
+typedef int32_t (* CMOCK_TEST_SOF_EvaluateCurve_CALLBACK)(const SOF_SCALED_CURVE_s* pCurve, int16_t input, int cmock_num_calls);
+void TEST_SOF_EvaluateCurve_AddCallback(CMOCK_TEST_SOF_EvaluateCurve_CALLBACK Callback);
+void TEST_SOF_EvaluateCurve_Stub(CMOCK_TEST_SOF_EvaluateCurve_CALLBACK Callback);
+#define TEST_SOF_EvaluateCurve_StubWithCallback TEST_SOF_EvaluateCurve_Stub
+#define TEST_SOF_EvaluateCurve_ExpectAndThrow(pCurve, input, cmock_to_throw) TEST_SOF_EvaluateCurve_CMockExpectAndThrow(__LINE__, pCurve, input, cmock_to_throw)
+void TEST_SOF_EvaluateCurve_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, const SOF_SCALED_CURVE_s* pCurve, int16_t input, CEXCEPTION_T cmock_to_throw);
+#define TEST_SOF_EvaluateCurve_IgnoreArg_pCurve() TEST_SOF_EvaluateCurve_CMockIgnoreArg_pCurve(__LINE__)
+void TEST_SOF_EvaluateCurve_CMockIgnoreArg_pCurve(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_EvaluateCurve_IgnoreArg_input() TEST_SOF_EvaluateCurve_CMockIgnoreArg_input(__LINE__)
+void TEST_SOF_EvaluateCurve_CMockIgnoreArg_input(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_Ignore() TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnore()
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnore(void);
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_StopIgnore() TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockStopIgnore()
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockStopIgnore(void);
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_Expect(minimumCellVoltage_mV, maximumCellVoltage_mV, pAllowedVoltageBasedCurrent, pCalculatedSofCurves) TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockExpect(__LINE__, minimumCellVoltage_mV, maximumCellVoltage_mV, pAllowedVoltageBasedCurrent, pCalculatedSofCurves)
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockExpect(UNITY_LINE_TYPE cmock_line, int16_t minimumCellVoltage_mV, int16_t maximumCellVoltage_mV, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves);
+typedef void (* CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALLBACK)(int16_t minimumCellVoltage_mV, int16_t maximumCellVoltage_mV, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves, int cmock_num_calls);
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_AddCallback(CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALLBACK Callback);
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_Stub(CMOCK_TEST_SOF_CalculateVoltageBasedCurrentLimit_CALLBACK Callback);
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_StubWithCallback TEST_SOF_CalculateVoltageBasedCurrentLimit_Stub
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_ExpectAndThrow(minimumCellVoltage_mV, maximumCellVoltage_mV, pAllowedVoltageBasedCurrent, pCalculatedSofCurves, cmock_to_throw) TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockExpectAndThrow(__LINE__, minimumCellVoltage_mV, maximumCellVoltage_mV, pAllowedVoltageBasedCurrent, pCalculatedSofCurves, cmock_to_throw)
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t minimumCellVoltage_mV, int16_t maximumCellVoltage_mV, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves, CEXCEPTION_T cmock_to_throw);
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_ReturnThruPtr_pAllowedVoltageBasedCurrent(pAllowedVoltageBasedCurrent) TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedVoltageBasedCurrent(__LINE__, pAllowedVoltageBasedCurrent, sizeof(SOF_CURRENT_LIMITS_s))
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_ReturnArrayThruPtr_pAllowedVoltageBasedCurrent(pAllowedVoltageBasedCurrent, cmock_len) TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedVoltageBasedCurrent(__LINE__, pAllowedVoltageBasedCurrent, cmock_len * sizeof(*pAllowedVoltageBasedCurrent))
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_ReturnMemThruPtr_pAllowedVoltageBasedCurrent(pAllowedVoltageBasedCurrent, cmock_size) TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedVoltageBasedCurrent(__LINE__, pAllowedVoltageBasedCurrent, cmock_size)
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedVoltageBasedCurrent(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s* pAllowedVoltageBasedCurrent, size_t cmock_size);
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreArg_minimumCellVoltage_mV() TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_minimumCellVoltage_mV(__LINE__)
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_minimumCellVoltage_mV(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreArg_maximumCellVoltage_mV() TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_maximumCellVoltage_mV(__LINE__)
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_maximumCellVoltage_mV(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreArg_pAllowedVoltageBasedCurrent() TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_pAllowedVoltageBasedCurrent(__LINE__)
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_pAllowedVoltageBasedCurrent(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_CalculateVoltageBasedCurrentLimit_IgnoreArg_pCalculatedSofCurves() TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_pCalculatedSofCurves(__LINE__)
+void TEST_SOF_CalculateVoltageBasedCurrentLimit_CMockIgnoreArg_pCalculatedSofCurves(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_Ignore() TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnore()
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnore(void);
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_StopIgnore() TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockStopIgnore()
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockStopIgnore(void);
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_Expect(minimumCellTemperature_ddegC, maximumCellTemperature_ddegC, pAllowedTemperatureBasedCurrent, pCalculatedSofCurves) TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockExpect(__LINE__, minimumCellTemperature_ddegC, maximumCellTemperature_ddegC, pAllowedTemperatureBasedCurrent, pCalculatedSofCurves)
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockExpect(UNITY_LINE_TYPE cmock_line, int16_t minimumCellTemperature_ddegC, int16_t maximumCellTemperature_ddegC, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves);
+typedef void (* CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALLBACK)(int16_t minimumCellTemperature_ddegC, int16_t maximumCellTemperature_ddegC, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves, int cmock_num_calls);
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_AddCallback(CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALLBACK Callback);
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_Stub(CMOCK_TEST_SOF_CalculateTemperatureBasedCurrentLimit_CALLBACK Callback);
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_StubWithCallback TEST_SOF_CalculateTemperatureBasedCurrentLimit_Stub
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_ExpectAndThrow(minimumCellTemperature_ddegC, maximumCellTemperature_ddegC, pAllowedTemperatureBasedCurrent, pCalculatedSofCurves, cmock_to_throw) TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockExpectAndThrow(__LINE__, minimumCellTemperature_ddegC, maximumCellTemperature_ddegC, pAllowedTemperatureBasedCurrent, pCalculatedSofCurves, cmock_to_throw)
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t minimumCellTemperature_ddegC, int16_t maximumCellTemperature_ddegC, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, const SOF_CURVE_s* pCalculatedSofCurves, CEXCEPTION_T cmock_to_throw);
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_ReturnThruPtr_pAllowedTemperatureBasedCurrent(pAllowedTemperatureBasedCurrent) TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedTemperatureBasedCurrent(__LINE__, pAllowedTemperatureBasedCurrent, sizeof(SOF_CURRENT_LIMITS_s))
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_ReturnArrayThruPtr_pAllowedTemperatureBasedCurrent(pAllowedTemperatureBasedCurrent, cmock_len) TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedTemperatureBasedCurrent(__LINE__, pAllowedTemperatureBasedCurrent, cmock_len * sizeof(*pAllowedTemperatureBasedCurrent))
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_ReturnMemThruPtr_pAllowedTemperatureBasedCurrent(pAllowedTemperatureBasedCurrent, cmock_size) TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedTemperatureBasedCurrent(__LINE__, pAllowedTemperatureBasedCurrent, cmock_size)
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockReturnMemThruPtr_pAllowedTemperatureBasedCurrent(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s* pAllowedTemperatureBasedCurrent, size_t cmock_size);
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreArg_minimumCellTemperature_ddegC() TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_minimumCellTemperature_ddegC(__LINE__)
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_minimumCellTemperature_ddegC(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreArg_maximumCellTemperature_ddegC() TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_maximumCellTemperature_ddegC(__LINE__)
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_maximumCellTemperature_ddegC(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreArg_pAllowedTemperatureBasedCurrent() TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_pAllowedTemperatureBasedCurrent(__LINE__)
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_pAllowedTemperatureBasedCurrent(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_CalculateTemperatureBasedCurrentLimit_IgnoreArg_pCalculatedSofCurves() TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_pCalculatedSofCurves(__LINE__)
+void TEST_SOF_CalculateTemperatureBasedCurrentLimit_CMockIgnoreArg_pCalculatedSofCurves(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_MinimumOfTwoSofValues_IgnoreAndReturn(cmock_retval) TEST_SOF_MinimumOfTwoSofValues_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_SOF_MinimumOfTwoSofValues_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s cmock_to_return);
+#define TEST_SOF_MinimumOfTwoSofValues_StopIgnore() TEST_SOF_MinimumOfTwoSofValues_CMockStopIgnore()
+void TEST_SOF_MinimumOfTwoSofValues_CMockStopIgnore(void);
+#define TEST_SOF_MinimumOfTwoSofValues_ExpectAndReturn(voltageBasedLimits, temperatureBasedLimits, cmock_retval) TEST_SOF_MinimumOfTwoSofValues_CMockExpectAndReturn(__LINE__, voltageBasedLimits, temperatureBasedLimits, cmock_retval)
+void TEST_SOF_MinimumOfTwoSofValues_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s voltageBasedLimits, SOF_CURRENT_LIMITS_s temperatureBasedLimits, SOF_CURRENT_LIMITS_s cmock_to_return);
+typedef SOF_CURRENT_LIMITS_s (* CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALLBACK)(SOF_CURRENT_LIMITS_s voltageBasedLimits, SOF_CURRENT_LIMITS_s temperatureBasedLimits, int cmock_num_calls);
+void TEST_SOF_MinimumOfTwoSofValues_AddCallback(CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALLBACK Callback);
+void TEST_SOF_MinimumOfTwoSofValues_Stub(CMOCK_TEST_SOF_MinimumOfTwoSofValues_CALLBACK Callback);
+#define TEST_SOF_MinimumOfTwoSofValues_StubWithCallback TEST_SOF_MinimumOfTwoSofValues_Stub
+#define TEST_SOF_MinimumOfTwoSofValues_ExpectAndThrow(voltageBasedLimits, temperatureBasedLimits, cmock_to_throw) TEST_SOF_MinimumOfTwoSofValues_CMockExpectAndThrow(__LINE__, voltageBasedLimits, temperatureBasedLimits, cmock_to_throw)
+void TEST_SOF_MinimumOfTwoSofValues_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SOF_CURRENT_LIMITS_s voltageBasedLimits, SOF_CURRENT_LIMITS_s temperatureBasedLimits, CEXCEPTION_T cmock_to_throw);
+#define TEST_SOF_MinimumOfTwoSofValues_IgnoreArg_voltageBasedLimits() TEST_SOF_MinimumOfTwoSofValues_CMockIgnoreArg_voltageBasedLimits(__LINE__)
+void TEST_SOF_MinimumOfTwoSofValues_CMockIgnoreArg_voltageBasedLimits(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_MinimumOfTwoSofValues_IgnoreArg_temperatureBasedLimits() TEST_SOF_MinimumOfTwoSofValues_CMockIgnoreArg_temperatureBasedLimits(__LINE__)
+void TEST_SOF_MinimumOfTwoSofValues_CMockIgnoreArg_temperatureBasedLimits(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_UpdateStringInputs_IgnoreAndReturn(cmock_retval) TEST_SOF_UpdateStringInputs_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TEST_SOF_UpdateStringInputs_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, _Bool cmock_to_return);
+#define TEST_SOF_UpdateStringInputs_StopIgnore() TEST_SOF_UpdateStringInputs_CMockStopIgnore()
+void TEST_SOF_UpdateStringInputs_CMockStopIgnore(void);
+#define TEST_SOF_UpdateStringInputs_ExpectAndReturn(stringNumber, pMinimumMaximumValues, cmock_retval) TEST_SOF_UpdateStringInputs_CMockExpectAndReturn(__LINE__, stringNumber, pMinimumMaximumValues, cmock_retval)
+void TEST_SOF_UpdateStringInputs_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s* pMinimumMaximumValues, _Bool cmock_to_return);
+typedef _Bool (* CMOCK_TEST_SOF_UpdateStringInputs_CALLBACK)(uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s* pMinimumMaximumValues, int cmock_num_calls);
+void TEST_SOF_UpdateStringInputs_AddCallback(CMOCK_TEST_SOF_UpdateStringInputs_CALLBACK Callback);
+void TEST_SOF_UpdateStringInputs_Stub(CMOCK_TEST_SOF_UpdateStringInputs_CALLBACK Callback);
+#define TEST_SOF_UpdateStringInputs_StubWithCallback TEST_SOF_UpdateStringInputs_Stub
+#define TEST_SOF_UpdateStringInputs_ExpectAndThrow(stringNumber, pMinimumMaximumValues, cmock_to_throw) TEST_SOF_UpdateStringInputs_CMockExpectAndThrow(__LINE__, stringNumber, pMinimumMaximumValues, cmock_to_throw)
+void TEST_SOF_UpdateStringInputs_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s* pMinimumMaximumValues, CEXCEPTION_T cmock_to_throw);
+#define TEST_SOF_UpdateStringInputs_IgnoreArg_stringNumber() TEST_SOF_UpdateStringInputs_CMockIgnoreArg_stringNumber(__LINE__)
+void TEST_SOF_UpdateStringInputs_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define TEST_SOF_UpdateStringInputs_IgnoreArg_pMinimumMaximumValues() TEST_SOF_UpdateStringInputs_CMockIgnoreArg_pMinimumMaximumValues(__LINE__)
+void TEST_SOF_UpdateStringInputs_CMockIgnoreArg_pMinimumMaximumValues(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,2671 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockspi.h"
+
+static const char* CMockString_SPI_DirectlyTransmitReceiveData = "SPI_DirectlyTransmitReceiveData";
+static const char* CMockString_SPI_Lock = "SPI_Lock";
+static const char* CMockString_SPI_TransmitData = "SPI_TransmitData";
+static const char* CMockString_SPI_TransmitDataWithDummy = "SPI_TransmitDataWithDummy";
+static const char* CMockString_SPI_TransmitDummyByte = "SPI_TransmitDummyByte";
+static const char* CMockString_SPI_TransmitReceiveData = "SPI_TransmitReceiveData";
+static const char* CMockString_SPI_TransmitReceiveDataDma = "SPI_TransmitReceiveDataDma";
+static const char* CMockString_SPI_TransmitReceiveDataDmaFromIsr = "SPI_TransmitReceiveDataDmaFromIsr";
+static const char* CMockString_SPI_TransmitReceiveDataDmaLocked = "SPI_TransmitReceiveDataDmaLocked";
+static const char* CMockString_SPI_TransmitReceiveDataWithDummyDma = "SPI_TransmitReceiveDataWithDummyDma";
+static const char* CMockString_SPI_Unlock = "SPI_Unlock";
+static const char* CMockString_delay = "delay";
+static const char* CMockString_frameLength = "frameLength";
+static const char* CMockString_pRxBuff = "pRxBuff";
+static const char* CMockString_pSpiInterface = "pSpiInterface";
+static const char* CMockString_pTxBuff = "pTxBuff";
+static const char* CMockString_spi = "spi";
+static const char* CMockString_wakeUpValidity_us = "wakeUpValidity_us";
+
+typedef struct _CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint32_t Expected_delay;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_delay;
+
+} CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint32_t Expected_delay;
+  uint32_t Expected_wakeUpValidity_us;
+  uint16_t* Expected_pTxBuff;
+  uint32_t Expected_frameLength;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char ReturnThruPtr_pTxBuff_Used;
+  uint16_t* ReturnThruPtr_pTxBuff_Val;
+  size_t ReturnThruPtr_pTxBuff_Size;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_delay;
+  char IgnoreArg_wakeUpValidity_us;
+  char IgnoreArg_pTxBuff;
+  char IgnoreArg_frameLength;
+
+} CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_TransmitData_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint16_t* Expected_pTxBuff;
+  uint32_t Expected_frameLength;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char ReturnThruPtr_pTxBuff_Used;
+  uint16_t* ReturnThruPtr_pTxBuff_Val;
+  size_t ReturnThruPtr_pTxBuff_Size;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_pTxBuff;
+  char IgnoreArg_frameLength;
+
+} CMOCK_SPI_TransmitData_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint16* Expected_pTxBuff;
+  uint16* Expected_pRxBuff;
+  uint32 Expected_frameLength;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char ReturnThruPtr_pTxBuff_Used;
+  uint16* ReturnThruPtr_pTxBuff_Val;
+  size_t ReturnThruPtr_pTxBuff_Size;
+  char ReturnThruPtr_pRxBuff_Used;
+  uint16* ReturnThruPtr_pRxBuff_Val;
+  size_t ReturnThruPtr_pRxBuff_Size;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_pTxBuff;
+  char IgnoreArg_pRxBuff;
+  char IgnoreArg_frameLength;
+
+} CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint16* Expected_pTxBuff;
+  uint16* Expected_pRxBuff;
+  uint32 Expected_frameLength;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char ReturnThruPtr_pTxBuff_Used;
+  uint16* ReturnThruPtr_pTxBuff_Val;
+  size_t ReturnThruPtr_pTxBuff_Size;
+  char ReturnThruPtr_pRxBuff_Used;
+  uint16* ReturnThruPtr_pRxBuff_Val;
+  size_t ReturnThruPtr_pRxBuff_Size;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_pTxBuff;
+  char IgnoreArg_pRxBuff;
+  char IgnoreArg_frameLength;
+
+} CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint16_t* Expected_pTxBuff;
+  uint16_t* Expected_pRxBuff;
+  uint32_t Expected_frameLength;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char ReturnThruPtr_pTxBuff_Used;
+  uint16_t* ReturnThruPtr_pTxBuff_Val;
+  size_t ReturnThruPtr_pTxBuff_Size;
+  char ReturnThruPtr_pRxBuff_Used;
+  uint16_t* ReturnThruPtr_pRxBuff_Val;
+  size_t ReturnThruPtr_pRxBuff_Size;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_pTxBuff;
+  char IgnoreArg_pRxBuff;
+  char IgnoreArg_frameLength;
+
+} CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint32_t Expected_delay;
+  uint32_t Expected_wakeUpValidity_us;
+  uint16_t* Expected_pTxBuff;
+  uint16_t* Expected_pRxBuff;
+  uint32_t Expected_frameLength;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char ReturnThruPtr_pTxBuff_Used;
+  uint16_t* ReturnThruPtr_pTxBuff_Val;
+  size_t ReturnThruPtr_pTxBuff_Size;
+  char ReturnThruPtr_pRxBuff_Used;
+  uint16_t* ReturnThruPtr_pRxBuff_Val;
+  size_t ReturnThruPtr_pRxBuff_Size;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_delay;
+  char IgnoreArg_wakeUpValidity_us;
+  char IgnoreArg_pTxBuff;
+  char IgnoreArg_pRxBuff;
+  char IgnoreArg_frameLength;
+
+} CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint16_t* Expected_pTxBuff;
+  uint16_t* Expected_pRxBuff;
+  uint32_t Expected_frameLength;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char ReturnThruPtr_pTxBuff_Used;
+  uint16_t* ReturnThruPtr_pTxBuff_Val;
+  size_t ReturnThruPtr_pTxBuff_Size;
+  char ReturnThruPtr_pRxBuff_Used;
+  uint16_t* ReturnThruPtr_pRxBuff_Val;
+  size_t ReturnThruPtr_pRxBuff_Size;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_pTxBuff;
+  char IgnoreArg_pRxBuff;
+  char IgnoreArg_frameLength;
+
+} CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  SPI_INTERFACE_CONFIG_s* Expected_pSpiInterface;
+  uint16_t* Expected_pTxBuff;
+  uint16_t* Expected_pRxBuff;
+  uint32_t Expected_frameLength;
+  CEXCEPTION_T ExceptionToThrow;
+  char ReturnThruPtr_pSpiInterface_Used;
+  SPI_INTERFACE_CONFIG_s* ReturnThruPtr_pSpiInterface_Val;
+  size_t ReturnThruPtr_pSpiInterface_Size;
+  char ReturnThruPtr_pTxBuff_Used;
+  uint16_t* ReturnThruPtr_pTxBuff_Val;
+  size_t ReturnThruPtr_pTxBuff_Size;
+  char ReturnThruPtr_pRxBuff_Used;
+  uint16_t* ReturnThruPtr_pRxBuff_Val;
+  size_t ReturnThruPtr_pRxBuff_Size;
+  char IgnoreArg_pSpiInterface;
+  char IgnoreArg_pTxBuff;
+  char IgnoreArg_pRxBuff;
+  char IgnoreArg_frameLength;
+
+} CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_Lock_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  STD_RETURN_TYPE_e ReturnVal;
+  int CallOrder;
+  uint8_t Expected_spi;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_spi;
+
+} CMOCK_SPI_Lock_CALL_INSTANCE;
+
+typedef struct _CMOCK_SPI_Unlock_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_spi;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_spi;
+
+} CMOCK_SPI_Unlock_CALL_INSTANCE;
+
+static struct MockspiInstance
+{
+  char SPI_TransmitDummyByte_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_TransmitDummyByte_FinalReturn;
+  char SPI_TransmitDummyByte_CallbackBool;
+  CMOCK_SPI_TransmitDummyByte_CALLBACK SPI_TransmitDummyByte_CallbackFunctionPointer;
+  int SPI_TransmitDummyByte_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_TransmitDummyByte_CallInstance;
+  char SPI_TransmitDataWithDummy_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_TransmitDataWithDummy_FinalReturn;
+  char SPI_TransmitDataWithDummy_CallbackBool;
+  CMOCK_SPI_TransmitDataWithDummy_CALLBACK SPI_TransmitDataWithDummy_CallbackFunctionPointer;
+  int SPI_TransmitDataWithDummy_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_TransmitDataWithDummy_CallInstance;
+  char SPI_TransmitData_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_TransmitData_FinalReturn;
+  char SPI_TransmitData_CallbackBool;
+  CMOCK_SPI_TransmitData_CALLBACK SPI_TransmitData_CallbackFunctionPointer;
+  int SPI_TransmitData_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_TransmitData_CallInstance;
+  char SPI_TransmitReceiveData_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_TransmitReceiveData_FinalReturn;
+  char SPI_TransmitReceiveData_CallbackBool;
+  CMOCK_SPI_TransmitReceiveData_CALLBACK SPI_TransmitReceiveData_CallbackFunctionPointer;
+  int SPI_TransmitReceiveData_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_TransmitReceiveData_CallInstance;
+  char SPI_DirectlyTransmitReceiveData_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_DirectlyTransmitReceiveData_FinalReturn;
+  char SPI_DirectlyTransmitReceiveData_CallbackBool;
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALLBACK SPI_DirectlyTransmitReceiveData_CallbackFunctionPointer;
+  int SPI_DirectlyTransmitReceiveData_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_DirectlyTransmitReceiveData_CallInstance;
+  char SPI_TransmitReceiveDataDma_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma_FinalReturn;
+  char SPI_TransmitReceiveDataDma_CallbackBool;
+  CMOCK_SPI_TransmitReceiveDataDma_CALLBACK SPI_TransmitReceiveDataDma_CallbackFunctionPointer;
+  int SPI_TransmitReceiveDataDma_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_TransmitReceiveDataDma_CallInstance;
+  char SPI_TransmitReceiveDataWithDummyDma_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_TransmitReceiveDataWithDummyDma_FinalReturn;
+  char SPI_TransmitReceiveDataWithDummyDma_CallbackBool;
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALLBACK SPI_TransmitReceiveDataWithDummyDma_CallbackFunctionPointer;
+  int SPI_TransmitReceiveDataWithDummyDma_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_TransmitReceiveDataWithDummyDma_CallInstance;
+  char SPI_TransmitReceiveDataDmaLocked_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaLocked_FinalReturn;
+  char SPI_TransmitReceiveDataDmaLocked_CallbackBool;
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALLBACK SPI_TransmitReceiveDataDmaLocked_CallbackFunctionPointer;
+  int SPI_TransmitReceiveDataDmaLocked_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_TransmitReceiveDataDmaLocked_CallInstance;
+  char SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaFromIsr_FinalReturn;
+  char SPI_TransmitReceiveDataDmaFromIsr_CallbackBool;
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALLBACK SPI_TransmitReceiveDataDmaFromIsr_CallbackFunctionPointer;
+  int SPI_TransmitReceiveDataDmaFromIsr_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_TransmitReceiveDataDmaFromIsr_CallInstance;
+  char SPI_Lock_IgnoreBool;
+  STD_RETURN_TYPE_e SPI_Lock_FinalReturn;
+  char SPI_Lock_CallbackBool;
+  CMOCK_SPI_Lock_CALLBACK SPI_Lock_CallbackFunctionPointer;
+  int SPI_Lock_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_Lock_CallInstance;
+  char SPI_Unlock_IgnoreBool;
+  char SPI_Unlock_CallbackBool;
+  CMOCK_SPI_Unlock_CALLBACK SPI_Unlock_CallbackFunctionPointer;
+  int SPI_Unlock_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SPI_Unlock_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockspi_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.SPI_TransmitDummyByte_CallInstance;
+  if (Mock.SPI_TransmitDummyByte_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_TransmitDummyByte);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_TransmitDummyByte_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_TransmitDataWithDummy_CallInstance;
+  if (Mock.SPI_TransmitDataWithDummy_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_TransmitDataWithDummy);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_TransmitDataWithDummy_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_TransmitData_CallInstance;
+  if (Mock.SPI_TransmitData_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_TransmitData);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_TransmitData_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_TransmitReceiveData_CallInstance;
+  if (Mock.SPI_TransmitReceiveData_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveData);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_TransmitReceiveData_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_DirectlyTransmitReceiveData_CallInstance;
+  if (Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_DirectlyTransmitReceiveData);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_DirectlyTransmitReceiveData_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_TransmitReceiveDataDma_CallInstance;
+  if (Mock.SPI_TransmitReceiveDataDma_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveDataDma);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_TransmitReceiveDataDma_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance;
+  if (Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveDataWithDummyDma);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance;
+  if (Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveDataDmaLocked);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_TransmitReceiveDataDmaLocked_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance;
+  if (Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveDataDmaFromIsr);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_Lock_CallInstance;
+  if (Mock.SPI_Lock_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_Lock);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_Lock_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SPI_Unlock_CallInstance;
+  if (Mock.SPI_Unlock_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SPI_Unlock);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SPI_Unlock_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockspi_Init(void)
+{
+  Mockspi_Destroy();
+}
+
+void Mockspi_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitDummyByte(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_TransmitDummyByte);
+  cmock_call_instance = (CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_TransmitDummyByte_CallInstance);
+  Mock.SPI_TransmitDummyByte_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitDummyByte_CallInstance);
+  if (Mock.SPI_TransmitDummyByte_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_TransmitDummyByte_FinalReturn;
+    memcpy((void*)(&Mock.SPI_TransmitDummyByte_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_TransmitDummyByte_CallbackBool &&
+      Mock.SPI_TransmitDummyByte_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_TransmitDummyByte_CallbackFunctionPointer(pSpiInterface, delay, Mock.SPI_TransmitDummyByte_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitDummyByte,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_delay)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitDummyByte,CMockString_delay);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_delay, delay, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_TransmitDummyByte_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_TransmitDummyByte_CallbackFunctionPointer(pSpiInterface, delay, Mock.SPI_TransmitDummyByte_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_TransmitDummyByte(CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay);
+void CMockExpectParameters_SPI_TransmitDummyByte(CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay)
+{
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_delay = delay;
+  cmock_call_instance->IgnoreArg_delay = 0;
+}
+
+void SPI_TransmitDummyByte_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE));
+  CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitDummyByte_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitDummyByte_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitDummyByte_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_TransmitDummyByte_IgnoreBool = (char)1;
+}
+
+void SPI_TransmitDummyByte_CMockStopIgnore(void)
+{
+  if(Mock.SPI_TransmitDummyByte_IgnoreBool)
+    Mock.SPI_TransmitDummyByte_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitDummyByte_CallInstance);
+  Mock.SPI_TransmitDummyByte_IgnoreBool = (char)0;
+}
+
+void SPI_TransmitDummyByte_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE));
+  CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitDummyByte_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitDummyByte_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitDummyByte_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitDummyByte(cmock_call_instance, pSpiInterface, delay);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_TransmitDummyByte_AddCallback(CMOCK_SPI_TransmitDummyByte_CALLBACK Callback)
+{
+  Mock.SPI_TransmitDummyByte_IgnoreBool = (char)0;
+  Mock.SPI_TransmitDummyByte_CallbackBool = (char)1;
+  Mock.SPI_TransmitDummyByte_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitDummyByte_Stub(CMOCK_SPI_TransmitDummyByte_CALLBACK Callback)
+{
+  Mock.SPI_TransmitDummyByte_IgnoreBool = (char)0;
+  Mock.SPI_TransmitDummyByte_CallbackBool = (char)0;
+  Mock.SPI_TransmitDummyByte_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitDummyByte_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE));
+  CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitDummyByte_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitDummyByte_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitDummyByte_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitDummyByte(cmock_call_instance, pSpiInterface, delay);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_TransmitDummyByte_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDummyByte_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void SPI_TransmitDummyByte_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDummyByte_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void SPI_TransmitDummyByte_CMockIgnoreArg_delay(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDummyByte_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDummyByte_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_delay = 1;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitDataWithDummy(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint32_t frameLength)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_TransmitDataWithDummy);
+  cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_TransmitDataWithDummy_CallInstance);
+  Mock.SPI_TransmitDataWithDummy_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitDataWithDummy_CallInstance);
+  if (Mock.SPI_TransmitDataWithDummy_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_TransmitDataWithDummy_FinalReturn;
+    memcpy((void*)(&Mock.SPI_TransmitDataWithDummy_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_TransmitDataWithDummy_CallbackBool &&
+      Mock.SPI_TransmitDataWithDummy_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_TransmitDataWithDummy_CallbackFunctionPointer(pSpiInterface, delay, wakeUpValidity_us, pTxBuff, frameLength, Mock.SPI_TransmitDataWithDummy_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitDataWithDummy,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_delay)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitDataWithDummy,CMockString_delay);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_delay, delay, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_wakeUpValidity_us)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitDataWithDummy,CMockString_wakeUpValidity_us);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_wakeUpValidity_us, wakeUpValidity_us, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitDataWithDummy,CMockString_pTxBuff);
+    if (cmock_call_instance->Expected_pTxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pTxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pTxBuff, pTxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_frameLength)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitDataWithDummy,CMockString_frameLength);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_frameLength, frameLength, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_TransmitDataWithDummy_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_TransmitDataWithDummy_CallbackFunctionPointer(pSpiInterface, delay, wakeUpValidity_us, pTxBuff, frameLength, Mock.SPI_TransmitDataWithDummy_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTxBuff, (void*)cmock_call_instance->ReturnThruPtr_pTxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pTxBuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_TransmitDataWithDummy(CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint32_t frameLength);
+void CMockExpectParameters_SPI_TransmitDataWithDummy(CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint32_t frameLength)
+{
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_delay = delay;
+  cmock_call_instance->IgnoreArg_delay = 0;
+  cmock_call_instance->Expected_wakeUpValidity_us = wakeUpValidity_us;
+  cmock_call_instance->IgnoreArg_wakeUpValidity_us = 0;
+  cmock_call_instance->Expected_pTxBuff = pTxBuff;
+  cmock_call_instance->IgnoreArg_pTxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 0;
+  cmock_call_instance->Expected_frameLength = frameLength;
+  cmock_call_instance->IgnoreArg_frameLength = 0;
+}
+
+void SPI_TransmitDataWithDummy_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE));
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitDataWithDummy_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitDataWithDummy_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitDataWithDummy_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_TransmitDataWithDummy_IgnoreBool = (char)1;
+}
+
+void SPI_TransmitDataWithDummy_CMockStopIgnore(void)
+{
+  if(Mock.SPI_TransmitDataWithDummy_IgnoreBool)
+    Mock.SPI_TransmitDataWithDummy_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitDataWithDummy_CallInstance);
+  Mock.SPI_TransmitDataWithDummy_IgnoreBool = (char)0;
+}
+
+void SPI_TransmitDataWithDummy_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE));
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitDataWithDummy_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitDataWithDummy_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitDataWithDummy_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitDataWithDummy(cmock_call_instance, pSpiInterface, delay, wakeUpValidity_us, pTxBuff, frameLength);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_TransmitDataWithDummy_AddCallback(CMOCK_SPI_TransmitDataWithDummy_CALLBACK Callback)
+{
+  Mock.SPI_TransmitDataWithDummy_IgnoreBool = (char)0;
+  Mock.SPI_TransmitDataWithDummy_CallbackBool = (char)1;
+  Mock.SPI_TransmitDataWithDummy_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitDataWithDummy_Stub(CMOCK_SPI_TransmitDataWithDummy_CALLBACK Callback)
+{
+  Mock.SPI_TransmitDataWithDummy_IgnoreBool = (char)0;
+  Mock.SPI_TransmitDataWithDummy_CallbackBool = (char)0;
+  Mock.SPI_TransmitDataWithDummy_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitDataWithDummy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE));
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitDataWithDummy_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitDataWithDummy_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitDataWithDummy_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitDataWithDummy(cmock_call_instance, pSpiInterface, delay, wakeUpValidity_us, pTxBuff, frameLength);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDataWithDummy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDataWithDummy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Val = pTxBuff;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDataWithDummy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_delay(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDataWithDummy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_delay = 1;
+}
+
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_wakeUpValidity_us(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDataWithDummy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_wakeUpValidity_us = 1;
+}
+
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDataWithDummy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTxBuff = 1;
+}
+
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitDataWithDummy_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitDataWithDummy_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_frameLength = 1;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitData(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint32_t frameLength)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_TransmitData);
+  cmock_call_instance = (CMOCK_SPI_TransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_TransmitData_CallInstance);
+  Mock.SPI_TransmitData_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitData_CallInstance);
+  if (Mock.SPI_TransmitData_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_TransmitData_FinalReturn;
+    memcpy((void*)(&Mock.SPI_TransmitData_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_TransmitData_CallbackBool &&
+      Mock.SPI_TransmitData_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_TransmitData_CallbackFunctionPointer(pSpiInterface, pTxBuff, frameLength, Mock.SPI_TransmitData_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitData,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitData,CMockString_pTxBuff);
+    if (cmock_call_instance->Expected_pTxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pTxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pTxBuff, pTxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_frameLength)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitData,CMockString_frameLength);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_frameLength, frameLength, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_TransmitData_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_TransmitData_CallbackFunctionPointer(pSpiInterface, pTxBuff, frameLength, Mock.SPI_TransmitData_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTxBuff, (void*)cmock_call_instance->ReturnThruPtr_pTxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pTxBuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_TransmitData(CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint32_t frameLength);
+void CMockExpectParameters_SPI_TransmitData(CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint32_t frameLength)
+{
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_pTxBuff = pTxBuff;
+  cmock_call_instance->IgnoreArg_pTxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 0;
+  cmock_call_instance->Expected_frameLength = frameLength;
+  cmock_call_instance->IgnoreArg_frameLength = 0;
+}
+
+void SPI_TransmitData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitData_CALL_INSTANCE));
+  CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitData_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitData_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_TransmitData_IgnoreBool = (char)1;
+}
+
+void SPI_TransmitData_CMockStopIgnore(void)
+{
+  if(Mock.SPI_TransmitData_IgnoreBool)
+    Mock.SPI_TransmitData_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitData_CallInstance);
+  Mock.SPI_TransmitData_IgnoreBool = (char)0;
+}
+
+void SPI_TransmitData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitData_CALL_INSTANCE));
+  CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitData_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitData_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitData(cmock_call_instance, pSpiInterface, pTxBuff, frameLength);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_TransmitData_AddCallback(CMOCK_SPI_TransmitData_CALLBACK Callback)
+{
+  Mock.SPI_TransmitData_IgnoreBool = (char)0;
+  Mock.SPI_TransmitData_CallbackBool = (char)1;
+  Mock.SPI_TransmitData_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitData_Stub(CMOCK_SPI_TransmitData_CALLBACK Callback)
+{
+  Mock.SPI_TransmitData_IgnoreBool = (char)0;
+  Mock.SPI_TransmitData_CallbackBool = (char)0;
+  Mock.SPI_TransmitData_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitData_CALL_INSTANCE));
+  CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitData_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitData_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitData(cmock_call_instance, pSpiInterface, pTxBuff, frameLength);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_TransmitData_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void SPI_TransmitData_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Val = pTxBuff;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitData_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void SPI_TransmitData_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTxBuff = 1;
+}
+
+void SPI_TransmitData_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_frameLength = 1;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitReceiveData(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveData);
+  cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_TransmitReceiveData_CallInstance);
+  Mock.SPI_TransmitReceiveData_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveData_CallInstance);
+  if (Mock.SPI_TransmitReceiveData_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_TransmitReceiveData_FinalReturn;
+    memcpy((void*)(&Mock.SPI_TransmitReceiveData_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_TransmitReceiveData_CallbackBool &&
+      Mock.SPI_TransmitReceiveData_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_TransmitReceiveData_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveData_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveData,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveData,CMockString_pTxBuff);
+    if (cmock_call_instance->Expected_pTxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pTxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pTxBuff, pTxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pRxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveData,CMockString_pRxBuff);
+    if (cmock_call_instance->Expected_pRxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pRxBuff, pRxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_frameLength)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveData,CMockString_frameLength);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_frameLength, frameLength, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_TransmitReceiveData_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_TransmitReceiveData_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveData_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTxBuff, (void*)cmock_call_instance->ReturnThruPtr_pTxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pTxBuff_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRxBuff, (void*)cmock_call_instance->ReturnThruPtr_pRxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pRxBuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_TransmitReceiveData(CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength);
+void CMockExpectParameters_SPI_TransmitReceiveData(CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength)
+{
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_pTxBuff = pTxBuff;
+  cmock_call_instance->IgnoreArg_pTxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 0;
+  cmock_call_instance->Expected_pRxBuff = pRxBuff;
+  cmock_call_instance->IgnoreArg_pRxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 0;
+  cmock_call_instance->Expected_frameLength = frameLength;
+  cmock_call_instance->IgnoreArg_frameLength = 0;
+}
+
+void SPI_TransmitReceiveData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveData_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveData_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_TransmitReceiveData_IgnoreBool = (char)1;
+}
+
+void SPI_TransmitReceiveData_CMockStopIgnore(void)
+{
+  if(Mock.SPI_TransmitReceiveData_IgnoreBool)
+    Mock.SPI_TransmitReceiveData_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveData_CallInstance);
+  Mock.SPI_TransmitReceiveData_IgnoreBool = (char)0;
+}
+
+void SPI_TransmitReceiveData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveData_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveData_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveData(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_TransmitReceiveData_AddCallback(CMOCK_SPI_TransmitReceiveData_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveData_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveData_CallbackBool = (char)1;
+  Mock.SPI_TransmitReceiveData_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveData_Stub(CMOCK_SPI_TransmitReceiveData_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveData_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveData_CallbackBool = (char)0;
+  Mock.SPI_TransmitReceiveData_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveData_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveData_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveData(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_TransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16* pTxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Val = pTxBuff;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16* pRxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Val = pRxBuff;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveData_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void SPI_TransmitReceiveData_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTxBuff = 1;
+}
+
+void SPI_TransmitReceiveData_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRxBuff = 1;
+}
+
+void SPI_TransmitReceiveData_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_frameLength = 1;
+}
+
+STD_RETURN_TYPE_e SPI_DirectlyTransmitReceiveData(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_DirectlyTransmitReceiveData);
+  cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_DirectlyTransmitReceiveData_CallInstance);
+  Mock.SPI_DirectlyTransmitReceiveData_CallInstance = CMock_Guts_MemNext(Mock.SPI_DirectlyTransmitReceiveData_CallInstance);
+  if (Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_DirectlyTransmitReceiveData_FinalReturn;
+    memcpy((void*)(&Mock.SPI_DirectlyTransmitReceiveData_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_DirectlyTransmitReceiveData_CallbackBool &&
+      Mock.SPI_DirectlyTransmitReceiveData_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_DirectlyTransmitReceiveData_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_DirectlyTransmitReceiveData_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_DirectlyTransmitReceiveData,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_DirectlyTransmitReceiveData,CMockString_pTxBuff);
+    if (cmock_call_instance->Expected_pTxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pTxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pTxBuff, pTxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pRxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_DirectlyTransmitReceiveData,CMockString_pRxBuff);
+    if (cmock_call_instance->Expected_pRxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pRxBuff, pRxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_frameLength)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_DirectlyTransmitReceiveData,CMockString_frameLength);
+    UNITY_TEST_ASSERT_EQUAL_UINT32(cmock_call_instance->Expected_frameLength, frameLength, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_DirectlyTransmitReceiveData_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_DirectlyTransmitReceiveData_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_DirectlyTransmitReceiveData_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTxBuff, (void*)cmock_call_instance->ReturnThruPtr_pTxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pTxBuff_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRxBuff, (void*)cmock_call_instance->ReturnThruPtr_pRxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pRxBuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_DirectlyTransmitReceiveData(CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength);
+void CMockExpectParameters_SPI_DirectlyTransmitReceiveData(CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength)
+{
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_pTxBuff = pTxBuff;
+  cmock_call_instance->IgnoreArg_pTxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 0;
+  cmock_call_instance->Expected_pRxBuff = pRxBuff;
+  cmock_call_instance->IgnoreArg_pRxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 0;
+  cmock_call_instance->Expected_frameLength = frameLength;
+  cmock_call_instance->IgnoreArg_frameLength = 0;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE));
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_DirectlyTransmitReceiveData_CallInstance = CMock_Guts_MemChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance, cmock_guts_index);
+  Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool = (char)1;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockStopIgnore(void)
+{
+  if(Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool)
+    Mock.SPI_DirectlyTransmitReceiveData_CallInstance = CMock_Guts_MemNext(Mock.SPI_DirectlyTransmitReceiveData_CallInstance);
+  Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool = (char)0;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE));
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_DirectlyTransmitReceiveData_CallInstance = CMock_Guts_MemChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance, cmock_guts_index);
+  Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_DirectlyTransmitReceiveData(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_DirectlyTransmitReceiveData_AddCallback(CMOCK_SPI_DirectlyTransmitReceiveData_CALLBACK Callback)
+{
+  Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool = (char)0;
+  Mock.SPI_DirectlyTransmitReceiveData_CallbackBool = (char)1;
+  Mock.SPI_DirectlyTransmitReceiveData_CallbackFunctionPointer = Callback;
+}
+
+void SPI_DirectlyTransmitReceiveData_Stub(CMOCK_SPI_DirectlyTransmitReceiveData_CALLBACK Callback)
+{
+  Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool = (char)0;
+  Mock.SPI_DirectlyTransmitReceiveData_CallbackBool = (char)0;
+  Mock.SPI_DirectlyTransmitReceiveData_CallbackFunctionPointer = Callback;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE));
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_DirectlyTransmitReceiveData_CallInstance = CMock_Guts_MemChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance, cmock_guts_index);
+  Mock.SPI_DirectlyTransmitReceiveData_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_DirectlyTransmitReceiveData(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16* pTxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Val = pTxBuff;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Size = cmock_size;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16* pRxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Val = pRxBuff;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Size = cmock_size;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTxBuff = 1;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRxBuff = 1;
+}
+
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_DirectlyTransmitReceiveData_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_DirectlyTransmitReceiveData_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_frameLength = 1;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveDataDma);
+  cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_TransmitReceiveDataDma_CallInstance);
+  Mock.SPI_TransmitReceiveDataDma_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveDataDma_CallInstance);
+  if (Mock.SPI_TransmitReceiveDataDma_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_TransmitReceiveDataDma_FinalReturn;
+    memcpy((void*)(&Mock.SPI_TransmitReceiveDataDma_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_TransmitReceiveDataDma_CallbackBool &&
+      Mock.SPI_TransmitReceiveDataDma_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_TransmitReceiveDataDma_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveDataDma_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDma,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDma,CMockString_pTxBuff);
+    if (cmock_call_instance->Expected_pTxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pTxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pTxBuff, pTxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pRxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDma,CMockString_pRxBuff);
+    if (cmock_call_instance->Expected_pRxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pRxBuff, pRxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_frameLength)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDma,CMockString_frameLength);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_frameLength, frameLength, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_TransmitReceiveDataDma_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_TransmitReceiveDataDma_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveDataDma_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTxBuff, (void*)cmock_call_instance->ReturnThruPtr_pTxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pTxBuff_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRxBuff, (void*)cmock_call_instance->ReturnThruPtr_pRxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pRxBuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_TransmitReceiveDataDma(CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength);
+void CMockExpectParameters_SPI_TransmitReceiveDataDma(CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength)
+{
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_pTxBuff = pTxBuff;
+  cmock_call_instance->IgnoreArg_pTxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 0;
+  cmock_call_instance->Expected_pRxBuff = pRxBuff;
+  cmock_call_instance->IgnoreArg_pRxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 0;
+  cmock_call_instance->Expected_frameLength = frameLength;
+  cmock_call_instance->IgnoreArg_frameLength = 0;
+}
+
+void SPI_TransmitReceiveDataDma_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataDma_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataDma_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataDma_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_TransmitReceiveDataDma_IgnoreBool = (char)1;
+}
+
+void SPI_TransmitReceiveDataDma_CMockStopIgnore(void)
+{
+  if(Mock.SPI_TransmitReceiveDataDma_IgnoreBool)
+    Mock.SPI_TransmitReceiveDataDma_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveDataDma_CallInstance);
+  Mock.SPI_TransmitReceiveDataDma_IgnoreBool = (char)0;
+}
+
+void SPI_TransmitReceiveDataDma_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataDma_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataDma_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataDma_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveDataDma(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_TransmitReceiveDataDma_AddCallback(CMOCK_SPI_TransmitReceiveDataDma_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveDataDma_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveDataDma_CallbackBool = (char)1;
+  Mock.SPI_TransmitReceiveDataDma_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveDataDma_Stub(CMOCK_SPI_TransmitReceiveDataDma_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveDataDma_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveDataDma_CallbackBool = (char)0;
+  Mock.SPI_TransmitReceiveDataDma_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveDataDma_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataDma_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataDma_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataDma_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveDataDma(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Val = pTxBuff;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Val = pRxBuff;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataDma_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void SPI_TransmitReceiveDataDma_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTxBuff = 1;
+}
+
+void SPI_TransmitReceiveDataDma_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRxBuff = 1;
+}
+
+void SPI_TransmitReceiveDataDma_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_frameLength = 1;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitReceiveDataWithDummyDma(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveDataWithDummyDma);
+  cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance);
+  Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance);
+  if (Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_TransmitReceiveDataWithDummyDma_FinalReturn;
+    memcpy((void*)(&Mock.SPI_TransmitReceiveDataWithDummyDma_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackBool &&
+      Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackFunctionPointer(pSpiInterface, delay, wakeUpValidity_us, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataWithDummyDma,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_delay)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataWithDummyDma,CMockString_delay);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_delay, delay, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_wakeUpValidity_us)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataWithDummyDma,CMockString_wakeUpValidity_us);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_wakeUpValidity_us, wakeUpValidity_us, cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataWithDummyDma,CMockString_pTxBuff);
+    if (cmock_call_instance->Expected_pTxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pTxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pTxBuff, pTxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pRxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataWithDummyDma,CMockString_pRxBuff);
+    if (cmock_call_instance->Expected_pRxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pRxBuff, pRxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_frameLength)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataWithDummyDma,CMockString_frameLength);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_frameLength, frameLength, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackFunctionPointer(pSpiInterface, delay, wakeUpValidity_us, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTxBuff, (void*)cmock_call_instance->ReturnThruPtr_pTxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pTxBuff_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRxBuff, (void*)cmock_call_instance->ReturnThruPtr_pRxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pRxBuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_TransmitReceiveDataWithDummyDma(CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength);
+void CMockExpectParameters_SPI_TransmitReceiveDataWithDummyDma(CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength)
+{
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_delay = delay;
+  cmock_call_instance->IgnoreArg_delay = 0;
+  cmock_call_instance->Expected_wakeUpValidity_us = wakeUpValidity_us;
+  cmock_call_instance->IgnoreArg_wakeUpValidity_us = 0;
+  cmock_call_instance->Expected_pTxBuff = pTxBuff;
+  cmock_call_instance->IgnoreArg_pTxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 0;
+  cmock_call_instance->Expected_pRxBuff = pRxBuff;
+  cmock_call_instance->IgnoreArg_pRxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 0;
+  cmock_call_instance->Expected_frameLength = frameLength;
+  cmock_call_instance->IgnoreArg_frameLength = 0;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool = (char)1;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockStopIgnore(void)
+{
+  if(Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool)
+    Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance);
+  Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool = (char)0;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveDataWithDummyDma(cmock_call_instance, pSpiInterface, delay, wakeUpValidity_us, pTxBuff, pRxBuff, frameLength);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_AddCallback(CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackBool = (char)1;
+  Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_Stub(CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackBool = (char)0;
+  Mock.SPI_TransmitReceiveDataWithDummyDma_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataWithDummyDma_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveDataWithDummyDma(cmock_call_instance, pSpiInterface, delay, wakeUpValidity_us, pTxBuff, pRxBuff, frameLength);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Val = pTxBuff;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Val = pRxBuff;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_delay(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_delay = 1;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_wakeUpValidity_us(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_wakeUpValidity_us = 1;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTxBuff = 1;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRxBuff = 1;
+}
+
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataWithDummyDma_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_frameLength = 1;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaLocked(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveDataDmaLocked);
+  cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance);
+  Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance);
+  if (Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_TransmitReceiveDataDmaLocked_FinalReturn;
+    memcpy((void*)(&Mock.SPI_TransmitReceiveDataDmaLocked_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_TransmitReceiveDataDmaLocked_CallbackBool &&
+      Mock.SPI_TransmitReceiveDataDmaLocked_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_TransmitReceiveDataDmaLocked_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveDataDmaLocked_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDmaLocked,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDmaLocked,CMockString_pTxBuff);
+    if (cmock_call_instance->Expected_pTxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pTxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pTxBuff, pTxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pRxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDmaLocked,CMockString_pRxBuff);
+    if (cmock_call_instance->Expected_pRxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pRxBuff, pRxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_frameLength)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDmaLocked,CMockString_frameLength);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_frameLength, frameLength, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_TransmitReceiveDataDmaLocked_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_TransmitReceiveDataDmaLocked_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveDataDmaLocked_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTxBuff, (void*)cmock_call_instance->ReturnThruPtr_pTxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pTxBuff_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRxBuff, (void*)cmock_call_instance->ReturnThruPtr_pRxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pRxBuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_TransmitReceiveDataDmaLocked(CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength);
+void CMockExpectParameters_SPI_TransmitReceiveDataDmaLocked(CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength)
+{
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_pTxBuff = pTxBuff;
+  cmock_call_instance->IgnoreArg_pTxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 0;
+  cmock_call_instance->Expected_pRxBuff = pRxBuff;
+  cmock_call_instance->IgnoreArg_pRxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 0;
+  cmock_call_instance->Expected_frameLength = frameLength;
+  cmock_call_instance->IgnoreArg_frameLength = 0;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool = (char)1;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockStopIgnore(void)
+{
+  if(Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool)
+    Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance);
+  Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool = (char)0;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveDataDmaLocked(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_TransmitReceiveDataDmaLocked_AddCallback(CMOCK_SPI_TransmitReceiveDataDmaLocked_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveDataDmaLocked_CallbackBool = (char)1;
+  Mock.SPI_TransmitReceiveDataDmaLocked_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_Stub(CMOCK_SPI_TransmitReceiveDataDmaLocked_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveDataDmaLocked_CallbackBool = (char)0;
+  Mock.SPI_TransmitReceiveDataDmaLocked_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataDmaLocked_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveDataDmaLocked(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Val = pTxBuff;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Val = pRxBuff;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTxBuff = 1;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRxBuff = 1;
+}
+
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaLocked_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaLocked_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_frameLength = 1;
+}
+
+STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaFromIsr(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_TransmitReceiveDataDmaFromIsr);
+  cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance);
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance);
+  if (Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_TransmitReceiveDataDmaFromIsr_FinalReturn;
+    memcpy((void*)(&Mock.SPI_TransmitReceiveDataDmaFromIsr_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackBool &&
+      Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_pSpiInterface)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDmaFromIsr,CMockString_pSpiInterface);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(cmock_call_instance->Expected_pSpiInterface), (void*)(pSpiInterface), sizeof(SPI_INTERFACE_CONFIG_s), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_pTxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDmaFromIsr,CMockString_pTxBuff);
+    if (cmock_call_instance->Expected_pTxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pTxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pTxBuff, pTxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_pRxBuff)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDmaFromIsr,CMockString_pRxBuff);
+    if (cmock_call_instance->Expected_pRxBuff == NULL)
+      { UNITY_TEST_ASSERT_NULL(pRxBuff, cmock_line, CMockStringExpNULL); }
+    else
+      { UNITY_TEST_ASSERT_EQUAL_HEX16_ARRAY(cmock_call_instance->Expected_pRxBuff, pRxBuff, 1, cmock_line, CMockStringMismatch); }
+  }
+  if (!cmock_call_instance->IgnoreArg_frameLength)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_TransmitReceiveDataDmaFromIsr,CMockString_frameLength);
+    UNITY_TEST_ASSERT_EQUAL_HEX32(cmock_call_instance->Expected_frameLength, frameLength, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackFunctionPointer(pSpiInterface, pTxBuff, pRxBuff, frameLength, Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pSpiInterface_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pSpiInterface, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pSpiInterface, (void*)cmock_call_instance->ReturnThruPtr_pSpiInterface_Val,
+      cmock_call_instance->ReturnThruPtr_pSpiInterface_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pTxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pTxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pTxBuff, (void*)cmock_call_instance->ReturnThruPtr_pTxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pTxBuff_Size);
+  }
+  if (cmock_call_instance->ReturnThruPtr_pRxBuff_Used)
+  {
+    UNITY_TEST_ASSERT_NOT_NULL(pRxBuff, cmock_line, CMockStringPtrIsNULL);
+    memcpy((void*)pRxBuff, (void*)cmock_call_instance->ReturnThruPtr_pRxBuff_Val,
+      cmock_call_instance->ReturnThruPtr_pRxBuff_Size);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_TransmitReceiveDataDmaFromIsr(CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength);
+void CMockExpectParameters_SPI_TransmitReceiveDataDmaFromIsr(CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength)
+{
+  cmock_call_instance->Expected_pSpiInterface = pSpiInterface;
+  cmock_call_instance->IgnoreArg_pSpiInterface = 0;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 0;
+  cmock_call_instance->Expected_pTxBuff = pTxBuff;
+  cmock_call_instance->IgnoreArg_pTxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 0;
+  cmock_call_instance->Expected_pRxBuff = pRxBuff;
+  cmock_call_instance->IgnoreArg_pRxBuff = 0;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 0;
+  cmock_call_instance->Expected_frameLength = frameLength;
+  cmock_call_instance->IgnoreArg_frameLength = 0;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool = (char)1;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockStopIgnore(void)
+{
+  if(Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool)
+    Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance = CMock_Guts_MemNext(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance);
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool = (char)0;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveDataDmaFromIsr(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_AddCallback(CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackBool = (char)1;
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_Stub(CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALLBACK Callback)
+{
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool = (char)0;
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackBool = (char)0;
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_CallbackFunctionPointer = Callback;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE));
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance = CMock_Guts_MemChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance, cmock_guts_index);
+  Mock.SPI_TransmitReceiveDataDmaFromIsr_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_TransmitReceiveDataDmaFromIsr(cmock_call_instance, pSpiInterface, pTxBuff, pRxBuff, frameLength);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Val = pSpiInterface;
+  cmock_call_instance->ReturnThruPtr_pSpiInterface_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Val = pTxBuff;
+  cmock_call_instance->ReturnThruPtr_pTxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuff, size_t cmock_size)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringPtrPreExp);
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Used = 1;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Val = pRxBuff;
+  cmock_call_instance->ReturnThruPtr_pRxBuff_Size = cmock_size;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pSpiInterface = 1;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pTxBuff = 1;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_pRxBuff = 1;
+}
+
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_TransmitReceiveDataDmaFromIsr_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_frameLength = 1;
+}
+
+STD_RETURN_TYPE_e SPI_Lock(uint8_t spi)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_Lock_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_Lock);
+  cmock_call_instance = (CMOCK_SPI_Lock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_Lock_CallInstance);
+  Mock.SPI_Lock_CallInstance = CMock_Guts_MemNext(Mock.SPI_Lock_CallInstance);
+  if (Mock.SPI_Lock_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SPI_Lock_FinalReturn;
+    memcpy((void*)(&Mock.SPI_Lock_FinalReturn), (void*)(&cmock_call_instance->ReturnVal),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_call_instance->ReturnVal) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SPI_Lock_CallbackBool &&
+      Mock.SPI_Lock_CallbackFunctionPointer != NULL)
+  {
+    STD_RETURN_TYPE_e cmock_cb_ret = Mock.SPI_Lock_CallbackFunctionPointer(spi, Mock.SPI_Lock_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_spi)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_Lock,CMockString_spi);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_spi, spi, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_Lock_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SPI_Lock_CallbackFunctionPointer(spi, Mock.SPI_Lock_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SPI_Lock(CMOCK_SPI_Lock_CALL_INSTANCE* cmock_call_instance, uint8_t spi);
+void CMockExpectParameters_SPI_Lock(CMOCK_SPI_Lock_CALL_INSTANCE* cmock_call_instance, uint8_t spi)
+{
+  cmock_call_instance->Expected_spi = spi;
+  cmock_call_instance->IgnoreArg_spi = 0;
+}
+
+void SPI_Lock_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_Lock_CALL_INSTANCE));
+  CMOCK_SPI_Lock_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_Lock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_Lock_CallInstance = CMock_Guts_MemChain(Mock.SPI_Lock_CallInstance, cmock_guts_index);
+  Mock.SPI_Lock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SPI_Lock_IgnoreBool = (char)1;
+}
+
+void SPI_Lock_CMockStopIgnore(void)
+{
+  if(Mock.SPI_Lock_IgnoreBool)
+    Mock.SPI_Lock_CallInstance = CMock_Guts_MemNext(Mock.SPI_Lock_CallInstance);
+  Mock.SPI_Lock_IgnoreBool = (char)0;
+}
+
+void SPI_Lock_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t spi, STD_RETURN_TYPE_e cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_Lock_CALL_INSTANCE));
+  CMOCK_SPI_Lock_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_Lock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_Lock_CallInstance = CMock_Guts_MemChain(Mock.SPI_Lock_CallInstance, cmock_guts_index);
+  Mock.SPI_Lock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_Lock(cmock_call_instance, spi);
+  memcpy((void*)(&cmock_call_instance->ReturnVal), (void*)(&cmock_to_return),
+         sizeof(STD_RETURN_TYPE_e[sizeof(cmock_to_return) == sizeof(STD_RETURN_TYPE_e) ? 1 : -1])); /* add STD_RETURN_TYPE_e to :treat_as_array if this causes an error */
+}
+
+void SPI_Lock_AddCallback(CMOCK_SPI_Lock_CALLBACK Callback)
+{
+  Mock.SPI_Lock_IgnoreBool = (char)0;
+  Mock.SPI_Lock_CallbackBool = (char)1;
+  Mock.SPI_Lock_CallbackFunctionPointer = Callback;
+}
+
+void SPI_Lock_Stub(CMOCK_SPI_Lock_CALLBACK Callback)
+{
+  Mock.SPI_Lock_IgnoreBool = (char)0;
+  Mock.SPI_Lock_CallbackBool = (char)0;
+  Mock.SPI_Lock_CallbackFunctionPointer = Callback;
+}
+
+void SPI_Lock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t spi, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_Lock_CALL_INSTANCE));
+  CMOCK_SPI_Lock_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_Lock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_Lock_CallInstance = CMock_Guts_MemChain(Mock.SPI_Lock_CallInstance, cmock_guts_index);
+  Mock.SPI_Lock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_Lock(cmock_call_instance, spi);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_Lock_CMockIgnoreArg_spi(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_Lock_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_Lock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_Lock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_spi = 1;
+}
+
+void SPI_Unlock(uint8_t spi)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SPI_Unlock_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SPI_Unlock);
+  cmock_call_instance = (CMOCK_SPI_Unlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SPI_Unlock_CallInstance);
+  Mock.SPI_Unlock_CallInstance = CMock_Guts_MemNext(Mock.SPI_Unlock_CallInstance);
+  if (Mock.SPI_Unlock_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SPI_Unlock_CallbackBool &&
+      Mock.SPI_Unlock_CallbackFunctionPointer != NULL)
+  {
+    Mock.SPI_Unlock_CallbackFunctionPointer(spi, Mock.SPI_Unlock_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_spi)
+  {
+    UNITY_SET_DETAILS(CMockString_SPI_Unlock,CMockString_spi);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_spi, spi, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SPI_Unlock_CallbackFunctionPointer != NULL)
+  {
+    Mock.SPI_Unlock_CallbackFunctionPointer(spi, Mock.SPI_Unlock_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_SPI_Unlock(CMOCK_SPI_Unlock_CALL_INSTANCE* cmock_call_instance, uint8_t spi);
+void CMockExpectParameters_SPI_Unlock(CMOCK_SPI_Unlock_CALL_INSTANCE* cmock_call_instance, uint8_t spi)
+{
+  cmock_call_instance->Expected_spi = spi;
+  cmock_call_instance->IgnoreArg_spi = 0;
+}
+
+void SPI_Unlock_CMockIgnore(void)
+{
+  Mock.SPI_Unlock_IgnoreBool = (char)1;
+}
+
+void SPI_Unlock_CMockStopIgnore(void)
+{
+  Mock.SPI_Unlock_IgnoreBool = (char)0;
+}
+
+void SPI_Unlock_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t spi)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_Unlock_CALL_INSTANCE));
+  CMOCK_SPI_Unlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_Unlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_Unlock_CallInstance = CMock_Guts_MemChain(Mock.SPI_Unlock_CallInstance, cmock_guts_index);
+  Mock.SPI_Unlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_Unlock(cmock_call_instance, spi);
+}
+
+void SPI_Unlock_AddCallback(CMOCK_SPI_Unlock_CALLBACK Callback)
+{
+  Mock.SPI_Unlock_IgnoreBool = (char)0;
+  Mock.SPI_Unlock_CallbackBool = (char)1;
+  Mock.SPI_Unlock_CallbackFunctionPointer = Callback;
+}
+
+void SPI_Unlock_Stub(CMOCK_SPI_Unlock_CALLBACK Callback)
+{
+  Mock.SPI_Unlock_IgnoreBool = (char)0;
+  Mock.SPI_Unlock_CallbackBool = (char)0;
+  Mock.SPI_Unlock_CallbackFunctionPointer = Callback;
+}
+
+void SPI_Unlock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t spi, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SPI_Unlock_CALL_INSTANCE));
+  CMOCK_SPI_Unlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_Unlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SPI_Unlock_CallInstance = CMock_Guts_MemChain(Mock.SPI_Unlock_CallInstance, cmock_guts_index);
+  Mock.SPI_Unlock_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SPI_Unlock(cmock_call_instance, spi);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SPI_Unlock_CMockIgnoreArg_spi(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SPI_Unlock_CALL_INSTANCE* cmock_call_instance = (CMOCK_SPI_Unlock_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SPI_Unlock_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_spi = 1;
+}
+
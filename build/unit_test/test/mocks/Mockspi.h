@@ -0,0 +1,346 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKSPI_H
+#define _MOCKSPI_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "spi.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockspi_Init(void);
+void Mockspi_Destroy(void);
+void Mockspi_Verify(void);
+
+
+
+
+#define SPI_TransmitDummyByte_IgnoreAndReturn(cmock_retval) SPI_TransmitDummyByte_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_TransmitDummyByte_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_TransmitDummyByte_StopIgnore() SPI_TransmitDummyByte_CMockStopIgnore()
+void SPI_TransmitDummyByte_CMockStopIgnore(void);
+#define SPI_TransmitDummyByte_ExpectAndReturn(pSpiInterface, delay, cmock_retval) SPI_TransmitDummyByte_CMockExpectAndReturn(__LINE__, pSpiInterface, delay, cmock_retval)
+void SPI_TransmitDummyByte_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_TransmitDummyByte_CALLBACK)(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, int cmock_num_calls);
+void SPI_TransmitDummyByte_AddCallback(CMOCK_SPI_TransmitDummyByte_CALLBACK Callback);
+void SPI_TransmitDummyByte_Stub(CMOCK_SPI_TransmitDummyByte_CALLBACK Callback);
+#define SPI_TransmitDummyByte_StubWithCallback SPI_TransmitDummyByte_Stub
+#define SPI_TransmitDummyByte_ExpectAndThrow(pSpiInterface, delay, cmock_to_throw) SPI_TransmitDummyByte_CMockExpectAndThrow(__LINE__, pSpiInterface, delay, cmock_to_throw)
+void SPI_TransmitDummyByte_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, CEXCEPTION_T cmock_to_throw);
+#define SPI_TransmitDummyByte_ReturnThruPtr_pSpiInterface(pSpiInterface) SPI_TransmitDummyByte_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define SPI_TransmitDummyByte_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) SPI_TransmitDummyByte_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define SPI_TransmitDummyByte_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) SPI_TransmitDummyByte_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void SPI_TransmitDummyByte_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define SPI_TransmitDummyByte_IgnoreArg_pSpiInterface() SPI_TransmitDummyByte_CMockIgnoreArg_pSpiInterface(__LINE__)
+void SPI_TransmitDummyByte_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitDummyByte_IgnoreArg_delay() SPI_TransmitDummyByte_CMockIgnoreArg_delay(__LINE__)
+void SPI_TransmitDummyByte_CMockIgnoreArg_delay(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitDataWithDummy_IgnoreAndReturn(cmock_retval) SPI_TransmitDataWithDummy_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_TransmitDataWithDummy_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_TransmitDataWithDummy_StopIgnore() SPI_TransmitDataWithDummy_CMockStopIgnore()
+void SPI_TransmitDataWithDummy_CMockStopIgnore(void);
+#define SPI_TransmitDataWithDummy_ExpectAndReturn(pSpiInterface, delay, wakeUpValidity_us, pTxBuff, frameLength, cmock_retval) SPI_TransmitDataWithDummy_CMockExpectAndReturn(__LINE__, pSpiInterface, delay, wakeUpValidity_us, pTxBuff, frameLength, cmock_retval)
+void SPI_TransmitDataWithDummy_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_TransmitDataWithDummy_CALLBACK)(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint32_t frameLength, int cmock_num_calls);
+void SPI_TransmitDataWithDummy_AddCallback(CMOCK_SPI_TransmitDataWithDummy_CALLBACK Callback);
+void SPI_TransmitDataWithDummy_Stub(CMOCK_SPI_TransmitDataWithDummy_CALLBACK Callback);
+#define SPI_TransmitDataWithDummy_StubWithCallback SPI_TransmitDataWithDummy_Stub
+#define SPI_TransmitDataWithDummy_ExpectAndThrow(pSpiInterface, delay, wakeUpValidity_us, pTxBuff, frameLength, cmock_to_throw) SPI_TransmitDataWithDummy_CMockExpectAndThrow(__LINE__, pSpiInterface, delay, wakeUpValidity_us, pTxBuff, frameLength, cmock_to_throw)
+void SPI_TransmitDataWithDummy_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw);
+#define SPI_TransmitDataWithDummy_ReturnThruPtr_pSpiInterface(pSpiInterface) SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define SPI_TransmitDataWithDummy_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define SPI_TransmitDataWithDummy_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define SPI_TransmitDataWithDummy_ReturnThruPtr_pTxBuff(pTxBuff) SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, sizeof(uint16_t))
+#define SPI_TransmitDataWithDummy_ReturnArrayThruPtr_pTxBuff(pTxBuff, cmock_len) SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_len * sizeof(*pTxBuff))
+#define SPI_TransmitDataWithDummy_ReturnMemThruPtr_pTxBuff(pTxBuff, cmock_size) SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_size)
+void SPI_TransmitDataWithDummy_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size);
+#define SPI_TransmitDataWithDummy_IgnoreArg_pSpiInterface() SPI_TransmitDataWithDummy_CMockIgnoreArg_pSpiInterface(__LINE__)
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitDataWithDummy_IgnoreArg_delay() SPI_TransmitDataWithDummy_CMockIgnoreArg_delay(__LINE__)
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_delay(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitDataWithDummy_IgnoreArg_wakeUpValidity_us() SPI_TransmitDataWithDummy_CMockIgnoreArg_wakeUpValidity_us(__LINE__)
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_wakeUpValidity_us(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitDataWithDummy_IgnoreArg_pTxBuff() SPI_TransmitDataWithDummy_CMockIgnoreArg_pTxBuff(__LINE__)
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitDataWithDummy_IgnoreArg_frameLength() SPI_TransmitDataWithDummy_CMockIgnoreArg_frameLength(__LINE__)
+void SPI_TransmitDataWithDummy_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitData_IgnoreAndReturn(cmock_retval) SPI_TransmitData_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_TransmitData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_TransmitData_StopIgnore() SPI_TransmitData_CMockStopIgnore()
+void SPI_TransmitData_CMockStopIgnore(void);
+#define SPI_TransmitData_ExpectAndReturn(pSpiInterface, pTxBuff, frameLength, cmock_retval) SPI_TransmitData_CMockExpectAndReturn(__LINE__, pSpiInterface, pTxBuff, frameLength, cmock_retval)
+void SPI_TransmitData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_TransmitData_CALLBACK)(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint32_t frameLength, int cmock_num_calls);
+void SPI_TransmitData_AddCallback(CMOCK_SPI_TransmitData_CALLBACK Callback);
+void SPI_TransmitData_Stub(CMOCK_SPI_TransmitData_CALLBACK Callback);
+#define SPI_TransmitData_StubWithCallback SPI_TransmitData_Stub
+#define SPI_TransmitData_ExpectAndThrow(pSpiInterface, pTxBuff, frameLength, cmock_to_throw) SPI_TransmitData_CMockExpectAndThrow(__LINE__, pSpiInterface, pTxBuff, frameLength, cmock_to_throw)
+void SPI_TransmitData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw);
+#define SPI_TransmitData_ReturnThruPtr_pSpiInterface(pSpiInterface) SPI_TransmitData_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define SPI_TransmitData_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) SPI_TransmitData_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define SPI_TransmitData_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) SPI_TransmitData_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void SPI_TransmitData_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define SPI_TransmitData_ReturnThruPtr_pTxBuff(pTxBuff) SPI_TransmitData_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, sizeof(uint16_t))
+#define SPI_TransmitData_ReturnArrayThruPtr_pTxBuff(pTxBuff, cmock_len) SPI_TransmitData_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_len * sizeof(*pTxBuff))
+#define SPI_TransmitData_ReturnMemThruPtr_pTxBuff(pTxBuff, cmock_size) SPI_TransmitData_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_size)
+void SPI_TransmitData_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size);
+#define SPI_TransmitData_IgnoreArg_pSpiInterface() SPI_TransmitData_CMockIgnoreArg_pSpiInterface(__LINE__)
+void SPI_TransmitData_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitData_IgnoreArg_pTxBuff() SPI_TransmitData_CMockIgnoreArg_pTxBuff(__LINE__)
+void SPI_TransmitData_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitData_IgnoreArg_frameLength() SPI_TransmitData_CMockIgnoreArg_frameLength(__LINE__)
+void SPI_TransmitData_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveData_IgnoreAndReturn(cmock_retval) SPI_TransmitReceiveData_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_TransmitReceiveData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_TransmitReceiveData_StopIgnore() SPI_TransmitReceiveData_CMockStopIgnore()
+void SPI_TransmitReceiveData_CMockStopIgnore(void);
+#define SPI_TransmitReceiveData_ExpectAndReturn(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval) SPI_TransmitReceiveData_CMockExpectAndReturn(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval)
+void SPI_TransmitReceiveData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_TransmitReceiveData_CALLBACK)(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, int cmock_num_calls);
+void SPI_TransmitReceiveData_AddCallback(CMOCK_SPI_TransmitReceiveData_CALLBACK Callback);
+void SPI_TransmitReceiveData_Stub(CMOCK_SPI_TransmitReceiveData_CALLBACK Callback);
+#define SPI_TransmitReceiveData_StubWithCallback SPI_TransmitReceiveData_Stub
+#define SPI_TransmitReceiveData_ExpectAndThrow(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw) SPI_TransmitReceiveData_CMockExpectAndThrow(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw)
+void SPI_TransmitReceiveData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, CEXCEPTION_T cmock_to_throw);
+#define SPI_TransmitReceiveData_ReturnThruPtr_pSpiInterface(pSpiInterface) SPI_TransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define SPI_TransmitReceiveData_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) SPI_TransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define SPI_TransmitReceiveData_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) SPI_TransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void SPI_TransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define SPI_TransmitReceiveData_ReturnThruPtr_pTxBuff(pTxBuff) SPI_TransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, sizeof(uint16))
+#define SPI_TransmitReceiveData_ReturnArrayThruPtr_pTxBuff(pTxBuff, cmock_len) SPI_TransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_len * sizeof(*pTxBuff))
+#define SPI_TransmitReceiveData_ReturnMemThruPtr_pTxBuff(pTxBuff, cmock_size) SPI_TransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_size)
+void SPI_TransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16* pTxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveData_ReturnThruPtr_pRxBuff(pRxBuff) SPI_TransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, sizeof(uint16))
+#define SPI_TransmitReceiveData_ReturnArrayThruPtr_pRxBuff(pRxBuff, cmock_len) SPI_TransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_len * sizeof(*pRxBuff))
+#define SPI_TransmitReceiveData_ReturnMemThruPtr_pRxBuff(pRxBuff, cmock_size) SPI_TransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_size)
+void SPI_TransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16* pRxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveData_IgnoreArg_pSpiInterface() SPI_TransmitReceiveData_CMockIgnoreArg_pSpiInterface(__LINE__)
+void SPI_TransmitReceiveData_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveData_IgnoreArg_pTxBuff() SPI_TransmitReceiveData_CMockIgnoreArg_pTxBuff(__LINE__)
+void SPI_TransmitReceiveData_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveData_IgnoreArg_pRxBuff() SPI_TransmitReceiveData_CMockIgnoreArg_pRxBuff(__LINE__)
+void SPI_TransmitReceiveData_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveData_IgnoreArg_frameLength() SPI_TransmitReceiveData_CMockIgnoreArg_frameLength(__LINE__)
+void SPI_TransmitReceiveData_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line);
+#define SPI_DirectlyTransmitReceiveData_IgnoreAndReturn(cmock_retval) SPI_DirectlyTransmitReceiveData_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_DirectlyTransmitReceiveData_StopIgnore() SPI_DirectlyTransmitReceiveData_CMockStopIgnore()
+void SPI_DirectlyTransmitReceiveData_CMockStopIgnore(void);
+#define SPI_DirectlyTransmitReceiveData_ExpectAndReturn(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval) SPI_DirectlyTransmitReceiveData_CMockExpectAndReturn(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval)
+void SPI_DirectlyTransmitReceiveData_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_DirectlyTransmitReceiveData_CALLBACK)(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, int cmock_num_calls);
+void SPI_DirectlyTransmitReceiveData_AddCallback(CMOCK_SPI_DirectlyTransmitReceiveData_CALLBACK Callback);
+void SPI_DirectlyTransmitReceiveData_Stub(CMOCK_SPI_DirectlyTransmitReceiveData_CALLBACK Callback);
+#define SPI_DirectlyTransmitReceiveData_StubWithCallback SPI_DirectlyTransmitReceiveData_Stub
+#define SPI_DirectlyTransmitReceiveData_ExpectAndThrow(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw) SPI_DirectlyTransmitReceiveData_CMockExpectAndThrow(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw)
+void SPI_DirectlyTransmitReceiveData_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16* pTxBuff, uint16* pRxBuff, uint32 frameLength, CEXCEPTION_T cmock_to_throw);
+#define SPI_DirectlyTransmitReceiveData_ReturnThruPtr_pSpiInterface(pSpiInterface) SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define SPI_DirectlyTransmitReceiveData_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define SPI_DirectlyTransmitReceiveData_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define SPI_DirectlyTransmitReceiveData_ReturnThruPtr_pTxBuff(pTxBuff) SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, sizeof(uint16))
+#define SPI_DirectlyTransmitReceiveData_ReturnArrayThruPtr_pTxBuff(pTxBuff, cmock_len) SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_len * sizeof(*pTxBuff))
+#define SPI_DirectlyTransmitReceiveData_ReturnMemThruPtr_pTxBuff(pTxBuff, cmock_size) SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_size)
+void SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16* pTxBuff, size_t cmock_size);
+#define SPI_DirectlyTransmitReceiveData_ReturnThruPtr_pRxBuff(pRxBuff) SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, sizeof(uint16))
+#define SPI_DirectlyTransmitReceiveData_ReturnArrayThruPtr_pRxBuff(pRxBuff, cmock_len) SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_len * sizeof(*pRxBuff))
+#define SPI_DirectlyTransmitReceiveData_ReturnMemThruPtr_pRxBuff(pRxBuff, cmock_size) SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_size)
+void SPI_DirectlyTransmitReceiveData_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16* pRxBuff, size_t cmock_size);
+#define SPI_DirectlyTransmitReceiveData_IgnoreArg_pSpiInterface() SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_pSpiInterface(__LINE__)
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define SPI_DirectlyTransmitReceiveData_IgnoreArg_pTxBuff() SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_pTxBuff(__LINE__)
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_DirectlyTransmitReceiveData_IgnoreArg_pRxBuff() SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_pRxBuff(__LINE__)
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_DirectlyTransmitReceiveData_IgnoreArg_frameLength() SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_frameLength(__LINE__)
+void SPI_DirectlyTransmitReceiveData_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDma_IgnoreAndReturn(cmock_retval) SPI_TransmitReceiveDataDma_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_TransmitReceiveDataDma_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_TransmitReceiveDataDma_StopIgnore() SPI_TransmitReceiveDataDma_CMockStopIgnore()
+void SPI_TransmitReceiveDataDma_CMockStopIgnore(void);
+#define SPI_TransmitReceiveDataDma_ExpectAndReturn(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval) SPI_TransmitReceiveDataDma_CMockExpectAndReturn(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval)
+void SPI_TransmitReceiveDataDma_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_TransmitReceiveDataDma_CALLBACK)(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, int cmock_num_calls);
+void SPI_TransmitReceiveDataDma_AddCallback(CMOCK_SPI_TransmitReceiveDataDma_CALLBACK Callback);
+void SPI_TransmitReceiveDataDma_Stub(CMOCK_SPI_TransmitReceiveDataDma_CALLBACK Callback);
+#define SPI_TransmitReceiveDataDma_StubWithCallback SPI_TransmitReceiveDataDma_Stub
+#define SPI_TransmitReceiveDataDma_ExpectAndThrow(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw) SPI_TransmitReceiveDataDma_CMockExpectAndThrow(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw)
+void SPI_TransmitReceiveDataDma_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw);
+#define SPI_TransmitReceiveDataDma_ReturnThruPtr_pSpiInterface(pSpiInterface) SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define SPI_TransmitReceiveDataDma_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define SPI_TransmitReceiveDataDma_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define SPI_TransmitReceiveDataDma_ReturnThruPtr_pTxBuff(pTxBuff) SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, sizeof(uint16_t))
+#define SPI_TransmitReceiveDataDma_ReturnArrayThruPtr_pTxBuff(pTxBuff, cmock_len) SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_len * sizeof(*pTxBuff))
+#define SPI_TransmitReceiveDataDma_ReturnMemThruPtr_pTxBuff(pTxBuff, cmock_size) SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_size)
+void SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveDataDma_ReturnThruPtr_pRxBuff(pRxBuff) SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, sizeof(uint16_t))
+#define SPI_TransmitReceiveDataDma_ReturnArrayThruPtr_pRxBuff(pRxBuff, cmock_len) SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_len * sizeof(*pRxBuff))
+#define SPI_TransmitReceiveDataDma_ReturnMemThruPtr_pRxBuff(pRxBuff, cmock_size) SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_size)
+void SPI_TransmitReceiveDataDma_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveDataDma_IgnoreArg_pSpiInterface() SPI_TransmitReceiveDataDma_CMockIgnoreArg_pSpiInterface(__LINE__)
+void SPI_TransmitReceiveDataDma_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDma_IgnoreArg_pTxBuff() SPI_TransmitReceiveDataDma_CMockIgnoreArg_pTxBuff(__LINE__)
+void SPI_TransmitReceiveDataDma_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDma_IgnoreArg_pRxBuff() SPI_TransmitReceiveDataDma_CMockIgnoreArg_pRxBuff(__LINE__)
+void SPI_TransmitReceiveDataDma_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDma_IgnoreArg_frameLength() SPI_TransmitReceiveDataDma_CMockIgnoreArg_frameLength(__LINE__)
+void SPI_TransmitReceiveDataDma_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataWithDummyDma_IgnoreAndReturn(cmock_retval) SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_TransmitReceiveDataWithDummyDma_StopIgnore() SPI_TransmitReceiveDataWithDummyDma_CMockStopIgnore()
+void SPI_TransmitReceiveDataWithDummyDma_CMockStopIgnore(void);
+#define SPI_TransmitReceiveDataWithDummyDma_ExpectAndReturn(pSpiInterface, delay, wakeUpValidity_us, pTxBuff, pRxBuff, frameLength, cmock_retval) SPI_TransmitReceiveDataWithDummyDma_CMockExpectAndReturn(__LINE__, pSpiInterface, delay, wakeUpValidity_us, pTxBuff, pRxBuff, frameLength, cmock_retval)
+void SPI_TransmitReceiveDataWithDummyDma_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALLBACK)(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, int cmock_num_calls);
+void SPI_TransmitReceiveDataWithDummyDma_AddCallback(CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALLBACK Callback);
+void SPI_TransmitReceiveDataWithDummyDma_Stub(CMOCK_SPI_TransmitReceiveDataWithDummyDma_CALLBACK Callback);
+#define SPI_TransmitReceiveDataWithDummyDma_StubWithCallback SPI_TransmitReceiveDataWithDummyDma_Stub
+#define SPI_TransmitReceiveDataWithDummyDma_ExpectAndThrow(pSpiInterface, delay, wakeUpValidity_us, pTxBuff, pRxBuff, frameLength, cmock_to_throw) SPI_TransmitReceiveDataWithDummyDma_CMockExpectAndThrow(__LINE__, pSpiInterface, delay, wakeUpValidity_us, pTxBuff, pRxBuff, frameLength, cmock_to_throw)
+void SPI_TransmitReceiveDataWithDummyDma_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint32_t delay, uint32_t wakeUpValidity_us, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw);
+#define SPI_TransmitReceiveDataWithDummyDma_ReturnThruPtr_pSpiInterface(pSpiInterface) SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define SPI_TransmitReceiveDataWithDummyDma_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define SPI_TransmitReceiveDataWithDummyDma_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define SPI_TransmitReceiveDataWithDummyDma_ReturnThruPtr_pTxBuff(pTxBuff) SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, sizeof(uint16_t))
+#define SPI_TransmitReceiveDataWithDummyDma_ReturnArrayThruPtr_pTxBuff(pTxBuff, cmock_len) SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_len * sizeof(*pTxBuff))
+#define SPI_TransmitReceiveDataWithDummyDma_ReturnMemThruPtr_pTxBuff(pTxBuff, cmock_size) SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_size)
+void SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveDataWithDummyDma_ReturnThruPtr_pRxBuff(pRxBuff) SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, sizeof(uint16_t))
+#define SPI_TransmitReceiveDataWithDummyDma_ReturnArrayThruPtr_pRxBuff(pRxBuff, cmock_len) SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_len * sizeof(*pRxBuff))
+#define SPI_TransmitReceiveDataWithDummyDma_ReturnMemThruPtr_pRxBuff(pRxBuff, cmock_size) SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_size)
+void SPI_TransmitReceiveDataWithDummyDma_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveDataWithDummyDma_IgnoreArg_pSpiInterface() SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_pSpiInterface(__LINE__)
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataWithDummyDma_IgnoreArg_delay() SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_delay(__LINE__)
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_delay(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataWithDummyDma_IgnoreArg_wakeUpValidity_us() SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_wakeUpValidity_us(__LINE__)
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_wakeUpValidity_us(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataWithDummyDma_IgnoreArg_pTxBuff() SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_pTxBuff(__LINE__)
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataWithDummyDma_IgnoreArg_pRxBuff() SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_pRxBuff(__LINE__)
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataWithDummyDma_IgnoreArg_frameLength() SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_frameLength(__LINE__)
+void SPI_TransmitReceiveDataWithDummyDma_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDmaLocked_IgnoreAndReturn(cmock_retval) SPI_TransmitReceiveDataDmaLocked_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_TransmitReceiveDataDmaLocked_StopIgnore() SPI_TransmitReceiveDataDmaLocked_CMockStopIgnore()
+void SPI_TransmitReceiveDataDmaLocked_CMockStopIgnore(void);
+#define SPI_TransmitReceiveDataDmaLocked_ExpectAndReturn(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval) SPI_TransmitReceiveDataDmaLocked_CMockExpectAndReturn(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval)
+void SPI_TransmitReceiveDataDmaLocked_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_TransmitReceiveDataDmaLocked_CALLBACK)(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, int cmock_num_calls);
+void SPI_TransmitReceiveDataDmaLocked_AddCallback(CMOCK_SPI_TransmitReceiveDataDmaLocked_CALLBACK Callback);
+void SPI_TransmitReceiveDataDmaLocked_Stub(CMOCK_SPI_TransmitReceiveDataDmaLocked_CALLBACK Callback);
+#define SPI_TransmitReceiveDataDmaLocked_StubWithCallback SPI_TransmitReceiveDataDmaLocked_Stub
+#define SPI_TransmitReceiveDataDmaLocked_ExpectAndThrow(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw) SPI_TransmitReceiveDataDmaLocked_CMockExpectAndThrow(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw)
+void SPI_TransmitReceiveDataDmaLocked_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw);
+#define SPI_TransmitReceiveDataDmaLocked_ReturnThruPtr_pSpiInterface(pSpiInterface) SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define SPI_TransmitReceiveDataDmaLocked_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define SPI_TransmitReceiveDataDmaLocked_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define SPI_TransmitReceiveDataDmaLocked_ReturnThruPtr_pTxBuff(pTxBuff) SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, sizeof(uint16_t))
+#define SPI_TransmitReceiveDataDmaLocked_ReturnArrayThruPtr_pTxBuff(pTxBuff, cmock_len) SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_len * sizeof(*pTxBuff))
+#define SPI_TransmitReceiveDataDmaLocked_ReturnMemThruPtr_pTxBuff(pTxBuff, cmock_size) SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_size)
+void SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveDataDmaLocked_ReturnThruPtr_pRxBuff(pRxBuff) SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, sizeof(uint16_t))
+#define SPI_TransmitReceiveDataDmaLocked_ReturnArrayThruPtr_pRxBuff(pRxBuff, cmock_len) SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_len * sizeof(*pRxBuff))
+#define SPI_TransmitReceiveDataDmaLocked_ReturnMemThruPtr_pRxBuff(pRxBuff, cmock_size) SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_size)
+void SPI_TransmitReceiveDataDmaLocked_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveDataDmaLocked_IgnoreArg_pSpiInterface() SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pSpiInterface(__LINE__)
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDmaLocked_IgnoreArg_pTxBuff() SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pTxBuff(__LINE__)
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDmaLocked_IgnoreArg_pRxBuff() SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pRxBuff(__LINE__)
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDmaLocked_IgnoreArg_frameLength() SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_frameLength(__LINE__)
+void SPI_TransmitReceiveDataDmaLocked_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDmaFromIsr_IgnoreAndReturn(cmock_retval) SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_TransmitReceiveDataDmaFromIsr_StopIgnore() SPI_TransmitReceiveDataDmaFromIsr_CMockStopIgnore()
+void SPI_TransmitReceiveDataDmaFromIsr_CMockStopIgnore(void);
+#define SPI_TransmitReceiveDataDmaFromIsr_ExpectAndReturn(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval) SPI_TransmitReceiveDataDmaFromIsr_CMockExpectAndReturn(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_retval)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALLBACK)(SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, int cmock_num_calls);
+void SPI_TransmitReceiveDataDmaFromIsr_AddCallback(CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALLBACK Callback);
+void SPI_TransmitReceiveDataDmaFromIsr_Stub(CMOCK_SPI_TransmitReceiveDataDmaFromIsr_CALLBACK Callback);
+#define SPI_TransmitReceiveDataDmaFromIsr_StubWithCallback SPI_TransmitReceiveDataDmaFromIsr_Stub
+#define SPI_TransmitReceiveDataDmaFromIsr_ExpectAndThrow(pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw) SPI_TransmitReceiveDataDmaFromIsr_CMockExpectAndThrow(__LINE__, pSpiInterface, pTxBuff, pRxBuff, frameLength, cmock_to_throw)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, uint16_t* pTxBuff, uint16_t* pRxBuff, uint32_t frameLength, CEXCEPTION_T cmock_to_throw);
+#define SPI_TransmitReceiveDataDmaFromIsr_ReturnThruPtr_pSpiInterface(pSpiInterface) SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, sizeof(SPI_INTERFACE_CONFIG_s))
+#define SPI_TransmitReceiveDataDmaFromIsr_ReturnArrayThruPtr_pSpiInterface(pSpiInterface, cmock_len) SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_len * sizeof(*pSpiInterface))
+#define SPI_TransmitReceiveDataDmaFromIsr_ReturnMemThruPtr_pSpiInterface(pSpiInterface, cmock_size) SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pSpiInterface(__LINE__, pSpiInterface, cmock_size)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pSpiInterface(UNITY_LINE_TYPE cmock_line, SPI_INTERFACE_CONFIG_s* pSpiInterface, size_t cmock_size);
+#define SPI_TransmitReceiveDataDmaFromIsr_ReturnThruPtr_pTxBuff(pTxBuff) SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, sizeof(uint16_t))
+#define SPI_TransmitReceiveDataDmaFromIsr_ReturnArrayThruPtr_pTxBuff(pTxBuff, cmock_len) SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_len * sizeof(*pTxBuff))
+#define SPI_TransmitReceiveDataDmaFromIsr_ReturnMemThruPtr_pTxBuff(pTxBuff, cmock_size) SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pTxBuff(__LINE__, pTxBuff, cmock_size)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pTxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pTxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveDataDmaFromIsr_ReturnThruPtr_pRxBuff(pRxBuff) SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, sizeof(uint16_t))
+#define SPI_TransmitReceiveDataDmaFromIsr_ReturnArrayThruPtr_pRxBuff(pRxBuff, cmock_len) SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_len * sizeof(*pRxBuff))
+#define SPI_TransmitReceiveDataDmaFromIsr_ReturnMemThruPtr_pRxBuff(pRxBuff, cmock_size) SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pRxBuff(__LINE__, pRxBuff, cmock_size)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockReturnMemThruPtr_pRxBuff(UNITY_LINE_TYPE cmock_line, uint16_t* pRxBuff, size_t cmock_size);
+#define SPI_TransmitReceiveDataDmaFromIsr_IgnoreArg_pSpiInterface() SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_pSpiInterface(__LINE__)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_pSpiInterface(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDmaFromIsr_IgnoreArg_pTxBuff() SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_pTxBuff(__LINE__)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_pTxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDmaFromIsr_IgnoreArg_pRxBuff() SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_pRxBuff(__LINE__)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_pRxBuff(UNITY_LINE_TYPE cmock_line);
+#define SPI_TransmitReceiveDataDmaFromIsr_IgnoreArg_frameLength() SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_frameLength(__LINE__)
+void SPI_TransmitReceiveDataDmaFromIsr_CMockIgnoreArg_frameLength(UNITY_LINE_TYPE cmock_line);
+#define SPI_Lock_IgnoreAndReturn(cmock_retval) SPI_Lock_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SPI_Lock_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, STD_RETURN_TYPE_e cmock_to_return);
+#define SPI_Lock_StopIgnore() SPI_Lock_CMockStopIgnore()
+void SPI_Lock_CMockStopIgnore(void);
+#define SPI_Lock_ExpectAndReturn(spi, cmock_retval) SPI_Lock_CMockExpectAndReturn(__LINE__, spi, cmock_retval)
+void SPI_Lock_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint8_t spi, STD_RETURN_TYPE_e cmock_to_return);
+typedef STD_RETURN_TYPE_e (* CMOCK_SPI_Lock_CALLBACK)(uint8_t spi, int cmock_num_calls);
+void SPI_Lock_AddCallback(CMOCK_SPI_Lock_CALLBACK Callback);
+void SPI_Lock_Stub(CMOCK_SPI_Lock_CALLBACK Callback);
+#define SPI_Lock_StubWithCallback SPI_Lock_Stub
+#define SPI_Lock_ExpectAndThrow(spi, cmock_to_throw) SPI_Lock_CMockExpectAndThrow(__LINE__, spi, cmock_to_throw)
+void SPI_Lock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t spi, CEXCEPTION_T cmock_to_throw);
+#define SPI_Lock_IgnoreArg_spi() SPI_Lock_CMockIgnoreArg_spi(__LINE__)
+void SPI_Lock_CMockIgnoreArg_spi(UNITY_LINE_TYPE cmock_line);
+#define SPI_Unlock_Ignore() SPI_Unlock_CMockIgnore()
+void SPI_Unlock_CMockIgnore(void);
+#define SPI_Unlock_StopIgnore() SPI_Unlock_CMockStopIgnore()
+void SPI_Unlock_CMockStopIgnore(void);
+#define SPI_Unlock_Expect(spi) SPI_Unlock_CMockExpect(__LINE__, spi)
+void SPI_Unlock_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t spi);
+typedef void (* CMOCK_SPI_Unlock_CALLBACK)(uint8_t spi, int cmock_num_calls);
+void SPI_Unlock_AddCallback(CMOCK_SPI_Unlock_CALLBACK Callback);
+void SPI_Unlock_Stub(CMOCK_SPI_Unlock_CALLBACK Callback);
+#define SPI_Unlock_StubWithCallback SPI_Unlock_Stub
+#define SPI_Unlock_ExpectAndThrow(spi, cmock_to_throw) SPI_Unlock_CMockExpectAndThrow(__LINE__, spi, cmock_to_throw)
+void SPI_Unlock_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t spi, CEXCEPTION_T cmock_to_throw);
+#define SPI_Unlock_IgnoreArg_spi() SPI_Unlock_CMockIgnoreArg_spi(__LINE__)
+void SPI_Unlock_CMockIgnoreArg_spi(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
@@ -0,0 +1,965 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mockstate_estimation.h"
+
+static const char* CMockString_SOC_Calculation = "SOC_Calculation";
+static const char* CMockString_SOC_GetFromVoltage = "SOC_GetFromVoltage";
+static const char* CMockString_SOC_Init = "SOC_Init";
+static const char* CMockString_SOE_Calculation = "SOE_Calculation";
+static const char* CMockString_SOE_Init = "SOE_Init";
+static const char* CMockString_SOH_Calculation = "SOH_Calculation";
+static const char* CMockString_SOH_Init = "SOH_Init";
+static const char* CMockString_cc_present = "cc_present";
+static const char* CMockString_ec_present = "ec_present";
+static const char* CMockString_stringNumber = "stringNumber";
+static const char* CMockString_voltage_mV = "voltage_mV";
+
+typedef struct _CMOCK_SOC_Init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  _Bool Expected_cc_present;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_cc_present;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_SOC_Init_CALL_INSTANCE;
+
+typedef struct _CMOCK_SOC_Calculation_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_SOC_Calculation_CALL_INSTANCE;
+
+typedef struct _CMOCK_SOC_GetFromVoltage_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  float ReturnVal;
+  int CallOrder;
+  int16_t Expected_voltage_mV;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_voltage_mV;
+
+} CMOCK_SOC_GetFromVoltage_CALL_INSTANCE;
+
+typedef struct _CMOCK_SOE_Init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  _Bool Expected_ec_present;
+  uint8_t Expected_stringNumber;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_ec_present;
+  char IgnoreArg_stringNumber;
+
+} CMOCK_SOE_Init_CALL_INSTANCE;
+
+typedef struct _CMOCK_SOE_Calculation_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_SOE_Calculation_CALL_INSTANCE;
+
+typedef struct _CMOCK_SOH_Init_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_SOH_Init_CALL_INSTANCE;
+
+typedef struct _CMOCK_SOH_Calculation_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_SOH_Calculation_CALL_INSTANCE;
+
+static struct Mockstate_estimationInstance
+{
+  char SOC_Init_IgnoreBool;
+  char SOC_Init_CallbackBool;
+  CMOCK_SOC_Init_CALLBACK SOC_Init_CallbackFunctionPointer;
+  int SOC_Init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SOC_Init_CallInstance;
+  char SOC_Calculation_IgnoreBool;
+  char SOC_Calculation_CallbackBool;
+  CMOCK_SOC_Calculation_CALLBACK SOC_Calculation_CallbackFunctionPointer;
+  int SOC_Calculation_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SOC_Calculation_CallInstance;
+  char SOC_GetFromVoltage_IgnoreBool;
+  float SOC_GetFromVoltage_FinalReturn;
+  char SOC_GetFromVoltage_CallbackBool;
+  CMOCK_SOC_GetFromVoltage_CALLBACK SOC_GetFromVoltage_CallbackFunctionPointer;
+  int SOC_GetFromVoltage_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SOC_GetFromVoltage_CallInstance;
+  char SOE_Init_IgnoreBool;
+  char SOE_Init_CallbackBool;
+  CMOCK_SOE_Init_CALLBACK SOE_Init_CallbackFunctionPointer;
+  int SOE_Init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SOE_Init_CallInstance;
+  char SOE_Calculation_IgnoreBool;
+  char SOE_Calculation_CallbackBool;
+  CMOCK_SOE_Calculation_CALLBACK SOE_Calculation_CallbackFunctionPointer;
+  int SOE_Calculation_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SOE_Calculation_CallInstance;
+  char SOH_Init_IgnoreBool;
+  char SOH_Init_CallbackBool;
+  CMOCK_SOH_Init_CALLBACK SOH_Init_CallbackFunctionPointer;
+  int SOH_Init_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SOH_Init_CallInstance;
+  char SOH_Calculation_IgnoreBool;
+  char SOH_Calculation_CallbackBool;
+  CMOCK_SOH_Calculation_CALLBACK SOH_Calculation_CallbackFunctionPointer;
+  int SOH_Calculation_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SOH_Calculation_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mockstate_estimation_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.SOC_Init_CallInstance;
+  if (Mock.SOC_Init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SOC_Init);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SOC_Init_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SOC_Calculation_CallInstance;
+  if (Mock.SOC_Calculation_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SOC_Calculation);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SOC_Calculation_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SOC_GetFromVoltage_CallInstance;
+  if (Mock.SOC_GetFromVoltage_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SOC_GetFromVoltage);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SOC_GetFromVoltage_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SOE_Init_CallInstance;
+  if (Mock.SOE_Init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SOE_Init);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SOE_Init_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SOE_Calculation_CallInstance;
+  if (Mock.SOE_Calculation_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SOE_Calculation);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SOE_Calculation_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SOH_Init_CallInstance;
+  if (Mock.SOH_Init_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SOH_Init);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SOH_Init_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.SOH_Calculation_CallInstance;
+  if (Mock.SOH_Calculation_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SOH_Calculation);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SOH_Calculation_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mockstate_estimation_Init(void)
+{
+  Mockstate_estimation_Destroy();
+}
+
+void Mockstate_estimation_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void SOC_Init(_Bool cc_present, uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SOC_Init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SOC_Init);
+  cmock_call_instance = (CMOCK_SOC_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SOC_Init_CallInstance);
+  Mock.SOC_Init_CallInstance = CMock_Guts_MemNext(Mock.SOC_Init_CallInstance);
+  if (Mock.SOC_Init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SOC_Init_CallbackBool &&
+      Mock.SOC_Init_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOC_Init_CallbackFunctionPointer(cc_present, stringNumber, Mock.SOC_Init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_cc_present)
+  {
+    UNITY_SET_DETAILS(CMockString_SOC_Init,CMockString_cc_present);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_cc_present), (void*)(&cc_present), sizeof(_Bool), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_SOC_Init,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SOC_Init_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOC_Init_CallbackFunctionPointer(cc_present, stringNumber, Mock.SOC_Init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_SOC_Init(CMOCK_SOC_Init_CALL_INSTANCE* cmock_call_instance, _Bool cc_present, uint8_t stringNumber);
+void CMockExpectParameters_SOC_Init(CMOCK_SOC_Init_CALL_INSTANCE* cmock_call_instance, _Bool cc_present, uint8_t stringNumber)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_cc_present), (void*)(&cc_present),
+         sizeof(_Bool[sizeof(cc_present) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_cc_present = 0;
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void SOC_Init_CMockIgnore(void)
+{
+  Mock.SOC_Init_IgnoreBool = (char)1;
+}
+
+void SOC_Init_CMockStopIgnore(void)
+{
+  Mock.SOC_Init_IgnoreBool = (char)0;
+}
+
+void SOC_Init_CMockExpect(UNITY_LINE_TYPE cmock_line, _Bool cc_present, uint8_t stringNumber)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOC_Init_CALL_INSTANCE));
+  CMOCK_SOC_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOC_Init_CallInstance = CMock_Guts_MemChain(Mock.SOC_Init_CallInstance, cmock_guts_index);
+  Mock.SOC_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SOC_Init(cmock_call_instance, cc_present, stringNumber);
+}
+
+void SOC_Init_AddCallback(CMOCK_SOC_Init_CALLBACK Callback)
+{
+  Mock.SOC_Init_IgnoreBool = (char)0;
+  Mock.SOC_Init_CallbackBool = (char)1;
+  Mock.SOC_Init_CallbackFunctionPointer = Callback;
+}
+
+void SOC_Init_Stub(CMOCK_SOC_Init_CALLBACK Callback)
+{
+  Mock.SOC_Init_IgnoreBool = (char)0;
+  Mock.SOC_Init_CallbackBool = (char)0;
+  Mock.SOC_Init_CallbackFunctionPointer = Callback;
+}
+
+void SOC_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, _Bool cc_present, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOC_Init_CALL_INSTANCE));
+  CMOCK_SOC_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOC_Init_CallInstance = CMock_Guts_MemChain(Mock.SOC_Init_CallInstance, cmock_guts_index);
+  Mock.SOC_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SOC_Init(cmock_call_instance, cc_present, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SOC_Init_CMockIgnoreArg_cc_present(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SOC_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SOC_Init_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_cc_present = 1;
+}
+
+void SOC_Init_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SOC_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SOC_Init_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+void SOC_Calculation(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SOC_Calculation_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SOC_Calculation);
+  cmock_call_instance = (CMOCK_SOC_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SOC_Calculation_CallInstance);
+  Mock.SOC_Calculation_CallInstance = CMock_Guts_MemNext(Mock.SOC_Calculation_CallInstance);
+  if (Mock.SOC_Calculation_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SOC_Calculation_CallbackBool &&
+      Mock.SOC_Calculation_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOC_Calculation_CallbackFunctionPointer(Mock.SOC_Calculation_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.SOC_Calculation_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOC_Calculation_CallbackFunctionPointer(Mock.SOC_Calculation_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void SOC_Calculation_CMockIgnore(void)
+{
+  Mock.SOC_Calculation_IgnoreBool = (char)1;
+}
+
+void SOC_Calculation_CMockStopIgnore(void)
+{
+  Mock.SOC_Calculation_IgnoreBool = (char)0;
+}
+
+void SOC_Calculation_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOC_Calculation_CALL_INSTANCE));
+  CMOCK_SOC_Calculation_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOC_Calculation_CallInstance = CMock_Guts_MemChain(Mock.SOC_Calculation_CallInstance, cmock_guts_index);
+  Mock.SOC_Calculation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void SOC_Calculation_AddCallback(CMOCK_SOC_Calculation_CALLBACK Callback)
+{
+  Mock.SOC_Calculation_IgnoreBool = (char)0;
+  Mock.SOC_Calculation_CallbackBool = (char)1;
+  Mock.SOC_Calculation_CallbackFunctionPointer = Callback;
+}
+
+void SOC_Calculation_Stub(CMOCK_SOC_Calculation_CALLBACK Callback)
+{
+  Mock.SOC_Calculation_IgnoreBool = (char)0;
+  Mock.SOC_Calculation_CallbackBool = (char)0;
+  Mock.SOC_Calculation_CallbackFunctionPointer = Callback;
+}
+
+void SOC_Calculation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOC_Calculation_CALL_INSTANCE));
+  CMOCK_SOC_Calculation_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOC_Calculation_CallInstance = CMock_Guts_MemChain(Mock.SOC_Calculation_CallInstance, cmock_guts_index);
+  Mock.SOC_Calculation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+float SOC_GetFromVoltage(int16_t voltage_mV)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SOC_GetFromVoltage_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SOC_GetFromVoltage);
+  cmock_call_instance = (CMOCK_SOC_GetFromVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SOC_GetFromVoltage_CallInstance);
+  Mock.SOC_GetFromVoltage_CallInstance = CMock_Guts_MemNext(Mock.SOC_GetFromVoltage_CallInstance);
+  if (Mock.SOC_GetFromVoltage_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.SOC_GetFromVoltage_FinalReturn;
+    Mock.SOC_GetFromVoltage_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.SOC_GetFromVoltage_CallbackBool &&
+      Mock.SOC_GetFromVoltage_CallbackFunctionPointer != NULL)
+  {
+    float cmock_cb_ret = Mock.SOC_GetFromVoltage_CallbackFunctionPointer(voltage_mV, Mock.SOC_GetFromVoltage_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_voltage_mV)
+  {
+    UNITY_SET_DETAILS(CMockString_SOC_GetFromVoltage,CMockString_voltage_mV);
+    UNITY_TEST_ASSERT_EQUAL_INT16(cmock_call_instance->Expected_voltage_mV, voltage_mV, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SOC_GetFromVoltage_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.SOC_GetFromVoltage_CallbackFunctionPointer(voltage_mV, Mock.SOC_GetFromVoltage_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_SOC_GetFromVoltage(CMOCK_SOC_GetFromVoltage_CALL_INSTANCE* cmock_call_instance, int16_t voltage_mV);
+void CMockExpectParameters_SOC_GetFromVoltage(CMOCK_SOC_GetFromVoltage_CALL_INSTANCE* cmock_call_instance, int16_t voltage_mV)
+{
+  cmock_call_instance->Expected_voltage_mV = voltage_mV;
+  cmock_call_instance->IgnoreArg_voltage_mV = 0;
+}
+
+void SOC_GetFromVoltage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, float cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOC_GetFromVoltage_CALL_INSTANCE));
+  CMOCK_SOC_GetFromVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_GetFromVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOC_GetFromVoltage_CallInstance = CMock_Guts_MemChain(Mock.SOC_GetFromVoltage_CallInstance, cmock_guts_index);
+  Mock.SOC_GetFromVoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.SOC_GetFromVoltage_IgnoreBool = (char)1;
+}
+
+void SOC_GetFromVoltage_CMockStopIgnore(void)
+{
+  if(Mock.SOC_GetFromVoltage_IgnoreBool)
+    Mock.SOC_GetFromVoltage_CallInstance = CMock_Guts_MemNext(Mock.SOC_GetFromVoltage_CallInstance);
+  Mock.SOC_GetFromVoltage_IgnoreBool = (char)0;
+}
+
+void SOC_GetFromVoltage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t voltage_mV, float cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOC_GetFromVoltage_CALL_INSTANCE));
+  CMOCK_SOC_GetFromVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_GetFromVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOC_GetFromVoltage_CallInstance = CMock_Guts_MemChain(Mock.SOC_GetFromVoltage_CallInstance, cmock_guts_index);
+  Mock.SOC_GetFromVoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SOC_GetFromVoltage(cmock_call_instance, voltage_mV);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void SOC_GetFromVoltage_AddCallback(CMOCK_SOC_GetFromVoltage_CALLBACK Callback)
+{
+  Mock.SOC_GetFromVoltage_IgnoreBool = (char)0;
+  Mock.SOC_GetFromVoltage_CallbackBool = (char)1;
+  Mock.SOC_GetFromVoltage_CallbackFunctionPointer = Callback;
+}
+
+void SOC_GetFromVoltage_Stub(CMOCK_SOC_GetFromVoltage_CALLBACK Callback)
+{
+  Mock.SOC_GetFromVoltage_IgnoreBool = (char)0;
+  Mock.SOC_GetFromVoltage_CallbackBool = (char)0;
+  Mock.SOC_GetFromVoltage_CallbackFunctionPointer = Callback;
+}
+
+void SOC_GetFromVoltage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t voltage_mV, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOC_GetFromVoltage_CALL_INSTANCE));
+  CMOCK_SOC_GetFromVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_GetFromVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOC_GetFromVoltage_CallInstance = CMock_Guts_MemChain(Mock.SOC_GetFromVoltage_CallInstance, cmock_guts_index);
+  Mock.SOC_GetFromVoltage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SOC_GetFromVoltage(cmock_call_instance, voltage_mV);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SOC_GetFromVoltage_CMockIgnoreArg_voltage_mV(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SOC_GetFromVoltage_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOC_GetFromVoltage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SOC_GetFromVoltage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_voltage_mV = 1;
+}
+
+void SOE_Init(_Bool ec_present, uint8_t stringNumber)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SOE_Init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SOE_Init);
+  cmock_call_instance = (CMOCK_SOE_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SOE_Init_CallInstance);
+  Mock.SOE_Init_CallInstance = CMock_Guts_MemNext(Mock.SOE_Init_CallInstance);
+  if (Mock.SOE_Init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SOE_Init_CallbackBool &&
+      Mock.SOE_Init_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOE_Init_CallbackFunctionPointer(ec_present, stringNumber, Mock.SOE_Init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_ec_present)
+  {
+    UNITY_SET_DETAILS(CMockString_SOE_Init,CMockString_ec_present);
+    UNITY_TEST_ASSERT_EQUAL_MEMORY((void*)(&cmock_call_instance->Expected_ec_present), (void*)(&ec_present), sizeof(_Bool), cmock_line, CMockStringMismatch);
+  }
+  if (!cmock_call_instance->IgnoreArg_stringNumber)
+  {
+    UNITY_SET_DETAILS(CMockString_SOE_Init,CMockString_stringNumber);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_stringNumber, stringNumber, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SOE_Init_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOE_Init_CallbackFunctionPointer(ec_present, stringNumber, Mock.SOE_Init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_SOE_Init(CMOCK_SOE_Init_CALL_INSTANCE* cmock_call_instance, _Bool ec_present, uint8_t stringNumber);
+void CMockExpectParameters_SOE_Init(CMOCK_SOE_Init_CALL_INSTANCE* cmock_call_instance, _Bool ec_present, uint8_t stringNumber)
+{
+  memcpy((void*)(&cmock_call_instance->Expected_ec_present), (void*)(&ec_present),
+         sizeof(_Bool[sizeof(ec_present) == sizeof(_Bool) ? 1 : -1])); /* add _Bool to :treat_as_array if this causes an error */
+  cmock_call_instance->IgnoreArg_ec_present = 0;
+  cmock_call_instance->Expected_stringNumber = stringNumber;
+  cmock_call_instance->IgnoreArg_stringNumber = 0;
+}
+
+void SOE_Init_CMockIgnore(void)
+{
+  Mock.SOE_Init_IgnoreBool = (char)1;
+}
+
+void SOE_Init_CMockStopIgnore(void)
+{
+  Mock.SOE_Init_IgnoreBool = (char)0;
+}
+
+void SOE_Init_CMockExpect(UNITY_LINE_TYPE cmock_line, _Bool ec_present, uint8_t stringNumber)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOE_Init_CALL_INSTANCE));
+  CMOCK_SOE_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOE_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOE_Init_CallInstance = CMock_Guts_MemChain(Mock.SOE_Init_CallInstance, cmock_guts_index);
+  Mock.SOE_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SOE_Init(cmock_call_instance, ec_present, stringNumber);
+}
+
+void SOE_Init_AddCallback(CMOCK_SOE_Init_CALLBACK Callback)
+{
+  Mock.SOE_Init_IgnoreBool = (char)0;
+  Mock.SOE_Init_CallbackBool = (char)1;
+  Mock.SOE_Init_CallbackFunctionPointer = Callback;
+}
+
+void SOE_Init_Stub(CMOCK_SOE_Init_CALLBACK Callback)
+{
+  Mock.SOE_Init_IgnoreBool = (char)0;
+  Mock.SOE_Init_CallbackBool = (char)0;
+  Mock.SOE_Init_CallbackFunctionPointer = Callback;
+}
+
+void SOE_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, _Bool ec_present, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOE_Init_CALL_INSTANCE));
+  CMOCK_SOE_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOE_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOE_Init_CallInstance = CMock_Guts_MemChain(Mock.SOE_Init_CallInstance, cmock_guts_index);
+  Mock.SOE_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SOE_Init(cmock_call_instance, ec_present, stringNumber);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SOE_Init_CMockIgnoreArg_ec_present(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SOE_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOE_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SOE_Init_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_ec_present = 1;
+}
+
+void SOE_Init_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SOE_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOE_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SOE_Init_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_stringNumber = 1;
+}
+
+void SOE_Calculation(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SOE_Calculation_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SOE_Calculation);
+  cmock_call_instance = (CMOCK_SOE_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SOE_Calculation_CallInstance);
+  Mock.SOE_Calculation_CallInstance = CMock_Guts_MemNext(Mock.SOE_Calculation_CallInstance);
+  if (Mock.SOE_Calculation_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SOE_Calculation_CallbackBool &&
+      Mock.SOE_Calculation_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOE_Calculation_CallbackFunctionPointer(Mock.SOE_Calculation_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.SOE_Calculation_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOE_Calculation_CallbackFunctionPointer(Mock.SOE_Calculation_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void SOE_Calculation_CMockIgnore(void)
+{
+  Mock.SOE_Calculation_IgnoreBool = (char)1;
+}
+
+void SOE_Calculation_CMockStopIgnore(void)
+{
+  Mock.SOE_Calculation_IgnoreBool = (char)0;
+}
+
+void SOE_Calculation_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOE_Calculation_CALL_INSTANCE));
+  CMOCK_SOE_Calculation_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOE_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOE_Calculation_CallInstance = CMock_Guts_MemChain(Mock.SOE_Calculation_CallInstance, cmock_guts_index);
+  Mock.SOE_Calculation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void SOE_Calculation_AddCallback(CMOCK_SOE_Calculation_CALLBACK Callback)
+{
+  Mock.SOE_Calculation_IgnoreBool = (char)0;
+  Mock.SOE_Calculation_CallbackBool = (char)1;
+  Mock.SOE_Calculation_CallbackFunctionPointer = Callback;
+}
+
+void SOE_Calculation_Stub(CMOCK_SOE_Calculation_CALLBACK Callback)
+{
+  Mock.SOE_Calculation_IgnoreBool = (char)0;
+  Mock.SOE_Calculation_CallbackBool = (char)0;
+  Mock.SOE_Calculation_CallbackFunctionPointer = Callback;
+}
+
+void SOE_Calculation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOE_Calculation_CALL_INSTANCE));
+  CMOCK_SOE_Calculation_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOE_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOE_Calculation_CallInstance = CMock_Guts_MemChain(Mock.SOE_Calculation_CallInstance, cmock_guts_index);
+  Mock.SOE_Calculation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SOH_Init(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SOH_Init_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SOH_Init);
+  cmock_call_instance = (CMOCK_SOH_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SOH_Init_CallInstance);
+  Mock.SOH_Init_CallInstance = CMock_Guts_MemNext(Mock.SOH_Init_CallInstance);
+  if (Mock.SOH_Init_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SOH_Init_CallbackBool &&
+      Mock.SOH_Init_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOH_Init_CallbackFunctionPointer(Mock.SOH_Init_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.SOH_Init_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOH_Init_CallbackFunctionPointer(Mock.SOH_Init_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void SOH_Init_CMockIgnore(void)
+{
+  Mock.SOH_Init_IgnoreBool = (char)1;
+}
+
+void SOH_Init_CMockStopIgnore(void)
+{
+  Mock.SOH_Init_IgnoreBool = (char)0;
+}
+
+void SOH_Init_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOH_Init_CALL_INSTANCE));
+  CMOCK_SOH_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOH_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOH_Init_CallInstance = CMock_Guts_MemChain(Mock.SOH_Init_CallInstance, cmock_guts_index);
+  Mock.SOH_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void SOH_Init_AddCallback(CMOCK_SOH_Init_CALLBACK Callback)
+{
+  Mock.SOH_Init_IgnoreBool = (char)0;
+  Mock.SOH_Init_CallbackBool = (char)1;
+  Mock.SOH_Init_CallbackFunctionPointer = Callback;
+}
+
+void SOH_Init_Stub(CMOCK_SOH_Init_CALLBACK Callback)
+{
+  Mock.SOH_Init_IgnoreBool = (char)0;
+  Mock.SOH_Init_CallbackBool = (char)0;
+  Mock.SOH_Init_CallbackFunctionPointer = Callback;
+}
+
+void SOH_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOH_Init_CALL_INSTANCE));
+  CMOCK_SOH_Init_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOH_Init_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOH_Init_CallInstance = CMock_Guts_MemChain(Mock.SOH_Init_CallInstance, cmock_guts_index);
+  Mock.SOH_Init_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SOH_Calculation(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SOH_Calculation_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SOH_Calculation);
+  cmock_call_instance = (CMOCK_SOH_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SOH_Calculation_CallInstance);
+  Mock.SOH_Calculation_CallInstance = CMock_Guts_MemNext(Mock.SOH_Calculation_CallInstance);
+  if (Mock.SOH_Calculation_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SOH_Calculation_CallbackBool &&
+      Mock.SOH_Calculation_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOH_Calculation_CallbackFunctionPointer(Mock.SOH_Calculation_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.SOH_Calculation_CallbackFunctionPointer != NULL)
+  {
+    Mock.SOH_Calculation_CallbackFunctionPointer(Mock.SOH_Calculation_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void SOH_Calculation_CMockIgnore(void)
+{
+  Mock.SOH_Calculation_IgnoreBool = (char)1;
+}
+
+void SOH_Calculation_CMockStopIgnore(void)
+{
+  Mock.SOH_Calculation_IgnoreBool = (char)0;
+}
+
+void SOH_Calculation_CMockExpect(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOH_Calculation_CALL_INSTANCE));
+  CMOCK_SOH_Calculation_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOH_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOH_Calculation_CallInstance = CMock_Guts_MemChain(Mock.SOH_Calculation_CallInstance, cmock_guts_index);
+  Mock.SOH_Calculation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+}
+
+void SOH_Calculation_AddCallback(CMOCK_SOH_Calculation_CALLBACK Callback)
+{
+  Mock.SOH_Calculation_IgnoreBool = (char)0;
+  Mock.SOH_Calculation_CallbackBool = (char)1;
+  Mock.SOH_Calculation_CallbackFunctionPointer = Callback;
+}
+
+void SOH_Calculation_Stub(CMOCK_SOH_Calculation_CALLBACK Callback)
+{
+  Mock.SOH_Calculation_IgnoreBool = (char)0;
+  Mock.SOH_Calculation_CallbackBool = (char)0;
+  Mock.SOH_Calculation_CallbackFunctionPointer = Callback;
+}
+
+void SOH_Calculation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SOH_Calculation_CALL_INSTANCE));
+  CMOCK_SOH_Calculation_CALL_INSTANCE* cmock_call_instance = (CMOCK_SOH_Calculation_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SOH_Calculation_CallInstance = CMock_Guts_MemChain(Mock.SOH_Calculation_CallInstance, cmock_guts_index);
+  Mock.SOH_Calculation_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
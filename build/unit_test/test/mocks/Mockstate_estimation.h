@@ -0,0 +1,140 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKSTATE_ESTIMATION_H
+#define _MOCKSTATE_ESTIMATION_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "state_estimation.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mockstate_estimation_Init(void);
+void Mockstate_estimation_Destroy(void);
+void Mockstate_estimation_Verify(void);
+
+
+
+
+#define SOC_Init_Ignore() SOC_Init_CMockIgnore()
+void SOC_Init_CMockIgnore(void);
+#define SOC_Init_StopIgnore() SOC_Init_CMockStopIgnore()
+void SOC_Init_CMockStopIgnore(void);
+#define SOC_Init_Expect(cc_present, stringNumber) SOC_Init_CMockExpect(__LINE__, cc_present, stringNumber)
+void SOC_Init_CMockExpect(UNITY_LINE_TYPE cmock_line, _Bool cc_present, uint8_t stringNumber);
+typedef void (* CMOCK_SOC_Init_CALLBACK)(_Bool cc_present, uint8_t stringNumber, int cmock_num_calls);
+void SOC_Init_AddCallback(CMOCK_SOC_Init_CALLBACK Callback);
+void SOC_Init_Stub(CMOCK_SOC_Init_CALLBACK Callback);
+#define SOC_Init_StubWithCallback SOC_Init_Stub
+#define SOC_Init_ExpectAndThrow(cc_present, stringNumber, cmock_to_throw) SOC_Init_CMockExpectAndThrow(__LINE__, cc_present, stringNumber, cmock_to_throw)
+void SOC_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, _Bool cc_present, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define SOC_Init_IgnoreArg_cc_present() SOC_Init_CMockIgnoreArg_cc_present(__LINE__)
+void SOC_Init_CMockIgnoreArg_cc_present(UNITY_LINE_TYPE cmock_line);
+#define SOC_Init_IgnoreArg_stringNumber() SOC_Init_CMockIgnoreArg_stringNumber(__LINE__)
+void SOC_Init_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define SOC_Calculation_Ignore() SOC_Calculation_CMockIgnore()
+void SOC_Calculation_CMockIgnore(void);
+#define SOC_Calculation_StopIgnore() SOC_Calculation_CMockStopIgnore()
+void SOC_Calculation_CMockStopIgnore(void);
+#define SOC_Calculation_Expect() SOC_Calculation_CMockExpect(__LINE__)
+void SOC_Calculation_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_SOC_Calculation_CALLBACK)(int cmock_num_calls);
+void SOC_Calculation_AddCallback(CMOCK_SOC_Calculation_CALLBACK Callback);
+void SOC_Calculation_Stub(CMOCK_SOC_Calculation_CALLBACK Callback);
+#define SOC_Calculation_StubWithCallback SOC_Calculation_Stub
+#define SOC_Calculation_ExpectAndThrow(cmock_to_throw) SOC_Calculation_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void SOC_Calculation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define SOC_GetFromVoltage_IgnoreAndReturn(cmock_retval) SOC_GetFromVoltage_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void SOC_GetFromVoltage_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, float cmock_to_return);
+#define SOC_GetFromVoltage_StopIgnore() SOC_GetFromVoltage_CMockStopIgnore()
+void SOC_GetFromVoltage_CMockStopIgnore(void);
+#define SOC_GetFromVoltage_ExpectAndReturn(voltage_mV, cmock_retval) SOC_GetFromVoltage_CMockExpectAndReturn(__LINE__, voltage_mV, cmock_retval)
+void SOC_GetFromVoltage_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t voltage_mV, float cmock_to_return);
+typedef float (* CMOCK_SOC_GetFromVoltage_CALLBACK)(int16_t voltage_mV, int cmock_num_calls);
+void SOC_GetFromVoltage_AddCallback(CMOCK_SOC_GetFromVoltage_CALLBACK Callback);
+void SOC_GetFromVoltage_Stub(CMOCK_SOC_GetFromVoltage_CALLBACK Callback);
+#define SOC_GetFromVoltage_StubWithCallback SOC_GetFromVoltage_Stub
+#define SOC_GetFromVoltage_ExpectAndThrow(voltage_mV, cmock_to_throw) SOC_GetFromVoltage_CMockExpectAndThrow(__LINE__, voltage_mV, cmock_to_throw)
+void SOC_GetFromVoltage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, int16_t voltage_mV, CEXCEPTION_T cmock_to_throw);
+#define SOC_GetFromVoltage_IgnoreArg_voltage_mV() SOC_GetFromVoltage_CMockIgnoreArg_voltage_mV(__LINE__)
+void SOC_GetFromVoltage_CMockIgnoreArg_voltage_mV(UNITY_LINE_TYPE cmock_line);
+#define SOE_Init_Ignore() SOE_Init_CMockIgnore()
+void SOE_Init_CMockIgnore(void);
+#define SOE_Init_StopIgnore() SOE_Init_CMockStopIgnore()
+void SOE_Init_CMockStopIgnore(void);
+#define SOE_Init_Expect(ec_present, stringNumber) SOE_Init_CMockExpect(__LINE__, ec_present, stringNumber)
+void SOE_Init_CMockExpect(UNITY_LINE_TYPE cmock_line, _Bool ec_present, uint8_t stringNumber);
+typedef void (* CMOCK_SOE_Init_CALLBACK)(_Bool ec_present, uint8_t stringNumber, int cmock_num_calls);
+void SOE_Init_AddCallback(CMOCK_SOE_Init_CALLBACK Callback);
+void SOE_Init_Stub(CMOCK_SOE_Init_CALLBACK Callback);
+#define SOE_Init_StubWithCallback SOE_Init_Stub
+#define SOE_Init_ExpectAndThrow(ec_present, stringNumber, cmock_to_throw) SOE_Init_CMockExpectAndThrow(__LINE__, ec_present, stringNumber, cmock_to_throw)
+void SOE_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, _Bool ec_present, uint8_t stringNumber, CEXCEPTION_T cmock_to_throw);
+#define SOE_Init_IgnoreArg_ec_present() SOE_Init_CMockIgnoreArg_ec_present(__LINE__)
+void SOE_Init_CMockIgnoreArg_ec_present(UNITY_LINE_TYPE cmock_line);
+#define SOE_Init_IgnoreArg_stringNumber() SOE_Init_CMockIgnoreArg_stringNumber(__LINE__)
+void SOE_Init_CMockIgnoreArg_stringNumber(UNITY_LINE_TYPE cmock_line);
+#define SOE_Calculation_Ignore() SOE_Calculation_CMockIgnore()
+void SOE_Calculation_CMockIgnore(void);
+#define SOE_Calculation_StopIgnore() SOE_Calculation_CMockStopIgnore()
+void SOE_Calculation_CMockStopIgnore(void);
+#define SOE_Calculation_Expect() SOE_Calculation_CMockExpect(__LINE__)
+void SOE_Calculation_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_SOE_Calculation_CALLBACK)(int cmock_num_calls);
+void SOE_Calculation_AddCallback(CMOCK_SOE_Calculation_CALLBACK Callback);
+void SOE_Calculation_Stub(CMOCK_SOE_Calculation_CALLBACK Callback);
+#define SOE_Calculation_StubWithCallback SOE_Calculation_Stub
+#define SOE_Calculation_ExpectAndThrow(cmock_to_throw) SOE_Calculation_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void SOE_Calculation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define SOH_Init_Ignore() SOH_Init_CMockIgnore()
+void SOH_Init_CMockIgnore(void);
+#define SOH_Init_StopIgnore() SOH_Init_CMockStopIgnore()
+void SOH_Init_CMockStopIgnore(void);
+#define SOH_Init_Expect() SOH_Init_CMockExpect(__LINE__)
+void SOH_Init_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_SOH_Init_CALLBACK)(int cmock_num_calls);
+void SOH_Init_AddCallback(CMOCK_SOH_Init_CALLBACK Callback);
+void SOH_Init_Stub(CMOCK_SOH_Init_CALLBACK Callback);
+#define SOH_Init_StubWithCallback SOH_Init_Stub
+#define SOH_Init_ExpectAndThrow(cmock_to_throw) SOH_Init_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void SOH_Init_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define SOH_Calculation_Ignore() SOH_Calculation_CMockIgnore()
+void SOH_Calculation_CMockIgnore(void);
+#define SOH_Calculation_StopIgnore() SOH_Calculation_CMockStopIgnore()
+void SOH_Calculation_CMockStopIgnore(void);
+#define SOH_Calculation_Expect() SOH_Calculation_CMockExpect(__LINE__)
+void SOH_Calculation_CMockExpect(UNITY_LINE_TYPE cmock_line);
+typedef void (* CMOCK_SOH_Calculation_CALLBACK)(int cmock_num_calls);
+void SOH_Calculation_AddCallback(CMOCK_SOH_Calculation_CALLBACK Callback);
+void SOH_Calculation_Stub(CMOCK_SOH_Calculation_CALLBACK Callback);
+#define SOH_Calculation_StubWithCallback SOH_Calculation_Stub
+#define SOH_Calculation_ExpectAndThrow(cmock_to_throw) SOH_Calculation_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void SOH_Calculation_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
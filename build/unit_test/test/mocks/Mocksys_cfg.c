@@ -0,0 +1,174 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mocksys_cfg.h"
+
+static const char* CMockString_SYS_SendBootMessage = "SYS_SendBootMessage";
+static const char* CMockString_directTransmission = "directTransmission";
+
+typedef struct _CMOCK_SYS_SendBootMessage_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int CallOrder;
+  uint8_t Expected_directTransmission;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_directTransmission;
+
+} CMOCK_SYS_SendBootMessage_CALL_INSTANCE;
+
+static struct Mocksys_cfgInstance
+{
+  char SYS_SendBootMessage_IgnoreBool;
+  char SYS_SendBootMessage_CallbackBool;
+  CMOCK_SYS_SendBootMessage_CALLBACK SYS_SendBootMessage_CallbackFunctionPointer;
+  int SYS_SendBootMessage_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE SYS_SendBootMessage_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mocksys_cfg_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.SYS_SendBootMessage_CallInstance;
+  if (Mock.SYS_SendBootMessage_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_SYS_SendBootMessage);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.SYS_SendBootMessage_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mocksys_cfg_Init(void)
+{
+  Mocksys_cfg_Destroy();
+}
+
+void Mocksys_cfg_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+void SYS_SendBootMessage(uint8_t directTransmission)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_SYS_SendBootMessage_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_SYS_SendBootMessage);
+  cmock_call_instance = (CMOCK_SYS_SendBootMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.SYS_SendBootMessage_CallInstance);
+  Mock.SYS_SendBootMessage_CallInstance = CMock_Guts_MemNext(Mock.SYS_SendBootMessage_CallInstance);
+  if (Mock.SYS_SendBootMessage_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  if (!Mock.SYS_SendBootMessage_CallbackBool &&
+      Mock.SYS_SendBootMessage_CallbackFunctionPointer != NULL)
+  {
+    Mock.SYS_SendBootMessage_CallbackFunctionPointer(directTransmission, Mock.SYS_SendBootMessage_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_directTransmission)
+  {
+    UNITY_SET_DETAILS(CMockString_SYS_SendBootMessage,CMockString_directTransmission);
+    UNITY_TEST_ASSERT_EQUAL_HEX8(cmock_call_instance->Expected_directTransmission, directTransmission, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.SYS_SendBootMessage_CallbackFunctionPointer != NULL)
+  {
+    Mock.SYS_SendBootMessage_CallbackFunctionPointer(directTransmission, Mock.SYS_SendBootMessage_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+}
+
+void CMockExpectParameters_SYS_SendBootMessage(CMOCK_SYS_SendBootMessage_CALL_INSTANCE* cmock_call_instance, uint8_t directTransmission);
+void CMockExpectParameters_SYS_SendBootMessage(CMOCK_SYS_SendBootMessage_CALL_INSTANCE* cmock_call_instance, uint8_t directTransmission)
+{
+  cmock_call_instance->Expected_directTransmission = directTransmission;
+  cmock_call_instance->IgnoreArg_directTransmission = 0;
+}
+
+void SYS_SendBootMessage_CMockIgnore(void)
+{
+  Mock.SYS_SendBootMessage_IgnoreBool = (char)1;
+}
+
+void SYS_SendBootMessage_CMockStopIgnore(void)
+{
+  Mock.SYS_SendBootMessage_IgnoreBool = (char)0;
+}
+
+void SYS_SendBootMessage_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t directTransmission)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SYS_SendBootMessage_CALL_INSTANCE));
+  CMOCK_SYS_SendBootMessage_CALL_INSTANCE* cmock_call_instance = (CMOCK_SYS_SendBootMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SYS_SendBootMessage_CallInstance = CMock_Guts_MemChain(Mock.SYS_SendBootMessage_CallInstance, cmock_guts_index);
+  Mock.SYS_SendBootMessage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SYS_SendBootMessage(cmock_call_instance, directTransmission);
+}
+
+void SYS_SendBootMessage_AddCallback(CMOCK_SYS_SendBootMessage_CALLBACK Callback)
+{
+  Mock.SYS_SendBootMessage_IgnoreBool = (char)0;
+  Mock.SYS_SendBootMessage_CallbackBool = (char)1;
+  Mock.SYS_SendBootMessage_CallbackFunctionPointer = Callback;
+}
+
+void SYS_SendBootMessage_Stub(CMOCK_SYS_SendBootMessage_CALLBACK Callback)
+{
+  Mock.SYS_SendBootMessage_IgnoreBool = (char)0;
+  Mock.SYS_SendBootMessage_CallbackBool = (char)0;
+  Mock.SYS_SendBootMessage_CallbackFunctionPointer = Callback;
+}
+
+void SYS_SendBootMessage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t directTransmission, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_SYS_SendBootMessage_CALL_INSTANCE));
+  CMOCK_SYS_SendBootMessage_CALL_INSTANCE* cmock_call_instance = (CMOCK_SYS_SendBootMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.SYS_SendBootMessage_CallInstance = CMock_Guts_MemChain(Mock.SYS_SendBootMessage_CallInstance, cmock_guts_index);
+  Mock.SYS_SendBootMessage_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_SYS_SendBootMessage(cmock_call_instance, directTransmission);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void SYS_SendBootMessage_CMockIgnoreArg_directTransmission(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_SYS_SendBootMessage_CALL_INSTANCE* cmock_call_instance = (CMOCK_SYS_SendBootMessage_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.SYS_SendBootMessage_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_directTransmission = 1;
+}
+
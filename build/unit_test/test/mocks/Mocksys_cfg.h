@@ -0,0 +1,60 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKSYS_CFG_H
+#define _MOCKSYS_CFG_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "sys_cfg.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mocksys_cfg_Init(void);
+void Mocksys_cfg_Destroy(void);
+void Mocksys_cfg_Verify(void);
+
+
+
+
+#define SYS_SendBootMessage_Ignore() SYS_SendBootMessage_CMockIgnore()
+void SYS_SendBootMessage_CMockIgnore(void);
+#define SYS_SendBootMessage_StopIgnore() SYS_SendBootMessage_CMockStopIgnore()
+void SYS_SendBootMessage_CMockStopIgnore(void);
+#define SYS_SendBootMessage_Expect(directTransmission) SYS_SendBootMessage_CMockExpect(__LINE__, directTransmission)
+void SYS_SendBootMessage_CMockExpect(UNITY_LINE_TYPE cmock_line, uint8_t directTransmission);
+typedef void (* CMOCK_SYS_SendBootMessage_CALLBACK)(uint8_t directTransmission, int cmock_num_calls);
+void SYS_SendBootMessage_AddCallback(CMOCK_SYS_SendBootMessage_CALLBACK Callback);
+void SYS_SendBootMessage_Stub(CMOCK_SYS_SendBootMessage_CALLBACK Callback);
+#define SYS_SendBootMessage_StubWithCallback SYS_SendBootMessage_Stub
+#define SYS_SendBootMessage_ExpectAndThrow(directTransmission, cmock_to_throw) SYS_SendBootMessage_CMockExpectAndThrow(__LINE__, directTransmission, cmock_to_throw)
+void SYS_SendBootMessage_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint8_t directTransmission, CEXCEPTION_T cmock_to_throw);
+#define SYS_SendBootMessage_IgnoreArg_directTransmission() SYS_SendBootMessage_CMockIgnoreArg_directTransmission(__LINE__)
+void SYS_SendBootMessage_CMockIgnoreArg_directTransmission(UNITY_LINE_TYPE cmock_line);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
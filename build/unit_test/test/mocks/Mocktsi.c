@@ -0,0 +1,458 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#include <string.h>
+#include <stdlib.h>
+#include <setjmp.h>
+#include "cmock.h"
+#include "Mocktsi.h"
+
+static const char* CMockString_TSI_GetMaximumPlausibleTemperature = "TSI_GetMaximumPlausibleTemperature";
+static const char* CMockString_TSI_GetMinimumPlausibleTemperature = "TSI_GetMinimumPlausibleTemperature";
+static const char* CMockString_TSI_GetTemperature = "TSI_GetTemperature";
+static const char* CMockString_adcVoltage_mV = "adcVoltage_mV";
+
+typedef struct _CMOCK_TSI_GetTemperature_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int16_t ReturnVal;
+  int CallOrder;
+  uint16_t Expected_adcVoltage_mV;
+  CEXCEPTION_T ExceptionToThrow;
+  char IgnoreArg_adcVoltage_mV;
+
+} CMOCK_TSI_GetTemperature_CALL_INSTANCE;
+
+typedef struct _CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int16_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE;
+
+typedef struct _CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE
+{
+  UNITY_LINE_TYPE LineNumber;
+  int16_t ReturnVal;
+  int CallOrder;
+  CEXCEPTION_T ExceptionToThrow;
+
+} CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE;
+
+static struct MocktsiInstance
+{
+  char TSI_GetTemperature_IgnoreBool;
+  int16_t TSI_GetTemperature_FinalReturn;
+  char TSI_GetTemperature_CallbackBool;
+  CMOCK_TSI_GetTemperature_CALLBACK TSI_GetTemperature_CallbackFunctionPointer;
+  int TSI_GetTemperature_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TSI_GetTemperature_CallInstance;
+  char TSI_GetMaximumPlausibleTemperature_IgnoreBool;
+  int16_t TSI_GetMaximumPlausibleTemperature_FinalReturn;
+  char TSI_GetMaximumPlausibleTemperature_CallbackBool;
+  CMOCK_TSI_GetMaximumPlausibleTemperature_CALLBACK TSI_GetMaximumPlausibleTemperature_CallbackFunctionPointer;
+  int TSI_GetMaximumPlausibleTemperature_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TSI_GetMaximumPlausibleTemperature_CallInstance;
+  char TSI_GetMinimumPlausibleTemperature_IgnoreBool;
+  int16_t TSI_GetMinimumPlausibleTemperature_FinalReturn;
+  char TSI_GetMinimumPlausibleTemperature_CallbackBool;
+  CMOCK_TSI_GetMinimumPlausibleTemperature_CALLBACK TSI_GetMinimumPlausibleTemperature_CallbackFunctionPointer;
+  int TSI_GetMinimumPlausibleTemperature_CallbackCalls;
+  CMOCK_MEM_INDEX_TYPE TSI_GetMinimumPlausibleTemperature_CallInstance;
+} Mock;
+
+extern jmp_buf AbortFrame;
+extern int GlobalExpectCount;
+extern int GlobalVerifyOrder;
+
+void Mocktsi_Verify(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_MEM_INDEX_TYPE call_instance;
+  call_instance = Mock.TSI_GetTemperature_CallInstance;
+  if (Mock.TSI_GetTemperature_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TSI_GetTemperature);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TSI_GetTemperature_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TSI_GetMaximumPlausibleTemperature_CallInstance;
+  if (Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TSI_GetMaximumPlausibleTemperature);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TSI_GetMaximumPlausibleTemperature_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+  call_instance = Mock.TSI_GetMinimumPlausibleTemperature_CallInstance;
+  if (Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool)
+    call_instance = CMOCK_GUTS_NONE;
+  if (CMOCK_GUTS_NONE != call_instance)
+  {
+    UNITY_SET_DETAIL(CMockString_TSI_GetMinimumPlausibleTemperature);
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLess);
+  }
+  if (Mock.TSI_GetMinimumPlausibleTemperature_CallbackFunctionPointer != NULL)
+  {
+    call_instance = CMOCK_GUTS_NONE;
+    (void)call_instance;
+  }
+}
+
+void Mocktsi_Init(void)
+{
+  Mocktsi_Destroy();
+}
+
+void Mocktsi_Destroy(void)
+{
+  CMock_Guts_MemFreeAll();
+  memset(&Mock, 0, sizeof(Mock));
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+}
+
+int16_t TSI_GetTemperature(uint16_t adcVoltage_mV)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TSI_GetTemperature_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TSI_GetTemperature);
+  cmock_call_instance = (CMOCK_TSI_GetTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TSI_GetTemperature_CallInstance);
+  Mock.TSI_GetTemperature_CallInstance = CMock_Guts_MemNext(Mock.TSI_GetTemperature_CallInstance);
+  if (Mock.TSI_GetTemperature_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TSI_GetTemperature_FinalReturn;
+    Mock.TSI_GetTemperature_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TSI_GetTemperature_CallbackBool &&
+      Mock.TSI_GetTemperature_CallbackFunctionPointer != NULL)
+  {
+    int16_t cmock_cb_ret = Mock.TSI_GetTemperature_CallbackFunctionPointer(adcVoltage_mV, Mock.TSI_GetTemperature_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (!cmock_call_instance->IgnoreArg_adcVoltage_mV)
+  {
+    UNITY_SET_DETAILS(CMockString_TSI_GetTemperature,CMockString_adcVoltage_mV);
+    UNITY_TEST_ASSERT_EQUAL_HEX16(cmock_call_instance->Expected_adcVoltage_mV, adcVoltage_mV, cmock_line, CMockStringMismatch);
+  }
+  if (Mock.TSI_GetTemperature_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TSI_GetTemperature_CallbackFunctionPointer(adcVoltage_mV, Mock.TSI_GetTemperature_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void CMockExpectParameters_TSI_GetTemperature(CMOCK_TSI_GetTemperature_CALL_INSTANCE* cmock_call_instance, uint16_t adcVoltage_mV);
+void CMockExpectParameters_TSI_GetTemperature(CMOCK_TSI_GetTemperature_CALL_INSTANCE* cmock_call_instance, uint16_t adcVoltage_mV)
+{
+  cmock_call_instance->Expected_adcVoltage_mV = adcVoltage_mV;
+  cmock_call_instance->IgnoreArg_adcVoltage_mV = 0;
+}
+
+void TSI_GetTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TSI_GetTemperature_CALL_INSTANCE));
+  CMOCK_TSI_GetTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TSI_GetTemperature_CallInstance = CMock_Guts_MemChain(Mock.TSI_GetTemperature_CallInstance, cmock_guts_index);
+  Mock.TSI_GetTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TSI_GetTemperature_IgnoreBool = (char)1;
+}
+
+void TSI_GetTemperature_CMockStopIgnore(void)
+{
+  if(Mock.TSI_GetTemperature_IgnoreBool)
+    Mock.TSI_GetTemperature_CallInstance = CMock_Guts_MemNext(Mock.TSI_GetTemperature_CallInstance);
+  Mock.TSI_GetTemperature_IgnoreBool = (char)0;
+}
+
+void TSI_GetTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t adcVoltage_mV, int16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TSI_GetTemperature_CALL_INSTANCE));
+  CMOCK_TSI_GetTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TSI_GetTemperature_CallInstance = CMock_Guts_MemChain(Mock.TSI_GetTemperature_CallInstance, cmock_guts_index);
+  Mock.TSI_GetTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TSI_GetTemperature(cmock_call_instance, adcVoltage_mV);
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TSI_GetTemperature_AddCallback(CMOCK_TSI_GetTemperature_CALLBACK Callback)
+{
+  Mock.TSI_GetTemperature_IgnoreBool = (char)0;
+  Mock.TSI_GetTemperature_CallbackBool = (char)1;
+  Mock.TSI_GetTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TSI_GetTemperature_Stub(CMOCK_TSI_GetTemperature_CALLBACK Callback)
+{
+  Mock.TSI_GetTemperature_IgnoreBool = (char)0;
+  Mock.TSI_GetTemperature_CallbackBool = (char)0;
+  Mock.TSI_GetTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TSI_GetTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t adcVoltage_mV, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TSI_GetTemperature_CALL_INSTANCE));
+  CMOCK_TSI_GetTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TSI_GetTemperature_CallInstance = CMock_Guts_MemChain(Mock.TSI_GetTemperature_CallInstance, cmock_guts_index);
+  Mock.TSI_GetTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  CMockExpectParameters_TSI_GetTemperature(cmock_call_instance, adcVoltage_mV);
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+void TSI_GetTemperature_CMockIgnoreArg_adcVoltage_mV(UNITY_LINE_TYPE cmock_line)
+{
+  CMOCK_TSI_GetTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(CMock_Guts_MemEndOfChain(Mock.TSI_GetTemperature_CallInstance));
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringIgnPreExp);
+  cmock_call_instance->IgnoreArg_adcVoltage_mV = 1;
+}
+
+int16_t TSI_GetMaximumPlausibleTemperature(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TSI_GetMaximumPlausibleTemperature);
+  cmock_call_instance = (CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TSI_GetMaximumPlausibleTemperature_CallInstance);
+  Mock.TSI_GetMaximumPlausibleTemperature_CallInstance = CMock_Guts_MemNext(Mock.TSI_GetMaximumPlausibleTemperature_CallInstance);
+  if (Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TSI_GetMaximumPlausibleTemperature_FinalReturn;
+    Mock.TSI_GetMaximumPlausibleTemperature_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TSI_GetMaximumPlausibleTemperature_CallbackBool &&
+      Mock.TSI_GetMaximumPlausibleTemperature_CallbackFunctionPointer != NULL)
+  {
+    int16_t cmock_cb_ret = Mock.TSI_GetMaximumPlausibleTemperature_CallbackFunctionPointer(Mock.TSI_GetMaximumPlausibleTemperature_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TSI_GetMaximumPlausibleTemperature_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TSI_GetMaximumPlausibleTemperature_CallbackFunctionPointer(Mock.TSI_GetMaximumPlausibleTemperature_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TSI_GetMaximumPlausibleTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE));
+  CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TSI_GetMaximumPlausibleTemperature_CallInstance = CMock_Guts_MemChain(Mock.TSI_GetMaximumPlausibleTemperature_CallInstance, cmock_guts_index);
+  Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool = (char)1;
+}
+
+void TSI_GetMaximumPlausibleTemperature_CMockStopIgnore(void)
+{
+  if(Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool)
+    Mock.TSI_GetMaximumPlausibleTemperature_CallInstance = CMock_Guts_MemNext(Mock.TSI_GetMaximumPlausibleTemperature_CallInstance);
+  Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool = (char)0;
+}
+
+void TSI_GetMaximumPlausibleTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE));
+  CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TSI_GetMaximumPlausibleTemperature_CallInstance = CMock_Guts_MemChain(Mock.TSI_GetMaximumPlausibleTemperature_CallInstance, cmock_guts_index);
+  Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TSI_GetMaximumPlausibleTemperature_AddCallback(CMOCK_TSI_GetMaximumPlausibleTemperature_CALLBACK Callback)
+{
+  Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool = (char)0;
+  Mock.TSI_GetMaximumPlausibleTemperature_CallbackBool = (char)1;
+  Mock.TSI_GetMaximumPlausibleTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TSI_GetMaximumPlausibleTemperature_Stub(CMOCK_TSI_GetMaximumPlausibleTemperature_CALLBACK Callback)
+{
+  Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool = (char)0;
+  Mock.TSI_GetMaximumPlausibleTemperature_CallbackBool = (char)0;
+  Mock.TSI_GetMaximumPlausibleTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TSI_GetMaximumPlausibleTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE));
+  CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetMaximumPlausibleTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TSI_GetMaximumPlausibleTemperature_CallInstance = CMock_Guts_MemChain(Mock.TSI_GetMaximumPlausibleTemperature_CallInstance, cmock_guts_index);
+  Mock.TSI_GetMaximumPlausibleTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
+int16_t TSI_GetMinimumPlausibleTemperature(void)
+{
+  UNITY_LINE_TYPE cmock_line = TEST_LINE_NUM;
+  CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE* cmock_call_instance;
+  UNITY_SET_DETAIL(CMockString_TSI_GetMinimumPlausibleTemperature);
+  cmock_call_instance = (CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(Mock.TSI_GetMinimumPlausibleTemperature_CallInstance);
+  Mock.TSI_GetMinimumPlausibleTemperature_CallInstance = CMock_Guts_MemNext(Mock.TSI_GetMinimumPlausibleTemperature_CallInstance);
+  if (Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool)
+  {
+    UNITY_CLR_DETAILS();
+    if (cmock_call_instance == NULL)
+      return Mock.TSI_GetMinimumPlausibleTemperature_FinalReturn;
+    Mock.TSI_GetMinimumPlausibleTemperature_FinalReturn = cmock_call_instance->ReturnVal;
+    return cmock_call_instance->ReturnVal;
+  }
+  if (!Mock.TSI_GetMinimumPlausibleTemperature_CallbackBool &&
+      Mock.TSI_GetMinimumPlausibleTemperature_CallbackFunctionPointer != NULL)
+  {
+    int16_t cmock_cb_ret = Mock.TSI_GetMinimumPlausibleTemperature_CallbackFunctionPointer(Mock.TSI_GetMinimumPlausibleTemperature_CallbackCalls++);
+    UNITY_CLR_DETAILS();
+    return cmock_cb_ret;
+  }
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringCalledMore);
+  cmock_line = cmock_call_instance->LineNumber;
+  if (cmock_call_instance->CallOrder > ++GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledEarly);
+  if (cmock_call_instance->CallOrder < GlobalVerifyOrder)
+    UNITY_TEST_FAIL(cmock_line, CMockStringCalledLate);
+  if (Mock.TSI_GetMinimumPlausibleTemperature_CallbackFunctionPointer != NULL)
+  {
+    cmock_call_instance->ReturnVal = Mock.TSI_GetMinimumPlausibleTemperature_CallbackFunctionPointer(Mock.TSI_GetMinimumPlausibleTemperature_CallbackCalls++);
+  }
+  if (cmock_call_instance->ExceptionToThrow != CEXCEPTION_NONE)
+  {
+    UNITY_CLR_DETAILS();
+    Throw(cmock_call_instance->ExceptionToThrow);
+  }
+  UNITY_CLR_DETAILS();
+  return cmock_call_instance->ReturnVal;
+}
+
+void TSI_GetMinimumPlausibleTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE));
+  CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TSI_GetMinimumPlausibleTemperature_CallInstance = CMock_Guts_MemChain(Mock.TSI_GetMinimumPlausibleTemperature_CallInstance, cmock_guts_index);
+  Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+  Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool = (char)1;
+}
+
+void TSI_GetMinimumPlausibleTemperature_CMockStopIgnore(void)
+{
+  if(Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool)
+    Mock.TSI_GetMinimumPlausibleTemperature_CallInstance = CMock_Guts_MemNext(Mock.TSI_GetMinimumPlausibleTemperature_CallInstance);
+  Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool = (char)0;
+}
+
+void TSI_GetMinimumPlausibleTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE));
+  CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TSI_GetMinimumPlausibleTemperature_CallInstance = CMock_Guts_MemChain(Mock.TSI_GetMinimumPlausibleTemperature_CallInstance, cmock_guts_index);
+  Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ReturnVal = cmock_to_return;
+}
+
+void TSI_GetMinimumPlausibleTemperature_AddCallback(CMOCK_TSI_GetMinimumPlausibleTemperature_CALLBACK Callback)
+{
+  Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool = (char)0;
+  Mock.TSI_GetMinimumPlausibleTemperature_CallbackBool = (char)1;
+  Mock.TSI_GetMinimumPlausibleTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TSI_GetMinimumPlausibleTemperature_Stub(CMOCK_TSI_GetMinimumPlausibleTemperature_CALLBACK Callback)
+{
+  Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool = (char)0;
+  Mock.TSI_GetMinimumPlausibleTemperature_CallbackBool = (char)0;
+  Mock.TSI_GetMinimumPlausibleTemperature_CallbackFunctionPointer = Callback;
+}
+
+void TSI_GetMinimumPlausibleTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw)
+{
+  CMOCK_MEM_INDEX_TYPE cmock_guts_index = CMock_Guts_MemNew(sizeof(CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE));
+  CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE* cmock_call_instance = (CMOCK_TSI_GetMinimumPlausibleTemperature_CALL_INSTANCE*)CMock_Guts_GetAddressFor(cmock_guts_index);
+  UNITY_TEST_ASSERT_NOT_NULL(cmock_call_instance, cmock_line, CMockStringOutOfMemory);
+  memset(cmock_call_instance, 0, sizeof(*cmock_call_instance));
+  Mock.TSI_GetMinimumPlausibleTemperature_CallInstance = CMock_Guts_MemChain(Mock.TSI_GetMinimumPlausibleTemperature_CallInstance, cmock_guts_index);
+  Mock.TSI_GetMinimumPlausibleTemperature_IgnoreBool = (char)0;
+  cmock_call_instance->LineNumber = cmock_line;
+  cmock_call_instance->CallOrder = ++GlobalExpectCount;
+  cmock_call_instance->ExceptionToThrow = CEXCEPTION_NONE;
+  cmock_call_instance->ExceptionToThrow = cmock_to_throw;
+}
+
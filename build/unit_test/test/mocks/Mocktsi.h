@@ -0,0 +1,84 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#ifndef _MOCKTSI_H
+#define _MOCKTSI_H
+
+#include "unity.h"
+#include "FreeRTOSConfig.h"
+#include "FreeRTOS.h"
+#include "portmacro.h"
+#include "mpu_wrappers.h"
+#include "portable.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "stream_buffer.h"
+#include "event_groups.h"
+#include "string.h"
+#include "tsi.h"
+#include "CException.h"
+
+/* Ignore the following warnings, since we are copying code */
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic push
+#endif
+#if !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wpragmas"
+#endif
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma GCC diagnostic ignored "-Wduplicate-decl-specifier"
+#endif
+
+void Mocktsi_Init(void);
+void Mocktsi_Destroy(void);
+void Mocktsi_Verify(void);
+
+
+
+
+#define TSI_GetTemperature_IgnoreAndReturn(cmock_retval) TSI_GetTemperature_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TSI_GetTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return);
+#define TSI_GetTemperature_StopIgnore() TSI_GetTemperature_CMockStopIgnore()
+void TSI_GetTemperature_CMockStopIgnore(void);
+#define TSI_GetTemperature_ExpectAndReturn(adcVoltage_mV, cmock_retval) TSI_GetTemperature_CMockExpectAndReturn(__LINE__, adcVoltage_mV, cmock_retval)
+void TSI_GetTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, uint16_t adcVoltage_mV, int16_t cmock_to_return);
+typedef int16_t (* CMOCK_TSI_GetTemperature_CALLBACK)(uint16_t adcVoltage_mV, int cmock_num_calls);
+void TSI_GetTemperature_AddCallback(CMOCK_TSI_GetTemperature_CALLBACK Callback);
+void TSI_GetTemperature_Stub(CMOCK_TSI_GetTemperature_CALLBACK Callback);
+#define TSI_GetTemperature_StubWithCallback TSI_GetTemperature_Stub
+#define TSI_GetTemperature_ExpectAndThrow(adcVoltage_mV, cmock_to_throw) TSI_GetTemperature_CMockExpectAndThrow(__LINE__, adcVoltage_mV, cmock_to_throw)
+void TSI_GetTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, uint16_t adcVoltage_mV, CEXCEPTION_T cmock_to_throw);
+#define TSI_GetTemperature_IgnoreArg_adcVoltage_mV() TSI_GetTemperature_CMockIgnoreArg_adcVoltage_mV(__LINE__)
+void TSI_GetTemperature_CMockIgnoreArg_adcVoltage_mV(UNITY_LINE_TYPE cmock_line);
+#define TSI_GetMaximumPlausibleTemperature_IgnoreAndReturn(cmock_retval) TSI_GetMaximumPlausibleTemperature_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TSI_GetMaximumPlausibleTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return);
+#define TSI_GetMaximumPlausibleTemperature_StopIgnore() TSI_GetMaximumPlausibleTemperature_CMockStopIgnore()
+void TSI_GetMaximumPlausibleTemperature_CMockStopIgnore(void);
+#define TSI_GetMaximumPlausibleTemperature_ExpectAndReturn(cmock_retval) TSI_GetMaximumPlausibleTemperature_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TSI_GetMaximumPlausibleTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return);
+typedef int16_t (* CMOCK_TSI_GetMaximumPlausibleTemperature_CALLBACK)(int cmock_num_calls);
+void TSI_GetMaximumPlausibleTemperature_AddCallback(CMOCK_TSI_GetMaximumPlausibleTemperature_CALLBACK Callback);
+void TSI_GetMaximumPlausibleTemperature_Stub(CMOCK_TSI_GetMaximumPlausibleTemperature_CALLBACK Callback);
+#define TSI_GetMaximumPlausibleTemperature_StubWithCallback TSI_GetMaximumPlausibleTemperature_Stub
+#define TSI_GetMaximumPlausibleTemperature_ExpectAndThrow(cmock_to_throw) TSI_GetMaximumPlausibleTemperature_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TSI_GetMaximumPlausibleTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+#define TSI_GetMinimumPlausibleTemperature_IgnoreAndReturn(cmock_retval) TSI_GetMinimumPlausibleTemperature_CMockIgnoreAndReturn(__LINE__, cmock_retval)
+void TSI_GetMinimumPlausibleTemperature_CMockIgnoreAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return);
+#define TSI_GetMinimumPlausibleTemperature_StopIgnore() TSI_GetMinimumPlausibleTemperature_CMockStopIgnore()
+void TSI_GetMinimumPlausibleTemperature_CMockStopIgnore(void);
+#define TSI_GetMinimumPlausibleTemperature_ExpectAndReturn(cmock_retval) TSI_GetMinimumPlausibleTemperature_CMockExpectAndReturn(__LINE__, cmock_retval)
+void TSI_GetMinimumPlausibleTemperature_CMockExpectAndReturn(UNITY_LINE_TYPE cmock_line, int16_t cmock_to_return);
+typedef int16_t (* CMOCK_TSI_GetMinimumPlausibleTemperature_CALLBACK)(int cmock_num_calls);
+void TSI_GetMinimumPlausibleTemperature_AddCallback(CMOCK_TSI_GetMinimumPlausibleTemperature_CALLBACK Callback);
+void TSI_GetMinimumPlausibleTemperature_Stub(CMOCK_TSI_GetMinimumPlausibleTemperature_CALLBACK Callback);
+#define TSI_GetMinimumPlausibleTemperature_StubWithCallback TSI_GetMinimumPlausibleTemperature_Stub
+#define TSI_GetMinimumPlausibleTemperature_ExpectAndThrow(cmock_to_throw) TSI_GetMinimumPlausibleTemperature_CMockExpectAndThrow(__LINE__, cmock_to_throw)
+void TSI_GetMinimumPlausibleTemperature_CMockExpectAndThrow(UNITY_LINE_TYPE cmock_line, CEXCEPTION_T cmock_to_throw);
+
+#if defined(__GNUC__) && !defined(__ICC) && !defined(__TMS470__)
+#if __GNUC__ > 4 || (__GNUC__ == 4 && (__GNUC_MINOR__ > 6 || (__GNUC_MINOR__ == 6 && __GNUC_PATCHLEVEL__ > 0)))
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+#endif
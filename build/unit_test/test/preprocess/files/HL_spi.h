@@ -0,0 +1,90 @@
+#include "include/HL_sys_common.h"
+
+
+
+
+
+
+
+
+
+
+
+
+typedef volatile struct spiBase {
+
+    uint32 GCR1;
+
+    uint32 INT0;
+
+    uint32 PC3;
+
+    uint32 DAT1;
+
+    uint32 BUF;
+
+    uint32 FMT0;
+
+    uint32 FMT1;
+
+    uint32 FMT2;
+
+    uint32 FMT3;
+
+} spiBASE_t;
+
+
+
+
+
+typedef enum dataformat {
+
+    SPI_FMT_0 = 0u,
+
+    SPI_FMT_1 = 1u,
+
+    SPI_FMT_2 = 2u,
+
+    SPI_FMT_3 = 3u,
+
+} SPIDATAFMT_t;
+
+
+
+
+
+typedef struct spiDAT1RegConfig {
+
+    boolean CS_HOLD;
+
+    boolean WDEL;
+
+    SPIDATAFMT_t DFSEL;
+
+    uint8 CSNR;
+
+} spiDAT1_t;
+
+extern spiBASE_t sil_spiRegisters[(5u)];
+
+
+
+
+
+
+
+extern void spiInit(void);
+
+extern uint32 spiTransmitData(spiBASE_t *spi, spiDAT1_t *dataconfig, uint32 blocksize, uint16 *srcbuff);
+
+extern uint32 spiTransmitAndReceiveData(
+
+    spiBASE_t *spi,
+
+    spiDAT1_t *dataconfig,
+
+    uint32 blocksize,
+
+    uint16 *srcbuff,
+
+    uint16 *destbuff);
@@ -0,0 +1,291 @@
+#include "../../src/app/engine/database/database.h"
+#include "../../src/app/application/config/bal_cfg.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+typedef enum BAL_STATEMACH {
+
+
+
+    BAL_STATEMACH_UNINITIALIZED,
+
+    BAL_STATEMACH_INITIALIZATION,
+
+    BAL_STATEMACH_INITIALIZED,
+
+    BAL_STATEMACH_CHECK_BALANCING,
+
+    BAL_STATEMACH_BALANCE,
+
+    BAL_STATEMACH_NO_BALANCING,
+
+    BAL_STATEMACH_ALLOWBALANCING,
+
+    BAL_STATEMACH_GLOBALDISABLE,
+
+    BAL_STATEMACH_GLOBALENABLE,
+
+    BAL_STATEMACH_UNDEFINED,
+
+    BAL_STATEMACH_RESERVED1,
+
+    BAL_STATEMACH_ERROR,
+
+} BAL_STATEMACH_e;
+
+
+
+
+
+
+
+
+
+typedef enum BAL_STATEMACH_SUB {
+
+    BAL_ENTRY,
+
+    BAL_CHECK_IMBALANCES,
+
+    BAL_COMPUTE_IMBALANCES,
+
+    BAL_ACTIVATE_BALANCING,
+
+    BAL_CHECK_LOWEST_VOLTAGE,
+
+    BAL_CHECK_CURRENT,
+
+} BAL_STATEMACH_SUB_e;
+
+
+
+
+
+
+
+
+
+typedef enum BAL_STATE_REQUEST {
+
+    BAL_STATE_INIT_REQUEST,
+
+    BAL_STATE_ERROR_REQUEST,
+
+    BAL_STATE_NO_BALANCING_REQUEST,
+
+    BAL_STATE_ALLOWBALANCING_REQUEST,
+
+    BAL_STATE_GLOBAL_DISABLE_REQUEST,
+
+    BAL_STATE_GLOBAL_ENABLE_REQUEST,
+
+    BAL_STATE_NO_REQUEST,
+
+} BAL_STATE_REQUEST_e;
+
+
+
+
+
+
+
+
+
+typedef enum BAL_RETURN_TYPE {
+
+    BAL_OK,
+
+    BAL_BUSY_OK,
+
+    BAL_REQUEST_PENDING,
+
+    BAL_ILLEGAL_REQUEST,
+
+    BAL_INIT_ERROR,
+
+    BAL_OK_FROM_ERROR,
+
+    BAL_ERROR,
+
+    BAL_ALREADY_INITIALIZED,
+
+    BAL_ILLEGAL_TASK_TYPE,
+
+} BAL_RETURN_TYPE_e;
+
+
+
+
+
+
+
+
+
+
+
+typedef struct BAL_STATE {
+
+    uint16_t timer;
+
+    BAL_STATE_REQUEST_e stateRequest;
+
+    BAL_STATEMACH_e state;
+
+    BAL_STATEMACH_SUB_e substate;
+
+    BAL_STATEMACH_e lastState;
+
+    uint8_t lastSubstate;
+
+    uint8_t triggerEntry;
+
+    uint32_t errorRequestCounter;
+
+    STD_RETURN_TYPE_e initializationFinished;
+
+    
+
+   _Bool 
+
+        active;
+
+    int32_t balancingThreshold;
+
+    
+
+   _Bool 
+
+        balancingAllowed;
+
+    
+
+   _Bool 
+
+        balancingGlobalAllowed;
+
+} BAL_STATE_s;
+
+
+
+
+
+
+
+
+
+extern void BAL_SaveLastStates(BAL_STATE_s *pBalancingState);
+
+extern uint8_t BAL_CheckReEntrance(BAL_STATE_s *currentState);
+
+extern BAL_STATE_REQUEST_e BAL_TransferStateRequest(BAL_STATE_s *currentState);
+
+extern BAL_RETURN_TYPE_e BAL_CheckStateRequest(BAL_STATE_s *pCurrentState, BAL_STATE_REQUEST_e stateRequest);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void BAL_ProcessStateUninitalized(BAL_STATE_s *pCurrentState, BAL_STATE_REQUEST_e stateRequest);
+
+
+
+
+
+
+
+
+
+
+
+extern void BAL_ProcessStateInitialization(BAL_STATE_s *currentState);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void BAL_ProcessStateInitialized(BAL_STATE_s *currentState);
+
+
+
+
+
+extern STD_RETURN_TYPE_e BAL_Init(DATA_BLOCK_BALANCING_CONTROL_s *pControl);
+
+extern BAL_RETURN_TYPE_e BAL_SetStateRequest(BAL_STATE_REQUEST_e stateRequest);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e BAL_GetInitializationState(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void BAL_Trigger(void);
+
+
+
+
+
+
+
+extern BAL_STATEMACH_e BAL_GetState(void);
+
+
+
+
+
+
+
+extern DATA_BLOCK_BALANCING_CONTROL_s *TEST_BAL_GetBalancingControl(void);
+
+extern BAL_STATE_s *TEST_BAL_GetBalancingState(void);
@@ -0,0 +1,166 @@
+#include "../../src/app/task/os/os.h"
+#include "../../src/os/freertos/include/task.h"
+#include "../../src/os/freertos/include/queue.h"
+#include "../../src/os/freertos/include/FreeRTOS.h"
+#include "../../src/app/engine/config/database_cfg.h"
+
+
+
+
+
+
+typedef enum DATA_BLOCK_ACCESS_TYPE {
+
+    DATA_WRITE_ACCESS,
+
+    DATA_READ_ACCESS,
+
+    DATA_READ_RANGE_ACCESS,
+
+} DATA_BLOCK_ACCESS_TYPE_e;
+
+extern void DATA_DummyFunction(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e DATA_Init(void);
+
+
+
+
+
+
+
+
+
+
+
+extern void DATA_Task(void);
+
+extern STD_RETURN_TYPE_e DATA_Write_1_DataBlock(void *pDataFromSender0);
+
+extern STD_RETURN_TYPE_e DATA_Write_2_DataBlocks(void *pDataFromSender0, void *pDataFromSender1);
+
+extern STD_RETURN_TYPE_e DATA_Write_3_DataBlocks(
+
+    void *pDataFromSender0,
+
+    void *pDataFromSender1,
+
+    void *pDataFromSender2);
+
+extern STD_RETURN_TYPE_e DATA_Write_4_DataBlocks(
+
+    void *pDataFromSender0,
+
+    void *pDataFromSender1,
+
+    void *pDataFromSender2,
+
+    void *pDataFromSender3);
+
+extern STD_RETURN_TYPE_e DATA_Read_1_DataBlock(void *pDataToReceiver0);
+
+extern STD_RETURN_TYPE_e DATA_Read_2_DataBlocks(void *pDataToReceiver0, void *pDataToReceiver1);
+
+extern STD_RETURN_TYPE_e DATA_Read_3_DataBlocks(void *pDataToReceiver0, void *pDataToReceiver1, void *pDataToReceiver2);
+
+extern STD_RETURN_TYPE_e DATA_Read_4_DataBlocks(
+
+    void *pDataToReceiver0,
+
+    void *pDataToReceiver1,
+
+    void *pDataToReceiver2,
+
+    void *pDataToReceiver3);
+
+extern STD_RETURN_TYPE_e DATA_ReadDataBlockRange(
+
+    DATA_BLOCK_ID_e blockId,
+
+    void *pDataToReceiver,
+
+    uint16_t offset,
+
+    uint16_t length);
+
+extern STD_RETURN_TYPE_e DATA_SubscribeToDataBlock(DATA_BLOCK_ID_e blockId, uint32_t notificationBits);
+
+extern uint32_t DATA_GetDataBlockUpdates(uint32_t notificationBits, uint32_t timeout_ms);
+
+extern void *DATA_GetBackBuffer(DATA_BLOCK_ID_e blockId);
+
+extern void DATA_CommitBackBuffer(DATA_BLOCK_ID_e blockId);
+
+extern const void *DATA_GetFrontBuffer(DATA_BLOCK_ID_e blockId);
+
+extern uint8_t DATA_GetMaximumNumberOfReadAttempts(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           DATA_DatabaseEntryUpdatedAtLeastOnce(void *pDatabaseEntry);
+
+extern 
+
+      _Bool 
+
+           DATA_DatabaseEntryUpdatedRecently(void *pDatabaseEntry, uint32_t timeInterval);
+
+extern 
+
+      _Bool 
+
+           DATA_DatabaseEntryUpdatedWithinInterval(void *pDatabaseEntry, uint32_t timeInterval);
+
+
+
+
+
+
+
+extern void TEST_DATA_WriteEntryWithSequenceLock(void *pDataFromSender);
+
+extern void TEST_DATA_ReadEntryWithSequenceLock(void *pDataToReceiver);
+
+extern void TEST_DATA_ReadRangeWithSequenceLock(
+
+    DATA_BLOCK_ID_e blockId,
+
+    void *pDataToReceiver,
+
+    uint16_t offset,
+
+    uint16_t length);
+
+extern void TEST_DATA_CopyRange(DATA_BLOCK_ID_e blockId, void *pDataToReceiver, uint16_t offset, uint16_t length);
+
+extern void TEST_DATA_NotifySubscribers(DATA_BLOCK_ID_e blockId);
+
+extern uint32_t TEST_DATA_GetSequenceCounter(DATA_BLOCK_ID_e blockId);
+
+extern void TEST_DATA_SetSequenceCounter(DATA_BLOCK_ID_e blockId, uint32_t value);
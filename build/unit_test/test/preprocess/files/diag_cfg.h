@@ -0,0 +1,300 @@
+#include "../../src/app/engine/config/database_cfg.h"
+#include "../../src/app/application/config/battery_system_cfg.h"
+#include "../../src/app/main/include/general.h"
+
+
+typedef struct DIAG_DATABASE_SHIM {
+
+    DATA_BLOCK_ERRORSTATE_s *pTableError;
+
+    DATA_BLOCK_MOL_FLAG_s *pTableMol;
+
+    DATA_BLOCK_RSL_FLAG_s *pTableRsl;
+
+    DATA_BLOCK_MSL_FLAG_s *pTableMsl;
+
+} DIAG_DATABASE_SHIM_s;
+
+
+
+
+
+extern const DIAG_DATABASE_SHIM_s diag_kDatabaseShim;
+
+
+
+
+
+typedef enum DIAG_ID {
+
+    DIAG_ID_FLASHCHECKSUM,
+
+    DIAG_ID_SYSTEMMONITORING,
+
+    DIAG_ID_CONFIGASSERT,
+
+    DIAG_ID_ALGORITHM_DEADLINE,
+
+    DIAG_ID_LTC_SPI,
+
+    DIAG_ID_LTC_PEC,
+
+    DIAG_ID_LTC_MUX,
+
+    DIAG_ID_LTC_CONFIG,
+
+    DIAG_ID_CAN_TIMING,
+
+    DIAG_ID_CAN_CC_RESPONDING,
+
+    DIAG_ID_CAN_EC_RESPONDING,
+
+    DIAG_ID_CURRENT_SENSOR_RESPONDING,
+
+    DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE,
+
+    DIAG_ID_MEASUREMENT_IC_CELL_VOLTAGE_MEAS_ERROR,
+
+    DIAG_ID_MEASUREMENT_IC_CELL_TEMPERATURE_MEAS_ERROR,
+
+    DIAG_ID_PLAUSIBILITY_CELL_TEMP,
+
+    DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD,
+
+    DIAG_ID_PLAUSIBILITY_CELL_TEMPERATURE_SPREAD,
+
+    DIAG_ID_CELLVOLTAGE_OVERVOLTAGE_MSL,
+
+    DIAG_ID_CELLVOLTAGE_OVERVOLTAGE_RSL,
+
+    DIAG_ID_CELLVOLTAGE_OVERVOLTAGE_MOL,
+
+    DIAG_ID_CELLVOLTAGE_UNDERVOLTAGE_MSL,
+
+    DIAG_ID_CELLVOLTAGE_UNDERVOLTAGE_RSL,
+
+    DIAG_ID_CELLVOLTAGE_UNDERVOLTAGE_MOL,
+
+    DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MSL,
+
+    DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_RSL,
+
+    DIAG_ID_TEMP_OVERTEMPERATURE_CHARGE_MOL,
+
+    DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MSL,
+
+    DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_RSL,
+
+    DIAG_ID_TEMP_OVERTEMPERATURE_DISCHARGE_MOL,
+
+    DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MSL,
+
+    DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_RSL,
+
+    DIAG_ID_TEMP_UNDERTEMPERATURE_CHARGE_MOL,
+
+    DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MSL,
+
+    DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_RSL,
+
+    DIAG_ID_TEMP_UNDERTEMPERATURE_DISCHARGE_MOL,
+
+    DIAG_ID_OVERCURRENT_CHARGE_CELL_MSL,
+
+    DIAG_ID_OVERCURRENT_CHARGE_CELL_RSL,
+
+    DIAG_ID_OVERCURRENT_CHARGE_CELL_MOL,
+
+    DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MSL,
+
+    DIAG_ID_OVERCURRENT_DISCHARGE_CELL_RSL,
+
+    DIAG_ID_OVERCURRENT_DISCHARGE_CELL_MOL,
+
+    DIAG_ID_STRING_OVERCURRENT_CHARGE_MSL,
+
+    DIAG_ID_STRING_OVERCURRENT_CHARGE_RSL,
+
+    DIAG_ID_STRING_OVERCURRENT_CHARGE_MOL,
+
+    DIAG_ID_STRING_OVERCURRENT_DISCHARGE_MSL,
+
+    DIAG_ID_STRING_OVERCURRENT_DISCHARGE_RSL,
+
+    DIAG_ID_STRING_OVERCURRENT_DISCHARGE_MOL,
+
+    DIAG_ID_PACK_OVERCURRENT_CHARGE_MSL,
+
+    DIAG_ID_PACK_OVERCURRENT_DISCHARGE_MSL,
+
+    DIAG_ID_CURRENT_ON_OPEN_STRING,
+
+    DIAG_ID_DEEP_DISCHARGE_DETECTED,
+
+    DIAG_ID_OPEN_WIRE,
+
+    DIAG_ID_PLAUSIBILITY_PACK_VOLTAGE,
+
+    DIAG_ID_INTERLOCK_FEEDBACK,
+
+    DIAG_ID_STRING_CONTACTOR_FEEDBACK,
+
+    DIAG_ID_PRECHARGE_CONTACTOR_FEEDBACK,
+
+    DIAG_ID_SBC_FIN_STATE,
+
+    DIAG_ID_SBC_RSTB_STATE,
+
+    DIAG_ID_BASE_CELL_VOLTAGE_MESUREMENT_TIMEOUT,
+
+    DIAG_ID_REDUNDANCY0_CELL_VOLTAGE_MESUREMENT_TIMEOUT,
+
+    DIAG_ID_BASE_CELL_TEMPERATURE_MESUREMENT_TIMEOUT,
+
+    DIAG_ID_REDUNDANCY0_CELL_TEMPERATURE_MESUREMENT_TIMEOUT,
+
+    DIAG_ID_CURRENT_MEASUREMENT_TIMEOUT,
+
+    DIAG_ID_CURRENT_MEASUREMENT_ERROR,
+
+    DIAG_ID_CURRENT_SENSOR_V1_MEASUREMENT_TIMEOUT,
+
+    DIAG_ID_CURRENT_SENSOR_V3_MEASUREMENT_TIMEOUT,
+
+    DIAG_ID_CURRENT_SENSOR_POWER_MEASUREMENT_TIMEOUT,
+
+    DIAG_ID_POWER_MEASUREMENT_ERROR,
+
+    DIAG_ID_INSULATION_MEASUREMENT_INVALID,
+
+    DIAG_ID_INSULATION_ERROR,
+
+    DIAG_ID_INSULATION_GROUND_ERROR,
+
+    DIAG_ID_MAX,
+
+} DIAG_ID_e;
+
+
+
+
+
+typedef enum DIAG_EVENT {
+
+    DIAG_EVENT_OK,
+
+    DIAG_EVENT_NOT_OK,
+
+    DIAG_EVENT_RESET,
+
+} DIAG_EVENT_e;
+
+
+
+
+
+typedef enum DIAG_EVALUATE {
+
+    DIAG_EVALUATION_ENABLED,
+
+    DIAG_EVALUATION_DISABLED,
+
+} DIAG_EVALUATE_e;
+
+
+
+
+
+typedef enum DIAG_IMPACT_LEVEL {
+
+    DIAG_SYSTEM,
+
+    DIAG_STRING,
+
+} DIAG_IMPACT_LEVEL_e;
+
+typedef enum DIAG_RECORDING {
+
+    DIAG_RECORDING_ENABLED,
+
+    DIAG_RECORDING_DISABLED,
+
+} DIAG_RECORDING_e;
+
+typedef void DIAG_CALLBACK_FUNCTION_f(
+
+    DIAG_ID_e ch_id,
+
+    DIAG_EVENT_e event,
+
+    const DIAG_DATABASE_SHIM_s *const kpkDiagShim,
+
+    uint32_t data);
+
+
+
+
+
+typedef struct DIAG_CH_CFG {
+
+    DIAG_ID_e id;
+
+    uint8_t description[(40)];
+
+    uint16_t threshold;
+
+
+
+
+
+
+
+    DIAG_RECORDING_e enable_recording;
+
+    DIAG_EVALUATE_e enable_evaluate;
+
+    DIAG_CALLBACK_FUNCTION_f *fpCallback;
+
+
+
+
+
+
+
+} DIAG_ID_CFG_s;
+
+
+
+
+
+typedef struct DIAG_DEV {
+
+    uint8_t nr_of_ch;
+
+    DIAG_ID_CFG_s *ch_cfg;
+
+} DIAG_DEV_s;
+
+
+
+
+
+
+
+extern DIAG_DEV_s diag_device;
+
+extern DIAG_ID_CFG_s DIAG_ID_cfg[DIAG_ID_MAX];
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void DIAG_UpdateFlags(void);
@@ -0,0 +1,86 @@
+#include "../../src/app/main/include/general.h"
+
+
+
+
+extern float MATH_linearInterpolation(float x1, float y1, float x2, float y2, float x_interpolate);
+
+
+
+
+
+
+
+
+
+
+
+extern uint16_t MATH_swapBytes_uint16_t(uint16_t val);
+
+
+
+
+
+
+
+
+
+
+
+extern uint32_t MATH_swapBytes_uint32_t(uint32_t val);
+
+
+
+
+
+
+
+
+
+
+
+extern uint64_t MATH_swapBytes_uint64_t(uint64_t val);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern float MATH_minimumOfTwoFloats(float value1, float value2);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern int32_t MATH_AbsInt32(int32_t value);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern int64_t MATH_AbsInt64(int64_t value);
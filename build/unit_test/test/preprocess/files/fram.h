@@ -0,0 +1,30 @@
+#include "../../src/app/driver/config/fram_cfg.h"
+extern void FRAM_Initialize(void);
+
+extern STD_RETURN_TYPE_e FRAM_Write(FRAM_BLOCK_ID_e blockId);
+
+extern STD_RETURN_TYPE_e FRAM_Read(FRAM_BLOCK_ID_e blockId);
+
+extern void FRAM_RequestWrite(FRAM_BLOCK_ID_e blockId);
+
+extern void FRAM_ProcessWriteRequests(void);
+
+extern STD_RETURN_TYPE_e FRAM_Flush(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           FRAM_IsWritePending(FRAM_BLOCK_ID_e blockId);
@@ -0,0 +1,86 @@
+#include "../../src/app/driver/config/fram_cfg.h"
+typedef void (*FRAM_JOURNAL_READ_f)(uint32_t address, uint8_t *pData, uint16_t size);
+
+extern uint32_t FRAM_JOURNAL_Initialize(void);
+
+extern void FRAM_JOURNAL_Scan(FRAM_JOURNAL_READ_f readFunction);
+
+extern STD_RETURN_TYPE_e FRAM_JOURNAL_ReadLatest(
+
+    FRAM_BLOCK_ID_e blockId,
+
+    FRAM_JOURNAL_READ_f readFunction,
+
+    uint8_t *pData);
+
+extern uint16_t FRAM_JOURNAL_EncodeRecord(
+
+    FRAM_BLOCK_ID_e blockId,
+
+    const uint8_t *pData,
+
+    uint8_t *pRecord,
+
+    uint32_t *pAddress);
+
+
+
+
+
+
+
+
+
+
+
+extern void FRAM_JOURNAL_CommitRecord(FRAM_BLOCK_ID_e blockId);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           FRAM_JOURNAL_IsIndexUpdateDue(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern uint16_t FRAM_JOURNAL_EncodeIndex(uint8_t *pIndex, uint32_t *pAddress);
+
+
+
+
+
+extern void FRAM_JOURNAL_CommitIndex(void);
+
+
+
+
+
+
+
+extern uint16_t TEST_FRAM_JOURNAL_CalculateCrc(const uint8_t *pData, uint16_t length);
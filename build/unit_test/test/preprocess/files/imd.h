@@ -0,0 +1,12 @@
+#include "../../src/app/task/os/os.h"
+#include "../../src/app/driver/config/can_cfg.h"
+#include "../../src/app/main/include/general.h"
+
+
+extern QueueHandle_t imd_canDataQueue;
+
+extern StaticQueue_t imd_queueStructure;
+
+extern uint8_t imd_queueStorageArea[(5u) * (sizeof(CAN_BUFFERELEMENT_s))];
+
+extern void IMD_Trigger(void);
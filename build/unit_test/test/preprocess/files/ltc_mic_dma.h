@@ -0,0 +1,48 @@
+#include "../../src/app/driver/mic/ltc/common/ltc_defs.h"
+#include "../../src/app/driver/config/dma_cfg.h"
+#include "../../src/app/driver/mic/api/mic_dma.h"
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_TransmitReceiveSpiWithDma(uint16_t *tx, uint16_t *rx, uint32_t length);
+
+extern 
+
+      _Bool 
+
+           MIC_IsTransmitOngoing(LTC_STATE_s *pLtcState);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void MIC_SetTransmitOngoing(LTC_STATE_s *pLtcState);
+
+extern void MIC_ClearTransactionList(
+
+    LTC_TRANSACTION_LIST_s *pList,
+
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+
+    uint16_t *pTxBuffer,
+
+    uint32_t frameLength);
+
+extern STD_RETURN_TYPE_e MIC_QueueTransaction(
+
+    LTC_TRANSACTION_LIST_s *pList,
+
+    uint16_t *pCommand,
+
+    uint16_t *pRxBuffer,
+
+    uint8_t registerSet);
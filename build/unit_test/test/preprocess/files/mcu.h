@@ -0,0 +1,40 @@
+#include "../../src/app/main/include/general.h"
+extern volatile uint32_t MCU_RTI_CNT0_FRC0_REG;
+
+extern void MCU_delay_us(uint32_t delay_us);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern uint32_t MCU_GetFreeRunningCount(void);
+
+extern uint32_t MCU_ConvertFrcDifferenceToTimespan_us(uint32_t count);
+
+extern void MCU_InitializeCycleCounter(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern uint32_t MCU_GetCycleCount(void);
+
+extern uint32_t MCU_ConvertCycleDifferenceToTimespan_us(uint32_t cycles);
@@ -0,0 +1,140 @@
+#include "../../src/app/main/include/general.h"
+extern STD_RETURN_TYPE_e MEAS_Initialize(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern void MEAS_Control(void);
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           MEAS_IsFirstMeasurementCycleFinished(void);
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MEAS_StartMeasurement(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MEAS_RequestIoWrite(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MEAS_RequestIoRead(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MEAS_RequestTemperatureRead(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MEAS_RequestBalancingFeedbackRead(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MEAS_RequestEepromRead(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MEAS_RequestEepromWrite(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MEAS_RequestOpenWireCheck(uint8_t string);
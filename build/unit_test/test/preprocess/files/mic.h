@@ -0,0 +1,146 @@
+#include "../../src/app/main/include/general.h"
+extern STD_RETURN_TYPE_e MIC_TriggerIc(void);
+
+
+
+extern STD_RETURN_TYPE_e MIC_Init(void);
+
+
+
+extern STD_RETURN_TYPE_e MIC_StartMeasurement(void);
+
+
+
+extern 
+
+      _Bool 
+
+           MIC_IsFirstMeasurementCycleFinished(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern 
+
+      _Bool 
+
+           MIC_IsFirstMeasurementCycleFinished(void);
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_StartMeasurement(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_RequestIoWrite(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_RequestIoRead(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_RequestTemperatureRead(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_RequestBalancingFeedbackRead(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_RequestEepromRead(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_RequestEepromWrite(uint8_t string);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_RequestOpenWireCheck(uint8_t string);
@@ -0,0 +1,44 @@
+#include "../../src/app/main/include/general.h"
+typedef struct MIC_PLAUSIBILITY_VALUES {
+
+
+
+
+
+
+
+
+
+    const int16_t maximumPlausibleVoltage_mV;
+
+
+
+
+
+
+
+
+
+    const int16_t minimumPlausibleVoltage_mV;
+
+} MIC_PLAUSIBILITY_VALUES_s;
+
+extern STD_RETURN_TYPE_e MIC_PlausibilityCheckVoltageMeasurementRange(
+
+    const int16_t cellvoltage_mV,
+
+    const MIC_PLAUSIBILITY_VALUES_s plausibleValues);
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern STD_RETURN_TYPE_e MIC_PlausibilityCheckTempMinMax(const int16_t celltemperature_ddegC);
@@ -0,0 +1,33 @@
+#include "../../src/app/engine/database/database.h"
+#include "../../src/app/application/config/plausibility_cfg.h"
+
+
+extern STD_RETURN_TYPE_e PL_CheckStringVoltage(int32_t voltageMic_mV, int32_t voltageCurrentSensor_mV);
+
+extern STD_RETURN_TYPE_e PL_CheckCellvoltage(
+
+    int16_t baseCellVoltage,
+
+    int16_t redundancy0CellVoltage,
+
+    int16_t *pCellVoltage);
+
+extern STD_RETURN_TYPE_e PL_CheckCelltemperature(
+
+    int16_t baseCelltemperature,
+
+    int16_t redundancy0Celltemperature,
+
+    int16_t *pCelltemperature);
+
+extern STD_RETURN_TYPE_e PL_CheckVoltageSpread(
+
+    DATA_BLOCK_CELL_VOLTAGE_s *pCellvoltages,
+
+    DATA_BLOCK_MIN_MAX_s *pMinMaxAverageValues);
+
+extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(
+
+    DATA_BLOCK_CELL_TEMPERATURE_s *pCellTemperatures,
+
+    DATA_BLOCK_MIN_MAX_s *pMinMaxAverageValues);
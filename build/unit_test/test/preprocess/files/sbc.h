@@ -0,0 +1,142 @@
+#include "../../src/app/driver/sbc/nxpfs85xx.h"
+#include "../../src/app/task/config/ftask_cfg.h"
+#include "../../src/app/main/include/general.h"
+
+
+
+
+typedef enum SBC_STATE_REQUEST {
+
+    SBC_STATE_INIT_REQUEST,
+
+    SBC_STATE_ERROR_REQUEST,
+
+    SBC_STATE_NO_REQUEST,
+
+} SBC_STATE_REQUEST_e;
+
+
+
+
+
+typedef enum SBC_PERIODIC_WATCHDOG_STATE {
+
+    SBC_PERIODIC_WATCHDOG_ACTIVATED,
+
+    SBC_PERIODIC_WATCHDOG_DEACTIVATED,
+
+} SBC_PERIODIC_WATCHDOG_STATE_e;
+
+
+
+
+
+typedef enum SBC_RETURN_TYPE {
+
+    SBC_OK,
+
+    SBC_BUSY_OK,
+
+    SBC_REQUEST_PENDING,
+
+    SBC_ILLEGAL_REQUEST,
+
+    SBC_ALREADY_INITIALIZED,
+
+    SBC_ILLEGAL_TASK_TYPE,
+
+} SBC_RETURN_TYPE_e;
+
+
+
+
+
+typedef enum SBC_STATEMACHINE {
+
+
+
+    SBC_STATEMACHINE_UNINITIALIZED,
+
+    SBC_STATEMACHINE_INITIALIZATION,
+
+    SBC_STATEMACHINE_RUNNING,
+
+    SBC_STATEMACHINE_ERROR,
+
+    SBC_STATEMACHINE_UNDEFINED,
+
+} SBC_STATEMACHINE_e;
+
+
+
+
+
+typedef enum SBC_STATEMACHINE_SUB {
+
+    SBC_ENTRY,
+
+    SBC_INIT_RESET_FAULT_ERROR_COUNTER_PART1,
+
+    SBC_INIT_RESET_FAULT_ERROR_COUNTER_PART2,
+
+    SBC_INITIALIZE_SAFETY_PATH_CHECK,
+
+    SBC_INITIALIZE_VOLTAGE_SUPERVISOR_PART3,
+
+    SBC_INITIALIZE_VOLTAGE_SUPERVISOR_PART4,
+
+} SBC_STATEMACHINE_SUB_e;
+
+
+
+
+
+
+
+
+
+
+
+typedef struct SBC_STATE {
+
+    uint16_t timer;
+
+    uint16_t watchdogTrigger;
+
+    SBC_STATE_REQUEST_e stateRequest;
+
+    SBC_STATEMACHINE_e state;
+
+    SBC_STATEMACHINE_SUB_e substate;
+
+    SBC_STATEMACHINE_e lastState;
+
+    SBC_STATEMACHINE_SUB_e lastSubstate;
+
+    uint32_t illegalRequestsCounter;
+
+    uint8_t retryCounter;
+
+    uint8_t requestWatchdogTrigger;
+
+    uint8_t triggerEntry;
+
+    SBC_PERIODIC_WATCHDOG_STATE_e watchdogState;
+
+    FS85xx_STATE_s *pFs85xxInstance;
+
+    uint16_t watchdogPeriod_10ms;
+
+} SBC_STATE_s;
+
+
+
+
+
+extern SBC_STATE_s sbc_stateMcuSupervisor;
+
+extern SBC_RETURN_TYPE_e SBC_SetStateRequest(SBC_STATE_s *pInstance, SBC_STATE_REQUEST_e stateRequest);
+
+extern SBC_STATEMACHINE_e SBC_GetState(SBC_STATE_s *pInstance);
+
+extern void SBC_Trigger(SBC_STATE_s *pInstance);
@@ -0,0 +1,2 @@
+#include "../../src/app/main/include/general.h"
+extern void SYS_SendBootMessage(uint8_t directTransmission);
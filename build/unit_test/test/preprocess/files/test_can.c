@@ -0,0 +1,1191 @@
+#include "../../src/app/driver/can/can.c"
+#include "../../tests/unit/support/test_assert_helper.h"
+#include "../../src/app/driver/can/can.h"
+#include "test/mocks/Mockos.h"
+#include "test/mocks/Mockmcu.h"
+#include "test/mocks/Mockio.h"
+#include "Mockfoxmath.h"
+#include "test/mocks/Mockdiag.h"
+#include "test/mocks/Mockdatabase.h"
+#include "Mockcan_cfg.h"
+#include "MockHL_can.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+static uint32_t can_dummy(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t *canData) {
+
+    return 0;
+
+}
+
+
+
+const CAN_MSG_TX_TYPE_s can_txMessages[] = {
+
+    {0x001, 8, 100, 0, littleEndian, &can_dummy},
+
+};
+
+
+
+static uint8_t rxCallbackCalls = 0u;
+
+static uint32_t can_rxCounter(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t *canData, uint32_t *pMuxId) {
+
+    rxCallbackCalls++;
+
+    return 0;
+
+}
+
+
+
+const CAN_MSG_RX_TYPE_s can_rxMessages[] = {
+
+    {0x002, 8, 0, littleEndian, &can_rxCounter, CAN_RX_PRIORITY_LOW},
+
+    {0x003, 8, 0, littleEndian, &can_rxCounter, CAN_RX_PRIORITY_HIGH},
+
+};
+
+
+
+const uint8_t can_txLength = sizeof(can_txMessages) / sizeof(can_txMessages[0]);
+
+const uint8_t can_rxLength = sizeof(can_rxMessages) / sizeof(can_rxMessages[0]);
+
+
+
+CAN_STATE_s *canTestState = ((void *)(0));
+
+
+
+
+
+static CAN_TX_SCHEDULE_s testSchedule = {0};
+
+
+
+
+
+static CAN_RX_DISPATCH_TABLE_s testDispatchTable = {0};
+
+
+
+
+
+static CAN_RX_BUFFER_s *canTestRxBuffer = ((void *)(0));
+
+
+
+
+
+static const uint8_t testRxData[(8u)] = {1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u};
+
+
+
+
+
+void setUp(void) {
+
+    canTestState = TEST_CAN_GetCANState();
+
+
+
+    canTestState->periodicEnable = 
+
+                                  0
+
+                                       ;
+
+
+
+    for (uint8_t stringNumber = 0u; stringNumber < (3u); stringNumber++) {
+
+        canTestState->currentSensorPresent[stringNumber] = 
+
+                                                            0
+
+                                                                 ;
+
+        canTestState->currentSensorCCPresent[stringNumber] = 
+
+                                                            0
+
+                                                                 ;
+
+    }
+
+
+
+
+
+    canTestRxBuffer = TEST_CAN_GetRxBuffer();
+
+    canTestRxBuffer->readIndex = 0u;
+
+    canTestRxBuffer->writeIndex = 0u;
+
+    canTestRxBuffer->receivedMessages = 0u;
+
+    canTestRxBuffer->overflowCounter = 0u;
+
+    canTestRxBuffer->droppedLowPriorityFrames = 0u;
+
+    canTestRxBuffer->highWaterMark = 0u;
+
+    CAN_BuildRxDispatchTable(can_rxMessages, can_rxLength, TEST_CAN_GetRxDispatchTable());
+
+    rxCallbackCalls = 0u;
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+void testDataSendNullPointerAsNode(void) {
+
+    uint8_t data = 0;
+
+    canIsTxMessagePending_CMockIgnoreAndReturn(136, 0u);
+
+    canUpdateID_CMockIgnore();
+
+    canTransmit_CMockIgnoreAndReturn(138, 0u);
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CAN_DataSend(((void *)(0)), 0u, &data); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(139)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testDataSendNullPointerAsData(void) {
+
+    canBASE_t node = {0};
+
+    canIsTxMessagePending_CMockIgnoreAndReturn(144, 0u);
+
+    canUpdateID_CMockIgnore();
+
+    canTransmit_CMockIgnoreAndReturn(146, 0u);
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CAN_DataSend(&node, 0u, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(147)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testDataSendNoMessagePending(void) {
+
+    canBASE_t node = {0};
+
+    uint8_t data = 0;
+
+
+
+    canIsTxMessagePending_CMockIgnoreAndReturn(154, 1u);
+
+
+
+    for (uint8_t i = 0u; i < 32; i++) {
+
+        UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_DataSend(&node, i, &data))), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(157), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+}
+
+
+
+void testDataSendMessagePending(void) {
+
+    canBASE_t node = {0};
+
+    uint8_t data = 0;
+
+
+
+
+
+    canIsTxMessagePending_CMockExpectAndReturn(166, &node, 1, 0u);
+
+    canUpdateID_CMockExpect(167, &node, 1, 0x20040000u);
+
+    canTransmit_CMockExpectAndReturn(168, &node, 1, &data, 0u);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((CAN_DataSend(&node, 0x001, &data))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(169), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    for (uint8_t messageBox = 1u; messageBox < ((32U) - 1); messageBox++) {
+
+        canIsTxMessagePending_CMockExpectAndReturn(173, &node, messageBox, 1u);
+
+    }
+
+
+
+    canIsTxMessagePending_CMockExpectAndReturn(176, &node, (32U) - 1, 0u);
+
+    canUpdateID_CMockExpect(177, &node, (32U) - 1, 0x20040000u);
+
+    canTransmit_CMockExpectAndReturn(178, &node, (32U) - 1, &data, 0u);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((CAN_DataSend(&node, 0x001, &data))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(179), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testEnablePeriodic(void) {
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((
+
+   0
+
+   )), (UNITY_INT)((canTestState->periodicEnable)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(184), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    CAN_EnablePeriodic(
+
+                      0
+
+                           );
+
+    UnityAssertEqualNumber((UNITY_INT)((
+
+   0
+
+   )), (UNITY_INT)((canTestState->periodicEnable)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(187), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    CAN_EnablePeriodic(
+
+                      1
+
+                          );
+
+    UnityAssertEqualNumber((UNITY_INT)((
+
+   1
+
+   )), (UNITY_INT)((canTestState->periodicEnable)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(190), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testIsCurrentSensorPresent(void) {
+
+    for (uint8_t stringNumber = 0u; stringNumber < (3u); stringNumber++) {
+
+
+
+        UnityAssertEqualNumber((UNITY_INT)((
+
+       0
+
+       )), (UNITY_INT)((canTestState->currentSensorPresent[stringNumber])), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(196), UNITY_DISPLAY_STYLE_INT);
+
+
+
+        UnityAssertEqualNumber((UNITY_INT)((
+
+       0
+
+       )), (UNITY_INT)((CAN_IsCurrentSensorPresent(stringNumber))), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(198), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+        canTestState->currentSensorPresent[stringNumber] = 
+
+                                                          1
+
+                                                              ;
+
+
+
+
+
+        UnityAssertEqualNumber((UNITY_INT)((
+
+       1
+
+       )), (UNITY_INT)((canTestState->currentSensorPresent[stringNumber])), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(204), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+}
+
+
+
+void testIsCurrentSensorCcPresent(void) {
+
+    for (uint8_t stringNumber = 0u; stringNumber < (3u); stringNumber++) {
+
+
+
+        UnityAssertEqualNumber((UNITY_INT)((
+
+       0
+
+       )), (UNITY_INT)((canTestState->currentSensorCCPresent[stringNumber])), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(211), UNITY_DISPLAY_STYLE_INT);
+
+
+
+        UnityAssertEqualNumber((UNITY_INT)((
+
+       0
+
+       )), (UNITY_INT)((CAN_IsCurrentSensorCcPresent(stringNumber))), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(213), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+        canTestState->currentSensorCCPresent[stringNumber] = 
+
+                                                            1
+
+                                                                ;
+
+
+
+
+
+        UnityAssertEqualNumber((UNITY_INT)((
+
+       1
+
+       )), (UNITY_INT)((canTestState->currentSensorCCPresent[stringNumber])), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(219), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+}
+
+
+
+void testWorstCaseFrameBits(void) {
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((55u)), (UNITY_INT)((TEST_CAN_GetWorstCaseFrameBits(0u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(225), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((135u)), (UNITY_INT)((TEST_CAN_GetWorstCaseFrameBits(8u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(226), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testBuildTxScheduleInvalidInput(void) {
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CAN_BuildTxSchedule(((void *)(0)), 1u, &testSchedule); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(230)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CAN_BuildTxSchedule(can_txMessages, can_txLength, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(231)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testBuildTxScheduleSlotsContainDueMessages(void) {
+
+    const CAN_MSG_TX_TYPE_s messages[] = {
+
+        {0x010, 8, 100, 0, littleEndian, ((void *)(0)), ((void *)(0))},
+
+        {0x011, 8, 1000, 0, littleEndian, ((void *)(0)), ((void *)(0))},
+
+        {0x012, 8, 100, 10, littleEndian, ((void *)(0)), ((void *)(0))},
+
+        {0x013, 4, 200, 30, littleEndian, ((void *)(0)), ((void *)(0))},
+
+    };
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((CAN_BuildTxSchedule(messages, 4u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(241), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    uint16_t numberOfTransmissions = 0u;
+
+    for (uint16_t slot = 0u; slot < (100u); slot++) {
+
+        uint16_t entry = testSchedule.slotStart[slot];
+
+        for (uint8_t i = 0u; i < 4u; i++) {
+
+            if (((slot * (10U)) % messages[i].repetitionTime) == messages[i].repetitionPhase) {
+
+                UnityAssertGreaterOrLessOrEqualNumber((UNITY_INT)((testSchedule.slotStart[slot + 1u])), (UNITY_INT)((entry)), UNITY_SMALLER_THAN, (
+
+               ((void *)0)
+
+               ), (UNITY_UINT)(249), UNITY_DISPLAY_STYLE_INT);
+
+                UnityAssertEqualNumber((UNITY_INT)((i)), (UNITY_INT)((testSchedule.entries[entry])), (
+
+               ((void *)0)
+
+               ), (UNITY_UINT)(250), UNITY_DISPLAY_STYLE_INT);
+
+                entry++;
+
+            }
+
+        }
+
+        UnityAssertEqualNumber((UNITY_INT)((testSchedule.slotStart[slot + 1u])), (UNITY_INT)((entry)), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(254), UNITY_DISPLAY_STYLE_INT);
+
+        numberOfTransmissions += testSchedule.slotStart[slot + 1u] - testSchedule.slotStart[slot];
+
+    }
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((26u)), (UNITY_INT)((numberOfTransmissions)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(258), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((2u * TEST_CAN_GetWorstCaseFrameBits(8u))), (UNITY_INT)((testSchedule.maximumBitsPerSlot)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(260), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testBuildTxScheduleRejectsInvalidTiming(void) {
+
+    const CAN_MSG_TX_TYPE_s notMultipleOfTick[] = {{0x010, 8, 105, 0, littleEndian, ((void *)(0)), ((void *)(0))}};
+
+    const CAN_MSG_TX_TYPE_s notDividingCycle[] = {{0x010, 8, 300, 0, littleEndian, ((void *)(0)), ((void *)(0))}};
+
+    const CAN_MSG_TX_TYPE_s phaseTooLarge[] = {{0x010, 8, 100, 100, littleEndian, ((void *)(0)), ((void *)(0))}};
+
+    const CAN_MSG_TX_TYPE_s phaseNotOnTick[] = {{0x010, 8, 100, 5, littleEndian, ((void *)(0)), ((void *)(0))}};
+
+    const CAN_MSG_TX_TYPE_s zeroRepetitionTime[] = {{0x010, 8, 0, 0, littleEndian, ((void *)(0)), ((void *)(0))}};
+
+    const CAN_MSG_TX_TYPE_s dataLengthTooLarge[] = {{0x010, 9, 100, 0, littleEndian, ((void *)(0)), ((void *)(0))}};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_BuildTxSchedule(notMultipleOfTick, 1u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(270), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_BuildTxSchedule(notDividingCycle, 1u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(271), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_BuildTxSchedule(phaseTooLarge, 1u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(272), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_BuildTxSchedule(phaseNotOnTick, 1u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(273), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_BuildTxSchedule(zeroRepetitionTime, 1u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(274), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_BuildTxSchedule(dataLengthTooLarge, 1u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(275), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((testSchedule.slotStart[(100u)])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(277), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testBuildTxScheduleRejectsPhaseCollisions(void) {
+
+
+
+    const uint8_t framesPerTick = (((500u) * (10U) * (50u)) / 100u) / TEST_CAN_GetWorstCaseFrameBits(8u);
+
+    CAN_MSG_TX_TYPE_s messages[((32U) - 1u) + 1u] = {0};
+
+    for (uint8_t i = 0u; i < (((32U) - 1u) + 1u); i++) {
+
+        messages[i].id = i;
+
+        messages[i].dlc = 8u;
+
+        messages[i].repetitionTime = 100u;
+
+        messages[i].repetitionPhase = 0u;
+
+    }
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((CAN_BuildTxSchedule(messages, framesPerTick, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(291), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_BuildTxSchedule(messages, framesPerTick + 1u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(294), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    messages[framesPerTick].repetitionPhase = 50u;
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((CAN_BuildTxSchedule(messages, framesPerTick + 1u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(298), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    for (uint8_t i = 0u; i < (((32U) - 1u) + 1u); i++) {
+
+        messages[i].dlc = 0u;
+
+        messages[i].repetitionPhase = 0u;
+
+    }
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((CAN_BuildTxSchedule(messages, ((32U) - 1u), &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(305), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_BuildTxSchedule(messages, ((32U) - 1u) + 1u, &testSchedule))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(306), UNITY_DISPLAY_STYLE_INT)
+
+                                                                                                        ;
+
+}
+
+
+
+void testBuildRxDispatchTableInvalidInput(void) {
+
+    uint8_t entry = 0u;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CAN_BuildRxDispatchTable(((void *)(0)), 1u, &testDispatchTable); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(312)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CAN_BuildRxDispatchTable(can_rxMessages, can_rxLength, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(313)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CAN_FindRxHandlers(((void *)(0)), 0u, &entry); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(314)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CAN_FindRxHandlers(&testDispatchTable, 0u, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(315)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testBuildRxDispatchTableTooManyMessages(void) {
+
+    CAN_MSG_RX_TYPE_s messages[(64u) + 1u] = {0};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((CAN_BuildRxDispatchTable(messages, (64u), &testDispatchTable))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(320), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((CAN_BuildRxDispatchTable(messages, (64u) + 1u, &testDispatchTable))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(321), UNITY_DISPLAY_STYLE_INT)
+
+                                                                                                                 ;
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((testDispatchTable.numberOfEntries)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(323), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRxDispatchFindsAllHandlersOfAnId(void) {
+
+    const CAN_MSG_RX_TYPE_s messages[] = {
+
+        {0x521, 8, 0, bigEndian, ((void *)(0))},
+
+        {0x120, 8, 0, littleEndian, ((void *)(0))},
+
+        {0x037, 8, 0, littleEndian, ((void *)(0))},
+
+        {0x120, 8, 0, littleEndian, ((void *)(0))},
+
+        {0x777, 8, 0, littleEndian, ((void *)(0))},
+
+        {0x100, 8, 0, littleEndian, ((void *)(0))},
+
+        {0x120, 8, 0, littleEndian, ((void *)(0))},
+
+    };
+
+    uint8_t entry = 0u;
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((CAN_BuildRxDispatchTable(messages, 7u, &testDispatchTable))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(337), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((7u)), (UNITY_INT)((testDispatchTable.numberOfEntries)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(338), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    for (uint8_t i = 1u; i < testDispatchTable.numberOfEntries; i++) {
+
+        do {if ((testDispatchTable.id[i - 1u] <= testDispatchTable.id[i])) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(342)));}} while(0);
+
+    }
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((3u)), (UNITY_INT)((CAN_FindRxHandlers(&testDispatchTable, 0x120u, &entry))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(346), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((1u)), (UNITY_INT)((testDispatchTable.message[entry])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(347), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((3u)), (UNITY_INT)((testDispatchTable.message[entry + 1u])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(348), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((6u)), (UNITY_INT)((testDispatchTable.message[entry + 2u])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(349), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((1u)), (UNITY_INT)((CAN_FindRxHandlers(&testDispatchTable, 0x037u, &entry))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(352), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((2u)), (UNITY_INT)((testDispatchTable.message[entry])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(353), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((1u)), (UNITY_INT)((CAN_FindRxHandlers(&testDispatchTable, 0x777u, &entry))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(354), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((4u)), (UNITY_INT)((testDispatchTable.message[entry])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(355), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((CAN_FindRxHandlers(&testDispatchTable, 0x001u, &entry))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(358), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((CAN_FindRxHandlers(&testDispatchTable, 0x240u, &entry))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(359), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((CAN_FindRxHandlers(&testDispatchTable, 0x7FFu, &entry))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(360), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((CAN_BuildRxDispatchTable(messages, 0u, &testDispatchTable))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(363), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((CAN_FindRxHandlers(&testDispatchTable, 0x120u, &entry))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(364), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRxBufferStoresAndDispatchesMessages(void) {
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_CAN_StoreRxMessage(0x002u, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(368)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x002u, testRxData))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(370), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x003u, testRxData))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(371), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x004u, testRxData))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(372), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((3u)), (UNITY_INT)((canTestRxBuffer->receivedMessages)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(373), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((3u)), (UNITY_INT)((canTestRxBuffer->highWaterMark)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(374), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    CAN_ReadRxBuffer();
+
+    UnityAssertEqualNumber((UNITY_INT)((2u)), (UNITY_INT)((rxCallbackCalls)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(378), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((canTestRxBuffer->writeIndex)), (UNITY_INT)((canTestRxBuffer->readIndex)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(379), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((3u)), (UNITY_INT)((canTestRxBuffer->highWaterMark)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(381), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRxBufferWrapsAround(void) {
+
+    for (uint8_t i = 0u; i < (3u * (32U)); i++) {
+
+        UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x002u, testRxData))), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(386), UNITY_DISPLAY_STYLE_INT);
+
+        CAN_ReadRxBuffer();
+
+    }
+
+    UnityAssertEqualNumber((UNITY_INT)((3u * (32U))), (UNITY_INT)((rxCallbackCalls)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(389), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((1u)), (UNITY_INT)((canTestRxBuffer->highWaterMark)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(390), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((canTestRxBuffer->overflowCounter)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(391), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRxBufferDropsLowPriorityMessagesFirst(void) {
+
+    const uint8_t capacity = (32U) - 1u;
+
+    const uint8_t lowPriorityCapacity = capacity - (8u);
+
+
+
+    for (uint8_t i = 0u; i < lowPriorityCapacity; i++) {
+
+        UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x002u, testRxData))), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(399), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x002u, testRxData))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(401), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x004u, testRxData))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(403), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((2u)), (UNITY_INT)((canTestRxBuffer->droppedLowPriorityFrames)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(404), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((canTestRxBuffer->overflowCounter)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(405), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    for (uint8_t i = 0u; i < (8u); i++) {
+
+        UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x003u, testRxData))), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(409), UNITY_DISPLAY_STYLE_INT);
+
+    }
+
+    UnityAssertEqualNumber((UNITY_INT)((capacity)), (UNITY_INT)((canTestRxBuffer->highWaterMark)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(411), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x003u, testRxData))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(414), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x002u, testRxData))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(415), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((2u)), (UNITY_INT)((canTestRxBuffer->overflowCounter)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(416), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((2u)), (UNITY_INT)((canTestRxBuffer->droppedLowPriorityFrames)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(417), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((capacity)), (UNITY_INT)((canTestRxBuffer->receivedMessages)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(418), UNITY_DISPLAY_STYLE_INT);
+
+
+
+    CAN_ReadRxBuffer();
+
+    UnityAssertEqualNumber((UNITY_INT)((capacity)), (UNITY_INT)((rxCallbackCalls)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(421), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testRxStatisticsAreOnlyWrittenOnChange(void) {
+
+
+
+    TEST_CAN_UpdateRxStatistics();
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((TEST_CAN_StoreRxMessage(0x002u, testRxData))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(429), UNITY_DISPLAY_STYLE_INT);
+
+    DATA_Write_1_DataBlock_CMockExpectAndReturn(430, ((void *)(0)), STD_OK);
+
+    DATA_Write_1_DataBlock_CMockIgnoreArg_pDataFromSender0(431);
+
+    TEST_CAN_UpdateRxStatistics();
+
+    TEST_CAN_UpdateRxStatistics();
+
+    CAN_ReadRxBuffer();
+
+}
@@ -0,0 +1,664 @@
+#include "../../tests/unit/support/test_assert_helper.h"
+#include "../../src/app/driver/foxmath/cell_statistics.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+static int16_t testCstat_values[(8u)][(64u)];
+
+static uint64_t testCstat_invalid[(8u)];
+
+static uint32_t testCstat_randomState = 0u;
+
+
+
+
+
+static uint32_t TEST_CSTAT_GetRandom(void) {
+
+    testCstat_randomState = (testCstat_randomState * 1103515245u) + 12345u;
+
+    return testCstat_randomState >> 8u;
+
+}
+
+
+
+
+
+static void TEST_CSTAT_GetReference(uint8_t nrOfValues, CSTAT_STATISTICS_s *pStatistics) {
+
+    CSTAT_InitializeStatistics(pStatistics);
+
+    for (uint8_t m = 0u; m < (8u); m++) {
+
+        for (uint8_t c = 0u; c < nrOfValues; c++) {
+
+            if ((testCstat_invalid[m] & (1ull << c)) == 0u) {
+
+                const int16_t value = testCstat_values[m][c];
+
+                pStatistics->sum += value;
+
+                pStatistics->nrOfValidValues++;
+
+                if (value < pStatistics->minimum) {
+
+                    pStatistics->minimum = value;
+
+                    pStatistics->minimumIndex = (uint16_t)((m * nrOfValues) + c);
+
+                }
+
+                if (value > pStatistics->maximum) {
+
+                    pStatistics->maximum = value;
+
+                    pStatistics->maximumIndex = (uint16_t)((m * nrOfValues) + c);
+
+                }
+
+            }
+
+        }
+
+    }
+
+}
+
+
+
+
+
+void setUp(void) {
+
+    testCstat_randomState = 0x5EEDu;
+
+    for (uint8_t m = 0u; m < (8u); m++) {
+
+        testCstat_invalid[m] = 0u;
+
+        for (uint8_t c = 0u; c < (64u); c++) {
+
+            testCstat_values[m][c] = 0;
+
+        }
+
+    }
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+void testCSTAT_InvalidInput(void) {
+
+    CSTAT_STATISTICS_s statistics = {0};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CSTAT_InitializeStatistics(((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(118)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CSTAT_AddValues(((void *)(0)), 1u, 0u, 0u, &statistics); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(119)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CSTAT_AddValues(testCstat_values[0], 1u, 0u, 0u, ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(120)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CSTAT_AddValues(testCstat_values[0], 65u, 0u, 0u, &statistics); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(121)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CSTAT_GetOutOfRangeValues(((void *)(0)), 1u, 0u, 0, 1); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(122)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CSTAT_GetOutOfRangeValues(testCstat_values[0], 65u, 0u, 0, 1); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(123)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CSTAT_GetOutOfRangeValues(testCstat_values[0], 1u, 0u, 1, 0); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(124)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { CSTAT_CountValidValues(65u, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(125)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testCSTAT_NoValidValues(void) {
+
+    CSTAT_STATISTICS_s statistics = {0};
+
+    CSTAT_InitializeStatistics(&statistics);
+
+    CSTAT_AddValues(testCstat_values[0], 18u, 0x3FFFFu, 0u, &statistics);
+
+    CSTAT_AddValues(testCstat_values[1], 0u, 0u, 18u, &statistics);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((
+
+   (32767)
+
+   )), (UNITY_INT)(UNITY_INT16)((statistics.minimum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(134), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((
+
+   (-32767-1)
+
+   )), (UNITY_INT)(UNITY_INT16)((statistics.maximum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(135), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((0u)), (UNITY_INT)(UNITY_UINT16)((statistics.minimumIndex)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(136), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((0u)), (UNITY_INT)(UNITY_UINT16)((statistics.maximumIndex)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(137), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0)), (UNITY_INT)(UNITY_INT32)((statistics.sum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(138), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((0u)), (UNITY_INT)(UNITY_UINT16)((statistics.nrOfValidValues)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(139), UNITY_DISPLAY_STYLE_UINT16);
+
+}
+
+
+
+void testCSTAT_FirstOccurrenceOfExtremaIsStored(void) {
+
+    const int16_t module0[5] = {3000, 3100, 2900, 3100, 2900};
+
+    const int16_t module1[4] = {2900, 3100, 3000, 3000};
+
+    CSTAT_STATISTICS_s statistics = {0};
+
+    CSTAT_InitializeStatistics(&statistics);
+
+    CSTAT_AddValues(module0, 5u, 0u, 0u, &statistics);
+
+    CSTAT_AddValues(module1, 4u, 0u, 5u, &statistics);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((2900)), (UNITY_INT)(UNITY_INT16)((statistics.minimum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(150), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((3100)), (UNITY_INT)(UNITY_INT16)((statistics.maximum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(151), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((2u)), (UNITY_INT)(UNITY_UINT16)((statistics.minimumIndex)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(152), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((1u)), (UNITY_INT)(UNITY_UINT16)((statistics.maximumIndex)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(153), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((27000)), (UNITY_INT)(UNITY_INT32)((statistics.sum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(154), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((9u)), (UNITY_INT)(UNITY_UINT16)((statistics.nrOfValidValues)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(155), UNITY_DISPLAY_STYLE_UINT16);
+
+}
+
+
+
+void testCSTAT_ExtremeValues(void) {
+
+    const int16_t values[3] = {
+
+                              (-32767-1)
+
+                                       , 
+
+                                         (32767)
+
+                                                  , -1};
+
+    CSTAT_STATISTICS_s statistics = {0};
+
+    CSTAT_InitializeStatistics(&statistics);
+
+    CSTAT_AddValues(values, 3u, 0u, 10u, &statistics);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((
+
+   (-32767-1)
+
+   )), (UNITY_INT)(UNITY_INT16)((statistics.minimum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(164), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((
+
+   (32767)
+
+   )), (UNITY_INT)(UNITY_INT16)((statistics.maximum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(165), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((10u)), (UNITY_INT)(UNITY_UINT16)((statistics.minimumIndex)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(166), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((11u)), (UNITY_INT)(UNITY_UINT16)((statistics.maximumIndex)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(167), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((-2)), (UNITY_INT)(UNITY_INT32)((statistics.sum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(168), UNITY_DISPLAY_STYLE_INT32);
+
+}
+
+
+
+void testCSTAT_InvalidValuesAreSkipped(void) {
+
+    const int16_t values[6] = {100, -500, 200, 900, 300, 50};
+
+    CSTAT_STATISTICS_s statistics = {0};
+
+    CSTAT_InitializeStatistics(&statistics);
+
+
+
+    CSTAT_AddValues(values, 6u, 0xFF0Au, 0u, &statistics);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((50)), (UNITY_INT)(UNITY_INT16)((statistics.minimum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(178), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((300)), (UNITY_INT)(UNITY_INT16)((statistics.maximum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(179), UNITY_DISPLAY_STYLE_INT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((5u)), (UNITY_INT)(UNITY_UINT16)((statistics.minimumIndex)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(180), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((4u)), (UNITY_INT)(UNITY_UINT16)((statistics.maximumIndex)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(181), UNITY_DISPLAY_STYLE_UINT16);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((650)), (UNITY_INT)(UNITY_INT32)((statistics.sum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(182), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((4u)), (UNITY_INT)(UNITY_UINT16)((statistics.nrOfValidValues)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(183), UNITY_DISPLAY_STYLE_UINT16);
+
+}
+
+
+
+void testCSTAT_GetOutOfRangeValues(void) {
+
+    const int16_t values[7] = {-1, 0, 4999, 5000, 5001, 
+
+                                                       (-32767-1)
+
+                                                                , 
+
+                                                                  (32767)
+
+                                                                           };
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((0x71u)), (UNITY_INT)((CSTAT_GetOutOfRangeValues(values, 7u, 0u, 0, 5000))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(189), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((0x60u)), (UNITY_INT)((CSTAT_GetOutOfRangeValues(values, 7u, 0x11u, 0, 5000))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(191), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((0x0u)), (UNITY_INT)((CSTAT_GetOutOfRangeValues(values, 7u, 0u, -100000, 100000))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(193), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((UNITY_INT)((0x7Fu)), (UNITY_INT)((CSTAT_GetOutOfRangeValues(values, 7u, 0u, 40000, 50000))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(194), UNITY_DISPLAY_STYLE_UINT64);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((CSTAT_GetOutOfRangeValues(testCstat_values[0], 64u, 0u, 0, 0))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(196), UNITY_DISPLAY_STYLE_UINT64);
+
+    testCstat_values[0][63] = 1;
+
+    UnityAssertEqualNumber((UNITY_INT)((1ull << 63u)), (UNITY_INT)((CSTAT_GetOutOfRangeValues(testCstat_values[0], 64u, 0u, 0, 0))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(198), UNITY_DISPLAY_STYLE_UINT64);
+
+}
+
+
+
+void testCSTAT_CountValidValues(void) {
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((0u)), (UNITY_INT)(UNITY_UINT8 )((CSTAT_CountValidValues(0u, 0u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(202), UNITY_DISPLAY_STYLE_UINT8);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((18u)), (UNITY_INT)(UNITY_UINT8 )((CSTAT_CountValidValues(18u, 0u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(203), UNITY_DISPLAY_STYLE_UINT8);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((15u)), (UNITY_INT)(UNITY_UINT8 )((CSTAT_CountValidValues(18u, 0xFFFC0007u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(204), UNITY_DISPLAY_STYLE_UINT8);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((64u)), (UNITY_INT)(UNITY_UINT8 )((CSTAT_CountValidValues(64u, 0u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(205), UNITY_DISPLAY_STYLE_UINT8);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((0u)), (UNITY_INT)(UNITY_UINT8 )((CSTAT_CountValidValues(64u, 
+
+   (18446744073709551615UL)
+
+   ))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(206), UNITY_DISPLAY_STYLE_UINT8);
+
+}
+
+
+
+void testCSTAT_RandomValuesMatchReference(void) {
+
+    for (uint16_t round = 0u; round < (500u); round++) {
+
+
+
+        const uint8_t nrOfValues = (uint8_t)(1u + (TEST_CSTAT_GetRandom() % (64u)));
+
+
+
+        const int32_t valueRange = ((round % 2u) == 0u) ? 16 : 65536;
+
+        for (uint8_t m = 0u; m < (8u); m++) {
+
+            for (uint8_t c = 0u; c < nrOfValues; c++) {
+
+                testCstat_values[m][c] = (int16_t)((int32_t)(TEST_CSTAT_GetRandom() % (uint32_t)valueRange) -
+
+                                                   (valueRange / 2));
+
+            }
+
+
+
+            testCstat_invalid[m] = 0u;
+
+            if ((TEST_CSTAT_GetRandom() % 2u) == 0u) {
+
+                testCstat_invalid[m] = ((uint64_t)TEST_CSTAT_GetRandom() << 32u) | TEST_CSTAT_GetRandom();
+
+                testCstat_invalid[m] &= ((uint64_t)TEST_CSTAT_GetRandom() << 32u) | TEST_CSTAT_GetRandom();
+
+            }
+
+        }
+
+
+
+        CSTAT_STATISTICS_s expected = {0};
+
+        CSTAT_STATISTICS_s actual = {0};
+
+        TEST_CSTAT_GetReference(nrOfValues, &expected);
+
+        CSTAT_InitializeStatistics(&actual);
+
+        for (uint8_t m = 0u; m < (8u); m++) {
+
+            CSTAT_AddValues(
+
+                testCstat_values[m], nrOfValues, testCstat_invalid[m], (uint16_t)(m * nrOfValues), &actual);
+
+        }
+
+        UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((expected.minimum)), (UNITY_INT)(UNITY_INT16)((actual.minimum)), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(236), UNITY_DISPLAY_STYLE_INT16);
+
+        UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((expected.maximum)), (UNITY_INT)(UNITY_INT16)((actual.maximum)), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(237), UNITY_DISPLAY_STYLE_INT16);
+
+        UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((expected.minimumIndex)), (UNITY_INT)(UNITY_UINT16)((actual.minimumIndex)), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(238), UNITY_DISPLAY_STYLE_UINT16);
+
+        UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((expected.maximumIndex)), (UNITY_INT)(UNITY_UINT16)((actual.maximumIndex)), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(239), UNITY_DISPLAY_STYLE_UINT16);
+
+        UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((expected.sum)), (UNITY_INT)(UNITY_INT32)((actual.sum)), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(240), UNITY_DISPLAY_STYLE_INT32);
+
+        UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT16)((expected.nrOfValidValues)), (UNITY_INT)(UNITY_UINT16)((actual.nrOfValidValues)), (
+
+       ((void *)0)
+
+       ), (UNITY_UINT)(241), UNITY_DISPLAY_STYLE_UINT16);
+
+
+
+
+
+        const int16_t average = (int16_t)(valueRange / 8);
+
+        const int16_t tolerance = (int16_t)(valueRange / 4);
+
+        for (uint8_t m = 0u; m < (8u); m++) {
+
+            uint64_t expectedOutOfRange = 0u;
+
+            for (uint8_t c = 0u; c < nrOfValues; c++) {
+
+                if (((testCstat_invalid[m] & (1ull << c)) == 0u) &&
+
+                    (abs(testCstat_values[m][c] - average) > tolerance)) {
+
+                    expectedOutOfRange |= (1ull << c);
+
+                }
+
+            }
+
+            UnityAssertEqualNumber((UNITY_INT)((expectedOutOfRange)), (UNITY_INT)((CSTAT_GetOutOfRangeValues( testCstat_values[m], nrOfValues, testCstat_invalid[m], (int32_t)average - tolerance, (int32_t)average + tolerance))), (
+
+           ((void *)0)
+
+           ), (UNITY_UINT)(254), UNITY_DISPLAY_STYLE_UINT64)
+
+
+
+
+
+
+
+
+
+
+
+
+
+                                                  ;
+
+        }
+
+    }
+
+}
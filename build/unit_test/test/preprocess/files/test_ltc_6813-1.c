@@ -0,0 +1,349 @@
+#include "../../src/app/driver/mic/ltc/6813-1/ltc_6813-1.c"
+#include "../../src/app/driver/mic/ltc/common/ltc.h"
+#include "../../src/app/driver/foxmath/cell_statistics.h"
+#include "../../src/app/driver/mic/ltc/6813-1/config/ltc_6813-1_cfg.h"
+#include "test/mocks/Mocktsi.h"
+#include "test/mocks/Mockspi.h"
+#include "test/mocks/Mockos.h"
+#include "test/mocks/Mockmic_plausibility.h"
+#include "test/mocks/Mockltc_pec.h"
+#include "test/mocks/Mockltc_mic_dma.h"
+#include "test/mocks/Mockio.h"
+#include "test/mocks/Mockfassert.h"
+#include "test/mocks/Mockdma.h"
+#include "test/mocks/Mockdiag.h"
+#include "test/mocks/Mockdatabase.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static const spiDAT1_t spi_kLtcDataConfig = {
+
+
+
+    .CS_HOLD = (
+
+              0
+
+              ),
+
+    .WDEL = (
+
+              1
+
+              ),
+
+    .DFSEL = SPI_FMT_0,
+
+    .CSNR = 0x0,
+
+};
+
+
+
+
+
+SPI_INTERFACE_CONFIG_s spi_ltcInterface[(3u)] = {
+
+    {
+
+        .channel = SPI_Interface1,
+
+        .pConfig = &spi_kLtcDataConfig,
+
+        .pNode = (&sil_spiRegisters[0u]),
+
+        .pGioPort = &((&sil_spiRegisters[0u])->PC3),
+
+        .csPin = 2u,
+
+    },
+
+};
+
+
+
+SPI_INTERFACE_CONFIG_s spi_ltcInterfaceSecondary[(3u)] = {
+
+    {
+
+        .channel = SPI_Interface1,
+
+        .pConfig = &spi_kLtcDataConfig,
+
+        .pNode = (&sil_spiRegisters[0u]),
+
+        .pGioPort = &((&sil_spiRegisters[0u])->PC3),
+
+        .csPin = 2u,
+
+    },
+
+};
+
+
+
+
+
+void setUp(void) {
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+void testTEST_LTC_CheckReEntrance(void) {
+
+    OS_EnterTaskCritical_CMockExpect(115);
+
+    OS_ExitTaskCritical_CMockExpect(116);
+
+
+
+    LTC_STATE_s ltc_state = {0};
+
+    uint8_t retVal = 0;
+
+    retVal = TEST_LTC_CheckReEntrance(&ltc_state);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((0)), (UNITY_INT)(UNITY_UINT8 )((retVal)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(121), UNITY_DISPLAY_STYLE_UINT8);
+
+
+
+    OS_EnterTaskCritical_CMockExpect(123);
+
+    OS_ExitTaskCritical_CMockExpect(124);
+
+    ltc_state.triggerentry = 1;
+
+    retVal = TEST_LTC_CheckReEntrance(&ltc_state);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((0xFF)), (UNITY_INT)(UNITY_UINT8 )((retVal)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(127), UNITY_DISPLAY_STYLE_UINT8);
+
+}
+
+
+
+void testLTC_SetFirstMeasurementCycleFinished(void) {
+
+    OS_EnterTaskCritical_CMockExpect(131);
+
+    OS_ExitTaskCritical_CMockExpect(132);
+
+    static LTC_STATE_s test_ltc_state = {0};
+
+    test_ltc_state.first_measurement_made = 
+
+                                           0
+
+                                                ;
+
+    TEST_LTC_SetFirstMeasurementCycleFinished(&test_ltc_state);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((
+
+   1
+
+   )), (UNITY_INT)(UNITY_UINT8 )((test_ltc_state.first_measurement_made)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(136), UNITY_DISPLAY_STYLE_UINT8);
+
+}
+
+
+
+void testLTC_Convert_MuxVoltages_to_Temperatures() {
+
+    TSI_GetTemperature_CMockExpectAndReturn(140, 0, 0u);
+
+    int16_t x = 0;
+
+    x = LTC_Convert_MuxVoltages_to_Temperatures(0);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((0)), (UNITY_INT)(UNITY_INT16)((x)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(143), UNITY_DISPLAY_STYLE_INT16);
+
+    TSI_GetTemperature_CMockExpectAndReturn(144, 11, 11u);
+
+    x = LTC_Convert_MuxVoltages_to_Temperatures(11);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT16)((11)), (UNITY_INT)(UNITY_INT16)((x)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(146), UNITY_DISPLAY_STYLE_INT16);
+
+}
+
+
+
+void testLTC_StartTransactionListSendsFirstReadCommand(void) {
+
+    static LTC_STATE_s test_ltc_state = {0};
+
+    static uint16_t txBuffer[(4 + (8 * ((1u))))] = {0};
+
+    static uint16_t rxBuffer[(4 + (8 * ((1u))))] = {0};
+
+    static uint16_t command[4] = {0x00u, 0x04u, 0x07u, 0xC2u};
+
+    uint16_t *commands[2] = {command, command};
+
+    test_ltc_state.spiSeqPtr = spi_ltcInterface;
+
+    test_ltc_state.ltcData.txBuffer = txBuffer;
+
+    test_ltc_state.ltcData.frameLength = (4 + (8 * ((1u))));
+
+
+
+
+
+    test_ltc_state.transactionList.pSpiInterface = spi_ltcInterface;
+
+    test_ltc_state.transactionList.pTxBuffer = txBuffer;
+
+    test_ltc_state.transactionList.frameLength = (4 + (8 * ((1u))));
+
+    test_ltc_state.transactionList.transactions[0].pCommand = command;
+
+    test_ltc_state.transactionList.transactions[0].pRxBuffer = rxBuffer;
+
+
+
+    MIC_ClearTransactionList_CMockExpect(166, &test_ltc_state.transactionList, spi_ltcInterface, txBuffer, (4 + (8 * ((1u)))))
+
+                                                                                                       ;
+
+    MIC_QueueTransaction_CMockExpectAndReturn(168, &test_ltc_state.transactionList, command, ((void *)(0)), 0u, STD_OK);
+
+    MIC_QueueTransaction_CMockIgnoreArg_pRxBuffer(169);
+
+    MIC_QueueTransaction_CMockExpectAndReturn(170, &test_ltc_state.transactionList, command, ((void *)(0)), 1u, STD_OK);
+
+    MIC_QueueTransaction_CMockIgnoreArg_pRxBuffer(171);
+
+    MIC_SetTransmitOngoing_CMockExpect(172, &test_ltc_state);
+
+    SPI_TransmitReceiveDataWithDummyDma_CMockExpectAndReturn(173, spi_ltcInterface, (30U), ((4300u) - (1000u)), txBuffer, rxBuffer, (4 + (8 * ((1u)))), STD_OK)
+
+
+
+
+
+
+
+
+
+
+
+
+
+               ;
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((TEST_LTC_StartTransactionList(&test_ltc_state, commands, 2u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(182), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((1u)), (UNITY_INT)(UNITY_UINT8 )((test_ltc_state.transactionList.next)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(183), UNITY_DISPLAY_STYLE_UINT8);
+
+    UnityAssertEqualIntArray(( const void*)((command)), ( const void*)((txBuffer)), (UNITY_UINT32)((4u)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(184), UNITY_DISPLAY_STYLE_HEX16, UNITY_ARRAY_TO_ARRAY);
+
+}
+
+
+
+void testLTC_CheckTransactionListCompleted(void) {
+
+    static LTC_STATE_s test_ltc_state = {0};
+
+
+
+
+
+    test_ltc_state.transactionList.length = 4u;
+
+    test_ltc_state.transactionList.next = 4u;
+
+    test_ltc_state.transactionList.completed = 4u;
+
+    OS_EnterTaskCritical_CMockExpect(194);
+
+    OS_ExitTaskCritical_CMockExpect(195);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((TEST_LTC_CheckTransactionListCompleted(&test_ltc_state))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(196), UNITY_DISPLAY_STYLE_INT);
+
+
+
+
+
+    test_ltc_state.transactionList.length = 4u;
+
+    test_ltc_state.transactionList.next = 2u;
+
+    test_ltc_state.transactionList.completed = 1u;
+
+    OS_EnterTaskCritical_CMockExpect(202);
+
+    OS_ExitTaskCritical_CMockExpect(203);
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((TEST_LTC_CheckTransactionListCompleted(&test_ltc_state))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(204), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT8 )((2u)), (UNITY_INT)(UNITY_UINT8 )((test_ltc_state.transactionList.length)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(205), UNITY_DISPLAY_STYLE_UINT8);
+
+}
@@ -0,0 +1,306 @@
+#include "../../tests/unit/support/test_assert_helper.h"
+#include "../../src/app/application/plausibility/plausibility.h"
+#include "../../src/app/driver/foxmath/cell_statistics.h"
+#include "test/mocks/Mockdiag.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+static DATA_BLOCK_CELL_VOLTAGE_s cellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+static DATA_BLOCK_CURRENT_SENSOR_s currentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+
+
+
+
+
+
+
+void setUp(void) {
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorBothZero(void) {
+
+    int32_t packVoltage_mV = 0;
+
+    int32_t highVoltage_mV = 0;
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(81), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorBothMaximum(void) {
+
+    int32_t packVoltage_mV = 
+
+                            (2147483647)
+
+                                     ;
+
+    int32_t highVoltage_mV = 
+
+                            (2147483647)
+
+                                     ;
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(87), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsTolerance(void) {
+
+    int32_t packVoltage_mV = 0;
+
+    int32_t highVoltage_mV = (3000);
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_NOT_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(93), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsToleranceMinusOne(void) {
+
+    int32_t packVoltage_mV = 0;
+
+    int32_t highVoltage_mV = (3000) - 1;
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(99), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsTolerancePlusOne(void) {
+
+    int32_t packVoltage_mV = 0;
+
+    int32_t highVoltage_mV = (3000) + 1;
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_NOT_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(105), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualValue(void) {
+
+    int32_t packVoltage_mV = 4242;
+
+    int32_t highVoltage_mV = 4242;
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(111), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxMinus(void) {
+
+    int32_t packVoltage_mV = 0;
+
+    int32_t highVoltage_mV = 
+
+                            (2147483647)
+
+                                     ;
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_NOT_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(117), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxPlus(void) {
+
+    int32_t packVoltage_mV = 
+
+                            (2147483647) 
+
+                                      - ((3000) + 100);
+
+    int32_t highVoltage_mV = 
+
+                            (2147483647)
+
+                                     ;
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_NOT_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(123), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxPlusTooMuch(void) {
+
+    int32_t packVoltage_mV = 
+
+                            (2147483647) 
+
+                                      - ((3000) + 1);
+
+    int32_t highVoltage_mV = 
+
+                            (2147483647)
+
+                                     ;
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_NOT_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(129), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32Max(void) {
+
+    int32_t packVoltage_mV = 
+
+                            (2147483647)
+
+                                     ;
+
+    int32_t highVoltage_mV = 
+
+                            (2147483647)
+
+                                     ;
+
+    UnityAssertEqualNumber((UNITY_INT)((PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV))), (UNITY_INT)((STD_OK)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(135), UNITY_DISPLAY_STYLE_INT);
+
+}
+
+
+
+void testCheckVoltageSpreadInvalidatesOutliers(void) {
+
+    static DATA_BLOCK_MIN_MAX_s minMaxAverage = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+
+    for (uint8_t s = 0u; s < (3u); s++) {
+
+        minMaxAverage.averageCellVoltage_mV[s] = 3000;
+
+        for (uint16_t c = 0u; c < ((1u) * (18u)); c++) {
+
+            cellVoltage.cellVoltage_mV[s][c] = 3000;
+
+        }
+
+        for (uint8_t m = 0u; m < (1u); m++) {
+
+            cellVoltage.invalidCellVoltage[s][m] = 0u;
+
+        }
+
+    }
+
+
+
+    cellVoltage.cellVoltage_mV[0][0] = 3000 + (300);
+
+    cellVoltage.cellVoltage_mV[0][1] = 3000 - (300);
+
+
+
+    cellVoltage.cellVoltage_mV[1][2] = 3001 + (300);
+
+    cellVoltage.cellVoltage_mV[1][3] = 2999 - (300);
+
+    cellVoltage.cellVoltage_mV[1][4] = 0;
+
+    cellVoltage.invalidCellVoltage[1][0] = 0x10u;
+
+
+
+    DIAG_CheckEvent_CMockExpectAndReturn(158, STD_OK, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, 0u, STD_OK);
+
+    DIAG_CheckEvent_CMockExpectAndReturn(159, STD_NOT_OK, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, 1u, STD_OK);
+
+    for (uint8_t s = 2u; s < (3u); s++) {
+
+        DIAG_CheckEvent_CMockExpectAndReturn(161, STD_OK, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, s, STD_OK);
+
+    }
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((PL_CheckVoltageSpread(&cellVoltage, &minMaxAverage))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(163), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((0u)), (UNITY_INT)((cellVoltage.invalidCellVoltage[0][0])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(164), UNITY_DISPLAY_STYLE_UINT64);
+
+    UnityAssertEqualNumber((UNITY_INT)((0x1Cu)), (UNITY_INT)((cellVoltage.invalidCellVoltage[1][0])), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(165), UNITY_DISPLAY_STYLE_UINT64);
+
+}
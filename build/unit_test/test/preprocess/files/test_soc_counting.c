@@ -0,0 +1,45 @@
+#include "../../src/app/application/algorithm/state_estimation/sox_counter.h"
+#include "../../src/app/application/algorithm/state_estimation/soc/counting/soc_counting.h"
+#include "Mockfram.h"
+#include "Mockdatabase.h"
+#include "Mockbms.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+FRAM_SOC_s fram_soc = {0};
+
+
+
+
+
+void setUp(void) {
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+void testSOC_GetFromVoltage(void) {
+
+    float test_soc = -1.0;
+
+    uint16_t test_voltage_mV = 10;
+
+    test_soc = SOC_GetFromVoltage(test_voltage_mV);
+
+    UnityAssertEqualNumber((UNITY_INT)((0.5)), (UNITY_INT)((test_soc)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(77), UNITY_DISPLAY_STYLE_INT);
+
+}
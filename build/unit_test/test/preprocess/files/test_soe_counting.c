@@ -0,0 +1,37 @@
+#include "../../src/app/application/algorithm/state_estimation/sox_counter.h"
+#include "../../src/app/application/algorithm/state_estimation/soe/counting/soe_counting.h"
+#include "../../src/app/driver/foxmath/foxmath.h"
+#include "../../src/app/application/config/battery_cell_cfg.h"
+#include "test/mocks/Mockfram.h"
+#include "test/mocks/Mockdatabase.h"
+#include "test/mocks/Mockbms.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+FRAM_SOE_s fram_soe = {0};
+
+
+
+
+
+void setUp(void) {
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+void testDummy(void) {
+
+}
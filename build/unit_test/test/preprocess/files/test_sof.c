@@ -0,0 +1,926 @@
+#include "../../tests/unit/support/test_assert_helper.h"
+#include "../../src/app/application/algorithm/state_estimation/sof/trapezoid/sof.h"
+#include "../../src/app/application/algorithm/state_estimation/sof/trapezoid/sof_cfg.h"
+#include "test/mocks/Mockfram.h"
+#include "test/mocks/Mockdatabase.h"
+#include "test/mocks/Mockbms.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+FRAM_SOC_s fram_soc = {0};
+
+
+
+
+
+
+
+
+
+
+
+typedef struct TEST_FLOAT_CONFIG {
+
+    float maximumDischargeCurrent_mA;
+
+    float maximumChargeCurrent_mA;
+
+    float limpHomeCurrent_mA;
+
+    int16_t cutoffLowTemperatureDischarge_ddegC;
+
+    int16_t limitLowTemperatureDischarge_ddegC;
+
+    int16_t cutoffLowTemperatureCharge_ddegC;
+
+    int16_t limitLowTemperatureCharge_ddegC;
+
+    int16_t cutoffHighTemperatureDischarge_ddegC;
+
+    int16_t limitHighTemperatureDischarge_ddegC;
+
+    int16_t cutoffHighTemperatureCharge_ddegC;
+
+    int16_t limitHighTemperatureCharge_ddegC;
+
+    int16_t cutoffUpperCellVoltage_mV;
+
+    int16_t limitUpperCellVoltage_mV;
+
+    int16_t cutoffLowerCellVoltage_mV;
+
+    int16_t limitLowerCellVoltage_mV;
+
+} TEST_FLOAT_CONFIG_s;
+
+
+
+
+
+typedef struct TEST_FLOAT_LIMITS {
+
+    float charge_mA;
+
+    float discharge_mA;
+
+} TEST_FLOAT_LIMITS_s;
+
+
+
+static const TEST_FLOAT_CONFIG_s test_floatRecommendedCurrent = {
+
+    .maximumChargeCurrent_mA = (120000.00f),
+
+    .maximumDischargeCurrent_mA = (120000.00f),
+
+    .limpHomeCurrent_mA = (20000.00f),
+
+    .cutoffLowTemperatureDischarge_ddegC = (0),
+
+    .limitLowTemperatureDischarge_ddegC = (-100),
+
+    .cutoffLowTemperatureCharge_ddegC = (0),
+
+    .limitLowTemperatureCharge_ddegC = (-100),
+
+    .cutoffHighTemperatureDischarge_ddegC = (450),
+
+    .limitHighTemperatureDischarge_ddegC = (550),
+
+    .cutoffHighTemperatureCharge_ddegC = (450),
+
+    .limitHighTemperatureCharge_ddegC = (550),
+
+    .limitUpperCellVoltage_mV = (2550),
+
+    .cutoffUpperCellVoltage_mV = (2400),
+
+    .limitLowerCellVoltage_mV = (1750),
+
+    .cutoffLowerCellVoltage_mV = (2000)};
+
+
+
+static const TEST_FLOAT_CONFIG_s test_floatMaximumOperatingLimit = {
+
+    .maximumChargeCurrent_mA = (100000.00f),
+
+    .maximumDischargeCurrent_mA = (100000.00f),
+
+    .limpHomeCurrent_mA = (20000.00f),
+
+    .cutoffLowTemperatureDischarge_ddegC = (0),
+
+    .limitLowTemperatureDischarge_ddegC = (-100),
+
+    .cutoffLowTemperatureCharge_ddegC = (0),
+
+    .limitLowTemperatureCharge_ddegC = (-100),
+
+    .cutoffHighTemperatureDischarge_ddegC = (450),
+
+    .limitHighTemperatureDischarge_ddegC = (550),
+
+    .cutoffHighTemperatureCharge_ddegC = (450),
+
+    .limitHighTemperatureCharge_ddegC = (550),
+
+    .limitUpperCellVoltage_mV = (2550),
+
+    .cutoffUpperCellVoltage_mV = (2400),
+
+    .limitLowerCellVoltage_mV = (1750),
+
+    .cutoffLowerCellVoltage_mV = (2000)};
+
+
+
+static const TEST_FLOAT_CONFIG_s test_floatRecommendedSafetyLimit = {
+
+    .maximumChargeCurrent_mA = (115000.00f),
+
+    .maximumDischargeCurrent_mA = (115000.00f),
+
+    .limpHomeCurrent_mA = (20000.00f),
+
+    .cutoffLowTemperatureDischarge_ddegC = (0),
+
+    .limitLowTemperatureDischarge_ddegC = (-100),
+
+    .cutoffLowTemperatureCharge_ddegC = (0),
+
+    .limitLowTemperatureCharge_ddegC = (-100),
+
+    .cutoffHighTemperatureDischarge_ddegC = (450),
+
+    .limitHighTemperatureDischarge_ddegC = (550),
+
+    .cutoffHighTemperatureCharge_ddegC = (450),
+
+    .limitHighTemperatureCharge_ddegC = (550),
+
+    .limitUpperCellVoltage_mV = (2550),
+
+    .cutoffUpperCellVoltage_mV = (2400),
+
+    .limitLowerCellVoltage_mV = (1750),
+
+    .cutoffLowerCellVoltage_mV = (2000)};
+
+
+
+static const TEST_FLOAT_CONFIG_s test_floatMaximumSafetyLimit = {
+
+    .maximumChargeCurrent_mA = (122000.00f),
+
+    .maximumDischargeCurrent_mA = (122000.00f),
+
+    .limpHomeCurrent_mA = (20000.00f),
+
+    .cutoffLowTemperatureDischarge_ddegC = (0),
+
+    .limitLowTemperatureDischarge_ddegC = (-100),
+
+    .cutoffLowTemperatureCharge_ddegC = (0),
+
+    .limitLowTemperatureCharge_ddegC = (-100),
+
+    .cutoffHighTemperatureDischarge_ddegC = (450),
+
+    .limitHighTemperatureDischarge_ddegC = (550),
+
+    .cutoffHighTemperatureCharge_ddegC = (450),
+
+    .limitHighTemperatureCharge_ddegC = (550),
+
+    .limitUpperCellVoltage_mV = (2550),
+
+    .cutoffUpperCellVoltage_mV = (2400),
+
+    .limitLowerCellVoltage_mV = (1750),
+
+    .cutoffLowerCellVoltage_mV = (2000)};
+
+
+
+static float TEST_Minimum(float a, float b) {
+
+    return (a < b) ? a : b;
+
+}
+
+
+
+
+
+static TEST_FLOAT_LIMITS_s TEST_FloatVoltageBasedLimit(
+
+    int16_t minimumCellVoltage_mV,
+
+    int16_t maximumCellVoltage_mV,
+
+    const TEST_FLOAT_CONFIG_s *pConfig) {
+
+    TEST_FLOAT_LIMITS_s limits = {0};
+
+    const float slopeDischarge = (pConfig->maximumDischargeCurrent_mA - 0.0f) /
+
+                                 (pConfig->cutoffLowerCellVoltage_mV - pConfig->limitLowerCellVoltage_mV);
+
+    const float slopeCharge = (pConfig->maximumChargeCurrent_mA - 0.0f) /
+
+                              (pConfig->cutoffUpperCellVoltage_mV - pConfig->limitUpperCellVoltage_mV);
+
+
+
+    if (minimumCellVoltage_mV <= pConfig->limitLowerCellVoltage_mV) {
+
+        limits.discharge_mA = 0.0f;
+
+    } else if (minimumCellVoltage_mV <= pConfig->cutoffLowerCellVoltage_mV) {
+
+        limits.discharge_mA = slopeDischarge * (minimumCellVoltage_mV - pConfig->limitLowerCellVoltage_mV);
+
+    } else {
+
+        limits.discharge_mA = pConfig->maximumDischargeCurrent_mA;
+
+    }
+
+    if (maximumCellVoltage_mV >= pConfig->limitUpperCellVoltage_mV) {
+
+        limits.charge_mA = 0.0f;
+
+    } else if (maximumCellVoltage_mV >= pConfig->cutoffUpperCellVoltage_mV) {
+
+        limits.charge_mA = slopeCharge * (maximumCellVoltage_mV - pConfig->limitUpperCellVoltage_mV);
+
+    } else {
+
+        limits.charge_mA = pConfig->maximumChargeCurrent_mA;
+
+    }
+
+    return limits;
+
+}
+
+
+
+
+
+static TEST_FLOAT_LIMITS_s TEST_FloatTemperatureBasedLimit(
+
+    int16_t minimumCellTemperature_ddegC,
+
+    int16_t maximumCellTemperature_ddegC,
+
+    const TEST_FLOAT_CONFIG_s *pConfig) {
+
+    TEST_FLOAT_LIMITS_s limits = {0};
+
+    const float slopeLowDischarge =
+
+        (pConfig->maximumDischargeCurrent_mA - pConfig->limpHomeCurrent_mA) /
+
+        (pConfig->cutoffLowTemperatureDischarge_ddegC - pConfig->limitLowTemperatureDischarge_ddegC);
+
+    const float offsetLowDischarge =
+
+        pConfig->limpHomeCurrent_mA - (slopeLowDischarge * pConfig->limitLowTemperatureDischarge_ddegC);
+
+    const float slopeHighDischarge =
+
+        (0.0f - pConfig->maximumDischargeCurrent_mA) /
+
+        (pConfig->limitHighTemperatureDischarge_ddegC - pConfig->cutoffHighTemperatureDischarge_ddegC);
+
+    const float offsetHighDischarge = 0.0f - (slopeHighDischarge * pConfig->limitHighTemperatureDischarge_ddegC);
+
+    const float slopeLowCharge =
+
+        (pConfig->maximumChargeCurrent_mA - 0.0f) /
+
+        (pConfig->cutoffLowTemperatureCharge_ddegC - pConfig->limitLowTemperatureCharge_ddegC);
+
+    const float offsetLowCharge = 0.0f - (slopeLowCharge * pConfig->limitLowTemperatureCharge_ddegC);
+
+    const float slopeHighCharge =
+
+        (0.0f - pConfig->maximumChargeCurrent_mA) /
+
+        (pConfig->limitHighTemperatureCharge_ddegC - pConfig->cutoffHighTemperatureCharge_ddegC);
+
+    const float offsetHighCharge = 0.0f - (slopeHighCharge * pConfig->limitHighTemperatureCharge_ddegC);
+
+
+
+    if (minimumCellTemperature_ddegC <= pConfig->limitLowTemperatureDischarge_ddegC) {
+
+        limits.discharge_mA = pConfig->limpHomeCurrent_mA;
+
+    } else if (minimumCellTemperature_ddegC <= pConfig->cutoffLowTemperatureDischarge_ddegC) {
+
+        limits.discharge_mA = (slopeLowDischarge * minimumCellTemperature_ddegC) + offsetLowDischarge;
+
+    } else {
+
+        limits.discharge_mA = pConfig->maximumDischargeCurrent_mA;
+
+    }
+
+    if (minimumCellTemperature_ddegC <= pConfig->limitLowTemperatureCharge_ddegC) {
+
+        limits.charge_mA = 0.0f;
+
+    } else if (minimumCellTemperature_ddegC <= pConfig->cutoffLowTemperatureCharge_ddegC) {
+
+        limits.charge_mA = (slopeLowCharge * minimumCellTemperature_ddegC) + offsetLowCharge;
+
+    } else {
+
+        limits.charge_mA = pConfig->maximumChargeCurrent_mA;
+
+    }
+
+    if (maximumCellTemperature_ddegC >= pConfig->limitHighTemperatureDischarge_ddegC) {
+
+        limits.discharge_mA = 0.0f;
+
+    } else if (maximumCellTemperature_ddegC >= pConfig->cutoffHighTemperatureDischarge_ddegC) {
+
+        limits.discharge_mA = TEST_Minimum(
+
+            limits.discharge_mA, (slopeHighDischarge * maximumCellTemperature_ddegC) + offsetHighDischarge);
+
+    } else {
+
+        limits.discharge_mA = TEST_Minimum(limits.discharge_mA, pConfig->maximumDischargeCurrent_mA);
+
+    }
+
+    if (maximumCellTemperature_ddegC >= pConfig->limitHighTemperatureCharge_ddegC) {
+
+        limits.charge_mA = 0.0f;
+
+    } else if (maximumCellTemperature_ddegC >= pConfig->cutoffHighTemperatureCharge_ddegC) {
+
+        limits.charge_mA =
+
+            TEST_Minimum(limits.charge_mA, (slopeHighCharge * maximumCellTemperature_ddegC) + offsetHighCharge);
+
+    } else {
+
+        limits.charge_mA = TEST_Minimum(limits.charge_mA, pConfig->maximumChargeCurrent_mA);
+
+    }
+
+    return limits;
+
+}
+
+
+
+
+
+static void TEST_CompareWithFloatImplementation(const SOF_CONFIG_s *pConfig, const TEST_FLOAT_CONFIG_s *pFloatConfig) {
+
+    SOF_CURVE_s curves = {0};
+
+    TEST_SOF_CalculateCurves(pConfig, &curves);
+
+
+
+    for (int16_t minimumCellVoltage_mV = 1000; minimumCellVoltage_mV <= 3000; minimumCellVoltage_mV++) {
+
+        for (int16_t spread_mV = 0; spread_mV <= 200; spread_mV += 50) {
+
+            const int16_t maximumCellVoltage_mV = minimumCellVoltage_mV + spread_mV;
+
+            SOF_CURRENT_LIMITS_s limits = {0};
+
+            TEST_SOF_CalculateVoltageBasedCurrentLimit(minimumCellVoltage_mV, maximumCellVoltage_mV, &limits, &curves);
+
+            const TEST_FLOAT_LIMITS_s expected =
+
+                TEST_FloatVoltageBasedLimit(minimumCellVoltage_mV, maximumCellVoltage_mV, pFloatConfig);
+
+            UnityAssertFloatsWithin((UNITY_FLOAT)(((1.0f))), (UNITY_FLOAT)((expected.discharge_mA)), (UNITY_FLOAT)(((float)limits.continuousDischargeCurrent_mA)), (
+
+           ((void *)0)
+
+           ), (UNITY_UINT)(265))
+
+                                                                                                          ;
+
+            UnityAssertFloatsWithin((UNITY_FLOAT)(((1.0f))), (UNITY_FLOAT)((expected.charge_mA)), (UNITY_FLOAT)(((float)limits.continuousChargeCurrent_mA)), (
+
+           ((void *)0)
+
+           ), (UNITY_UINT)(267))
+
+                                                                                                    ;
+
+            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((limits.continuousDischargeCurrent_mA)), (UNITY_INT)(UNITY_INT32)((limits.peakDischargeCurrent_mA)), (
+
+           ((void *)0)
+
+           ), (UNITY_UINT)(269), UNITY_DISPLAY_STYLE_INT32);
+
+            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((limits.continuousChargeCurrent_mA)), (UNITY_INT)(UNITY_INT32)((limits.peakChargeCurrent_mA)), (
+
+           ((void *)0)
+
+           ), (UNITY_UINT)(270), UNITY_DISPLAY_STYLE_INT32);
+
+        }
+
+    }
+
+
+
+    for (int16_t minimumTemperature_ddegC = -400; minimumTemperature_ddegC <= 800; minimumTemperature_ddegC++) {
+
+        for (int16_t spread_ddegC = 0; spread_ddegC <= 300; spread_ddegC += 25) {
+
+            const int16_t maximumTemperature_ddegC = minimumTemperature_ddegC + spread_ddegC;
+
+            SOF_CURRENT_LIMITS_s limits = {0};
+
+            TEST_SOF_CalculateTemperatureBasedCurrentLimit(
+
+                minimumTemperature_ddegC, maximumTemperature_ddegC, &limits, &curves);
+
+            const TEST_FLOAT_LIMITS_s expected =
+
+                TEST_FloatTemperatureBasedLimit(minimumTemperature_ddegC, maximumTemperature_ddegC, pFloatConfig);
+
+            UnityAssertFloatsWithin((UNITY_FLOAT)(((1.0f))), (UNITY_FLOAT)((expected.discharge_mA)), (UNITY_FLOAT)(((float)limits.continuousDischargeCurrent_mA)), (
+
+           ((void *)0)
+
+           ), (UNITY_UINT)(282))
+
+                                                                                                          ;
+
+            UnityAssertFloatsWithin((UNITY_FLOAT)(((1.0f))), (UNITY_FLOAT)((expected.charge_mA)), (UNITY_FLOAT)(((float)limits.continuousChargeCurrent_mA)), (
+
+           ((void *)0)
+
+           ), (UNITY_UINT)(284))
+
+                                                                                                    ;
+
+            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((limits.continuousDischargeCurrent_mA)), (UNITY_INT)(UNITY_INT32)((limits.peakDischargeCurrent_mA)), (
+
+           ((void *)0)
+
+           ), (UNITY_UINT)(286), UNITY_DISPLAY_STYLE_INT32);
+
+            UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((limits.continuousChargeCurrent_mA)), (UNITY_INT)(UNITY_INT32)((limits.peakChargeCurrent_mA)), (
+
+           ((void *)0)
+
+           ), (UNITY_UINT)(287), UNITY_DISPLAY_STYLE_INT32);
+
+        }
+
+    }
+
+}
+
+
+
+
+
+void setUp(void) {
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+void testFixedPointDeratingMatchesFloatImplementation(void) {
+
+    TEST_CompareWithFloatImplementation(&sof_recommendedCurrent, &test_floatRecommendedCurrent);
+
+    TEST_CompareWithFloatImplementation(&sof_maximumOperatingLimit, &test_floatMaximumOperatingLimit);
+
+    TEST_CompareWithFloatImplementation(&sof_recommendedSafetyLimit, &test_floatRecommendedSafetyLimit);
+
+    TEST_CompareWithFloatImplementation(&sof_configMaximumSafetyLimit, &test_floatMaximumSafetyLimit);
+
+}
+
+
+
+void testEvaluateCurveWithMultipleSegments(void) {
+
+    const SOF_CONFIG_s config = {
+
+        .dischargeCurrentOverCellVoltage =
+
+            {.nrOfBreakpoints = 5u,
+
+             .breakpoints = {{2500, 0}, {2700, 10000}, {3000, 100000}, {4000, 100000}, {4200, 50000}}},
+
+        .chargeCurrentOverCellVoltage = {.nrOfBreakpoints = 1u, .breakpoints = {{3000, 20000}}},
+
+        .dischargeCurrentOverTemperature = {.nrOfBreakpoints = 2u, .breakpoints = {{-200, 1000}, {0, 101000}}},
+
+        .chargeCurrentOverTemperature = {.nrOfBreakpoints = 2u, .breakpoints = {{400, 3}, {403, 0}}},
+
+    };
+
+    SOF_CURVE_s curves = {0};
+
+    TEST_SOF_CalculateCurves(&config, &curves);
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 
+
+   (-32767-1)
+
+   ))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(320), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 2500))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(321), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((50000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 4200))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(322), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((50000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 
+
+   (32767)
+
+   ))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(323), UNITY_DISPLAY_STYLE_INT32);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((10000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 2700))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(325), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((100000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 3000))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(326), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((100000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 4000))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(327), UNITY_DISPLAY_STYLE_INT32);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((5000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 2600))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(329), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((55000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 2850))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(330), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((100000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 3500))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(331), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((75000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 4100))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(332), UNITY_DISPLAY_STYLE_INT32);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((20000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverCellVoltage, 0))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(334), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((20000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverCellVoltage, 4000))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(335), UNITY_DISPLAY_STYLE_INT32);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((51000)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverTemperature, -100))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(337), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((2)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverTemperature, 401))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(338), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((1)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverTemperature, 402))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(339), UNITY_DISPLAY_STYLE_INT32);
+
+}
+
+
+
+void testRangeIncludesBreakpointsBetweenMinimumAndMaximum(void) {
+
+
+
+    const SOF_CONFIG_s config = {
+
+        .dischargeCurrentOverCellVoltage =
+
+            {.nrOfBreakpoints = 3u, .breakpoints = {{3000, 100000}, {3500, 10000}, {4000, 100000}}},
+
+        .chargeCurrentOverCellVoltage = {.nrOfBreakpoints = 2u, .breakpoints = {{3000, 20000}, {4000, 40000}}},
+
+        .dischargeCurrentOverTemperature = {.nrOfBreakpoints = 1u, .breakpoints = {{0, 100000}}},
+
+        .chargeCurrentOverTemperature = {.nrOfBreakpoints = 1u, .breakpoints = {{0, 100000}}},
+
+    };
+
+    SOF_CURVE_s curves = {0};
+
+    TEST_SOF_CalculateCurves(&config, &curves);
+
+
+
+    SOF_CURRENT_LIMITS_s limits = {0};
+
+    TEST_SOF_CalculateVoltageBasedCurrentLimit(3000, 4000, &limits, &curves);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((10000)), (UNITY_INT)(UNITY_INT32)((limits.continuousDischargeCurrent_mA)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(356), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((20000)), (UNITY_INT)(UNITY_INT32)((limits.continuousChargeCurrent_mA)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(357), UNITY_DISPLAY_STYLE_INT32);
+
+
+
+    TEST_SOF_CalculateVoltageBasedCurrentLimit(3250, 3500, &limits, &curves);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((10000)), (UNITY_INT)(UNITY_INT32)((limits.continuousDischargeCurrent_mA)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(360), UNITY_DISPLAY_STYLE_INT32);
+
+
+
+    TEST_SOF_CalculateVoltageBasedCurrentLimit(3600, 3900, &limits, &curves);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((28000)), (UNITY_INT)(UNITY_INT32)((limits.continuousDischargeCurrent_mA)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(363), UNITY_DISPLAY_STYLE_INT32);
+
+}
+
+
+
+void testEvaluateCurveBeforeInitialization(void) {
+
+
+
+    const SOF_CURVE_s curves = {0};
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 3700))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(369), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0)), (UNITY_INT)(UNITY_INT32)((TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverTemperature, 
+
+   (-32767-1)
+
+   ))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(370), UNITY_DISPLAY_STYLE_INT32);
+
+}
+
+
+
+void testCalculateCurvesRejectsInvalidCurves(void) {
+
+    SOF_CURVE_s curves = {0};
+
+    SOF_CONFIG_s config = sof_recommendedCurrent;
+
+
+
+    config.chargeCurrentOverTemperature.nrOfBreakpoints = 0u;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_SOF_CalculateCurves(&config, &curves); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(378)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+
+
+    config = sof_recommendedCurrent;
+
+    config.chargeCurrentOverTemperature.nrOfBreakpoints = (8u) + 1u;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_SOF_CalculateCurves(&config, &curves); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(382)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+
+
+
+
+    config = sof_recommendedCurrent;
+
+    config.chargeCurrentOverTemperature.breakpoints[2].input = config.chargeCurrentOverTemperature.breakpoints[1].input;
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_SOF_CalculateCurves(&config, &curves); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(387)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testMinimumOfTwoSofValues(void) {
+
+    const SOF_CURRENT_LIMITS_s voltageBasedLimits = {100, 200, 300, 400};
+
+    const SOF_CURRENT_LIMITS_s temperatureBasedLimits = {400, 100, 300, -5};
+
+    const SOF_CURRENT_LIMITS_s minimum = TEST_SOF_MinimumOfTwoSofValues(voltageBasedLimits, temperatureBasedLimits);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((100)), (UNITY_INT)(UNITY_INT32)((minimum.continuousChargeCurrent_mA)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(394), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((100)), (UNITY_INT)(UNITY_INT32)((minimum.peakChargeCurrent_mA)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(395), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((300)), (UNITY_INT)(UNITY_INT32)((minimum.continuousDischargeCurrent_mA)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(396), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((-5)), (UNITY_INT)(UNITY_INT32)((minimum.peakDischargeCurrent_mA)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(397), UNITY_DISPLAY_STYLE_INT32);
+
+}
+
+
+
+void testUpdateStringInputsDetectsChangedInputs(void) {
+
+    DATA_BLOCK_MIN_MAX_s minimumMaximumValues = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+
+    minimumMaximumValues.minimumCellVoltage_mV[0u] = 3000;
+
+    minimumMaximumValues.maximumCellVoltage_mV[0u] = 3100;
+
+    minimumMaximumValues.minimumTemperature_ddegC[0u] = 200;
+
+    minimumMaximumValues.maximumTemperature_ddegC[0u] = 250;
+
+
+
+
+
+    SOF_Init();
+
+    do {if ((TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(409)));}} while(0);
+
+    do {if (!(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(410)));}} while(0);
+
+
+
+
+
+    minimumMaximumValues.minimumCellVoltage_mV[1u] = 2000;
+
+    do {if (!(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(414)));}} while(0);
+
+
+
+    minimumMaximumValues.minimumCellVoltage_mV[0u] = 2999;
+
+    do {if ((TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(417)));}} while(0);
+
+    minimumMaximumValues.maximumCellVoltage_mV[0u] = 3101;
+
+    do {if ((TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(419)));}} while(0);
+
+    minimumMaximumValues.minimumTemperature_ddegC[0u] = 199;
+
+    do {if ((TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(421)));}} while(0);
+
+    minimumMaximumValues.maximumTemperature_ddegC[0u] = 251;
+
+    do {if ((TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(423)));}} while(0);
+
+    do {if (!(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues))) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(424)));}} while(0);
+
+
+
+
+
+    SOF_Init();
+
+    do {if ((TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues))) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(428)));}} while(0);
+
+
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { TEST_SOF_UpdateStringInputs((3u), &minimumMaximumValues); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(430)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
@@ -0,0 +1,598 @@
+#include "../../tests/unit/support/test_assert_helper.h"
+#include "../../src/app/application/algorithm/state_estimation/sox_counter.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+static uint32_t test_randomState = 0u;
+
+
+
+
+
+static uint32_t TEST_GetRandom(void) {
+
+    test_randomState = (test_randomState * 1664525u) + 1013904223u;
+
+    return test_randomState >> 16u;
+
+}
+
+
+
+
+
+void setUp(void) {
+
+    test_randomState = 0x12345678u;
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+void testSOX_InvalidInput(void) {
+
+    SOX_COUNTER_s counter = {0};
+
+    SOX_REFERENCE_s reference = {0};
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { SOX_InitializeCounter(((void *)(0)), 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(92)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { SOX_AddSample(((void *)(0)), 0, 0, 0u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(93)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { SOX_SetReference(((void *)(0)), 1, 0, 0.0f, 0.0f, 0.0f); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(94)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { SOX_SetReference(&reference, 0, 0, 0.0f, 0.0f, 0.0f); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(95)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { SOX_GetPercentages(&reference, 0, ((void *)(0)), ((void *)(0)), ((void *)(0))); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(96)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+    SOX_InitializeCounter(&counter, 0u);
+
+}
+
+
+
+void testSOX_AddSampleCarriesRemainder(void) {
+
+    SOX_COUNTER_s counter = {0};
+
+    SOX_InitializeCounter(&counter, 0u);
+
+
+
+
+
+    for (uint32_t timestamp_ms = 1u; timestamp_ms <= 1000u; timestamp_ms++) {
+
+        SOX_AddSample(&counter, 1, 1, timestamp_ms);
+
+    }
+
+    UnityAssertEqualNumber((UNITY_INT)((1)), (UNITY_INT)((counter.dischargedCharge_mAs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(108), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0)), (UNITY_INT)(UNITY_INT32)((counter.chargeRemainder_uAs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(109), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((counter.dischargedEnergy_mWs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(110), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((1000)), (UNITY_INT)(UNITY_INT32)((counter.energyRemainder_nWs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(111), UNITY_DISPLAY_STYLE_INT32);
+
+
+
+
+
+    for (uint32_t timestamp_ms = 1001u; timestamp_ms <= 2000u; timestamp_ms++) {
+
+        SOX_AddSample(&counter, -1, 1, timestamp_ms);
+
+    }
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((counter.dischargedCharge_mAs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(117), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0)), (UNITY_INT)(UNITY_INT32)((counter.chargeRemainder_uAs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(118), UNITY_DISPLAY_STYLE_INT32);
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((counter.dischargedEnergy_mWs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(119), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_INT32)((0)), (UNITY_INT)(UNITY_INT32)((counter.energyRemainder_nWs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(120), UNITY_DISPLAY_STYLE_INT32);
+
+}
+
+
+
+void testSOX_AddSampleTimestamps(void) {
+
+    SOX_COUNTER_s counter = {0};
+
+    SOX_InitializeCounter(&counter, 
+
+                                   (4294967295U) 
+
+                                              - 49u);
+
+
+
+
+
+    SOX_AddSample(&counter, 1000, 400000, 
+
+                                         (4294967295U) 
+
+                                                    - 49u);
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((counter.dischargedCharge_mAs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(129), UNITY_DISPLAY_STYLE_INT64);
+
+
+
+
+
+    SOX_AddSample(&counter, 1000, 400000, 50u);
+
+    UnityAssertEqualNumber((UNITY_INT)((100)), (UNITY_INT)((counter.dischargedCharge_mAs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(133), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)((40000)), (UNITY_INT)((counter.dischargedEnergy_mWs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(134), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT32)((50u)), (UNITY_INT)(UNITY_UINT32)((counter.previousTimestamp_ms)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(135), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void testSOX_ReferenceAndPercentages(void) {
+
+    SOX_REFERENCE_s reference = {0};
+
+    float minimum_perc = 0.0f;
+
+    float average_perc = 0.0f;
+
+    float maximum_perc = 0.0f;
+
+
+
+    SOX_SetReference(&reference, 1000, 500, 40.0f, 50.0f, 120.0f);
+
+    UnityAssertEqualNumber((UNITY_INT)((400)), (UNITY_INT)((reference.minimum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(145), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)((500)), (UNITY_INT)((reference.average)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(146), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)((1000)), (UNITY_INT)((reference.maximum)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(147), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)((500)), (UNITY_INT)((reference.counterAtReference)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(148), UNITY_DISPLAY_STYLE_INT64);
+
+
+
+
+
+    SOX_GetPercentages(&reference, 600, &minimum_perc, &average_perc, &maximum_perc);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((30.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((30.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((minimum_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(152)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((40.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((40.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((average_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(153)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((90.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((90.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((maximum_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(154)));
+
+
+
+
+
+    SOX_GetPercentages(&reference, 1000, &minimum_perc, ((void *)(0)), ((void *)(0)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((0.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((0.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((minimum_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(158)));
+
+    SOX_GetPercentages(&reference, -1000, ((void *)(0)), ((void *)(0)), &maximum_perc);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((100.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((100.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((maximum_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(160)));
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((SOX_GetRemaining(&reference, &reference.minimum, 1000))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(161), UNITY_DISPLAY_STYLE_INT64);
+
+    UnityAssertEqualNumber((UNITY_INT)((1000)), (UNITY_INT)((SOX_GetRemaining(&reference, &reference.maximum, -1000))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(162), UNITY_DISPLAY_STYLE_INT64);
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { SOX_GetRemaining(&reference, ((void *)(0)), 0); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(163)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+
+
+
+
+void testSOX_LimitsReanchorReference(void) {
+
+    SOX_REFERENCE_s reference = {0};
+
+    float average_perc = 0.0f;
+
+
+
+    SOX_SetReference(&reference, 1000, 0, 50.0f, 50.0f, 50.0f);
+
+
+
+
+
+    SOX_GetPercentages(&reference, 700, ((void *)(0)), &average_perc, ((void *)(0)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((0.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((0.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((average_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(176)));
+
+    SOX_GetPercentages(&reference, 600, ((void *)(0)), &average_perc, ((void *)(0)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((10.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((10.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((average_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(178)));
+
+
+
+
+
+    SOX_GetPercentages(&reference, -600, ((void *)(0)), &average_perc, ((void *)(0)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((100.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((100.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((average_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(182)));
+
+    SOX_GetPercentages(&reference, -500, ((void *)(0)), &average_perc, ((void *)(0)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((90.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((90.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((average_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(184)));
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((0)), (UNITY_INT)((reference.counterAtReference)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(187), UNITY_DISPLAY_STYLE_INT64);
+
+    SOX_GetPercentages(&reference, 0, ((void *)(0)), &average_perc, ((void *)(0)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((40.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((40.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((average_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(189)));
+
+
+
+
+
+    SOX_SetReference(&reference, 1000, 0, 10.0f, 50.0f, 90.0f);
+
+    float minimum_perc = 0.0f;
+
+    float maximum_perc = 0.0f;
+
+    SOX_GetPercentages(&reference, 200, &minimum_perc, &average_perc, &maximum_perc);
+
+    SOX_GetPercentages(&reference, 100, &minimum_perc, &average_perc, &maximum_perc);
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((10.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((10.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((minimum_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(197)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((40.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((40.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((average_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(198)));
+
+    UnityAssertFloatsWithin((UNITY_FLOAT)((UNITY_FLOAT)((80.0f)) * (UNITY_FLOAT)(0.00001f)), (UNITY_FLOAT)((UNITY_FLOAT)((80.0f))), (UNITY_FLOAT)((UNITY_FLOAT)((maximum_perc))), ((
+
+   ((void *)0)
+
+   )), (UNITY_UINT)((UNITY_UINT)(199)));
+
+}
+
+
+
+
+
+
+
+
+
+
+
+
+
+void testSOX_ReplayOneWeekDrift(void) {
+
+    SOX_COUNTER_s counter = {0};
+
+    SOX_REFERENCE_s reference = {0};
+
+    int64_t exact_uAs = 0;
+
+    float floatSoc_perc = 50.0f;
+
+    int32_t current_mA = 0;
+
+    uint32_t timestamp_ms = 0u;
+
+
+
+    SOX_InitializeCounter(&counter, timestamp_ms);
+
+    SOX_SetReference(&reference, ((int64_t)100 * 3600 * 1000), 0, 50.0f, 50.0f, 50.0f);
+
+
+
+    while (timestamp_ms < (7u * 24u * 3600u * 1000u)) {
+
+
+
+        const uint32_t timestep_ms = 95u + (TEST_GetRandom() % 11u);
+
+        timestamp_ms += timestep_ms;
+
+
+
+        current_mA += (int32_t)(TEST_GetRandom() % 2001u) - 1000;
+
+        if (current_mA > 100000) {
+
+            current_mA = 100000;
+
+        }
+
+        if (current_mA < -100000) {
+
+            current_mA = -100000;
+
+        }
+
+
+
+        if ((exact_uAs > (((int64_t)100 * 3600 * 1000) * 100)) && (current_mA > 0)) {
+
+            current_mA = -current_mA;
+
+        }
+
+        if ((exact_uAs < -(((int64_t)100 * 3600 * 1000) * 100)) && (current_mA < 0)) {
+
+            current_mA = -current_mA;
+
+        }
+
+
+
+        exact_uAs += (int64_t)current_mA * (int64_t)timestep_ms;
+
+        SOX_AddSample(&counter, current_mA, 400000, timestamp_ms);
+
+
+
+        const float timestep_s = (float)timestep_ms / 1000.0f;
+
+        const float deltaSoc_perc = ((((float)current_mA / 1000.0f) * timestep_s) /
+
+                                     ((float)((int64_t)100 * 3600 * 1000) / 1000.0f)) *
+
+                                    100.0f;
+
+        floatSoc_perc -= deltaSoc_perc;
+
+    }
+
+
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((exact_uAs)), (UNITY_INT)(((counter.dischargedCharge_mAs * 1000) + counter.chargeRemainder_uAs)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(249), UNITY_DISPLAY_STYLE_INT64);
+
+    do {if ((abs(counter.chargeRemainder_uAs) < 1000)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(250)));}} while(0);
+
+
+
+    float fixedSoc_perc = 0.0f;
+
+    SOX_GetPercentages(&reference, counter.dischargedCharge_mAs, ((void *)(0)), &fixedSoc_perc, ((void *)(0)));
+
+    const double exactSoc_perc = 50.0 - ((100.0 * (double)exact_uAs) / ((double)((int64_t)100 * 3600 * 1000) * 1000.0));
+
+    const double fixedDrift_perc = fabs((double)fixedSoc_perc - exactSoc_perc);
+
+    const double floatDrift_perc = fabs((double)floatSoc_perc - exactSoc_perc);
+
+
+
+    char message[100] = {0};
+
+    (void)snprintf(
+
+        message,
+
+        sizeof(message),
+
+        "drift after one week: fixed %.6f %%, float %.6f %%",
+
+        fixedDrift_perc,
+
+        floatDrift_perc);
+
+    UnityMessage((message), 265);
+
+
+
+
+
+    do {if ((fixedDrift_perc < 0.0001)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(268)));}} while(0);
+
+    do {if ((fixedDrift_perc < floatDrift_perc)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(269)));}} while(0);
+
+}
@@ -0,0 +1,448 @@
+#include "../../src/app/driver/spi/spi.c"
+#include "../../tests/unit/support/test_assert_helper.h"
+#include "../../src/app/driver/spi/spi.h"
+#include "../../src/app/driver/config/spi_cfg.h"
+#include "../../src/app/driver/config/dma_cfg.h"
+#include "test/mocks/Mockos.h"
+#include "test/mocks/Mockmcu.h"
+#include "test/mocks/Mockio.h"
+#include "test/mocks/MockHL_sys_dma.h"
+#include "test/mocks/MockHL_spi.h"
+#include "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+long FSYS_RaisePrivilege(void) {
+
+    return 0;
+
+}
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+static spiBASE_t testSpiNode = {0};
+
+static volatile uint32_t testGioPort = 0u;
+
+static const spiDAT1_t testSpiConfig = {0};
+
+static SPI_ACTIVITY_s testSpiActivity = {0};
+
+static uint16_t testTxBuffer[4] = {0};
+
+
+
+
+
+static SPI_INTERFACE_CONFIG_s testSpiInterface = {
+
+    .channel = SPI_Interface1,
+
+    .pConfig = &testSpiConfig,
+
+    .pNode = &testSpiNode,
+
+    .pGioPort = &testGioPort,
+
+    .csPin = 2u,
+
+    .pActivity = &testSpiActivity,
+
+};
+
+
+
+
+
+static void TEST_ExpectTransfer(uint32_t frameLength, uint32_t tick, uint32_t count) {
+
+    MCU_GetFreeRunningCount_CMockExpectAndReturn(100, count);
+
+    OS_GetTickCount_CMockExpectAndReturn(101, tick);
+
+    spiTransmitData_CMockExpectAndReturn(102, &testSpiNode, (spiDAT1_t *)&testSpiConfig, frameLength, ((void *)(0)), 0u);
+
+    spiTransmitData_CMockIgnoreArg_srcbuff(103);
+
+}
+
+
+
+
+
+void setUp(void) {
+
+    testSpiActivity.isValid = 
+
+                                   0
+
+                                        ;
+
+    testSpiActivity.lastCount = 0u;
+
+    testSpiActivity.lastTick = 0u;
+
+    testSpiActivity.elidedWakeUps = 0u;
+
+    testSpiInterface.pActivity = &testSpiActivity;
+
+    OS_EnterTaskCritical_CMockIgnore();
+
+    OS_ExitTaskCritical_CMockIgnore();
+
+    IO_PinSet_CMockIgnore();
+
+    IO_PinReset_CMockIgnore();
+
+}
+
+
+
+void tearDown(void) {
+
+}
+
+
+
+
+
+
+
+void testDummyFunction() {
+
+}
+
+
+
+void testTransmitDataWithDummyWakesUpInactiveInterface(void) {
+
+
+
+    TEST_ExpectTransfer(1u, 10u, 1000u);
+
+    MCU_delay_us_CMockExpect(130, (30u));
+
+    TEST_ExpectTransfer(4u, 10u, 2000u);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((SPI_TransmitDataWithDummy( &testSpiInterface, (30u), (3300u), testTxBuffer, 4u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(133), UNITY_DISPLAY_STYLE_INT)
+
+
+
+
+
+                                                                                                  ;
+
+    do {if ((testSpiActivity.isValid)) {} else {UnityFail( ((" Expected TRUE Was FALSE")), (UNITY_UINT)((UNITY_UINT)(137)));}} while(0);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT32)((2000u)), (UNITY_INT)(UNITY_UINT32)((testSpiActivity.lastCount)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(138), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT32)((0u)), (UNITY_INT)(UNITY_UINT32)((testSpiActivity.elidedWakeUps)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(139), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void testTransmitDataWithDummySkipsWakeUpWithinValidity(void) {
+
+    testSpiActivity.isValid = 
+
+                               1
+
+                                   ;
+
+    testSpiActivity.lastCount = 2000u;
+
+    testSpiActivity.lastTick = 10u;
+
+
+
+
+
+    OS_GetTickCount_CMockExpectAndReturn(148, 12u);
+
+    MCU_GetFreeRunningCount_CMockExpectAndReturn(149, 90000u);
+
+    MCU_ConvertFrcDifferenceToTimespan_us_CMockExpectAndReturn(150, 88000u, (3300u) - 1u);
+
+    TEST_ExpectTransfer(4u, 12u, 90000u);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((SPI_TransmitDataWithDummy( &testSpiInterface, (30u), (3300u), testTxBuffer, 4u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(153), UNITY_DISPLAY_STYLE_INT)
+
+
+
+
+
+                                                                                                  ;
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT32)((1u)), (UNITY_INT)(UNITY_UINT32)((testSpiActivity.elidedWakeUps)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(157), UNITY_DISPLAY_STYLE_UINT32);
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT32)((90000u)), (UNITY_INT)(UNITY_UINT32)((testSpiActivity.lastCount)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(158), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void testTransmitDataWithDummyWakesUpAfterValidity(void) {
+
+    testSpiActivity.isValid = 
+
+                               1
+
+                                   ;
+
+    testSpiActivity.lastCount = 2000u;
+
+    testSpiActivity.lastTick = 10u;
+
+
+
+
+
+    OS_GetTickCount_CMockExpectAndReturn(167, 14u);
+
+    MCU_GetFreeRunningCount_CMockExpectAndReturn(168, 200000u);
+
+    MCU_ConvertFrcDifferenceToTimespan_us_CMockExpectAndReturn(169, 198000u, (3300u));
+
+    TEST_ExpectTransfer(1u, 14u, 200000u);
+
+    MCU_delay_us_CMockExpect(171, (30u));
+
+    TEST_ExpectTransfer(4u, 14u, 201000u);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((SPI_TransmitDataWithDummy( &testSpiInterface, (30u), (3300u), testTxBuffer, 4u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(174), UNITY_DISPLAY_STYLE_INT)
+
+
+
+
+
+                                                                                                  ;
+
+    UnityAssertEqualNumber((UNITY_INT)(UNITY_UINT32)((0u)), (UNITY_INT)(UNITY_UINT32)((testSpiActivity.elidedWakeUps)), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(178), UNITY_DISPLAY_STYLE_UINT32);
+
+}
+
+
+
+void testTransmitDataWithDummyWakesUpAfterCounterWrapAround(void) {
+
+    testSpiActivity.isValid = 
+
+                               1
+
+                                   ;
+
+    testSpiActivity.lastCount = 2000u;
+
+    testSpiActivity.lastTick = 10u;
+
+
+
+
+
+    OS_GetTickCount_CMockExpectAndReturn(187, 200000u);
+
+    TEST_ExpectTransfer(1u, 200000u, 3000u);
+
+    MCU_delay_us_CMockExpect(189, (30u));
+
+    TEST_ExpectTransfer(4u, 200000u, 4000u);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((SPI_TransmitDataWithDummy( &testSpiInterface, (30u), (3300u), testTxBuffer, 4u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(192), UNITY_DISPLAY_STYLE_INT)
+
+
+
+
+
+                                                                                                  ;
+
+}
+
+
+
+void testTransmitDataWithDummyAlwaysWakesUpUntrackedInterface(void) {
+
+    testSpiInterface.pActivity = ((void *)(0));
+
+
+
+    spiTransmitData_CMockExpectAndReturn(201, &testSpiNode, (spiDAT1_t *)&testSpiConfig, 1u, ((void *)(0)), 0u);
+
+    spiTransmitData_CMockIgnoreArg_srcbuff(202);
+
+    MCU_delay_us_CMockExpect(203, (30u));
+
+    spiTransmitData_CMockExpectAndReturn(204, &testSpiNode, (spiDAT1_t *)&testSpiConfig, 4u, ((void *)(0)), 0u);
+
+    spiTransmitData_CMockIgnoreArg_srcbuff(205);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((SPI_TransmitDataWithDummy( &testSpiInterface, (30u), (3300u), testTxBuffer, 4u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(207), UNITY_DISPLAY_STYLE_INT)
+
+
+
+
+
+                                                                                                  ;
+
+}
+
+
+
+void testTransmitReceiveDataDmaFromIsrDoesNotStartDuringOngoingDmaTransfer(void) {
+
+    uint16_t rxBuffer[4] = {0};
+
+    testSpiNode.INT0 = (0x10000U);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((SPI_TransmitReceiveDataDmaFromIsr(&testSpiInterface, testTxBuffer, rxBuffer, 4u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(217), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((SPI_IDLE)), (UNITY_INT)((*(spi_busyFlags + testSpiInterface.channel))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(218), UNITY_DISPLAY_STYLE_INT);
+
+    do {if (!(testSpiActivity.isValid)) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(219)));}} while(0);
+
+
+
+    testSpiNode.INT0 = 0u;
+
+}
+
+
+
+void testTransmitReceiveDataDmaLockedRequiresLockedInterface(void) {
+
+    uint16_t rxBuffer[4] = {0};
+
+
+
+    { unsigned int e; { jmp_buf *PrevFrame, NewFrame; unsigned int MY_ID = (0); PrevFrame = CExceptionFrames[MY_ID].pFrame; CExceptionFrames[MY_ID].pFrame = (jmp_buf*)(&NewFrame); CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; if (
+
+   _setjmp (
+
+   NewFrame
+
+   ) 
+
+   == 0) { if (1) { SPI_TransmitReceiveDataDmaLocked(&testSpiInterface, testTxBuffer, rxBuffer, 4u); UnityFail( (("Code under test did not assert")), (UNITY_UINT)(227)); } else { } CExceptionFrames[MY_ID].Exception = (0x5A5A5A5A); ; } else { e = CExceptionFrames[MY_ID].Exception; (void)e; ; } CExceptionFrames[MY_ID].pFrame = PrevFrame; ; } if (CExceptionFrames[(0)].Exception != (0x5A5A5A5A)) {} };
+
+}
+
+
+
+void testTransmitReceiveDataDmaLockedKeepsLockDuringOngoingDmaTransfer(void) {
+
+    uint16_t rxBuffer[4] = {0};
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_OK)), (UNITY_INT)((SPI_Lock(testSpiInterface.channel))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(232), UNITY_DISPLAY_STYLE_INT);
+
+    testSpiNode.INT0 = (0x10000U);
+
+
+
+    UnityAssertEqualNumber((UNITY_INT)((STD_NOT_OK)), (UNITY_INT)((SPI_TransmitReceiveDataDmaLocked(&testSpiInterface, testTxBuffer, rxBuffer, 4u))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(235), UNITY_DISPLAY_STYLE_INT);
+
+    UnityAssertEqualNumber((UNITY_INT)((SPI_BUSY)), (UNITY_INT)((*(spi_busyFlags + testSpiInterface.channel))), (
+
+   ((void *)0)
+
+   ), (UNITY_UINT)(236), UNITY_DISPLAY_STYLE_INT);
+
+    do {if (!(testSpiActivity.isValid)) {} else {UnityFail( ((" Expected FALSE Was TRUE")), (UNITY_UINT)((UNITY_UINT)(237)));}} while(0);
+
+
+
+    testSpiNode.INT0 = 0u;
+
+    SPI_Unlock(testSpiInterface.channel);
+
+}
@@ -0,0 +1,34 @@
+#include "../../src/app/main/include/general.h"
+extern int16_t TSI_GetTemperature(uint16_t adcVoltage_mV);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern int16_t TSI_GetMaximumPlausibleTemperature(void);
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+extern int16_t TSI_GetMinimumPlausibleTemperature(void);
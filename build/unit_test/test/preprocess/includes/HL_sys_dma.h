@@ -0,0 +1,2 @@
+---
+- include/HL_sys_common.h
@@ -0,0 +1,2 @@
+---
+- "../../src/app/application/algorithm/config/algorithm_cfg.h"
@@ -0,0 +1,3 @@
+---
+- "../../src/app/application/config/bal_cfg.h"
+- "../../src/app/engine/database/database.h"
@@ -0,0 +1,4 @@
+---
+- "../../src/app/application/config/battery_system_cfg.h"
+- "../../src/app/application/config/bms_cfg.h"
+- "../../src/app/engine/database/database.h"
@@ -0,0 +1,2 @@
+---
+- "../../src/app/main/include/general.h"
@@ -0,0 +1,3 @@
+---
+- "../../src/app/main/include/general.h"
+- "../../src/app/engine/database/database.h"
@@ -0,0 +1,2 @@
+---
+- "../../src/app/driver/config/contactor_cfg.h"
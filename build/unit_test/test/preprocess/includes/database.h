@@ -0,0 +1,6 @@
+---
+- "../../src/app/engine/config/database_cfg.h"
+- "../../src/os/freertos/include/FreeRTOS.h"
+- "../../src/os/freertos/include/queue.h"
+- "../../src/os/freertos/include/task.h"
+- "../../src/app/task/os/os.h"
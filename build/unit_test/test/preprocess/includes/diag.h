@@ -0,0 +1,2 @@
+---
+- "../../src/app/engine/config/diag_cfg.h"
@@ -0,0 +1,4 @@
+---
+- "../../src/app/main/include/general.h"
+- "../../src/app/application/config/battery_system_cfg.h"
+- "../../src/app/engine/config/database_cfg.h"
@@ -0,0 +1,2 @@
+---
+- "../../src/app/driver/config/dma_cfg.h"
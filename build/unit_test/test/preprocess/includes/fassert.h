@@ -0,0 +1,2 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/c_exception/lib/CException.h"
@@ -0,0 +1,2 @@
+---
+- "../../src/app/driver/config/fram_cfg.h"
@@ -0,0 +1,4 @@
+---
+- "../../src/app/main/include/general.h"
+- "../../src/app/driver/config/can_cfg.h"
+- "../../src/app/task/os/os.h"
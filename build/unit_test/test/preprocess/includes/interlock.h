@@ -0,0 +1,2 @@
+---
+- "../../src/app/driver/config/interlock_cfg.h"
@@ -0,0 +1,4 @@
+---
+- "../../src/app/driver/mic/api/mic_dma.h"
+- "../../src/app/driver/config/dma_cfg.h"
+- "../../src/app/driver/mic/ltc/common/ltc_defs.h"
@@ -0,0 +1,6 @@
+---
+- "../../src/app/main/include/general.h"
+- "../../src/os/freertos/include/FreeRTOS.h"
+- "../../src/os/freertos/include/event_groups.h"
+- "../../src/os/freertos/include/semphr.h"
+- "../../src/os/freertos/include/task.h"
@@ -0,0 +1,4 @@
+---
+- "../../src/app/main/include/general.h"
+- "../../src/app/task/config/ftask_cfg.h"
+- "../../src/app/driver/sbc/nxpfs85xx.h"
@@ -0,0 +1,3 @@
+---
+- "../../src/app/application/algorithm/state_estimation/sof/trapezoid/sof_cfg.h"
+- "../../src/app/engine/config/database_cfg.h"
@@ -0,0 +1,2 @@
+---
+- "../../src/app/driver/config/spi_cfg.h"
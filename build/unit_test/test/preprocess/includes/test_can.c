@@ -0,0 +1,13 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- MockHL_can.h
+- Mockcan_cfg.h
+- test/mocks/Mockdatabase.h
+- test/mocks/Mockdiag.h
+- Mockfoxmath.h
+- test/mocks/Mockio.h
+- test/mocks/Mockmcu.h
+- test/mocks/Mockos.h
+- "../../src/app/driver/can/can.h"
+- "../../tests/unit/support/test_assert_helper.h"
+- "../../src/app/driver/can/can.c"
@@ -0,0 +1,4 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- "../../src/app/driver/foxmath/cell_statistics.h"
+- "../../tests/unit/support/test_assert_helper.h"
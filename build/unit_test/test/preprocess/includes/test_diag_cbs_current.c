@@ -0,0 +1,6 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- Mockdiag_cfg.h
+- "../../src/app/engine/diag/cbs/diag_cbs.h"
+- "../../tests/unit/support/test_assert_helper.h"
+- "../../src/app/engine/diag/cbs/diag_cbs_current.c"
@@ -0,0 +1,12 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- test/mocks/MockHL_spi.h
+- test/mocks/Mockfram_journal.h
+- test/mocks/Mockio.h
+- test/mocks/Mockmcu.h
+- test/mocks/Mockos.h
+- test/mocks/Mockspi.h
+- "../../src/app/driver/config/fram_cfg.h"
+- "../../src/app/driver/config/spi_cfg.h"
+- "../../src/app/main/include/fassert.h"
+- "../../src/app/driver/fram/fram.h"
@@ -0,0 +1,5 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- "../../src/app/driver/config/fram_cfg.h"
+- "../../src/app/driver/fram/fram_journal.h"
+- "../../tests/unit/support/test_assert_helper.h"
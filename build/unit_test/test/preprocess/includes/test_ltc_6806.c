@@ -0,0 +1,16 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- test/mocks/Mockdatabase.h
+- test/mocks/Mockdiag.h
+- test/mocks/Mockdma.h
+- test/mocks/Mockfassert.h
+- test/mocks/Mockio.h
+- test/mocks/Mockltc_mic_dma.h
+- test/mocks/Mockltc_pec.h
+- test/mocks/Mockmic_plausibility.h
+- test/mocks/Mockos.h
+- test/mocks/Mockspi.h
+- "../../src/app/driver/mic/ltc/6806/config/ltc_6806_cfg.h"
+- "../../src/app/driver/foxmath/cell_statistics.h"
+- "../../src/app/driver/mic/ltc/common/ltc.h"
+- "../../src/app/driver/mic/ltc/6806/ltc_6806.c"
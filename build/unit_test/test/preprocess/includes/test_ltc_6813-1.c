@@ -0,0 +1,17 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- test/mocks/Mockdatabase.h
+- test/mocks/Mockdiag.h
+- test/mocks/Mockdma.h
+- test/mocks/Mockfassert.h
+- test/mocks/Mockio.h
+- test/mocks/Mockltc_mic_dma.h
+- test/mocks/Mockltc_pec.h
+- test/mocks/Mockmic_plausibility.h
+- test/mocks/Mockos.h
+- test/mocks/Mockspi.h
+- test/mocks/Mocktsi.h
+- "../../src/app/driver/mic/ltc/6813-1/config/ltc_6813-1_cfg.h"
+- "../../src/app/driver/foxmath/cell_statistics.h"
+- "../../src/app/driver/mic/ltc/common/ltc.h"
+- "../../src/app/driver/mic/ltc/6813-1/ltc_6813-1.c"
@@ -0,0 +1,6 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- test/mocks/Mockdiag.h
+- "../../src/app/driver/foxmath/cell_statistics.h"
+- "../../src/app/application/plausibility/plausibility.h"
+- "../../tests/unit/support/test_assert_helper.h"
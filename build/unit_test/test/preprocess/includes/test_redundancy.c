@@ -0,0 +1,11 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- test/mocks/Mockbms.h
+- test/mocks/Mockdatabase.h
+- test/mocks/Mockdiag.h
+- test/mocks/Mockos.h
+- test/mocks/Mockplausibility.h
+- "../../src/app/driver/foxmath/cell_statistics.h"
+- "../../src/app/driver/foxmath/foxmath.h"
+- "../../src/app/application/redundancy/redundancy.h"
+- "../../tests/unit/support/test_assert_helper.h"
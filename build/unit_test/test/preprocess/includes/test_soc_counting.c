@@ -0,0 +1,7 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- Mockbms.h
+- Mockdatabase.h
+- Mockfram.h
+- "../../src/app/application/algorithm/state_estimation/soc/counting/soc_counting.h"
+- "../../src/app/application/algorithm/state_estimation/sox_counter.h"
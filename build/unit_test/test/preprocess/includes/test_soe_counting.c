@@ -0,0 +1,9 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- test/mocks/Mockbms.h
+- test/mocks/Mockdatabase.h
+- test/mocks/Mockfram.h
+- "../../src/app/application/config/battery_cell_cfg.h"
+- "../../src/app/driver/foxmath/foxmath.h"
+- "../../src/app/application/algorithm/state_estimation/soe/counting/soe_counting.h"
+- "../../src/app/application/algorithm/state_estimation/sox_counter.h"
@@ -0,0 +1,8 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- test/mocks/Mockbms.h
+- test/mocks/Mockdatabase.h
+- test/mocks/Mockfram.h
+- "../../src/app/application/algorithm/state_estimation/sof/trapezoid/sof_cfg.h"
+- "../../src/app/application/algorithm/state_estimation/sof/trapezoid/sof.h"
+- "../../tests/unit/support/test_assert_helper.h"
@@ -0,0 +1,4 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- "../../src/app/application/algorithm/state_estimation/sox_counter.h"
+- "../../tests/unit/support/test_assert_helper.h"
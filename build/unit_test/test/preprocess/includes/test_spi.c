@@ -0,0 +1,12 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- test/mocks/MockHL_spi.h
+- test/mocks/MockHL_sys_dma.h
+- test/mocks/Mockio.h
+- test/mocks/Mockmcu.h
+- test/mocks/Mockos.h
+- "../../src/app/driver/config/dma_cfg.h"
+- "../../src/app/driver/config/spi_cfg.h"
+- "../../src/app/driver/spi/spi.h"
+- "../../tests/unit/support/test_assert_helper.h"
+- "../../src/app/driver/spi/spi.c"
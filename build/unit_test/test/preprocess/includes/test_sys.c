@@ -0,0 +1,21 @@
+---
+- "/root/repo/tools/vendor/ceedling/vendor/unity/src/unity.h"
+- Mockalgorithm.h
+- Mockbal.h
+- test/mocks/Mockbms.h
+- Mockcan.h
+- Mockcontactor.h
+- test/mocks/Mockdiag.h
+- test/mocks/Mockfassert.h
+- test/mocks/Mockfram.h
+- Mockimd.h
+- Mockinterlock.h
+- Mockmeas.h
+- Mockmic.h
+- test/mocks/Mockos.h
+- Mocksbc.h
+- Mocksof.h
+- Mockstate_estimation.h
+- Mocksys_cfg.h
+- "../../src/app/driver/config/fram_cfg.h"
+- "../../src/app/engine/sys/sys.h"
@@ -0,0 +1,157 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "MockHL_can.h"
+#include "Mockcan_cfg.h"
+#include "Mockdatabase.h"
+#include "Mockdiag.h"
+#include "Mockfoxmath.h"
+#include "Mockio.h"
+#include "Mockmcu.h"
+#include "Mockos.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testDataSendNullPointerAsNode(void);
+extern void testDataSendNullPointerAsData(void);
+extern void testDataSendNoMessagePending(void);
+extern void testDataSendMessagePending(void);
+extern void testEnablePeriodic(void);
+extern void testIsCurrentSensorPresent(void);
+extern void testIsCurrentSensorCcPresent(void);
+extern void testWorstCaseFrameBits(void);
+extern void testBuildTxScheduleInvalidInput(void);
+extern void testBuildTxScheduleSlotsContainDueMessages(void);
+extern void testBuildTxScheduleRejectsInvalidTiming(void);
+extern void testBuildTxScheduleRejectsPhaseCollisions(void);
+extern void testBuildRxDispatchTableInvalidInput(void);
+extern void testBuildRxDispatchTableTooManyMessages(void);
+extern void testRxDispatchFindsAllHandlersOfAnId(void);
+extern void testRxBufferStoresAndDispatchesMessages(void);
+extern void testRxBufferWrapsAround(void);
+extern void testRxBufferDropsLowPriorityMessagesFirst(void);
+extern void testRxStatisticsAreOnlyWrittenOnChange(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  MockHL_can_Init();
+  Mockcan_cfg_Init();
+  Mockdatabase_Init();
+  Mockdiag_Init();
+  Mockfoxmath_Init();
+  Mockio_Init();
+  Mockmcu_Init();
+  Mockos_Init();
+}
+static void CMock_Verify(void)
+{
+  MockHL_can_Verify();
+  Mockcan_cfg_Verify();
+  Mockdatabase_Verify();
+  Mockdiag_Verify();
+  Mockfoxmath_Verify();
+  Mockio_Verify();
+  Mockmcu_Verify();
+  Mockos_Verify();
+}
+static void CMock_Destroy(void)
+{
+  MockHL_can_Destroy();
+  Mockcan_cfg_Destroy();
+  Mockdatabase_Destroy();
+  Mockdiag_Destroy();
+  Mockfoxmath_Destroy();
+  Mockio_Destroy();
+  Mockmcu_Destroy();
+  Mockos_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_can.c");
+  run_test(testDataSendNullPointerAsNode, "testDataSendNullPointerAsNode", 134);
+  run_test(testDataSendNullPointerAsData, "testDataSendNullPointerAsData", 142);
+  run_test(testDataSendNoMessagePending, "testDataSendNoMessagePending", 150);
+  run_test(testDataSendMessagePending, "testDataSendMessagePending", 161);
+  run_test(testEnablePeriodic, "testEnablePeriodic", 182);
+  run_test(testIsCurrentSensorPresent, "testIsCurrentSensorPresent", 193);
+  run_test(testIsCurrentSensorCcPresent, "testIsCurrentSensorCcPresent", 208);
+  run_test(testWorstCaseFrameBits, "testWorstCaseFrameBits", 223);
+  run_test(testBuildTxScheduleInvalidInput, "testBuildTxScheduleInvalidInput", 229);
+  run_test(testBuildTxScheduleSlotsContainDueMessages, "testBuildTxScheduleSlotsContainDueMessages", 234);
+  run_test(testBuildTxScheduleRejectsInvalidTiming, "testBuildTxScheduleRejectsInvalidTiming", 263);
+  run_test(testBuildTxScheduleRejectsPhaseCollisions, "testBuildTxScheduleRejectsPhaseCollisions", 280);
+  run_test(testBuildRxDispatchTableInvalidInput, "testBuildRxDispatchTableInvalidInput", 310);
+  run_test(testBuildRxDispatchTableTooManyMessages, "testBuildRxDispatchTableTooManyMessages", 318);
+  run_test(testRxDispatchFindsAllHandlersOfAnId, "testRxDispatchFindsAllHandlersOfAnId", 326);
+  run_test(testRxBufferStoresAndDispatchesMessages, "testRxBufferStoresAndDispatchesMessages", 367);
+  run_test(testRxBufferWrapsAround, "testRxBufferWrapsAround", 384);
+  run_test(testRxBufferDropsLowPriorityMessagesFirst, "testRxBufferDropsLowPriorityMessagesFirst", 394);
+  run_test(testRxStatisticsAreOnlyWrittenOnChange, "testRxStatisticsAreOnlyWrittenOnChange", 424);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
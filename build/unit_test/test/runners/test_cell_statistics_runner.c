@@ -0,0 +1,101 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testCSTAT_InvalidInput(void);
+extern void testCSTAT_NoValidValues(void);
+extern void testCSTAT_FirstOccurrenceOfExtremaIsStored(void);
+extern void testCSTAT_ExtremeValues(void);
+extern void testCSTAT_InvalidValuesAreSkipped(void);
+extern void testCSTAT_GetOutOfRangeValues(void);
+extern void testCSTAT_CountValidValues(void);
+extern void testCSTAT_RandomValuesMatchReference(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_cell_statistics.c");
+  run_test(testCSTAT_InvalidInput, "testCSTAT_InvalidInput", 116);
+  run_test(testCSTAT_NoValidValues, "testCSTAT_NoValidValues", 128);
+  run_test(testCSTAT_FirstOccurrenceOfExtremaIsStored, "testCSTAT_FirstOccurrenceOfExtremaIsStored", 142);
+  run_test(testCSTAT_ExtremeValues, "testCSTAT_ExtremeValues", 158);
+  run_test(testCSTAT_InvalidValuesAreSkipped, "testCSTAT_InvalidValuesAreSkipped", 171);
+  run_test(testCSTAT_GetOutOfRangeValues, "testCSTAT_GetOutOfRangeValues", 186);
+  run_test(testCSTAT_CountValidValues, "testCSTAT_CountValidValues", 201);
+  run_test(testCSTAT_RandomValuesMatchReference, "testCSTAT_RandomValuesMatchReference", 209);
+
+  return UnityEnd();
+}
@@ -0,0 +1,101 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "Mockdiag_cfg.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testDIAG_ErrorOvercurrentChargeInvalidInput(void);
+extern void testDIAG_ErrorOvercurrentDischargeInvalidInput(void);
+extern void testDIAG_ErrorCurrentMeasurementInvalidInput(void);
+extern void testDIAG_ErrorCurrentOnOpenStringInvalidInput(void);
+extern void testDIAG_ErrorCurrentOnOpenString(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  Mockdiag_cfg_Init();
+}
+static void CMock_Verify(void)
+{
+  Mockdiag_cfg_Verify();
+}
+static void CMock_Destroy(void)
+{
+  Mockdiag_cfg_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_diag_cbs_current.c");
+  run_test(testDIAG_ErrorOvercurrentChargeInvalidInput, "testDIAG_ErrorOvercurrentChargeInvalidInput", 92);
+  run_test(testDIAG_ErrorOvercurrentDischargeInvalidInput, "testDIAG_ErrorOvercurrentDischargeInvalidInput", 103);
+  run_test(testDIAG_ErrorCurrentMeasurementInvalidInput, "testDIAG_ErrorCurrentMeasurementInvalidInput", 114);
+  run_test(testDIAG_ErrorCurrentOnOpenStringInvalidInput, "testDIAG_ErrorCurrentOnOpenStringInvalidInput", 125);
+  run_test(testDIAG_ErrorCurrentOnOpenString, "testDIAG_ErrorCurrentOnOpenString", 125);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
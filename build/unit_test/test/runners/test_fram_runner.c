@@ -0,0 +1,125 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "MockHL_spi.h"
+#include "Mockfram_journal.h"
+#include "Mockio.h"
+#include "Mockmcu.h"
+#include "Mockos.h"
+#include "Mockspi.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testRequestWriteCoalescesRequests(void);
+extern void testProcessWriteRequestsSkipsUnchangedData(void);
+extern void testProcessWriteRequestsHoldsLockUntilTransferIsStarted(void);
+extern void testProcessWriteRequestsRetriesFailedTransfer(void);
+extern void testProcessWriteRequestsDoesNotCommitIndexOfFailedTransfer(void);
+extern void testProcessWriteRequestsWaitsForInterface(void);
+extern void testReadWithoutRecordKeepsDefault(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  MockHL_spi_Init();
+  Mockfram_journal_Init();
+  Mockio_Init();
+  Mockmcu_Init();
+  Mockos_Init();
+  Mockspi_Init();
+}
+static void CMock_Verify(void)
+{
+  MockHL_spi_Verify();
+  Mockfram_journal_Verify();
+  Mockio_Verify();
+  Mockmcu_Verify();
+  Mockos_Verify();
+  Mockspi_Verify();
+}
+static void CMock_Destroy(void)
+{
+  MockHL_spi_Destroy();
+  Mockfram_journal_Destroy();
+  Mockio_Destroy();
+  Mockmcu_Destroy();
+  Mockos_Destroy();
+  Mockspi_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_fram.c");
+  run_test(testRequestWriteCoalescesRequests, "testRequestWriteCoalescesRequests", 94);
+  run_test(testProcessWriteRequestsSkipsUnchangedData, "testProcessWriteRequestsSkipsUnchangedData", 119);
+  run_test(testProcessWriteRequestsHoldsLockUntilTransferIsStarted, "testProcessWriteRequestsHoldsLockUntilTransferIsStarted", 144);
+  run_test(testProcessWriteRequestsRetriesFailedTransfer, "testProcessWriteRequestsRetriesFailedTransfer", 158);
+  run_test(testProcessWriteRequestsDoesNotCommitIndexOfFailedTransfer, "testProcessWriteRequestsDoesNotCommitIndexOfFailedTransfer", 182);
+  run_test(testProcessWriteRequestsWaitsForInterface, "testProcessWriteRequestsWaitsForInterface", 199);
+  run_test(testReadWithoutRecordKeepsDefault, "testReadWithoutRecordKeepsDefault", 219);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
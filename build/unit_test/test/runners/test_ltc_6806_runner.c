@@ -0,0 +1,129 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "Mockdatabase.h"
+#include "Mockdiag.h"
+#include "Mockdma.h"
+#include "Mockfassert.h"
+#include "Mockio.h"
+#include "Mockltc_mic_dma.h"
+#include "Mockltc_pec.h"
+#include "Mockmic_plausibility.h"
+#include "Mockos.h"
+#include "Mockspi.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testLTC_SetFirstMeasurementCycleFinished(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  Mockdatabase_Init();
+  Mockdiag_Init();
+  Mockdma_Init();
+  Mockfassert_Init();
+  Mockio_Init();
+  Mockltc_mic_dma_Init();
+  Mockltc_pec_Init();
+  Mockmic_plausibility_Init();
+  Mockos_Init();
+  Mockspi_Init();
+}
+static void CMock_Verify(void)
+{
+  Mockdatabase_Verify();
+  Mockdiag_Verify();
+  Mockdma_Verify();
+  Mockfassert_Verify();
+  Mockio_Verify();
+  Mockltc_mic_dma_Verify();
+  Mockltc_pec_Verify();
+  Mockmic_plausibility_Verify();
+  Mockos_Verify();
+  Mockspi_Verify();
+}
+static void CMock_Destroy(void)
+{
+  Mockdatabase_Destroy();
+  Mockdiag_Destroy();
+  Mockdma_Destroy();
+  Mockfassert_Destroy();
+  Mockio_Destroy();
+  Mockltc_mic_dma_Destroy();
+  Mockltc_pec_Destroy();
+  Mockmic_plausibility_Destroy();
+  Mockos_Destroy();
+  Mockspi_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_ltc_6806.c");
+  run_test(testLTC_SetFirstMeasurementCycleFinished, "testLTC_SetFirstMeasurementCycleFinished", 127);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
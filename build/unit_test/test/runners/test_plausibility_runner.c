@@ -0,0 +1,113 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "Mockdiag.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorBothZero(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorBothMaximum(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsTolerance(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsToleranceMinusOne(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsTolerancePlusOne(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualValue(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxMinus(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxPlus(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxPlusTooMuch(void);
+extern void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32Max(void);
+extern void testCheckVoltageSpreadInvalidatesOutliers(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  Mockdiag_Init();
+}
+static void CMock_Verify(void)
+{
+  Mockdiag_Verify();
+}
+static void CMock_Destroy(void)
+{
+  Mockdiag_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_plausibility.c");
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorBothZero, "testCheckPackVoltagecellVoltageandcurrentSensorBothZero", 78);
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorBothMaximum, "testCheckPackVoltagecellVoltageandcurrentSensorBothMaximum", 84);
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsTolerance, "testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsTolerance", 90);
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsToleranceMinusOne, "testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsToleranceMinusOne", 96);
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsTolerancePlusOne, "testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualsTolerancePlusOne", 102);
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualValue, "testCheckPackVoltagecellVoltageandcurrentSensorDifferenceEqualValue", 108);
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxMinus, "testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxMinus", 114);
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxPlus, "testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxPlus", 120);
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxPlusTooMuch, "testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32MaxPlusTooMuch", 126);
+  run_test(testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32Max, "testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32Max", 126);
+  run_test(testCheckVoltageSpreadInvalidatesOutliers, "testCheckVoltageSpreadInvalidatesOutliers", 138);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
@@ -0,0 +1,127 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockdiag.h"
+#include "Mockos.h"
+#include "Mockplausibility.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testMRC_MeasurementUpdatedAtLeastOnce(void);
+extern void testMRC_MeasurementUpdatedRecently(void);
+extern void testMRC_CalculateCellVoltageMinMaxAverageNullPointer(void);
+extern void testMRC_CalculateCellTemperatureMinMaxAverageNullPointer(void);
+extern void testMRC_CalculateCellVoltageMinMaxAverage(void);
+extern void testMRC_ValidateCellVoltageNullPointer(void);
+extern void testMRC_UpdateCellVoltageValidationNullPointer(void);
+extern void testMRC_ValidateCellTemperatureNullPointer(void);
+extern void testMRC_UpdateCellTemperatureValidationNullPointer(void);
+extern void testMRC_MicMeasurementValidationTickZeroNothingToDo(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  Mockbms_Init();
+  Mockdatabase_Init();
+  Mockdiag_Init();
+  Mockos_Init();
+  Mockplausibility_Init();
+}
+static void CMock_Verify(void)
+{
+  Mockbms_Verify();
+  Mockdatabase_Verify();
+  Mockdiag_Verify();
+  Mockos_Verify();
+  Mockplausibility_Verify();
+}
+static void CMock_Destroy(void)
+{
+  Mockbms_Destroy();
+  Mockdatabase_Destroy();
+  Mockdiag_Destroy();
+  Mockos_Destroy();
+  Mockplausibility_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_redundancy.c");
+  run_test(testMRC_MeasurementUpdatedAtLeastOnce, "testMRC_MeasurementUpdatedAtLeastOnce", 107);
+  run_test(testMRC_MeasurementUpdatedRecently, "testMRC_MeasurementUpdatedRecently", 129);
+  run_test(testMRC_CalculateCellVoltageMinMaxAverageNullPointer, "testMRC_CalculateCellVoltageMinMaxAverageNullPointer", 175);
+  run_test(testMRC_CalculateCellTemperatureMinMaxAverageNullPointer, "testMRC_CalculateCellTemperatureMinMaxAverageNullPointer", 182);
+  run_test(testMRC_CalculateCellVoltageMinMaxAverage, "testMRC_CalculateCellVoltageMinMaxAverage", 189);
+  run_test(testMRC_ValidateCellVoltageNullPointer, "testMRC_ValidateCellVoltageNullPointer", 222);
+  run_test(testMRC_UpdateCellVoltageValidationNullPointer, "testMRC_UpdateCellVoltageValidationNullPointer", 229);
+  run_test(testMRC_ValidateCellTemperatureNullPointer, "testMRC_ValidateCellTemperatureNullPointer", 235);
+  run_test(testMRC_UpdateCellTemperatureValidationNullPointer, "testMRC_UpdateCellTemperatureValidationNullPointer", 242);
+  run_test(testMRC_MicMeasurementValidationTickZeroNothingToDo, "testMRC_MicMeasurementValidationTickZeroNothingToDo", 249);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
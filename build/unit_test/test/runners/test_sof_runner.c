@@ -0,0 +1,113 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "Mockbms.h"
+#include "Mockdatabase.h"
+#include "Mockfram.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testFixedPointDeratingMatchesFloatImplementation(void);
+extern void testEvaluateCurveWithMultipleSegments(void);
+extern void testRangeIncludesBreakpointsBetweenMinimumAndMaximum(void);
+extern void testEvaluateCurveBeforeInitialization(void);
+extern void testCalculateCurvesRejectsInvalidCurves(void);
+extern void testMinimumOfTwoSofValues(void);
+extern void testUpdateStringInputsDetectsChangedInputs(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  Mockbms_Init();
+  Mockdatabase_Init();
+  Mockfram_Init();
+}
+static void CMock_Verify(void)
+{
+  Mockbms_Verify();
+  Mockdatabase_Verify();
+  Mockfram_Verify();
+}
+static void CMock_Destroy(void)
+{
+  Mockbms_Destroy();
+  Mockdatabase_Destroy();
+  Mockfram_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_sof.c");
+  run_test(testFixedPointDeratingMatchesFloatImplementation, "testFixedPointDeratingMatchesFloatImplementation", 300);
+  run_test(testEvaluateCurveWithMultipleSegments, "testEvaluateCurveWithMultipleSegments", 307);
+  run_test(testRangeIncludesBreakpointsBetweenMinimumAndMaximum, "testRangeIncludesBreakpointsBetweenMinimumAndMaximum", 342);
+  run_test(testEvaluateCurveBeforeInitialization, "testEvaluateCurveBeforeInitialization", 366);
+  run_test(testCalculateCurvesRejectsInvalidCurves, "testCalculateCurvesRejectsInvalidCurves", 373);
+  run_test(testMinimumOfTwoSofValues, "testMinimumOfTwoSofValues", 390);
+  run_test(testUpdateStringInputsDetectsChangedInputs, "testUpdateStringInputsDetectsChangedInputs", 400);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
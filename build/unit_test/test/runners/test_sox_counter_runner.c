@@ -0,0 +1,97 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testSOX_InvalidInput(void);
+extern void testSOX_AddSampleCarriesRemainder(void);
+extern void testSOX_AddSampleTimestamps(void);
+extern void testSOX_ReferenceAndPercentages(void);
+extern void testSOX_LimitsReanchorReference(void);
+extern void testSOX_ReplayOneWeekDrift(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+}
+static void CMock_Verify(void)
+{
+}
+static void CMock_Destroy(void)
+{
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_sox_counter.c");
+  run_test(testSOX_InvalidInput, "testSOX_InvalidInput", 89);
+  run_test(testSOX_AddSampleCarriesRemainder, "testSOX_AddSampleCarriesRemainder", 100);
+  run_test(testSOX_AddSampleTimestamps, "testSOX_AddSampleTimestamps", 123);
+  run_test(testSOX_ReferenceAndPercentages, "testSOX_ReferenceAndPercentages", 138);
+  run_test(testSOX_LimitsReanchorReference, "testSOX_LimitsReanchorReference", 168);
+  run_test(testSOX_ReplayOneWeekDrift, "testSOX_ReplayOneWeekDrift", 207);
+
+  return UnityEnd();
+}
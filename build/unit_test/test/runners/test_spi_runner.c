@@ -0,0 +1,125 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "MockHL_spi.h"
+#include "MockHL_sys_dma.h"
+#include "Mockio.h"
+#include "Mockmcu.h"
+#include "Mockos.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testDummyFunction();
+extern void testTransmitDataWithDummyWakesUpInactiveInterface(void);
+extern void testTransmitDataWithDummySkipsWakeUpWithinValidity(void);
+extern void testTransmitDataWithDummyWakesUpAfterValidity(void);
+extern void testTransmitDataWithDummyWakesUpAfterCounterWrapAround(void);
+extern void testTransmitDataWithDummyAlwaysWakesUpUntrackedInterface(void);
+extern void testTransmitReceiveDataDmaFromIsrDoesNotStartDuringOngoingDmaTransfer(void);
+extern void testTransmitReceiveDataDmaLockedRequiresLockedInterface(void);
+extern void testTransmitReceiveDataDmaLockedKeepsLockDuringOngoingDmaTransfer(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  MockHL_spi_Init();
+  MockHL_sys_dma_Init();
+  Mockio_Init();
+  Mockmcu_Init();
+  Mockos_Init();
+}
+static void CMock_Verify(void)
+{
+  MockHL_spi_Verify();
+  MockHL_sys_dma_Verify();
+  Mockio_Verify();
+  Mockmcu_Verify();
+  Mockos_Verify();
+}
+static void CMock_Destroy(void)
+{
+  MockHL_spi_Destroy();
+  MockHL_sys_dma_Destroy();
+  Mockio_Destroy();
+  Mockmcu_Destroy();
+  Mockos_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_spi.c");
+  run_test(testDummyFunction, "testDummyFunction", 124);
+  run_test(testTransmitDataWithDummyWakesUpInactiveInterface, "testTransmitDataWithDummyWakesUpInactiveInterface", 127);
+  run_test(testTransmitDataWithDummySkipsWakeUpWithinValidity, "testTransmitDataWithDummySkipsWakeUpWithinValidity", 142);
+  run_test(testTransmitDataWithDummyWakesUpAfterValidity, "testTransmitDataWithDummyWakesUpAfterValidity", 161);
+  run_test(testTransmitDataWithDummyWakesUpAfterCounterWrapAround, "testTransmitDataWithDummyWakesUpAfterCounterWrapAround", 181);
+  run_test(testTransmitDataWithDummyAlwaysWakesUpUntrackedInterface, "testTransmitDataWithDummyAlwaysWakesUpUntrackedInterface", 198);
+  run_test(testTransmitReceiveDataDmaFromIsrDoesNotStartDuringOngoingDmaTransfer, "testTransmitReceiveDataDmaFromIsrDoesNotStartDuringOngoingDmaTransfer", 213);
+  run_test(testTransmitReceiveDataDmaLockedRequiresLockedInterface, "testTransmitReceiveDataDmaLockedRequiresLockedInterface", 224);
+  run_test(testTransmitReceiveDataDmaLockedKeepsLockDuringOngoingDmaTransfer, "testTransmitReceiveDataDmaLockedKeepsLockDuringOngoingDmaTransfer", 230);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
@@ -0,0 +1,157 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Automagically Detected Files To Include=====*/
+#include "unity.h"
+#include "cmock.h"
+#include "Mockalgorithm.h"
+#include "Mockbal.h"
+#include "Mockbms.h"
+#include "Mockcan.h"
+#include "Mockcontactor.h"
+#include "Mockdiag.h"
+#include "Mockfassert.h"
+#include "Mockfram.h"
+#include "Mockimd.h"
+#include "Mockinterlock.h"
+#include "Mockmeas.h"
+#include "Mockmic.h"
+#include "Mockos.h"
+#include "Mocksbc.h"
+#include "Mocksof.h"
+#include "Mockstate_estimation.h"
+#include "Mocksys_cfg.h"
+#include "CException.h"
+
+int GlobalExpectCount;
+int GlobalVerifyOrder;
+char* GlobalOrderError;
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testDummy(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  GlobalExpectCount = 0;
+  GlobalVerifyOrder = 0;
+  GlobalOrderError = NULL;
+  Mockalgorithm_Init();
+  Mockbal_Init();
+  Mockbms_Init();
+  Mockcan_Init();
+  Mockcontactor_Init();
+  Mockdiag_Init();
+  Mockfassert_Init();
+  Mockfram_Init();
+  Mockimd_Init();
+  Mockinterlock_Init();
+  Mockmeas_Init();
+  Mockmic_Init();
+  Mockos_Init();
+  Mocksbc_Init();
+  Mocksof_Init();
+  Mockstate_estimation_Init();
+  Mocksys_cfg_Init();
+}
+static void CMock_Verify(void)
+{
+  Mockalgorithm_Verify();
+  Mockbal_Verify();
+  Mockbms_Verify();
+  Mockcan_Verify();
+  Mockcontactor_Verify();
+  Mockdiag_Verify();
+  Mockfassert_Verify();
+  Mockfram_Verify();
+  Mockimd_Verify();
+  Mockinterlock_Verify();
+  Mockmeas_Verify();
+  Mockmic_Verify();
+  Mockos_Verify();
+  Mocksbc_Verify();
+  Mocksof_Verify();
+  Mockstate_estimation_Verify();
+  Mocksys_cfg_Verify();
+}
+static void CMock_Destroy(void)
+{
+  Mockalgorithm_Destroy();
+  Mockbal_Destroy();
+  Mockbms_Destroy();
+  Mockcan_Destroy();
+  Mockcontactor_Destroy();
+  Mockdiag_Destroy();
+  Mockfassert_Destroy();
+  Mockfram_Destroy();
+  Mockimd_Destroy();
+  Mockinterlock_Destroy();
+  Mockmeas_Destroy();
+  Mockmic_Destroy();
+  Mockos_Destroy();
+  Mocksbc_Destroy();
+  Mocksof_Destroy();
+  Mockstate_estimation_Destroy();
+  Mocksys_cfg_Destroy();
+}
+
+/*=======Test Reset Options=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  CMock_Verify();
+  CMock_Destroy();
+  CMock_Init();
+  setUp();
+}
+void verifyTest(void);
+void verifyTest(void)
+{
+  CMock_Verify();
+}
+
+/*=======Test Runner Used To Run Each Test=====*/
+static void run_test(UnityTestFunction func, const char* name, UNITY_LINE_TYPE line_num)
+{
+    Unity.CurrentTestName = name;
+    Unity.CurrentTestLineNumber = line_num;
+#ifdef UNITY_USE_COMMAND_LINE_ARGS
+    if (!UnityTestMatches())
+        return;
+#endif
+    Unity.NumberOfTests++;
+    UNITY_CLR_DETAILS();
+    UNITY_EXEC_TIME_START();
+    CMock_Init();
+    if (TEST_PROTECT())
+    {
+        CEXCEPTION_T e;
+        Try {
+            setUp();
+            func();
+        } Catch(e) {
+            TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!");
+        }
+    }
+    if (TEST_PROTECT())
+    {
+        tearDown();
+        CMock_Verify();
+    }
+    CMock_Destroy();
+    UNITY_EXEC_TIME_STOP();
+    UnityConcludeTest();
+}
+
+/*=======MAIN=====*/
+int main(void)
+{
+  UnityBegin("test_sys.c");
+  run_test(testDummy, "testDummy", 88);
+
+  CMock_Guts_MemFreeFinal();
+  return UnityEnd();
+}
@@ -55,9 +55,14 @@
 /*========== Includes =======================================================*/
 #include "algorithm.h"
 
+#include "database.h"
+#include "diag.h"
+#include "mcu.h"
 #include "os.h"
 
 /*========== Macros and Definitions =========================================*/
+/** maximum number of algorithms, one task notification bit per algorithm */
+#define ALGO_MAXIMUM_NUMBER_OF_ALGORITHMS (32u)
 
 /*========== Static Constant and Variable Definitions =======================*/
 /**
@@ -66,6 +71,12 @@
  */
 static bool algo_initializationRequested = false;
 
+/** time of the scheduler, incremented by #ALGO_TICK_MS in every call of #ALGO_MainFunction() */
+static uint32_t algo_schedulerTime_ms = 0u;
+
+/** task notification bits of all data triggered algorithms */
+static uint32_t algo_triggerBits = 0u;
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -75,26 +86,62 @@ static bool algo_initializationRequested = false;
  */
 static void ALGO_Initialization(void);
 
+/**
+ * @brief   checks if an algorithm is released in the current time slot
+ * @details Cyclic algorithms are released when their next release time has
+ *          been reached, data triggered algorithms when their database entry
+ *          has been written since the last time slot.
+ * @param[in]   algorithmIndex  index entry of the algorithm
+ * @param[in]   dataUpdates     notification bits of the updated database entries
+ * @return  true if the algorithm has to be run, false otherwise
+ */
+static bool ALGO_IsReleased(uint16_t algorithmIndex, uint32_t dataUpdates);
+
+/**
+ * @brief   runs an algorithm and accounts its execution time
+ * @details The CPU time is measured with the cycle counter. A run that exceeds
+ *          the deadline blocks the algorithm and is reported to the
+ *          diagnosis module, unless #ALGO_MonitorExecutionTime() has already
+ *          done so while the algorithm was running.
+ * @param[in]   algorithmIndex  index entry of the algorithm
+ */
+static void ALGO_RunAlgorithm(uint16_t algorithmIndex);
+
 /*========== Static Function Implementations ================================*/
 static void ALGO_Initialization(void) {
+    FAS_ASSERT(algo_length <= ALGO_MAXIMUM_NUMBER_OF_ALGORITHMS);
+
     /* iterate over all algorithms */
     for (uint16_t i = 0u; i < algo_length; i++) {
-        /* check if the cycle time is valid */
-        FAS_ASSERT((algo_algorithms[i].cycleTime_ms % ALGO_TICK_MS) == 0u);
+        /* check if period and phase are valid */
+        FAS_ASSERT((algo_algorithms[i].period_ms % ALGO_TICK_MS) == 0u);
+        FAS_ASSERT((algo_algorithms[i].phase_ms % ALGO_TICK_MS) == 0u);
+        FAS_ASSERT((algo_algorithms[i].phase_ms < algo_algorithms[i].period_ms) || (algo_algorithms[i].phase_ms == 0u));
+        FAS_ASSERT(
+            (ALGO_TRIGGER_CYCLIC == algo_algorithms[i].trigger) || (ALGO_TRIGGER_DATA == algo_algorithms[i].trigger));
 
         /* check only uninitialized algorithms */
         if (ALGO_UNINITIALIZED == algo_algorithms[i].state) {
+            algo_algorithms[i].nextRelease_ms = algo_schedulerTime_ms + algo_algorithms[i].phase_ms;
+
+            STD_RETURN_TYPE_e result = STD_OK;
+            if (ALGO_TRIGGER_DATA == algo_algorithms[i].trigger) {
+                /* the algorithm task is notified on every write access to the database entry */
+                FAS_ASSERT(algo_algorithms[i].triggerBlockId < DATA_BLOCK_ID_MAX);
+                result = DATA_SubscribeToDataBlock(algo_algorithms[i].triggerBlockId, ((uint32_t)1u << i));
+                if (STD_OK == result) {
+                    algo_triggerBits |= ((uint32_t)1u << i);
+                }
+            }
             /* directly make ready when init function is a null pointer otherwise run init */
-            if (NULL_PTR == algo_algorithms[i].fpInitialization) {
+            if ((STD_OK == result) && (NULL_PTR != algo_algorithms[i].fpInitialization)) {
+                result = algo_algorithms[i].fpInitialization();
+                FAS_ASSERT((STD_OK == result) || (STD_NOT_OK == result));
+            }
+            if (STD_OK == result) {
                 algo_algorithms[i].state = ALGO_READY;
             } else {
-                const STD_RETURN_TYPE_e result = algo_algorithms[i].fpInitialization();
-                FAS_ASSERT((STD_OK == result) || (STD_NOT_OK == result));
-                if (STD_OK == result) {
-                    algo_algorithms[i].state = ALGO_READY;
-                } else {
-                    algo_algorithms[i].state = ALGO_FAILED_INIT;
-                }
+                algo_algorithms[i].state = ALGO_FAILED_INIT;
             }
         }
     }
@@ -102,6 +149,53 @@ static void ALGO_Initialization(void) {
     return;
 }
 
+static bool ALGO_IsReleased(uint16_t algorithmIndex, uint32_t dataUpdates) {
+    ALGO_TASKS_s *pAlgorithm = &algo_algorithms[algorithmIndex];
+    bool isReleased          = false;
+
+    if (ALGO_TRIGGER_DATA == pAlgorithm->trigger) {
+        isReleased = ((dataUpdates & ((uint32_t)1u << algorithmIndex)) != 0u);
+    } else if (pAlgorithm->period_ms == 0u) {
+        isReleased = true;
+    } else if ((int32_t)(algo_schedulerTime_ms - pAlgorithm->nextRelease_ms) >= 0) {
+        /* compare the difference so that a wrap around of the scheduler time is handled */
+        isReleased = true;
+        pAlgorithm->nextRelease_ms += pAlgorithm->period_ms;
+    } else {
+        /* not released in this time slot */
+    }
+    return isReleased;
+}
+
+static void ALGO_RunAlgorithm(uint16_t algorithmIndex) {
+    ALGO_TASKS_s *pAlgorithm = &algo_algorithms[algorithmIndex];
+
+    /* Set the start before the state, so that the monitor never sees a running algorithm with an old start */
+    pAlgorithm->startCycle = MCU_GetCycleCount();
+    pAlgorithm->state      = ALGO_RUNNING;
+    pAlgorithm->fpAlgorithm();
+    const uint32_t executionTime_us =
+        MCU_ConvertCycleDifferenceToTimespan_us(MCU_GetCycleCount() - pAlgorithm->startCycle);
+
+    OS_EnterTaskCritical();
+    pAlgorithm->statistics.lastExecutionTime_us = executionTime_us;
+    if (executionTime_us > pAlgorithm->statistics.worstExecutionTime_us) {
+        pAlgorithm->statistics.worstExecutionTime_us = executionTime_us;
+    }
+    pAlgorithm->statistics.totalExecutionTime_us += executionTime_us;
+    pAlgorithm->statistics.nrOfRuns++;
+    if (executionTime_us > pAlgorithm->deadline_us) {
+        pAlgorithm->statistics.nrOfOverruns++;
+    }
+    OS_ExitTaskCritical();
+
+    if ((executionTime_us > pAlgorithm->deadline_us) && (ALGO_RUNNING == pAlgorithm->state)) {
+        pAlgorithm->state = ALGO_BLOCKED;
+        (void)DIAG_Handler(DIAG_ID_ALGORITHM_DEADLINE, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, algorithmIndex);
+    }
+    ALGO_MarkAsDone(algorithmIndex);
+}
+
 /*========== Extern Function Implementations ================================*/
 
 extern void ALGO_UnlockInitialization(void) {
@@ -121,44 +215,54 @@ extern void ALGO_MainFunction(void) {
         OS_ExitTaskCritical();
     }
 
-    static uint32_t counter_ticks = 0u;
+    /* collect the database entries that have been written since the last time slot */
+    uint32_t dataUpdates = 0u;
+    if (algo_triggerBits != 0u) {
+        dataUpdates = DATA_GetDataBlockUpdates(algo_triggerBits, 0u);
+    }
 
     for (uint16_t i = 0u; i < algo_length; i++) {
-        const bool runAlgorithmAsap = (algo_algorithms[i].cycleTime_ms == 0u);
-        const bool runAlgorithmCycleElapsed =
-            ((algo_algorithms[i].cycleTime_ms != 0u) && ((counter_ticks % algo_algorithms[i].cycleTime_ms) == 0u));
-        if ((runAlgorithmAsap != false) || (runAlgorithmCycleElapsed != false)) {
-            /* Cycle time elapsed -> call function */
-            if (ALGO_READY == algo_algorithms[i].state) {
-                /* Set state to running -> reset to READY before leaving algo function */
-                algo_algorithms[i].state     = ALGO_RUNNING;
-                algo_algorithms[i].startTime = OS_GetTickCount();
-                algo_algorithms[i].fpAlgorithm();
-                ALGO_MarkAsDone(i);
-            }
+        /* the release is evaluated for all algorithms, so that blocked ones do not accumulate releases */
+        const bool isReleased = ALGO_IsReleased(i, dataUpdates);
+        if ((true == isReleased) && (ALGO_READY == algo_algorithms[i].state)) {
+            ALGO_RunAlgorithm(i);
         }
     }
 
-    counter_ticks += ALGO_TICK_MS;
+    algo_schedulerTime_ms += ALGO_TICK_MS;
 }
 
 extern void ALGO_MonitorExecutionTime(void) {
-    const uint32_t timestamp = OS_GetTickCount();
+    const uint32_t cycleCount = MCU_GetCycleCount();
 
     for (uint16_t i = 0u; i < algo_length; i++) {
-        if ((algo_algorithms[i].startTime != 0u) && (ALGO_RUNNING == algo_algorithms[i].state) &&
-            ((algo_algorithms[i].startTime + algo_algorithms[i].maxCalculationDuration_ms) < timestamp)) {
-            /* Block task from further execution because of runtime violation, but task will finish its execution */
-            algo_algorithms[i].state = ALGO_BLOCKED;
-
-            /* TODO: Add diag call to notify error in algorithm module */
+        if (ALGO_RUNNING == algo_algorithms[i].state) {
+            const uint32_t runningTime_us =
+                MCU_ConvertCycleDifferenceToTimespan_us(cycleCount - algo_algorithms[i].startCycle);
+            if (runningTime_us > algo_algorithms[i].deadline_us) {
+                /* Block task from further execution because of runtime violation, but task will finish its execution */
+                algo_algorithms[i].state = ALGO_BLOCKED;
+                (void)DIAG_Handler(DIAG_ID_ALGORITHM_DEADLINE, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, i);
+            }
         }
     }
 }
 
+extern void ALGO_GetStatistics(uint16_t algorithmIndex, ALGO_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(algorithmIndex < algo_length);
+    FAS_ASSERT(pStatistics != NULL_PTR);
+    OS_EnterTaskCritical();
+    *pStatistics = algo_algorithms[algorithmIndex].statistics;
+    OS_ExitTaskCritical();
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
 extern void TEST_ALGO_ResetInitializationRequest() {
     algo_initializationRequested = false;
 }
+extern void TEST_ALGO_ResetScheduler(void) {
+    algo_schedulerTime_ms = 0u;
+    algo_triggerBits      = 0u;
+}
 #endif /* UNITY_UNIT_TEST */
@@ -71,18 +71,33 @@
 extern void ALGO_UnlockInitialization(void);
 
 /**
- * @brief   handles the call of different algorithm functions when cycle time
- *          has expired
+ * @brief   handles the call of different algorithm functions when they are
+ *          released
+ * @details Cyclic algorithms are released according to their period and
+ *          phase, data triggered algorithms after their database entry has
+ *          been written. The CPU time of every run is recorded in
+ *          #ALGO_TASKS::statistics.
  */
 extern void ALGO_MainFunction(void);
 
 /**
  * @brief   monitors the calculation duration of the different algorithms
+ * @details A running algorithm that exceeds its deadline is blocked and the
+ *          violation is reported with #DIAG_ID_ALGORITHM_DEADLINE.
  */
 extern void ALGO_MonitorExecutionTime(void);
 
+/**
+ * @brief   returns a consistent copy of the execution time statistics of an
+ *          algorithm
+ * @param[in]   algorithmIndex  index entry of the algorithm
+ * @param[out]  pStatistics     copy of the statistics
+ */
+extern void ALGO_GetStatistics(uint16_t algorithmIndex, ALGO_STATISTICS_s *pStatistics);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 extern void TEST_ALGO_ResetInitializationRequest(void);
+extern void TEST_ALGO_ResetScheduler(void);
 #endif /* UNITY_UNIT_TEST */
 #endif /* FOXBMS__ALGORITHM_H_ */
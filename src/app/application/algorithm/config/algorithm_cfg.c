@@ -64,7 +64,17 @@
 /*========== Extern Constant and Variable Definitions =======================*/
 /** array of algorithms that should be executed */
 ALGO_TASKS_s algo_algorithms[] = {
-    {ALGO_UNINITIALIZED, 100, 1000, 0, NULL_PTR, &ALGO_MovAverage},
+    {ALGO_UNINITIALIZED,
+     0u,
+     0u,
+     10000u,
+     ALGO_TRIGGER_DATA,
+     DATA_BLOCK_ID_CURRENT_SENSOR,
+     &ALGO_InitializeMovingAverage,
+     &ALGO_MovAverage,
+     0u,
+     0u,
+     {0u, 0u, 0u, 0u, 0u}},
 };
 
 const uint16_t algo_length = sizeof(algo_algorithms) / sizeof(algo_algorithms[0]);
@@ -57,6 +57,8 @@
 /*========== Includes =======================================================*/
 #include "general.h"
 
+#include "database_cfg.h"
+
 /*========== Macros and Definitions =========================================*/
 /**
  * @ingroup ALGORITHMS_CONFIGURATION
@@ -81,20 +83,40 @@ typedef enum ALGO_STATE {
     ALGO_UNINITIALIZED, /*!< This is the default value indicating that initialization has not run yet */
     ALGO_READY,         /*!< This indicates that the algorithm is ready to be run on next time slot */
     ALGO_RUNNING,       /*!< This indicates that the algorithm is currently running.
-    Note that it may not spend more than #ALGO_TASKS::maxCalculationDuration_ms in this state. */
-    ALGO_BLOCKED,       /*!< This indicates that the algorithm has violated its maximum calculation duration. */
+    Note that it may not spend more than #ALGO_TASKS::deadline_us in this state. */
+    ALGO_BLOCKED,       /*!< This indicates that the algorithm has violated its deadline. */
     ALGO_FAILED_INIT,   /*!< This indicates a failed initialization. */
 } ALGO_STATE_e;
 
+/** events that release an algorithm */
+typedef enum ALGO_TRIGGER {
+    ALGO_TRIGGER_CYCLIC, /*!< released every #ALGO_TASKS::period_ms, shifted by #ALGO_TASKS::phase_ms */
+    ALGO_TRIGGER_DATA,   /*!< released in the next time slot after #ALGO_TASKS::triggerBlockId has been written */
+} ALGO_TRIGGER_e;
+
+/** execution time statistics of an algorithm */
+typedef struct ALGO_STATISTICS {
+    uint32_t lastExecutionTime_us;  /*!< CPU time of the last run */
+    uint32_t worstExecutionTime_us; /*!< largest CPU time of all runs */
+    uint64_t totalExecutionTime_us; /*!< sum of the CPU time of all runs */
+    uint32_t nrOfRuns;              /*!< number of completed runs */
+    uint32_t nrOfOverruns;          /*!< number of runs that exceeded the deadline */
+} ALGO_STATISTICS_s;
+
 /** Struct representing the key parameters of an algorithm */
 typedef struct ALGO_TASKS {
     ALGO_STATE_e state;                               /*!< current execution state */
-    uint32_t cycleTime_ms;                            /*!< cycle time of algorithm */
-    uint32_t maxCalculationDuration_ms;               /*!< maximum allowed calculation duration for task */
-    uint32_t startTime;                               /*!< start time when executing algorithm */
+    uint32_t period_ms;                               /*!< period of a cyclic algorithm, 0 runs it in every slot */
+    uint32_t phase_ms;                                /*!< offset of the first release of a cyclic algorithm */
+    uint32_t deadline_us;                             /*!< maximum allowed CPU time of one run */
+    ALGO_TRIGGER_e trigger;                           /*!< event that releases the algorithm */
+    DATA_BLOCK_ID_e triggerBlockId;                   /*!< database entry that releases a data triggered algorithm */
     ALGO_INITIALIZATION_FUNCTION_f *fpInitialization; /*!< callback function for init;
         set to #NULL_PTR if not needed; return #STD_OK if init successful */
     ALGO_COMPUTATION_FUNCTION_f *fpAlgorithm;         /*!< callback function */
+    uint32_t nextRelease_ms;                          /*!< runtime: scheduler time of the next cyclic release */
+    uint32_t startCycle;                              /*!< runtime: cycle counter value at the start of the run */
+    ALGO_STATISTICS_s statistics;                     /*!< runtime: execution time statistics */
 } ALGO_TASKS_s;
 
 /*========== Extern Constant and Variable Declarations ======================*/
@@ -54,113 +54,91 @@
 /*========== Includes =======================================================*/
 #include "moving_average.h"
 
+#include "algorithm_cfg.h"
 #include "database.h"
+#include "sliding_window.h"
 
 /*========== Macros and Definitions =========================================*/
-/** TODO */
-#define MEM_EXT_SDRAM
 
+/** time between two current samples, the algorithm can not sample faster than it is called */
 #if ALGO_TICK_MS > ISA_CURRENT_CYCLE_TIME_MS
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_1s  ((1000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_5s  ((5000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_10s ((10000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_30s ((30000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_60s ((60000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_CFG (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ALGO_TICK_MS)
+#define ALGO_CURRENT_SAMPLE_TIME_MS (ALGO_TICK_MS)
 #else
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_1s  ((1000u) / ISA_CURRENT_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_5s  ((5000u) / ISA_CURRENT_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_10s ((10000u) / ISA_CURRENT_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_30s ((30000u) / ISA_CURRENT_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_60s ((60000u) / ISA_CURRENT_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_CUR_CFG (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ISA_CURRENT_CYCLE_TIME_MS)
+#define ALGO_CURRENT_SAMPLE_TIME_MS (ISA_CURRENT_CYCLE_TIME_MS)
 #endif
 
+/** time between two power samples, the algorithm can not sample faster than it is called */
 #if ALGO_TICK_MS > ISA_POWER_CYCLE_TIME_MS
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_1s  ((1000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_5s  ((5000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_10s ((10000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_30s ((30000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_60s ((60000u) / ALGO_TICK_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_CFG (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ALGO_TICK_MS)
+#define ALGO_POWER_SAMPLE_TIME_MS (ALGO_TICK_MS)
 #else
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_1s  ((1000u) / ISA_POWER_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_5s  ((5000u) / ISA_POWER_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_10s ((10000u) / ISA_POWER_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_30s ((30000u) / ISA_POWER_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_60s ((60000u) / ISA_POWER_CYCLE_TIME_MS)
-#define ALGO_NUMBER_AVERAGE_VALUES_POW_CFG (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ISA_POWER_CYCLE_TIME_MS)
+#define ALGO_POWER_SAMPLE_TIME_MS (ISA_POWER_CYCLE_TIME_MS)
 #endif
 
-/*========== Static Constant and Variable Definitions =======================*/
-
-/* Arrays in extern SDRAM to calculate moving average current and power */
+/** longest fixed window */
+#define ALGO_LONGEST_FIXED_WINDOW_MS (60000u)
 
-/* Check if minimum algo cycle time > current sensor sample time */
-#if ALGO_TICK_MS > ISA_CURRENT_CYCLE_TIME_MS
-#if MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ALGO_TICK_MS > 60000u / ALGO_TICK_MS
-/* If array length of configured time > 60s array take this array size */
-static float MEM_EXT_SDRAM curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ALGO_TICK_MS) + 1u] = {};
-static uint32_t movingAverageCurrentLength = (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ALGO_TICK_MS) + 1u;
+/** number of samples in the ring buffers, large enough for the longest window @{*/
+#if MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS > ALGO_LONGEST_FIXED_WINDOW_MS
+#define ALGO_CURRENT_BUFFER_LENGTH (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ALGO_CURRENT_SAMPLE_TIME_MS)
 #else
-/* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM curValues[(60000u / ALGO_TICK_MS) + 1u] = {};
-static uint32_t movingAverageCurrentLength                         = (60000u / ALGO_TICK_MS) + 1;
+#define ALGO_CURRENT_BUFFER_LENGTH (ALGO_LONGEST_FIXED_WINDOW_MS / ALGO_CURRENT_SAMPLE_TIME_MS)
 #endif
+#if MOVING_AVERAGE_DURATION_POWER_CONFIG_MS > ALGO_LONGEST_FIXED_WINDOW_MS
+#define ALGO_POWER_BUFFER_LENGTH (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ALGO_POWER_SAMPLE_TIME_MS)
 #else
-/* If array length of configured time > 60s array take this array size */
-#if (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ISA_CURRENT_CYCLE_TIME_MS) > (60000u / ISA_CURRENT_CYCLE_TIME_MS)
-static float MEM_EXT_SDRAM curValues[(MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ISA_CURRENT_CYCLE_TIME_MS) + 1u] = {};
-static uint32_t movingAverageCurrentLength = (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ISA_CURRENT_CYCLE_TIME_MS) +
-                                             1u;
-#else
-/* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM curValues[(60000u / ISA_CURRENT_CYCLE_TIME_MS) + 1u] = {0.0f};
-static uint32_t movingAverageCurrentLength = (60000u / ISA_CURRENT_CYCLE_TIME_MS) + 1u;
-#endif
+#define ALGO_POWER_BUFFER_LENGTH (ALGO_LONGEST_FIXED_WINDOW_MS / ALGO_POWER_SAMPLE_TIME_MS)
 #endif
+/**@}*/
 
-/* Check if minimum algo cycle time > current sensor sample time */
-#if ALGO_TICK_MS > ISA_POWER_CYCLE_TIME_MS
-#if (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ALGO_TICK_MS) > (60000u / ALGO_TICK_MS)
-/* If array length of configured time > 60s array take this array size */
-static float MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ALGO_TICK_MS) + 1u] = {};
-static uint32_t movingAveragePowerLength = (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ALGO_TICK_MS) + 1u;
-#else
-/* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM powValues[(60000u / ALGO_TICK_MS) + 1] = {};
-static uint32_t movingAveragePowerLength                          = (60000u / ALGO_TICK_MS) + 1u;
-#endif
-#else
-#if (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ISA_POWER_CYCLE_TIME_MS) > (60000u / ISA_POWER_CYCLE_TIME_MS)
-/* If array length of configured time > 60s array take this array size */
-static float MEM_EXT_SDRAM powValues[(MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ISA_POWER_CYCLE_TIME_MS) + 1u] = {};
-static uint32_t movingAveragePowerLength = (MOVING_AVERAGE_DURATION_POWER_CONFIG_MS / ISA_POWER_CYCLE_TIME_MS) + 1u;
-#else
-/* Take array size of 60s moving average */
-static float MEM_EXT_SDRAM powValues[(60000u / ISA_POWER_CYCLE_TIME_MS) + 1u] = {0.0f};
-static uint32_t movingAveragePowerLength                                      = (60000u / ISA_POWER_CYCLE_TIME_MS) + 1u;
-#endif
-#endif
+/** number of samples of the configurable current window */
+#define ALGO_CURRENT_CONFIGURABLE_LENGTH (MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS / ALGO_CURRENT_SAMPLE_TIME_MS)
+
+/** number of instances per quantity: one per string and one for the pack */
+#define ALGO_NR_OF_INSTANCES (BS_NR_OF_STRINGS + 1u)
+
+/** index of the pack instance */
+#define ALGO_PACK_INSTANCE (BS_NR_OF_STRINGS)
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** duration of the current windows in ms */
+static const uint32_t algo_currentWindowDuration_ms[DATA_MOVING_AVERAGE_NR_OF_WINDOWS] = {
+    [DATA_MOVING_AVERAGE_WINDOW_1s]           = 1000u,
+    [DATA_MOVING_AVERAGE_WINDOW_5s]           = 5000u,
+    [DATA_MOVING_AVERAGE_WINDOW_10s]          = 10000u,
+    [DATA_MOVING_AVERAGE_WINDOW_30s]          = 30000u,
+    [DATA_MOVING_AVERAGE_WINDOW_60s]          = ALGO_LONGEST_FIXED_WINDOW_MS,
+    [DATA_MOVING_AVERAGE_WINDOW_CONFIGURABLE] = MOVING_AVERAGE_DURATION_CURRENT_CONFIG_MS,
+};
+
+/** duration of the power windows in ms */
+static const uint32_t algo_powerWindowDuration_ms[DATA_MOVING_AVERAGE_NR_OF_WINDOWS] = {
+    [DATA_MOVING_AVERAGE_WINDOW_1s]           = 1000u,
+    [DATA_MOVING_AVERAGE_WINDOW_5s]           = 5000u,
+    [DATA_MOVING_AVERAGE_WINDOW_10s]          = 10000u,
+    [DATA_MOVING_AVERAGE_WINDOW_30s]          = 30000u,
+    [DATA_MOVING_AVERAGE_WINDOW_60s]          = ALGO_LONGEST_FIXED_WINDOW_MS,
+    [DATA_MOVING_AVERAGE_WINDOW_CONFIGURABLE] = MOVING_AVERAGE_DURATION_POWER_CONFIG_MS,
+};
+
+/** ring buffers with the latest samples @{*/
+static int32_t algo_currentSamples_mA[ALGO_NR_OF_INSTANCES][ALGO_CURRENT_BUFFER_LENGTH] = {0};
+static int32_t algo_powerSamples_W[ALGO_NR_OF_INSTANCES][ALGO_POWER_BUFFER_LENGTH]      = {0};
+/**@}*/
+
+/** storage of the minimum and maximum of the configurable string current window @{*/
+static uint16_t algo_currentMinimumIndex[BS_NR_OF_STRINGS][ALGO_CURRENT_CONFIGURABLE_LENGTH] = {0};
+static uint16_t algo_currentMaximumIndex[BS_NR_OF_STRINGS][ALGO_CURRENT_CONFIGURABLE_LENGTH] = {0};
+/**@}*/
 
-/** Pointer for current moving average calculation @{*/
-static float *pMovingAverageCurrrentNew = &curValues[0];
-static float *pMovingAverageCurrrent_1s = &curValues[0];
-static float *pMovingAverageCurrent_5s  = &curValues[0];
-static float *pMovingAverageCurrent_10s = &curValues[0];
-static float *pMovingAverageCurrent_30s = &curValues[0];
-static float *pMovingAverageCurrent_60s = &curValues[0];
-static float *pMovingAverageCurrent_cfg = &curValues[0];
+/** windows over the ring buffers @{*/
+static SLW_WINDOW_s algo_currentWindows[ALGO_NR_OF_INSTANCES][DATA_MOVING_AVERAGE_NR_OF_WINDOWS] = {0};
+static SLW_WINDOW_s algo_powerWindows[ALGO_NR_OF_INSTANCES][DATA_MOVING_AVERAGE_NR_OF_WINDOWS]   = {0};
 /**@}*/
 
-/** Pointer for power moving average calculation @{*/
-static float *pMovingAveragePowerNew  = &powValues[0];
-static float *pMovingAveragePower_1s  = &powValues[0];
-static float *pMovingAveragePower_5s  = &powValues[0];
-static float *pMovingAveragePower_10s = &powValues[0];
-static float *pMovingAveragePower_30s = &powValues[0];
-static float *pMovingAveragePower_60s = &powValues[0];
-static float *pMovingAveragePower_cfg = &powValues[0];
+/** sliding window instances, one per string and one for the pack @{*/
+static SLW_INSTANCE_s algo_current[ALGO_NR_OF_INSTANCES] = {0};
+static SLW_INSTANCE_s algo_power[ALGO_NR_OF_INSTANCES]   = {0};
 /**@}*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
@@ -170,265 +148,111 @@ static float *pMovingAveragePower_cfg = &powValues[0];
 /*========== Static Function Implementations ================================*/
 
 /*========== Extern Function Implementations ================================*/
-extern void ALGO_MovAverage() {
+extern STD_RETURN_TYPE_e ALGO_InitializeMovingAverage(void) {
+    for (uint8_t instance = 0u; instance < ALGO_NR_OF_INSTANCES; instance++) {
+        for (uint8_t window = 0u; window < DATA_MOVING_AVERAGE_NR_OF_WINDOWS; window++) {
+            uint16_t *pMinimumStorage = NULL_PTR;
+            uint16_t *pMaximumStorage = NULL_PTR;
+            if ((instance != ALGO_PACK_INSTANCE) && (window == DATA_MOVING_AVERAGE_WINDOW_CONFIGURABLE)) {
+                pMinimumStorage = algo_currentMinimumIndex[instance];
+                pMaximumStorage = algo_currentMaximumIndex[instance];
+            }
+            SLW_InitializeWindow(
+                &algo_currentWindows[instance][window],
+                (uint16_t)(algo_currentWindowDuration_ms[window] / ALGO_CURRENT_SAMPLE_TIME_MS),
+                pMinimumStorage,
+                pMaximumStorage);
+            SLW_InitializeWindow(
+                &algo_powerWindows[instance][window],
+                (uint16_t)(algo_powerWindowDuration_ms[window] / ALGO_POWER_SAMPLE_TIME_MS),
+                NULL_PTR,
+                NULL_PTR);
+        }
+        SLW_Initialize(
+            &algo_current[instance],
+            algo_currentSamples_mA[instance],
+            ALGO_CURRENT_BUFFER_LENGTH,
+            algo_currentWindows[instance],
+            DATA_MOVING_AVERAGE_NR_OF_WINDOWS,
+            MOVING_AVERAGE_RECOMPUTATION_PERIOD);
+        SLW_Initialize(
+            &algo_power[instance],
+            algo_powerSamples_W[instance],
+            ALGO_POWER_BUFFER_LENGTH,
+            algo_powerWindows[instance],
+            DATA_MOVING_AVERAGE_NR_OF_WINDOWS,
+            MOVING_AVERAGE_RECOMPUTATION_PERIOD);
+    }
+    return STD_OK;
+}
+
+extern void ALGO_MovAverage(void) {
     static uint8_t curCounter                            = 0u;
     static uint8_t powCounter                            = 0u;
     static DATA_BLOCK_CURRENT_SENSOR_s curPow_tab        = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
     static DATA_BLOCK_MOVING_AVERAGE_s movingAverage_tab = {.header.uniqueId = DATA_BLOCK_ID_MOVING_AVERAGE};
-    static uint8_t curInit   = 0u; /* bit0: 1s, bit1: 5s, bit2: 10s, bit3: 30s, bit4: 60s, bit5: cfg */
-    static uint8_t powInit   = 0u; /* bit0: 1s, bit1: 5s, bit2: 10s, bit3: 30s, bit4: 60s, bit5: cfg */
-    static uint8_t newValues = 0u;
-    float divider            = 0.0f;
-    bool validValues         = true;
+    bool newValues                                       = false;
 
     DATA_READ_DATA(&curPow_tab);
-    DATA_READ_DATA(&movingAverage_tab);
 
     /* Check if new current value */
     if (curCounter != curPow_tab.newCurrent) {
-        curCounter = curPow_tab.newCurrent;
-
-        /* Check if valid values */
+        curCounter          = curPow_tab.newCurrent;
+        bool validValues    = true;
+        int32_t packCurrent = 0;
         for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
-            if (curPow_tab.invalidCurrentMeasurement[stringNumber] != 0u) {
+            if (curPow_tab.invalidCurrentMeasurement[stringNumber] == 0u) {
+                SLW_AddSample(&algo_current[stringNumber], curPow_tab.current_mA[stringNumber]);
+                packCurrent += curPow_tab.current_mA[stringNumber];
+            } else {
                 validValues = false;
             }
         }
-
+        /* the pack current is only valid if all strings have been measured */
         if (validValues == true) {
-            /* new Values -> Save later in database */
-            newValues = 1u;
-
-            int32_t packCurrent = 0;
-            for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
-                packCurrent += curPow_tab.current_mA[stringNumber];
-            }
-
-            /* Add value to array and calculate new moving average values */
-            *pMovingAverageCurrrentNew = packCurrent;
-
-            /* Calculate new moving average - first add new value */
-            divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_1s;
-            movingAverage_tab.movingAverageCurrent1sInterval_mA += (*pMovingAverageCurrrentNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_5s;
-            movingAverage_tab.movingAverageCurrent5sInterval_mA += (*pMovingAverageCurrrentNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_10s;
-            movingAverage_tab.movingAverageCurrent10sInterval_mA += (*pMovingAverageCurrrentNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_30s;
-            movingAverage_tab.movingAverageCurrent30sInterval_mA += (*pMovingAverageCurrrentNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_60s;
-            movingAverage_tab.movingAverageCurrent60sInterval_mA += (*pMovingAverageCurrrentNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_CFG;
-            movingAverage_tab.movingAverageCurrentConfigurableInterval_mA += (*pMovingAverageCurrrentNew) / divider;
-
-            /* Then, increment pointer and substract oldest value when respective window is filled with data */
-            pMovingAverageCurrrentNew++;
-            if ((curInit & 0x01u) == 0x01u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_1s;
-                movingAverage_tab.movingAverageCurrent1sInterval_mA -= ((*pMovingAverageCurrrent_1s) / divider);
-                pMovingAverageCurrrent_1s++;
-            } else {
-                if (pMovingAverageCurrrentNew == &curValues[ALGO_NUMBER_AVERAGE_VALUES_CUR_1s]) {
-                    curInit |= 0x01u;
-                }
-            }
-            if ((curInit & 0x02u) == 0x02u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_5s;
-                movingAverage_tab.movingAverageCurrent5sInterval_mA -= (*pMovingAverageCurrent_5s) / divider;
-                pMovingAverageCurrent_5s++;
-            } else {
-                if (pMovingAverageCurrrentNew == &curValues[ALGO_NUMBER_AVERAGE_VALUES_CUR_5s]) {
-                    curInit |= 0x02u;
-                }
-            }
-            if ((curInit & 0x04u) == 0x04u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_10s;
-                movingAverage_tab.movingAverageCurrent10sInterval_mA -= (*pMovingAverageCurrent_10s) / divider;
-                pMovingAverageCurrent_10s++;
-            } else {
-                if (pMovingAverageCurrrentNew == &curValues[ALGO_NUMBER_AVERAGE_VALUES_CUR_10s]) {
-                    curInit |= 0x04u;
-                }
-            }
-            if ((curInit & 0x08u) == 0x08u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_30s;
-                movingAverage_tab.movingAverageCurrent30sInterval_mA -= (*pMovingAverageCurrent_30s) / divider;
-                pMovingAverageCurrent_30s++;
-            } else {
-                if (pMovingAverageCurrrentNew == &curValues[ALGO_NUMBER_AVERAGE_VALUES_CUR_30s]) {
-                    curInit |= 0x08u;
-                }
-            }
-            if ((curInit & 0x10u) == 0x10u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_60s;
-                movingAverage_tab.movingAverageCurrent60sInterval_mA -= (*pMovingAverageCurrent_60s) / divider;
-                pMovingAverageCurrent_60s++;
-            } else {
-                if (pMovingAverageCurrrentNew == &curValues[ALGO_NUMBER_AVERAGE_VALUES_CUR_60s]) {
-                    curInit |= 0x10u;
-                }
-            }
-            if ((curInit & 0x20u) == 0x20u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_CUR_CFG;
-                movingAverage_tab.movingAverageCurrentConfigurableInterval_mA -= (*pMovingAverageCurrent_cfg) / divider;
-                pMovingAverageCurrent_cfg++;
-            } else {
-                if (pMovingAverageCurrrentNew == &curValues[ALGO_NUMBER_AVERAGE_VALUES_CUR_CFG]) {
-                    curInit |= 0x20u;
-                }
-            }
-
-            /* Check pointer for buffer overflow */
-            if (pMovingAverageCurrrentNew > &curValues[movingAverageCurrentLength - 1u]) {
-                pMovingAverageCurrrentNew = &curValues[0u];
-            }
-            if (pMovingAverageCurrrent_1s > &curValues[movingAverageCurrentLength - 1u]) {
-                pMovingAverageCurrrent_1s = &curValues[0u];
-            }
-            if (pMovingAverageCurrent_5s > &curValues[movingAverageCurrentLength - 1u]) {
-                pMovingAverageCurrent_5s = &curValues[0u];
-            }
-            if (pMovingAverageCurrent_10s > &curValues[movingAverageCurrentLength - 1u]) {
-                pMovingAverageCurrent_10s = &curValues[0u];
-            }
-            if (pMovingAverageCurrent_30s > &curValues[movingAverageCurrentLength - 1u]) {
-                pMovingAverageCurrent_30s = &curValues[0u];
-            }
-            if (pMovingAverageCurrent_60s > &curValues[movingAverageCurrentLength - 1u]) {
-                pMovingAverageCurrent_60s = &curValues[0u];
-            }
-            if (pMovingAverageCurrent_cfg > &curValues[movingAverageCurrentLength - 1u]) {
-                pMovingAverageCurrent_cfg = &curValues[0u];
-            }
+            SLW_AddSample(&algo_current[ALGO_PACK_INSTANCE], packCurrent);
         }
+        newValues = true;
     }
 
-    validValues = true;
-
     /* Check if new power value */
     if (powCounter != curPow_tab.newPower) {
-        powCounter = curPow_tab.newPower;
-
-        /* Check if valid values */
+        powCounter        = curPow_tab.newPower;
+        bool validValues  = true;
+        int32_t packPower = 0;
         for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
-            if (curPow_tab.invalidPowerMeasurement[stringNumber] != 0u) {
+            if (curPow_tab.invalidPowerMeasurement[stringNumber] == 0u) {
+                SLW_AddSample(&algo_power[stringNumber], curPow_tab.power_W[stringNumber]);
+                packPower += curPow_tab.power_W[stringNumber];
+            } else {
                 validValues = false;
             }
         }
         if (validValues == true) {
-            newValues = 1u;
+            SLW_AddSample(&algo_power[ALGO_PACK_INSTANCE], packPower);
+        }
+        newValues = true;
+    }
 
-            int32_t packPower = 0;
+    if (newValues == true) {
+        for (uint8_t window = 0u; window < DATA_MOVING_AVERAGE_NR_OF_WINDOWS; window++) {
+            movingAverage_tab.packCurrent_mA[window] = SLW_GetAverage(&algo_current[ALGO_PACK_INSTANCE], window);
+            movingAverage_tab.packPower_W[window]    = SLW_GetAverage(&algo_power[ALGO_PACK_INSTANCE], window);
             for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
-                packPower += curPow_tab.power_W[stringNumber];
-            }
-
-            /* Add value to array and calculate new moving mean values */
-            *pMovingAveragePowerNew = packPower;
-
-            /* Calculate new moving means - first add new value */
-            divider = ALGO_NUMBER_AVERAGE_VALUES_POW_1s;
-            movingAverage_tab.movingAveragePower1sInterval_mA += (*pMovingAveragePowerNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_POW_5s;
-            movingAverage_tab.movingAveragePower5sInterval_mA += (*pMovingAveragePowerNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_POW_10s;
-            movingAverage_tab.movingAveragePower10sInterval_mA += (*pMovingAveragePowerNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_POW_30s;
-            movingAverage_tab.movingAveragePower30sInterval_mA += (*pMovingAveragePowerNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_POW_60s;
-            movingAverage_tab.movingAveragePower60sInterval_mA += (*pMovingAveragePowerNew) / divider;
-            divider = ALGO_NUMBER_AVERAGE_VALUES_POW_CFG;
-            movingAverage_tab.movingAveragePowerConfigurableInterval_mA += (*pMovingAveragePowerNew) / divider;
-
-            /* Then, increment pointer and substract oldest value when respective window is filled with data */
-            pMovingAveragePowerNew++;
-            if ((powInit & 0x01u) == 0x01u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_POW_1s;
-                movingAverage_tab.movingAveragePower1sInterval_mA -= ((*pMovingAveragePower_1s) / divider);
-                pMovingAveragePower_1s++;
-            } else {
-                if (pMovingAveragePowerNew == &powValues[ALGO_NUMBER_AVERAGE_VALUES_POW_1s]) {
-                    powInit |= 0x01u;
-                }
-            }
-            if ((powInit & 0x02u) == 0x02u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_POW_5s;
-                movingAverage_tab.movingAveragePower5sInterval_mA -= ((*pMovingAveragePower_5s) / divider);
-                pMovingAveragePower_5s++;
-            } else {
-                if (pMovingAveragePowerNew == &powValues[ALGO_NUMBER_AVERAGE_VALUES_POW_5s]) {
-                    powInit |= 0x02u;
-                }
-            }
-            if ((powInit & 0x04u) == 0x04u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_POW_10s;
-                movingAverage_tab.movingAveragePower10sInterval_mA -= ((*pMovingAveragePower_10s) / divider);
-                pMovingAveragePower_10s++;
-            } else {
-                if (pMovingAveragePowerNew == &powValues[ALGO_NUMBER_AVERAGE_VALUES_POW_10s]) {
-                    powInit |= 0x04u;
-                }
-            }
-            if ((powInit & 0x08u) == 0x08u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_POW_30s;
-                movingAverage_tab.movingAveragePower30sInterval_mA -= ((*pMovingAveragePower_30s) / divider);
-                pMovingAveragePower_30s++;
-            } else {
-                if (pMovingAveragePowerNew == &powValues[ALGO_NUMBER_AVERAGE_VALUES_POW_30s]) {
-                    powInit |= 0x08u;
-                }
-            }
-            if ((powInit & 0x10u) == 0x10u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_POW_60s;
-                movingAverage_tab.movingAveragePower60sInterval_mA -= ((*pMovingAveragePower_60s) / divider);
-                pMovingAveragePower_60s++;
-            } else {
-                if (pMovingAveragePowerNew == &powValues[ALGO_NUMBER_AVERAGE_VALUES_POW_60s]) {
-                    powInit |= 0x10u;
-                }
-            }
-            if ((powInit & 0x20u) == 0x20u) {
-                divider = ALGO_NUMBER_AVERAGE_VALUES_POW_CFG;
-                movingAverage_tab.movingAveragePowerConfigurableInterval_mA -= ((*pMovingAveragePower_cfg) / divider);
-                pMovingAveragePower_cfg++;
-            } else {
-                if (pMovingAveragePowerNew == &powValues[ALGO_NUMBER_AVERAGE_VALUES_POW_CFG]) {
-                    powInit |= 0x20u;
-                }
-            }
-
-            /* Check pointer for buffer overflow */
-            if (pMovingAveragePowerNew > &powValues[movingAveragePowerLength - 1u]) {
-                pMovingAveragePowerNew = &powValues[0u];
-            }
-            if (pMovingAveragePower_1s > &powValues[movingAveragePowerLength - 1u]) {
-                pMovingAveragePower_1s = &powValues[0u];
-            }
-            if (pMovingAveragePower_5s > &powValues[movingAveragePowerLength - 1u]) {
-                pMovingAveragePower_5s = &powValues[0u];
-            }
-            if (pMovingAveragePower_10s > &powValues[movingAveragePowerLength - 1u]) {
-                pMovingAveragePower_10s = &powValues[0u];
-            }
-            if (pMovingAveragePower_30s > &powValues[movingAveragePowerLength - 1u]) {
-                pMovingAveragePower_30s = &powValues[0u];
-            }
-            if (pMovingAveragePower_60s > &powValues[movingAveragePowerLength - 1u]) {
-                pMovingAveragePower_60s = &powValues[0u];
-            }
-            if (pMovingAveragePower_cfg > &powValues[movingAveragePowerLength - 1u]) {
-                pMovingAveragePower_cfg = &powValues[0u];
+                movingAverage_tab.stringCurrent_mA[stringNumber][window] =
+                    SLW_GetAverage(&algo_current[stringNumber], window);
+                movingAverage_tab.stringPower_W[stringNumber][window] =
+                    SLW_GetAverage(&algo_power[stringNumber], window);
             }
         }
-    }
-
-    if (newValues == 1u) {
-        newValues = 0;
-
+        for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
+            movingAverage_tab.minimumStringCurrent_mA[stringNumber] =
+                SLW_GetMinimum(&algo_current[stringNumber], DATA_MOVING_AVERAGE_WINDOW_CONFIGURABLE);
+            movingAverage_tab.maximumStringCurrent_mA[stringNumber] =
+                SLW_GetMaximum(&algo_current[stringNumber], DATA_MOVING_AVERAGE_WINDOW_CONFIGURABLE);
+        }
         DATA_WRITE_DATA(&movingAverage_tab);
     }
-
-    return;
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -65,9 +65,21 @@
 #define ISA_CURRENT_CYCLE_TIME_MS (200u)
 #define ISA_POWER_CYCLE_TIME_MS   (200u)
 
+/**
+ * number of samples after which the running sum of one window is recomputed
+ * from the stored samples, 0 disables the recomputation
+ */
+#define MOVING_AVERAGE_RECOMPUTATION_PERIOD (50u)
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   initializes the windows of the moving average algorithm
+ * @return  #STD_OK
+ */
+extern STD_RETURN_TYPE_e ALGO_InitializeMovingAverage(void);
+
 /** moving average function for the algorithm module */
 extern void ALGO_MovAverage(void);
 
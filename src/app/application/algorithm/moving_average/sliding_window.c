@@ -0,0 +1,280 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sliding_window.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup ALGORITHMS
+ * @prefix  SLW
+ *
+ * @brief   Sliding window statistics over integer samples
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "sliding_window.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   Returns the age of a sample in the ring buffer.
+ * @param   pInstance   instance
+ * @param   index       position of the sample in the ring buffer
+ * @return  number of samples that have been added since the sample, 1 for
+ *          the latest sample and the length of the ring buffer for the
+ *          sample at the position of the next sample
+ */
+static uint16_t SLW_GetAge(const SLW_INSTANCE_s *pInstance, uint16_t index);
+
+/**
+ * @brief   Adds the next sample to a monotonic deque.
+ * @details Removes the oldest entry if it leaves the window and all entries
+ *          that can no longer become the minimum (or maximum) of the window.
+ * @param   pInstance   instance
+ * @param   pDeque      deque of the window
+ * @param   length      length of the window
+ * @param   value       value of the next sample
+ * @param   isMinimum   true for the minimum deque, false for the maximum deque
+ */
+static void SLW_UpdateDeque(
+    const SLW_INSTANCE_s *pInstance,
+    SLW_DEQUE_s *pDeque,
+    uint16_t length,
+    int32_t value,
+    bool isMinimum);
+
+/**
+ * @brief   Recomputes the sum of a window from the ring buffer.
+ * @param   pInstance   instance
+ * @param   window      index of the window
+ */
+static void SLW_RecomputeSum(SLW_INSTANCE_s *pInstance, uint8_t window);
+
+/*========== Static Function Implementations ================================*/
+
+static uint16_t SLW_GetAge(const SLW_INSTANCE_s *pInstance, uint16_t index) {
+    uint16_t age = pInstance->bufferLength;
+    if (index != pInstance->nextIndex) {
+        age = (uint16_t)(((uint32_t)pInstance->nextIndex + pInstance->bufferLength - index) % pInstance->bufferLength);
+    }
+    return age;
+}
+
+static void SLW_UpdateDeque(
+    const SLW_INSTANCE_s *pInstance,
+    SLW_DEQUE_s *pDeque,
+    uint16_t length,
+    int32_t value,
+    bool isMinimum) {
+    /* the sample that is added now pushes the oldest entry out of the window */
+    if ((pDeque->count > 0u) && (SLW_GetAge(pInstance, pDeque->pIndex[pDeque->head]) >= length)) {
+        pDeque->head = (pDeque->head + 1u) % length;
+        pDeque->count--;
+    }
+    /* newer entries that are not better than the new sample are never needed again */
+    bool removeNewest = true;
+    while ((pDeque->count > 0u) && (removeNewest == true)) {
+        const uint16_t newest  = (pDeque->head + pDeque->count - 1u) % length;
+        const int32_t previous = pInstance->pBuffer[pDeque->pIndex[newest]];
+        if (isMinimum == true) {
+            removeNewest = (previous >= value);
+        } else {
+            removeNewest = (previous <= value);
+        }
+        if (removeNewest == true) {
+            pDeque->count--;
+        }
+    }
+    pDeque->pIndex[(pDeque->head + pDeque->count) % length] = pInstance->nextIndex;
+    pDeque->count++;
+}
+
+static void SLW_RecomputeSum(SLW_INSTANCE_s *pInstance, uint8_t window) {
+    const uint16_t nrOfSamples = SLW_GetNumberOfSamples(pInstance, window);
+    int64_t sum                = 0;
+    uint16_t index             = pInstance->nextIndex;
+    for (uint16_t i = 0u; i < nrOfSamples; i++) {
+        index = (index == 0u) ? (pInstance->bufferLength - 1u) : (index - 1u);
+        sum += pInstance->pBuffer[index];
+    }
+    pInstance->pWindows[window].sum = sum;
+}
+
+/*========== Extern Function Implementations ================================*/
+
+extern void SLW_InitializeWindow(
+    SLW_WINDOW_s *pWindow,
+    uint16_t length,
+    uint16_t *pMinimumStorage,
+    uint16_t *pMaximumStorage) {
+    FAS_ASSERT(pWindow != NULL_PTR);
+    FAS_ASSERT(length > 0u);
+    pWindow->length         = length;
+    pWindow->minimum.pIndex = pMinimumStorage;
+    pWindow->maximum.pIndex = pMaximumStorage;
+}
+
+extern void SLW_Initialize(
+    SLW_INSTANCE_s *pInstance,
+    int32_t *pBuffer,
+    uint16_t bufferLength,
+    SLW_WINDOW_s *pWindows,
+    uint8_t nrOfWindows,
+    uint16_t recomputationPeriod) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+    FAS_ASSERT(pBuffer != NULL_PTR);
+    FAS_ASSERT(pWindows != NULL_PTR);
+    FAS_ASSERT(nrOfWindows > 0u);
+
+    pInstance->pBuffer                   = pBuffer;
+    pInstance->bufferLength              = bufferLength;
+    pInstance->pWindows                  = pWindows;
+    pInstance->nrOfWindows               = nrOfWindows;
+    pInstance->recomputationPeriod       = recomputationPeriod;
+    pInstance->nextIndex                 = 0u;
+    pInstance->nrOfSamples               = 0u;
+    pInstance->samplesSinceRecomputation = 0u;
+    pInstance->nextRecomputedWindow      = 0u;
+
+    for (uint8_t window = 0u; window < nrOfWindows; window++) {
+        /* the ring buffer has to hold all samples of every window */
+        FAS_ASSERT((pWindows[window].length > 0u) && (pWindows[window].length <= bufferLength));
+        pWindows[window].sum           = 0;
+        pWindows[window].minimum.head  = 0u;
+        pWindows[window].minimum.count = 0u;
+        pWindows[window].maximum.head  = 0u;
+        pWindows[window].maximum.count = 0u;
+    }
+}
+
+extern void SLW_AddSample(SLW_INSTANCE_s *pInstance, int32_t value) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+
+    for (uint8_t window = 0u; window < pInstance->nrOfWindows; window++) {
+        SLW_WINDOW_s *pWindow = &pInstance->pWindows[window];
+        /* remove the sample that leaves the window; it is read before the
+           ring buffer is overwritten, so a window may be as long as the buffer */
+        if (pInstance->nrOfSamples >= pWindow->length) {
+            const uint16_t oldest =
+                (uint16_t)(((uint32_t)pInstance->nextIndex + pInstance->bufferLength - pWindow->length) %
+                           pInstance->bufferLength);
+            pWindow->sum -= pInstance->pBuffer[oldest];
+        }
+        pWindow->sum += value;
+
+        if (pWindow->minimum.pIndex != NULL_PTR) {
+            SLW_UpdateDeque(pInstance, &pWindow->minimum, pWindow->length, value, true);
+        }
+        if (pWindow->maximum.pIndex != NULL_PTR) {
+            SLW_UpdateDeque(pInstance, &pWindow->maximum, pWindow->length, value, false);
+        }
+    }
+
+    pInstance->pBuffer[pInstance->nextIndex] = value;
+    pInstance->nextIndex                     = (pInstance->nextIndex + 1u) % pInstance->bufferLength;
+    if (pInstance->nrOfSamples < UINT32_MAX) {
+        pInstance->nrOfSamples++;
+    }
+
+    /* the integer sums are exact; recomputing one window at a time bounds the
+       runtime and repairs a sum that has been corrupted in memory */
+    if (pInstance->recomputationPeriod > 0u) {
+        pInstance->samplesSinceRecomputation++;
+        if (pInstance->samplesSinceRecomputation >= pInstance->recomputationPeriod) {
+            pInstance->samplesSinceRecomputation = 0u;
+            SLW_RecomputeSum(pInstance, pInstance->nextRecomputedWindow);
+            pInstance->nextRecomputedWindow = (pInstance->nextRecomputedWindow + 1u) % pInstance->nrOfWindows;
+        }
+    }
+}
+
+extern uint16_t SLW_GetNumberOfSamples(const SLW_INSTANCE_s *pInstance, uint8_t window) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+    FAS_ASSERT(window < pInstance->nrOfWindows);
+    uint16_t nrOfSamples = pInstance->pWindows[window].length;
+    if (pInstance->nrOfSamples < nrOfSamples) {
+        nrOfSamples = (uint16_t)pInstance->nrOfSamples;
+    }
+    return nrOfSamples;
+}
+
+extern float SLW_GetAverage(const SLW_INSTANCE_s *pInstance, uint8_t window) {
+    const uint16_t nrOfSamples = SLW_GetNumberOfSamples(pInstance, window);
+    float average              = 0.0f;
+    if (nrOfSamples > 0u) {
+        average = (float)pInstance->pWindows[window].sum / (float)nrOfSamples;
+    }
+    return average;
+}
+
+extern int32_t SLW_GetMinimum(const SLW_INSTANCE_s *pInstance, uint8_t window) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+    FAS_ASSERT(window < pInstance->nrOfWindows);
+    const SLW_DEQUE_s *pDeque = &pInstance->pWindows[window].minimum;
+    FAS_ASSERT(pDeque->pIndex != NULL_PTR);
+    int32_t minimum = 0;
+    if (pDeque->count > 0u) {
+        minimum = pInstance->pBuffer[pDeque->pIndex[pDeque->head]];
+    }
+    return minimum;
+}
+
+extern int32_t SLW_GetMaximum(const SLW_INSTANCE_s *pInstance, uint8_t window) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+    FAS_ASSERT(window < pInstance->nrOfWindows);
+    const SLW_DEQUE_s *pDeque = &pInstance->pWindows[window].maximum;
+    FAS_ASSERT(pDeque->pIndex != NULL_PTR);
+    int32_t maximum = 0;
+    if (pDeque->count > 0u) {
+        maximum = pInstance->pBuffer[pDeque->pIndex[pDeque->head]];
+    }
+    return maximum;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
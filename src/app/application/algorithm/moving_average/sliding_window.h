@@ -0,0 +1,179 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sliding_window.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup ALGORITHMS
+ * @prefix  SLW
+ *
+ * @brief   Sliding window statistics over integer samples
+ *
+ * @details An instance holds the latest samples of one quantity in a ring
+ *          buffer that is shared by any number of windows. Every window keeps
+ *          an integer running sum of its samples, so that the average can be
+ *          calculated without drift. Minimum and maximum are tracked with
+ *          monotonic deques for the windows that provide storage for them.
+ *          The memory of an instance is provided by the user, so that the
+ *          engine can be used for any quantity.
+ *
+ */
+
+#ifndef FOXBMS__SLIDING_WINDOW_H_
+#define FOXBMS__SLIDING_WINDOW_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/** monotonic deque of buffer indices, used for the minimum and maximum of a window */
+typedef struct {
+    uint16_t *pIndex; /*!< storage with one entry per sample of the window, #NULL_PTR if disabled */
+    uint16_t head;    /*!< position of the oldest entry in the storage */
+    uint16_t count;   /*!< number of entries */
+} SLW_DEQUE_s;
+
+/** state of one window of an instance */
+typedef struct {
+    uint16_t length;     /*!< number of samples in the window */
+    int64_t sum;         /*!< sum of the samples in the window */
+    SLW_DEQUE_s minimum; /*!< candidates for the minimum, the oldest is the minimum */
+    SLW_DEQUE_s maximum; /*!< candidates for the maximum, the oldest is the maximum */
+} SLW_WINDOW_s;
+
+/** instance of the sliding window statistics for one quantity */
+typedef struct {
+    int32_t *pBuffer;                   /*!< ring buffer with the latest samples */
+    uint16_t bufferLength;              /*!< length of the ring buffer, at least the longest window */
+    SLW_WINDOW_s *pWindows;             /*!< windows over the ring buffer */
+    uint8_t nrOfWindows;                /*!< number of windows */
+    uint16_t recomputationPeriod;       /*!< number of samples after which the sum of one window is recomputed */
+    uint16_t nextIndex;                 /*!< position in the ring buffer for the next sample */
+    uint32_t nrOfSamples;               /*!< number of samples since initialization, saturated */
+    uint16_t samplesSinceRecomputation; /*!< samples since the last recomputation of a sum */
+    uint8_t nextRecomputedWindow;       /*!< window whose sum is recomputed next */
+} SLW_INSTANCE_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Sets the length and the minimum/maximum storage of a window.
+ * @details Has to be called for all windows before #SLW_Initialize().
+ * @param   pWindow             window
+ * @param   length              number of samples in the window
+ * @param   pMinimumStorage     storage with length entries for the minimum, #NULL_PTR if not needed
+ * @param   pMaximumStorage     storage with length entries for the maximum, #NULL_PTR if not needed
+ */
+extern void SLW_InitializeWindow(
+    SLW_WINDOW_s *pWindow,
+    uint16_t length,
+    uint16_t *pMinimumStorage,
+    uint16_t *pMaximumStorage);
+
+/**
+ * @brief   Initializes an instance and discards all samples.
+ * @param   pInstance           instance
+ * @param   pBuffer             ring buffer with bufferLength entries
+ * @param   bufferLength        length of the ring buffer, at least the length of the longest window
+ * @param   pWindows            windows, set up with #SLW_InitializeWindow()
+ * @param   nrOfWindows         number of windows
+ * @param   recomputationPeriod number of samples after which the sum of the next window is recomputed
+ *                              from the ring buffer, 0 to disable the recomputation
+ */
+extern void SLW_Initialize(
+    SLW_INSTANCE_s *pInstance,
+    int32_t *pBuffer,
+    uint16_t bufferLength,
+    SLW_WINDOW_s *pWindows,
+    uint8_t nrOfWindows,
+    uint16_t recomputationPeriod);
+
+/**
+ * @brief   Adds a sample to all windows of an instance.
+ * @param   pInstance   instance
+ * @param   value       sample
+ */
+extern void SLW_AddSample(SLW_INSTANCE_s *pInstance, int32_t value);
+
+/**
+ * @brief   Returns the number of samples that are currently in a window.
+ * @details This is less than the length of the window until enough samples
+ *          have been added.
+ * @param   pInstance   instance
+ * @param   window      index of the window
+ * @return  number of samples in the window
+ */
+extern uint16_t SLW_GetNumberOfSamples(const SLW_INSTANCE_s *pInstance, uint8_t window);
+
+/**
+ * @brief   Returns the average of the samples in a window.
+ * @param   pInstance   instance
+ * @param   window      index of the window
+ * @return  average, 0 if the window does not contain samples
+ */
+extern float SLW_GetAverage(const SLW_INSTANCE_s *pInstance, uint8_t window);
+
+/**
+ * @brief   Returns the minimum of the samples in a window.
+ * @details The window must have been set up with a minimum storage.
+ * @param   pInstance   instance
+ * @param   window      index of the window
+ * @return  minimum, 0 if the window does not contain samples
+ */
+extern int32_t SLW_GetMinimum(const SLW_INSTANCE_s *pInstance, uint8_t window);
+
+/**
+ * @brief   Returns the maximum of the samples in a window.
+ * @details The window must have been set up with a maximum storage.
+ * @param   pInstance   instance
+ * @param   window      index of the window
+ * @return  maximum, 0 if the window does not contain samples
+ */
+extern int32_t SLW_GetMaximum(const SLW_INSTANCE_s *pInstance, uint8_t window);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__SLIDING_WINDOW_H_ */
@@ -58,6 +58,7 @@
 #include "database.h"
 #include "foxmath.h"
 #include "fram.h"
+#include "sox_counter.h"
 
 /*========== Macros and Definitions =========================================*/
 /** This structure contains all the variables relevant for the SOX */
@@ -68,6 +69,8 @@ typedef struct SOC_STATE {
     float ccScalingMinimum[BS_NR_OF_STRINGS]; /*!< current sensor offset scaling value for minimum SOC */
     float ccScalingMaximum[BS_NR_OF_STRINGS]; /*!< current sensor offset scaling value for maximum SOC */
     uint32_t previousTimestamp[BS_NR_OF_STRINGS]; /*!< timestamp buffer to check if current/CC data has been updated */
+    SOX_COUNTER_s counter[BS_NR_OF_STRINGS];      /*!< fixed-point charge counter if the sensor CC is not used */
+    SOX_REFERENCE_s reference[BS_NR_OF_STRINGS];  /*!< SOC values at the last calibration of the counter */
 } SOC_STATE_s;
 
 /*========== Static Constant and Variable Definitions =======================*/
@@ -180,6 +183,19 @@ static void SOC_SetValue(
         soc_state.ccScalingMaximum[stringNumber] = soc_tableSocValues.maximumSoc_perc[stringNumber] + ccOffset_perc;
     }
 
+#if SOC_USE_FIXED_POINT_COUNTING == true
+    if (soc_state.sensorCcUsed[stringNumber] == false) {
+        /* Recalibrate reference of the counter */
+        SOX_SetReference(
+            &soc_state.reference[stringNumber],
+            SOC_STRING_CAPACITY_mAs,
+            soc_state.counter[stringNumber].dischargedCharge_mAs,
+            socMinimumValue_perc,
+            socAverageValue_perc,
+            socMaximumValue_perc);
+    }
+#endif /* SOC_USE_FIXED_POINT_COUNTING == true */
+
     /* Limit SOC values to [0.0, 100.0] */
     SOC_CheckDatabaseSocPercentageLimits(&soc_tableSocValues, stringNumber);
 
@@ -254,6 +270,18 @@ void SOC_Init(bool ccPresent, uint8_t stringNumber) {
     } else {
         soc_state.previousTimestamp[stringNumber] = soc_tableCurrentSensor.timestampCurrent[stringNumber];
         soc_state.sensorCcUsed[stringNumber]      = false;
+
+#if SOC_USE_FIXED_POINT_COUNTING == true
+        /* Count from the SOC values that are stored in the FRAM */
+        SOX_InitializeCounter(&soc_state.counter[stringNumber], soc_tableCurrentSensor.timestampCurrent[stringNumber]);
+        SOX_SetReference(
+            &soc_state.reference[stringNumber],
+            SOC_STRING_CAPACITY_mAs,
+            0,
+            fram_soc.minimumSoc_perc[stringNumber],
+            fram_soc.averageSoc_perc[stringNumber],
+            fram_soc.maximumSoc_perc[stringNumber]);
+#endif /* SOC_USE_FIXED_POINT_COUNTING == true */
     }
     soc_state.socInitialized = true;
     DATA_WRITE_DATA(&soc_tableSocValues);
@@ -279,6 +307,24 @@ void SOC_Calculation(void) {
                     /* check if current measurement has been updated */
                     if (soc_state.previousTimestamp[stringNumber] !=
                         soc_tableCurrentSensor.timestampCurrent[stringNumber]) {
+#if SOC_USE_FIXED_POINT_COUNTING == true
+                        SOX_AddSample(
+                            &soc_state.counter[stringNumber],
+                            soc_tableCurrentSensor.current_mA[stringNumber],
+                            soc_tableCurrentSensor.highVoltage_mV[stringNumber][0],
+                            soc_tableCurrentSensor.timestampCurrent[stringNumber]);
+
+                        /* Convert to percent only for the database, limited to [0.0, 100.0] */
+                        SOX_GetPercentages(
+                            &soc_state.reference[stringNumber],
+                            soc_state.counter[stringNumber].dischargedCharge_mAs,
+                            &soc_tableSocValues.minimumSoc_perc[stringNumber],
+                            &soc_tableSocValues.averageSoc_perc[stringNumber],
+                            &soc_tableSocValues.maximumSoc_perc[stringNumber]);
+
+                        /* Update values in non-volatile memory */
+                        SOC_UpdateNvmValues(&soc_tableSocValues, stringNumber);
+#else  /* SOC_USE_FIXED_POINT_COUNTING == true */
                         float timestep_s =
                             ((float)(soc_tableCurrentSensor.timestampCurrent[stringNumber] - soc_state.previousTimestamp[stringNumber])) /
                             1000.0f;
@@ -308,6 +354,7 @@ void SOC_Calculation(void) {
                             /* Update values in non-volatile memory */
                             SOC_UpdateNvmValues(&soc_tableSocValues, stringNumber);
                         }
+#endif /* SOC_USE_FIXED_POINT_COUNTING == true */
                         soc_state.previousTimestamp[stringNumber] =
                             soc_tableCurrentSensor.timestampCurrent[stringNumber];
                     } /* end check if current measurement has been updated */
@@ -343,7 +390,7 @@ void SOC_Calculation(void) {
                 }
             }
             /* Update database and FRAM value */
-            FRAM_Write(FRAM_BLOCK_ID_SOC);
+            FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
             DATA_WRITE_DATA(&soc_tableSocValues);
         }
     }
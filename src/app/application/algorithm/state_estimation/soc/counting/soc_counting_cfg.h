@@ -68,6 +68,16 @@
 /** #SOC_STRING_CAPACITY_Ah in As */
 #define SOC_STRING_CAPACITY_As ((uint32_t)((SOC_STRING_CAPACITY_Ah) / 3600u))
 
+/** #SOC_STRING_CAPACITY_As in mAs */
+#define SOC_STRING_CAPACITY_mAs ((int64_t)SOC_STRING_CAPACITY_As * 1000)
+
+/**
+ * If no coulomb counting of the current sensor is used, the current is
+ * integrated in mAs by the fixed-point counter (true) or the SOC deltas are
+ * accumulated in float (false).
+ */
+#define SOC_USE_FIXED_POINT_COUNTING (true)
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
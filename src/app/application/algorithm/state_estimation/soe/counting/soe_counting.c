@@ -62,6 +62,7 @@
 #include "database.h"
 #include "foxmath.h"
 #include "fram.h"
+#include "sox_counter.h"
 
 /*========== Macros and Definitions =========================================*/
 /**
@@ -75,6 +76,8 @@ typedef struct {
     float ecScalingMaximum[BS_NR_OF_STRINGS]; /*!< current sensor offset scaling for maximum SOE */
     uint32_t previousTimestamp
         [BS_NR_OF_STRINGS]; /*!< last used timestamp of current or energy counting value for SOE estimation */
+    SOX_COUNTER_s counter[BS_NR_OF_STRINGS];     /*!< fixed-point energy counter if the sensor EC is not used */
+    SOX_REFERENCE_s reference[BS_NR_OF_STRINGS]; /*!< SOE values at the last calibration of the counter */
 } SOE_STATE_s;
 
 /*========== Static Constant and Variable Definitions =======================*/
@@ -260,6 +263,19 @@ static void SOE_SetValue(
         soe_state.ecScalingMinimum[stringNumber] = fram_soe.minimumSoe_perc[stringNumber] + ecOffset;
         soe_state.ecScalingMaximum[stringNumber] = fram_soe.maximumSoe_perc[stringNumber] + ecOffset;
     }
+
+#if SOE_USE_FIXED_POINT_COUNTING == true
+    if (soe_state.sensor_ec_used[stringNumber] == false) {
+        /* Recalibrate reference of the counter */
+        SOX_SetReference(
+            &soe_state.reference[stringNumber],
+            SOE_STRING_ENERGY_mWs,
+            soe_state.counter[stringNumber].dischargedEnergy_mWs,
+            soeMinimumValue_perc,
+            soeAverageValue_perc,
+            soeMaximumValue_perc);
+    }
+#endif /* SOE_USE_FIXED_POINT_COUNTING == true */
 }
 
 static void SOE_CheckDatabaseSoePercentageLimits(DATA_BLOCK_SOX_s *pTableSoe, uint8_t stringNumber) {
@@ -324,6 +340,21 @@ extern void SOE_Init(bool ec_present, uint8_t stringNumber) {
         soe_state.ecScalingMaximum[stringNumber] = fram_soe.maximumSoe_perc[stringNumber] + ecOffset;
         soe_state.ecScalingAverage[stringNumber] = fram_soe.averageSoe_perc[stringNumber] + ecOffset;
     }
+
+#if SOE_USE_FIXED_POINT_COUNTING == true
+    if (false == ec_present) {
+        /* Count from the SOE values that are stored in the FRAM */
+        DATA_READ_DATA(&soe_tableCurrentSensor);
+        SOX_InitializeCounter(&soe_state.counter[stringNumber], soe_tableCurrentSensor.timestampCurrent[stringNumber]);
+        SOX_SetReference(
+            &soe_state.reference[stringNumber],
+            SOE_STRING_ENERGY_mWs,
+            0,
+            soe_tableSoeValues.minimumSoe_perc[stringNumber],
+            soe_tableSoeValues.averageSoe_perc[stringNumber],
+            soe_tableSoeValues.maximumSoe_perc[stringNumber]);
+    }
+#endif /* SOE_USE_FIXED_POINT_COUNTING == true */
     soe_state.soeInitialized = true;
     DATA_WRITE_DATA(&soe_tableCurrentSensor);
 }
@@ -346,11 +377,34 @@ void SOE_Calculation(void) {
             for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
                 if (false == soe_state.sensor_ec_used[stringNumber]) {
                     /* no energy counting activated -> manually integrate energy */
-                    uint32_t timestamp          = soe_tableCurrentSensor.timestampCurrent[stringNumber];
-                    uint32_t previous_timestamp = soe_tableCurrentSensor.previousTimestampCurrent[stringNumber];
+                    uint32_t timestamp = soe_tableCurrentSensor.timestampCurrent[stringNumber];
 
                     /* check if current measurement has been updated */
                     if (soe_state.previousTimestamp[stringNumber] != timestamp) {
+#if SOE_USE_FIXED_POINT_COUNTING == true
+                        SOX_AddSample(
+                            &soe_state.counter[stringNumber],
+                            soe_tableCurrentSensor.current_mA[stringNumber],
+                            soe_tableCurrentSensor.highVoltage_mV[stringNumber][0],
+                            timestamp);
+
+                        /* Convert to percent only for the database, limited to [0.0, 100.0] */
+                        SOX_GetPercentages(
+                            &soe_state.reference[stringNumber],
+                            soe_state.counter[stringNumber].dischargedEnergy_mWs,
+                            &soe_tableSoeValues.minimumSoe_perc[stringNumber],
+                            &soe_tableSoeValues.averageSoe_perc[stringNumber],
+                            &soe_tableSoeValues.maximumSoe_perc[stringNumber]);
+                        soe_tableSoeValues.maximumSoe_Wh[stringNumber] =
+                            SOE_GetStringEnergyFromSoePercentage(soe_tableSoeValues.maximumSoe_perc[stringNumber]);
+                        soe_tableSoeValues.averageSoe_Wh[stringNumber] =
+                            SOE_GetStringEnergyFromSoePercentage(soe_tableSoeValues.averageSoe_perc[stringNumber]);
+                        soe_tableSoeValues.minimumSoe_Wh[stringNumber] =
+                            SOE_GetStringEnergyFromSoePercentage(soe_tableSoeValues.minimumSoe_perc[stringNumber]);
+
+                        soe_state.previousTimestamp[stringNumber] = timestamp;
+#else  /* SOE_USE_FIXED_POINT_COUNTING == true */
+                        uint32_t previous_timestamp = soe_tableCurrentSensor.previousTimestampCurrent[stringNumber];
                         float timestep_s = (((float)timestamp - (float)previous_timestamp)) / 1000.0f;
                         if (timestep_s > 0.0f) {
                             /* Current in charge direction negative means SOE increasing --> BAT naming, not ROB */
@@ -380,6 +434,7 @@ void SOE_Calculation(void) {
                             /* update timestamp SOE state variable for next iteration */
                             soe_state.previousTimestamp[stringNumber] = timestamp;
                         }
+#endif /* SOE_USE_FIXED_POINT_COUNTING == true */
                     } /* end check if current measurement has been updated */
                 } else {
                     /* check if ec measurement has been updated */
@@ -425,7 +480,7 @@ void SOE_Calculation(void) {
             }
 
             /* Update database and FRAM value */
-            FRAM_Write(FRAM_BLOCK_ID_SOE);
+            FRAM_RequestWrite(FRAM_BLOCK_ID_SOE);
             DATA_WRITE_DATA(&soe_tableSoeValues);
         }
     }
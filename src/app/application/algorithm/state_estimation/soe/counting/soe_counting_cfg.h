@@ -67,6 +67,16 @@
 /** Slice energy in Wh */
 #define SOE_STRING_ENERGY_Wh ((float)7616.0f) /* (22848/3 = 7616) */
 
+/** #SOE_STRING_ENERGY_Wh in mWs */
+#define SOE_STRING_ENERGY_mWs ((int64_t)((double)SOE_STRING_ENERGY_Wh * 3600000.0))
+
+/**
+ * If no energy counting of the current sensor is used, the power is
+ * integrated in mWs by the fixed-point counter (true) or the SOE deltas are
+ * accumulated in float (false).
+ */
+#define SOE_USE_FIXED_POINT_COUNTING (true)
+
 /** Battery pack energy in Wh */
 #define SOE_PACK_ENERGY_Wh ((uint32_t)(BS_NR_OF_STRINGS * SOE_STRING_ENERGY_Wh))
 
@@ -59,12 +59,25 @@
 
 #include "bms.h"
 #include "database.h"
-#include "foxmath.h"
 
 #include <float.h>
+#include <stdint.h>
 
 /*========== Macros and Definitions =========================================*/
 
+/** derating inputs of a string and the derating that has been calculated for them */
+typedef struct SOF_STRING_CACHE {
+    bool isValid;                                /*!< false until the first calculation for this string */
+    int16_t minimumCellVoltage_mV;               /*!< minimum cell voltage of the last calculation */
+    int16_t maximumCellVoltage_mV;               /*!< maximum cell voltage of the last calculation */
+    int16_t minimumTemperature_ddegC;            /*!< minimum cell temperature of the last calculation */
+    int16_t maximumTemperature_ddegC;            /*!< maximum cell temperature of the last calculation */
+    SOF_CURRENT_LIMITS_s recommendedCurrent;     /*!< derating for the recommended operating current */
+    SOF_CURRENT_LIMITS_s maximumOperatingLimit;  /*!< derating for the maximum operating limit */
+    SOF_CURRENT_LIMITS_s recommendedSafetyLimit; /*!< derating for the recommended safety limit */
+    SOF_CURRENT_LIMITS_s maximumSafetyLimit;     /*!< derating for the maximum safety limit */
+} SOF_STRING_CACHE_s;
+
 /*========== Static Constant and Variable Definitions =======================*/
 /** @{
  * module-local static Variables that are calculated at startup and used later to avoid divisions at runtime
@@ -75,6 +88,9 @@ static SOF_CURVE_s sof_curveRsl;
 static SOF_CURVE_s sof_curveMsl;
 /** @} */
 
+/** derating of the last calculation for each string */
+static SOF_STRING_CACHE_s sof_stringCache[BS_NR_OF_STRINGS] = {0};
+
 /** local copies of database tables */
 /**@{*/
 static DATA_BLOCK_MIN_MAX_s sof_tableMinimumMaximumValues = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
@@ -85,13 +101,46 @@ static DATA_BLOCK_SOF_s sof_tableSofValues                = {.header.uniqueId =
 
 /*========== Static Function Prototypes =====================================*/
 
+/**
+ * @brief   pre-calculates the fixed-point slopes of a derating curve
+ *
+ * @param[in]  pCurve        configured derating curve
+ * @param[out] pScaledCurve  derating curve with pre-calculated slopes
+ */
+static void SOF_ScaleCurve(const SOF_DERATING_CURVE_s *pCurve, SOF_SCALED_CURVE_s *pScaledCurve);
+
 /**
  * @brief   calculate SOF curve depending on configured configuration values
  *
- * @param[in]  pConfigurationValues         SOF curve configuration values
- * @param[out] pCalculatedSofCurveValues    calculate SOF curve
+ * @param[in]  pConfigurationValues     SOF curve configuration values
+ * @param[out] pCalculatedSofCurves     calculate SOF curve
+ */
+static void SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CURVE_s *pCalculatedSofCurves);
+
+/**
+ * @brief   evaluates a derating curve
+ *
+ * @param[in]  pCurve   derating curve with pre-calculated slopes
+ * @param[in]  input    cell voltage or cell temperature
+ *
+ * @return allowed current in mA
+ */
+static int32_t SOF_EvaluateCurve(const SOF_SCALED_CURVE_s *pCurve, int16_t input);
+
+/**
+ * @brief   evaluates a derating curve for all inputs between a minimum and a
+ *          maximum value
+ * @details The curve is piecewise linear, therefore its smallest current in
+ *          the range is found at the minimum, at the maximum or at one of the
+ *          breakpoints in between.
+ *
+ * @param[in]  pCurve   derating curve with pre-calculated slopes
+ * @param[in]  minimum  minimum cell voltage or cell temperature
+ * @param[in]  maximum  maximum cell voltage or cell temperature
+ *
+ * @return smallest allowed current in the range in mA
  */
-static void SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CURVE_s *pCalculatedSofCurveValues);
+static int32_t SOF_EvaluateCurveForRange(const SOF_SCALED_CURVE_s *pCurve, int16_t minimum, int16_t maximum);
 
 /**
  *  @brief  calculates the SoF from voltage data (i.e., minimum and maximum voltage)
@@ -99,15 +148,13 @@ static void SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CU
  * @param[in]  minimumCellVoltage_mV        minimum cell voltage
  * @param[in]  maximumCellVoltage_mV        maximum cell voltage
  * @param[out] pAllowedVoltageBasedCurrent  Voltage-based SOF
- * @param[in]  pConfigLimitValues           pointer to the SOF configuration structure
  * @param[in]  pCalculatedSofCurves         pointer to the SOF curve structure
  */
 static void SOF_CalculateVoltageBasedCurrentLimit(
     int16_t minimumCellVoltage_mV,
     int16_t maximumCellVoltage_mV,
     SOF_CURRENT_LIMITS_s *pAllowedVoltageBasedCurrent,
-    const SOF_CONFIG_s *pConfigLimitValues,
-    SOF_CURVE_s *pCalculatedSofCurves);
+    const SOF_CURVE_s *pCalculatedSofCurves);
 
 /**
  * @brief   calculates the SoF from temperature data (i.e., minimum and maximum temperature of cells)
@@ -115,15 +162,13 @@ static void SOF_CalculateVoltageBasedCurrentLimit(
  * @param[in]  minimumCellTemperature_ddegC      minimum temperature of cells
  * @param[in]  maximumCellTemperature_ddegC      maximum temperature of cells
  * @param[out] pAllowedTemperatureBasedCurrent   pointer where to store the results
- * @param[in]  pConfigLimitValues                pointer to the structure used for SOF calculation
  * @param[in]  pCalculatedSofCurves              pointer to the structure containing limit values
  */
 static void SOF_CalculateTemperatureBasedCurrentLimit(
     int16_t minimumCellTemperature_ddegC,
     int16_t maximumCellTemperature_ddegC,
     SOF_CURRENT_LIMITS_s *pAllowedTemperatureBasedCurrent,
-    const SOF_CONFIG_s *pConfigLimitValues,
-    SOF_CURVE_s *pCalculatedSofCurves);
+    const SOF_CURVE_s *pCalculatedSofCurves);
 
 /**
  * @brief   get the minimum current values of all variants of SoF calculation
@@ -137,207 +182,283 @@ static SOF_CURRENT_LIMITS_s SOF_MinimumOfTwoSofValues(
     SOF_CURRENT_LIMITS_s voltageBasedLimits,
     SOF_CURRENT_LIMITS_s temperatureBasedLimits);
 
+/**
+ * @brief   calculates the derating of a string for one set of SOF curves
+ *
+ * @param[in]  stringNumber          string addressed
+ * @param[in]  pCalculatedSofCurves  SOF curves to be used
+ *
+ * @return allowed currents of the string
+ */
+static SOF_CURRENT_LIMITS_s SOF_CalculateStringCurrentLimits(
+    uint8_t stringNumber,
+    const SOF_CURVE_s *pCalculatedSofCurves);
+
+/**
+ * @brief   stores the derating inputs of a string in the cache
+ *
+ * @param[in]  stringNumber           string addressed
+ * @param[in]  pMinimumMaximumValues  current minimum and maximum values
+ *
+ * @return true if the inputs differ from the last calculation and the
+ *         derating has to be recalculated, false otherwise
+ */
+static bool SOF_UpdateStringInputs(uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s *pMinimumMaximumValues);
+
+/**
+ * @brief   writes the derating of a string to the local copy of the SOF
+ *          database entry
+ *
+ * @param[in]  stringNumber  string addressed
+ * @param[in]  isClosed      true if the string is connected to the battery system
+ */
+static void SOF_WriteStringCurrentLimits(uint8_t stringNumber, bool isClosed);
+
 /*========== Static Function Implementations ================================*/
-static void SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CURVE_s *pCalculatedSofCurveValues) {
-    FAS_ASSERT(pConfigurationValues != NULL_PTR);
-    FAS_ASSERT(pCalculatedSofCurveValues != NULL_PTR);
-
-    /* Calculating SOF curve for the maximum allowed current for MOL/RSL/MSL */
-    pCalculatedSofCurveValues->slopeLowTemperatureDischarge =
-        (pConfigurationValues->maximumDischargeCurrent_mA - pConfigurationValues->limpHomeCurrent_mA) /
-        (pConfigurationValues->cutoffLowTemperatureDischarge_ddegC -
-         pConfigurationValues->limitLowTemperatureDischarge_ddegC);
-    pCalculatedSofCurveValues->offsetLowTemperatureDischarge =
-        pConfigurationValues->limpHomeCurrent_mA - (pCalculatedSofCurveValues->slopeLowTemperatureDischarge *
-                                                    pConfigurationValues->limitLowTemperatureDischarge_ddegC);
-
-    pCalculatedSofCurveValues->slopeHighTemperatureDischarge =
-        (0.0f - pConfigurationValues->maximumDischargeCurrent_mA) /
-        (pConfigurationValues->limitHighTemperatureDischarge_ddegC -
-         pConfigurationValues->cutoffHighTemperatureDischarge_ddegC);
-    pCalculatedSofCurveValues->offsetHighTemperatureDischarge =
-        0.0f - (pCalculatedSofCurveValues->slopeHighTemperatureDischarge *
-                pConfigurationValues->limitHighTemperatureDischarge_ddegC);
-
-    pCalculatedSofCurveValues->slopeLowTemperatureCharge = (pConfigurationValues->maximumChargeCurrent_mA - 0.0f) /
-                                                           (pConfigurationValues->cutoffLowTemperatureCharge_ddegC -
-                                                            pConfigurationValues->limitLowTemperatureCharge_ddegC);
-    pCalculatedSofCurveValues->offsetLowTemperatureCharge =
-        0.0f -
-        (pCalculatedSofCurveValues->slopeLowTemperatureCharge * pConfigurationValues->limitLowTemperatureCharge_ddegC);
-
-    pCalculatedSofCurveValues->slopeHighTemperatureCharge = (0.0f - pConfigurationValues->maximumChargeCurrent_mA) /
-                                                            (pConfigurationValues->limitHighTemperatureCharge_ddegC -
-                                                             pConfigurationValues->cutoffHighTemperatureCharge_ddegC);
-    pCalculatedSofCurveValues->offsetHighTemperatureCharge = 0.0f -
-                                                             (pCalculatedSofCurveValues->slopeHighTemperatureCharge *
-                                                              pConfigurationValues->limitHighTemperatureCharge_ddegC);
-
-    pCalculatedSofCurveValues->slopeUpperCellVoltage =
-        (pConfigurationValues->maximumDischargeCurrent_mA - 0.0f) /
-        (pConfigurationValues->cutoffLowerCellVoltage_mV - pConfigurationValues->limitLowerCellVoltage_mV);
-    pCalculatedSofCurveValues->offsetUpperCellVoltage =
-        0.0f - (pCalculatedSofCurveValues->slopeUpperCellVoltage * pConfigurationValues->limitLowerCellVoltage_mV);
-
-    pCalculatedSofCurveValues->slopeLowerCellVoltage =
-        (pConfigurationValues->maximumChargeCurrent_mA - 0.0f) /
-        (pConfigurationValues->cutoffUpperCellVoltage_mV - pConfigurationValues->limitUpperCellVoltage_mV);
-    pCalculatedSofCurveValues->offsetLowerCellVoltage =
-        0.0f - (pCalculatedSofCurveValues->slopeLowerCellVoltage * pConfigurationValues->limitLowerCellVoltage_mV);
+static void SOF_ScaleCurve(const SOF_DERATING_CURVE_s *pCurve, SOF_SCALED_CURVE_s *pScaledCurve) {
+    FAS_ASSERT(pCurve != NULL_PTR);
+    FAS_ASSERT(pScaledCurve != NULL_PTR);
+    FAS_ASSERT(pCurve->nrOfBreakpoints > 0u);
+    FAS_ASSERT(pCurve->nrOfBreakpoints <= SOF_MAXIMUM_NR_OF_BREAKPOINTS);
+
+    pScaledCurve->nrOfBreakpoints = pCurve->nrOfBreakpoints;
+    for (uint8_t i = 0u; i < pCurve->nrOfBreakpoints; i++) {
+        pScaledCurve->input[i]      = pCurve->breakpoints[i].input;
+        pScaledCurve->current_mA[i] = pCurve->breakpoints[i].current_mA;
+    }
+    for (uint8_t i = 1u; i < pCurve->nrOfBreakpoints; i++) {
+        const int32_t inputDifference = (int32_t)pScaledCurve->input[i] - (int32_t)pScaledCurve->input[i - 1u];
+        /* breakpoints have to be sorted by strictly increasing input */
+        FAS_ASSERT(inputDifference > 0);
+        const int64_t slope =
+            (((int64_t)pScaledCurve->current_mA[i] - (int64_t)pScaledCurve->current_mA[i - 1u]) *
+             SOF_SLOPE_SCALING_FACTOR) /
+            inputDifference;
+        /* a slope that does not fit into 32 bit is no sensible derating */
+        FAS_ASSERT((slope >= (int64_t)INT32_MIN) && (slope <= (int64_t)INT32_MAX));
+        pScaledCurve->slope[i - 1u] = (int32_t)slope;
+    }
 }
 
-static void SOF_CalculateVoltageBasedCurrentLimit(
-    int16_t minimumCellVoltage_mV,
-    int16_t maximumCellVoltage_mV,
-    SOF_CURRENT_LIMITS_s *pAllowedVoltageBasedCurrent,
-    const SOF_CONFIG_s *pConfigLimitValues,
-    SOF_CURVE_s *pCalculatedSofCurves) {
-    FAS_ASSERT(pAllowedVoltageBasedCurrent != NULL_PTR);
-    FAS_ASSERT(pConfigLimitValues != NULL_PTR);
+static void SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CURVE_s *pCalculatedSofCurves) {
+    FAS_ASSERT(pConfigurationValues != NULL_PTR);
     FAS_ASSERT(pCalculatedSofCurves != NULL_PTR);
 
-    /* minimum cell voltage calculation */
-    if (minimumCellVoltage_mV <= pConfigLimitValues->limitLowerCellVoltage_mV) {
-        pAllowedVoltageBasedCurrent->continuousDischargeCurrent_mA = 0.0f;
-        pAllowedVoltageBasedCurrent->peakDischargeCurrent_mA       = 0.0f;
+    SOF_ScaleCurve(
+        &pConfigurationValues->dischargeCurrentOverCellVoltage, &pCalculatedSofCurves->dischargeCurrentOverCellVoltage);
+    SOF_ScaleCurve(
+        &pConfigurationValues->chargeCurrentOverCellVoltage, &pCalculatedSofCurves->chargeCurrentOverCellVoltage);
+    SOF_ScaleCurve(
+        &pConfigurationValues->dischargeCurrentOverTemperature, &pCalculatedSofCurves->dischargeCurrentOverTemperature);
+    SOF_ScaleCurve(
+        &pConfigurationValues->chargeCurrentOverTemperature, &pCalculatedSofCurves->chargeCurrentOverTemperature);
+}
+
+static int32_t SOF_EvaluateCurve(const SOF_SCALED_CURVE_s *pCurve, int16_t input) {
+    FAS_ASSERT(pCurve != NULL_PTR);
+
+    /* the curves are calculated by SOF_Init(), no current is allowed before */
+    int32_t current_mA = 0;
+    if (pCurve->nrOfBreakpoints == 0u) {
+        /* curve not calculated yet */
+    } else if (input <= pCurve->input[0u]) {
+        current_mA = pCurve->current_mA[0u];
     } else {
-        if (minimumCellVoltage_mV <= pConfigLimitValues->cutoffLowerCellVoltage_mV) {
-            pAllowedVoltageBasedCurrent->continuousDischargeCurrent_mA =
-                (pCalculatedSofCurves->slopeUpperCellVoltage *
-                 (minimumCellVoltage_mV - pConfigLimitValues->limitLowerCellVoltage_mV));
-            pAllowedVoltageBasedCurrent->peakDischargeCurrent_mA =
-                pAllowedVoltageBasedCurrent->continuousDischargeCurrent_mA;
+        /* find the first breakpoint with an input larger than the requested one */
+        uint8_t i = 1u;
+        while ((i < pCurve->nrOfBreakpoints) && (input >= pCurve->input[i])) {
+            i++;
+        }
+        if (i == pCurve->nrOfBreakpoints) {
+            current_mA = pCurve->current_mA[i - 1u];
         } else {
-            pAllowedVoltageBasedCurrent->continuousDischargeCurrent_mA = pConfigLimitValues->maximumDischargeCurrent_mA;
-            pAllowedVoltageBasedCurrent->peakDischargeCurrent_mA       = pConfigLimitValues->maximumDischargeCurrent_mA;
+            const int32_t inputDifference = (int32_t)input - (int32_t)pCurve->input[i - 1u];
+            const int64_t scaledIncrease  = (int64_t)pCurve->slope[i - 1u] * inputDifference;
+            const int32_t increase_mA     = (int32_t)(scaledIncrease / SOF_SLOPE_SCALING_FACTOR);
+            current_mA                    = pCurve->current_mA[i - 1u] + increase_mA;
         }
     }
-    /* maximum cell voltage calculation */
-    if (maximumCellVoltage_mV >= pConfigLimitValues->limitUpperCellVoltage_mV) {
-        pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA = 0.0f;
-        pAllowedVoltageBasedCurrent->peakChargeCurrent_mA       = 0.0f;
-    } else {
-        if (maximumCellVoltage_mV >= pConfigLimitValues->cutoffUpperCellVoltage_mV) {
-            pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA =
-                (pCalculatedSofCurves->slopeLowerCellVoltage *
-                 (maximumCellVoltage_mV - pConfigLimitValues->limitUpperCellVoltage_mV));
-            pAllowedVoltageBasedCurrent->peakChargeCurrent_mA = pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA;
-        } else {
-            pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA = pConfigLimitValues->maximumChargeCurrent_mA;
-            pAllowedVoltageBasedCurrent->peakChargeCurrent_mA       = pConfigLimitValues->maximumChargeCurrent_mA;
+    return current_mA;
+}
+
+static int32_t SOF_EvaluateCurveForRange(const SOF_SCALED_CURVE_s *pCurve, int16_t minimum, int16_t maximum) {
+    FAS_ASSERT(pCurve != NULL_PTR);
+    int32_t current_mA                = SOF_EvaluateCurve(pCurve, minimum);
+    const int32_t currentAtMaximum_mA = SOF_EvaluateCurve(pCurve, maximum);
+    if (currentAtMaximum_mA < current_mA) {
+        current_mA = currentAtMaximum_mA;
+    }
+    /* cells between minimum and maximum may lie on a breakpoint with a smaller current */
+    for (uint8_t i = 0u; i < pCurve->nrOfBreakpoints; i++) {
+        if ((pCurve->input[i] > minimum) && (pCurve->input[i] < maximum) && (pCurve->current_mA[i] < current_mA)) {
+            current_mA = pCurve->current_mA[i];
         }
     }
+    return current_mA;
+}
+
+static void SOF_CalculateVoltageBasedCurrentLimit(
+    int16_t minimumCellVoltage_mV,
+    int16_t maximumCellVoltage_mV,
+    SOF_CURRENT_LIMITS_s *pAllowedVoltageBasedCurrent,
+    const SOF_CURVE_s *pCalculatedSofCurves) {
+    FAS_ASSERT(pAllowedVoltageBasedCurrent != NULL_PTR);
+    FAS_ASSERT(pCalculatedSofCurves != NULL_PTR);
+
+    pAllowedVoltageBasedCurrent->continuousDischargeCurrent_mA = SOF_EvaluateCurveForRange(
+        &pCalculatedSofCurves->dischargeCurrentOverCellVoltage, minimumCellVoltage_mV, maximumCellVoltage_mV);
+    pAllowedVoltageBasedCurrent->peakDischargeCurrent_mA = pAllowedVoltageBasedCurrent->continuousDischargeCurrent_mA;
+    pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA = SOF_EvaluateCurveForRange(
+        &pCalculatedSofCurves->chargeCurrentOverCellVoltage, minimumCellVoltage_mV, maximumCellVoltage_mV);
+    pAllowedVoltageBasedCurrent->peakChargeCurrent_mA = pAllowedVoltageBasedCurrent->continuousChargeCurrent_mA;
 }
 
 static void SOF_CalculateTemperatureBasedCurrentLimit(
     int16_t minimumCellTemperature_ddegC,
     int16_t maximumCellTemperature_ddegC,
     SOF_CURRENT_LIMITS_s *pAllowedTemperatureBasedCurrent,
-    const SOF_CONFIG_s *pConfigLimitValues,
-    SOF_CURVE_s *pCalculatedSofCurves) {
+    const SOF_CURVE_s *pCalculatedSofCurves) {
     FAS_ASSERT(pAllowedTemperatureBasedCurrent != NULL_PTR);
-    FAS_ASSERT(pConfigLimitValues != NULL_PTR);
     FAS_ASSERT(pCalculatedSofCurves != NULL_PTR);
 
-    SOF_CURRENT_LIMITS_s temporaryCurrentLimits = {0.0f, 0.0f, 0.0f, 0.0f};
-    /* Temperature low Discharge */
-    if (minimumCellTemperature_ddegC <= pConfigLimitValues->limitLowTemperatureDischarge_ddegC) {
-        pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA = pConfigLimitValues->limpHomeCurrent_mA;
-        pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA       = pConfigLimitValues->limpHomeCurrent_mA;
-    } else {
-        if (minimumCellTemperature_ddegC <= pConfigLimitValues->cutoffLowTemperatureDischarge_ddegC) {
-            pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA =
-                (pCalculatedSofCurves->slopeLowTemperatureDischarge * minimumCellTemperature_ddegC) +
-                pCalculatedSofCurves->offsetLowTemperatureDischarge;
-            pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA =
-                pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA;
-        } else {
-            pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA =
-                pConfigLimitValues->maximumDischargeCurrent_mA;
-            pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA = pConfigLimitValues->maximumDischargeCurrent_mA;
-        }
-    }
-    /* Temperature low charge */
-    if (minimumCellTemperature_ddegC <= pConfigLimitValues->limitLowTemperatureCharge_ddegC) {
-        pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA = 0;
-        pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA       = 0;
-    } else {
-        if (minimumCellTemperature_ddegC <= pConfigLimitValues->cutoffLowTemperatureCharge_ddegC) {
-            pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA =
-                (pCalculatedSofCurves->slopeLowTemperatureCharge * minimumCellTemperature_ddegC) +
-                pCalculatedSofCurves->offsetLowTemperatureCharge;
-            pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA =
-                pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA;
-        } else {
-            pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA = pConfigLimitValues->maximumChargeCurrent_mA;
-            pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA       = pConfigLimitValues->maximumChargeCurrent_mA;
-        }
-    }
-    /* Temperature high discharge */
-    if (maximumCellTemperature_ddegC >= pConfigLimitValues->limitHighTemperatureDischarge_ddegC) {
-        pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA = 0.0f;
-        pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA       = 0.0f;
-    } else {
-        if (maximumCellTemperature_ddegC >= pConfigLimitValues->cutoffHighTemperatureDischarge_ddegC) {
-            temporaryCurrentLimits.continuousDischargeCurrent_mA =
-                (pCalculatedSofCurves->slopeHighTemperatureDischarge * maximumCellTemperature_ddegC) +
-                pCalculatedSofCurves->offsetHighTemperatureDischarge;
-            temporaryCurrentLimits.peakDischargeCurrent_mA = temporaryCurrentLimits.continuousDischargeCurrent_mA;
-        } else {
-            /* do nothing because this situation is handled with minimumCellTemperature_ddegC */
-            temporaryCurrentLimits.continuousDischargeCurrent_mA = pConfigLimitValues->maximumDischargeCurrent_mA;
-            temporaryCurrentLimits.peakDischargeCurrent_mA       = pConfigLimitValues->maximumDischargeCurrent_mA;
-        }
-        /* Derating value for minimum cell temperature has already been calculated and result is saved in
-           pAllowedTemperatureBasedCurrentCheck. Check now if newly calculated derating value for maximum
-           cell temperatures is smaller than the previously calculated value */
-        pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA = MATH_minimumOfTwoFloats(
-            pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA,
-            temporaryCurrentLimits.continuousDischargeCurrent_mA);
-        pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA = MATH_minimumOfTwoFloats(
-            pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA, temporaryCurrentLimits.peakDischargeCurrent_mA);
-    }
-    /* Temperature high Charge */
-    if (maximumCellTemperature_ddegC >= pConfigLimitValues->limitHighTemperatureCharge_ddegC) {
-        pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA = 0.0f;
-        pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA       = 0.0f;
-    } else {
-        if (maximumCellTemperature_ddegC >= pConfigLimitValues->cutoffHighTemperatureCharge_ddegC) {
-            temporaryCurrentLimits.continuousChargeCurrent_mA =
-                (pCalculatedSofCurves->slopeHighTemperatureCharge * maximumCellTemperature_ddegC) +
-                pCalculatedSofCurves->offsetHighTemperatureCharge;
-            temporaryCurrentLimits.peakChargeCurrent_mA = temporaryCurrentLimits.continuousChargeCurrent_mA;
-        } else {
-            /* do nothing because this situation is handled with minimumCellTemperature_ddegC */
-            temporaryCurrentLimits.continuousChargeCurrent_mA = pConfigLimitValues->maximumChargeCurrent_mA;
-            temporaryCurrentLimits.peakChargeCurrent_mA       = pConfigLimitValues->maximumChargeCurrent_mA;
-        }
-        /* Derating value for minimum cell temperature has already been calculated and result is saved in
-           pAllowedTemperatureBasedCurrentCheck. Check now if newly calculated derating value for maximum
-           cell temperatures is smaller than the previously calculated value */
-        pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA = MATH_minimumOfTwoFloats(
-            pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA,
-            temporaryCurrentLimits.continuousChargeCurrent_mA);
-        pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA = MATH_minimumOfTwoFloats(
-            pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA, temporaryCurrentLimits.peakChargeCurrent_mA);
-    }
+    pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA = SOF_EvaluateCurveForRange(
+        &pCalculatedSofCurves->dischargeCurrentOverTemperature,
+        minimumCellTemperature_ddegC,
+        maximumCellTemperature_ddegC);
+    pAllowedTemperatureBasedCurrent->peakDischargeCurrent_mA =
+        pAllowedTemperatureBasedCurrent->continuousDischargeCurrent_mA;
+    pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA = SOF_EvaluateCurveForRange(
+        &pCalculatedSofCurves->chargeCurrentOverTemperature,
+        minimumCellTemperature_ddegC,
+        maximumCellTemperature_ddegC);
+    pAllowedTemperatureBasedCurrent->peakChargeCurrent_mA =
+        pAllowedTemperatureBasedCurrent->continuousChargeCurrent_mA;
 }
 
 static SOF_CURRENT_LIMITS_s SOF_MinimumOfTwoSofValues(
     SOF_CURRENT_LIMITS_s voltageBasedLimits,
     SOF_CURRENT_LIMITS_s temperatureBasedLimits) {
-    SOF_CURRENT_LIMITS_s retval       = {0};
-    retval.continuousChargeCurrent_mA = MATH_minimumOfTwoFloats(
-        voltageBasedLimits.continuousChargeCurrent_mA, temperatureBasedLimits.continuousChargeCurrent_mA);
-    retval.peakChargeCurrent_mA =
-        MATH_minimumOfTwoFloats(voltageBasedLimits.peakChargeCurrent_mA, temperatureBasedLimits.peakChargeCurrent_mA);
-    retval.continuousDischargeCurrent_mA = MATH_minimumOfTwoFloats(
-        voltageBasedLimits.continuousDischargeCurrent_mA, temperatureBasedLimits.continuousDischargeCurrent_mA);
-    retval.peakDischargeCurrent_mA = MATH_minimumOfTwoFloats(
-        voltageBasedLimits.peakDischargeCurrent_mA, temperatureBasedLimits.peakDischargeCurrent_mA);
+    SOF_CURRENT_LIMITS_s retval = voltageBasedLimits;
+    if (temperatureBasedLimits.continuousChargeCurrent_mA < retval.continuousChargeCurrent_mA) {
+        retval.continuousChargeCurrent_mA = temperatureBasedLimits.continuousChargeCurrent_mA;
+    }
+    if (temperatureBasedLimits.peakChargeCurrent_mA < retval.peakChargeCurrent_mA) {
+        retval.peakChargeCurrent_mA = temperatureBasedLimits.peakChargeCurrent_mA;
+    }
+    if (temperatureBasedLimits.continuousDischargeCurrent_mA < retval.continuousDischargeCurrent_mA) {
+        retval.continuousDischargeCurrent_mA = temperatureBasedLimits.continuousDischargeCurrent_mA;
+    }
+    if (temperatureBasedLimits.peakDischargeCurrent_mA < retval.peakDischargeCurrent_mA) {
+        retval.peakDischargeCurrent_mA = temperatureBasedLimits.peakDischargeCurrent_mA;
+    }
     return retval;
 }
 
+static SOF_CURRENT_LIMITS_s SOF_CalculateStringCurrentLimits(
+    uint8_t stringNumber,
+    const SOF_CURVE_s *pCalculatedSofCurves) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(pCalculatedSofCurves != NULL_PTR);
+
+    SOF_CURRENT_LIMITS_s voltageBasedSof     = {0};
+    SOF_CURRENT_LIMITS_s temperatureBasedSof = {0};
+    SOF_CalculateVoltageBasedCurrentLimit(
+        sof_stringCache[stringNumber].minimumCellVoltage_mV,
+        sof_stringCache[stringNumber].maximumCellVoltage_mV,
+        &voltageBasedSof,
+        pCalculatedSofCurves);
+    SOF_CalculateTemperatureBasedCurrentLimit(
+        sof_stringCache[stringNumber].minimumTemperature_ddegC,
+        sof_stringCache[stringNumber].maximumTemperature_ddegC,
+        &temperatureBasedSof,
+        pCalculatedSofCurves);
+    return SOF_MinimumOfTwoSofValues(voltageBasedSof, temperatureBasedSof);
+}
+
+static bool SOF_UpdateStringInputs(uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s *pMinimumMaximumValues) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    FAS_ASSERT(pMinimumMaximumValues != NULL_PTR);
+
+    SOF_STRING_CACHE_s *pCache = &sof_stringCache[stringNumber];
+    const bool haveInputsChanged =
+        (pCache->isValid == false) ||
+        (pCache->minimumCellVoltage_mV != pMinimumMaximumValues->minimumCellVoltage_mV[stringNumber]) ||
+        (pCache->maximumCellVoltage_mV != pMinimumMaximumValues->maximumCellVoltage_mV[stringNumber]) ||
+        (pCache->minimumTemperature_ddegC != pMinimumMaximumValues->minimumTemperature_ddegC[stringNumber]) ||
+        (pCache->maximumTemperature_ddegC != pMinimumMaximumValues->maximumTemperature_ddegC[stringNumber]);
+
+    pCache->isValid                  = true;
+    pCache->minimumCellVoltage_mV    = pMinimumMaximumValues->minimumCellVoltage_mV[stringNumber];
+    pCache->maximumCellVoltage_mV    = pMinimumMaximumValues->maximumCellVoltage_mV[stringNumber];
+    pCache->minimumTemperature_ddegC = pMinimumMaximumValues->minimumTemperature_ddegC[stringNumber];
+    pCache->maximumTemperature_ddegC = pMinimumMaximumValues->maximumTemperature_ddegC[stringNumber];
+    return haveInputsChanged;
+}
+
+static void SOF_WriteStringCurrentLimits(uint8_t stringNumber, bool isClosed) {
+    FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
+    const SOF_STRING_CACHE_s *pCache = &sof_stringCache[stringNumber];
+
+    if (isClosed == true) {
+        sof_tableSofValues.recommendedContinuousChargeCurrent_mA[stringNumber] =
+            (float)pCache->recommendedCurrent.continuousChargeCurrent_mA;
+        sof_tableSofValues.recommendedContinuousDischargeCurrent_mA[stringNumber] =
+            (float)pCache->recommendedCurrent.continuousDischargeCurrent_mA;
+        sof_tableSofValues.recommendedPeakChargeCurrent_mA[stringNumber] =
+            (float)pCache->recommendedCurrent.peakChargeCurrent_mA;
+        sof_tableSofValues.recommendedPeakDischargeCurrent_mA[stringNumber] =
+            (float)pCache->recommendedCurrent.peakDischargeCurrent_mA;
+    } else {
+        sof_tableSofValues.recommendedContinuousChargeCurrent_mA[stringNumber]    = 0.0f;
+        sof_tableSofValues.recommendedContinuousDischargeCurrent_mA[stringNumber] = 0.0f;
+        sof_tableSofValues.recommendedPeakChargeCurrent_mA[stringNumber]          = 0.0f;
+        sof_tableSofValues.recommendedPeakDischargeCurrent_mA[stringNumber]       = 0.0f;
+    }
+
+#if BMS_CHECK_SOF_CURRENT_LIMITS == true
+    sof_tableSofValues.continuousMolChargeCurrent_mA[stringNumber] =
+        (float)pCache->maximumOperatingLimit.continuousChargeCurrent_mA;
+    sof_tableSofValues.continuousMolDischargeCurrent_mA[stringNumber] =
+        (float)pCache->maximumOperatingLimit.continuousDischargeCurrent_mA;
+    sof_tableSofValues.peakMolChargeCurrent_mA[stringNumber] =
+        (float)pCache->maximumOperatingLimit.peakChargeCurrent_mA;
+    sof_tableSofValues.peakMolDischargeCurrent_mA[stringNumber] =
+        (float)pCache->maximumOperatingLimit.peakDischargeCurrent_mA;
+
+    sof_tableSofValues.continuousRslChargeCurrent_mA[stringNumber] =
+        (float)pCache->recommendedSafetyLimit.continuousChargeCurrent_mA;
+    sof_tableSofValues.continuousRslDischargeCurrent_mA[stringNumber] =
+        (float)pCache->recommendedSafetyLimit.continuousDischargeCurrent_mA;
+    sof_tableSofValues.peakRslChargeCurrent_mA[stringNumber] =
+        (float)pCache->recommendedSafetyLimit.peakChargeCurrent_mA;
+    sof_tableSofValues.peakRslDischargeCurrent_mA[stringNumber] =
+        (float)pCache->recommendedSafetyLimit.peakDischargeCurrent_mA;
+
+    sof_tableSofValues.continuousMslChargeCurrent_mA[stringNumber] =
+        (float)pCache->maximumSafetyLimit.continuousChargeCurrent_mA;
+    sof_tableSofValues.continuousMslDischargeCurrent_mA[stringNumber] =
+        (float)pCache->maximumSafetyLimit.continuousDischargeCurrent_mA;
+    sof_tableSofValues.peakMslChargeCurrent_mA[stringNumber] = (float)pCache->maximumSafetyLimit.peakChargeCurrent_mA;
+    sof_tableSofValues.peakMslDischargeCurrent_mA[stringNumber] =
+        (float)pCache->maximumSafetyLimit.peakDischargeCurrent_mA;
+#else  /* BMS_CHECK_SOF_CURRENT_LIMITS == false */
+    sof_tableSofValues.continuousMolChargeCurrent_mA[stringNumber]    = BC_CURRENT_MAX_CHARGE_MOL_mA;
+    sof_tableSofValues.continuousMolDischargeCurrent_mA[stringNumber] = BC_CURRENT_MAX_DISCHARGE_MOL_mA;
+    sof_tableSofValues.peakMolChargeCurrent_mA[stringNumber]          = BC_CURRENT_MAX_CHARGE_MOL_mA;
+    sof_tableSofValues.peakMolDischargeCurrent_mA[stringNumber]       = BC_CURRENT_MAX_DISCHARGE_MOL_mA;
+
+    sof_tableSofValues.continuousRslChargeCurrent_mA[stringNumber]    = BC_CURRENT_MAX_CHARGE_RSL_mA;
+    sof_tableSofValues.continuousRslDischargeCurrent_mA[stringNumber] = BC_CURRENT_MAX_DISCHARGE_RSL_mA;
+    sof_tableSofValues.peakRslChargeCurrent_mA[stringNumber]          = BC_CURRENT_MAX_CHARGE_RSL_mA;
+    sof_tableSofValues.peakRslDischargeCurrent_mA[stringNumber]       = BC_CURRENT_MAX_DISCHARGE_RSL_mA;
+
+    sof_tableSofValues.continuousMslChargeCurrent_mA[stringNumber]    = BC_CURRENT_MAX_CHARGE_MSL_mA;
+    sof_tableSofValues.continuousMslDischargeCurrent_mA[stringNumber] = BC_CURRENT_MAX_DISCHARGE_MSL_mA;
+    sof_tableSofValues.peakMslChargeCurrent_mA[stringNumber]          = BC_CURRENT_MAX_CHARGE_MSL_mA;
+    sof_tableSofValues.peakMslDischargeCurrent_mA[stringNumber]       = BC_CURRENT_MAX_DISCHARGE_MSL_mA;
+#endif /* BMS_CHECK_SOF_CURRENT_LIMITS == true */
+}
+
 /*========== Extern Function Implementations ================================*/
 extern void SOF_Init(void) {
     /* Calculating SOF curve for the recommended operating current */
@@ -353,11 +474,14 @@ extern void SOF_Init(void) {
     /* Calculating SOF curve for maximum safety limit */
     SOF_CalculateCurves(&sof_configMaximumSafetyLimit, &sof_curveMsl);
 #endif
+
+    /* curves have changed, cached derating values are outdated */
+    for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
+        sof_stringCache[stringNumber].isValid = false;
+    }
 }
 
 extern void SOF_Calculation(void) {
-    SOF_CURRENT_LIMITS_s allowedCurrent = {0};
-
     DATA_READ_DATA(&sof_tableMinimumMaximumValues);
 
     /* Reset allowed current values */
@@ -371,32 +495,24 @@ extern void SOF_Calculation(void) {
     float minCharge_mA      = FLT_MAX;
 
     for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
-        SOF_CURRENT_LIMITS_s voltageBasedSof     = {0};
-        SOF_CURRENT_LIMITS_s temperatureBasedSof = {0};
-        /* Calculate allowed current if string is connected */
-        if (true == BMS_IsStringClosed(stringNumber)) {
-            SOF_CalculateVoltageBasedCurrentLimit(
-                (float)sof_tableMinimumMaximumValues.minimumCellVoltage_mV[stringNumber],
-                (float)sof_tableMinimumMaximumValues.maximumCellVoltage_mV[stringNumber],
-                &voltageBasedSof,
-                &sof_recommendedCurrent,
-                &sof_curveRecommendedOperatingCurrent);
-            SOF_CalculateTemperatureBasedCurrentLimit(
-                (float)sof_tableMinimumMaximumValues.minimumTemperature_ddegC[stringNumber],
-                (float)sof_tableMinimumMaximumValues.maximumTemperature_ddegC[stringNumber],
-                &temperatureBasedSof,
-                &sof_recommendedCurrent,
-                &sof_curveRecommendedOperatingCurrent);
-            allowedCurrent = SOF_MinimumOfTwoSofValues(voltageBasedSof, temperatureBasedSof);
-
-            sof_tableSofValues.recommendedContinuousChargeCurrent_mA[stringNumber] =
-                allowedCurrent.continuousChargeCurrent_mA;
-            sof_tableSofValues.recommendedContinuousDischargeCurrent_mA[stringNumber] =
-                allowedCurrent.continuousDischargeCurrent_mA;
-            sof_tableSofValues.recommendedPeakChargeCurrent_mA[stringNumber] = allowedCurrent.peakChargeCurrent_mA;
-            sof_tableSofValues.recommendedPeakDischargeCurrent_mA[stringNumber] =
-                allowedCurrent.peakDischargeCurrent_mA;
+        /* Recalculate derating only if the minimum/maximum values of the string have changed */
+        if (true == SOF_UpdateStringInputs(stringNumber, &sof_tableMinimumMaximumValues)) {
+            sof_stringCache[stringNumber].recommendedCurrent =
+                SOF_CalculateStringCurrentLimits(stringNumber, &sof_curveRecommendedOperatingCurrent);
+#if BMS_CHECK_SOF_CURRENT_LIMITS == true
+            sof_stringCache[stringNumber].maximumOperatingLimit =
+                SOF_CalculateStringCurrentLimits(stringNumber, &sof_curveMol);
+            sof_stringCache[stringNumber].recommendedSafetyLimit =
+                SOF_CalculateStringCurrentLimits(stringNumber, &sof_curveRsl);
+            sof_stringCache[stringNumber].maximumSafetyLimit =
+                SOF_CalculateStringCurrentLimits(stringNumber, &sof_curveMsl);
+#endif /* BMS_CHECK_SOF_CURRENT_LIMITS == true */
+        }
 
+        /* Allowed current is only recommended if string is connected */
+        const bool isClosed = BMS_IsStringClosed(stringNumber);
+        SOF_WriteStringCurrentLimits(stringNumber, isClosed);
+        if (true == isClosed) {
             nrClosedStrings++;
             if (minCharge_mA > sof_tableSofValues.recommendedContinuousChargeCurrent_mA[stringNumber]) {
                 minCharge_mA = sof_tableSofValues.recommendedContinuousChargeCurrent_mA[stringNumber];
@@ -404,89 +520,7 @@ extern void SOF_Calculation(void) {
             if (minDischarge_mA > sof_tableSofValues.recommendedContinuousDischargeCurrent_mA[stringNumber]) {
                 minDischarge_mA = sof_tableSofValues.recommendedContinuousDischargeCurrent_mA[stringNumber];
             }
-        } else {
-            sof_tableSofValues.recommendedContinuousChargeCurrent_mA[stringNumber]    = 0.0f;
-            sof_tableSofValues.recommendedContinuousDischargeCurrent_mA[stringNumber] = 0.0f;
-            sof_tableSofValues.recommendedPeakChargeCurrent_mA[stringNumber]          = 0.0f;
-            sof_tableSofValues.recommendedPeakDischargeCurrent_mA[stringNumber]       = 0.0f;
         }
-
-#if BMS_CHECK_SOF_CURRENT_LIMITS == true
-        /* Calculate maximum allowed current MOL level */
-        SOF_CalculateVoltageBasedCurrentLimit(
-            (float)sof_tableMinimumMaximumValues.minimumCellVoltage_mV[stringNumber],
-            (float)sof_tableMinimumMaximumValues.maximumCellVoltage_mV[stringNumber],
-            &voltageBasedSof,
-            &sof_maximumOperatingLimit,
-            &sof_curveMol);
-        SOF_CalculateTemperatureBasedCurrentLimit(
-            (float)sof_tableMinimumMaximumValues.minimumTemperature_ddegC[stringNumber],
-            (float)sof_tableMinimumMaximumValues.maximumTemperature_ddegC[stringNumber],
-            &temperatureBasedSof,
-            &sof_maximumOperatingLimit,
-            &sof_curveMol);
-        allowedCurrent = SOF_MinimumOfTwoSofValues(voltageBasedSof, temperatureBasedSof);
-        sof_tableSofValues.continuousMolChargeCurrent_mA[stringNumber] = allowedCurrent.continuousChargeCurrent_mA;
-        sof_tableSofValues.continuousMolDischargeCurrent_mA[stringNumber] =
-            allowedCurrent.continuousDischargeCurrent_mA;
-        sof_tableSofValues.peakMolChargeCurrent_mA[stringNumber]    = allowedCurrent.peakChargeCurrent_mA;
-        sof_tableSofValues.peakMolDischargeCurrent_mA[stringNumber] = allowedCurrent.peakDischargeCurrent_mA;
-
-        /* Calculate maximum allowed current RSL level */
-        SOF_CalculateVoltageBasedCurrentLimit(
-            (float)sof_tableMinimumMaximumValues.minimumCellVoltage_mV[stringNumber],
-            (float)sof_tableMinimumMaximumValues.maximumCellVoltage_mV[stringNumber],
-            &voltageBasedSof,
-            &sof_recommendedSafetyLimit,
-            &sof_curveRsl);
-        SOF_CalculateTemperatureBasedCurrentLimit(
-            (float)sof_tableMinimumMaximumValues.minimumTemperature_ddegC[stringNumber],
-            (float)sof_tableMinimumMaximumValues.maximumTemperature_ddegC[stringNumber],
-            &temperatureBasedSof,
-            &sof_recommendedSafetyLimit,
-            &sof_curveRsl);
-        allowedCurrent = SOF_MinimumOfTwoSofValues(voltageBasedSof, temperatureBasedSof);
-        sof_tableSofValues.continuousRslChargeCurrent_mA[stringNumber] = allowedCurrent.continuousChargeCurrent_mA;
-        sof_tableSofValues.continuousRslDischargeCurrent_mA[stringNumber] =
-            allowedCurrent.continuousDischargeCurrent_mA;
-        sof_tableSofValues.peakRslChargeCurrent_mA[stringNumber]    = allowedCurrent.peakChargeCurrent_mA;
-        sof_tableSofValues.peakRslDischargeCurrent_mA[stringNumber] = allowedCurrent.peakDischargeCurrent_mA;
-
-        /* Calculate maximum allowed current MSL level */
-        SOF_CalculateVoltageBasedCurrentLimit(
-            (float)sof_tableMinimumMaximumValues.minimumCellVoltage_mV[stringNumber],
-            (float)sof_tableMinimumMaximumValues.maximumCellVoltage_mV[stringNumber],
-            &voltageBasedSof,
-            &sof_configMaximumSafetyLimit,
-            &sof_curveMsl);
-        SOF_CalculateTemperatureBasedCurrentLimit(
-            (float)sof_tableMinimumMaximumValues.minimumTemperature_ddegC[stringNumber],
-            (float)sof_tableMinimumMaximumValues.maximumTemperature_ddegC[stringNumber],
-            &temperatureBasedSof,
-            &sof_configMaximumSafetyLimit,
-            &sof_curveMsl);
-        allowedCurrent = SOF_MinimumOfTwoSofValues(voltageBasedSof, temperatureBasedSof);
-        sof_tableSofValues.continuousMslChargeCurrent_mA[stringNumber] = allowedCurrent.continuousChargeCurrent_mA;
-        sof_tableSofValues.continuousMslDischargeCurrent_mA[stringNumber] =
-            allowedCurrent.continuousDischargeCurrent_mA;
-        sof_tableSofValues.peakMslChargeCurrent_mA[stringNumber]    = allowedCurrent.peakChargeCurrent_mA;
-        sof_tableSofValues.peakMslDischargeCurrent_mA[stringNumber] = allowedCurrent.peakDischargeCurrent_mA;
-#else  /* BMS_CHECK_SOF_CURRENT_LIMITS == false */
-        sof_tableSofValues.continuousMolChargeCurrent_mA[stringNumber]    = BC_CURRENT_MAX_CHARGE_MOL_mA;
-        sof_tableSofValues.continuousMolDischargeCurrent_mA[stringNumber] = BC_CURRENT_MAX_DISCHARGE_MOL_mA;
-        sof_tableSofValues.peakMolChargeCurrent_mA[stringNumber]          = BC_CURRENT_MAX_CHARGE_MOL_mA;
-        sof_tableSofValues.peakMolDischargeCurrent_mA[stringNumber]       = BC_CURRENT_MAX_DISCHARGE_MOL_mA;
-
-        sof_tableSofValues.continuousRslChargeCurrent_mA[stringNumber]    = BC_CURRENT_MAX_CHARGE_RSL_mA;
-        sof_tableSofValues.continuousRslDischargeCurrent_mA[stringNumber] = BC_CURRENT_MAX_DISCHARGE_RSL_mA;
-        sof_tableSofValues.peakRslChargeCurrent_mA[stringNumber]          = BC_CURRENT_MAX_CHARGE_RSL_mA;
-        sof_tableSofValues.peakRslDischargeCurrent_mA[stringNumber]       = BC_CURRENT_MAX_DISCHARGE_RSL_mA;
-
-        sof_tableSofValues.continuousMslChargeCurrent_mA[stringNumber]    = BC_CURRENT_MAX_CHARGE_MSL_mA;
-        sof_tableSofValues.continuousMslDischargeCurrent_mA[stringNumber] = BC_CURRENT_MAX_DISCHARGE_MSL_mA;
-        sof_tableSofValues.peakMslChargeCurrent_mA[stringNumber]          = BC_CURRENT_MAX_CHARGE_MSL_mA;
-        sof_tableSofValues.peakMslDischargeCurrent_mA[stringNumber]       = BC_CURRENT_MAX_DISCHARGE_MSL_mA;
-#endif /* BMS_CHECK_SOF_CURRENT_LIMITS == true */
     }
 
     if ((minCharge_mA * 1000.0f) > (float)BS_MAXIMUM_STRING_CURRENT_mA) {
@@ -507,33 +541,29 @@ extern void SOF_Calculation(void) {
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
 #ifdef UNITY_UNIT_TEST
-extern void TEST_SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CURVE_s *pCalculatedSofCurveValues) {
-    SOF_CalculateCurves(pConfigurationValues, pCalculatedSofCurveValues);
+extern void TEST_SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CURVE_s *pCalculatedSofCurves) {
+    SOF_CalculateCurves(pConfigurationValues, pCalculatedSofCurves);
+}
+extern int32_t TEST_SOF_EvaluateCurve(const SOF_SCALED_CURVE_s *pCurve, int16_t input) {
+    return SOF_EvaluateCurve(pCurve, input);
 }
 extern void TEST_SOF_CalculateVoltageBasedCurrentLimit(
     int16_t minimumCellVoltage_mV,
     int16_t maximumCellVoltage_mV,
     SOF_CURRENT_LIMITS_s *pAllowedVoltageBasedCurrent,
-    const SOF_CONFIG_s *pConfigLimitValues,
-    SOF_CURVE_s *pCalculatedSofCurves) {
+    const SOF_CURVE_s *pCalculatedSofCurves) {
     SOF_CalculateVoltageBasedCurrentLimit(
-        minimumCellVoltage_mV,
-        maximumCellVoltage_mV,
-        pAllowedVoltageBasedCurrent,
-        pConfigLimitValues,
-        pCalculatedSofCurves);
+        minimumCellVoltage_mV, maximumCellVoltage_mV, pAllowedVoltageBasedCurrent, pCalculatedSofCurves);
 }
 extern void TEST_SOF_CalculateTemperatureBasedCurrentLimit(
     int16_t minimumCellTemperature_ddegC,
     int16_t maximumCellTemperature_ddegC,
     SOF_CURRENT_LIMITS_s *pAllowedTemperatureBasedCurrent,
-    const SOF_CONFIG_s *pConfigLimitValues,
-    SOF_CURVE_s *pCalculatedSofCurves) {
+    const SOF_CURVE_s *pCalculatedSofCurves) {
     SOF_CalculateTemperatureBasedCurrentLimit(
         minimumCellTemperature_ddegC,
         maximumCellTemperature_ddegC,
         pAllowedTemperatureBasedCurrent,
-        pConfigLimitValues,
         pCalculatedSofCurves);
 }
 extern SOF_CURRENT_LIMITS_s TEST_SOF_MinimumOfTwoSofValues(
@@ -541,4 +571,7 @@ extern SOF_CURRENT_LIMITS_s TEST_SOF_MinimumOfTwoSofValues(
     SOF_CURRENT_LIMITS_s temperatureBasedLimits) {
     return SOF_MinimumOfTwoSofValues(voltageBasedLimits, temperatureBasedLimits);
 }
+extern bool TEST_SOF_UpdateStringInputs(uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s *pMinimumMaximumValues) {
+    return SOF_UpdateStringInputs(stringNumber, pMinimumMaximumValues);
+}
 #endif
@@ -57,37 +57,46 @@
 /*========== Includes =======================================================*/
 #include "sof_cfg.h"
 
+#include "database_cfg.h"
+
 /*========== Macros and Definitions =========================================*/
+/**
+ * Scaling factor of the pre-calculated derating slopes, i.e., the slopes are
+ * stored as Q16 fixed-point numbers in mA per input unit
+ */
+#define SOF_SLOPE_SCALING_FACTOR (65536)
+
 /**
  * struct definition for 4 different values: in two current directions (charge,
  * discharge) for two use cases (peak and continuous)
  */
 typedef struct SOF_CURRENT_LIMITS {
-    float continuousChargeCurrent_mA;    /*!< maximum current for continues charging */
-    float peakChargeCurrent_mA;          /*!< maximum current for peak charging */
-    float continuousDischargeCurrent_mA; /*!< maximum current for continues discharging */
-    float peakDischargeCurrent_mA;       /*!< maximum current for peak discharging */
+    int32_t continuousChargeCurrent_mA;    /*!< maximum current for continues charging */
+    int32_t peakChargeCurrent_mA;          /*!< maximum current for peak charging */
+    int32_t continuousDischargeCurrent_mA; /*!< maximum current for continues discharging */
+    int32_t peakDischargeCurrent_mA;       /*!< maximum current for peak discharging */
 } SOF_CURRENT_LIMITS_s;
 
 /**
- * struct definition for calculating the linear SOF curve. The SOF curve is
- * voltage, temperature and charge/discharge dependent.
+ * derating curve with pre-calculated fixed-point slopes, derived from a
+ * #SOF_DERATING_CURVE_s at initialization
  */
-typedef struct SOF_CURVE {
-    float slopeLowTemperatureDischarge;   /*!< low temperature dependent derating slope for discharge current */
-    float offsetLowTemperatureDischarge;  /*!< discharge current offset for low temperature dependent derating */
-    float slopeHighTemperatureDischarge;  /*!< high temperature dependent derating slope for discharge current */
-    float offsetHighTemperatureDischarge; /*!< discharge current offset for high temperature dependent derating */
+typedef struct SOF_SCALED_CURVE {
+    uint8_t nrOfBreakpoints;                           /*!< number of used breakpoints */
+    int16_t input[SOF_MAXIMUM_NR_OF_BREAKPOINTS];      /*!< input of the breakpoints, strictly increasing */
+    int32_t current_mA[SOF_MAXIMUM_NR_OF_BREAKPOINTS]; /*!< current at the breakpoints, unit: mA */
+    int32_t slope[SOF_MAXIMUM_NR_OF_BREAKPOINTS - 1u]; /*!< slope to the next breakpoint (Q16) */
+} SOF_SCALED_CURVE_s;
 
-    float slopeLowTemperatureCharge;   /*!< low temperature dependent derating slope for charge current */
-    float offsetLowTemperatureCharge;  /*!< charge current offset for low temperature dependent derating */
-    float slopeHighTemperatureCharge;  /*!< high temperature dependent derating slope for charge current */
-    float offsetHighTemperatureCharge; /*!< charge current offset for high temperature dependent derating */
-
-    float slopeUpperCellVoltage;  /*!< upper cell voltage derating slope for charge and discharge current */
-    float offsetUpperCellVoltage; /*!< charge/discharge current offset for upper voltage derating */
-    float slopeLowerCellVoltage;  /*!< lower cell voltage derating slope for charge and discharge current */
-    float offsetLowerCellVoltage; /*!< charge/discharge current offset for lower voltage derating */
+/**
+ * struct definition for calculating the SOF curves. The SOF curve is voltage,
+ * temperature and charge/discharge dependent.
+ */
+typedef struct SOF_CURVE {
+    SOF_SCALED_CURVE_s dischargeCurrentOverCellVoltage; /*!< cell voltage dependent discharge derating */
+    SOF_SCALED_CURVE_s chargeCurrentOverCellVoltage;    /*!< cell voltage dependent charge derating */
+    SOF_SCALED_CURVE_s dischargeCurrentOverTemperature; /*!< temperature dependent discharge derating */
+    SOF_SCALED_CURVE_s chargeCurrentOverTemperature;    /*!< temperature dependent charge derating */
 } SOF_CURVE_s;
 
 /*========== Extern Constant and Variable Declarations ======================*/
@@ -96,35 +105,39 @@ typedef struct SOF_CURVE {
 /**
  * @brief   initializes the area for SOF (where derating starts and is fully
  *          active).
- * @details Pseudocode for linear function parameter extraction with 2 points:
- *          - slope = (y2 - y1) / (x2-x1)
- *          - offset = y1 - (slope) * x1
- *          - function y= slope * x + offset
+ * @details The slopes between the breakpoints of all configured derating
+ *          curves are calculated once as fixed-point numbers, so that the
+ *          cyclic calculation does not need any division:
+ *          - slope = (y2 - y1) * #SOF_SLOPE_SCALING_FACTOR / (x2 - x1)
+ *          - function y = y1 + slope * (x - x1) / #SOF_SLOPE_SCALING_FACTOR
  */
 extern void SOF_Init(void);
 
 /**
  * @brief   triggers SOF calculation
- * @details TODO
+ * @details The derating of a string is only recalculated when its minimum or
+ *          maximum cell voltage or temperature has changed since the last
+ *          call, otherwise the previous result is reused.
  */
 extern void SOF_Calculation(void);
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
+extern void TEST_SOF_CalculateCurves(const SOF_CONFIG_s *pConfigurationValues, SOF_CURVE_s *pCalculatedSofCurves);
+extern int32_t TEST_SOF_EvaluateCurve(const SOF_SCALED_CURVE_s *pCurve, int16_t input);
 extern void TEST_SOF_CalculateVoltageBasedCurrentLimit(
     int16_t minimumCellVoltage_mV,
     int16_t maximumCellVoltage_mV,
     SOF_CURRENT_LIMITS_s *pAllowedVoltageBasedCurrent,
-    const SOF_CONFIG_s *pConfigLimitValues,
-    SOF_CURVE_s *pCalculatedSofCurves);
+    const SOF_CURVE_s *pCalculatedSofCurves);
 extern void TEST_SOF_CalculateTemperatureBasedCurrentLimit(
     int16_t minimumCellTemperature_ddegC,
     int16_t maximumCellTemperature_ddegC,
     SOF_CURRENT_LIMITS_s *pAllowedTemperatureBasedCurrent,
-    const SOF_CONFIG_s *pConfigLimitValues,
-    SOF_CURVE_s *pCalculatedSofCurves);
+    const SOF_CURVE_s *pCalculatedSofCurves);
 extern SOF_CURRENT_LIMITS_s TEST_SOF_MinimumOfTwoSofValues(
     SOF_CURRENT_LIMITS_s voltageBasedLimits,
     SOF_CURRENT_LIMITS_s temperatureBasedLimits);
+extern bool TEST_SOF_UpdateStringInputs(uint8_t stringNumber, const DATA_BLOCK_MIN_MAX_s *pMinimumMaximumValues);
 #endif /* UNITY_UNIT_TEST */
 #endif /* FOXBMS__SOF_H_ */
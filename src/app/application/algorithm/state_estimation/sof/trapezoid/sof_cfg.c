@@ -61,72 +61,112 @@
 /*========== Extern Constant and Variable Definitions =======================*/
 
 const SOF_CONFIG_s sof_recommendedCurrent = {
-    .maximumChargeCurrent_mA              = SOF_CURRENT_MAX_CONTINUOUS_CHARGE_mA,
-    .maximumDischargeCurrent_mA           = SOF_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA,
-    .limpHomeCurrent_mA                   = SOF_CURRENT_LIMP_HOME_mA,
-    .cutoffLowTemperatureDischarge_ddegC  = SOF_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC,
-    .limitLowTemperatureDischarge_ddegC   = SOF_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC,
-    .cutoffLowTemperatureCharge_ddegC     = SOF_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC,
-    .limitLowTemperatureCharge_ddegC      = SOF_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC,
-    .cutoffHighTemperatureDischarge_ddegC = SOF_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC,
-    .limitHighTemperatureDischarge_ddegC  = SOF_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC,
-    .cutoffHighTemperatureCharge_ddegC    = SOF_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC,
-    .limitHighTemperatureCharge_ddegC     = SOF_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC,
-    .limitUpperCellVoltage_mV             = SOF_VOLTAGE_LIMIT_CHARGE_mV,
-    .cutoffUpperCellVoltage_mV            = SOF_VOLTAGE_CUTOFF_CHARGE_mV,
-    .limitLowerCellVoltage_mV             = SOF_VOLTAGE_LIMIT_DISCHARGE_mV,
-    .cutoffLowerCellVoltage_mV            = SOF_VOLTAGE_CUTOFF_DISCHARGE_mV};
+    .dischargeCurrentOverCellVoltage =
+        {.nrOfBreakpoints = 2u,
+         .breakpoints =
+             {{SOF_VOLTAGE_LIMIT_DISCHARGE_mV, 0},
+              {SOF_VOLTAGE_CUTOFF_DISCHARGE_mV, (int32_t)SOF_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA}}},
+    .chargeCurrentOverCellVoltage =
+        {.nrOfBreakpoints = 2u,
+         .breakpoints =
+             {{SOF_VOLTAGE_CUTOFF_CHARGE_mV, (int32_t)SOF_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_VOLTAGE_LIMIT_CHARGE_mV, 0}}},
+    .dischargeCurrentOverTemperature =
+        {.nrOfBreakpoints = 4u,
+         .breakpoints =
+             {{SOF_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC, (int32_t)SOF_CURRENT_LIMP_HOME_mA},
+              {SOF_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC, (int32_t)SOF_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA},
+              {SOF_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC, (int32_t)SOF_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA},
+              {SOF_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC, 0}}},
+    .chargeCurrentOverTemperature =
+        {.nrOfBreakpoints = 4u,
+         .breakpoints =
+             {{SOF_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC, 0},
+              {SOF_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC, (int32_t)SOF_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC, (int32_t)SOF_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC, 0}}},
+};
 
 const SOF_CONFIG_s sof_maximumOperatingLimit = {
-    .maximumChargeCurrent_mA              = SOF_MOL_CURRENT_MAX_CONTINUOUS_CHARGE_mA,
-    .maximumDischargeCurrent_mA           = SOF_MOL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA,
-    .limpHomeCurrent_mA                   = SOF_MOL_CURRENT_LIMP_HOME_mA,
-    .cutoffLowTemperatureDischarge_ddegC  = SOF_MOL_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC,
-    .limitLowTemperatureDischarge_ddegC   = SOF_MOL_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC,
-    .cutoffLowTemperatureCharge_ddegC     = SOF_MOL_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC,
-    .limitLowTemperatureCharge_ddegC      = SOF_MOL_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC,
-    .cutoffHighTemperatureDischarge_ddegC = SOF_MOL_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC,
-    .limitHighTemperatureDischarge_ddegC  = SOF_MOL_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC,
-    .cutoffHighTemperatureCharge_ddegC    = SOF_MOL_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC,
-    .limitHighTemperatureCharge_ddegC     = SOF_MOL_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC,
-    .limitUpperCellVoltage_mV             = SOF_MOL_VOLTAGE_LIMIT_CHARGE_mV,
-    .cutoffUpperCellVoltage_mV            = SOF_MOL_VOLTAGE_CUTOFF_CHARGE_mV,
-    .limitLowerCellVoltage_mV             = SOF_MOL_VOLTAGE_LIMIT_DISCHARGE_mV,
-    .cutoffLowerCellVoltage_mV            = SOF_MOL_VOLTAGE_CUTOFF_DISCHARGE_mV};
+    .dischargeCurrentOverCellVoltage =
+        {.nrOfBreakpoints = 2u,
+         .breakpoints =
+             {{SOF_MOL_VOLTAGE_LIMIT_DISCHARGE_mV, 0},
+              {SOF_MOL_VOLTAGE_CUTOFF_DISCHARGE_mV, (int32_t)SOF_MOL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA}}},
+    .chargeCurrentOverCellVoltage =
+        {.nrOfBreakpoints = 2u,
+         .breakpoints =
+             {{SOF_MOL_VOLTAGE_CUTOFF_CHARGE_mV, (int32_t)SOF_MOL_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_MOL_VOLTAGE_LIMIT_CHARGE_mV, 0}}},
+    .dischargeCurrentOverTemperature =
+        {.nrOfBreakpoints = 4u,
+         .breakpoints =
+             {{SOF_MOL_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC, (int32_t)SOF_MOL_CURRENT_LIMP_HOME_mA},
+              {SOF_MOL_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC, (int32_t)SOF_MOL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA},
+              {SOF_MOL_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC, (int32_t)SOF_MOL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA},
+              {SOF_MOL_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC, 0}}},
+    .chargeCurrentOverTemperature =
+        {.nrOfBreakpoints = 4u,
+         .breakpoints =
+             {{SOF_MOL_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC, 0},
+              {SOF_MOL_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC, (int32_t)SOF_MOL_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_MOL_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC, (int32_t)SOF_MOL_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_MOL_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC, 0}}},
+};
 
 const SOF_CONFIG_s sof_recommendedSafetyLimit = {
-    .maximumChargeCurrent_mA              = SOF_RSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA,
-    .maximumDischargeCurrent_mA           = SOF_RSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA,
-    .limpHomeCurrent_mA                   = SOF_RSL_CURRENT_LIMP_HOME_mA,
-    .cutoffLowTemperatureDischarge_ddegC  = SOF_RSL_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC,
-    .limitLowTemperatureDischarge_ddegC   = SOF_RSL_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC,
-    .cutoffLowTemperatureCharge_ddegC     = SOF_RSL_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC,
-    .limitLowTemperatureCharge_ddegC      = SOF_RSL_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC,
-    .cutoffHighTemperatureDischarge_ddegC = SOF_RSL_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC,
-    .limitHighTemperatureDischarge_ddegC  = SOF_RSL_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC,
-    .cutoffHighTemperatureCharge_ddegC    = SOF_RSL_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC,
-    .limitHighTemperatureCharge_ddegC     = SOF_RSL_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC,
-    .limitUpperCellVoltage_mV             = SOF_RSL_VOLTAGE_LIMIT_CHARGE_mV,
-    .cutoffUpperCellVoltage_mV            = SOF_RSL_VOLTAGE_CUTOFF_CHARGE_mV,
-    .limitLowerCellVoltage_mV             = SOF_RSL_VOLTAGE_LIMIT_DISCHARGE_mV,
-    .cutoffLowerCellVoltage_mV            = SOF_RSL_VOLTAGE_CUTOFF_DISCHARGE_mV};
+    .dischargeCurrentOverCellVoltage =
+        {.nrOfBreakpoints = 2u,
+         .breakpoints =
+             {{SOF_RSL_VOLTAGE_LIMIT_DISCHARGE_mV, 0},
+              {SOF_RSL_VOLTAGE_CUTOFF_DISCHARGE_mV, (int32_t)SOF_RSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA}}},
+    .chargeCurrentOverCellVoltage =
+        {.nrOfBreakpoints = 2u,
+         .breakpoints =
+             {{SOF_RSL_VOLTAGE_CUTOFF_CHARGE_mV, (int32_t)SOF_RSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_RSL_VOLTAGE_LIMIT_CHARGE_mV, 0}}},
+    .dischargeCurrentOverTemperature =
+        {.nrOfBreakpoints = 4u,
+         .breakpoints =
+             {{SOF_RSL_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC, (int32_t)SOF_RSL_CURRENT_LIMP_HOME_mA},
+              {SOF_RSL_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC, (int32_t)SOF_RSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA},
+              {SOF_RSL_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC, (int32_t)SOF_RSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA},
+              {SOF_RSL_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC, 0}}},
+    .chargeCurrentOverTemperature =
+        {.nrOfBreakpoints = 4u,
+         .breakpoints =
+             {{SOF_RSL_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC, 0},
+              {SOF_RSL_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC, (int32_t)SOF_RSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_RSL_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC, (int32_t)SOF_RSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_RSL_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC, 0}}},
+};
 
 const SOF_CONFIG_s sof_configMaximumSafetyLimit = {
-    .maximumChargeCurrent_mA              = SOF_MSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA,
-    .maximumDischargeCurrent_mA           = SOF_MSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA,
-    .limpHomeCurrent_mA                   = SOF_MSL_CURRENT_LIMP_HOME_mA,
-    .cutoffLowTemperatureDischarge_ddegC  = SOF_MSL_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC,
-    .limitLowTemperatureDischarge_ddegC   = SOF_MSL_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC,
-    .cutoffLowTemperatureCharge_ddegC     = SOF_MSL_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC,
-    .limitLowTemperatureCharge_ddegC      = SOF_MSL_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC,
-    .cutoffHighTemperatureDischarge_ddegC = SOF_MSL_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC,
-    .limitHighTemperatureDischarge_ddegC  = SOF_MSL_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC,
-    .cutoffHighTemperatureCharge_ddegC    = SOF_MSL_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC,
-    .limitHighTemperatureCharge_ddegC     = SOF_MSL_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC,
-    .limitUpperCellVoltage_mV             = SOF_MSL_VOLTAGE_LIMIT_CHARGE_mV,
-    .cutoffUpperCellVoltage_mV            = SOF_MSL_VOLTAGE_CUTOFF_CHARGE_mV,
-    .limitLowerCellVoltage_mV             = SOF_MSL_VOLTAGE_LIMIT_DISCHARGE_mV,
-    .cutoffLowerCellVoltage_mV            = SOF_MSL_VOLTAGE_CUTOFF_DISCHARGE_mV};
+    .dischargeCurrentOverCellVoltage =
+        {.nrOfBreakpoints = 2u,
+         .breakpoints =
+             {{SOF_MSL_VOLTAGE_LIMIT_DISCHARGE_mV, 0},
+              {SOF_MSL_VOLTAGE_CUTOFF_DISCHARGE_mV, (int32_t)SOF_MSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA}}},
+    .chargeCurrentOverCellVoltage =
+        {.nrOfBreakpoints = 2u,
+         .breakpoints =
+             {{SOF_MSL_VOLTAGE_CUTOFF_CHARGE_mV, (int32_t)SOF_MSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_MSL_VOLTAGE_LIMIT_CHARGE_mV, 0}}},
+    .dischargeCurrentOverTemperature =
+        {.nrOfBreakpoints = 4u,
+         .breakpoints =
+             {{SOF_MSL_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC, (int32_t)SOF_MSL_CURRENT_LIMP_HOME_mA},
+              {SOF_MSL_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC, (int32_t)SOF_MSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA},
+              {SOF_MSL_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC, (int32_t)SOF_MSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA},
+              {SOF_MSL_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC, 0}}},
+    .chargeCurrentOverTemperature =
+        {.nrOfBreakpoints = 4u,
+         .breakpoints =
+             {{SOF_MSL_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC, 0},
+              {SOF_MSL_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC, (int32_t)SOF_MSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_MSL_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC, (int32_t)SOF_MSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA},
+              {SOF_MSL_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC, 0}}},
+};
 
 /*========== Static Function Prototypes =====================================*/
 
@@ -315,35 +315,44 @@
 #define SOF_MSL_VOLTAGE_LIMIT_DISCHARGE_mV (1750)
 /**@}*/
 
+/** maximum number of breakpoints of a single derating curve */
+#define SOF_MAXIMUM_NR_OF_BREAKPOINTS (8u)
+
+/** breakpoint of a derating curve */
+typedef struct SOF_BREAKPOINT {
+    int16_t input;      /*!< cell voltage in mV or cell temperature in deci &deg;C */
+    int32_t current_mA; /*!< allowed current at this input, unit: mA */
+} SOF_BREAKPOINT_s;
+
+/**
+ * piecewise linear derating curve
+ *
+ * The breakpoints have to be sorted by strictly increasing input. Between two
+ * breakpoints the allowed current is interpolated linearly, below the first
+ * and above the last breakpoint the current of that breakpoint applies.
+ */
+typedef struct SOF_DERATING_CURVE {
+    uint8_t nrOfBreakpoints;                                     /*!< number of used breakpoints */
+    SOF_BREAKPOINT_s breakpoints[SOF_MAXIMUM_NR_OF_BREAKPOINTS]; /*!< breakpoints of the curve */
+} SOF_DERATING_CURVE_s;
+
 /**
  * structure for configuration of SoF Calculation
+ *
+ * Each curve is evaluated at the minimum and at the maximum value of its input
+ * and the smaller current applies. This yields the derating of the whole
+ * input range as long as the curve rises to a plateau and falls from it again,
+ * which is the shape of the derating curves found in cell datasheets.
  */
 typedef struct SOF_CONFIG {
-    /** Current derating limits @{ */
-    float maximumDischargeCurrent_mA;
-    float maximumChargeCurrent_mA;
-    float limpHomeCurrent_mA;
-    /**@}*/
-
-    /** Low temperature derating limits @{ */
-    int16_t cutoffLowTemperatureDischarge_ddegC;
-    int16_t limitLowTemperatureDischarge_ddegC;
-    int16_t cutoffLowTemperatureCharge_ddegC;
-    int16_t limitLowTemperatureCharge_ddegC;
-    /**@}*/
-
-    /** High temperature derating limits @{ */
-    int16_t cutoffHighTemperatureDischarge_ddegC;
-    int16_t limitHighTemperatureDischarge_ddegC;
-    int16_t cutoffHighTemperatureCharge_ddegC;
-    int16_t limitHighTemperatureCharge_ddegC;
+    /** Cell voltage derating curves, input in mV @{ */
+    SOF_DERATING_CURVE_s dischargeCurrentOverCellVoltage;
+    SOF_DERATING_CURVE_s chargeCurrentOverCellVoltage;
     /**@}*/
 
-    /** Cell voltage derating limits @{ */
-    int16_t cutoffUpperCellVoltage_mV;
-    int16_t limitUpperCellVoltage_mV;
-    int16_t cutoffLowerCellVoltage_mV;
-    int16_t limitLowerCellVoltage_mV;
+    /** Cell temperature derating curves, input in deci &deg;C @{ */
+    SOF_DERATING_CURVE_s dischargeCurrentOverTemperature;
+    SOF_DERATING_CURVE_s chargeCurrentOverTemperature;
     /**@}*/
 } SOF_CONFIG_s;
 
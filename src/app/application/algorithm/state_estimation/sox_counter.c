@@ -0,0 +1,200 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_counter.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup APPLICATION
+ * @prefix  SOX
+ *
+ * @brief   Fixed-point charge and energy counter of the state estimation
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "sox_counter.h"
+
+#include "battery_system_cfg.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/** number of &micro;As per mAs */
+#define SOX_uAs_PER_mAs (1000)
+
+/** number of nWs per mWs */
+#define SOX_nWs_PER_mWs (1000000)
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   Converts a percentage of the capacity of a reference into a value.
+ * @param   pReference  reference
+ * @param   value_perc  percentage, limited to [0.0, 100.0]
+ * @return  charge (mAs) or energy (mWs)
+ */
+static int64_t SOX_GetValueFromPercentage(const SOX_REFERENCE_s *pReference, float value_perc);
+
+/**
+ * @brief   Converts a value into a percentage of the capacity of a reference.
+ * @param   pReference  reference
+ * @param   value       charge (mAs) or energy (mWs), in [0, capacity]
+ * @return  percentage
+ */
+static float SOX_GetPercentageFromValue(const SOX_REFERENCE_s *pReference, int64_t value);
+
+/*========== Static Function Implementations ================================*/
+
+static int64_t SOX_GetValueFromPercentage(const SOX_REFERENCE_s *pReference, float value_perc) {
+    float limited_perc = value_perc;
+    if (limited_perc > 100.0f) {
+        limited_perc = 100.0f;
+    }
+    if (limited_perc < 0.0f) {
+        limited_perc = 0.0f;
+    }
+    return (int64_t)((limited_perc / 100.0f) * (float)pReference->capacity);
+}
+
+static float SOX_GetPercentageFromValue(const SOX_REFERENCE_s *pReference, int64_t value) {
+    return 100.0f * ((float)value / (float)pReference->capacity);
+}
+
+/*========== Extern Function Implementations ================================*/
+
+extern void SOX_InitializeCounter(SOX_COUNTER_s *pCounter, uint32_t timestamp_ms) {
+    FAS_ASSERT(pCounter != NULL_PTR);
+    pCounter->dischargedCharge_mAs = 0;
+    pCounter->dischargedEnergy_mWs = 0;
+    pCounter->chargeRemainder_uAs  = 0;
+    pCounter->energyRemainder_nWs  = 0;
+    pCounter->previousTimestamp_ms = timestamp_ms;
+}
+
+extern void SOX_AddSample(SOX_COUNTER_s *pCounter, int32_t current_mA, int32_t voltage_mV, uint32_t timestamp_ms) {
+    FAS_ASSERT(pCounter != NULL_PTR);
+    /* the difference is also valid if the timestamp has wrapped around */
+    const uint32_t timestep_ms = timestamp_ms - pCounter->previousTimestamp_ms;
+
+    if (timestep_ms > 0u) {
+        /* mA * ms = uAs and mA * mV * ms = nWs: no overflow for currents up
+           to 2000 A, voltages up to 1000 V and time steps up to one hour */
+        int64_t charge_uAs = (int64_t)current_mA * (int64_t)timestep_ms;
+        int64_t energy_nWs = (int64_t)current_mA * (int64_t)voltage_mV * (int64_t)timestep_ms;
+
+#if POSITIVE_DISCHARGE_CURRENT == false
+        charge_uAs = -charge_uAs;
+        energy_nWs = -energy_nWs;
+#endif /* POSITIVE_DISCHARGE_CURRENT == false */
+
+        /* carry the part below the resolution, the sum stays exact */
+        charge_uAs += pCounter->chargeRemainder_uAs;
+        energy_nWs += pCounter->energyRemainder_nWs;
+        pCounter->dischargedCharge_mAs += charge_uAs / SOX_uAs_PER_mAs;
+        pCounter->dischargedEnergy_mWs += energy_nWs / SOX_nWs_PER_mWs;
+
+        pCounter->chargeRemainder_uAs  = (int32_t)(charge_uAs % SOX_uAs_PER_mAs);
+        pCounter->energyRemainder_nWs  = (int32_t)(energy_nWs % SOX_nWs_PER_mWs);
+        pCounter->previousTimestamp_ms = timestamp_ms;
+    }
+}
+
+extern void SOX_SetReference(
+    SOX_REFERENCE_s *pReference,
+    int64_t capacity,
+    int64_t counterValue,
+    float minimum_perc,
+    float average_perc,
+    float maximum_perc) {
+    FAS_ASSERT(pReference != NULL_PTR);
+    FAS_ASSERT(capacity > 0);
+    pReference->capacity           = capacity;
+    pReference->minimum            = SOX_GetValueFromPercentage(pReference, minimum_perc);
+    pReference->average            = SOX_GetValueFromPercentage(pReference, average_perc);
+    pReference->maximum            = SOX_GetValueFromPercentage(pReference, maximum_perc);
+    pReference->counterAtReference = counterValue;
+}
+
+extern int64_t SOX_GetRemaining(SOX_REFERENCE_s *pReference, int64_t *pReferenceValue, int64_t counterValue) {
+    FAS_ASSERT(pReference != NULL_PTR);
+    FAS_ASSERT(pReferenceValue != NULL_PTR);
+    const int64_t unlimited = *pReferenceValue - (counterValue - pReference->counterAtReference);
+    int64_t remaining       = unlimited;
+    if (remaining > pReference->capacity) {
+        remaining = pReference->capacity;
+    }
+    if (remaining < 0) {
+        remaining = 0;
+    }
+    /* re-anchor the reference at the limit, so that the counted charge or
+       energy beyond the limit does not have to be counted back first */
+    *pReferenceValue += remaining - unlimited;
+    return remaining;
+}
+
+extern void SOX_GetPercentages(
+    SOX_REFERENCE_s *pReference,
+    int64_t counterValue,
+    float *pMinimum_perc,
+    float *pAverage_perc,
+    float *pMaximum_perc) {
+    FAS_ASSERT(pReference != NULL_PTR);
+    FAS_ASSERT(pReference->capacity > 0);
+    if (pMinimum_perc != NULL_PTR) {
+        *pMinimum_perc =
+            SOX_GetPercentageFromValue(pReference, SOX_GetRemaining(pReference, &pReference->minimum, counterValue));
+    }
+    if (pAverage_perc != NULL_PTR) {
+        *pAverage_perc =
+            SOX_GetPercentageFromValue(pReference, SOX_GetRemaining(pReference, &pReference->average, counterValue));
+    }
+    if (pMaximum_perc != NULL_PTR) {
+        *pMaximum_perc =
+            SOX_GetPercentageFromValue(pReference, SOX_GetRemaining(pReference, &pReference->maximum, counterValue));
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
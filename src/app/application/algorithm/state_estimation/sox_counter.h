@@ -0,0 +1,166 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sox_counter.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup APPLICATION
+ * @prefix  SOX
+ *
+ * @brief   Header for the fixed-point charge and energy counter of the
+ *          state estimation
+ *
+ * @details The counter integrates the current in mAs and the power in mWs
+ *          with 64 bit integers. The parts below the resolution are carried
+ *          to the next sample, so that the integration is exact. Percentage
+ *          values are only calculated from the integrated values when they
+ *          are published.
+ *
+ */
+
+#ifndef FOXBMS__SOX_COUNTER_H_
+#define FOXBMS__SOX_COUNTER_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/** integrated charge and energy of a string, discharge is positive */
+typedef struct {
+    int64_t dischargedCharge_mAs;  /*!< charge that has been discharged since initialization */
+    int64_t dischargedEnergy_mWs;  /*!< energy that has been discharged since initialization */
+    int32_t chargeRemainder_uAs;   /*!< charge below 1 mAs that is carried to the next sample */
+    int32_t energyRemainder_nWs;   /*!< energy below 1 mWs that is carried to the next sample */
+    uint32_t previousTimestamp_ms; /*!< timestamp of the last sample */
+} SOX_COUNTER_s;
+
+/**
+ * minimum, average and maximum remaining charge or energy, referenced to the
+ * value of a counter
+ */
+typedef struct {
+    int64_t minimum;            /*!< remaining minimum charge (mAs) or energy (mWs) at the reference */
+    int64_t average;            /*!< remaining average charge (mAs) or energy (mWs) at the reference */
+    int64_t maximum;            /*!< remaining maximum charge (mAs) or energy (mWs) at the reference */
+    int64_t counterAtReference; /*!< discharged charge (mAs) or energy (mWs) of the counter at the reference */
+    int64_t capacity;           /*!< charge (mAs) or energy (mWs) that corresponds to 100 % */
+} SOX_REFERENCE_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Resets a counter.
+ * @param   pCounter        counter
+ * @param   timestamp_ms    timestamp from which the next sample is integrated
+ */
+extern void SOX_InitializeCounter(SOX_COUNTER_s *pCounter, uint32_t timestamp_ms);
+
+/**
+ * @brief   Integrates a current sample.
+ * @details The current and the voltage are integrated over the time since
+ *          the previous sample. The sign convention of
+ *          #POSITIVE_DISCHARGE_CURRENT is applied. A sample with the
+ *          timestamp of the previous sample is ignored.
+ * @param   pCounter        counter
+ * @param   current_mA      current of the sample
+ * @param   voltage_mV      voltage of the sample
+ * @param   timestamp_ms    timestamp of the sample
+ */
+extern void SOX_AddSample(SOX_COUNTER_s *pCounter, int32_t current_mA, int32_t voltage_mV, uint32_t timestamp_ms);
+
+/**
+ * @brief   Sets the minimum, average and maximum value of a reference.
+ * @param   pReference      reference
+ * @param   capacity        charge (mAs) or energy (mWs) that corresponds to 100 %
+ * @param   counterValue    discharged charge or energy of the counter at the reference
+ * @param   minimum_perc    minimum value in percent of the capacity
+ * @param   average_perc    average value in percent of the capacity
+ * @param   maximum_perc    maximum value in percent of the capacity
+ */
+extern void SOX_SetReference(
+    SOX_REFERENCE_s *pReference,
+    int64_t capacity,
+    int64_t counterValue,
+    float minimum_perc,
+    float average_perc,
+    float maximum_perc);
+
+/**
+ * @brief   Calculates the remaining minimum, average and maximum values in
+ *          percent of the capacity.
+ * @details The values are limited to [0.0, 100.0], a limited value is
+ *          re-anchored (see #SOX_GetRemaining()). The pointers may be
+ *          #NULL_PTR if a value is not needed.
+ * @param   pReference      reference
+ * @param   counterValue    current discharged charge or energy of the counter
+ * @param   pMinimum_perc   remaining minimum value
+ * @param   pAverage_perc   remaining average value
+ * @param   pMaximum_perc   remaining maximum value
+ */
+extern void SOX_GetPercentages(
+    SOX_REFERENCE_s *pReference,
+    int64_t counterValue,
+    float *pMinimum_perc,
+    float *pAverage_perc,
+    float *pMaximum_perc);
+
+/**
+ * @brief   Calculates a remaining value of a reference.
+ * @details The value is limited to [0, capacity]. If it is limited, the
+ *          value of the reference is moved so that the limit is the remaining
+ *          value at the counter value: the charge or energy that is counted
+ *          beyond 0 % or 100 % is discarded and the remaining value follows
+ *          the counter as soon as the direction of the current reverses.
+ * @param   pReference      reference
+ * @param   pReferenceValue minimum, average or maximum value of the reference
+ * @param   counterValue    current discharged charge or energy of the counter
+ * @return  remaining charge (mAs) or energy (mWs)
+ */
+extern int64_t SOX_GetRemaining(SOX_REFERENCE_s *pReference, int64_t *pReferenceValue, int64_t counterValue);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__SOX_COUNTER_H_ */
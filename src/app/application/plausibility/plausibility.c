@@ -56,6 +56,7 @@
 
 #include "battery_system_cfg.h"
 
+#include "cell_statistics.h"
 #include "diag.h"
 #include "foxmath.h"
 
@@ -125,22 +126,23 @@ extern STD_RETURN_TYPE_e PL_CheckVoltageSpread(
 
     STD_RETURN_TYPE_e retval = STD_OK;
 
-    /* Iterate over all cells */
+    /* Iterate over all modules, only valid voltages are checked */
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         STD_RETURN_TYPE_e plausibilityIssueDetected = STD_OK;
+        const int32_t average_mV                    = pMinMaxAverageValues->averageCellVoltage_mV[s];
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES; m++) {
-            for (uint8_t c = 0u; c < BS_NR_OF_CELLS_PER_MODULE; c++) {
-                /* Only do check for valid voltages */
-                if ((pCellvoltages->invalidCellVoltage[s][m] & (0x01u << c)) == 0) {
-                    if (abs(pCellvoltages->cellVoltage_mV[s][(m * BS_NR_OF_CELLS_PER_MODULE) + c] -
-                            pMinMaxAverageValues->averageCellVoltage_mV[s]) > PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV) {
-                        /* Voltage difference too large */
-                        plausibilityIssueDetected = STD_NOT_OK;
-                        retval                    = STD_NOT_OK;
-                        /* Set this cell voltage invalid */
-                        pCellvoltages->invalidCellVoltage[s][m] |= (0x01u << c);
-                    }
-                }
+            const uint64_t spreadTooLarge = CSTAT_GetOutOfRangeValues(
+                &pCellvoltages->cellVoltage_mV[s][m * BS_NR_OF_CELLS_PER_MODULE],
+                BS_NR_OF_CELLS_PER_MODULE,
+                pCellvoltages->invalidCellVoltage[s][m],
+                average_mV - PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV,
+                average_mV + PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV);
+            if (spreadTooLarge != 0u) {
+                /* Voltage difference too large */
+                plausibilityIssueDetected = STD_NOT_OK;
+                retval                    = STD_NOT_OK;
+                /* Set these cell voltages invalid */
+                pCellvoltages->invalidCellVoltage[s][m] |= spreadTooLarge;
             }
         }
         DIAG_CheckEvent(plausibilityIssueDetected, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, s);
@@ -157,26 +159,27 @@ extern STD_RETURN_TYPE_e PL_CheckTemperatureSpread(
 
     STD_RETURN_TYPE_e retval = STD_OK;
 
-    /* Iterate over all cells */
+    /* Iterate over all modules, only valid temperatures are checked */
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
         STD_RETURN_TYPE_e plausibilityIssueDetected = STD_OK;
+        const int32_t average_ddegC                 = (int16_t)pMinMaxAverageValues->averageTemperature_ddegC[s];
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES; m++) {
-            for (uint8_t c = 0u; c < BS_NR_OF_TEMP_SENSORS_PER_MODULE; c++) {
-                /* Only do check for valid temperatures */
-                if ((pCellTemperatures->invalidCellTemperature[s][m] & (0x01u << c)) == 0) {
-                    if (abs(pCellTemperatures->cellTemperature_ddegC[s][(m * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + c] -
-                            (int16_t)pMinMaxAverageValues->averageTemperature_ddegC[s]) >
-                        PL_CELL_TEMPERATURE_SPREAD_TOLERANCE_dK) {
-                        /* temperature difference too large */
-                        plausibilityIssueDetected = STD_NOT_OK;
-                        retval                    = STD_NOT_OK;
-                        /* Set this cell temperature invalid */
-                        pCellTemperatures->invalidCellTemperature[s][m] |= (0x01u << c);
-                    } else {
-                        pCellTemperatures->nrValidTemperatures[s]++;
-                    }
-                }
+            const uint64_t spreadTooLarge = CSTAT_GetOutOfRangeValues(
+                &pCellTemperatures->cellTemperature_ddegC[s][m * BS_NR_OF_TEMP_SENSORS_PER_MODULE],
+                BS_NR_OF_TEMP_SENSORS_PER_MODULE,
+                pCellTemperatures->invalidCellTemperature[s][m],
+                average_ddegC - PL_CELL_TEMPERATURE_SPREAD_TOLERANCE_dK,
+                average_ddegC + PL_CELL_TEMPERATURE_SPREAD_TOLERANCE_dK);
+            if (spreadTooLarge != 0u) {
+                /* temperature difference too large */
+                plausibilityIssueDetected = STD_NOT_OK;
+                retval                    = STD_NOT_OK;
+                /* Set these cell temperatures invalid */
+                pCellTemperatures->invalidCellTemperature[s][m] |= (uint16_t)spreadTooLarge;
             }
+            /* all remaining valid temperatures passed the check */
+            pCellTemperatures->nrValidTemperatures[s] += CSTAT_CountValidValues(
+                BS_NR_OF_TEMP_SENSORS_PER_MODULE, pCellTemperatures->invalidCellTemperature[s][m]);
         }
         DIAG_CheckEvent(plausibilityIssueDetected, DIAG_ID_PLAUSIBILITY_CELL_TEMPERATURE_SPREAD, DIAG_STRING, s);
     }
@@ -56,6 +56,7 @@
 #include "redundancy.h"
 
 #include "bms.h"
+#include "cell_statistics.h"
 #include "database.h"
 #include "diag.h"
 #include "foxmath.h"
@@ -768,45 +769,28 @@ static STD_RETURN_TYPE_e MRC_CalculateCellVoltageMinMaxAverage(
     STD_RETURN_TYPE_e retval = STD_OK;
 
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
-        uint16_t nrValidCellvoltages = 0u;
-        int16_t min                  = INT16_MAX;
-        int16_t max                  = INT16_MIN;
-        int32_t sum                  = 0;
-        uint16_t moduleNumberMinimum = 0u;
-        uint16_t cellNumberMinimum   = 0u;
-        uint16_t moduleNumberMaximum = 0u;
-        uint16_t cellNumberMaximum   = 0u;
-        /* Iterate over all cells in each string */
+        CSTAT_STATISTICS_s statistics = {0};
+        CSTAT_InitializeStatistics(&statistics);
+        /* Iterate over all modules in each string, only valid cell voltages are used */
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES; m++) {
-            for (uint8_t c = 0u; c < BS_NR_OF_CELLS_PER_MODULE; c++) {
-                if ((pValidatedVoltages->invalidCellVoltage[s][m] & (0x01u << c)) == 0u) {
-                    /* Cell voltage is valid -> use this voltage for subsequent calculations */
-                    nrValidCellvoltages++;
-                    sum += pValidatedVoltages->cellVoltage_mV[s][(m * BS_NR_OF_CELLS_PER_MODULE) + c];
-
-                    if (pValidatedVoltages->cellVoltage_mV[s][(m * BS_NR_OF_CELLS_PER_MODULE) + c] < min) {
-                        min = pValidatedVoltages->cellVoltage_mV[s][(m * BS_NR_OF_CELLS_PER_MODULE) + c];
-                        moduleNumberMinimum = m;
-                        cellNumberMinimum   = c;
-                    }
-                    if (pValidatedVoltages->cellVoltage_mV[s][(m * BS_NR_OF_CELLS_PER_MODULE) + c] > max) {
-                        max = pValidatedVoltages->cellVoltage_mV[s][(m * BS_NR_OF_CELLS_PER_MODULE) + c];
-                        moduleNumberMaximum = m;
-                        cellNumberMaximum   = c;
-                    }
-                }
-            }
+            CSTAT_AddValues(
+                &pValidatedVoltages->cellVoltage_mV[s][m * BS_NR_OF_CELLS_PER_MODULE],
+                BS_NR_OF_CELLS_PER_MODULE,
+                pValidatedVoltages->invalidCellVoltage[s][m],
+                (uint16_t)(m * BS_NR_OF_CELLS_PER_MODULE),
+                &statistics);
         }
-        pMinMaxAverageValues->minimumCellVoltage_mV[s]      = min;
-        pMinMaxAverageValues->nrCellMinimumCellVoltage[s]   = cellNumberMinimum;
-        pMinMaxAverageValues->nrModuleMinimumCellVoltage[s] = moduleNumberMinimum;
-        pMinMaxAverageValues->maximumCellVoltage_mV[s]      = max;
-        pMinMaxAverageValues->nrCellMaximumCellVoltage[s]   = cellNumberMaximum;
-        pMinMaxAverageValues->nrModuleMaximumCellVoltage[s] = moduleNumberMaximum;
+        pMinMaxAverageValues->minimumCellVoltage_mV[s]      = statistics.minimum;
+        pMinMaxAverageValues->nrCellMinimumCellVoltage[s]   = statistics.minimumIndex % BS_NR_OF_CELLS_PER_MODULE;
+        pMinMaxAverageValues->nrModuleMinimumCellVoltage[s] = statistics.minimumIndex / BS_NR_OF_CELLS_PER_MODULE;
+        pMinMaxAverageValues->maximumCellVoltage_mV[s]      = statistics.maximum;
+        pMinMaxAverageValues->nrCellMaximumCellVoltage[s]   = statistics.maximumIndex % BS_NR_OF_CELLS_PER_MODULE;
+        pMinMaxAverageValues->nrModuleMaximumCellVoltage[s] = statistics.maximumIndex / BS_NR_OF_CELLS_PER_MODULE;
 
         /* Prevent division by 0, if all cell voltages are invalid */
-        if (nrValidCellvoltages > 0u) {
-            pMinMaxAverageValues->averageCellVoltage_mV[s] = (int16_t)(sum / (int32_t)nrValidCellvoltages);
+        if (statistics.nrOfValidValues > 0u) {
+            pMinMaxAverageValues->averageCellVoltage_mV[s] =
+                (int16_t)(statistics.sum / (int32_t)statistics.nrOfValidValues);
         } else {
             pMinMaxAverageValues->averageCellVoltage_mV[s] = 0;
             retval                                         = STD_NOT_OK;
@@ -825,50 +809,32 @@ static STD_RETURN_TYPE_e MRC_CalculateCellTemperatureMinMaxAverage(
     STD_RETURN_TYPE_e retval = STD_OK;
 
     for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
-        uint16_t moduleNumberMinimum     = 0u;
-        uint16_t sensorNumberMinimum     = 0u;
-        uint16_t moduleNumberMaximum     = 0u;
-        uint16_t sensorNumberMaximum     = 0u;
-        uint16_t nrValidCelltemperatures = 0u;
-        int16_t min                      = INT16_MAX;
-        int16_t max                      = INT16_MIN;
-        float sum_ddegC                  = 0.0f;
-
+        CSTAT_STATISTICS_s statistics = {0};
+        CSTAT_InitializeStatistics(&statistics);
+        /* Iterate over all modules in each string, only valid cell temperatures are used */
         for (uint8_t m = 0u; m < BS_NR_OF_MODULES; m++) {
-            for (uint8_t c = 0u; c < BS_NR_OF_TEMP_SENSORS_PER_MODULE; c++) {
-                if ((pValidatedTemperatures->invalidCellTemperature[s][m] & (0x01u << c)) == 0u) {
-                    /* Cell temperature is valid -> use this voltage for subsequent calculations */
-                    nrValidCelltemperatures++;
-                    sum_ddegC += (float)pValidatedTemperatures
-                                     ->cellTemperature_ddegC[s][(m * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + c];
-
-                    if (pValidatedTemperatures->cellTemperature_ddegC[s][(m * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + c] <
-                        min) {
-                        min = pValidatedTemperatures
-                                  ->cellTemperature_ddegC[s][(m * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + c];
-                        moduleNumberMinimum = m;
-                        sensorNumberMinimum = c;
-                    }
-                    if (pValidatedTemperatures->cellTemperature_ddegC[s][(m * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + c] >
-                        max) {
-                        max = pValidatedTemperatures
-                                  ->cellTemperature_ddegC[s][(m * BS_NR_OF_TEMP_SENSORS_PER_MODULE) + c];
-                        moduleNumberMaximum = m;
-                        sensorNumberMaximum = c;
-                    }
-                }
-            }
+            CSTAT_AddValues(
+                &pValidatedTemperatures->cellTemperature_ddegC[s][m * BS_NR_OF_TEMP_SENSORS_PER_MODULE],
+                BS_NR_OF_TEMP_SENSORS_PER_MODULE,
+                pValidatedTemperatures->invalidCellTemperature[s][m],
+                (uint16_t)(m * BS_NR_OF_TEMP_SENSORS_PER_MODULE),
+                &statistics);
         }
-        pMinMaxAverageValues->minimumTemperature_ddegC[s]   = min;
-        pMinMaxAverageValues->nrSensorMinimumTemperature[s] = sensorNumberMinimum;
-        pMinMaxAverageValues->nrModuleMinimumTemperature[s] = moduleNumberMinimum;
-        pMinMaxAverageValues->maximumTemperature_ddegC[s]   = max;
-        pMinMaxAverageValues->nrSensorMaximumTemperature[s] = sensorNumberMaximum;
-        pMinMaxAverageValues->nrModuleMaximumTemperature[s] = moduleNumberMaximum;
-
-        /* Prevent division by 0, if all cell voltages are invalid */
-        if (nrValidCelltemperatures > 0u) {
-            pMinMaxAverageValues->averageTemperature_ddegC[s] = (sum_ddegC / (float)nrValidCelltemperatures);
+        pMinMaxAverageValues->minimumTemperature_ddegC[s] = statistics.minimum;
+        pMinMaxAverageValues->nrSensorMinimumTemperature[s] =
+            statistics.minimumIndex % BS_NR_OF_TEMP_SENSORS_PER_MODULE;
+        pMinMaxAverageValues->nrModuleMinimumTemperature[s] =
+            statistics.minimumIndex / BS_NR_OF_TEMP_SENSORS_PER_MODULE;
+        pMinMaxAverageValues->maximumTemperature_ddegC[s] = statistics.maximum;
+        pMinMaxAverageValues->nrSensorMaximumTemperature[s] =
+            statistics.maximumIndex % BS_NR_OF_TEMP_SENSORS_PER_MODULE;
+        pMinMaxAverageValues->nrModuleMaximumTemperature[s] =
+            statistics.maximumIndex / BS_NR_OF_TEMP_SENSORS_PER_MODULE;
+
+        /* Prevent division by 0, if all cell temperatures are invalid */
+        if (statistics.nrOfValidValues > 0u) {
+            pMinMaxAverageValues->averageTemperature_ddegC[s] =
+                ((float)statistics.sum / (float)statistics.nrOfValidValues);
         } else {
             pMinMaxAverageValues->averageTemperature_ddegC[s] = 0.0f;
             retval                                            = STD_NOT_OK;
@@ -1120,7 +1086,7 @@ extern STD_RETURN_TYPE_e MRC_ValidatePackMeasurement(void) {
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
-#ifdef UNITY_UNIT_TEST
+#if defined(UNITY_UNIT_TEST) || defined(FOXBMS_BENCHMARK)
 extern bool TEST_MRC_MeasurementUpdatedAtLeastOnce(uint32_t timestamp, uint32_t previousTimestamp) {
     return MRC_MeasurementUpdatedAtLeastOnce(timestamp, previousTimestamp);
 }
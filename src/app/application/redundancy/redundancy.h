@@ -142,7 +142,7 @@ extern STD_RETURN_TYPE_e MRC_ValidateMicMeasurement(void);
 extern STD_RETURN_TYPE_e MRC_ValidatePackMeasurement(void);
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
-#ifdef UNITY_UNIT_TEST
+#if defined(UNITY_UNIT_TEST) || defined(FOXBMS_BENCHMARK)
 extern bool TEST_MRC_MeasurementUpdatedAtLeastOnce(uint32_t timestamp, uint32_t previousTimestamp);
 extern STD_RETURN_TYPE_e TEST_MRC_MeasurementUpdatedRecently(
     uint32_t timestamp,
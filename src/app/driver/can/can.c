@@ -66,14 +66,45 @@
 
 /*========== Macros and Definitions =========================================*/
 
+/** length of the TX schedule cycle in ms */
+#define CAN_TX_SCHEDULE_CYCLE_MS (CAN_TX_SCHEDULE_TICKS * CAN_TICK_MS)
+
+/* the schedule has to be able to hold at least one transmission per slot */
+static_assert(CAN_TX_SCHEDULE_MAXIMUM_ENTRIES >= CAN_TX_SCHEDULE_TICKS, "TX schedule too small");
+/* slot start indices are stored as uint16_t */
+static_assert(CAN_TX_SCHEDULE_MAXIMUM_ENTRIES <= UINT16_MAX, "TX schedule too large");
+/* the bus load limit must not exceed the bus capacity of one tick */
+static_assert(CAN_TX_MAXIMUM_BUS_LOAD_PERCENT <= 100u, "TX bus load limit above 100%");
+/* the indices of the RX buffer are stored as uint8_t */
+static_assert(CAN0_RX_BUFFER_LENGTH <= UINT8_MAX, "RX buffer too large");
+/* messages with low priority need at least one usable element of the RX buffer */
+static_assert(CAN_RX_HIGH_PRIORITY_RESERVED_SLOTS < (CAN0_RX_BUFFER_LENGTH - 1u), "too many reserved RX elements");
+
+/**
+ * Memory barrier between the accesses to the elements and to the indices of
+ * the RX buffer. It guarantees that an element is completely written before
+ * the RX interrupt publishes it by incrementing the write index and that
+ * #CAN_ReadRxBuffer has completely read an element before it releases the
+ * element by incrementing the read index.
+ */
+#if defined(FOXBMS_SIL)
+#define CAN_MEMORY_BARRIER() \
+    { __sync_synchronize(); }
+#elif !defined(UNITY_UNIT_TEST)
+#define CAN_MEMORY_BARRIER() \
+    { __asm(" DMB"); }
+#else
+#define CAN_MEMORY_BARRIER()
+#endif
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /** tracks the local state of the can module */
 static CAN_STATE_s can_state = {
     .periodicEnable         = false,
-    .currentSensorPresent   = false,
-    .currentSensorCCPresent = false,
-    .currentSensorECPresent = false,
+    .currentSensorPresent   = {false},
+    .currentSensorCCPresent = {false},
+    .currentSensorECPresent = {false},
 };
 
 /** local buffer for receiving data from CAN */
@@ -81,11 +112,24 @@ static CAN_BUFFERELEMENT_s can_rxBufferData[CAN0_RX_BUFFER_LENGTH];
 
 /** interface object for #can_rxBufferData */
 static CAN_RX_BUFFER_s can_rxBuffer = {
-    .pRead  = &can_rxBufferData[0],
-    .pWrite = &can_rxBufferData[0],
-    .length = CAN0_RX_BUFFER_LENGTH,
+    .readIndex                = 0u,
+    .writeIndex               = 0u,
+    .length                   = CAN0_RX_BUFFER_LENGTH,
+    .receivedMessages         = 0u,
+    .overflowCounter          = 0u,
+    .droppedLowPriorityFrames = 0u,
+    .highWaterMark            = 0u,
 };
 
+/** local copy of the RX statistics that are published in the database */
+static DATA_BLOCK_CAN_RX_STATISTICS_s can_tableRxStatistics = {.header.uniqueId = DATA_BLOCK_ID_CAN_RX_STATISTICS};
+
+/** schedule of the periodic TX messages, built in #CAN_Initialize */
+static CAN_TX_SCHEDULE_s can_txSchedule = {0};
+
+/** dispatch table of the RX messages, built in #CAN_Initialize */
+static CAN_RX_DISPATCH_TABLE_s can_rxDispatchTable = {0};
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
@@ -159,8 +203,115 @@ static void CAN_SetCurrentSensorEcPresent(bool command, uint8_t stringNumber);
 /** initialize the SPI interface to the CAN transceiver */
 static void CAN_InitializeTransceiver(void);
 
+/**
+ * @brief   Returns the worst-case length of a standard CAN frame on the bus.
+ * @details The length includes the maximum number of stuff bits and the
+ *          interframe space.
+ * @param   dlc     data length code of the frame
+ * @return  length of the frame in bits
+ */
+static uint32_t CAN_GetWorstCaseFrameBits(uint8_t dlc);
+
+/**
+ * @brief   Checks if a TX message fits the CAN tick and the TX schedule cycle.
+ * @param   pMessage    TX message to check
+ * @return  true if the timing of the message is valid, false otherwise
+ */
+static bool CAN_IsTxTimingValid(const CAN_MSG_TX_TYPE_s *pMessage);
+
+/**
+ * @brief   Returns the priority of a received message.
+ * @details A message is of high priority if any RX message configured for
+ *          its ID is of high priority. Unknown messages are of low priority.
+ * @param   id  ID of the received message
+ * @return  priority of the message
+ */
+static CAN_RX_PRIORITY_e CAN_GetRxPriority(uint32_t id);
+
+/**
+ * @brief   Stores a received message in the RX buffer.
+ * @details Must only be called from the RX interrupt, as it is the only
+ *          producer of the RX buffer. Low priority messages are dropped if
+ *          storing them would use the elements reserved for high priority
+ *          messages, all messages are dropped if the buffer is full.
+ * @param   id      ID of the received message
+ * @param   pData   payload of the received message (8 bytes)
+ * @return  #STD_OK if the message was stored, #STD_NOT_OK if it was dropped
+ */
+static STD_RETURN_TYPE_e CAN_StoreRxMessage(uint32_t id, const uint8_t *pData);
+
+/**
+ * @brief   Publishes the statistics of the RX buffer in the database.
+ * @details The database entry is only written if the statistics changed.
+ */
+static void CAN_UpdateRxStatistics(void);
+
 /*========== Static Function Implementations ================================*/
 
+static CAN_RX_PRIORITY_e CAN_GetRxPriority(uint32_t id) {
+    CAN_RX_PRIORITY_e priority     = CAN_RX_PRIORITY_LOW;
+    uint8_t entry                  = 0u;
+    const uint8_t numberOfHandlers = CAN_FindRxHandlers(&can_rxDispatchTable, id, &entry);
+    for (uint8_t i = 0u; i < numberOfHandlers; i++) {
+        if (can_rxMessages[can_rxDispatchTable.message[entry + i]].priority == CAN_RX_PRIORITY_HIGH) {
+            priority = CAN_RX_PRIORITY_HIGH;
+        }
+    }
+    return priority;
+}
+
+static STD_RETURN_TYPE_e CAN_StoreRxMessage(uint32_t id, const uint8_t *pData) {
+    FAS_ASSERT(pData != NULL_PTR);
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    const uint8_t readIndex  = can_rxBuffer.readIndex;
+    const uint8_t writeIndex = can_rxBuffer.writeIndex;
+    /* number of pending messages, one element is always kept free */
+    const uint8_t fillLevel = (uint8_t)((writeIndex + can_rxBuffer.length - readIndex) % can_rxBuffer.length);
+    const uint8_t capacity  = can_rxBuffer.length - 1u;
+
+    if (fillLevel >= capacity) {
+        can_rxBuffer.overflowCounter++;
+    } else if (
+        (fillLevel >= (capacity - CAN_RX_HIGH_PRIORITY_RESERVED_SLOTS)) &&
+        (CAN_GetRxPriority(id) == CAN_RX_PRIORITY_LOW)) {
+        can_rxBuffer.droppedLowPriorityFrames++;
+    } else {
+        can_rxBufferData[writeIndex].id = id;
+        for (uint8_t i = 0u; i < CAN_MAX_DLC; i++) {
+            can_rxBufferData[writeIndex].data[i] = pData[i];
+        }
+        /* the element has to be written completely before it is published */
+        CAN_MEMORY_BARRIER();
+        can_rxBuffer.writeIndex = (uint8_t)((writeIndex + 1u) % can_rxBuffer.length);
+        can_rxBuffer.receivedMessages++;
+        if ((fillLevel + 1u) > can_rxBuffer.highWaterMark) {
+            can_rxBuffer.highWaterMark = fillLevel + 1u;
+        }
+        retVal = STD_OK;
+    }
+    return retVal;
+}
+
+static void CAN_UpdateRxStatistics(void) {
+    /* the counters are only written by the RX interrupt, reading a single
+       32-bit counter is atomic */
+    const uint32_t receivedMessages         = can_rxBuffer.receivedMessages;
+    const uint32_t overflowCounter          = can_rxBuffer.overflowCounter;
+    const uint32_t droppedLowPriorityFrames = can_rxBuffer.droppedLowPriorityFrames;
+    const uint8_t highWaterMark             = can_rxBuffer.highWaterMark;
+
+    if ((receivedMessages != can_tableRxStatistics.receivedMessages) ||
+        (overflowCounter != can_tableRxStatistics.overflowCounter) ||
+        (droppedLowPriorityFrames != can_tableRxStatistics.droppedLowPriorityFrames) ||
+        (highWaterMark != can_tableRxStatistics.highWaterMark)) {
+        can_tableRxStatistics.receivedMessages         = receivedMessages;
+        can_tableRxStatistics.overflowCounter          = overflowCounter;
+        can_tableRxStatistics.droppedLowPriorityFrames = droppedLowPriorityFrames;
+        can_tableRxStatistics.highWaterMark            = highWaterMark;
+        DATA_WRITE_DATA(&can_tableRxStatistics);
+    }
+}
+
 static void CAN_InitializeTransceiver(void) {
     /* set EN and STB pins to output */
     SETBIT(CAN_HET1_GIO->DIR, CAN_HET1_EN_PIN);
@@ -183,10 +334,93 @@ static void CAN_InitializeTransceiver(void) {
     MCU_delay_us(CAN_PIN_TOGGLE_DELAY_US);
 }
 
+static uint32_t CAN_GetWorstCaseFrameBits(uint8_t dlc) {
+    /* 34 bits of the standard frame are subject to bit stuffing (SOF to CRC) together with the data,
+     * 13 bits are not (CRC delimiter, ACK, EOF and interframe space) */
+    const uint32_t stuffedBits = 34u + (8u * (uint32_t)dlc);
+    return stuffedBits + 13u + ((stuffedBits - 1u) / 4u);
+}
+
+static bool CAN_IsTxTimingValid(const CAN_MSG_TX_TYPE_s *pMessage) {
+    FAS_ASSERT(pMessage != NULL_PTR);
+    bool isValid = true;
+    if ((pMessage->repetitionTime == 0u) || ((pMessage->repetitionTime % CAN_TICK_MS) != 0u) ||
+        ((CAN_TX_SCHEDULE_CYCLE_MS % pMessage->repetitionTime) != 0u)) {
+        isValid = false;
+    } else if ((pMessage->repetitionPhase >= pMessage->repetitionTime) ||
+               ((pMessage->repetitionPhase % CAN_TICK_MS) != 0u)) {
+        isValid = false;
+    } else if (pMessage->dlc > 8u) {
+        isValid = false;
+    } else {
+        /* timing fits the schedule */
+    }
+    return isValid;
+}
+
 /*========== Extern Function Implementations ================================*/
 
 extern void CAN_Initialize(void) {
     CAN_InitializeTransceiver();
+    const STD_RETURN_TYPE_e txScheduleValid = CAN_BuildTxSchedule(can_txMessages, can_txLength, &can_txSchedule);
+    FAS_ASSERT(txScheduleValid == STD_OK);
+    const STD_RETURN_TYPE_e rxDispatchTableValid =
+        CAN_BuildRxDispatchTable(can_rxMessages, can_rxLength, &can_rxDispatchTable);
+    FAS_ASSERT(rxDispatchTableValid == STD_OK);
+}
+
+extern STD_RETURN_TYPE_e CAN_BuildTxSchedule(
+    const CAN_MSG_TX_TYPE_s *pMessages,
+    uint8_t numberOfMessages,
+    CAN_TX_SCHEDULE_s *pSchedule) {
+    FAS_ASSERT(pMessages != NULL_PTR);
+    FAS_ASSERT(pSchedule != NULL_PTR);
+    STD_RETURN_TYPE_e retVal = STD_OK;
+    uint16_t numberOfEntries = 0u;
+
+    pSchedule->maximumBitsPerSlot = 0u;
+
+    for (uint8_t i = 0u; i < numberOfMessages; i++) {
+        if (CAN_IsTxTimingValid(&pMessages[i]) == false) {
+            retVal = STD_NOT_OK;
+        }
+    }
+
+    for (uint16_t slot = 0u; (slot < CAN_TX_SCHEDULE_TICKS) && (retVal == STD_OK); slot++) {
+        uint32_t bitsInSlot     = 0u;
+        uint16_t messagesInSlot = 0u;
+
+        pSchedule->slotStart[slot] = numberOfEntries;
+        for (uint8_t i = 0u; i < numberOfMessages; i++) {
+            if (((slot * CAN_TICK_MS) % pMessages[i].repetitionTime) == pMessages[i].repetitionPhase) {
+                if (numberOfEntries < CAN_TX_SCHEDULE_MAXIMUM_ENTRIES) {
+                    pSchedule->entries[numberOfEntries] = i;
+                    numberOfEntries++;
+                } else {
+                    retVal = STD_NOT_OK;
+                }
+                bitsInSlot += CAN_GetWorstCaseFrameBits(pMessages[i].dlc);
+                messagesInSlot++;
+            }
+        }
+        if (bitsInSlot > pSchedule->maximumBitsPerSlot) {
+            pSchedule->maximumBitsPerSlot = bitsInSlot;
+        }
+        /* phases of too many messages collide in this slot */
+        if ((bitsInSlot > CAN_TX_MAXIMUM_BITS_PER_TICK) || (messagesInSlot > CAN_TX_MAXIMUM_MESSAGES_PER_TICK)) {
+            retVal = STD_NOT_OK;
+        }
+    }
+
+    if (retVal == STD_OK) {
+        pSchedule->slotStart[CAN_TX_SCHEDULE_TICKS] = numberOfEntries;
+    } else {
+        /* do not transmit anything with an invalid schedule */
+        for (uint16_t slot = 0u; slot <= CAN_TX_SCHEDULE_TICKS; slot++) {
+            pSchedule->slotStart[slot] = 0u;
+        }
+    }
+    return retVal;
 }
 
 extern STD_RETURN_TYPE_e CAN_DataSend(canBASE_t *pNode, uint32_t id, uint8 *pData) {
@@ -207,36 +441,85 @@ extern STD_RETURN_TYPE_e CAN_DataSend(canBASE_t *pNode, uint32_t id, uint8 *pDat
     return STD_NOT_OK;
 }
 
+extern STD_RETURN_TYPE_e CAN_BuildRxDispatchTable(
+    const CAN_MSG_RX_TYPE_s *pMessages,
+    uint8_t numberOfMessages,
+    CAN_RX_DISPATCH_TABLE_s *pTable) {
+    FAS_ASSERT(pMessages != NULL_PTR);
+    FAS_ASSERT(pTable != NULL_PTR);
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+
+    pTable->numberOfEntries = 0u;
+    if (numberOfMessages <= CAN_RX_DISPATCH_MAXIMUM_ENTRIES) {
+        /* insertion sort: stable, so handlers of the same ID keep the configuration order */
+        for (uint8_t i = 0u; i < numberOfMessages; i++) {
+            uint8_t position = i;
+            while ((position > 0u) && (pTable->id[position - 1u] > pMessages[i].id)) {
+                pTable->id[position]      = pTable->id[position - 1u];
+                pTable->message[position] = pTable->message[position - 1u];
+                position--;
+            }
+            pTable->id[position]      = pMessages[i].id;
+            pTable->message[position] = i;
+        }
+        pTable->numberOfEntries = numberOfMessages;
+        retVal                  = STD_OK;
+    }
+    return retVal;
+}
+
+extern uint8_t CAN_FindRxHandlers(const CAN_RX_DISPATCH_TABLE_s *pTable, uint32_t id, uint8_t *pFirstEntry) {
+    FAS_ASSERT(pTable != NULL_PTR);
+    FAS_ASSERT(pFirstEntry != NULL_PTR);
+    /* binary search for the first entry with an ID not smaller than the received ID */
+    uint8_t low  = 0u;
+    uint8_t high = pTable->numberOfEntries;
+    while (low < high) {
+        const uint8_t middle = low + ((high - low) / 2u);
+        if (pTable->id[middle] < id) {
+            low = middle + 1u;
+        } else {
+            high = middle;
+        }
+    }
+    *pFirstEntry = low;
+
+    uint8_t numberOfHandlers = 0u;
+    while (((low + numberOfHandlers) < pTable->numberOfEntries) && (pTable->id[low + numberOfHandlers] == id)) {
+        numberOfHandlers++;
+    }
+    return numberOfHandlers;
+}
+
 extern void CAN_MainFunction(void) {
     CAN_CheckCanTiming();
+    CAN_UpdateRxStatistics();
     if (true == can_state.periodicEnable) {
         CAN_PeriodicTransmit();
     }
 }
 
 static STD_RETURN_TYPE_e CAN_PeriodicTransmit(void) {
-    STD_RETURN_TYPE_e retVal     = STD_NOT_OK;
-    static uint32_t counterTicks = 0;
-    uint8_t data[8]              = {0};
-
-    for (uint16_t i = 0u; i < can_txLength; i++) {
-        if (((counterTicks * CAN_TICK_MS) % (can_txMessages[i].repetitionTime)) == can_txMessages[i].repetitionPhase) {
-            if (can_txMessages[i].callbackFunction != NULL_PTR) {
-                OS_EnterTaskCritical();
-                can_txMessages[i].callbackFunction(
-                    can_txMessages[i].id,
-                    can_txMessages[i].dlc,
-                    can_txMessages[i].byteOrder,
-                    data,
-                    can_txMessages[i].pMuxId);
-                OS_ExitTaskCritical();
-                CAN_DataSend(CAN0_NODE, can_txMessages[i].id, data);
-                retVal = STD_OK;
-            }
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    static uint16_t slot     = 0u;
+    uint8_t data[8]          = {0};
+
+    /* only the messages that are due in this tick are in the slot */
+    for (uint16_t entry = can_txSchedule.slotStart[slot]; entry < can_txSchedule.slotStart[slot + 1u]; entry++) {
+        const CAN_MSG_TX_TYPE_s *pMessage = &can_txMessages[can_txSchedule.entries[entry]];
+        if (pMessage->callbackFunction != NULL_PTR) {
+            OS_EnterTaskCritical();
+            pMessage->callbackFunction(pMessage->id, pMessage->dlc, pMessage->byteOrder, data, pMessage->pMuxId);
+            OS_ExitTaskCritical();
+            CAN_DataSend(CAN0_NODE, pMessage->id, data);
+            retVal = STD_OK;
         }
     }
 
-    counterTicks++;
+    slot++;
+    if (slot >= CAN_TX_SCHEDULE_TICKS) {
+        slot = 0u;
+    }
     return retVal;
 }
 
@@ -321,23 +604,23 @@ static bool CAN_CheckCanTiming(void) {
 }
 
 extern void CAN_ReadRxBuffer(void) {
-    while (can_rxBuffer.pRead != can_rxBuffer.pWrite) {
-        for (int i = 0; i < can_rxLength; i++) {
-            if (can_rxBuffer.pRead->id == can_rxMessages[i].id) {
-                if (can_rxMessages[i].callbackFunction != NULL_PTR) {
-                    can_rxMessages[i].callbackFunction(
-                        can_rxMessages[i].id,
-                        can_rxMessages[i].dlc,
-                        can_rxMessages[i].byteOrder,
-                        can_rxBuffer.pRead->data,
-                        NULL_PTR);
-                }
+    uint8_t readIndex = can_rxBuffer.readIndex;
+    while (readIndex != can_rxBuffer.writeIndex) {
+        /* the element must not be read before the write index that published it */
+        CAN_MEMORY_BARRIER();
+        CAN_BUFFERELEMENT_s *pElement  = &can_rxBufferData[readIndex];
+        uint8_t entry                  = 0u;
+        const uint8_t numberOfHandlers = CAN_FindRxHandlers(&can_rxDispatchTable, pElement->id, &entry);
+        for (uint8_t i = 0u; i < numberOfHandlers; i++) {
+            const CAN_MSG_RX_TYPE_s *pMessage = &can_rxMessages[can_rxDispatchTable.message[entry + i]];
+            if (pMessage->callbackFunction != NULL_PTR) {
+                pMessage->callbackFunction(pMessage->id, pMessage->dlc, pMessage->byteOrder, pElement->data, NULL_PTR);
             }
         }
-        can_rxBuffer.pRead++;
-        if (can_rxBuffer.pRead > &can_rxBufferData[CAN0_RX_BUFFER_LENGTH - 1u]) {
-            can_rxBuffer.pRead = &can_rxBufferData[0];
-        }
+        /* the element has to be read completely before it is released */
+        CAN_MEMORY_BARRIER();
+        readIndex              = (uint8_t)((readIndex + 1u) % can_rxBuffer.length);
+        can_rxBuffer.readIndex = readIndex;
     }
 }
 
@@ -419,20 +702,8 @@ static void CAN_RxInterrupt(canBASE_t *pNode, uint32 messageBox) {
         /* extended frame: bits [28:0] */
         id = canGetID(pNode, messageBox) >> 18;
 
-        can_rxBuffer.pWrite->id      = id;
-        can_rxBuffer.pWrite->data[0] = data[0];
-        can_rxBuffer.pWrite->data[1] = data[1];
-        can_rxBuffer.pWrite->data[2] = data[2];
-        can_rxBuffer.pWrite->data[3] = data[3];
-        can_rxBuffer.pWrite->data[4] = data[4];
-        can_rxBuffer.pWrite->data[5] = data[5];
-        can_rxBuffer.pWrite->data[6] = data[6];
-        can_rxBuffer.pWrite->data[7] = data[7];
-
-        can_rxBuffer.pWrite++;
-        if (can_rxBuffer.pWrite > &can_rxBufferData[CAN0_RX_BUFFER_LENGTH - 1u]) {
-            can_rxBuffer.pWrite = &can_rxBufferData[0];
-        }
+        /* dropped messages are counted in the RX buffer statistics */
+        (void)CAN_StoreRxMessage(id, data);
     }
 }
 
@@ -450,6 +721,23 @@ void UNIT_TEST_WEAK_IMPL canMessageNotification(canBASE_t *node, uint32 messageB
 extern CAN_STATE_s *TEST_CAN_GetCANState(void) {
     return &can_state;
 }
+extern CAN_RX_BUFFER_s *TEST_CAN_GetRxBuffer(void) {
+    return &can_rxBuffer;
+}
+extern CAN_RX_DISPATCH_TABLE_s *TEST_CAN_GetRxDispatchTable(void) {
+    return &can_rxDispatchTable;
+}
 #endif
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern uint32_t TEST_CAN_GetWorstCaseFrameBits(uint8_t dlc) {
+    return CAN_GetWorstCaseFrameBits(dlc);
+}
+extern STD_RETURN_TYPE_e TEST_CAN_StoreRxMessage(uint32_t id, const uint8_t *pData) {
+    return CAN_StoreRxMessage(id, pData);
+}
+extern void TEST_CAN_UpdateRxStatistics(void) {
+    CAN_UpdateRxStatistics();
+}
+#endif
@@ -74,19 +74,56 @@
  */
 #define CAN_NR_OF_TX_MESSAGEBOX (32U)
 
-/** length of the RX buffer */
+/** maximum data length code of a CAN frame */
+#define CAN_MAX_DLC (8u)
+
+/** length of the RX buffer, one element is always kept free to distinguish a full from an empty buffer */
 #define CAN0_RX_BUFFER_LENGTH (32U)
 
+/**
+ * number of RX buffer elements that are reserved for messages with
+ * #CAN_RX_PRIORITY_HIGH. Messages with #CAN_RX_PRIORITY_LOW are dropped once
+ * the buffer is filled up to these elements.
+ */
+#define CAN_RX_HIGH_PRIORITY_RESERVED_SLOTS (8u)
+
+/** maximum number of RX messages in the RX dispatch table */
+#define CAN_RX_DISPATCH_MAXIMUM_ENTRIES (64u)
+
 /** Task time slot where the CAN TX function is called. Repetition time of
  * periodic CAN messages must be multiple of this (e.g., 1u, 10u or 100u)
  */
 #define CAN_TICK_MS (10U)
 
-/** Buffer containing all the CAN RX elements */
+/** number of CAN ticks after which the periodic TX schedule repeats. The
+ * repetition time of each periodic CAN message must divide
+ * CAN_TX_SCHEDULE_TICKS * #CAN_TICK_MS
+ */
+#define CAN_TX_SCHEDULE_TICKS (100u)
+
+/** maximum number of transmissions within one cycle of the TX schedule */
+#define CAN_TX_SCHEDULE_MAXIMUM_ENTRIES (512u)
+
+/** maximum number of periodic messages in one CAN tick (message box 0 is not used for TX) */
+#define CAN_TX_MAXIMUM_MESSAGES_PER_TICK (CAN_NR_OF_TX_MESSAGEBOX - 1u)
+
+/** maximum number of bits on the bus that the periodic messages of one CAN tick may use */
+#define CAN_TX_MAXIMUM_BITS_PER_TICK \
+    ((CAN_NODE0_BITRATE_KBIT_S * CAN_TICK_MS * CAN_TX_MAXIMUM_BUS_LOAD_PERCENT) / 100u)
+
+/**
+ * Buffer containing all the CAN RX elements. The buffer is a single-producer
+ * single-consumer ring: the RX interrupt is the only writer of writeIndex and
+ * of the statistics, #CAN_ReadRxBuffer is the only writer of readIndex.
+ */
 typedef struct CAN_RX_BUFFER {
-    CAN_BUFFERELEMENT_s *pRead;  /*!< read pointer */
-    CAN_BUFFERELEMENT_s *pWrite; /*!< write pointer */
-    uint8_t length;              /*!< length of buffer */
+    volatile uint8_t readIndex;                 /*!< index of the next element to read */
+    volatile uint8_t writeIndex;                /*!< index of the next element to write */
+    uint8_t length;                             /*!< length of buffer */
+    volatile uint32_t receivedMessages;         /*!< messages stored in the buffer */
+    volatile uint32_t overflowCounter;          /*!< messages lost because the buffer was full */
+    volatile uint32_t droppedLowPriorityFrames; /*!< low priority messages dropped to keep the reserved slots free */
+    volatile uint8_t highWaterMark;             /*!< maximum number of pending messages */
 } CAN_RX_BUFFER_s;
 
 /** This structure contains variables relevant for the CAN signal module. */
@@ -97,6 +134,27 @@ typedef struct CAN_STATE {
     bool currentSensorECPresent[BS_NR_OF_STRINGS]; /*!< defines if a EC info is being sent */
 } CAN_STATE_s;
 
+/**
+ * Precomputed schedule of the periodic TX messages. The entries of slot n
+ * (i.e., CAN tick n of the schedule cycle) are
+ * entries[slotStart[n]] to entries[slotStart[n + 1] - 1].
+ */
+typedef struct CAN_TX_SCHEDULE {
+    uint16_t slotStart[CAN_TX_SCHEDULE_TICKS + 1u];   /*!< index of the first entry of each slot */
+    uint8_t entries[CAN_TX_SCHEDULE_MAXIMUM_ENTRIES]; /*!< indices in the TX message array, sorted by slot */
+    uint32_t maximumBitsPerSlot;                      /*!< worst-case bus load of the busiest slot in bits */
+} CAN_TX_SCHEDULE_s;
+
+/**
+ * RX messages sorted by ID for a binary search. Several entries can have the
+ * same ID, they are sorted in configuration order.
+ */
+typedef struct CAN_RX_DISPATCH_TABLE {
+    uint8_t numberOfEntries;                          /*!< number of valid entries */
+    uint32_t id[CAN_RX_DISPATCH_MAXIMUM_ENTRIES];     /*!< message IDs in ascending order */
+    uint8_t message[CAN_RX_DISPATCH_MAXIMUM_ENTRIES]; /*!< index of each entry in the RX message array */
+} CAN_RX_DISPATCH_TABLE_s;
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -112,6 +170,47 @@ typedef struct CAN_STATE {
  */
 extern STD_RETURN_TYPE_e CAN_DataSend(canBASE_t *pNode, uint32_t id, uint8 *pData);
 
+/**
+ * @brief   Builds the schedule of the periodic TX messages.
+ * @details The slot of each CAN tick lists the messages that are due in this
+ *          tick, so that the periodic transmit only visits these messages.
+ *          The configuration is rejected if a repetition time or phase does
+ *          not fit the tick and schedule length, or if the worst-case bus load
+ *          of a slot exceeds #CAN_TX_MAXIMUM_BITS_PER_TICK or
+ *          #CAN_TX_MAXIMUM_MESSAGES_PER_TICK (i.e., the phases of too many
+ *          messages collide). The schedule is empty in this case.
+ * @param[in]   pMessages           TX message configuration
+ * @param[in]   numberOfMessages    number of TX messages
+ * @param[out]  pSchedule           schedule to build
+ * @return  #STD_OK if the schedule is valid, #STD_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e CAN_BuildTxSchedule(
+    const CAN_MSG_TX_TYPE_s *pMessages,
+    uint8_t numberOfMessages,
+    CAN_TX_SCHEDULE_s *pSchedule);
+
+/**
+ * @brief   Builds the dispatch table of the RX messages.
+ * @param[in]   pMessages           RX message configuration
+ * @param[in]   numberOfMessages    number of RX messages
+ * @param[out]  pTable              dispatch table to build
+ * @return  #STD_OK if all messages fit in the table, #STD_NOT_OK otherwise
+ *          (the table is empty in this case)
+ */
+extern STD_RETURN_TYPE_e CAN_BuildRxDispatchTable(
+    const CAN_MSG_RX_TYPE_s *pMessages,
+    uint8_t numberOfMessages,
+    CAN_RX_DISPATCH_TABLE_s *pTable);
+
+/**
+ * @brief   Searches the RX messages that handle a CAN ID.
+ * @param[in]   pTable          dispatch table
+ * @param[in]   id              CAN ID of the received message
+ * @param[out]  pFirstEntry     first entry in the table with this ID
+ * @return  number of consecutive entries with this ID (0 if the ID is not configured)
+ */
+extern uint8_t CAN_FindRxHandlers(const CAN_RX_DISPATCH_TABLE_s *pTable, uint32_t id, uint8_t *pFirstEntry);
+
 /**
  * @brief   Calls the functions to drive the CAN interface.
  * Makes the CAN timing checks and sends the periodic messages.
@@ -130,7 +229,8 @@ extern void CAN_ReadRxBuffer(void);
 
 /**
  * @brief   Enables the CAN transceiver..
- * This function sets th pins to enable the CAN transceiver.
+ * This function sets th pins to enable the CAN transceiver and builds the
+ * schedule of the periodic TX messages and the RX dispatch table.
  * It must be called before using the CAN interface.
  */
 extern void CAN_Initialize(void);
@@ -165,6 +265,11 @@ extern bool CAN_IsCurrentSensorEcPresent(uint8_t stringNumber);
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 #ifdef UNITY_UNIT_TEST
 extern CAN_STATE_s *TEST_CAN_GetCANState(void);
+extern CAN_RX_BUFFER_s *TEST_CAN_GetRxBuffer(void);
+extern CAN_RX_DISPATCH_TABLE_s *TEST_CAN_GetRxDispatchTable(void);
+extern uint32_t TEST_CAN_GetWorstCaseFrameBits(uint8_t dlc);
+extern STD_RETURN_TYPE_e TEST_CAN_StoreRxMessage(uint32_t id, const uint8_t *pData);
+extern void TEST_CAN_UpdateRxStatistics(void);
 #endif
 
 #endif /* FOXBMS__CAN_H_ */
@@ -0,0 +1,2706 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    can_codec.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup DRIVERS
+ * @prefix  CAN
+ *
+ * @brief   Pack and unpack functions of the CAN messages
+ *
+ * @details This file is generated from tools/dbc/foxbms.dbc by
+ *          tools/dbc/can_codec_generator.py, do not edit it.
+ *          Each signal is copied with a constant shift and mask from or to
+ *          the little endian (Intel) or big endian (Motorola)
+ *          representation of the CAN data as 64-bit value.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "can_codec.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+
+extern void CAN_PackFoxbmsPackValues(const CAN_FOXBMS_PACK_VALUES_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_packCurrent: 41|18@0- */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_packCurrent & 0x3FFFFu) << 0u;
+    /* foxBMS_batteryVoltage: 7|14@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_batteryVoltage & 0x3FFFu) << 50u;
+    /* foxBMS_busVoltage: 9|14@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_busVoltage & 0x3FFFu) << 36u;
+    /* foxBMS_packPower: 27|18@0- */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_packPower & 0x3FFFFu) << 18u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsPackValues(const uint8_t *pCanData, CAN_FOXBMS_PACK_VALUES_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_packCurrent: 41|18@0- */
+    pSignals->foxBMS_packCurrent = (int32_t)(int64_t)((((messageBigEndian >> 0u) & 0x3FFFFu) ^ 0x20000u) - 0x20000u);
+    /* foxBMS_batteryVoltage: 7|14@0+ */
+    pSignals->foxBMS_batteryVoltage = (uint16_t)((messageBigEndian >> 50u) & 0x3FFFu);
+    /* foxBMS_busVoltage: 9|14@0+ */
+    pSignals->foxBMS_busVoltage = (uint16_t)((messageBigEndian >> 36u) & 0x3FFFu);
+    /* foxBMS_packPower: 27|18@0- */
+    pSignals->foxBMS_packPower = (int32_t)(int64_t)((((messageBigEndian >> 18u) & 0x3FFFFu) ^ 0x20000u) - 0x20000u);
+}
+
+extern void CAN_PackFoxbmsLimitValues(const CAN_FOXBMS_LIMIT_VALUES_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_maxChargeCurrent: 11|12@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_maxChargeCurrent & 0xFFFu) << 40u;
+    /* foxBMS_maxDischargeCurrent: 7|12@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_maxDischargeCurrent & 0xFFFu) << 52u;
+    /* foxBMS_maxChargePower: 35|12@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_maxChargePower & 0xFFFu) << 16u;
+    /* foxBMS_maxDischargePower: 31|12@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_maxDischargePower & 0xFFFu) << 28u;
+    /* foxBMS_maxBatteryVoltage: 55|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_maxBatteryVoltage & 0xFFu) << 8u;
+    /* foxBMS_minBatteryVoltage: 63|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_minBatteryVoltage & 0xFFu) << 0u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsLimitValues(const uint8_t *pCanData, CAN_FOXBMS_LIMIT_VALUES_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_maxChargeCurrent: 11|12@0+ */
+    pSignals->foxBMS_maxChargeCurrent = (uint16_t)((messageBigEndian >> 40u) & 0xFFFu);
+    /* foxBMS_maxDischargeCurrent: 7|12@0+ */
+    pSignals->foxBMS_maxDischargeCurrent = (uint16_t)((messageBigEndian >> 52u) & 0xFFFu);
+    /* foxBMS_maxChargePower: 35|12@0+ */
+    pSignals->foxBMS_maxChargePower = (uint16_t)((messageBigEndian >> 16u) & 0xFFFu);
+    /* foxBMS_maxDischargePower: 31|12@0+ */
+    pSignals->foxBMS_maxDischargePower = (uint16_t)((messageBigEndian >> 28u) & 0xFFFu);
+    /* foxBMS_maxBatteryVoltage: 55|8@0+ */
+    pSignals->foxBMS_maxBatteryVoltage = (uint8_t)((messageBigEndian >> 8u) & 0xFFu);
+    /* foxBMS_minBatteryVoltage: 63|8@0+ */
+    pSignals->foxBMS_minBatteryVoltage = (uint8_t)((messageBigEndian >> 0u) & 0xFFu);
+}
+
+extern void CAN_PackFoxbmsMinimumMaximumValues(
+    const CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_SIGNALS_s *pSignals,
+    uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_minimumCellVoltage: 10|13@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_minimumCellVoltage & 0x1FFFu) << 38u;
+    /* foxBMS_maximumCellVoltage: 7|13@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_maximumCellVoltage & 0x1FFFu) << 51u;
+    /* foxBMS_maximumCellTemp: 55|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_maximumCellTemp & 0xFFu) << 8u;
+    /* foxBMS_minimumCellTemp: 63|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_minimumCellTemp & 0xFFu) << 0u;
+    /* foxBMS_inletTemperature: 39|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_inletTemperature & 0xFFu) << 24u;
+    /* foxBMS_outletTemperature: 47|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_outletTemperature & 0xFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsMinimumMaximumValues(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_minimumCellVoltage: 10|13@0+ */
+    pSignals->foxBMS_minimumCellVoltage = (uint16_t)((messageBigEndian >> 38u) & 0x1FFFu);
+    /* foxBMS_maximumCellVoltage: 7|13@0+ */
+    pSignals->foxBMS_maximumCellVoltage = (uint16_t)((messageBigEndian >> 51u) & 0x1FFFu);
+    /* foxBMS_maximumCellTemp: 55|8@0- */
+    pSignals->foxBMS_maximumCellTemp = (int8_t)(int64_t)((((messageBigEndian >> 8u) & 0xFFu) ^ 0x80u) - 0x80u);
+    /* foxBMS_minimumCellTemp: 63|8@0- */
+    pSignals->foxBMS_minimumCellTemp = (int8_t)(int64_t)((((messageBigEndian >> 0u) & 0xFFu) ^ 0x80u) - 0x80u);
+    /* foxBMS_inletTemperature: 39|8@0- */
+    pSignals->foxBMS_inletTemperature = (int8_t)(int64_t)((((messageBigEndian >> 24u) & 0xFFu) ^ 0x80u) - 0x80u);
+    /* foxBMS_outletTemperature: 47|8@0- */
+    pSignals->foxBMS_outletTemperature = (int8_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFu) ^ 0x80u) - 0x80u);
+}
+
+extern void CAN_PackFoxbmsStringValues(const CAN_FOXBMS_STRING_VALUES_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_StringValues_Mux: 7|3@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_StringValues_Mux & 0x7u) << 61u;
+    /* foxBMS_String0_current: 19|18@0- */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_String0_current & 0x3FFFFu) << 26u;
+    /* foxBMS_String0_voltage: 4|17@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_String0_voltage & 0x1FFFFu) << 44u;
+    /* foxBMS_String0_power: 33|18@0- */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_String0_power & 0x3FFFFu) << 8u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsStringValues(const uint8_t *pCanData, CAN_FOXBMS_STRING_VALUES_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_StringValues_Mux: 7|3@0+ */
+    pSignals->foxBMS_StringValues_Mux = (uint8_t)((messageBigEndian >> 61u) & 0x7u);
+    /* foxBMS_String0_current: 19|18@0- */
+    pSignals->foxBMS_String0_current =
+        (int32_t)(int64_t)((((messageBigEndian >> 26u) & 0x3FFFFu) ^ 0x20000u) - 0x20000u);
+    /* foxBMS_String0_voltage: 4|17@0+ */
+    pSignals->foxBMS_String0_voltage = (uint32_t)((messageBigEndian >> 44u) & 0x1FFFFu);
+    /* foxBMS_String0_power: 33|18@0- */
+    pSignals->foxBMS_String0_power = (int32_t)(int64_t)((((messageBigEndian >> 8u) & 0x3FFFFu) ^ 0x20000u) - 0x20000u);
+}
+
+extern void CAN_PackFoxbmsStringValues2(const CAN_FOXBMS_STRING_VALUES2_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_StringValues2_Mux: 7|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_StringValues2_Mux & 0xFu) << 60u;
+    /* String0_energyCount: 15|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->String0_energyCount & 0xFFFFFFFFu) << 24u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsStringValues2(const uint8_t *pCanData, CAN_FOXBMS_STRING_VALUES2_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_StringValues2_Mux: 7|4@0+ */
+    pSignals->foxBMS_StringValues2_Mux = (uint8_t)((messageBigEndian >> 60u) & 0xFu);
+    /* String0_energyCount: 15|32@0- */
+    pSignals->String0_energyCount =
+        (int32_t)(int64_t)((((messageBigEndian >> 24u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackFoxbmsPackStateEstimation(
+    const CAN_FOXBMS_PACK_STATE_ESTIMATION_SIGNALS_s *pSignals,
+    uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_packSoc: 7|14@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_packSoc & 0x3FFFu) << 50u;
+    /* foxBMS_packSoe: 9|14@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_packSoe & 0x3FFFu) << 36u;
+    /* foxBMS_packEnergy: 47|24@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_packEnergy & 0xFFFFFFu) << 0u;
+    /* foxBMS_packSoh: 27|12@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_packSoh & 0xFFFu) << 24u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsPackStateEstimation(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_PACK_STATE_ESTIMATION_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_packSoc: 7|14@0+ */
+    pSignals->foxBMS_packSoc = (uint16_t)((messageBigEndian >> 50u) & 0x3FFFu);
+    /* foxBMS_packSoe: 9|14@0+ */
+    pSignals->foxBMS_packSoe = (uint16_t)((messageBigEndian >> 36u) & 0x3FFFu);
+    /* foxBMS_packEnergy: 47|24@0+ */
+    pSignals->foxBMS_packEnergy = (uint32_t)((messageBigEndian >> 0u) & 0xFFFFFFu);
+    /* foxBMS_packSoh: 27|12@0+ */
+    pSignals->foxBMS_packSoh = (uint16_t)((messageBigEndian >> 24u) & 0xFFFu);
+}
+
+extern void CAN_PackFoxbmsCellVoltage(const CAN_FOXBMS_CELL_VOLTAGE_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_CellVoltage_Mux: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_CellVoltage_Mux & 0xFFu) << 56u;
+    /* cellVoltage_0_invalidFlag: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellVoltage_0_invalidFlag & 0x1u) << 52u;
+    /* cellVoltage_1_invalidFlag: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellVoltage_1_invalidFlag & 0x1u) << 53u;
+    /* cellVoltage_2_invalidFlag: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellVoltage_2_invalidFlag & 0x1u) << 54u;
+    /* cellVoltage_3_invalidFlag: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellVoltage_3_invalidFlag & 0x1u) << 55u;
+    /* cellVoltage_0: 11|13@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellVoltage_0 & 0x1FFFu) << 39u;
+    /* cell_voltage_1: 30|13@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cell_voltage_1 & 0x1FFFu) << 26u;
+    /* cell_voltage_2: 33|13@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cell_voltage_2 & 0x1FFFu) << 13u;
+    /* cell_voltage_3: 52|13@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cell_voltage_3 & 0x1FFFu) << 0u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsCellVoltage(const uint8_t *pCanData, CAN_FOXBMS_CELL_VOLTAGE_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_CellVoltage_Mux: 7|8@0+ */
+    pSignals->foxBMS_CellVoltage_Mux = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* cellVoltage_0_invalidFlag: 12|1@0+ */
+    pSignals->cellVoltage_0_invalidFlag = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* cellVoltage_1_invalidFlag: 13|1@0+ */
+    pSignals->cellVoltage_1_invalidFlag = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* cellVoltage_2_invalidFlag: 14|1@0+ */
+    pSignals->cellVoltage_2_invalidFlag = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* cellVoltage_3_invalidFlag: 15|1@0+ */
+    pSignals->cellVoltage_3_invalidFlag = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* cellVoltage_0: 11|13@0+ */
+    pSignals->cellVoltage_0 = (uint16_t)((messageBigEndian >> 39u) & 0x1FFFu);
+    /* cell_voltage_1: 30|13@0+ */
+    pSignals->cell_voltage_1 = (uint16_t)((messageBigEndian >> 26u) & 0x1FFFu);
+    /* cell_voltage_2: 33|13@0+ */
+    pSignals->cell_voltage_2 = (uint16_t)((messageBigEndian >> 13u) & 0x1FFFu);
+    /* cell_voltage_3: 52|13@0+ */
+    pSignals->cell_voltage_3 = (uint16_t)((messageBigEndian >> 0u) & 0x1FFFu);
+}
+
+extern void CAN_PackFoxbmsCellTemperature(const CAN_FOXBMS_CELL_TEMPERATURE_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_CellTemperature_Mux: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_CellTemperature_Mux & 0xFFu) << 56u;
+    /* cellTemperature_0_invalidFlag: 8|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_0_invalidFlag & 0x1u) << 48u;
+    /* cellTemperature_1_invalidFlag: 9|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_1_invalidFlag & 0x1u) << 49u;
+    /* cellTemperature_2_invalidFlag: 10|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_2_invalidFlag & 0x1u) << 50u;
+    /* cellTemperature_3_invalidFlag: 11|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_3_invalidFlag & 0x1u) << 51u;
+    /* cellTemperature_4_invalidFlag: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_4_invalidFlag & 0x1u) << 52u;
+    /* cellTemperature_5_invalidFlag: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_5_invalidFlag & 0x1u) << 53u;
+    /* cellTemperature_0: 23|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_0 & 0xFFu) << 40u;
+    /* cellTemperature_1: 31|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_1 & 0xFFu) << 32u;
+    /* cellTemperature_2: 39|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_2 & 0xFFu) << 24u;
+    /* cellTemperature_3: 47|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_3 & 0xFFu) << 16u;
+    /* cellTemperature_4: 55|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_4 & 0xFFu) << 8u;
+    /* cellTemperature_5: 63|8@0- */
+    messageBigEndian |= ((uint64_t)pSignals->cellTemperature_5 & 0xFFu) << 0u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsCellTemperature(const uint8_t *pCanData, CAN_FOXBMS_CELL_TEMPERATURE_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_CellTemperature_Mux: 7|8@0+ */
+    pSignals->foxBMS_CellTemperature_Mux = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* cellTemperature_0_invalidFlag: 8|1@0+ */
+    pSignals->cellTemperature_0_invalidFlag = (uint8_t)((messageBigEndian >> 48u) & 0x1u);
+    /* cellTemperature_1_invalidFlag: 9|1@0+ */
+    pSignals->cellTemperature_1_invalidFlag = (uint8_t)((messageBigEndian >> 49u) & 0x1u);
+    /* cellTemperature_2_invalidFlag: 10|1@0+ */
+    pSignals->cellTemperature_2_invalidFlag = (uint8_t)((messageBigEndian >> 50u) & 0x1u);
+    /* cellTemperature_3_invalidFlag: 11|1@0+ */
+    pSignals->cellTemperature_3_invalidFlag = (uint8_t)((messageBigEndian >> 51u) & 0x1u);
+    /* cellTemperature_4_invalidFlag: 12|1@0+ */
+    pSignals->cellTemperature_4_invalidFlag = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* cellTemperature_5_invalidFlag: 13|1@0+ */
+    pSignals->cellTemperature_5_invalidFlag = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* cellTemperature_0: 23|8@0- */
+    pSignals->cellTemperature_0 = (int8_t)(int64_t)((((messageBigEndian >> 40u) & 0xFFu) ^ 0x80u) - 0x80u);
+    /* cellTemperature_1: 31|8@0- */
+    pSignals->cellTemperature_1 = (int8_t)(int64_t)((((messageBigEndian >> 32u) & 0xFFu) ^ 0x80u) - 0x80u);
+    /* cellTemperature_2: 39|8@0- */
+    pSignals->cellTemperature_2 = (int8_t)(int64_t)((((messageBigEndian >> 24u) & 0xFFu) ^ 0x80u) - 0x80u);
+    /* cellTemperature_3: 47|8@0- */
+    pSignals->cellTemperature_3 = (int8_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFu) ^ 0x80u) - 0x80u);
+    /* cellTemperature_4: 55|8@0- */
+    pSignals->cellTemperature_4 = (int8_t)(int64_t)((((messageBigEndian >> 8u) & 0xFFu) ^ 0x80u) - 0x80u);
+    /* cellTemperature_5: 63|8@0- */
+    pSignals->cellTemperature_5 = (int8_t)(int64_t)((((messageBigEndian >> 0u) & 0xFFu) ^ 0x80u) - 0x80u);
+}
+
+extern void CAN_PackFoxbmsCommand(const CAN_FOXBMS_COMMAND_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian    = 0u;
+    uint64_t messageLittleEndian = 0u;
+
+    /* foxBMS_ModeRequest: 1|2@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_ModeRequest & 0x3u) << 56u;
+    /* foxBMS_activateBalancing: 8|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_activateBalancing & 0x1u) << 48u;
+    /* foxBMS_balancingThreshold: 23|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_balancingThreshold & 0xFFu) << 40u;
+    /* foxBMS_externallyPrecharged: 3|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_externallyPrecharged & 0x1u) << 59u;
+    /* foxBMS_resetFlags: 2|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->foxBMS_resetFlags & 0x1u) << 2u;
+    /* foxBMS_chargerConnected: 4|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->foxBMS_chargerConnected & 0x1u) << 4u;
+    /* foxBMS_disableInsulationMon: 5|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->foxBMS_disableInsulationMon & 0x1u) << 5u;
+    /* foxBMS_heaterOverride_ON: 6|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->foxBMS_heaterOverride_ON & 0x1u) << 6u;
+    /* foxBMS_heaterOverride_OFF: 7|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->foxBMS_heaterOverride_OFF & 0x1u) << 7u;
+
+    pCanData[0] = (uint8_t)((messageLittleEndian >> 0u) | (messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageLittleEndian >> 8u) | (messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageLittleEndian >> 16u) | (messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageLittleEndian >> 24u) | (messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageLittleEndian >> 32u) | (messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageLittleEndian >> 40u) | (messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageLittleEndian >> 48u) | (messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageLittleEndian >> 56u) | (messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsCommand(const uint8_t *pCanData, CAN_FOXBMS_COMMAND_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+    const uint64_t messageLittleEndian =
+        ((uint64_t)pCanData[0] << 0u) |
+        ((uint64_t)pCanData[1] << 8u) |
+        ((uint64_t)pCanData[2] << 16u) |
+        ((uint64_t)pCanData[3] << 24u) |
+        ((uint64_t)pCanData[4] << 32u) |
+        ((uint64_t)pCanData[5] << 40u) |
+        ((uint64_t)pCanData[6] << 48u) |
+        ((uint64_t)pCanData[7] << 56u);
+
+    /* foxBMS_ModeRequest: 1|2@0+ */
+    pSignals->foxBMS_ModeRequest = (uint8_t)((messageBigEndian >> 56u) & 0x3u);
+    /* foxBMS_activateBalancing: 8|1@0+ */
+    pSignals->foxBMS_activateBalancing = (uint8_t)((messageBigEndian >> 48u) & 0x1u);
+    /* foxBMS_balancingThreshold: 23|8@0+ */
+    pSignals->foxBMS_balancingThreshold = (uint8_t)((messageBigEndian >> 40u) & 0xFFu);
+    /* foxBMS_externallyPrecharged: 3|1@0+ */
+    pSignals->foxBMS_externallyPrecharged = (uint8_t)((messageBigEndian >> 59u) & 0x1u);
+    /* foxBMS_resetFlags: 2|1@1+ */
+    pSignals->foxBMS_resetFlags = (uint8_t)((messageLittleEndian >> 2u) & 0x1u);
+    /* foxBMS_chargerConnected: 4|1@1+ */
+    pSignals->foxBMS_chargerConnected = (uint8_t)((messageLittleEndian >> 4u) & 0x1u);
+    /* foxBMS_disableInsulationMon: 5|1@1+ */
+    pSignals->foxBMS_disableInsulationMon = (uint8_t)((messageLittleEndian >> 5u) & 0x1u);
+    /* foxBMS_heaterOverride_ON: 6|1@1+ */
+    pSignals->foxBMS_heaterOverride_ON = (uint8_t)((messageLittleEndian >> 6u) & 0x1u);
+    /* foxBMS_heaterOverride_OFF: 7|1@1+ */
+    pSignals->foxBMS_heaterOverride_OFF = (uint8_t)((messageLittleEndian >> 7u) & 0x1u);
+}
+
+extern void CAN_PackFoxbmsState(const CAN_FOXBMS_STATE_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian    = 0u;
+    uint64_t messageLittleEndian = 0u;
+
+    /* foxBMS_State: 3|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_State & 0xFu) << 56u;
+    /* BMS_nrOfConnectedStrings: 7|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->BMS_nrOfConnectedStrings & 0xFu) << 60u;
+    /* foxBMS_generalError: 10|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_generalError & 0x1u) << 50u;
+    /* foxBMS_generalWarning: 9|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_generalWarning & 0x1u) << 49u;
+    /* foxBMS_Error_dieTemperatureMCU: 18|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_Error_dieTemperatureMCU & 0x1u) << 42u;
+    /* foxBMS_Error_OvertempPCB: 19|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_Error_OvertempPCB & 0x1u) << 43u;
+    /* foxBMS_Error_UndertempPCB: 20|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_Error_UndertempPCB & 0x1u) << 44u;
+    /* foxBMS_Error_PrechargeVolt: 16|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_Error_PrechargeVolt & 0x1u) << 40u;
+    /* foxBMS_Error_PrechargeCurrent: 17|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_Error_PrechargeCurrent & 0x1u) << 41u;
+    /* foxBMS_heaterState: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_heaterState & 0x1u) << 54u;
+    /* foxBMS_coolingState: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_coolingState & 0x1u) << 55u;
+    /* foxBMS_insulationMonitoring: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_insulationMonitoring & 0x1u) << 53u;
+    /* foxBMS_chargingComplete: 8|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_chargingComplete & 0x1u) << 48u;
+    /* foxBMS_EmergencyShutoff: 11|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->foxBMS_EmergencyShutoff & 0x1u) << 11u;
+    /* foxBMS_MainFuseBlown: 21|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_MainFuseBlown & 0x1u) << 45u;
+    /* foxBMS_insulationResistance: 63|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_insulationResistance & 0xFFu) << 0u;
+    /* foxBMS_Error_Interlock: 22|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->foxBMS_Error_Interlock & 0x1u) << 22u;
+    /* foxBMS_NrDeactivatedStrings: 51|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_NrDeactivatedStrings & 0xFu) << 8u;
+
+    pCanData[0] = (uint8_t)((messageLittleEndian >> 0u) | (messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageLittleEndian >> 8u) | (messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageLittleEndian >> 16u) | (messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageLittleEndian >> 24u) | (messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageLittleEndian >> 32u) | (messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageLittleEndian >> 40u) | (messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageLittleEndian >> 48u) | (messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageLittleEndian >> 56u) | (messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsState(const uint8_t *pCanData, CAN_FOXBMS_STATE_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+    const uint64_t messageLittleEndian =
+        ((uint64_t)pCanData[0] << 0u) |
+        ((uint64_t)pCanData[1] << 8u) |
+        ((uint64_t)pCanData[2] << 16u) |
+        ((uint64_t)pCanData[3] << 24u) |
+        ((uint64_t)pCanData[4] << 32u) |
+        ((uint64_t)pCanData[5] << 40u) |
+        ((uint64_t)pCanData[6] << 48u) |
+        ((uint64_t)pCanData[7] << 56u);
+
+    /* foxBMS_State: 3|4@0+ */
+    pSignals->foxBMS_State = (uint8_t)((messageBigEndian >> 56u) & 0xFu);
+    /* BMS_nrOfConnectedStrings: 7|4@0+ */
+    pSignals->BMS_nrOfConnectedStrings = (uint8_t)((messageBigEndian >> 60u) & 0xFu);
+    /* foxBMS_generalError: 10|1@0+ */
+    pSignals->foxBMS_generalError = (uint8_t)((messageBigEndian >> 50u) & 0x1u);
+    /* foxBMS_generalWarning: 9|1@0+ */
+    pSignals->foxBMS_generalWarning = (uint8_t)((messageBigEndian >> 49u) & 0x1u);
+    /* foxBMS_Error_dieTemperatureMCU: 18|1@0+ */
+    pSignals->foxBMS_Error_dieTemperatureMCU = (uint8_t)((messageBigEndian >> 42u) & 0x1u);
+    /* foxBMS_Error_OvertempPCB: 19|1@0+ */
+    pSignals->foxBMS_Error_OvertempPCB = (uint8_t)((messageBigEndian >> 43u) & 0x1u);
+    /* foxBMS_Error_UndertempPCB: 20|1@0+ */
+    pSignals->foxBMS_Error_UndertempPCB = (uint8_t)((messageBigEndian >> 44u) & 0x1u);
+    /* foxBMS_Error_PrechargeVolt: 16|1@0+ */
+    pSignals->foxBMS_Error_PrechargeVolt = (uint8_t)((messageBigEndian >> 40u) & 0x1u);
+    /* foxBMS_Error_PrechargeCurrent: 17|1@0+ */
+    pSignals->foxBMS_Error_PrechargeCurrent = (uint8_t)((messageBigEndian >> 41u) & 0x1u);
+    /* foxBMS_heaterState: 14|1@0+ */
+    pSignals->foxBMS_heaterState = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* foxBMS_coolingState: 15|1@0+ */
+    pSignals->foxBMS_coolingState = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* foxBMS_insulationMonitoring: 13|1@0+ */
+    pSignals->foxBMS_insulationMonitoring = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* foxBMS_chargingComplete: 8|1@0+ */
+    pSignals->foxBMS_chargingComplete = (uint8_t)((messageBigEndian >> 48u) & 0x1u);
+    /* foxBMS_EmergencyShutoff: 11|1@1+ */
+    pSignals->foxBMS_EmergencyShutoff = (uint8_t)((messageLittleEndian >> 11u) & 0x1u);
+    /* foxBMS_MainFuseBlown: 21|1@0+ */
+    pSignals->foxBMS_MainFuseBlown = (uint8_t)((messageBigEndian >> 45u) & 0x1u);
+    /* foxBMS_insulationResistance: 63|8@0+ */
+    pSignals->foxBMS_insulationResistance = (uint8_t)((messageBigEndian >> 0u) & 0xFFu);
+    /* foxBMS_Error_Interlock: 22|1@1+ */
+    pSignals->foxBMS_Error_Interlock = (uint8_t)((messageLittleEndian >> 22u) & 0x1u);
+    /* foxBMS_NrDeactivatedStrings: 51|4@0+ */
+    pSignals->foxBMS_NrDeactivatedStrings = (uint8_t)((messageBigEndian >> 8u) & 0xFu);
+}
+
+extern void CAN_PackFoxbmsStringState(const CAN_FOXBMS_STRING_STATE_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian    = 0u;
+    uint64_t messageLittleEndian = 0u;
+
+    /* foxBMS_StringState_Mux: 3|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_StringState_Mux & 0xFu) << 56u;
+    /* String0_stringConnected: 4|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_stringConnected & 0x1u) << 60u;
+    /* String0_balancing_active: 5|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_balancing_active & 0x1u) << 61u;
+    /* String0_Err_overtemp_charge: 8|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_overtemp_charge & 0x1u) << 48u;
+    /* String0_Err_undertemp_charge: 9|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_undertemp_charge & 0x1u) << 49u;
+    /* String0_Err_overtemp_discharge: 10|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_overtemp_discharge & 0x1u) << 50u;
+    /* String0_Err_undertemp_discharge: 11|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_undertemp_discharge & 0x1u) << 51u;
+    /* String0_Err_Overcurrent_charge: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_Overcurrent_charge & 0x1u) << 52u;
+    /* String0_Err_Overcurre_discharge: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_Overcurre_discharge & 0x1u) << 53u;
+    /* String0_Err_Overvoltage: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_Overvoltage & 0x1u) << 54u;
+    /* String0_Err_Undervoltage: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_Undervoltage & 0x1u) << 55u;
+    /* String0_Err_deep_discharge: 7|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_deep_discharge & 0x1u) << 63u;
+    /* String0_Err_CS_currentMeas: 43|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_CS_currentMeas & 0x1u) << 19u;
+    /* String0_Err_positiveContactor: 32|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_positiveContactor & 0x1u) << 24u;
+    /* String0_Err_openWire: 49|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_openWire & 0x1u) << 9u;
+    /* String0_openWireNumber: 63|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_openWireNumber & 0xFFu) << 0u;
+    /* String0_Err_plaus_cell_volt: 52|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_plaus_cell_volt & 0x1u) << 12u;
+    /* String0_Err_plaus_cell_temp: 51|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_plaus_cell_temp & 0x1u) << 11u;
+    /* String0_Err_plaus_string_volt: 53|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_plaus_string_volt & 0x1u) << 13u;
+    /* String0_Err_slave_hardware: 34|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_slave_hardware & 0x1u) << 26u;
+    /* String0_Err_dsyChainPrim_Comm: 35|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_dsyChainPrim_Comm & 0x1u) << 27u;
+    /* String0_Err_dsyChainPrim_CRC: 37|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_dsyChainPrim_CRC & 0x1u) << 29u;
+    /* String0_Err_dsyChainRedun_Comm: 36|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_dsyChainRedun_Comm & 0x1u) << 28u;
+    /* String0_Err_dsyChainRedun_CRC: 38|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_dsyChainRedun_CRC & 0x1u) << 30u;
+    /* String0_Err_dsyPrim_voltMeasOor: 39|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_dsyPrim_voltMeasOor & 0x1u) << 31u;
+    /* String0_Err_dsyRedun_voltMeasOor: 40|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_dsyRedun_voltMeasOor & 0x1u) << 16u;
+    /* String0_Err_dsyPrim_tempMeasOor: 41|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_dsyPrim_tempMeasOor & 0x1u) << 17u;
+    /* String0_Err_dsyRedun_tempMeasOor: 42|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_dsyRedun_tempMeasOor & 0x1u) << 18u;
+    /* String0_Err_CS_coulombCountMeas: 44|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_CS_coulombCountMeas & 0x1u) << 20u;
+    /* String0_Err_CS_energyCountMeas: 45|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_CS_energyCountMeas & 0x1u) << 21u;
+    /* String0_Err_plaus_volt_spread: 55|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_plaus_volt_spread & 0x1u) << 15u;
+    /* String0_Err_plaus_temp_spread: 54|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Err_plaus_temp_spread & 0x1u) << 14u;
+    /* String0_fuseBlown: 6|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_fuseBlown & 0x1u) << 6u;
+    /* String0_Warning_overvoltage_MOL: 22|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Warning_overvoltage_MOL & 0x1u) << 22u;
+    /* String0_Warning_undervoltage_MOL: 23|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Warning_undervoltage_MOL & 0x1u) << 23u;
+    /* String0_Wrng_chargeOverTemp_MOL: 16|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_chargeOverTemp_MOL & 0x1u) << 16u;
+    /* String0_Wrng_dischrgOverTemp_MOL: 18|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_dischrgOverTemp_MOL & 0x1u) << 18u;
+    /* String0_Wrng_chargeUnderTemp_MOL: 17|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_chargeUnderTemp_MOL & 0x1u) << 17u;
+    /* String0_Wrng_dischrgUnderTmp_MOL: 19|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_dischrgUnderTmp_MOL & 0x1u) << 19u;
+    /* String0_Wrng_chargeOverCur_MOL: 20|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_chargeOverCur_MOL & 0x1u) << 20u;
+    /* String0_Wrng_dischargOverCur_MOL: 21|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_dischargOverCur_MOL & 0x1u) << 21u;
+    /* String0_Wrng_chargeOverTemp_RSL: 24|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_chargeOverTemp_RSL & 0x1u) << 24u;
+    /* String0_Wrng_chargeUnderTemp_RSL: 25|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_chargeUnderTemp_RSL & 0x1u) << 25u;
+    /* String0_Wrng_dischrgOverTemp_RSL: 26|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_dischrgOverTemp_RSL & 0x1u) << 26u;
+    /* String0_Wrng_dischrgUnderTmp_RSL: 27|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_dischrgUnderTmp_RSL & 0x1u) << 27u;
+    /* String0_Wrng_chargeOverCur_RSL: 28|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_chargeOverCur_RSL & 0x1u) << 28u;
+    /* String0_Wrng_dischargOverCur_RSL: 29|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_dischargOverCur_RSL & 0x1u) << 29u;
+    /* String0_Wrng_overvoltage_RSL: 30|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_overvoltage_RSL & 0x1u) << 30u;
+    /* String0_Wrng_undervoltage_RSL: 31|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Wrng_undervoltage_RSL & 0x1u) << 31u;
+    /* String0_Err_negativeContactor: 33|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Err_negativeContactor & 0x1u) << 33u;
+    /* String0_Err_CS_voltage1Meas: 46|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Err_CS_voltage1Meas & 0x1u) << 46u;
+    /* String0_Err_CS_voltage2Meas: 47|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Err_CS_voltage2Meas & 0x1u) << 47u;
+    /* String0_Err_CS_voltage3Meas: 48|1@1+ */
+    messageLittleEndian |= ((uint64_t)pSignals->String0_Err_CS_voltage3Meas & 0x1u) << 48u;
+
+    pCanData[0] = (uint8_t)((messageLittleEndian >> 0u) | (messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageLittleEndian >> 8u) | (messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageLittleEndian >> 16u) | (messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageLittleEndian >> 24u) | (messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageLittleEndian >> 32u) | (messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageLittleEndian >> 40u) | (messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageLittleEndian >> 48u) | (messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageLittleEndian >> 56u) | (messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsStringState(const uint8_t *pCanData, CAN_FOXBMS_STRING_STATE_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+    const uint64_t messageLittleEndian =
+        ((uint64_t)pCanData[0] << 0u) |
+        ((uint64_t)pCanData[1] << 8u) |
+        ((uint64_t)pCanData[2] << 16u) |
+        ((uint64_t)pCanData[3] << 24u) |
+        ((uint64_t)pCanData[4] << 32u) |
+        ((uint64_t)pCanData[5] << 40u) |
+        ((uint64_t)pCanData[6] << 48u) |
+        ((uint64_t)pCanData[7] << 56u);
+
+    /* foxBMS_StringState_Mux: 3|4@0+ */
+    pSignals->foxBMS_StringState_Mux = (uint8_t)((messageBigEndian >> 56u) & 0xFu);
+    /* String0_stringConnected: 4|1@0+ */
+    pSignals->String0_stringConnected = (uint8_t)((messageBigEndian >> 60u) & 0x1u);
+    /* String0_balancing_active: 5|1@0+ */
+    pSignals->String0_balancing_active = (uint8_t)((messageBigEndian >> 61u) & 0x1u);
+    /* String0_Err_overtemp_charge: 8|1@0+ */
+    pSignals->String0_Err_overtemp_charge = (uint8_t)((messageBigEndian >> 48u) & 0x1u);
+    /* String0_Err_undertemp_charge: 9|1@0+ */
+    pSignals->String0_Err_undertemp_charge = (uint8_t)((messageBigEndian >> 49u) & 0x1u);
+    /* String0_Err_overtemp_discharge: 10|1@0+ */
+    pSignals->String0_Err_overtemp_discharge = (uint8_t)((messageBigEndian >> 50u) & 0x1u);
+    /* String0_Err_undertemp_discharge: 11|1@0+ */
+    pSignals->String0_Err_undertemp_discharge = (uint8_t)((messageBigEndian >> 51u) & 0x1u);
+    /* String0_Err_Overcurrent_charge: 12|1@0+ */
+    pSignals->String0_Err_Overcurrent_charge = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* String0_Err_Overcurre_discharge: 13|1@0+ */
+    pSignals->String0_Err_Overcurre_discharge = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* String0_Err_Overvoltage: 14|1@0+ */
+    pSignals->String0_Err_Overvoltage = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* String0_Err_Undervoltage: 15|1@0+ */
+    pSignals->String0_Err_Undervoltage = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* String0_Err_deep_discharge: 7|1@0+ */
+    pSignals->String0_Err_deep_discharge = (uint8_t)((messageBigEndian >> 63u) & 0x1u);
+    /* String0_Err_CS_currentMeas: 43|1@0+ */
+    pSignals->String0_Err_CS_currentMeas = (uint8_t)((messageBigEndian >> 19u) & 0x1u);
+    /* String0_Err_positiveContactor: 32|1@0+ */
+    pSignals->String0_Err_positiveContactor = (uint8_t)((messageBigEndian >> 24u) & 0x1u);
+    /* String0_Err_openWire: 49|1@0+ */
+    pSignals->String0_Err_openWire = (uint8_t)((messageBigEndian >> 9u) & 0x1u);
+    /* String0_openWireNumber: 63|8@0+ */
+    pSignals->String0_openWireNumber = (uint8_t)((messageBigEndian >> 0u) & 0xFFu);
+    /* String0_Err_plaus_cell_volt: 52|1@0+ */
+    pSignals->String0_Err_plaus_cell_volt = (uint8_t)((messageBigEndian >> 12u) & 0x1u);
+    /* String0_Err_plaus_cell_temp: 51|1@0+ */
+    pSignals->String0_Err_plaus_cell_temp = (uint8_t)((messageBigEndian >> 11u) & 0x1u);
+    /* String0_Err_plaus_string_volt: 53|1@0+ */
+    pSignals->String0_Err_plaus_string_volt = (uint8_t)((messageBigEndian >> 13u) & 0x1u);
+    /* String0_Err_slave_hardware: 34|1@0+ */
+    pSignals->String0_Err_slave_hardware = (uint8_t)((messageBigEndian >> 26u) & 0x1u);
+    /* String0_Err_dsyChainPrim_Comm: 35|1@0+ */
+    pSignals->String0_Err_dsyChainPrim_Comm = (uint8_t)((messageBigEndian >> 27u) & 0x1u);
+    /* String0_Err_dsyChainPrim_CRC: 37|1@0+ */
+    pSignals->String0_Err_dsyChainPrim_CRC = (uint8_t)((messageBigEndian >> 29u) & 0x1u);
+    /* String0_Err_dsyChainRedun_Comm: 36|1@0+ */
+    pSignals->String0_Err_dsyChainRedun_Comm = (uint8_t)((messageBigEndian >> 28u) & 0x1u);
+    /* String0_Err_dsyChainRedun_CRC: 38|1@0+ */
+    pSignals->String0_Err_dsyChainRedun_CRC = (uint8_t)((messageBigEndian >> 30u) & 0x1u);
+    /* String0_Err_dsyPrim_voltMeasOor: 39|1@0+ */
+    pSignals->String0_Err_dsyPrim_voltMeasOor = (uint8_t)((messageBigEndian >> 31u) & 0x1u);
+    /* String0_Err_dsyRedun_voltMeasOor: 40|1@0+ */
+    pSignals->String0_Err_dsyRedun_voltMeasOor = (uint8_t)((messageBigEndian >> 16u) & 0x1u);
+    /* String0_Err_dsyPrim_tempMeasOor: 41|1@0+ */
+    pSignals->String0_Err_dsyPrim_tempMeasOor = (uint8_t)((messageBigEndian >> 17u) & 0x1u);
+    /* String0_Err_dsyRedun_tempMeasOor: 42|1@0+ */
+    pSignals->String0_Err_dsyRedun_tempMeasOor = (uint8_t)((messageBigEndian >> 18u) & 0x1u);
+    /* String0_Err_CS_coulombCountMeas: 44|1@0+ */
+    pSignals->String0_Err_CS_coulombCountMeas = (uint8_t)((messageBigEndian >> 20u) & 0x1u);
+    /* String0_Err_CS_energyCountMeas: 45|1@0+ */
+    pSignals->String0_Err_CS_energyCountMeas = (uint8_t)((messageBigEndian >> 21u) & 0x1u);
+    /* String0_Err_plaus_volt_spread: 55|1@0+ */
+    pSignals->String0_Err_plaus_volt_spread = (uint8_t)((messageBigEndian >> 15u) & 0x1u);
+    /* String0_Err_plaus_temp_spread: 54|1@0+ */
+    pSignals->String0_Err_plaus_temp_spread = (uint8_t)((messageBigEndian >> 14u) & 0x1u);
+    /* String0_fuseBlown: 6|1@1+ */
+    pSignals->String0_fuseBlown = (uint8_t)((messageLittleEndian >> 6u) & 0x1u);
+    /* String0_Warning_overvoltage_MOL: 22|1@1+ */
+    pSignals->String0_Warning_overvoltage_MOL = (uint8_t)((messageLittleEndian >> 22u) & 0x1u);
+    /* String0_Warning_undervoltage_MOL: 23|1@1+ */
+    pSignals->String0_Warning_undervoltage_MOL = (uint8_t)((messageLittleEndian >> 23u) & 0x1u);
+    /* String0_Wrng_chargeOverTemp_MOL: 16|1@1+ */
+    pSignals->String0_Wrng_chargeOverTemp_MOL = (uint8_t)((messageLittleEndian >> 16u) & 0x1u);
+    /* String0_Wrng_dischrgOverTemp_MOL: 18|1@1+ */
+    pSignals->String0_Wrng_dischrgOverTemp_MOL = (uint8_t)((messageLittleEndian >> 18u) & 0x1u);
+    /* String0_Wrng_chargeUnderTemp_MOL: 17|1@1+ */
+    pSignals->String0_Wrng_chargeUnderTemp_MOL = (uint8_t)((messageLittleEndian >> 17u) & 0x1u);
+    /* String0_Wrng_dischrgUnderTmp_MOL: 19|1@1+ */
+    pSignals->String0_Wrng_dischrgUnderTmp_MOL = (uint8_t)((messageLittleEndian >> 19u) & 0x1u);
+    /* String0_Wrng_chargeOverCur_MOL: 20|1@1+ */
+    pSignals->String0_Wrng_chargeOverCur_MOL = (uint8_t)((messageLittleEndian >> 20u) & 0x1u);
+    /* String0_Wrng_dischargOverCur_MOL: 21|1@1+ */
+    pSignals->String0_Wrng_dischargOverCur_MOL = (uint8_t)((messageLittleEndian >> 21u) & 0x1u);
+    /* String0_Wrng_chargeOverTemp_RSL: 24|1@1+ */
+    pSignals->String0_Wrng_chargeOverTemp_RSL = (uint8_t)((messageLittleEndian >> 24u) & 0x1u);
+    /* String0_Wrng_chargeUnderTemp_RSL: 25|1@1+ */
+    pSignals->String0_Wrng_chargeUnderTemp_RSL = (uint8_t)((messageLittleEndian >> 25u) & 0x1u);
+    /* String0_Wrng_dischrgOverTemp_RSL: 26|1@1+ */
+    pSignals->String0_Wrng_dischrgOverTemp_RSL = (uint8_t)((messageLittleEndian >> 26u) & 0x1u);
+    /* String0_Wrng_dischrgUnderTmp_RSL: 27|1@1+ */
+    pSignals->String0_Wrng_dischrgUnderTmp_RSL = (uint8_t)((messageLittleEndian >> 27u) & 0x1u);
+    /* String0_Wrng_chargeOverCur_RSL: 28|1@1+ */
+    pSignals->String0_Wrng_chargeOverCur_RSL = (uint8_t)((messageLittleEndian >> 28u) & 0x1u);
+    /* String0_Wrng_dischargOverCur_RSL: 29|1@1+ */
+    pSignals->String0_Wrng_dischargOverCur_RSL = (uint8_t)((messageLittleEndian >> 29u) & 0x1u);
+    /* String0_Wrng_overvoltage_RSL: 30|1@1+ */
+    pSignals->String0_Wrng_overvoltage_RSL = (uint8_t)((messageLittleEndian >> 30u) & 0x1u);
+    /* String0_Wrng_undervoltage_RSL: 31|1@1+ */
+    pSignals->String0_Wrng_undervoltage_RSL = (uint8_t)((messageLittleEndian >> 31u) & 0x1u);
+    /* String0_Err_negativeContactor: 33|1@1+ */
+    pSignals->String0_Err_negativeContactor = (uint8_t)((messageLittleEndian >> 33u) & 0x1u);
+    /* String0_Err_CS_voltage1Meas: 46|1@1+ */
+    pSignals->String0_Err_CS_voltage1Meas = (uint8_t)((messageLittleEndian >> 46u) & 0x1u);
+    /* String0_Err_CS_voltage2Meas: 47|1@1+ */
+    pSignals->String0_Err_CS_voltage2Meas = (uint8_t)((messageLittleEndian >> 47u) & 0x1u);
+    /* String0_Err_CS_voltage3Meas: 48|1@1+ */
+    pSignals->String0_Err_CS_voltage3Meas = (uint8_t)((messageLittleEndian >> 48u) & 0x1u);
+}
+
+extern void CAN_PackFoxbmsStringMinimumMaximumValues(
+    const CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_SIGNALS_s *pSignals,
+    uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_StringMinimumMaximumValues_Mux: 3|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_StringMinimumMaximumValues_Mux & 0xFu) << 56u;
+    /* String0_minimumCellVoltage: 18|13@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_minimumCellVoltage & 0x1FFFu) << 30u;
+    /* String0_maximumCellVoltage: 15|13@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_maximumCellVoltage & 0x1FFFu) << 43u;
+    /* String0_maximumCellTemperature: 37|9@0- */
+    messageBigEndian |= ((uint64_t)pSignals->String0_maximumCellTemperature & 0x1FFu) << 21u;
+    /* String0_minimumCellTemperature: 44|9@0- */
+    messageBigEndian |= ((uint64_t)pSignals->String0_minimumCellTemperature & 0x1FFu) << 12u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsStringMinimumMaximumValues(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_StringMinimumMaximumValues_Mux: 3|4@0+ */
+    pSignals->foxBMS_StringMinimumMaximumValues_Mux = (uint8_t)((messageBigEndian >> 56u) & 0xFu);
+    /* String0_minimumCellVoltage: 18|13@0+ */
+    pSignals->String0_minimumCellVoltage = (uint16_t)((messageBigEndian >> 30u) & 0x1FFFu);
+    /* String0_maximumCellVoltage: 15|13@0+ */
+    pSignals->String0_maximumCellVoltage = (uint16_t)((messageBigEndian >> 43u) & 0x1FFFu);
+    /* String0_maximumCellTemperature: 37|9@0- */
+    pSignals->String0_maximumCellTemperature =
+        (int16_t)(int64_t)((((messageBigEndian >> 21u) & 0x1FFu) ^ 0x100u) - 0x100u);
+    /* String0_minimumCellTemperature: 44|9@0- */
+    pSignals->String0_minimumCellTemperature =
+        (int16_t)(int64_t)((((messageBigEndian >> 12u) & 0x1FFu) ^ 0x100u) - 0x100u);
+}
+
+extern void CAN_PackFoxbmsStringStateEstimation(
+    const CAN_FOXBMS_STRING_STATE_ESTIMATION_SIGNALS_s *pSignals,
+    uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_StringStateEstimation_Mux: 7|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_StringStateEstimation_Mux & 0xFu) << 60u;
+    /* String0_minimumSOC: 3|9@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_minimumSOC & 0x1FFu) << 51u;
+    /* String0_averageSOC: 10|9@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_averageSOC & 0x1FFu) << 42u;
+    /* String0_maximumSOC: 17|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_maximumSOC & 0xFFu) << 34u;
+    /* String0_SOE: 25|9@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_SOE & 0x1FFu) << 25u;
+    /* String0_Energy_Wh: 55|16@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_Energy_Wh & 0xFFFFu) << 0u;
+    /* String0_SOH: 32|9@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->String0_SOH & 0x1FFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsStringStateEstimation(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_STRING_STATE_ESTIMATION_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_StringStateEstimation_Mux: 7|4@0+ */
+    pSignals->foxBMS_StringStateEstimation_Mux = (uint8_t)((messageBigEndian >> 60u) & 0xFu);
+    /* String0_minimumSOC: 3|9@0+ */
+    pSignals->String0_minimumSOC = (uint16_t)((messageBigEndian >> 51u) & 0x1FFu);
+    /* String0_averageSOC: 10|9@0+ */
+    pSignals->String0_averageSOC = (uint16_t)((messageBigEndian >> 42u) & 0x1FFu);
+    /* String0_maximumSOC: 17|8@0+ */
+    pSignals->String0_maximumSOC = (uint8_t)((messageBigEndian >> 34u) & 0xFFu);
+    /* String0_SOE: 25|9@0+ */
+    pSignals->String0_SOE = (uint16_t)((messageBigEndian >> 25u) & 0x1FFu);
+    /* String0_Energy_Wh: 55|16@0+ */
+    pSignals->String0_Energy_Wh = (uint16_t)((messageBigEndian >> 0u) & 0xFFFFu);
+    /* String0_SOH: 32|9@0+ */
+    pSignals->String0_SOH = (uint16_t)((messageBigEndian >> 16u) & 0x1FFu);
+}
+
+extern void CAN_PackFoxbmsAlgorithmStatistics(
+    const CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS_s *pSignals,
+    uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_AlgorithmStatistics_Mux: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_AlgorithmStatistics_Mux & 0xFFu) << 56u;
+    /* Algorithm0_averageTime: 15|16@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Algorithm0_averageTime & 0xFFFFu) << 40u;
+    /* Algorithm0_worstTime: 31|16@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Algorithm0_worstTime & 0xFFFFu) << 24u;
+    /* Algorithm0_overruns: 47|16@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Algorithm0_overruns & 0xFFFFu) << 8u;
+    /* Algorithm0_state: 63|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Algorithm0_state & 0xFu) << 4u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsAlgorithmStatistics(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_AlgorithmStatistics_Mux: 7|8@0+ */
+    pSignals->foxBMS_AlgorithmStatistics_Mux = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* Algorithm0_averageTime: 15|16@0+ */
+    pSignals->Algorithm0_averageTime = (uint16_t)((messageBigEndian >> 40u) & 0xFFFFu);
+    /* Algorithm0_worstTime: 31|16@0+ */
+    pSignals->Algorithm0_worstTime = (uint16_t)((messageBigEndian >> 24u) & 0xFFFFu);
+    /* Algorithm0_overruns: 47|16@0+ */
+    pSignals->Algorithm0_overruns = (uint16_t)((messageBigEndian >> 8u) & 0xFFFFu);
+    /* Algorithm0_state: 63|4@0+ */
+    pSignals->Algorithm0_state = (uint8_t)((messageBigEndian >> 4u) & 0xFu);
+}
+
+extern void CAN_PackFoxbmsProfilingTimes(const CAN_FOXBMS_PROFILING_TIMES_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_ProfilingTimes_Mux: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_ProfilingTimes_Mux & 0xFFu) << 56u;
+    /* Profile0_minimumTime: 15|16@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_minimumTime & 0xFFFFu) << 40u;
+    /* Profile0_maximumTime: 31|16@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_maximumTime & 0xFFFFu) << 24u;
+    /* Profile0_meanTime: 47|16@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_meanTime & 0xFFFFu) << 8u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsProfilingTimes(const uint8_t *pCanData, CAN_FOXBMS_PROFILING_TIMES_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_ProfilingTimes_Mux: 7|8@0+ */
+    pSignals->foxBMS_ProfilingTimes_Mux = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* Profile0_minimumTime: 15|16@0+ */
+    pSignals->Profile0_minimumTime = (uint16_t)((messageBigEndian >> 40u) & 0xFFFFu);
+    /* Profile0_maximumTime: 31|16@0+ */
+    pSignals->Profile0_maximumTime = (uint16_t)((messageBigEndian >> 24u) & 0xFFFFu);
+    /* Profile0_meanTime: 47|16@0+ */
+    pSignals->Profile0_meanTime = (uint16_t)((messageBigEndian >> 8u) & 0xFFFFu);
+}
+
+extern void CAN_PackFoxbmsProfilingHistogram(
+    const CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS_s *pSignals,
+    uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_ProfilingHistogram_Mux: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_ProfilingHistogram_Mux & 0xFFu) << 56u;
+    /* Profile0_bucket0: 15|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_bucket0 & 0xFFu) << 48u;
+    /* Profile0_bucket1: 23|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_bucket1 & 0xFFu) << 40u;
+    /* Profile0_bucket2: 31|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_bucket2 & 0xFFu) << 32u;
+    /* Profile0_bucket3: 39|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_bucket3 & 0xFFu) << 24u;
+    /* Profile0_bucket4: 47|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_bucket4 & 0xFFu) << 16u;
+    /* Profile0_bucket5: 55|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_bucket5 & 0xFFu) << 8u;
+    /* Profile0_bucket6: 63|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Profile0_bucket6 & 0xFFu) << 0u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsProfilingHistogram(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_ProfilingHistogram_Mux: 7|8@0+ */
+    pSignals->foxBMS_ProfilingHistogram_Mux = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* Profile0_bucket0: 15|8@0+ */
+    pSignals->Profile0_bucket0 = (uint8_t)((messageBigEndian >> 48u) & 0xFFu);
+    /* Profile0_bucket1: 23|8@0+ */
+    pSignals->Profile0_bucket1 = (uint8_t)((messageBigEndian >> 40u) & 0xFFu);
+    /* Profile0_bucket2: 31|8@0+ */
+    pSignals->Profile0_bucket2 = (uint8_t)((messageBigEndian >> 32u) & 0xFFu);
+    /* Profile0_bucket3: 39|8@0+ */
+    pSignals->Profile0_bucket3 = (uint8_t)((messageBigEndian >> 24u) & 0xFFu);
+    /* Profile0_bucket4: 47|8@0+ */
+    pSignals->Profile0_bucket4 = (uint8_t)((messageBigEndian >> 16u) & 0xFFu);
+    /* Profile0_bucket5: 55|8@0+ */
+    pSignals->Profile0_bucket5 = (uint8_t)((messageBigEndian >> 8u) & 0xFFu);
+    /* Profile0_bucket6: 63|8@0+ */
+    pSignals->Profile0_bucket6 = (uint8_t)((messageBigEndian >> 0u) & 0xFFu);
+}
+
+extern void CAN_PackFoxbmsTimingViolation(const CAN_FOXBMS_TIMING_VIOLATION_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_TimingViolation_Mux: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_TimingViolation_Mux & 0xFFu) << 56u;
+    /* Violation0_taskId: 15|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Violation0_taskId & 0xFFu) << 48u;
+    /* Violation0_timestamp: 23|32@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Violation0_timestamp & 0xFFFFFFFFu) << 16u;
+    /* Violation0_jitter: 55|16@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Violation0_jitter & 0xFFFFu) << 0u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsTimingViolation(const uint8_t *pCanData, CAN_FOXBMS_TIMING_VIOLATION_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_TimingViolation_Mux: 7|8@0+ */
+    pSignals->foxBMS_TimingViolation_Mux = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* Violation0_taskId: 15|8@0+ */
+    pSignals->Violation0_taskId = (uint8_t)((messageBigEndian >> 48u) & 0xFFu);
+    /* Violation0_timestamp: 23|32@0+ */
+    pSignals->Violation0_timestamp = (uint32_t)((messageBigEndian >> 16u) & 0xFFFFFFFFu);
+    /* Violation0_jitter: 55|16@0+ */
+    pSignals->Violation0_jitter = (uint16_t)((messageBigEndian >> 0u) & 0xFFFFu);
+}
+
+extern void CAN_PackFoxbmsTimingViolationDurations(
+    const CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS_s *pSignals,
+    uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* foxBMS_TimingViolationDurations_Mux: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->foxBMS_TimingViolationDurations_Mux & 0xFFu) << 56u;
+    /* Violation0_durationTask0: 15|10@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Violation0_durationTask0 & 0x3FFu) << 46u;
+    /* Violation0_durationTask1: 21|10@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Violation0_durationTask1 & 0x3FFu) << 36u;
+    /* Violation0_durationTask2: 27|10@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Violation0_durationTask2 & 0x3FFu) << 26u;
+    /* Violation0_durationTask3: 33|10@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Violation0_durationTask3 & 0x3FFu) << 16u;
+    /* Violation0_durationTask4: 55|10@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->Violation0_durationTask4 & 0x3FFu) << 6u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+    pCanData[6] = (uint8_t)((messageBigEndian >> 8u));
+    pCanData[7] = (uint8_t)((messageBigEndian >> 0u));
+}
+
+extern void CAN_UnpackFoxbmsTimingViolationDurations(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u) |
+        ((uint64_t)pCanData[6] << 8u) |
+        ((uint64_t)pCanData[7] << 0u);
+
+    /* foxBMS_TimingViolationDurations_Mux: 7|8@0+ */
+    pSignals->foxBMS_TimingViolationDurations_Mux = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* Violation0_durationTask0: 15|10@0+ */
+    pSignals->Violation0_durationTask0 = (uint16_t)((messageBigEndian >> 46u) & 0x3FFu);
+    /* Violation0_durationTask1: 21|10@0+ */
+    pSignals->Violation0_durationTask1 = (uint16_t)((messageBigEndian >> 36u) & 0x3FFu);
+    /* Violation0_durationTask2: 27|10@0+ */
+    pSignals->Violation0_durationTask2 = (uint16_t)((messageBigEndian >> 26u) & 0x3FFu);
+    /* Violation0_durationTask3: 33|10@0+ */
+    pSignals->Violation0_durationTask3 = (uint16_t)((messageBigEndian >> 16u) & 0x3FFu);
+    /* Violation0_durationTask4: 55|10@0+ */
+    pSignals->Violation0_durationTask4 = (uint16_t)((messageBigEndian >> 6u) & 0x3FFu);
+}
+
+extern void CAN_PackIvt0MsgResultI(const CAN_IVT0_MSG_RESULT_I_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT0_Result_I_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_I_systemError & 0x1u) << 55u;
+    /* IVT0_Result_I_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_I_OCS & 0x1u) << 52u;
+    /* IVT0_Result_I_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_I_overallMeasError & 0x1u) << 54u;
+    /* IVT0_Result_I_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_I_channelMeasError & 0x1u) << 53u;
+    /* IVT0_ID_Result_I: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_ID_Result_I & 0xFFu) << 56u;
+    /* IVT0_MsgCount_Result_I: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_MsgCount_Result_I & 0xFu) << 48u;
+    /* IVT0_Result_I_mA: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_I_mA & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt0MsgResultI(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_I_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT0_Result_I_systemError: 15|1@0+ */
+    pSignals->IVT0_Result_I_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT0_Result_I_OCS: 12|1@0+ */
+    pSignals->IVT0_Result_I_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT0_Result_I_overallMeasError: 14|1@0+ */
+    pSignals->IVT0_Result_I_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT0_Result_I_channelMeasError: 13|1@0+ */
+    pSignals->IVT0_Result_I_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT0_ID_Result_I: 7|8@0+ */
+    pSignals->IVT0_ID_Result_I = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT0_MsgCount_Result_I: 11|4@0+ */
+    pSignals->IVT0_MsgCount_Result_I = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT0_Result_I_mA: 23|32@0- */
+    pSignals->IVT0_Result_I_mA =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt0MsgResultU1(const CAN_IVT0_MSG_RESULT_U1_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT0_Result_U1_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U1_systemError & 0x1u) << 55u;
+    /* IVT0_Result_U1_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U1_overallMeasError & 0x1u) << 54u;
+    /* IVT0_Result_U1_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U1_channelMeasError & 0x1u) << 53u;
+    /* IVT0_Result_U1_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U1_OCS & 0x1u) << 52u;
+    /* IVT0_ID_Result_U1: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_ID_Result_U1 & 0xFFu) << 56u;
+    /* IVT0_MsgCount_Result_U1: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_MsgCount_Result_U1 & 0xFu) << 48u;
+    /* IVT0_Result_U1_mV: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U1_mV & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt0MsgResultU1(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_U1_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT0_Result_U1_systemError: 15|1@0+ */
+    pSignals->IVT0_Result_U1_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT0_Result_U1_overallMeasError: 14|1@0+ */
+    pSignals->IVT0_Result_U1_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT0_Result_U1_channelMeasError: 13|1@0+ */
+    pSignals->IVT0_Result_U1_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT0_Result_U1_OCS: 12|1@0+ */
+    pSignals->IVT0_Result_U1_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT0_ID_Result_U1: 7|8@0+ */
+    pSignals->IVT0_ID_Result_U1 = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT0_MsgCount_Result_U1: 11|4@0+ */
+    pSignals->IVT0_MsgCount_Result_U1 = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT0_Result_U1_mV: 23|32@0- */
+    pSignals->IVT0_Result_U1_mV =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt0MsgResultU2(const CAN_IVT0_MSG_RESULT_U2_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT0_Result_U2_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U2_systemError & 0x1u) << 55u;
+    /* IVT0_Result_U2_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U2_OCS & 0x1u) << 52u;
+    /* IVT0_Result_U2_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U2_overallMeasError & 0x1u) << 54u;
+    /* IVT0_Result_U2_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U2_channelMeasError & 0x1u) << 53u;
+    /* IVT0_ID_Result_U2: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_ID_Result_U2 & 0xFFu) << 56u;
+    /* IVT0_MsgCount_Result_U2: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_MsgCount_Result_U2 & 0xFu) << 48u;
+    /* IVT0_Result_U2_mV: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_U2_mV & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt0MsgResultU2(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_U2_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT0_Result_U2_systemError: 15|1@0+ */
+    pSignals->IVT0_Result_U2_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT0_Result_U2_OCS: 12|1@0+ */
+    pSignals->IVT0_Result_U2_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT0_Result_U2_overallMeasError: 14|1@0+ */
+    pSignals->IVT0_Result_U2_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT0_Result_U2_channelMeasError: 13|1@0+ */
+    pSignals->IVT0_Result_U2_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT0_ID_Result_U2: 7|8@0+ */
+    pSignals->IVT0_ID_Result_U2 = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT0_MsgCount_Result_U2: 11|4@0+ */
+    pSignals->IVT0_MsgCount_Result_U2 = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT0_Result_U2_mV: 23|32@0- */
+    pSignals->IVT0_Result_U2_mV =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt0MsgResultU3(const CAN_IVT0_MSG_RESULT_U3_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT_Result_U3_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_systemError & 0x1u) << 55u;
+    /* IVT_Result_U3_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_OCS & 0x1u) << 52u;
+    /* IVT_Result_U3_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_overallMeasError & 0x1u) << 54u;
+    /* IVT_Result_U3_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_channelMeasError & 0x1u) << 53u;
+    /* IVT_ID_Result_U3: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_ID_Result_U3 & 0xFFu) << 56u;
+    /* IVT_MsgCount_Result_U3: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_MsgCount_Result_U3 & 0xFu) << 48u;
+    /* IVT_Result_U3_mV: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_mV & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt0MsgResultU3(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_U3_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT_Result_U3_systemError: 15|1@0+ */
+    pSignals->IVT_Result_U3_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT_Result_U3_OCS: 12|1@0+ */
+    pSignals->IVT_Result_U3_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT_Result_U3_overallMeasError: 14|1@0+ */
+    pSignals->IVT_Result_U3_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT_Result_U3_channelMeasError: 13|1@0+ */
+    pSignals->IVT_Result_U3_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT_ID_Result_U3: 7|8@0+ */
+    pSignals->IVT_ID_Result_U3 = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT_MsgCount_Result_U3: 11|4@0+ */
+    pSignals->IVT_MsgCount_Result_U3 = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT_Result_U3_mV: 23|32@0- */
+    pSignals->IVT_Result_U3_mV =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt0MsgResultT(const CAN_IVT0_MSG_RESULT_T_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT0_Result_T_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_T_systemError & 0x1u) << 55u;
+    /* IVT0_Result_T_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_T_OCS & 0x1u) << 52u;
+    /* IVT0_Result_T_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_T_overallMeasError & 0x1u) << 54u;
+    /* IVT0_Result_T_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_T_channelMeasError & 0x1u) << 53u;
+    /* IVT0_ID_Result_T: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_ID_Result_T & 0xFFu) << 56u;
+    /* IVT0_MsgCount_Result_T: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_MsgCount_Result_T & 0xFu) << 48u;
+    /* IVT0_Result_T_ddegC: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_T_ddegC & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt0MsgResultT(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_T_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT0_Result_T_systemError: 15|1@0+ */
+    pSignals->IVT0_Result_T_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT0_Result_T_OCS: 12|1@0+ */
+    pSignals->IVT0_Result_T_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT0_Result_T_overallMeasError: 14|1@0+ */
+    pSignals->IVT0_Result_T_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT0_Result_T_channelMeasError: 13|1@0+ */
+    pSignals->IVT0_Result_T_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT0_ID_Result_T: 7|8@0+ */
+    pSignals->IVT0_ID_Result_T = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT0_MsgCount_Result_T: 11|4@0+ */
+    pSignals->IVT0_MsgCount_Result_T = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT0_Result_T_ddegC: 23|32@0- */
+    pSignals->IVT0_Result_T_ddegC =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt0MsgResultW(const CAN_IVT0_MSG_RESULT_W_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT0_Result_W_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_W_systemError & 0x1u) << 55u;
+    /* IVT0_Result_W_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_W_OCS & 0x1u) << 52u;
+    /* IVT0_Result_W_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_W_overallMeasError & 0x1u) << 54u;
+    /* IVT0_Result_W_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_W_channelMeasError & 0x1u) << 53u;
+    /* IVT0_Result_W: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_W & 0xFFFFFFFFu) << 16u;
+    /* IVT0_MsgCount_Result_W: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_MsgCount_Result_W & 0xFu) << 48u;
+    /* IVT0_ID_Result_W: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_ID_Result_W & 0xFFu) << 56u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt0MsgResultW(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_W_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT0_Result_W_systemError: 15|1@0+ */
+    pSignals->IVT0_Result_W_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT0_Result_W_OCS: 12|1@0+ */
+    pSignals->IVT0_Result_W_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT0_Result_W_overallMeasError: 14|1@0+ */
+    pSignals->IVT0_Result_W_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT0_Result_W_channelMeasError: 13|1@0+ */
+    pSignals->IVT0_Result_W_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT0_Result_W: 23|32@0- */
+    pSignals->IVT0_Result_W =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+    /* IVT0_MsgCount_Result_W: 11|4@0+ */
+    pSignals->IVT0_MsgCount_Result_W = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT0_ID_Result_W: 7|8@0+ */
+    pSignals->IVT0_ID_Result_W = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+}
+
+extern void CAN_PackIvt0MsgResultAs(const CAN_IVT0_MSG_RESULT_AS_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT0_Result_As_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_As_systemError & 0x1u) << 55u;
+    /* IVT0_Result_As_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_As_OCS & 0x1u) << 52u;
+    /* IVT0_Result_As_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_As_overallMeasError & 0x1u) << 54u;
+    /* IVT0_Result_As_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_As_channelMeasError & 0x1u) << 53u;
+    /* IVT0_Result_As: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_As & 0xFFFFFFFFu) << 16u;
+    /* IVT0_MsgCount_Result_As: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_MsgCount_Result_As & 0xFu) << 48u;
+    /* IVT0_ID_Result_As: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_ID_Result_As & 0xFFu) << 56u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt0MsgResultAs(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_AS_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT0_Result_As_systemError: 15|1@0+ */
+    pSignals->IVT0_Result_As_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT0_Result_As_OCS: 12|1@0+ */
+    pSignals->IVT0_Result_As_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT0_Result_As_overallMeasError: 14|1@0+ */
+    pSignals->IVT0_Result_As_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT0_Result_As_channelMeasError: 13|1@0+ */
+    pSignals->IVT0_Result_As_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT0_Result_As: 23|32@0- */
+    pSignals->IVT0_Result_As =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+    /* IVT0_MsgCount_Result_As: 11|4@0+ */
+    pSignals->IVT0_MsgCount_Result_As = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT0_ID_Result_As: 7|8@0+ */
+    pSignals->IVT0_ID_Result_As = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+}
+
+extern void CAN_PackIvt0MsgResultWh(const CAN_IVT0_MSG_RESULT_WH_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT0_Result_Wh_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_Wh_systemError & 0x1u) << 55u;
+    /* IVT0_Result_Wh_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_Wh_OCS & 0x1u) << 52u;
+    /* IVT0_Result_Wh_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_Wh_overallMeasError & 0x1u) << 54u;
+    /* IVT0_Result_Wh_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_Wh_channelMeasError & 0x1u) << 53u;
+    /* IVT0_Result_Wh: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_Result_Wh & 0xFFFFFFFFu) << 16u;
+    /* IVT0_MsgCount_Result_Wh: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_MsgCount_Result_Wh & 0xFu) << 48u;
+    /* IVT0_ID_Result_Wh: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT0_ID_Result_Wh & 0xFFu) << 56u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt0MsgResultWh(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_WH_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT0_Result_Wh_systemError: 15|1@0+ */
+    pSignals->IVT0_Result_Wh_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT0_Result_Wh_OCS: 12|1@0+ */
+    pSignals->IVT0_Result_Wh_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT0_Result_Wh_overallMeasError: 14|1@0+ */
+    pSignals->IVT0_Result_Wh_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT0_Result_Wh_channelMeasError: 13|1@0+ */
+    pSignals->IVT0_Result_Wh_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT0_Result_Wh: 23|32@0- */
+    pSignals->IVT0_Result_Wh =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+    /* IVT0_MsgCount_Result_Wh: 11|4@0+ */
+    pSignals->IVT0_MsgCount_Result_Wh = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT0_ID_Result_Wh: 7|8@0+ */
+    pSignals->IVT0_ID_Result_Wh = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+}
+
+extern void CAN_PackIvt1MsgResultI(const CAN_IVT1_MSG_RESULT_I_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT1_Result_I_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_I_systemError & 0x1u) << 55u;
+    /* IVT1_Result_I_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_I_OCS & 0x1u) << 52u;
+    /* IVT1_Result_I_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_I_overallMeasError & 0x1u) << 54u;
+    /* IVT1_Result_I_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_I_channelMeasError & 0x1u) << 53u;
+    /* IVT1_ID_Result_I: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_ID_Result_I & 0xFFu) << 56u;
+    /* IVT1_MsgCount_Result_I: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_MsgCount_Result_I & 0xFu) << 48u;
+    /* IVT1_Result_I_mA: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_I_mA & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt1MsgResultI(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_I_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT1_Result_I_systemError: 15|1@0+ */
+    pSignals->IVT1_Result_I_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT1_Result_I_OCS: 12|1@0+ */
+    pSignals->IVT1_Result_I_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT1_Result_I_overallMeasError: 14|1@0+ */
+    pSignals->IVT1_Result_I_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT1_Result_I_channelMeasError: 13|1@0+ */
+    pSignals->IVT1_Result_I_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT1_ID_Result_I: 7|8@0+ */
+    pSignals->IVT1_ID_Result_I = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT1_MsgCount_Result_I: 11|4@0+ */
+    pSignals->IVT1_MsgCount_Result_I = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT1_Result_I_mA: 23|32@0- */
+    pSignals->IVT1_Result_I_mA =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt1MsgResultU1(const CAN_IVT1_MSG_RESULT_U1_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT1_Result_U1_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U1_systemError & 0x1u) << 55u;
+    /* IVT1_Result_U1_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U1_overallMeasError & 0x1u) << 54u;
+    /* IVT1_Result_U1_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U1_channelMeasError & 0x1u) << 53u;
+    /* IVT1_Result_U1_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U1_OCS & 0x1u) << 52u;
+    /* IVT1_ID_Result_U1: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_ID_Result_U1 & 0xFFu) << 56u;
+    /* IVT1_MsgCount_Result_U1: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_MsgCount_Result_U1 & 0xFu) << 48u;
+    /* IVT1_Result_U1_mV: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U1_mV & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt1MsgResultU1(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_U1_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT1_Result_U1_systemError: 15|1@0+ */
+    pSignals->IVT1_Result_U1_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT1_Result_U1_overallMeasError: 14|1@0+ */
+    pSignals->IVT1_Result_U1_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT1_Result_U1_channelMeasError: 13|1@0+ */
+    pSignals->IVT1_Result_U1_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT1_Result_U1_OCS: 12|1@0+ */
+    pSignals->IVT1_Result_U1_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT1_ID_Result_U1: 7|8@0+ */
+    pSignals->IVT1_ID_Result_U1 = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT1_MsgCount_Result_U1: 11|4@0+ */
+    pSignals->IVT1_MsgCount_Result_U1 = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT1_Result_U1_mV: 23|32@0- */
+    pSignals->IVT1_Result_U1_mV =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt1MsgResultU2(const CAN_IVT1_MSG_RESULT_U2_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT1_Result_U2_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U2_systemError & 0x1u) << 55u;
+    /* IVT1_Result_U2_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U2_OCS & 0x1u) << 52u;
+    /* IVT1_Result_U2_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U2_overallMeasError & 0x1u) << 54u;
+    /* IVT1_Result_U2_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U2_channelMeasError & 0x1u) << 53u;
+    /* IVT1_ID_Result_U2: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_ID_Result_U2 & 0xFFu) << 56u;
+    /* IVT1_MsgCount_Result_U2: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_MsgCount_Result_U2 & 0xFu) << 48u;
+    /* IVT1_Result_U2_mV: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_U2_mV & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt1MsgResultU2(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_U2_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT1_Result_U2_systemError: 15|1@0+ */
+    pSignals->IVT1_Result_U2_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT1_Result_U2_OCS: 12|1@0+ */
+    pSignals->IVT1_Result_U2_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT1_Result_U2_overallMeasError: 14|1@0+ */
+    pSignals->IVT1_Result_U2_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT1_Result_U2_channelMeasError: 13|1@0+ */
+    pSignals->IVT1_Result_U2_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT1_ID_Result_U2: 7|8@0+ */
+    pSignals->IVT1_ID_Result_U2 = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT1_MsgCount_Result_U2: 11|4@0+ */
+    pSignals->IVT1_MsgCount_Result_U2 = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT1_Result_U2_mV: 23|32@0- */
+    pSignals->IVT1_Result_U2_mV =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt1MsgResultU3(const CAN_IVT1_MSG_RESULT_U3_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT_Result_U3_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_systemError & 0x1u) << 55u;
+    /* IVT_Result_U3_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_OCS & 0x1u) << 52u;
+    /* IVT_Result_U3_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_overallMeasError & 0x1u) << 54u;
+    /* IVT_Result_U3_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_channelMeasError & 0x1u) << 53u;
+    /* IVT_ID_Result_U3: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_ID_Result_U3 & 0xFFu) << 56u;
+    /* IVT_MsgCount_Result_U3: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_MsgCount_Result_U3 & 0xFu) << 48u;
+    /* IVT_Result_U3_mV: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_mV & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt1MsgResultU3(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_U3_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT_Result_U3_systemError: 15|1@0+ */
+    pSignals->IVT_Result_U3_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT_Result_U3_OCS: 12|1@0+ */
+    pSignals->IVT_Result_U3_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT_Result_U3_overallMeasError: 14|1@0+ */
+    pSignals->IVT_Result_U3_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT_Result_U3_channelMeasError: 13|1@0+ */
+    pSignals->IVT_Result_U3_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT_ID_Result_U3: 7|8@0+ */
+    pSignals->IVT_ID_Result_U3 = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT_MsgCount_Result_U3: 11|4@0+ */
+    pSignals->IVT_MsgCount_Result_U3 = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT_Result_U3_mV: 23|32@0- */
+    pSignals->IVT_Result_U3_mV =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt1MsgResultT(const CAN_IVT1_MSG_RESULT_T_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT1_Result_T_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_T_systemError & 0x1u) << 55u;
+    /* IVT1_Result_T_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_T_OCS & 0x1u) << 52u;
+    /* IVT1_Result_T_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_T_overallMeasError & 0x1u) << 54u;
+    /* IVT1_Result_T_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_T_channelMeasError & 0x1u) << 53u;
+    /* IVT1_ID_Result_T: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_ID_Result_T & 0xFFu) << 56u;
+    /* IVT1_MsgCount_Result_T: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_MsgCount_Result_T & 0xFu) << 48u;
+    /* IVT1_Result_T_ddegC: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_T_ddegC & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt1MsgResultT(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_T_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT1_Result_T_systemError: 15|1@0+ */
+    pSignals->IVT1_Result_T_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT1_Result_T_OCS: 12|1@0+ */
+    pSignals->IVT1_Result_T_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT1_Result_T_overallMeasError: 14|1@0+ */
+    pSignals->IVT1_Result_T_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT1_Result_T_channelMeasError: 13|1@0+ */
+    pSignals->IVT1_Result_T_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT1_ID_Result_T: 7|8@0+ */
+    pSignals->IVT1_ID_Result_T = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT1_MsgCount_Result_T: 11|4@0+ */
+    pSignals->IVT1_MsgCount_Result_T = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT1_Result_T_ddegC: 23|32@0- */
+    pSignals->IVT1_Result_T_ddegC =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt1MsgResultW(const CAN_IVT1_MSG_RESULT_W_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT1_Result_W_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_W_systemError & 0x1u) << 55u;
+    /* IVT1_Result_W_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_W_OCS & 0x1u) << 52u;
+    /* IVT1_Result_W_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_W_overallMeasError & 0x1u) << 54u;
+    /* IVT1_Result_W_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_W_channelMeasError & 0x1u) << 53u;
+    /* IVT1_Result_W: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_W & 0xFFFFFFFFu) << 16u;
+    /* IVT1_MsgCount_Result_W: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_MsgCount_Result_W & 0xFu) << 48u;
+    /* IVT1_ID_Result_W: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_ID_Result_W & 0xFFu) << 56u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt1MsgResultW(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_W_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT1_Result_W_systemError: 15|1@0+ */
+    pSignals->IVT1_Result_W_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT1_Result_W_OCS: 12|1@0+ */
+    pSignals->IVT1_Result_W_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT1_Result_W_overallMeasError: 14|1@0+ */
+    pSignals->IVT1_Result_W_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT1_Result_W_channelMeasError: 13|1@0+ */
+    pSignals->IVT1_Result_W_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT1_Result_W: 23|32@0- */
+    pSignals->IVT1_Result_W =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+    /* IVT1_MsgCount_Result_W: 11|4@0+ */
+    pSignals->IVT1_MsgCount_Result_W = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT1_ID_Result_W: 7|8@0+ */
+    pSignals->IVT1_ID_Result_W = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+}
+
+extern void CAN_PackIvt1MsgResultAs(const CAN_IVT1_MSG_RESULT_AS_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT1_Result_As_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_As_systemError & 0x1u) << 55u;
+    /* IVT1_Result_As_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_As_OCS & 0x1u) << 52u;
+    /* IVT1_Result_As_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_As_overallMeasError & 0x1u) << 54u;
+    /* IVT1_Result_As_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_As_channelMeasError & 0x1u) << 53u;
+    /* IVT1_Result_As: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_As & 0xFFFFFFFFu) << 16u;
+    /* IVT1_MsgCount_Result_As: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_MsgCount_Result_As & 0xFu) << 48u;
+    /* IVT1_ID_Result_As: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_ID_Result_As & 0xFFu) << 56u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt1MsgResultAs(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_AS_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT1_Result_As_systemError: 15|1@0+ */
+    pSignals->IVT1_Result_As_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT1_Result_As_OCS: 12|1@0+ */
+    pSignals->IVT1_Result_As_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT1_Result_As_overallMeasError: 14|1@0+ */
+    pSignals->IVT1_Result_As_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT1_Result_As_channelMeasError: 13|1@0+ */
+    pSignals->IVT1_Result_As_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT1_Result_As: 23|32@0- */
+    pSignals->IVT1_Result_As =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+    /* IVT1_MsgCount_Result_As: 11|4@0+ */
+    pSignals->IVT1_MsgCount_Result_As = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT1_ID_Result_As: 7|8@0+ */
+    pSignals->IVT1_ID_Result_As = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+}
+
+extern void CAN_PackIvt1MsgResultWh(const CAN_IVT1_MSG_RESULT_WH_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT1_Result_Wh_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_Wh_systemError & 0x1u) << 55u;
+    /* IVT1_Result_Wh_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_Wh_OCS & 0x1u) << 52u;
+    /* IVT1_Result_Wh_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_Wh_overallMeasError & 0x1u) << 54u;
+    /* IVT1_Result_Wh_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_Wh_channelMeasError & 0x1u) << 53u;
+    /* IVT1_Result_Wh: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_Result_Wh & 0xFFFFFFFFu) << 16u;
+    /* IVT1_MsgCount_Result_Wh: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_MsgCount_Result_Wh & 0xFu) << 48u;
+    /* IVT1_ID_Result_Wh: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT1_ID_Result_Wh & 0xFFu) << 56u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt1MsgResultWh(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_WH_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT1_Result_Wh_systemError: 15|1@0+ */
+    pSignals->IVT1_Result_Wh_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT1_Result_Wh_OCS: 12|1@0+ */
+    pSignals->IVT1_Result_Wh_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT1_Result_Wh_overallMeasError: 14|1@0+ */
+    pSignals->IVT1_Result_Wh_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT1_Result_Wh_channelMeasError: 13|1@0+ */
+    pSignals->IVT1_Result_Wh_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT1_Result_Wh: 23|32@0- */
+    pSignals->IVT1_Result_Wh =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+    /* IVT1_MsgCount_Result_Wh: 11|4@0+ */
+    pSignals->IVT1_MsgCount_Result_Wh = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT1_ID_Result_Wh: 7|8@0+ */
+    pSignals->IVT1_ID_Result_Wh = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+}
+
+extern void CAN_PackIvt2MsgResultI(const CAN_IVT2_MSG_RESULT_I_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT2_Result_I_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_I_systemError & 0x1u) << 55u;
+    /* IVT2_Result_I_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_I_OCS & 0x1u) << 52u;
+    /* IVT2_Result_I_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_I_overallMeasError & 0x1u) << 54u;
+    /* IVT2_Result_I_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_I_channelMeasError & 0x1u) << 53u;
+    /* IVT2_ID_Result_I: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_ID_Result_I & 0xFFu) << 56u;
+    /* IVT2_MsgCount_Result_I: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_MsgCount_Result_I & 0xFu) << 48u;
+    /* IVT2_Result_I_mA: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_I_mA & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt2MsgResultI(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_I_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT2_Result_I_systemError: 15|1@0+ */
+    pSignals->IVT2_Result_I_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT2_Result_I_OCS: 12|1@0+ */
+    pSignals->IVT2_Result_I_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT2_Result_I_overallMeasError: 14|1@0+ */
+    pSignals->IVT2_Result_I_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT2_Result_I_channelMeasError: 13|1@0+ */
+    pSignals->IVT2_Result_I_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT2_ID_Result_I: 7|8@0+ */
+    pSignals->IVT2_ID_Result_I = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT2_MsgCount_Result_I: 11|4@0+ */
+    pSignals->IVT2_MsgCount_Result_I = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT2_Result_I_mA: 23|32@0- */
+    pSignals->IVT2_Result_I_mA =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt2MsgResultU1(const CAN_IVT2_MSG_RESULT_U1_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT2_Result_U1_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U1_systemError & 0x1u) << 55u;
+    /* IVT2_Result_U1_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U1_overallMeasError & 0x1u) << 54u;
+    /* IVT2_Result_U1_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U1_channelMeasError & 0x1u) << 53u;
+    /* IVT2_Result_U1_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U1_OCS & 0x1u) << 52u;
+    /* IVT2_ID_Result_U1: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_ID_Result_U1 & 0xFFu) << 56u;
+    /* IVT2_MsgCount_Result_U1: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_MsgCount_Result_U1 & 0xFu) << 48u;
+    /* IVT2_Result_U1_mV: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U1_mV & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt2MsgResultU1(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_U1_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT2_Result_U1_systemError: 15|1@0+ */
+    pSignals->IVT2_Result_U1_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT2_Result_U1_overallMeasError: 14|1@0+ */
+    pSignals->IVT2_Result_U1_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT2_Result_U1_channelMeasError: 13|1@0+ */
+    pSignals->IVT2_Result_U1_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT2_Result_U1_OCS: 12|1@0+ */
+    pSignals->IVT2_Result_U1_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT2_ID_Result_U1: 7|8@0+ */
+    pSignals->IVT2_ID_Result_U1 = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT2_MsgCount_Result_U1: 11|4@0+ */
+    pSignals->IVT2_MsgCount_Result_U1 = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT2_Result_U1_mV: 23|32@0- */
+    pSignals->IVT2_Result_U1_mV =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt2MsgResultU2(const CAN_IVT2_MSG_RESULT_U2_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT2_Result_U2_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U2_systemError & 0x1u) << 55u;
+    /* IVT2_Result_U2_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U2_OCS & 0x1u) << 52u;
+    /* IVT2_Result_U2_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U2_overallMeasError & 0x1u) << 54u;
+    /* IVT2_Result_U2_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U2_channelMeasError & 0x1u) << 53u;
+    /* IVT2_ID_Result_U2: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_ID_Result_U2 & 0xFFu) << 56u;
+    /* IVT2_MsgCount_Result_U2: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_MsgCount_Result_U2 & 0xFu) << 48u;
+    /* IVT2_Result_U2_mV: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_U2_mV & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt2MsgResultU2(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_U2_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT2_Result_U2_systemError: 15|1@0+ */
+    pSignals->IVT2_Result_U2_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT2_Result_U2_OCS: 12|1@0+ */
+    pSignals->IVT2_Result_U2_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT2_Result_U2_overallMeasError: 14|1@0+ */
+    pSignals->IVT2_Result_U2_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT2_Result_U2_channelMeasError: 13|1@0+ */
+    pSignals->IVT2_Result_U2_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT2_ID_Result_U2: 7|8@0+ */
+    pSignals->IVT2_ID_Result_U2 = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT2_MsgCount_Result_U2: 11|4@0+ */
+    pSignals->IVT2_MsgCount_Result_U2 = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT2_Result_U2_mV: 23|32@0- */
+    pSignals->IVT2_Result_U2_mV =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt2MsgResultU3(const CAN_IVT2_MSG_RESULT_U3_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT_Result_U3_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_systemError & 0x1u) << 55u;
+    /* IVT_Result_U3_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_OCS & 0x1u) << 52u;
+    /* IVT_Result_U3_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_overallMeasError & 0x1u) << 54u;
+    /* IVT_Result_U3_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_channelMeasError & 0x1u) << 53u;
+    /* IVT_ID_Result_U3: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_ID_Result_U3 & 0xFFu) << 56u;
+    /* IVT_MsgCount_Result_U3: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_MsgCount_Result_U3 & 0xFu) << 48u;
+    /* IVT_Result_U3_mV: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT_Result_U3_mV & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt2MsgResultU3(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_U3_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT_Result_U3_systemError: 15|1@0+ */
+    pSignals->IVT_Result_U3_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT_Result_U3_OCS: 12|1@0+ */
+    pSignals->IVT_Result_U3_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT_Result_U3_overallMeasError: 14|1@0+ */
+    pSignals->IVT_Result_U3_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT_Result_U3_channelMeasError: 13|1@0+ */
+    pSignals->IVT_Result_U3_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT_ID_Result_U3: 7|8@0+ */
+    pSignals->IVT_ID_Result_U3 = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT_MsgCount_Result_U3: 11|4@0+ */
+    pSignals->IVT_MsgCount_Result_U3 = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT_Result_U3_mV: 23|32@0- */
+    pSignals->IVT_Result_U3_mV =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt2MsgResultT(const CAN_IVT2_MSG_RESULT_T_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT2_Result_T_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_T_systemError & 0x1u) << 55u;
+    /* IVT2_Result_T_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_T_OCS & 0x1u) << 52u;
+    /* IVT2_Result_T_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_T_overallMeasError & 0x1u) << 54u;
+    /* IVT2_Result_T_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_T_channelMeasError & 0x1u) << 53u;
+    /* IVT2_ID_Result_T: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_ID_Result_T & 0xFFu) << 56u;
+    /* IVT2_MsgCount_Result_T: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_MsgCount_Result_T & 0xFu) << 48u;
+    /* IVT2_Result_T_ddegC: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_T_ddegC & 0xFFFFFFFFu) << 16u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt2MsgResultT(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_T_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT2_Result_T_systemError: 15|1@0+ */
+    pSignals->IVT2_Result_T_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT2_Result_T_OCS: 12|1@0+ */
+    pSignals->IVT2_Result_T_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT2_Result_T_overallMeasError: 14|1@0+ */
+    pSignals->IVT2_Result_T_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT2_Result_T_channelMeasError: 13|1@0+ */
+    pSignals->IVT2_Result_T_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT2_ID_Result_T: 7|8@0+ */
+    pSignals->IVT2_ID_Result_T = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+    /* IVT2_MsgCount_Result_T: 11|4@0+ */
+    pSignals->IVT2_MsgCount_Result_T = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT2_Result_T_ddegC: 23|32@0- */
+    pSignals->IVT2_Result_T_ddegC =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+}
+
+extern void CAN_PackIvt2MsgResultW(const CAN_IVT2_MSG_RESULT_W_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT2_Result_W_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_W_systemError & 0x1u) << 55u;
+    /* IVT2_Result_W_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_W_OCS & 0x1u) << 52u;
+    /* IVT2_Result_W_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_W_overallMeasError & 0x1u) << 54u;
+    /* IVT2_Result_W_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_W_channelMeasError & 0x1u) << 53u;
+    /* IVT2_Result_W: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_W & 0xFFFFFFFFu) << 16u;
+    /* IVT2_MsgCount_Result_W: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_MsgCount_Result_W & 0xFu) << 48u;
+    /* IVT2_ID_Result_W: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_ID_Result_W & 0xFFu) << 56u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt2MsgResultW(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_W_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT2_Result_W_systemError: 15|1@0+ */
+    pSignals->IVT2_Result_W_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT2_Result_W_OCS: 12|1@0+ */
+    pSignals->IVT2_Result_W_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT2_Result_W_overallMeasError: 14|1@0+ */
+    pSignals->IVT2_Result_W_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT2_Result_W_channelMeasError: 13|1@0+ */
+    pSignals->IVT2_Result_W_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT2_Result_W: 23|32@0- */
+    pSignals->IVT2_Result_W =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+    /* IVT2_MsgCount_Result_W: 11|4@0+ */
+    pSignals->IVT2_MsgCount_Result_W = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT2_ID_Result_W: 7|8@0+ */
+    pSignals->IVT2_ID_Result_W = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+}
+
+extern void CAN_PackIvt2MsgResultAs(const CAN_IVT2_MSG_RESULT_AS_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT2_Result_As_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_As_systemError & 0x1u) << 55u;
+    /* IVT2_Result_As_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_As_OCS & 0x1u) << 52u;
+    /* IVT2_Result_As_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_As_overallMeasError & 0x1u) << 54u;
+    /* IVT2_Result_As_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_As_channelMeasError & 0x1u) << 53u;
+    /* IVT2_Result_As: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_As & 0xFFFFFFFFu) << 16u;
+    /* IVT2_MsgCount_Result_As: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_MsgCount_Result_As & 0xFu) << 48u;
+    /* IVT2_ID_Result_As: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_ID_Result_As & 0xFFu) << 56u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt2MsgResultAs(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_AS_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT2_Result_As_systemError: 15|1@0+ */
+    pSignals->IVT2_Result_As_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT2_Result_As_OCS: 12|1@0+ */
+    pSignals->IVT2_Result_As_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT2_Result_As_overallMeasError: 14|1@0+ */
+    pSignals->IVT2_Result_As_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT2_Result_As_channelMeasError: 13|1@0+ */
+    pSignals->IVT2_Result_As_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT2_Result_As: 23|32@0- */
+    pSignals->IVT2_Result_As =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+    /* IVT2_MsgCount_Result_As: 11|4@0+ */
+    pSignals->IVT2_MsgCount_Result_As = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT2_ID_Result_As: 7|8@0+ */
+    pSignals->IVT2_ID_Result_As = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+}
+
+extern void CAN_PackIvt2MsgResultWh(const CAN_IVT2_MSG_RESULT_WH_SIGNALS_s *pSignals, uint8_t *pCanData) {
+    FAS_ASSERT(pSignals != NULL_PTR);
+    FAS_ASSERT(pCanData != NULL_PTR);
+    uint64_t messageBigEndian = 0u;
+
+    /* IVT2_Result_Wh_systemError: 15|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_Wh_systemError & 0x1u) << 55u;
+    /* IVT2_Result_Wh_OCS: 12|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_Wh_OCS & 0x1u) << 52u;
+    /* IVT2_Result_Wh_overallMeasError: 14|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_Wh_overallMeasError & 0x1u) << 54u;
+    /* IVT2_Result_Wh_channelMeasError: 13|1@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_Wh_channelMeasError & 0x1u) << 53u;
+    /* IVT2_Result_Wh: 23|32@0- */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_Result_Wh & 0xFFFFFFFFu) << 16u;
+    /* IVT2_MsgCount_Result_Wh: 11|4@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_MsgCount_Result_Wh & 0xFu) << 48u;
+    /* IVT2_ID_Result_Wh: 7|8@0+ */
+    messageBigEndian |= ((uint64_t)pSignals->IVT2_ID_Result_Wh & 0xFFu) << 56u;
+
+    pCanData[0] = (uint8_t)((messageBigEndian >> 56u));
+    pCanData[1] = (uint8_t)((messageBigEndian >> 48u));
+    pCanData[2] = (uint8_t)((messageBigEndian >> 40u));
+    pCanData[3] = (uint8_t)((messageBigEndian >> 32u));
+    pCanData[4] = (uint8_t)((messageBigEndian >> 24u));
+    pCanData[5] = (uint8_t)((messageBigEndian >> 16u));
+}
+
+extern void CAN_UnpackIvt2MsgResultWh(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_WH_SIGNALS_s *pSignals) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pSignals != NULL_PTR);
+    const uint64_t messageBigEndian =
+        ((uint64_t)pCanData[0] << 56u) |
+        ((uint64_t)pCanData[1] << 48u) |
+        ((uint64_t)pCanData[2] << 40u) |
+        ((uint64_t)pCanData[3] << 32u) |
+        ((uint64_t)pCanData[4] << 24u) |
+        ((uint64_t)pCanData[5] << 16u);
+
+    /* IVT2_Result_Wh_systemError: 15|1@0+ */
+    pSignals->IVT2_Result_Wh_systemError = (uint8_t)((messageBigEndian >> 55u) & 0x1u);
+    /* IVT2_Result_Wh_OCS: 12|1@0+ */
+    pSignals->IVT2_Result_Wh_OCS = (uint8_t)((messageBigEndian >> 52u) & 0x1u);
+    /* IVT2_Result_Wh_overallMeasError: 14|1@0+ */
+    pSignals->IVT2_Result_Wh_overallMeasError = (uint8_t)((messageBigEndian >> 54u) & 0x1u);
+    /* IVT2_Result_Wh_channelMeasError: 13|1@0+ */
+    pSignals->IVT2_Result_Wh_channelMeasError = (uint8_t)((messageBigEndian >> 53u) & 0x1u);
+    /* IVT2_Result_Wh: 23|32@0- */
+    pSignals->IVT2_Result_Wh =
+        (int32_t)(int64_t)((((messageBigEndian >> 16u) & 0xFFFFFFFFu) ^ 0x80000000u) - 0x80000000u);
+    /* IVT2_MsgCount_Result_Wh: 11|4@0+ */
+    pSignals->IVT2_MsgCount_Result_Wh = (uint8_t)((messageBigEndian >> 48u) & 0xFu);
+    /* IVT2_ID_Result_Wh: 7|8@0+ */
+    pSignals->IVT2_ID_Result_Wh = (uint8_t)((messageBigEndian >> 56u) & 0xFFu);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
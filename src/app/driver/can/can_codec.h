@@ -0,0 +1,1504 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    can_codec.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup DRIVERS
+ * @prefix  CAN
+ *
+ * @brief   Pack and unpack functions of the CAN messages
+ *
+ * @details This file is generated from tools/dbc/foxbms.dbc by
+ *          tools/dbc/can_codec_generator.py, do not edit it.
+ *          The structs hold the raw values of the signals. The physical
+ *          value of a scaled signal is
+ *          raw * FACTOR_NUMERATOR / FACTOR_DENOMINATOR + OFFSET.
+ *          The members of multiplexed messages are named after the signals
+ *          of multiplexer value 0, all multiplexer values have the same
+ *          layout.
+ *
+ */
+
+#ifndef FOXBMS__CAN_CODEC_H_
+#define FOXBMS__CAN_CODEC_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/** ID, DLC and scaling of foxBMS_PackValues @{ */
+#define CAN_FOXBMS_PACK_VALUES_ID (0x222u)
+#define CAN_FOXBMS_PACK_VALUES_DLC (8u)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_PACK_CURRENT_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_PACK_CURRENT_FACTOR_DENOMINATOR (100)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_PACK_CURRENT_OFFSET (0)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_BATTERY_VOLTAGE_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_BATTERY_VOLTAGE_FACTOR_DENOMINATOR (10)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_BATTERY_VOLTAGE_OFFSET (0)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_BUS_VOLTAGE_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_BUS_VOLTAGE_FACTOR_DENOMINATOR (10)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_BUS_VOLTAGE_OFFSET (0)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_PACK_POWER_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_PACK_POWER_FACTOR_DENOMINATOR (100)
+#define CAN_FOXBMS_PACK_VALUES_FOXBMS_PACK_POWER_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_LimitValues @{ */
+#define CAN_FOXBMS_LIMIT_VALUES_ID (0x224u)
+#define CAN_FOXBMS_LIMIT_VALUES_DLC (8u)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_CHARGE_CURRENT_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_CHARGE_CURRENT_FACTOR_DENOMINATOR (4)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_CHARGE_CURRENT_OFFSET (0)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_DISCHARGE_CURRENT_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_DISCHARGE_CURRENT_FACTOR_DENOMINATOR (4)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_DISCHARGE_CURRENT_OFFSET (0)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_CHARGE_POWER_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_CHARGE_POWER_FACTOR_DENOMINATOR (5)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_CHARGE_POWER_OFFSET (0)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_DISCHARGE_POWER_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_DISCHARGE_POWER_FACTOR_DENOMINATOR (10)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_DISCHARGE_POWER_OFFSET (0)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_BATTERY_VOLTAGE_FACTOR_NUMERATOR (4)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_BATTERY_VOLTAGE_FACTOR_DENOMINATOR (1)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MAX_BATTERY_VOLTAGE_OFFSET (0)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MIN_BATTERY_VOLTAGE_FACTOR_NUMERATOR (4)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MIN_BATTERY_VOLTAGE_FACTOR_DENOMINATOR (1)
+#define CAN_FOXBMS_LIMIT_VALUES_FOXBMS_MIN_BATTERY_VOLTAGE_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_MinimumMaximumValues @{ */
+#define CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_ID (0x223u)
+#define CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_DLC (8u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_StringValues @{ */
+#define CAN_FOXBMS_STRING_VALUES_ID (0x280u)
+#define CAN_FOXBMS_STRING_VALUES_DLC (8u)
+#define CAN_FOXBMS_STRING_VALUES_NUMBER_OF_MUX_VALUES (3u)
+#define CAN_FOXBMS_STRING_VALUES_FOXBMS_STRING0_CURRENT_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_VALUES_FOXBMS_STRING0_CURRENT_FACTOR_DENOMINATOR (100)
+#define CAN_FOXBMS_STRING_VALUES_FOXBMS_STRING0_CURRENT_OFFSET (0)
+#define CAN_FOXBMS_STRING_VALUES_FOXBMS_STRING0_VOLTAGE_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_VALUES_FOXBMS_STRING0_VOLTAGE_FACTOR_DENOMINATOR (100)
+#define CAN_FOXBMS_STRING_VALUES_FOXBMS_STRING0_VOLTAGE_OFFSET (0)
+#define CAN_FOXBMS_STRING_VALUES_FOXBMS_STRING0_POWER_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_VALUES_FOXBMS_STRING0_POWER_FACTOR_DENOMINATOR (100)
+#define CAN_FOXBMS_STRING_VALUES_FOXBMS_STRING0_POWER_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_StringValues2 @{ */
+#define CAN_FOXBMS_STRING_VALUES2_ID (0x283u)
+#define CAN_FOXBMS_STRING_VALUES2_DLC (8u)
+#define CAN_FOXBMS_STRING_VALUES2_NUMBER_OF_MUX_VALUES (3u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_PackStateEstimation @{ */
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_ID (0x225u)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_DLC (8u)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_SOC_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_SOC_FACTOR_DENOMINATOR (100)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_SOC_OFFSET (0)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_SOE_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_SOE_FACTOR_DENOMINATOR (100)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_SOE_OFFSET (0)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_ENERGY_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_ENERGY_FACTOR_DENOMINATOR (100)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_ENERGY_OFFSET (0)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_SOH_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_SOH_FACTOR_DENOMINATOR (40)
+#define CAN_FOXBMS_PACK_STATE_ESTIMATION_FOXBMS_PACK_SOH_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_CellVoltage @{ */
+#define CAN_FOXBMS_CELL_VOLTAGE_ID (0x240u)
+#define CAN_FOXBMS_CELL_VOLTAGE_DLC (8u)
+#define CAN_FOXBMS_CELL_VOLTAGE_NUMBER_OF_MUX_VALUES (54u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_CellTemperature @{ */
+#define CAN_FOXBMS_CELL_TEMPERATURE_ID (0x250u)
+#define CAN_FOXBMS_CELL_TEMPERATURE_DLC (8u)
+#define CAN_FOXBMS_CELL_TEMPERATURE_NUMBER_OF_MUX_VALUES (30u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_Command @{ */
+#define CAN_FOXBMS_COMMAND_ID (0x230u)
+#define CAN_FOXBMS_COMMAND_DLC (8u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_State @{ */
+#define CAN_FOXBMS_STATE_ID (0x220u)
+#define CAN_FOXBMS_STATE_DLC (8u)
+#define CAN_FOXBMS_STATE_FOXBMS_INSULATION_RESISTANCE_FACTOR_NUMERATOR (10)
+#define CAN_FOXBMS_STATE_FOXBMS_INSULATION_RESISTANCE_FACTOR_DENOMINATOR (1)
+#define CAN_FOXBMS_STATE_FOXBMS_INSULATION_RESISTANCE_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_StringState @{ */
+#define CAN_FOXBMS_STRING_STATE_ID (0x221u)
+#define CAN_FOXBMS_STRING_STATE_DLC (8u)
+#define CAN_FOXBMS_STRING_STATE_NUMBER_OF_MUX_VALUES (3u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_StringMinimumMaximumValues @{ */
+#define CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_ID (0x281u)
+#define CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_DLC (8u)
+#define CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_NUMBER_OF_MUX_VALUES (3u)
+#define CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_STRING0_MAXIMUM_CELL_TEMPERATURE_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_STRING0_MAXIMUM_CELL_TEMPERATURE_FACTOR_DENOMINATOR (2)
+#define CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_STRING0_MAXIMUM_CELL_TEMPERATURE_OFFSET (0)
+#define CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_STRING0_MINIMUM_CELL_TEMPERATURE_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_STRING0_MINIMUM_CELL_TEMPERATURE_FACTOR_DENOMINATOR (2)
+#define CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_STRING0_MINIMUM_CELL_TEMPERATURE_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_StringStateEstimation @{ */
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_ID (0x282u)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_DLC (8u)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_NUMBER_OF_MUX_VALUES (3u)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_MINIMUMSOC_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_MINIMUMSOC_FACTOR_DENOMINATOR (4)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_MINIMUMSOC_OFFSET (0)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_AVERAGESOC_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_AVERAGESOC_FACTOR_DENOMINATOR (4)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_AVERAGESOC_OFFSET (0)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_MAXIMUMSOC_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_MAXIMUMSOC_FACTOR_DENOMINATOR (4)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_MAXIMUMSOC_OFFSET (0)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_SOE_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_SOE_FACTOR_DENOMINATOR (4)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_SOE_OFFSET (0)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_ENERGY_WH_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_ENERGY_WH_FACTOR_DENOMINATOR (100)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_ENERGY_WH_OFFSET (0)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_SOH_FACTOR_NUMERATOR (1)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_SOH_FACTOR_DENOMINATOR (4)
+#define CAN_FOXBMS_STRING_STATE_ESTIMATION_STRING0_SOH_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_AlgorithmStatistics @{ */
+#define CAN_FOXBMS_ALGORITHM_STATISTICS_ID (0x210u)
+#define CAN_FOXBMS_ALGORITHM_STATISTICS_DLC (8u)
+#define CAN_FOXBMS_ALGORITHM_STATISTICS_NUMBER_OF_MUX_VALUES (8u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_ProfilingTimes @{ */
+#define CAN_FOXBMS_PROFILING_TIMES_ID (0x211u)
+#define CAN_FOXBMS_PROFILING_TIMES_DLC (8u)
+#define CAN_FOXBMS_PROFILING_TIMES_NUMBER_OF_MUX_VALUES (15u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_ProfilingHistogram @{ */
+#define CAN_FOXBMS_PROFILING_HISTOGRAM_ID (0x212u)
+#define CAN_FOXBMS_PROFILING_HISTOGRAM_DLC (8u)
+#define CAN_FOXBMS_PROFILING_HISTOGRAM_NUMBER_OF_MUX_VALUES (15u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_TimingViolation @{ */
+#define CAN_FOXBMS_TIMING_VIOLATION_ID (0x213u)
+#define CAN_FOXBMS_TIMING_VIOLATION_DLC (8u)
+#define CAN_FOXBMS_TIMING_VIOLATION_NUMBER_OF_MUX_VALUES (8u)
+/**@}*/
+
+/** ID, DLC and scaling of foxBMS_TimingViolationDurations @{ */
+#define CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_ID (0x214u)
+#define CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_DLC (8u)
+#define CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_NUMBER_OF_MUX_VALUES (8u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT0_Msg_Result_I @{ */
+#define CAN_IVT0_MSG_RESULT_I_ID (0x521u)
+#define CAN_IVT0_MSG_RESULT_I_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT0_Msg_Result_U1 @{ */
+#define CAN_IVT0_MSG_RESULT_U1_ID (0x522u)
+#define CAN_IVT0_MSG_RESULT_U1_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT0_Msg_Result_U2 @{ */
+#define CAN_IVT0_MSG_RESULT_U2_ID (0x523u)
+#define CAN_IVT0_MSG_RESULT_U2_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT0_Msg_Result_U3 @{ */
+#define CAN_IVT0_MSG_RESULT_U3_ID (0x524u)
+#define CAN_IVT0_MSG_RESULT_U3_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT0_Msg_Result_T @{ */
+#define CAN_IVT0_MSG_RESULT_T_ID (0x525u)
+#define CAN_IVT0_MSG_RESULT_T_DLC (6u)
+#define CAN_IVT0_MSG_RESULT_T_IVT0_RESULT_T_DDEGC_FACTOR_NUMERATOR (1)
+#define CAN_IVT0_MSG_RESULT_T_IVT0_RESULT_T_DDEGC_FACTOR_DENOMINATOR (10)
+#define CAN_IVT0_MSG_RESULT_T_IVT0_RESULT_T_DDEGC_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of IVT0_Msg_Result_W @{ */
+#define CAN_IVT0_MSG_RESULT_W_ID (0x526u)
+#define CAN_IVT0_MSG_RESULT_W_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT0_Msg_Result_As @{ */
+#define CAN_IVT0_MSG_RESULT_AS_ID (0x527u)
+#define CAN_IVT0_MSG_RESULT_AS_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT0_Msg_Result_Wh @{ */
+#define CAN_IVT0_MSG_RESULT_WH_ID (0x528u)
+#define CAN_IVT0_MSG_RESULT_WH_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT1_Msg_Result_I @{ */
+#define CAN_IVT1_MSG_RESULT_I_ID (0x621u)
+#define CAN_IVT1_MSG_RESULT_I_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT1_Msg_Result_U1 @{ */
+#define CAN_IVT1_MSG_RESULT_U1_ID (0x622u)
+#define CAN_IVT1_MSG_RESULT_U1_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT1_Msg_Result_U2 @{ */
+#define CAN_IVT1_MSG_RESULT_U2_ID (0x623u)
+#define CAN_IVT1_MSG_RESULT_U2_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT1_Msg_Result_U3 @{ */
+#define CAN_IVT1_MSG_RESULT_U3_ID (0x624u)
+#define CAN_IVT1_MSG_RESULT_U3_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT1_Msg_Result_T @{ */
+#define CAN_IVT1_MSG_RESULT_T_ID (0x625u)
+#define CAN_IVT1_MSG_RESULT_T_DLC (6u)
+#define CAN_IVT1_MSG_RESULT_T_IVT1_RESULT_T_DDEGC_FACTOR_NUMERATOR (1)
+#define CAN_IVT1_MSG_RESULT_T_IVT1_RESULT_T_DDEGC_FACTOR_DENOMINATOR (10)
+#define CAN_IVT1_MSG_RESULT_T_IVT1_RESULT_T_DDEGC_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of IVT1_Msg_Result_W @{ */
+#define CAN_IVT1_MSG_RESULT_W_ID (0x626u)
+#define CAN_IVT1_MSG_RESULT_W_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT1_Msg_Result_As @{ */
+#define CAN_IVT1_MSG_RESULT_AS_ID (0x627u)
+#define CAN_IVT1_MSG_RESULT_AS_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT1_Msg_Result_Wh @{ */
+#define CAN_IVT1_MSG_RESULT_WH_ID (0x628u)
+#define CAN_IVT1_MSG_RESULT_WH_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT2_Msg_Result_I @{ */
+#define CAN_IVT2_MSG_RESULT_I_ID (0x721u)
+#define CAN_IVT2_MSG_RESULT_I_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT2_Msg_Result_U1 @{ */
+#define CAN_IVT2_MSG_RESULT_U1_ID (0x722u)
+#define CAN_IVT2_MSG_RESULT_U1_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT2_Msg_Result_U2 @{ */
+#define CAN_IVT2_MSG_RESULT_U2_ID (0x723u)
+#define CAN_IVT2_MSG_RESULT_U2_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT2_Msg_Result_U3 @{ */
+#define CAN_IVT2_MSG_RESULT_U3_ID (0x724u)
+#define CAN_IVT2_MSG_RESULT_U3_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT2_Msg_Result_T @{ */
+#define CAN_IVT2_MSG_RESULT_T_ID (0x725u)
+#define CAN_IVT2_MSG_RESULT_T_DLC (6u)
+#define CAN_IVT2_MSG_RESULT_T_IVT2_RESULT_T_DDEGC_FACTOR_NUMERATOR (1)
+#define CAN_IVT2_MSG_RESULT_T_IVT2_RESULT_T_DDEGC_FACTOR_DENOMINATOR (10)
+#define CAN_IVT2_MSG_RESULT_T_IVT2_RESULT_T_DDEGC_OFFSET (0)
+/**@}*/
+
+/** ID, DLC and scaling of IVT2_Msg_Result_W @{ */
+#define CAN_IVT2_MSG_RESULT_W_ID (0x726u)
+#define CAN_IVT2_MSG_RESULT_W_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT2_Msg_Result_As @{ */
+#define CAN_IVT2_MSG_RESULT_AS_ID (0x727u)
+#define CAN_IVT2_MSG_RESULT_AS_DLC (6u)
+/**@}*/
+
+/** ID, DLC and scaling of IVT2_Msg_Result_Wh @{ */
+#define CAN_IVT2_MSG_RESULT_WH_ID (0x728u)
+#define CAN_IVT2_MSG_RESULT_WH_DLC (6u)
+/**@}*/
+
+/** raw signal values of foxBMS_PackValues */
+typedef struct CAN_FOXBMS_PACK_VALUES_SIGNALS {
+    int32_t foxBMS_packCurrent;     /*!< raw value, factor 0.01, unit A */
+    uint16_t foxBMS_batteryVoltage; /*!< raw value, factor 0.1, unit V */
+    uint16_t foxBMS_busVoltage;     /*!< raw value, factor 0.1, unit V */
+    int32_t foxBMS_packPower;       /*!< raw value, factor 0.01, unit kW */
+} CAN_FOXBMS_PACK_VALUES_SIGNALS_s;
+
+/** raw signal values of foxBMS_LimitValues */
+typedef struct CAN_FOXBMS_LIMIT_VALUES_SIGNALS {
+    uint16_t foxBMS_maxChargeCurrent;    /*!< raw value, factor 0.25, unit A */
+    uint16_t foxBMS_maxDischargeCurrent; /*!< raw value, factor 0.25, unit A */
+    uint16_t foxBMS_maxChargePower;      /*!< raw value, factor 0.2, unit kW */
+    uint16_t foxBMS_maxDischargePower;   /*!< raw value, factor 0.1, unit kW */
+    uint8_t foxBMS_maxBatteryVoltage;    /*!< raw value, factor 4, unit V */
+    uint8_t foxBMS_minBatteryVoltage;    /*!< raw value, factor 4, unit V */
+} CAN_FOXBMS_LIMIT_VALUES_SIGNALS_s;
+
+/** raw signal values of foxBMS_MinimumMaximumValues */
+typedef struct CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_SIGNALS {
+    uint16_t foxBMS_minimumCellVoltage; /*!< raw value, unit mV */
+    uint16_t foxBMS_maximumCellVoltage; /*!< raw value, unit mV */
+    int8_t foxBMS_maximumCellTemp;      /*!< raw value, unit degC */
+    int8_t foxBMS_minimumCellTemp;      /*!< raw value, unit degC */
+    int8_t foxBMS_inletTemperature;     /*!< raw value, unit degC */
+    int8_t foxBMS_outletTemperature;    /*!< raw value, unit degC */
+} CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_SIGNALS_s;
+
+/** raw signal values of foxBMS_StringValues */
+typedef struct CAN_FOXBMS_STRING_VALUES_SIGNALS {
+    uint8_t foxBMS_StringValues_Mux; /*!< multiplexer */
+    int32_t foxBMS_String0_current;  /*!< raw value, factor 0.01, unit A */
+    uint32_t foxBMS_String0_voltage; /*!< raw value, factor 0.01, unit V */
+    int32_t foxBMS_String0_power;    /*!< raw value, factor 0.01, unit kW */
+} CAN_FOXBMS_STRING_VALUES_SIGNALS_s;
+
+/** raw signal values of foxBMS_StringValues2 */
+typedef struct CAN_FOXBMS_STRING_VALUES2_SIGNALS {
+    uint8_t foxBMS_StringValues2_Mux; /*!< multiplexer */
+    int32_t String0_energyCount;      /*!< raw value, unit Wh */
+} CAN_FOXBMS_STRING_VALUES2_SIGNALS_s;
+
+/** raw signal values of foxBMS_PackStateEstimation */
+typedef struct CAN_FOXBMS_PACK_STATE_ESTIMATION_SIGNALS {
+    uint16_t foxBMS_packSoc;    /*!< raw value, factor 0.01, unit % */
+    uint16_t foxBMS_packSoe;    /*!< raw value, factor 0.01, unit % */
+    uint32_t foxBMS_packEnergy; /*!< raw value, factor 0.01, unit kWh */
+    uint16_t foxBMS_packSoh;    /*!< raw value, factor 0.025, unit % */
+} CAN_FOXBMS_PACK_STATE_ESTIMATION_SIGNALS_s;
+
+/** raw signal values of foxBMS_CellVoltage */
+typedef struct CAN_FOXBMS_CELL_VOLTAGE_SIGNALS {
+    uint8_t foxBMS_CellVoltage_Mux;    /*!< multiplexer */
+    uint8_t cellVoltage_0_invalidFlag; /*!< raw value */
+    uint8_t cellVoltage_1_invalidFlag; /*!< raw value */
+    uint8_t cellVoltage_2_invalidFlag; /*!< raw value */
+    uint8_t cellVoltage_3_invalidFlag; /*!< raw value */
+    uint16_t cellVoltage_0;            /*!< raw value, unit mV */
+    uint16_t cell_voltage_1;           /*!< raw value, unit mV */
+    uint16_t cell_voltage_2;           /*!< raw value, unit mV */
+    uint16_t cell_voltage_3;           /*!< raw value, unit mV */
+} CAN_FOXBMS_CELL_VOLTAGE_SIGNALS_s;
+
+/** raw signal values of foxBMS_CellTemperature */
+typedef struct CAN_FOXBMS_CELL_TEMPERATURE_SIGNALS {
+    uint8_t foxBMS_CellTemperature_Mux;    /*!< multiplexer */
+    uint8_t cellTemperature_0_invalidFlag; /*!< raw value */
+    uint8_t cellTemperature_1_invalidFlag; /*!< raw value */
+    uint8_t cellTemperature_2_invalidFlag; /*!< raw value */
+    uint8_t cellTemperature_3_invalidFlag; /*!< raw value */
+    uint8_t cellTemperature_4_invalidFlag; /*!< raw value */
+    uint8_t cellTemperature_5_invalidFlag; /*!< raw value */
+    int8_t cellTemperature_0;              /*!< raw value, unit degC */
+    int8_t cellTemperature_1;              /*!< raw value, unit degC */
+    int8_t cellTemperature_2;              /*!< raw value, unit degC */
+    int8_t cellTemperature_3;              /*!< raw value, unit degC */
+    int8_t cellTemperature_4;              /*!< raw value, unit degC */
+    int8_t cellTemperature_5;              /*!< raw value, unit degC */
+} CAN_FOXBMS_CELL_TEMPERATURE_SIGNALS_s;
+
+/** raw signal values of foxBMS_Command */
+typedef struct CAN_FOXBMS_COMMAND_SIGNALS {
+    uint8_t foxBMS_ModeRequest;          /*!< raw value */
+    uint8_t foxBMS_activateBalancing;    /*!< raw value */
+    uint8_t foxBMS_balancingThreshold;   /*!< raw value, unit mV */
+    uint8_t foxBMS_externallyPrecharged; /*!< raw value */
+    uint8_t foxBMS_resetFlags;           /*!< raw value */
+    uint8_t foxBMS_chargerConnected;     /*!< raw value */
+    uint8_t foxBMS_disableInsulationMon; /*!< raw value */
+    uint8_t foxBMS_heaterOverride_ON;    /*!< raw value */
+    uint8_t foxBMS_heaterOverride_OFF;   /*!< raw value */
+} CAN_FOXBMS_COMMAND_SIGNALS_s;
+
+/** raw signal values of foxBMS_State */
+typedef struct CAN_FOXBMS_STATE_SIGNALS {
+    uint8_t foxBMS_State;                   /*!< raw value */
+    uint8_t BMS_nrOfConnectedStrings;       /*!< raw value */
+    uint8_t foxBMS_generalError;            /*!< raw value */
+    uint8_t foxBMS_generalWarning;          /*!< raw value */
+    uint8_t foxBMS_Error_dieTemperatureMCU; /*!< raw value */
+    uint8_t foxBMS_Error_OvertempPCB;       /*!< raw value */
+    uint8_t foxBMS_Error_UndertempPCB;      /*!< raw value */
+    uint8_t foxBMS_Error_PrechargeVolt;     /*!< raw value */
+    uint8_t foxBMS_Error_PrechargeCurrent;  /*!< raw value */
+    uint8_t foxBMS_heaterState;             /*!< raw value */
+    uint8_t foxBMS_coolingState;            /*!< raw value */
+    uint8_t foxBMS_insulationMonitoring;    /*!< raw value */
+    uint8_t foxBMS_chargingComplete;        /*!< raw value */
+    uint8_t foxBMS_EmergencyShutoff;        /*!< raw value */
+    uint8_t foxBMS_MainFuseBlown;           /*!< raw value */
+    uint8_t foxBMS_insulationResistance;    /*!< raw value, factor 10, unit kOhm */
+    uint8_t foxBMS_Error_Interlock;         /*!< raw value */
+    uint8_t foxBMS_NrDeactivatedStrings;    /*!< raw value */
+} CAN_FOXBMS_STATE_SIGNALS_s;
+
+/** raw signal values of foxBMS_StringState */
+typedef struct CAN_FOXBMS_STRING_STATE_SIGNALS {
+    uint8_t foxBMS_StringState_Mux;           /*!< multiplexer */
+    uint8_t String0_stringConnected;          /*!< raw value */
+    uint8_t String0_balancing_active;         /*!< raw value */
+    uint8_t String0_Err_overtemp_charge;      /*!< raw value */
+    uint8_t String0_Err_undertemp_charge;     /*!< raw value */
+    uint8_t String0_Err_overtemp_discharge;   /*!< raw value */
+    uint8_t String0_Err_undertemp_discharge;  /*!< raw value */
+    uint8_t String0_Err_Overcurrent_charge;   /*!< raw value */
+    uint8_t String0_Err_Overcurre_discharge;  /*!< raw value */
+    uint8_t String0_Err_Overvoltage;          /*!< raw value */
+    uint8_t String0_Err_Undervoltage;         /*!< raw value */
+    uint8_t String0_Err_deep_discharge;       /*!< raw value */
+    uint8_t String0_Err_CS_currentMeas;       /*!< raw value */
+    uint8_t String0_Err_positiveContactor;    /*!< raw value */
+    uint8_t String0_Err_openWire;             /*!< raw value */
+    uint8_t String0_openWireNumber;           /*!< raw value */
+    uint8_t String0_Err_plaus_cell_volt;      /*!< raw value */
+    uint8_t String0_Err_plaus_cell_temp;      /*!< raw value */
+    uint8_t String0_Err_plaus_string_volt;    /*!< raw value */
+    uint8_t String0_Err_slave_hardware;       /*!< raw value */
+    uint8_t String0_Err_dsyChainPrim_Comm;    /*!< raw value */
+    uint8_t String0_Err_dsyChainPrim_CRC;     /*!< raw value */
+    uint8_t String0_Err_dsyChainRedun_Comm;   /*!< raw value */
+    uint8_t String0_Err_dsyChainRedun_CRC;    /*!< raw value */
+    uint8_t String0_Err_dsyPrim_voltMeasOor;  /*!< raw value */
+    uint8_t String0_Err_dsyRedun_voltMeasOor; /*!< raw value */
+    uint8_t String0_Err_dsyPrim_tempMeasOor;  /*!< raw value */
+    uint8_t String0_Err_dsyRedun_tempMeasOor; /*!< raw value */
+    uint8_t String0_Err_CS_coulombCountMeas;  /*!< raw value */
+    uint8_t String0_Err_CS_energyCountMeas;   /*!< raw value */
+    uint8_t String0_Err_plaus_volt_spread;    /*!< raw value */
+    uint8_t String0_Err_plaus_temp_spread;    /*!< raw value */
+    uint8_t String0_fuseBlown;                /*!< raw value */
+    uint8_t String0_Warning_overvoltage_MOL;  /*!< raw value */
+    uint8_t String0_Warning_undervoltage_MOL; /*!< raw value */
+    uint8_t String0_Wrng_chargeOverTemp_MOL;  /*!< raw value */
+    uint8_t String0_Wrng_dischrgOverTemp_MOL; /*!< raw value */
+    uint8_t String0_Wrng_chargeUnderTemp_MOL; /*!< raw value */
+    uint8_t String0_Wrng_dischrgUnderTmp_MOL; /*!< raw value */
+    uint8_t String0_Wrng_chargeOverCur_MOL;   /*!< raw value */
+    uint8_t String0_Wrng_dischargOverCur_MOL; /*!< raw value */
+    uint8_t String0_Wrng_chargeOverTemp_RSL;  /*!< raw value */
+    uint8_t String0_Wrng_chargeUnderTemp_RSL; /*!< raw value */
+    uint8_t String0_Wrng_dischrgOverTemp_RSL; /*!< raw value */
+    uint8_t String0_Wrng_dischrgUnderTmp_RSL; /*!< raw value */
+    uint8_t String0_Wrng_chargeOverCur_RSL;   /*!< raw value */
+    uint8_t String0_Wrng_dischargOverCur_RSL; /*!< raw value */
+    uint8_t String0_Wrng_overvoltage_RSL;     /*!< raw value */
+    uint8_t String0_Wrng_undervoltage_RSL;    /*!< raw value */
+    uint8_t String0_Err_negativeContactor;    /*!< raw value */
+    uint8_t String0_Err_CS_voltage1Meas;      /*!< raw value */
+    uint8_t String0_Err_CS_voltage2Meas;      /*!< raw value */
+    uint8_t String0_Err_CS_voltage3Meas;      /*!< raw value */
+} CAN_FOXBMS_STRING_STATE_SIGNALS_s;
+
+/** raw signal values of foxBMS_StringMinimumMaximumValues */
+typedef struct CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_SIGNALS {
+    uint8_t foxBMS_StringMinimumMaximumValues_Mux; /*!< multiplexer */
+    uint16_t String0_minimumCellVoltage;           /*!< raw value, unit mV */
+    uint16_t String0_maximumCellVoltage;           /*!< raw value, unit mV */
+    int16_t String0_maximumCellTemperature;        /*!< raw value, factor 0.5, unit degC */
+    int16_t String0_minimumCellTemperature;        /*!< raw value, factor 0.5, unit degC */
+} CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_SIGNALS_s;
+
+/** raw signal values of foxBMS_StringStateEstimation */
+typedef struct CAN_FOXBMS_STRING_STATE_ESTIMATION_SIGNALS {
+    uint8_t foxBMS_StringStateEstimation_Mux; /*!< multiplexer */
+    uint16_t String0_minimumSOC;              /*!< raw value, factor 0.25, unit % */
+    uint16_t String0_averageSOC;              /*!< raw value, factor 0.25, unit % */
+    uint8_t String0_maximumSOC;               /*!< raw value, factor 0.25, unit % */
+    uint16_t String0_SOE;                     /*!< raw value, factor 0.25, unit % */
+    uint16_t String0_Energy_Wh;               /*!< raw value, factor 0.01, unit kWh */
+    uint16_t String0_SOH;                     /*!< raw value, factor 0.25 */
+} CAN_FOXBMS_STRING_STATE_ESTIMATION_SIGNALS_s;
+
+/** raw signal values of foxBMS_AlgorithmStatistics */
+typedef struct CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS {
+    uint8_t foxBMS_AlgorithmStatistics_Mux; /*!< multiplexer */
+    uint16_t Algorithm0_averageTime;        /*!< raw value, unit us */
+    uint16_t Algorithm0_worstTime;          /*!< raw value, unit us */
+    uint16_t Algorithm0_overruns;           /*!< raw value */
+    uint8_t Algorithm0_state;               /*!< raw value */
+} CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS_s;
+
+/** raw signal values of foxBMS_ProfilingTimes */
+typedef struct CAN_FOXBMS_PROFILING_TIMES_SIGNALS {
+    uint8_t foxBMS_ProfilingTimes_Mux; /*!< multiplexer */
+    uint16_t Profile0_minimumTime;     /*!< raw value, unit us */
+    uint16_t Profile0_maximumTime;     /*!< raw value, unit us */
+    uint16_t Profile0_meanTime;        /*!< raw value, unit us */
+} CAN_FOXBMS_PROFILING_TIMES_SIGNALS_s;
+
+/** raw signal values of foxBMS_ProfilingHistogram */
+typedef struct CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS {
+    uint8_t foxBMS_ProfilingHistogram_Mux; /*!< multiplexer */
+    uint8_t Profile0_bucket0;              /*!< raw value, unit % */
+    uint8_t Profile0_bucket1;              /*!< raw value, unit % */
+    uint8_t Profile0_bucket2;              /*!< raw value, unit % */
+    uint8_t Profile0_bucket3;              /*!< raw value, unit % */
+    uint8_t Profile0_bucket4;              /*!< raw value, unit % */
+    uint8_t Profile0_bucket5;              /*!< raw value, unit % */
+    uint8_t Profile0_bucket6;              /*!< raw value, unit % */
+} CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS_s;
+
+/** raw signal values of foxBMS_TimingViolation */
+typedef struct CAN_FOXBMS_TIMING_VIOLATION_SIGNALS {
+    uint8_t foxBMS_TimingViolation_Mux; /*!< multiplexer */
+    uint8_t Violation0_taskId;          /*!< raw value */
+    uint32_t Violation0_timestamp;      /*!< raw value, unit ms */
+    uint16_t Violation0_jitter;         /*!< raw value, unit ms */
+} CAN_FOXBMS_TIMING_VIOLATION_SIGNALS_s;
+
+/** raw signal values of foxBMS_TimingViolationDurations */
+typedef struct CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS {
+    uint8_t foxBMS_TimingViolationDurations_Mux; /*!< multiplexer */
+    uint16_t Violation0_durationTask0;           /*!< raw value, unit ms */
+    uint16_t Violation0_durationTask1;           /*!< raw value, unit ms */
+    uint16_t Violation0_durationTask2;           /*!< raw value, unit ms */
+    uint16_t Violation0_durationTask3;           /*!< raw value, unit ms */
+    uint16_t Violation0_durationTask4;           /*!< raw value, unit ms */
+} CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS_s;
+
+/** raw signal values of IVT0_Msg_Result_I */
+typedef struct CAN_IVT0_MSG_RESULT_I_SIGNALS {
+    uint8_t IVT0_Result_I_systemError;      /*!< raw value */
+    uint8_t IVT0_Result_I_OCS;              /*!< raw value */
+    uint8_t IVT0_Result_I_overallMeasError; /*!< raw value */
+    uint8_t IVT0_Result_I_channelMeasError; /*!< raw value */
+    uint8_t IVT0_ID_Result_I;               /*!< raw value */
+    uint8_t IVT0_MsgCount_Result_I;         /*!< raw value */
+    int32_t IVT0_Result_I_mA;               /*!< raw value, unit mA */
+} CAN_IVT0_MSG_RESULT_I_SIGNALS_s;
+
+/** raw signal values of IVT0_Msg_Result_U1 */
+typedef struct CAN_IVT0_MSG_RESULT_U1_SIGNALS {
+    uint8_t IVT0_Result_U1_systemError;      /*!< raw value */
+    uint8_t IVT0_Result_U1_overallMeasError; /*!< raw value */
+    uint8_t IVT0_Result_U1_channelMeasError; /*!< raw value */
+    uint8_t IVT0_Result_U1_OCS;              /*!< raw value */
+    uint8_t IVT0_ID_Result_U1;               /*!< raw value */
+    uint8_t IVT0_MsgCount_Result_U1;         /*!< raw value */
+    int32_t IVT0_Result_U1_mV;               /*!< raw value, unit mV */
+} CAN_IVT0_MSG_RESULT_U1_SIGNALS_s;
+
+/** raw signal values of IVT0_Msg_Result_U2 */
+typedef struct CAN_IVT0_MSG_RESULT_U2_SIGNALS {
+    uint8_t IVT0_Result_U2_systemError;      /*!< raw value */
+    uint8_t IVT0_Result_U2_OCS;              /*!< raw value */
+    uint8_t IVT0_Result_U2_overallMeasError; /*!< raw value */
+    uint8_t IVT0_Result_U2_channelMeasError; /*!< raw value */
+    uint8_t IVT0_ID_Result_U2;               /*!< raw value */
+    uint8_t IVT0_MsgCount_Result_U2;         /*!< raw value */
+    int32_t IVT0_Result_U2_mV;               /*!< raw value, unit mV */
+} CAN_IVT0_MSG_RESULT_U2_SIGNALS_s;
+
+/** raw signal values of IVT0_Msg_Result_U3 */
+typedef struct CAN_IVT0_MSG_RESULT_U3_SIGNALS {
+    uint8_t IVT_Result_U3_systemError;      /*!< raw value */
+    uint8_t IVT_Result_U3_OCS;              /*!< raw value */
+    uint8_t IVT_Result_U3_overallMeasError; /*!< raw value */
+    uint8_t IVT_Result_U3_channelMeasError; /*!< raw value */
+    uint8_t IVT_ID_Result_U3;               /*!< raw value */
+    uint8_t IVT_MsgCount_Result_U3;         /*!< raw value */
+    int32_t IVT_Result_U3_mV;               /*!< raw value, unit mV */
+} CAN_IVT0_MSG_RESULT_U3_SIGNALS_s;
+
+/** raw signal values of IVT0_Msg_Result_T */
+typedef struct CAN_IVT0_MSG_RESULT_T_SIGNALS {
+    uint8_t IVT0_Result_T_systemError;      /*!< raw value */
+    uint8_t IVT0_Result_T_OCS;              /*!< raw value */
+    uint8_t IVT0_Result_T_overallMeasError; /*!< raw value */
+    uint8_t IVT0_Result_T_channelMeasError; /*!< raw value */
+    uint8_t IVT0_ID_Result_T;               /*!< raw value */
+    uint8_t IVT0_MsgCount_Result_T;         /*!< raw value */
+    int32_t IVT0_Result_T_ddegC;            /*!< raw value, factor 0.1, unit ddegCC */
+} CAN_IVT0_MSG_RESULT_T_SIGNALS_s;
+
+/** raw signal values of IVT0_Msg_Result_W */
+typedef struct CAN_IVT0_MSG_RESULT_W_SIGNALS {
+    uint8_t IVT0_Result_W_systemError;      /*!< raw value */
+    uint8_t IVT0_Result_W_OCS;              /*!< raw value */
+    uint8_t IVT0_Result_W_overallMeasError; /*!< raw value */
+    uint8_t IVT0_Result_W_channelMeasError; /*!< raw value */
+    int32_t IVT0_Result_W;                  /*!< raw value, unit W */
+    uint8_t IVT0_MsgCount_Result_W;         /*!< raw value */
+    uint8_t IVT0_ID_Result_W;               /*!< raw value */
+} CAN_IVT0_MSG_RESULT_W_SIGNALS_s;
+
+/** raw signal values of IVT0_Msg_Result_As */
+typedef struct CAN_IVT0_MSG_RESULT_AS_SIGNALS {
+    uint8_t IVT0_Result_As_systemError;      /*!< raw value */
+    uint8_t IVT0_Result_As_OCS;              /*!< raw value */
+    uint8_t IVT0_Result_As_overallMeasError; /*!< raw value */
+    uint8_t IVT0_Result_As_channelMeasError; /*!< raw value */
+    int32_t IVT0_Result_As;                  /*!< raw value, unit As */
+    uint8_t IVT0_MsgCount_Result_As;         /*!< raw value */
+    uint8_t IVT0_ID_Result_As;               /*!< raw value */
+} CAN_IVT0_MSG_RESULT_AS_SIGNALS_s;
+
+/** raw signal values of IVT0_Msg_Result_Wh */
+typedef struct CAN_IVT0_MSG_RESULT_WH_SIGNALS {
+    uint8_t IVT0_Result_Wh_systemError;      /*!< raw value */
+    uint8_t IVT0_Result_Wh_OCS;              /*!< raw value */
+    uint8_t IVT0_Result_Wh_overallMeasError; /*!< raw value */
+    uint8_t IVT0_Result_Wh_channelMeasError; /*!< raw value */
+    int32_t IVT0_Result_Wh;                  /*!< raw value, unit Wh */
+    uint8_t IVT0_MsgCount_Result_Wh;         /*!< raw value */
+    uint8_t IVT0_ID_Result_Wh;               /*!< raw value */
+} CAN_IVT0_MSG_RESULT_WH_SIGNALS_s;
+
+/** raw signal values of IVT1_Msg_Result_I */
+typedef struct CAN_IVT1_MSG_RESULT_I_SIGNALS {
+    uint8_t IVT1_Result_I_systemError;      /*!< raw value */
+    uint8_t IVT1_Result_I_OCS;              /*!< raw value */
+    uint8_t IVT1_Result_I_overallMeasError; /*!< raw value */
+    uint8_t IVT1_Result_I_channelMeasError; /*!< raw value */
+    uint8_t IVT1_ID_Result_I;               /*!< raw value */
+    uint8_t IVT1_MsgCount_Result_I;         /*!< raw value */
+    int32_t IVT1_Result_I_mA;               /*!< raw value, unit mA */
+} CAN_IVT1_MSG_RESULT_I_SIGNALS_s;
+
+/** raw signal values of IVT1_Msg_Result_U1 */
+typedef struct CAN_IVT1_MSG_RESULT_U1_SIGNALS {
+    uint8_t IVT1_Result_U1_systemError;      /*!< raw value */
+    uint8_t IVT1_Result_U1_overallMeasError; /*!< raw value */
+    uint8_t IVT1_Result_U1_channelMeasError; /*!< raw value */
+    uint8_t IVT1_Result_U1_OCS;              /*!< raw value */
+    uint8_t IVT1_ID_Result_U1;               /*!< raw value */
+    uint8_t IVT1_MsgCount_Result_U1;         /*!< raw value */
+    int32_t IVT1_Result_U1_mV;               /*!< raw value, unit mV */
+} CAN_IVT1_MSG_RESULT_U1_SIGNALS_s;
+
+/** raw signal values of IVT1_Msg_Result_U2 */
+typedef struct CAN_IVT1_MSG_RESULT_U2_SIGNALS {
+    uint8_t IVT1_Result_U2_systemError;      /*!< raw value */
+    uint8_t IVT1_Result_U2_OCS;              /*!< raw value */
+    uint8_t IVT1_Result_U2_overallMeasError; /*!< raw value */
+    uint8_t IVT1_Result_U2_channelMeasError; /*!< raw value */
+    uint8_t IVT1_ID_Result_U2;               /*!< raw value */
+    uint8_t IVT1_MsgCount_Result_U2;         /*!< raw value */
+    int32_t IVT1_Result_U2_mV;               /*!< raw value, unit mV */
+} CAN_IVT1_MSG_RESULT_U2_SIGNALS_s;
+
+/** raw signal values of IVT1_Msg_Result_U3 */
+typedef struct CAN_IVT1_MSG_RESULT_U3_SIGNALS {
+    uint8_t IVT_Result_U3_systemError;      /*!< raw value */
+    uint8_t IVT_Result_U3_OCS;              /*!< raw value */
+    uint8_t IVT_Result_U3_overallMeasError; /*!< raw value */
+    uint8_t IVT_Result_U3_channelMeasError; /*!< raw value */
+    uint8_t IVT_ID_Result_U3;               /*!< raw value */
+    uint8_t IVT_MsgCount_Result_U3;         /*!< raw value */
+    int32_t IVT_Result_U3_mV;               /*!< raw value, unit mV */
+} CAN_IVT1_MSG_RESULT_U3_SIGNALS_s;
+
+/** raw signal values of IVT1_Msg_Result_T */
+typedef struct CAN_IVT1_MSG_RESULT_T_SIGNALS {
+    uint8_t IVT1_Result_T_systemError;      /*!< raw value */
+    uint8_t IVT1_Result_T_OCS;              /*!< raw value */
+    uint8_t IVT1_Result_T_overallMeasError; /*!< raw value */
+    uint8_t IVT1_Result_T_channelMeasError; /*!< raw value */
+    uint8_t IVT1_ID_Result_T;               /*!< raw value */
+    uint8_t IVT1_MsgCount_Result_T;         /*!< raw value */
+    int32_t IVT1_Result_T_ddegC;            /*!< raw value, factor 0.1, unit ddegCC */
+} CAN_IVT1_MSG_RESULT_T_SIGNALS_s;
+
+/** raw signal values of IVT1_Msg_Result_W */
+typedef struct CAN_IVT1_MSG_RESULT_W_SIGNALS {
+    uint8_t IVT1_Result_W_systemError;      /*!< raw value */
+    uint8_t IVT1_Result_W_OCS;              /*!< raw value */
+    uint8_t IVT1_Result_W_overallMeasError; /*!< raw value */
+    uint8_t IVT1_Result_W_channelMeasError; /*!< raw value */
+    int32_t IVT1_Result_W;                  /*!< raw value, unit W */
+    uint8_t IVT1_MsgCount_Result_W;         /*!< raw value */
+    uint8_t IVT1_ID_Result_W;               /*!< raw value */
+} CAN_IVT1_MSG_RESULT_W_SIGNALS_s;
+
+/** raw signal values of IVT1_Msg_Result_As */
+typedef struct CAN_IVT1_MSG_RESULT_AS_SIGNALS {
+    uint8_t IVT1_Result_As_systemError;      /*!< raw value */
+    uint8_t IVT1_Result_As_OCS;              /*!< raw value */
+    uint8_t IVT1_Result_As_overallMeasError; /*!< raw value */
+    uint8_t IVT1_Result_As_channelMeasError; /*!< raw value */
+    int32_t IVT1_Result_As;                  /*!< raw value, unit As */
+    uint8_t IVT1_MsgCount_Result_As;         /*!< raw value */
+    uint8_t IVT1_ID_Result_As;               /*!< raw value */
+} CAN_IVT1_MSG_RESULT_AS_SIGNALS_s;
+
+/** raw signal values of IVT1_Msg_Result_Wh */
+typedef struct CAN_IVT1_MSG_RESULT_WH_SIGNALS {
+    uint8_t IVT1_Result_Wh_systemError;      /*!< raw value */
+    uint8_t IVT1_Result_Wh_OCS;              /*!< raw value */
+    uint8_t IVT1_Result_Wh_overallMeasError; /*!< raw value */
+    uint8_t IVT1_Result_Wh_channelMeasError; /*!< raw value */
+    int32_t IVT1_Result_Wh;                  /*!< raw value, unit Wh */
+    uint8_t IVT1_MsgCount_Result_Wh;         /*!< raw value */
+    uint8_t IVT1_ID_Result_Wh;               /*!< raw value */
+} CAN_IVT1_MSG_RESULT_WH_SIGNALS_s;
+
+/** raw signal values of IVT2_Msg_Result_I */
+typedef struct CAN_IVT2_MSG_RESULT_I_SIGNALS {
+    uint8_t IVT2_Result_I_systemError;      /*!< raw value */
+    uint8_t IVT2_Result_I_OCS;              /*!< raw value */
+    uint8_t IVT2_Result_I_overallMeasError; /*!< raw value */
+    uint8_t IVT2_Result_I_channelMeasError; /*!< raw value */
+    uint8_t IVT2_ID_Result_I;               /*!< raw value */
+    uint8_t IVT2_MsgCount_Result_I;         /*!< raw value */
+    int32_t IVT2_Result_I_mA;               /*!< raw value, unit mA */
+} CAN_IVT2_MSG_RESULT_I_SIGNALS_s;
+
+/** raw signal values of IVT2_Msg_Result_U1 */
+typedef struct CAN_IVT2_MSG_RESULT_U1_SIGNALS {
+    uint8_t IVT2_Result_U1_systemError;      /*!< raw value */
+    uint8_t IVT2_Result_U1_overallMeasError; /*!< raw value */
+    uint8_t IVT2_Result_U1_channelMeasError; /*!< raw value */
+    uint8_t IVT2_Result_U1_OCS;              /*!< raw value */
+    uint8_t IVT2_ID_Result_U1;               /*!< raw value */
+    uint8_t IVT2_MsgCount_Result_U1;         /*!< raw value */
+    int32_t IVT2_Result_U1_mV;               /*!< raw value, unit mV */
+} CAN_IVT2_MSG_RESULT_U1_SIGNALS_s;
+
+/** raw signal values of IVT2_Msg_Result_U2 */
+typedef struct CAN_IVT2_MSG_RESULT_U2_SIGNALS {
+    uint8_t IVT2_Result_U2_systemError;      /*!< raw value */
+    uint8_t IVT2_Result_U2_OCS;              /*!< raw value */
+    uint8_t IVT2_Result_U2_overallMeasError; /*!< raw value */
+    uint8_t IVT2_Result_U2_channelMeasError; /*!< raw value */
+    uint8_t IVT2_ID_Result_U2;               /*!< raw value */
+    uint8_t IVT2_MsgCount_Result_U2;         /*!< raw value */
+    int32_t IVT2_Result_U2_mV;               /*!< raw value, unit mV */
+} CAN_IVT2_MSG_RESULT_U2_SIGNALS_s;
+
+/** raw signal values of IVT2_Msg_Result_U3 */
+typedef struct CAN_IVT2_MSG_RESULT_U3_SIGNALS {
+    uint8_t IVT_Result_U3_systemError;      /*!< raw value */
+    uint8_t IVT_Result_U3_OCS;              /*!< raw value */
+    uint8_t IVT_Result_U3_overallMeasError; /*!< raw value */
+    uint8_t IVT_Result_U3_channelMeasError; /*!< raw value */
+    uint8_t IVT_ID_Result_U3;               /*!< raw value */
+    uint8_t IVT_MsgCount_Result_U3;         /*!< raw value */
+    int32_t IVT_Result_U3_mV;               /*!< raw value, unit mV */
+} CAN_IVT2_MSG_RESULT_U3_SIGNALS_s;
+
+/** raw signal values of IVT2_Msg_Result_T */
+typedef struct CAN_IVT2_MSG_RESULT_T_SIGNALS {
+    uint8_t IVT2_Result_T_systemError;      /*!< raw value */
+    uint8_t IVT2_Result_T_OCS;              /*!< raw value */
+    uint8_t IVT2_Result_T_overallMeasError; /*!< raw value */
+    uint8_t IVT2_Result_T_channelMeasError; /*!< raw value */
+    uint8_t IVT2_ID_Result_T;               /*!< raw value */
+    uint8_t IVT2_MsgCount_Result_T;         /*!< raw value */
+    int32_t IVT2_Result_T_ddegC;            /*!< raw value, factor 0.1, unit ddegC */
+} CAN_IVT2_MSG_RESULT_T_SIGNALS_s;
+
+/** raw signal values of IVT2_Msg_Result_W */
+typedef struct CAN_IVT2_MSG_RESULT_W_SIGNALS {
+    uint8_t IVT2_Result_W_systemError;      /*!< raw value */
+    uint8_t IVT2_Result_W_OCS;              /*!< raw value */
+    uint8_t IVT2_Result_W_overallMeasError; /*!< raw value */
+    uint8_t IVT2_Result_W_channelMeasError; /*!< raw value */
+    int32_t IVT2_Result_W;                  /*!< raw value, unit W */
+    uint8_t IVT2_MsgCount_Result_W;         /*!< raw value */
+    uint8_t IVT2_ID_Result_W;               /*!< raw value */
+} CAN_IVT2_MSG_RESULT_W_SIGNALS_s;
+
+/** raw signal values of IVT2_Msg_Result_As */
+typedef struct CAN_IVT2_MSG_RESULT_AS_SIGNALS {
+    uint8_t IVT2_Result_As_systemError;      /*!< raw value */
+    uint8_t IVT2_Result_As_OCS;              /*!< raw value */
+    uint8_t IVT2_Result_As_overallMeasError; /*!< raw value */
+    uint8_t IVT2_Result_As_channelMeasError; /*!< raw value */
+    int32_t IVT2_Result_As;                  /*!< raw value, unit As */
+    uint8_t IVT2_MsgCount_Result_As;         /*!< raw value */
+    uint8_t IVT2_ID_Result_As;               /*!< raw value */
+} CAN_IVT2_MSG_RESULT_AS_SIGNALS_s;
+
+/** raw signal values of IVT2_Msg_Result_Wh */
+typedef struct CAN_IVT2_MSG_RESULT_WH_SIGNALS {
+    uint8_t IVT2_Result_Wh_systemError;      /*!< raw value */
+    uint8_t IVT2_Result_Wh_OCS;              /*!< raw value */
+    uint8_t IVT2_Result_Wh_overallMeasError; /*!< raw value */
+    uint8_t IVT2_Result_Wh_channelMeasError; /*!< raw value */
+    int32_t IVT2_Result_Wh;                  /*!< raw value, unit Wh */
+    uint8_t IVT2_MsgCount_Result_Wh;         /*!< raw value */
+    uint8_t IVT2_ID_Result_Wh;               /*!< raw value */
+} CAN_IVT2_MSG_RESULT_WH_SIGNALS_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Packs the signals of foxBMS_PackValues into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsPackValues(const CAN_FOXBMS_PACK_VALUES_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_PackValues from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsPackValues(const uint8_t *pCanData, CAN_FOXBMS_PACK_VALUES_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_LimitValues into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsLimitValues(const CAN_FOXBMS_LIMIT_VALUES_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_LimitValues from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsLimitValues(const uint8_t *pCanData, CAN_FOXBMS_LIMIT_VALUES_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_MinimumMaximumValues into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsMinimumMaximumValues(
+    const CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_SIGNALS_s *pSignals,
+    uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_MinimumMaximumValues from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsMinimumMaximumValues(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_StringValues into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsStringValues(const CAN_FOXBMS_STRING_VALUES_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_StringValues from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsStringValues(const uint8_t *pCanData, CAN_FOXBMS_STRING_VALUES_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_StringValues2 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsStringValues2(const CAN_FOXBMS_STRING_VALUES2_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_StringValues2 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsStringValues2(const uint8_t *pCanData, CAN_FOXBMS_STRING_VALUES2_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_PackStateEstimation into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsPackStateEstimation(
+    const CAN_FOXBMS_PACK_STATE_ESTIMATION_SIGNALS_s *pSignals,
+    uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_PackStateEstimation from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsPackStateEstimation(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_PACK_STATE_ESTIMATION_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_CellVoltage into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsCellVoltage(const CAN_FOXBMS_CELL_VOLTAGE_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_CellVoltage from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsCellVoltage(const uint8_t *pCanData, CAN_FOXBMS_CELL_VOLTAGE_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_CellTemperature into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsCellTemperature(const CAN_FOXBMS_CELL_TEMPERATURE_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_CellTemperature from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsCellTemperature(const uint8_t *pCanData, CAN_FOXBMS_CELL_TEMPERATURE_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_Command into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsCommand(const CAN_FOXBMS_COMMAND_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_Command from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsCommand(const uint8_t *pCanData, CAN_FOXBMS_COMMAND_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_State into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsState(const CAN_FOXBMS_STATE_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_State from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsState(const uint8_t *pCanData, CAN_FOXBMS_STATE_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_StringState into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsStringState(const CAN_FOXBMS_STRING_STATE_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_StringState from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsStringState(const uint8_t *pCanData, CAN_FOXBMS_STRING_STATE_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_StringMinimumMaximumValues into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsStringMinimumMaximumValues(
+    const CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_SIGNALS_s *pSignals,
+    uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_StringMinimumMaximumValues from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsStringMinimumMaximumValues(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_StringStateEstimation into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsStringStateEstimation(
+    const CAN_FOXBMS_STRING_STATE_ESTIMATION_SIGNALS_s *pSignals,
+    uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_StringStateEstimation from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsStringStateEstimation(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_STRING_STATE_ESTIMATION_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_AlgorithmStatistics into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsAlgorithmStatistics(
+    const CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS_s *pSignals,
+    uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_AlgorithmStatistics from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsAlgorithmStatistics(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_ProfilingTimes into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsProfilingTimes(const CAN_FOXBMS_PROFILING_TIMES_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_ProfilingTimes from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsProfilingTimes(const uint8_t *pCanData, CAN_FOXBMS_PROFILING_TIMES_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_ProfilingHistogram into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsProfilingHistogram(
+    const CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS_s *pSignals,
+    uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_ProfilingHistogram from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsProfilingHistogram(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_TimingViolation into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsTimingViolation(const CAN_FOXBMS_TIMING_VIOLATION_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_TimingViolation from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsTimingViolation(const uint8_t *pCanData, CAN_FOXBMS_TIMING_VIOLATION_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of foxBMS_TimingViolationDurations into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 8 bytes are written
+ */
+extern void CAN_PackFoxbmsTimingViolationDurations(
+    const CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS_s *pSignals,
+    uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of foxBMS_TimingViolationDurations from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 8 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackFoxbmsTimingViolationDurations(
+    const uint8_t *pCanData,
+    CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT0_Msg_Result_I into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt0MsgResultI(const CAN_IVT0_MSG_RESULT_I_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT0_Msg_Result_I from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt0MsgResultI(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_I_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT0_Msg_Result_U1 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt0MsgResultU1(const CAN_IVT0_MSG_RESULT_U1_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT0_Msg_Result_U1 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt0MsgResultU1(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_U1_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT0_Msg_Result_U2 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt0MsgResultU2(const CAN_IVT0_MSG_RESULT_U2_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT0_Msg_Result_U2 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt0MsgResultU2(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_U2_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT0_Msg_Result_U3 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt0MsgResultU3(const CAN_IVT0_MSG_RESULT_U3_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT0_Msg_Result_U3 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt0MsgResultU3(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_U3_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT0_Msg_Result_T into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt0MsgResultT(const CAN_IVT0_MSG_RESULT_T_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT0_Msg_Result_T from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt0MsgResultT(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_T_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT0_Msg_Result_W into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt0MsgResultW(const CAN_IVT0_MSG_RESULT_W_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT0_Msg_Result_W from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt0MsgResultW(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_W_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT0_Msg_Result_As into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt0MsgResultAs(const CAN_IVT0_MSG_RESULT_AS_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT0_Msg_Result_As from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt0MsgResultAs(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_AS_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT0_Msg_Result_Wh into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt0MsgResultWh(const CAN_IVT0_MSG_RESULT_WH_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT0_Msg_Result_Wh from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt0MsgResultWh(const uint8_t *pCanData, CAN_IVT0_MSG_RESULT_WH_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT1_Msg_Result_I into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt1MsgResultI(const CAN_IVT1_MSG_RESULT_I_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT1_Msg_Result_I from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt1MsgResultI(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_I_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT1_Msg_Result_U1 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt1MsgResultU1(const CAN_IVT1_MSG_RESULT_U1_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT1_Msg_Result_U1 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt1MsgResultU1(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_U1_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT1_Msg_Result_U2 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt1MsgResultU2(const CAN_IVT1_MSG_RESULT_U2_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT1_Msg_Result_U2 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt1MsgResultU2(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_U2_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT1_Msg_Result_U3 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt1MsgResultU3(const CAN_IVT1_MSG_RESULT_U3_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT1_Msg_Result_U3 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt1MsgResultU3(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_U3_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT1_Msg_Result_T into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt1MsgResultT(const CAN_IVT1_MSG_RESULT_T_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT1_Msg_Result_T from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt1MsgResultT(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_T_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT1_Msg_Result_W into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt1MsgResultW(const CAN_IVT1_MSG_RESULT_W_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT1_Msg_Result_W from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt1MsgResultW(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_W_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT1_Msg_Result_As into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt1MsgResultAs(const CAN_IVT1_MSG_RESULT_AS_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT1_Msg_Result_As from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt1MsgResultAs(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_AS_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT1_Msg_Result_Wh into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt1MsgResultWh(const CAN_IVT1_MSG_RESULT_WH_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT1_Msg_Result_Wh from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt1MsgResultWh(const uint8_t *pCanData, CAN_IVT1_MSG_RESULT_WH_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT2_Msg_Result_I into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt2MsgResultI(const CAN_IVT2_MSG_RESULT_I_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT2_Msg_Result_I from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt2MsgResultI(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_I_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT2_Msg_Result_U1 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt2MsgResultU1(const CAN_IVT2_MSG_RESULT_U1_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT2_Msg_Result_U1 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt2MsgResultU1(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_U1_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT2_Msg_Result_U2 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt2MsgResultU2(const CAN_IVT2_MSG_RESULT_U2_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT2_Msg_Result_U2 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt2MsgResultU2(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_U2_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT2_Msg_Result_U3 into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt2MsgResultU3(const CAN_IVT2_MSG_RESULT_U3_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT2_Msg_Result_U3 from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt2MsgResultU3(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_U3_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT2_Msg_Result_T into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt2MsgResultT(const CAN_IVT2_MSG_RESULT_T_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT2_Msg_Result_T from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt2MsgResultT(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_T_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT2_Msg_Result_W into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt2MsgResultW(const CAN_IVT2_MSG_RESULT_W_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT2_Msg_Result_W from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt2MsgResultW(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_W_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT2_Msg_Result_As into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt2MsgResultAs(const CAN_IVT2_MSG_RESULT_AS_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT2_Msg_Result_As from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt2MsgResultAs(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_AS_SIGNALS_s *pSignals);
+
+/**
+ * @brief   Packs the signals of IVT2_Msg_Result_Wh into the CAN data.
+ * @param[in]   pSignals    raw signal values
+ * @param[out]  pCanData    CAN data, only the first 6 bytes are written
+ */
+extern void CAN_PackIvt2MsgResultWh(const CAN_IVT2_MSG_RESULT_WH_SIGNALS_s *pSignals, uint8_t *pCanData);
+
+/**
+ * @brief   Unpacks the signals of IVT2_Msg_Result_Wh from the CAN data.
+ * @param[in]   pCanData    CAN data, only the first 6 bytes are read
+ * @param[out]  pSignals    raw signal values
+ */
+extern void CAN_UnpackIvt2MsgResultWh(const uint8_t *pCanData, CAN_IVT2_MSG_RESULT_WH_SIGNALS_s *pSignals);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__CAN_CODEC_H_ */
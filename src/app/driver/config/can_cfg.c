@@ -58,12 +58,69 @@
 /*========== Includes =======================================================*/
 #include "can_cfg.h"
 
+#include "algorithm.h"
+#include "can.h"
+#include "can_codec.h"
 #include "database.h"
 #include "diag.h"
 #include "foxmath.h"
 #include "imd.h"
+#include "sys_mon.h"
 
 /*========== Macros and Definitions =========================================*/
+/* every task and section is transmitted with its own multiplexer value */
+static_assert(CAN_FOXBMS_PROFILING_TIMES_NUMBER_OF_MUX_VALUES == SYSM_NR_OF_PROFILES, "profiles missing in DBC file");
+static_assert(
+    CAN_FOXBMS_PROFILING_HISTOGRAM_NUMBER_OF_MUX_VALUES == SYSM_NR_OF_PROFILES,
+    "profiles missing in DBC file");
+static_assert(SYSM_PROFILE_NR_OF_BUCKETS == 7u, "histogram buckets do not match the DBC file");
+
+/* every recorded timing violation is transmitted with its own multiplexer value */
+static_assert(
+    CAN_FOXBMS_TIMING_VIOLATION_NUMBER_OF_MUX_VALUES == FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS,
+    "timing violations missing in DBC file");
+static_assert(
+    CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_NUMBER_OF_MUX_VALUES == FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS,
+    "timing violations missing in DBC file");
+static_assert(FRAM_SYS_MON_RECORD_NR_OF_TASKS == 5u, "task durations do not match the DBC file");
+
+/** identifier of the first message with cell voltages */
+#define CAN_CELL_VOLTAGES_FIRST_ID (0x110u)
+
+/** number of cell voltages in one message */
+#define CAN_CELL_VOLTAGES_PER_MESSAGE (6u)
+
+/** number of messages with cell voltages in the TX table */
+#define CAN_CELL_VOLTAGES_NR_OF_MESSAGES (9u)
+
+/* the messages with cell voltages transmit exactly the cells of all strings */
+static_assert(
+    (BS_NR_OF_STRINGS * BS_NR_OF_BAT_CELLS) <= (CAN_CELL_VOLTAGES_NR_OF_MESSAGES * CAN_CELL_VOLTAGES_PER_MESSAGE),
+    "messages with cell voltages missing");
+static_assert(
+    (BS_NR_OF_STRINGS * BS_NR_OF_BAT_CELLS) >
+        ((CAN_CELL_VOLTAGES_NR_OF_MESSAGES - 1u) * CAN_CELL_VOLTAGES_PER_MESSAGE),
+    "messages without cell voltages");
+
+/** commands of the debug message for the record of the timing violations @{ */
+#define CAN_DEBUG_COMMAND_READ_TIMING_VIOLATIONS  (0xB0u)
+#define CAN_DEBUG_COMMAND_CLEAR_TIMING_VIOLATIONS (0xB1u)
+/**@}*/
+
+/** maximum task duration that can be transmitted in a timing violation */
+#define CAN_TIMING_VIOLATION_MAXIMUM_DURATION_ms (1023u)
+
+/** offset between the CAN IDs of the current sensors of two strings */
+#define CAN_CURRENT_SENSOR_STRING_ID_OFFSET (0x100u)
+
+/** signals that all result messages of the current sensor have in common */
+typedef struct CAN_CURRENT_SENSOR_RESULT {
+    uint8_t overCurrent;      /*!< overcurrent detection (OCS) */
+    uint8_t channelMeasError; /*!< measurement error of the channel of this message */
+    uint8_t overallMeasError; /*!< measurement error of any channel */
+    uint8_t systemError;      /*!< system error of the current sensor */
+    int32_t value;            /*!< measured value */
+} CAN_CURRENT_SENSOR_RESULT_s;
 
 /*========== Static Function Prototypes =====================================*/
 
@@ -121,6 +178,36 @@ static void CAN_RxGetSignalDataFromMessageData(
  */
 static void CAN_RxGetMessageDataFromCanData(uint8_t *pCanData, uint64_t *pMessage);
 
+/**
+ * @brief   Unpacks a result message of the current sensor.
+ * The layout of the result messages is taken from the generated codecs of
+ * the DBC file. The sensors of all strings use the same layout, therefore
+ * the codecs of the first sensor are used.
+ * @param   string0Id  CAN ID of the message shifted to the ID range of the
+ *                     current sensor of the first string
+ * @param   pCanData   CAN data of the message
+ * @param   pResult    unpacked status and value
+ */
+static void CAN_RxGetCurrentSensorResult(
+    uint32_t string0Id,
+    const uint8_t *pCanData,
+    CAN_CURRENT_SENSOR_RESULT_s *pResult);
+
+/**
+ * @brief   Limits a value to the range of a 16 bit CAN signal.
+ * @param   value   value to be transmitted
+ * @return  value, or UINT16_MAX if the value does not fit into 16 bit
+ */
+static uint16_t CAN_LimitToUint16(uint64_t value);
+
+/**
+ * @brief   Sends the recorded timing violations of the system monitoring.
+ * @details Two messages are sent per violation, the multiplexer value is the
+ *          age of the violation, i.e., 0 for the newest one. The messages are
+ *          sent directly and not by the periodic schedule.
+ */
+static void CAN_TxTimingViolations(void);
+
 /** TX callback functions @{ */
 static uint32_t CAN_TxVoltage(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t *canData, uint32_t *pMuxId);
 static uint32_t CAN_TxPcbTemperature(
@@ -141,6 +228,26 @@ static uint32_t CAN_TxVoltageMinMax(
     CAN_byteOrder_e byteOrder,
     uint8_t *canData,
     uint32_t *pMuxId);
+static uint32_t CAN_TxAlgorithmStatistics(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *canData,
+    uint32_t *pMuxId);
+#if SYSM_PROFILING_ENABLED == true
+static uint32_t CAN_TxProfilingTimes(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *canData,
+    uint32_t *pMuxId);
+static uint32_t CAN_TxProfilingHistogram(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *canData,
+    uint32_t *pMuxId);
+#endif
 /** @} */
 
 /** RX callback functions @{ */
@@ -169,6 +276,15 @@ static uint32_t CAN_RxSwVersion(
 /** @} */
 
 /*========== Static Constant and Variable Definitions =======================*/
+/** multiplexer of the algorithm statistics message, i.e., the index of the next algorithm */
+static uint32_t can_algorithmStatisticsMux = 0u;
+
+#if SYSM_PROFILING_ENABLED == true
+/** multiplexers of the profiling messages, i.e., the index of the next profile @{ */
+static uint32_t can_profilingTimesMux     = 0u;
+static uint32_t can_profilingHistogramMux = 0u;
+/**@}*/
+#endif
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
@@ -181,6 +297,29 @@ const CAN_MSG_TX_TYPE_s can_txMessages[] = {
     {0x100, 8, 100, 0, littleEndian, &CAN_TxVoltageMinMax, NULL_PTR},   /*!< Min/Max voltages */
     {0x101, 8, 1000, 0, littleEndian, &CAN_TxPcbTemperature, NULL_PTR}, /*!< PCB temperature and open wire channels */
     {0x102, 8, 100, 0, littleEndian, &CAN_TxExternalTemperature, NULL_PTR}, /*!< External temperature */
+    {CAN_FOXBMS_ALGORITHM_STATISTICS_ID,
+     CAN_FOXBMS_ALGORITHM_STATISTICS_DLC,
+     1000,
+     50,
+     bigEndian,
+     &CAN_TxAlgorithmStatistics,
+     &can_algorithmStatisticsMux}, /*!< Algorithm execution times */
+#if SYSM_PROFILING_ENABLED == true
+    {CAN_FOXBMS_PROFILING_TIMES_ID,
+     CAN_FOXBMS_PROFILING_TIMES_DLC,
+     100,
+     60,
+     bigEndian,
+     &CAN_TxProfilingTimes,
+     &can_profilingTimesMux}, /*!< Task and section execution times */
+    {CAN_FOXBMS_PROFILING_HISTOGRAM_ID,
+     CAN_FOXBMS_PROFILING_HISTOGRAM_DLC,
+     100,
+     70,
+     bigEndian,
+     &CAN_TxProfilingHistogram,
+     &can_profilingHistogramMux}, /*!< Task and section execution time histograms */
+#endif
 
     {0x110, 8, 100, 0, littleEndian, &CAN_TxVoltage, NULL_PTR},  /*!< Cell voltages 0-5*/
     {0x111, 8, 100, 0, littleEndian, &CAN_TxVoltage, NULL_PTR},  /*!< Cell voltages 6-11*/
@@ -191,27 +330,6 @@ const CAN_MSG_TX_TYPE_s can_txMessages[] = {
     {0x116, 8, 100, 20, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 36-41*/
     {0x117, 8, 100, 20, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 42-47*/
     {0x118, 8, 100, 20, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 48-53*/
-    {0x119, 8, 100, 30, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 54-59*/
-    {0x11A, 8, 100, 30, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 60-65*/
-    {0x11B, 8, 100, 30, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 66-71*/
-    {0x11C, 8, 100, 40, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 72-77*/
-    {0x11D, 8, 100, 40, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 78-83*/
-    {0x11E, 8, 100, 40, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 84-89*/
-    {0x11F, 8, 100, 50, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 90-95*/
-    {0x120, 8, 100, 50, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 96-101*/
-    {0x121, 8, 100, 50, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 102-107*/
-    {0x122, 8, 100, 60, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 108-113*/
-    {0x123, 8, 100, 60, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 114-119*/
-    {0x124, 8, 100, 60, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 120-125*/
-    {0x125, 8, 100, 70, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 126-131*/
-    {0x126, 8, 100, 70, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 132-137*/
-    {0x127, 8, 100, 70, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 138-143*/
-    {0x128, 8, 100, 80, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 144-149*/
-    {0x129, 8, 100, 80, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 150-155*/
-    {0x12A, 8, 100, 80, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 156-161*/
-    {0x12B, 8, 100, 90, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 162-167*/
-    {0x12C, 8, 100, 90, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 168-173*/
-    {0x12D, 8, 100, 90, littleEndian, &CAN_TxVoltage, NULL_PTR}, /*!< Cell voltages 174-179*/
 };
 
 /* ***************************************
@@ -220,46 +338,46 @@ const CAN_MSG_TX_TYPE_s can_txMessages[] = {
 
 /** registry of CAN RX messages */
 const CAN_MSG_RX_TYPE_s can_rxMessages[] = {
-    {0x37, 8, 0, littleEndian, &CAN_RxImdInfo},     /*!< request SW version */
-    {0x23, 8, 0, littleEndian, &CAN_RxImdResponse}, /*!< request SW version */
+    {0x37, 8, 0, littleEndian, &CAN_RxImdInfo, CAN_RX_PRIORITY_LOW},     /*!< request SW version */
+    {0x23, 8, 0, littleEndian, &CAN_RxImdResponse, CAN_RX_PRIORITY_LOW}, /*!< request SW version */
 
-    {0x120, 8, 0, littleEndian, &CAN_RxRequest},                     /*!< state request      */
-    {CAN_ID_SOFTWARE_RESET_MSG, 8, 0, littleEndian, &CAN_RxSwReset}, /*!< software reset     */
+    {0x120, 8, 0, littleEndian, &CAN_RxRequest, CAN_RX_PRIORITY_HIGH},                     /*!< state request      */
+    {CAN_ID_SOFTWARE_RESET_MSG, 8, 0, littleEndian, &CAN_RxSwReset, CAN_RX_PRIORITY_HIGH}, /*!< software reset     */
 
-    {0x521u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor I in cyclic mode   */
-    {0x522u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor U1 in cyclic mode  */
-    {0x523u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor U2 in cyclic mode  */
-    {0x524u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor U3 in cyclic mode  */
-    {0x525u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor T in cyclic mode  */
-    {0x526u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor Power in cyclic mode  */
-    {0x527u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor C-C in cyclic mode  */
-    {0x528u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor E-C in cyclic mode  */
+    {0x521u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor I in cyclic mode   */
+    {0x522u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor U1 in cyclic mode  */
+    {0x523u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor U2 in cyclic mode  */
+    {0x524u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor U3 in cyclic mode  */
+    {0x525u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor T in cyclic mode  */
+    {0x526u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor Power in cyclic mode  */
+    {0x527u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor C-C in cyclic mode  */
+    {0x528u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor E-C in cyclic mode  */
 
 #if BS_NR_OF_STRINGS > 1u
-    {0x621u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor I in cyclic mode   */
-    {0x622u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor U1 in cyclic mode  */
-    {0x623u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor U2 in cyclic mode  */
-    {0x624u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor U3 in cyclic mode  */
-    {0x625u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor T in cyclic mode  */
-    {0x626u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor Power in cyclic mode  */
-    {0x627u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor C-C in cyclic mode  */
-    {0x628u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor E-C in cyclic mode  */
+    {0x621u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor I in cyclic mode   */
+    {0x622u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor U1 in cyclic mode  */
+    {0x623u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor U2 in cyclic mode  */
+    {0x624u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor U3 in cyclic mode  */
+    {0x625u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor T in cyclic mode  */
+    {0x626u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor Power in cyclic mode  */
+    {0x627u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor C-C in cyclic mode  */
+    {0x628u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor E-C in cyclic mode  */
 
 #if BS_NR_OF_STRINGS > 2u
-    {0x721u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor I in cyclic mode   */
-    {0x722u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor U1 in cyclic mode  */
-    {0x723u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor U2 in cyclic mode  */
-    {0x724u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor U3 in cyclic mode  */
-    {0x725u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor T in cyclic mode  */
-    {0x726u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor Power in cyclic mode  */
-    {0x727u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor C-C in cyclic mode  */
-    {0x728u, 8, 0, bigEndian, &CAN_RxCurrentSensor}, /*!< current sensor E-C in cyclic mode  */
+    {0x721u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor I in cyclic mode   */
+    {0x722u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor U1 in cyclic mode  */
+    {0x723u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor U2 in cyclic mode  */
+    {0x724u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor U3 in cyclic mode  */
+    {0x725u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor T in cyclic mode  */
+    {0x726u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor Power in cyclic mode  */
+    {0x727u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor C-C in cyclic mode  */
+    {0x728u, 8, 0, bigEndian, &CAN_RxCurrentSensor, CAN_RX_PRIORITY_HIGH}, /*!< current sensor E-C in cyclic mode  */
 
 #endif /* BS_NR_OF_STRINGS > 1 */
 #endif /* BS_NR_OF_STRINGS > 2 */
 
-    {0x100, 8, 0, littleEndian, &CAN_RxDebug},     /*!< debug message      */
-    {0x777, 8, 0, littleEndian, &CAN_RxSwVersion}, /*!< request SW version */
+    {0x100, 8, 0, littleEndian, &CAN_RxDebug, CAN_RX_PRIORITY_LOW},     /*!< debug message      */
+    {0x777, 8, 0, littleEndian, &CAN_RxSwVersion, CAN_RX_PRIORITY_LOW}, /*!< request SW version */
 };
 
 /** length of CAN message arrays @{*/
@@ -293,17 +411,27 @@ static uint32_t CAN_TxVoltage(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrde
     uint8_t bitLength = 0;
 
     /* first signal to transmit cell voltages */
-    if (id == 0x110u) {
-        DATA_READ_DATA(&can_tableCellVoltages);
+    if (id == CAN_CELL_VOLTAGES_FIRST_ID) {
+        /* the cell voltages of all strings are transmitted, the pack voltages are not needed */
+        DATA_READ_FIELD(
+            DATA_BLOCK_ID_CELL_VOLTAGE,
+            DATA_BLOCK_CELL_VOLTAGE_s,
+            cellVoltage_mV,
+            &can_tableCellVoltages.cellVoltage_mV);
     }
 
-    index     = id - 0x110u;
+    index     = id - CAN_CELL_VOLTAGES_FIRST_ID;
     bitLength = 10;
-    /* each voltage frame contains 6 voltages */
-    for (uint8_t i = 0u; i < 6u; i++) {
+    /* each voltage frame contains 6 voltages, the cells of the strings are transmitted one after another */
+    for (uint8_t i = 0u; i < CAN_CELL_VOLTAGES_PER_MESSAGE; i++) {
+        const uint32_t cell = (index * CAN_CELL_VOLTAGES_PER_MESSAGE) + i;
+        if (cell >= (BS_NR_OF_STRINGS * BS_NR_OF_BAT_CELLS)) {
+            /* the last message is not completely filled */
+            break;
+        }
         /* conversion from mV to V */
-        tmpVal = (can_tableCellVoltages.cellVoltage_mV[0][(index * 6u) + i]) /
-                 1000.0; /* TODO: string index to be added */
+        tmpVal = (can_tableCellVoltages.cellVoltage_mV[cell / BS_NR_OF_BAT_CELLS][cell % BS_NR_OF_BAT_CELLS]) /
+                 1000.0;
         /* apply offset and factor */
         offset = 2.5f;
         factor = 200.0f;
@@ -477,6 +605,126 @@ static uint32_t CAN_TxVoltageMinMax(
 
 #pragma diag_pop
 
+#pragma diag_push
+#pragma diag_suppress 880
+static uint32_t CAN_TxAlgorithmStatistics(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *canData,
+    uint32_t *pMuxId) {
+    FAS_ASSERT(canData != NULL_PTR);
+    FAS_ASSERT(pMuxId != NULL_PTR);
+
+    /* one algorithm per message, the multiplexer cycles over all algorithms */
+    if ((*pMuxId >= algo_length) || (*pMuxId >= CAN_FOXBMS_ALGORITHM_STATISTICS_NUMBER_OF_MUX_VALUES)) {
+        *pMuxId = 0u;
+    }
+    const uint16_t algorithmIndex = (uint16_t)*pMuxId;
+
+    ALGO_STATISTICS_s statistics = {0};
+    ALGO_GetStatistics(algorithmIndex, &statistics);
+    uint64_t averageExecutionTime_us = 0u;
+    if (statistics.nrOfRuns > 0u) {
+        averageExecutionTime_us = statistics.totalExecutionTime_us / statistics.nrOfRuns;
+    }
+
+    const CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS_s signals = {
+        .foxBMS_AlgorithmStatistics_Mux = (uint8_t)algorithmIndex,
+        .Algorithm0_averageTime         = CAN_LimitToUint16(averageExecutionTime_us),
+        .Algorithm0_worstTime           = CAN_LimitToUint16(statistics.worstExecutionTime_us),
+        .Algorithm0_overruns            = CAN_LimitToUint16(statistics.nrOfOverruns),
+        .Algorithm0_state               = (uint8_t)algo_algorithms[algorithmIndex].state,
+    };
+    CAN_PackFoxbmsAlgorithmStatistics(&signals, canData);
+
+    *pMuxId = *pMuxId + 1u;
+    return 0;
+}
+#pragma diag_pop
+
+#if SYSM_PROFILING_ENABLED == true
+#pragma diag_push
+#pragma diag_suppress 880
+static uint32_t CAN_TxProfilingTimes(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *canData,
+    uint32_t *pMuxId) {
+    FAS_ASSERT(canData != NULL_PTR);
+    FAS_ASSERT(pMuxId != NULL_PTR);
+
+    /* one task or section per message, the multiplexer cycles over all profiles */
+    if (*pMuxId >= CAN_FOXBMS_PROFILING_TIMES_NUMBER_OF_MUX_VALUES) {
+        *pMuxId = 0u;
+    }
+    const uint8_t profileIndex = (uint8_t)*pMuxId;
+
+    SYSM_PROFILE_s profile = {0};
+    SYSM_GetProfile(profileIndex, &profile);
+    uint64_t mean_us = 0u;
+    if (profile.count > 0u) {
+        mean_us = profile.total_us / profile.count;
+    }
+
+    const CAN_FOXBMS_PROFILING_TIMES_SIGNALS_s signals = {
+        .foxBMS_ProfilingTimes_Mux = profileIndex,
+        .Profile0_minimumTime      = CAN_LimitToUint16(profile.minimum_us),
+        .Profile0_maximumTime      = CAN_LimitToUint16(profile.maximum_us),
+        .Profile0_meanTime         = CAN_LimitToUint16(mean_us),
+    };
+    CAN_PackFoxbmsProfilingTimes(&signals, canData);
+
+    *pMuxId = *pMuxId + 1u;
+    return 0;
+}
+#pragma diag_pop
+
+#pragma diag_push
+#pragma diag_suppress 880
+static uint32_t CAN_TxProfilingHistogram(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *canData,
+    uint32_t *pMuxId) {
+    FAS_ASSERT(canData != NULL_PTR);
+    FAS_ASSERT(pMuxId != NULL_PTR);
+
+    if (*pMuxId >= CAN_FOXBMS_PROFILING_HISTOGRAM_NUMBER_OF_MUX_VALUES) {
+        *pMuxId = 0u;
+    }
+    const uint8_t profileIndex = (uint8_t)*pMuxId;
+
+    SYSM_PROFILE_s profile = {0};
+    SYSM_GetProfile(profileIndex, &profile);
+    /* the buckets are transmitted as share of all executions in percent */
+    uint8_t share_perc[SYSM_PROFILE_NR_OF_BUCKETS] = {0u};
+    if (profile.count > 0u) {
+        for (uint8_t bucket = 0u; bucket < SYSM_PROFILE_NR_OF_BUCKETS; bucket++) {
+            share_perc[bucket] = (uint8_t)(((uint64_t)profile.histogram[bucket] * 100u) / profile.count);
+        }
+    }
+
+    const CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS_s signals = {
+        .foxBMS_ProfilingHistogram_Mux = profileIndex,
+        .Profile0_bucket0              = share_perc[0],
+        .Profile0_bucket1              = share_perc[1],
+        .Profile0_bucket2              = share_perc[2],
+        .Profile0_bucket3              = share_perc[3],
+        .Profile0_bucket4              = share_perc[4],
+        .Profile0_bucket5              = share_perc[5],
+        .Profile0_bucket6              = share_perc[6],
+    };
+    CAN_PackFoxbmsProfilingHistogram(&signals, canData);
+
+    *pMuxId = *pMuxId + 1u;
+    return 0;
+}
+#pragma diag_pop
+#endif
+
 #pragma diag_push
 #pragma diag_suppress 880
 static uint32_t CAN_RxImdInfo(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t *canData, uint32_t *pMuxId) {
@@ -571,14 +819,9 @@ static uint32_t CAN_RxCurrentSensor(
     uint8_t *canData,
     uint32_t *pMuxId) {
     FAS_ASSERT(canData != NULL_PTR);
-    uint64_t message  = 0u;
-    uint64_t signal   = 0u;
-    uint64_t bitStart = 0u;
-    uint8_t bitLength = 0u;
-
-    int32_t tempValue    = 0;
-    uint8_t dummy        = 0u;
-    uint8_t stringNumber = 0;
+    CAN_CURRENT_SENSOR_RESULT_s result = {0};
+    int32_t tempValue                  = 0;
+    uint8_t stringNumber               = 0;
 
     /* IDs are used as follows:
        - String 0:  0x521 - 0x528
@@ -591,43 +834,37 @@ static uint32_t CAN_RxCurrentSensor(
     } else {
         stringNumber = 2u;
     }
+    const uint32_t string0Id = id - (stringNumber * CAN_CURRENT_SENSOR_STRING_ID_OFFSET);
 
-    CAN_RxGetMessageDataFromCanData(canData, &message);
+    CAN_RxGetCurrentSensorResult(string0Id, canData, &result);
 
-    /* Get status*/
-    bitStart  = 0;
-    bitLength = 8;
-    CAN_RxGetSignalDataFromMessageData(message, bitStart, bitLength, &signal, byteOrder);
-
-    dummy = (uint32_t)signal;
-    dummy &= 0xF0u; /* only high nibble contains diag info */
-    if ((dummy & 0x10u) == 0x10u) {
+    if (result.overCurrent == 1u) {
         /* Overcurrent detected. This feature is currently not supported. */
     }
-    if ((dummy & 0x20u) == 0x20u) {
-        switch (id) {
-            case 0x521u: /* Current status */
+    if (result.channelMeasError == 1u) {
+        switch (string0Id) {
+            case CAN_IVT0_MSG_RESULT_I_ID: /* Current status */
                 can_tableCurrentSensor.invalidCurrentMeasurement[stringNumber] = 1;
                 break;
-            case 0x522u: /* Voltage status */
+            case CAN_IVT0_MSG_RESULT_U1_ID: /* Voltage status */
                 can_tableCurrentSensor.invalidHighVoltageMeasurement[stringNumber][0] = 1;
                 break;
-            case 0x523u:
+            case CAN_IVT0_MSG_RESULT_U2_ID:
                 can_tableCurrentSensor.invalidHighVoltageMeasurement[stringNumber][1] = 1;
                 break;
-            case 0x524u:
+            case CAN_IVT0_MSG_RESULT_U3_ID:
                 can_tableCurrentSensor.invalidHighVoltageMeasurement[stringNumber][2] = 1;
                 break;
-            case 0x525u: /* Temperature status */
+            case CAN_IVT0_MSG_RESULT_T_ID: /* Temperature status */
                 can_tableCurrentSensor.invalidSensorTemperatureMeasurement[stringNumber] = 1;
                 break;
-            case 0x526u: /* Power status */
+            case CAN_IVT0_MSG_RESULT_W_ID: /* Power status */
                 can_tableCurrentSensor.invalidPowerMeasurement[stringNumber] = 1;
                 break;
-            case 0x527u: /* CC status */
+            case CAN_IVT0_MSG_RESULT_AS_ID: /* CC status */
                 can_tableCurrentSensor.invalidCurrentCountingMeasurement[stringNumber] = 1;
                 break;
-            case 0x528u: /* EC status */
+            case CAN_IVT0_MSG_RESULT_WH_ID: /* EC status */
                 can_tableCurrentSensor.invalidEnergyCountingMeasurement[stringNumber] = 1;
                 break;
             default:
@@ -644,7 +881,7 @@ static uint32_t CAN_RxCurrentSensor(
         can_tableCurrentSensor.invalidEnergyCountingMeasurement[stringNumber]    = 0;
     }
 
-    if (((dummy & 0x40u) == 0x40u) || ((dummy & 0x80u) == 0x80u)) {
+    if ((result.overallMeasError == 1u) || (result.systemError == 1u)) {
         can_tableCurrentSensor.invalidCurrentMeasurement[stringNumber]           = 1;
         can_tableCurrentSensor.invalidHighVoltageMeasurement[stringNumber][0]    = 1;
         can_tableCurrentSensor.invalidHighVoltageMeasurement[stringNumber][1]    = 1;
@@ -656,15 +893,12 @@ static uint32_t CAN_RxCurrentSensor(
     }
 
     /* Get measurement */
-    bitStart  = 16;
-    bitLength = 32;
-    CAN_RxGetSignalDataFromMessageData(message, bitStart, bitLength, &signal, byteOrder);
+    tempValue = result.value;
     switch (id) {
         /* Current measurement */
         case 0x521u:
         case 0x621u:
         case 0x721u:
-            tempValue                                       = (int32_t)signal;
             can_tableCurrentSensor.current_mA[stringNumber] = tempValue;
             can_tableCurrentSensor.newCurrent++;
             can_tableCurrentSensor.previousTimestampCurrent[stringNumber] =
@@ -675,7 +909,6 @@ static uint32_t CAN_RxCurrentSensor(
         case 0x522u:
         case 0x622u:
         case 0x722u:
-            tempValue                                              = (int32_t)signal;
             can_tableCurrentSensor.highVoltage_mV[stringNumber][0] = tempValue;
             can_tableCurrentSensor.previousTimestampHighVoltage[stringNumber][0] =
                 can_tableCurrentSensor.timestampHighVoltage[stringNumber][0];
@@ -685,7 +918,6 @@ static uint32_t CAN_RxCurrentSensor(
         case 0x523u:
         case 0x623u:
         case 0x723u:
-            tempValue                                              = (int32_t)signal;
             can_tableCurrentSensor.highVoltage_mV[stringNumber][1] = tempValue;
             can_tableCurrentSensor.previousTimestampHighVoltage[stringNumber][1] =
                 can_tableCurrentSensor.timestampHighVoltage[stringNumber][1];
@@ -695,7 +927,6 @@ static uint32_t CAN_RxCurrentSensor(
         case 0x524u:
         case 0x624u:
         case 0x724u:
-            tempValue                                              = (int32_t)signal;
             can_tableCurrentSensor.highVoltage_mV[stringNumber][2] = tempValue;
             can_tableCurrentSensor.previousTimestampHighVoltage[stringNumber][2] =
                 can_tableCurrentSensor.timestampHighVoltage[stringNumber][2];
@@ -705,14 +936,12 @@ static uint32_t CAN_RxCurrentSensor(
         case 0x525u:
         case 0x625u:
         case 0x725u:
-            tempValue                                                    = (int32_t)signal;
             can_tableCurrentSensor.sensorTemperature_ddegC[stringNumber] = tempValue;
             break;
         /* Power measurement */
         case 0x526u:
         case 0x626u:
         case 0x726u:
-            tempValue                                    = (int32_t)signal;
             can_tableCurrentSensor.power_W[stringNumber] = tempValue;
             can_tableCurrentSensor.newPower++;
             can_tableCurrentSensor.previousTimestampPower[stringNumber] =
@@ -723,7 +952,6 @@ static uint32_t CAN_RxCurrentSensor(
         case 0x527u:
         case 0x627u:
         case 0x727u:
-            tempValue = (int32_t)signal;
             can_tableCurrentSensor.previousTimestampCurrentCounting[stringNumber] =
                 can_tableCurrentSensor.timestampCurrentCounting[stringNumber];
             can_tableCurrentSensor.timestampCurrentCounting[stringNumber] = OS_GetTickCount();
@@ -733,7 +961,6 @@ static uint32_t CAN_RxCurrentSensor(
         case 0x528u:
         case 0x628u:
         case 0x728u:
-            tempValue                                             = (int32_t)signal;
             can_tableCurrentSensor.energyCounter_Wh[stringNumber] = tempValue;
             can_tableCurrentSensor.previousTimestampEnergyCounting[stringNumber] =
                 can_tableCurrentSensor.timestampEnergyCounting[stringNumber];
@@ -772,6 +999,12 @@ static uint32_t CAN_RxDebug(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder,
                 DIAG_Handler(DIAG_ID_DEEP_DISCHARGE_DETECTED, DIAG_EVENT_OK, DIAG_STRING, stringNumber);
             }
             break;
+        case CAN_DEBUG_COMMAND_READ_TIMING_VIOLATIONS:
+            CAN_TxTimingViolations();
+            break;
+        case CAN_DEBUG_COMMAND_CLEAR_TIMING_VIOLATIONS:
+            SYSM_ClearViolationRecord();
+            break;
 
         default:
             break;
@@ -891,6 +1124,136 @@ static void CAN_RxGetMessageDataFromCanData(uint8_t *pCanData, uint64_t *pMessag
                 ((((uint64_t)pCanData[6]) & 0xFFu) << 48u) | ((((uint64_t)pCanData[7]) & 0xFFu) << 56u);
 }
 
+static void CAN_RxGetCurrentSensorResult(
+    uint32_t string0Id,
+    const uint8_t *pCanData,
+    CAN_CURRENT_SENSOR_RESULT_s *pResult) {
+    FAS_ASSERT(pCanData != NULL_PTR);
+    FAS_ASSERT(pResult != NULL_PTR);
+    CAN_IVT0_MSG_RESULT_I_SIGNALS_s current         = {0};
+    CAN_IVT0_MSG_RESULT_U1_SIGNALS_s voltage1       = {0};
+    CAN_IVT0_MSG_RESULT_U2_SIGNALS_s voltage2       = {0};
+    CAN_IVT0_MSG_RESULT_U3_SIGNALS_s voltage3       = {0};
+    CAN_IVT0_MSG_RESULT_T_SIGNALS_s temperature     = {0};
+    CAN_IVT0_MSG_RESULT_W_SIGNALS_s power           = {0};
+    CAN_IVT0_MSG_RESULT_AS_SIGNALS_s currentCounter = {0};
+    CAN_IVT0_MSG_RESULT_WH_SIGNALS_s energyCounter  = {0};
+
+    switch (string0Id) {
+        case CAN_IVT0_MSG_RESULT_I_ID:
+            CAN_UnpackIvt0MsgResultI(pCanData, &current);
+            pResult->overCurrent      = current.IVT0_Result_I_OCS;
+            pResult->channelMeasError = current.IVT0_Result_I_channelMeasError;
+            pResult->overallMeasError = current.IVT0_Result_I_overallMeasError;
+            pResult->systemError      = current.IVT0_Result_I_systemError;
+            pResult->value            = current.IVT0_Result_I_mA;
+            break;
+        case CAN_IVT0_MSG_RESULT_U1_ID:
+            CAN_UnpackIvt0MsgResultU1(pCanData, &voltage1);
+            pResult->overCurrent      = voltage1.IVT0_Result_U1_OCS;
+            pResult->channelMeasError = voltage1.IVT0_Result_U1_channelMeasError;
+            pResult->overallMeasError = voltage1.IVT0_Result_U1_overallMeasError;
+            pResult->systemError      = voltage1.IVT0_Result_U1_systemError;
+            pResult->value            = voltage1.IVT0_Result_U1_mV;
+            break;
+        case CAN_IVT0_MSG_RESULT_U2_ID:
+            CAN_UnpackIvt0MsgResultU2(pCanData, &voltage2);
+            pResult->overCurrent      = voltage2.IVT0_Result_U2_OCS;
+            pResult->channelMeasError = voltage2.IVT0_Result_U2_channelMeasError;
+            pResult->overallMeasError = voltage2.IVT0_Result_U2_overallMeasError;
+            pResult->systemError      = voltage2.IVT0_Result_U2_systemError;
+            pResult->value            = voltage2.IVT0_Result_U2_mV;
+            break;
+        case CAN_IVT0_MSG_RESULT_U3_ID:
+            CAN_UnpackIvt0MsgResultU3(pCanData, &voltage3);
+            pResult->overCurrent      = voltage3.IVT_Result_U3_OCS;
+            pResult->channelMeasError = voltage3.IVT_Result_U3_channelMeasError;
+            pResult->overallMeasError = voltage3.IVT_Result_U3_overallMeasError;
+            pResult->systemError      = voltage3.IVT_Result_U3_systemError;
+            pResult->value            = voltage3.IVT_Result_U3_mV;
+            break;
+        case CAN_IVT0_MSG_RESULT_T_ID:
+            CAN_UnpackIvt0MsgResultT(pCanData, &temperature);
+            pResult->overCurrent      = temperature.IVT0_Result_T_OCS;
+            pResult->channelMeasError = temperature.IVT0_Result_T_channelMeasError;
+            pResult->overallMeasError = temperature.IVT0_Result_T_overallMeasError;
+            pResult->systemError      = temperature.IVT0_Result_T_systemError;
+            pResult->value            = temperature.IVT0_Result_T_ddegC;
+            break;
+        case CAN_IVT0_MSG_RESULT_W_ID:
+            CAN_UnpackIvt0MsgResultW(pCanData, &power);
+            pResult->overCurrent      = power.IVT0_Result_W_OCS;
+            pResult->channelMeasError = power.IVT0_Result_W_channelMeasError;
+            pResult->overallMeasError = power.IVT0_Result_W_overallMeasError;
+            pResult->systemError      = power.IVT0_Result_W_systemError;
+            pResult->value            = power.IVT0_Result_W;
+            break;
+        case CAN_IVT0_MSG_RESULT_AS_ID:
+            CAN_UnpackIvt0MsgResultAs(pCanData, &currentCounter);
+            pResult->overCurrent      = currentCounter.IVT0_Result_As_OCS;
+            pResult->channelMeasError = currentCounter.IVT0_Result_As_channelMeasError;
+            pResult->overallMeasError = currentCounter.IVT0_Result_As_overallMeasError;
+            pResult->systemError      = currentCounter.IVT0_Result_As_systemError;
+            pResult->value            = currentCounter.IVT0_Result_As;
+            break;
+        case CAN_IVT0_MSG_RESULT_WH_ID:
+            CAN_UnpackIvt0MsgResultWh(pCanData, &energyCounter);
+            pResult->overCurrent      = energyCounter.IVT0_Result_Wh_OCS;
+            pResult->channelMeasError = energyCounter.IVT0_Result_Wh_channelMeasError;
+            pResult->overallMeasError = energyCounter.IVT0_Result_Wh_overallMeasError;
+            pResult->systemError      = energyCounter.IVT0_Result_Wh_systemError;
+            pResult->value            = energyCounter.IVT0_Result_Wh;
+            break;
+        default:
+            FAS_ASSERT(FAS_TRAP);
+            break;
+    }
+}
+
+static uint16_t CAN_LimitToUint16(uint64_t value) {
+    uint16_t limitedValue = UINT16_MAX;
+    if (value < UINT16_MAX) {
+        limitedValue = (uint16_t)value;
+    }
+    return limitedValue;
+}
+
+static void CAN_TxTimingViolations(void) {
+    for (uint8_t age = 0u; age < FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS; age++) {
+        FRAM_SYS_MON_VIOLATION_s violation = {0};
+        if (SYSM_GetRecordedViolation(age, &violation) == true) {
+            uint8_t data[CAN_MAX_DLC] = {0u};
+
+            const CAN_FOXBMS_TIMING_VIOLATION_SIGNALS_s signals = {
+                .foxBMS_TimingViolation_Mux = age,
+                .Violation0_taskId          = violation.taskId,
+                .Violation0_timestamp       = violation.timestamp_ms,
+                .Violation0_jitter          = violation.jitter_ms,
+            };
+            CAN_PackFoxbmsTimingViolation(&signals, data);
+            (void)CAN_DataSend(CAN0_NODE, CAN_FOXBMS_TIMING_VIOLATION_ID, data);
+
+            uint16_t durations_ms[FRAM_SYS_MON_RECORD_NR_OF_TASKS] = {0u};
+            for (uint8_t task = 0u; task < FRAM_SYS_MON_RECORD_NR_OF_TASKS; task++) {
+                durations_ms[task] = violation.taskDurations_ms[task];
+                if (durations_ms[task] > CAN_TIMING_VIOLATION_MAXIMUM_DURATION_ms) {
+                    durations_ms[task] = CAN_TIMING_VIOLATION_MAXIMUM_DURATION_ms;
+                }
+            }
+            const CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS_s durations = {
+                .foxBMS_TimingViolationDurations_Mux = age,
+                .Violation0_durationTask0            = durations_ms[0],
+                .Violation0_durationTask1            = durations_ms[1],
+                .Violation0_durationTask2            = durations_ms[2],
+                .Violation0_durationTask3            = durations_ms[3],
+                .Violation0_durationTask4            = durations_ms[4],
+            };
+            CAN_PackFoxbmsTimingViolationDurations(&durations, data);
+            (void)CAN_DataSend(CAN0_NODE, CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_ID, data);
+        }
+    }
+}
+
 /*========== Extern Function Implementations ================================*/
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -932,6 +1295,30 @@ extern uint32_t TEST_CAN_TxVoltageMinMax(
     uint32_t *pMuxId) {
     return CAN_TxVoltageMinMax(id, dlc, byteOrder, pCanData, pMuxId);
 }
+extern uint32_t TEST_CAN_TxAlgorithmStatistics(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *pCanData,
+    uint32_t *pMuxId) {
+    return CAN_TxAlgorithmStatistics(id, dlc, byteOrder, pCanData, pMuxId);
+}
+extern uint32_t TEST_CAN_TxProfilingTimes(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *pCanData,
+    uint32_t *pMuxId) {
+    return CAN_TxProfilingTimes(id, dlc, byteOrder, pCanData, pMuxId);
+}
+extern uint32_t TEST_CAN_TxProfilingHistogram(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *pCanData,
+    uint32_t *pMuxId) {
+    return CAN_TxProfilingHistogram(id, dlc, byteOrder, pCanData, pMuxId);
+}
 
 /* RX callback functions */
 extern uint32_t TEST_CAN_RxRequest(
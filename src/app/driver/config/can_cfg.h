@@ -94,12 +94,27 @@ typedef struct CAN_BUFFERELEMENT {
 /** delay in &micro;s used in #CAN_InitializeTransceiver for pin-toggling */
 #define CAN_PIN_TOGGLE_DELAY_US (5u)
 
+/** bitrate of CAN node 0 in kbit/s, has to match the HALCoGen configuration */
+#define CAN_NODE0_BITRATE_KBIT_S (500u)
+
+/**
+ * share of the bus that the periodic TX messages of one CAN tick may use at
+ * most in percent, the rest is left for received and event-triggered messages
+ */
+#define CAN_TX_MAXIMUM_BUS_LOAD_PERCENT (50u)
+
 /** enum for byte order */
 typedef enum {
     littleEndian,
     bigEndian,
 } CAN_byteOrder_e;
 
+/** priority of an RX message when the RX buffer runs full */
+typedef enum {
+    CAN_RX_PRIORITY_LOW,  /*!< dropped first, may not use the reserved RX buffer elements */
+    CAN_RX_PRIORITY_HIGH, /*!< may use the RX buffer elements reserved for high priority messages */
+} CAN_RX_PRIORITY_e;
+
 /** type definition for callback functions used in CAN messages */
 typedef uint32_t (
     *can_callback_funcPtr)(uint32_t ID, uint8_t DLC, CAN_byteOrder_e byteorder, uint8_t *candata, uint32_t *pMuxId);
@@ -122,6 +137,7 @@ typedef struct CAN_MSG_RX_TYPE {
     uint8_t rtr;                           /*!< rtr bit */
     CAN_byteOrder_e byteOrder;             /*!< Byte order (big or little endian) */
     can_callback_funcPtr callbackFunction; /*!< CAN message callback after message is received */
+    CAN_RX_PRIORITY_e priority;            /*!< priority of the message when the RX buffer runs full */
 } CAN_MSG_RX_TYPE_s;
 
 /*========== Extern Constant and Variable Declarations ======================*/
@@ -164,6 +180,24 @@ extern uint32_t TEST_CAN_TxVoltageMinMax(
     CAN_byteOrder_e byteOrder,
     uint8_t *pCanData,
     uint32_t *pMuxId);
+extern uint32_t TEST_CAN_TxAlgorithmStatistics(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *pCanData,
+    uint32_t *pMuxId);
+extern uint32_t TEST_CAN_TxProfilingTimes(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *pCanData,
+    uint32_t *pMuxId);
+extern uint32_t TEST_CAN_TxProfilingHistogram(
+    uint32_t id,
+    uint8_t dlc,
+    CAN_byteOrder_e byteOrder,
+    uint8_t *pCanData,
+    uint32_t *pMuxId);
 
 /* RX callback functions */
 extern uint32_t TEST_CAN_RxRequest(
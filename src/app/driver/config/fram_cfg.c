@@ -74,10 +74,11 @@ FRAM_SBC_INIT_s fram_sbcInit = {
     .finState = STD_NOT_OK,
 };
 FRAM_DEEP_DISCHARGE_FLAG_s fram_deepDischargeFlags = {0};
+FRAM_SYS_MON_RECORD_s fram_sysMonViolationRecord   = {0};
 /**@}*/
 
 /**
- * The zeros are the uninitialized addresses of the variables
+ * The zeros are the uninitialized addresses of the journals of the variables
  * in the FRAM. They are initialized by the call of FRAM_Initialize()
  */
 FRAM_BASE_HEADER_s fram_base_header[] = {
@@ -86,6 +87,7 @@ FRAM_BASE_HEADER_s fram_base_header[] = {
     {(void *)(&fram_sbcInit), sizeof(fram_sbcInit), 0},
     {(void *)(&fram_deepDischargeFlags), sizeof(fram_deepDischargeFlags), 0},
     {(void *)(&fram_soe), sizeof(fram_soe), 0},
+    {(void *)(&fram_sysMonViolationRecord), sizeof(fram_sysMonViolationRecord), 0},
 };
 
 /*========== Static Function Prototypes =====================================*/
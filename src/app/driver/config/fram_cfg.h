@@ -90,6 +90,7 @@ typedef enum FRAM_BLOCK_ID {
     FRAM_BLOCK_ID_SBC_INIT_STATE,
     FRAM_BLOCK_ID_DEEP_DISCHARGE_FLAG,
     FRAM_BLOCK_ID_SOE,
+    FRAM_BLOCK_ID_SYS_MON_RECORD,
     FRAM_BLOCK_MAX, /**< DO NOT CHANGE, MUST BE THE LAST ENTRY */
 } FRAM_BLOCK_ID_e;
 
@@ -139,6 +140,53 @@ typedef struct FRAM_DEEP_DISCHARGE_FLAG {
     bool deepDischargeFlag[BS_NR_OF_STRINGS]; /*!< false (0): no error, true (1): deep-discharge detected */
 } FRAM_DEEP_DISCHARGE_FLAG_s;
 
+/** number of timing violations that are kept in the record of the system monitoring */
+#define FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS (8u)
+
+/** number of tasks whose durations are stored with a timing violation, has to match SYSM_TASK_ID_MAX */
+#define FRAM_SYS_MON_RECORD_NR_OF_TASKS (5u)
+
+/** timing violation of a task as detected by the system monitoring */
+typedef struct FRAM_SYS_MON_VIOLATION {
+    uint32_t timestamp_ms;                                      /*!< time at which the violation was detected */
+    uint16_t duration_ms;                                       /*!< last duration of the violating task */
+    uint16_t jitter_ms;                                         /*!< delay of the task beyond its cycle time */
+    uint16_t taskDurations_ms[FRAM_SYS_MON_RECORD_NR_OF_TASKS]; /*!< last durations of all tasks */
+    uint8_t taskId;                                             /*!< violating task, see SYSM_TASK_ID_e */
+} FRAM_SYS_MON_VIOLATION_s;
+
+/**
+ * ring buffer of the latest timing violations. The violations are counted
+ * since the record was cleared, the violation with the number n (counted
+ * from 0) is stored at index n modulo #FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS.
+ */
+typedef struct FRAM_SYS_MON_RECORD {
+    uint32_t nrOfViolations;                                                   /*!< number of violations */
+    FRAM_SYS_MON_VIOLATION_s violations[FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS]; /*!< latest violations */
+} FRAM_SYS_MON_RECORD_s;
+
+/**
+ * Number of records that are stored per block. A write appends a new record,
+ * the oldest record is overwritten after this number of writes.
+ */
+#define FRAM_JOURNAL_SLOTS_PER_BLOCK (8u)
+
+/**
+ * Number of records of a block after which the summary index is written. It
+ * must be at most half of #FRAM_JOURNAL_SLOTS_PER_BLOCK, so that the record
+ * referenced by the older index copy has not been overwritten yet.
+ */
+#define FRAM_JOURNAL_INDEX_INTERVAL (4u)
+
+/**
+ * Size of the data of all blocks in bytes. The write requests of the FRAM
+ * driver buffer all blocks one after another, this size has to cover the sum
+ * of the data lengths in #fram_base_header.
+ */
+#define FRAM_SIZE_OF_ALL_BLOCKS                                                                                   \
+    (sizeof(FRAM_VERSION_s) + sizeof(FRAM_SOC_s) + sizeof(FRAM_SBC_INIT_s) + sizeof(FRAM_DEEP_DISCHARGE_FLAG_s) + \
+     sizeof(FRAM_SOE_s) + sizeof(FRAM_SYS_MON_RECORD_s))
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 extern FRAM_BASE_HEADER_s fram_base_header[FRAM_BLOCK_MAX];
@@ -152,6 +200,7 @@ extern FRAM_SOC_s fram_soc;
 extern FRAM_SOE_s fram_soe;
 extern FRAM_SBC_INIT_s fram_sbcInit;
 extern FRAM_DEEP_DISCHARGE_FLAG_s fram_deepDischargeFlags;
+extern FRAM_SYS_MON_RECORD_s fram_sysMonViolationRecord;
 /**@}*/
 
 /*========== Extern Function Prototypes =====================================*/
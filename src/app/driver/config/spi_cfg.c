@@ -69,6 +69,9 @@ static const spiDAT1_t spi_kLtcDataConfig = {
     .CSNR    = 0x0,       /* Chip select (CS) number, 0x01h for CS[0] */
 };
 
+/** activity of the LTC daisy-chains, one per string */
+static SPI_ACTIVITY_s spi_ltcActivity[BS_NR_OF_STRINGS] = {0};
+
 /*========== Extern Constant and Variable Definitions =======================*/
 /**
  * SPI interface configuration for LTC communication
@@ -76,25 +79,28 @@ static const spiDAT1_t spi_kLtcDataConfig = {
  */
 SPI_INTERFACE_CONFIG_s spi_ltcInterface[BS_NR_OF_STRINGS] = {
     {
-        .channel  = SPI_Interface1,
-        .pConfig  = &spi_kLtcDataConfig,
-        .pNode    = spiREG1,
-        .pGioPort = &(spiREG1->PC3),
-        .csPin    = 2u,
+        .channel   = SPI_Interface1,
+        .pConfig   = &spi_kLtcDataConfig,
+        .pNode     = spiREG1,
+        .pGioPort  = &(spiREG1->PC3),
+        .csPin     = 2u,
+        .pActivity = &spi_ltcActivity[0],
     },
     {
-        .channel  = SPI_Interface1,
-        .pConfig  = &spi_kLtcDataConfig,
-        .pNode    = spiREG1,
-        .pGioPort = &(spiREG1->PC3),
-        .csPin    = 2u,
+        .channel   = SPI_Interface1,
+        .pConfig   = &spi_kLtcDataConfig,
+        .pNode     = spiREG1,
+        .pGioPort  = &(spiREG1->PC3),
+        .csPin     = 2u,
+        .pActivity = &spi_ltcActivity[1],
     },
     {
-        .channel  = SPI_Interface1,
-        .pConfig  = &spi_kLtcDataConfig,
-        .pNode    = spiREG1,
-        .pGioPort = &(spiREG1->PC3),
-        .csPin    = 2u,
+        .channel   = SPI_Interface1,
+        .pConfig   = &spi_kLtcDataConfig,
+        .pNode     = spiREG1,
+        .pGioPort  = &(spiREG1->PC3),
+        .csPin     = 2u,
+        .pActivity = &spi_ltcActivity[2],
     },
 };
 
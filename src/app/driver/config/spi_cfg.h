@@ -103,6 +103,17 @@ typedef enum SPI_INTERFACE {
     SPI_Interface5,
 } SPI_INTERFACE_e;
 
+/**
+ * last activity on an SPI interface, used to decide if the devices connected
+ * to the interface have to be woken up before a transfer
+ */
+typedef struct SPI_ACTIVITY {
+    bool isValid;           /*!< true as soon as a transfer has been started */
+    uint32_t lastCount;     /*!< FRC0 value at the start of the last transfer */
+    uint32_t lastTick;      /*!< operating system tick at the start of the last transfer */
+    uint32_t elidedWakeUps; /*!< number of wake-up transfers that have been skipped */
+} SPI_ACTIVITY_s;
+
 /** configuration of the SPI interface */
 typedef struct SPI_INTERFACE_CONFIG {
     SPI_INTERFACE_e channel;
@@ -110,6 +121,7 @@ typedef struct SPI_INTERFACE_CONFIG {
     spiBASE_t *pNode;
     volatile uint32_t *pGioPort;
     uint32_t csPin;
+    SPI_ACTIVITY_s *pActivity; /*!< activity of the interface, #NULL_PTR if the activity is not tracked */
 } SPI_INTERFACE_CONFIG_s;
 
 /*========== Extern Constant and Variable Declarations ======================*/
@@ -73,8 +73,8 @@
 void DMA_Initialize(void) {
     /* - configuring dma control packets   */
     g_dmaCTRL dma_controlPacketTx = {
-        .SADD      = (uint32_t)NULL_PTR,     /* source address             */
-        .DADD      = (uint32_t)NULL_PTR,     /* destination  address       */
+        .SADD      = 0u,                     /* source address             */
+        .DADD      = 0u,                     /* destination  address       */
         .CHCTRL    = 0U,                     /* channel chain control      */
         .FRCNT     = 0U,                     /* frame count                */
         .ELCNT     = 1U,                     /* element count              */
@@ -92,8 +92,8 @@ void DMA_Initialize(void) {
     };
 
     g_dmaCTRL dma_controlPacketRx = {
-        .SADD      = (uint32_t)NULL_PTR,     /* source address             */
-        .DADD      = (uint32_t)NULL_PTR,     /* destination  address       */
+        .SADD      = 0u,                     /* source address             */
+        .DADD      = 0u,                     /* destination  address       */
         .CHCTRL    = 0U,                     /* channel chain control      */
         .FRCNT     = 0U,                     /* frame count                */
         .ELCNT     = 1U,                     /* element count              */
@@ -125,8 +125,8 @@ void DMA_Initialize(void) {
         dmaEnableInterrupt(
             (dmaChannel_t)(dmaChannel_t)dma_spiDmaChannels[i].rxChannel, (dmaInterrupt_t)BTC, (dmaIntGroup_t)DMA_INTA);
 
-        dma_controlPacketTx.DADD = (uint32_t)(&(dma_spiInterfaces[i]->DAT1)) + DMA_BIG_ENDIAN_ADDRESS_16BIT;
-        dma_controlPacketRx.SADD = (uint32_t)(&(dma_spiInterfaces[i]->BUF)) + DMA_BIG_ENDIAN_ADDRESS_16BIT;
+        dma_controlPacketTx.DADD = (uint32_t)(uintptr_t)(&(dma_spiInterfaces[i]->DAT1)) + DMA_BIG_ENDIAN_ADDRESS_16BIT;
+        dma_controlPacketRx.SADD = (uint32_t)(uintptr_t)(&(dma_spiInterfaces[i]->BUF)) + DMA_BIG_ENDIAN_ADDRESS_16BIT;
 
         /* Set dma control packet for Tx */
         dmaSetCtrlPacket((dmaChannel_t)dma_spiDmaChannels[i].txChannel, dma_controlPacketTx);
@@ -0,0 +1,148 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    cell_statistics.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup DRIVERS
+ * @prefix  CSTAT
+ *
+ * @brief   Statistics kernel for cell measurement values
+ *
+ * @details The values of a module are visited in a single loop in ascending
+ *          order of their index. Invalid values are skipped with the bitmask
+ *          of the module.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "cell_statistics.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/** returns the bitmask that covers nrOfValues values */
+static uint64_t CSTAT_GetAllValuesMask(uint8_t nrOfValues);
+
+/*========== Static Function Implementations ================================*/
+static uint64_t CSTAT_GetAllValuesMask(uint8_t nrOfValues) {
+    uint64_t mask = UINT64_MAX;
+    if (nrOfValues < CSTAT_MAXIMUM_NR_OF_VALUES) {
+        mask = (1ull << nrOfValues) - 1u;
+    }
+    return mask;
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void CSTAT_InitializeStatistics(CSTAT_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(pStatistics != NULL_PTR);
+    pStatistics->minimum         = INT16_MAX;
+    pStatistics->maximum         = INT16_MIN;
+    pStatistics->minimumIndex    = 0u;
+    pStatistics->maximumIndex    = 0u;
+    pStatistics->sum             = 0;
+    pStatistics->nrOfValidValues = 0u;
+}
+
+extern void CSTAT_AddValues(
+    const int16_t *pValues,
+    uint8_t nrOfValues,
+    uint64_t invalidMask,
+    uint16_t firstIndex,
+    CSTAT_STATISTICS_s *pStatistics) {
+    FAS_ASSERT(pValues != NULL_PTR);
+    FAS_ASSERT(nrOfValues <= CSTAT_MAXIMUM_NR_OF_VALUES);
+    FAS_ASSERT(pStatistics != NULL_PTR);
+
+    for (uint8_t i = 0u; i < nrOfValues; i++) {
+        if ((invalidMask & (1ull << i)) == 0u) {
+            const int16_t value = pValues[i];
+            pStatistics->sum += value;
+            pStatistics->nrOfValidValues++;
+            if (value < pStatistics->minimum) {
+                pStatistics->minimum      = value;
+                pStatistics->minimumIndex = firstIndex + i;
+            }
+            if (value > pStatistics->maximum) {
+                pStatistics->maximum      = value;
+                pStatistics->maximumIndex = firstIndex + i;
+            }
+        }
+    }
+}
+
+extern uint64_t CSTAT_GetOutOfRangeValues(
+    const int16_t *pValues,
+    uint8_t nrOfValues,
+    uint64_t invalidMask,
+    int32_t lowerLimit,
+    int32_t upperLimit) {
+    FAS_ASSERT(pValues != NULL_PTR);
+    FAS_ASSERT(nrOfValues <= CSTAT_MAXIMUM_NR_OF_VALUES);
+    FAS_ASSERT(lowerLimit <= upperLimit);
+
+    uint64_t outOfRange = 0u;
+    for (uint8_t i = 0u; i < nrOfValues; i++) {
+        if ((pValues[i] < lowerLimit) || (pValues[i] > upperLimit)) {
+            outOfRange |= 1ull << i;
+        }
+    }
+    return outOfRange & (~invalidMask);
+}
+
+extern uint8_t CSTAT_CountValidValues(uint8_t nrOfValues, uint64_t invalidMask) {
+    FAS_ASSERT(nrOfValues <= CSTAT_MAXIMUM_NR_OF_VALUES);
+    uint64_t validValues = (~invalidMask) & CSTAT_GetAllValuesMask(nrOfValues);
+    uint8_t count        = 0u;
+    while (validValues != 0u) {
+        validValues &= validValues - 1u;
+        count++;
+    }
+    return count;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
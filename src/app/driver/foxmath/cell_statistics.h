@@ -0,0 +1,136 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    cell_statistics.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup DRIVERS
+ * @prefix  CSTAT
+ *
+ * @brief   Headers for the statistics kernel for cell measurement values
+ *
+ * @details The kernel computes minimum, maximum, their positions, sum and
+ *          number of valid values of a set of cell measurement values in one
+ *          pass and detects values that are outside of a range. Invalid
+ *          values are marked by a set bit in a bitmask (one bitmask per
+ *          module, as in the database) and are skipped.
+ *
+ */
+
+#ifndef FOXBMS__CELL_STATISTICS_H_
+#define FOXBMS__CELL_STATISTICS_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/** maximum number of values that are described by one bitmask */
+#define CSTAT_MAXIMUM_NR_OF_VALUES (64u)
+
+/** statistics of a set of cell measurement values */
+typedef struct CSTAT_STATISTICS {
+    int16_t minimum;          /*!< smallest valid value (INT16_MAX if there is no valid value) */
+    int16_t maximum;          /*!< largest valid value (INT16_MIN if there is no valid value) */
+    uint16_t minimumIndex;    /*!< index of the first occurrence of the minimum */
+    uint16_t maximumIndex;    /*!< index of the first occurrence of the maximum */
+    int32_t sum;              /*!< sum of all valid values */
+    uint16_t nrOfValidValues; /*!< number of valid values */
+} CSTAT_STATISTICS_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   resets the statistics before the first call of #CSTAT_AddValues()
+ * @param   pStatistics  statistics that are reset
+ */
+extern void CSTAT_InitializeStatistics(CSTAT_STATISTICS_s *pStatistics);
+
+/**
+ * @brief   adds the valid values of one module to the statistics
+ * @details Values are added in ascending order of their index, i.e., the
+ *          first occurrence of the minimum and of the maximum is stored.
+ * @param   pValues      values of the module
+ * @param   nrOfValues   number of values (at most #CSTAT_MAXIMUM_NR_OF_VALUES)
+ * @param   invalidMask  bit n is set if value n is invalid
+ * @param   firstIndex   index that is stored for the first value of the module
+ * @param   pStatistics  statistics that are updated
+ */
+extern void CSTAT_AddValues(
+    const int16_t *pValues,
+    uint8_t nrOfValues,
+    uint64_t invalidMask,
+    uint16_t firstIndex,
+    CSTAT_STATISTICS_s *pStatistics);
+
+/**
+ * @brief   detects the valid values that are outside of a range
+ * @details The values are compared with the limits as 32-bit values, e.g., a
+ *          lower limit below INT16_MIN does not detect any value.
+ * @param   pValues      values of the module
+ * @param   nrOfValues   number of values (at most #CSTAT_MAXIMUM_NR_OF_VALUES)
+ * @param   invalidMask  bit n is set if value n is invalid
+ * @param   lowerLimit   smallest value that is inside of the range
+ * @param   upperLimit   largest value that is inside of the range
+ * @return  bitmask in which bit n is set if value n is valid and outside of
+ *          the range
+ */
+extern uint64_t CSTAT_GetOutOfRangeValues(
+    const int16_t *pValues,
+    uint8_t nrOfValues,
+    uint64_t invalidMask,
+    int32_t lowerLimit,
+    int32_t upperLimit);
+
+/**
+ * @brief   counts the valid values of a module
+ * @param   nrOfValues   number of values (at most #CSTAT_MAXIMUM_NR_OF_VALUES)
+ * @param   invalidMask  bit n is set if value n is invalid
+ * @return  number of values whose bit is not set in invalidMask
+ */
+extern uint8_t CSTAT_CountValidValues(uint8_t nrOfValues, uint64_t invalidMask);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__CELL_STATISTICS_H_ */
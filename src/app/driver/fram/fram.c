@@ -55,6 +55,7 @@
 /*========== Includes =======================================================*/
 #include "fram.h"
 
+#include "fram_journal.h"
 #include "io.h"
 #include "mcu.h"
 #include "os.h"
@@ -75,134 +76,423 @@
 /** maximal memory address of the FRAM */
 #define FRAM_MAX_ADDRESS (0x3FFFFu)
 
+/** number of words for the command and the address that precede the data */
+#define FRAM_COMMAND_AND_ADDRESS_LENGTH (4u)
+
+/** state of the write requests of a block */
+typedef struct {
+    bool isRequested;   /*!< the requested copy may differ from the FRAM and has to be written */
+    bool isShadowValid; /*!< the shadow copy is equal to the content of the FRAM */
+} FRAM_WRITE_STATE_s;
+
 /*========== Static Constant and Variable Definitions =======================*/
 
+/**
+ * DMA buffers for the write requests: command, address and record, one byte
+ * per word
+ * @{
+ */
+#pragma SET_DATA_SECTION(".sharedRAM")
+static uint16_t fram_dmaTxBuffer[FRAM_COMMAND_AND_ADDRESS_LENGTH + FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH] = {0};
+static uint16_t fram_dmaRxBuffer[FRAM_COMMAND_AND_ADDRESS_LENGTH + FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH] = {0};
+#pragma SET_DATA_SECTION()
+/**@}*/
+
+/**
+ * Buffer for a record or an index copy that is written. It is only used while
+ * the SPI interface is locked, which also serializes the access to the
+ * journal.
+ */
+static uint8_t fram_recordBuffer[FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH] = {0};
+
+/**
+ * Copies of the blocks, located one after another
+ * @{
+ */
+/** content of the blocks when the last write was requested */
+static uint8_t fram_requestedData[FRAM_SIZE_OF_ALL_BLOCKS] = {0};
+/** content of the blocks in the FRAM, i.e., as last read or written */
+static uint8_t fram_shadowData[FRAM_SIZE_OF_ALL_BLOCKS] = {0};
+/**@}*/
+
+/** offset of the blocks in the copies */
+static uint16_t fram_copyOffset[FRAM_BLOCK_MAX] = {0};
+
+/** state of the write requests of all blocks */
+static FRAM_WRITE_STATE_s fram_writeState[FRAM_BLOCK_MAX] = {0};
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
 
+/**
+ * @brief   Sends the write enable command and the write command with the
+ *          address.
+ * @details The SPI interface has to be locked by the caller. Chip select
+ *          stays active after the function, the data has to follow.
+ * @param   address FRAM address of the first byte to write
+ */
+static void FRAM_StartWriteCommand(uint32_t address);
+
+/**
+ * @brief   Writes bytes to the FRAM with polled SPI transfers.
+ * @details The SPI interface has to be locked by the caller.
+ * @param   address FRAM address of the first byte to write
+ * @param   pData   data to write
+ * @param   size    number of bytes to write
+ */
+static void FRAM_WriteBytes(uint32_t address, const uint8_t *pData, uint16_t size);
+
+/**
+ * @brief   Reads bytes from the FRAM with polled SPI transfers.
+ * @details The SPI interface has to be locked by the caller.
+ * @param   address FRAM address of the first byte to read
+ * @param   pData   buffer for the read bytes
+ * @param   size    number of bytes to read
+ */
+static void FRAM_ReadBytes(uint32_t address, uint8_t *pData, uint16_t size);
+
+/**
+ * @brief   Appends a record of a block to its journal with polled SPI
+ *          transfers.
+ * @details The SPI interface has to be locked by the caller. The summary
+ *          index is written afterwards if it is due.
+ * @param   blockId ID of the block
+ * @param   pData   data of the block
+ */
+static void FRAM_WriteRecord(FRAM_BLOCK_ID_e blockId, const uint8_t *pData);
+
+/**
+ * @brief   Checks if the requested copy of a block differs from the FRAM.
+ * @details If the shadow copy is not valid, the block is treated as changed.
+ * @param   blockId ID of the block
+ * @return  true if the block has to be written, false otherwise
+ */
+static bool FRAM_IsRequestChanged(FRAM_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Marks the shadow copy of a block as equal to the given data.
+ * @param   blockId ID of the block
+ * @param   pData   data of the block
+ */
+static void FRAM_UpdateShadow(FRAM_BLOCK_ID_e blockId, const uint8_t *pData);
+
 /*========== Static Function Implementations ================================*/
 
-/*========== Extern Function Implementations ================================*/
+static void FRAM_StartWriteCommand(uint32_t address) {
+    uint16_t write = 0;
+    uint16_t read  = 0;
 
-extern void FRAM_Initialize(void) {
-    uint32_t address = 0;
+    /* send write enable command */
+    IO_PinReset((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+    write = FRAM_WRITEENABLECOMMAND;
+    SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+    IO_PinSet((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+    MCU_delay_us(FRAM_DELAY_AFTER_WRITE_ENABLE_US);
 
-    /* find address of all variables in FRAM  by parsing length of data*/
-    for (uint16_t i = 0u; i < FRAM_BLOCK_MAX; i++) {
-        (&fram_base_header[0u] + i)->address = address;
-        address += (&fram_base_header[0u] + i)->datalength;
+    /* send data to write */
+    /* set chip select low to start transmission */
+    IO_PinReset((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+
+    /* send write command */
+    write = FRAM_WRITECOMMAND;
+    SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+
+    /* send upper part of address */
+    write = (address & 0x3F0000u) >> 16u;
+    SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+
+    /* send middle part of address */
+    write = (address & 0xFF00u) >> 8u;
+    SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+
+    /* send lower part of address */
+    write = address & 0xFFu;
+    SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+}
+
+static void FRAM_WriteBytes(uint32_t address, const uint8_t *pData, uint16_t size) {
+    uint16_t write = 0;
+    uint16_t read  = 0;
+
+    FRAM_StartWriteCommand(address);
+
+    while (size > 0u) {
+        write = (uint16_t)(*pData);
+        SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+        pData++;
+        size--;
     }
 
-    /* ASSERT that size of variables does not exceed FRAM size */
-    FAS_ASSERT(!(address > FRAM_MAX_ADDRESS));
+    /* set chip select high to start transmission */
+    IO_PinSet((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
 }
 
-extern STD_RETURN_TYPE_e FRAM_Write(FRAM_BLOCK_ID_e blockId) {
-    uint8_t *wrt_ptr         = NULL_PTR;
-    uint32_t address         = 0;
-    uint16_t write           = 0;
-    uint16_t read            = 0;
-    uint16_t size            = 0;
-    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+static void FRAM_ReadBytes(uint32_t address, uint8_t *pData, uint16_t size) {
+    uint16_t write = 0;
+    uint16_t read  = 0;
 
-    retVal = SPI_Lock(SPI_Interface3);
+    /* get data to be read */
+    /* set chip select low to start transmission */
+    IO_PinReset((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
 
-    if (retVal == STD_OK) {
-        address = (&fram_base_header[0] + blockId)->address;
+    /* send read command */
+    write = FRAM_READCOMMAND;
+    SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
 
-        wrt_ptr = (uint8_t *)((&fram_base_header[0] + blockId)->blockptr);
-        size    = (&fram_base_header[0] + blockId)->datalength;
+    /* send upper part of address */
+    write = (address & 0x3F0000u) >> 16u;
+    SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
 
-        /* send write enable command */
-        IO_PinReset((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
-        write = FRAM_WRITEENABLECOMMAND;
-        SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
-        IO_PinSet((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
-        MCU_delay_us(FRAM_DELAY_AFTER_WRITE_ENABLE_US);
+    /* send middle part of address */
+    write = (address & 0xFF00u) >> 8u;
+    SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
 
-        /* send data to write */
-        /* set chip select low to start transmission */
-        IO_PinReset((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+    /* send lower part of address */
+    write = address & 0xFFu;
+    SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
 
-        /* send write command */
-        write = FRAM_WRITECOMMAND;
+    write = 0;
+    while (size > 0u) {
         SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+        *pData = (uint8_t)read;
+        pData++;
+        size--;
+    }
 
-        /* send upper part of address */
-        write = (address & 0x3F0000u) >> 16u;
-        SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+    /* set chip select high to end transmission */
+    IO_PinSet((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+}
 
-        /* send middle part of address */
-        write = (address & 0xFF00u) >> 8u;
-        SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+static void FRAM_WriteRecord(FRAM_BLOCK_ID_e blockId, const uint8_t *pData) {
+    uint32_t address = 0u;
+    uint16_t length  = FRAM_JOURNAL_EncodeRecord(blockId, pData, fram_recordBuffer, &address);
 
-        /* send lower part of address */
-        write = address & 0xFFu;
-        SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+    FRAM_WriteBytes(address, fram_recordBuffer, length);
+    FRAM_JOURNAL_CommitRecord(blockId);
 
-        while (size > 0u) {
-            write = (uint16_t)(*wrt_ptr);
-            SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
-            wrt_ptr++;
-            size--;
-        }
+    if (FRAM_JOURNAL_IsIndexUpdateDue() == true) {
+        length = FRAM_JOURNAL_EncodeIndex(fram_recordBuffer, &address);
+        FRAM_WriteBytes(address, fram_recordBuffer, length);
+        FRAM_JOURNAL_CommitIndex();
+    }
+}
 
-        /* set chip select high to start transmission */
-        IO_PinSet((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+static bool FRAM_IsRequestChanged(FRAM_BLOCK_ID_e blockId) {
+    const uint16_t offset = fram_copyOffset[blockId];
+    const uint16_t size   = (&fram_base_header[0] + blockId)->datalength;
+    bool isChanged        = (fram_writeState[blockId].isShadowValid == false);
 
-        SPI_Unlock(SPI_Interface3);
+    for (uint16_t i = 0u; (i < size) && (isChanged == false); i++) {
+        isChanged = (fram_requestedData[offset + i] != fram_shadowData[offset + i]);
     }
+    return isChanged;
+}
 
-    return retVal;
+static void FRAM_UpdateShadow(FRAM_BLOCK_ID_e blockId, const uint8_t *pData) {
+    const uint16_t offset = fram_copyOffset[blockId];
+    const uint16_t size   = (&fram_base_header[0] + blockId)->datalength;
+
+    for (uint16_t i = 0u; i < size; i++) {
+        fram_shadowData[offset + i] = pData[i];
+    }
+    fram_writeState[blockId].isShadowValid = true;
 }
 
-extern STD_RETURN_TYPE_e FRAM_Read(FRAM_BLOCK_ID_e blockId) {
-    uint8_t *rd_ptr          = NULL_PTR;
-    uint32_t address         = 0;
-    uint16_t write           = 0;
-    uint16_t read            = 0;
-    uint16_t size            = 0;
-    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+/*========== Extern Function Implementations ================================*/
+
+extern void FRAM_Initialize(void) {
+    uint16_t offset = 0u;
+
+    /* find the offset of all variables in the copies by parsing length of data */
+    for (uint16_t i = 0u; i < FRAM_BLOCK_MAX; i++) {
+        fram_copyOffset[i] = offset;
+        offset += (&fram_base_header[0u] + i)->datalength;
+        fram_writeState[i].isRequested   = false;
+        fram_writeState[i].isShadowValid = false;
+    }
+    /* ASSERT that the copies of the write requests cover all variables */
+    FAS_ASSERT(!(offset > FRAM_SIZE_OF_ALL_BLOCKS));
+
+    /* find address of all journals in FRAM */
+    const uint32_t usedSize = FRAM_JOURNAL_Initialize();
+    /* ASSERT that size of the journals does not exceed FRAM size */
+    FAS_ASSERT(!(usedSize > FRAM_MAX_ADDRESS));
+
+    /* The FRAM is initialized before the cyclic tasks use the interface. */
+    const STD_RETURN_TYPE_e lockState = SPI_Lock(SPI_Interface3);
+    FAS_ASSERT(lockState == STD_OK);
+    FRAM_JOURNAL_Scan(&FRAM_ReadBytes);
+    SPI_Unlock(SPI_Interface3);
+}
 
-    retVal = SPI_Lock(SPI_Interface3);
+extern STD_RETURN_TYPE_e FRAM_Write(FRAM_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    const uint8_t *wrt_ptr   = (const uint8_t *)((&fram_base_header[0] + blockId)->blockptr);
+    STD_RETURN_TYPE_e retVal = SPI_Lock(SPI_Interface3);
 
     if (retVal == STD_OK) {
-        address = (&fram_base_header[0] + blockId)->address;
+        FRAM_WriteRecord(blockId, wrt_ptr);
 
-        rd_ptr = (uint8_t *)((&fram_base_header[0] + blockId)->blockptr);
-        size   = (&fram_base_header[0] + blockId)->datalength;
+        /* the written data supersedes a pending write request */
+        OS_EnterTaskCritical();
+        FRAM_UpdateShadow(blockId, wrt_ptr);
+        fram_writeState[blockId].isRequested = false;
+        OS_ExitTaskCritical();
 
-        /* get data to be read */
-        /* set chip select low to start transmission */
-        IO_PinReset((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+        SPI_Unlock(SPI_Interface3);
+    }
 
-        /* send write command */
-        write = FRAM_READCOMMAND;
-        SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+    return retVal;
+}
 
-        /* send upper part of address */
-        write = (address & 0x3F0000u) >> 16u;
-        SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+extern void FRAM_RequestWrite(FRAM_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    const uint16_t offset = fram_copyOffset[blockId];
+    const uint16_t size   = (&fram_base_header[0] + blockId)->datalength;
+    const uint8_t *pBlock = (const uint8_t *)((&fram_base_header[0] + blockId)->blockptr);
 
-        /* send middle part of address */
-        write = (address & 0xFF00u) >> 8u;
-        SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+    /* take a consistent copy, a later request replaces it */
+    OS_EnterTaskCritical();
+    for (uint16_t i = 0u; i < size; i++) {
+        fram_requestedData[offset + i] = pBlock[i];
+    }
+    fram_writeState[blockId].isRequested = true;
+    OS_ExitTaskCritical();
+}
 
-        /* send lower part of address */
-        write = address & 0xFFu;
-        SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
+extern void FRAM_ProcessWriteRequests(void) {
+    FRAM_BLOCK_ID_e blockId = FRAM_BLOCK_MAX;
+    uint32_t address        = 0u;
+    uint16_t length         = 0u;
+    uint16_t write          = 0u;
+    uint16_t read           = 0u;
+
+    /* The interface is released by the DMA callback, a successful lock
+       therefore also means that the previous DMA transfer has been completed.
+       The lock is held from the write enable command until the DMA transfer
+       has been started, so that no other access to the interface clears the
+       write enable latch of the FRAM in between. */
+    if (SPI_Lock(SPI_Interface3) == STD_OK) {
+        if (FRAM_JOURNAL_IsIndexUpdateDue() == true) {
+            length = FRAM_JOURNAL_EncodeIndex(fram_recordBuffer, &address);
+        } else {
+            OS_EnterTaskCritical();
+            for (uint16_t i = 0u; (i < (uint16_t)FRAM_BLOCK_MAX) && (length == 0u); i++) {
+                if (fram_writeState[i].isRequested == true) {
+                    fram_writeState[i].isRequested = false;
+                    /* unchanged data is not written again */
+                    if (FRAM_IsRequestChanged((FRAM_BLOCK_ID_e)i) == true) {
+                        const uint8_t *pRequest = &fram_requestedData[fram_copyOffset[i]];
+                        blockId                 = (FRAM_BLOCK_ID_e)i;
+                        length = FRAM_JOURNAL_EncodeRecord(blockId, pRequest, fram_recordBuffer, &address);
+                    }
+                }
+            }
+            OS_ExitTaskCritical();
+        }
 
-        write = 0;
-        while (size > 0u) {
+        if (length > 0u) {
+            fram_dmaTxBuffer[0u] = FRAM_WRITECOMMAND;
+            fram_dmaTxBuffer[1u] = (uint16_t)((address & 0x3F0000u) >> 16u);
+            fram_dmaTxBuffer[2u] = (uint16_t)((address & 0xFF00u) >> 8u);
+            fram_dmaTxBuffer[3u] = (uint16_t)(address & 0xFFu);
+            for (uint16_t i = 0u; i < length; i++) {
+                fram_dmaTxBuffer[FRAM_COMMAND_AND_ADDRESS_LENGTH + i] = fram_recordBuffer[i];
+            }
+
+            /* send write enable command */
+            IO_PinReset((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+            write = FRAM_WRITEENABLECOMMAND;
             SPI_DirectlyTransmitReceiveData(&spi_framInterface, &write, &read, 1);
-            *rd_ptr = read;
-            rd_ptr++;
-            size--;
+            IO_PinSet((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+            MCU_delay_us(FRAM_DELAY_AFTER_WRITE_ENABLE_US);
+
+            /* The lock is released by the DMA callback. The transfer is started
+               and committed in one critical section, as another task may lock
+               the interface and reuse the record buffer as soon as the
+               transfer has been completed. */
+            OS_EnterTaskCritical();
+            const STD_RETURN_TYPE_e transferState = SPI_TransmitReceiveDataDmaLocked(
+                &spi_framInterface,
+                fram_dmaTxBuffer,
+                fram_dmaRxBuffer,
+                (uint32_t)FRAM_COMMAND_AND_ADDRESS_LENGTH + length);
+            if (transferState == STD_OK) {
+                /* a record or index copy that is cut by a power loss is
+                   detected by its CRC at startup */
+                if (blockId == FRAM_BLOCK_MAX) {
+                    FRAM_JOURNAL_CommitIndex();
+                } else {
+                    /* the record contains the written data, the request may
+                       have been replaced in the meantime */
+                    FRAM_UpdateShadow(blockId, &fram_recordBuffer[FRAM_JOURNAL_RECORD_HEADER_LENGTH]);
+                    FRAM_JOURNAL_CommitRecord(blockId);
+                }
+            } else if (blockId != FRAM_BLOCK_MAX) {
+                /* the transfer has not been started: write the block again */
+                fram_writeState[blockId].isRequested = true;
+            } else {
+                /* the index is still due and written by the next call */
+            }
+            OS_ExitTaskCritical();
+
+            if (transferState != STD_OK) {
+                SPI_Unlock(SPI_Interface3);
+            }
+        } else {
+            SPI_Unlock(SPI_Interface3);
+        }
+    }
+}
+
+extern STD_RETURN_TYPE_e FRAM_Flush(void) {
+    bool isChanged           = false;
+    STD_RETURN_TYPE_e retVal = SPI_Lock(SPI_Interface3);
+
+    if (retVal == STD_OK) {
+        for (uint16_t i = 0u; i < (uint16_t)FRAM_BLOCK_MAX; i++) {
+            const FRAM_BLOCK_ID_e blockId = (FRAM_BLOCK_ID_e)i;
+
+            OS_EnterTaskCritical();
+            isChanged = false;
+            if (fram_writeState[i].isRequested == true) {
+                isChanged = FRAM_IsRequestChanged(blockId);
+                FRAM_UpdateShadow(blockId, &fram_requestedData[fram_copyOffset[i]]);
+                fram_writeState[i].isRequested = false;
+            }
+            OS_ExitTaskCritical();
+
+            if (isChanged == true) {
+                FRAM_WriteRecord(blockId, &fram_shadowData[fram_copyOffset[i]]);
+            }
         }
+        SPI_Unlock(SPI_Interface3);
+    }
+
+    return retVal;
+}
 
-        /* set chip select high to start transmission */
-        IO_PinSet((uint32_t *)spi_framInterface.pGioPort, spi_framInterface.csPin);
+extern bool FRAM_IsWritePending(FRAM_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    return fram_writeState[blockId].isRequested;
+}
+
+extern STD_RETURN_TYPE_e FRAM_Read(FRAM_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    uint8_t *rd_ptr          = (uint8_t *)((&fram_base_header[0] + blockId)->blockptr);
+    STD_RETURN_TYPE_e retVal = SPI_Lock(SPI_Interface3);
+
+    if (retVal == STD_OK) {
+        /* without a valid record the variable keeps its default value */
+        retVal = FRAM_JOURNAL_ReadLatest(blockId, &FRAM_ReadBytes, rd_ptr);
+
+        if (retVal == STD_OK) {
+            /* the read data is the content of the FRAM */
+            OS_EnterTaskCritical();
+            FRAM_UpdateShadow(blockId, rd_ptr);
+            OS_ExitTaskCritical();
+        }
 
         SPI_Unlock(SPI_Interface3);
     }
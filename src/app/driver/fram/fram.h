@@ -66,15 +66,17 @@
 
 /**
  * @brief   Initializes the addresses to be written in the FRAM.
- * @details This function must be called before any use of the FRAM.
+ * @details This function must be called before any use of the FRAM. It finds
+ *          the newest valid record of every variable.
  */
 extern void FRAM_Initialize(void);
 
 /* The variable corrresponding to the block_ID is written */
 /**
  * @brief   Writes a variable to the FRAM.
- * @details This function stores the variable corresponding to the ID passed as
- *          parameter. Write can fail if SPI interface was locked.
+ * @details This function appends a record of the variable corresponding to
+ *          the ID passed as parameter to its journal. Write can fail if SPI
+ *          interface was locked.
  * @param   blockId ID of variable to write to FRAM
  * @return  #STD_OK if write was successful, #STD_NOT_OK otherwise
  */
@@ -83,13 +85,51 @@ extern STD_RETURN_TYPE_e FRAM_Write(FRAM_BLOCK_ID_e blockId);
 /* The variable corrresponding to the block_ID is written */
 /**
  * @brief   Reads a variable from the FRAM.
- * @details This function reads the variable corresponding to the ID passed as
- *          parameter. Read can fail if SPI interface was locked.
+ * @details This function reads the newest valid record of the variable
+ *          corresponding to the ID passed as parameter. Read can fail if SPI
+ *          interface was locked or if no valid record is stored. In this
+ *          case the variable is not changed.
  * @param   blockId ID of variable to read from FRAM
  * @return  #STD_OK if read was successful, #STD_NOT_OK otherwise
  */
 extern STD_RETURN_TYPE_e FRAM_Read(FRAM_BLOCK_ID_e blockId);
 
+/**
+ * @brief   Requests to write a variable to the FRAM.
+ * @details A copy of the variable corresponding to the ID passed as parameter
+ *          is taken and written later by #FRAM_ProcessWriteRequests(). A new
+ *          request for the same variable replaces a pending one, so that only
+ *          the latest value is written.
+ * @param   blockId ID of variable to write to FRAM
+ */
+extern void FRAM_RequestWrite(FRAM_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Writes the pending write requests to the FRAM.
+ * @details A variable is only written if its copy differs from the content
+ *          of the FRAM. The record or the summary index is transferred by
+ *          DMA, the function does not wait for its end. At most one transfer
+ *          is started per call, the function has to be called periodically,
+ *          e.g., from the idle task.
+ */
+extern void FRAM_ProcessWriteRequests(void);
+
+/**
+ * @brief   Writes all pending write requests to the FRAM.
+ * @details The data is written by polling, the function returns after all
+ *          requests have been written, e.g., before a shutdown. Flush can
+ *          fail if SPI interface was locked.
+ * @return  #STD_OK if all requests were written, #STD_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e FRAM_Flush(void);
+
+/**
+ * @brief   Checks if a write request of a variable has not yet been written.
+ * @param   blockId ID of variable
+ * @return  true if the write request is pending, false otherwise
+ */
+extern bool FRAM_IsWritePending(FRAM_BLOCK_ID_e blockId);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 
 #endif /* FOXBMS__FRAM_H_ */
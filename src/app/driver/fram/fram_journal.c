@@ -0,0 +1,418 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    fram_journal.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup DRIVERS
+ * @prefix  FRAM
+ *
+ * @brief   Record journal of the FRAM blocks
+ *
+ * @details A record consists of the sequence number (4 bytes), the block ID
+ *          and its complement (1 byte each), the data length (2 bytes), the
+ *          data and a CRC16 (CCITT, polynomial 0x1021) over all preceding
+ *          bytes. All values are stored little endian. The sequence number
+ *          0 marks a block without record. A copy of the summary index
+ *          consists of the index sequence number (4 bytes), the slot
+ *          (1 byte) and the sequence number (4 bytes) of the newest record of
+ *          every block and the CRC16.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "fram_journal.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/** initial value of the CRC16 */
+#define FRAM_JOURNAL_CRC_SEED (0xFFFFu)
+
+/** generator polynomial of the CRC16 */
+#define FRAM_JOURNAL_CRC_POLYNOMIAL (0x1021u)
+
+/** number of copies of the summary index */
+#define FRAM_JOURNAL_NUMBER_OF_INDEX_COPIES (2u)
+
+/** sequence number of a block without record */
+#define FRAM_JOURNAL_NO_RECORD (0u)
+
+/* the record that the older index copy references must still exist */
+#if ((2u * FRAM_JOURNAL_INDEX_INTERVAL) > FRAM_JOURNAL_SLOTS_PER_BLOCK)
+#error "FRAM_JOURNAL_INDEX_INTERVAL must be at most half of FRAM_JOURNAL_SLOTS_PER_BLOCK"
+#endif
+
+/** state of the journal of a block */
+typedef struct {
+    uint16_t recordLength;     /*!< length of a record of the block in bytes */
+    uint8_t latestSlot;        /*!< slot of the newest valid record */
+    uint32_t latestSequence;   /*!< sequence number of the newest record, #FRAM_JOURNAL_NO_RECORD if none */
+    uint8_t recordsSinceIndex; /*!< number of records written since the last index */
+} FRAM_JOURNAL_BLOCK_STATE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/** state of the journals of all blocks */
+static FRAM_JOURNAL_BLOCK_STATE_s fram_journalState[FRAM_BLOCK_MAX] = {0};
+
+/** sequence number of the newest valid copy of the summary index, 0 if none */
+static uint32_t fram_journalIndexSequence = 0u;
+
+/** the summary index has to be written */
+static bool fram_journalIsIndexDue = false;
+
+/** buffer for the records and the index copies that are read during the scan */
+static uint8_t fram_journalReadBuffer[FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH] = {0};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   Calculates the CRC16 of a byte array.
+ * @param   pData   data
+ * @param   length  number of bytes
+ * @return  CRC16 of the data
+ */
+static uint16_t FRAM_JOURNAL_CalculateCrc(const uint8_t *pData, uint16_t length);
+
+/**
+ * @brief   Stores a value little endian in a byte array.
+ * @param   pDestination    first byte of the value
+ * @param   value           value to store
+ * @param   numberOfBytes   number of bytes of the value
+ */
+static void FRAM_JOURNAL_PutValue(uint8_t *pDestination, uint32_t value, uint8_t numberOfBytes);
+
+/**
+ * @brief   Reads a little endian value from a byte array.
+ * @param   pSource         first byte of the value
+ * @param   numberOfBytes   number of bytes of the value
+ * @return  value
+ */
+static uint32_t FRAM_JOURNAL_GetValue(const uint8_t *pSource, uint8_t numberOfBytes);
+
+/**
+ * @brief   Computes the FRAM address of a slot of a block.
+ * @param   blockId ID of the block
+ * @param   slot    slot of the record
+ * @return  FRAM address of the slot
+ */
+static uint32_t FRAM_JOURNAL_GetSlotAddress(FRAM_BLOCK_ID_e blockId, uint8_t slot);
+
+/**
+ * @brief   Reads a record into #fram_journalReadBuffer and checks it.
+ * @param   blockId         ID of the block
+ * @param   slot            slot of the record
+ * @param   readFunction    function that reads from the FRAM
+ * @return  sequence number of the record, #FRAM_JOURNAL_NO_RECORD if the
+ *          record is not valid
+ */
+static uint32_t FRAM_JOURNAL_ReadRecord(FRAM_BLOCK_ID_e blockId, uint8_t slot, FRAM_JOURNAL_READ_f readFunction);
+
+/**
+ * @brief   Reads a copy of the summary index into #fram_journalReadBuffer
+ *          and checks it.
+ * @param   copy            number of the copy
+ * @param   readFunction    function that reads from the FRAM
+ * @return  sequence number of the index, 0 if the copy is not valid
+ */
+static uint32_t FRAM_JOURNAL_ReadIndex(uint8_t copy, FRAM_JOURNAL_READ_f readFunction);
+
+/**
+ * @brief   Finds the newest valid record of a block by reading all slots.
+ * @param   blockId         ID of the block
+ * @param   readFunction    function that reads from the FRAM
+ */
+static void FRAM_JOURNAL_ScanAllSlots(FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction);
+
+/*========== Static Function Implementations ================================*/
+
+static uint16_t FRAM_JOURNAL_CalculateCrc(const uint8_t *pData, uint16_t length) {
+    FAS_ASSERT(pData != NULL_PTR);
+    uint16_t crc = FRAM_JOURNAL_CRC_SEED;
+
+    for (uint16_t i = 0u; i < length; i++) {
+        crc ^= (uint16_t)((uint16_t)pData[i] << 8u);
+        for (uint8_t bit = 0u; bit < 8u; bit++) {
+            if ((crc & 0x8000u) != 0u) {
+                crc = (uint16_t)((uint16_t)(crc << 1u) ^ FRAM_JOURNAL_CRC_POLYNOMIAL);
+            } else {
+                crc = (uint16_t)(crc << 1u);
+            }
+        }
+    }
+    return crc;
+}
+
+static void FRAM_JOURNAL_PutValue(uint8_t *pDestination, uint32_t value, uint8_t numberOfBytes) {
+    for (uint8_t i = 0u; i < numberOfBytes; i++) {
+        pDestination[i] = (uint8_t)((value >> (8u * i)) & 0xFFu);
+    }
+}
+
+static uint32_t FRAM_JOURNAL_GetValue(const uint8_t *pSource, uint8_t numberOfBytes) {
+    uint32_t value = 0u;
+    for (uint8_t i = 0u; i < numberOfBytes; i++) {
+        value |= (uint32_t)pSource[i] << (8u * i);
+    }
+    return value;
+}
+
+static uint32_t FRAM_JOURNAL_GetSlotAddress(FRAM_BLOCK_ID_e blockId, uint8_t slot) {
+    return (&fram_base_header[0] + blockId)->address +
+           ((uint32_t)slot * (uint32_t)fram_journalState[blockId].recordLength);
+}
+
+static uint32_t FRAM_JOURNAL_ReadRecord(FRAM_BLOCK_ID_e blockId, uint8_t slot, FRAM_JOURNAL_READ_f readFunction) {
+    const uint16_t recordLength = fram_journalState[blockId].recordLength;
+    const uint16_t dataLength   = (&fram_base_header[0] + blockId)->datalength;
+    uint32_t sequence           = FRAM_JOURNAL_NO_RECORD;
+
+    readFunction(FRAM_JOURNAL_GetSlotAddress(blockId, slot), fram_journalReadBuffer, recordLength);
+
+    const uint16_t crc = (uint16_t)FRAM_JOURNAL_GetValue(&fram_journalReadBuffer[recordLength - 2u], 2u);
+    if ((fram_journalReadBuffer[4] == (uint8_t)blockId) && (fram_journalReadBuffer[5] == (uint8_t)(~blockId)) &&
+        (FRAM_JOURNAL_GetValue(&fram_journalReadBuffer[6], 2u) == dataLength) &&
+        (FRAM_JOURNAL_CalculateCrc(fram_journalReadBuffer, recordLength - FRAM_JOURNAL_CRC_LENGTH) == crc)) {
+        sequence = FRAM_JOURNAL_GetValue(&fram_journalReadBuffer[0], 4u);
+    }
+    return sequence;
+}
+
+static uint32_t FRAM_JOURNAL_ReadIndex(uint8_t copy, FRAM_JOURNAL_READ_f readFunction) {
+    uint32_t sequence = 0u;
+
+    readFunction((uint32_t)copy * FRAM_JOURNAL_INDEX_LENGTH, fram_journalReadBuffer, FRAM_JOURNAL_INDEX_LENGTH);
+
+    const uint16_t crc = (uint16_t)FRAM_JOURNAL_GetValue(&fram_journalReadBuffer[FRAM_JOURNAL_INDEX_LENGTH - 2u], 2u);
+    if (FRAM_JOURNAL_CalculateCrc(fram_journalReadBuffer, FRAM_JOURNAL_INDEX_LENGTH - FRAM_JOURNAL_CRC_LENGTH) ==
+        crc) {
+        sequence = FRAM_JOURNAL_GetValue(&fram_journalReadBuffer[0], 4u);
+    }
+    return sequence;
+}
+
+static void FRAM_JOURNAL_ScanAllSlots(FRAM_BLOCK_ID_e blockId, FRAM_JOURNAL_READ_f readFunction) {
+    fram_journalState[blockId].latestSequence = FRAM_JOURNAL_NO_RECORD;
+    fram_journalState[blockId].latestSlot     = FRAM_JOURNAL_SLOTS_PER_BLOCK - 1u;
+
+    for (uint8_t slot = 0u; slot < FRAM_JOURNAL_SLOTS_PER_BLOCK; slot++) {
+        const uint32_t sequence = FRAM_JOURNAL_ReadRecord(blockId, slot, readFunction);
+        if (sequence > fram_journalState[blockId].latestSequence) {
+            fram_journalState[blockId].latestSequence = sequence;
+            fram_journalState[blockId].latestSlot     = slot;
+        }
+    }
+    fram_journalIsIndexDue = true;
+}
+
+/*========== Extern Function Implementations ================================*/
+
+extern uint32_t FRAM_JOURNAL_Initialize(void) {
+    /* the index copies are located at the start of the FRAM */
+    uint32_t address = FRAM_JOURNAL_NUMBER_OF_INDEX_COPIES * FRAM_JOURNAL_INDEX_LENGTH;
+
+    FAS_ASSERT(FRAM_JOURNAL_INDEX_LENGTH <= FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH);
+    for (uint16_t i = 0u; i < (uint16_t)FRAM_BLOCK_MAX; i++) {
+        const uint16_t recordLength =
+            FRAM_JOURNAL_RECORD_HEADER_LENGTH + (&fram_base_header[0] + i)->datalength + FRAM_JOURNAL_CRC_LENGTH;
+        FAS_ASSERT(recordLength <= FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH);
+
+        (&fram_base_header[0] + i)->address    = address;
+        fram_journalState[i].recordLength      = recordLength;
+        fram_journalState[i].latestSlot        = FRAM_JOURNAL_SLOTS_PER_BLOCK - 1u;
+        fram_journalState[i].latestSequence    = FRAM_JOURNAL_NO_RECORD;
+        fram_journalState[i].recordsSinceIndex = 0u;
+        address += (uint32_t)recordLength * FRAM_JOURNAL_SLOTS_PER_BLOCK;
+    }
+    fram_journalIndexSequence = 0u;
+    fram_journalIsIndexDue    = false;
+
+    return address;
+}
+
+extern void FRAM_JOURNAL_Scan(FRAM_JOURNAL_READ_f readFunction) {
+    FAS_ASSERT(readFunction != NULL_PTR);
+    uint8_t indexSlot[FRAM_BLOCK_MAX]      = {0};
+    uint32_t indexSequence[FRAM_BLOCK_MAX] = {0};
+
+    /* take the newer of the valid index copies */
+    fram_journalIndexSequence = 0u;
+    for (uint8_t copy = 0u; copy < FRAM_JOURNAL_NUMBER_OF_INDEX_COPIES; copy++) {
+        const uint32_t sequence = FRAM_JOURNAL_ReadIndex(copy, readFunction);
+        if (sequence > fram_journalIndexSequence) {
+            fram_journalIndexSequence = sequence;
+            for (uint16_t i = 0u; i < (uint16_t)FRAM_BLOCK_MAX; i++) {
+                indexSlot[i]     = fram_journalReadBuffer[4u + (5u * i)];
+                indexSequence[i] = FRAM_JOURNAL_GetValue(&fram_journalReadBuffer[5u + (5u * i)], 4u);
+            }
+        }
+    }
+    fram_journalIsIndexDue = (fram_journalIndexSequence == 0u);
+
+    for (uint16_t i = 0u; i < (uint16_t)FRAM_BLOCK_MAX; i++) {
+        const FRAM_BLOCK_ID_e blockId          = (FRAM_BLOCK_ID_e)i;
+        fram_journalState[i].recordsSinceIndex = 0u;
+        /* a block without record at the time of the index starts with its first slot */
+        if ((fram_journalIndexSequence == 0u) || (indexSlot[i] >= FRAM_JOURNAL_SLOTS_PER_BLOCK) ||
+            ((indexSequence[i] != FRAM_JOURNAL_NO_RECORD) &&
+             (FRAM_JOURNAL_ReadRecord(blockId, indexSlot[i], readFunction) != indexSequence[i]))) {
+            /* the index does not lead to a record, search the whole journal */
+            FRAM_JOURNAL_ScanAllSlots(blockId, readFunction);
+        } else {
+            fram_journalState[i].latestSlot     = indexSlot[i];
+            fram_journalState[i].latestSequence = indexSequence[i];
+            /* follow the records that have been appended after the index */
+            for (uint8_t n = 1u; n < FRAM_JOURNAL_SLOTS_PER_BLOCK; n++) {
+                const uint8_t slot = (fram_journalState[i].latestSlot + 1u) % FRAM_JOURNAL_SLOTS_PER_BLOCK;
+                if (FRAM_JOURNAL_ReadRecord(blockId, slot, readFunction) !=
+                    (fram_journalState[i].latestSequence + 1u)) {
+                    break;
+                }
+                fram_journalState[i].latestSlot = slot;
+                fram_journalState[i].latestSequence++;
+                fram_journalState[i].recordsSinceIndex++;
+            }
+            if (fram_journalState[i].recordsSinceIndex > 0u) {
+                fram_journalIsIndexDue = true;
+            }
+        }
+    }
+}
+
+extern STD_RETURN_TYPE_e FRAM_JOURNAL_ReadLatest(
+    FRAM_BLOCK_ID_e blockId,
+    FRAM_JOURNAL_READ_f readFunction,
+    uint8_t *pData) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    FAS_ASSERT(readFunction != NULL_PTR);
+    FAS_ASSERT(pData != NULL_PTR);
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+
+    if ((fram_journalState[blockId].latestSequence != FRAM_JOURNAL_NO_RECORD) &&
+        (FRAM_JOURNAL_ReadRecord(blockId, fram_journalState[blockId].latestSlot, readFunction) ==
+         fram_journalState[blockId].latestSequence)) {
+        for (uint16_t i = 0u; i < (&fram_base_header[0] + blockId)->datalength; i++) {
+            pData[i] = fram_journalReadBuffer[FRAM_JOURNAL_RECORD_HEADER_LENGTH + i];
+        }
+        retVal = STD_OK;
+    }
+    return retVal;
+}
+
+extern uint16_t FRAM_JOURNAL_EncodeRecord(
+    FRAM_BLOCK_ID_e blockId,
+    const uint8_t *pData,
+    uint8_t *pRecord,
+    uint32_t *pAddress) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    FAS_ASSERT(pData != NULL_PTR);
+    FAS_ASSERT(pRecord != NULL_PTR);
+    FAS_ASSERT(pAddress != NULL_PTR);
+    const uint16_t recordLength = fram_journalState[blockId].recordLength;
+    const uint16_t dataLength   = (&fram_base_header[0] + blockId)->datalength;
+    const uint8_t slot          = (fram_journalState[blockId].latestSlot + 1u) % FRAM_JOURNAL_SLOTS_PER_BLOCK;
+
+    FRAM_JOURNAL_PutValue(&pRecord[0], fram_journalState[blockId].latestSequence + 1u, 4u);
+    pRecord[4] = (uint8_t)blockId;
+    pRecord[5] = (uint8_t)(~blockId);
+    FRAM_JOURNAL_PutValue(&pRecord[6], dataLength, 2u);
+    for (uint16_t i = 0u; i < dataLength; i++) {
+        pRecord[FRAM_JOURNAL_RECORD_HEADER_LENGTH + i] = pData[i];
+    }
+    FRAM_JOURNAL_PutValue(
+        &pRecord[recordLength - 2u], FRAM_JOURNAL_CalculateCrc(pRecord, recordLength - FRAM_JOURNAL_CRC_LENGTH), 2u);
+
+    *pAddress = FRAM_JOURNAL_GetSlotAddress(blockId, slot);
+    return recordLength;
+}
+
+extern void FRAM_JOURNAL_CommitRecord(FRAM_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < FRAM_BLOCK_MAX);
+    fram_journalState[blockId].latestSlot = (fram_journalState[blockId].latestSlot + 1u) % FRAM_JOURNAL_SLOTS_PER_BLOCK;
+    fram_journalState[blockId].latestSequence++;
+    fram_journalState[blockId].recordsSinceIndex++;
+    if (fram_journalState[blockId].recordsSinceIndex >= FRAM_JOURNAL_INDEX_INTERVAL) {
+        fram_journalIsIndexDue = true;
+    }
+}
+
+extern bool FRAM_JOURNAL_IsIndexUpdateDue(void) {
+    return fram_journalIsIndexDue;
+}
+
+extern uint16_t FRAM_JOURNAL_EncodeIndex(uint8_t *pIndex, uint32_t *pAddress) {
+    FAS_ASSERT(pIndex != NULL_PTR);
+    FAS_ASSERT(pAddress != NULL_PTR);
+    const uint32_t sequence = fram_journalIndexSequence + 1u;
+
+    FRAM_JOURNAL_PutValue(&pIndex[0], sequence, 4u);
+    for (uint16_t i = 0u; i < (uint16_t)FRAM_BLOCK_MAX; i++) {
+        pIndex[4u + (5u * i)] = fram_journalState[i].latestSlot;
+        FRAM_JOURNAL_PutValue(&pIndex[5u + (5u * i)], fram_journalState[i].latestSequence, 4u);
+    }
+    FRAM_JOURNAL_PutValue(
+        &pIndex[FRAM_JOURNAL_INDEX_LENGTH - 2u],
+        FRAM_JOURNAL_CalculateCrc(pIndex, FRAM_JOURNAL_INDEX_LENGTH - FRAM_JOURNAL_CRC_LENGTH),
+        2u);
+
+    /* the copies are written alternately, the older copy stays valid */
+    *pAddress = (sequence % FRAM_JOURNAL_NUMBER_OF_INDEX_COPIES) * FRAM_JOURNAL_INDEX_LENGTH;
+    return FRAM_JOURNAL_INDEX_LENGTH;
+}
+
+extern void FRAM_JOURNAL_CommitIndex(void) {
+    fram_journalIndexSequence++;
+    for (uint16_t i = 0u; i < (uint16_t)FRAM_BLOCK_MAX; i++) {
+        fram_journalState[i].recordsSinceIndex = 0u;
+    }
+    fram_journalIsIndexDue = false;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern uint16_t TEST_FRAM_JOURNAL_CalculateCrc(const uint8_t *pData, uint16_t length) {
+    return FRAM_JOURNAL_CalculateCrc(pData, length);
+}
+#endif
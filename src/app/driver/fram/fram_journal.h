@@ -0,0 +1,173 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    fram_journal.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup DRIVERS
+ * @prefix  FRAM
+ *
+ * @brief   Header for the record journal of the FRAM blocks
+ *
+ * @details Every block is stored as a journal of #FRAM_JOURNAL_SLOTS_PER_BLOCK
+ *          records. A write appends a record with the next sequence number
+ *          and a CRC to the slot after the newest record, so that the newest
+ *          valid record is never overwritten. A summary index that points to
+ *          the newest record of every block is written in two alternating
+ *          copies at the start of the FRAM. The module only encodes and
+ *          decodes the records, the transfers are done by the FRAM driver.
+ *
+ */
+
+#ifndef FOXBMS__FRAM_JOURNAL_H_
+#define FOXBMS__FRAM_JOURNAL_H_
+
+/*========== Includes =======================================================*/
+#include "fram_cfg.h"
+
+/*========== Macros and Definitions =========================================*/
+/** number of bytes of a record before the data: sequence, block ID and length */
+#define FRAM_JOURNAL_RECORD_HEADER_LENGTH (8u)
+
+/** number of bytes of the CRC at the end of a record or index */
+#define FRAM_JOURNAL_CRC_LENGTH (2u)
+
+/**
+ * maximum length of a record in bytes, including header and CRC; it has to
+ * cover the largest block, i.e., the timing violation record
+ */
+#define FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH (192u)
+
+/** length of one copy of the summary index in bytes */
+#define FRAM_JOURNAL_INDEX_LENGTH (4u + (5u * (uint16_t)FRAM_BLOCK_MAX) + FRAM_JOURNAL_CRC_LENGTH)
+
+/**
+ * @brief   Function that reads bytes from the FRAM
+ * @param   address FRAM address of the first byte to read
+ * @param   pData   buffer for the read bytes
+ * @param   size    number of bytes to read
+ */
+typedef void (*FRAM_JOURNAL_READ_f)(uint32_t address, uint8_t *pData, uint16_t size);
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Computes the location of the journals from #fram_base_header.
+ * @details All blocks are marked as not stored, #FRAM_JOURNAL_Scan() finds
+ *          the stored records.
+ * @return  number of bytes of the FRAM that are used by the journals
+ */
+extern uint32_t FRAM_JOURNAL_Initialize(void);
+
+/**
+ * @brief   Finds the newest valid record of every block.
+ * @details The newer valid copy of the summary index is read. For each
+ *          block, the indexed record and the records appended after it are
+ *          checked. Only if there is no valid index or the indexed record
+ *          is not valid anymore, all slots of the block are read.
+ * @param   readFunction    function that reads from the FRAM
+ */
+extern void FRAM_JOURNAL_Scan(FRAM_JOURNAL_READ_f readFunction);
+
+/**
+ * @brief   Reads the data of the newest valid record of a block.
+ * @param   blockId         ID of the block
+ * @param   readFunction    function that reads from the FRAM
+ * @param   pData           buffer for the data of the block
+ * @return  #STD_OK if a valid record was read, #STD_NOT_OK if there is no
+ *          valid record and pData has not been changed
+ */
+extern STD_RETURN_TYPE_e FRAM_JOURNAL_ReadLatest(
+    FRAM_BLOCK_ID_e blockId,
+    FRAM_JOURNAL_READ_f readFunction,
+    uint8_t *pData);
+
+/**
+ * @brief   Encodes the next record of a block.
+ * @details The record is located in the slot after the newest record. The
+ *          journal is only advanced by #FRAM_JOURNAL_CommitRecord().
+ * @param   blockId     ID of the block
+ * @param   pData       data of the block
+ * @param   pRecord     buffer for the record, #FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH bytes
+ * @param   pAddress    FRAM address of the record
+ * @return  length of the record in bytes
+ */
+extern uint16_t FRAM_JOURNAL_EncodeRecord(
+    FRAM_BLOCK_ID_e blockId,
+    const uint8_t *pData,
+    uint8_t *pRecord,
+    uint32_t *pAddress);
+
+/**
+ * @brief   Marks the record from #FRAM_JOURNAL_EncodeRecord() as written.
+ * @param   blockId ID of the block
+ */
+extern void FRAM_JOURNAL_CommitRecord(FRAM_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Checks if the summary index has to be written.
+ * @details The index is due after #FRAM_JOURNAL_INDEX_INTERVAL records of a
+ *          block or after a slot scan at startup.
+ * @return  true if the index has to be written, false otherwise
+ */
+extern bool FRAM_JOURNAL_IsIndexUpdateDue(void);
+
+/**
+ * @brief   Encodes the next copy of the summary index.
+ * @param   pIndex      buffer for the index, #FRAM_JOURNAL_INDEX_LENGTH bytes
+ * @param   pAddress    FRAM address of the index copy
+ * @return  length of the index in bytes
+ */
+extern uint16_t FRAM_JOURNAL_EncodeIndex(uint8_t *pIndex, uint32_t *pAddress);
+
+/** @brief   Marks the index from #FRAM_JOURNAL_EncodeIndex() as written. */
+extern void FRAM_JOURNAL_CommitIndex(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern uint16_t TEST_FRAM_JOURNAL_CalculateCrc(const uint8_t *pData, uint16_t length);
+#endif
+
+#endif /* FOXBMS__FRAM_JOURNAL_H_ */
@@ -54,6 +54,7 @@
 /*========== Includes =======================================================*/
 #include "mcu.h"
 
+#include "HL_sys_pmu.h"
 #include "HL_system.h"
 
 /*========== Macros and Definitions =========================================*/
@@ -67,21 +68,25 @@
 /** threshold in order to limit the time spent in wait to avoid livelock in wait */
 #define MCU_US_WAIT_TIMEOUT (10000U)
 
+/** number of CPU clock cycles per microsecond */
+#define MCU_CYCLES_PER_MICROSECOND ((uint32_t)(GCLK_FREQ))
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
 
-/*========== Static Function Implementations ================================*/
+/**
+ * @brief   Returns the number of FRC0 increments per microsecond.
+ * @return  number of FRC0 increments per microsecond
+ */
+static uint32_t MCU_GetFrcCountsPerMicrosecond(void);
 
-/*========== Extern Function Implementations ================================*/
+/*========== Static Function Implementations ================================*/
 
-void MCU_delay_us(uint32_t delay_us) {
-    uint32_t timeOut           = 0;
-    uint32_t startValue        = 0;
-    uint32_t rti_clock         = 0;
-    uint32_t rti_nrOfCounts_us = 0;
+static uint32_t MCU_GetFrcCountsPerMicrosecond(void) {
+    uint32_t rti_clock = 0;
 
     /**
      * This is the frequency of the FRC0 counter
@@ -101,7 +106,15 @@ void MCU_delay_us(uint32_t delay_us) {
      * To avoid floating point computation problems, the number of
      * increments needed to reach 1 microsecond is computed at once with:
      */
-    rti_nrOfCounts_us = (uint32_t)(((float)rti_clock) / 1e6f);
+    return (uint32_t)(((float)rti_clock) / 1e6f);
+}
+
+/*========== Extern Function Implementations ================================*/
+
+void MCU_delay_us(uint32_t delay_us) {
+    uint32_t timeOut                 = 0;
+    uint32_t startValue              = 0;
+    const uint32_t rti_nrOfCounts_us = MCU_GetFrcCountsPerMicrosecond();
 
     /* Get current value of FRC0 counter */
     startValue = (uint32_t)MCU_RTI_CNT0_FRC0_REG;
@@ -119,4 +132,32 @@ void MCU_delay_us(uint32_t delay_us) {
     }
 }
 
+extern uint32_t MCU_GetFreeRunningCount(void) {
+    return (uint32_t)MCU_RTI_CNT0_FRC0_REG;
+}
+
+extern uint32_t MCU_ConvertFrcDifferenceToTimespan_us(uint32_t count) {
+    const uint32_t rti_nrOfCounts_us = MCU_GetFrcCountsPerMicrosecond();
+    uint32_t timespan_us             = UINT32_MAX;
+    if (rti_nrOfCounts_us > 0u) {
+        timespan_us = count / rti_nrOfCounts_us;
+    }
+    return timespan_us;
+}
+
+extern void MCU_InitializeCycleCounter(void) {
+    _pmuInit_();
+    _pmuEnableCountersGlobal_();
+    _pmuResetCycleCounter_();
+    _pmuStartCounters_(pmuCYCLE_COUNTER);
+}
+
+extern uint32_t MCU_GetCycleCount(void) {
+    return _pmuGetCycleCount_();
+}
+
+extern uint32_t MCU_ConvertCycleDifferenceToTimespan_us(uint32_t cycles) {
+    return cycles / MCU_CYCLES_PER_MICROSECOND;
+}
+
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -59,7 +59,11 @@
 
 /*========== Macros and Definitions =========================================*/
 
-#ifndef UNITY_UNIT_TEST
+#if defined(FOXBMS_SIL)
+/** Free Running Counter 0 (FRC0), simulated from the host clock */
+extern uint32_t SIL_GetFreeRunningCount(void);
+#define MCU_RTI_CNT0_FRC0_REG (SIL_GetFreeRunningCount())
+#elif !defined(UNITY_UNIT_TEST)
 /** Address of Free Running Counter 0 (FRC0) */
 #define MCU_RTI_CNT0_FRC0_REG (*((volatile uint32_t *)0xFFFFFC10))
 #else
@@ -79,6 +83,48 @@ extern volatile uint32_t MCU_RTI_CNT0_FRC0_REG;
  */
 extern void MCU_delay_us(uint32_t delay_us);
 
+/**
+ * @brief   Returns the current value of the Free Running Counter 0 (FRC0).
+ * @details The counter is used as time base for durations below one
+ *          operating system tick. It wraps around after 2^32 increments.
+ * @return  current value of FRC0
+ */
+extern uint32_t MCU_GetFreeRunningCount(void);
+
+/**
+ * @brief   Converts a difference of two FRC0 values to microseconds.
+ * @details The difference has to be computed with unsigned arithmetic, so
+ *          that a single wrap around of the counter is handled.
+ * @param   count   difference of two values of #MCU_GetFreeRunningCount()
+ * @return  timespan in microseconds (rounded down)
+ */
+extern uint32_t MCU_ConvertFrcDifferenceToTimespan_us(uint32_t count);
+
+/**
+ * @brief   Initializes and starts the cycle counter of the performance
+ *          monitoring unit (PMU).
+ * @details The cycle counter is incremented with every CPU clock cycle
+ *          (GCLK). It has to be started once before the operating system is
+ *          started.
+ */
+extern void MCU_InitializeCycleCounter(void);
+
+/**
+ * @brief   Returns the current value of the PMU cycle counter.
+ * @details The counter wraps around after 2^32 CPU clock cycles.
+ * @return  current value of the cycle counter
+ */
+extern uint32_t MCU_GetCycleCount(void);
+
+/**
+ * @brief   Converts a difference of two cycle counter values to microseconds.
+ * @details The difference has to be computed with unsigned arithmetic, so
+ *          that a single wrap around of the counter is handled.
+ * @param   cycles  difference of two values of #MCU_GetCycleCount()
+ * @return  timespan in microseconds (rounded down)
+ */
+extern uint32_t MCU_ConvertCycleDifferenceToTimespan_us(uint32_t cycles);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 
 #endif /* FOXBMS__MCU_H_ */
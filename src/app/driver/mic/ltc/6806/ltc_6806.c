@@ -60,6 +60,7 @@
 #include "HL_spi.h"
 #include "HL_system.h"
 
+#include "cell_statistics.h"
 #include "database.h"
 #include "diag.h"
 #include "io.h"
@@ -403,56 +404,57 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
     /* Pointer validity check */
     FAS_ASSERT(ltc_state != NULL_PTR);
 
-    /* Iterate over all cell to:
+    /* Iterate over all modules to:
      *
      * 1. Check open-wires and set respective cell measurements to invalid
      * 2. Perform minimum/maximum measurement value plausibility check
      * 3. Calculate string values
      */
     STD_RETURN_TYPE_e cellVoltageMeasurementValid = STD_OK;
-    int32_t stringVoltage_mV                      = 0;
-    uint16_t numberValidMeasurements              = 0;
+    CSTAT_STATISTICS_s statistics                 = {0};
+    CSTAT_InitializeStatistics(&statistics);
     for (uint8_t m = 0u; m < BS_NR_OF_MODULES; m++) {
+        const uint8_t *pOpenWire =
+            &ltc_state->ltcData.openWire->openwire[stringNumber][m * (BS_NR_OF_CELLS_PER_MODULE + 1u)];
+        const int16_t *pCellVoltages =
+            &ltc_state->ltcData.cellVoltage->cellVoltage_mV[stringNumber][m * BS_NR_OF_CELLS_PER_MODULE];
+        /* Cell voltages that are already invalid because of a previous PEC error */
+        uint64_t invalidCellVoltages = ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m];
+
+        /* ------- 1. Check open-wires -----------------
+         * Cell voltage is invalid if cell N input or cell N+1 input is open wire
+         */
         for (uint8_t c = 0u; c < BS_NR_OF_CELLS_PER_MODULE; c++) {
-            /* ------- 1. Check open-wires -----------------
-                 * Is cell N input not open wire &&
-                 * Is cell N+1 input not open wire &&
-                 * Is cell voltage valid because of previous PEC error
-                 * If so, everything okay, else set cell voltage measurement to invalid.
-                 */
-            if ((ltc_state->ltcData.openWire->openwire[stringNumber][(m * (BS_NR_OF_CELLS_PER_MODULE + 1u)) + c] ==
-                 0u) &&
-                (ltc_state->ltcData.openWire->openwire[stringNumber][(m * (BS_NR_OF_CELLS_PER_MODULE + 1u)) + c + 1u] ==
-                 0u) &&
-                ((ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] & (0x01u << c)) == 0u)) {
-                /* Cell voltage is valid -> perform minimum/maximum plausibility check */
-
-                /* ------- 2. Perform minimum/maximum measurement range check ---------- */
-                if (STD_OK == MIC_PlausibilityCheckVoltageMeasurementRange(
-                                  ltc_state->ltcData.cellVoltage
-                                      ->cellVoltage_mV[stringNumber][(m * BS_NR_OF_CELLS_PER_MODULE) + c],
-                                  ltc_plausibleCellVoltages6806)) {
-                    /* Cell voltage is valid ->  calculate string voltage */
-                    /* -------- 3. Calculate string values ------------- */
-                    stringVoltage_mV += ltc_state->ltcData.cellVoltage
-                                            ->cellVoltage_mV[stringNumber][(m * BS_NR_OF_CELLS_PER_MODULE) + c];
-                    numberValidMeasurements++;
-                } else {
-                    /* Invalidate cell voltage measurement */
-                    ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] |= (0x01u << c);
-                    cellVoltageMeasurementValid = STD_NOT_OK;
-                }
-            } else {
-                /* Set cell voltage measurement value invalid, if not already invalid because of PEC Error */
-                ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] |= (0x01u << c);
-                cellVoltageMeasurementValid = STD_NOT_OK;
+            if ((pOpenWire[c] != 0u) || (pOpenWire[c + 1u] != 0u)) {
+                invalidCellVoltages |= (0x01ull << c);
             }
         }
+
+        /* ------- 2. Perform minimum/maximum measurement range check ---------- */
+        invalidCellVoltages |= CSTAT_GetOutOfRangeValues(
+            pCellVoltages,
+            BS_NR_OF_CELLS_PER_MODULE,
+            invalidCellVoltages,
+            ltc_plausibleCellVoltages6806.minimumPlausibleVoltage_mV,
+            ltc_plausibleCellVoltages6806.maximumPlausibleVoltage_mV);
+
+        /* -------- 3. Calculate string values ------------- */
+        CSTAT_AddValues(
+            pCellVoltages,
+            BS_NR_OF_CELLS_PER_MODULE,
+            invalidCellVoltages,
+            (uint16_t)(m * BS_NR_OF_CELLS_PER_MODULE),
+            &statistics);
+
+        if (CSTAT_CountValidValues(BS_NR_OF_CELLS_PER_MODULE, invalidCellVoltages) < BS_NR_OF_CELLS_PER_MODULE) {
+            cellVoltageMeasurementValid = STD_NOT_OK;
+        }
+        ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] = invalidCellVoltages;
     }
     DIAG_CheckEvent(
         cellVoltageMeasurementValid, DIAG_ID_MEASUREMENT_IC_CELL_VOLTAGE_MEAS_ERROR, DIAG_STRING, stringNumber);
-    ltc_state->ltcData.cellVoltage->packVoltage_mV[stringNumber]      = stringVoltage_mV;
-    ltc_state->ltcData.cellVoltage->nrValidCellVoltages[stringNumber] = numberValidMeasurements;
+    ltc_state->ltcData.cellVoltage->packVoltage_mV[stringNumber]      = statistics.sum;
+    ltc_state->ltcData.cellVoltage->nrValidCellVoltages[stringNumber] = statistics.nrOfValidValues;
 
     /* Increment state variable each time new values are written into database */
     ltc_state->ltcData.cellVoltage->state++;
@@ -1406,9 +1408,6 @@ static STD_RETURN_TYPE_e LTC_Init(
     uint32_t frameLength) {
     STD_RETURN_TYPE_e retVal = STD_NOT_OK;
 
-    uint8_t PEC_Check[6];
-    uint16_t PEC_result = 0;
-
     /* now construct the message to be sent: it contains the wanted data, PLUS the needed PECs */
     pTxBuff[0] = ltc_cmdWRCFG[0];
     pTxBuff[1] = ltc_cmdWRCFG[1];
@@ -1425,18 +1424,8 @@ static STD_RETURN_TYPE_e LTC_Init(
         pTxBuff[7u + (i * 8u)] = 0x00;
         pTxBuff[8u + (i * 8u)] = 0x00;
         pTxBuff[9u + (i * 8u)] = 0x00;
-
-        PEC_Check[0] = pTxBuff[4u + (i * 8u)];
-        PEC_Check[1] = pTxBuff[5u + (i * 8u)];
-        PEC_Check[2] = pTxBuff[6u + (i * 8u)];
-        PEC_Check[3] = pTxBuff[7u + (i * 8u)];
-        PEC_Check[4] = pTxBuff[8u + (i * 8u)];
-        PEC_Check[5] = pTxBuff[9u + (i * 8u)];
-
-        PEC_result              = LTC_pec15_calc(6, PEC_Check);
-        pTxBuff[10u + (i * 8u)] = (PEC_result >> 8u) & 0xFFu;
-        pTxBuff[11u + (i * 8u)] = PEC_result & 0xFFu;
     } /* end for */
+    LTC_SetFramePecs(pTxBuff, LTC_N_LTC);
 
     retVal = LTC_TransmitReceiveData(pSpiInterface, pTxBuff, pRxBuff, frameLength);
 
@@ -1536,28 +1525,13 @@ static STD_RETURN_TYPE_e LTC_RX_PECCheck(
     LTC_STATE_s *ltc_state,
     uint16_t *DataBufferSPI_RX_with_PEC,
     uint8_t stringNumber) {
-    uint16_t i               = 0;
     STD_RETURN_TYPE_e retVal = STD_OK;
-    uint8_t PEC_TX[2];
-    uint16_t PEC_result  = 0;
-    uint8_t PEC_Check[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
-    /* check all PECs and put data without command and PEC in DataBufferSPI_RX (easier to use) */
-    for (i = 0; i < LTC_N_LTC; i++) {
-        PEC_Check[0] = DataBufferSPI_RX_with_PEC[4u + (i * 8u)];
-        PEC_Check[1] = DataBufferSPI_RX_with_PEC[5u + (i * 8u)];
-        PEC_Check[2] = DataBufferSPI_RX_with_PEC[6u + (i * 8u)];
-        PEC_Check[3] = DataBufferSPI_RX_with_PEC[7u + (i * 8u)];
-        PEC_Check[4] = DataBufferSPI_RX_with_PEC[8u + (i * 8u)];
-        PEC_Check[5] = DataBufferSPI_RX_with_PEC[9u + (i * 8u)];
-
-        PEC_result = LTC_pec15_calc(6, PEC_Check);
-        PEC_TX[0]  = (uint8_t)((PEC_result >> 8u) & 0xFFu);
-        PEC_TX[1]  = (uint8_t)(PEC_result & 0xFFu);
-
-        /* if calculated PEC not equal to received PEC */
-        if ((PEC_TX[0] != DataBufferSPI_RX_with_PEC[10u + (i * 8u)]) ||
-            (PEC_TX[1] != DataBufferSPI_RX_with_PEC[11u + (i * 8u)])) {
+    uint32_t pecValid[LTC_PEC_VALID_MASK_WORDS(LTC_N_LTC)];
+
+    /* check the PECs of all LTCs of the daisy-chain in one pass */
+    (void)LTC_CheckFramePecs(DataBufferSPI_RX_with_PEC, LTC_N_LTC, pecValid);
+    for (uint16_t i = 0u; i < LTC_N_LTC; i++) {
+        if (LTC_PEC_IS_DEVICE_VALID(pecValid, i) == false) {
             /* update error table of the corresponding LTC only if PEC check is activated */
             if (LTC_DISCARD_PEC == false) {
                 ltc_state->ltcData.errorTable->PEC_valid[stringNumber][i] = false;
@@ -164,6 +164,21 @@
 /** LTC SPI wakeup time */
 #define LTC_SPI_WAKEUP_WAIT_TIME_US (30U)
 
+/**
+ * minimum time without activity after which the isoSPI ports enter IDLE;
+ * Tidle minimum (see LTC datasheet)
+ */
+#define LTC_TIDLE_MINIMUM_US (4300u)
+
+/** safety margin against #LTC_TIDLE_MINIMUM_US, e.g., for clock tolerances */
+#define LTC_TIDLE_SAFETY_MARGIN_US (1000u)
+
+/**
+ * time after the start of the last transfer in which the daisy-chain is
+ * still awake and the wake-up byte is skipped
+ */
+#define LTC_SPI_WAKEUP_VALIDITY_US (LTC_TIDLE_MINIMUM_US - LTC_TIDLE_SAFETY_MARGIN_US)
+
 /** LTC statemachine short time definition in ms */
 #define LTC_STATEMACH_SHORTTIME (1)
 
@@ -292,11 +307,12 @@
  */
 #define LTC_TransmitWakeUp(spi_ltcInterface) SPI_TransmitDummyByte(spi_ltcInterface, LTC_SPI_WAKEUP_WAIT_TIME_US)
 #define LTC_TransmitI2cCommand(spi_ltcInterface, txbuf) \
-    SPI_TransmitDataWithDummy(spi_ltcInterface, LTC_SPI_WAKEUP_WAIT_TIME_US, txbuf, 4 + 9)
+    SPI_TransmitDataWithDummy(spi_ltcInterface, LTC_SPI_WAKEUP_WAIT_TIME_US, LTC_SPI_WAKEUP_VALIDITY_US, txbuf, 4 + 9)
 #define LTC_TransmitCommand(spi_ltcInterface, command) \
-    SPI_TransmitDataWithDummy(spi_ltcInterface, LTC_SPI_WAKEUP_WAIT_TIME_US, command, 4)
+    SPI_TransmitDataWithDummy(spi_ltcInterface, LTC_SPI_WAKEUP_WAIT_TIME_US, LTC_SPI_WAKEUP_VALIDITY_US, command, 4)
 #define LTC_TransmitReceiveData(spi_ltcInterface, txbuf, rxbuf, length) \
-    SPI_TransmitReceiveDataWithDummyDma(spi_ltcInterface, LTC_SPI_WAKEUP_WAIT_TIME_US, txbuf, rxbuf, length)
+    SPI_TransmitReceiveDataWithDummyDma(                                  \
+        spi_ltcInterface, LTC_SPI_WAKEUP_WAIT_TIME_US, LTC_SPI_WAKEUP_VALIDITY_US, txbuf, rxbuf, length)
 /**@}*/
 
 /*========== Extern Constant and Variable Declarations ======================*/
@@ -60,6 +60,7 @@
 #include "HL_spi.h"
 #include "HL_system.h"
 
+#include "cell_statistics.h"
 #include "database.h"
 #include "diag.h"
 #include "io.h"
@@ -108,6 +109,12 @@
 /** maximum number of supported cells */
 #define LTC_MAX_SUPPORTED_CELLS (12u)
 
+/** number of cell voltage register groups that are read, each group holds three cell voltages */
+#define LTC_NUMBER_OF_VOLTAGE_REGISTER_GROUPS (BS_MAX_SUPPORTED_CELLS / 3u)
+
+/** number of auxiliary register groups that are read to get all GPIO voltages */
+#define LTC_NUMBER_OF_GPIO_REGISTER_GROUPS ((BS_MAX_SUPPORTED_CELLS > 12u) ? 4u : 2u)
+
 /*========== Static Constant and Variable Definitions =======================*/
 /**
  * PEC buffer for RX and TX
@@ -119,6 +126,12 @@ uint16_t ltc_TxPecBuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {0};
 #pragma SET_DATA_SECTION()
 /**@}*/
 
+/** receive buffers of the read commands of a transaction list */
+#pragma SET_DATA_SECTION(".sharedRAM")
+static uint16_t
+    ltc_transactionRxBuffer[LTC_TRANSACTION_LIST_MAXIMUM_LENGTH][LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {{0}};
+#pragma SET_DATA_SECTION()
+
 /** index of used cells */
 static uint16_t ltc_used_cells_index[BS_NR_OF_STRINGS] = {0};
 /** local copies of database tables */
@@ -209,6 +222,23 @@ static uint16_t ltc_cmdRDAUXB[4] = {0x00, 0x0E, 0x72, 0x9A};
 static uint16_t ltc_cmdRDAUXC[4] = {0x00, 0x0D, 0x64, 0xFE};
 static uint16_t ltc_cmdRDAUXD[4] = {0x00, 0x0F, 0xF9, 0xA8};
 
+/** read commands of the cell voltage register groups, in the order of the register sets */
+static uint16_t *const ltc_cmdRDCV[LTC_TRANSACTION_LIST_MAXIMUM_LENGTH] = {
+    ltc_cmdRDCVA,
+    ltc_cmdRDCVB,
+    ltc_cmdRDCVC,
+    ltc_cmdRDCVD,
+    ltc_cmdRDCVE,
+    ltc_cmdRDCVF};
+/** read commands of the auxiliary register groups, in the order of the register sets */
+static uint16_t *const ltc_cmdRDAUX[LTC_TRANSACTION_LIST_MAXIMUM_LENGTH] = {
+    ltc_cmdRDAUXA,
+    ltc_cmdRDAUXB,
+    ltc_cmdRDAUXC,
+    ltc_cmdRDAUXD,
+    NULL_PTR,
+    NULL_PTR};
+
 /* static uint16_t ltc_cmdMUTE[4] = {0x00, 0x28, 0xE8, 0x0E};                    !< MUTE discharging via S pins */
 /* static uint16_t ltc_cmdUNMUTE[4] = {0x00, 0x29, 0x63, 0x3C};                  !< UN-MUTE discharging via S pins */
 
@@ -362,6 +392,11 @@ static STD_RETURN_TYPE_e LTC_TX(
     uint16_t *pTxBuff,
     uint16_t *pRxBuff,
     uint32_t frameLength);
+static STD_RETURN_TYPE_e LTC_StartTransactionList(
+    LTC_STATE_s *ltc_state,
+    uint16_t *const *pCommands,
+    uint8_t nrOfCommands);
+static STD_RETURN_TYPE_e LTC_CheckTransactionListCompleted(LTC_STATE_s *ltc_state);
 static void LTC_SetMUXChCommand(uint16_t *pTxBuff, uint8_t mux, uint8_t channel);
 static STD_RETURN_TYPE_e LTC_SendEEPROMReadCommand(
     LTC_STATE_s *ltc_state,
@@ -570,56 +605,57 @@ extern void LTC_SaveVoltages(LTC_STATE_s *ltc_state, uint8_t stringNumber) {
     FAS_ASSERT(ltc_state != NULL_PTR);
     FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
 
-    /* Iterate over all cell to:
+    /* Iterate over all modules to:
      *
      * 1. Check open-wires and set respective cell measurements to invalid
      * 2. Perform minimum/maximum measurement value plausibility check
      * 3. Calculate string values
      */
     STD_RETURN_TYPE_e cellVoltageMeasurementValid = STD_OK;
-    int32_t stringVoltage_mV                      = 0;
-    uint16_t numberValidMeasurements              = 0;
+    CSTAT_STATISTICS_s statistics                 = {0};
+    CSTAT_InitializeStatistics(&statistics);
     for (uint8_t m = 0u; m < BS_NR_OF_MODULES; m++) {
+        const uint8_t *pOpenWire =
+            &ltc_state->ltcData.openWire->openwire[stringNumber][m * (BS_NR_OF_CELLS_PER_MODULE + 1u)];
+        const int16_t *pCellVoltages =
+            &ltc_state->ltcData.cellVoltage->cellVoltage_mV[stringNumber][m * BS_NR_OF_CELLS_PER_MODULE];
+        /* Cell voltages that are already invalid because of a previous PEC error */
+        uint64_t invalidCellVoltages = ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m];
+
+        /* ------- 1. Check open-wires -----------------
+         * Cell voltage is invalid if cell N input or cell N+1 input is open wire
+         */
         for (uint8_t c = 0u; c < BS_NR_OF_CELLS_PER_MODULE; c++) {
-            /* ------- 1. Check open-wires -----------------
-                 * Is cell N input not open wire &&
-                 * Is cell N+1 input not open wire &&
-                 * Is cell voltage valid because of previous PEC error
-                 * If so, everything okay, else set cell voltage measurement to invalid.
-                 */
-            if ((ltc_state->ltcData.openWire->openwire[stringNumber][(m * (BS_NR_OF_CELLS_PER_MODULE + 1u)) + c] ==
-                 0u) &&
-                (ltc_state->ltcData.openWire->openwire[stringNumber][(m * (BS_NR_OF_CELLS_PER_MODULE + 1u)) + c + 1u] ==
-                 0u) &&
-                ((ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] & (0x01u << c)) == 0u)) {
-                /* Cell voltage is valid -> perform minimum/maximum plausibility check */
-
-                /* ------- 2. Perform minimum/maximum measurement range check ---------- */
-                if (STD_OK == MIC_PlausibilityCheckVoltageMeasurementRange(
-                                  ltc_state->ltcData.cellVoltage
-                                      ->cellVoltage_mV[stringNumber][(m * BS_NR_OF_CELLS_PER_MODULE) + c],
-                                  ltc_plausibleCellVoltages681x)) {
-                    /* Cell voltage is valid ->  calculate string voltage */
-                    /* -------- 3. Calculate string values ------------- */
-                    stringVoltage_mV += ltc_state->ltcData.cellVoltage
-                                            ->cellVoltage_mV[stringNumber][(m * BS_NR_OF_CELLS_PER_MODULE) + c];
-                    numberValidMeasurements++;
-                } else {
-                    /* Invalidate cell voltage measurement */
-                    ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] |= (0x01u << c);
-                    cellVoltageMeasurementValid = STD_NOT_OK;
-                }
-            } else {
-                /* Set cell voltage measurement value invalid, if not already invalid because of PEC Error */
-                ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] |= (0x01u << c);
-                cellVoltageMeasurementValid = STD_NOT_OK;
+            if ((pOpenWire[c] != 0u) || (pOpenWire[c + 1u] != 0u)) {
+                invalidCellVoltages |= (0x01ull << c);
             }
         }
+
+        /* ------- 2. Perform minimum/maximum measurement range check ---------- */
+        invalidCellVoltages |= CSTAT_GetOutOfRangeValues(
+            pCellVoltages,
+            BS_NR_OF_CELLS_PER_MODULE,
+            invalidCellVoltages,
+            ltc_plausibleCellVoltages681x.minimumPlausibleVoltage_mV,
+            ltc_plausibleCellVoltages681x.maximumPlausibleVoltage_mV);
+
+        /* -------- 3. Calculate string values ------------- */
+        CSTAT_AddValues(
+            pCellVoltages,
+            BS_NR_OF_CELLS_PER_MODULE,
+            invalidCellVoltages,
+            (uint16_t)(m * BS_NR_OF_CELLS_PER_MODULE),
+            &statistics);
+
+        if (CSTAT_CountValidValues(BS_NR_OF_CELLS_PER_MODULE, invalidCellVoltages) < BS_NR_OF_CELLS_PER_MODULE) {
+            cellVoltageMeasurementValid = STD_NOT_OK;
+        }
+        ltc_state->ltcData.cellVoltage->invalidCellVoltage[stringNumber][m] = invalidCellVoltages;
     }
     DIAG_CheckEvent(
         cellVoltageMeasurementValid, DIAG_ID_MEASUREMENT_IC_CELL_VOLTAGE_MEAS_ERROR, DIAG_STRING, stringNumber);
-    ltc_state->ltcData.cellVoltage->packVoltage_mV[stringNumber]      = stringVoltage_mV;
-    ltc_state->ltcData.cellVoltage->nrValidCellVoltages[stringNumber] = numberValidMeasurements;
+    ltc_state->ltcData.cellVoltage->packVoltage_mV[stringNumber]      = statistics.sum;
+    ltc_state->ltcData.cellVoltage->nrValidCellVoltages[stringNumber] = statistics.nrOfValidValues;
 
     /* Increment state variable each time new values are written into database */
     ltc_state->ltcData.cellVoltage->state++;
@@ -1010,180 +1046,32 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
 
                 if (ltc_state->substate == LTC_READ_VOLTAGE_REGISTER_A_RDCVA_READVOLTAGE) {
                     ltc_state->check_spi_flag = STD_OK;
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDCVA,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
-                    LTC_CondBasedStateTransition(
-                        ltc_state,
-                        retVal,
-                        DIAG_ID_LTC_SPI,
-                        LTC_STATEMACH_READVOLTAGE,
-                        LTC_READ_VOLTAGE_REGISTER_B_RDCVB_READVOLTAGE,
-                        (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                        LTC_STATEMACH_READVOLTAGE,
-                        LTC_READ_VOLTAGE_REGISTER_B_RDCVB_READVOLTAGE,
-                        LTC_STATEMACH_SHORTTIME);
-                    break;
-
-                } else if (ltc_state->substate == LTC_READ_VOLTAGE_REGISTER_B_RDCVB_READVOLTAGE) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-                    LTC_SaveRXtoVoltagebuffer(ltc_state, ltc_state->ltcData.rxBuffer, 0, ltc_state->currentString);
-
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDCVB,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
-                    LTC_CondBasedStateTransition(
-                        ltc_state,
-                        retVal,
-                        DIAG_ID_LTC_SPI,
-                        LTC_STATEMACH_READVOLTAGE,
-                        LTC_READ_VOLTAGE_REGISTER_C_RDCVC_READVOLTAGE,
-                        (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                        LTC_STATEMACH_READVOLTAGE,
-                        LTC_READ_VOLTAGE_REGISTER_C_RDCVC_READVOLTAGE,
-                        LTC_STATEMACH_SHORTTIME);
-                    break;
-
-                } else if (ltc_state->substate == LTC_READ_VOLTAGE_REGISTER_C_RDCVC_READVOLTAGE) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-                    LTC_SaveRXtoVoltagebuffer(ltc_state, ltc_state->ltcData.rxBuffer, 1, ltc_state->currentString);
-
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDCVC,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
-                    LTC_CondBasedStateTransition(
-                        ltc_state,
-                        retVal,
-                        DIAG_ID_LTC_SPI,
-                        LTC_STATEMACH_READVOLTAGE,
-                        LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE,
-                        (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                        LTC_STATEMACH_READVOLTAGE,
-                        LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE,
-                        LTC_STATEMACH_SHORTTIME);
-                    break;
-
-                } else if (ltc_state->substate == LTC_READ_VOLTAGE_REGISTER_D_RDCVD_READVOLTAGE) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-                    LTC_SaveRXtoVoltagebuffer(ltc_state, ltc_state->ltcData.rxBuffer, 2, ltc_state->currentString);
-
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDCVD,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
-                    if (BS_MAX_SUPPORTED_CELLS > 12) {
-                        LTC_CondBasedStateTransition(
-                            ltc_state,
-                            retVal,
-                            DIAG_ID_LTC_SPI,
-                            LTC_STATEMACH_READVOLTAGE,
-                            LTC_READ_VOLTAGE_REGISTER_E_RDCVE_READVOLTAGE,
-                            (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                            LTC_STATEMACH_READVOLTAGE,
-                            LTC_READ_VOLTAGE_REGISTER_E_RDCVE_READVOLTAGE,
-                            LTC_STATEMACH_SHORTTIME);
-                    } else {
-                        LTC_CondBasedStateTransition(
-                            ltc_state,
-                            retVal,
-                            DIAG_ID_LTC_SPI,
-                            LTC_STATEMACH_READVOLTAGE,
-                            LTC_EXIT_READVOLTAGE,
-                            (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                            LTC_STATEMACH_READVOLTAGE,
-                            LTC_EXIT_READVOLTAGE,
-                            LTC_STATEMACH_SHORTTIME);
-                    }
-                    break;
-
-                } else if (ltc_state->substate == LTC_READ_VOLTAGE_REGISTER_E_RDCVE_READVOLTAGE) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-                    LTC_SaveRXtoVoltagebuffer(ltc_state, ltc_state->ltcData.rxBuffer, 3, ltc_state->currentString);
-
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDCVE,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
-                    if (BS_MAX_SUPPORTED_CELLS > 15) {
-                        LTC_CondBasedStateTransition(
-                            ltc_state,
-                            retVal,
-                            DIAG_ID_LTC_SPI,
-                            LTC_STATEMACH_READVOLTAGE,
-                            LTC_READ_VOLTAGE_REGISTER_F_RDCVF_READVOLTAGE,
-                            (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                            LTC_STATEMACH_READVOLTAGE,
-                            LTC_READ_VOLTAGE_REGISTER_F_RDCVF_READVOLTAGE,
-                            LTC_STATEMACH_SHORTTIME);
-                    } else {
-                        LTC_CondBasedStateTransition(
-                            ltc_state,
-                            retVal,
-                            DIAG_ID_LTC_SPI,
-                            LTC_STATEMACH_READVOLTAGE,
-                            LTC_EXIT_READVOLTAGE,
-                            (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                            LTC_STATEMACH_READVOLTAGE,
-                            LTC_EXIT_READVOLTAGE,
-                            LTC_STATEMACH_SHORTTIME);
-                    }
-                    break;
-
-                } else if (ltc_state->substate == LTC_READ_VOLTAGE_REGISTER_F_RDCVF_READVOLTAGE) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-                    LTC_SaveRXtoVoltagebuffer(ltc_state, ltc_state->ltcData.rxBuffer, 4, ltc_state->currentString);
-
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDCVF,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
+                    /* read all voltage register groups back to back */
+                    retVal = LTC_StartTransactionList(ltc_state, ltc_cmdRDCV, LTC_NUMBER_OF_VOLTAGE_REGISTER_GROUPS);
                     LTC_CondBasedStateTransition(
                         ltc_state,
                         retVal,
                         DIAG_ID_LTC_SPI,
                         LTC_STATEMACH_READVOLTAGE,
                         LTC_EXIT_READVOLTAGE,
-                        (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
+                        ((LTC_NUMBER_OF_VOLTAGE_REGISTER_GROUPS * ltc_state->commandDataTransferTime) +
+                         LTC_TRANSMISSION_TIMEOUT),
                         LTC_STATEMACH_READVOLTAGE,
                         LTC_EXIT_READVOLTAGE,
                         LTC_STATEMACH_SHORTTIME);
                     break;
 
                 } else if (ltc_state->substate == LTC_EXIT_READVOLTAGE) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-                    if (BS_MAX_SUPPORTED_CELLS == 12) {
-                        LTC_SaveRXtoVoltagebuffer(ltc_state, ltc_state->ltcData.rxBuffer, 3, ltc_state->currentString);
-                    } else if (BS_MAX_SUPPORTED_CELLS == 15) {
-                        LTC_SaveRXtoVoltagebuffer(ltc_state, ltc_state->ltcData.rxBuffer, 4, ltc_state->currentString);
-                    } else if (BS_MAX_SUPPORTED_CELLS == 18) {
-                        LTC_SaveRXtoVoltagebuffer(ltc_state, ltc_state->ltcData.rxBuffer, 5, ltc_state->currentString);
+                    retVal = LTC_CheckTransactionListCompleted(ltc_state);
+                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_SPI, DIAG_STRING, ltc_state->currentString);
+                    /* decode all voltage register groups in one pass */
+                    for (uint8_t i = 0u; i < LTC_NUMBER_OF_VOLTAGE_REGISTER_GROUPS; i++) {
+                        LTC_TRANSACTION_s *pTransaction = &ltc_state->transactionList.transactions[i];
+
+                        retVal = LTC_RX_PECCheck(ltc_state, pTransaction->pRxBuffer, ltc_state->currentString);
+                        DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
+                        LTC_SaveRXtoVoltagebuffer(
+                            ltc_state, pTransaction->pRxBuffer, pTransaction->registerSet, ltc_state->currentString);
                     }
 
                     /* Switch to different state if read voltage state is reused
@@ -1620,119 +1508,32 @@ void LTC_Trigger(LTC_STATE_s *ltc_state) {
 
                 if (ltc_state->substate == LTC_READ_AUXILIARY_REGISTER_A_RDAUXA) {
                     ltc_state->check_spi_flag = STD_OK;
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDAUXA,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
-                    LTC_CondBasedStateTransition(
-                        ltc_state,
-                        retVal,
-                        DIAG_ID_LTC_SPI,
-                        LTC_STATEMACH_READALLGPIO,
-                        LTC_READ_AUXILIARY_REGISTER_B_RDAUXB,
-                        (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                        LTC_STATEMACH_READALLGPIO,
-                        LTC_READ_AUXILIARY_REGISTER_B_RDAUXB,
-                        LTC_STATEMACH_SHORTTIME);
-                    break;
-
-                } else if (ltc_state->substate == LTC_READ_AUXILIARY_REGISTER_B_RDAUXB) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-                    LTC_SaveRXtoGPIOBuffer(ltc_state, ltc_state->ltcData.rxBuffer, 0, ltc_state->currentString);
-
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDAUXB,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
-
-                    if (BS_MAX_SUPPORTED_CELLS > 12) {
-                        LTC_CondBasedStateTransition(
-                            ltc_state,
-                            retVal,
-                            DIAG_ID_LTC_SPI,
-                            LTC_STATEMACH_READALLGPIO,
-                            LTC_READ_AUXILIARY_REGISTER_C_RDAUXC,
-                            (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                            LTC_STATEMACH_READALLGPIO,
-                            LTC_READ_AUXILIARY_REGISTER_C_RDAUXC,
-                            LTC_STATEMACH_SHORTTIME);
-                    } else {
-                        LTC_CondBasedStateTransition(
-                            ltc_state,
-                            retVal,
-                            DIAG_ID_LTC_SPI,
-                            LTC_STATEMACH_READALLGPIO,
-                            LTC_EXIT_READAUXILIARY_ALLGPIOS,
-                            (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                            LTC_STATEMACH_READALLGPIO,
-                            LTC_EXIT_READAUXILIARY_ALLGPIOS,
-                            LTC_STATEMACH_SHORTTIME);
-                    }
-                    break;
-
-                } else if (ltc_state->substate == LTC_READ_AUXILIARY_REGISTER_C_RDAUXC) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-                    LTC_SaveRXtoGPIOBuffer(ltc_state, ltc_state->ltcData.rxBuffer, 1, ltc_state->currentString);
-
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDAUXC,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
-                    LTC_CondBasedStateTransition(
-                        ltc_state,
-                        retVal,
-                        DIAG_ID_LTC_SPI,
-                        LTC_STATEMACH_READALLGPIO,
-                        LTC_READ_AUXILIARY_REGISTER_D_RDAUXD,
-                        (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
-                        LTC_STATEMACH_READALLGPIO,
-                        LTC_READ_AUXILIARY_REGISTER_D_RDAUXD,
-                        LTC_STATEMACH_SHORTTIME);
-                    break;
-
-                } else if (ltc_state->substate == LTC_READ_AUXILIARY_REGISTER_D_RDAUXD) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-                    LTC_SaveRXtoGPIOBuffer(ltc_state, ltc_state->ltcData.rxBuffer, 2, ltc_state->currentString);
-
-                    MIC_SetTransmitOngoing(ltc_state);
-                    retVal = LTC_RX(
-                        ltc_cmdRDAUXD,
-                        ltc_state->spiSeqPtr,
-                        ltc_state->ltcData.txBuffer,
-                        ltc_state->ltcData.rxBuffer,
-                        ltc_state->ltcData.frameLength);
+                    /* read all auxiliary register groups back to back */
+                    retVal = LTC_StartTransactionList(ltc_state, ltc_cmdRDAUX, LTC_NUMBER_OF_GPIO_REGISTER_GROUPS);
                     LTC_CondBasedStateTransition(
                         ltc_state,
                         retVal,
                         DIAG_ID_LTC_SPI,
                         LTC_STATEMACH_READALLGPIO,
                         LTC_EXIT_READAUXILIARY_ALLGPIOS,
-                        (ltc_state->commandDataTransferTime + LTC_TRANSMISSION_TIMEOUT),
+                        ((LTC_NUMBER_OF_GPIO_REGISTER_GROUPS * ltc_state->commandDataTransferTime) +
+                         LTC_TRANSMISSION_TIMEOUT),
                         LTC_STATEMACH_READALLGPIO,
                         LTC_EXIT_READAUXILIARY_ALLGPIOS,
                         LTC_STATEMACH_SHORTTIME);
                     break;
 
                 } else if (ltc_state->substate == LTC_EXIT_READAUXILIARY_ALLGPIOS) {
-                    retVal = LTC_RX_PECCheck(ltc_state, ltc_state->ltcData.rxBuffer, ltc_state->currentString);
-                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
-
-                    if (BS_MAX_SUPPORTED_CELLS == 12) {
-                        LTC_SaveRXtoGPIOBuffer(ltc_state, ltc_state->ltcData.rxBuffer, 1, ltc_state->currentString);
-                    } else if (BS_MAX_SUPPORTED_CELLS > 12) {
-                        LTC_SaveRXtoGPIOBuffer(ltc_state, ltc_state->ltcData.rxBuffer, 3, ltc_state->currentString);
+                    retVal = LTC_CheckTransactionListCompleted(ltc_state);
+                    DIAG_CheckEvent(retVal, DIAG_ID_LTC_SPI, DIAG_STRING, ltc_state->currentString);
+                    /* decode all auxiliary register groups in one pass */
+                    for (uint8_t i = 0u; i < LTC_NUMBER_OF_GPIO_REGISTER_GROUPS; i++) {
+                        LTC_TRANSACTION_s *pTransaction = &ltc_state->transactionList.transactions[i];
+
+                        retVal = LTC_RX_PECCheck(ltc_state, pTransaction->pRxBuffer, ltc_state->currentString);
+                        DIAG_CheckEvent(retVal, DIAG_ID_LTC_PEC, DIAG_STRING, ltc_state->currentString);
+                        LTC_SaveRXtoGPIOBuffer(
+                            ltc_state, pTransaction->pRxBuffer, pTransaction->registerSet, ltc_state->currentString);
                     }
 
                     LTC_SaveAllGPIOMeasurement(ltc_state);
@@ -3231,9 +3032,6 @@ static STD_RETURN_TYPE_e LTC_Init(
     uint32_t frameLength) {
     STD_RETURN_TYPE_e retVal = STD_NOT_OK;
 
-    uint8_t PEC_Check[6];
-    uint16_t PEC_result = 0;
-
     /* now construct the message to be sent: it contains the wanted data, PLUS the needed PECs */
     pTxBuff[0] = ltc_cmdWRCFG[0];
     pTxBuff[1] = ltc_cmdWRCFG[1];
@@ -3250,18 +3048,8 @@ static STD_RETURN_TYPE_e LTC_Init(
         pTxBuff[7u + (i * 8u)] = 0x00;
         pTxBuff[8u + (i * 8u)] = 0x00;
         pTxBuff[9u + (i * 8u)] = 0x00;
-
-        PEC_Check[0] = pTxBuff[4u + (i * 8u)];
-        PEC_Check[1] = pTxBuff[5u + (i * 8u)];
-        PEC_Check[2] = pTxBuff[6u + (i * 8u)];
-        PEC_Check[3] = pTxBuff[7u + (i * 8u)];
-        PEC_Check[4] = pTxBuff[8u + (i * 8u)];
-        PEC_Check[5] = pTxBuff[9u + (i * 8u)];
-
-        PEC_result              = LTC_pec15_calc(6, PEC_Check);
-        pTxBuff[10u + (i * 8u)] = (PEC_result >> 8u) & 0xFFu;
-        pTxBuff[11u + (i * 8u)] = PEC_result & 0xFFu;
     } /* end for */
+    LTC_SetFramePecs(pTxBuff, LTC_N_LTC);
 
     retVal = LTC_TransmitReceiveData(pSpiInterface, pTxBuff, pRxBuff, frameLength);
 
@@ -3295,9 +3083,6 @@ static STD_RETURN_TYPE_e LTC_BalanceControl(
     uint8_t stringNumber) {
     STD_RETURN_TYPE_e retVal = STD_OK;
 
-    uint8_t PEC_Check[6];
-    uint16_t PEC_result = 0;
-
     LTC_Get_BalancingControlValues(ltc_state);
 
     if (registerSet == 0u) { /* cells 1 to 12, WRCFG */
@@ -3364,18 +3149,8 @@ static STD_RETURN_TYPE_e LTC_BalanceControl(
                     ->balancingState[stringNumber][(j * (BS_NR_OF_CELLS_PER_MODULE)) + 11u] == 1u) {
                 pTxBuff[9u + (i * 8u)] |= 0x08u;
             }
-
-            PEC_Check[0] = pTxBuff[4u + (i * 8u)];
-            PEC_Check[1] = pTxBuff[5u + (i * 8u)];
-            PEC_Check[2] = pTxBuff[6u + (i * 8u)];
-            PEC_Check[3] = pTxBuff[7u + (i * 8u)];
-            PEC_Check[4] = pTxBuff[8u + (i * 8u)];
-            PEC_Check[5] = pTxBuff[9u + (i * 8u)];
-
-            PEC_result              = LTC_pec15_calc(6, PEC_Check);
-            pTxBuff[10u + (i * 8u)] = (PEC_result >> 8u) & 0xFFu;
-            pTxBuff[11u + (i * 8u)] = PEC_result & 0xFFu;
         }
+        LTC_SetFramePecs(pTxBuff, LTC_N_LTC);
         retVal = LTC_TransmitReceiveData(pSpiInterface, pTxBuff, pRxBuff, frameLength);
     } else if (registerSet == 1u) { /* cells 13 to 15/18 WRCFG2 */
         pTxBuff[0] = ltc_cmdWRCFG2[0];
@@ -3419,18 +3194,8 @@ static STD_RETURN_TYPE_e LTC_BalanceControl(
                     pTxBuff[5u + (i * 8u)] |= 0x02u;
                 }
             }
-
-            PEC_Check[0] = pTxBuff[4u + (i * 8u)];
-            PEC_Check[1] = pTxBuff[5u + (i * 8u)];
-            PEC_Check[2] = pTxBuff[6u + (i * 8u)];
-            PEC_Check[3] = pTxBuff[7u + (i * 8u)];
-            PEC_Check[4] = pTxBuff[8u + (i * 8u)];
-            PEC_Check[5] = pTxBuff[9u + (i * 8u)];
-
-            PEC_result              = LTC_pec15_calc(6, PEC_Check);
-            pTxBuff[10u + (i * 8u)] = (PEC_result >> 8u) & 0xFFu;
-            pTxBuff[11u + (i * 8u)] = PEC_result & 0xFFu;
         }
+        LTC_SetFramePecs(pTxBuff, LTC_N_LTC);
         retVal = LTC_TransmitReceiveData(pSpiInterface, pTxBuff, pRxBuff, frameLength);
     } else {
         retVal = STD_NOT_OK;
@@ -3673,26 +3438,12 @@ static STD_RETURN_TYPE_e LTC_RX_PECCheck(
     uint16_t *DataBufferSPI_RX_with_PEC,
     uint8_t stringNumber) {
     STD_RETURN_TYPE_e retVal = STD_OK;
-    uint8_t PEC_TX[2];
-    uint16_t PEC_result  = 0;
-    uint8_t PEC_Check[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    uint32_t pecValid[LTC_PEC_VALID_MASK_WORDS(LTC_N_LTC)];
 
-    /* check all PECs and put data without command and PEC in DataBufferSPI_RX (easier to use) */
-    for (uint16_t i = 0; i < LTC_N_LTC; i++) {
-        PEC_Check[0] = DataBufferSPI_RX_with_PEC[4u + (i * 8u)];
-        PEC_Check[1] = DataBufferSPI_RX_with_PEC[5u + (i * 8u)];
-        PEC_Check[2] = DataBufferSPI_RX_with_PEC[6u + (i * 8u)];
-        PEC_Check[3] = DataBufferSPI_RX_with_PEC[7u + (i * 8u)];
-        PEC_Check[4] = DataBufferSPI_RX_with_PEC[8u + (i * 8u)];
-        PEC_Check[5] = DataBufferSPI_RX_with_PEC[9u + (i * 8u)];
-
-        PEC_result = LTC_pec15_calc(6, PEC_Check);
-        PEC_TX[0]  = (uint8_t)((PEC_result >> 8u) & 0xFFu);
-        PEC_TX[1]  = (uint8_t)(PEC_result & 0xFFu);
-
-        /* if calculated PEC not equal to received PEC */
-        if ((PEC_TX[0] != DataBufferSPI_RX_with_PEC[10u + (i * 8u)]) ||
-            (PEC_TX[1] != DataBufferSPI_RX_with_PEC[11u + (i * 8u)])) {
+    /* check the PECs of all LTCs of the daisy-chain in one pass */
+    (void)LTC_CheckFramePecs(DataBufferSPI_RX_with_PEC, LTC_N_LTC, pecValid);
+    for (uint16_t i = 0u; i < LTC_N_LTC; i++) {
+        if (LTC_PEC_IS_DEVICE_VALID(pecValid, i) == false) {
             /* update error table of the corresponding LTC only if PEC check is activated */
             if (LTC_DISCARD_PEC == false) {
                 ltc_state->ltcData.errorTable->PEC_valid[stringNumber][i] = false;
@@ -3756,6 +3507,86 @@ static STD_RETURN_TYPE_e LTC_RX(
     return retVal;
 }
 
+/**
+ * @brief   reads several register groups of the LTC daisy-chain back to back.
+ *
+ * The read commands are queued in the transaction list of the state machine,
+ * each with its own receive buffer. The first read command is sent here,
+ * including the wake-up of the daisy-chain. Every following read command is
+ * started from the DMA complete interrupt of the previous one, so that the
+ * whole list is transmitted within the wire time instead of one read command
+ * per call of the state machine. The transmission is ongoing until the last
+ * read command has been completed.
+ *
+ * The receive buffers are cleared before the transmission: a read command
+ * that has not been completed fails the PEC check.
+ *
+ * @param   ltc_state      state of the ltc state machine
+ * @param   pCommands      read commands, the index is used as register set
+ * @param   nrOfCommands   number of read commands to send
+ *
+ * @return  #STD_OK if the transmission was started, #STD_NOT_OK otherwise
+ *
+ */
+static STD_RETURN_TYPE_e LTC_StartTransactionList(
+    LTC_STATE_s *ltc_state,
+    uint16_t *const *pCommands,
+    uint8_t nrOfCommands) {
+    FAS_ASSERT(nrOfCommands <= LTC_TRANSACTION_LIST_MAXIMUM_LENGTH);
+    FAS_ASSERT(nrOfCommands > 0u);
+    STD_RETURN_TYPE_e retVal            = STD_NOT_OK;
+    LTC_TRANSACTION_LIST_s *const pList = &ltc_state->transactionList;
+
+    MIC_ClearTransactionList(
+        pList, ltc_state->spiSeqPtr, ltc_state->ltcData.txBuffer, ltc_state->ltcData.frameLength);
+    for (uint8_t i = 0u; i < nrOfCommands; i++) {
+        for (uint16_t j = 0u; j < LTC_N_BYTES_FOR_DATA_TRANSMISSION; j++) {
+            ltc_transactionRxBuffer[i][j] = 0u;
+        }
+        (void)MIC_QueueTransaction(pList, pCommands[i], ltc_transactionRxBuffer[i], i);
+    }
+
+    /* the DMA callback continues the list once the first read command has been completed */
+    pList->next = 1u;
+    MIC_SetTransmitOngoing(ltc_state);
+    retVal = LTC_RX(
+        pList->transactions[0u].pCommand,
+        pList->pSpiInterface,
+        pList->pTxBuffer,
+        pList->transactions[0u].pRxBuffer,
+        pList->frameLength);
+    if (retVal != STD_OK) {
+        pList->next = 0u;
+    }
+    return retVal;
+}
+
+/**
+ * @brief   ends the transmission of a transaction list.
+ *
+ * Read commands that have not been sent yet are dropped. The received data
+ * remains in the receive buffers of the list until the next list is started.
+ *
+ * @param   ltc_state      state of the ltc state machine
+ *
+ * @return  #STD_OK if all read commands of the list have been completed, #STD_NOT_OK otherwise
+ *
+ */
+static STD_RETURN_TYPE_e LTC_CheckTransactionListCompleted(LTC_STATE_s *ltc_state) {
+    STD_RETURN_TYPE_e retVal            = STD_NOT_OK;
+    LTC_TRANSACTION_LIST_s *const pList = &ltc_state->transactionList;
+
+    OS_EnterTaskCritical();
+    if ((pList->length > 0u) && (pList->completed == pList->length)) {
+        retVal = STD_OK;
+    }
+    /* stop the DMA callback from starting further read commands */
+    pList->length = pList->next;
+    OS_ExitTaskCritical();
+
+    return retVal;
+}
+
 /**
  * @brief   sends command and data to the LTC daisy-chain.
  *
@@ -3787,27 +3618,13 @@ static STD_RETURN_TYPE_e LTC_TX(
     uint32_t frameLength) {
     STD_RETURN_TYPE_e retVal = STD_NOT_OK;
 
-    uint16_t PEC_result  = 0;
-    uint8_t PEC_Check[6] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
-
     pTxBuff[0] = Command[0];
     pTxBuff[1] = Command[1];
     pTxBuff[2] = Command[2];
     pTxBuff[3] = Command[3];
 
     /* Calculate PEC of all data (1 PEC value for 6 bytes) */
-    for (uint16_t i = 0u; i < LTC_N_LTC; i++) {
-        PEC_Check[0] = pTxBuff[4u + (i * 8u)];
-        PEC_Check[1] = pTxBuff[5u + (i * 8u)];
-        PEC_Check[2] = pTxBuff[6u + (i * 8u)];
-        PEC_Check[3] = pTxBuff[7u + (i * 8u)];
-        PEC_Check[4] = pTxBuff[8u + (i * 8u)];
-        PEC_Check[5] = pTxBuff[9u + (i * 8u)];
-
-        PEC_result              = LTC_pec15_calc(6, PEC_Check);
-        pTxBuff[10u + (i * 8u)] = (PEC_result >> 8u) & 0xFFu;
-        pTxBuff[11u + (i * 8u)] = PEC_result & 0xFFu;
-    }
+    LTC_SetFramePecs(pTxBuff, LTC_N_LTC);
 
     retVal = LTC_TransmitReceiveData(pSpiInterface, pTxBuff, pRxBuff, frameLength);
 
@@ -4540,6 +4357,17 @@ extern void TEST_LTC_SetFirstMeasurementCycleFinished(LTC_STATE_s *ltc_state) {
     LTC_SetFirstMeasurementCycleFinished(ltc_state);
 }
 
+extern STD_RETURN_TYPE_e TEST_LTC_StartTransactionList(
+    LTC_STATE_s *ltc_state,
+    uint16_t *const *pCommands,
+    uint8_t nrOfCommands) {
+    return LTC_StartTransactionList(ltc_state, pCommands, nrOfCommands);
+}
+
+extern STD_RETURN_TYPE_e TEST_LTC_CheckTransactionListCompleted(LTC_STATE_s *ltc_state) {
+    return LTC_CheckTransactionListCompleted(ltc_state);
+}
+
 /** this define is used for creating the declaration of a function for variable extraction */
 #define TEST_LTC_DEFINE_GET(VARIABLE)                      \
     extern void TEST_LTC_Get_##VARIABLE(uint8_t data[4]) { \
@@ -83,6 +83,13 @@
  */
 #define LTC_N_BYTES_FOR_DATA_TRANSMISSION_DATA_ONLY (0 + (6 * LTC_N_LTC))
 
+/**
+ * Time in us chip select is held high between two read commands of a
+ * transaction list. Gives the isoSPI interface time to signal the end of the
+ * previous command to the daisy-chain before the next command starts.
+ */
+#define LTC_TRANSACTION_CS_HIGH_TIME_US (2u)
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -178,6 +178,11 @@ extern void LTC_monitoringPinInit(void);
 #ifdef UNITY_UNIT_TEST
 extern uint8_t TEST_LTC_CheckReEntrance();
 extern void TEST_LTC_SetFirstMeasurementCycleFinished(LTC_STATE_s *ltc_state);
+extern STD_RETURN_TYPE_e TEST_LTC_StartTransactionList(
+    LTC_STATE_s *ltc_state,
+    uint16_t *const *pCommands,
+    uint8_t nrOfCommands);
+extern STD_RETURN_TYPE_e TEST_LTC_CheckTransactionListCompleted(LTC_STATE_s *ltc_state);
 
 /** this define is used for creating the declaration of a function for variable extraction
  *  deviate from style guide in order to make the variable name better recognizable
@@ -511,6 +511,32 @@ typedef struct {
     uint8_t string;              /*!<    */
 } LTC_REQUEST_s;
 
+/** maximum number of read commands that are queued in one transaction list */
+#define LTC_TRANSACTION_LIST_MAXIMUM_LENGTH (6u)
+
+/** one read command of a transaction list */
+typedef struct {
+    uint16_t *pCommand;  /*!< command including PEC (4 words) */
+    uint16_t *pRxBuffer; /*!< buffer that receives the answer of the daisy-chain */
+    uint8_t registerSet; /*!< register group that is read, used to decode the answer */
+} LTC_TRANSACTION_s;
+
+/**
+ * List of read commands that are transmitted back to back. The first transfer
+ * is started by the state machine, all following transfers are started from
+ * the DMA complete interrupt of the previous transfer.
+ */
+typedef struct {
+    uint8_t length;                        /*!< number of queued read commands */
+    uint8_t next;                          /*!< index of the next read command to be transmitted */
+    uint8_t completed;                     /*!< number of read commands that have been completed */
+    SPI_INTERFACE_CONFIG_s *pSpiInterface; /*!< SPI interface of the addressed daisy-chain */
+    uint16_t *pTxBuffer;                   /*!< transmit buffer shared by all read commands */
+    uint32_t frameLength;                  /*!< number of words per read command */
+
+    LTC_TRANSACTION_s transactions[LTC_TRANSACTION_LIST_MAXIMUM_LENGTH]; /*!< queued read commands */
+} LTC_TRANSACTION_LIST_s;
+
 /**
  * This structure contains all the variables relevant for the LTC state machine.
  * The user can get the current state of the LTC state machine with this variable
@@ -576,7 +602,8 @@ typedef struct {
         [BS_NR_OF_STRINGS]; /*!< point to the end of the multiplexer sequence; pointer to ending point of sequence */
     uint8_t muxmeas_nr_end
         [BS_NR_OF_STRINGS]; /*!< number of multiplexer channels that have to be measured; end number of sequence, where measurement is finished*/
-    uint8_t configuration[6]; /*!< holds the configuration of the ltc (configuration register) */
+    uint8_t configuration[6];               /*!< holds the configuration of the ltc (configuration register) */
+    LTC_TRANSACTION_LIST_s transactionList; /*!< read commands that are transmitted back to back */
 
 } LTC_STATE_s;
 
@@ -56,6 +56,7 @@
 
 #include "io.h"
 #include "ltc.h"
+#include "mcu.h"
 #include "spi.h"
 
 /*========== Macros and Definitions =========================================*/
@@ -66,8 +67,42 @@
 
 /*========== Static Function Prototypes =====================================*/
 
+/**
+ * @brief   Transmits the next read command of a transaction list.
+ * @details Called on DMA complete. If a transfer of the list has just been
+ *          completed and further read commands are queued, the next read
+ *          command is started directly, without waiting for the next call
+ *          of the state machine.
+ * @param   pList   transaction list of the LTC state machine
+ * @return  true if a further transfer has been started, false otherwise
+ */
+static bool MIC_TransmitNextTransaction(LTC_TRANSACTION_LIST_s *pList);
+
 /*========== Static Function Implementations ================================*/
 
+static bool MIC_TransmitNextTransaction(LTC_TRANSACTION_LIST_s *pList) {
+    bool isTransmitting = false;
+
+    /* Transfers that are not part of a list leave next and completed equal */
+    if (pList->next > pList->completed) {
+        pList->completed = pList->next;
+        if (pList->next < pList->length) {
+            const LTC_TRANSACTION_s *pTransaction = &pList->transactions[pList->next];
+            for (uint8_t i = 0u; i < 4u; i++) {
+                pList->pTxBuffer[i] = pTransaction->pCommand[i];
+            }
+            /* CS has just been released by the DMA callback, keep it high long enough */
+            MCU_delay_us(LTC_TRANSACTION_CS_HIGH_TIME_US);
+            if (SPI_TransmitReceiveDataDmaFromIsr(
+                    pList->pSpiInterface, pList->pTxBuffer, pTransaction->pRxBuffer, pList->frameLength) == STD_OK) {
+                pList->next++;
+                isTransmitting = true;
+            }
+        }
+    }
+    return isTransmitting;
+}
+
 /*========== Extern Function Implementations ================================*/
 
 extern bool MIC_IsTransmitOngoing(LTC_STATE_s *pLtcState) {
@@ -78,10 +113,48 @@ extern void MIC_SetTransmitOngoing(LTC_STATE_s *pLtcState) {
     pLtcState->transmit_ongoing = true;
 }
 
+extern void MIC_ClearTransactionList(
+    LTC_TRANSACTION_LIST_s *pList,
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuffer,
+    uint32_t frameLength) {
+    FAS_ASSERT(pList != NULL_PTR);
+    FAS_ASSERT(pSpiInterface != NULL_PTR);
+    FAS_ASSERT(pTxBuffer != NULL_PTR);
+    pList->length        = 0u;
+    pList->next          = 0u;
+    pList->completed     = 0u;
+    pList->pSpiInterface = pSpiInterface;
+    pList->pTxBuffer     = pTxBuffer;
+    pList->frameLength   = frameLength;
+}
+
+extern STD_RETURN_TYPE_e MIC_QueueTransaction(
+    LTC_TRANSACTION_LIST_s *pList,
+    uint16_t *pCommand,
+    uint16_t *pRxBuffer,
+    uint8_t registerSet) {
+    FAS_ASSERT(pList != NULL_PTR);
+    FAS_ASSERT(pCommand != NULL_PTR);
+    FAS_ASSERT(pRxBuffer != NULL_PTR);
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+
+    if (pList->length < LTC_TRANSACTION_LIST_MAXIMUM_LENGTH) {
+        pList->transactions[pList->length].pCommand    = pCommand;
+        pList->transactions[pList->length].pRxBuffer   = pRxBuffer;
+        pList->transactions[pList->length].registerSet = registerSet;
+        pList->length++;
+        retVal = STD_OK;
+    }
+    return retVal;
+}
+
 /* Function called on DMA complete interrupts (TX and RX). */
 void MIC_DmaCallback(dmaInterrupt_t inttype, uint32 channel) {
     if (((dmaChannel_t)channel == DMA_CH0) || ((dmaChannel_t)channel == DMA_CH1)) {
-        ltc_stateBase.transmit_ongoing = false;
+        if (MIC_TransmitNextTransaction(&ltc_stateBase.transactionList) == false) {
+            ltc_stateBase.transmit_ongoing = false;
+        }
     } else {
         FAS_ASSERT(FAS_TRAP);
     }
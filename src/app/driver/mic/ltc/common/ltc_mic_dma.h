@@ -90,6 +90,36 @@ extern bool MIC_IsTransmitOngoing(LTC_STATE_s *pLtcState);
  */
 extern void MIC_SetTransmitOngoing(LTC_STATE_s *pLtcState);
 
+/**
+ * @brief   empties a transaction list and sets the interface it is sent on.
+ *
+ * @param[out] pList          transaction list to be cleared
+ * @param[in]  pSpiInterface  SPI interface of the addressed daisy-chain
+ * @param[in]  pTxBuffer      transmit buffer shared by all read commands of the list
+ * @param[in]  frameLength    number of words per read command
+ */
+extern void MIC_ClearTransactionList(
+    LTC_TRANSACTION_LIST_s *pList,
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuffer,
+    uint32_t frameLength);
+
+/**
+ * @brief   appends a read command to a transaction list.
+ *
+ * @param[in,out] pList        transaction list
+ * @param[in]     pCommand     command including PEC (4 words)
+ * @param[out]    pRxBuffer    buffer that receives the answer of the daisy-chain
+ * @param[in]     registerSet  register group that is read
+ *
+ * @return  #STD_OK if the read command was queued, #STD_NOT_OK if the list is full
+ */
+extern STD_RETURN_TYPE_e MIC_QueueTransaction(
+    LTC_TRANSACTION_LIST_s *pList,
+    uint16_t *pCommand,
+    uint16_t *pRxBuffer,
+    uint8_t registerSet);
+
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
 
 #endif /* FOXBMS__LTC_MIC_DMA_H_ */
@@ -71,6 +71,28 @@ Copyright 2013 Linear Technology Corp. (LTC)
 
 /*========== Static Function Prototypes =====================================*/
 
+/**
+ * @brief   calculates the PEC15 over the data bytes of one device
+ * @details The data bytes are taken from the lower byte of consecutive SPI
+ *          words, so no intermediate byte array is needed.
+ * @param   pDeviceData     first data word of the device in the frame
+ * @return  PEC15 of the #LTC_PEC_DATA_BYTES_PER_DEVICE data bytes
+ */
+static uint16_t LTC_CalculateDevicePec(const uint16_t *pDeviceData);
+
+/*========== Static Function Implementations ================================*/
+
+static uint16_t LTC_CalculateDevicePec(const uint16_t *pDeviceData) {
+    FAS_ASSERT(pDeviceData != NULL_PTR);
+    uint16_t remainder = 16u; /* initialize the PEC */
+    for (uint8_t i = 0u; i < LTC_PEC_DATA_BYTES_PER_DEVICE; i++) {
+        const uint16_t address = ((remainder >> 7u) ^ pDeviceData[i]) & 0xFFu;
+        remainder              = (remainder << 8u) ^ crc15Table[address];
+    }
+    /* The CRC15 has a 0 in the LSB so the remainder must be multiplied by 2 */
+    return (uint16_t)(remainder << 1u);
+}
+
 /*========== Extern Function Implementations ================================*/
 
 uint16_t LTC_pec15_calc(uint8_t len, uint8_t *data) {
@@ -84,6 +106,39 @@ uint16_t LTC_pec15_calc(uint8_t len, uint8_t *data) {
     }
     return (remainder * 2u); /* The CRC15 has a 0 in the LSB so the remainder must be multiplied by 2 */
 }
+
+extern void LTC_SetFramePecs(uint16_t *pFrame, uint16_t numberOfDevices) {
+    FAS_ASSERT(pFrame != NULL_PTR);
+    for (uint16_t device = 0u; device < numberOfDevices; device++) {
+        const uint32_t offset = LTC_PEC_FRAME_HEADER_WORDS + ((uint32_t)device * LTC_PEC_WORDS_PER_DEVICE);
+        const uint16_t pec    = LTC_CalculateDevicePec(&pFrame[offset]);
+
+        pFrame[offset + LTC_PEC_DATA_BYTES_PER_DEVICE]      = (pec >> 8u) & 0xFFu;
+        pFrame[offset + LTC_PEC_DATA_BYTES_PER_DEVICE + 1u] = pec & 0xFFu;
+    }
+}
+
+extern bool LTC_CheckFramePecs(const uint16_t *pFrame, uint16_t numberOfDevices, uint32_t *pValidMask) {
+    FAS_ASSERT(pFrame != NULL_PTR);
+    FAS_ASSERT(pValidMask != NULL_PTR);
+    bool allPecsValid = true;
+
+    for (uint32_t word = 0u; word < LTC_PEC_VALID_MASK_WORDS(numberOfDevices); word++) {
+        pValidMask[word] = 0u;
+    }
+    for (uint16_t device = 0u; device < numberOfDevices; device++) {
+        const uint32_t offset = LTC_PEC_FRAME_HEADER_WORDS + ((uint32_t)device * LTC_PEC_WORDS_PER_DEVICE);
+        const uint16_t pec    = LTC_CalculateDevicePec(&pFrame[offset]);
+
+        if ((pFrame[offset + LTC_PEC_DATA_BYTES_PER_DEVICE] == ((pec >> 8u) & 0xFFu)) &&
+            (pFrame[offset + LTC_PEC_DATA_BYTES_PER_DEVICE + 1u] == (pec & 0xFFu))) {
+            pValidMask[device / 32u] |= (1uL << (device % 32u));
+        } else {
+            allPecsValid = false;
+        }
+    }
+    return allPecsValid;
+}
 /*================== Public functions =====================================*/
 
 /*================== Static functions =====================================*/
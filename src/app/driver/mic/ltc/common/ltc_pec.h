@@ -76,10 +76,22 @@ void generate_crc15_table()
 #include "general.h"
 
 /*========== Macros and Definitions =========================================*/
+/** number of SPI words in front of the first device in a daisy-chain frame (2 command bytes + command PEC) */
+#define LTC_PEC_FRAME_HEADER_WORDS (4u)
+/** number of data bytes of one register group of one device, i.e., the bytes covered by one PEC */
+#define LTC_PEC_DATA_BYTES_PER_DEVICE (6u)
+/** number of SPI words of one device in a daisy-chain frame (data bytes + 2 PEC bytes) */
+#define LTC_PEC_WORDS_PER_DEVICE (8u)
+
+/** number of 32 bit words needed to store the PEC validity bitmask of numberOfDevices devices */
+#define LTC_PEC_VALID_MASK_WORDS(numberOfDevices) ((((uint32_t)(numberOfDevices)) + 31u) / 32u)
+/** true if the PEC of device was marked as valid in the bitmask pValidMask */
+#define LTC_PEC_IS_DEVICE_VALID(pValidMask, device) \
+    ((((pValidMask)[(device) / 32u] >> ((device) % 32u)) & 1u) == 1u)
 
 /*========== Extern Constant and Variable Declarations ======================*/
 
-static const unsigned int crc15Table[256] =
+static const uint16_t crc15Table[256] =
     {/* precomputed CRC15 Table */
      0x0,    0xc599, 0xceab, 0xb32,  0xd8cf, 0x1d56, 0x1664, 0xd3fd, 0xf407, 0x319e, 0x3aac, 0xff35, 0x2cc8, 0xe951,
      0xe263, 0x27fa, 0xad97, 0x680e, 0x633c, 0xa6a5, 0x7558, 0xb0c1, 0xbbf3, 0x7e6a, 0x5990, 0x9c09, 0x973b, 0x52a2,
@@ -133,4 +145,28 @@ static const unsigned int crc10Table[256] =
  */
 uint16_t LTC_pec15_calc(uint8_t len, uint8_t *data);
 
+/**
+ * @brief   calculates the data PECs of all devices in a daisy-chain frame
+ * @details The data bytes of each device are read directly from the SPI words
+ *          of the frame (#LTC_PEC_WORDS_PER_DEVICE words per device, starting
+ *          after #LTC_PEC_FRAME_HEADER_WORDS) and the two PEC bytes of each
+ *          device are written to the last two words of the device.
+ * @param   pFrame              daisy-chain frame as it is sent over SPI
+ * @param   numberOfDevices     number of devices in the daisy-chain
+ */
+extern void LTC_SetFramePecs(uint16_t *pFrame, uint16_t numberOfDevices);
+
+/**
+ * @brief   checks the data PECs of all devices in a received daisy-chain frame
+ * @details The bit of each device is set in pValidMask if the received PEC
+ *          matches the PEC calculated over the received data bytes and
+ *          cleared otherwise. Use #LTC_PEC_IS_DEVICE_VALID to evaluate it.
+ * @param   pFrame              daisy-chain frame as it was received over SPI
+ * @param   numberOfDevices     number of devices in the daisy-chain
+ * @param   pValidMask          bitmask of at least
+ *                              #LTC_PEC_VALID_MASK_WORDS(numberOfDevices) words
+ * @return  true if the PECs of all devices are valid, false otherwise
+ */
+extern bool LTC_CheckFramePecs(const uint16_t *pFrame, uint16_t numberOfDevices, uint32_t *pValidMask);
+
 #endif /* LTC_PEC_H_ */
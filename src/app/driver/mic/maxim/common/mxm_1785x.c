@@ -101,18 +101,6 @@ static const MXM_REG_NAME_e mxm_voltageCellAddresses[MXM_VOLTAGE_READ_ARRAY_LENG
     MXM_REG_BLOCK,
 };
 
-/**
- * @brief Local cell voltage data block
- *
- * This local instance stores the measured cell voltages. In contrast to
- * #MXM_MONITORING_INSTANCE::localVoltages, the layout of this structure
- * changes with the defined battery-system as it is described by the
- * database_cfg.h. Mapping the values from
- * #MXM_MONITORING_INSTANCE::localVoltages to #mxm_cellVoltages and copying
- * these entries into the database is handled by #MXM_ParseVoltagesIntoDB().
- */
-static DATA_BLOCK_CELL_VOLTAGE_s mxm_cellVoltages = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
-
 /**
  * @brief   Local cell temperature data block
  * @details This local instance stores the measured cell temperatures.
@@ -277,11 +265,12 @@ static MXM_MONINTORING_STATE_e must_check_return
 /**
  * @brief   Copies measured voltage data into the database.
  * @details This function copies the acquired voltage data from
- *          #MXM_MONITORING_INSTANCE::localVoltages into the database-struct mxm_cellVoltages and
- *          copies this struct into the database. This action is required due
- *          to different data layouts. This driver always stores its
- *          cell-voltages in an array with 14*32 = 448 cells in order to reduce
- *          the amount of different configurations and variants.
+ *          #MXM_MONITORING_INSTANCE::localVoltages directly into the back
+ *          buffer of the cell voltage database entry and commits it with
+ *          #DATA_CommitBackBuffer(). This action is required due to different
+ *          data layouts. This driver always stores its cell-voltages in an
+ *          array with 14*32 = 448 cells in order to reduce the amount of
+ *          different configurations and variants.
  *
  *          This function maps these values into the database-struct which
  *          scales with the number of connected cells and monitoring ICs.
@@ -1196,6 +1185,9 @@ MXM_MONINTORING_STATE_e must_check_return
 static STD_RETURN_TYPE_e MXM_ParseVoltagesIntoDB(MXM_MONITORING_INSTANCE_s *pInstance) {
     FAS_ASSERT(pInstance != NULL_PTR);
     STD_RETURN_TYPE_e retval = STD_OK;
+    /* decode the voltages in place, the back buffer contains the values of the second to last cycle */
+    DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltages =
+        (DATA_BLOCK_CELL_VOLTAGE_s *)DATA_GetBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
 
     /* voltages */
     for (uint8_t i_mod = 0; i_mod < (BS_NR_OF_MODULES * BS_NR_OF_STRINGS); i_mod++) {
@@ -1203,18 +1195,17 @@ static STD_RETURN_TYPE_e MXM_ParseVoltagesIntoDB(MXM_MONITORING_INSTANCE_s *pIns
             uint8_t stringNumber  = 0u;
             uint16_t moduleNumber = 0u;
             MXM_ConvertModuleToString(i_mod, &stringNumber, &moduleNumber);
-            mxm_cellVoltages.moduleVoltage_mV[stringNumber][moduleNumber] =
-                pInstance->localVoltages.blockVoltages[i_mod];
+            pCellVoltages->moduleVoltage_mV[stringNumber][moduleNumber] = pInstance->localVoltages.blockVoltages[i_mod];
             /* every iteration that we hit a string first (module 0), we reset the packvoltage counter */
             if (moduleNumber == 0u) {
-                mxm_cellVoltages.packVoltage_mV[stringNumber] = 0;
+                pCellVoltages->packVoltage_mV[stringNumber] = 0;
             }
-            mxm_cellVoltages.packVoltage_mV[stringNumber] += pInstance->localVoltages.blockVoltages[i_mod];
+            pCellVoltages->packVoltage_mV[stringNumber] += pInstance->localVoltages.blockVoltages[i_mod];
             for (uint8_t i_bat = 0; i_bat < BS_NR_OF_CELLS_PER_MODULE; i_bat++) {
                 if (i_bat < MXM_MAXIMUM_NR_OF_CELLS_PER_MODULE) {
                     uint16_t cell_counter_db  = (moduleNumber * BS_NR_OF_CELLS_PER_MODULE) + i_bat;
                     uint16_t cell_counter_max = (i_mod * MXM_MAXIMUM_NR_OF_CELLS_PER_MODULE) + i_bat;
-                    mxm_cellVoltages.cellVoltage_mV[stringNumber][cell_counter_db] =
+                    pCellVoltages->cellVoltage_mV[stringNumber][cell_counter_db] =
                         pInstance->localVoltages.cellVoltages[cell_counter_max];
                 }
             }
@@ -1248,7 +1239,8 @@ static STD_RETURN_TYPE_e MXM_ParseVoltagesIntoDB(MXM_MONITORING_INSTANCE_s *pIns
         }
     }
 
-    DATA_WRITE_DATA(&mxm_cellVoltages, &mxm_cellTemperatures);
+    DATA_CommitBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+    DATA_WRITE_DATA(&mxm_cellTemperatures);
 
     return retval;
 }
@@ -1916,7 +1908,7 @@ extern void MXM_StateMachine(MXM_MONITORING_INSTANCE_s *pInstance) {
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
-#ifdef UNITY_UNIT_TEST
+#if defined(UNITY_UNIT_TEST) || defined(FOXBMS_BENCHMARK)
 extern STD_RETURN_TYPE_e TEST_MXM_ParseVoltageReadallTest(MXM_MONITORING_INSTANCE_s *pInstance) {
     return MXM_ParseVoltageReadallTest(pInstance);
 }
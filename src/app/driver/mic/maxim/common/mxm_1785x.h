@@ -107,7 +107,7 @@
 extern void MXM_StateMachine(MXM_MONITORING_INSTANCE_s *pInstance);
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
-#ifdef UNITY_UNIT_TEST
+#if defined(UNITY_UNIT_TEST) || defined(FOXBMS_BENCHMARK)
 extern STD_RETURN_TYPE_e TEST_MXM_ParseVoltageReadallTest(MXM_MONITORING_INSTANCE_s *pInstance);
 extern STD_RETURN_TYPE_e TEST_MXM_ParseVoltagesIntoDB(MXM_MONITORING_INSTANCE_s *pInstance);
 extern MXM_MONINTORING_STATE_e TEST_MXM_MonGetVoltages(MXM_MONITORING_INSTANCE_s *pInstance, MXM_REG_NAME_e regAddress);
@@ -60,6 +60,7 @@
 #include "database.h"
 #include "diag.h"
 #include "mic_dma.h"
+#include "n775_crc.h"
 #include "os.h"
 
 /*========== Macros and Definitions =========================================*/
@@ -140,8 +141,6 @@ static void N775_StateTransition(N775_STATEMACH_e state, uint8_t substate, uint1
                                          N775_STATEMACH_e state_ok, uint8_t substate_ok, uint16_t timer_ms_ok,
                                          N775_STATEMACH_e state_nok,  uint8_t substate_nok,  uint16_t timer_ms_nok); */
 
-uint16_t n775_CrcAddItem(uint16_t remainder, uint16_t item);
-
 static N775_RETURN_TYPE_e N775_CheckStateRequest(N775_STATE_REQUEST_e statereq);
 uint16_t n775_CalcCrc(const N775_MESSAGE_s *msg);
 
@@ -149,57 +148,29 @@ uint16_t n775_CalcCrc(const N775_MESSAGE_s *msg);
 
 /*========== Extern Function Implementations ================================*/
 
-/* TODO: use own function */
-/**
- * @brief   Called to calculate the CRC of a message. NXP function.
- *
- * @param   remainder
- * @param   item
- *
- * @return  remainder
- *
- */
-uint16_t n775_CrcAddItem(uint16_t remainder, uint16_t item) {
-    int i;
-    uint16_t local_remainder = remainder;
-
-    local_remainder ^= item;
-
-    for (i = 0; i < 16; i++) {
-        /*
-         * Try to divide the current data bit.
-         */
-        if ((local_remainder & 0x8000u) > 0u) {
-            local_remainder = (local_remainder << 1u) ^ ((0x9eb2u << 1u) + 0x1u);
-        } else {
-            local_remainder = (local_remainder << 1u);
-        }
-    }
-
-    return (local_remainder);
-}
-
-/* TODO: use own function */
 /**
- * @brief   Calculate the CRC of a message. NXP function.
+ * @brief   Calculate the CRC of a message.
+ * @details The CRC covers the head, the data head and the data words of the
+ *          message, see #N775_CrcAddItems().
  *
- * @param   msg
+ * @param   msg     message for which the CRC is calculated
  *
  * @return  crc
  *
  */
 uint16_t n775_CalcCrc(const N775_MESSAGE_s *msg) {
-    uint16_t remainder = 0;
-    int i;
+    FAS_ASSERT(msg != NULL_PTR);
+    uint16_t remainder = 0u;
 
-    remainder = n775_CrcAddItem(remainder, msg->head);
-    remainder = n775_CrcAddItem(remainder, msg->dataHead);
+    remainder = N775_CrcAddItem(remainder, msg->head);
+    remainder = N775_CrcAddItem(remainder, msg->dataHead);
 
-    for (i = 0; i < (msg->dataLength - 3); i++) {
-        remainder = n775_CrcAddItem(remainder, msg->data[i]);
+    /* dataLength includes head, data head and CRC */
+    if (msg->dataLength > 3u) {
+        remainder = N775_CrcAddItems(remainder, msg->data, msg->dataLength - 3u);
     }
 
-    return (remainder);
+    return remainder;
 }
 
 /**
@@ -410,6 +381,8 @@ void N775_Trigger(void) {
 
             /****************************INITIALIZATION**********************************/
             case N775_STATEMACH_INITIALIZATION:
+                /* the messages can not be protected if the CRC implementation is broken */
+                FAS_ASSERT(N775_CrcSelfTest() == STD_OK);
                 N775_Initialize_Database();
                 N775_StateTransition(N775_STATEMACH_INITIALIZED, N775_ENTRY, N775_STATEMACH_SHORTTIME);
                 break;
@@ -0,0 +1,343 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    n775_crc.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup DRIVERS
+ * @prefix  N775
+ *
+ * @brief   CRC16 calculation for the NXP MC33775A
+ *
+ * @details This module supports the calculation of the CRC16 that protects
+ *          the messages of the MC33775A. The polynomial is 0x9EB2 in Koopman
+ *          notation, i.e., 0x3D65 in normal notation. The implementation is
+ *          selected with #N775_CRC_IMPLEMENTATION.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "n775_crc.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/** CRC polynomial in normal notation ((0x9EB2 << 1) + 1, truncated to 16 bit) */
+#define N775_CRC_POLYNOMIAL (0x3D65u)
+
+/** most significant bit of the CRC remainder */
+#define N775_CRC_MSB_MASK (0x8000u)
+
+/** number of bits in one item */
+#define N775_CRC_BITS_PER_ITEM (16u)
+
+/** mask of the lower byte of an item */
+#define N775_CRC_BYTE_MASK (0xFFu)
+
+/** number of bits in one byte */
+#define N775_CRC_BITS_PER_BYTE (8u)
+
+/** number of look-up tables of the slice-by-4 implementation */
+#define N775_CRC_NUMBER_OF_TABLES (4u)
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+#if (N775_CRC_IMPLEMENTATION != N775_CRC_BITWISE) || defined(UNITY_UNIT_TEST)
+/**
+ * @brief   Precomputed CRC16-tables for polynomial 0x9EB2
+ * @details n775_crcTable[0][i] is the remainder of the byte i followed by
+ *          two zero bytes, n775_crcTable[k][i] the remainder of the byte i
+ *          followed by k further zero bytes. The table-driven
+ *          implementation only uses the first table, the slice-by-4
+ *          implementation uses all four.
+ *
+ *          The tables have been generated with the bitwise implementation
+ *          #N775_CrcAddItemsBitwise().
+ */
+static const uint16_t n775_crcTable[N775_CRC_NUMBER_OF_TABLES][256] = {
+    {
+        0x0000u, 0x3D65u, 0x7ACAu, 0x47AFu, 0xF594u, 0xC8F1u, 0x8F5Eu, 0xB23Bu, 0xD64Du, 0xEB28u, 0xAC87u, 0x91E2u,
+        0x23D9u, 0x1EBCu, 0x5913u, 0x6476u, 0x91FFu, 0xAC9Au, 0xEB35u, 0xD650u, 0x646Bu, 0x590Eu, 0x1EA1u, 0x23C4u,
+        0x47B2u, 0x7AD7u, 0x3D78u, 0x001Du, 0xB226u, 0x8F43u, 0xC8ECu, 0xF589u, 0x1E9Bu, 0x23FEu, 0x6451u, 0x5934u,
+        0xEB0Fu, 0xD66Au, 0x91C5u, 0xACA0u, 0xC8D6u, 0xF5B3u, 0xB21Cu, 0x8F79u, 0x3D42u, 0x0027u, 0x4788u, 0x7AEDu,
+        0x8F64u, 0xB201u, 0xF5AEu, 0xC8CBu, 0x7AF0u, 0x4795u, 0x003Au, 0x3D5Fu, 0x5929u, 0x644Cu, 0x23E3u, 0x1E86u,
+        0xACBDu, 0x91D8u, 0xD677u, 0xEB12u, 0x3D36u, 0x0053u, 0x47FCu, 0x7A99u, 0xC8A2u, 0xF5C7u, 0xB268u, 0x8F0Du,
+        0xEB7Bu, 0xD61Eu, 0x91B1u, 0xACD4u, 0x1EEFu, 0x238Au, 0x6425u, 0x5940u, 0xACC9u, 0x91ACu, 0xD603u, 0xEB66u,
+        0x595Du, 0x6438u, 0x2397u, 0x1EF2u, 0x7A84u, 0x47E1u, 0x004Eu, 0x3D2Bu, 0x8F10u, 0xB275u, 0xF5DAu, 0xC8BFu,
+        0x23ADu, 0x1EC8u, 0x5967u, 0x6402u, 0xD639u, 0xEB5Cu, 0xACF3u, 0x9196u, 0xF5E0u, 0xC885u, 0x8F2Au, 0xB24Fu,
+        0x0074u, 0x3D11u, 0x7ABEu, 0x47DBu, 0xB252u, 0x8F37u, 0xC898u, 0xF5FDu, 0x47C6u, 0x7AA3u, 0x3D0Cu, 0x0069u,
+        0x641Fu, 0x597Au, 0x1ED5u, 0x23B0u, 0x918Bu, 0xACEEu, 0xEB41u, 0xD624u, 0x7A6Cu, 0x4709u, 0x00A6u, 0x3DC3u,
+        0x8FF8u, 0xB29Du, 0xF532u, 0xC857u, 0xAC21u, 0x9144u, 0xD6EBu, 0xEB8Eu, 0x59B5u, 0x64D0u, 0x237Fu, 0x1E1Au,
+        0xEB93u, 0xD6F6u, 0x9159u, 0xAC3Cu, 0x1E07u, 0x2362u, 0x64CDu, 0x59A8u, 0x3DDEu, 0x00BBu, 0x4714u, 0x7A71u,
+        0xC84Au, 0xF52Fu, 0xB280u, 0x8FE5u, 0x64F7u, 0x5992u, 0x1E3Du, 0x2358u, 0x9163u, 0xAC06u, 0xEBA9u, 0xD6CCu,
+        0xB2BAu, 0x8FDFu, 0xC870u, 0xF515u, 0x472Eu, 0x7A4Bu, 0x3DE4u, 0x0081u, 0xF508u, 0xC86Du, 0x8FC2u, 0xB2A7u,
+        0x009Cu, 0x3DF9u, 0x7A56u, 0x4733u, 0x2345u, 0x1E20u, 0x598Fu, 0x64EAu, 0xD6D1u, 0xEBB4u, 0xAC1Bu, 0x917Eu,
+        0x475Au, 0x7A3Fu, 0x3D90u, 0x00F5u, 0xB2CEu, 0x8FABu, 0xC804u, 0xF561u, 0x9117u, 0xAC72u, 0xEBDDu, 0xD6B8u,
+        0x6483u, 0x59E6u, 0x1E49u, 0x232Cu, 0xD6A5u, 0xEBC0u, 0xAC6Fu, 0x910Au, 0x2331u, 0x1E54u, 0x59FBu, 0x649Eu,
+        0x00E8u, 0x3D8Du, 0x7A22u, 0x4747u, 0xF57Cu, 0xC819u, 0x8FB6u, 0xB2D3u, 0x59C1u, 0x64A4u, 0x230Bu, 0x1E6Eu,
+        0xAC55u, 0x9130u, 0xD69Fu, 0xEBFAu, 0x8F8Cu, 0xB2E9u, 0xF546u, 0xC823u, 0x7A18u, 0x477Du, 0x00D2u, 0x3DB7u,
+        0xC83Eu, 0xF55Bu, 0xB2F4u, 0x8F91u, 0x3DAAu, 0x00CFu, 0x4760u, 0x7A05u, 0x1E73u, 0x2316u, 0x64B9u, 0x59DCu,
+        0xEBE7u, 0xD682u, 0x912Du, 0xAC48u,
+    },
+    {
+        0x0000u, 0xF4D8u, 0xD4D5u, 0x200Du, 0x94CFu, 0x6017u, 0x401Au, 0xB4C2u, 0x14FBu, 0xE023u, 0xC02Eu, 0x34F6u,
+        0x8034u, 0x74ECu, 0x54E1u, 0xA039u, 0x29F6u, 0xDD2Eu, 0xFD23u, 0x09FBu, 0xBD39u, 0x49E1u, 0x69ECu, 0x9D34u,
+        0x3D0Du, 0xC9D5u, 0xE9D8u, 0x1D00u, 0xA9C2u, 0x5D1Au, 0x7D17u, 0x89CFu, 0x53ECu, 0xA734u, 0x8739u, 0x73E1u,
+        0xC723u, 0x33FBu, 0x13F6u, 0xE72Eu, 0x4717u, 0xB3CFu, 0x93C2u, 0x671Au, 0xD3D8u, 0x2700u, 0x070Du, 0xF3D5u,
+        0x7A1Au, 0x8EC2u, 0xAECFu, 0x5A17u, 0xEED5u, 0x1A0Du, 0x3A00u, 0xCED8u, 0x6EE1u, 0x9A39u, 0xBA34u, 0x4EECu,
+        0xFA2Eu, 0x0EF6u, 0x2EFBu, 0xDA23u, 0xA7D8u, 0x5300u, 0x730Du, 0x87D5u, 0x3317u, 0xC7CFu, 0xE7C2u, 0x131Au,
+        0xB323u, 0x47FBu, 0x67F6u, 0x932Eu, 0x27ECu, 0xD334u, 0xF339u, 0x07E1u, 0x8E2Eu, 0x7AF6u, 0x5AFBu, 0xAE23u,
+        0x1AE1u, 0xEE39u, 0xCE34u, 0x3AECu, 0x9AD5u, 0x6E0Du, 0x4E00u, 0xBAD8u, 0x0E1Au, 0xFAC2u, 0xDACFu, 0x2E17u,
+        0xF434u, 0x00ECu, 0x20E1u, 0xD439u, 0x60FBu, 0x9423u, 0xB42Eu, 0x40F6u, 0xE0CFu, 0x1417u, 0x341Au, 0xC0C2u,
+        0x7400u, 0x80D8u, 0xA0D5u, 0x540Du, 0xDDC2u, 0x291Au, 0x0917u, 0xFDCFu, 0x490Du, 0xBDD5u, 0x9DD8u, 0x6900u,
+        0xC939u, 0x3DE1u, 0x1DECu, 0xE934u, 0x5DF6u, 0xA92Eu, 0x8923u, 0x7DFBu, 0x72D5u, 0x860Du, 0xA600u, 0x52D8u,
+        0xE61Au, 0x12C2u, 0x32CFu, 0xC617u, 0x662Eu, 0x92F6u, 0xB2FBu, 0x4623u, 0xF2E1u, 0x0639u, 0x2634u, 0xD2ECu,
+        0x5B23u, 0xAFFBu, 0x8FF6u, 0x7B2Eu, 0xCFECu, 0x3B34u, 0x1B39u, 0xEFE1u, 0x4FD8u, 0xBB00u, 0x9B0Du, 0x6FD5u,
+        0xDB17u, 0x2FCFu, 0x0FC2u, 0xFB1Au, 0x2139u, 0xD5E1u, 0xF5ECu, 0x0134u, 0xB5F6u, 0x412Eu, 0x6123u, 0x95FBu,
+        0x35C2u, 0xC11Au, 0xE117u, 0x15CFu, 0xA10Du, 0x55D5u, 0x75D8u, 0x8100u, 0x08CFu, 0xFC17u, 0xDC1Au, 0x28C2u,
+        0x9C00u, 0x68D8u, 0x48D5u, 0xBC0Du, 0x1C34u, 0xE8ECu, 0xC8E1u, 0x3C39u, 0x88FBu, 0x7C23u, 0x5C2Eu, 0xA8F6u,
+        0xD50Du, 0x21D5u, 0x01D8u, 0xF500u, 0x41C2u, 0xB51Au, 0x9517u, 0x61CFu, 0xC1F6u, 0x352Eu, 0x1523u, 0xE1FBu,
+        0x5539u, 0xA1E1u, 0x81ECu, 0x7534u, 0xFCFBu, 0x0823u, 0x282Eu, 0xDCF6u, 0x6834u, 0x9CECu, 0xBCE1u, 0x4839u,
+        0xE800u, 0x1CD8u, 0x3CD5u, 0xC80Du, 0x7CCFu, 0x8817u, 0xA81Au, 0x5CC2u, 0x86E1u, 0x7239u, 0x5234u, 0xA6ECu,
+        0x122Eu, 0xE6F6u, 0xC6FBu, 0x3223u, 0x921Au, 0x66C2u, 0x46CFu, 0xB217u, 0x06D5u, 0xF20Du, 0xD200u, 0x26D8u,
+        0xAF17u, 0x5BCFu, 0x7BC2u, 0x8F1Au, 0x3BD8u, 0xCF00u, 0xEF0Du, 0x1BD5u, 0xBBECu, 0x4F34u, 0x6F39u, 0x9BE1u,
+        0x2F23u, 0xDBFBu, 0xFBF6u, 0x0F2Eu,
+    },
+    {
+        0x0000u, 0xE5AAu, 0xF631u, 0x139Bu, 0xD107u, 0x34ADu, 0x2736u, 0xC29Cu, 0x9F6Bu, 0x7AC1u, 0x695Au, 0x8CF0u,
+        0x4E6Cu, 0xABC6u, 0xB85Du, 0x5DF7u, 0x03B3u, 0xE619u, 0xF582u, 0x1028u, 0xD2B4u, 0x371Eu, 0x2485u, 0xC12Fu,
+        0x9CD8u, 0x7972u, 0x6AE9u, 0x8F43u, 0x4DDFu, 0xA875u, 0xBBEEu, 0x5E44u, 0x0766u, 0xE2CCu, 0xF157u, 0x14FDu,
+        0xD661u, 0x33CBu, 0x2050u, 0xC5FAu, 0x980Du, 0x7DA7u, 0x6E3Cu, 0x8B96u, 0x490Au, 0xACA0u, 0xBF3Bu, 0x5A91u,
+        0x04D5u, 0xE17Fu, 0xF2E4u, 0x174Eu, 0xD5D2u, 0x3078u, 0x23E3u, 0xC649u, 0x9BBEu, 0x7E14u, 0x6D8Fu, 0x8825u,
+        0x4AB9u, 0xAF13u, 0xBC88u, 0x5922u, 0x0ECCu, 0xEB66u, 0xF8FDu, 0x1D57u, 0xDFCBu, 0x3A61u, 0x29FAu, 0xCC50u,
+        0x91A7u, 0x740Du, 0x6796u, 0x823Cu, 0x40A0u, 0xA50Au, 0xB691u, 0x533Bu, 0x0D7Fu, 0xE8D5u, 0xFB4Eu, 0x1EE4u,
+        0xDC78u, 0x39D2u, 0x2A49u, 0xCFE3u, 0x9214u, 0x77BEu, 0x6425u, 0x818Fu, 0x4313u, 0xA6B9u, 0xB522u, 0x5088u,
+        0x09AAu, 0xEC00u, 0xFF9Bu, 0x1A31u, 0xD8ADu, 0x3D07u, 0x2E9Cu, 0xCB36u, 0x96C1u, 0x736Bu, 0x60F0u, 0x855Au,
+        0x47C6u, 0xA26Cu, 0xB1F7u, 0x545Du, 0x0A19u, 0xEFB3u, 0xFC28u, 0x1982u, 0xDB1Eu, 0x3EB4u, 0x2D2Fu, 0xC885u,
+        0x9572u, 0x70D8u, 0x6343u, 0x86E9u, 0x4475u, 0xA1DFu, 0xB244u, 0x57EEu, 0x1D98u, 0xF832u, 0xEBA9u, 0x0E03u,
+        0xCC9Fu, 0x2935u, 0x3AAEu, 0xDF04u, 0x82F3u, 0x6759u, 0x74C2u, 0x9168u, 0x53F4u, 0xB65Eu, 0xA5C5u, 0x406Fu,
+        0x1E2Bu, 0xFB81u, 0xE81Au, 0x0DB0u, 0xCF2Cu, 0x2A86u, 0x391Du, 0xDCB7u, 0x8140u, 0x64EAu, 0x7771u, 0x92DBu,
+        0x5047u, 0xB5EDu, 0xA676u, 0x43DCu, 0x1AFEu, 0xFF54u, 0xECCFu, 0x0965u, 0xCBF9u, 0x2E53u, 0x3DC8u, 0xD862u,
+        0x8595u, 0x603Fu, 0x73A4u, 0x960Eu, 0x5492u, 0xB138u, 0xA2A3u, 0x4709u, 0x194Du, 0xFCE7u, 0xEF7Cu, 0x0AD6u,
+        0xC84Au, 0x2DE0u, 0x3E7Bu, 0xDBD1u, 0x8626u, 0x638Cu, 0x7017u, 0x95BDu, 0x5721u, 0xB28Bu, 0xA110u, 0x44BAu,
+        0x1354u, 0xF6FEu, 0xE565u, 0x00CFu, 0xC253u, 0x27F9u, 0x3462u, 0xD1C8u, 0x8C3Fu, 0x6995u, 0x7A0Eu, 0x9FA4u,
+        0x5D38u, 0xB892u, 0xAB09u, 0x4EA3u, 0x10E7u, 0xF54Du, 0xE6D6u, 0x037Cu, 0xC1E0u, 0x244Au, 0x37D1u, 0xD27Bu,
+        0x8F8Cu, 0x6A26u, 0x79BDu, 0x9C17u, 0x5E8Bu, 0xBB21u, 0xA8BAu, 0x4D10u, 0x1432u, 0xF198u, 0xE203u, 0x07A9u,
+        0xC535u, 0x209Fu, 0x3304u, 0xD6AEu, 0x8B59u, 0x6EF3u, 0x7D68u, 0x98C2u, 0x5A5Eu, 0xBFF4u, 0xAC6Fu, 0x49C5u,
+        0x1781u, 0xF22Bu, 0xE1B0u, 0x041Au, 0xC686u, 0x232Cu, 0x30B7u, 0xD51Du, 0x88EAu, 0x6D40u, 0x7EDBu, 0x9B71u,
+        0x59EDu, 0xBC47u, 0xAFDCu, 0x4A76u,
+    },
+    {
+        0x0000u, 0x3B30u, 0x7660u, 0x4D50u, 0xECC0u, 0xD7F0u, 0x9AA0u, 0xA190u, 0xE4E5u, 0xDFD5u, 0x9285u, 0xA9B5u,
+        0x0825u, 0x3315u, 0x7E45u, 0x4575u, 0xF4AFu, 0xCF9Fu, 0x82CFu, 0xB9FFu, 0x186Fu, 0x235Fu, 0x6E0Fu, 0x553Fu,
+        0x104Au, 0x2B7Au, 0x662Au, 0x5D1Au, 0xFC8Au, 0xC7BAu, 0x8AEAu, 0xB1DAu, 0xD43Bu, 0xEF0Bu, 0xA25Bu, 0x996Bu,
+        0x38FBu, 0x03CBu, 0x4E9Bu, 0x75ABu, 0x30DEu, 0x0BEEu, 0x46BEu, 0x7D8Eu, 0xDC1Eu, 0xE72Eu, 0xAA7Eu, 0x914Eu,
+        0x2094u, 0x1BA4u, 0x56F4u, 0x6DC4u, 0xCC54u, 0xF764u, 0xBA34u, 0x8104u, 0xC471u, 0xFF41u, 0xB211u, 0x8921u,
+        0x28B1u, 0x1381u, 0x5ED1u, 0x65E1u, 0x9513u, 0xAE23u, 0xE373u, 0xD843u, 0x79D3u, 0x42E3u, 0x0FB3u, 0x3483u,
+        0x71F6u, 0x4AC6u, 0x0796u, 0x3CA6u, 0x9D36u, 0xA606u, 0xEB56u, 0xD066u, 0x61BCu, 0x5A8Cu, 0x17DCu, 0x2CECu,
+        0x8D7Cu, 0xB64Cu, 0xFB1Cu, 0xC02Cu, 0x8559u, 0xBE69u, 0xF339u, 0xC809u, 0x6999u, 0x52A9u, 0x1FF9u, 0x24C9u,
+        0x4128u, 0x7A18u, 0x3748u, 0x0C78u, 0xADE8u, 0x96D8u, 0xDB88u, 0xE0B8u, 0xA5CDu, 0x9EFDu, 0xD3ADu, 0xE89Du,
+        0x490Du, 0x723Du, 0x3F6Du, 0x045Du, 0xB587u, 0x8EB7u, 0xC3E7u, 0xF8D7u, 0x5947u, 0x6277u, 0x2F27u, 0x1417u,
+        0x5162u, 0x6A52u, 0x2702u, 0x1C32u, 0xBDA2u, 0x8692u, 0xCBC2u, 0xF0F2u, 0x1743u, 0x2C73u, 0x6123u, 0x5A13u,
+        0xFB83u, 0xC0B3u, 0x8DE3u, 0xB6D3u, 0xF3A6u, 0xC896u, 0x85C6u, 0xBEF6u, 0x1F66u, 0x2456u, 0x6906u, 0x5236u,
+        0xE3ECu, 0xD8DCu, 0x958Cu, 0xAEBCu, 0x0F2Cu, 0x341Cu, 0x794Cu, 0x427Cu, 0x0709u, 0x3C39u, 0x7169u, 0x4A59u,
+        0xEBC9u, 0xD0F9u, 0x9DA9u, 0xA699u, 0xC378u, 0xF848u, 0xB518u, 0x8E28u, 0x2FB8u, 0x1488u, 0x59D8u, 0x62E8u,
+        0x279Du, 0x1CADu, 0x51FDu, 0x6ACDu, 0xCB5Du, 0xF06Du, 0xBD3Du, 0x860Du, 0x37D7u, 0x0CE7u, 0x41B7u, 0x7A87u,
+        0xDB17u, 0xE027u, 0xAD77u, 0x9647u, 0xD332u, 0xE802u, 0xA552u, 0x9E62u, 0x3FF2u, 0x04C2u, 0x4992u, 0x72A2u,
+        0x8250u, 0xB960u, 0xF430u, 0xCF00u, 0x6E90u, 0x55A0u, 0x18F0u, 0x23C0u, 0x66B5u, 0x5D85u, 0x10D5u, 0x2BE5u,
+        0x8A75u, 0xB145u, 0xFC15u, 0xC725u, 0x76FFu, 0x4DCFu, 0x009Fu, 0x3BAFu, 0x9A3Fu, 0xA10Fu, 0xEC5Fu, 0xD76Fu,
+        0x921Au, 0xA92Au, 0xE47Au, 0xDF4Au, 0x7EDAu, 0x45EAu, 0x08BAu, 0x338Au, 0x566Bu, 0x6D5Bu, 0x200Bu, 0x1B3Bu,
+        0xBAABu, 0x819Bu, 0xCCCBu, 0xF7FBu, 0xB28Eu, 0x89BEu, 0xC4EEu, 0xFFDEu, 0x5E4Eu, 0x657Eu, 0x282Eu, 0x131Eu,
+        0xA2C4u, 0x99F4u, 0xD4A4u, 0xEF94u, 0x4E04u, 0x7534u, 0x3864u, 0x0354u, 0x4621u, 0x7D11u, 0x3041u, 0x0B71u,
+        0xAAE1u, 0x91D1u, 0xDC81u, 0xE7B1u,
+    },
+};
+#endif
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/**
+ * @brief   Computes the CRC bit by bit.
+ * @details Reference implementation as provided by NXP, 16 iterations per
+ *          item.
+ * @param[in]   remainder       remainder of the previously processed items
+ * @param[in]   pItems          items that are added to the CRC
+ * @param[in]   numberOfItems   number of items in pItems
+ * @return  remainder after the items have been processed
+ */
+static uint16_t N775_CrcAddItemsBitwise(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems);
+
+#if (N775_CRC_IMPLEMENTATION == N775_CRC_TABLE) || defined(UNITY_UNIT_TEST)
+/**
+ * @brief   Computes the CRC with one look-up per byte.
+ * @param[in]   remainder       remainder of the previously processed items
+ * @param[in]   pItems          items that are added to the CRC
+ * @param[in]   numberOfItems   number of items in pItems
+ * @return  remainder after the items have been processed
+ */
+static uint16_t N775_CrcAddItemsTable(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems);
+#endif
+
+#if (N775_CRC_IMPLEMENTATION == N775_CRC_SLICE_BY_4) || defined(UNITY_UNIT_TEST)
+/**
+ * @brief   Computes the CRC with four independent look-ups per two items.
+ * @details The look-ups of one iteration do not depend on each other, which
+ *          shortens the dependency chain compared to #N775_CrcAddItemsTable().
+ *          A remaining odd item is processed with the first two tables.
+ * @param[in]   remainder       remainder of the previously processed items
+ * @param[in]   pItems          items that are added to the CRC
+ * @param[in]   numberOfItems   number of items in pItems
+ * @return  remainder after the items have been processed
+ */
+static uint16_t N775_CrcAddItemsSliceBy4(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems);
+#endif
+
+/*========== Static Function Implementations ================================*/
+static uint16_t N775_CrcAddItemsBitwise(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems) {
+    FAS_ASSERT(pItems != NULL_PTR);
+    uint16_t localRemainder = remainder;
+    for (uint16_t item = 0u; item < numberOfItems; item++) {
+        localRemainder ^= pItems[item];
+        for (uint8_t bit = 0u; bit < N775_CRC_BITS_PER_ITEM; bit++) {
+            /* Try to divide the current data bit */
+            if ((localRemainder & N775_CRC_MSB_MASK) > 0u) {
+                localRemainder = (uint16_t)(localRemainder << 1u) ^ N775_CRC_POLYNOMIAL;
+            } else {
+                localRemainder = (uint16_t)(localRemainder << 1u);
+            }
+        }
+    }
+    return localRemainder;
+}
+
+#if (N775_CRC_IMPLEMENTATION == N775_CRC_TABLE) || defined(UNITY_UNIT_TEST)
+static uint16_t N775_CrcAddItemsTable(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems) {
+    FAS_ASSERT(pItems != NULL_PTR);
+    uint16_t localRemainder = remainder;
+    for (uint16_t item = 0u; item < numberOfItems; item++) {
+        localRemainder ^= pItems[item];
+        /* upper byte first, then lower byte */
+        localRemainder = (uint16_t)(localRemainder << N775_CRC_BITS_PER_BYTE) ^
+                         n775_crcTable[0u][localRemainder >> N775_CRC_BITS_PER_BYTE];
+        localRemainder = (uint16_t)(localRemainder << N775_CRC_BITS_PER_BYTE) ^
+                         n775_crcTable[0u][localRemainder >> N775_CRC_BITS_PER_BYTE];
+    }
+    return localRemainder;
+}
+#endif
+
+#if (N775_CRC_IMPLEMENTATION == N775_CRC_SLICE_BY_4) || defined(UNITY_UNIT_TEST)
+static uint16_t N775_CrcAddItemsSliceBy4(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems) {
+    FAS_ASSERT(pItems != NULL_PTR);
+    uint16_t localRemainder = remainder;
+    uint16_t item           = 0u;
+    while ((item + 1u) < numberOfItems) {
+        const uint16_t first  = localRemainder ^ pItems[item];
+        const uint16_t second = pItems[item + 1u];
+
+        /* the four look-ups are independent of each other */
+        localRemainder = n775_crcTable[3u][first >> N775_CRC_BITS_PER_BYTE] ^
+                         n775_crcTable[2u][first & N775_CRC_BYTE_MASK] ^
+                         n775_crcTable[1u][second >> N775_CRC_BITS_PER_BYTE] ^
+                         n775_crcTable[0u][second & N775_CRC_BYTE_MASK];
+        item += 2u;
+    }
+    if (item < numberOfItems) {
+        const uint16_t last = localRemainder ^ pItems[item];
+        localRemainder      =
+            n775_crcTable[1u][last >> N775_CRC_BITS_PER_BYTE] ^ n775_crcTable[0u][last & N775_CRC_BYTE_MASK];
+    }
+    return localRemainder;
+}
+#endif
+
+/*========== Extern Function Implementations ================================*/
+extern uint16_t N775_CrcAddItems(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems) {
+#if N775_CRC_IMPLEMENTATION == N775_CRC_SLICE_BY_4
+    return N775_CrcAddItemsSliceBy4(remainder, pItems, numberOfItems);
+#elif N775_CRC_IMPLEMENTATION == N775_CRC_TABLE
+    return N775_CrcAddItemsTable(remainder, pItems, numberOfItems);
+#elif N775_CRC_IMPLEMENTATION == N775_CRC_BITWISE
+    return N775_CrcAddItemsBitwise(remainder, pItems, numberOfItems);
+#else
+#error "Unknown CRC implementation selected with N775_CRC_IMPLEMENTATION"
+#endif
+}
+
+extern uint16_t N775_CrcAddItem(uint16_t remainder, uint16_t item) {
+    return N775_CrcAddItems(remainder, &item, 1u);
+}
+
+extern STD_RETURN_TYPE_e must_check_return N775_CrcSelfTest(void) {
+    const uint16_t testSequence1[1] = {0x0000u};
+    FAS_ASSERT(N775_CrcAddItems(0u, testSequence1, 1u) == 0x0000u);
+
+    const uint16_t testSequence2[2] = {0x1234u, 0x5678u};
+    FAS_ASSERT(N775_CrcAddItems(0u, testSequence2, 2u) == 0xFD36u);
+
+    const uint16_t testSequence3[3] = {0xFFFFu, 0xFFFFu, 0xFFFFu};
+    FAS_ASSERT(N775_CrcAddItems(0u, testSequence3, 3u) == 0xAE15u);
+
+    const uint16_t testSequence4[5] = {0x0123u, 0x4567u, 0x89ABu, 0xCDEFu, 0xFEDCu};
+    FAS_ASSERT(N775_CrcAddItems(0u, testSequence4, 5u) == 0xBB74u);
+    /* the selected implementation must match the reference item by item */
+    FAS_ASSERT(
+        N775_CrcAddItem(N775_CrcAddItems(0u, testSequence4, 4u), testSequence4[4]) ==
+        N775_CrcAddItemsBitwise(0u, testSequence4, 5u));
+
+    return STD_OK;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern uint16_t TEST_N775_CrcAddItemsBitwise(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems) {
+    return N775_CrcAddItemsBitwise(remainder, pItems, numberOfItems);
+}
+extern uint16_t TEST_N775_CrcAddItemsTable(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems) {
+    return N775_CrcAddItemsTable(remainder, pItems, numberOfItems);
+}
+extern uint16_t TEST_N775_CrcAddItemsSliceBy4(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems) {
+    return N775_CrcAddItemsSliceBy4(remainder, pItems, numberOfItems);
+}
+#endif
@@ -0,0 +1,121 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    n775_crc.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup DRIVERS
+ * @prefix  N775
+ *
+ * @brief   Headers for the CRC16 calculation for the NXP MC33775A
+ *
+ * @details This module supports the calculation of the CRC16 that protects
+ *          the messages of the MC33775A. The polynomial is 0x9EB2 in Koopman
+ *          notation, i.e., 0x3D65 in normal notation.
+ *
+ */
+
+#ifndef FOXBMS__N775_CRC_H_
+#define FOXBMS__N775_CRC_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/** CRC calculation bit by bit, 16 iterations per item (reference) */
+#define N775_CRC_BITWISE (0u)
+/** CRC calculation with one look-up table, one look-up per byte */
+#define N775_CRC_TABLE (1u)
+/** CRC calculation with four look-up tables, two items per iteration */
+#define N775_CRC_SLICE_BY_4 (2u)
+
+/**
+ * @brief   selects the implementation that is used by #N775_CrcAddItems()
+ * @details All implementations compute the same CRC. The table-driven
+ *          implementations need 512 bytes (#N775_CRC_TABLE) and 2048 bytes
+ *          (#N775_CRC_SLICE_BY_4) of constant data.
+ */
+#define N775_CRC_IMPLEMENTATION (N775_CRC_SLICE_BY_4)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/**
+ * @brief   Adds a sequence of items to a CRC remainder.
+ * @details The items are processed in the order of the array, the most
+ *          significant bit of each item first. Start with a remainder of 0
+ *          to compute the CRC of a message.
+ * @param[in]   remainder       remainder of the previously processed items
+ * @param[in]   pItems          items that are added to the CRC
+ * @param[in]   numberOfItems   number of items in pItems
+ * @return  remainder after the items have been processed
+ */
+extern uint16_t N775_CrcAddItems(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems);
+
+/**
+ * @brief   Adds a single item to a CRC remainder.
+ * @details Shorthand for #N775_CrcAddItems() with one item.
+ * @param[in]   remainder   remainder of the previously processed items
+ * @param[in]   item        item that is added to the CRC
+ * @return  remainder after the item has been processed
+ */
+extern uint16_t N775_CrcAddItem(uint16_t remainder, uint16_t item);
+
+/**
+ * @brief   Test the CRC16-algorithm with known patterns.
+ * @details Tests the selected implementation with known patterns and
+ *          asserts that it matches the bitwise reference implementation.
+ * @return  #STD_OK if the selfcheck is successful and #STD_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e must_check_return N775_CrcSelfTest(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern uint16_t TEST_N775_CrcAddItemsBitwise(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems);
+extern uint16_t TEST_N775_CrcAddItemsTable(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems);
+extern uint16_t TEST_N775_CrcAddItemsSliceBy4(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems);
+#endif
+
+#endif /* FOXBMS__N775_CRC_H_ */
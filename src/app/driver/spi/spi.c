@@ -64,14 +64,151 @@
 /** Bitfield to check for transmission errors in SPI FLAG register */
 #define SPI_FLAG_REGISTER_TRANSMISSION_ERRORS (0x5Fu)
 
+/**
+ * Maximum age of the last activity in operating system ticks for which the
+ * FRC0 timestamp is evaluated. FRC0 wraps around after some minutes, older
+ * activities always lead to a wake-up.
+ */
+#define SPI_ACTIVITY_MAXIMUM_AGE_TICKS (1000u)
+
 /*========== Static Constant and Variable Definitions =======================*/
 
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
 
+/**
+ * @brief   Records the start of a transfer on an SPI interface.
+ * @details The start and not the end of the transfer is recorded. The idle
+ *          time of the devices is therefore overestimated, which is the safe
+ *          direction for the wake-up decision.
+ * @param   pSpiInterface pointer to SPI interface configuration
+ */
+static void SPI_RecordActivity(const SPI_INTERFACE_CONFIG_s *pSpiInterface);
+
+/**
+ * @brief   Checks if the devices on an SPI interface have to be woken up.
+ * @param   pSpiInterface       pointer to SPI interface configuration
+ * @param   wakeUpValidity_us   time after the start of the last transfer in
+ *                              which the devices are guaranteed to be awake,
+ *                              0 if the devices are always woken up
+ * @return  true if the wake-up byte has to be sent, false otherwise
+ */
+static bool SPI_IsWakeUpRequired(const SPI_INTERFACE_CONFIG_s *pSpiInterface, uint32_t wakeUpValidity_us);
+
+/**
+ * @brief   Writes the DMA configuration for a transfer on an SPI interface.
+ * @details Sets the buffers and lengths of the Tx and Rx DMA channels,
+ *          re-enables the channels, stores the interface for the DMA callback
+ *          and selects the data format. The CPU has to be in privileged mode.
+ * @param   pSpiInterface pointer to SPI interface configuration
+ * @param   pTxBuff pointer to data that is transmitted by the SPI interface
+ * @param   pRxBuff pointer to data that is received by the SPI interface
+ * @param   frameLength number of bytes to be transmitted by the SPI interface
+ */
+static void SPI_ConfigureDmaTransfer(
+    const SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+
 /*========== Static Function Implementations ================================*/
 
+static void SPI_RecordActivity(const SPI_INTERFACE_CONFIG_s *pSpiInterface) {
+    if (pSpiInterface->pActivity != NULL_PTR) {
+        pSpiInterface->pActivity->lastCount = MCU_GetFreeRunningCount();
+        pSpiInterface->pActivity->lastTick  = OS_GetTickCount();
+        pSpiInterface->pActivity->isValid   = true;
+    }
+}
+
+static bool SPI_IsWakeUpRequired(const SPI_INTERFACE_CONFIG_s *pSpiInterface, uint32_t wakeUpValidity_us) {
+    bool isWakeUpRequired           = true;
+    SPI_ACTIVITY_s *const pActivity = pSpiInterface->pActivity;
+
+    if ((pActivity != NULL_PTR) && (pActivity->isValid == true) && (wakeUpValidity_us > 0u)) {
+        const uint32_t age_ticks = OS_GetTickCount() - pActivity->lastTick;
+        if (age_ticks <= SPI_ACTIVITY_MAXIMUM_AGE_TICKS) {
+            const uint32_t age_us =
+                MCU_ConvertFrcDifferenceToTimespan_us(MCU_GetFreeRunningCount() - pActivity->lastCount);
+            if (age_us < wakeUpValidity_us) {
+                isWakeUpRequired = false;
+                pActivity->elidedWakeUps++;
+            }
+        }
+    }
+    return isWakeUpRequired;
+}
+
+static void SPI_ConfigureDmaTransfer(
+    const SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength) {
+    /* Set Tx buffer address */
+    dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].txChannel].ISADDR = (uint32_t)(uintptr_t)pTxBuff;
+    /* Set number of Tx bytes to transmit */
+    dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].txChannel].ITCOUNT =
+        (frameLength << 16U) | 1U;
+
+    /* Set Rx buffer address */
+    dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].rxChannel].IDADDR = (uint32_t)(uintptr_t)pRxBuff;
+    /* Set number of Rx bytes to receive */
+    dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].rxChannel].ITCOUNT =
+        (frameLength << 16U) | 1U;
+
+    uint8_t spiFmtRegister = 0U;
+    switch (pSpiInterface->pConfig->DFSEL) {
+        case 0U:
+            spiFmtRegister = 0U;
+            break;
+        case 1U:
+            spiFmtRegister = 1U;
+            break;
+        case 2U:
+            spiFmtRegister = 2U;
+            break;
+        case 3U:
+            spiFmtRegister = 3U;
+            break;
+        default:
+            spiFmtRegister = 0U;
+            break;
+    }
+
+    /* Re-enable channels; because auto-init is disabled */
+    /* Disable otherwise transmission  is constantly ongoping */
+    dmaSetChEnable((dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].txChannel, (dmaTriggerType_t)DMA_HW);
+    dmaSetChEnable((dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].rxChannel, (dmaTriggerType_t)DMA_HW);
+
+    /* Store the CS pin to be deactivated in DMA callback */
+    spi_dmaTransmission[pSpiInterface->channel].channel  = pSpiInterface->channel;
+    spi_dmaTransmission[pSpiInterface->channel].pConfig  = pSpiInterface->pConfig;
+    spi_dmaTransmission[pSpiInterface->channel].pNode    = pSpiInterface->pNode;
+    spi_dmaTransmission[pSpiInterface->channel].pGioPort = pSpiInterface->pGioPort;
+    spi_dmaTransmission[pSpiInterface->channel].csPin    = pSpiInterface->csPin;
+
+    /* DMA seems to only be able to use FMT0, save FMT0 config */
+    spi_saveFmt0[pSpiInterface->channel] = pSpiInterface->pNode->FMT0;
+
+    /* DMA seems to only be able to use FMT0, write actual FMT in FMT0 */
+    switch (spiFmtRegister) {
+        case 0U:
+            break;
+        case 1U:
+            pSpiInterface->pNode->FMT0 = pSpiInterface->pNode->FMT1;
+            break;
+        case 2U:
+            pSpiInterface->pNode->FMT0 = pSpiInterface->pNode->FMT2;
+            break;
+        case 3U:
+            pSpiInterface->pNode->FMT0 = pSpiInterface->pNode->FMT3;
+            break;
+        default:
+            break;
+    }
+}
+
 /*========== Extern Function Implementations ================================*/
 
 extern STD_RETURN_TYPE_e SPI_TransmitDummyByte(SPI_INTERFACE_CONFIG_s *pSpiInterface, uint32_t delay) {
@@ -81,6 +218,7 @@ extern STD_RETURN_TYPE_e SPI_TransmitDummyByte(SPI_INTERFACE_CONFIG_s *pSpiInter
     /* Lock SPI hardware to prevent concurrent read/write commands */
     if (STD_OK == SPI_Lock(pSpiInterface->channel)) {
         IO_PinReset((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+        SPI_RecordActivity(pSpiInterface);
         uint32_t spiRetval =
             spiTransmitData(pSpiInterface->pNode, ((spiDAT1_t *)pSpiInterface->pConfig), 1u, spi_cmdDummy);
         IO_PinSet((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
@@ -103,6 +241,7 @@ STD_RETURN_TYPE_e SPI_TransmitData(SPI_INTERFACE_CONFIG_s *pSpiInterface, uint16
     /* Lock SPI hardware to prevent concurrent read/write commands */
     if (STD_OK == SPI_Lock(pSpiInterface->channel)) {
         IO_PinReset((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+        SPI_RecordActivity(pSpiInterface);
         uint32_t spiRetval =
             spiTransmitData(pSpiInterface->pNode, ((spiDAT1_t *)pSpiInterface->pConfig), frameLength, pTxBuff);
         IO_PinSet((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
@@ -121,12 +260,15 @@ STD_RETURN_TYPE_e SPI_TransmitData(SPI_INTERFACE_CONFIG_s *pSpiInterface, uint16
 STD_RETURN_TYPE_e SPI_TransmitDataWithDummy(
     SPI_INTERFACE_CONFIG_s *pSpiInterface,
     uint32_t delay,
+    uint32_t wakeUpValidity_us,
     uint16_t *pTxBuff,
     uint32_t frameLength) {
     STD_RETURN_TYPE_e retval = STD_OK;
 
-    /* Transmit dummy byte */
-    if (SPI_TransmitDummyByte(pSpiInterface, delay) == STD_OK) {
+    if (SPI_IsWakeUpRequired(pSpiInterface, wakeUpValidity_us) == false) {
+        /* Devices are still awake, skip dummy byte and wake-up time */
+        retval = SPI_TransmitData(pSpiInterface, pTxBuff, frameLength);
+    } else if (SPI_TransmitDummyByte(pSpiInterface, delay) == STD_OK) {
         /* Transmit data only if transmission of dummy byte was successful */
         retval = SPI_TransmitData(pSpiInterface, pTxBuff, frameLength);
     } else {
@@ -145,6 +287,7 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveData(
     /* Lock SPI hardware to prevent concurrent read/write commands */
     if (STD_OK == SPI_Lock(pSpiInterface->channel)) {
         IO_PinReset((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+        SPI_RecordActivity(pSpiInterface);
         uint32_t spiRetval = SPI_DirectlyTransmitReceiveData(pSpiInterface, pTxBuff, pRxBuff, frameLength);
         IO_PinSet((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
 
@@ -197,72 +340,7 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma(
             /* Go to privilege mode to write DMA config registers */
             FSYS_RaisePrivilege();
 
-            /* Set Tx buffer address */
-            dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].txChannel].ISADDR =
-                (uint32_t)pTxBuff;
-            /* Set number of Tx bytes to send */
-            dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].txChannel].ITCOUNT =
-                (frameLength << 16U) | 1U;
-
-            /* Set Rx buffer address */
-            dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].rxChannel].IDADDR =
-                (uint32_t)pRxBuff;
-            /* Set number of Rx bytes to receive */
-            dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].rxChannel].ITCOUNT =
-                (frameLength << 16U) | 1U;
-
-            uint8_t spiFmtRegister = 0U;
-            switch (pSpiInterface->pConfig->DFSEL) {
-                case 0U:
-                    spiFmtRegister = 0U;
-                    break;
-                case 1U:
-                    spiFmtRegister = 1U;
-                    break;
-                case 2U:
-                    spiFmtRegister = 2U;
-                    break;
-                case 3U:
-                    spiFmtRegister = 3U;
-                    break;
-                default:
-                    spiFmtRegister = 0U;
-                    break;
-            }
-
-            /* Re-enable channels; because auto-init is disabled */
-            /* Disable otherwise transmission  is constantly ongoping */
-            dmaSetChEnable(
-                (dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].txChannel, (dmaTriggerType_t)DMA_HW);
-            dmaSetChEnable(
-                (dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].rxChannel, (dmaTriggerType_t)DMA_HW);
-
-            /* Store the CS pin to be deactivated in DMA callback */
-            spi_dmaTransmission[pSpiInterface->channel].channel  = pSpiInterface->channel;
-            spi_dmaTransmission[pSpiInterface->channel].pConfig  = pSpiInterface->pConfig;
-            spi_dmaTransmission[pSpiInterface->channel].pNode    = pSpiInterface->pNode;
-            spi_dmaTransmission[pSpiInterface->channel].pGioPort = pSpiInterface->pGioPort;
-            spi_dmaTransmission[pSpiInterface->channel].csPin    = pSpiInterface->csPin;
-
-            /* DMA seems to only be able to use FMT0, save FMT0 config */
-            spi_saveFmt0[pSpiInterface->channel] = pSpiInterface->pNode->FMT0;
-
-            /* DMA seems to only be able to use FMT0, write actual FMT in FMT0 */
-            switch (spiFmtRegister) {
-                case 0U:
-                    break;
-                case 1U:
-                    pSpiInterface->pNode->FMT0 = pSpiInterface->pNode->FMT1;
-                    break;
-                case 2U:
-                    pSpiInterface->pNode->FMT0 = pSpiInterface->pNode->FMT2;
-                    break;
-                case 3U:
-                    pSpiInterface->pNode->FMT0 = pSpiInterface->pNode->FMT3;
-                    break;
-                default:
-                    break;
-            }
+            SPI_ConfigureDmaTransfer(pSpiInterface, pTxBuff, pRxBuff, frameLength);
 
             /* DMA config registers written, leave privilege mode */
             FSYS_SwitchToUserMode();
@@ -271,6 +349,7 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma(
 
             /* Software activate CS */
             IO_PinReset((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+            SPI_RecordActivity(pSpiInterface);
             /* DMA_REQ_Enable */
             /* Starts DMA requests if SPIEN is also set to 1 */
             pSpiInterface->pNode->INT0 |= DMAREQEN_BIT;
@@ -287,6 +366,7 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma(
 extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataWithDummyDma(
     SPI_INTERFACE_CONFIG_s *pSpiInterface,
     uint32_t delay,
+    uint32_t wakeUpValidity_us,
     uint16_t *pTxBuff,
     uint16_t *pRxBuff,
     uint32_t frameLength) {
@@ -304,89 +384,29 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataWithDummyDma(
             /* Go to privilege mode to write DMA config registers */
             FSYS_RaisePrivilege();
 
-            /* Set Tx buffer address */
-            dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].txChannel].ISADDR =
-                (uint32_t)pTxBuff;
-            /* Set number of Tx bytes to transmit */
-            dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].txChannel].ITCOUNT =
-                (frameLength << 16U) | 1U;
-
-            /* Set Rx buffer address */
-            dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].rxChannel].IDADDR =
-                (uint32_t)pRxBuff;
-            /* Set number of Rx bytes to receive */
-            dmaRAMREG->PCP[(dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].rxChannel].ITCOUNT =
-                (frameLength << 16U) | 1U;
-
-            uint8_t spiFmtRegister = 0U;
-            switch (pSpiInterface->pConfig->DFSEL) {
-                case 0U:
-                    spiFmtRegister = 0U;
-                    break;
-                case 1U:
-                    spiFmtRegister = 1U;
-                    break;
-                case 2U:
-                    spiFmtRegister = 2U;
-                    break;
-                case 3U:
-                    spiFmtRegister = 3U;
-                    break;
-                default:
-                    spiFmtRegister = 0U;
-                    break;
-            }
-
-            /* Re-enable channels; because auto-init is disabled */
-            /* Disable otherwise transmission  is constantly ongoping */
-            dmaSetChEnable(
-                (dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].txChannel, (dmaTriggerType_t)DMA_HW);
-            dmaSetChEnable(
-                (dmaChannel_t)dma_spiDmaChannels[pSpiInterface->channel].rxChannel, (dmaTriggerType_t)DMA_HW);
-
-            /* Store the CS pin to be deactivated in DMA callback */
-            spi_dmaTransmission[pSpiInterface->channel].channel  = pSpiInterface->channel;
-            spi_dmaTransmission[pSpiInterface->channel].pConfig  = pSpiInterface->pConfig;
-            spi_dmaTransmission[pSpiInterface->channel].pNode    = pSpiInterface->pNode;
-            spi_dmaTransmission[pSpiInterface->channel].pGioPort = pSpiInterface->pGioPort;
-            spi_dmaTransmission[pSpiInterface->channel].csPin    = pSpiInterface->csPin;
-
-            /* DMA seems to only be able to use FMT0, save FMT0 config */
-            spi_saveFmt0[pSpiInterface->channel] = pSpiInterface->pNode->FMT0;
-
-            /* DMA seems to only be able to use FMT0, write actual FMT in FMT0 */
-            switch (spiFmtRegister) {
-                case 0U:
-                    break;
-                case 1U:
-                    pSpiInterface->pNode->FMT0 = pSpiInterface->pNode->FMT1;
-                    break;
-                case 2U:
-                    pSpiInterface->pNode->FMT0 = pSpiInterface->pNode->FMT2;
-                    break;
-                case 3U:
-                    pSpiInterface->pNode->FMT0 = pSpiInterface->pNode->FMT3;
-                    break;
-                default:
-                    break;
-            }
+            SPI_ConfigureDmaTransfer(pSpiInterface, pTxBuff, pRxBuff, frameLength);
 
             /* DMA config registers written, leave privilege mode */
             FSYS_SwitchToUserMode();
 
             OS_ExitTaskCritical();
 
-            IO_PinReset((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
-            uint32_t spiRetval =
-                spiTransmitData(pSpiInterface->pNode, ((spiDAT1_t *)pSpiInterface->pConfig), 1u, spi_cmdDummy);
-            IO_PinSet((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+            uint32_t spiRetval = 0u;
+            if (SPI_IsWakeUpRequired(pSpiInterface, wakeUpValidity_us) == true) {
+                IO_PinReset((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+                spiRetval =
+                    spiTransmitData(pSpiInterface->pNode, ((spiDAT1_t *)pSpiInterface->pConfig), 1u, spi_cmdDummy);
+                IO_PinSet((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+                if ((spiRetval & SPI_FLAG_REGISTER_TRANSMISSION_ERRORS) == 0u) {
+                    MCU_delay_us(delay);
+                }
+            }
             if ((spiRetval & SPI_FLAG_REGISTER_TRANSMISSION_ERRORS) == 0u) {
                 /* No error flag set during communication */
 
-                MCU_delay_us(delay);
-
                 /* Software activate CS */
                 IO_PinReset((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+                SPI_RecordActivity(pSpiInterface);
                 /* DMA_REQ_Enable */
                 /* Starts DMA requests if SPIEN is also set to 1 */
                 pSpiInterface->pNode->INT0 |= DMAREQEN_BIT;
@@ -400,6 +420,80 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataWithDummyDma(
     return retVal;
 }
 
+extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaLocked(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength) {
+    FAS_ASSERT(pSpiInterface != NULL_PTR);
+    FAS_ASSERT(pTxBuff != NULL_PTR);
+    FAS_ASSERT(pRxBuff != NULL_PTR);
+    FAS_ASSERT(pSpiInterface->channel < spi_nrBusyFlags);
+    /* the caller has to hold the lock of the interface */
+    FAS_ASSERT(*(spi_busyFlags + pSpiInterface->channel) == SPI_BUSY);
+
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+
+    OS_EnterTaskCritical();
+    /* Check that not SPI transmission over DMA is taking place */
+    if ((pSpiInterface->pNode->INT0 & DMAREQEN_BIT) == 0x0) {
+        /* Go to privilege mode to write DMA config registers */
+        FSYS_RaisePrivilege();
+
+        SPI_ConfigureDmaTransfer(pSpiInterface, pTxBuff, pRxBuff, frameLength);
+
+        /* DMA config registers written, leave privilege mode */
+        FSYS_SwitchToUserMode();
+        retVal = STD_OK;
+    }
+    OS_ExitTaskCritical();
+
+    if (retVal == STD_OK) {
+        /* Software activate CS */
+        IO_PinReset((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+        SPI_RecordActivity(pSpiInterface);
+        /* DMA_REQ_Enable */
+        /* Starts DMA requests if SPIEN is also set to 1 */
+        pSpiInterface->pNode->INT0 |= DMAREQEN_BIT;
+    }
+
+    return retVal;
+}
+
+extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaFromIsr(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength) {
+    FAS_ASSERT(pSpiInterface != NULL_PTR);
+    FAS_ASSERT(pTxBuff != NULL_PTR);
+    FAS_ASSERT(pRxBuff != NULL_PTR);
+
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+
+    /* Called with interrupts disabled and in privileged mode: neither a
+       critical section nor a mode switch is needed to write the DMA config */
+    if ((pSpiInterface->channel < spi_nrBusyFlags) && (*(spi_busyFlags + pSpiInterface->channel) == SPI_IDLE)) {
+        /* Check that not SPI transmission over DMA is taking place */
+        if ((pSpiInterface->pNode->INT0 & DMAREQEN_BIT) == 0x0) {
+            *(spi_busyFlags + pSpiInterface->channel) = SPI_BUSY;
+
+            SPI_ConfigureDmaTransfer(pSpiInterface, pTxBuff, pRxBuff, frameLength);
+
+            /* Software activate CS */
+            IO_PinReset((uint32_t *)pSpiInterface->pGioPort, pSpiInterface->csPin);
+            SPI_RecordActivity(pSpiInterface);
+            /* DMA_REQ_Enable */
+            /* Starts DMA requests if SPIEN is also set to 1 */
+            pSpiInterface->pNode->INT0 |= DMAREQEN_BIT;
+
+            retVal = STD_OK;
+        }
+    }
+
+    return retVal;
+}
+
 extern STD_RETURN_TYPE_e SPI_Lock(uint8_t spi) {
     STD_RETURN_TYPE_e retVal = STD_NOT_OK;
 
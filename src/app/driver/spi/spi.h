@@ -76,10 +76,14 @@ extern STD_RETURN_TYPE_e SPI_TransmitDummyByte(SPI_INTERFACE_CONFIG_s *pSpiInter
 /**
  * @brief   Sends data on SPI without DMA, with wake-up byte.
  *
- * It calls SPI_SendDummyByte() to wake-up the SPI interface.
+ * It calls SPI_SendDummyByte() to wake-up the SPI interface. The wake-up
+ * byte and the delay are skipped if the activity of the interface is tracked
+ * and the last transfer started less than wakeUpValidity_us ago.
  *
  * @param   pSpiInterface pointer to SPI interface configuration
  * @param   delay delay to wait after dummy byte transfer
+ * @param   wakeUpValidity_us time after the start of the last transfer in
+ *          which the devices do not need to be woken up, 0 to always wake up
  * @param   pTxBuff pointer to data that is transmitted by the SPI interface
  * @param   frameLength number of bytes to be transmitted by the SPI interface
  *
@@ -88,6 +92,7 @@ extern STD_RETURN_TYPE_e SPI_TransmitDummyByte(SPI_INTERFACE_CONFIG_s *pSpiInter
 extern STD_RETURN_TYPE_e SPI_TransmitDataWithDummy(
     SPI_INTERFACE_CONFIG_s *pSpiInterface,
     uint32_t delay,
+    uint32_t wakeUpValidity_us,
     uint16_t *pTxBuff,
     uint32_t frameLength);
 
@@ -164,9 +169,13 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma(
  * @brief   Transmits and receives data on SPI with DMA.
  * @details This function can be used to send and receive data via SPI. SPI
  *          communication is performed in blocking mode and chip select is
- *          set/reset automatically. A dummy is sent first.
+ *          set/reset automatically. A dummy is sent first, unless the
+ *          activity of the interface is tracked and the last transfer started
+ *          less than wakeUpValidity_us ago.
  * @param   pSpiInterface pointer to SPI interface configuration
  * @param   delay delay to wait after dummy byte transfer
+ * @param   wakeUpValidity_us time after the start of the last transfer in
+ *          which the devices do not need to be woken up, 0 to always wake up
  * @param   pTxBuff pointer to data that is transmitted by the SPI interface
  * @param   pRxBuff pointer to data that is received by the SPI interface
  * @param   frameLength number of bytes to be transmitted by the SPI interface
@@ -176,6 +185,52 @@ extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDma(
 extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataWithDummyDma(
     SPI_INTERFACE_CONFIG_s *pSpiInterface,
     uint32_t delay,
+    uint32_t wakeUpValidity_us,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+
+/**
+ * @brief   Transmits and receives data on SPI with DMA on an interface that
+ *          the caller has locked.
+ * @details This function is used if the transfer has to follow other
+ *          transfers without another task using the interface in between
+ *          (e.g., a command that is only valid for the next transfer). The
+ *          lock of the caller is handed over to the transfer and released by
+ *          the DMA callback. If the transfer is not started, the interface
+ *          stays locked and has to be unlocked by the caller. Chip select is
+ *          set/reset automatically.
+ * @param   pSpiInterface pointer to SPI interface configuration
+ * @param   pTxBuff pointer to data that is transmitted by the SPI interface
+ * @param   pRxBuff pointer to data that is received by the SPI interface
+ * @param   frameLength number of bytes to be transmitted by the SPI interface
+ * @return  #STD_OK if the transfer was started, #STD_NOT_OK if a DMA transfer
+ *          is still ongoing
+ */
+extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaLocked(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+
+/**
+ * @brief   Transmits and receives data on SPI with DMA from the DMA complete
+ *          interrupt.
+ * @details This function is used to chain transfers: it starts the next
+ *          transfer directly from the DMA callback of the previous one. It
+ *          must only be called from interrupt context, where interrupts are
+ *          disabled and the CPU is in privileged mode. No dummy byte is sent,
+ *          the devices are still awake from the previous transfer. Chip
+ *          select is set/reset automatically.
+ * @param   pSpiInterface pointer to SPI interface configuration
+ * @param   pTxBuff pointer to data that is transmitted by the SPI interface
+ * @param   pRxBuff pointer to data that is received by the SPI interface
+ * @param   frameLength number of bytes to be transmitted by the SPI interface
+ * @return  #STD_OK if the transfer was started, #STD_NOT_OK if the interface
+ *          is busy
+ */
+extern STD_RETURN_TYPE_e SPI_TransmitReceiveDataDmaFromIsr(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
     uint16_t *pTxBuff,
     uint16_t *pRxBuff,
     uint32_t frameLength);
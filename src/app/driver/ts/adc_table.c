@@ -0,0 +1,96 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    adc_table.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup TEMPERATURE_SENSORS
+ * @prefix  TS
+ *
+ * @brief   Temperature lookup with tables that are indexed by the ADC voltage
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "adc_table.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+extern int16_t TS_GetTemperatureFromAdcTable(const TS_ADC_TABLE_s *pTable, uint16_t adcVoltage_mV) {
+    FAS_ASSERT(pTable != NULL_PTR);
+    FAS_ASSERT(pTable->pTemperatures != NULL_PTR);
+    int16_t temperature_ddegC = 0;
+
+    if (adcVoltage_mV > pTable->maximumVoltage_mV) {
+        /* Invalid measured ADC voltage -> sensor out of operating range or disconnected/shorted */
+        temperature_ddegC = INT16_MIN;
+    } else if (adcVoltage_mV < pTable->minimumVoltage_mV) {
+        /* Invalid measured ADC voltage -> sensor out of operating range or shorted/disconnected */
+        temperature_ddegC = INT16_MAX;
+    } else {
+        const uint16_t offset_mV   = adcVoltage_mV - pTable->minimumVoltage_mV;
+        const uint16_t index       = offset_mV >> pTable->stepShift;
+        const int32_t remainder_mV = (int32_t)offset_mV - (int32_t)((uint32_t)index << pTable->stepShift);
+        int32_t scaledTemperature  = pTable->pTemperatures[index];
+        if (remainder_mV != 0) {
+            /* the generator adds an entry beyond the maximum voltage, if it is not on the grid */
+            FAS_ASSERT((index + 1u) < pTable->nrOfEntries);
+            const int32_t difference = (int32_t)pTable->pTemperatures[index + 1u] - scaledTemperature;
+            scaledTemperature += (difference * remainder_mV) / (int32_t)(1u << pTable->stepShift);
+        }
+        /* truncate towards zero like the conversion of the floating point calculation */
+        temperature_ddegC = (int16_t)(scaledTemperature / TS_ADC_TABLE_TEMPERATURE_SCALE);
+    }
+    return temperature_ddegC;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -0,0 +1,90 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    adc_table.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup TEMPERATURE_SENSORS
+ * @prefix  TS
+ *
+ * @brief   Temperature lookup with tables that are indexed by the ADC voltage
+ *
+ * @details The table of a sensor replaces the calculation of the NTC
+ *          resistance and the search in the resistance LUT by an index
+ *          calculation and an integer interpolation.
+ *
+ */
+
+#ifndef FOXBMS__ADC_TABLE_H_
+#define FOXBMS__ADC_TABLE_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "temperature_sensor_defs.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/**
+ * largest deviation in deci &deg;C of #TS_GetTemperatureFromAdcTable() from
+ * the floating point calculation with the resistance LUT (checked by
+ * tools/ts/ntc_table_generator.py and the unit tests of the sensors)
+ */
+#define TS_ADC_TABLE_TOLERANCE_ddegC (1)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   returns the temperature of a measured ADC voltage
+ * @param   pTable          table of the temperature sensor
+ * @param   adcVoltage_mV   voltage in mV
+ * @return  corresponding temperature in deci &deg;C or INT16_MAX/INT16_MIN if
+ *          the voltage is outside of the operating range, i.e., the NTC is
+ *          shorted or got disconnected
+ */
+extern int16_t TS_GetTemperatureFromAdcTable(const TS_ADC_TABLE_s *pTable, uint16_t adcVoltage_mV);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__ADC_TABLE_H_ */
@@ -169,7 +169,7 @@ extern int16_t TS_Epc00GetTemperatureFromLut(uint16_t adcVoltage_mV) {
         /* Variables for interpolating LUT value */
         uint16_t between_high = 0;
         uint16_t between_low  = 0;
-        for (uint16_t i = 1; i < b57251v5103j060LutSize; i++) {
+        for (uint16_t i = 0u; i < b57251v5103j060LutSize; i++) {
             if (resistance_Ohm < ts_b57251v5103j060Lut[i].resistance_Ohm) {
                 between_low  = i + 1u;
                 between_high = i;
@@ -178,7 +178,7 @@ extern int16_t TS_Epc00GetTemperatureFromLut(uint16_t adcVoltage_mV) {
 
         /* Interpolate between LUT values, but do not extrapolate LUT! */
         if (!(((between_high == 0u) && (between_low == 0u)) || /* measured resistance > maximum LUT resistance */
-              (between_low > b57251v5103j060LutSize))) {       /* measured resistance < minimum LUT resistance */
+              (between_low >= b57251v5103j060LutSize))) {      /* measured resistance < minimum LUT resistance */
             temperature_ddegC = (int16_t)MATH_linearInterpolation(
                 ts_b57251v5103j060Lut[between_low].resistance_Ohm,
                 ts_b57251v5103j060Lut[between_low].temperature_ddegC,
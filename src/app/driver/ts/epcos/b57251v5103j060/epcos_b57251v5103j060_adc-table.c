@@ -0,0 +1,149 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    epcos_b57251v5103j060_adc-table.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup TEMPERATURE_SENSORS
+ * @prefix  TS
+ *
+ * @brief   ADC voltage indexed temperature table of the epcos b57251v5103j060
+ *
+ * @details This file is generated from the LUT in epcos_b57251v5103j060.c and
+ *          the resistor divider in epcos_b57251v5103j060.h by
+ *          tools/ts/ntc_table_generator.py, do not edit it.
+ *          Operating range: 45 mV to 2474 mV, spacing: 4 mV.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "epcos_b57251v5103j060.h"
+
+#include "temperature_sensor_defs.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/* clang-format off */
+/** temperatures in 1/16 deci &deg;C, spacing 4 mV */
+static const int16_t ts_b57251v5103j060AdcTableTemperatures[609u] = {
+     23955,  23373,  22842,  22342,  21899,  21475,  21091,  20719,  20386,  20052,
+     19758,  19469,  19183,  18935,  18686,  18437,  18218,  18004,  17789,  17578,
+     17394,  17210,  17025,  16840,  16677,  16519,  16360,  16202,  16042,  15901,
+     15765,  15630,  15494,  15357,  15220,  15101,  14985,  14869,  14752,  14635,
+     14518,  14400,  14301,  14202,  14102,  14002,  13902,  13802,  13701,  13599,
+     13515,  13430,  13345,  13259,  13173,  13087,  13001,  12914,  12827,  12750,
+     12677,  12604,  12531,  12458,  12384,  12310,  12236,  12161,  12086,  12011,
+     11947,  11885,  11822,  11759,  11696,  11633,  11569,  11506,  11442,  11377,
+     11313,  11248,  11186,  11133,  11079,  11025,  10971,  10916,  10862,  10807,
+     10752,  10697,  10641,  10586,  10530,  10474,  10418,  10368,  10322,  10275,
+     10229,  10182,  10135,  10087,  10040,   9992,   9945,   9897,   9849,   9800,
+      9752,   9703,   9654,   9605,   9564,   9524,   9483,   9443,   9402,   9361,
+      9320,   9278,   9237,   9195,   9154,   9112,   9070,   9027,   8985,   8942,
+      8900,   8857,   8813,   8776,   8741,   8705,   8670,   8634,   8598,   8563,
+      8526,   8490,   8454,   8417,   8381,   8344,   8307,   8270,   8232,   8195,
+      8157,   8119,   8081,   8043,   8005,   7973,   7942,   7911,   7879,   7848,
+      7816,   7785,   7753,   7721,   7688,   7656,   7624,   7591,   7558,   7525,
+      7492,   7459,   7426,   7392,   7359,   7325,   7291,   7257,   7222,   7190,
+      7163,   7135,   7107,   7079,   7051,   7022,   6994,   6965,   6937,   6908,
+      6879,   6850,   6820,   6791,   6762,   6732,   6702,   6672,   6642,   6612,
+      6581,   6551,   6520,   6489,   6458,   6427,   6397,   6372,   6346,   6321,
+      6296,   6270,   6245,   6219,   6193,   6167,   6141,   6115,   6088,   6062,
+      6035,   6008,   5981,   5954,   5927,   5900,   5872,   5844,   5817,   5789,
+      5761,   5732,   5704,   5676,   5647,   5618,   5591,   5568,   5545,   5522,
+      5499,   5475,   5451,   5428,   5404,   5380,   5356,   5331,   5307,   5282,
+      5258,   5233,   5208,   5183,   5157,   5132,   5107,   5081,   5055,   5029,
+      5003,   4977,   4950,   4924,   4897,   4870,   4843,   4816,   4791,   4770,
+      4748,   4726,   4704,   4682,   4660,   4638,   4615,   4592,   4570,   4547,
+      4524,   4501,   4477,   4454,   4430,   4407,   4383,   4359,   4335,   4310,
+      4286,   4261,   4237,   4212,   4187,   4161,   4136,   4110,   4085,   4059,
+      4033,   4007,   3985,   3964,   3943,   3922,   3901,   3880,   3858,   3837,
+      3815,   3793,   3771,   3749,   3727,   3705,   3682,   3660,   3637,   3614,
+      3591,   3567,   3544,   3520,   3496,   3472,   3448,   3424,   3399,   3375,
+      3350,   3325,   3300,   3274,   3249,   3223,   3198,   3178,   3157,   3137,
+      3116,   3096,   3075,   3054,   3032,   3011,   2989,   2968,   2946,   2924,
+      2901,   2879,   2856,   2834,   2811,   2788,   2764,   2741,   2717,   2694,
+      2670,   2645,   2621,   2596,   2572,   2547,   2521,   2496,   2470,   2445,
+      2419,   2394,   2374,   2353,   2333,   2312,   2291,   2270,   2248,   2227,
+      2205,   2183,   2161,   2139,   2116,   2093,   2070,   2047,   2024,   2001,
+      1977,   1953,   1929,   1904,   1880,   1855,   1830,   1805,   1779,   1753,
+      1727,   1701,   1675,   1648,   1621,   1595,   1574,   1553,   1532,   1510,
+      1488,   1466,   1444,   1421,   1399,   1376,   1353,   1329,   1306,   1282,
+      1258,   1233,   1209,   1184,   1159,   1133,   1107,   1081,   1055,   1029,
+      1002,    975,    947,    920,    892,    863,    835,    806,    782,    760,
+       737,    714,    691,    667,    644,    620,    595,    571,    546,    520,
+       495,    469,    443,    416,    390,    362,    335,    307,    279,    250,
+       221,    192,    162,    132,    102,     71,     39,      7,    -19,    -43,
+       -68,    -93,   -119,   -145,   -171,   -198,   -225,   -252,   -280,   -308,
+      -337,   -366,   -396,   -426,   -456,   -487,   -519,   -550,   -583,   -616,
+      -649,   -683,   -718,   -753,   -789,   -819,   -846,   -874,   -903,   -932,
+      -961,   -991,  -1022,  -1053,  -1085,  -1117,  -1150,  -1183,  -1217,  -1252,
+     -1288,  -1324,  -1360,  -1398,  -1436,  -1475,  -1515,  -1556,  -1598,  -1629,
+     -1661,  -1694,  -1727,  -1762,  -1796,  -1832,  -1869,  -1906,  -1944,  -1983,
+     -2023,  -2064,  -2106,  -2149,  -2193,  -2238,  -2285,  -2332,  -2381,  -2423,
+     -2461,  -2499,  -2539,  -2580,  -2622,  -2665,  -2710,  -2756,  -2803,  -2852,
+     -2902,  -2954,  -3007,  -3063,  -3120,  -3179,  -3229,  -3275,  -3322,  -3371,
+     -3422,  -3475,  -3530,  -3588,  -3647,  -3709,  -3773,  -3841,  -3911,  -3984,
+     -4044,  -4101,  -4161,  -4225,  -4291,  -4361,  -4434,  -4512,  -4594,  -4680,
+     -4772,  -4849,  -4922,  -5000,  -5084,  -5173,  -5268,  -5371,  -5482,  -5601,
+     -5692,  -5790,  -5898,  -6017,  -6147,  -6291,  -6436,  -6560,  -6700,  -6860,
+     -7042,  -7236,  -7405,  -7605,  -7847,  -8097,  -8349,  -8675,  -9115,
+};
+/* clang-format on */
+
+/*========== Extern Constant and Variable Definitions =======================*/
+const TS_ADC_TABLE_s ts_b57251v5103j060AdcTable = {
+    .minimumVoltage_mV = 45u,
+    .maximumVoltage_mV = 2474u,
+    .stepShift         = 2u,
+    .nrOfEntries       = 609u,
+    .pTemperatures     = ts_b57251v5103j060AdcTableTemperatures,
+};
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -52,6 +52,7 @@
  */
 
 /*========== Includes =======================================================*/
+#include "adc_table.h"
 #include "epcos_b57251v5103j060.h"
 #include "tsi.h"
 
@@ -68,7 +69,7 @@
 /*========== Extern Function Implementations ================================*/
 
 extern int16_t TSI_GetTemperature(uint16_t adcVoltage_mV) {
-    return TS_Epc00GetTemperatureFromLut(adcVoltage_mV);
+    return TS_GetTemperatureFromAdcTable(&ts_b57251v5103j060AdcTable, adcVoltage_mV);
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -170,7 +170,7 @@ extern int16_t TS_Epc01GetTemperatureFromLut(uint16_t adcVoltage_mV) {
         /* Variables for interpolating LUT value */
         uint16_t between_high = 0;
         uint16_t between_low  = 0;
-        for (uint16_t i = 1; i < ts_b57861s0103f045LutSize; i++) {
+        for (uint16_t i = 0u; i < ts_b57861s0103f045LutSize; i++) {
             if (resistance_Ohm < ts_b57861s0103f045Lut[i].resistance_Ohm) {
                 between_low  = i + 1u;
                 between_high = i;
@@ -179,7 +179,7 @@ extern int16_t TS_Epc01GetTemperatureFromLut(uint16_t adcVoltage_mV) {
 
         /* Interpolate between LUT values, but do not extrapolate LUT! */
         if (!(((between_high == 0u) && (between_low == 0u)) || /* measured resistance > maximum LUT resistance */
-              (between_low > ts_b57861s0103f045LutSize))) {    /* measured resistance < minimum LUT resistance */
+              (between_low >= ts_b57861s0103f045LutSize))) {   /* measured resistance < minimum LUT resistance */
             temperature_ddegC = (int16_t)MATH_linearInterpolation(
                 ts_b57861s0103f045Lut[between_low].resistance_Ohm,
                 ts_b57861s0103f045Lut[between_low].temperature_ddegC,
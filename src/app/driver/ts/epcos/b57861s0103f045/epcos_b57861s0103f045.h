@@ -77,6 +77,8 @@
 /*========== Includes =======================================================*/
 #include "general.h"
 
+#include "temperature_sensor_defs.h"
+
 /*========== Macros and Definitions =========================================*/
 /**
  * Position of the NTC in the voltage resistor
@@ -98,6 +100,9 @@
 #define TS_EPCOS_B57861S0103F045_RESISTOR_DIVIDER_RESISTANCE_R_1_R_2_Ohm (10000.0f)
 
 /*========== Extern Constant and Variable Declarations ======================*/
+/** temperature table indexed by the ADC voltage, generated by tools/ts/ntc_table_generator.py */
+extern const TS_ADC_TABLE_s ts_b57861s0103f045AdcTable;
+
 /**
  * @brief   returns temperature based on measured ADC voltage
  * @param   adcVoltage_mV   voltage in mV
@@ -0,0 +1,162 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    epcos_b57861s0103f045_adc-table.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup TEMPERATURE_SENSORS
+ * @prefix  TS
+ *
+ * @brief   ADC voltage indexed temperature table of the epcos b57861s0103f045
+ *
+ * @details This file is generated from the LUT in epcos_b57861s0103f045.c and
+ *          the resistor divider in epcos_b57861s0103f045.h by
+ *          tools/ts/ntc_table_generator.py, do not edit it.
+ *          Operating range: 49 mV to 2969 mV, spacing: 4 mV.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "epcos_b57861s0103f045.h"
+
+#include "temperature_sensor_defs.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/* clang-format off */
+/** temperatures in 1/16 deci &deg;C, spacing 4 mV */
+static const int16_t ts_b57861s0103f045AdcTableTemperatures[731u] = {
+     24770,  24218,  23709,  23226,  22803,  22384,  22018,  21652,  21327,  21010,
+     20705,  20427,  20148,  19887,  19647,  19406,  19170,  18964,  18758,  18551,
+     18352,  18175,  17997,  17819,  17640,  17482,  17329,  17176,  17022,  16868,
+     16727,  16596,  16464,  16332,  16200,  16067,  15944,  15832,  15719,  15606,
+     15492,  15379,  15265,  15158,  15062,  14965,  14868,  14771,  14674,  14576,
+     14478,  14383,  14300,  14217,  14134,  14051,  13968,  13884,  13800,  13715,
+     13631,  13555,  13485,  13414,  13343,  13272,  13201,  13129,  13057,  12985,
+     12913,  12840,  12773,  12712,  12651,  12590,  12529,  12467,  12406,  12344,
+     12282,  12219,  12157,  12094,  12031,  11974,  11922,  11870,  11817,  11765,
+     11712,  11659,  11606,  11553,  11500,  11446,  11392,  11339,  11285,  11230,
+     11180,  11136,  11091,  11046,  11001,  10956,  10910,  10865,  10819,  10774,
+     10728,  10682,  10635,  10589,  10542,  10496,  10449,  10402,  10363,  10325,
+     10286,  10247,  10208,  10169,  10129,  10090,  10051,  10011,   9971,   9931,
+      9891,   9851,   9811,   9770,   9730,   9689,   9648,   9607,   9572,   9539,
+      9505,   9471,   9437,   9403,   9369,   9335,   9301,   9266,   9232,   9197,
+      9162,   9127,   9092,   9057,   9022,   8986,   8951,   8915,   8879,   8843,
+      8807,   8777,   8748,   8718,   8689,   8659,   8629,   8600,   8570,   8540,
+      8510,   8479,   8449,   8419,   8388,   8357,   8327,   8296,   8265,   8234,
+      8202,   8171,   8140,   8108,   8076,   8045,   8013,   7985,   7959,   7933,
+      7907,   7881,   7854,   7828,   7801,   7775,   7748,   7722,   7695,   7668,
+      7641,   7614,   7586,   7559,   7532,   7504,   7476,   7449,   7421,   7393,
+      7365,   7337,   7308,   7280,   7251,   7223,   7195,   7172,   7149,   7126,
+      7103,   7079,   7056,   7032,   7008,   6985,   6961,   6937,   6913,   6889,
+      6864,   6840,   6815,   6791,   6766,   6742,   6717,   6692,   6667,   6642,
+      6616,   6591,   6566,   6540,   6515,   6489,   6463,   6437,   6411,   6388,
+      6367,   6346,   6325,   6304,   6282,   6261,   6240,   6218,   6197,   6175,
+      6153,   6131,   6109,   6087,   6065,   6043,   6020,   5998,   5975,   5953,
+      5930,   5907,   5884,   5861,   5838,   5815,   5792,   5768,   5745,   5721,
+      5697,   5674,   5650,   5626,   5601,   5582,   5563,   5543,   5524,   5505,
+      5485,   5465,   5446,   5426,   5406,   5386,   5366,   5346,   5325,   5305,
+      5284,   5264,   5243,   5222,   5202,   5181,   5160,   5138,   5117,   5096,
+      5074,   5053,   5031,   5009,   4988,   4966,   4944,   4921,   4899,   4877,
+      4854,   4832,   4809,   4789,   4771,   4753,   4735,   4717,   4698,   4680,
+      4661,   4643,   4624,   4605,   4586,   4567,   4548,   4529,   4510,   4490,
+      4471,   4451,   4432,   4412,   4392,   4372,   4352,   4332,   4312,   4291,
+      4271,   4250,   4229,   4209,   4188,   4167,   4146,   4124,   4103,   4082,
+      4060,   4038,   4016,   3996,   3979,   3961,   3944,   3926,   3909,   3891,
+      3873,   3855,   3837,   3819,   3801,   3783,   3765,   3746,   3728,   3709,
+      3690,   3671,   3652,   3633,   3614,   3595,   3575,   3556,   3536,   3516,
+      3496,   3476,   3456,   3436,   3416,   3395,   3375,   3354,   3333,   3312,
+      3291,   3270,   3249,   3227,   3206,   3188,   3171,   3154,   3137,   3120,
+      3102,   3085,   3067,   3050,   3032,   3014,   2996,   2978,   2960,   2942,
+      2923,   2905,   2886,   2867,   2849,   2830,   2810,   2791,   2772,   2752,
+      2733,   2713,   2693,   2673,   2653,   2633,   2612,   2592,   2571,   2550,
+      2529,   2508,   2487,   2466,   2444,   2423,   2401,   2384,   2367,   2350,
+      2332,   2315,   2298,   2280,   2262,   2244,   2226,   2208,   2190,   2172,
+      2153,   2135,   2116,   2097,   2078,   2059,   2039,   2020,   2000,   1981,
+      1961,   1941,   1920,   1900,   1880,   1859,   1838,   1817,   1796,   1775,
+      1753,   1731,   1710,   1688,   1666,   1643,   1621,   1599,   1581,   1563,
+      1546,   1528,   1510,   1492,   1473,   1455,   1436,   1417,   1399,   1379,
+      1360,   1341,   1321,   1301,   1282,   1261,   1241,   1221,   1200,   1179,
+      1158,   1137,   1116,   1094,   1073,   1051,   1029,   1006,    984,    961,
+       938,    915,    891,    868,    844,    820,    797,    778,    760,    741,
+       722,    702,    683,    663,    644,    624,    603,    583,    562,    542,
+       520,    499,    478,    456,    434,    412,    390,    367,    344,    321,
+       298,    274,    250,    226,    202,    177,    153,    127,    102,     76,
+        50,     24,     -2,    -22,    -43,    -63,    -84,   -105,   -127,   -148,
+      -170,   -193,   -215,   -238,   -261,   -284,   -308,   -331,   -356,   -380,
+      -405,   -430,   -455,   -481,   -507,   -534,   -560,   -587,   -615,   -643,
+      -671,   -700,   -729,   -758,   -788,   -813,   -836,   -859,   -883,   -907,
+      -931,   -955,   -980,  -1005,  -1031,  -1057,  -1083,  -1110,  -1137,  -1165,
+     -1193,  -1221,  -1250,  -1280,  -1310,  -1340,  -1371,  -1402,  -1434,  -1466,
+     -1499,  -1533,  -1567,  -1601,  -1627,  -1654,  -1681,  -1709,  -1737,  -1765,
+     -1794,  -1824,  -1854,  -1885,  -1916,  -1948,  -1981,  -2014,  -2048,  -2083,
+     -2118,  -2154,  -2191,  -2228,  -2267,  -2306,  -2346,  -2387,  -2421,  -2452,
+     -2484,  -2517,  -2550,  -2584,  -2619,  -2655,  -2692,  -2730,  -2768,  -2808,
+     -2848,  -2890,  -2933,  -2977,  -3022,  -3068,  -3116,  -3165,  -3211,  -3249,
+     -3287,  -3327,  -3368,  -3410,  -3454,  -3499,  -3545,  -3593,  -3643,  -3694,
+     -3747,  -3802,  -3859,  -3918,  -3979,  -4031,  -4078,  -4127,  -4178,  -4231,
+     -4286,  -4344,  -4404,  -4467,  -4533,  -4602,  -4674,  -4749,  -4820,  -4880,
+     -4942,  -5008,  -5078,  -5152,  -5230,  -5312,  -5400,  -5494,  -5594,  -5670,
+     -5751,  -5837,  -5929,  -6030,  -6138,  -6257,  -6386,  -6488,  -6597,  -6717,
+     -6850,  -6999,  -7167,  -7308,  -7457,  -7630,  -7831,  -8048,  -8243,  -8484,
+     -8786,
+};
+/* clang-format on */
+
+/*========== Extern Constant and Variable Definitions =======================*/
+const TS_ADC_TABLE_s ts_b57861s0103f045AdcTable = {
+    .minimumVoltage_mV = 49u,
+    .maximumVoltage_mV = 2969u,
+    .stepShift         = 2u,
+    .nrOfEntries       = 731u,
+    .pTemperatures     = ts_b57861s0103f045AdcTableTemperatures,
+};
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
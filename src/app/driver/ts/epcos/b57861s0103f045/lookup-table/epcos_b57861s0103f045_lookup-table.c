@@ -52,6 +52,7 @@
  */
 
 /*========== Includes =======================================================*/
+#include "adc_table.h"
 #include "epcos_b57861s0103f045.h"
 #include "tsi.h"
 
@@ -67,7 +68,7 @@
 
 /*========== Extern Function Implementations ================================*/
 extern int16_t TSI_GetTemperature(uint16_t adcVoltage_mV) {
-    return TS_Epc01GetTemperatureFromLut(adcVoltage_mV);
+    return TS_GetTemperatureFromAdcTable(&ts_b57861s0103f045AdcTable, adcVoltage_mV);
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
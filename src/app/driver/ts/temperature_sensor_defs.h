@@ -64,6 +64,23 @@ typedef struct TS_TEMPERATURE_SENSOR_LUT {
     float resistance_Ohm;      /*!< resistance in ohms */
 } TS_TEMPERATURE_SENSOR_LUT_s;
 
+/** scaling of the temperatures in #TS_ADC_TABLE_s, i.e., 1/16 deci &deg;C */
+#define TS_ADC_TABLE_TEMPERATURE_SCALE (16)
+
+/**
+ * @brief   temperature lookup table that is indexed by the ADC voltage
+ * @details The tables are generated from the resistance LUT and the resistor
+ *          divider of a sensor by tools/ts/ntc_table_generator.py. Entry i is
+ *          the temperature at minimumVoltage_mV + (i << stepShift) mV.
+ */
+typedef struct TS_ADC_TABLE {
+    uint16_t minimumVoltage_mV;   /*!< smallest ADC voltage in the operating range */
+    uint16_t maximumVoltage_mV;   /*!< largest ADC voltage in the operating range */
+    uint8_t stepShift;            /*!< distance of the entries is 2^stepShift mV */
+    uint16_t nrOfEntries;         /*!< number of entries of pTemperatures */
+    const int16_t *pTemperatures; /*!< scaled by #TS_ADC_TABLE_TEMPERATURE_SCALE */
+} TS_ADC_TABLE_s;
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -52,6 +52,7 @@
  */
 
 /*========== Includes =======================================================*/
+#include "adc_table.h"
 #include "tsi.h"
 #include "vishay_ntcalug01a103g.h"
 
@@ -68,7 +69,7 @@
 /*========== Extern Function Implementations ================================*/
 
 extern int16_t TSI_GetTemperature(uint16_t adcVoltage_mV) {
-    return TS_Vis00GetTemperatureFromLut(adcVoltage_mV);
+    return TS_GetTemperatureFromAdcTable(&ts_ntcalug01a103gAdcTable, adcVoltage_mV);
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -273,7 +273,7 @@ extern int16_t TS_Vis00GetTemperatureFromLut(uint16_t adcVoltage_mV) {
         /* Variables for interpolating LUT value */
         uint16_t between_high = 0;
         uint16_t between_low  = 0;
-        for (uint16_t i = 1u; i < ts_ntcalug01a103gLutSize; i++) {
+        for (uint16_t i = 0u; i < ts_ntcalug01a103gLutSize; i++) {
             if (resistance_Ohm < ts_ntcalug01a103gLut[i].resistance_Ohm) {
                 between_low  = i + 1u;
                 between_high = i;
@@ -282,7 +282,7 @@ extern int16_t TS_Vis00GetTemperatureFromLut(uint16_t adcVoltage_mV) {
 
         /* Interpolate between LUT values, but do not extrapolate LUT! */
         if (!(((between_high == 0u) && (between_low == 0u)) || /* measured resistance > maximum LUT resistance */
-              (between_low > ts_ntcalug01a103gLutSize))) {     /* measured resistance < minimum LUT resistance */
+              (between_low >= ts_ntcalug01a103gLutSize))) {    /* measured resistance < minimum LUT resistance */
             temperature_ddegC = (int16_t)MATH_linearInterpolation(
                 ts_ntcalug01a103gLut[between_low].resistance_Ohm,
                 ts_ntcalug01a103gLut[between_low].temperature_ddegC,
@@ -76,6 +76,8 @@
 /*========== Includes =======================================================*/
 #include "general.h"
 
+#include "temperature_sensor_defs.h"
+
 /*========== Macros and Definitions =========================================*/
 /**
  * Position of the NTC in the voltage resistor
@@ -97,6 +99,9 @@
 #define TS_VISHAY_NTCALUG01A103G_RESISTOR_DIVIDER_RESISTANCE_R_1_R_2_Ohm (10000.0f)
 
 /*========== Extern Constant and Variable Declarations ======================*/
+/** temperature table indexed by the ADC voltage, generated by tools/ts/ntc_table_generator.py */
+extern const TS_ADC_TABLE_s ts_ntcalug01a103gAdcTable;
+
 /**
  * @brief   returns temperature based on measured ADC voltage.
  * @param   adcVoltage_mV   voltage in mV
@@ -0,0 +1,106 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    vishay_ntcalug01a103g_adc-table.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup TEMPERATURE_SENSORS
+ * @prefix  TS
+ *
+ * @brief   ADC voltage indexed temperature table of the vishay ntcalug01a103g
+ *
+ * @details This file is generated from the LUT in vishay_ntcalug01a103g.c and
+ *          the resistor divider in vishay_ntcalug01a103g.h by
+ *          tools/ts/ntc_table_generator.py, do not edit it.
+ *          Operating range: 166 mV to 2912 mV, spacing: 16 mV.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "vishay_ntcalug01a103g.h"
+
+#include "temperature_sensor_defs.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/* clang-format off */
+/** temperatures in 1/16 deci &deg;C, spacing 16 mV */
+static const int16_t ts_ntcalug01a103gAdcTableTemperatures[173u] = {
+     16773,  16234,  15746,  15299,  14887,  14506,  14151,  13818,  13505,  13210,
+     12931,  12665,  12413,  12172,  11942,  11720,  11508,  11304,  11107,  10916,
+     10732,  10554,  10382,  10215,  10052,   9894,   9740,   9590,   9443,   9301,
+      9162,   9026,   8892,   8761,   8633,   8508,   8385,   8264,   8145,   8029,
+      7914,   7801,   7690,   7581,   7474,   7367,   7263,   7160,   7058,   6958,
+      6858,   6760,   6663,   6567,   6473,   6379,   6286,   6194,   6103,   6013,
+      5923,   5836,   5747,   5661,   5574,   5489,   5403,   5319,   5235,   5152,
+      5069,   4987,   4905,   4823,   4743,   4662,   4582,   4502,   4423,   4343,
+      4265,   4186,   4108,   4030,   3952,   3874,   3797,   3720,   3643,   3566,
+      3489,   3413,   3336,   3259,   3182,   3107,   3029,   2954,   2876,   2801,
+      2723,   2647,   2570,   2493,   2416,   2339,   2261,   2184,   2106,   2028,
+      1950,   1871,   1792,   1713,   1633,   1554,   1473,   1392,   1311,   1229,
+      1147,   1064,    980,    897,    811,    727,    640,    554,    465,    378,
+       288,    197,    106,     13,    -80,   -175,   -271,   -368,   -468,   -567,
+      -669,   -773,   -878,   -985,  -1095,  -1205,  -1319,  -1436,  -1554,  -1675,
+     -1800,  -1928,  -2059,  -2193,  -2332,  -2475,  -2624,  -2777,  -2937,  -3102,
+     -3275,  -3456,  -3647,  -3848,  -4059,  -4285,  -4525,  -4786,  -5067,  -5375,
+     -5718,  -6105,  -6562,
+};
+/* clang-format on */
+
+/*========== Extern Constant and Variable Definitions =======================*/
+const TS_ADC_TABLE_s ts_ntcalug01a103gAdcTable = {
+    .minimumVoltage_mV = 166u,
+    .maximumVoltage_mV = 2912u,
+    .stepShift         = 4u,
+    .nrOfEntries       = 173u,
+    .pTemperatures     = ts_ntcalug01a103gAdcTableTemperatures,
+};
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -66,6 +66,8 @@
 /**@{*/
 static DATA_BLOCK_CELL_VOLTAGE_s data_blockCellVoltage     = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
 static DATA_BLOCK_CELL_VOLTAGE_s data_blockCellVoltageBase = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+static DATA_BLOCK_CELL_VOLTAGE_s data_blockCellVoltageBaseBackBuffer = {
+    .header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
 static DATA_BLOCK_CELL_VOLTAGE_s data_blockCellVoltageRedundancy0 = {
     .header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0};
 /**@}*/
@@ -161,6 +163,9 @@ static DATA_BLOCK_INSULATION_MONITORING_s data_blockInsulationMonitoring = {
 /** data block: adc temperature */
 static DATA_BLOCK_PACK_VALUES_s data_blockPackValues = {.header.uniqueId = DATA_BLOCK_ID_PACK_VALUES};
 
+/** data block: can reception statistics */
+static DATA_BLOCK_CAN_RX_STATISTICS_s data_blockCanRxStatistics = {.header.uniqueId = DATA_BLOCK_ID_CAN_RX_STATISTICS};
+
 /**
  * @brief   channel configuration of database (data blocks)
  * @details all data block managed by database are listed here (address, size,
@@ -198,6 +203,17 @@ DATA_BASE_s data_database[] = {
     {(void *)(&data_blockAdcTemperature), sizeof(DATA_BLOCK_ADC_TEMPERATURE_s)},
     {(void *)(&data_blockInsulationMonitoring), sizeof(DATA_BLOCK_INSULATION_MONITORING_s)},
     {(void *)(&data_blockPackValues), sizeof(DATA_BLOCK_PACK_VALUES_s)},
+    {(void *)(&data_blockCanRxStatistics), sizeof(DATA_BLOCK_CAN_RX_STATISTICS_s)},
+};
+
+/**
+ * @brief   back buffers of the double-buffered database entries
+ * @details The measurement IC drivers decode the cell voltages directly into
+ *          the back buffer of the cell voltage base entry and publish it
+ *          without an additional copy.
+ */
+DATA_BACK_BUFFER_s data_backBuffers[] = {
+    {DATA_BLOCK_ID_CELL_VOLTAGE_BASE, (void *)(&data_blockCellVoltageBaseBackBuffer)},
 };
 
 /*========== Static Function Prototypes =====================================*/
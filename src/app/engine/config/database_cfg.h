@@ -68,6 +68,38 @@ typedef struct DATA_BASE {
     uint16_t datalength;  /*!< length of the entry */
 } DATA_BASE_s;
 
+/**
+ * @brief   selects the access mode of the database
+ * @details If set to false, read and write accesses are passed through a
+ *          queue to #DATA_Task() which then copies the data.
+ *          If set to true, every database entry is guarded by a sequence
+ *          counter: writers copy their data directly into the database in a
+ *          critical section and readers copy optimistically and retry if the
+ *          entry has been written while it was read. #DATA_Task() is then not
+ *          involved in the access anymore.
+ *          The stress test of the database on the host always uses the
+ *          sequence lock.
+ */
+#if defined(FOXBMS_DATABASE_STRESS_TEST)
+#define DATA_USE_SEQUENCE_LOCK (true)
+#else
+#define DATA_USE_SEQUENCE_LOCK (false)
+#endif
+
+/**
+ * @brief   maximum number of attempts of a sequence locked read access
+ * @details If the entry has been written during each of the attempts, the
+ *          read access copies the entry in a critical section.
+ */
+#define DATA_SEQUENCE_LOCK_MAX_READ_ATTEMPTS (5u)
+
+/**
+ * @brief   maximum number of tasks that can subscribe to one database entry
+ * @details A subscribed task is notified each time the entry is written, see
+ *          #DATA_SubscribeToDataBlock().
+ */
+#define DATA_MAX_SUBSCRIBERS_PER_BLOCK (2u)
+
 /** data block identification numbers */
 typedef enum DATA_BLOCK_ID {
     DATA_BLOCK_ID_CELL_VOLTAGE,
@@ -101,6 +133,7 @@ typedef enum DATA_BLOCK_ID {
     DATA_BLOCK_ID_ADC_TEMPERATURE,
     DATA_BLOCK_ID_INSULATION_MONITORING,
     DATA_BLOCK_ID_PACK_VALUES,
+    DATA_BLOCK_ID_CAN_RX_STATISTICS,
     DATA_BLOCK_ID_MAX, /**< DO NOT CHANGE, MUST BE THE LAST ENTRY */
 } DATA_BLOCK_ID_e;
 
@@ -510,24 +543,29 @@ typedef struct DATA_BLOCK_STATEREQUEST {
     uint8_t state;                      /*!< state */
 } DATA_BLOCK_STATEREQUEST_s;
 
+/** windows of the moving average algorithm, durations are configured in moving_average.h */
+typedef enum {
+    DATA_MOVING_AVERAGE_WINDOW_1s,           /*!< moving average over the last 1s */
+    DATA_MOVING_AVERAGE_WINDOW_5s,           /*!< moving average over the last 5s */
+    DATA_MOVING_AVERAGE_WINDOW_10s,          /*!< moving average over the last 10s */
+    DATA_MOVING_AVERAGE_WINDOW_30s,          /*!< moving average over the last 30s */
+    DATA_MOVING_AVERAGE_WINDOW_60s,          /*!< moving average over the last 60s */
+    DATA_MOVING_AVERAGE_WINDOW_CONFIGURABLE, /*!< moving average over the last configured time */
+    DATA_MOVING_AVERAGE_NR_OF_WINDOWS,       /*!< number of windows */
+} DATA_MOVING_AVERAGE_WINDOW_e;
+
 /** data block struct of the moving average algorithm */
 typedef struct {
     /* This struct needs to be at the beginning of every database entry. During
      * the initialization of a database struct, uniqueId must be set to the
      * respective database entry representation in enum DATA_BLOCK_ID_e. */
-    DATA_BLOCK_HEADER_s header;                        /*!< Data block header */
-    float movingAverageCurrent1sInterval_mA;           /*!< current moving average over the last 1s */
-    float movingAverageCurrent5sInterval_mA;           /*!< current moving average over the last 5s */
-    float movingAverageCurrent10sInterval_mA;          /*!< current moving average over the last 10s */
-    float movingAverageCurrent30sInterval_mA;          /*!< current moving average over the last 30s */
-    float movingAverageCurrent60sInterval_mA;          /*!< current moving average over the last 60s */
-    float movingAverageCurrentConfigurableInterval_mA; /*!< current moving average over the last configured time */
-    float movingAveragePower1sInterval_mA;             /*!< power moving average over the last 1s */
-    float movingAveragePower5sInterval_mA;             /*!< power moving average over the last 5s */
-    float movingAveragePower10sInterval_mA;            /*!< power moving average over the last 10s */
-    float movingAveragePower30sInterval_mA;            /*!< power moving average over the last 30s */
-    float movingAveragePower60sInterval_mA;            /*!< power moving average over the last 60s */
-    float movingAveragePowerConfigurableInterval_mA;   /*!< power moving average over the last configured time */
+    DATA_BLOCK_HEADER_s header;                                                  /*!< Data block header */
+    float packCurrent_mA[DATA_MOVING_AVERAGE_NR_OF_WINDOWS];                     /*!< pack current, unit: mA */
+    float packPower_W[DATA_MOVING_AVERAGE_NR_OF_WINDOWS];                        /*!< pack power, unit: W */
+    float stringCurrent_mA[BS_NR_OF_STRINGS][DATA_MOVING_AVERAGE_NR_OF_WINDOWS]; /*!< string currents, unit: mA */
+    float stringPower_W[BS_NR_OF_STRINGS][DATA_MOVING_AVERAGE_NR_OF_WINDOWS];    /*!< string powers, unit: W */
+    int32_t minimumStringCurrent_mA[BS_NR_OF_STRINGS];                           /*!< minimum in configured time */
+    int32_t maximumStringCurrent_mA[BS_NR_OF_STRINGS];                           /*!< maximum in configured time */
 } DATA_BLOCK_MOVING_AVERAGE_s;
 
 /** data block struct of insulation monitoring device measurement */
@@ -552,9 +590,38 @@ typedef struct DATA_BLOCK_INSULATION_MONITORING {
     uint8_t testImcParameterConfiguration;     /*!< 0 = NotWarning, 1 = Warning */
 } DATA_BLOCK_INSULATION_MONITORING_s;
 
+/** data block struct of the CAN reception statistics */
+typedef struct DATA_BLOCK_CAN_RX_STATISTICS {
+    /* This struct needs to be at the beginning of every database entry. During
+     * the initialization of a database struct, uniqueId must be set to the
+     * respective database entry representation in enum DATA_BLOCK_ID_e. */
+    DATA_BLOCK_HEADER_s header;        /*!< Data block header */
+    uint32_t receivedMessages;         /*!< messages stored in the receive buffer */
+    uint32_t overflowCounter;          /*!< messages lost because the receive buffer was full */
+    uint32_t droppedLowPriorityFrames; /*!< low priority messages dropped to keep the reserved slots free */
+    uint8_t highWaterMark;             /*!< maximum number of messages pending in the receive buffer */
+} DATA_BLOCK_CAN_RX_STATISTICS_s;
+
+/**
+ * @brief   configuration struct of a double-buffered database entry
+ * @details The back buffer has the type of the database entry. A writer
+ *          fills the back buffer in place and publishes it by swapping it
+ *          with the current entry, see #DATA_CommitBackBuffer().
+ */
+typedef struct DATA_BACK_BUFFER {
+    DATA_BLOCK_ID_e blockId; /*!< database entry that is double-buffered */
+    void *pBackBuffer;       /*!< second buffer of the database entry */
+} DATA_BACK_BUFFER_s;
+
+/** number of double-buffered database entries */
+#define DATA_NR_OF_BACK_BUFFERS (1u)
+
 /** array for the database */
 extern DATA_BASE_s data_database[DATA_BLOCK_ID_MAX];
 
+/** array of the back buffers of the double-buffered database entries */
+extern DATA_BACK_BUFFER_s data_backBuffers[DATA_NR_OF_BACK_BUFFERS];
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -112,6 +112,7 @@ DIAG_ID_CFG_s DIAG_ID_cfg[] = {
     {DIAG_ID_FLASHCHECKSUM, "FLASHCHECKSUM", DIAG_ERROR_SENSITIVITY_FIRST_EVENT, DIAG_RECORDING_ENABLED, DIAG_EVALUATION_ENABLED, DIAG_DummyCallback},
     {DIAG_ID_SYSTEMMONITORING, "SYSTEMMONITORING", DIAG_ERROR_SENSITIVITY_FIRST_EVENT, DIAG_RECORDING_ENABLED, DIAG_EVALUATION_ENABLED, DIAG_ErrorSystemMonitoring},
     {DIAG_ID_CONFIGASSERT, "CONFIGASSERT", DIAG_ERROR_SENSITIVITY_FIRST_EVENT, DIAG_RECORDING_ENABLED, DIAG_EVALUATION_ENABLED, DIAG_DummyCallback},
+    {DIAG_ID_ALGORITHM_DEADLINE, "ALGORITHM_DEADLINE", DIAG_ERROR_SENSITIVITY_FIRST_EVENT, DIAG_RECORDING_ENABLED, DIAG_EVALUATION_ENABLED, DIAG_DummyCallback},
     /* TODO: reactivate interlock feedback when HW ready */
     {DIAG_ID_INTERLOCK_FEEDBACK, "INTERLOCK_FEEDBACK", DIAG_ERROR_INTERLOCK_SENSITIVITY, DIAG_RECORDING_DISABLED, DIAG_EVALUATION_DISABLED, DIAG_ErrorInterlock},
 
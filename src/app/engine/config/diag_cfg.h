@@ -122,9 +122,10 @@ extern const DIAG_DATABASE_SHIM_s diag_kDatabaseShim;
 
 /** list of diag IDs */
 typedef enum DIAG_ID {
-    DIAG_ID_FLASHCHECKSUM,    /**< TODO */
-    DIAG_ID_SYSTEMMONITORING, /**< TODO */
-    DIAG_ID_CONFIGASSERT,     /**< TODO*/
+    DIAG_ID_FLASHCHECKSUM,      /**< TODO */
+    DIAG_ID_SYSTEMMONITORING,   /**< TODO */
+    DIAG_ID_CONFIGASSERT,       /**< TODO*/
+    DIAG_ID_ALGORITHM_DEADLINE, /**< an algorithm has exceeded its deadline */
     DIAG_ID_LTC_SPI,
     DIAG_ID_LTC_PEC,
     DIAG_ID_LTC_MUX,
@@ -101,6 +101,8 @@ SYSM_MONITORING_CFG_s sysm_ch_cfg[] = {
      SYSM_DummyCallback},
 };
 
+const uint32_t sysm_profileBucketLimits_us[SYSM_PROFILE_NR_OF_BUCKETS - 1u] = {50u, 100u, 250u, 500u, 1000u, 2500u};
+
 /*========== Static Function Implementations ================================*/
 /**
  * @brief   dummy callback function of system monitoring error events
@@ -59,6 +59,24 @@
 #include "diag_cfg.h"
 
 /*========== Macros and Definitions =========================================*/
+/**
+ * @brief   enables the profiling of the tasks and sections
+ * @details If enabled, the execution time between enter and exit of every
+ *          task and section is measured with the cycle counter and
+ *          accumulated in a profile, and the profiles are transmitted on CAN.
+ *          Disabled by default, as every task cycle and section then reads
+ *          the cycle counter and updates its profile in a critical section.
+ *          The unit tests always enable the profiling, so that it is tested.
+ */
+#if defined(UNITY_UNIT_TEST)
+#define SYSM_PROFILING_ENABLED (true)
+#else
+#define SYSM_PROFILING_ENABLED (false)
+#endif
+
+/** number of buckets of the execution time histogram of a profile */
+#define SYSM_PROFILE_NR_OF_BUCKETS (7u)
+
 /** diagnosis handling type for system monitoring */
 typedef enum SYSM_HANDLING_TYPE {
     SYSM_HANDLING_DONOTHING,         /**< */
@@ -78,6 +96,27 @@ typedef enum SYSM_TASK_ID {
     SYSM_TASK_ID_MAX                     /**< end marker do not delete               */
 } SYSM_TASK_ID_e;
 
+/**
+ * listing of the profiled sections inside of the tasks, the profile of a
+ * section follows the profiles of the tasks
+ */
+typedef enum SYSM_SECTION_ID {
+    SYSM_SECTION_ID_SYS_TRIGGER,       /**< SYS_Trigger in the 10ms task                */
+    SYSM_SECTION_ID_BMS_TRIGGER,       /**< BMS_Trigger in the 10ms task                */
+    SYSM_SECTION_ID_ILCK_TRIGGER,      /**< ILCK_Trigger in the 10ms task               */
+    SYSM_SECTION_ID_ADC_CONTROL,       /**< ADC_Control in the 10ms task                */
+    SYSM_SECTION_ID_SPS_CTRL,          /**< SPS_Ctrl in the 10ms task                   */
+    SYSM_SECTION_ID_CAN_MAIN_FUNCTION, /**< CAN_MainFunction in the 10ms task           */
+    SYSM_SECTION_ID_SOF_CALCULATION,   /**< SOF_Calculation in the 10ms task            */
+    SYSM_SECTION_ID_ALGO_MONITOR,      /**< ALGO_MonitorExecutionTime in the 10ms task  */
+    SYSM_SECTION_ID_SBC_TRIGGER,       /**< SBC_Trigger in the 10ms task                */
+    SYSM_SECTION_ID_MRC_VALIDATION,    /**< redundancy validation in the 10ms task      */
+    SYSM_SECTION_ID_MAX                /**< end marker do not delete                    */
+} SYSM_SECTION_ID_e;
+
+/** number of profiles, first one per task, then one per section */
+#define SYSM_NR_OF_PROFILES ((uint8_t)SYSM_TASK_ID_MAX + (uint8_t)SYSM_SECTION_ID_MAX)
+
 /** recording activation */
 typedef enum SYSM_RECORDING {
     SYSM_RECORDING_ENABLED,  /*!< enable event recording  */
@@ -105,6 +144,13 @@ typedef struct SYSM_CH_CFG {
 /** diag system monitoring struct */
 extern SYSM_MONITORING_CFG_s sysm_ch_cfg[];
 
+/**
+ * upper limits of the histogram buckets in microseconds; a duration is
+ * counted in the first bucket whose limit it does not reach, the last bucket
+ * counts all longer durations
+ */
+extern const uint32_t sysm_profileBucketLimits_us[SYSM_PROFILE_NR_OF_BUCKETS - 1u];
+
 /*========== Extern Function Prototypes =====================================*/
 /**
  * @brief   initialization function for system monitoring
@@ -79,6 +79,21 @@
  */
 #define DATA_MAX_ENTRIES_PER_ACCESS (4u)
 
+/**
+ * @brief   memory barrier for the sequence locked database access
+ * @details Ensures that the copy of a database entry is not reordered with
+ *          the accesses to the sequence counter of this entry.
+ */
+#if defined(FOXBMS_SIL)
+#define DATA_MEMORY_BARRIER() \
+    { __sync_synchronize(); }
+#elif !defined(UNITY_UNIT_TEST)
+#define DATA_MEMORY_BARRIER() \
+    { __asm(" DMB"); }
+#else
+#define DATA_MEMORY_BARRIER()
+#endif
+
 /**
  * configuration struct of database device
  */
@@ -93,8 +108,19 @@ typedef struct DATA_BASE_HEADER {
 typedef struct DATA_QUEUE_MESSAGE {
     DATA_BLOCK_ACCESS_TYPE_e accesstype;               /*!< read or write access type */
     void *pDatabaseEntry[DATA_MAX_ENTRIES_PER_ACCESS]; /*!< reference by general pointer */
+    DATA_BLOCK_ID_e blockId;                           /*!< database entry of a range access */
+    uint16_t offset;                                   /*!< offset in bytes of a range access */
+    uint16_t length;                                   /*!< length in bytes of a range access */
 } DATA_QUEUE_MESSAGE_s;
 
+/**
+ * subscription of a task to a database entry
+ */
+typedef struct DATA_SUBSCRIPTION {
+    TaskHandle_t taskToNotify; /*!< task that is notified, NULL_PTR if slot is unused */
+    uint32_t notificationBits; /*!< bits that are set in the notification value of the task */
+} DATA_SUBSCRIPTION_s;
+
 /*========== Static Constant and Variable Definitions =======================*/
 /** handle of the data queue */
 static QueueHandle_t data_queue;
@@ -128,11 +154,231 @@ static const DATA_BASE_HEADER_s data_baseHeader = {
  */
 static uint16_t uniqueIdToDatabaseEntry[DATA_BLOCK_ID_MAX];
 
+/**
+ * @brief   sequence counter of each database entry
+ * @details Only used if #DATA_USE_SEQUENCE_LOCK is true. The counter is
+ *          incremented before and after each write access, i.e., it is odd
+ *          while the entry is written.
+ */
+static volatile uint32_t data_sequenceCounter[DATA_BLOCK_ID_MAX];
+
+/**
+ * @brief   largest number of attempts a sequence locked read access needed
+ * @details Indicator for the worst-case read latency of the database. As this
+ *          value is only used for statistics, it is updated without locking.
+ */
+static uint8_t data_maximumReadAttempts = 0u;
+
+/**
+ * @brief   subscriptions of tasks to database entries
+ * @details Indexed by the position of the database entry in data_database[]
+ */
+static DATA_SUBSCRIPTION_s data_subscriptions[DATA_BLOCK_ID_MAX][DATA_MAX_SUBSCRIBERS_PER_BLOCK];
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Writes a database entry guarded by the sequence counter
+ * @details Updates timestamp and previous timestamp in the passed struct and
+ *          copies it into the database. The copy is done in the same
+ *          critical section as the increments of the sequence counter. On the
+ *          single core of the target a reader therefore never has to wait for
+ *          a preempted writer, and concurrent writers of an entry are
+ *          serialized.
+ * @param[in,out]   pDataFromSender pointer to the data that is written
+ */
+static void DATA_WriteEntryWithSequenceLock(void *pDataFromSender);
+
+/**
+ * @brief   Reads a byte range of a database entry guarded by the sequence
+ *          counter
+ * @details The range is copied without locking. If the sequence counter
+ *          changed during the copy, the read is retried up to
+ *          #DATA_SEQUENCE_LOCK_MAX_READ_ATTEMPTS times. If all attempts
+ *          fail, the range is copied in a critical section, which excludes
+ *          the writers. The read therefore always returns a consistent copy.
+ * @param[in]   entryIndex      index of the entry in the database
+ * @param[out]  pDataToReceiver pointer to the memory the data is copied to
+ * @param[in]   offset          offset of the range in bytes
+ * @param[in]   length          length of the range in bytes
+ */
+static void DATA_ReadRangeWithSequenceLock(
+    uint16_t entryIndex,
+    void *pDataToReceiver,
+    uint16_t offset,
+    uint16_t length);
+
+/**
+ * @brief   Reads a complete database entry guarded by the sequence counter
+ * @param[out]  pDataToReceiver pointer to the struct the data is copied to
+ */
+static void DATA_ReadEntryWithSequenceLock(void *pDataToReceiver);
+
+/**
+ * @brief   Copies a byte range of a database entry
+ * @details Used by #DATA_Task() for range accesses passed through the queue.
+ * @param[in]   blockId         database entry that is read
+ * @param[out]  pDataToReceiver pointer to the memory the data is copied to
+ * @param[in]   offset          offset of the range in bytes
+ * @param[in]   length          length of the range in bytes
+ */
+static void DATA_CopyRange(DATA_BLOCK_ID_e blockId, void *pDataToReceiver, uint16_t offset, uint16_t length);
+
+/**
+ * @brief   Notifies all tasks that subscribed to a database entry
+ * @details Called after a write access to the entry has been committed.
+ * @param[in]   entryIndex  index of the entry in the database
+ */
+static void DATA_NotifySubscribers(uint16_t entryIndex);
+
+/**
+ * @brief   Accesses up to #DATA_MAX_ENTRIES_PER_ACCESS database entries
+ *          without passing them through #DATA_Task()
+ * @param[in]       accessType  read or write access
+ * @param[in,out]   pData       array of pointers to the data blocks, unused
+ *                              entries are #NULL_PTR
+ */
+static void DATA_AccessEntriesWithSequenceLock(DATA_BLOCK_ACCESS_TYPE_e accessType, void *pData[]);
+
+/**
+ * @brief   searches the back buffer of a double-buffered database entry
+ * @param   blockId     id of the database entry
+ * @return  index of the back buffer in #data_backBuffers or
+ *          #DATA_NR_OF_BACK_BUFFERS if the entry is not double-buffered
+ */
+static uint8_t DATA_GetBackBufferIndex(DATA_BLOCK_ID_e blockId);
 
 /*========== Static Function Implementations ================================*/
+static void DATA_WriteEntryWithSequenceLock(void *pDataFromSender) {
+    FAS_ASSERT(pDataFromSender != NULL_PTR);
+    DATA_BLOCK_HEADER_s *pHeader = (DATA_BLOCK_HEADER_s *)pDataFromSender;
+    FAS_ASSERT(pHeader->uniqueId < DATA_BLOCK_ID_MAX);
+    const uint16_t entryIndex = uniqueIdToDatabaseEntry[(uint16_t)pHeader->uniqueId];
+    void *pDatabaseStruct     = data_baseHeader.pDatabase[entryIndex].pDatabaseEntry;
+    const uint16_t datalength = data_baseHeader.pDatabase[entryIndex].datalength;
+
+    /* Update timestamps in passed database struct and then copy this struct into database */
+    pHeader->previousTimestamp = pHeader->timestamp;
+    pHeader->timestamp         = OS_GetTickCount();
+
+    /* an odd sequence counter makes readers on other cores retry while the entry is copied */
+    OS_EnterTaskCritical();
+    data_sequenceCounter[entryIndex]++;
+    DATA_MEMORY_BARRIER();
+    /* memcpy has no return value therefore there is nothing to check: casting to void */
+    (void)memcpy(pDatabaseStruct, pDataFromSender, datalength);
+    DATA_MEMORY_BARRIER();
+    data_sequenceCounter[entryIndex]++;
+    OS_ExitTaskCritical();
+
+    DATA_NotifySubscribers(entryIndex);
+}
+
+static void DATA_ReadRangeWithSequenceLock(
+    uint16_t entryIndex,
+    void *pDataToReceiver,
+    uint16_t offset,
+    uint16_t length) {
+    FAS_ASSERT(entryIndex < DATA_BLOCK_ID_MAX);
+    FAS_ASSERT(pDataToReceiver != NULL_PTR);
+    FAS_ASSERT(((uint32_t)offset + length) <= data_baseHeader.pDatabase[entryIndex].datalength);
+    STD_RETURN_TYPE_e retval = STD_NOT_OK;
+    uint8_t attempts         = 0u;
+
+    while ((retval == STD_NOT_OK) && (attempts < DATA_SEQUENCE_LOCK_MAX_READ_ATTEMPTS)) {
+        attempts++;
+        const uint32_t sequenceBeforeCopy = data_sequenceCounter[entryIndex];
+        /* an odd sequence counter means that a write access is in progress */
+        if ((sequenceBeforeCopy & 1u) == 0u) {
+            DATA_MEMORY_BARRIER();
+            /* the location of a double-buffered entry changes with each commit */
+            const uint8_t *pDatabaseRange =
+                &((const uint8_t *)data_baseHeader.pDatabase[entryIndex].pDatabaseEntry)[offset];
+            /* memcpy has no return value therefore there is nothing to check: casting to void */
+            (void)memcpy(pDataToReceiver, pDatabaseRange, length);
+            DATA_MEMORY_BARRIER();
+            if (data_sequenceCounter[entryIndex] == sequenceBeforeCopy) {
+                /* entry has not been written during the copy */
+                retval = STD_OK;
+            }
+        }
+    }
+
+    if (retval != STD_OK) {
+        /* the entry has been written during every attempt: the writers cannot
+           run while the range is copied in the critical section */
+        attempts++;
+        OS_EnterTaskCritical();
+        /* memcpy has no return value therefore there is nothing to check: casting to void */
+        (void)memcpy(
+            pDataToReceiver,
+            &((const uint8_t *)data_baseHeader.pDatabase[entryIndex].pDatabaseEntry)[offset],
+            length);
+        OS_ExitTaskCritical();
+    }
+    if (attempts > data_maximumReadAttempts) {
+        data_maximumReadAttempts = attempts;
+    }
+}
+
+static void DATA_ReadEntryWithSequenceLock(void *pDataToReceiver) {
+    FAS_ASSERT(pDataToReceiver != NULL_PTR);
+    const DATA_BLOCK_HEADER_s *pHeader = (DATA_BLOCK_HEADER_s *)pDataToReceiver;
+    FAS_ASSERT(pHeader->uniqueId < DATA_BLOCK_ID_MAX);
+    const uint16_t entryIndex = uniqueIdToDatabaseEntry[(uint16_t)pHeader->uniqueId];
+    DATA_ReadRangeWithSequenceLock(entryIndex, pDataToReceiver, 0u, data_baseHeader.pDatabase[entryIndex].datalength);
+}
+
+static void DATA_CopyRange(DATA_BLOCK_ID_e blockId, void *pDataToReceiver, uint16_t offset, uint16_t length) {
+    FAS_ASSERT(blockId < DATA_BLOCK_ID_MAX);
+    FAS_ASSERT(pDataToReceiver != NULL_PTR);
+    const uint16_t entryIndex = uniqueIdToDatabaseEntry[(uint16_t)blockId];
+    FAS_ASSERT(((uint32_t)offset + length) <= data_baseHeader.pDatabase[entryIndex].datalength);
+    const uint8_t *pDatabaseRange = &((const uint8_t *)data_baseHeader.pDatabase[entryIndex].pDatabaseEntry)[offset];
+    /* memcpy has no return value therefore there is nothing to check: casting to void */
+    (void)memcpy(pDataToReceiver, pDatabaseRange, length);
+}
+
+static void DATA_NotifySubscribers(uint16_t entryIndex) {
+    FAS_ASSERT(entryIndex < DATA_BLOCK_ID_MAX);
+    for (uint8_t subscriber = 0u; subscriber < DATA_MAX_SUBSCRIBERS_PER_BLOCK; subscriber++) {
+        const DATA_SUBSCRIPTION_s subscription = data_subscriptions[entryIndex][subscriber];
+        if (subscription.taskToNotify != NULL_PTR) {
+            /* eSetBits always succeeds, therefore the return value can be discarded */
+            (void)xTaskNotify(subscription.taskToNotify, subscription.notificationBits, eSetBits);
+        }
+    }
+}
+
+static void DATA_AccessEntriesWithSequenceLock(DATA_BLOCK_ACCESS_TYPE_e accessType, void *pData[]) {
+    FAS_ASSERT(pData != NULL_PTR);
+    /* plausibility check, error if first pointer NULL_PTR */
+    FAS_ASSERT(pData[0] != NULL_PTR);
+
+    for (uint8_t entry = 0u; entry < DATA_MAX_ENTRIES_PER_ACCESS; entry++) {
+        if (pData[entry] != NULL_PTR) {
+            if (accessType == DATA_WRITE_ACCESS) {
+                DATA_WriteEntryWithSequenceLock(pData[entry]);
+            } else if (accessType == DATA_READ_ACCESS) {
+                DATA_ReadEntryWithSequenceLock(pData[entry]);
+            } else {
+                /* invalid database operation */
+                FAS_ASSERT(FAS_TRAP);
+            }
+        }
+    }
+}
+
+static uint8_t DATA_GetBackBufferIndex(DATA_BLOCK_ID_e blockId) {
+    uint8_t backBufferIndex = DATA_NR_OF_BACK_BUFFERS;
+    for (uint8_t i = 0u; i < DATA_NR_OF_BACK_BUFFERS; i++) {
+        if (data_backBuffers[i].blockId == blockId) {
+            backBufferIndex = i;
+        }
+    }
+    return backBufferIndex;
+}
 
 /*========== Extern Function Implementations ================================*/
 STD_RETURN_TYPE_e DATA_Init(void) {
@@ -175,13 +421,38 @@ STD_RETURN_TYPE_e DATA_Init(void) {
         }
     }
 
-    /* Create a queue capable of containing a pointer of type DATA_QUEUE_MESSAGE_s
-    Data of Messages are passed by pointer as they contain a lot of data. */
-    data_queue = xQueueCreateStatic(DATA_QUEUE_LENGTH, DATA_QUEUE_ITEM_SIZE, dataQueueStorageArea, &dataQueueStructure);
+    /* Initialize back buffers with 0 in the same way as the database entries */
+    for (uint8_t i = 0u; i < DATA_NR_OF_BACK_BUFFERS; i++) {
+        DATA_BLOCK_HEADER_s *pHeader = (DATA_BLOCK_HEADER_s *)data_backBuffers[i].pBackBuffer;
+        FAS_ASSERT(pHeader != NULL_PTR);
+        if ((data_backBuffers[i].blockId < DATA_BLOCK_ID_MAX) && (pHeader->uniqueId == data_backBuffers[i].blockId)) {
+            const uint16_t entryIndex = uniqueIdToDatabaseEntry[pHeader->uniqueId];
+            const uint16_t datalength = data_baseHeader.pDatabase[entryIndex].datalength;
+            (void)memset(&((uint8_t *)pHeader)[sizeof(DATA_BLOCK_ID_e)], 0, datalength - sizeof(DATA_BLOCK_ID_e));
+        } else {
+            /* Configuration error -> set retval to #STD_NOT_OK */
+            retval = STD_NOT_OK;
+        }
+    }
 
-    if (data_queue == NULL_PTR) {
-        /* Failed to create the queue */
-        retval = STD_NOT_OK;
+    for (uint16_t databaseEntry = 0u; databaseEntry < DATA_BLOCK_ID_MAX; databaseEntry++) {
+        data_sequenceCounter[databaseEntry] = 0u;
+        for (uint8_t subscriber = 0u; subscriber < DATA_MAX_SUBSCRIBERS_PER_BLOCK; subscriber++) {
+            data_subscriptions[databaseEntry][subscriber].taskToNotify     = NULL_PTR;
+            data_subscriptions[databaseEntry][subscriber].notificationBits = 0u;
+        }
+    }
+
+    if (DATA_USE_SEQUENCE_LOCK == false) {
+        /* Create a queue capable of containing a pointer of type DATA_QUEUE_MESSAGE_s
+        Data of Messages are passed by pointer as they contain a lot of data. */
+        data_queue =
+            xQueueCreateStatic(DATA_QUEUE_LENGTH, DATA_QUEUE_ITEM_SIZE, dataQueueStorageArea, &dataQueueStructure);
+
+        if (data_queue == NULL_PTR) {
+            /* Failed to create the queue */
+            retval = STD_NOT_OK;
+        }
     }
     return retval;
 }
@@ -189,44 +460,57 @@ STD_RETURN_TYPE_e DATA_Init(void) {
 void DATA_Task(void) {
     DATA_QUEUE_MESSAGE_s receiveMessage;
 
-    if (data_queue != NULL_PTR) {
+    if (DATA_USE_SEQUENCE_LOCK == true) {
+        /* Accesses are handled directly by the callers. Block the engine task
+           for the same time as when waiting on the queue. */
+        OS_DelayTask(1u);
+    } else if (data_queue != NULL_PTR) {
         if (xQueueReceive(data_queue, (&receiveMessage), (TickType_t)1) >
             0) { /* scan queue and wait for a message up to a maximum amount of 1ms (block time) */
             /* plausibility check, error if first pointer NULL_PTR */
             FAS_ASSERT(receiveMessage.pDatabaseEntry[0] != NULL_PTR);
-            /* Iterate over pointer array and handle all access operations if pointer != NULL_PTR */
-            for (uint8_t queueEntry = 0u; queueEntry < DATA_MAX_ENTRIES_PER_ACCESS; queueEntry++) {
-                if (receiveMessage.pDatabaseEntry[queueEntry] != NULL_PTR) {
-                    /* pointer to passed database struct */
-                    void *pPassedDataStruct = receiveMessage.pDatabaseEntry[queueEntry];
-                    /* Get access type (read or write) of passed data struct */
-                    DATA_BLOCK_ACCESS_TYPE_e accesstype = receiveMessage.accesstype;
-
-                    /* Get pointer to database header entry */
-                    DATA_BLOCK_HEADER_s *pHeader1 = (DATA_BLOCK_HEADER_s *)receiveMessage.pDatabaseEntry[queueEntry];
-                    uint16_t entryIndex           = uniqueIdToDatabaseEntry[(uint16_t)pHeader1->uniqueId];
-                    /* Pointer to database struct representation of passed struct */
-                    void *pDatabaseStruct = (void *)data_baseHeader.pDatabase[entryIndex].pDatabaseEntry;
-                    /* Get datalength of database entry */
-                    uint16_t datalength = data_baseHeader.pDatabase[entryIndex].datalength;
-
-                    /* Copy data either into database or passed database struct */
-                    if (accesstype == DATA_WRITE_ACCESS) {
-                        /* Pointer on datablock header of passed struct */
-                        DATA_BLOCK_HEADER_s *pHeader = (DATA_BLOCK_HEADER_s *)pPassedDataStruct;
-                        /* Update timestamps in passed database struct and then copy this struct into database */
-                        pHeader->previousTimestamp = pHeader->timestamp;
-                        pHeader->timestamp         = OS_GetTickCount();
-                        /* Copy passed struct in database struct */
-                        /* memcpy has no return value therefore there is nothing to check: casting to void */
-                        (void)memcpy(pDatabaseStruct, pPassedDataStruct, datalength);
-                    } else if (accesstype == DATA_READ_ACCESS) {
-                        /* Copy database entry in passed struct */
-                        /* memcpy has no return value therefore there is nothing to check: casting to void */
-                        (void)memcpy(pPassedDataStruct, pDatabaseStruct, datalength);
-                    } else {
-                        /* invalid database operation */
-                        FAS_ASSERT(FAS_TRAP);
+            if (receiveMessage.accesstype == DATA_READ_RANGE_ACCESS) {
+                DATA_CopyRange(
+                    receiveMessage.blockId,
+                    receiveMessage.pDatabaseEntry[0],
+                    receiveMessage.offset,
+                    receiveMessage.length);
+            } else {
+                /* Iterate over pointer array and handle all access operations if pointer != NULL_PTR */
+                for (uint8_t queueEntry = 0u; queueEntry < DATA_MAX_ENTRIES_PER_ACCESS; queueEntry++) {
+                    if (receiveMessage.pDatabaseEntry[queueEntry] != NULL_PTR) {
+                        /* pointer to passed database struct */
+                        void *pPassedDataStruct = receiveMessage.pDatabaseEntry[queueEntry];
+                        /* Get access type (read or write) of passed data struct */
+                        DATA_BLOCK_ACCESS_TYPE_e accesstype = receiveMessage.accesstype;
+
+                        /* Get pointer to database header entry */
+                        DATA_BLOCK_HEADER_s *pHeader1 = (DATA_BLOCK_HEADER_s *)pPassedDataStruct;
+                        uint16_t entryIndex           = uniqueIdToDatabaseEntry[(uint16_t)pHeader1->uniqueId];
+                        /* Pointer to database struct representation of passed struct */
+                        void *pDatabaseStruct = (void *)data_baseHeader.pDatabase[entryIndex].pDatabaseEntry;
+                        /* Get datalength of database entry */
+                        uint16_t datalength = data_baseHeader.pDatabase[entryIndex].datalength;
+
+                        /* Copy data either into database or passed database struct */
+                        if (accesstype == DATA_WRITE_ACCESS) {
+                            /* Pointer on datablock header of passed struct */
+                            DATA_BLOCK_HEADER_s *pHeader = (DATA_BLOCK_HEADER_s *)pPassedDataStruct;
+                            /* Update timestamps in passed database struct and then copy this struct into database */
+                            pHeader->previousTimestamp = pHeader->timestamp;
+                            pHeader->timestamp         = OS_GetTickCount();
+                            /* Copy passed struct in database struct */
+                            /* memcpy has no return value therefore there is nothing to check: casting to void */
+                            (void)memcpy(pDatabaseStruct, pPassedDataStruct, datalength);
+                            DATA_NotifySubscribers(entryIndex);
+                        } else if (accesstype == DATA_READ_ACCESS) {
+                            /* Copy database entry in passed struct */
+                            /* memcpy has no return value therefore there is nothing to check: casting to void */
+                            (void)memcpy(pPassedDataStruct, pDatabaseStruct, datalength);
+                        } else {
+                            /* invalid database operation */
+                            FAS_ASSERT(FAS_TRAP);
+                        }
                     }
                 }
             }
@@ -273,10 +557,15 @@ STD_RETURN_TYPE_e DATA_Read_4_DataBlocks(
     data_send_msg.pDatabaseEntry[3] = pDataToReceiver3;
     data_send_msg.accesstype        = DATA_READ_ACCESS;
 
-    /* Send a pointer to a message object and */
-    /* maximum block time: queuetimeout */
-    if (pdPASS == xQueueSend(data_queue, (void *)&data_send_msg, queuetimeout)) {
+    if (DATA_USE_SEQUENCE_LOCK == true) {
+        DATA_AccessEntriesWithSequenceLock(data_send_msg.accesstype, data_send_msg.pDatabaseEntry);
         retval = STD_OK;
+    } else if (pdPASS == xQueueSend(data_queue, (void *)&data_send_msg, queuetimeout)) {
+        /* Send a pointer to a message object and */
+        /* maximum block time: queuetimeout */
+        retval = STD_OK;
+    } else {
+        /* queue is full, retval stays #STD_NOT_OK */
     }
     return retval;
 }
@@ -317,14 +606,135 @@ STD_RETURN_TYPE_e DATA_Write_4_DataBlocks(
     data_send_msg.pDatabaseEntry[3] = pDataFromSender3;
 
     data_send_msg.accesstype = DATA_WRITE_ACCESS;
-    /* Send a pointer to a message object and
-       maximum block time: queuetimeout */
-    if (pdPASS == xQueueSend(data_queue, (void *)&data_send_msg, queuetimeout)) {
+    if (DATA_USE_SEQUENCE_LOCK == true) {
+        DATA_AccessEntriesWithSequenceLock(data_send_msg.accesstype, data_send_msg.pDatabaseEntry);
+        retval = STD_OK;
+    } else if (pdPASS == xQueueSend(data_queue, (void *)&data_send_msg, queuetimeout)) {
+        /* Send a pointer to a message object and
+           maximum block time: queuetimeout */
         retval = STD_OK;
+    } else {
+        /* queue is full, retval stays #STD_NOT_OK */
     }
     return retval;
 }
 
+STD_RETURN_TYPE_e DATA_ReadDataBlockRange(
+    DATA_BLOCK_ID_e blockId,
+    void *pDataToReceiver,
+    uint16_t offset,
+    uint16_t length) {
+    FAS_ASSERT(blockId < DATA_BLOCK_ID_MAX);
+    FAS_ASSERT(pDataToReceiver != NULL_PTR);
+    STD_RETURN_TYPE_e retval = STD_NOT_OK;
+    DATA_QUEUE_MESSAGE_s data_send_msg;
+    TickType_t queuetimeout;
+
+    queuetimeout = DATA_QUEUE_TIMEOUT_MS / portTICK_RATE_MS;
+    if (queuetimeout == (TickType_t)0) {
+        queuetimeout = 1;
+    }
+
+    if (DATA_USE_SEQUENCE_LOCK == true) {
+        DATA_ReadRangeWithSequenceLock(uniqueIdToDatabaseEntry[(uint16_t)blockId], pDataToReceiver, offset, length);
+        retval = STD_OK;
+    } else {
+        /* prepare send message with attributes of the range */
+        data_send_msg.pDatabaseEntry[0] = pDataToReceiver;
+        data_send_msg.pDatabaseEntry[1] = NULL_PTR;
+        data_send_msg.pDatabaseEntry[2] = NULL_PTR;
+        data_send_msg.pDatabaseEntry[3] = NULL_PTR;
+        data_send_msg.blockId           = blockId;
+        data_send_msg.offset            = offset;
+        data_send_msg.length            = length;
+        data_send_msg.accesstype        = DATA_READ_RANGE_ACCESS;
+        /* Send a pointer to a message object and
+           maximum block time: queuetimeout */
+        if (pdPASS == xQueueSend(data_queue, (void *)&data_send_msg, queuetimeout)) {
+            retval = STD_OK;
+        }
+    }
+    return retval;
+}
+
+STD_RETURN_TYPE_e DATA_SubscribeToDataBlock(DATA_BLOCK_ID_e blockId, uint32_t notificationBits) {
+    FAS_ASSERT(blockId < DATA_BLOCK_ID_MAX);
+    FAS_ASSERT(notificationBits != 0u);
+    STD_RETURN_TYPE_e retval        = STD_NOT_OK;
+    const TaskHandle_t taskToNotify = xTaskGetCurrentTaskHandle();
+    const uint16_t entryIndex       = uniqueIdToDatabaseEntry[(uint16_t)blockId];
+
+    OS_EnterTaskCritical();
+    for (uint8_t subscriber = 0u; (subscriber < DATA_MAX_SUBSCRIBERS_PER_BLOCK) && (retval == STD_NOT_OK);
+         subscriber++) {
+        DATA_SUBSCRIPTION_s *pSubscription = &data_subscriptions[entryIndex][subscriber];
+        if ((pSubscription->taskToNotify == NULL_PTR) || (pSubscription->taskToNotify == taskToNotify)) {
+            /* use a free slot or add the bits to an existing subscription of this task */
+            pSubscription->taskToNotify = taskToNotify;
+            pSubscription->notificationBits |= notificationBits;
+            retval = STD_OK;
+        }
+    }
+    OS_ExitTaskCritical();
+    return retval;
+}
+
+uint32_t DATA_GetDataBlockUpdates(uint32_t notificationBits, uint32_t timeout_ms) {
+    uint32_t notificationValue = 0u;
+    const TickType_t timeout   = (TickType_t)(timeout_ms / portTICK_RATE_MS);
+    /* do not clear any bits on entry, clear the requested bits on exit */
+    if (xTaskNotifyWait(0u, notificationBits, &notificationValue, timeout) != pdTRUE) {
+        /* no notification received within the timeout */
+        notificationValue = 0u;
+    }
+    return notificationValue & notificationBits;
+}
+
+void *DATA_GetBackBuffer(DATA_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < DATA_BLOCK_ID_MAX);
+    const uint8_t backBufferIndex = DATA_GetBackBufferIndex(blockId);
+    /* only entries configured in data_backBuffers are double-buffered */
+    FAS_ASSERT(backBufferIndex < DATA_NR_OF_BACK_BUFFERS);
+    return data_backBuffers[backBufferIndex].pBackBuffer;
+}
+
+void DATA_CommitBackBuffer(DATA_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < DATA_BLOCK_ID_MAX);
+    const uint8_t backBufferIndex = DATA_GetBackBufferIndex(blockId);
+    FAS_ASSERT(backBufferIndex < DATA_NR_OF_BACK_BUFFERS);
+    const uint16_t entryIndex         = uniqueIdToDatabaseEntry[(uint16_t)blockId];
+    DATA_BASE_s *pEntry               = &data_baseHeader.pDatabase[entryIndex];
+    DATA_BLOCK_HEADER_s *pBackHeader  = (DATA_BLOCK_HEADER_s *)data_backBuffers[backBufferIndex].pBackBuffer;
+    DATA_BLOCK_HEADER_s *pFrontHeader = (DATA_BLOCK_HEADER_s *)pEntry->pDatabaseEntry;
+    FAS_ASSERT(pBackHeader->uniqueId == blockId);
+
+    /* Update timestamps in the back buffer as if it had been written into the database */
+    pBackHeader->previousTimestamp = pFrontHeader->timestamp;
+    pBackHeader->timestamp         = OS_GetTickCount();
+
+    /* Swap the buffers: the back buffer is published, the old front buffer becomes the next back buffer */
+    OS_EnterTaskCritical();
+    data_sequenceCounter[entryIndex]++;
+    DATA_MEMORY_BARRIER();
+    pEntry->pDatabaseEntry                        = (void *)pBackHeader;
+    data_backBuffers[backBufferIndex].pBackBuffer = (void *)pFrontHeader;
+    DATA_MEMORY_BARRIER();
+    data_sequenceCounter[entryIndex]++;
+    OS_ExitTaskCritical();
+
+    DATA_NotifySubscribers(entryIndex);
+}
+
+const void *DATA_GetFrontBuffer(DATA_BLOCK_ID_e blockId) {
+    FAS_ASSERT(blockId < DATA_BLOCK_ID_MAX);
+    FAS_ASSERT(DATA_GetBackBufferIndex(blockId) < DATA_NR_OF_BACK_BUFFERS);
+    return (const void *)data_baseHeader.pDatabase[uniqueIdToDatabaseEntry[(uint16_t)blockId]].pDatabaseEntry;
+}
+
+extern uint8_t DATA_GetMaximumNumberOfReadAttempts(void) {
+    return data_maximumReadAttempts;
+}
+
 extern bool DATA_DatabaseEntryUpdatedAtLeastOnce(void *pDatabaseEntry) {
     bool retval                  = false;
     DATA_BLOCK_HEADER_s *pHeader = (DATA_BLOCK_HEADER_s *)pDatabaseEntry;
@@ -370,3 +780,30 @@ extern bool DATA_DatabaseEntryUpdatedWithinInterval(void *pDatabaseEntry, uint32
 }
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_DATA_WriteEntryWithSequenceLock(void *pDataFromSender) {
+    DATA_WriteEntryWithSequenceLock(pDataFromSender);
+}
+extern void TEST_DATA_ReadEntryWithSequenceLock(void *pDataToReceiver) {
+    DATA_ReadEntryWithSequenceLock(pDataToReceiver);
+}
+extern void TEST_DATA_ReadRangeWithSequenceLock(
+    DATA_BLOCK_ID_e blockId,
+    void *pDataToReceiver,
+    uint16_t offset,
+    uint16_t length) {
+    DATA_ReadRangeWithSequenceLock(uniqueIdToDatabaseEntry[blockId], pDataToReceiver, offset, length);
+}
+extern void TEST_DATA_CopyRange(DATA_BLOCK_ID_e blockId, void *pDataToReceiver, uint16_t offset, uint16_t length) {
+    DATA_CopyRange(blockId, pDataToReceiver, offset, length);
+}
+extern void TEST_DATA_NotifySubscribers(DATA_BLOCK_ID_e blockId) {
+    DATA_NotifySubscribers(uniqueIdToDatabaseEntry[blockId]);
+}
+extern uint32_t TEST_DATA_GetSequenceCounter(DATA_BLOCK_ID_e blockId) {
+    return data_sequenceCounter[uniqueIdToDatabaseEntry[blockId]];
+}
+extern void TEST_DATA_SetSequenceCounter(DATA_BLOCK_ID_e blockId, uint32_t value) {
+    data_sequenceCounter[uniqueIdToDatabaseEntry[blockId]] = value;
+}
+#endif /* UNITY_UNIT_TEST */
@@ -61,9 +61,12 @@
 
 #include "FreeRTOS.h"
 #include "queue.h"
+#include "task.h"
 
 #include "os.h"
 
+#include <stddef.h>
+
 /*========== Macros and Definitions =========================================*/
 
 /** helper macro for the variadic macros for read and write functions */
@@ -89,12 +92,31 @@
         DATA_DummyFunction)      \
     (__VA_ARGS__)
 
+/**
+ * @brief   reads a single member of a database entry
+ * @details Wrapper for #DATA_ReadDataBlockRange() that determines offset and
+ *          length of the member from the type of the database entry, e.g.,
+ *          DATA_READ_FIELD(DATA_BLOCK_ID_MIN_MAX, DATA_BLOCK_MIN_MAX_s,
+ *          minimumCellVoltage_mV, &minimumCellVoltage_mV)
+ * @param   blockId             ID of the database entry
+ * @param   dataBlockType       type of the database entry
+ * @param   member              member (member designator) that is read
+ * @param   pDataToReceiver     pointer to the memory the member is copied to
+ */
+#define DATA_READ_FIELD(blockId, dataBlockType, member, pDataToReceiver) \
+    DATA_ReadDataBlockRange(                                             \
+        (blockId),                                                       \
+        (void *)(pDataToReceiver),                                       \
+        (uint16_t)offsetof(dataBlockType, member),                       \
+        (uint16_t)sizeof(((dataBlockType *)NULL_PTR)->member))
+
 /**
  * @brief data block access types (read or write)
  */
 typedef enum DATA_BLOCK_ACCESS_TYPE {
-    DATA_WRITE_ACCESS, /**< write access to data block   */
-    DATA_READ_ACCESS,  /**< read access to data block    */
+    DATA_WRITE_ACCESS,      /**< write access to data block             */
+    DATA_READ_ACCESS,       /**< read access to data block              */
+    DATA_READ_RANGE_ACCESS, /**< read access to a byte range of a block */
 } DATA_BLOCK_ACCESS_TYPE_e;
 
 /*========== Extern Constant and Variable Declarations ======================*/
@@ -243,6 +265,101 @@ extern STD_RETURN_TYPE_e DATA_Read_4_DataBlocks(
     void *pDataToReceiver2,
     void *pDataToReceiver3);
 
+/**
+ * @brief   Reads a byte range of a datablock in database by value.
+ * @details Only the requested range is copied into the passed memory. The
+ *          header of the database entry is not copied unless it is part of
+ *          the range. Use #DATA_READ_FIELD() to read a single member.
+ * @warning Do not call this function from inside a critical section, as it is
+ *          computationally complex.
+ * @param[in]   blockId         ID of the database entry
+ * @param[out]  pDataToReceiver pointer to the memory the range is copied to,
+ *                              must be at least length bytes large
+ * @param[in]   offset          offset of the range in bytes
+ * @param[in]   length          length of the range in bytes
+ * @return  #STD_OK if access was successful, otherwise #STD_NOT_OK
+ */
+extern STD_RETURN_TYPE_e DATA_ReadDataBlockRange(
+    DATA_BLOCK_ID_e blockId,
+    void *pDataToReceiver,
+    uint16_t offset,
+    uint16_t length);
+
+/**
+ * @brief   Subscribes the calling task to updates of a database entry
+ * @details Each time the entry is written, the passed bits are set in the
+ *          task notification value of the calling task. A task can subscribe
+ *          to several entries with different bits and evaluate them with
+ *          #DATA_GetDataBlockUpdates(). Subscribing again to the same entry
+ *          adds the bits to the existing subscription.
+ * @warning Must be called from task context after the scheduler has started.
+ * @param[in]   blockId             ID of the database entry
+ * @param[in]   notificationBits    bits that are set on an update, must not
+ *                                  be zero
+ * @return  #STD_OK if the subscription has been registered, #STD_NOT_OK if
+ *          already #DATA_MAX_SUBSCRIBERS_PER_BLOCK tasks are subscribed
+ */
+extern STD_RETURN_TYPE_e DATA_SubscribeToDataBlock(DATA_BLOCK_ID_e blockId, uint32_t notificationBits);
+
+/**
+ * @brief   Returns which subscribed database entries have been updated
+ * @details Waits at most timeout_ms for a notification of the calling task
+ *          and clears the returned bits. Use a timeout of zero to only check
+ *          for updates without blocking.
+ * @param[in]   notificationBits    bits of interest as passed to
+ *                                  #DATA_SubscribeToDataBlock()
+ * @param[in]   timeout_ms          maximum time to wait for an update
+ * @return  bits of entries that have been updated since the last call, zero
+ *          if no update has been received
+ */
+extern uint32_t DATA_GetDataBlockUpdates(uint32_t notificationBits, uint32_t timeout_ms);
+
+/**
+ * @brief   Returns the back buffer of a double-buffered database entry
+ * @details The writer of the entry fills the back buffer in place and then
+ *          publishes it with #DATA_CommitBackBuffer(). The content of the
+ *          back buffer is the content that was published two commits ago.
+ *          Only the entries configured in #data_backBuffers are
+ *          double-buffered and there must be only one writer per entry.
+ * @param[in]   blockId     ID of the database entry
+ * @return  pointer to the back buffer, the pointer is only valid until the
+ *          next call of #DATA_CommitBackBuffer()
+ */
+extern void *DATA_GetBackBuffer(DATA_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Publishes the back buffer of a double-buffered database entry
+ * @details Updates the timestamps of the back buffer and swaps it with the
+ *          current database entry without copying the data. Subscribed
+ *          tasks are notified as for a write access.
+ * @param[in]   blockId     ID of the database entry
+ */
+extern void DATA_CommitBackBuffer(DATA_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Returns a pointer to the current content of a double-buffered
+ *          database entry
+ * @details Readers can work on the entry without copying it. The referenced
+ *          data stays unchanged until the writer starts to fill the back
+ *          buffer after the next commit, i.e., for one measurement cycle.
+ *          Calculations that take longer have to copy the entry with
+ *          #DATA_READ_DATA().
+ * @param[in]   blockId     ID of the database entry
+ * @return  pointer to the current content of the database entry
+ */
+extern const void *DATA_GetFrontBuffer(DATA_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Returns the largest number of attempts a read access needed
+ * @details Only meaningful if #DATA_USE_SEQUENCE_LOCK is true. A value larger
+ *          than one means that a read access had to be repeated because the
+ *          entry was written concurrently, a value larger than
+ *          #DATA_SEQUENCE_LOCK_MAX_READ_ATTEMPTS means that a read access had
+ *          to copy the entry in a critical section.
+ * @return  largest number of read attempts since startup
+ */
+extern uint8_t DATA_GetMaximumNumberOfReadAttempts(void);
+
 /**
  * @brief   Checks if passed database entry has been updated at least once.
  * @param[in]  pDatabaseEntry (type: void *)
@@ -274,5 +391,18 @@ extern bool DATA_DatabaseEntryUpdatedRecently(void *pDatabaseEntry, uint32_t tim
 extern bool DATA_DatabaseEntryUpdatedWithinInterval(void *pDatabaseEntry, uint32_t timeInterval);
 
 /*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+#ifdef UNITY_UNIT_TEST
+extern void TEST_DATA_WriteEntryWithSequenceLock(void *pDataFromSender);
+extern void TEST_DATA_ReadEntryWithSequenceLock(void *pDataToReceiver);
+extern void TEST_DATA_ReadRangeWithSequenceLock(
+    DATA_BLOCK_ID_e blockId,
+    void *pDataToReceiver,
+    uint16_t offset,
+    uint16_t length);
+extern void TEST_DATA_CopyRange(DATA_BLOCK_ID_e blockId, void *pDataToReceiver, uint16_t offset, uint16_t length);
+extern void TEST_DATA_NotifySubscribers(DATA_BLOCK_ID_e blockId);
+extern uint32_t TEST_DATA_GetSequenceCounter(DATA_BLOCK_ID_e blockId);
+extern void TEST_DATA_SetSequenceCounter(DATA_BLOCK_ID_e blockId, uint32_t value);
+#endif /* UNITY_UNIT_TEST */
 
 #endif /* FOXBMS__DATABASE_H_ */
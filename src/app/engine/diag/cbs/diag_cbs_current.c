@@ -276,7 +276,7 @@ void DIAG_ErrorCurrentOnOpenString(
     FAS_ASSERT(stringNumber < BS_NR_OF_STRINGS);
 
     switch (ch_id) {
-        case DIAG_ID_CURRENT_MEASUREMENT_TIMEOUT:
+        case DIAG_ID_CURRENT_ON_OPEN_STRING:
             if (event == DIAG_EVENT_RESET) {
                 kpkDiagShim->pTableError->currentOnOpenString[stringNumber] = 0u;
             } else if (event == DIAG_EVENT_NOT_OK) {
@@ -54,19 +54,108 @@
 #include "sys_mon.h"
 
 #include "diag.h"
+#include "fram.h"
+#include "mcu.h"
 #include "os.h"
 
 /*========== Macros and Definitions =========================================*/
+/* the durations of all tasks are stored with a timing violation */
+static_assert(
+    FRAM_SYS_MON_RECORD_NR_OF_TASKS == (uint8_t)SYSM_TASK_ID_MAX,
+    "number of tasks in the timing violation record does not match");
 
 /*========== Static Constant and Variable Definitions =======================*/
 /** tracking variable for System monitoring notifications */
 static SYSM_NOTIFICATION_s sysm_notifications[SYSM_TASK_ID_MAX];
 
+/** cycle counter values at the last entry into the profiled tasks and sections */
+static uint32_t sysm_profileStartCycles[SYSM_NR_OF_PROFILES] = {0u};
+
+/** execution time profiles of the tasks and sections */
+static SYSM_PROFILE_s sysm_profiles[SYSM_NR_OF_PROFILES] = {0};
+
+/**
+ * a timing violation is detected in every check until the task is called
+ * again, these flags ensure that it is recorded only once
+ */
+static bool sysm_isViolationRecorded[SYSM_TASK_ID_MAX] = {false};
+
 /*========== Extern Constant and Variable Definitions =======================*/
 
 /*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   adds the execution time since the last start to a profile
+ * @details Has to be called within a critical section.
+ * @param   profileIndex    index of the profile
+ */
+static void SYSM_StopProfile(uint8_t profileIndex);
+
+/**
+ * @brief   limits a time to the range of the timing violation record
+ * @param   time_ms time in ms
+ * @return  time in ms, at most UINT16_MAX
+ */
+static uint16_t SYSM_LimitToUint16(uint32_t time_ms);
+
+/**
+ * @brief   adds a timing violation to the record in the FRAM
+ * @details The oldest violation is overwritten if the record is full. The
+ *          record is written to the FRAM later by the FRAM driver.
+ * @param   tsk_id      task that violated its timing
+ * @param   timestamp   time at which the violation was detected
+ * @param   jitter      delay of the task beyond its cycle time
+ */
+static void SYSM_RecordViolation(SYSM_TASK_ID_e tsk_id, uint32_t timestamp, uint32_t jitter);
 
 /*========== Static Function Implementations ================================*/
+static void SYSM_StopProfile(uint8_t profileIndex) {
+    const uint32_t duration_us =
+        MCU_ConvertCycleDifferenceToTimespan_us(MCU_GetCycleCount() - sysm_profileStartCycles[profileIndex]);
+    SYSM_PROFILE_s *pProfile = &sysm_profiles[profileIndex];
+
+    uint8_t bucket = 0u;
+    while ((bucket < (SYSM_PROFILE_NR_OF_BUCKETS - 1u)) && (duration_us >= sysm_profileBucketLimits_us[bucket])) {
+        bucket++;
+    }
+
+    if ((pProfile->count == 0u) || (duration_us < pProfile->minimum_us)) {
+        pProfile->minimum_us = duration_us;
+    }
+    if (duration_us > pProfile->maximum_us) {
+        pProfile->maximum_us = duration_us;
+    }
+    pProfile->total_us += duration_us;
+    pProfile->count++;
+    pProfile->histogram[bucket]++;
+}
+
+static uint16_t SYSM_LimitToUint16(uint32_t time_ms) {
+    uint16_t limitedTime_ms = UINT16_MAX;
+    if (time_ms < UINT16_MAX) {
+        limitedTime_ms = (uint16_t)time_ms;
+    }
+    return limitedTime_ms;
+}
+
+static void SYSM_RecordViolation(SYSM_TASK_ID_e tsk_id, uint32_t timestamp, uint32_t jitter) {
+    OS_EnterTaskCritical();
+    /* the number of slots divides 2^32, the ring continues when the counter wraps around */
+    const uint32_t nrOfViolations = fram_sysMonViolationRecord.nrOfViolations;
+    FRAM_SYS_MON_VIOLATION_s *pViolation =
+        &fram_sysMonViolationRecord.violations[nrOfViolations % FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS];
+
+    pViolation->timestamp_ms = timestamp;
+    pViolation->taskId       = (uint8_t)tsk_id;
+    pViolation->duration_ms  = SYSM_LimitToUint16(sysm_notifications[tsk_id].duration);
+    pViolation->jitter_ms    = SYSM_LimitToUint16(jitter);
+    for (uint8_t task = 0u; task < (uint8_t)SYSM_TASK_ID_MAX; task++) {
+        pViolation->taskDurations_ms[task] = SYSM_LimitToUint16(sysm_notifications[task].duration);
+    }
+    fram_sysMonViolationRecord.nrOfViolations = nrOfViolations + 1u;
+    OS_ExitTaskCritical();
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SYS_MON_RECORD);
+}
 
 /*========== Extern Function Implementations ================================*/
 void SYSM_CheckNotifications(void) {
@@ -92,10 +181,14 @@ void SYSM_CheckNotifications(void) {
                 (sysm_notifications[tsk_id].duration > sysm_ch_cfg[tsk_id].cycleTime)) {
                 /* module not running within its timed limits */
                 DIAG_Handler(DIAG_ID_SYSTEMMONITORING, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, tsk_id);
-                if (sysm_ch_cfg[tsk_id].enableRecording == SYSM_RECORDING_ENABLED) {
-                    /* TODO add recording function (when MRAM/FRAM are available) */
+                if ((sysm_ch_cfg[tsk_id].enableRecording == SYSM_RECORDING_ENABLED) &&
+                    (sysm_isViolationRecorded[tsk_id] == false)) {
+                    SYSM_RecordViolation(tsk_id, local_timer, time_since_last_call - sysm_ch_cfg[tsk_id].cycleTime);
+                    sysm_isViolationRecorded[tsk_id] = true;
                 }
                 sysm_ch_cfg[tsk_id].callbackfunc(tsk_id);
+            } else {
+                sysm_isViolationRecorded[tsk_id] = false;
             }
         }
     }
@@ -107,9 +200,15 @@ void SYSM_Notify(SYSM_TASK_ID_e tsk_id, SYSM_NOTIFY_TYPE_e state, uint32_t time)
         OS_EnterTaskCritical();
         if (SYSM_NOTIFY_ENTER == state) {
             sysm_notifications[tsk_id].timestampEnter = time;
+            if (SYSM_PROFILING_ENABLED == true) {
+                sysm_profileStartCycles[tsk_id] = MCU_GetCycleCount();
+            }
         } else if (SYSM_NOTIFY_EXIT == state) {
             sysm_notifications[tsk_id].timestampExit = time;
             sysm_notifications[tsk_id].duration      = time - sysm_notifications[tsk_id].timestampEnter;
+            if (SYSM_PROFILING_ENABLED == true) {
+                SYSM_StopProfile((uint8_t)tsk_id);
+            }
         } else {
             /* state has an illegal value */
             FAS_ASSERT(FAS_TRAP);
@@ -118,11 +217,72 @@ void SYSM_Notify(SYSM_TASK_ID_e tsk_id, SYSM_NOTIFY_TYPE_e state, uint32_t time)
     }
 }
 
+extern void SYSM_EnterSection(SYSM_SECTION_ID_e sectionId) {
+    FAS_ASSERT(sectionId < SYSM_SECTION_ID_MAX);
+    if (SYSM_PROFILING_ENABLED == true) {
+        sysm_profileStartCycles[(uint8_t)SYSM_TASK_ID_MAX + (uint8_t)sectionId] = MCU_GetCycleCount();
+    }
+}
+
+extern void SYSM_ExitSection(SYSM_SECTION_ID_e sectionId) {
+    FAS_ASSERT(sectionId < SYSM_SECTION_ID_MAX);
+    if (SYSM_PROFILING_ENABLED == true) {
+        OS_EnterTaskCritical();
+        SYSM_StopProfile((uint8_t)SYSM_TASK_ID_MAX + (uint8_t)sectionId);
+        OS_ExitTaskCritical();
+    }
+}
+
+extern void SYSM_GetProfile(uint8_t profileIndex, SYSM_PROFILE_s *pProfile) {
+    FAS_ASSERT(profileIndex < SYSM_NR_OF_PROFILES);
+    FAS_ASSERT(pProfile != NULL_PTR);
+    OS_EnterTaskCritical();
+    *pProfile = sysm_profiles[profileIndex];
+    OS_ExitTaskCritical();
+}
+
+extern void SYSM_LoadViolationRecord(void) {
+    /* without a valid record in the FRAM the record stays empty */
+    (void)FRAM_Read(FRAM_BLOCK_ID_SYS_MON_RECORD);
+}
+
+extern bool SYSM_GetRecordedViolation(uint8_t age, FRAM_SYS_MON_VIOLATION_s *pViolation) {
+    FAS_ASSERT(pViolation != NULL_PTR);
+    bool isRecorded = false;
+
+    OS_EnterTaskCritical();
+    const uint32_t nrOfViolations = fram_sysMonViolationRecord.nrOfViolations;
+    if ((age < FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS) && (age < nrOfViolations)) {
+        *pViolation =
+            fram_sysMonViolationRecord.violations[(nrOfViolations - 1u - age) % FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS];
+        isRecorded = true;
+    }
+    OS_ExitTaskCritical();
+    return isRecorded;
+}
+
+extern void SYSM_ClearViolationRecord(void) {
+    OS_EnterTaskCritical();
+    fram_sysMonViolationRecord = (FRAM_SYS_MON_RECORD_s){0};
+    for (uint8_t task = 0u; task < (uint8_t)SYSM_TASK_ID_MAX; task++) {
+        sysm_isViolationRecorded[task] = false;
+    }
+    OS_ExitTaskCritical();
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SYS_MON_RECORD);
+}
+
 /*========== Getter for static Variables (Unit Test) ========================*/
 #ifdef UNITY_UNIT_TEST
 extern SYSM_NOTIFICATION_s *TEST_SYSM_GetNotifications(void) {
     return sysm_notifications;
 }
+extern void TEST_SYSM_ResetProfiles(void) {
+    for (uint8_t i = 0u; i < SYSM_NR_OF_PROFILES; i++) {
+        sysm_profileStartCycles[i] = 0u;
+        sysm_profiles[i]           = (SYSM_PROFILE_s){0};
+    }
+}
 #endif
 
 /*========== Externalized Static Function Implementations (Unit Test) =======*/
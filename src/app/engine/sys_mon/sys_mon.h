@@ -56,6 +56,8 @@
 /*========== Includes =======================================================*/
 #include "sys_mon_cfg.h"
 
+#include "fram_cfg.h"
+
 /*========== Macros and Definitions =========================================*/
 /** defines entry or exit */
 typedef enum SYSM_NOTIFY_TYPE {
@@ -71,6 +73,15 @@ typedef struct SYSM_NOTIFICATION {
     uint32_t duration;        /**< duration between last complete entry and exit cycle */
 } SYSM_NOTIFICATION_s;
 
+/** execution time profile of a task or section */
+typedef struct SYSM_PROFILE {
+    uint32_t minimum_us;                            /**< shortest execution time */
+    uint32_t maximum_us;                            /**< longest execution time */
+    uint64_t total_us;                              /**< sum of all execution times */
+    uint32_t count;                                 /**< number of measured executions */
+    uint32_t histogram[SYSM_PROFILE_NR_OF_BUCKETS]; /**< number of executions per bucket */
+} SYSM_PROFILE_s;
+
 /*========== Extern Constant and Variable Declarations ======================*/
 
 /*========== Extern Function Prototypes =====================================*/
@@ -91,9 +102,62 @@ extern void SYSM_CheckNotifications(void);
  */
 extern void SYSM_Notify(SYSM_TASK_ID_e tsk_id, SYSM_NOTIFY_TYPE_e state, uint32_t time);
 
+/**
+ * @brief   Marks the start of a profiled section
+ * @details Only has an effect if #SYSM_PROFILING_ENABLED is true. Sections
+ *          must not be nested with themselves.
+ * @param   sectionId   section that is entered
+ */
+extern void SYSM_EnterSection(SYSM_SECTION_ID_e sectionId);
+
+/**
+ * @brief   Marks the end of a profiled section and adds the execution time
+ *          since #SYSM_EnterSection() to the profile of the section
+ * @param   sectionId   section that is left
+ */
+extern void SYSM_ExitSection(SYSM_SECTION_ID_e sectionId);
+
+/**
+ * @brief   Returns a consistent copy of an execution time profile
+ * @details The execution times are measured between enter and exit with the
+ *          cycle counter and therefore include the time spent in preempting
+ *          tasks and interrupts.
+ * @param   profileIndex    index of the profile, the profiles of the tasks
+ *                          (#SYSM_TASK_ID_e) are followed by the profiles of
+ *                          the sections (#SYSM_SECTION_ID_e)
+ * @param   pProfile        copy of the profile
+ */
+extern void SYSM_GetProfile(uint8_t profileIndex, SYSM_PROFILE_s *pProfile);
+
+/**
+ * @brief   Loads the record of the timing violations from the FRAM
+ * @details Has to be called once after the FRAM has been initialized and
+ *          before the system monitoring checks the tasks. If no valid record
+ *          is stored, the record starts empty.
+ */
+extern void SYSM_LoadViolationRecord(void);
+
+/**
+ * @brief   Returns a recorded timing violation
+ * @details The record keeps the latest #FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS
+ *          violations. A violation is recorded once, even if it is detected
+ *          until the task is called again.
+ * @param   age         age of the violation, 0 is the newest one
+ * @param   pViolation  copy of the violation
+ * @return  true if a violation of this age is recorded, false otherwise
+ */
+extern bool SYSM_GetRecordedViolation(uint8_t age, FRAM_SYS_MON_VIOLATION_s *pViolation);
+
+/**
+ * @brief   Deletes all recorded timing violations
+ * @details The empty record is written to the FRAM later by the FRAM driver.
+ */
+extern void SYSM_ClearViolationRecord(void);
+
 /*========== Getter for static Variables (Unit Test) ========================*/
 #ifdef UNITY_UNIT_TEST
 extern SYSM_NOTIFICATION_s *TEST_SYSM_GetNotifications(void);
+extern void TEST_SYSM_ResetProfiles(void);
 
 #endif
 
@@ -186,7 +186,17 @@ static inline void FAS_infiniteLoop() {
 
 /*============= define the recording macro =============*/
 
-#ifdef UNITY_UNIT_TEST
+#if defined(FOXBMS_SIL)
+/**
+ * @def     __curpc(x)
+ * @brief   replaces in the software-in-the-loop build the (platform-specific)
+ *          function for the retrieval of the program counter by the return
+ *          address of the asserting function
+ */
+static inline void *__curpc(void) {
+    return __builtin_return_address(0);
+}
+#elif defined(UNITY_UNIT_TEST)
 /**
  * @def     __curpc(x)
  * @brief   replaces in unit test the (platform-specific) function for the retrieval of the program counter
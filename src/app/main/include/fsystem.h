@@ -104,7 +104,7 @@ extern long FSYS_RaisePrivilege(void);
  *          #FSYS_RaisePrivilege(). Failure to call this macro may lead to
  *          unintended system behavior.
  */
-#ifndef UNITY_UNIT_TEST
+#if !defined(UNITY_UNIT_TEST) && !defined(FOXBMS_SIL)
 #define FSYS_SwitchToUserMode() \
     { __asm(" CPS #0x10"); }
 #else
@@ -67,10 +67,15 @@
 #include "diag.h"
 #include "dma.h"
 #include "masterinfo.h"
+#include "mcu.h"
 #include "meas.h"
 #include "os.h"
 #include "sps.h"
 
+#ifdef FOXBMS_SIL
+#include "sil.h"
+#endif
+
 /*========== Macros and Definitions =========================================*/
 
 /*========== Static Constant and Variable Definitions =======================*/
@@ -83,8 +88,12 @@
 
 /*========== Extern Function Implementations ================================*/
 int main(void) {
+#ifdef FOXBMS_SIL
+    SIL_Initialize(); /* Simulated peripherals of the software-in-the-loop build */
+#endif
     MINFO_SetResetSource(getResetSource()); /* Get reset source and clear respective flags */
     _enable_IRQ_interrupt_();
+    MCU_InitializeCycleCounter();
     gioInit();
     canInit();
     spiInit();
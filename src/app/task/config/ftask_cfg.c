@@ -154,6 +154,7 @@ void FTSK_UserCodePreCyclicTasksInitialization(void) {
 
     /* Init FRAM */
     FRAM_Initialize();
+    SYSM_LoadViolationRecord();
 
     imd_canDataQueue =
         xQueueCreateStatic(IMD_QUEUE_LENGTH, IMD_QUEUE_ITEM_SIZE, imd_queueStorageArea, &imd_queueStructure);
@@ -179,18 +180,38 @@ void FTSK_UserCodeCyclic1ms(void) {
 void FTSK_UserCodeCyclic10ms(void) {
     static uint8_t cnt = 0;
     /* user code */
+    SYSM_EnterSection(SYSM_SECTION_ID_SYS_TRIGGER);
     SYS_Trigger(&sys_state);
+    SYSM_ExitSection(SYSM_SECTION_ID_SYS_TRIGGER);
+    SYSM_EnterSection(SYSM_SECTION_ID_BMS_TRIGGER);
     BMS_Trigger();
+    SYSM_ExitSection(SYSM_SECTION_ID_BMS_TRIGGER);
+    SYSM_EnterSection(SYSM_SECTION_ID_ILCK_TRIGGER);
     ILCK_Trigger();
+    SYSM_ExitSection(SYSM_SECTION_ID_ILCK_TRIGGER);
+    SYSM_EnterSection(SYSM_SECTION_ID_ADC_CONTROL);
     ADC_Control(); /* TODO: check for shared SPI */
+    SYSM_ExitSection(SYSM_SECTION_ID_ADC_CONTROL);
+    SYSM_EnterSection(SYSM_SECTION_ID_SPS_CTRL);
     SPS_Ctrl();
+    SYSM_ExitSection(SYSM_SECTION_ID_SPS_CTRL);
+    SYSM_EnterSection(SYSM_SECTION_ID_CAN_MAIN_FUNCTION);
     CAN_MainFunction();
+    SYSM_ExitSection(SYSM_SECTION_ID_CAN_MAIN_FUNCTION);
+    SYSM_EnterSection(SYSM_SECTION_ID_SOF_CALCULATION);
     SOF_Calculation();
+    SYSM_ExitSection(SYSM_SECTION_ID_SOF_CALCULATION);
+    SYSM_EnterSection(SYSM_SECTION_ID_ALGO_MONITOR);
     ALGO_MonitorExecutionTime();
+    SYSM_ExitSection(SYSM_SECTION_ID_ALGO_MONITOR);
+    SYSM_EnterSection(SYSM_SECTION_ID_SBC_TRIGGER);
     SBC_Trigger(&sbc_stateMcuSupervisor);
+    SYSM_ExitSection(SYSM_SECTION_ID_SBC_TRIGGER);
     if (cnt == 5u) {
+        SYSM_EnterSection(SYSM_SECTION_ID_MRC_VALIDATION);
         MRC_ValidateMicMeasurement();
         MRC_ValidatePackMeasurement();
+        SYSM_ExitSection(SYSM_SECTION_ID_MRC_VALIDATION);
         cnt = 0;
     }
     cnt++;
@@ -218,6 +239,8 @@ void FTSK_UserCodeCyclicAlgorithm100ms(void) {
 }
 
 void FTSK_UserCodeIdle(void) {
+    /* Write the FRAM requests of the cyclic tasks */
+    FRAM_ProcessWriteRequests();
     /* user code */
 }
 
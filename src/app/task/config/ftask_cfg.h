@@ -60,8 +60,19 @@
 #include "os.h"
 
 /*========== Macros and Definitions =========================================*/
+/**
+ * @brief   Factor by which the stack sizes of the tasks are enlarged
+ * @details In the software-in-the-loop build the tasks run as threads of the
+ *          host, which need a multiple of the stack of the target.
+ */
+#ifdef FOXBMS_SIL
+#define FTSK_STACK_SIZE_FACTOR (32u)
+#else
+#define FTSK_STACK_SIZE_FACTOR (1u)
+#endif
+
 /** @brief Stack size of engine task */
-#define FTSK_TSK_ENGINE_STACK_SIZE (1024u / 4u)
+#define FTSK_TSK_ENGINE_STACK_SIZE ((1024u / 4u) * FTSK_STACK_SIZE_FACTOR)
 
 /** @brief Phase of engine task */
 #define FTSK_TSK_ENGINE_PHASE (0u)
@@ -73,7 +84,7 @@
 #define FTSK_TSK_ENGINE_MAXIMUM_JITTER (1u)
 
 /** @brief Stack size of cyclic 1 ms task */
-#define FTSK_TSK_CYCLIC_1MS_STACK_SIZE (1024u / 4u)
+#define FTSK_TSK_CYCLIC_1MS_STACK_SIZE ((1024u / 4u) * FTSK_STACK_SIZE_FACTOR)
 
 /** @brief Phase of cyclic 1ms task */
 #define FTSK_TSK_CYCLIC_1MS_PHASE (0u)
@@ -85,7 +96,7 @@
 #define FTSK_TSK_CYCLIC_1MS_MAXIMUM_JITTER (1u)
 
 /** @brief Stack size of cyclic 10 ms task */
-#define FTSK_TSK_CYCLIC_10MS_STACK_SIZE ((4096u) / 4u)
+#define FTSK_TSK_CYCLIC_10MS_STACK_SIZE (((4096u) / 4u) * FTSK_STACK_SIZE_FACTOR)
 
 /** @brief Phase of cyclic 10 ms task */
 #define FTSK_TSK_CYCLIC_10MS_PHASE (2u)
@@ -97,7 +108,7 @@
 #define FTSK_TSK_CYCLIC_10MS_MAXIMUM_JITTER (2u)
 
 /** @brief Stack size of cyclic 100 ms task */
-#define FTSK_TSK_CYCLIC_100MS_STACK_SIZE (1024u / 4u)
+#define FTSK_TSK_CYCLIC_100MS_STACK_SIZE ((1024u / 4u) * FTSK_STACK_SIZE_FACTOR)
 
 /** @brief Phase of cyclic 100 ms task */
 #define FTSK_TSK_CYCLIC_100MS_PHASE (56u)
@@ -109,7 +120,7 @@
 #define FTSK_TSK_CYCLIC_100MS_MAXIMUM_JITTER (5u)
 
 /** @brief Stack size of cyclic 100 ms task for algorithms */
-#define FTSK_TSK_CYCLIC_ALGORITHM_100MS_STACKSIZE (1024u / 4u)
+#define FTSK_TSK_CYCLIC_ALGORITHM_100MS_STACKSIZE ((1024u / 4u) * FTSK_STACK_SIZE_FACTOR)
 
 /** @brief Phase of cyclic 100 ms task for algorithms */
 #define FTSK_TSK_CYCLIC_ALGORITHM_100MS_PHASE (64u)
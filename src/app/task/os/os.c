@@ -196,7 +196,10 @@ void OS_DelayTask(uint32_t delay_ms) {
 void OS_DelayTaskUntil(uint32_t *pPreviousWakeTime, uint32_t milliseconds) {
 #if INCLUDE_vTaskDelayUntil
     TickType_t ticks = (milliseconds / portTICK_PERIOD_MS);
-    vTaskDelayUntil((TickType_t *)pPreviousWakeTime, ticks ? ticks : 1);
+    /* TickType_t is wider than 32 bit on 64-bit ports (software-in-the-loop build) */
+    TickType_t previousWakeTime = (TickType_t)*pPreviousWakeTime;
+    vTaskDelayUntil(&previousWakeTime, ticks ? ticks : 1);
+    *pPreviousWakeTime = (uint32_t)previousWakeTime;
 
 #else
 #error "Can't use OS_taskDelayUntil."
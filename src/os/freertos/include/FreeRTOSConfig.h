@@ -105,4 +105,10 @@
 
 #define configASSERT( x )    if( ( x ) == pdFALSE ) { taskDISABLE_INTERRUPTS(); for( ; ; ) {; } }
 
+/* The software-in-the-loop build runs on the FreeRTOS POSIX port and adapts
+ * the configuration of the target to it. */
+#ifdef FOXBMS_SIL
+#include "sil_freertos_cfg.h"
+#endif
+
 #endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,406 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bench.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  BENCH
+ *
+ * @brief   Micro-benchmark of the hot kernels of foxBMS on the host
+ *
+ * @details Measures the kernels of bench_kernels.c with statistical repetition: the number
+ *          of calls per sample is calibrated so that one sample takes at least the sample
+ *          time, then the given number of samples is measured. The median, the minimum and
+ *          the interquartile range of the time per call are reported and, on x86-64 hosts,
+ *          the median number of time stamp counter cycles per call. The results are written
+ *          as JSON, so that they can be compared with a baseline.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "bench_kernels.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/utsname.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+/*========== Macros and Definitions =========================================*/
+/** default number of samples per kernel */
+#define BENCH_DEFAULT_NUMBER_OF_SAMPLES (31u)
+
+/** largest number of samples per kernel */
+#define BENCH_MAXIMUM_NUMBER_OF_SAMPLES (1001u)
+
+/** default minimum duration of a sample in us */
+#define BENCH_DEFAULT_SAMPLE_TIME_us (2000u)
+
+/** largest number of calls per sample */
+#define BENCH_MAXIMUM_CALLS_PER_SAMPLE (UINT32_C(1) << 30u)
+
+/** busy time before the first kernel in us, so that the host runs at its full clock frequency */
+#define BENCH_WARM_UP_TIME_us (200000u)
+
+/** nanoseconds per microsecond */
+#define BENCH_NS_PER_US (1000u)
+
+/** nanoseconds per second */
+#define BENCH_NS_PER_S (1000000000u)
+
+/** options of the micro-benchmark */
+typedef struct BENCH_OPTIONS {
+    const char *pOutputFile;  /*!< JSON file of the results or NULL_PTR */
+    const char *pFilter;      /*!< only kernels whose name contains the filter or NULL_PTR */
+    uint32_t numberOfSamples; /*!< samples per kernel */
+    uint32_t sampleTime_us;   /*!< minimum duration of a sample */
+    bool isListOnly;          /*!< true if only the names of the kernels are printed */
+} BENCH_OPTIONS_s;
+
+/** result of a kernel */
+typedef struct BENCH_RESULT {
+    uint32_t callsPerSample;      /*!< calibrated number of calls per sample */
+    double median_ns;             /*!< median time per call */
+    double minimum_ns;            /*!< shortest time per call */
+    double interquartileRange_ns; /*!< interquartile range of the time per call */
+    double medianCycles;          /*!< median cycles per call, negative if not measured */
+} BENCH_RESULT_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** options of the micro-benchmark */
+static BENCH_OPTIONS_s bench_options = {
+    .pOutputFile     = NULL_PTR,
+    .pFilter         = NULL_PTR,
+    .numberOfSamples = BENCH_DEFAULT_NUMBER_OF_SAMPLES,
+    .sampleTime_us   = BENCH_DEFAULT_SAMPLE_TIME_us,
+    .isListOnly      = false,
+};
+
+/** time per call of the samples of the current kernel */
+static double bench_sampleTimes_ns[BENCH_MAXIMUM_NUMBER_OF_SAMPLES] = {0.0};
+
+/** cycles per call of the samples of the current kernel */
+static double bench_sampleCycles[BENCH_MAXIMUM_NUMBER_OF_SAMPLES] = {0.0};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Prints the usage of the micro-benchmark.
+ * @param   pProgram    name of the program
+ */
+static void BENCH_PrintUsage(const char *pProgram);
+
+/**
+ * @brief   Parses a positive number of the command line.
+ * @param   pValue      value of the option
+ * @param   maximum     largest valid value
+ * @param   pNumber     parsed number
+ * @return  #STD_OK if the value is a valid number, #STD_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e BENCH_ParseNumber(const char *pValue, uint32_t maximum, uint32_t *pNumber);
+
+/**
+ * @brief   Parses the command line.
+ * @param   argc    number of arguments
+ * @param   argv    arguments
+ * @return  #STD_OK if the command line is valid, #STD_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e BENCH_ParseOptions(int argc, char *argv[]);
+
+/**
+ * @brief   Returns the host time.
+ * @return  monotonic host time in ns
+ */
+static uint64_t BENCH_GetHostTime_ns(void);
+
+/**
+ * @brief   Returns the time stamp counter of the host.
+ * @return  cycles of the time stamp counter, 0 if the host has none
+ */
+static uint64_t BENCH_GetCycles(void);
+
+/**
+ * @brief   Compares two doubles for qsort().
+ * @param   pA  first value
+ * @param   pB  second value
+ * @return  negative, zero or positive as *pA is smaller, equal or larger
+ */
+static int BENCH_CompareDoubles(const void *pA, const void *pB);
+
+/**
+ * @brief   Returns a quantile of sorted values.
+ * @param   pValues         sorted values
+ * @param   numberOfValues  number of values
+ * @param   quantile        quantile between 0 and 1
+ * @return  the value at the quantile (nearest rank)
+ */
+static double BENCH_GetQuantile(const double *pValues, uint32_t numberOfValues, double quantile);
+
+/**
+ * @brief   Calibrates and measures a kernel.
+ * @param   pKernel the kernel
+ * @param   pResult result of the kernel
+ */
+static void BENCH_MeasureKernel(const BENCH_KERNEL_s *pKernel, BENCH_RESULT_s *pResult);
+
+/**
+ * @brief   Writes the header of the JSON results.
+ * @param   pFile   opened JSON file
+ */
+static void BENCH_WriteJsonHeader(FILE *pFile);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_PrintUsage(const char *pProgram) {
+    (void)fprintf(
+        stderr,
+        "usage: %s [-o results] [-n samples] [-s sample_us] [-k filter] [-l]\n"
+        "  -o results      JSON file of the results (default: none)\n"
+        "  -n samples      samples per kernel (default: %u, at most %u)\n"
+        "  -s sample_us    minimum duration of a sample in us (default: %u)\n"
+        "  -k filter       only the kernels whose name contains the filter\n"
+        "  -l              print the names of the kernels and exit\n",
+        pProgram,
+        BENCH_DEFAULT_NUMBER_OF_SAMPLES,
+        BENCH_MAXIMUM_NUMBER_OF_SAMPLES,
+        BENCH_DEFAULT_SAMPLE_TIME_us);
+}
+
+static STD_RETURN_TYPE_e BENCH_ParseNumber(const char *pValue, uint32_t maximum, uint32_t *pNumber) {
+    STD_RETURN_TYPE_e retVal  = STD_NOT_OK;
+    char *pEnd                = NULL_PTR;
+    errno                     = 0;
+    const unsigned long value = strtoul(pValue, &pEnd, 10);
+    if ((pEnd != pValue) && (*pEnd == '\0') && (errno == 0) && (value > 0u) && (value <= maximum) &&
+        (pValue[0] != '-')) {
+        *pNumber = (uint32_t)value;
+        retVal   = STD_OK;
+    }
+    return retVal;
+}
+
+static STD_RETURN_TYPE_e BENCH_ParseOptions(int argc, char *argv[]) {
+    STD_RETURN_TYPE_e retVal = STD_OK;
+    int option               = 0;
+    while ((retVal == STD_OK) && ((option = getopt(argc, argv, "o:n:s:k:l")) != -1)) {
+        switch (option) {
+            case 'o':
+                bench_options.pOutputFile = optarg;
+                break;
+            case 'n':
+                retVal = BENCH_ParseNumber(optarg, BENCH_MAXIMUM_NUMBER_OF_SAMPLES, &bench_options.numberOfSamples);
+                break;
+            case 's':
+                retVal = BENCH_ParseNumber(optarg, UINT32_MAX / BENCH_NS_PER_US, &bench_options.sampleTime_us);
+                break;
+            case 'k':
+                bench_options.pFilter = optarg;
+                break;
+            case 'l':
+                bench_options.isListOnly = true;
+                break;
+            default:
+                retVal = STD_NOT_OK;
+                break;
+        }
+    }
+    if (optind != argc) {
+        retVal = STD_NOT_OK;
+    }
+    return retVal;
+}
+
+static uint64_t BENCH_GetHostTime_ns(void) {
+    struct timespec now = {0};
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * BENCH_NS_PER_S) + (uint64_t)now.tv_nsec;
+}
+
+static uint64_t BENCH_GetCycles(void) {
+#if defined(__x86_64__)
+    return __rdtsc();
+#else
+    return 0u;
+#endif
+}
+
+static int BENCH_CompareDoubles(const void *pA, const void *pB) {
+    const double a = *(const double *)pA;
+    const double b = *(const double *)pB;
+    return (a > b) - (a < b);
+}
+
+static double BENCH_GetQuantile(const double *pValues, uint32_t numberOfValues, double quantile) {
+    const uint32_t index = (uint32_t)((quantile * (double)(numberOfValues - 1u)) + 0.5);
+    return pValues[index];
+}
+
+static void BENCH_MeasureKernel(const BENCH_KERNEL_s *pKernel, BENCH_RESULT_s *pResult) {
+    if (pKernel->pInitialize != NULL_PTR) {
+        pKernel->pInitialize();
+    }
+    /* calibration, which also warms up the caches and the branch predictors */
+    const uint64_t sampleTime_ns = (uint64_t)bench_options.sampleTime_us * BENCH_NS_PER_US;
+    uint32_t callsPerSample      = 1u;
+    while (callsPerSample < BENCH_MAXIMUM_CALLS_PER_SAMPLE) {
+        const uint64_t start_ns = BENCH_GetHostTime_ns();
+        pKernel->pRun(callsPerSample);
+        if ((BENCH_GetHostTime_ns() - start_ns) >= sampleTime_ns) {
+            break;
+        }
+        callsPerSample *= 2u;
+    }
+
+    for (uint32_t sample = 0u; sample < bench_options.numberOfSamples; sample++) {
+        const uint64_t start_ns    = BENCH_GetHostTime_ns();
+        const uint64_t startCycles = BENCH_GetCycles();
+        pKernel->pRun(callsPerSample);
+        const uint64_t cycles        = BENCH_GetCycles() - startCycles;
+        const uint64_t duration_ns   = BENCH_GetHostTime_ns() - start_ns;
+        bench_sampleTimes_ns[sample] = (double)duration_ns / (double)callsPerSample;
+        bench_sampleCycles[sample]   = (double)cycles / (double)callsPerSample;
+    }
+    const uint32_t n = bench_options.numberOfSamples;
+    qsort(bench_sampleTimes_ns, n, sizeof(double), &BENCH_CompareDoubles);
+    qsort(bench_sampleCycles, n, sizeof(double), &BENCH_CompareDoubles);
+    const double firstQuartile_ns  = BENCH_GetQuantile(bench_sampleTimes_ns, n, 0.25);
+    const double thirdQuartile_ns  = BENCH_GetQuantile(bench_sampleTimes_ns, n, 0.75);
+    pResult->callsPerSample        = callsPerSample;
+    pResult->median_ns             = BENCH_GetQuantile(bench_sampleTimes_ns, n, 0.5);
+    pResult->minimum_ns            = bench_sampleTimes_ns[0u];
+    pResult->interquartileRange_ns = thirdQuartile_ns - firstQuartile_ns;
+    pResult->medianCycles          = (BENCH_GetCycles() != 0u) ? BENCH_GetQuantile(bench_sampleCycles, n, 0.5) : -1.0;
+}
+
+static void BENCH_WriteJsonHeader(FILE *pFile) {
+    struct utsname host = {0};
+    (void)uname(&host);
+    (void)fprintf(pFile, "{\n");
+    (void)fprintf(pFile, "  \"host\": {\n");
+    (void)fprintf(pFile, "    \"machine\": \"%s\",\n", host.machine);
+    (void)fprintf(pFile, "    \"compiler\": \"gcc %s\"\n", __VERSION__);
+    (void)fprintf(pFile, "  },\n");
+    (void)fprintf(pFile, "  \"samples\": %u,\n", bench_options.numberOfSamples);
+    (void)fprintf(pFile, "  \"sample_time_us\": %u,\n", bench_options.sampleTime_us);
+    (void)fprintf(pFile, "  \"kernels\": {");
+}
+
+/*========== Extern Function Implementations ================================*/
+int main(int argc, char *argv[]) {
+    if (BENCH_ParseOptions(argc, argv) != STD_OK) {
+        BENCH_PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (bench_options.isListOnly == true) {
+        for (uint8_t i = 0u; i < bench_numberOfKernels; i++) {
+            (void)printf("%s\n", bench_kernels[i].pName);
+        }
+        return EXIT_SUCCESS;
+    }
+    FILE *pJson = NULL_PTR;
+    if (bench_options.pOutputFile != NULL_PTR) {
+        pJson = fopen(bench_options.pOutputFile, "w");
+        if (pJson == NULL_PTR) {
+            (void)fprintf(
+                stderr, "foxBMS benchmark: '%s' not writable (%s)\n", bench_options.pOutputFile, strerror(errno));
+            return EXIT_FAILURE;
+        }
+        BENCH_WriteJsonHeader(pJson);
+    }
+
+    BENCH_InitializeApplication();
+    const uint64_t warmUpStart_ns = BENCH_GetHostTime_ns();
+    while ((BENCH_GetHostTime_ns() - warmUpStart_ns) < ((uint64_t)BENCH_WARM_UP_TIME_us * BENCH_NS_PER_US)) {
+        bench_kernels[0u].pRun(1u);
+    }
+    (void)printf("%-40s %12s %12s %12s %10s %12s\n", "kernel", "calls", "median ns", "min ns", "IQR %", "cycles");
+    const char *pSeparator = "";
+    for (uint8_t i = 0u; i < bench_numberOfKernels; i++) {
+        const BENCH_KERNEL_s *pKernel = &bench_kernels[i];
+        if ((bench_options.pFilter != NULL_PTR) && (strstr(pKernel->pName, bench_options.pFilter) == NULL_PTR)) {
+            continue;
+        }
+        BENCH_RESULT_s result = {0};
+        BENCH_MeasureKernel(pKernel, &result);
+        (void)printf(
+            "%-40s %12u %12.2f %12.2f %10.1f",
+            pKernel->pName,
+            result.callsPerSample,
+            result.median_ns,
+            result.minimum_ns,
+            (100.0 * result.interquartileRange_ns) / result.median_ns);
+        if (result.medianCycles >= 0.0) {
+            (void)printf(" %12.1f\n", result.medianCycles);
+        } else {
+            (void)printf(" %12s\n", "-");
+        }
+        if (pJson != NULL_PTR) {
+            (void)fprintf(pJson, "%s\n    \"%s\": {\n", pSeparator, pKernel->pName);
+            (void)fprintf(pJson, "      \"calls_per_sample\": %u,\n", result.callsPerSample);
+            (void)fprintf(pJson, "      \"median_ns\": %.3f,\n", result.median_ns);
+            (void)fprintf(pJson, "      \"minimum_ns\": %.3f,\n", result.minimum_ns);
+            (void)fprintf(pJson, "      \"interquartile_range_ns\": %.3f,\n", result.interquartileRange_ns);
+            if (result.medianCycles >= 0.0) {
+                (void)fprintf(pJson, "      \"median_cycles\": %.1f\n", result.medianCycles);
+            } else {
+                (void)fprintf(pJson, "      \"median_cycles\": null\n");
+            }
+            (void)fprintf(pJson, "    }");
+            pSeparator = ",";
+        }
+    }
+    if (pJson != NULL_PTR) {
+        (void)fprintf(pJson, "\n  }\n}\n");
+        (void)fclose(pJson);
+    }
+    return EXIT_SUCCESS;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
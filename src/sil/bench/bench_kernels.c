@@ -0,0 +1,379 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bench_kernels.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  BENCH
+ *
+ * @brief   Kernels of the micro-benchmark of foxBMS
+ *
+ * @details The inputs of the kernels are representative for the configuration of the
+ *          repository: register groups and messages of the monitoring ICs, the READALL answer
+ *          of a daisy-chain of the largest supported length, a cell voltage message and the
+ *          cell voltages of all strings. Where the input depends on a value (e.g., the ADC
+ *          voltage of a temperature sensor), every call uses the next value of a table, so
+ *          that the branches of the kernel are not always taken in the same way.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "bench_kernels.h"
+
+#include "battery_system_cfg.h"
+#include "database_cfg.h"
+#include "diag_cfg.h"
+
+#include "can_codec.h"
+#include "database.h"
+#include "diag.h"
+#include "epcos_b57251v5103j060.h"
+#include "epcos_b57861s0103f045.h"
+#include "ltc_pec.h"
+#include "moving_average.h"
+#include "mxm_1785x.h"
+#include "mxm_crc8.h"
+#include "n775_crc.h"
+#include "redundancy.h"
+#include "replay_kernel.h"
+#include "vishay_ntcalug01a103g.h"
+
+/*========== Macros and Definitions =========================================*/
+/** number of data bytes of a register group of the LTC monitoring ICs */
+#define BENCH_LTC_REGISTER_GROUP_SIZE (6u)
+
+/** number of items of a message to the NXP monitoring ICs */
+#define BENCH_N775_MESSAGE_SIZE (3u)
+
+/** length of the answer of the Maxim daisy-chain to a READALL command (command,
+ *  register, two bytes per module, data check byte and CRC) */
+#define BENCH_MXM_READALL_LENGTH (2u + (2u * MXM_MAXIMUM_NR_OF_MODULES) + 2u)
+
+/** number of ADC voltages at which the temperature look-up tables are evaluated */
+#define BENCH_NUMBER_OF_ADC_VOLTAGES (64u)
+
+/** largest ADC voltage at which the temperature look-up tables are evaluated */
+#define BENCH_MAXIMUM_ADC_VOLTAGE_mV (3000u)
+
+/** number of cell voltages of one string */
+#define BENCH_NUMBER_OF_CELL_VOLTAGES (BS_NR_OF_BAT_CELLS)
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** register group of the LTC monitoring ICs */
+static uint8_t bench_ltcRegisterGroup[BENCH_LTC_REGISTER_GROUP_SIZE] = {0u};
+
+/** message to the NXP monitoring ICs */
+static uint16_t bench_n775Message[BENCH_N775_MESSAGE_SIZE] = {0u};
+
+/** READALL answer of the Maxim daisy-chain, one byte per entry as received */
+static uint16_t bench_mxmCrcBuffer[BENCH_MXM_READALL_LENGTH] = {0u};
+
+/** READALL answer of the Maxim daisy-chain with the cell voltages of the first cell */
+static uint8_t bench_mxmReadall[BENCH_MXM_READALL_LENGTH] = {0u};
+
+/** voltages that are parsed from #bench_mxmReadall */
+static MXM_DATA_STORAGE_s bench_mxmVoltages = {0};
+
+/** signals of the cell voltage message */
+static CAN_FOXBMS_CELL_VOLTAGE_SIGNALS_s bench_canCellVoltage = {0};
+
+/** data of the packed CAN message */
+static uint8_t bench_canData[CAN_FOXBMS_CELL_VOLTAGE_DLC] = {0u};
+
+/** ADC voltages at which the temperature look-up tables are evaluated */
+static uint16_t bench_adcVoltages_mV[BENCH_NUMBER_OF_ADC_VOLTAGES] = {0u};
+
+/** cell voltages of all strings */
+static DATA_BLOCK_CELL_VOLTAGE_s bench_cellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+
+/** minimum, maximum and average values of the cell voltages */
+static DATA_BLOCK_MIN_MAX_s bench_minMax = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+
+/** current sensor values that are averaged */
+static DATA_BLOCK_CURRENT_SENSOR_s bench_currentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+
+/** results of the kernels, so that the compiler cannot remove the calls */
+static volatile uint32_t bench_sink = 0u;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/** prepares the input of the LTC PEC kernel */
+static void BENCH_InitializeLtcPec(void);
+/** calls #LTC_pec15_calc() */
+static void BENCH_RunLtcPec(uint32_t numberOfCalls);
+
+/** prepares the input of the NXP CRC kernel */
+static void BENCH_InitializeN775Crc(void);
+/** calls #N775_CrcAddItems() */
+static void BENCH_RunN775Crc(uint32_t numberOfCalls);
+
+/** prepares the input of the Maxim kernels */
+static void BENCH_InitializeMxmReadall(void);
+/** calls #MXM_CRC8() */
+static void BENCH_RunMxmCrc8(uint32_t numberOfCalls);
+/** calls MXM_ParseVoltageReadall() */
+static void BENCH_RunMxmParseVoltageReadall(uint32_t numberOfCalls);
+
+/** prepares the input of the CAN kernel */
+static void BENCH_InitializeCanCellVoltage(void);
+/** calls #CAN_PackFoxbmsCellVoltage() */
+static void BENCH_RunCanPackCellVoltage(uint32_t numberOfCalls);
+
+/** calls #DIAG_Handler() */
+static void BENCH_RunDiagHandler(uint32_t numberOfCalls);
+
+/** prepares the cell voltages of all strings */
+static void BENCH_InitializeCellVoltages(void);
+/** calls #DATA_READ_DATA() */
+static void BENCH_RunDataRead(uint32_t numberOfCalls);
+/** calls #DATA_WRITE_DATA() */
+static void BENCH_RunDataWrite(uint32_t numberOfCalls);
+/** calls MRC_CalculateCellVoltageMinMaxAverage() */
+static void BENCH_RunMrcCellVoltageMinMaxAverage(uint32_t numberOfCalls);
+
+/** prepares the ADC voltages of the temperature sensors */
+static void BENCH_InitializeAdcVoltages(void);
+/** calls #TS_Epc00GetTemperatureFromLut() */
+static void BENCH_RunTsEpc00Lut(uint32_t numberOfCalls);
+/** calls #TS_Epc01GetTemperatureFromLut() */
+static void BENCH_RunTsEpc01Lut(uint32_t numberOfCalls);
+/** calls #TS_Vis00GetTemperatureFromLut() */
+static void BENCH_RunTsVis00Lut(uint32_t numberOfCalls);
+
+/** calls #ALGO_MovAverage() with a new current and power value in every call */
+static void BENCH_RunAlgoMovAverage(uint32_t numberOfCalls);
+
+/*========== Static Function Implementations ================================*/
+static void BENCH_InitializeLtcPec(void) {
+    for (uint8_t i = 0u; i < BENCH_LTC_REGISTER_GROUP_SIZE; i++) {
+        bench_ltcRegisterGroup[i] = (uint8_t)(0x5Au + (17u * i));
+    }
+}
+
+static void BENCH_RunLtcPec(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        bench_ltcRegisterGroup[0u] = (uint8_t)call;
+        bench_sink                 = LTC_pec15_calc(BENCH_LTC_REGISTER_GROUP_SIZE, bench_ltcRegisterGroup);
+    }
+}
+
+static void BENCH_InitializeN775Crc(void) {
+    for (uint8_t i = 0u; i < BENCH_N775_MESSAGE_SIZE; i++) {
+        bench_n775Message[i] = (uint16_t)(0x1234u * (i + 1u));
+    }
+}
+
+static void BENCH_RunN775Crc(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        bench_n775Message[0u] = (uint16_t)call;
+        bench_sink            = N775_CrcAddItems(0u, bench_n775Message, BENCH_N775_MESSAGE_SIZE);
+    }
+}
+
+static void BENCH_InitializeMxmReadall(void) {
+    bench_mxmReadall[0u] = BATTERY_MANAGEMENT_READALL;
+    bench_mxmReadall[1u] = MXM_REG_CELL1;
+    for (uint16_t i = 2u; i < (BENCH_MXM_READALL_LENGTH - 2u); i++) {
+        /* cell voltages around 3.7 V, the two lowest bits of the register are not used */
+        bench_mxmReadall[i] = ((i % 2u) == 0u) ? (uint8_t)(0x1Cu + i) : 0xBDu;
+    }
+    for (uint16_t i = 0u; i < BENCH_MXM_READALL_LENGTH; i++) {
+        bench_mxmCrcBuffer[i] = bench_mxmReadall[i];
+    }
+}
+
+static void BENCH_RunMxmCrc8(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        bench_mxmCrcBuffer[2u] = (uint8_t)call;
+        bench_sink             = MXM_CRC8(bench_mxmCrcBuffer, (int32_t)BENCH_MXM_READALL_LENGTH);
+    }
+}
+
+static void BENCH_RunMxmParseVoltageReadall(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        bench_sink = (uint32_t)TEST_MXM_ParseVoltageReadall(
+            bench_mxmReadall, BENCH_MXM_READALL_LENGTH, &bench_mxmVoltages, MXM_CONVERSION_UNIPOLAR);
+    }
+}
+
+static void BENCH_InitializeCanCellVoltage(void) {
+    bench_canCellVoltage.foxBMS_CellVoltage_Mux    = 1u;
+    bench_canCellVoltage.cellVoltage_1_invalidFlag = 1u;
+    bench_canCellVoltage.cellVoltage_0             = 3700u;
+    bench_canCellVoltage.cell_voltage_1            = 3712u;
+    bench_canCellVoltage.cell_voltage_2            = 3698u;
+    bench_canCellVoltage.cell_voltage_3            = 3705u;
+}
+
+static void BENCH_RunCanPackCellVoltage(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        bench_canCellVoltage.foxBMS_CellVoltage_Mux = (uint8_t)call;
+        CAN_PackFoxbmsCellVoltage(&bench_canCellVoltage, bench_canData);
+        bench_sink = bench_canData[0u];
+    }
+}
+
+static void BENCH_RunDiagHandler(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        /* the most frequent call: the check of a limit passed */
+        bench_sink = (uint32_t)DIAG_Handler(
+            DIAG_ID_CELLVOLTAGE_OVERVOLTAGE_MSL, DIAG_EVENT_OK, DIAG_STRING, call % BS_NR_OF_STRINGS);
+    }
+}
+
+static void BENCH_InitializeCellVoltages(void) {
+    for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
+        int32_t packVoltage_mV = 0;
+        for (uint16_t cell = 0u; cell < BENCH_NUMBER_OF_CELL_VOLTAGES; cell++) {
+            bench_cellVoltage.cellVoltage_mV[stringNumber][cell] = (int16_t)(3600u + ((cell * 37u) % 200u));
+            packVoltage_mV += bench_cellVoltage.cellVoltage_mV[stringNumber][cell];
+        }
+        bench_cellVoltage.packVoltage_mV[stringNumber]      = packVoltage_mV;
+        bench_cellVoltage.nrValidCellVoltages[stringNumber] = BENCH_NUMBER_OF_CELL_VOLTAGES;
+        for (uint8_t module = 0u; module < BS_NR_OF_MODULES; module++) {
+            bench_cellVoltage.invalidCellVoltage[stringNumber][module] = 0u;
+            bench_cellVoltage.validModuleVoltage[stringNumber][module] = true;
+        }
+    }
+    /* one invalid cell voltage, so that the validity is evaluated */
+    bench_cellVoltage.invalidCellVoltage[0u][0u] = 1u;
+    bench_cellVoltage.nrValidCellVoltages[0u]--;
+    const STD_RETURN_TYPE_e cellVoltagesWritten = DATA_WRITE_DATA(&bench_cellVoltage);
+    FAS_ASSERT(cellVoltagesWritten == STD_OK);
+}
+
+static void BENCH_RunDataRead(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        const STD_RETURN_TYPE_e cellVoltagesRead = DATA_READ_DATA(&bench_cellVoltage);
+        FAS_ASSERT(cellVoltagesRead == STD_OK);
+    }
+}
+
+static void BENCH_RunDataWrite(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        const STD_RETURN_TYPE_e cellVoltagesWritten = DATA_WRITE_DATA(&bench_cellVoltage);
+        FAS_ASSERT(cellVoltagesWritten == STD_OK);
+    }
+}
+
+static void BENCH_RunMrcCellVoltageMinMaxAverage(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        bench_sink = (uint32_t)TEST_MRC_CalculateCellVoltageMinMaxAverage(&bench_cellVoltage, &bench_minMax);
+    }
+}
+
+static void BENCH_InitializeAdcVoltages(void) {
+    for (uint16_t i = 0u; i < BENCH_NUMBER_OF_ADC_VOLTAGES; i++) {
+        /* visits the table entries in a scattered order */
+        const uint16_t step     = (uint16_t)((i * 41u) % BENCH_NUMBER_OF_ADC_VOLTAGES);
+        bench_adcVoltages_mV[i] = (uint16_t)(step * (BENCH_MAXIMUM_ADC_VOLTAGE_mV / BENCH_NUMBER_OF_ADC_VOLTAGES));
+    }
+}
+
+static void BENCH_RunTsEpc00Lut(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        bench_sink = (uint32_t)TS_Epc00GetTemperatureFromLut(bench_adcVoltages_mV[call % BENCH_NUMBER_OF_ADC_VOLTAGES]);
+    }
+}
+
+static void BENCH_RunTsEpc01Lut(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        bench_sink = (uint32_t)TS_Epc01GetTemperatureFromLut(bench_adcVoltages_mV[call % BENCH_NUMBER_OF_ADC_VOLTAGES]);
+    }
+}
+
+static void BENCH_RunTsVis00Lut(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        bench_sink = (uint32_t)TS_Vis00GetTemperatureFromLut(bench_adcVoltages_mV[call % BENCH_NUMBER_OF_ADC_VOLTAGES]);
+    }
+}
+
+static void BENCH_RunAlgoMovAverage(uint32_t numberOfCalls) {
+    for (uint32_t call = 0u; call < numberOfCalls; call++) {
+        for (uint8_t stringNumber = 0u; stringNumber < BS_NR_OF_STRINGS; stringNumber++) {
+            bench_currentSensor.current_mA[stringNumber] = (int32_t)(call % 20000u) - 10000;
+            bench_currentSensor.power_W[stringNumber]    = (int32_t)(call % 4000u) - 2000;
+        }
+        bench_currentSensor.newCurrent++;
+        bench_currentSensor.newPower++;
+        const STD_RETURN_TYPE_e currentSensorWritten = DATA_WRITE_DATA(&bench_currentSensor);
+        FAS_ASSERT(currentSensorWritten == STD_OK);
+        ALGO_MovAverage();
+    }
+}
+
+/*========== Extern Constant and Variable Definitions =======================*/
+const BENCH_KERNEL_s bench_kernels[] = {
+    {"LTC_pec15_calc", &BENCH_InitializeLtcPec, &BENCH_RunLtcPec},
+    {"N775_CrcAddItems", &BENCH_InitializeN775Crc, &BENCH_RunN775Crc},
+    {"MXM_CRC8", &BENCH_InitializeMxmReadall, &BENCH_RunMxmCrc8},
+    {"MXM_ParseVoltageReadall", &BENCH_InitializeMxmReadall, &BENCH_RunMxmParseVoltageReadall},
+    {"CAN_PackFoxbmsCellVoltage", &BENCH_InitializeCanCellVoltage, &BENCH_RunCanPackCellVoltage},
+    {"DIAG_Handler", NULL_PTR, &BENCH_RunDiagHandler},
+    {"DATA_READ_DATA", &BENCH_InitializeCellVoltages, &BENCH_RunDataRead},
+    {"DATA_WRITE_DATA", &BENCH_InitializeCellVoltages, &BENCH_RunDataWrite},
+    {"TS_Epc00GetTemperatureFromLut", &BENCH_InitializeAdcVoltages, &BENCH_RunTsEpc00Lut},
+    {"TS_Epc01GetTemperatureFromLut", &BENCH_InitializeAdcVoltages, &BENCH_RunTsEpc01Lut},
+    {"TS_Vis00GetTemperatureFromLut", &BENCH_InitializeAdcVoltages, &BENCH_RunTsVis00Lut},
+    {"ALGO_MovAverage", NULL_PTR, &BENCH_RunAlgoMovAverage},
+    {"MRC_CalculateCellVoltageMinMaxAverage", &BENCH_InitializeCellVoltages, &BENCH_RunMrcCellVoltageMinMaxAverage},
+};
+
+const uint8_t bench_numberOfKernels = (uint8_t)(sizeof(bench_kernels) / sizeof(BENCH_KERNEL_s));
+
+/*========== Extern Function Implementations ================================*/
+void BENCH_InitializeApplication(void) {
+    const STD_RETURN_TYPE_e databaseInitialized = DATA_Init();
+    FAS_ASSERT(databaseInitialized == STD_OK);
+    /* the database task processes every access right after it has been queued,
+       as it preempts the caller on the target */
+    REPLAY_SetQueueReceiver(NULL_PTR, &DATA_Task);
+    const STD_RETURN_TYPE_e diagnosisInitialized = DIAG_Initialize(&diag_device);
+    FAS_ASSERT(diagnosisInitialized == STD_OK);
+    const STD_RETURN_TYPE_e movingAverageInitialized = ALGO_InitializeMovingAverage();
+    FAS_ASSERT(movingAverageInitialized == STD_OK);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
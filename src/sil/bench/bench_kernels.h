@@ -0,0 +1,92 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    bench_kernels.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  BENCH
+ *
+ * @brief   Kernels of the micro-benchmark of foxBMS
+ *
+ * @details The kernels are the functions of the application that are executed most often
+ *          or with the largest inputs. Every kernel prepares its input once and then calls
+ *          the measured function in a loop. The kernels only use the interfaces of the
+ *          application, the time measurement is done by the caller, so that the same table
+ *          can be measured on the host and on the target.
+ *
+ */
+
+#ifndef FOXBMS__BENCH_KERNELS_H_
+#define FOXBMS__BENCH_KERNELS_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+/*========== Macros and Definitions =========================================*/
+/** kernel of the micro-benchmark */
+typedef struct BENCH_KERNEL {
+    const char *pName;                    /*!< name of the kernel, the measured function */
+    void (*pInitialize)(void);            /*!< prepares the input of the kernel, NULL_PTR if not needed */
+    void (*pRun)(uint32_t numberOfCalls); /*!< calls the measured function numberOfCalls times */
+} BENCH_KERNEL_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** kernels of the micro-benchmark */
+extern const BENCH_KERNEL_s bench_kernels[];
+
+/** number of entries in #bench_kernels */
+extern const uint8_t bench_numberOfKernels;
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Initializes the parts of the application that the kernels use.
+ * @details Initializes the database, the diagnosis module and the moving
+ *          average. Has to be called once before the first kernel is
+ *          initialized.
+ */
+extern void BENCH_InitializeApplication(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__BENCH_KERNELS_H_ */
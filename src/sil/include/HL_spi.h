@@ -0,0 +1,142 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    HL_spi.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  NONE
+ *
+ * @brief   SPI driver of the HALCoGen HAL for the software-in-the-loop build
+ *
+ * @details Replaces the HALCoGen generated header of the same name on the host.
+ *          The transfers are answered by the device models of sil_spi.c.
+ *
+ */
+
+#ifndef FOXBMS__HL_SPI_H_
+#define FOXBMS__HL_SPI_H_
+
+/*========== Includes =======================================================*/
+#include "HL_sys_common.h"
+
+/*========== Macros and Definitions =========================================*/
+/** number of SPI nodes */
+#define SIL_SPI_NR_OF_NODES (5u)
+
+/** simulated register set of a SPI node */
+typedef volatile struct spiBase {
+    uint32 GCR1; /*!< global control register 1 */
+    uint32 INT0; /*!< interrupt register */
+    uint32 PC3;  /*!< pin data out register (used for software chip selects) */
+    uint32 DAT1; /*!< transmit data register */
+    uint32 BUF;  /*!< receive buffer register */
+    uint32 FMT0; /*!< data format register 0 */
+    uint32 FMT1; /*!< data format register 1 */
+    uint32 FMT2; /*!< data format register 2 */
+    uint32 FMT3; /*!< data format register 3 */
+} spiBASE_t;
+
+/** data formats */
+typedef enum dataformat {
+    SPI_FMT_0 = 0u, /*!< data format 0 */
+    SPI_FMT_1 = 1u, /*!< data format 1 */
+    SPI_FMT_2 = 2u, /*!< data format 2 */
+    SPI_FMT_3 = 3u, /*!< data format 3 */
+} SPIDATAFMT_t;
+
+/** transfer configuration */
+typedef struct spiDAT1RegConfig {
+    boolean CS_HOLD;    /*!< hold the chip select between words */
+    boolean WDEL;       /*!< insert a delay between words */
+    SPIDATAFMT_t DFSEL; /*!< data format */
+    uint8 CSNR;         /*!< hardware chip select */
+} spiDAT1_t;
+
+/** @{
+ * simulated SPI nodes
+ */
+#define spiREG1 (&sil_spiRegisters[0u])
+#define spiREG2 (&sil_spiRegisters[1u])
+#define spiREG3 (&sil_spiRegisters[2u])
+#define spiREG4 (&sil_spiRegisters[3u])
+#define spiREG5 (&sil_spiRegisters[4u])
+/** @} */
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** register sets of the simulated SPI nodes */
+extern spiBASE_t sil_spiRegisters[SIL_SPI_NR_OF_NODES];
+
+/*========== Extern Function Prototypes =====================================*/
+/** initializes the SPI nodes */
+extern void spiInit(void);
+
+/**
+ * @brief   transmits words, the received words are discarded
+ * @param   spi         SPI node
+ * @param   dataconfig  transfer configuration
+ * @param   blocksize   number of words
+ * @param   srcbuff     words to transmit
+ * @return  0 (no error)
+ */
+extern uint32 spiTransmitData(spiBASE_t *spi, spiDAT1_t *dataconfig, uint32 blocksize, uint16 *srcbuff);
+
+/**
+ * @brief   transmits and receives words
+ * @param   spi         SPI node
+ * @param   dataconfig  transfer configuration
+ * @param   blocksize   number of words
+ * @param   srcbuff     words to transmit
+ * @param   destbuff    received words
+ * @return  0 (no error)
+ */
+extern uint32 spiTransmitAndReceiveData(
+    spiBASE_t *spi,
+    spiDAT1_t *dataconfig,
+    uint32 blocksize,
+    uint16 *srcbuff,
+    uint16 *destbuff);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__HL_SPI_H_ */
@@ -0,0 +1,277 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    HL_sys_dma.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  NONE
+ *
+ * @brief   DMA driver of the HALCoGen HAL for the software-in-the-loop build
+ *
+ * @details Replaces the HALCoGen generated header of the same name on the host.
+ *          Pending transfers are carried out by sil_spi.c in the tick of the
+ *          simulation.
+ *
+ */
+
+#ifndef FOXBMS__HL_SYS_DMA_H_
+#define FOXBMS__HL_SYS_DMA_H_
+
+/*========== Includes =======================================================*/
+#include "HL_sys_common.h"
+
+/*========== Macros and Definitions =========================================*/
+/** number of DMA channels */
+#define SIL_DMA_NR_OF_CHANNELS (32u)
+
+/** DMA channel */
+typedef uint32 dmaChannel_t;
+/** DMA request line */
+typedef uint32 dmaRequest_t;
+/** DMA interrupt type */
+typedef uint32 dmaInterrupt_t;
+/** DMA interrupt group */
+typedef uint32 dmaIntGroup_t;
+/** DMA trigger type */
+typedef uint32 dmaTriggerType_t;
+
+/** @{
+ * DMA channels
+ */
+#define DMA_CH0  (0u)
+#define DMA_CH1  (1u)
+#define DMA_CH2  (2u)
+#define DMA_CH3  (3u)
+#define DMA_CH4  (4u)
+#define DMA_CH5  (5u)
+#define DMA_CH6  (6u)
+#define DMA_CH7  (7u)
+#define DMA_CH8  (8u)
+#define DMA_CH9  (9u)
+#define DMA_CH10 (10u)
+#define DMA_CH11 (11u)
+#define DMA_CH12 (12u)
+#define DMA_CH13 (13u)
+#define DMA_CH14 (14u)
+#define DMA_CH15 (15u)
+#define DMA_CH16 (16u)
+#define DMA_CH17 (17u)
+#define DMA_CH18 (18u)
+#define DMA_CH19 (19u)
+#define DMA_CH20 (20u)
+#define DMA_CH21 (21u)
+#define DMA_CH22 (22u)
+#define DMA_CH23 (23u)
+#define DMA_CH24 (24u)
+#define DMA_CH25 (25u)
+#define DMA_CH26 (26u)
+#define DMA_CH27 (27u)
+#define DMA_CH28 (28u)
+#define DMA_CH29 (29u)
+#define DMA_CH30 (30u)
+#define DMA_CH31 (31u)
+/** @} */
+
+/** @{
+ * DMA request lines
+ */
+#define DMA_REQ0  (0u)
+#define DMA_REQ1  (1u)
+#define DMA_REQ2  (2u)
+#define DMA_REQ3  (3u)
+#define DMA_REQ4  (4u)
+#define DMA_REQ5  (5u)
+#define DMA_REQ6  (6u)
+#define DMA_REQ7  (7u)
+#define DMA_REQ8  (8u)
+#define DMA_REQ9  (9u)
+#define DMA_REQ10 (10u)
+#define DMA_REQ11 (11u)
+#define DMA_REQ12 (12u)
+#define DMA_REQ13 (13u)
+#define DMA_REQ14 (14u)
+#define DMA_REQ15 (15u)
+#define DMA_REQ16 (16u)
+#define DMA_REQ17 (17u)
+#define DMA_REQ18 (18u)
+#define DMA_REQ19 (19u)
+#define DMA_REQ20 (20u)
+#define DMA_REQ21 (21u)
+#define DMA_REQ22 (22u)
+#define DMA_REQ23 (23u)
+#define DMA_REQ24 (24u)
+#define DMA_REQ25 (25u)
+#define DMA_REQ26 (26u)
+#define DMA_REQ27 (27u)
+#define DMA_REQ28 (28u)
+#define DMA_REQ29 (29u)
+#define DMA_REQ30 (30u)
+#define DMA_REQ31 (31u)
+#define DMA_REQ32 (32u)
+#define DMA_REQ33 (33u)
+#define DMA_REQ34 (34u)
+#define DMA_REQ35 (35u)
+#define DMA_REQ36 (36u)
+#define DMA_REQ37 (37u)
+#define DMA_REQ38 (38u)
+#define DMA_REQ39 (39u)
+#define DMA_REQ40 (40u)
+#define DMA_REQ41 (41u)
+#define DMA_REQ42 (42u)
+#define DMA_REQ43 (43u)
+#define DMA_REQ44 (44u)
+#define DMA_REQ45 (45u)
+#define DMA_REQ46 (46u)
+#define DMA_REQ47 (47u)
+/** @} */
+
+/** @{
+ * control packet values
+ */
+#define PORTA_READ_PORTB_WRITE (1u)
+#define PORTB_READ_PORTA_WRITE (4u)
+#define ACCESS_8_BIT           (0u)
+#define ACCESS_16_BIT          (1u)
+#define FRAME_TRANSFER         (0u)
+#define ADDR_FIXED             (0u)
+#define ADDR_INC1              (1u)
+#define AUTOINIT_OFF           (0u)
+/** @} */
+
+/** @{
+ * interrupts and triggers
+ */
+#define BTC      (3u)
+#define DMA_INTA (0u)
+#define DMA_HW   (0u)
+/** @} */
+
+/** DMA control packet */
+typedef struct dmaCTRLPKT {
+    uint32 SADD;      /*!< source address */
+    uint32 DADD;      /*!< destination address */
+    uint32 CHCTRL;    /*!< channel chain control */
+    uint32 FRCNT;     /*!< frame count */
+    uint32 ELCNT;     /*!< element count */
+    uint32 ELDOFFSET; /*!< element destination offset */
+    uint32 ELSOFFSET; /*!< element source offset */
+    uint32 FRDOFFSET; /*!< frame destination offset */
+    uint32 FRSOFFSET; /*!< frame source offset */
+    uint32 PORTASGN;  /*!< port assignment */
+    uint32 RDSIZE;    /*!< read size */
+    uint32 WRSIZE;    /*!< write size */
+    uint32 TTYPE;     /*!< transfer type */
+    uint32 ADDMODERD; /*!< address mode read */
+    uint32 ADDMODEWR; /*!< address mode write */
+    uint32 AUTOINIT;  /*!< auto initialization */
+} g_dmaCTRL;
+
+/** primary control packet in the DMA RAM */
+typedef volatile struct {
+    uint32 ISADDR;  /*!< initial source address */
+    uint32 IDADDR;  /*!< initial destination address */
+    uint32 ITCOUNT; /*!< initial transfer count (frames in bits 31 to 16) */
+    uint32 rsvd1;   /*!< reserved */
+    uint32 CHCTRL;  /*!< channel control */
+    uint32 EIOFF;   /*!< element index offset */
+    uint32 FIOFF;   /*!< frame index offset */
+    uint32 rsvd2;   /*!< reserved */
+} dmaPCP_t;
+
+/** simulated DMA RAM */
+typedef volatile struct dmaRamBase {
+    dmaPCP_t PCP[SIL_DMA_NR_OF_CHANNELS]; /*!< primary control packets */
+} dmaRAMBASE_t;
+
+/** simulated DMA RAM */
+#define dmaRAMREG (&sil_dmaRam)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** simulated DMA RAM */
+extern dmaRAMBASE_t sil_dmaRam;
+
+/*========== Extern Function Prototypes =====================================*/
+/** enables the DMA */
+extern void dmaEnable(void);
+
+/**
+ * @brief   assigns a request line to a channel
+ * @param   channel     DMA channel
+ * @param   reqline     request line
+ */
+extern void dmaReqAssign(dmaChannel_t channel, dmaRequest_t reqline);
+
+/**
+ * @brief   writes the control packet of a channel
+ * @param   channel         DMA channel
+ * @param   g_dmaCTRLPKT    control packet
+ */
+extern void dmaSetCtrlPacket(dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT);
+
+/**
+ * @brief   enables a channel
+ * @param   channel     DMA channel
+ * @param   type        trigger type
+ */
+extern void dmaSetChEnable(dmaChannel_t channel, dmaTriggerType_t type);
+
+/**
+ * @brief   enables an interrupt of a channel
+ * @param   channel     DMA channel
+ * @param   inttype     interrupt type
+ * @param   group       interrupt group
+ */
+extern void dmaEnableInterrupt(dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group);
+
+/**
+ * @brief   notification of a completed transfer
+ * @details Implemented by the application, called by sil_spi.c.
+ * @param   inttype     interrupt type
+ * @param   channel     DMA channel
+ */
+extern void dmaGroupANotification(dmaInterrupt_t inttype, uint32 channel);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__HL_SYS_DMA_H_ */
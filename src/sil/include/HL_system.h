@@ -0,0 +1,106 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    HL_system.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  NONE
+ *
+ * @brief   System module of the HALCoGen HAL for the software-in-the-loop build
+ *
+ * @details Replaces the HALCoGen generated header of the same name on the host.
+ *
+ */
+
+#ifndef FOXBMS__HL_SYSTEM_H_
+#define FOXBMS__HL_SYSTEM_H_
+
+/*========== Includes =======================================================*/
+#include "HL_sys_common.h"
+
+/*========== Macros and Definitions =========================================*/
+/** CPU clock (GCLK) of the target in MHz */
+#define GCLK_FREQ (300.000f)
+
+/** peripheral clock (AVCLK1) of the target in MHz */
+#define AVCLK1_FREQ (75.000f)
+
+/** simulated system register frame 1 */
+typedef volatile struct systemBase1 {
+    uint32 SYSPC1; /*!< ECLK pin control */
+    uint32 SYSPC4; /*!< ECLK data out (nERROR pin of the safety path) */
+} systemBASE1_t;
+
+/** simulated system register frame 1 */
+#define systemREG1 (&sil_systemRegisters)
+
+/** reset sources */
+typedef enum {
+    NO_RESET           = 0u,      /*!< no reset flag set */
+    POWERON_RESET      = 0x8000u, /*!< power-on reset */
+    OSC_FAILURE_RESET  = 0x4000u, /*!< oscillator failure */
+    WATCHDOG_RESET     = 0x2000u, /*!< watchdog reset */
+    WATCHDOG2_RESET    = 0x1000u, /*!< second watchdog reset */
+    DEBUG_RESET        = 0x0800u, /*!< debug reset */
+    INTERCONNECT_RESET = 0x0080u, /*!< interconnect reset */
+    CPU0_RESET         = 0x0020u, /*!< CPU reset */
+    SW_RESET           = 0x0010u, /*!< software reset */
+    EXT_RESET          = 0x0008u, /*!< external reset */
+} resetSource_t;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** simulated system register frame 1 */
+extern systemBASE1_t sil_systemRegisters;
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   returns the source of the last reset
+ * @details The simulation always starts with a power-on reset.
+ * @return  #POWERON_RESET
+ */
+extern resetSource_t getResetSource(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__HL_SYSTEM_H_ */
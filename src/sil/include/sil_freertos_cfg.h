@@ -0,0 +1,107 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil_freertos_cfg.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  NONE
+ *
+ * @brief   FreeRTOS configuration of the software-in-the-loop build
+ *
+ * @details Included at the end of FreeRTOSConfig.h and adapts the configuration of
+ *          the target to the FreeRTOS POSIX port:
+ *          - the tick hook drives the simulated peripherals,
+ *          - tickless idle and the port optimized task selection are not available,
+ *          - the tasks run as threads of the host, which need larger stacks,
+ *          - a failed assertion terminates the simulation instead of halting the CPU.
+ *
+ */
+
+#ifndef FOXBMS__SIL_FREERTOS_CFG_H_
+#define FOXBMS__SIL_FREERTOS_CFG_H_
+
+/*========== Includes =======================================================*/
+
+/*========== Macros and Definitions =========================================*/
+#undef configUSE_TICK_HOOK
+#undef configUSE_TICKLESS_IDLE
+#undef configUSE_PORT_OPTIMISED_TASK_SELECTION
+#undef configMINIMAL_STACK_SIZE
+#undef configTOTAL_HEAP_SIZE
+#undef configASSERT
+
+/** the simulation is driven from #vApplicationTickHook() */
+#define configUSE_TICK_HOOK (1)
+
+/** the POSIX port does not support tickless idle */
+#define configUSE_TICKLESS_IDLE (0)
+
+/** the POSIX port has no optimized task selection */
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION (0)
+
+/** stack depth (in words) of the idle task, has to exceed PTHREAD_STACK_MIN */
+#define configMINIMAL_STACK_SIZE ((unsigned short)4096)
+
+/** heap for the kernel objects, pointers are twice as large on the host */
+#define configTOTAL_HEAP_SIZE ((size_t)65536)
+
+/** terminates the simulation on a failed assertion of the kernel */
+#define configASSERT(x)                \
+    if ((x) == 0) {                    \
+        SIL_Abort(__FILE__, __LINE__); \
+    }
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   terminates the simulation after a failed assertion
+ * @param   pFile   file of the failed assertion
+ * @param   line    line of the failed assertion
+ */
+extern void SIL_Abort(const char *pFile, int line);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__SIL_FREERTOS_CFG_H_ */
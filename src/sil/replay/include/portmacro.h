@@ -0,0 +1,115 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    portmacro.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  NONE
+ *
+ * @brief   Single-threaded FreeRTOS port of the CAN log replay
+ *
+ * @details The replay runs the application without the FreeRTOS kernel: the tasks are
+ *          called one after another by the deterministic scheduler of the replay and the
+ *          kernel functions that are used by the application are implemented in
+ *          replay_kernel.c. This file provides the port specific types and macros that
+ *          the FreeRTOS headers need for this.
+ *
+ */
+
+#ifndef FOXBMS__PORTMACRO_H_
+#define FOXBMS__PORTMACRO_H_
+
+/*========== Includes =======================================================*/
+#include <stdint.h>
+
+/*========== Macros and Definitions =========================================*/
+/* Type definitions, the tick type has the same width as on the target */
+#define portCHAR              char
+#define portFLOAT             float
+#define portDOUBLE            double
+#define portLONG              long
+#define portSHORT             short
+#define portSTACK_TYPE        uint32_t
+#define portBASE_TYPE         long
+#define portPOINTER_SIZE_TYPE uintptr_t
+
+typedef portSTACK_TYPE StackType_t;
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define portMAX_DELAY           ((TickType_t)0xFFFFFFFFu)
+#define portTICK_TYPE_IS_ATOMIC (1)
+
+/* Architecture specifics */
+#define portSTACK_GROWTH    (-1)
+#define portTICK_PERIOD_MS  ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portBYTE_ALIGNMENT  (8)
+#define portNOP()
+#define portMEMORY_BARRIER() __sync_synchronize()
+
+/* Critical sections, tasks and interrupts never preempt each other in the replay */
+extern void vPortEnterCritical(void);
+extern void vPortExitCritical(void);
+#define portENTER_CRITICAL()                   vPortEnterCritical()
+#define portEXIT_CRITICAL()                    vPortExitCritical()
+#define portDISABLE_INTERRUPTS()               vPortEnterCritical()
+#define portENABLE_INTERRUPTS()                vPortExitCritical()
+#define portSET_INTERRUPT_MASK_FROM_ISR()      (0)
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)   ((void)(x))
+#define portYIELD()
+#define portYIELD_FROM_ISR(x)                  ((void)(x))
+#define portEND_SWITCHING_ISR(xSwitchRequired) ((void)(xSwitchRequired))
+
+/* Task function macros */
+#define portTASK_FUNCTION_PROTO(vFunction, pvParameters) void vFunction(void *pvParameters)
+#define portTASK_FUNCTION(vFunction, pvParameters)       void vFunction(void *pvParameters)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__PORTMACRO_H_ */
@@ -0,0 +1,626 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    replay.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  REPLAY
+ *
+ * @brief   Deterministic replay of CAN logs against the foxBMS application
+ *
+ * @details The application is initialized as in main.c. Instead of starting the
+ *          scheduler, the replay calls the user code of the tasks in the order of their
+ *          priorities on a simulated tick counter. The messages of the log are passed to
+ *          the application through the virtual CAN bus at their (relative) time stamps,
+ *          the messages that the application sends are written to a trace, together with
+ *          the state of the BMS, the SOC and the SOF once per period. As nothing depends on
+ *          the host clock, two replays of the same log give the same trace and the replay
+ *          runs as fast as the host executes the application.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "HL_can.h"
+#include "HL_gio.h"
+#include "HL_spi.h"
+#include "HL_sys_core.h"
+#include "HL_system.h"
+
+#include "bms.h"
+#include "can.h"
+#include "checksum.h"
+#include "contactor.h"
+#include "database.h"
+#include "diag.h"
+#include "dma.h"
+#include "ftask.h"
+#include "masterinfo.h"
+#include "mcu.h"
+#include "meas.h"
+#include "os.h"
+#include "replay_kernel.h"
+#include "replay_log.h"
+#include "sil.h"
+#include "sil_can.h"
+#include "sil_fram.h"
+#include "sil_spi.h"
+#include "sps.h"
+#include "sys_mon.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/*========== Macros and Definitions =========================================*/
+/** microseconds per millisecond */
+#define REPLAY_US_PER_MS (1000u)
+
+/** simulated time after the last message of the log in ms */
+#define REPLAY_DEFAULT_TAIL_ms (1000u)
+
+/** period of the state of the application in the trace if no snapshots are written */
+#define REPLAY_DEFAULT_STATE_PERIOD_ms (1000u)
+
+/** longest line with the state of the application in the trace */
+#define REPLAY_STATE_LENGTH (256u)
+
+/** template of the file that backs the FRAM if no file is given */
+#define REPLAY_FRAM_FILE_TEMPLATE "/tmp/foxbms-replay-fram-XXXXXX"
+
+/** number of tasks of the application */
+#define REPLAY_NUMBER_OF_TASKS (5u)
+
+/** number of standard identifiers */
+#define REPLAY_NUMBER_OF_IDS (0x800u)
+
+/** options of the replay */
+typedef struct REPLAY_OPTIONS {
+    const char *pLogFile;   /*!< CAN log that is replayed, "-" for the standard input */
+    const char *pTraceFile; /*!< trace of the sent messages, "-" for the standard output */
+    const char *pFramFile;  /*!< file that backs the FRAM or NULL_PTR for an empty FRAM */
+    uint32_t offset_ms;     /*!< simulated time of the first message of the log */
+    uint32_t tail_ms;       /*!< simulated time after the last message of the log */
+    uint32_t duration_ms;   /*!< largest simulated time, 0 for no limit */
+    uint32_t snapshot_ms;   /*!< period of the snapshots of the trace, 0 for every message */
+    bool isRxTraced;        /*!< true if the received messages are written to the trace */
+} REPLAY_OPTIONS_s;
+
+/** task of the application that is called by the scheduler of the replay */
+typedef struct REPLAY_TASK {
+    const char *pName;                       /*!< name of the task */
+    const OS_TASK_DEFINITION_s *pDefinition; /*!< phase and cycle time of the task */
+    void (*pUserCode)(void);                 /*!< user code of the task */
+    SYSM_TASK_ID_e taskId;                   /*!< task in the system monitoring */
+    TaskHandle_t handle;                     /*!< control block in the kernel of the replay */
+    uint32_t wakeTime;                       /*!< tick of the next call */
+} REPLAY_TASK_s;
+
+/** counters of the replay */
+typedef struct REPLAY_STATISTICS {
+    uint32_t readMessages;     /*!< messages read from the log */
+    uint32_t injectedMessages; /*!< messages passed to the application */
+    uint32_t ignoredMessages;  /*!< messages without receive handler in the application */
+    uint32_t droppedMessages;  /*!< messages that did not fit into the receive queue */
+} REPLAY_STATISTICS_s;
+
+/** last message of every identifier in the current period of the snapshots */
+typedef struct REPLAY_SNAPSHOT {
+    SIL_CAN_MESSAGE_s rxMessages[REPLAY_NUMBER_OF_IDS]; /*!< last received message of every identifier */
+    SIL_CAN_MESSAGE_s txMessages[REPLAY_NUMBER_OF_IDS]; /*!< last sent message of every identifier */
+    bool isRxValid[REPLAY_NUMBER_OF_IDS];               /*!< true if the identifier has been received */
+    bool isTxValid[REPLAY_NUMBER_OF_IDS];               /*!< true if the identifier has been sent */
+} REPLAY_SNAPSHOT_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** options of the replay */
+static REPLAY_OPTIONS_s replay_options = {
+    .pLogFile    = NULL_PTR,
+    .pTraceFile  = "-",
+    .pFramFile   = NULL_PTR,
+    .offset_ms   = 0u,
+    .tail_ms     = REPLAY_DEFAULT_TAIL_ms,
+    .duration_ms = 0u,
+    .snapshot_ms = 0u,
+    .isRxTraced  = false,
+};
+
+/** tasks in the order of their priorities, the engine task first */
+static REPLAY_TASK_s replay_tasks[REPLAY_NUMBER_OF_TASKS] = {
+    {"Engine", &ftsk_taskDefinitionEngine, &FTSK_UserCodeEngine, SYSM_TASK_ID_ENGINE, NULL, 0u},
+    {"Cyclic1ms", &ftsk_taskDefinitionCyclic1ms, &FTSK_UserCodeCyclic1ms, SYSM_TASK_ID_CYCLIC_1ms, NULL, 0u},
+    {"Cyclic10ms", &ftsk_taskDefinitionCyclic10ms, &FTSK_UserCodeCyclic10ms, SYSM_TASK_ID_CYCLIC_10ms, NULL, 0u},
+    {"Cyclic100ms", &ftsk_taskDefinitionCyclic100ms, &FTSK_UserCodeCyclic100ms, SYSM_TASK_ID_CYCLIC_100ms, NULL, 0u},
+    {"CyclicAlgorithm100ms",
+     &ftsk_taskDefinitionCyclicAlgorithm100ms,
+     &FTSK_UserCodeCyclicAlgorithm100ms,
+     SYSM_TASK_ID_CYCLIC_ALGORITHM_100ms,
+     NULL,
+     0u},
+};
+
+/** replayed CAN log */
+static REPLAY_LOG_s replay_log = {0};
+
+/** written CAN trace */
+static REPLAY_TRACE_s replay_trace = {0};
+
+/** receive messages of the application, to skip messages that it does not handle */
+static CAN_RX_DISPATCH_TABLE_s replay_rxDispatchTable = {0};
+
+/** counters of the replay */
+static REPLAY_STATISTICS_s replay_statistics = {0u, 0u, 0u, 0u};
+
+/** messages of the current period of the snapshots */
+static REPLAY_SNAPSHOT_s replay_snapshot = {0};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Prints the usage of the replay.
+ * @param   pProgram    name of the program
+ */
+static void REPLAY_PrintUsage(const char *pProgram);
+
+/**
+ * @brief   Parses a time in ms of the command line.
+ * @param   pValue  value of the option
+ * @param   pTime   parsed time
+ * @return  #STD_OK if the value is a valid time, #STD_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e REPLAY_ParseTime(const char *pValue, uint32_t *pTime);
+
+/**
+ * @brief   Parses the command line.
+ * @param   argc    number of arguments
+ * @param   argv    arguments
+ * @return  #STD_OK if the command line is valid, #STD_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e REPLAY_ParseOptions(int argc, char *argv[]);
+
+/**
+ * @brief   Maps the FRAM to the given file or to an empty temporary file.
+ * @details The temporary file is removed right away, so that every replay
+ *          starts with the same (empty) FRAM.
+ */
+static void REPLAY_InitializeFram(void);
+
+/**
+ * @brief   Initializes the application as main() does before it starts the
+ *          scheduler and runs the initialization of the tasks.
+ */
+static void REPLAY_InitializeApplication(void);
+
+/**
+ * @brief   Writes a message to the trace or keeps it for the next snapshot.
+ * @param   pMessage    received or sent message
+ * @param   tick        simulated time
+ * @param   isTx        true if the application sent the message
+ */
+static void REPLAY_TraceMessage(const SIL_CAN_MESSAGE_s *pMessage, TickType_t tick, bool isTx);
+
+/**
+ * @brief   Writes a message that the application sends to the trace.
+ * @param   pMessage    the sent message
+ */
+static void REPLAY_TraceTxMessage(const SIL_CAN_MESSAGE_s *pMessage);
+
+/**
+ * @brief   Writes the last message of every identifier of the current period
+ *          to the trace and starts the next period.
+ * @param   tick    simulated time of the snapshot
+ */
+static void REPLAY_WriteSnapshot(TickType_t tick);
+
+/**
+ * @brief   Writes the state of the BMS, the SOC and the SOF and the time of
+ *          the last measurement of the cell voltages as comment to the trace.
+ * @details The database is read like by a task of the application.
+ * @param   tick    simulated time of the state
+ */
+static void REPLAY_TraceState(TickType_t tick);
+
+/**
+ * @brief   Passes a message of the log to the application.
+ * @param   pMessage    message of the log
+ * @param   tick        simulated time
+ */
+static void REPLAY_InjectMessage(const SIL_CAN_MESSAGE_s *pMessage, TickType_t tick);
+
+/**
+ * @brief   Calls the tasks that are due in this tick in the order of their
+ *          priorities.
+ * @param   tick    simulated time
+ */
+static void REPLAY_RunTasks(TickType_t tick);
+
+/**
+ * @brief   Closes the log and the trace when the replay exits.
+ */
+static void REPLAY_CloseFiles(void);
+
+/**
+ * @brief   Returns the host time.
+ * @return  monotonic host time in ns
+ */
+static uint64_t REPLAY_GetHostTime_ns(void);
+
+/*========== Static Function Implementations ================================*/
+static void REPLAY_PrintUsage(const char *pProgram) {
+    (void)fprintf(
+        stderr,
+        "usage: %s [-o trace] [-f fram] [-b offset_ms] [-t tail_ms] [-d duration_ms] [-s period_ms] [-r] log\n"
+        "  log             PCAN-View trace or CAN log of the foxBMS GUI, '-' reads the standard input\n"
+        "  -o trace        trace of the sent messages (default: '-', the standard output)\n"
+        "  -f fram         file that backs the FRAM (default: an empty FRAM)\n"
+        "  -b offset_ms    simulated time of the first message (default: 0)\n"
+        "  -t tail_ms      simulated time after the last message (default: %u)\n"
+        "  -d duration_ms  stop after this simulated time (default: end of the log and tail)\n"
+        "  -s period_ms    write only the last message of every identifier once per period\n"
+        "  -r              write the received messages to the trace, too\n",
+        pProgram,
+        REPLAY_DEFAULT_TAIL_ms);
+}
+
+static STD_RETURN_TYPE_e REPLAY_ParseTime(const char *pValue, uint32_t *pTime) {
+    STD_RETURN_TYPE_e retVal  = STD_NOT_OK;
+    char *pEnd                = NULL_PTR;
+    errno                     = 0;
+    const unsigned long value = strtoul(pValue, &pEnd, 10);
+    if ((pEnd != pValue) && (*pEnd == '\0') && (errno == 0) && (value <= UINT32_MAX) && (pValue[0] != '-')) {
+        *pTime = (uint32_t)value;
+        retVal = STD_OK;
+    }
+    return retVal;
+}
+
+static STD_RETURN_TYPE_e REPLAY_ParseOptions(int argc, char *argv[]) {
+    STD_RETURN_TYPE_e retVal = STD_OK;
+    int option               = 0;
+    while ((retVal == STD_OK) && ((option = getopt(argc, argv, "o:f:b:t:d:s:r")) != -1)) {
+        switch (option) {
+            case 'o':
+                replay_options.pTraceFile = optarg;
+                break;
+            case 'f':
+                replay_options.pFramFile = optarg;
+                break;
+            case 'b':
+                retVal = REPLAY_ParseTime(optarg, &replay_options.offset_ms);
+                break;
+            case 't':
+                retVal = REPLAY_ParseTime(optarg, &replay_options.tail_ms);
+                break;
+            case 'd':
+                retVal = REPLAY_ParseTime(optarg, &replay_options.duration_ms);
+                break;
+            case 's':
+                retVal = REPLAY_ParseTime(optarg, &replay_options.snapshot_ms);
+                break;
+            case 'r':
+                replay_options.isRxTraced = true;
+                break;
+            default:
+                retVal = STD_NOT_OK;
+                break;
+        }
+    }
+    if ((retVal == STD_OK) && (optind == (argc - 1))) {
+        replay_options.pLogFile = argv[optind];
+    } else {
+        retVal = STD_NOT_OK;
+    }
+    return retVal;
+}
+
+static void REPLAY_InitializeFram(void) {
+    if (replay_options.pFramFile != NULL_PTR) {
+        SIL_FramInitialize(replay_options.pFramFile);
+    } else {
+        char framFile[] = REPLAY_FRAM_FILE_TEMPLATE;
+        const int file  = mkstemp(framFile);
+        if (file < 0) {
+            (void)fprintf(stderr, "foxBMS replay: no temporary FRAM file (%s)\n", strerror(errno));
+            SIL_Exit(EXIT_FAILURE);
+        }
+        (void)close(file);
+        SIL_FramInitialize(framFile);
+        (void)unlink(framFile);
+    }
+}
+
+static void REPLAY_InitializeApplication(void) {
+    /* main() */
+    MINFO_SetResetSource(getResetSource());
+    _enable_IRQ_interrupt_();
+    MCU_InitializeCycleCounter();
+    gioInit();
+    canInit();
+    spiInit();
+    CONT_Initialize();
+    SPS_Initialize();
+    MEAS_Initialize();
+    DMA_Initialize();
+    DIAG_Initialize(&diag_device);
+    CAN_Initialize();
+
+    /* OS_InitializeTasks(), the tasks are created by the replay */
+    os_boot = OS_CREATE_QUEUES;
+    FTSK_CreateQueues();
+    os_boot = OS_CREATE_MUTEX;
+    FTSK_CreateMutexes();
+    os_boot = OS_CREATE_EVENT;
+    FTSK_CreateEvents();
+    os_boot = OS_CREATE_TASKS;
+    for (uint8_t i = 0u; i < REPLAY_NUMBER_OF_TASKS; i++) {
+        replay_tasks[i].handle   = REPLAY_CreateTask(replay_tasks[i].pName);
+        replay_tasks[i].wakeTime = replay_tasks[i].pDefinition->phase;
+    }
+    /* the engine task waits for the messages of the database queue */
+    REPLAY_SetQueueReceiver(replay_tasks[0u].handle, &DATA_Task);
+    os_boot = OS_INIT_PRE_OS;
+
+    if (STD_OK != CHK_ValidateChecksum()) {
+        if (DIAG_HANDLER_RETURN_OK != DIAG_Handler(DIAG_ID_FLASHCHECKSUM, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u)) {
+            (void)fprintf(stderr, "foxBMS replay: checksum not valid\n");
+            SIL_Exit(EXIT_FAILURE);
+        }
+    }
+    os_schedulerStartTime = OS_GetTickCount();
+
+    /* initialization of the engine task and of the cyclic 1 ms task before their phases */
+    REPLAY_SetCurrentTask(replay_tasks[0u].handle);
+    os_boot = OS_SCHEDULER_RUNNING;
+    FTSK_UserCodeEngineInit();
+    os_boot = OS_ENGINE_RUNNING;
+    REPLAY_SetCurrentTask(replay_tasks[1u].handle);
+    FTSK_UserCodePreCyclicTasksInitialization();
+    os_boot = OS_PRECYCLIC_INIT_HAS_FINISHED;
+    REPLAY_SetCurrentTask(NULL);
+}
+
+static void REPLAY_TraceMessage(const SIL_CAN_MESSAGE_s *pMessage, TickType_t tick, bool isTx) {
+    FAS_ASSERT(pMessage->id < REPLAY_NUMBER_OF_IDS);
+    if (replay_options.snapshot_ms == 0u) {
+        REPLAY_WriteTraceFrame(&replay_trace, (uint64_t)tick * REPLAY_US_PER_MS, pMessage, isTx);
+    } else if (isTx == true) {
+        replay_snapshot.txMessages[pMessage->id] = *pMessage;
+        replay_snapshot.isTxValid[pMessage->id]  = true;
+    } else {
+        replay_snapshot.rxMessages[pMessage->id] = *pMessage;
+        replay_snapshot.isRxValid[pMessage->id]  = true;
+    }
+}
+
+static void REPLAY_TraceTxMessage(const SIL_CAN_MESSAGE_s *pMessage) {
+    REPLAY_TraceMessage(pMessage, OS_GetTickCount(), true);
+}
+
+static void REPLAY_WriteSnapshot(TickType_t tick) {
+    const uint64_t timestamp_us = (uint64_t)tick * REPLAY_US_PER_MS;
+    for (uint32_t id = 0u; id < REPLAY_NUMBER_OF_IDS; id++) {
+        if (replay_snapshot.isRxValid[id] == true) {
+            REPLAY_WriteTraceFrame(&replay_trace, timestamp_us, &replay_snapshot.rxMessages[id], false);
+            replay_snapshot.isRxValid[id] = false;
+        }
+        if (replay_snapshot.isTxValid[id] == true) {
+            REPLAY_WriteTraceFrame(&replay_trace, timestamp_us, &replay_snapshot.txMessages[id], true);
+            replay_snapshot.isTxValid[id] = false;
+        }
+    }
+}
+
+static void REPLAY_TraceState(TickType_t tick) {
+    DATA_BLOCK_CELL_VOLTAGE_s cellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    DATA_BLOCK_SOX_s sox                  = {.header.uniqueId = DATA_BLOCK_ID_SOX};
+    DATA_BLOCK_SOF_s sof                  = {.header.uniqueId = DATA_BLOCK_ID_SOF};
+    const STD_RETURN_TYPE_e stateRead     = DATA_READ_DATA(&cellVoltage, &sox, &sof);
+    FAS_ASSERT(stateRead == STD_OK);
+
+    char state[REPLAY_STATE_LENGTH] = {0};
+    int length                      = snprintf(
+        state, sizeof(state), "State %u ms: BMS %u, SOC", (unsigned int)tick, (unsigned int)BMS_GetState());
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        length += snprintf(&state[length], sizeof(state) - (size_t)length, " %.2f", sox.averageSoc_perc[s]);
+    }
+    (void)snprintf(
+        &state[length],
+        sizeof(state) - (size_t)length,
+        " %%, SOF %.0f %.0f mA, cell voltages %u ms, SOX %u ms",
+        sof.recommendedContinuousPackChargeCurrent_mA,
+        sof.recommendedContinuousPackDischargeCurrent_mA,
+        (unsigned int)cellVoltage.header.timestamp,
+        (unsigned int)sox.header.timestamp);
+    REPLAY_WriteTraceComment(&replay_trace, state);
+}
+
+static void REPLAY_InjectMessage(const SIL_CAN_MESSAGE_s *pMessage, TickType_t tick) {
+    uint8_t firstEntry = 0u;
+    if (CAN_FindRxHandlers(&replay_rxDispatchTable, pMessage->id, &firstEntry) == 0u) {
+        /* e.g., messages that foxBMS sent while the log was recorded */
+        replay_statistics.ignoredMessages++;
+    } else if (SIL_CanInjectRxMessage(pMessage) != STD_OK) {
+        replay_statistics.droppedMessages++;
+    } else {
+        replay_statistics.injectedMessages++;
+        if (replay_options.isRxTraced == true) {
+            REPLAY_TraceMessage(pMessage, tick, false);
+        }
+    }
+}
+
+static void REPLAY_RunTasks(TickType_t tick) {
+    if (tick == ftsk_taskDefinitionCyclicAlgorithm100ms.phase) {
+        /* as the algorithm task after its phase */
+        os_boot = OS_SYSTEM_RUNNING;
+    }
+    for (uint8_t i = 0u; i < REPLAY_NUMBER_OF_TASKS; i++) {
+        REPLAY_TASK_s *pTask = &replay_tasks[i];
+        if (pTask->wakeTime == tick) {
+            REPLAY_SetCurrentTask(pTask->handle);
+            SYSM_Notify(pTask->taskId, SYSM_NOTIFY_ENTER, OS_GetTickCount());
+            pTask->pUserCode();
+            SYSM_Notify(pTask->taskId, SYSM_NOTIFY_EXIT, OS_GetTickCount());
+            pTask->wakeTime += pTask->pDefinition->cycleTime;
+        }
+    }
+    /* the idle task runs when all tasks wait for their next cycle */
+    REPLAY_SetCurrentTask(NULL);
+    FTSK_UserCodeIdle();
+}
+
+static void REPLAY_CloseFiles(void) {
+    REPLAY_CloseLog(&replay_log);
+    REPLAY_CloseTrace(&replay_trace);
+}
+
+static uint64_t REPLAY_GetHostTime_ns(void) {
+    struct timespec now = {0};
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/*========== Extern Function Implementations ================================*/
+int main(int argc, char *argv[]) {
+    if (REPLAY_ParseOptions(argc, argv) != STD_OK) {
+        REPLAY_PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (REPLAY_OpenLog(&replay_log, replay_options.pLogFile) != STD_OK) {
+        (void)fprintf(stderr, "foxBMS replay: log '%s' not readable\n", replay_options.pLogFile);
+        return EXIT_FAILURE;
+    }
+    if (REPLAY_OpenTrace(&replay_trace, replay_options.pTraceFile) != STD_OK) {
+        (void)fprintf(stderr, "foxBMS replay: trace '%s' not writable\n", replay_options.pTraceFile);
+        REPLAY_CloseLog(&replay_log);
+        return EXIT_FAILURE;
+    }
+    (void)atexit(&REPLAY_CloseFiles);
+
+    const uint64_t start_ns = REPLAY_GetHostTime_ns();
+    REPLAY_InitializeFram();
+    SIL_CanInitialize(NULL_PTR);
+    SIL_CanSetTxCallback(&REPLAY_TraceTxMessage);
+    const STD_RETURN_TYPE_e rxDispatchTableValid =
+        CAN_BuildRxDispatchTable(can_rxMessages, can_rxLength, &replay_rxDispatchTable);
+    FAS_ASSERT(rxDispatchTableValid == STD_OK);
+    REPLAY_InitializeApplication();
+
+    /* the first message of the log is replayed at the offset, the others relative to it */
+    REPLAY_FRAME_s frame     = {0};
+    bool isFramePending      = (REPLAY_ReadFrame(&replay_log, &frame) == STD_OK);
+    const uint64_t origin_us = frame.timestamp_us;
+    uint64_t end_ms          = UINT64_MAX;
+    const uint32_t statePeriod_ms =
+        (replay_options.snapshot_ms > 0u) ? replay_options.snapshot_ms : REPLAY_DEFAULT_STATE_PERIOD_ms;
+    for (TickType_t tick = OS_GetTickCount();
+         ((uint64_t)tick < end_ms) && ((replay_options.duration_ms == 0u) || (tick < replay_options.duration_ms));
+         tick = OS_GetTickCount()) {
+        while (isFramePending == true) {
+            /* messages with a time stamp before the first message are replayed at once */
+            const uint64_t frame_ms =
+                replay_options.offset_ms +
+                (((frame.timestamp_us > origin_us) ? (frame.timestamp_us - origin_us) : 0u) / REPLAY_US_PER_MS);
+            if (frame_ms > tick) {
+                break;
+            }
+            replay_statistics.readMessages++;
+            REPLAY_InjectMessage(&frame.message, tick);
+            isFramePending = (REPLAY_ReadFrame(&replay_log, &frame) == STD_OK);
+        }
+        if ((isFramePending == false) && (end_ms == UINT64_MAX)) {
+            end_ms = (uint64_t)tick + replay_options.tail_ms;
+        }
+        /* tick interrupt: messages are received and DMA transfers complete */
+        SIL_CanProcessRxMessages();
+        SIL_SpiProcessDmaTransfers();
+        REPLAY_RunTasks(tick);
+        if ((replay_options.snapshot_ms > 0u) && (((tick + 1u) % replay_options.snapshot_ms) == 0u)) {
+            REPLAY_WriteSnapshot(tick);
+        }
+        if (((tick + 1u) % statePeriod_ms) == 0u) {
+            REPLAY_TraceState(tick);
+        }
+        REPLAY_IncrementTick();
+    }
+    /* the last, incomplete period */
+    if (replay_options.snapshot_ms > 0u) {
+        REPLAY_WriteSnapshot(OS_GetTickCount() - 1u);
+    }
+    if ((OS_GetTickCount() % statePeriod_ms) != 0u) {
+        REPLAY_TraceState(OS_GetTickCount() - 1u);
+    }
+
+    const uint64_t host_ns                     = REPLAY_GetHostTime_ns() - start_ns;
+    const uint32_t simulated_ms                = OS_GetTickCount();
+    const SIL_CAN_STATISTICS_s *pCanStatistics = SIL_CanGetStatistics();
+    (void)fprintf(
+        stderr,
+        "foxBMS replay: %u ms simulated in %llu ms (x%llu)\n"
+        "  log:   %u messages (%u injected, %u without handler, %u dropped), %u lines skipped\n"
+        "  trace: %u messages sent\n",
+        (unsigned int)simulated_ms,
+        (unsigned long long)(host_ns / 1000000u),
+        (unsigned long long)(((uint64_t)simulated_ms * 1000000u) / ((host_ns > 0u) ? host_ns : 1u)),
+        (unsigned int)replay_statistics.readMessages,
+        (unsigned int)replay_statistics.injectedMessages,
+        (unsigned int)replay_statistics.ignoredMessages,
+        (unsigned int)(replay_statistics.droppedMessages + pCanStatistics->droppedMessages),
+        (unsigned int)replay_log.skippedLines,
+        (unsigned int)pCanStatistics->txMessages);
+
+    /* a log that does not reach the application does not test anything */
+    int exitCode = EXIT_SUCCESS;
+    if (replay_statistics.injectedMessages == 0u) {
+        (void)fprintf(stderr, "foxBMS replay: no message of the log has been passed to the application\n");
+        exitCode = EXIT_FAILURE;
+    }
+    SIL_Exit(exitCode);
+    return exitCode;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -0,0 +1,437 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    replay_kernel.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  REPLAY
+ *
+ * @brief   Deterministic stand-in for the FreeRTOS kernel of the CAN log replay
+ *
+ * @details Implements the subset of the FreeRTOS API that the application uses and the
+ *          time base of the software-in-the-loop build (see sil.h) on the simulated tick
+ *          counter of the replay. Within a tick, the time advances by a fixed step with
+ *          every read of the free running counter or the cycle counter, so that busy
+ *          waits and execution time measurements do not depend on the host. Everything
+ *          runs in one thread, therefore critical sections only check their nesting and
+ *          defer the receiver of the queues.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "replay_kernel.h"
+
+#include "HL_system.h"
+
+#include "queue.h"
+#include "sil.h"
+#include "sil_fram.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*========== Macros and Definitions =========================================*/
+/** nanoseconds per millisecond */
+#define REPLAY_NS_PER_MS (1000000u)
+
+/** simulated time that every read of a counter takes, so that busy waits on the counters end */
+#define REPLAY_COUNTER_READ_TIME_ns (1000u)
+
+/** the time within a tick does not advance beyond the next tick */
+#define REPLAY_MAXIMUM_SUB_TICK_TIME_ns \
+    (((uint32_t)portTICK_PERIOD_MS * REPLAY_NS_PER_MS) - REPLAY_COUNTER_READ_TIME_ns)
+
+/** frequency of FRC0 in kHz: AVCLK1 divided by (#MCU_RTI_CNT0_CPUC0_REG + 1) */
+#define REPLAY_FRC_FREQUENCY_kHz ((uint64_t)(AVCLK1_FREQ * 1000.0f) / 2u)
+
+/** frequency of the CPU clock in kHz */
+#define REPLAY_GCLK_FREQUENCY_kHz ((uint64_t)(GCLK_FREQ * 1000.0f))
+
+/** task control block of the replay */
+struct tskTaskControlBlock {
+    const char *pName;          /*!< name of the task */
+    uint32_t notificationValue; /*!< value of the task notification */
+    bool isNotificationPending; /*!< true if the task has been notified since its last wait */
+};
+
+/** queue of the replay, the items are stored in the storage area of the application */
+struct QueueDefinition {
+    uint8_t *pStorage;       /*!< storage area with space for length items */
+    UBaseType_t length;      /*!< maximum number of items */
+    UBaseType_t itemSize;    /*!< size of an item in bytes */
+    UBaseType_t readIndex;   /*!< index of the oldest item */
+    UBaseType_t numberItems; /*!< number of queued items */
+};
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** simulated time in ticks */
+static TickType_t replay_tickCount = 0u;
+
+/** simulated time since the last tick, advanced by the reads of the counters */
+static uint32_t replay_subTickTime_ns = 0u;
+
+/** nesting depth of the critical sections */
+static uint32_t replay_criticalNesting = 0u;
+
+/** control blocks of the tasks */
+static struct tskTaskControlBlock replay_tasks[REPLAY_MAXIMUM_NUMBER_OF_TASKS] = {0};
+
+/** number of created tasks */
+static uint8_t replay_numberOfTasks = 0u;
+
+/** task that is executed */
+static TaskHandle_t replay_currentTask = NULL;
+
+/** queues of the application */
+static struct QueueDefinition replay_queues[REPLAY_MAXIMUM_NUMBER_OF_QUEUES] = {0};
+
+/** number of created queues */
+static uint8_t replay_numberOfQueues = 0u;
+
+/** task of the receiver of the queues */
+static TaskHandle_t replay_queueReceiverTask = NULL;
+
+/** function that receives the messages of the queues or NULL_PTR */
+static void (*replay_pQueueReceiver)(void) = NULL_PTR;
+
+/** true if a message has been sent in a critical section and has not been received yet */
+static bool replay_isQueueReceiverPending = false;
+
+/** true while the receiver of the queues runs, it does not preempt itself */
+static bool replay_isQueueReceiverRunning = false;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Reads a simulated counter and advances the time within the tick.
+ * @param   frequency_kHz   frequency of the counter
+ * @return  counter value, wraps around like the 32-bit registers of the target
+ */
+static uint32_t REPLAY_ReadCounter(uint64_t frequency_kHz);
+
+/**
+ * @brief   Runs the receiver of the queues in its task, as if it preempted the
+ *          current task.
+ */
+static void REPLAY_RunQueueReceiver(void);
+
+/*========== Static Function Implementations ================================*/
+static uint32_t REPLAY_ReadCounter(uint64_t frequency_kHz) {
+    const uint64_t count = ((uint64_t)replay_tickCount * portTICK_PERIOD_MS * frequency_kHz) +
+                           (((uint64_t)replay_subTickTime_ns * frequency_kHz) / REPLAY_NS_PER_MS);
+    if (replay_subTickTime_ns < REPLAY_MAXIMUM_SUB_TICK_TIME_ns) {
+        replay_subTickTime_ns += REPLAY_COUNTER_READ_TIME_ns;
+    }
+    return (uint32_t)count;
+}
+
+static void REPLAY_RunQueueReceiver(void) {
+    if ((replay_pQueueReceiver != NULL_PTR) && (replay_isQueueReceiverRunning == false)) {
+        const TaskHandle_t preemptedTask = replay_currentTask;
+        replay_isQueueReceiverRunning    = true;
+        replay_currentTask               = replay_queueReceiverTask;
+        replay_pQueueReceiver();
+        replay_currentTask            = preemptedTask;
+        replay_isQueueReceiverRunning = false;
+    }
+}
+
+/*========== Extern Function Implementations ================================*/
+extern TaskHandle_t REPLAY_CreateTask(const char *pName) {
+    FAS_ASSERT(pName != NULL_PTR);
+    FAS_ASSERT(replay_numberOfTasks < REPLAY_MAXIMUM_NUMBER_OF_TASKS);
+    TaskHandle_t task = &replay_tasks[replay_numberOfTasks];
+    task->pName       = pName;
+    replay_numberOfTasks++;
+    return task;
+}
+
+extern void REPLAY_SetCurrentTask(TaskHandle_t task) {
+    replay_currentTask = task;
+}
+
+extern void REPLAY_SetQueueReceiver(TaskHandle_t task, void (*pReceiver)(void)) {
+    replay_queueReceiverTask = task;
+    replay_pQueueReceiver    = pReceiver;
+}
+
+extern void REPLAY_IncrementTick(void) {
+    /* ticks are only counted between the tasks, as by the tick interrupt */
+    FAS_ASSERT(replay_criticalNesting == 0u);
+    replay_tickCount++;
+    replay_subTickTime_ns = 0u;
+}
+
+/* time base of the software-in-the-loop build */
+extern uint64_t SIL_GetSimulatedTime_ns(void) {
+    return ((uint64_t)replay_tickCount * portTICK_PERIOD_MS * REPLAY_NS_PER_MS) + replay_subTickTime_ns;
+}
+
+extern uint32_t SIL_GetFreeRunningCount(void) {
+    return REPLAY_ReadCounter(REPLAY_FRC_FREQUENCY_kHz);
+}
+
+extern uint32_t SIL_GetCycleCount(void) {
+    return REPLAY_ReadCounter(REPLAY_GCLK_FREQUENCY_kHz);
+}
+
+extern void SIL_Exit(int status) {
+    SIL_FramFlush();
+    if (status != EXIT_SUCCESS) {
+        (void)fprintf(stderr, "foxBMS replay: stopped after %u ms\n", (unsigned int)replay_tickCount);
+    }
+    /* the handlers of the replay complete the trace */
+    exit(status);
+}
+
+extern void SIL_Abort(const char *pFile, int line) {
+    (void)fprintf(stderr, "foxBMS replay: assertion failed in %s:%d\n", pFile, line);
+    SIL_Exit(EXIT_FAILURE);
+}
+
+/* kernel */
+void vPortEnterCritical(void) {
+    replay_criticalNesting++;
+}
+
+void vPortExitCritical(void) {
+    FAS_ASSERT(replay_criticalNesting > 0u);
+    replay_criticalNesting--;
+    if ((replay_criticalNesting == 0u) && (replay_isQueueReceiverPending == true)) {
+        /* the receiver preempts the sender as soon as the interrupts are enabled again */
+        replay_isQueueReceiverPending = false;
+        REPLAY_RunQueueReceiver();
+    }
+}
+
+TaskHandle_t xTaskCreateStatic(
+    TaskFunction_t pxTaskCode,
+    const char *const pcName,
+    const uint32_t ulStackDepth,
+    void *const pvParameters,
+    UBaseType_t uxPriority,
+    StackType_t *const puxStackBuffer,
+    StaticTask_t *const pxTaskBuffer) {
+    /* the tasks are created with REPLAY_CreateTask() and do not run their task functions */
+    (void)pxTaskCode;
+    (void)pcName;
+    (void)ulStackDepth;
+    (void)pvParameters;
+    (void)uxPriority;
+    (void)puxStackBuffer;
+    (void)pxTaskBuffer;
+    FAS_ASSERT(FAS_TRAP);
+    return NULL;
+}
+
+void vTaskStartScheduler(void) {
+    /* the tasks are called by the scheduler of the replay */
+    FAS_ASSERT(FAS_TRAP);
+}
+
+BaseType_t xTaskGetSchedulerState(void) {
+    return taskSCHEDULER_RUNNING;
+}
+
+BaseType_t xTaskIncrementTick(void) {
+    REPLAY_IncrementTick();
+    return pdFALSE;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return replay_tickCount;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return replay_currentTask;
+}
+
+void vTaskDelay(const TickType_t xTicksToDelay) {
+    /* the task is called again by the scheduler of the replay in its next cycle */
+    (void)xTicksToDelay;
+}
+
+BaseType_t xTaskDelayUntil(TickType_t *const pxPreviousWakeTime, const TickType_t xTimeIncrement) {
+    FAS_ASSERT(pxPreviousWakeTime != NULL_PTR);
+    *pxPreviousWakeTime += xTimeIncrement;
+    return pdTRUE;
+}
+
+BaseType_t xTaskGenericNotify(
+    TaskHandle_t xTaskToNotify,
+    UBaseType_t uxIndexToNotify,
+    uint32_t ulValue,
+    eNotifyAction eAction,
+    uint32_t *pulPreviousNotificationValue) {
+    FAS_ASSERT(xTaskToNotify != NULL);
+    FAS_ASSERT(uxIndexToNotify == 0u);
+    BaseType_t result = pdPASS;
+    if (pulPreviousNotificationValue != NULL_PTR) {
+        *pulPreviousNotificationValue = xTaskToNotify->notificationValue;
+    }
+    switch (eAction) {
+        case eSetBits:
+            xTaskToNotify->notificationValue |= ulValue;
+            break;
+        case eIncrement:
+            xTaskToNotify->notificationValue++;
+            break;
+        case eSetValueWithOverwrite:
+            xTaskToNotify->notificationValue = ulValue;
+            break;
+        case eSetValueWithoutOverwrite:
+            if (xTaskToNotify->isNotificationPending == true) {
+                result = pdFAIL;
+            } else {
+                xTaskToNotify->notificationValue = ulValue;
+            }
+            break;
+        default:
+            /* eNoAction */
+            break;
+    }
+    xTaskToNotify->isNotificationPending = true;
+    return result;
+}
+
+BaseType_t xTaskGenericNotifyWait(
+    UBaseType_t uxIndexToWaitOn,
+    uint32_t ulBitsToClearOnEntry,
+    uint32_t ulBitsToClearOnExit,
+    uint32_t *pulNotificationValue,
+    TickType_t xTicksToWait) {
+    FAS_ASSERT(replay_currentTask != NULL);
+    FAS_ASSERT(uxIndexToWaitOn == 0u);
+    /* tasks do not block, a missing notification is reported as timeout */
+    (void)xTicksToWait;
+    BaseType_t result = pdFALSE;
+    if (replay_currentTask->isNotificationPending == false) {
+        replay_currentTask->notificationValue &= ~ulBitsToClearOnEntry;
+    }
+    if (pulNotificationValue != NULL_PTR) {
+        *pulNotificationValue = replay_currentTask->notificationValue;
+    }
+    if (replay_currentTask->isNotificationPending == true) {
+        replay_currentTask->notificationValue &= ~ulBitsToClearOnExit;
+        replay_currentTask->isNotificationPending = false;
+        result                                    = pdTRUE;
+    }
+    return result;
+}
+
+QueueHandle_t xQueueGenericCreateStatic(
+    const UBaseType_t uxQueueLength,
+    const UBaseType_t uxItemSize,
+    uint8_t *pucQueueStorage,
+    StaticQueue_t *pxStaticQueue,
+    const uint8_t ucQueueType) {
+    FAS_ASSERT(uxQueueLength > 0u);
+    FAS_ASSERT(pucQueueStorage != NULL_PTR);
+    FAS_ASSERT(replay_numberOfQueues < REPLAY_MAXIMUM_NUMBER_OF_QUEUES);
+    /* the control block of the replay is used instead of the static one */
+    (void)pxStaticQueue;
+    (void)ucQueueType;
+    QueueHandle_t queue = &replay_queues[replay_numberOfQueues];
+    queue->pStorage     = pucQueueStorage;
+    queue->length       = uxQueueLength;
+    queue->itemSize     = uxItemSize;
+    replay_numberOfQueues++;
+    return queue;
+}
+
+BaseType_t xQueueGenericSend(
+    QueueHandle_t xQueue,
+    const void *const pvItemToQueue,
+    TickType_t xTicksToWait,
+    const BaseType_t xCopyPosition) {
+    FAS_ASSERT(xQueue != NULL);
+    FAS_ASSERT(pvItemToQueue != NULL_PTR);
+    (void)xTicksToWait;
+    BaseType_t result = errQUEUE_FULL;
+    if ((xCopyPosition == queueOVERWRITE) && (xQueue->numberItems == xQueue->length)) {
+        /* only allowed for queues with one element */
+        xQueue->numberItems = 0u;
+    }
+    if (xQueue->numberItems < xQueue->length) {
+        UBaseType_t index = 0u;
+        if (xCopyPosition == queueSEND_TO_FRONT) {
+            xQueue->readIndex = (xQueue->readIndex + xQueue->length - 1u) % xQueue->length;
+            index             = xQueue->readIndex;
+        } else {
+            index = (xQueue->readIndex + xQueue->numberItems) % xQueue->length;
+        }
+        (void)memcpy(&xQueue->pStorage[index * xQueue->itemSize], pvItemToQueue, xQueue->itemSize);
+        xQueue->numberItems++;
+        result = pdPASS;
+        if (replay_criticalNesting == 0u) {
+            REPLAY_RunQueueReceiver();
+        } else {
+            replay_isQueueReceiverPending = true;
+        }
+    }
+    return result;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void *const pvBuffer, TickType_t xTicksToWait) {
+    FAS_ASSERT(xQueue != NULL);
+    FAS_ASSERT(pvBuffer != NULL_PTR);
+    (void)xTicksToWait;
+    BaseType_t result = pdFALSE;
+    if (xQueue->numberItems > 0u) {
+        (void)memcpy(pvBuffer, &xQueue->pStorage[xQueue->readIndex * xQueue->itemSize], xQueue->itemSize);
+        xQueue->readIndex = (xQueue->readIndex + 1u) % xQueue->length;
+        xQueue->numberItems--;
+        result = pdPASS;
+    }
+    return result;
+}
+
+UBaseType_t uxQueueMessagesWaiting(const QueueHandle_t xQueue) {
+    FAS_ASSERT(xQueue != NULL);
+    return xQueue->numberItems;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
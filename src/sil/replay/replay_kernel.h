@@ -0,0 +1,113 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    replay_kernel.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  REPLAY
+ *
+ * @brief   Deterministic stand-in for the FreeRTOS kernel of the CAN log replay
+ *
+ * @details The replay does not run the FreeRTOS kernel. The kernel functions that the
+ *          application uses are implemented on a simulated tick counter that is advanced
+ *          by the scheduler of the replay. Tasks never block: functions that would block
+ *          return as if their timeout expired. The receiver of the queues preempts the
+ *          senders, as the engine task does on the target.
+ *
+ */
+
+#ifndef FOXBMS__REPLAY_KERNEL_H_
+#define FOXBMS__REPLAY_KERNEL_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*========== Macros and Definitions =========================================*/
+/** largest number of tasks that the replay schedules */
+#define REPLAY_MAXIMUM_NUMBER_OF_TASKS (8u)
+
+/** largest number of queues that the application creates */
+#define REPLAY_MAXIMUM_NUMBER_OF_QUEUES (8u)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Creates the control block of a task of the replay.
+ * @param   pName   name of the task
+ * @return  handle of the task
+ */
+extern TaskHandle_t REPLAY_CreateTask(const char *pName);
+
+/**
+ * @brief   Sets the task that is executed by the scheduler of the replay.
+ * @details The handle is returned by xTaskGetCurrentTaskHandle(), e.g., for
+ *          task notifications.
+ * @param   task    handle of the task or NULL outside of a task
+ */
+extern void REPLAY_SetCurrentTask(TaskHandle_t task);
+
+/**
+ * @brief   Sets the receiver of the messages that are sent to the queues.
+ * @details On the target the engine task has the highest priority and waits
+ *          for the messages of the database queue, therefore it preempts every
+ *          sender as soon as a message has been sent. The replay calls the
+ *          receiver after every message that has been sent to a queue, or at
+ *          the end of the critical section in which it has been sent.
+ * @param   task        task of the receiver or NULL
+ * @param   pReceiver   function that receives the messages, NULL_PTR for none
+ */
+extern void REPLAY_SetQueueReceiver(TaskHandle_t task, void (*pReceiver)(void));
+
+/**
+ * @brief   Advances the simulated time by one tick.
+ */
+extern void REPLAY_IncrementTick(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__REPLAY_KERNEL_H_ */
@@ -0,0 +1,481 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    replay_log.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  REPLAY
+ *
+ * @brief   Reader of CAN logs and writer of CAN traces of the CAN log replay
+ *
+ * @details The timestamps are parsed as fixed-point numbers, so that the replay of a log
+ *          does not depend on the rounding of floating-point numbers.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "replay_log.h"
+
+#include <ctype.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*========== Macros and Definitions =========================================*/
+/** length of the line buffer, longer lines are skipped */
+#define REPLAY_LOG_LINE_LENGTH (512u)
+
+/** decimal places of a timestamp in ms that are resolved in us */
+#define REPLAY_LOG_MS_DECIMAL_PLACES (3u)
+
+/** decimal places of a timestamp in s that are resolved in us */
+#define REPLAY_LOG_S_DECIMAL_PLACES (6u)
+
+/** largest standard identifier */
+#define REPLAY_LOG_MAXIMUM_STANDARD_ID (0x7FFu)
+
+/** columns of PCAN-View traces with file version 1.0, which do not state their version */
+#define REPLAY_LOG_PCAN_VIEW_1_0_COLUMNS "NOIlD"
+
+/** columns of PCAN-View traces with file version 1.1 */
+#define REPLAY_LOG_PCAN_VIEW_1_1_COLUMNS "NOdIlD"
+
+/** default columns of PCAN-View traces with file version 2.x */
+#define REPLAY_LOG_PCAN_VIEW_2_X_COLUMNS "NOTIdlD"
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Reads the next line of a log.
+ * @details Lines that do not fit into the buffer are skipped.
+ * @param   pLog    opened log
+ * @param   pLine   buffer of #REPLAY_LOG_LINE_LENGTH characters
+ * @return  #STD_OK if a line has been read, #STD_NOT_OK at the end of the log
+ */
+static STD_RETURN_TYPE_e REPLAY_ReadLine(REPLAY_LOG_s *pLog, char *pLine);
+
+/**
+ * @brief   Parses a decimal number with decimal places as fixed-point number.
+ * @param   pToken          the number, e.g., "1103.387"
+ * @param   decimalPlaces   number of decimal places that are resolved, further
+ *                          decimal places are truncated
+ * @param   pValue          value in units of the last resolved decimal place
+ * @return  #STD_OK if the token is a valid number, #STD_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e REPLAY_ParseFixedPoint(const char *pToken, uint8_t decimalPlaces, uint64_t *pValue);
+
+/**
+ * @brief   Parses an unsigned integer.
+ * @param   pToken  the number
+ * @param   base    base of the number
+ * @param   maximum largest valid value
+ * @param   pValue  value of the number
+ * @return  #STD_OK if the token is a valid number, #STD_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e REPLAY_ParseUnsigned(const char *pToken, int base, uint32_t maximum, uint32_t *pValue);
+
+/**
+ * @brief   Parses the header of a PCAN-View trace.
+ * @param   pLog    log with the format #REPLAY_LOG_FORMAT_PCAN_VIEW
+ * @param   pLine   comment line of the header
+ * @return  #STD_NOT_OK if the file version is not supported, #STD_OK
+ *          otherwise
+ */
+static STD_RETURN_TYPE_e REPLAY_ParsePcanViewHeader(REPLAY_LOG_s *pLog, const char *pLine);
+
+/**
+ * @brief   Parses a message of a PCAN-View trace.
+ * @param   pLog    log with the format #REPLAY_LOG_FORMAT_PCAN_VIEW
+ * @param   pLine   line of the trace, is modified
+ * @param   pFrame  parsed message
+ * @return  #STD_OK if the line contains a supported message, #STD_NOT_OK
+ *          otherwise
+ */
+static STD_RETURN_TYPE_e REPLAY_ParsePcanViewFrame(const REPLAY_LOG_s *pLog, char *pLine, REPLAY_FRAME_s *pFrame);
+
+/**
+ * @brief   Parses a message of a CAN log of the foxBMS GUI.
+ * @param   pLine   line of the log, is modified
+ * @param   pFrame  parsed message
+ * @return  #STD_OK if the line contains a supported message, #STD_NOT_OK
+ *          otherwise
+ */
+static STD_RETURN_TYPE_e REPLAY_ParseFoxbmsFrame(char *pLine, REPLAY_FRAME_s *pFrame);
+
+/*========== Static Function Implementations ================================*/
+static STD_RETURN_TYPE_e REPLAY_ReadLine(REPLAY_LOG_s *pLog, char *pLine) {
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    bool isLineTooLong       = true;
+    while (isLineTooLong == true) {
+        isLineTooLong = false;
+        if (fgets(pLine, (int)REPLAY_LOG_LINE_LENGTH, pLog->pFile) != NULL_PTR) {
+            retVal = STD_OK;
+            pLog->lineNumber++;
+            if ((strchr(pLine, '\n') == NULL_PTR) && (feof(pLog->pFile) == 0)) {
+                /* skip the rest of the line and read the next one */
+                int character = 0;
+                do {
+                    character = fgetc(pLog->pFile);
+                } while ((character != '\n') && (character != EOF));
+                pLog->skippedLines++;
+                isLineTooLong = true;
+            }
+        } else {
+            retVal = STD_NOT_OK;
+        }
+    }
+    return retVal;
+}
+
+static STD_RETURN_TYPE_e REPLAY_ParseFixedPoint(const char *pToken, uint8_t decimalPlaces, uint64_t *pValue) {
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    uint64_t value           = 0u;
+    uint8_t parsedPlaces     = 0u;
+    bool hasDigits           = false;
+    bool isFraction          = false;
+    bool isValid             = true;
+    for (const char *pCharacter = pToken; (*pCharacter != '\0') && (isValid == true); pCharacter++) {
+        if (isdigit((unsigned char)*pCharacter) != 0) {
+            hasDigits = true;
+            if (isFraction == false) {
+                value = (value * 10u) + (uint64_t)(*pCharacter - '0');
+            } else if (parsedPlaces < decimalPlaces) {
+                value = (value * 10u) + (uint64_t)(*pCharacter - '0');
+                parsedPlaces++;
+            } else {
+                /* truncate the decimal places that are not resolved */
+            }
+        } else if ((*pCharacter == '.') && (isFraction == false)) {
+            isFraction = true;
+        } else {
+            isValid = false;
+        }
+    }
+    if ((isValid == true) && (hasDigits == true)) {
+        for (; parsedPlaces < decimalPlaces; parsedPlaces++) {
+            value *= 10u;
+        }
+        *pValue = value;
+        retVal  = STD_OK;
+    }
+    return retVal;
+}
+
+static STD_RETURN_TYPE_e REPLAY_ParseUnsigned(const char *pToken, int base, uint32_t maximum, uint32_t *pValue) {
+    STD_RETURN_TYPE_e retVal  = STD_NOT_OK;
+    char *pEnd                = NULL_PTR;
+    errno                     = 0;
+    const unsigned long value = strtoul(pToken, &pEnd, base);
+    if ((pEnd != pToken) && (*pEnd == '\0') && (errno == 0) && (value <= maximum) && (pToken[0] != '-')) {
+        *pValue = (uint32_t)value;
+        retVal  = STD_OK;
+    }
+    return retVal;
+}
+
+static STD_RETURN_TYPE_e REPLAY_ParsePcanViewHeader(REPLAY_LOG_s *pLog, const char *pLine) {
+    STD_RETURN_TYPE_e retVal = STD_OK;
+    if (strncmp(pLine, ";$FILEVERSION=", strlen(";$FILEVERSION=")) == 0) {
+        const char *pVersion = &pLine[strlen(";$FILEVERSION=")];
+        if (strncmp(pVersion, "1.1", 3u) == 0) {
+            (void)strcpy(pLog->columns, REPLAY_LOG_PCAN_VIEW_1_1_COLUMNS);
+        } else if (strncmp(pVersion, "2.", 2u) == 0) {
+            (void)strcpy(pLog->columns, REPLAY_LOG_PCAN_VIEW_2_X_COLUMNS);
+        } else {
+            retVal = STD_NOT_OK;
+        }
+        pLog->numberOfColumns = (uint8_t)strlen(pLog->columns);
+    } else if (strncmp(pLine, ";$COLUMNS=", strlen(";$COLUMNS=")) == 0) {
+        /* e.g. ";$COLUMNS=N,O,T,I,d,l,D" */
+        pLog->numberOfColumns = 0u;
+        for (const char *pCharacter = &pLine[strlen(";$COLUMNS=")];
+             (*pCharacter != '\0') && (pLog->numberOfColumns < (REPLAY_LOG_MAXIMUM_NUMBER_OF_COLUMNS - 1u));
+             pCharacter++) {
+            if (isalpha((unsigned char)*pCharacter) != 0) {
+                pLog->columns[pLog->numberOfColumns] = *pCharacter;
+                pLog->numberOfColumns++;
+            }
+        }
+        pLog->columns[pLog->numberOfColumns] = '\0';
+    } else {
+        /* other comments are ignored */
+    }
+    return retVal;
+}
+
+static STD_RETURN_TYPE_e REPLAY_ParsePcanViewFrame(const REPLAY_LOG_s *pLog, char *pLine, REPLAY_FRAME_s *pFrame) {
+    STD_RETURN_TYPE_e retVal = STD_OK;
+    bool hasTimestamp        = false;
+    bool hasId               = false;
+    uint32_t length          = UINT32_MAX;
+    char *pSavePointer       = NULL_PTR;
+    char *pToken             = strtok_r(pLine, " \t\r\n", &pSavePointer);
+    for (uint8_t column = 0u; (column < pLog->numberOfColumns) && (pToken != NULL_PTR) && (retVal == STD_OK);
+         column++) {
+        uint32_t value = 0u;
+        switch (pLog->columns[column]) {
+            case 'O':
+                /* time offset in ms */
+                retVal       = REPLAY_ParseFixedPoint(pToken, REPLAY_LOG_MS_DECIMAL_PLACES, &pFrame->timestamp_us);
+                hasTimestamp = true;
+                break;
+            case 'T':
+                /* only data frames of classic CAN are replayed */
+                if (strcmp(pToken, "DT") != 0) {
+                    retVal = STD_NOT_OK;
+                }
+                break;
+            case 'I':
+                /* extended identifiers are written with eight digits */
+                if ((strlen(pToken) > 4u) ||
+                    (REPLAY_ParseUnsigned(pToken, 16, REPLAY_LOG_MAXIMUM_STANDARD_ID, &value) != STD_OK)) {
+                    retVal = STD_NOT_OK;
+                }
+                pFrame->message.id = value;
+                hasId              = true;
+                break;
+            case 'l':
+            case 'L':
+                retVal = REPLAY_ParseUnsigned(pToken, 10, SIL_CAN_MAXIMUM_DLC, &length);
+                break;
+            case 'D':
+                if (length == UINT32_MAX) {
+                    retVal = STD_NOT_OK;
+                }
+                for (uint32_t i = 0u; (i < length) && (retVal == STD_OK); i++) {
+                    if ((pToken == NULL_PTR) || (REPLAY_ParseUnsigned(pToken, 16, UINT8_MAX, &value) != STD_OK)) {
+                        retVal = STD_NOT_OK;
+                    } else {
+                        pFrame->message.data[i] = (uint8_t)value;
+                        pToken                  = strtok_r(NULL_PTR, " \t\r\n", &pSavePointer);
+                    }
+                }
+                pFrame->message.dlc = (uint8_t)length;
+                break;
+            default:
+                /* message number, direction, bus and reserved columns are not needed */
+                break;
+        }
+        if (pLog->columns[column] != 'D') {
+            pToken = strtok_r(NULL_PTR, " \t\r\n", &pSavePointer);
+        }
+    }
+    if ((hasTimestamp == false) || (hasId == false) || (length == UINT32_MAX)) {
+        retVal = STD_NOT_OK;
+    }
+    return retVal;
+}
+
+static STD_RETURN_TYPE_e REPLAY_ParseFoxbmsFrame(char *pLine, REPLAY_FRAME_s *pFrame) {
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    char *pSavePointer       = NULL_PTR;
+    const char *pTimestamp   = strtok_r(pLine, " \t\r\n", &pSavePointer);
+    const char *pId          = strtok_r(NULL_PTR, " \t\r\n", &pSavePointer);
+    const char *pLength      = strtok_r(NULL_PTR, " \t\r\n", &pSavePointer);
+    uint32_t id              = 0u;
+    uint32_t length          = 0u;
+    if ((pLength != NULL_PTR) &&
+        (REPLAY_ParseFixedPoint(pTimestamp, REPLAY_LOG_S_DECIMAL_PLACES, &pFrame->timestamp_us) == STD_OK) &&
+        (REPLAY_ParseUnsigned(pId, 10, REPLAY_LOG_MAXIMUM_STANDARD_ID, &id) == STD_OK) &&
+        (REPLAY_ParseUnsigned(pLength, 10, SIL_CAN_MAXIMUM_DLC, &length) == STD_OK)) {
+        retVal = STD_OK;
+        for (uint32_t i = 0u; (i < length) && (retVal == STD_OK); i++) {
+            const char *pData = strtok_r(NULL_PTR, " \t\r\n", &pSavePointer);
+            uint32_t value    = 0u;
+            if ((pData == NULL_PTR) || (REPLAY_ParseUnsigned(pData, 10, UINT8_MAX, &value) != STD_OK)) {
+                retVal = STD_NOT_OK;
+            } else {
+                pFrame->message.data[i] = (uint8_t)value;
+            }
+        }
+        pFrame->message.id  = id;
+        pFrame->message.dlc = (uint8_t)length;
+    }
+    return retVal;
+}
+
+/*========== Extern Function Implementations ================================*/
+extern STD_RETURN_TYPE_e REPLAY_OpenLog(REPLAY_LOG_s *pLog, const char *pFile) {
+    FAS_ASSERT(pLog != NULL_PTR);
+    FAS_ASSERT(pFile != NULL_PTR);
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    (void)memset(pLog, 0, sizeof(REPLAY_LOG_s));
+    if (strcmp(pFile, "-") == 0) {
+        pLog->pFile = stdin;
+    } else {
+        pLog->pFile = fopen(pFile, "r");
+    }
+    if (pLog->pFile != NULL_PTR) {
+        /* PCAN-View traces start with their header, logs of the GUI have none */
+        const int character = fgetc(pLog->pFile);
+        if (character == ';') {
+            pLog->format = REPLAY_LOG_FORMAT_PCAN_VIEW;
+            (void)strcpy(pLog->columns, REPLAY_LOG_PCAN_VIEW_1_0_COLUMNS);
+            pLog->numberOfColumns = (uint8_t)strlen(pLog->columns);
+        } else {
+            pLog->format = REPLAY_LOG_FORMAT_FOXBMS;
+        }
+        if ((character == EOF) || (ungetc(character, pLog->pFile) != EOF)) {
+            retVal = STD_OK;
+        }
+    }
+    return retVal;
+}
+
+extern STD_RETURN_TYPE_e REPLAY_ReadFrame(REPLAY_LOG_s *pLog, REPLAY_FRAME_s *pFrame) {
+    FAS_ASSERT(pLog != NULL_PTR);
+    FAS_ASSERT(pFrame != NULL_PTR);
+    STD_RETURN_TYPE_e retVal          = STD_NOT_OK;
+    char line[REPLAY_LOG_LINE_LENGTH] = {0};
+    bool isFrameFound                 = false;
+    while ((isFrameFound == false) && (REPLAY_ReadLine(pLog, line) == STD_OK)) {
+        (void)memset(pFrame, 0, sizeof(REPLAY_FRAME_s));
+        const size_t start = strspn(line, " \t");
+        if ((line[start] == '\r') || (line[start] == '\n') || (line[start] == '\0')) {
+            /* empty line */
+        } else if (line[start] == ';') {
+            if ((pLog->format == REPLAY_LOG_FORMAT_PCAN_VIEW) &&
+                (REPLAY_ParsePcanViewHeader(pLog, &line[start]) != STD_OK)) {
+                (void)fprintf(stderr, "foxBMS replay: line %u: unsupported trace\n", (unsigned int)pLog->lineNumber);
+                break;
+            }
+        } else if (pLog->format == REPLAY_LOG_FORMAT_PCAN_VIEW) {
+            isFrameFound = (REPLAY_ParsePcanViewFrame(pLog, line, pFrame) == STD_OK);
+        } else {
+            isFrameFound = (REPLAY_ParseFoxbmsFrame(line, pFrame) == STD_OK);
+        }
+        if ((isFrameFound == false) && (line[start] != ';') && (line[start] != '\r') && (line[start] != '\n')) {
+            pLog->skippedLines++;
+        }
+    }
+    if (isFrameFound == true) {
+        retVal = STD_OK;
+    }
+    return retVal;
+}
+
+extern void REPLAY_CloseLog(REPLAY_LOG_s *pLog) {
+    FAS_ASSERT(pLog != NULL_PTR);
+    if ((pLog->pFile != NULL_PTR) && (pLog->pFile != stdin)) {
+        (void)fclose(pLog->pFile);
+    }
+    pLog->pFile = NULL_PTR;
+}
+
+extern STD_RETURN_TYPE_e REPLAY_OpenTrace(REPLAY_TRACE_s *pTrace, const char *pFile) {
+    FAS_ASSERT(pTrace != NULL_PTR);
+    FAS_ASSERT(pFile != NULL_PTR);
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    pTrace->messageCounter   = 0u;
+    if (strcmp(pFile, "-") == 0) {
+        pTrace->pFile = stdout;
+    } else {
+        pTrace->pFile = fopen(pFile, "w");
+    }
+    if (pTrace->pFile != NULL_PTR) {
+        /* the header does not contain the time of the replay, so that the traces of two runs are equal */
+        (void)fputs(
+            ";$FILEVERSION=2.0\n"
+            ";$STARTTIME=0\n"
+            ";$COLUMNS=N,O,T,I,d,l,D\n"
+            ";\n"
+            ";   Generated by the CAN log replay of foxBMS (simulated time)\n"
+            ";-------------------------------------------------------------------------------\n"
+            ";   Message   Time    Type ID     Rx/Tx\n"
+            ";   Number    Offset  |    [hex]  |  Data Length\n"
+            ";   |         [ms]    |    |      |  |  Data [hex] ...\n"
+            ";   |         |       |    |      |  |  |\n"
+            ";---+-- ------+------ +- --+----- +- +- +- +- -- -- -- -- -- -- --\n",
+            pTrace->pFile);
+        retVal = STD_OK;
+    }
+    return retVal;
+}
+
+extern void REPLAY_WriteTraceFrame(
+    REPLAY_TRACE_s *pTrace,
+    uint64_t timestamp_us,
+    const SIL_CAN_MESSAGE_s *pMessage,
+    bool isTransmitted) {
+    FAS_ASSERT(pTrace != NULL_PTR);
+    FAS_ASSERT(pMessage != NULL_PTR);
+    FAS_ASSERT(pMessage->dlc <= SIL_CAN_MAXIMUM_DLC);
+    pTrace->messageCounter++;
+    (void)fprintf(
+        pTrace->pFile,
+        "%7u %9llu.%03u DT     %04X %s %u ",
+        (unsigned int)pTrace->messageCounter,
+        (unsigned long long)(timestamp_us / 1000u),
+        (unsigned int)(timestamp_us % 1000u),
+        (unsigned int)pMessage->id,
+        (isTransmitted == true) ? "Tx" : "Rx",
+        (unsigned int)pMessage->dlc);
+    for (uint8_t i = 0u; i < pMessage->dlc; i++) {
+        (void)fprintf(pTrace->pFile, " %02X", (unsigned int)pMessage->data[i]);
+    }
+    (void)fputc('\n', pTrace->pFile);
+}
+
+extern void REPLAY_WriteTraceComment(REPLAY_TRACE_s *pTrace, const char *pComment) {
+    FAS_ASSERT(pTrace != NULL_PTR);
+    FAS_ASSERT(pComment != NULL_PTR);
+    (void)fprintf(pTrace->pFile, ";   %s\n", pComment);
+}
+
+extern void REPLAY_CloseTrace(REPLAY_TRACE_s *pTrace) {
+    FAS_ASSERT(pTrace != NULL_PTR);
+    if (pTrace->pFile != NULL_PTR) {
+        if (pTrace->pFile == stdout) {
+            (void)fflush(pTrace->pFile);
+        } else {
+            (void)fclose(pTrace->pFile);
+        }
+    }
+    pTrace->pFile = NULL_PTR;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
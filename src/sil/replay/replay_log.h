@@ -0,0 +1,170 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    replay_log.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  REPLAY
+ *
+ * @brief   Reader of CAN logs and writer of CAN traces of the CAN log replay
+ *
+ * @details Reads the CAN messages of
+ *          - PCAN-View traces (file versions 1.1 and 2.x) and
+ *          - CAN logs of the foxBMS GUI (one message per line: time in s, decimal
+ *            identifier, data length and decimal data bytes)
+ *          one after another, so that logs of any length can be replayed. The messages
+ *          that are sent by the application are written as PCAN-View trace (file version
+ *          2.0).
+ *
+ */
+
+#ifndef FOXBMS__REPLAY_LOG_H_
+#define FOXBMS__REPLAY_LOG_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "sil_can.h"
+
+#include <stdio.h>
+
+/*========== Macros and Definitions =========================================*/
+/** largest number of columns of a PCAN-View trace */
+#define REPLAY_LOG_MAXIMUM_NUMBER_OF_COLUMNS (16u)
+
+/** formats of the CAN logs */
+typedef enum REPLAY_LOG_FORMAT {
+    REPLAY_LOG_FORMAT_FOXBMS,    /*!< CAN log of the foxBMS GUI */
+    REPLAY_LOG_FORMAT_PCAN_VIEW, /*!< PCAN-View trace */
+} REPLAY_LOG_FORMAT_e;
+
+/** CAN message of a log */
+typedef struct REPLAY_FRAME {
+    uint64_t timestamp_us;     /*!< time of the message in the log */
+    SIL_CAN_MESSAGE_s message; /*!< the message */
+} REPLAY_FRAME_s;
+
+/** CAN log that is read */
+typedef struct REPLAY_LOG {
+    FILE *pFile;                                        /*!< the opened log */
+    REPLAY_LOG_FORMAT_e format;                         /*!< format of the log */
+    char columns[REPLAY_LOG_MAXIMUM_NUMBER_OF_COLUMNS]; /*!< columns of a PCAN-View trace */
+    uint8_t numberOfColumns;                            /*!< number of entries in columns */
+    uint32_t lineNumber;                                /*!< number of the line that has been read last */
+    uint32_t skippedLines;                              /*!< lines without a supported CAN message */
+} REPLAY_LOG_s;
+
+/** CAN trace that is written */
+typedef struct REPLAY_TRACE {
+    FILE *pFile;             /*!< the opened trace */
+    uint32_t messageCounter; /*!< number of written messages */
+} REPLAY_TRACE_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Opens a CAN log and detects its format.
+ * @param   pLog    log to be initialized
+ * @param   pFile   path of the log, "-" reads the standard input
+ * @return  #STD_OK if the log can be read, #STD_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e REPLAY_OpenLog(REPLAY_LOG_s *pLog, const char *pFile);
+
+/**
+ * @brief   Reads the next CAN message of a log.
+ * @details Lines with comments, error frames, remote frames, CAN FD frames and
+ *          extended identifiers are skipped.
+ * @param   pLog    opened log
+ * @param   pFrame  message that has been read
+ * @return  #STD_OK if a message has been read, #STD_NOT_OK at the end of the
+ *          log
+ */
+extern STD_RETURN_TYPE_e REPLAY_ReadFrame(REPLAY_LOG_s *pLog, REPLAY_FRAME_s *pFrame);
+
+/**
+ * @brief   Closes a CAN log.
+ * @param   pLog    opened log
+ */
+extern void REPLAY_CloseLog(REPLAY_LOG_s *pLog);
+
+/**
+ * @brief   Opens a CAN trace and writes its header.
+ * @param   pTrace  trace to be initialized
+ * @param   pFile   path of the trace, "-" writes to the standard output
+ * @return  #STD_OK if the trace can be written, #STD_NOT_OK otherwise
+ */
+extern STD_RETURN_TYPE_e REPLAY_OpenTrace(REPLAY_TRACE_s *pTrace, const char *pFile);
+
+/**
+ * @brief   Writes a CAN message to a trace.
+ * @param   pTrace          opened trace
+ * @param   timestamp_us    simulated time of the message
+ * @param   pMessage        the message
+ * @param   isTransmitted   true if the application sent the message, false
+ *                          if it received the message
+ */
+extern void REPLAY_WriteTraceFrame(
+    REPLAY_TRACE_s *pTrace,
+    uint64_t timestamp_us,
+    const SIL_CAN_MESSAGE_s *pMessage,
+    bool isTransmitted);
+
+/**
+ * @brief   Writes a comment line to a trace.
+ * @details Comments are ignored by the tools that read PCAN-View traces.
+ * @param   pTrace      opened trace
+ * @param   pComment    text of the comment without line break
+ */
+extern void REPLAY_WriteTraceComment(REPLAY_TRACE_s *pTrace, const char *pComment);
+
+/**
+ * @brief   Closes a CAN trace.
+ * @param   pTrace  opened trace
+ */
+extern void REPLAY_CloseTrace(REPLAY_TRACE_s *pTrace);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__REPLAY_LOG_H_ */
@@ -0,0 +1,282 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Core of the software-in-the-loop (SIL) build
+ *
+ * @details The simulated time advances with the ticks of the operating system. Between
+ *          two ticks it is interpolated from the host clock, but never beyond the next
+ *          tick, so that the simulated counters stay consistent with the tick count even
+ *          if the host can not keep up with the requested time scale.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "sil.h"
+
+#include "HL_system.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "sil_can.h"
+#include "sil_fram.h"
+#include "sil_spi.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+/*========== Macros and Definitions =========================================*/
+/** nanoseconds per millisecond */
+#define SIL_NS_PER_MS (1000000u)
+
+/** simulated duration of one tick of the operating system in ns */
+#define SIL_TICK_PERIOD_ns ((uint64_t)SIL_NS_PER_MS * portTICK_PERIOD_MS)
+
+/** frequency of FRC0 in kHz: AVCLK1 divided by (#MCU_RTI_CNT0_CPUC0_REG + 1) */
+#define SIL_FRC_FREQUENCY_kHz ((uint64_t)(AVCLK1_FREQ * 1000.0f) / 2u)
+
+/** frequency of the CPU clock in kHz */
+#define SIL_GCLK_FREQUENCY_kHz ((uint64_t)(GCLK_FREQ * 1000.0f))
+
+/**
+ * time base of the simulation, written in the tick hook and read with a
+ * sequence lock, as it is read from all tasks
+ */
+typedef struct SIL_TIME_BASE {
+    uint32_t sequence;     /*!< odd while the time base is updated */
+    bool isTicking;        /*!< false until the first tick of the operating system */
+    uint64_t simulated_ns; /*!< simulated time at the last tick */
+    uint64_t host_ns;      /*!< host time at the last tick */
+} SIL_TIME_BASE_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** time base of the simulation */
+static SIL_TIME_BASE_s sil_timeBase = {0u, false, 0u, 0u};
+
+/** number of ticks since the start of the scheduler */
+static uint32_t sil_elapsedTicks = 0u;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+SIL_CONFIG_s sil_config = {
+    .timeScale     = SIL_DEFAULT_TIME_SCALE,
+    .duration_ms   = 0u,
+    .pFramFile     = SIL_DEFAULT_FRAM_FILE,
+    .pCanInterface = NULL_PTR,
+};
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Returns the host time.
+ * @return  monotonic host time in ns
+ */
+static uint64_t SIL_GetHostTime_ns(void);
+
+/**
+ * @brief   Reads a numeric value from the environment.
+ * @param   pName           name of the environment variable
+ * @param   defaultValue    value if the variable is not set or invalid
+ * @param   minimum         smallest valid value
+ * @param   maximum         largest valid value
+ * @return  value of the environment variable or the default value
+ */
+static uint32_t SIL_GetEnvironmentValue(const char *pName, uint32_t defaultValue, uint32_t minimum, uint32_t maximum);
+
+/**
+ * @brief   Speeds up the tick timer of the POSIX port by the time scale.
+ * @details The port starts a timer with the tick period of the target when
+ *          the scheduler starts, therefore this is done with the first tick.
+ */
+static void SIL_ScaleTickTimer(void);
+
+/**
+ * @brief   Advances the time base of the simulation by one tick.
+ */
+static void SIL_AdvanceTimeBase(void);
+
+/*========== Static Function Implementations ================================*/
+static uint64_t SIL_GetHostTime_ns(void) {
+    struct timespec now = {0};
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+static uint32_t SIL_GetEnvironmentValue(const char *pName, uint32_t defaultValue, uint32_t minimum, uint32_t maximum) {
+    FAS_ASSERT(pName != NULL_PTR);
+    uint32_t value     = defaultValue;
+    const char *pValue = getenv(pName);
+    if (pValue != NULL_PTR) {
+        char *pEnd                 = NULL_PTR;
+        const unsigned long parsed = strtoul(pValue, &pEnd, 10);
+        if ((pEnd != pValue) && (*pEnd == '\0') && (parsed >= minimum) && (parsed <= maximum)) {
+            value = (uint32_t)parsed;
+        } else {
+            (void)fprintf(
+                stderr,
+                "foxBMS SIL: invalid value '%s' of %s (%u to %u), using %u\n",
+                pValue,
+                pName,
+                minimum,
+                maximum,
+                defaultValue);
+        }
+    }
+    return value;
+}
+
+static void SIL_ScaleTickTimer(void) {
+    const uint32_t tickPeriod_us = (uint32_t)(SIL_TICK_PERIOD_ns / 1000u);
+    struct itimerval timer       = {0};
+    timer.it_interval.tv_usec    = (suseconds_t)(tickPeriod_us / sil_config.timeScale);
+    if (timer.it_interval.tv_usec == 0) {
+        timer.it_interval.tv_usec = 1;
+    }
+    timer.it_value = timer.it_interval;
+    (void)setitimer(ITIMER_REAL, &timer, NULL_PTR);
+}
+
+static void SIL_AdvanceTimeBase(void) {
+    const uint64_t now_ns = SIL_GetHostTime_ns();
+    __atomic_add_fetch(&sil_timeBase.sequence, 1u, __ATOMIC_ACQ_REL);
+    if (sil_timeBase.isTicking == false) {
+        /* continue with the time that has been simulated before the scheduler started */
+        sil_timeBase.simulated_ns += (now_ns - sil_timeBase.host_ns) * sil_config.timeScale;
+        sil_timeBase.isTicking = true;
+    } else {
+        sil_timeBase.simulated_ns += SIL_TICK_PERIOD_ns;
+    }
+    sil_timeBase.host_ns = now_ns;
+    __atomic_add_fetch(&sil_timeBase.sequence, 1u, __ATOMIC_ACQ_REL);
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void SIL_Initialize(void) {
+    sil_config.timeScale = SIL_GetEnvironmentValue(
+        "FOXBMS_SIL_TIME_SCALE", SIL_DEFAULT_TIME_SCALE, 1u, SIL_MAXIMUM_TIME_SCALE);
+    sil_config.duration_ms = SIL_GetEnvironmentValue("FOXBMS_SIL_DURATION_MS", 0u, 0u, UINT32_MAX);
+    if (getenv("FOXBMS_SIL_FRAM_FILE") != NULL_PTR) {
+        sil_config.pFramFile = getenv("FOXBMS_SIL_FRAM_FILE");
+    }
+    sil_config.pCanInterface = getenv("FOXBMS_SIL_CAN_INTERFACE");
+
+    sil_timeBase.host_ns = SIL_GetHostTime_ns();
+
+    SIL_FramInitialize(sil_config.pFramFile);
+    SIL_CanInitialize(sil_config.pCanInterface);
+}
+
+extern uint64_t SIL_GetSimulatedTime_ns(void) {
+    uint32_t sequence     = 0u;
+    uint64_t simulated_ns = 0u;
+    do {
+        sequence                  = __atomic_load_n(&sil_timeBase.sequence, __ATOMIC_ACQUIRE);
+        const uint64_t host_ns    = SIL_GetHostTime_ns();
+        const uint64_t elapsed_ns = (host_ns - sil_timeBase.host_ns) * sil_config.timeScale;
+        simulated_ns              = sil_timeBase.simulated_ns;
+        if ((sil_timeBase.isTicking == true) && (elapsed_ns > SIL_TICK_PERIOD_ns)) {
+            /* the next tick is late, do not run ahead of the operating system */
+            simulated_ns += SIL_TICK_PERIOD_ns;
+        } else {
+            simulated_ns += elapsed_ns;
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    } while (((sequence & 1u) != 0u) || (sequence != __atomic_load_n(&sil_timeBase.sequence, __ATOMIC_ACQUIRE)));
+    return simulated_ns;
+}
+
+extern uint32_t SIL_GetFreeRunningCount(void) {
+    /* the counter wraps around like the 32-bit register of the target */
+    return (uint32_t)(((unsigned __int128)SIL_GetSimulatedTime_ns() * SIL_FRC_FREQUENCY_kHz) / SIL_NS_PER_MS);
+}
+
+extern uint32_t SIL_GetCycleCount(void) {
+    return (uint32_t)(((unsigned __int128)SIL_GetSimulatedTime_ns() * SIL_GCLK_FREQUENCY_kHz) / SIL_NS_PER_MS);
+}
+
+extern void SIL_Exit(int status) {
+    SIL_FramFlush();
+    const SIL_CAN_STATISTICS_s *pCanStatistics = SIL_CanGetStatistics();
+    (void)fprintf(
+        stderr,
+        "foxBMS SIL: stopped after %u ms (CAN: %u messages sent, %u received, %u dropped)\n",
+        (unsigned int)(SIL_GetSimulatedTime_ns() / SIL_NS_PER_MS),
+        (unsigned int)pCanStatistics->txMessages,
+        (unsigned int)pCanStatistics->rxMessages,
+        (unsigned int)pCanStatistics->droppedMessages);
+    /* the process may be left from the tick hook, i.e., from a signal handler */
+    _exit(status);
+}
+
+extern void SIL_Abort(const char *pFile, int line) {
+    (void)fprintf(stderr, "foxBMS SIL: assertion failed in %s:%d\n", pFile, line);
+    SIL_Exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief   Tick hook of the operating system that drives the simulation.
+ * @details Called by the POSIX port with every tick from the timer signal
+ *          handler, i.e., with the semantics of an interrupt.
+ */
+void vApplicationTickHook(void) {
+    if (sil_timeBase.isTicking == false) {
+        SIL_ScaleTickTimer();
+    }
+    SIL_AdvanceTimeBase();
+    SIL_CanProcessRxMessages();
+    SIL_SpiProcessDmaTransfers();
+
+    sil_elapsedTicks++;
+    if ((sil_config.duration_ms > 0u) && ((sil_elapsedTicks * portTICK_PERIOD_MS) >= sil_config.duration_ms)) {
+        SIL_Exit(EXIT_SUCCESS);
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -0,0 +1,133 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Core of the software-in-the-loop (SIL) build
+ *
+ * @details The SIL build runs the application on the FreeRTOS POSIX port on a Linux
+ *          host. This module reads the configuration of the simulation from the
+ *          environment, provides the simulated time base and drives the simulated
+ *          peripherals from the tick hook of the operating system.
+ *
+ */
+
+#ifndef FOXBMS__SIL_H_
+#define FOXBMS__SIL_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+/*========== Macros and Definitions =========================================*/
+/** default ratio of simulated time to host time */
+#define SIL_DEFAULT_TIME_SCALE (10u)
+
+/** largest supported ratio of simulated time to host time */
+#define SIL_MAXIMUM_TIME_SCALE (1000u)
+
+/** default file that backs the simulated FRAM */
+#define SIL_DEFAULT_FRAM_FILE "foxbms-sil-fram.bin"
+
+/** configuration of the simulation */
+typedef struct SIL_CONFIG {
+    uint32_t timeScale;        /*!< simulated time per host time (FOXBMS_SIL_TIME_SCALE) */
+    uint32_t duration_ms;      /*!< simulated duration in ms, 0 runs forever (FOXBMS_SIL_DURATION_MS) */
+    const char *pFramFile;     /*!< file that backs the FRAM (FOXBMS_SIL_FRAM_FILE) */
+    const char *pCanInterface; /*!< SocketCAN interface or NULL_PTR for the in-process bus
+                                    (FOXBMS_SIL_CAN_INTERFACE) */
+} SIL_CONFIG_s;
+
+/*========== Extern Constant and Variable Declarations ======================*/
+/** configuration of the simulation */
+extern SIL_CONFIG_s sil_config;
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Initializes the simulation.
+ * @details Reads the configuration from the environment and initializes the
+ *          simulated FRAM and CAN bus. Has to be called first in main().
+ */
+extern void SIL_Initialize(void);
+
+/**
+ * @brief   Returns the simulated time since the start of the simulation.
+ * @return  simulated time in ns
+ */
+extern uint64_t SIL_GetSimulatedTime_ns(void);
+
+/**
+ * @brief   Returns the simulated Free Running Counter 0 (FRC0) of the RTI.
+ * @details The counter runs with half of the peripheral clock (AVCLK1), as
+ *          configured on the target.
+ * @return  simulated value of FRC0
+ */
+extern uint32_t SIL_GetFreeRunningCount(void);
+
+/**
+ * @brief   Returns the simulated cycle counter of the CPU.
+ * @return  simulated CPU clock cycles (GCLK) since the start of the simulation
+ */
+extern uint32_t SIL_GetCycleCount(void);
+
+/**
+ * @brief   Stops the simulation.
+ * @details Writes the simulated FRAM back to its file and terminates the
+ *          process. Can be called from the tick hook.
+ * @param   status  exit status of the process
+ */
+extern void SIL_Exit(int status);
+
+/**
+ * @brief   Terminates the simulation after a failed assertion.
+ * @param   pFile   file of the failed assertion
+ * @param   line    line of the failed assertion
+ */
+extern void SIL_Abort(const char *pFile, int line);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__SIL_H_ */
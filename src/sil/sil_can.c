@@ -0,0 +1,275 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil_can.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Virtual CAN bus of the software-in-the-loop (SIL) build
+ *
+ * @details The message boxes of the HAL are kept in RAM. Transmissions complete
+ *          immediately, received messages are passed to the application in the tick
+ *          hook, i.e., with the semantics of the receive interrupt.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "sil_can.h"
+
+#include "HL_can.h"
+
+#include "can.h"
+#include "sil.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <net/if.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/*========== Macros and Definitions =========================================*/
+/** message box in which received messages are stored */
+#define SIL_CAN_RX_MESSAGE_BOX (CAN_NR_OF_TX_MESSAGEBOX + 1u)
+
+/** position of the standard identifier in the arbitration value of a message box */
+#define SIL_CAN_STANDARD_ID_SHIFT (18u)
+
+/** message box of the HAL */
+typedef struct SIL_CAN_MESSAGE_BOX {
+    uint32_t arbitrationValue;         /*!< arbitration value as set with canUpdateID() */
+    bool hasNewData;                   /*!< true if the data has not been read yet */
+    uint8_t data[SIL_CAN_MAXIMUM_DLC]; /*!< data bytes */
+} SIL_CAN_MESSAGE_BOX_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** message boxes of all nodes, box 1 is stored at index 0 */
+static SIL_CAN_MESSAGE_BOX_s sil_canMessageBoxes[SIL_CAN_NR_OF_NODES][SIL_CAN_NR_OF_MESSAGE_BOXES] = {0};
+
+/** socket of the SocketCAN interface, -1 for the in-process bus */
+static int sil_canSocket = -1;
+
+/** receive queue of the in-process bus (single producer, single consumer) */
+static SIL_CAN_MESSAGE_s sil_canRxQueue[SIL_CAN_RX_QUEUE_LENGTH] = {0};
+
+/** write index of the receive queue, only written by the producer */
+static uint32_t sil_canRxQueueHead = 0u;
+
+/** read index of the receive queue, only written in the tick hook */
+static uint32_t sil_canRxQueueTail = 0u;
+
+/** callback for messages sent on the in-process bus */
+static SIL_CAN_TX_CALLBACK_f sil_canTxCallback = NULL_PTR;
+
+/** statistics of the virtual CAN bus */
+static SIL_CAN_STATISTICS_s sil_canStatistics = {0u, 0u, 0u};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+canBASE_t sil_canRegisters[SIL_CAN_NR_OF_NODES] = {0};
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Returns a message box of the HAL.
+ * @param   node        CAN node
+ * @param   messageBox  message box (1 to 64)
+ * @return  pointer to the message box
+ */
+static SIL_CAN_MESSAGE_BOX_s *SIL_CanGetMessageBox(const canBASE_t *node, uint32 messageBox);
+
+/**
+ * @brief   Fetches the next received message.
+ * @param   pMessage    received message
+ * @return  true if a message has been fetched, false otherwise
+ */
+static bool SIL_CanReceiveMessage(SIL_CAN_MESSAGE_s *pMessage);
+
+/*========== Static Function Implementations ================================*/
+static SIL_CAN_MESSAGE_BOX_s *SIL_CanGetMessageBox(const canBASE_t *node, uint32 messageBox) {
+    FAS_ASSERT((node >= &sil_canRegisters[0u]) && (node < &sil_canRegisters[SIL_CAN_NR_OF_NODES]));
+    FAS_ASSERT((messageBox >= 1u) && (messageBox <= SIL_CAN_NR_OF_MESSAGE_BOXES));
+    return &sil_canMessageBoxes[node - &sil_canRegisters[0u]][messageBox - 1u];
+}
+
+static bool SIL_CanReceiveMessage(SIL_CAN_MESSAGE_s *pMessage) {
+    FAS_ASSERT(pMessage != NULL_PTR);
+    bool isReceived = false;
+    if (sil_canSocket >= 0) {
+        struct can_frame frame = {0};
+        /* non-blocking read, all other frames are received with the next tick */
+        if ((read(sil_canSocket, &frame, sizeof(frame)) == (ssize_t)sizeof(frame)) &&
+            ((frame.can_id & (CAN_EFF_FLAG | CAN_RTR_FLAG | CAN_ERR_FLAG)) == 0u)) {
+            pMessage->id  = frame.can_id & CAN_SFF_MASK;
+            pMessage->dlc = (frame.can_dlc <= SIL_CAN_MAXIMUM_DLC) ? frame.can_dlc : SIL_CAN_MAXIMUM_DLC;
+            (void)memcpy(pMessage->data, frame.data, SIL_CAN_MAXIMUM_DLC);
+            isReceived = true;
+        }
+    } else {
+        const uint32_t tail = sil_canRxQueueTail;
+        if (tail != __atomic_load_n(&sil_canRxQueueHead, __ATOMIC_ACQUIRE)) {
+            *pMessage = sil_canRxQueue[tail % SIL_CAN_RX_QUEUE_LENGTH];
+            __atomic_store_n(&sil_canRxQueueTail, tail + 1u, __ATOMIC_RELEASE);
+            isReceived = true;
+        }
+    }
+    return isReceived;
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void SIL_CanInitialize(const char *pInterface) {
+    if (pInterface != NULL_PTR) {
+        struct ifreq interfaceRequest = {0};
+        struct sockaddr_can address   = {0};
+        sil_canSocket                 = socket(PF_CAN, SOCK_RAW, CAN_RAW);
+        (void)strncpy(interfaceRequest.ifr_name, pInterface, IFNAMSIZ - 1u);
+        if ((sil_canSocket < 0) || (ioctl(sil_canSocket, SIOCGIFINDEX, &interfaceRequest) < 0)) {
+            (void)fprintf(stderr, "foxBMS SIL: CAN interface '%s' not available (%s)\n", pInterface, strerror(errno));
+            SIL_Exit(EXIT_FAILURE);
+        }
+        address.can_family  = AF_CAN;
+        address.can_ifindex = interfaceRequest.ifr_ifindex;
+        if ((bind(sil_canSocket, (struct sockaddr *)&address, sizeof(address)) < 0) ||
+            (fcntl(sil_canSocket, F_SETFL, O_NONBLOCK) < 0)) {
+            (void)fprintf(stderr, "foxBMS SIL: CAN interface '%s' not usable (%s)\n", pInterface, strerror(errno));
+            SIL_Exit(EXIT_FAILURE);
+        }
+    }
+}
+
+extern STD_RETURN_TYPE_e SIL_CanInjectRxMessage(const SIL_CAN_MESSAGE_s *pMessage) {
+    FAS_ASSERT(pMessage != NULL_PTR);
+    FAS_ASSERT(pMessage->dlc <= SIL_CAN_MAXIMUM_DLC);
+    STD_RETURN_TYPE_e retVal = STD_NOT_OK;
+    const uint32_t head      = sil_canRxQueueHead;
+    if ((head - __atomic_load_n(&sil_canRxQueueTail, __ATOMIC_ACQUIRE)) < SIL_CAN_RX_QUEUE_LENGTH) {
+        sil_canRxQueue[head % SIL_CAN_RX_QUEUE_LENGTH] = *pMessage;
+        __atomic_store_n(&sil_canRxQueueHead, head + 1u, __ATOMIC_RELEASE);
+        retVal = STD_OK;
+    } else {
+        __atomic_add_fetch(&sil_canStatistics.droppedMessages, 1u, __ATOMIC_RELAXED);
+    }
+    return retVal;
+}
+
+extern void SIL_CanSetTxCallback(SIL_CAN_TX_CALLBACK_f callback) {
+    sil_canTxCallback = callback;
+}
+
+extern void SIL_CanProcessRxMessages(void) {
+    SIL_CAN_MESSAGE_s message = {0};
+    for (uint32_t i = 0u; (i < SIL_CAN_MAXIMUM_RX_MESSAGES_PER_TICK) && SIL_CanReceiveMessage(&message); i++) {
+        SIL_CAN_MESSAGE_BOX_s *pBox = SIL_CanGetMessageBox(CAN0_NODE, SIL_CAN_RX_MESSAGE_BOX);
+        pBox->arbitrationValue      = message.id << SIL_CAN_STANDARD_ID_SHIFT;
+        (void)memset(pBox->data, 0, SIL_CAN_MAXIMUM_DLC);
+        (void)memcpy(pBox->data, message.data, message.dlc);
+        pBox->hasNewData = true;
+        sil_canStatistics.rxMessages++;
+        canMessageNotification(CAN0_NODE, SIL_CAN_RX_MESSAGE_BOX);
+    }
+}
+
+extern const SIL_CAN_STATISTICS_s *SIL_CanGetStatistics(void) {
+    return &sil_canStatistics;
+}
+
+void canInit(void) {
+    (void)memset(sil_canMessageBoxes, 0, sizeof(sil_canMessageBoxes));
+}
+
+uint32 canTransmit(canBASE_t *node, uint32 messageBox, const uint8 *data) {
+    FAS_ASSERT(data != NULL_PTR);
+    SIL_CAN_MESSAGE_BOX_s *pBox = SIL_CanGetMessageBox(node, messageBox);
+    SIL_CAN_MESSAGE_s message   = {
+        .id  = (pBox->arbitrationValue >> SIL_CAN_STANDARD_ID_SHIFT) & CAN_SFF_MASK,
+        .dlc = SIL_CAN_MAXIMUM_DLC,
+    };
+    (void)memcpy(message.data, data, SIL_CAN_MAXIMUM_DLC);
+    bool isSent = false;
+    if (sil_canSocket >= 0) {
+        struct can_frame frame = {.can_id = message.id, .can_dlc = message.dlc};
+        (void)memcpy(frame.data, message.data, SIL_CAN_MAXIMUM_DLC);
+        isSent = (write(sil_canSocket, &frame, sizeof(frame)) == (ssize_t)sizeof(frame));
+    } else if (sil_canTxCallback != NULL_PTR) {
+        sil_canTxCallback(&message);
+        isSent = true;
+    } else {
+        /* nobody listens on the in-process bus */
+        isSent = true;
+    }
+    if (isSent == true) {
+        __atomic_add_fetch(&sil_canStatistics.txMessages, 1u, __ATOMIC_RELAXED);
+    } else {
+        __atomic_add_fetch(&sil_canStatistics.droppedMessages, 1u, __ATOMIC_RELAXED);
+    }
+    return 1u;
+}
+
+uint32 canGetData(canBASE_t *node, uint32 messageBox, uint8 *const data) {
+    FAS_ASSERT(data != NULL_PTR);
+    SIL_CAN_MESSAGE_BOX_s *pBox = SIL_CanGetMessageBox(node, messageBox);
+    (void)memcpy(data, pBox->data, SIL_CAN_MAXIMUM_DLC);
+    const uint32 hasNewData = (pBox->hasNewData == true) ? 1u : 0u;
+    pBox->hasNewData        = false;
+    return hasNewData;
+}
+
+uint32 canIsTxMessagePending(canBASE_t *node, uint32 messageBox) {
+    (void)SIL_CanGetMessageBox(node, messageBox);
+    return 0u;
+}
+
+void canUpdateID(canBASE_t *node, uint32 messageBox, uint32 msgBoxArbitVal) {
+    SIL_CanGetMessageBox(node, messageBox)->arbitrationValue = msgBoxArbitVal;
+}
+
+uint32 canGetID(canBASE_t *node, uint32 messageBox) {
+    return SIL_CanGetMessageBox(node, messageBox)->arbitrationValue;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -0,0 +1,136 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil_can.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Virtual CAN bus of the software-in-the-loop (SIL) build
+ *
+ * @details Implements the CAN driver of the HAL on the host. The messages are either
+ *          exchanged on a SocketCAN interface (e.g., a vcan interface) or on an
+ *          in-process bus, on which messages are injected with
+ *          #SIL_CanInjectRxMessage() and transmitted messages are passed to the
+ *          callback set with #SIL_CanSetTxCallback().
+ *
+ */
+
+#ifndef FOXBMS__SIL_CAN_H_
+#define FOXBMS__SIL_CAN_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+/*========== Macros and Definitions =========================================*/
+/** number of data bytes of a CAN message */
+#define SIL_CAN_MAXIMUM_DLC (8u)
+
+/** length of the receive queue of the in-process bus */
+#define SIL_CAN_RX_QUEUE_LENGTH (256u)
+
+/** largest number of messages that are received per tick */
+#define SIL_CAN_MAXIMUM_RX_MESSAGES_PER_TICK (32u)
+
+/** CAN message on the virtual bus, only standard identifiers are supported */
+typedef struct SIL_CAN_MESSAGE {
+    uint32_t id;                       /*!< standard identifier */
+    uint8_t dlc;                       /*!< number of data bytes */
+    uint8_t data[SIL_CAN_MAXIMUM_DLC]; /*!< data bytes */
+} SIL_CAN_MESSAGE_s;
+
+/** statistics of the virtual CAN bus */
+typedef struct SIL_CAN_STATISTICS {
+    uint32_t txMessages;      /*!< messages sent by the application */
+    uint32_t rxMessages;      /*!< messages passed to the application */
+    uint32_t droppedMessages; /*!< messages that could not be queued or sent */
+} SIL_CAN_STATISTICS_s;
+
+/** callback for messages that are sent on the in-process bus */
+typedef void (*SIL_CAN_TX_CALLBACK_f)(const SIL_CAN_MESSAGE_s *pMessage);
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Initializes the virtual CAN bus.
+ * @param   pInterface  name of the SocketCAN interface or NULL_PTR for the
+ *                      in-process bus
+ */
+extern void SIL_CanInitialize(const char *pInterface);
+
+/**
+ * @brief   Queues a message on the in-process bus for the application.
+ * @details The message is passed to the application with the next tick. The
+ *          queue supports one producer thread.
+ * @param   pMessage    message to be received by the application
+ * @return  #STD_OK if the message has been queued, #STD_NOT_OK if the queue
+ *          is full
+ */
+extern STD_RETURN_TYPE_e SIL_CanInjectRxMessage(const SIL_CAN_MESSAGE_s *pMessage);
+
+/**
+ * @brief   Sets the callback for messages sent on the in-process bus.
+ * @details The callback is called in the context of the sending task.
+ * @param   callback    callback or NULL_PTR to discard sent messages
+ */
+extern void SIL_CanSetTxCallback(SIL_CAN_TX_CALLBACK_f callback);
+
+/**
+ * @brief   Passes the received messages to the application.
+ * @details Called from the tick hook. Every message is stored in the first
+ *          receive message box of the node and #canMessageNotification() is
+ *          called, as by the receive interrupt on the target.
+ */
+extern void SIL_CanProcessRxMessages(void);
+
+/**
+ * @brief   Returns the statistics of the virtual CAN bus.
+ * @return  pointer to the statistics
+ */
+extern const SIL_CAN_STATISTICS_s *SIL_CanGetStatistics(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__SIL_CAN_H_ */
@@ -0,0 +1,194 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil_fram.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Simulated FRAM of the software-in-the-loop (SIL) build
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "sil_fram.h"
+
+#include "sil.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*========== Macros and Definitions =========================================*/
+/** @{
+ * opcodes of the FRAM
+ */
+#define SIL_FRAM_WRITE_ENABLE_OPCODE (0x06u)
+#define SIL_FRAM_WRITE_OPCODE        (0x02u)
+#define SIL_FRAM_READ_OPCODE         (0x03u)
+/** @} */
+
+/** number of address bytes that follow the READ and WRITE opcodes */
+#define SIL_FRAM_ADDRESS_LENGTH (3u)
+
+/** states of a transaction */
+typedef enum SIL_FRAM_STATE {
+    SIL_FRAM_STATE_DESELECTED, /*!< chip select inactive */
+    SIL_FRAM_STATE_OPCODE,     /*!< waiting for the opcode */
+    SIL_FRAM_STATE_ADDRESS,    /*!< receiving the address */
+    SIL_FRAM_STATE_DATA,       /*!< reading or writing data */
+    SIL_FRAM_STATE_IGNORE,     /*!< ignoring the rest of the transaction */
+} SIL_FRAM_STATE_e;
+
+/** state of the simulated FRAM */
+typedef struct SIL_FRAM {
+    uint8_t *pMemory;       /*!< memory mapped from the file */
+    SIL_FRAM_STATE_e state; /*!< state of the current transaction */
+    uint8_t opcode;         /*!< opcode of the current transaction */
+    uint8_t addressBytes;   /*!< number of received address bytes */
+    uint32_t address;       /*!< current address */
+    bool isWriteEnabled;    /*!< write enable latch */
+} SIL_FRAM_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** state of the simulated FRAM */
+static SIL_FRAM_s sil_fram = {
+    .pMemory        = NULL_PTR,
+    .state          = SIL_FRAM_STATE_DESELECTED,
+    .opcode         = 0u,
+    .addressBytes   = 0u,
+    .address        = 0u,
+    .isWriteEnabled = false,
+};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+extern void SIL_FramInitialize(const char *pFile) {
+    FAS_ASSERT(pFile != NULL_PTR);
+    const int file = open(pFile, O_RDWR | O_CREAT, 0644);
+    if ((file < 0) || (ftruncate(file, (off_t)SIL_FRAM_SIZE) < 0)) {
+        (void)fprintf(stderr, "foxBMS SIL: FRAM file '%s' not usable (%s)\n", pFile, strerror(errno));
+        SIL_Exit(EXIT_FAILURE);
+    }
+    void *pMemory = mmap(NULL_PTR, SIL_FRAM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    (void)close(file);
+    if (pMemory == MAP_FAILED) {
+        (void)fprintf(stderr, "foxBMS SIL: FRAM file '%s' not mappable (%s)\n", pFile, strerror(errno));
+        SIL_Exit(EXIT_FAILURE);
+    }
+    sil_fram.pMemory = (uint8_t *)pMemory;
+}
+
+extern void SIL_FramSetChipSelect(bool isSelected) {
+    if (isSelected == true) {
+        sil_fram.state        = SIL_FRAM_STATE_OPCODE;
+        sil_fram.addressBytes = 0u;
+        sil_fram.address      = 0u;
+    } else {
+        if ((sil_fram.state == SIL_FRAM_STATE_DATA) && (sil_fram.opcode == SIL_FRAM_WRITE_OPCODE)) {
+            /* the write enable latch is reset by the completion of a write */
+            sil_fram.isWriteEnabled = false;
+        }
+        sil_fram.state = SIL_FRAM_STATE_DESELECTED;
+    }
+}
+
+extern uint16_t SIL_FramTransferWord(uint16_t txWord) {
+    const uint8_t txByte = (uint8_t)(txWord & 0xFFu);
+    uint16_t rxWord      = 0u;
+    switch (sil_fram.state) {
+        case SIL_FRAM_STATE_OPCODE:
+            sil_fram.opcode = txByte;
+            if (txByte == SIL_FRAM_WRITE_ENABLE_OPCODE) {
+                sil_fram.isWriteEnabled = true;
+                sil_fram.state          = SIL_FRAM_STATE_IGNORE;
+            } else if ((txByte == SIL_FRAM_WRITE_OPCODE) || (txByte == SIL_FRAM_READ_OPCODE)) {
+                sil_fram.state = SIL_FRAM_STATE_ADDRESS;
+            } else {
+                sil_fram.state = SIL_FRAM_STATE_IGNORE;
+            }
+            break;
+        case SIL_FRAM_STATE_ADDRESS:
+            sil_fram.address = (sil_fram.address << 8u) | txByte;
+            sil_fram.addressBytes++;
+            if (sil_fram.addressBytes == SIL_FRAM_ADDRESS_LENGTH) {
+                sil_fram.address %= SIL_FRAM_SIZE;
+                sil_fram.state = SIL_FRAM_STATE_DATA;
+            }
+            break;
+        case SIL_FRAM_STATE_DATA:
+            if (sil_fram.opcode == SIL_FRAM_READ_OPCODE) {
+                rxWord = sil_fram.pMemory[sil_fram.address];
+            } else if (sil_fram.isWriteEnabled == true) {
+                sil_fram.pMemory[sil_fram.address] = txByte;
+            } else {
+                /* write protected, the data is discarded */
+            }
+            /* the address rolls over at the end of the memory */
+            sil_fram.address = (sil_fram.address + 1u) % SIL_FRAM_SIZE;
+            break;
+        default:
+            /* deselected or ignored transaction, the FRAM does not drive its output */
+            break;
+    }
+    return rxWord;
+}
+
+extern void SIL_FramFlush(void) {
+    if (sil_fram.pMemory != NULL_PTR) {
+        (void)msync(sil_fram.pMemory, SIL_FRAM_SIZE, MS_SYNC);
+    }
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
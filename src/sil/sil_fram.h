@@ -0,0 +1,100 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil_fram.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Simulated FRAM of the software-in-the-loop (SIL) build
+ *
+ * @details Models the SPI protocol of the FRAM (opcodes WREN, WRITE and READ with
+ *          three address bytes). The memory is mapped from a file, so that the
+ *          content persists between runs of the simulation, as on the target.
+ *
+ */
+
+#ifndef FOXBMS__SIL_FRAM_H_
+#define FOXBMS__SIL_FRAM_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+/*========== Macros and Definitions =========================================*/
+/** size of the simulated FRAM in bytes (4 Mbit) */
+#define SIL_FRAM_SIZE (512u * 1024u)
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Maps the file that backs the simulated FRAM.
+ * @details The file is created and zero-filled if it does not exist.
+ * @param   pFile   path of the file
+ */
+extern void SIL_FramInitialize(const char *pFile);
+
+/**
+ * @brief   Sets the chip select of the FRAM.
+ * @details A transaction starts with the falling edge and ends with the
+ *          rising edge of the chip select.
+ * @param   isSelected  true if the chip select is active (low)
+ */
+extern void SIL_FramSetChipSelect(bool isSelected);
+
+/**
+ * @brief   Transfers one word to and from the FRAM.
+ * @param   txWord  transmitted word, only the lower byte is used
+ * @return  received word
+ */
+extern uint16_t SIL_FramTransferWord(uint16_t txWord);
+
+/**
+ * @brief   Writes the simulated FRAM back to its file.
+ */
+extern void SIL_FramFlush(void);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__SIL_FRAM_H_ */
@@ -0,0 +1,156 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil_hal.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Simulated system peripherals of the software-in-the-loop (SIL) build
+ *
+ * @details Implements the GIO, HET, system, core and PMU functions of the HAL and the
+ *          software interrupts of the application on the host. The ports are plain
+ *          variables: outputs are not connected to anything and inputs read back the
+ *          output value.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "HL_gio.h"
+#include "HL_het.h"
+#include "HL_sys_core.h"
+#include "HL_sys_pmu.h"
+#include "HL_system.h"
+
+#include "fassert.h"
+#include "fsystem.h"
+#include "sil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** value of the cycle counter at its last reset */
+static uint32_t sil_pmuCycleCounterOffset = 0u;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+gioPORT_t sil_gioPorts[2u] = {0};
+
+hetBASE_t sil_hetRegisters[2u] = {0};
+
+systemBASE1_t sil_systemRegisters = {0};
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+void gioInit(void) {
+    (void)memset((void *)sil_gioPorts, 0, sizeof(sil_gioPorts));
+    (void)memset((void *)sil_hetRegisters, 0, sizeof(sil_hetRegisters));
+}
+
+void gioSetBit(gioPORT_t *port, uint32 bit, uint32 value) {
+    FAS_ASSERT(port != NULL_PTR);
+    if (value != 0u) {
+        port->DOUT |= (uint32)1u << bit;
+    } else {
+        port->DOUT &= ~((uint32)1u << bit);
+    }
+}
+
+uint32 gioGetBit(gioPORT_t *port, uint32 bit) {
+    FAS_ASSERT(port != NULL_PTR);
+    return (port->DOUT >> bit) & 1u;
+}
+
+void gioToggleBit(gioPORT_t *port, uint32 bit) {
+    FAS_ASSERT(port != NULL_PTR);
+    port->DOUT ^= (uint32)1u << bit;
+}
+
+resetSource_t getResetSource(void) {
+    return POWERON_RESET;
+}
+
+void _enable_IRQ_interrupt_(void) {
+}
+
+void _pmuInit_(void) {
+}
+
+void _pmuEnableCountersGlobal_(void) {
+}
+
+void _pmuResetCycleCounter_(void) {
+    sil_pmuCycleCounterOffset = SIL_GetCycleCount();
+}
+
+void _pmuStartCounters_(uint32 counters) {
+    (void)counters;
+}
+
+uint32 _pmuGetCycleCount_(void) {
+    return SIL_GetCycleCount() - sil_pmuCycleCounterOffset;
+}
+
+/** the tasks always run privileged on the host */
+long FSYS_RaisePrivilege(void) {
+    return 0;
+}
+
+/** an assertion of the application failed, the simulation is stopped */
+void FAS_DisableInterrupts(void) {
+    (void)fprintf(
+        stderr,
+        "foxBMS SIL: assertion failed (caller %p, line %u)\n",
+        (void *)fas_assertLocation.pc,
+        (unsigned int)fas_assertLocation.line);
+    SIL_Exit(EXIT_FAILURE);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -0,0 +1,120 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil_sbc.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Simulated system basis chip (SBC) of the software-in-the-loop (SIL) build
+ *
+ * @details Replaces the FS85xx driver (nxpfs85xx.c): the simulated SBC accepts the
+ *          configuration, has no pending faults and every watchdog refresh is good, so
+ *          that the SBC state machine reaches its running state as on a healthy board.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "nxpfs85xx.h"
+
+#include "HL_system.h"
+
+#include "fram.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Static Constant and Variable Definitions =======================*/
+
+/*========== Extern Constant and Variable Definitions =======================*/
+FS85xx_STATE_s fs85xx_mcuSupervisor = {
+    .pSpiInterface                  = &spi_kSbcMcuInterface,
+    .configValues.watchdogSeed      = FS8x_WD_SEED_DEFAULT,
+    .configValues.communicationMode = fs8xSPI,
+    .configValues.i2cAddressOtp     = 0, /* Not used as SPI is selected */
+    .fin.finUsed                    = true,
+    .fin.finState                   = STD_NOT_OK,
+    .fin.pGIOport                   = &(systemREG1->SYSPC4),
+    .fin.pin                        = 0,
+    .mainRegister                   = {0},
+    .fsRegister                     = {0},
+    .nvram.entry                    = FRAM_BLOCK_ID_SBC_INIT_STATE,
+    .nvram.data                     = &fram_sbcInit,
+    .mode                           = SBC_NORMAL_MODE,
+};
+
+/*========== Static Function Prototypes =====================================*/
+
+/*========== Static Function Implementations ================================*/
+
+/*========== Extern Function Implementations ================================*/
+extern STD_RETURN_TYPE_e FS85X_InitFS(FS85xx_STATE_s *pInstance) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+    pInstance->fin.finState = STD_OK;
+    return STD_OK;
+}
+
+extern STD_RETURN_TYPE_e FS85X_Init_ReqWDGRefreshes(FS85xx_STATE_s *pInstance, uint8_t *requiredWatchdogRefreshes) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+    FAS_ASSERT(requiredWatchdogRefreshes != NULL_PTR);
+    /* the fault error counter of the simulated SBC is always zero */
+    *requiredWatchdogRefreshes = 0u;
+    return STD_OK;
+}
+
+extern STD_RETURN_TYPE_e FS85X_CheckFaultErrorCounter(FS85xx_STATE_s *pInstance) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+    return STD_OK;
+}
+
+extern STD_RETURN_TYPE_e FS85X_SafetyPathChecks(FS85xx_STATE_s *pInstance) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+    return STD_OK;
+}
+
+extern STD_RETURN_TYPE_e SBC_TriggerWatchdog(FS85xx_STATE_s *pInstance) {
+    FAS_ASSERT(pInstance != NULL_PTR);
+    return STD_OK;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
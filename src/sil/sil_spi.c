@@ -0,0 +1,291 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil_spi.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Simulated SPI and DMA of the software-in-the-loop (SIL) build
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "sil_spi.h"
+
+#include "HL_spi.h"
+#include "HL_sys_dma.h"
+
+#include "dma_cfg.h"
+#include "spi_cfg.h"
+
+#include "fassert.h"
+#include "io.h"
+#include "spi.h"
+#include "sil_fram.h"
+
+#include <string.h>
+
+/*========== Macros and Definitions =========================================*/
+/** position of the number of frames in the transfer count of a control packet */
+#define SIL_DMA_FRAME_COUNT_SHIFT (16u)
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** state of the chip select of the FRAM */
+static bool sil_isFramSelected = false;
+
+/*========== Extern Constant and Variable Definitions =======================*/
+spiBASE_t sil_spiRegisters[SIL_SPI_NR_OF_NODES] = {0};
+
+dmaRAMBASE_t sil_dmaRam = {0};
+
+/*========== Static Function Prototypes =====================================*/
+/** @{
+ * original IO driver functions, resolved by the linker
+ */
+extern void __real_IO_PinSet(uint32_t *pRegisterAddress, uint32_t pin);
+extern void __real_IO_PinReset(uint32_t *pRegisterAddress, uint32_t pin);
+extern STD_RETURN_TYPE_e __real_SPI_TransmitReceiveDataDma(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+extern STD_RETURN_TYPE_e __real_SPI_TransmitReceiveDataWithDummyDma(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint32_t delay,
+    uint32_t wakeUpValidity_us,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+extern STD_RETURN_TYPE_e __real_SPI_TransmitReceiveDataDmaLocked(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+extern STD_RETURN_TYPE_e __real_SPI_TransmitReceiveDataDmaFromIsr(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+/** @} */
+
+/**
+ * @brief   Asserts that a buffer handed to the DMA has a 32-bit address.
+ * @details The SPI driver writes the buffer addresses into the 32-bit address
+ *          registers of the DMA control packets. On the host this only works
+ *          as long as the address survives the conversion to 32 bit.
+ * @param   pBuffer     buffer of a DMA transfer
+ */
+static void SIL_SpiAssertDmaAddress(const uint16_t *pBuffer);
+
+/**
+ * @brief   Transfers one word to and from the selected device.
+ * @param   spi     SPI node
+ * @param   txWord  transmitted word
+ * @return  received word
+ */
+static uint16 SIL_SpiTransferWord(const spiBASE_t *spi, uint16 txWord);
+
+/**
+ * @brief   Passes a change of a chip select to the device models.
+ * @param   pRegisterAddress    address of the port register that has changed
+ */
+static void SIL_SpiUpdateChipSelects(const uint32_t *pRegisterAddress);
+
+/*========== Static Function Implementations ================================*/
+static void SIL_SpiAssertDmaAddress(const uint16_t *pBuffer) {
+    const uintptr_t address = (uintptr_t)pBuffer;
+    FAS_ASSERT((uintptr_t)(uint32_t)address == address);
+}
+
+static uint16 SIL_SpiTransferWord(const spiBASE_t *spi, uint16 txWord) {
+    uint16 rxWord = 0u;
+    if ((spi == spi_framInterface.pNode) && (sil_isFramSelected == true)) {
+        rxWord = SIL_FramTransferWord(txWord);
+    }
+    return rxWord;
+}
+
+static void SIL_SpiUpdateChipSelects(const uint32_t *pRegisterAddress) {
+    if (pRegisterAddress == (const uint32_t *)spi_framInterface.pGioPort) {
+        /* the chip select is active low */
+        const bool isSelected = (IO_PinGet(pRegisterAddress, spi_framInterface.csPin) == 0u);
+        if (isSelected != sil_isFramSelected) {
+            sil_isFramSelected = isSelected;
+            SIL_FramSetChipSelect(isSelected);
+        }
+    }
+}
+
+/*========== Extern Function Implementations ================================*/
+extern void SIL_SpiProcessDmaTransfers(void) {
+    for (uint8_t i = 0u; i < DMA_NUMBER_SPI_INTERFACES; i++) {
+        spiBASE_t *pNode = dma_spiInterfaces[i];
+        if ((pNode->INT0 & DMAREQEN_BIT) != 0u) {
+            const dmaPCP_t *pTx        = &dmaRAMREG->PCP[dma_spiDmaChannels[i].txChannel];
+            const dmaPCP_t *pRx        = &dmaRAMREG->PCP[dma_spiDmaChannels[i].rxChannel];
+            const uint32_t frameLength = pTx->ITCOUNT >> SIL_DMA_FRAME_COUNT_SHIFT;
+            /* the addresses have been checked by the wrappers of the SPI driver */
+            const uint16 *pTxBuffer = (const uint16 *)(uintptr_t)pTx->ISADDR;
+            uint16 *pRxBuffer       = (uint16 *)(uintptr_t)pRx->IDADDR;
+            for (uint32_t word = 0u; word < frameLength; word++) {
+                pRxBuffer[word] = SIL_SpiTransferWord(pNode, pTxBuffer[word]);
+            }
+            dmaGroupANotification((dmaInterrupt_t)BTC, (uint32)dma_spiDmaChannels[i].rxChannel);
+        }
+    }
+}
+
+extern void __wrap_IO_PinSet(uint32_t *pRegisterAddress, uint32_t pin) {
+    __real_IO_PinSet(pRegisterAddress, pin);
+    SIL_SpiUpdateChipSelects(pRegisterAddress);
+}
+
+extern void __wrap_IO_PinReset(uint32_t *pRegisterAddress, uint32_t pin) {
+    __real_IO_PinReset(pRegisterAddress, pin);
+    SIL_SpiUpdateChipSelects(pRegisterAddress);
+}
+
+extern STD_RETURN_TYPE_e __wrap_SPI_TransmitReceiveDataDma(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength) {
+    SIL_SpiAssertDmaAddress(pTxBuff);
+    SIL_SpiAssertDmaAddress(pRxBuff);
+    return __real_SPI_TransmitReceiveDataDma(pSpiInterface, pTxBuff, pRxBuff, frameLength);
+}
+
+extern STD_RETURN_TYPE_e __wrap_SPI_TransmitReceiveDataWithDummyDma(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint32_t delay,
+    uint32_t wakeUpValidity_us,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength) {
+    SIL_SpiAssertDmaAddress(pTxBuff);
+    SIL_SpiAssertDmaAddress(pRxBuff);
+    return __real_SPI_TransmitReceiveDataWithDummyDma(
+        pSpiInterface, delay, wakeUpValidity_us, pTxBuff, pRxBuff, frameLength);
+}
+
+extern STD_RETURN_TYPE_e __wrap_SPI_TransmitReceiveDataDmaLocked(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength) {
+    SIL_SpiAssertDmaAddress(pTxBuff);
+    SIL_SpiAssertDmaAddress(pRxBuff);
+    return __real_SPI_TransmitReceiveDataDmaLocked(pSpiInterface, pTxBuff, pRxBuff, frameLength);
+}
+
+extern STD_RETURN_TYPE_e __wrap_SPI_TransmitReceiveDataDmaFromIsr(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength) {
+    SIL_SpiAssertDmaAddress(pTxBuff);
+    SIL_SpiAssertDmaAddress(pRxBuff);
+    return __real_SPI_TransmitReceiveDataDmaFromIsr(pSpiInterface, pTxBuff, pRxBuff, frameLength);
+}
+
+void spiInit(void) {
+    (void)memset((void *)sil_spiRegisters, 0, sizeof(sil_spiRegisters));
+    for (uint8_t i = 0u; i < SIL_SPI_NR_OF_NODES; i++) {
+        /* all chip selects inactive (high) */
+        sil_spiRegisters[i].PC3 = UINT32_MAX;
+    }
+    sil_isFramSelected = false;
+}
+
+uint32 spiTransmitData(spiBASE_t *spi, spiDAT1_t *dataconfig, uint32 blocksize, uint16 *srcbuff) {
+    FAS_ASSERT(dataconfig != NULL_PTR);
+    FAS_ASSERT(srcbuff != NULL_PTR);
+    for (uint32 word = 0u; word < blocksize; word++) {
+        (void)SIL_SpiTransferWord(spi, srcbuff[word]);
+    }
+    return 0u;
+}
+
+uint32 spiTransmitAndReceiveData(
+    spiBASE_t *spi,
+    spiDAT1_t *dataconfig,
+    uint32 blocksize,
+    uint16 *srcbuff,
+    uint16 *destbuff) {
+    FAS_ASSERT(dataconfig != NULL_PTR);
+    FAS_ASSERT(srcbuff != NULL_PTR);
+    FAS_ASSERT(destbuff != NULL_PTR);
+    for (uint32 word = 0u; word < blocksize; word++) {
+        destbuff[word] = SIL_SpiTransferWord(spi, srcbuff[word]);
+    }
+    return 0u;
+}
+
+void dmaEnable(void) {
+}
+
+void dmaReqAssign(dmaChannel_t channel, dmaRequest_t reqline) {
+    FAS_ASSERT(channel < SIL_DMA_NR_OF_CHANNELS);
+    (void)reqline;
+}
+
+void dmaSetCtrlPacket(dmaChannel_t channel, g_dmaCTRL g_dmaCTRLPKT) {
+    FAS_ASSERT(channel < SIL_DMA_NR_OF_CHANNELS);
+    /* only the initial addresses and counts of the primary control packets are simulated */
+    (void)g_dmaCTRLPKT;
+}
+
+void dmaSetChEnable(dmaChannel_t channel, dmaTriggerType_t type) {
+    FAS_ASSERT(channel < SIL_DMA_NR_OF_CHANNELS);
+    (void)type;
+}
+
+void dmaEnableInterrupt(dmaChannel_t channel, dmaInterrupt_t inttype, dmaIntGroup_t group) {
+    FAS_ASSERT(channel < SIL_DMA_NR_OF_CHANNELS);
+    (void)inttype;
+    (void)group;
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -0,0 +1,160 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    sil_spi.h
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup SIL
+ * @prefix  SIL
+ *
+ * @brief   Simulated SPI and DMA of the software-in-the-loop (SIL) build
+ *
+ * @details Implements the SPI and DMA drivers of the HAL on the host. The words are
+ *          exchanged with the device models, at the moment the FRAM. All other devices
+ *          do not answer, i.e., zeros are received. The chip selects are observed by
+ *          wrapping the IO driver at link time (--wrap=IO_PinSet,--wrap=IO_PinReset).
+ *
+ */
+
+#ifndef FOXBMS__SIL_SPI_H_
+#define FOXBMS__SIL_SPI_H_
+
+/*========== Includes =======================================================*/
+#include "general.h"
+
+#include "spi_cfg.h"
+
+/*========== Macros and Definitions =========================================*/
+
+/*========== Extern Constant and Variable Declarations ======================*/
+
+/*========== Extern Function Prototypes =====================================*/
+/**
+ * @brief   Carries out the requested DMA transfers.
+ * @details Called from the tick hook. Every SPI interface on which DMA
+ *          requests are enabled transfers the words of its Tx channel,
+ *          stores the received words with its Rx channel and then signals
+ *          the completion with #dmaGroupANotification(), as on the target.
+ */
+extern void SIL_SpiProcessDmaTransfers(void);
+
+/**
+ * @brief   Wraps #IO_PinSet() to observe the chip selects.
+ * @param   pRegisterAddress    address of the port register
+ * @param   pin                 pin of the port
+ */
+extern void __wrap_IO_PinSet(uint32_t *pRegisterAddress, uint32_t pin);
+
+/**
+ * @brief   Wraps #IO_PinReset() to observe the chip selects.
+ * @param   pRegisterAddress    address of the port register
+ * @param   pin                 pin of the port
+ */
+extern void __wrap_IO_PinReset(uint32_t *pRegisterAddress, uint32_t pin);
+
+/**
+ * @brief   Wraps #SPI_TransmitReceiveDataDma() to check the buffer addresses.
+ * @param   pSpiInterface   SPI interface
+ * @param   pTxBuff         buffer of the transmitted words
+ * @param   pRxBuff         buffer of the received words
+ * @param   frameLength     number of words
+ * @return  return value of the SPI driver
+ */
+extern STD_RETURN_TYPE_e __wrap_SPI_TransmitReceiveDataDma(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+
+/**
+ * @brief   Wraps #SPI_TransmitReceiveDataWithDummyDma() to check the buffer
+ *          addresses.
+ * @param   pSpiInterface       SPI interface
+ * @param   delay               delay after the dummy byte in microseconds
+ * @param   wakeUpValidity_us   time in which no dummy byte is needed
+ * @param   pTxBuff             buffer of the transmitted words
+ * @param   pRxBuff             buffer of the received words
+ * @param   frameLength         number of words
+ * @return  return value of the SPI driver
+ */
+extern STD_RETURN_TYPE_e __wrap_SPI_TransmitReceiveDataWithDummyDma(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint32_t delay,
+    uint32_t wakeUpValidity_us,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+
+/**
+ * @brief   Wraps #SPI_TransmitReceiveDataDmaLocked() to check the buffer
+ *          addresses.
+ * @param   pSpiInterface   SPI interface
+ * @param   pTxBuff         buffer of the transmitted words
+ * @param   pRxBuff         buffer of the received words
+ * @param   frameLength     number of words
+ * @return  return value of the SPI driver
+ */
+extern STD_RETURN_TYPE_e __wrap_SPI_TransmitReceiveDataDmaLocked(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+
+/**
+ * @brief   Wraps #SPI_TransmitReceiveDataDmaFromIsr() to check the buffer
+ *          addresses.
+ * @param   pSpiInterface   SPI interface
+ * @param   pTxBuff         buffer of the transmitted words
+ * @param   pRxBuff         buffer of the received words
+ * @param   frameLength     number of words
+ * @return  return value of the SPI driver
+ */
+extern STD_RETURN_TYPE_e __wrap_SPI_TransmitReceiveDataDmaFromIsr(
+    SPI_INTERFACE_CONFIG_s *pSpiInterface,
+    uint16_t *pTxBuff,
+    uint16_t *pRxBuff,
+    uint32_t frameLength);
+
+/*========== Externalized Static Functions Prototypes (Unit Test) ===========*/
+
+#endif /* FOXBMS__SIL_SPI_H_ */
@@ -0,0 +1,621 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    stress.c
+ * @author  foxBMS Team
+ * @date    2026-10-16 (date of creation)
+ * @updated 2026-10-16 (date of last update)
+ * @ingroup SIL
+ * @prefix  STRESS
+ *
+ * @brief   Stress test of the sequence locked database access on the host
+ *
+ * @details Runs the database with the sequence lock (see #DATA_USE_SEQUENCE_LOCK) with one host
+ *          thread per cyclic task of foxBMS. The threads access the database in tight loops: each
+ *          database entry has exactly one writer, which fills all values of the entry with the same
+ *          number, and all threads read the entries. Every read must therefore succeed and give
+ *          equal values. The latency of every read access is measured; the worst case, the 99 % and
+ *          the 99.99 % quantile are reported per task.
+ *          On a host with several cores the writers and the readers really run in parallel, so that
+ *          readers have to retry (and to fall back to the critical section) more often than on the
+ *          single core of the target, where a reader can only be interrupted by a writer of a higher
+ *          priority. On a host with a single processor a copy is rarely interrupted at all, the test
+ *          is meant for hosts with several processors.
+ *          The test fails on any failed read and on torn data, the latencies are reported.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "database.h"
+
+#include "fassert.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/*========== Macros and Definitions =========================================*/
+/** default duration of the stress test in ms */
+#define STRESS_DEFAULT_DURATION_ms (1000u)
+
+/** longest duration of the stress test in ms */
+#define STRESS_MAXIMUM_DURATION_ms (3600000u)
+
+/** number of buckets of the latency histograms, bucket i counts latencies below 2^(i+1) ns */
+#define STRESS_NUMBER_OF_BUCKETS (40u)
+
+/** nanoseconds per millisecond */
+#define STRESS_NS_PER_MS (1000000u)
+
+/** nanoseconds per second */
+#define STRESS_NS_PER_S (1000000000u)
+
+/** tasks of foxBMS that are simulated by the stress test */
+typedef enum STRESS_TASK_ID {
+    STRESS_TASK_ENGINE,           /*!< reads only */
+    STRESS_TASK_CYCLIC_1MS,       /*!< writes the redundant cell voltages */
+    STRESS_TASK_CYCLIC_10MS,      /*!< writes the cell temperatures */
+    STRESS_TASK_CYCLIC_100MS,     /*!< publishes the cell voltage base entry with its back buffer */
+    STRESS_TASK_CYCLIC_ALGORITHM, /*!< reads only */
+    STRESS_NUMBER_OF_TASKS,       /*!< number of simulated tasks */
+} STRESS_TASK_ID_e;
+
+/** simulated task and its results */
+typedef struct STRESS_TASK {
+    const char *pName;                                   /*!< name of the task in the report */
+    STRESS_TASK_ID_e id;                                 /*!< ID of the task */
+    pthread_t thread;                                    /*!< host thread of the task */
+    uint64_t writes;                                     /*!< number of write accesses */
+    uint64_t reads;                                      /*!< number of read accesses */
+    uint64_t failedReads;                                /*!< reads that returned #STD_NOT_OK */
+    uint64_t tornReads;                                  /*!< reads that returned inconsistent data */
+    uint64_t maximumLatency_ns;                          /*!< longest read access */
+    uint64_t latencyHistogram[STRESS_NUMBER_OF_BUCKETS]; /*!< read accesses per power of two of ns */
+} STRESS_TASK_s;
+
+/*========== Static Constant and Variable Definitions =======================*/
+/** report file or NULL_PTR */
+static const char *stress_pReportFile = NULL_PTR;
+
+/** duration of the stress test */
+static uint32_t stress_duration_ms = STRESS_DEFAULT_DURATION_ms;
+
+/** host time of the start of the stress test, the tick count is derived from it */
+static uint64_t stress_startTime_ns = 0u;
+
+/** set by the main thread to stop the simulated tasks */
+static bool stress_isStopped = false;
+
+/** replaces the critical section of the target, which disables the interrupts */
+static pthread_mutex_t stress_criticalSection = PTHREAD_MUTEX_INITIALIZER;
+
+/** simulated tasks */
+static STRESS_TASK_s stress_tasks[STRESS_NUMBER_OF_TASKS] = {
+    {.pName = "engine", .id = STRESS_TASK_ENGINE},
+    {.pName = "1ms", .id = STRESS_TASK_CYCLIC_1MS},
+    {.pName = "10ms", .id = STRESS_TASK_CYCLIC_10MS},
+    {.pName = "100ms", .id = STRESS_TASK_CYCLIC_100MS},
+    {.pName = "algorithm", .id = STRESS_TASK_CYCLIC_ALGORITHM},
+};
+
+/*========== Extern Constant and Variable Definitions =======================*/
+
+/*========== Static Function Prototypes =====================================*/
+/**
+ * @brief   Prints the usage of the stress test.
+ * @param   pProgram    name of the program
+ */
+static void STRESS_PrintUsage(const char *pProgram);
+
+/**
+ * @brief   Parses the command line.
+ * @param   argc    number of arguments
+ * @param   argv    arguments
+ * @return  #STD_OK if the command line is valid, #STD_NOT_OK otherwise
+ */
+static STD_RETURN_TYPE_e STRESS_ParseOptions(int argc, char *argv[]);
+
+/**
+ * @brief   Returns the host time.
+ * @return  monotonic host time in ns
+ */
+static uint64_t STRESS_GetHostTime_ns(void);
+
+/**
+ * @brief   Checks that all values are equal to the first value.
+ * @param   pValues         values
+ * @param   numberOfValues  number of values
+ * @return  true if all values are equal, false otherwise
+ */
+static bool STRESS_AreAllEqual(const int16_t *pValues, uint32_t numberOfValues);
+
+/**
+ * @brief   Checks the cell voltages that have been read.
+ * @param   pCellVoltage    cell voltage entry that has been read
+ * @param   blockId         ID of the entry that has been read
+ * @return  true if the entry is consistent, false if it is torn
+ */
+static bool STRESS_IsCellVoltageConsistent(const DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltage, DATA_BLOCK_ID_e blockId);
+
+/**
+ * @brief   Checks the cell temperatures that have been read.
+ * @param   pCellTemperature    cell temperature entry that has been read
+ * @return  true if the entry is consistent, false if it is torn
+ */
+static bool STRESS_IsCellTemperatureConsistent(const DATA_BLOCK_CELL_TEMPERATURE_s *pCellTemperature);
+
+/**
+ * @brief   Records the result and the latency of a read access.
+ * @param   pTask       task that has read
+ * @param   start_ns    host time before the read access
+ * @param   retval      return value of the read access
+ * @param   isConsistent true if the read data is consistent
+ */
+static void STRESS_RecordRead(STRESS_TASK_s *pTask, uint64_t start_ns, STD_RETURN_TYPE_e retval, bool isConsistent);
+
+/**
+ * @brief   Writes the entry of a task, if the task writes one.
+ * @param   pTask       task that writes
+ * @param   value       value that is written to all values of the entry
+ */
+static void STRESS_Write(STRESS_TASK_s *pTask, int16_t value);
+
+/**
+ * @brief   Reads the entries in all ways the application does.
+ * @param   pTask   task that reads
+ */
+static void STRESS_Read(STRESS_TASK_s *pTask);
+
+/**
+ * @brief   Runs a simulated task until the stress test is stopped.
+ * @param   pArgument   the #STRESS_TASK_s of the task
+ * @return  NULL_PTR
+ */
+static void *STRESS_RunTask(void *pArgument);
+
+/**
+ * @brief   Returns the latency below which a quantile of the read accesses of a task are.
+ * @param   pTask       task
+ * @param   quantile    quantile between 0 and 1
+ * @return  upper bound of the bucket that contains the quantile in ns
+ */
+static uint64_t STRESS_GetLatencyQuantile_ns(const STRESS_TASK_s *pTask, double quantile);
+
+/**
+ * @brief   Writes the report of the stress test.
+ * @param   pFile   opened file
+ */
+static void STRESS_WriteReport(FILE *pFile);
+
+/*========== Static Function Implementations ================================*/
+static void STRESS_PrintUsage(const char *pProgram) {
+    (void)fprintf(
+        stderr,
+        "usage: %s [-o report] [-d duration_ms]\n"
+        "  -o report       file of the report (default: none)\n"
+        "  -d duration_ms  duration of the stress test in ms (default: %u, at most %u)\n",
+        pProgram,
+        STRESS_DEFAULT_DURATION_ms,
+        STRESS_MAXIMUM_DURATION_ms);
+}
+
+static STD_RETURN_TYPE_e STRESS_ParseOptions(int argc, char *argv[]) {
+    STD_RETURN_TYPE_e retVal = STD_OK;
+    int option               = 0;
+    while ((retVal == STD_OK) && ((option = getopt(argc, argv, "o:d:")) != -1)) {
+        switch (option) {
+            case 'o':
+                stress_pReportFile = optarg;
+                break;
+            case 'd': {
+                char *pEnd                = NULL_PTR;
+                errno                     = 0;
+                const unsigned long value = strtoul(optarg, &pEnd, 10);
+                if ((pEnd == optarg) || (*pEnd != '\0') || (errno != 0) || (value == 0u) ||
+                    (value > STRESS_MAXIMUM_DURATION_ms) || (optarg[0] == '-')) {
+                    retVal = STD_NOT_OK;
+                } else {
+                    stress_duration_ms = (uint32_t)value;
+                }
+                break;
+            }
+            default:
+                retVal = STD_NOT_OK;
+                break;
+        }
+    }
+    if (optind != argc) {
+        retVal = STD_NOT_OK;
+    }
+    return retVal;
+}
+
+static uint64_t STRESS_GetHostTime_ns(void) {
+    struct timespec now = {0};
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * STRESS_NS_PER_S) + (uint64_t)now.tv_nsec;
+}
+
+static bool STRESS_AreAllEqual(const int16_t *pValues, uint32_t numberOfValues) {
+    bool areEqual = true;
+    for (uint32_t i = 1u; i < numberOfValues; i++) {
+        if (pValues[i] != pValues[0u]) {
+            areEqual = false;
+        }
+    }
+    return areEqual;
+}
+
+static bool STRESS_IsCellVoltageConsistent(const DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltage, DATA_BLOCK_ID_e blockId) {
+    const int16_t value = pCellVoltage->cellVoltage_mV[0u][0u];
+    bool isConsistent   = (pCellVoltage->header.uniqueId == blockId) &&
+                        STRESS_AreAllEqual(
+                            &pCellVoltage->cellVoltage_mV[0u][0u], BS_NR_OF_STRINGS * BS_NR_OF_BAT_CELLS);
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        if (pCellVoltage->packVoltage_mV[s] != (int32_t)value) {
+            isConsistent = false;
+        }
+    }
+    return isConsistent;
+}
+
+static bool STRESS_IsCellTemperatureConsistent(const DATA_BLOCK_CELL_TEMPERATURE_s *pCellTemperature) {
+    return (pCellTemperature->header.uniqueId == DATA_BLOCK_ID_CELL_TEMPERATURE_BASE) &&
+           STRESS_AreAllEqual(
+               &pCellTemperature->cellTemperature_ddegC[0u][0u], BS_NR_OF_STRINGS * BS_NR_OF_TEMP_SENSORS);
+}
+
+static void STRESS_RecordRead(STRESS_TASK_s *pTask, uint64_t start_ns, STD_RETURN_TYPE_e retval, bool isConsistent) {
+    const uint64_t latency_ns = STRESS_GetHostTime_ns() - start_ns;
+    uint8_t bucket            = 0u;
+    while (((latency_ns >> (bucket + 1u)) != 0u) && (bucket < (STRESS_NUMBER_OF_BUCKETS - 1u))) {
+        bucket++;
+    }
+    pTask->latencyHistogram[bucket]++;
+    if (latency_ns > pTask->maximumLatency_ns) {
+        pTask->maximumLatency_ns = latency_ns;
+    }
+    pTask->reads++;
+    if (retval != STD_OK) {
+        pTask->failedReads++;
+    }
+    if (isConsistent == false) {
+        pTask->tornReads++;
+    }
+}
+
+static void STRESS_Write(STRESS_TASK_s *pTask, int16_t value) {
+    static DATA_BLOCK_CELL_VOLTAGE_s stress_cellVoltage = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0};
+    static DATA_BLOCK_CELL_TEMPERATURE_s stress_cellTemperature = {
+        .header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE_BASE};
+    DATA_BLOCK_CELL_VOLTAGE_s *pCellVoltage = NULL_PTR;
+    switch (pTask->id) {
+        case STRESS_TASK_CYCLIC_1MS:
+            pCellVoltage = &stress_cellVoltage;
+            break;
+        case STRESS_TASK_CYCLIC_10MS:
+            for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+                for (uint16_t t = 0u; t < BS_NR_OF_TEMP_SENSORS; t++) {
+                    stress_cellTemperature.cellTemperature_ddegC[s][t] = value;
+                }
+            }
+            (void)DATA_WRITE_DATA(&stress_cellTemperature);
+            pTask->writes++;
+            break;
+        case STRESS_TASK_CYCLIC_100MS:
+            /* the back buffer is filled while the readers may still copy the published entry */
+            pCellVoltage = (DATA_BLOCK_CELL_VOLTAGE_s *)DATA_GetBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+            break;
+        default:
+            /* the task only reads */
+            break;
+    }
+    if (pCellVoltage != NULL_PTR) {
+        for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+            pCellVoltage->packVoltage_mV[s] = (int32_t)value;
+            for (uint16_t c = 0u; c < BS_NR_OF_BAT_CELLS; c++) {
+                pCellVoltage->cellVoltage_mV[s][c] = value;
+            }
+        }
+        if (pTask->id == STRESS_TASK_CYCLIC_1MS) {
+            (void)DATA_WRITE_DATA(pCellVoltage);
+        } else {
+            DATA_CommitBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+        }
+        pTask->writes++;
+    }
+}
+
+static void STRESS_Read(STRESS_TASK_s *pTask) {
+    DATA_BLOCK_CELL_VOLTAGE_s cellVoltage         = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0};
+    DATA_BLOCK_CELL_TEMPERATURE_s cellTemperature = {.header.uniqueId = DATA_BLOCK_ID_CELL_TEMPERATURE_BASE};
+    DATA_BLOCK_CELL_VOLTAGE_s cellVoltageBase     = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+    int16_t cellVoltages_mV[BS_NR_OF_STRINGS][BS_NR_OF_BAT_CELLS];
+
+    /* the two entries are read in one access, as the measurement and the algorithms do */
+    uint64_t start_ns        = STRESS_GetHostTime_ns();
+    STD_RETURN_TYPE_e retval = DATA_READ_DATA(&cellVoltage, &cellTemperature);
+    STRESS_RecordRead(
+        pTask,
+        start_ns,
+        retval,
+        STRESS_IsCellVoltageConsistent(&cellVoltage, DATA_BLOCK_ID_CELL_VOLTAGE_REDUNDANCY0) &&
+            STRESS_IsCellTemperatureConsistent(&cellTemperature));
+
+    /* the location of the double-buffered entry changes with each commit */
+    start_ns = STRESS_GetHostTime_ns();
+    retval   = DATA_READ_DATA(&cellVoltageBase);
+    STRESS_RecordRead(
+        pTask, start_ns, retval, STRESS_IsCellVoltageConsistent(&cellVoltageBase, DATA_BLOCK_ID_CELL_VOLTAGE_BASE));
+
+    start_ns = STRESS_GetHostTime_ns();
+    retval =
+        DATA_READ_FIELD(DATA_BLOCK_ID_CELL_VOLTAGE_BASE, DATA_BLOCK_CELL_VOLTAGE_s, cellVoltage_mV, cellVoltages_mV);
+    STRESS_RecordRead(
+        pTask, start_ns, retval, STRESS_AreAllEqual(&cellVoltages_mV[0u][0u], BS_NR_OF_STRINGS * BS_NR_OF_BAT_CELLS));
+}
+
+static void *STRESS_RunTask(void *pArgument) {
+    STRESS_TASK_s *pTask = (STRESS_TASK_s *)pArgument;
+    int16_t value        = 0;
+    while (__atomic_load_n(&stress_isStopped, __ATOMIC_RELAXED) == false) {
+        /* the values stay positive, so that they can be told apart from the initialized entries */
+        value = (value == INT16_MAX) ? 1 : (int16_t)(value + 1);
+        STRESS_Write(pTask, value);
+        STRESS_Read(pTask);
+    }
+    return NULL_PTR;
+}
+
+static uint64_t STRESS_GetLatencyQuantile_ns(const STRESS_TASK_s *pTask, double quantile) {
+    const uint64_t rank = (uint64_t)(quantile * (double)pTask->reads);
+    uint64_t reads      = 0u;
+    uint8_t bucket      = 0u;
+    while (bucket < (STRESS_NUMBER_OF_BUCKETS - 1u)) {
+        reads += pTask->latencyHistogram[bucket];
+        if (reads >= rank) {
+            break;
+        }
+        bucket++;
+    }
+    return UINT64_C(1) << (bucket + 1u);
+}
+
+static void STRESS_WriteReport(FILE *pFile) {
+    (void)fprintf(
+        pFile,
+        "foxBMS database stress test: %u ms, %u tasks, %u processors\n",
+        stress_duration_ms,
+        (unsigned int)STRESS_NUMBER_OF_TASKS,
+        (unsigned int)sysconf(_SC_NPROCESSORS_ONLN));
+    (void)fprintf(
+        pFile,
+        "%-10s %12s %12s %12s %10s %14s %14s %12s\n",
+        "task",
+        "writes",
+        "reads",
+        "failed",
+        "torn",
+        "99 % below ns",
+        "99.99 % below ns",
+        "max ns");
+    for (uint8_t i = 0u; i < STRESS_NUMBER_OF_TASKS; i++) {
+        const STRESS_TASK_s *pTask = &stress_tasks[i];
+        (void)fprintf(
+            pFile,
+            "%-10s %12llu %12llu %12llu %10llu %14llu %14llu %12llu\n",
+            pTask->pName,
+            (unsigned long long)pTask->writes,
+            (unsigned long long)pTask->reads,
+            (unsigned long long)pTask->failedReads,
+            (unsigned long long)pTask->tornReads,
+            (unsigned long long)STRESS_GetLatencyQuantile_ns(pTask, 0.99),
+            (unsigned long long)STRESS_GetLatencyQuantile_ns(pTask, 0.9999),
+            (unsigned long long)pTask->maximumLatency_ns);
+    }
+    (void)fprintf(
+        pFile,
+        "maximum number of read attempts: %u (%u optimistic attempts, then locked)\n",
+        (unsigned int)DATA_GetMaximumNumberOfReadAttempts(),
+        (unsigned int)DATA_SEQUENCE_LOCK_MAX_READ_ATTEMPTS);
+}
+
+/*========== Extern Function Implementations ================================*/
+int main(int argc, char *argv[]) {
+    if (STRESS_ParseOptions(argc, argv) != STD_OK) {
+        STRESS_PrintUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    stress_startTime_ns = STRESS_GetHostTime_ns();
+    const STD_RETURN_TYPE_e databaseInitialized = DATA_Init();
+    FAS_ASSERT(databaseInitialized == STD_OK);
+
+    for (uint8_t i = 0u; i < STRESS_NUMBER_OF_TASKS; i++) {
+        if (pthread_create(&stress_tasks[i].thread, NULL_PTR, &STRESS_RunTask, &stress_tasks[i]) != 0) {
+            (void)fprintf(stderr, "foxBMS stress test: could not create the task '%s'\n", stress_tasks[i].pName);
+            return EXIT_FAILURE;
+        }
+    }
+    const struct timespec duration = {
+        .tv_sec  = (time_t)(stress_duration_ms / 1000u),
+        .tv_nsec = (long)(stress_duration_ms % 1000u) * (long)STRESS_NS_PER_MS,
+    };
+    (void)nanosleep(&duration, NULL_PTR);
+    __atomic_store_n(&stress_isStopped, true, __ATOMIC_RELAXED);
+    uint64_t failedReads = 0u;
+    uint64_t tornReads   = 0u;
+    for (uint8_t i = 0u; i < STRESS_NUMBER_OF_TASKS; i++) {
+        (void)pthread_join(stress_tasks[i].thread, NULL_PTR);
+        failedReads += stress_tasks[i].failedReads;
+        tornReads += stress_tasks[i].tornReads;
+    }
+
+    STRESS_WriteReport(stdout);
+    if (stress_pReportFile != NULL_PTR) {
+        FILE *pReport = fopen(stress_pReportFile, "w");
+        if (pReport == NULL_PTR) {
+            (void)fprintf(
+                stderr, "foxBMS stress test: '%s' not writable (%s)\n", stress_pReportFile, strerror(errno));
+            return EXIT_FAILURE;
+        }
+        STRESS_WriteReport(pReport);
+        (void)fclose(pReport);
+    }
+    int exitCode = EXIT_SUCCESS;
+    if (failedReads != 0u) {
+        (void)fprintf(stderr, "foxBMS stress test: %llu reads failed\n", (unsigned long long)failedReads);
+        exitCode = EXIT_FAILURE;
+    }
+    if (tornReads != 0u) {
+        (void)fprintf(stderr, "foxBMS stress test: %llu reads returned torn data\n", (unsigned long long)tornReads);
+        exitCode = EXIT_FAILURE;
+    }
+    return exitCode;
+}
+
+/* the critical section of the target disables the interrupts, on the host the
+ * writers are serialized by a mutex, the readers only use it after their
+ * optimistic attempts failed */
+void OS_EnterTaskCritical(void) {
+    (void)pthread_mutex_lock(&stress_criticalSection);
+}
+
+void OS_ExitTaskCritical(void) {
+    (void)pthread_mutex_unlock(&stress_criticalSection);
+}
+
+uint32_t OS_GetTickCount(void) {
+    return (uint32_t)((STRESS_GetHostTime_ns() - stress_startTime_ns) / STRESS_NS_PER_MS);
+}
+
+/* the database task, the queue and the subscriptions are not used with the sequence lock */
+void OS_DelayTask(uint32_t delay_ms) {
+    (void)delay_ms;
+    FAS_ASSERT(FAS_TRAP);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    FAS_ASSERT(FAS_TRAP);
+    return NULL;
+}
+
+BaseType_t xTaskGenericNotify(
+    TaskHandle_t xTaskToNotify,
+    UBaseType_t uxIndexToNotify,
+    uint32_t ulValue,
+    eNotifyAction eAction,
+    uint32_t *pulPreviousNotificationValue) {
+    (void)xTaskToNotify;
+    (void)uxIndexToNotify;
+    (void)ulValue;
+    (void)eAction;
+    (void)pulPreviousNotificationValue;
+    FAS_ASSERT(FAS_TRAP);
+    return pdFAIL;
+}
+
+BaseType_t xTaskGenericNotifyWait(
+    UBaseType_t uxIndexToWaitOn,
+    uint32_t ulBitsToClearOnEntry,
+    uint32_t ulBitsToClearOnExit,
+    uint32_t *pulNotificationValue,
+    TickType_t xTicksToWait) {
+    (void)uxIndexToWaitOn;
+    (void)ulBitsToClearOnEntry;
+    (void)ulBitsToClearOnExit;
+    (void)pulNotificationValue;
+    (void)xTicksToWait;
+    FAS_ASSERT(FAS_TRAP);
+    return pdFALSE;
+}
+
+QueueHandle_t xQueueGenericCreateStatic(
+    const UBaseType_t uxQueueLength,
+    const UBaseType_t uxItemSize,
+    uint8_t *pucQueueStorage,
+    StaticQueue_t *pxStaticQueue,
+    const uint8_t ucQueueType) {
+    (void)uxQueueLength;
+    (void)uxItemSize;
+    (void)pucQueueStorage;
+    (void)pxStaticQueue;
+    (void)ucQueueType;
+    FAS_ASSERT(FAS_TRAP);
+    return NULL;
+}
+
+BaseType_t xQueueGenericSend(
+    QueueHandle_t xQueue,
+    const void *const pvItemToQueue,
+    TickType_t xTicksToWait,
+    const BaseType_t xCopyPosition) {
+    (void)xQueue;
+    (void)pvItemToQueue;
+    (void)xTicksToWait;
+    (void)xCopyPosition;
+    FAS_ASSERT(FAS_TRAP);
+    return errQUEUE_FULL;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void *const pvBuffer, TickType_t xTicksToWait) {
+    (void)xQueue;
+    (void)pvBuffer;
+    (void)xTicksToWait;
+    FAS_ASSERT(FAS_TRAP);
+    return pdFALSE;
+}
+
+/** an assertion of the database failed, the stress test is stopped */
+void FAS_DisableInterrupts(void) {
+    (void)fprintf(
+        stderr,
+        "foxBMS stress test: assertion failed (caller %p, line %u)\n",
+        (void *)fas_assertLocation.pc,
+        (unsigned int)fas_assertLocation.line);
+    exit(EXIT_FAILURE);
+}
+
+/*========== Externalized Static Function Implementations (Unit Test) =======*/
@@ -57,16 +57,76 @@
 #include "Mockos.h"
 
 #include "moving_average.h"
+#include "sliding_window.h"
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/** current sensor table that is returned by the database */
+static DATA_BLOCK_CURRENT_SENSOR_s test_currentSensor = {.header.uniqueId = DATA_BLOCK_ID_CURRENT_SENSOR};
+
+/** last moving average table that has been written to the database */
+static DATA_BLOCK_MOVING_AVERAGE_s test_movingAverage = {.header.uniqueId = DATA_BLOCK_ID_MOVING_AVERAGE};
+
+/** stores the moving average table that is written to the database */
+static STD_RETURN_TYPE_e TEST_WriteCallback(void *pDataFromSender0, int numCalls) {
+    test_movingAverage = *(DATA_BLOCK_MOVING_AVERAGE_s *)pDataFromSender0;
+    return STD_OK;
+}
+
+/** adds one current and power measurement with the same value for all strings */
+static void TEST_AddMeasurement(int32_t current_mA, int32_t power_W) {
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        test_currentSensor.current_mA[s] = current_mA;
+        test_currentSensor.power_W[s]    = power_W;
+    }
+    test_currentSensor.newCurrent++;
+    test_currentSensor.newPower++;
+    DATA_Read_1_DataBlock_ExpectAndReturn(NULL_PTR, STD_OK);
+    DATA_Read_1_DataBlock_IgnoreArg_pDataToReceiver0();
+    DATA_Read_1_DataBlock_ReturnMemThruPtr_pDataToReceiver0(&test_currentSensor, sizeof(test_currentSensor));
+    ALGO_MovAverage();
+}
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    DATA_Write_1_DataBlock_StubWithCallback(TEST_WriteCallback);
+    TEST_ASSERT_EQUAL(STD_OK, ALGO_InitializeMovingAverage());
 }
 
 void tearDown(void) {
 }
 
 /*========== Test Cases =====================================================*/
-void testDummy(void) {
+void testMovingAveragePerString(void) {
+    /* 1 s window: 5 samples with 200 ms */
+    TEST_AddMeasurement(1000, 10);
+    TEST_AddMeasurement(3000, 30);
+    TEST_ASSERT_EQUAL_FLOAT(2000.0f, test_movingAverage.stringCurrent_mA[0u][DATA_MOVING_AVERAGE_WINDOW_1s]);
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, test_movingAverage.stringPower_W[0u][DATA_MOVING_AVERAGE_WINDOW_1s]);
+    TEST_ASSERT_EQUAL_FLOAT(
+        (float)BS_NR_OF_STRINGS * 2000.0f, test_movingAverage.packCurrent_mA[DATA_MOVING_AVERAGE_WINDOW_60s]);
+    TEST_ASSERT_EQUAL_INT32(1000, test_movingAverage.minimumStringCurrent_mA[0u]);
+    TEST_ASSERT_EQUAL_INT32(3000, test_movingAverage.maximumStringCurrent_mA[0u]);
+
+    for (uint8_t i = 0u; i < 5u; i++) {
+        TEST_AddMeasurement(500, 5);
+    }
+    TEST_ASSERT_EQUAL_FLOAT(500.0f, test_movingAverage.stringCurrent_mA[0u][DATA_MOVING_AVERAGE_WINDOW_1s]);
+    TEST_ASSERT_EQUAL_FLOAT(
+        (1000.0f + 3000.0f + (5.0f * 500.0f)) / 7.0f,
+        test_movingAverage.stringCurrent_mA[0u][DATA_MOVING_AVERAGE_WINDOW_5s]);
+}
+
+void testInvalidStringIsNotAdded(void) {
+    TEST_AddMeasurement(1000, 10);
+    test_currentSensor.invalidCurrentMeasurement[0u] = 1u;
+    TEST_AddMeasurement(4000, 40);
+    test_currentSensor.invalidCurrentMeasurement[0u] = 0u;
+    TEST_ASSERT_EQUAL_FLOAT(1000.0f, test_movingAverage.stringCurrent_mA[0u][DATA_MOVING_AVERAGE_WINDOW_1s]);
+    TEST_ASSERT_EQUAL_FLOAT(2500.0f, test_movingAverage.stringCurrent_mA[1u][DATA_MOVING_AVERAGE_WINDOW_1s]);
+    /* the pack is only updated when all strings are valid */
+    TEST_ASSERT_EQUAL_FLOAT(
+        (float)BS_NR_OF_STRINGS * 1000.0f, test_movingAverage.packCurrent_mA[DATA_MOVING_AVERAGE_WINDOW_1s]);
+    /* the power of string 0 is still valid */
+    TEST_ASSERT_EQUAL_FLOAT(
+        (float)BS_NR_OF_STRINGS * 25.0f, test_movingAverage.packPower_W[DATA_MOVING_AVERAGE_WINDOW_1s]);
 }
@@ -0,0 +1,184 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_sliding_window.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the sliding window statistics
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "sliding_window.h"
+#include "test_assert_helper.h"
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+#define TEST_BUFFER_LENGTH (10u)
+#define TEST_NR_OF_WINDOWS (3u)
+
+static int32_t test_buffer[TEST_BUFFER_LENGTH]       = {0};
+static uint16_t test_minimum[TEST_BUFFER_LENGTH]     = {0};
+static uint16_t test_maximum[TEST_BUFFER_LENGTH]     = {0};
+static uint16_t test_shortMinimum[3u]                = {0};
+static SLW_WINDOW_s test_windows[TEST_NR_OF_WINDOWS] = {0};
+static SLW_INSTANCE_s test_instance                  = {0};
+
+/** state of the pseudo random number generator */
+static uint32_t test_randomState = 0u;
+
+/** deterministic linear congruential generator */
+static int32_t TEST_GetRandom(void) {
+    test_randomState = (test_randomState * 1664525u) + 1013904223u;
+    return (int32_t)(test_randomState >> 8u) - (int32_t)(1u << 23u);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    test_randomState = 42u;
+    /* window 0: 3 samples with minimum, window 1: 10 samples with minimum and
+       maximum, window 2: 5 samples without minimum and maximum */
+    SLW_InitializeWindow(&test_windows[0u], 3u, test_shortMinimum, NULL_PTR);
+    SLW_InitializeWindow(&test_windows[1u], TEST_BUFFER_LENGTH, test_minimum, test_maximum);
+    SLW_InitializeWindow(&test_windows[2u], 5u, NULL_PTR, NULL_PTR);
+    SLW_Initialize(&test_instance, test_buffer, TEST_BUFFER_LENGTH, test_windows, TEST_NR_OF_WINDOWS, 7u);
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSLW_InvalidInput(void) {
+    SLW_WINDOW_s window = {0};
+    TEST_ASSERT_FAIL_ASSERT(SLW_InitializeWindow(NULL_PTR, 1u, NULL_PTR, NULL_PTR));
+    TEST_ASSERT_FAIL_ASSERT(SLW_InitializeWindow(&window, 0u, NULL_PTR, NULL_PTR));
+    /* a window must not be longer than the ring buffer */
+    SLW_InitializeWindow(&window, TEST_BUFFER_LENGTH + 1u, NULL_PTR, NULL_PTR);
+    TEST_ASSERT_FAIL_ASSERT(SLW_Initialize(&test_instance, test_buffer, TEST_BUFFER_LENGTH, &window, 1u, 0u));
+    TEST_ASSERT_FAIL_ASSERT(SLW_Initialize(&test_instance, test_buffer, TEST_BUFFER_LENGTH, test_windows, 0u, 0u));
+    TEST_ASSERT_FAIL_ASSERT(SLW_GetAverage(&test_instance, TEST_NR_OF_WINDOWS));
+    /* window 2 has no minimum and maximum */
+    TEST_ASSERT_FAIL_ASSERT(SLW_GetMinimum(&test_instance, 2u));
+    TEST_ASSERT_FAIL_ASSERT(SLW_GetMaximum(&test_instance, 0u));
+}
+
+void testSLW_EmptyWindows(void) {
+    TEST_ASSERT_EQUAL_UINT16(0u, SLW_GetNumberOfSamples(&test_instance, 1u));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, SLW_GetAverage(&test_instance, 1u));
+    TEST_ASSERT_EQUAL_INT32(0, SLW_GetMinimum(&test_instance, 1u));
+    TEST_ASSERT_EQUAL_INT32(0, SLW_GetMaximum(&test_instance, 1u));
+}
+
+void testSLW_PartiallyFilledWindow(void) {
+    SLW_AddSample(&test_instance, 10);
+    SLW_AddSample(&test_instance, 20);
+    /* the average is calculated over the available samples only */
+    TEST_ASSERT_EQUAL_UINT16(2u, SLW_GetNumberOfSamples(&test_instance, 1u));
+    TEST_ASSERT_EQUAL_FLOAT(15.0f, SLW_GetAverage(&test_instance, 1u));
+    TEST_ASSERT_EQUAL_INT32(10, SLW_GetMinimum(&test_instance, 1u));
+    TEST_ASSERT_EQUAL_INT32(20, SLW_GetMaximum(&test_instance, 1u));
+}
+
+void testSLW_SamplesLeaveTheWindow(void) {
+    const int32_t samples[] = {5, 1, 9, 7, 3, 8};
+    for (uint8_t i = 0u; i < (sizeof(samples) / sizeof(samples[0])); i++) {
+        SLW_AddSample(&test_instance, samples[i]);
+    }
+    /* window 0 contains 7, 3, 8 */
+    TEST_ASSERT_EQUAL_UINT16(3u, SLW_GetNumberOfSamples(&test_instance, 0u));
+    TEST_ASSERT_EQUAL_FLOAT(6.0f, SLW_GetAverage(&test_instance, 0u));
+    TEST_ASSERT_EQUAL_INT32(3, SLW_GetMinimum(&test_instance, 0u));
+    /* window 2 contains 1, 9, 7, 3, 8 */
+    TEST_ASSERT_EQUAL_FLOAT(5.6f, SLW_GetAverage(&test_instance, 2u));
+    /* window 1 contains all samples */
+    TEST_ASSERT_EQUAL_INT32(1, SLW_GetMinimum(&test_instance, 1u));
+    TEST_ASSERT_EQUAL_INT32(9, SLW_GetMaximum(&test_instance, 1u));
+}
+
+/** compares all windows against a brute-force calculation over many wrap-arounds of the ring buffer */
+void testSLW_CompareWithBruteForce(void) {
+    int32_t history[1000u] = {0};
+    for (uint16_t n = 0u; n < 1000u; n++) {
+        /* plateaus of equal values check the handling of ties in the deques */
+        history[n] = ((n % 50u) < 10u) ? 100 : TEST_GetRandom();
+        SLW_AddSample(&test_instance, history[n]);
+
+        for (uint8_t window = 0u; window < TEST_NR_OF_WINDOWS; window++) {
+            const uint16_t length = test_windows[window].length;
+            const uint16_t first  = (n + 1u > length) ? (n + 1u - length) : 0u;
+            int64_t sum           = 0;
+            int32_t minimum       = history[first];
+            int32_t maximum       = history[first];
+            for (uint16_t i = first; i <= n; i++) {
+                sum += history[i];
+                minimum = (history[i] < minimum) ? history[i] : minimum;
+                maximum = (history[i] > maximum) ? history[i] : maximum;
+            }
+            TEST_ASSERT_EQUAL_UINT16(n + 1u - first, SLW_GetNumberOfSamples(&test_instance, window));
+            TEST_ASSERT_EQUAL_INT64(sum, test_windows[window].sum);
+            if (test_windows[window].minimum.pIndex != NULL_PTR) {
+                TEST_ASSERT_EQUAL_INT32(minimum, SLW_GetMinimum(&test_instance, window));
+            }
+            if (test_windows[window].maximum.pIndex != NULL_PTR) {
+                TEST_ASSERT_EQUAL_INT32(maximum, SLW_GetMaximum(&test_instance, window));
+            }
+        }
+    }
+}
+
+void testSLW_RecomputationRepairsSum(void) {
+    for (uint8_t i = 0u; i < 20u; i++) {
+        SLW_AddSample(&test_instance, 4);
+    }
+    /* simulate a corrupted sum; it is recomputed within one period per window */
+    test_windows[1u].sum = 12345;
+    for (uint8_t i = 0u; i < (7u * TEST_NR_OF_WINDOWS); i++) {
+        SLW_AddSample(&test_instance, 4);
+    }
+    TEST_ASSERT_EQUAL_INT64(40, test_windows[1u].sum);
+    TEST_ASSERT_EQUAL_FLOAT(4.0f, SLW_GetAverage(&test_instance, 1u));
+}
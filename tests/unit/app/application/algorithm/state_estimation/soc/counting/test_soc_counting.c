@@ -58,6 +58,7 @@
 #include "Mockfram.h"
 
 #include "soc_counting.h"
+#include "sox_counter.h"
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 FRAM_SOC_s fram_soc = {0};
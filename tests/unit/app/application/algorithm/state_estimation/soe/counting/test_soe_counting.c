@@ -61,6 +61,7 @@
 
 #include "foxmath.h"
 #include "soe_counting.h"
+#include "sox_counter.h"
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 FRAM_SOE_s fram_soe = {0};
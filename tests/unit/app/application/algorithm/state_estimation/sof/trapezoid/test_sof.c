@@ -59,12 +59,236 @@
 
 #include "sof_cfg.h"
 
-#include "foxmath.h"
 #include "sof.h"
+#include "test_assert_helper.h"
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 FRAM_SOC_s fram_soc = {0};
 
+/** maximum deviation of the fixed-point from the floating-point derating in mA */
+#define TEST_SOF_TOLERANCE_mA (1.0f)
+
+/** configuration of the previous floating-point implementation of the trapezoid derating */
+typedef struct TEST_FLOAT_CONFIG {
+    float maximumDischargeCurrent_mA;
+    float maximumChargeCurrent_mA;
+    float limpHomeCurrent_mA;
+    int16_t cutoffLowTemperatureDischarge_ddegC;
+    int16_t limitLowTemperatureDischarge_ddegC;
+    int16_t cutoffLowTemperatureCharge_ddegC;
+    int16_t limitLowTemperatureCharge_ddegC;
+    int16_t cutoffHighTemperatureDischarge_ddegC;
+    int16_t limitHighTemperatureDischarge_ddegC;
+    int16_t cutoffHighTemperatureCharge_ddegC;
+    int16_t limitHighTemperatureCharge_ddegC;
+    int16_t cutoffUpperCellVoltage_mV;
+    int16_t limitUpperCellVoltage_mV;
+    int16_t cutoffLowerCellVoltage_mV;
+    int16_t limitLowerCellVoltage_mV;
+} TEST_FLOAT_CONFIG_s;
+
+/** result of the previous floating-point implementation */
+typedef struct TEST_FLOAT_LIMITS {
+    float charge_mA;
+    float discharge_mA;
+} TEST_FLOAT_LIMITS_s;
+
+static const TEST_FLOAT_CONFIG_s test_floatRecommendedCurrent = {
+    .maximumChargeCurrent_mA              = SOF_CURRENT_MAX_CONTINUOUS_CHARGE_mA,
+    .maximumDischargeCurrent_mA           = SOF_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA,
+    .limpHomeCurrent_mA                   = SOF_CURRENT_LIMP_HOME_mA,
+    .cutoffLowTemperatureDischarge_ddegC  = SOF_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC,
+    .limitLowTemperatureDischarge_ddegC   = SOF_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC,
+    .cutoffLowTemperatureCharge_ddegC     = SOF_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC,
+    .limitLowTemperatureCharge_ddegC      = SOF_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC,
+    .cutoffHighTemperatureDischarge_ddegC = SOF_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC,
+    .limitHighTemperatureDischarge_ddegC  = SOF_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC,
+    .cutoffHighTemperatureCharge_ddegC    = SOF_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC,
+    .limitHighTemperatureCharge_ddegC     = SOF_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC,
+    .limitUpperCellVoltage_mV             = SOF_VOLTAGE_LIMIT_CHARGE_mV,
+    .cutoffUpperCellVoltage_mV            = SOF_VOLTAGE_CUTOFF_CHARGE_mV,
+    .limitLowerCellVoltage_mV             = SOF_VOLTAGE_LIMIT_DISCHARGE_mV,
+    .cutoffLowerCellVoltage_mV            = SOF_VOLTAGE_CUTOFF_DISCHARGE_mV};
+
+static const TEST_FLOAT_CONFIG_s test_floatMaximumOperatingLimit = {
+    .maximumChargeCurrent_mA              = SOF_MOL_CURRENT_MAX_CONTINUOUS_CHARGE_mA,
+    .maximumDischargeCurrent_mA           = SOF_MOL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA,
+    .limpHomeCurrent_mA                   = SOF_MOL_CURRENT_LIMP_HOME_mA,
+    .cutoffLowTemperatureDischarge_ddegC  = SOF_MOL_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC,
+    .limitLowTemperatureDischarge_ddegC   = SOF_MOL_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC,
+    .cutoffLowTemperatureCharge_ddegC     = SOF_MOL_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC,
+    .limitLowTemperatureCharge_ddegC      = SOF_MOL_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC,
+    .cutoffHighTemperatureDischarge_ddegC = SOF_MOL_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC,
+    .limitHighTemperatureDischarge_ddegC  = SOF_MOL_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC,
+    .cutoffHighTemperatureCharge_ddegC    = SOF_MOL_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC,
+    .limitHighTemperatureCharge_ddegC     = SOF_MOL_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC,
+    .limitUpperCellVoltage_mV             = SOF_MOL_VOLTAGE_LIMIT_CHARGE_mV,
+    .cutoffUpperCellVoltage_mV            = SOF_MOL_VOLTAGE_CUTOFF_CHARGE_mV,
+    .limitLowerCellVoltage_mV             = SOF_MOL_VOLTAGE_LIMIT_DISCHARGE_mV,
+    .cutoffLowerCellVoltage_mV            = SOF_MOL_VOLTAGE_CUTOFF_DISCHARGE_mV};
+
+static const TEST_FLOAT_CONFIG_s test_floatRecommendedSafetyLimit = {
+    .maximumChargeCurrent_mA              = SOF_RSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA,
+    .maximumDischargeCurrent_mA           = SOF_RSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA,
+    .limpHomeCurrent_mA                   = SOF_RSL_CURRENT_LIMP_HOME_mA,
+    .cutoffLowTemperatureDischarge_ddegC  = SOF_RSL_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC,
+    .limitLowTemperatureDischarge_ddegC   = SOF_RSL_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC,
+    .cutoffLowTemperatureCharge_ddegC     = SOF_RSL_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC,
+    .limitLowTemperatureCharge_ddegC      = SOF_RSL_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC,
+    .cutoffHighTemperatureDischarge_ddegC = SOF_RSL_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC,
+    .limitHighTemperatureDischarge_ddegC  = SOF_RSL_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC,
+    .cutoffHighTemperatureCharge_ddegC    = SOF_RSL_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC,
+    .limitHighTemperatureCharge_ddegC     = SOF_RSL_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC,
+    .limitUpperCellVoltage_mV             = SOF_RSL_VOLTAGE_LIMIT_CHARGE_mV,
+    .cutoffUpperCellVoltage_mV            = SOF_RSL_VOLTAGE_CUTOFF_CHARGE_mV,
+    .limitLowerCellVoltage_mV             = SOF_RSL_VOLTAGE_LIMIT_DISCHARGE_mV,
+    .cutoffLowerCellVoltage_mV            = SOF_RSL_VOLTAGE_CUTOFF_DISCHARGE_mV};
+
+static const TEST_FLOAT_CONFIG_s test_floatMaximumSafetyLimit = {
+    .maximumChargeCurrent_mA              = SOF_MSL_CURRENT_MAX_CONTINUOUS_CHARGE_mA,
+    .maximumDischargeCurrent_mA           = SOF_MSL_CURRENT_MAX_CONTINUOUS_DISCHARGE_mA,
+    .limpHomeCurrent_mA                   = SOF_MSL_CURRENT_LIMP_HOME_mA,
+    .cutoffLowTemperatureDischarge_ddegC  = SOF_MSL_TEMPERATURE_LOW_CUTOFF_DISCHARGE_ddegC,
+    .limitLowTemperatureDischarge_ddegC   = SOF_MSL_TEMPERATURE_LOW_LIMIT_DISCHARGE_ddegC,
+    .cutoffLowTemperatureCharge_ddegC     = SOF_MSL_TEMPERATURE_LOW_CUTOFF_CHARGE_ddegC,
+    .limitLowTemperatureCharge_ddegC      = SOF_MSL_TEMPERATURE_LOW_LIMIT_CHARGE_ddegC,
+    .cutoffHighTemperatureDischarge_ddegC = SOF_MSL_TEMPERATURE_HIGH_CUTOFF_DISCHARGE_ddegC,
+    .limitHighTemperatureDischarge_ddegC  = SOF_MSL_TEMPERATURE_HIGH_LIMIT_DISCHARGE_ddegC,
+    .cutoffHighTemperatureCharge_ddegC    = SOF_MSL_TEMPERATURE_HIGH_CUTOFF_CHARGE_ddegC,
+    .limitHighTemperatureCharge_ddegC     = SOF_MSL_TEMPERATURE_HIGH_LIMIT_CHARGE_ddegC,
+    .limitUpperCellVoltage_mV             = SOF_MSL_VOLTAGE_LIMIT_CHARGE_mV,
+    .cutoffUpperCellVoltage_mV            = SOF_MSL_VOLTAGE_CUTOFF_CHARGE_mV,
+    .limitLowerCellVoltage_mV             = SOF_MSL_VOLTAGE_LIMIT_DISCHARGE_mV,
+    .cutoffLowerCellVoltage_mV            = SOF_MSL_VOLTAGE_CUTOFF_DISCHARGE_mV};
+
+static float TEST_Minimum(float a, float b) {
+    return (a < b) ? a : b;
+}
+
+/** voltage based derating as calculated by the previous floating-point implementation */
+static TEST_FLOAT_LIMITS_s TEST_FloatVoltageBasedLimit(
+    int16_t minimumCellVoltage_mV,
+    int16_t maximumCellVoltage_mV,
+    const TEST_FLOAT_CONFIG_s *pConfig) {
+    TEST_FLOAT_LIMITS_s limits = {0};
+    const float slopeDischarge = (pConfig->maximumDischargeCurrent_mA - 0.0f) /
+                                 (pConfig->cutoffLowerCellVoltage_mV - pConfig->limitLowerCellVoltage_mV);
+    const float slopeCharge = (pConfig->maximumChargeCurrent_mA - 0.0f) /
+                              (pConfig->cutoffUpperCellVoltage_mV - pConfig->limitUpperCellVoltage_mV);
+
+    if (minimumCellVoltage_mV <= pConfig->limitLowerCellVoltage_mV) {
+        limits.discharge_mA = 0.0f;
+    } else if (minimumCellVoltage_mV <= pConfig->cutoffLowerCellVoltage_mV) {
+        limits.discharge_mA = slopeDischarge * (minimumCellVoltage_mV - pConfig->limitLowerCellVoltage_mV);
+    } else {
+        limits.discharge_mA = pConfig->maximumDischargeCurrent_mA;
+    }
+    if (maximumCellVoltage_mV >= pConfig->limitUpperCellVoltage_mV) {
+        limits.charge_mA = 0.0f;
+    } else if (maximumCellVoltage_mV >= pConfig->cutoffUpperCellVoltage_mV) {
+        limits.charge_mA = slopeCharge * (maximumCellVoltage_mV - pConfig->limitUpperCellVoltage_mV);
+    } else {
+        limits.charge_mA = pConfig->maximumChargeCurrent_mA;
+    }
+    return limits;
+}
+
+/** temperature based derating as calculated by the previous floating-point implementation */
+static TEST_FLOAT_LIMITS_s TEST_FloatTemperatureBasedLimit(
+    int16_t minimumCellTemperature_ddegC,
+    int16_t maximumCellTemperature_ddegC,
+    const TEST_FLOAT_CONFIG_s *pConfig) {
+    TEST_FLOAT_LIMITS_s limits = {0};
+    const float slopeLowDischarge =
+        (pConfig->maximumDischargeCurrent_mA - pConfig->limpHomeCurrent_mA) /
+        (pConfig->cutoffLowTemperatureDischarge_ddegC - pConfig->limitLowTemperatureDischarge_ddegC);
+    const float offsetLowDischarge =
+        pConfig->limpHomeCurrent_mA - (slopeLowDischarge * pConfig->limitLowTemperatureDischarge_ddegC);
+    const float slopeHighDischarge =
+        (0.0f - pConfig->maximumDischargeCurrent_mA) /
+        (pConfig->limitHighTemperatureDischarge_ddegC - pConfig->cutoffHighTemperatureDischarge_ddegC);
+    const float offsetHighDischarge = 0.0f - (slopeHighDischarge * pConfig->limitHighTemperatureDischarge_ddegC);
+    const float slopeLowCharge =
+        (pConfig->maximumChargeCurrent_mA - 0.0f) /
+        (pConfig->cutoffLowTemperatureCharge_ddegC - pConfig->limitLowTemperatureCharge_ddegC);
+    const float offsetLowCharge = 0.0f - (slopeLowCharge * pConfig->limitLowTemperatureCharge_ddegC);
+    const float slopeHighCharge =
+        (0.0f - pConfig->maximumChargeCurrent_mA) /
+        (pConfig->limitHighTemperatureCharge_ddegC - pConfig->cutoffHighTemperatureCharge_ddegC);
+    const float offsetHighCharge = 0.0f - (slopeHighCharge * pConfig->limitHighTemperatureCharge_ddegC);
+
+    if (minimumCellTemperature_ddegC <= pConfig->limitLowTemperatureDischarge_ddegC) {
+        limits.discharge_mA = pConfig->limpHomeCurrent_mA;
+    } else if (minimumCellTemperature_ddegC <= pConfig->cutoffLowTemperatureDischarge_ddegC) {
+        limits.discharge_mA = (slopeLowDischarge * minimumCellTemperature_ddegC) + offsetLowDischarge;
+    } else {
+        limits.discharge_mA = pConfig->maximumDischargeCurrent_mA;
+    }
+    if (minimumCellTemperature_ddegC <= pConfig->limitLowTemperatureCharge_ddegC) {
+        limits.charge_mA = 0.0f;
+    } else if (minimumCellTemperature_ddegC <= pConfig->cutoffLowTemperatureCharge_ddegC) {
+        limits.charge_mA = (slopeLowCharge * minimumCellTemperature_ddegC) + offsetLowCharge;
+    } else {
+        limits.charge_mA = pConfig->maximumChargeCurrent_mA;
+    }
+    if (maximumCellTemperature_ddegC >= pConfig->limitHighTemperatureDischarge_ddegC) {
+        limits.discharge_mA = 0.0f;
+    } else if (maximumCellTemperature_ddegC >= pConfig->cutoffHighTemperatureDischarge_ddegC) {
+        limits.discharge_mA = TEST_Minimum(
+            limits.discharge_mA, (slopeHighDischarge * maximumCellTemperature_ddegC) + offsetHighDischarge);
+    } else {
+        limits.discharge_mA = TEST_Minimum(limits.discharge_mA, pConfig->maximumDischargeCurrent_mA);
+    }
+    if (maximumCellTemperature_ddegC >= pConfig->limitHighTemperatureCharge_ddegC) {
+        limits.charge_mA = 0.0f;
+    } else if (maximumCellTemperature_ddegC >= pConfig->cutoffHighTemperatureCharge_ddegC) {
+        limits.charge_mA =
+            TEST_Minimum(limits.charge_mA, (slopeHighCharge * maximumCellTemperature_ddegC) + offsetHighCharge);
+    } else {
+        limits.charge_mA = TEST_Minimum(limits.charge_mA, pConfig->maximumChargeCurrent_mA);
+    }
+    return limits;
+}
+
+/** compares the fixed-point derating of one configuration against the floating-point reference */
+static void TEST_CompareWithFloatImplementation(const SOF_CONFIG_s *pConfig, const TEST_FLOAT_CONFIG_s *pFloatConfig) {
+    SOF_CURVE_s curves = {0};
+    TEST_SOF_CalculateCurves(pConfig, &curves);
+
+    for (int16_t minimumCellVoltage_mV = 1000; minimumCellVoltage_mV <= 3000; minimumCellVoltage_mV++) {
+        for (int16_t spread_mV = 0; spread_mV <= 200; spread_mV += 50) {
+            const int16_t maximumCellVoltage_mV = minimumCellVoltage_mV + spread_mV;
+            SOF_CURRENT_LIMITS_s limits         = {0};
+            TEST_SOF_CalculateVoltageBasedCurrentLimit(minimumCellVoltage_mV, maximumCellVoltage_mV, &limits, &curves);
+            const TEST_FLOAT_LIMITS_s expected =
+                TEST_FloatVoltageBasedLimit(minimumCellVoltage_mV, maximumCellVoltage_mV, pFloatConfig);
+            TEST_ASSERT_FLOAT_WITHIN(
+                TEST_SOF_TOLERANCE_mA, expected.discharge_mA, (float)limits.continuousDischargeCurrent_mA);
+            TEST_ASSERT_FLOAT_WITHIN(
+                TEST_SOF_TOLERANCE_mA, expected.charge_mA, (float)limits.continuousChargeCurrent_mA);
+            TEST_ASSERT_EQUAL_INT32(limits.continuousDischargeCurrent_mA, limits.peakDischargeCurrent_mA);
+            TEST_ASSERT_EQUAL_INT32(limits.continuousChargeCurrent_mA, limits.peakChargeCurrent_mA);
+        }
+    }
+
+    for (int16_t minimumTemperature_ddegC = -400; minimumTemperature_ddegC <= 800; minimumTemperature_ddegC++) {
+        for (int16_t spread_ddegC = 0; spread_ddegC <= 300; spread_ddegC += 25) {
+            const int16_t maximumTemperature_ddegC = minimumTemperature_ddegC + spread_ddegC;
+            SOF_CURRENT_LIMITS_s limits            = {0};
+            TEST_SOF_CalculateTemperatureBasedCurrentLimit(
+                minimumTemperature_ddegC, maximumTemperature_ddegC, &limits, &curves);
+            const TEST_FLOAT_LIMITS_s expected =
+                TEST_FloatTemperatureBasedLimit(minimumTemperature_ddegC, maximumTemperature_ddegC, pFloatConfig);
+            TEST_ASSERT_FLOAT_WITHIN(
+                TEST_SOF_TOLERANCE_mA, expected.discharge_mA, (float)limits.continuousDischargeCurrent_mA);
+            TEST_ASSERT_FLOAT_WITHIN(
+                TEST_SOF_TOLERANCE_mA, expected.charge_mA, (float)limits.continuousChargeCurrent_mA);
+            TEST_ASSERT_EQUAL_INT32(limits.continuousDischargeCurrent_mA, limits.peakDischargeCurrent_mA);
+            TEST_ASSERT_EQUAL_INT32(limits.continuousChargeCurrent_mA, limits.peakChargeCurrent_mA);
+        }
+    }
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
 }
@@ -72,7 +296,136 @@ void setUp(void) {
 void tearDown(void) {
 }
 
-void test_Dummy(void) {
+/*========== Test Cases =====================================================*/
+void testFixedPointDeratingMatchesFloatImplementation(void) {
+    TEST_CompareWithFloatImplementation(&sof_recommendedCurrent, &test_floatRecommendedCurrent);
+    TEST_CompareWithFloatImplementation(&sof_maximumOperatingLimit, &test_floatMaximumOperatingLimit);
+    TEST_CompareWithFloatImplementation(&sof_recommendedSafetyLimit, &test_floatRecommendedSafetyLimit);
+    TEST_CompareWithFloatImplementation(&sof_configMaximumSafetyLimit, &test_floatMaximumSafetyLimit);
 }
 
-/*========== Test Cases =====================================================*/
+void testEvaluateCurveWithMultipleSegments(void) {
+    const SOF_CONFIG_s config = {
+        .dischargeCurrentOverCellVoltage =
+            {.nrOfBreakpoints = 5u,
+             .breakpoints     = {{2500, 0}, {2700, 10000}, {3000, 100000}, {4000, 100000}, {4200, 50000}}},
+        .chargeCurrentOverCellVoltage    = {.nrOfBreakpoints = 1u, .breakpoints = {{3000, 20000}}},
+        .dischargeCurrentOverTemperature = {.nrOfBreakpoints = 2u, .breakpoints = {{-200, 1000}, {0, 101000}}},
+        .chargeCurrentOverTemperature    = {.nrOfBreakpoints = 2u, .breakpoints = {{400, 3}, {403, 0}}},
+    };
+    SOF_CURVE_s curves = {0};
+    TEST_SOF_CalculateCurves(&config, &curves);
+
+    /* constant outside of the breakpoints */
+    TEST_ASSERT_EQUAL_INT32(0, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, INT16_MIN));
+    TEST_ASSERT_EQUAL_INT32(0, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 2500));
+    TEST_ASSERT_EQUAL_INT32(50000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 4200));
+    TEST_ASSERT_EQUAL_INT32(50000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, INT16_MAX));
+    /* exact at every breakpoint */
+    TEST_ASSERT_EQUAL_INT32(10000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 2700));
+    TEST_ASSERT_EQUAL_INT32(100000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 3000));
+    TEST_ASSERT_EQUAL_INT32(100000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 4000));
+    /* interpolated within each segment */
+    TEST_ASSERT_EQUAL_INT32(5000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 2600));
+    TEST_ASSERT_EQUAL_INT32(55000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 2850));
+    TEST_ASSERT_EQUAL_INT32(100000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 3500));
+    TEST_ASSERT_EQUAL_INT32(75000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 4100));
+    /* a single breakpoint is a constant limit */
+    TEST_ASSERT_EQUAL_INT32(20000, TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverCellVoltage, 0));
+    TEST_ASSERT_EQUAL_INT32(20000, TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverCellVoltage, 4000));
+    /* negative inputs and fractional slopes */
+    TEST_ASSERT_EQUAL_INT32(51000, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverTemperature, -100));
+    TEST_ASSERT_EQUAL_INT32(2, TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverTemperature, 401));
+    TEST_ASSERT_EQUAL_INT32(1, TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverTemperature, 402));
+}
+
+void testRangeIncludesBreakpointsBetweenMinimumAndMaximum(void) {
+    /* a curve with its smallest current between two cells */
+    const SOF_CONFIG_s config = {
+        .dischargeCurrentOverCellVoltage =
+            {.nrOfBreakpoints = 3u, .breakpoints = {{3000, 100000}, {3500, 10000}, {4000, 100000}}},
+        .chargeCurrentOverCellVoltage    = {.nrOfBreakpoints = 2u, .breakpoints = {{3000, 20000}, {4000, 40000}}},
+        .dischargeCurrentOverTemperature = {.nrOfBreakpoints = 1u, .breakpoints = {{0, 100000}}},
+        .chargeCurrentOverTemperature    = {.nrOfBreakpoints = 1u, .breakpoints = {{0, 100000}}},
+    };
+    SOF_CURVE_s curves = {0};
+    TEST_SOF_CalculateCurves(&config, &curves);
+
+    SOF_CURRENT_LIMITS_s limits = {0};
+    TEST_SOF_CalculateVoltageBasedCurrentLimit(3000, 4000, &limits, &curves);
+    TEST_ASSERT_EQUAL_INT32(10000, limits.continuousDischargeCurrent_mA);
+    TEST_ASSERT_EQUAL_INT32(20000, limits.continuousChargeCurrent_mA);
+    /* a breakpoint at the limit of the range is evaluated as the limit */
+    TEST_SOF_CalculateVoltageBasedCurrentLimit(3250, 3500, &limits, &curves);
+    TEST_ASSERT_EQUAL_INT32(10000, limits.continuousDischargeCurrent_mA);
+    /* breakpoints outside of the range are ignored */
+    TEST_SOF_CalculateVoltageBasedCurrentLimit(3600, 3900, &limits, &curves);
+    TEST_ASSERT_EQUAL_INT32(28000, limits.continuousDischargeCurrent_mA);
+}
+
+void testEvaluateCurveBeforeInitialization(void) {
+    /* SOF_Calculation() is called by the cyclic tasks before SOF_Init() */
+    const SOF_CURVE_s curves = {0};
+    TEST_ASSERT_EQUAL_INT32(0, TEST_SOF_EvaluateCurve(&curves.dischargeCurrentOverCellVoltage, 3700));
+    TEST_ASSERT_EQUAL_INT32(0, TEST_SOF_EvaluateCurve(&curves.chargeCurrentOverTemperature, INT16_MIN));
+}
+
+void testCalculateCurvesRejectsInvalidCurves(void) {
+    SOF_CURVE_s curves  = {0};
+    SOF_CONFIG_s config = sof_recommendedCurrent;
+
+    config.chargeCurrentOverTemperature.nrOfBreakpoints = 0u;
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOF_CalculateCurves(&config, &curves));
+
+    config                                              = sof_recommendedCurrent;
+    config.chargeCurrentOverTemperature.nrOfBreakpoints = SOF_MAXIMUM_NR_OF_BREAKPOINTS + 1u;
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOF_CalculateCurves(&config, &curves));
+
+    /* breakpoints not sorted by increasing input */
+    config                                                   = sof_recommendedCurrent;
+    config.chargeCurrentOverTemperature.breakpoints[2].input = config.chargeCurrentOverTemperature.breakpoints[1].input;
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOF_CalculateCurves(&config, &curves));
+}
+
+void testMinimumOfTwoSofValues(void) {
+    const SOF_CURRENT_LIMITS_s voltageBasedLimits     = {100, 200, 300, 400};
+    const SOF_CURRENT_LIMITS_s temperatureBasedLimits = {400, 100, 300, -5};
+    const SOF_CURRENT_LIMITS_s minimum = TEST_SOF_MinimumOfTwoSofValues(voltageBasedLimits, temperatureBasedLimits);
+    TEST_ASSERT_EQUAL_INT32(100, minimum.continuousChargeCurrent_mA);
+    TEST_ASSERT_EQUAL_INT32(100, minimum.peakChargeCurrent_mA);
+    TEST_ASSERT_EQUAL_INT32(300, minimum.continuousDischargeCurrent_mA);
+    TEST_ASSERT_EQUAL_INT32(-5, minimum.peakDischargeCurrent_mA);
+}
+
+void testUpdateStringInputsDetectsChangedInputs(void) {
+    DATA_BLOCK_MIN_MAX_s minimumMaximumValues = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    minimumMaximumValues.minimumCellVoltage_mV[0u]    = 3000;
+    minimumMaximumValues.maximumCellVoltage_mV[0u]    = 3100;
+    minimumMaximumValues.minimumTemperature_ddegC[0u] = 200;
+    minimumMaximumValues.maximumTemperature_ddegC[0u] = 250;
+
+    /* first calculation after initialization always has to be done */
+    SOF_Init();
+    TEST_ASSERT_TRUE(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues));
+    TEST_ASSERT_FALSE(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues));
+
+    /* values of other strings are no input of this string */
+    minimumMaximumValues.minimumCellVoltage_mV[1u] = 2000;
+    TEST_ASSERT_FALSE(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues));
+
+    minimumMaximumValues.minimumCellVoltage_mV[0u] = 2999;
+    TEST_ASSERT_TRUE(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues));
+    minimumMaximumValues.maximumCellVoltage_mV[0u] = 3101;
+    TEST_ASSERT_TRUE(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues));
+    minimumMaximumValues.minimumTemperature_ddegC[0u] = 199;
+    TEST_ASSERT_TRUE(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues));
+    minimumMaximumValues.maximumTemperature_ddegC[0u] = 251;
+    TEST_ASSERT_TRUE(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues));
+    TEST_ASSERT_FALSE(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues));
+
+    /* re-initialization invalidates the cache */
+    SOF_Init();
+    TEST_ASSERT_TRUE(TEST_SOF_UpdateStringInputs(0u, &minimumMaximumValues));
+
+    TEST_ASSERT_FAIL_ASSERT(TEST_SOF_UpdateStringInputs(BS_NR_OF_STRINGS, &minimumMaximumValues));
+}
@@ -0,0 +1,270 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_sox_counter.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the fixed-point charge and energy counter
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "sox_counter.h"
+#include "test_assert_helper.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** capacity of 100 Ah in mAs that is used for the replay */
+#define TEST_CAPACITY_mAs ((int64_t)100 * 3600 * 1000)
+
+/** duration of the replay: one week in ms */
+#define TEST_REPLAY_DURATION_ms (7u * 24u * 3600u * 1000u)
+
+/** state of the pseudo random number generator of the replay */
+static uint32_t test_randomState = 0u;
+
+/** deterministic linear congruential generator, returns values in [0, 65535] */
+static uint32_t TEST_GetRandom(void) {
+    test_randomState = (test_randomState * 1664525u) + 1013904223u;
+    return test_randomState >> 16u;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    test_randomState = 0x12345678u;
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testSOX_InvalidInput(void) {
+    SOX_COUNTER_s counter     = {0};
+    SOX_REFERENCE_s reference = {0};
+    TEST_ASSERT_FAIL_ASSERT(SOX_InitializeCounter(NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(SOX_AddSample(NULL_PTR, 0, 0, 0u));
+    TEST_ASSERT_FAIL_ASSERT(SOX_SetReference(NULL_PTR, 1, 0, 0.0f, 0.0f, 0.0f));
+    TEST_ASSERT_FAIL_ASSERT(SOX_SetReference(&reference, 0, 0, 0.0f, 0.0f, 0.0f));
+    TEST_ASSERT_FAIL_ASSERT(SOX_GetPercentages(&reference, 0, NULL_PTR, NULL_PTR, NULL_PTR));
+    SOX_InitializeCounter(&counter, 0u);
+}
+
+void testSOX_AddSampleCarriesRemainder(void) {
+    SOX_COUNTER_s counter = {0};
+    SOX_InitializeCounter(&counter, 0u);
+
+    /* 1 mA for 1 ms is 1 uAs: nothing is lost after 1000 samples */
+    for (uint32_t timestamp_ms = 1u; timestamp_ms <= 1000u; timestamp_ms++) {
+        SOX_AddSample(&counter, 1, 1, timestamp_ms);
+    }
+    TEST_ASSERT_EQUAL_INT64(1, counter.dischargedCharge_mAs);
+    TEST_ASSERT_EQUAL_INT32(0, counter.chargeRemainder_uAs);
+    TEST_ASSERT_EQUAL_INT64(0, counter.dischargedEnergy_mWs);
+    TEST_ASSERT_EQUAL_INT32(1000, counter.energyRemainder_nWs);
+
+    /* charging removes the same amount again */
+    for (uint32_t timestamp_ms = 1001u; timestamp_ms <= 2000u; timestamp_ms++) {
+        SOX_AddSample(&counter, -1, 1, timestamp_ms);
+    }
+    TEST_ASSERT_EQUAL_INT64(0, counter.dischargedCharge_mAs);
+    TEST_ASSERT_EQUAL_INT32(0, counter.chargeRemainder_uAs);
+    TEST_ASSERT_EQUAL_INT64(0, counter.dischargedEnergy_mWs);
+    TEST_ASSERT_EQUAL_INT32(0, counter.energyRemainder_nWs);
+}
+
+void testSOX_AddSampleTimestamps(void) {
+    SOX_COUNTER_s counter = {0};
+    SOX_InitializeCounter(&counter, UINT32_MAX - 49u);
+
+    /* a sample with the same timestamp is ignored */
+    SOX_AddSample(&counter, 1000, 400000, UINT32_MAX - 49u);
+    TEST_ASSERT_EQUAL_INT64(0, counter.dischargedCharge_mAs);
+
+    /* 100 ms across the wrap-around of the timestamp */
+    SOX_AddSample(&counter, 1000, 400000, 50u);
+    TEST_ASSERT_EQUAL_INT64(100, counter.dischargedCharge_mAs);
+    TEST_ASSERT_EQUAL_INT64(40000, counter.dischargedEnergy_mWs);
+    TEST_ASSERT_EQUAL_UINT32(50u, counter.previousTimestamp_ms);
+}
+
+void testSOX_ReferenceAndPercentages(void) {
+    SOX_REFERENCE_s reference = {0};
+    float minimum_perc        = 0.0f;
+    float average_perc        = 0.0f;
+    float maximum_perc        = 0.0f;
+
+    SOX_SetReference(&reference, 1000, 500, 40.0f, 50.0f, 120.0f);
+    TEST_ASSERT_EQUAL_INT64(400, reference.minimum);
+    TEST_ASSERT_EQUAL_INT64(500, reference.average);
+    TEST_ASSERT_EQUAL_INT64(1000, reference.maximum);
+    TEST_ASSERT_EQUAL_INT64(500, reference.counterAtReference);
+
+    /* 100 mAs discharged since the reference */
+    SOX_GetPercentages(&reference, 600, &minimum_perc, &average_perc, &maximum_perc);
+    TEST_ASSERT_EQUAL_FLOAT(30.0f, minimum_perc);
+    TEST_ASSERT_EQUAL_FLOAT(40.0f, average_perc);
+    TEST_ASSERT_EQUAL_FLOAT(90.0f, maximum_perc);
+
+    /* results are limited to [0, 100] */
+    SOX_GetPercentages(&reference, 1000, &minimum_perc, NULL_PTR, NULL_PTR);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, minimum_perc);
+    SOX_GetPercentages(&reference, -1000, NULL_PTR, NULL_PTR, &maximum_perc);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, maximum_perc);
+    TEST_ASSERT_EQUAL_INT64(0, SOX_GetRemaining(&reference, &reference.minimum, 1000));
+    TEST_ASSERT_EQUAL_INT64(1000, SOX_GetRemaining(&reference, &reference.maximum, -1000));
+    TEST_ASSERT_FAIL_ASSERT(SOX_GetRemaining(&reference, NULL_PTR, 0));
+}
+
+/** the counter is re-anchored at 0 % and 100 %, so that the percentage
+ *  follows the current as soon as it reverses */
+void testSOX_LimitsReanchorReference(void) {
+    SOX_REFERENCE_s reference = {0};
+    float average_perc        = 0.0f;
+
+    SOX_SetReference(&reference, 1000, 0, 50.0f, 50.0f, 50.0f);
+
+    /* discharged 200 mAs beyond 0 %, then charged with 100 mAs */
+    SOX_GetPercentages(&reference, 700, NULL_PTR, &average_perc, NULL_PTR);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, average_perc);
+    SOX_GetPercentages(&reference, 600, NULL_PTR, &average_perc, NULL_PTR);
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, average_perc);
+
+    /* charged 300 mAs beyond 100 %, then discharged with 100 mAs */
+    SOX_GetPercentages(&reference, -600, NULL_PTR, &average_perc, NULL_PTR);
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, average_perc);
+    SOX_GetPercentages(&reference, -500, NULL_PTR, &average_perc, NULL_PTR);
+    TEST_ASSERT_EQUAL_FLOAT(90.0f, average_perc);
+
+    /* within the limits the reference is not moved */
+    TEST_ASSERT_EQUAL_INT64(0, reference.counterAtReference);
+    SOX_GetPercentages(&reference, 0, NULL_PTR, &average_perc, NULL_PTR);
+    TEST_ASSERT_EQUAL_FLOAT(40.0f, average_perc);
+
+    /* the minimum and the maximum are re-anchored independently */
+    SOX_SetReference(&reference, 1000, 0, 10.0f, 50.0f, 90.0f);
+    float minimum_perc = 0.0f;
+    float maximum_perc = 0.0f;
+    SOX_GetPercentages(&reference, 200, &minimum_perc, &average_perc, &maximum_perc);
+    SOX_GetPercentages(&reference, 100, &minimum_perc, &average_perc, &maximum_perc);
+    TEST_ASSERT_EQUAL_FLOAT(10.0f, minimum_perc);
+    TEST_ASSERT_EQUAL_FLOAT(40.0f, average_perc);
+    TEST_ASSERT_EQUAL_FLOAT(80.0f, maximum_perc);
+}
+
+/**
+ * Replays one week of a synthetic current profile with jittered time steps
+ * and compares the fixed-point counter and the previous float algorithm
+ * (percentage delta subtracted in every step) against an exact reference.
+ */
+void testSOX_ReplayOneWeekDrift(void) {
+    SOX_COUNTER_s counter     = {0};
+    SOX_REFERENCE_s reference = {0};
+    int64_t exact_uAs         = 0;
+    float floatSoc_perc       = 50.0f;
+    int32_t current_mA        = 0;
+    uint32_t timestamp_ms     = 0u;
+
+    SOX_InitializeCounter(&counter, timestamp_ms);
+    SOX_SetReference(&reference, TEST_CAPACITY_mAs, 0, 50.0f, 50.0f, 50.0f);
+
+    while (timestamp_ms < TEST_REPLAY_DURATION_ms) {
+        /* 100 ms task with up to 10 ms jitter */
+        const uint32_t timestep_ms = 95u + (TEST_GetRandom() % 11u);
+        timestamp_ms += timestep_ms;
+        /* random walk of the current between -100 A and 100 A */
+        current_mA += (int32_t)(TEST_GetRandom() % 2001u) - 1000;
+        if (current_mA > 100000) {
+            current_mA = 100000;
+        }
+        if (current_mA < -100000) {
+            current_mA = -100000;
+        }
+        /* keep the state of charge around 50 % to avoid limiting */
+        if ((exact_uAs > (TEST_CAPACITY_mAs * 100)) && (current_mA > 0)) {
+            current_mA = -current_mA;
+        }
+        if ((exact_uAs < -(TEST_CAPACITY_mAs * 100)) && (current_mA < 0)) {
+            current_mA = -current_mA;
+        }
+
+        exact_uAs += (int64_t)current_mA * (int64_t)timestep_ms;
+        SOX_AddSample(&counter, current_mA, 400000, timestamp_ms);
+
+        const float timestep_s    = (float)timestep_ms / 1000.0f;
+        const float deltaSoc_perc = ((((float)current_mA / 1000.0f) * timestep_s) /
+                                     ((float)TEST_CAPACITY_mAs / 1000.0f)) *
+                                    100.0f;
+        floatSoc_perc -= deltaSoc_perc;
+    }
+
+    /* the integration itself is exact */
+    TEST_ASSERT_EQUAL_INT64(exact_uAs, (counter.dischargedCharge_mAs * 1000) + counter.chargeRemainder_uAs);
+    TEST_ASSERT_TRUE(abs(counter.chargeRemainder_uAs) < 1000);
+
+    float fixedSoc_perc = 0.0f;
+    SOX_GetPercentages(&reference, counter.dischargedCharge_mAs, NULL_PTR, &fixedSoc_perc, NULL_PTR);
+    const double exactSoc_perc   = 50.0 - ((100.0 * (double)exact_uAs) / ((double)TEST_CAPACITY_mAs * 1000.0));
+    const double fixedDrift_perc = fabs((double)fixedSoc_perc - exactSoc_perc);
+    const double floatDrift_perc = fabs((double)floatSoc_perc - exactSoc_perc);
+
+    char message[100] = {0};
+    (void)snprintf(
+        message,
+        sizeof(message),
+        "drift after one week: fixed %.6f %%, float %.6f %%",
+        fixedDrift_perc,
+        floatDrift_perc);
+    TEST_MESSAGE(message);
+
+    /* only the conversion to float for publishing is inexact */
+    TEST_ASSERT_TRUE(fixedDrift_perc < 0.0001);
+    TEST_ASSERT_TRUE(fixedDrift_perc < floatDrift_perc);
+}
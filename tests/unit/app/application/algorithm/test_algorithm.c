@@ -54,6 +54,9 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 #include "Mockalgorithm_cfg.h"
+#include "Mockdatabase.h"
+#include "Mockdiag.h"
+#include "Mockmcu.h"
 #include "Mockos.h"
 #include "Mocktest_algorithm_stubs.h"
 
@@ -62,29 +65,75 @@
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 ALGO_TASKS_s algo_algorithms[] = {
-    {ALGO_UNINITIALIZED, 100, 1000, 0, NULL_PTR, &TEST_AlgorithmComputeFunction},
-    {ALGO_UNINITIALIZED, 100, 1000, 0, &TEST_AlgorithmInitializationFunction, &TEST_AlgorithmComputeFunction},
+    {ALGO_UNINITIALIZED,
+     100u,
+     0u,
+     1000u,
+     ALGO_TRIGGER_CYCLIC,
+     DATA_BLOCK_ID_MAX,
+     NULL_PTR,
+     &TEST_AlgorithmComputeFunction,
+     0u,
+     0u,
+     {0u, 0u, 0u, 0u, 0u}},
+    {ALGO_UNINITIALIZED,
+     100u,
+     0u,
+     1000u,
+     ALGO_TRIGGER_CYCLIC,
+     DATA_BLOCK_ID_MAX,
+     &TEST_AlgorithmInitializationFunction,
+     &TEST_AlgorithmComputeFunction,
+     0u,
+     0u,
+     {0u, 0u, 0u, 0u, 0u}},
 };
 
 const uint16_t algo_length = sizeof(algo_algorithms) / sizeof(algo_algorithms[0]);
 
+/** the cycle counter is simulated with one cycle per microsecond */
+static uint32_t TEST_ConvertCycleDifferenceToTimespan_us(uint32_t cycles, int numCalls) {
+    return cycles;
+}
+
+/** expects one run of the compute function that takes executionTime_us */
+static void TEST_ExpectRun(uint32_t algorithmIndex, uint32_t executionTime_us) {
+    MCU_GetCycleCount_ExpectAndReturn(1000u);
+    TEST_AlgorithmComputeFunction_Expect();
+    MCU_GetCycleCount_ExpectAndReturn(1000u + executionTime_us);
+    ALGO_MarkAsDone_Expect(algorithmIndex);
+}
+
+/** emulates #ALGO_MonitorExecutionTime() blocking the first algorithm while it runs */
+static void TEST_BlockWhileRunning(int numCalls) {
+    algo_algorithms[0].state = ALGO_BLOCKED;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
     /* uninitialize everything */
     for (uint16_t i = 0u; i < algo_length; i++) {
-        algo_algorithms[i].state = ALGO_UNINITIALIZED;
+        algo_algorithms[i].state          = ALGO_UNINITIALIZED;
+        algo_algorithms[i].period_ms      = 100u;
+        algo_algorithms[i].phase_ms       = 0u;
+        algo_algorithms[i].trigger        = ALGO_TRIGGER_CYCLIC;
+        algo_algorithms[i].triggerBlockId = DATA_BLOCK_ID_MAX;
+        algo_algorithms[i].nextRelease_ms = 0u;
+        algo_algorithms[i].startCycle     = 0u;
+        algo_algorithms[i].statistics     = (ALGO_STATISTICS_s){0u, 0u, 0u, 0u, 0u};
     }
 
     /* relock initialization */
     TEST_ALGO_ResetInitializationRequest();
+    TEST_ALGO_ResetScheduler();
+
+    MCU_ConvertCycleDifferenceToTimespan_us_StubWithCallback(TEST_ConvertCycleDifferenceToTimespan_us);
 }
 
 void tearDown(void) {
 }
 
 /*========== Test Cases =====================================================*/
-/* TODO: check behavior when timer flows over for the runtime analysis */
-
 void testUninitializedCallsNothing(void) {
     /* when no algorithm is initialized and init is not unlocked then nothing should be called */
     OS_EnterTaskCritical_Ignore();
@@ -109,14 +158,10 @@ void testUnlockInitialization(void) {
     /* call to the init function of the second entry (first one has no init) */
     TEST_AlgorithmInitializationFunction_ExpectAndReturn(STD_OK);
 
-    /* this is the retrieval of the start time for both algorithms and
+    /* this is the measurement of the execution time for both algorithms and
        after that both algorithms should be called */
-    OS_GetTickCount_ExpectAndReturn(0u);
-    TEST_AlgorithmComputeFunction_Expect();
-    ALGO_MarkAsDone_Expect(0u);
-    OS_GetTickCount_ExpectAndReturn(0u);
-    TEST_AlgorithmComputeFunction_Expect();
-    ALGO_MarkAsDone_Expect(1u);
+    TEST_ExpectRun(0u, 10u);
+    TEST_ExpectRun(1u, 10u);
 
     ALGO_MainFunction();
 
@@ -134,17 +179,28 @@ void testUnlockInitializationInvalidAlgorithmConfiguration(void) {
     OS_ExitTaskCritical_Ignore();
     ALGO_UnlockInitialization();
 
-    const uint32_t storeCycleTime = algo_algorithms[0].cycleTime_ms;
-    /* set to an invalid cycle time */
-    algo_algorithms[0].cycleTime_ms = ALGO_TICK_MS + 1u;
+    /* set to an invalid period */
+    algo_algorithms[0].period_ms = ALGO_TICK_MS + 1u;
 
     TEST_ASSERT_FAIL_ASSERT(ALGO_MainFunction());
 
     TEST_ASSERT_EQUAL(ALGO_UNINITIALIZED, algo_algorithms[0].state);
     TEST_ASSERT_EQUAL(ALGO_UNINITIALIZED, algo_algorithms[1].state);
+}
+
+void testUnlockInitializationInvalidPhase(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
 
-    /* restore cycle time for other tests */
-    algo_algorithms[0].cycleTime_ms = storeCycleTime;
+    /* the phase has to be shorter than the period */
+    algo_algorithms[0].phase_ms = algo_algorithms[0].period_ms;
+    TEST_ASSERT_FAIL_ASSERT(ALGO_MainFunction());
+
+    /* the phase has to be a multiple of the tick */
+    algo_algorithms[0].period_ms = 5u * ALGO_TICK_MS;
+    algo_algorithms[0].phase_ms  = ALGO_TICK_MS / 2u;
+    TEST_ASSERT_FAIL_ASSERT(ALGO_MainFunction());
 }
 
 void testUnsuccessfulInitialization(void) {
@@ -159,9 +215,7 @@ void testUnsuccessfulInitialization(void) {
 
     /* now the algorithm without init should be running and the other one in
        error state */
-    OS_GetTickCount_ExpectAndReturn(0u);
-    TEST_AlgorithmComputeFunction_Expect();
-    ALGO_MarkAsDone_Expect(0u);
+    TEST_ExpectRun(0u, 10u);
 
     ALGO_MainFunction();
 
@@ -179,7 +233,7 @@ void testUnsuccessfulInitialization(void) {
 void testTwoTimesInitialization(void) {
     OS_EnterTaskCritical_Ignore();
     OS_ExitTaskCritical_Ignore();
-    OS_GetTickCount_IgnoreAndReturn(0u);
+    MCU_GetCycleCount_IgnoreAndReturn(0u);
     TEST_AlgorithmComputeFunction_Ignore();
     ALGO_MarkAsDone_Ignore();
 
@@ -221,60 +275,193 @@ void testWrongInitializationImplementation(void) {
 }
 
 void testCycleTimeZero(void) {
-    /* this test aims to test what a cycle time of zero does */
+    /* this test aims to test what a period of zero does */
 
     /* unlock so that we can continue */
     OS_EnterTaskCritical_Ignore();
     OS_ExitTaskCritical_Ignore();
     ALGO_UnlockInitialization();
 
-    /* inject a cycle time of zero */
-    algo_algorithms[0].cycleTime_ms = 0u;
+    /* inject a period of zero */
+    algo_algorithms[0].period_ms = 0u;
 
     /* call the main function;
        if this crashes we ran probably into a division by zero;*/
     TEST_AlgorithmInitializationFunction_ExpectAndReturn(STD_OK);
-    OS_GetTickCount_ExpectAndReturn(0u);
+    TEST_ExpectRun(0u, 10u);
+    TEST_ExpectRun(1u, 10u);
+    ALGO_MainFunction();
+}
+
+void testPeriodAndPhase(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
+
+    /* the first algorithm runs every 300ms, starting at 100ms */
+    algo_algorithms[0].period_ms = 3u * ALGO_TICK_MS;
+    algo_algorithms[0].phase_ms  = ALGO_TICK_MS;
+    /* the second algorithm runs every 200ms, starting at 0ms */
+    algo_algorithms[1].period_ms = 2u * ALGO_TICK_MS;
+
+    const bool runsFirst[]  = {false, true, false, false, true, false, false, true};
+    const bool runsSecond[] = {true, false, true, false, true, false, true, false};
+
+    TEST_AlgorithmInitializationFunction_ExpectAndReturn(STD_OK);
+    for (uint8_t tick = 0u; tick < (sizeof(runsFirst) / sizeof(runsFirst[0])); tick++) {
+        if (runsFirst[tick] == true) {
+            TEST_ExpectRun(0u, 10u);
+        }
+        if (runsSecond[tick] == true) {
+            TEST_ExpectRun(1u, 10u);
+        }
+        ALGO_MainFunction();
+        /* emulate the completion of the algorithms */
+        algo_algorithms[0].state = ALGO_READY;
+        algo_algorithms[1].state = ALGO_READY;
+    }
+    TEST_ASSERT_EQUAL_UINT32(3u, algo_algorithms[0].statistics.nrOfRuns);
+    TEST_ASSERT_EQUAL_UINT32(4u, algo_algorithms[1].statistics.nrOfRuns);
+}
+
+void testDataTriggeredAlgorithm(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
+
+    algo_algorithms[1].trigger        = ALGO_TRIGGER_DATA;
+    algo_algorithms[1].triggerBlockId = DATA_BLOCK_ID_CURRENT_SENSOR;
+
+    /* the algorithm subscribes with its own bit before it is initialized */
+    DATA_SubscribeToDataBlock_ExpectAndReturn(DATA_BLOCK_ID_CURRENT_SENSOR, 0x2u, STD_OK);
+    TEST_AlgorithmInitializationFunction_ExpectAndReturn(STD_OK);
+    /* no update: only the cyclic algorithm runs */
+    DATA_GetDataBlockUpdates_ExpectAndReturn(0x2u, 0u, 0u);
+    TEST_ExpectRun(0u, 10u);
+    ALGO_MainFunction();
+    TEST_ASSERT_EQUAL(ALGO_READY, algo_algorithms[1].state);
+
+    /* update: both algorithms run */
+    algo_algorithms[0].state = ALGO_READY;
+    DATA_GetDataBlockUpdates_ExpectAndReturn(0x2u, 0u, 0x2u);
+    TEST_ExpectRun(0u, 10u);
+    TEST_ExpectRun(1u, 10u);
+    ALGO_MainFunction();
+}
+
+void testDataTriggeredAlgorithmSubscriptionFails(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
+
+    algo_algorithms[1].trigger        = ALGO_TRIGGER_DATA;
+    algo_algorithms[1].triggerBlockId = DATA_BLOCK_ID_CURRENT_SENSOR;
+
+    /* the initialization function is not called if the subscription fails */
+    DATA_SubscribeToDataBlock_ExpectAndReturn(DATA_BLOCK_ID_CURRENT_SENSOR, 0x2u, STD_NOT_OK);
+    TEST_ExpectRun(0u, 10u);
+    ALGO_MainFunction();
+    TEST_ASSERT_EQUAL(ALGO_FAILED_INIT, algo_algorithms[1].state);
+}
+
+void testExecutionTimeStatistics(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
+    algo_algorithms[1].state = ALGO_FAILED_INIT;
+
+    const uint32_t executionTimes_us[] = {300u, 100u, 200u};
+    for (uint8_t run = 0u; run < (sizeof(executionTimes_us) / sizeof(executionTimes_us[0])); run++) {
+        TEST_ExpectRun(0u, executionTimes_us[run]);
+        ALGO_MainFunction();
+        algo_algorithms[0].state = ALGO_READY;
+    }
+
+    ALGO_STATISTICS_s statistics = {0};
+    ALGO_GetStatistics(0u, &statistics);
+    TEST_ASSERT_EQUAL_UINT32(200u, statistics.lastExecutionTime_us);
+    TEST_ASSERT_EQUAL_UINT32(300u, statistics.worstExecutionTime_us);
+    TEST_ASSERT_EQUAL_UINT64(600u, statistics.totalExecutionTime_us);
+    TEST_ASSERT_EQUAL_UINT32(3u, statistics.nrOfRuns);
+    TEST_ASSERT_EQUAL_UINT32(0u, statistics.nrOfOverruns);
+
+    TEST_ASSERT_FAIL_ASSERT(ALGO_GetStatistics(algo_length, &statistics));
+    TEST_ASSERT_FAIL_ASSERT(ALGO_GetStatistics(0u, NULL_PTR));
+}
+
+void testDeadlineExceededAfterRun(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
+    algo_algorithms[1].state = ALGO_FAILED_INIT;
+
+    /* the overrun is reported with the index of the algorithm and blocks it */
+    MCU_GetCycleCount_ExpectAndReturn(1000u);
     TEST_AlgorithmComputeFunction_Expect();
+    MCU_GetCycleCount_ExpectAndReturn(2001u);
+    DIAG_Handler_ExpectAndReturn(
+        DIAG_ID_ALGORITHM_DEADLINE, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, DIAG_HANDLER_RETURN_OK);
     ALGO_MarkAsDone_Expect(0u);
-    OS_GetTickCount_ExpectAndReturn(0u);
-    TEST_AlgorithmComputeFunction_Expect();
-    ALGO_MarkAsDone_Expect(1u);
     ALGO_MainFunction();
+    TEST_ASSERT_EQUAL(ALGO_BLOCKED, algo_algorithms[0].state);
+    TEST_ASSERT_EQUAL_UINT32(1u, algo_algorithms[0].statistics.nrOfOverruns);
+
+    /* a blocked algorithm is not run again */
+    ALGO_MainFunction();
+    TEST_ASSERT_EQUAL_UINT32(1u, algo_algorithms[0].statistics.nrOfRuns);
+}
+
+void testDeadlineExceededDetectedByMonitor(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    ALGO_UnlockInitialization();
+    algo_algorithms[1].state = ALGO_FAILED_INIT;
+
+    /* the monitor blocks the algorithm while it is running and reports the
+       overrun, the run itself is only counted afterwards */
+    MCU_GetCycleCount_ExpectAndReturn(1000u);
+    TEST_AlgorithmComputeFunction_StubWithCallback(TEST_BlockWhileRunning);
+    MCU_GetCycleCount_ExpectAndReturn(3000u);
+    ALGO_MarkAsDone_Expect(0u);
+    ALGO_MainFunction();
+    TEST_ASSERT_EQUAL(ALGO_BLOCKED, algo_algorithms[0].state);
+    TEST_ASSERT_EQUAL_UINT32(1u, algo_algorithms[0].statistics.nrOfOverruns);
 }
 
 void testMonitorFunctionPassBecauseNotRunning(void) {
-    const uint32_t startTime   = 500u;
-    const uint32_t currentTime = 0u;
-    const ALGO_STATE_e state   = ALGO_READY;
+    const ALGO_STATE_e state = ALGO_READY;
 
-    algo_algorithms[0].startTime = startTime;
-    algo_algorithms[0].state     = state;
-    OS_GetTickCount_ExpectAndReturn(currentTime);
+    algo_algorithms[0].startCycle = 0u;
+    algo_algorithms[0].state      = state;
+    MCU_GetCycleCount_ExpectAndReturn(50000u);
     ALGO_MonitorExecutionTime();
     TEST_ASSERT_EQUAL(state, algo_algorithms[0].state);
 }
 
 void testMonitorFunctionPassBecauseInTime(void) {
-    const uint32_t startTime   = 500u;
-    const uint32_t currentTime = 500u;
-    const ALGO_STATE_e state   = ALGO_RUNNING;
+    const ALGO_STATE_e state = ALGO_RUNNING;
 
-    algo_algorithms[0].startTime = startTime;
-    algo_algorithms[0].state     = state;
-    OS_GetTickCount_ExpectAndReturn(currentTime);
+    algo_algorithms[0].startCycle = 500u;
+    algo_algorithms[0].state      = state;
+    MCU_GetCycleCount_ExpectAndReturn(1500u);
     ALGO_MonitorExecutionTime();
     TEST_ASSERT_EQUAL(state, algo_algorithms[0].state);
 }
 
 void testMonitorFunctionStopBecauseOutOfTime(void) {
-    const uint32_t startTime   = 500u;
-    const uint32_t currentTime = 50000u;
-    const ALGO_STATE_e state   = ALGO_RUNNING;
-
-    algo_algorithms[0].startTime = startTime;
-    algo_algorithms[0].state     = state;
-    OS_GetTickCount_ExpectAndReturn(currentTime);
+    algo_algorithms[0].startCycle = 500u;
+    algo_algorithms[0].state      = ALGO_RUNNING;
+    MCU_GetCycleCount_ExpectAndReturn(1501u);
+    DIAG_Handler_ExpectAndReturn(
+        DIAG_ID_ALGORITHM_DEADLINE, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, 0u, DIAG_HANDLER_RETURN_OK);
     ALGO_MonitorExecutionTime();
     TEST_ASSERT_EQUAL(ALGO_BLOCKED, algo_algorithms[0].state);
 }
+
+void testMonitorFunctionHandlesCounterWrapAround(void) {
+    algo_algorithms[0].startCycle = UINT32_MAX - 499u;
+    algo_algorithms[0].state      = ALGO_RUNNING;
+    MCU_GetCycleCount_ExpectAndReturn(500u);
+    ALGO_MonitorExecutionTime();
+    TEST_ASSERT_EQUAL(ALGO_RUNNING, algo_algorithms[0].state);
+}
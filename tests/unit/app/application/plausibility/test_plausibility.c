@@ -55,6 +55,7 @@
 #include "unity.h"
 #include "Mockdiag.h"
 
+#include "cell_statistics.h"
 #include "plausibility.h"
 #include "test_assert_helper.h"
 
@@ -133,3 +134,33 @@ void testCheckPackVoltagecellVoltageandcurrentSensorDifferenceINT32Max(void) {
     int32_t highVoltage_mV = INT32_MAX;
     TEST_ASSERT_EQUAL(PL_CheckStringVoltage(packVoltage_mV, highVoltage_mV), STD_OK);
 }
+
+void testCheckVoltageSpreadInvalidatesOutliers(void) {
+    static DATA_BLOCK_MIN_MAX_s minMaxAverage = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        minMaxAverage.averageCellVoltage_mV[s] = 3000;
+        for (uint16_t c = 0u; c < BS_NR_OF_BAT_CELLS; c++) {
+            cellVoltage.cellVoltage_mV[s][c] = 3000;
+        }
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES; m++) {
+            cellVoltage.invalidCellVoltage[s][m] = 0u;
+        }
+    }
+    /* string 0: values exactly at the tolerance are plausible */
+    cellVoltage.cellVoltage_mV[0][0] = 3000 + PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV;
+    cellVoltage.cellVoltage_mV[0][1] = 3000 - PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV;
+    /* string 1: outliers on both sides, the already invalid value is not reported again */
+    cellVoltage.cellVoltage_mV[1][2]     = 3001 + PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV;
+    cellVoltage.cellVoltage_mV[1][3]     = 2999 - PL_CELL_VOLTAGE_SPREAD_TOLERANCE_mV;
+    cellVoltage.cellVoltage_mV[1][4]     = 0;
+    cellVoltage.invalidCellVoltage[1][0] = 0x10u;
+
+    DIAG_CheckEvent_ExpectAndReturn(STD_OK, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, 0u, STD_OK);
+    DIAG_CheckEvent_ExpectAndReturn(STD_NOT_OK, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, 1u, STD_OK);
+    for (uint8_t s = 2u; s < BS_NR_OF_STRINGS; s++) {
+        DIAG_CheckEvent_ExpectAndReturn(STD_OK, DIAG_ID_PLAUSIBILITY_CELL_VOLTAGE_SPREAD, DIAG_STRING, s, STD_OK);
+    }
+    TEST_ASSERT_EQUAL(STD_NOT_OK, PL_CheckVoltageSpread(&cellVoltage, &minMaxAverage));
+    TEST_ASSERT_EQUAL_UINT64(0u, cellVoltage.invalidCellVoltage[0][0]);
+    TEST_ASSERT_EQUAL_UINT64(0x1Cu, cellVoltage.invalidCellVoltage[1][0]);
+}
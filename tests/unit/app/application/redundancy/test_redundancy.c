@@ -59,6 +59,7 @@
 #include "Mockos.h"
 #include "Mockplausibility.h"
 
+#include "cell_statistics.h"
 #include "foxmath.h"
 #include "redundancy.h"
 #include "test_assert_helper.h"
@@ -185,6 +186,39 @@ void testMRC_CalculateCellTemperatureMinMaxAverageNullPointer(void) {
     TEST_ASSERT_FAIL_ASSERT(TEST_MRC_CalculateCellTemperatureMinMaxAverage(&dummy1, NULL_PTR));
 }
 
+void testMRC_CalculateCellVoltageMinMaxAverage(void) {
+    static DATA_BLOCK_CELL_VOLTAGE_s cellVoltages = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    static DATA_BLOCK_MIN_MAX_s minMaxAverage     = {.header.uniqueId = DATA_BLOCK_ID_MIN_MAX};
+    for (uint8_t s = 0u; s < BS_NR_OF_STRINGS; s++) {
+        for (uint16_t c = 0u; c < BS_NR_OF_BAT_CELLS; c++) {
+            cellVoltages.cellVoltage_mV[s][c] = 3000;
+        }
+        for (uint8_t m = 0u; m < BS_NR_OF_MODULES; m++) {
+            cellVoltages.invalidCellVoltage[s][m] = 0u;
+        }
+    }
+    /* string 0: the smallest value is invalid and not used */
+    cellVoltages.cellVoltage_mV[0][0]     = 1000;
+    cellVoltages.invalidCellVoltage[0][0] = 0x01u;
+    cellVoltages.cellVoltage_mV[0][1]     = 2900;
+    cellVoltages.cellVoltage_mV[0][2]     = 3100;
+    cellVoltages.cellVoltage_mV[0][3]     = 2900;
+    const int32_t sum_mV                  = (3000 * (BS_NR_OF_BAT_CELLS - 4)) + 2900 + 3100 + 2900;
+    /* last string: all values are invalid */
+    for (uint8_t m = 0u; m < BS_NR_OF_MODULES; m++) {
+        cellVoltages.invalidCellVoltage[BS_NR_OF_STRINGS - 1u][m] = UINT64_MAX;
+    }
+
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_MRC_CalculateCellVoltageMinMaxAverage(&cellVoltages, &minMaxAverage));
+    TEST_ASSERT_EQUAL_INT16(2900, minMaxAverage.minimumCellVoltage_mV[0]);
+    TEST_ASSERT_EQUAL_UINT16(1u, minMaxAverage.nrCellMinimumCellVoltage[0]);
+    TEST_ASSERT_EQUAL_UINT16(0u, minMaxAverage.nrModuleMinimumCellVoltage[0]);
+    TEST_ASSERT_EQUAL_INT16(3100, minMaxAverage.maximumCellVoltage_mV[0]);
+    TEST_ASSERT_EQUAL_UINT16(2u, minMaxAverage.nrCellMaximumCellVoltage[0]);
+    TEST_ASSERT_EQUAL_INT16(sum_mV / (BS_NR_OF_BAT_CELLS - 1), minMaxAverage.averageCellVoltage_mV[0]);
+    TEST_ASSERT_EQUAL_INT16(0, minMaxAverage.averageCellVoltage_mV[BS_NR_OF_STRINGS - 1u]);
+}
+
 void testMRC_ValidateCellVoltageNullPointer(void) {
     DATA_BLOCK_CELL_VOLTAGE_s dummy = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
     TEST_ASSERT_FAIL_ASSERT(TEST_MRC_ValidateCellVoltage(NULL_PTR, &dummy, &dummy));
@@ -76,8 +76,15 @@ const CAN_MSG_TX_TYPE_s can_txMessages[] = {
     {0x001, 8, 100, 0, littleEndian, &can_dummy},
 };
 
+static uint8_t rxCallbackCalls = 0u;
+static uint32_t can_rxCounter(uint32_t id, uint8_t dlc, CAN_byteOrder_e byteOrder, uint8_t *canData, uint32_t *pMuxId) {
+    rxCallbackCalls++;
+    return 0;
+}
+
 const CAN_MSG_RX_TYPE_s can_rxMessages[] = {
-    {0x002, 8, 0, littleEndian, &can_dummy},
+    {0x002, 8, 0, littleEndian, &can_rxCounter, CAN_RX_PRIORITY_LOW},
+    {0x003, 8, 0, littleEndian, &can_rxCounter, CAN_RX_PRIORITY_HIGH},
 };
 
 const uint8_t can_txLength = sizeof(can_txMessages) / sizeof(can_txMessages[0]);
@@ -85,6 +92,18 @@ const uint8_t can_rxLength = sizeof(can_rxMessages) / sizeof(can_rxMessages[0]);
 
 CAN_STATE_s *canTestState = NULL_PTR;
 
+/** schedule used by the TX schedule tests */
+static CAN_TX_SCHEDULE_s testSchedule = {0};
+
+/** dispatch table used by the RX dispatch tests */
+static CAN_RX_DISPATCH_TABLE_s testDispatchTable = {0};
+
+/** receive buffer of the CAN module */
+static CAN_RX_BUFFER_s *canTestRxBuffer = NULL_PTR;
+
+/** payload used by the RX buffer tests */
+static const uint8_t testRxData[CAN_MAX_DLC] = {1u, 2u, 3u, 4u, 5u, 6u, 7u, 8u};
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
     canTestState = TEST_CAN_GetCANState();
@@ -95,6 +114,17 @@ void setUp(void) {
         canTestState->currentSensorPresent[stringNumber]   = false;
         canTestState->currentSensorCCPresent[stringNumber] = false;
     }
+
+    /* empty RX buffer without statistics and dispatch table of the test configuration */
+    canTestRxBuffer                           = TEST_CAN_GetRxBuffer();
+    canTestRxBuffer->readIndex                = 0u;
+    canTestRxBuffer->writeIndex               = 0u;
+    canTestRxBuffer->receivedMessages         = 0u;
+    canTestRxBuffer->overflowCounter          = 0u;
+    canTestRxBuffer->droppedLowPriorityFrames = 0u;
+    canTestRxBuffer->highWaterMark            = 0u;
+    CAN_BuildRxDispatchTable(can_rxMessages, can_rxLength, TEST_CAN_GetRxDispatchTable());
+    rxCallbackCalls = 0u;
 }
 
 void tearDown(void) {
@@ -189,3 +219,217 @@ void testIsCurrentSensorCcPresent(void) {
         TEST_ASSERT_EQUAL(true, canTestState->currentSensorCCPresent[stringNumber]);
     }
 }
+
+void testWorstCaseFrameBits(void) {
+    /* worst-case lengths of standard frames including stuff bits and interframe space */
+    TEST_ASSERT_EQUAL(55u, TEST_CAN_GetWorstCaseFrameBits(0u));
+    TEST_ASSERT_EQUAL(135u, TEST_CAN_GetWorstCaseFrameBits(8u));
+}
+
+void testBuildTxScheduleInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(CAN_BuildTxSchedule(NULL_PTR, 1u, &testSchedule));
+    TEST_ASSERT_FAIL_ASSERT(CAN_BuildTxSchedule(can_txMessages, can_txLength, NULL_PTR));
+}
+
+void testBuildTxScheduleSlotsContainDueMessages(void) {
+    const CAN_MSG_TX_TYPE_s messages[] = {
+        {0x010, 8, 100, 0, littleEndian, NULL_PTR, NULL_PTR},
+        {0x011, 8, 1000, 0, littleEndian, NULL_PTR, NULL_PTR},
+        {0x012, 8, 100, 10, littleEndian, NULL_PTR, NULL_PTR},
+        {0x013, 4, 200, 30, littleEndian, NULL_PTR, NULL_PTR},
+    };
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildTxSchedule(messages, 4u, &testSchedule));
+
+    /* every slot has to contain exactly the messages the modulo check selects, in configuration order */
+    uint16_t numberOfTransmissions = 0u;
+    for (uint16_t slot = 0u; slot < CAN_TX_SCHEDULE_TICKS; slot++) {
+        uint16_t entry = testSchedule.slotStart[slot];
+        for (uint8_t i = 0u; i < 4u; i++) {
+            if (((slot * CAN_TICK_MS) % messages[i].repetitionTime) == messages[i].repetitionPhase) {
+                TEST_ASSERT_LESS_THAN(testSchedule.slotStart[slot + 1u], entry);
+                TEST_ASSERT_EQUAL(i, testSchedule.entries[entry]);
+                entry++;
+            }
+        }
+        TEST_ASSERT_EQUAL(testSchedule.slotStart[slot + 1u], entry);
+        numberOfTransmissions += testSchedule.slotStart[slot + 1u] - testSchedule.slotStart[slot];
+    }
+    /* per cycle: 10 + 1 + 10 + 5 transmissions */
+    TEST_ASSERT_EQUAL(26u, numberOfTransmissions);
+    /* busiest slot is slot 0 with two frames of 8 bytes */
+    TEST_ASSERT_EQUAL(2u * TEST_CAN_GetWorstCaseFrameBits(8u), testSchedule.maximumBitsPerSlot);
+}
+
+void testBuildTxScheduleRejectsInvalidTiming(void) {
+    const CAN_MSG_TX_TYPE_s notMultipleOfTick[]  = {{0x010, 8, 105, 0, littleEndian, NULL_PTR, NULL_PTR}};
+    const CAN_MSG_TX_TYPE_s notDividingCycle[]   = {{0x010, 8, 300, 0, littleEndian, NULL_PTR, NULL_PTR}};
+    const CAN_MSG_TX_TYPE_s phaseTooLarge[]      = {{0x010, 8, 100, 100, littleEndian, NULL_PTR, NULL_PTR}};
+    const CAN_MSG_TX_TYPE_s phaseNotOnTick[]     = {{0x010, 8, 100, 5, littleEndian, NULL_PTR, NULL_PTR}};
+    const CAN_MSG_TX_TYPE_s zeroRepetitionTime[] = {{0x010, 8, 0, 0, littleEndian, NULL_PTR, NULL_PTR}};
+    const CAN_MSG_TX_TYPE_s dataLengthTooLarge[] = {{0x010, 9, 100, 0, littleEndian, NULL_PTR, NULL_PTR}};
+    TEST_ASSERT_EQUAL(STD_NOT_OK, CAN_BuildTxSchedule(notMultipleOfTick, 1u, &testSchedule));
+    TEST_ASSERT_EQUAL(STD_NOT_OK, CAN_BuildTxSchedule(notDividingCycle, 1u, &testSchedule));
+    TEST_ASSERT_EQUAL(STD_NOT_OK, CAN_BuildTxSchedule(phaseTooLarge, 1u, &testSchedule));
+    TEST_ASSERT_EQUAL(STD_NOT_OK, CAN_BuildTxSchedule(phaseNotOnTick, 1u, &testSchedule));
+    TEST_ASSERT_EQUAL(STD_NOT_OK, CAN_BuildTxSchedule(zeroRepetitionTime, 1u, &testSchedule));
+    TEST_ASSERT_EQUAL(STD_NOT_OK, CAN_BuildTxSchedule(dataLengthTooLarge, 1u, &testSchedule));
+    /* an invalid schedule is empty */
+    TEST_ASSERT_EQUAL(0u, testSchedule.slotStart[CAN_TX_SCHEDULE_TICKS]);
+}
+
+void testBuildTxScheduleRejectsPhaseCollisions(void) {
+    /* number of 8 byte frames that fit in the bus load limit of one tick */
+    const uint8_t framesPerTick = CAN_TX_MAXIMUM_BITS_PER_TICK / TEST_CAN_GetWorstCaseFrameBits(8u);
+    CAN_MSG_TX_TYPE_s messages[CAN_TX_MAXIMUM_MESSAGES_PER_TICK + 1u] = {0};
+    for (uint8_t i = 0u; i < (CAN_TX_MAXIMUM_MESSAGES_PER_TICK + 1u); i++) {
+        messages[i].id              = i;
+        messages[i].dlc             = 8u;
+        messages[i].repetitionTime  = 100u;
+        messages[i].repetitionPhase = 0u;
+    }
+    /* all frames in the same tick, but within the limit */
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildTxSchedule(messages, framesPerTick, &testSchedule));
+
+    /* one more frame in the same tick exceeds the bus load limit */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, CAN_BuildTxSchedule(messages, framesPerTick + 1u, &testSchedule));
+
+    /* moving the phase of the additional frame resolves the collision */
+    messages[framesPerTick].repetitionPhase = 50u;
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildTxSchedule(messages, framesPerTick + 1u, &testSchedule));
+
+    /* empty frames use little bus load, but each needs a message box */
+    for (uint8_t i = 0u; i < (CAN_TX_MAXIMUM_MESSAGES_PER_TICK + 1u); i++) {
+        messages[i].dlc             = 0u;
+        messages[i].repetitionPhase = 0u;
+    }
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildTxSchedule(messages, CAN_TX_MAXIMUM_MESSAGES_PER_TICK, &testSchedule));
+    TEST_ASSERT_EQUAL(
+        STD_NOT_OK, CAN_BuildTxSchedule(messages, CAN_TX_MAXIMUM_MESSAGES_PER_TICK + 1u, &testSchedule));
+}
+
+void testBuildRxDispatchTableInvalidInput(void) {
+    uint8_t entry = 0u;
+    TEST_ASSERT_FAIL_ASSERT(CAN_BuildRxDispatchTable(NULL_PTR, 1u, &testDispatchTable));
+    TEST_ASSERT_FAIL_ASSERT(CAN_BuildRxDispatchTable(can_rxMessages, can_rxLength, NULL_PTR));
+    TEST_ASSERT_FAIL_ASSERT(CAN_FindRxHandlers(NULL_PTR, 0u, &entry));
+    TEST_ASSERT_FAIL_ASSERT(CAN_FindRxHandlers(&testDispatchTable, 0u, NULL_PTR));
+}
+
+void testBuildRxDispatchTableTooManyMessages(void) {
+    CAN_MSG_RX_TYPE_s messages[CAN_RX_DISPATCH_MAXIMUM_ENTRIES + 1u] = {0};
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildRxDispatchTable(messages, CAN_RX_DISPATCH_MAXIMUM_ENTRIES, &testDispatchTable));
+    TEST_ASSERT_EQUAL(
+        STD_NOT_OK, CAN_BuildRxDispatchTable(messages, CAN_RX_DISPATCH_MAXIMUM_ENTRIES + 1u, &testDispatchTable));
+    TEST_ASSERT_EQUAL(0u, testDispatchTable.numberOfEntries);
+}
+
+void testRxDispatchFindsAllHandlersOfAnId(void) {
+    const CAN_MSG_RX_TYPE_s messages[] = {
+        {0x521, 8, 0, bigEndian, NULL_PTR},
+        {0x120, 8, 0, littleEndian, NULL_PTR},
+        {0x037, 8, 0, littleEndian, NULL_PTR},
+        {0x120, 8, 0, littleEndian, NULL_PTR},
+        {0x777, 8, 0, littleEndian, NULL_PTR},
+        {0x100, 8, 0, littleEndian, NULL_PTR},
+        {0x120, 8, 0, littleEndian, NULL_PTR},
+    };
+    uint8_t entry = 0u;
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildRxDispatchTable(messages, 7u, &testDispatchTable));
+    TEST_ASSERT_EQUAL(7u, testDispatchTable.numberOfEntries);
+
+    /* IDs are sorted */
+    for (uint8_t i = 1u; i < testDispatchTable.numberOfEntries; i++) {
+        TEST_ASSERT_TRUE(testDispatchTable.id[i - 1u] <= testDispatchTable.id[i]);
+    }
+
+    /* all three handlers of 0x120 are found in configuration order */
+    TEST_ASSERT_EQUAL(3u, CAN_FindRxHandlers(&testDispatchTable, 0x120u, &entry));
+    TEST_ASSERT_EQUAL(1u, testDispatchTable.message[entry]);
+    TEST_ASSERT_EQUAL(3u, testDispatchTable.message[entry + 1u]);
+    TEST_ASSERT_EQUAL(6u, testDispatchTable.message[entry + 2u]);
+
+    /* first and last ID */
+    TEST_ASSERT_EQUAL(1u, CAN_FindRxHandlers(&testDispatchTable, 0x037u, &entry));
+    TEST_ASSERT_EQUAL(2u, testDispatchTable.message[entry]);
+    TEST_ASSERT_EQUAL(1u, CAN_FindRxHandlers(&testDispatchTable, 0x777u, &entry));
+    TEST_ASSERT_EQUAL(4u, testDispatchTable.message[entry]);
+
+    /* IDs that are not configured, below, between and above the configured IDs */
+    TEST_ASSERT_EQUAL(0u, CAN_FindRxHandlers(&testDispatchTable, 0x001u, &entry));
+    TEST_ASSERT_EQUAL(0u, CAN_FindRxHandlers(&testDispatchTable, 0x240u, &entry));
+    TEST_ASSERT_EQUAL(0u, CAN_FindRxHandlers(&testDispatchTable, 0x7FFu, &entry));
+
+    /* empty table */
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildRxDispatchTable(messages, 0u, &testDispatchTable));
+    TEST_ASSERT_EQUAL(0u, CAN_FindRxHandlers(&testDispatchTable, 0x120u, &entry));
+}
+
+void testRxBufferStoresAndDispatchesMessages(void) {
+    TEST_ASSERT_FAIL_ASSERT(TEST_CAN_StoreRxMessage(0x002u, NULL_PTR));
+
+    TEST_ASSERT_EQUAL(STD_OK, TEST_CAN_StoreRxMessage(0x002u, testRxData));
+    TEST_ASSERT_EQUAL(STD_OK, TEST_CAN_StoreRxMessage(0x003u, testRxData));
+    TEST_ASSERT_EQUAL(STD_OK, TEST_CAN_StoreRxMessage(0x004u, testRxData));
+    TEST_ASSERT_EQUAL(3u, canTestRxBuffer->receivedMessages);
+    TEST_ASSERT_EQUAL(3u, canTestRxBuffer->highWaterMark);
+
+    /* unknown IDs are consumed without a callback */
+    CAN_ReadRxBuffer();
+    TEST_ASSERT_EQUAL(2u, rxCallbackCalls);
+    TEST_ASSERT_EQUAL(canTestRxBuffer->writeIndex, canTestRxBuffer->readIndex);
+    /* the high-water mark is kept after the buffer has been emptied */
+    TEST_ASSERT_EQUAL(3u, canTestRxBuffer->highWaterMark);
+}
+
+void testRxBufferWrapsAround(void) {
+    for (uint8_t i = 0u; i < (3u * CAN0_RX_BUFFER_LENGTH); i++) {
+        TEST_ASSERT_EQUAL(STD_OK, TEST_CAN_StoreRxMessage(0x002u, testRxData));
+        CAN_ReadRxBuffer();
+    }
+    TEST_ASSERT_EQUAL(3u * CAN0_RX_BUFFER_LENGTH, rxCallbackCalls);
+    TEST_ASSERT_EQUAL(1u, canTestRxBuffer->highWaterMark);
+    TEST_ASSERT_EQUAL(0u, canTestRxBuffer->overflowCounter);
+}
+
+void testRxBufferDropsLowPriorityMessagesFirst(void) {
+    const uint8_t capacity            = CAN0_RX_BUFFER_LENGTH - 1u;
+    const uint8_t lowPriorityCapacity = capacity - CAN_RX_HIGH_PRIORITY_RESERVED_SLOTS;
+    /* low priority messages may only use the unreserved elements */
+    for (uint8_t i = 0u; i < lowPriorityCapacity; i++) {
+        TEST_ASSERT_EQUAL(STD_OK, TEST_CAN_StoreRxMessage(0x002u, testRxData));
+    }
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_CAN_StoreRxMessage(0x002u, testRxData));
+    /* unknown IDs are treated as low priority */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_CAN_StoreRxMessage(0x004u, testRxData));
+    TEST_ASSERT_EQUAL(2u, canTestRxBuffer->droppedLowPriorityFrames);
+    TEST_ASSERT_EQUAL(0u, canTestRxBuffer->overflowCounter);
+
+    /* high priority messages fill the reserved elements */
+    for (uint8_t i = 0u; i < CAN_RX_HIGH_PRIORITY_RESERVED_SLOTS; i++) {
+        TEST_ASSERT_EQUAL(STD_OK, TEST_CAN_StoreRxMessage(0x003u, testRxData));
+    }
+    TEST_ASSERT_EQUAL(capacity, canTestRxBuffer->highWaterMark);
+
+    /* a full buffer drops everything and does not overwrite pending messages */
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_CAN_StoreRxMessage(0x003u, testRxData));
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_CAN_StoreRxMessage(0x002u, testRxData));
+    TEST_ASSERT_EQUAL(2u, canTestRxBuffer->overflowCounter);
+    TEST_ASSERT_EQUAL(2u, canTestRxBuffer->droppedLowPriorityFrames);
+    TEST_ASSERT_EQUAL(capacity, canTestRxBuffer->receivedMessages);
+
+    CAN_ReadRxBuffer();
+    TEST_ASSERT_EQUAL(capacity, rxCallbackCalls);
+}
+
+void testRxStatisticsAreOnlyWrittenOnChange(void) {
+    /* the static copy of the statistics starts with zero */
+    TEST_CAN_UpdateRxStatistics();
+
+    /* new statistics are written exactly once */
+    TEST_ASSERT_EQUAL(STD_OK, TEST_CAN_StoreRxMessage(0x002u, testRxData));
+    DATA_Write_1_DataBlock_ExpectAndReturn(NULL_PTR, STD_OK);
+    DATA_Write_1_DataBlock_IgnoreArg_pDataFromSender0();
+    TEST_CAN_UpdateRxStatistics();
+    TEST_CAN_UpdateRxStatistics();
+    CAN_ReadRxBuffer();
+}
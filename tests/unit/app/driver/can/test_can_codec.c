@@ -0,0 +1,2832 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_can_codec.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Round trip tests of the CAN codecs against the DBC file
+ *
+ * @details This file is generated from tools/dbc/foxbms.dbc by
+ *          tools/dbc/can_codec_generator.py, do not edit it.
+ *          Every message is packed with random raw values. Each signal is
+ *          read back from the CAN data with the bit numbering of the DBC
+ *          file, the unused bits have to stay zero and unpacking has to
+ *          return the packed values.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "can_codec.h"
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of random values that are packed per message */
+#define TEST_ROUNDS (64u)
+
+/** state of the pseudo random number generator */
+static uint64_t testRandomState = 0u;
+
+/** returns a random raw value of a signal (round 0: all bits set, round 1: zero) */
+static int64_t TEST_GetRandomRaw(uint8_t round, uint8_t length, bool isSigned) {
+    uint64_t raw = 0u;
+    if (round == 0u) {
+        raw = UINT64_MAX;
+    } else if (round > 1u) {
+        /* xorshift64 */
+        testRandomState ^= testRandomState << 13u;
+        testRandomState ^= testRandomState >> 7u;
+        testRandomState ^= testRandomState << 17u;
+        raw = testRandomState;
+    }
+    if (length < 64u) {
+        raw &= (1ull << length) - 1u;
+        if (isSigned && (((raw >> (length - 1u)) & 1u) == 1u)) {
+            raw |= UINT64_MAX << length;
+        }
+    }
+    return (int64_t)raw;
+}
+
+/**
+ * reads a signal bit by bit from the CAN data with the bit numbering of
+ * the DBC file: the start bit is the least significant bit of little
+ * endian signals and the most significant bit of big endian signals
+ */
+static int64_t TEST_GetDbcSignal(
+    const uint8_t *pCanData,
+    uint8_t startBit,
+    uint8_t length,
+    bool isBigEndian,
+    bool isSigned) {
+    uint64_t raw = 0u;
+    uint8_t bit  = startBit;
+    for (uint8_t i = 0u; i < length; i++) {
+        const uint64_t value = (pCanData[bit / 8u] >> (bit % 8u)) & 1u;
+        if (isBigEndian) {
+            raw = (raw << 1u) | value;
+            /* continue with the most significant bit of the next byte */
+            bit = ((bit % 8u) == 0u) ? (bit + 15u) : (bit - 1u);
+        } else {
+            raw |= value << i;
+            bit++;
+        }
+    }
+    if (isSigned && (length < 64u) && (((raw >> (length - 1u)) & 1u) == 1u)) {
+        raw |= UINT64_MAX << length;
+    }
+    return (int64_t)raw;
+}
+
+/** returns the CAN data as little endian 64-bit value */
+static uint64_t TEST_GetFrame(const uint8_t *pCanData) {
+    uint64_t frame = 0u;
+    for (uint8_t i = 0u; i < 8u; i++) {
+        frame |= (uint64_t)pCanData[i] << (8u * i);
+    }
+    return frame;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    testRandomState = 0x2545F4914F6CDD1Dull;
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testRoundTripFoxbmsPackValues(void) {
+    CAN_FOXBMS_PACK_VALUES_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_PACK_VALUES_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_packCurrent = (int32_t)TEST_GetRandomRaw(round, 18u, true);
+        sent.foxBMS_batteryVoltage = (uint16_t)TEST_GetRandomRaw(round, 14u, false);
+        sent.foxBMS_busVoltage = (uint16_t)TEST_GetRandomRaw(round, 14u, false);
+        sent.foxBMS_packPower = (int32_t)TEST_GetRandomRaw(round, 18u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsPackValues(&sent, canData);
+
+        /* foxBMS_packCurrent: 41|18@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packCurrent, TEST_GetDbcSignal(canData, 41u, 18u, true, true));
+        /* foxBMS_batteryVoltage: 7|14@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_batteryVoltage, TEST_GetDbcSignal(canData, 7u, 14u, true, false));
+        /* foxBMS_busVoltage: 9|14@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_busVoltage, TEST_GetDbcSignal(canData, 9u, 14u, true, false));
+        /* foxBMS_packPower: 27|18@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packPower, TEST_GetDbcSignal(canData, 27u, 18u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x0u);
+
+        CAN_UnpackFoxbmsPackValues(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packCurrent, (int64_t)received.foxBMS_packCurrent);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_batteryVoltage, (int64_t)received.foxBMS_batteryVoltage);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_busVoltage, (int64_t)received.foxBMS_busVoltage);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packPower, (int64_t)received.foxBMS_packPower);
+    }
+}
+
+void testRoundTripFoxbmsLimitValues(void) {
+    CAN_FOXBMS_LIMIT_VALUES_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_LIMIT_VALUES_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_maxChargeCurrent = (uint16_t)TEST_GetRandomRaw(round, 12u, false);
+        sent.foxBMS_maxDischargeCurrent = (uint16_t)TEST_GetRandomRaw(round, 12u, false);
+        sent.foxBMS_maxChargePower = (uint16_t)TEST_GetRandomRaw(round, 12u, false);
+        sent.foxBMS_maxDischargePower = (uint16_t)TEST_GetRandomRaw(round, 12u, false);
+        sent.foxBMS_maxBatteryVoltage = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.foxBMS_minBatteryVoltage = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsLimitValues(&sent, canData);
+
+        /* foxBMS_maxChargeCurrent: 11|12@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_maxChargeCurrent,
+            TEST_GetDbcSignal(canData, 11u, 12u, true, false));
+        /* foxBMS_maxDischargeCurrent: 7|12@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_maxDischargeCurrent,
+            TEST_GetDbcSignal(canData, 7u, 12u, true, false));
+        /* foxBMS_maxChargePower: 35|12@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_maxChargePower, TEST_GetDbcSignal(canData, 35u, 12u, true, false));
+        /* foxBMS_maxDischargePower: 31|12@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_maxDischargePower,
+            TEST_GetDbcSignal(canData, 31u, 12u, true, false));
+        /* foxBMS_maxBatteryVoltage: 55|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_maxBatteryVoltage,
+            TEST_GetDbcSignal(canData, 55u, 8u, true, false));
+        /* foxBMS_minBatteryVoltage: 63|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_minBatteryVoltage,
+            TEST_GetDbcSignal(canData, 63u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x0u);
+
+        CAN_UnpackFoxbmsLimitValues(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_maxChargeCurrent, (int64_t)received.foxBMS_maxChargeCurrent);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_maxDischargeCurrent, (int64_t)received.foxBMS_maxDischargeCurrent);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_maxChargePower, (int64_t)received.foxBMS_maxChargePower);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_maxDischargePower, (int64_t)received.foxBMS_maxDischargePower);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_maxBatteryVoltage, (int64_t)received.foxBMS_maxBatteryVoltage);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_minBatteryVoltage, (int64_t)received.foxBMS_minBatteryVoltage);
+    }
+}
+
+void testRoundTripFoxbmsMinimumMaximumValues(void) {
+    CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_MINIMUM_MAXIMUM_VALUES_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_minimumCellVoltage = (uint16_t)TEST_GetRandomRaw(round, 13u, false);
+        sent.foxBMS_maximumCellVoltage = (uint16_t)TEST_GetRandomRaw(round, 13u, false);
+        sent.foxBMS_maximumCellTemp = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        sent.foxBMS_minimumCellTemp = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        sent.foxBMS_inletTemperature = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        sent.foxBMS_outletTemperature = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsMinimumMaximumValues(&sent, canData);
+
+        /* foxBMS_minimumCellVoltage: 10|13@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_minimumCellVoltage,
+            TEST_GetDbcSignal(canData, 10u, 13u, true, false));
+        /* foxBMS_maximumCellVoltage: 7|13@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_maximumCellVoltage,
+            TEST_GetDbcSignal(canData, 7u, 13u, true, false));
+        /* foxBMS_maximumCellTemp: 55|8@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_maximumCellTemp, TEST_GetDbcSignal(canData, 55u, 8u, true, true));
+        /* foxBMS_minimumCellTemp: 63|8@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_minimumCellTemp, TEST_GetDbcSignal(canData, 63u, 8u, true, true));
+        /* foxBMS_inletTemperature: 39|8@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_inletTemperature, TEST_GetDbcSignal(canData, 39u, 8u, true, true));
+        /* foxBMS_outletTemperature: 47|8@0- */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_outletTemperature,
+            TEST_GetDbcSignal(canData, 47u, 8u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x3F000000u);
+
+        CAN_UnpackFoxbmsMinimumMaximumValues(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_minimumCellVoltage, (int64_t)received.foxBMS_minimumCellVoltage);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_maximumCellVoltage, (int64_t)received.foxBMS_maximumCellVoltage);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_maximumCellTemp, (int64_t)received.foxBMS_maximumCellTemp);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_minimumCellTemp, (int64_t)received.foxBMS_minimumCellTemp);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_inletTemperature, (int64_t)received.foxBMS_inletTemperature);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_outletTemperature, (int64_t)received.foxBMS_outletTemperature);
+    }
+}
+
+void testRoundTripFoxbmsStringValues(void) {
+    CAN_FOXBMS_STRING_VALUES_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_STRING_VALUES_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_StringValues_Mux = (uint8_t)(round % CAN_FOXBMS_STRING_VALUES_NUMBER_OF_MUX_VALUES);
+        sent.foxBMS_String0_current = (int32_t)TEST_GetRandomRaw(round, 18u, true);
+        sent.foxBMS_String0_voltage = (uint32_t)TEST_GetRandomRaw(round, 17u, false);
+        sent.foxBMS_String0_power = (int32_t)TEST_GetRandomRaw(round, 18u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsStringValues(&sent, canData);
+
+        /* foxBMS_StringValues_Mux: 7|3@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_StringValues_Mux, TEST_GetDbcSignal(canData, 7u, 3u, true, false));
+        /* foxBMS_String0_current: 19|18@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_String0_current, TEST_GetDbcSignal(canData, 19u, 18u, true, true));
+        /* foxBMS_String0_voltage: 4|17@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_String0_voltage, TEST_GetDbcSignal(canData, 4u, 17u, true, false));
+        /* foxBMS_String0_power: 33|18@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_String0_power, TEST_GetDbcSignal(canData, 33u, 18u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFF00000000000000ull);
+
+        CAN_UnpackFoxbmsStringValues(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_StringValues_Mux, (int64_t)received.foxBMS_StringValues_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_String0_current, (int64_t)received.foxBMS_String0_current);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_String0_voltage, (int64_t)received.foxBMS_String0_voltage);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_String0_power, (int64_t)received.foxBMS_String0_power);
+    }
+}
+
+void testRoundTripFoxbmsStringValues2(void) {
+    CAN_FOXBMS_STRING_VALUES2_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_STRING_VALUES2_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_StringValues2_Mux = (uint8_t)(round % CAN_FOXBMS_STRING_VALUES2_NUMBER_OF_MUX_VALUES);
+        sent.String0_energyCount = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsStringValues2(&sent, canData);
+
+        /* foxBMS_StringValues2_Mux: 7|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_StringValues2_Mux,
+            TEST_GetDbcSignal(canData, 7u, 4u, true, false));
+        /* String0_energyCount: 15|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_energyCount, TEST_GetDbcSignal(canData, 15u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFFFF000000000Full);
+
+        CAN_UnpackFoxbmsStringValues2(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_StringValues2_Mux, (int64_t)received.foxBMS_StringValues2_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_energyCount, (int64_t)received.String0_energyCount);
+    }
+}
+
+void testRoundTripFoxbmsPackStateEstimation(void) {
+    CAN_FOXBMS_PACK_STATE_ESTIMATION_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_PACK_STATE_ESTIMATION_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_packSoc = (uint16_t)TEST_GetRandomRaw(round, 14u, false);
+        sent.foxBMS_packSoe = (uint16_t)TEST_GetRandomRaw(round, 14u, false);
+        sent.foxBMS_packEnergy = (uint32_t)TEST_GetRandomRaw(round, 24u, false);
+        sent.foxBMS_packSoh = (uint16_t)TEST_GetRandomRaw(round, 12u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsPackStateEstimation(&sent, canData);
+
+        /* foxBMS_packSoc: 7|14@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packSoc, TEST_GetDbcSignal(canData, 7u, 14u, true, false));
+        /* foxBMS_packSoe: 9|14@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packSoe, TEST_GetDbcSignal(canData, 9u, 14u, true, false));
+        /* foxBMS_packEnergy: 47|24@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packEnergy, TEST_GetDbcSignal(canData, 47u, 24u, true, false));
+        /* foxBMS_packSoh: 27|12@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packSoh, TEST_GetDbcSignal(canData, 27u, 12u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x0u);
+
+        CAN_UnpackFoxbmsPackStateEstimation(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packSoc, (int64_t)received.foxBMS_packSoc);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packSoe, (int64_t)received.foxBMS_packSoe);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packEnergy, (int64_t)received.foxBMS_packEnergy);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_packSoh, (int64_t)received.foxBMS_packSoh);
+    }
+}
+
+void testRoundTripFoxbmsCellVoltage(void) {
+    CAN_FOXBMS_CELL_VOLTAGE_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_CELL_VOLTAGE_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_CellVoltage_Mux = (uint8_t)(round % CAN_FOXBMS_CELL_VOLTAGE_NUMBER_OF_MUX_VALUES);
+        sent.cellVoltage_0_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellVoltage_1_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellVoltage_2_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellVoltage_3_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellVoltage_0 = (uint16_t)TEST_GetRandomRaw(round, 13u, false);
+        sent.cell_voltage_1 = (uint16_t)TEST_GetRandomRaw(round, 13u, false);
+        sent.cell_voltage_2 = (uint16_t)TEST_GetRandomRaw(round, 13u, false);
+        sent.cell_voltage_3 = (uint16_t)TEST_GetRandomRaw(round, 13u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsCellVoltage(&sent, canData);
+
+        /* foxBMS_CellVoltage_Mux: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_CellVoltage_Mux, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* cellVoltage_0_invalidFlag: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellVoltage_0_invalidFlag,
+            TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* cellVoltage_1_invalidFlag: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellVoltage_1_invalidFlag,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* cellVoltage_2_invalidFlag: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellVoltage_2_invalidFlag,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* cellVoltage_3_invalidFlag: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellVoltage_3_invalidFlag,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* cellVoltage_0: 11|13@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellVoltage_0, TEST_GetDbcSignal(canData, 11u, 13u, true, false));
+        /* cell_voltage_1: 30|13@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cell_voltage_1, TEST_GetDbcSignal(canData, 30u, 13u, true, false));
+        /* cell_voltage_2: 33|13@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cell_voltage_2, TEST_GetDbcSignal(canData, 33u, 13u, true, false));
+        /* cell_voltage_3: 52|13@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cell_voltage_3, TEST_GetDbcSignal(canData, 52u, 13u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x0u);
+
+        CAN_UnpackFoxbmsCellVoltage(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_CellVoltage_Mux, (int64_t)received.foxBMS_CellVoltage_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellVoltage_0_invalidFlag, (int64_t)received.cellVoltage_0_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellVoltage_1_invalidFlag, (int64_t)received.cellVoltage_1_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellVoltage_2_invalidFlag, (int64_t)received.cellVoltage_2_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellVoltage_3_invalidFlag, (int64_t)received.cellVoltage_3_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellVoltage_0, (int64_t)received.cellVoltage_0);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cell_voltage_1, (int64_t)received.cell_voltage_1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cell_voltage_2, (int64_t)received.cell_voltage_2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cell_voltage_3, (int64_t)received.cell_voltage_3);
+    }
+}
+
+void testRoundTripFoxbmsCellTemperature(void) {
+    CAN_FOXBMS_CELL_TEMPERATURE_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_CELL_TEMPERATURE_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_CellTemperature_Mux = (uint8_t)(round % CAN_FOXBMS_CELL_TEMPERATURE_NUMBER_OF_MUX_VALUES);
+        sent.cellTemperature_0_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellTemperature_1_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellTemperature_2_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellTemperature_3_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellTemperature_4_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellTemperature_5_invalidFlag = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.cellTemperature_0 = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        sent.cellTemperature_1 = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        sent.cellTemperature_2 = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        sent.cellTemperature_3 = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        sent.cellTemperature_4 = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        sent.cellTemperature_5 = (int8_t)TEST_GetRandomRaw(round, 8u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsCellTemperature(&sent, canData);
+
+        /* foxBMS_CellTemperature_Mux: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_CellTemperature_Mux,
+            TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* cellTemperature_0_invalidFlag: 8|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_0_invalidFlag,
+            TEST_GetDbcSignal(canData, 8u, 1u, true, false));
+        /* cellTemperature_1_invalidFlag: 9|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_1_invalidFlag,
+            TEST_GetDbcSignal(canData, 9u, 1u, true, false));
+        /* cellTemperature_2_invalidFlag: 10|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_2_invalidFlag,
+            TEST_GetDbcSignal(canData, 10u, 1u, true, false));
+        /* cellTemperature_3_invalidFlag: 11|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_3_invalidFlag,
+            TEST_GetDbcSignal(canData, 11u, 1u, true, false));
+        /* cellTemperature_4_invalidFlag: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_4_invalidFlag,
+            TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* cellTemperature_5_invalidFlag: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_5_invalidFlag,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* cellTemperature_0: 23|8@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_0, TEST_GetDbcSignal(canData, 23u, 8u, true, true));
+        /* cellTemperature_1: 31|8@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_1, TEST_GetDbcSignal(canData, 31u, 8u, true, true));
+        /* cellTemperature_2: 39|8@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_2, TEST_GetDbcSignal(canData, 39u, 8u, true, true));
+        /* cellTemperature_3: 47|8@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_3, TEST_GetDbcSignal(canData, 47u, 8u, true, true));
+        /* cellTemperature_4: 55|8@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_4, TEST_GetDbcSignal(canData, 55u, 8u, true, true));
+        /* cellTemperature_5: 63|8@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_5, TEST_GetDbcSignal(canData, 63u, 8u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xC000u);
+
+        CAN_UnpackFoxbmsCellTemperature(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_CellTemperature_Mux, (int64_t)received.foxBMS_CellTemperature_Mux);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_0_invalidFlag,
+            (int64_t)received.cellTemperature_0_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_1_invalidFlag,
+            (int64_t)received.cellTemperature_1_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_2_invalidFlag,
+            (int64_t)received.cellTemperature_2_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_3_invalidFlag,
+            (int64_t)received.cellTemperature_3_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_4_invalidFlag,
+            (int64_t)received.cellTemperature_4_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.cellTemperature_5_invalidFlag,
+            (int64_t)received.cellTemperature_5_invalidFlag);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_0, (int64_t)received.cellTemperature_0);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_1, (int64_t)received.cellTemperature_1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_2, (int64_t)received.cellTemperature_2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_3, (int64_t)received.cellTemperature_3);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_4, (int64_t)received.cellTemperature_4);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.cellTemperature_5, (int64_t)received.cellTemperature_5);
+    }
+}
+
+void testRoundTripFoxbmsCommand(void) {
+    CAN_FOXBMS_COMMAND_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_COMMAND_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_ModeRequest = (uint8_t)TEST_GetRandomRaw(round, 2u, false);
+        sent.foxBMS_activateBalancing = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_balancingThreshold = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.foxBMS_externallyPrecharged = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_resetFlags = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_chargerConnected = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_disableInsulationMon = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_heaterOverride_ON = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_heaterOverride_OFF = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsCommand(&sent, canData);
+
+        /* foxBMS_ModeRequest: 1|2@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_ModeRequest, TEST_GetDbcSignal(canData, 1u, 2u, true, false));
+        /* foxBMS_activateBalancing: 8|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_activateBalancing,
+            TEST_GetDbcSignal(canData, 8u, 1u, true, false));
+        /* foxBMS_balancingThreshold: 23|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_balancingThreshold,
+            TEST_GetDbcSignal(canData, 23u, 8u, true, false));
+        /* foxBMS_externallyPrecharged: 3|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_externallyPrecharged,
+            TEST_GetDbcSignal(canData, 3u, 1u, true, false));
+        /* foxBMS_resetFlags: 2|1@1+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_resetFlags, TEST_GetDbcSignal(canData, 2u, 1u, false, false));
+        /* foxBMS_chargerConnected: 4|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_chargerConnected,
+            TEST_GetDbcSignal(canData, 4u, 1u, false, false));
+        /* foxBMS_disableInsulationMon: 5|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_disableInsulationMon,
+            TEST_GetDbcSignal(canData, 5u, 1u, false, false));
+        /* foxBMS_heaterOverride_ON: 6|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_heaterOverride_ON,
+            TEST_GetDbcSignal(canData, 6u, 1u, false, false));
+        /* foxBMS_heaterOverride_OFF: 7|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_heaterOverride_OFF,
+            TEST_GetDbcSignal(canData, 7u, 1u, false, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFFFFFFFF00FE00ull);
+
+        CAN_UnpackFoxbmsCommand(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_ModeRequest, (int64_t)received.foxBMS_ModeRequest);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_activateBalancing, (int64_t)received.foxBMS_activateBalancing);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_balancingThreshold, (int64_t)received.foxBMS_balancingThreshold);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_externallyPrecharged,
+            (int64_t)received.foxBMS_externallyPrecharged);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_resetFlags, (int64_t)received.foxBMS_resetFlags);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_chargerConnected, (int64_t)received.foxBMS_chargerConnected);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_disableInsulationMon,
+            (int64_t)received.foxBMS_disableInsulationMon);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_heaterOverride_ON, (int64_t)received.foxBMS_heaterOverride_ON);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_heaterOverride_OFF, (int64_t)received.foxBMS_heaterOverride_OFF);
+    }
+}
+
+void testRoundTripFoxbmsState(void) {
+    CAN_FOXBMS_STATE_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_STATE_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_State = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.BMS_nrOfConnectedStrings = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.foxBMS_generalError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_generalWarning = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_Error_dieTemperatureMCU = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_Error_OvertempPCB = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_Error_UndertempPCB = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_Error_PrechargeVolt = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_Error_PrechargeCurrent = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_heaterState = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_coolingState = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_insulationMonitoring = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_chargingComplete = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_EmergencyShutoff = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_MainFuseBlown = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_insulationResistance = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.foxBMS_Error_Interlock = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.foxBMS_NrDeactivatedStrings = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsState(&sent, canData);
+
+        /* foxBMS_State: 3|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_State, TEST_GetDbcSignal(canData, 3u, 4u, true, false));
+        /* BMS_nrOfConnectedStrings: 7|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.BMS_nrOfConnectedStrings,
+            TEST_GetDbcSignal(canData, 7u, 4u, true, false));
+        /* foxBMS_generalError: 10|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_generalError, TEST_GetDbcSignal(canData, 10u, 1u, true, false));
+        /* foxBMS_generalWarning: 9|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_generalWarning, TEST_GetDbcSignal(canData, 9u, 1u, true, false));
+        /* foxBMS_Error_dieTemperatureMCU: 18|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_Error_dieTemperatureMCU,
+            TEST_GetDbcSignal(canData, 18u, 1u, true, false));
+        /* foxBMS_Error_OvertempPCB: 19|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_Error_OvertempPCB,
+            TEST_GetDbcSignal(canData, 19u, 1u, true, false));
+        /* foxBMS_Error_UndertempPCB: 20|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_Error_UndertempPCB,
+            TEST_GetDbcSignal(canData, 20u, 1u, true, false));
+        /* foxBMS_Error_PrechargeVolt: 16|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_Error_PrechargeVolt,
+            TEST_GetDbcSignal(canData, 16u, 1u, true, false));
+        /* foxBMS_Error_PrechargeCurrent: 17|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_Error_PrechargeCurrent,
+            TEST_GetDbcSignal(canData, 17u, 1u, true, false));
+        /* foxBMS_heaterState: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_heaterState, TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* foxBMS_coolingState: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_coolingState, TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* foxBMS_insulationMonitoring: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_insulationMonitoring,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* foxBMS_chargingComplete: 8|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_chargingComplete, TEST_GetDbcSignal(canData, 8u, 1u, true, false));
+        /* foxBMS_EmergencyShutoff: 11|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_EmergencyShutoff,
+            TEST_GetDbcSignal(canData, 11u, 1u, false, false));
+        /* foxBMS_MainFuseBlown: 21|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_MainFuseBlown, TEST_GetDbcSignal(canData, 21u, 1u, true, false));
+        /* foxBMS_insulationResistance: 63|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_insulationResistance,
+            TEST_GetDbcSignal(canData, 63u, 8u, true, false));
+        /* foxBMS_Error_Interlock: 22|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_Error_Interlock,
+            TEST_GetDbcSignal(canData, 22u, 1u, false, false));
+        /* foxBMS_NrDeactivatedStrings: 51|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_NrDeactivatedStrings,
+            TEST_GetDbcSignal(canData, 51u, 4u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xF0FFFFFF801000ull);
+
+        CAN_UnpackFoxbmsState(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_State, (int64_t)received.foxBMS_State);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.BMS_nrOfConnectedStrings, (int64_t)received.BMS_nrOfConnectedStrings);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_generalError, (int64_t)received.foxBMS_generalError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_generalWarning, (int64_t)received.foxBMS_generalWarning);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_Error_dieTemperatureMCU,
+            (int64_t)received.foxBMS_Error_dieTemperatureMCU);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_Error_OvertempPCB, (int64_t)received.foxBMS_Error_OvertempPCB);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_Error_UndertempPCB, (int64_t)received.foxBMS_Error_UndertempPCB);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_Error_PrechargeVolt, (int64_t)received.foxBMS_Error_PrechargeVolt);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_Error_PrechargeCurrent,
+            (int64_t)received.foxBMS_Error_PrechargeCurrent);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_heaterState, (int64_t)received.foxBMS_heaterState);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_coolingState, (int64_t)received.foxBMS_coolingState);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_insulationMonitoring,
+            (int64_t)received.foxBMS_insulationMonitoring);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_chargingComplete, (int64_t)received.foxBMS_chargingComplete);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_EmergencyShutoff, (int64_t)received.foxBMS_EmergencyShutoff);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_MainFuseBlown, (int64_t)received.foxBMS_MainFuseBlown);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_insulationResistance,
+            (int64_t)received.foxBMS_insulationResistance);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_Error_Interlock, (int64_t)received.foxBMS_Error_Interlock);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_NrDeactivatedStrings,
+            (int64_t)received.foxBMS_NrDeactivatedStrings);
+    }
+}
+
+void testRoundTripFoxbmsStringState(void) {
+    CAN_FOXBMS_STRING_STATE_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_STRING_STATE_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_StringState_Mux = (uint8_t)(round % CAN_FOXBMS_STRING_STATE_NUMBER_OF_MUX_VALUES);
+        sent.String0_stringConnected = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_balancing_active = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_overtemp_charge = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_undertemp_charge = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_overtemp_discharge = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_undertemp_discharge = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_Overcurrent_charge = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_Overcurre_discharge = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_Overvoltage = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_Undervoltage = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_deep_discharge = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_CS_currentMeas = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_positiveContactor = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_openWire = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_openWireNumber = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.String0_Err_plaus_cell_volt = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_plaus_cell_temp = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_plaus_string_volt = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_slave_hardware = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_dsyChainPrim_Comm = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_dsyChainPrim_CRC = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_dsyChainRedun_Comm = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_dsyChainRedun_CRC = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_dsyPrim_voltMeasOor = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_dsyRedun_voltMeasOor = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_dsyPrim_tempMeasOor = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_dsyRedun_tempMeasOor = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_CS_coulombCountMeas = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_CS_energyCountMeas = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_plaus_volt_spread = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_plaus_temp_spread = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_fuseBlown = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Warning_overvoltage_MOL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Warning_undervoltage_MOL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_chargeOverTemp_MOL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_dischrgOverTemp_MOL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_chargeUnderTemp_MOL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_dischrgUnderTmp_MOL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_chargeOverCur_MOL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_dischargOverCur_MOL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_chargeOverTemp_RSL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_chargeUnderTemp_RSL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_dischrgOverTemp_RSL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_dischrgUnderTmp_RSL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_chargeOverCur_RSL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_dischargOverCur_RSL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_overvoltage_RSL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Wrng_undervoltage_RSL = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_negativeContactor = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_CS_voltage1Meas = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_CS_voltage2Meas = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.String0_Err_CS_voltage3Meas = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsStringState(&sent, canData);
+
+        /* foxBMS_StringState_Mux: 3|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_StringState_Mux, TEST_GetDbcSignal(canData, 3u, 4u, true, false));
+        /* String0_stringConnected: 4|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_stringConnected, TEST_GetDbcSignal(canData, 4u, 1u, true, false));
+        /* String0_balancing_active: 5|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_balancing_active,
+            TEST_GetDbcSignal(canData, 5u, 1u, true, false));
+        /* String0_Err_overtemp_charge: 8|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_overtemp_charge,
+            TEST_GetDbcSignal(canData, 8u, 1u, true, false));
+        /* String0_Err_undertemp_charge: 9|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_undertemp_charge,
+            TEST_GetDbcSignal(canData, 9u, 1u, true, false));
+        /* String0_Err_overtemp_discharge: 10|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_overtemp_discharge,
+            TEST_GetDbcSignal(canData, 10u, 1u, true, false));
+        /* String0_Err_undertemp_discharge: 11|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_undertemp_discharge,
+            TEST_GetDbcSignal(canData, 11u, 1u, true, false));
+        /* String0_Err_Overcurrent_charge: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_Overcurrent_charge,
+            TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* String0_Err_Overcurre_discharge: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_Overcurre_discharge,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* String0_Err_Overvoltage: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_Overvoltage,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* String0_Err_Undervoltage: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_Undervoltage,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* String0_Err_deep_discharge: 7|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_deep_discharge,
+            TEST_GetDbcSignal(canData, 7u, 1u, true, false));
+        /* String0_Err_CS_currentMeas: 43|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_currentMeas,
+            TEST_GetDbcSignal(canData, 43u, 1u, true, false));
+        /* String0_Err_positiveContactor: 32|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_positiveContactor,
+            TEST_GetDbcSignal(canData, 32u, 1u, true, false));
+        /* String0_Err_openWire: 49|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_Err_openWire, TEST_GetDbcSignal(canData, 49u, 1u, true, false));
+        /* String0_openWireNumber: 63|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_openWireNumber, TEST_GetDbcSignal(canData, 63u, 8u, true, false));
+        /* String0_Err_plaus_cell_volt: 52|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_cell_volt,
+            TEST_GetDbcSignal(canData, 52u, 1u, true, false));
+        /* String0_Err_plaus_cell_temp: 51|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_cell_temp,
+            TEST_GetDbcSignal(canData, 51u, 1u, true, false));
+        /* String0_Err_plaus_string_volt: 53|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_string_volt,
+            TEST_GetDbcSignal(canData, 53u, 1u, true, false));
+        /* String0_Err_slave_hardware: 34|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_slave_hardware,
+            TEST_GetDbcSignal(canData, 34u, 1u, true, false));
+        /* String0_Err_dsyChainPrim_Comm: 35|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyChainPrim_Comm,
+            TEST_GetDbcSignal(canData, 35u, 1u, true, false));
+        /* String0_Err_dsyChainPrim_CRC: 37|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyChainPrim_CRC,
+            TEST_GetDbcSignal(canData, 37u, 1u, true, false));
+        /* String0_Err_dsyChainRedun_Comm: 36|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyChainRedun_Comm,
+            TEST_GetDbcSignal(canData, 36u, 1u, true, false));
+        /* String0_Err_dsyChainRedun_CRC: 38|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyChainRedun_CRC,
+            TEST_GetDbcSignal(canData, 38u, 1u, true, false));
+        /* String0_Err_dsyPrim_voltMeasOor: 39|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyPrim_voltMeasOor,
+            TEST_GetDbcSignal(canData, 39u, 1u, true, false));
+        /* String0_Err_dsyRedun_voltMeasOor: 40|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyRedun_voltMeasOor,
+            TEST_GetDbcSignal(canData, 40u, 1u, true, false));
+        /* String0_Err_dsyPrim_tempMeasOor: 41|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyPrim_tempMeasOor,
+            TEST_GetDbcSignal(canData, 41u, 1u, true, false));
+        /* String0_Err_dsyRedun_tempMeasOor: 42|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyRedun_tempMeasOor,
+            TEST_GetDbcSignal(canData, 42u, 1u, true, false));
+        /* String0_Err_CS_coulombCountMeas: 44|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_coulombCountMeas,
+            TEST_GetDbcSignal(canData, 44u, 1u, true, false));
+        /* String0_Err_CS_energyCountMeas: 45|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_energyCountMeas,
+            TEST_GetDbcSignal(canData, 45u, 1u, true, false));
+        /* String0_Err_plaus_volt_spread: 55|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_volt_spread,
+            TEST_GetDbcSignal(canData, 55u, 1u, true, false));
+        /* String0_Err_plaus_temp_spread: 54|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_temp_spread,
+            TEST_GetDbcSignal(canData, 54u, 1u, true, false));
+        /* String0_fuseBlown: 6|1@1+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_fuseBlown, TEST_GetDbcSignal(canData, 6u, 1u, false, false));
+        /* String0_Warning_overvoltage_MOL: 22|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Warning_overvoltage_MOL,
+            TEST_GetDbcSignal(canData, 22u, 1u, false, false));
+        /* String0_Warning_undervoltage_MOL: 23|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Warning_undervoltage_MOL,
+            TEST_GetDbcSignal(canData, 23u, 1u, false, false));
+        /* String0_Wrng_chargeOverTemp_MOL: 16|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeOverTemp_MOL,
+            TEST_GetDbcSignal(canData, 16u, 1u, false, false));
+        /* String0_Wrng_dischrgOverTemp_MOL: 18|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischrgOverTemp_MOL,
+            TEST_GetDbcSignal(canData, 18u, 1u, false, false));
+        /* String0_Wrng_chargeUnderTemp_MOL: 17|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeUnderTemp_MOL,
+            TEST_GetDbcSignal(canData, 17u, 1u, false, false));
+        /* String0_Wrng_dischrgUnderTmp_MOL: 19|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischrgUnderTmp_MOL,
+            TEST_GetDbcSignal(canData, 19u, 1u, false, false));
+        /* String0_Wrng_chargeOverCur_MOL: 20|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeOverCur_MOL,
+            TEST_GetDbcSignal(canData, 20u, 1u, false, false));
+        /* String0_Wrng_dischargOverCur_MOL: 21|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischargOverCur_MOL,
+            TEST_GetDbcSignal(canData, 21u, 1u, false, false));
+        /* String0_Wrng_chargeOverTemp_RSL: 24|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeOverTemp_RSL,
+            TEST_GetDbcSignal(canData, 24u, 1u, false, false));
+        /* String0_Wrng_chargeUnderTemp_RSL: 25|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeUnderTemp_RSL,
+            TEST_GetDbcSignal(canData, 25u, 1u, false, false));
+        /* String0_Wrng_dischrgOverTemp_RSL: 26|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischrgOverTemp_RSL,
+            TEST_GetDbcSignal(canData, 26u, 1u, false, false));
+        /* String0_Wrng_dischrgUnderTmp_RSL: 27|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischrgUnderTmp_RSL,
+            TEST_GetDbcSignal(canData, 27u, 1u, false, false));
+        /* String0_Wrng_chargeOverCur_RSL: 28|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeOverCur_RSL,
+            TEST_GetDbcSignal(canData, 28u, 1u, false, false));
+        /* String0_Wrng_dischargOverCur_RSL: 29|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischargOverCur_RSL,
+            TEST_GetDbcSignal(canData, 29u, 1u, false, false));
+        /* String0_Wrng_overvoltage_RSL: 30|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_overvoltage_RSL,
+            TEST_GetDbcSignal(canData, 30u, 1u, false, false));
+        /* String0_Wrng_undervoltage_RSL: 31|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_undervoltage_RSL,
+            TEST_GetDbcSignal(canData, 31u, 1u, false, false));
+        /* String0_Err_negativeContactor: 33|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_negativeContactor,
+            TEST_GetDbcSignal(canData, 33u, 1u, false, false));
+        /* String0_Err_CS_voltage1Meas: 46|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_voltage1Meas,
+            TEST_GetDbcSignal(canData, 46u, 1u, false, false));
+        /* String0_Err_CS_voltage2Meas: 47|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_voltage2Meas,
+            TEST_GetDbcSignal(canData, 47u, 1u, false, false));
+        /* String0_Err_CS_voltage3Meas: 48|1@1+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_voltage3Meas,
+            TEST_GetDbcSignal(canData, 48u, 1u, false, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x4000000000000ull);
+
+        CAN_UnpackFoxbmsStringState(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_StringState_Mux, (int64_t)received.foxBMS_StringState_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_stringConnected, (int64_t)received.String0_stringConnected);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_balancing_active, (int64_t)received.String0_balancing_active);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_overtemp_charge,
+            (int64_t)received.String0_Err_overtemp_charge);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_undertemp_charge,
+            (int64_t)received.String0_Err_undertemp_charge);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_overtemp_discharge,
+            (int64_t)received.String0_Err_overtemp_discharge);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_undertemp_discharge,
+            (int64_t)received.String0_Err_undertemp_discharge);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_Overcurrent_charge,
+            (int64_t)received.String0_Err_Overcurrent_charge);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_Overcurre_discharge,
+            (int64_t)received.String0_Err_Overcurre_discharge);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_Err_Overvoltage, (int64_t)received.String0_Err_Overvoltage);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_Err_Undervoltage, (int64_t)received.String0_Err_Undervoltage);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_Err_deep_discharge, (int64_t)received.String0_Err_deep_discharge);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_Err_CS_currentMeas, (int64_t)received.String0_Err_CS_currentMeas);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_positiveContactor,
+            (int64_t)received.String0_Err_positiveContactor);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_Err_openWire, (int64_t)received.String0_Err_openWire);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_openWireNumber, (int64_t)received.String0_openWireNumber);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_cell_volt,
+            (int64_t)received.String0_Err_plaus_cell_volt);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_cell_temp,
+            (int64_t)received.String0_Err_plaus_cell_temp);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_string_volt,
+            (int64_t)received.String0_Err_plaus_string_volt);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_Err_slave_hardware, (int64_t)received.String0_Err_slave_hardware);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyChainPrim_Comm,
+            (int64_t)received.String0_Err_dsyChainPrim_Comm);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyChainPrim_CRC,
+            (int64_t)received.String0_Err_dsyChainPrim_CRC);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyChainRedun_Comm,
+            (int64_t)received.String0_Err_dsyChainRedun_Comm);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyChainRedun_CRC,
+            (int64_t)received.String0_Err_dsyChainRedun_CRC);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyPrim_voltMeasOor,
+            (int64_t)received.String0_Err_dsyPrim_voltMeasOor);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyRedun_voltMeasOor,
+            (int64_t)received.String0_Err_dsyRedun_voltMeasOor);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyPrim_tempMeasOor,
+            (int64_t)received.String0_Err_dsyPrim_tempMeasOor);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_dsyRedun_tempMeasOor,
+            (int64_t)received.String0_Err_dsyRedun_tempMeasOor);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_coulombCountMeas,
+            (int64_t)received.String0_Err_CS_coulombCountMeas);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_energyCountMeas,
+            (int64_t)received.String0_Err_CS_energyCountMeas);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_volt_spread,
+            (int64_t)received.String0_Err_plaus_volt_spread);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_plaus_temp_spread,
+            (int64_t)received.String0_Err_plaus_temp_spread);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_fuseBlown, (int64_t)received.String0_fuseBlown);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Warning_overvoltage_MOL,
+            (int64_t)received.String0_Warning_overvoltage_MOL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Warning_undervoltage_MOL,
+            (int64_t)received.String0_Warning_undervoltage_MOL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeOverTemp_MOL,
+            (int64_t)received.String0_Wrng_chargeOverTemp_MOL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischrgOverTemp_MOL,
+            (int64_t)received.String0_Wrng_dischrgOverTemp_MOL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeUnderTemp_MOL,
+            (int64_t)received.String0_Wrng_chargeUnderTemp_MOL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischrgUnderTmp_MOL,
+            (int64_t)received.String0_Wrng_dischrgUnderTmp_MOL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeOverCur_MOL,
+            (int64_t)received.String0_Wrng_chargeOverCur_MOL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischargOverCur_MOL,
+            (int64_t)received.String0_Wrng_dischargOverCur_MOL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeOverTemp_RSL,
+            (int64_t)received.String0_Wrng_chargeOverTemp_RSL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeUnderTemp_RSL,
+            (int64_t)received.String0_Wrng_chargeUnderTemp_RSL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischrgOverTemp_RSL,
+            (int64_t)received.String0_Wrng_dischrgOverTemp_RSL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischrgUnderTmp_RSL,
+            (int64_t)received.String0_Wrng_dischrgUnderTmp_RSL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_chargeOverCur_RSL,
+            (int64_t)received.String0_Wrng_chargeOverCur_RSL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_dischargOverCur_RSL,
+            (int64_t)received.String0_Wrng_dischargOverCur_RSL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_overvoltage_RSL,
+            (int64_t)received.String0_Wrng_overvoltage_RSL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Wrng_undervoltage_RSL,
+            (int64_t)received.String0_Wrng_undervoltage_RSL);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_negativeContactor,
+            (int64_t)received.String0_Err_negativeContactor);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_voltage1Meas,
+            (int64_t)received.String0_Err_CS_voltage1Meas);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_voltage2Meas,
+            (int64_t)received.String0_Err_CS_voltage2Meas);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_Err_CS_voltage3Meas,
+            (int64_t)received.String0_Err_CS_voltage3Meas);
+    }
+}
+
+void testRoundTripFoxbmsStringMinimumMaximumValues(void) {
+    CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_StringMinimumMaximumValues_Mux =
+            (uint8_t)(round % CAN_FOXBMS_STRING_MINIMUM_MAXIMUM_VALUES_NUMBER_OF_MUX_VALUES);
+        sent.String0_minimumCellVoltage = (uint16_t)TEST_GetRandomRaw(round, 13u, false);
+        sent.String0_maximumCellVoltage = (uint16_t)TEST_GetRandomRaw(round, 13u, false);
+        sent.String0_maximumCellTemperature = (int16_t)TEST_GetRandomRaw(round, 9u, true);
+        sent.String0_minimumCellTemperature = (int16_t)TEST_GetRandomRaw(round, 9u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsStringMinimumMaximumValues(&sent, canData);
+
+        /* foxBMS_StringMinimumMaximumValues_Mux: 3|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_StringMinimumMaximumValues_Mux,
+            TEST_GetDbcSignal(canData, 3u, 4u, true, false));
+        /* String0_minimumCellVoltage: 18|13@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_minimumCellVoltage,
+            TEST_GetDbcSignal(canData, 18u, 13u, true, false));
+        /* String0_maximumCellVoltage: 15|13@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_maximumCellVoltage,
+            TEST_GetDbcSignal(canData, 15u, 13u, true, false));
+        /* String0_maximumCellTemperature: 37|9@0- */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_maximumCellTemperature,
+            TEST_GetDbcSignal(canData, 37u, 9u, true, true));
+        /* String0_minimumCellTemperature: 44|9@0- */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_minimumCellTemperature,
+            TEST_GetDbcSignal(canData, 44u, 9u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFF0F0000000000F0ull);
+
+        CAN_UnpackFoxbmsStringMinimumMaximumValues(canData, &received);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_StringMinimumMaximumValues_Mux,
+            (int64_t)received.foxBMS_StringMinimumMaximumValues_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_minimumCellVoltage, (int64_t)received.String0_minimumCellVoltage);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_maximumCellVoltage, (int64_t)received.String0_maximumCellVoltage);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_maximumCellTemperature,
+            (int64_t)received.String0_maximumCellTemperature);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.String0_minimumCellTemperature,
+            (int64_t)received.String0_minimumCellTemperature);
+    }
+}
+
+void testRoundTripFoxbmsStringStateEstimation(void) {
+    CAN_FOXBMS_STRING_STATE_ESTIMATION_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_STRING_STATE_ESTIMATION_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_StringStateEstimation_Mux =
+            (uint8_t)(round % CAN_FOXBMS_STRING_STATE_ESTIMATION_NUMBER_OF_MUX_VALUES);
+        sent.String0_minimumSOC = (uint16_t)TEST_GetRandomRaw(round, 9u, false);
+        sent.String0_averageSOC = (uint16_t)TEST_GetRandomRaw(round, 9u, false);
+        sent.String0_maximumSOC = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.String0_SOE = (uint16_t)TEST_GetRandomRaw(round, 9u, false);
+        sent.String0_Energy_Wh = (uint16_t)TEST_GetRandomRaw(round, 16u, false);
+        sent.String0_SOH = (uint16_t)TEST_GetRandomRaw(round, 9u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsStringStateEstimation(&sent, canData);
+
+        /* foxBMS_StringStateEstimation_Mux: 7|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_StringStateEstimation_Mux,
+            TEST_GetDbcSignal(canData, 7u, 4u, true, false));
+        /* String0_minimumSOC: 3|9@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_minimumSOC, TEST_GetDbcSignal(canData, 3u, 9u, true, false));
+        /* String0_averageSOC: 10|9@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_averageSOC, TEST_GetDbcSignal(canData, 10u, 9u, true, false));
+        /* String0_maximumSOC: 17|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_maximumSOC, TEST_GetDbcSignal(canData, 17u, 8u, true, false));
+        /* String0_SOE: 25|9@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_SOE, TEST_GetDbcSignal(canData, 25u, 9u, true, false));
+        /* String0_Energy_Wh: 55|16@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_Energy_Wh, TEST_GetDbcSignal(canData, 55u, 16u, true, false));
+        /* String0_SOH: 32|9@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_SOH, TEST_GetDbcSignal(canData, 32u, 9u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x0u);
+
+        CAN_UnpackFoxbmsStringStateEstimation(canData, &received);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_StringStateEstimation_Mux,
+            (int64_t)received.foxBMS_StringStateEstimation_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_minimumSOC, (int64_t)received.String0_minimumSOC);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_averageSOC, (int64_t)received.String0_averageSOC);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_maximumSOC, (int64_t)received.String0_maximumSOC);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_SOE, (int64_t)received.String0_SOE);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_Energy_Wh, (int64_t)received.String0_Energy_Wh);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.String0_SOH, (int64_t)received.String0_SOH);
+    }
+}
+
+void testRoundTripFoxbmsAlgorithmStatistics(void) {
+    CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_AlgorithmStatistics_Mux = (uint8_t)(round % CAN_FOXBMS_ALGORITHM_STATISTICS_NUMBER_OF_MUX_VALUES);
+        sent.Algorithm0_averageTime = (uint16_t)TEST_GetRandomRaw(round, 16u, false);
+        sent.Algorithm0_worstTime = (uint16_t)TEST_GetRandomRaw(round, 16u, false);
+        sent.Algorithm0_overruns = (uint16_t)TEST_GetRandomRaw(round, 16u, false);
+        sent.Algorithm0_state = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsAlgorithmStatistics(&sent, canData);
+
+        /* foxBMS_AlgorithmStatistics_Mux: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_AlgorithmStatistics_Mux,
+            TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* Algorithm0_averageTime: 15|16@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.Algorithm0_averageTime,
+            TEST_GetDbcSignal(canData, 15u, 16u, true, false));
+        /* Algorithm0_worstTime: 31|16@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Algorithm0_worstTime, TEST_GetDbcSignal(canData, 31u, 16u, true, false));
+        /* Algorithm0_overruns: 47|16@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Algorithm0_overruns, TEST_GetDbcSignal(canData, 47u, 16u, true, false));
+        /* Algorithm0_state: 63|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Algorithm0_state, TEST_GetDbcSignal(canData, 63u, 4u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xF00000000000000ull);
+
+        CAN_UnpackFoxbmsAlgorithmStatistics(canData, &received);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_AlgorithmStatistics_Mux,
+            (int64_t)received.foxBMS_AlgorithmStatistics_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Algorithm0_averageTime, (int64_t)received.Algorithm0_averageTime);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Algorithm0_worstTime, (int64_t)received.Algorithm0_worstTime);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Algorithm0_overruns, (int64_t)received.Algorithm0_overruns);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Algorithm0_state, (int64_t)received.Algorithm0_state);
+    }
+}
+
+void testRoundTripFoxbmsProfilingTimes(void) {
+    CAN_FOXBMS_PROFILING_TIMES_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_PROFILING_TIMES_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_ProfilingTimes_Mux = (uint8_t)(round % CAN_FOXBMS_PROFILING_TIMES_NUMBER_OF_MUX_VALUES);
+        sent.Profile0_minimumTime = (uint16_t)TEST_GetRandomRaw(round, 16u, false);
+        sent.Profile0_maximumTime = (uint16_t)TEST_GetRandomRaw(round, 16u, false);
+        sent.Profile0_meanTime = (uint16_t)TEST_GetRandomRaw(round, 16u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsProfilingTimes(&sent, canData);
+
+        /* foxBMS_ProfilingTimes_Mux: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_ProfilingTimes_Mux,
+            TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* Profile0_minimumTime: 15|16@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_minimumTime, TEST_GetDbcSignal(canData, 15u, 16u, true, false));
+        /* Profile0_maximumTime: 31|16@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_maximumTime, TEST_GetDbcSignal(canData, 31u, 16u, true, false));
+        /* Profile0_meanTime: 47|16@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_meanTime, TEST_GetDbcSignal(canData, 47u, 16u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFF00000000000000ull);
+
+        CAN_UnpackFoxbmsProfilingTimes(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_ProfilingTimes_Mux, (int64_t)received.foxBMS_ProfilingTimes_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_minimumTime, (int64_t)received.Profile0_minimumTime);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_maximumTime, (int64_t)received.Profile0_maximumTime);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_meanTime, (int64_t)received.Profile0_meanTime);
+    }
+}
+
+void testRoundTripFoxbmsProfilingHistogram(void) {
+    CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_ProfilingHistogram_Mux = (uint8_t)(round % CAN_FOXBMS_PROFILING_HISTOGRAM_NUMBER_OF_MUX_VALUES);
+        sent.Profile0_bucket0 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.Profile0_bucket1 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.Profile0_bucket2 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.Profile0_bucket3 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.Profile0_bucket4 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.Profile0_bucket5 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.Profile0_bucket6 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsProfilingHistogram(&sent, canData);
+
+        /* foxBMS_ProfilingHistogram_Mux: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_ProfilingHistogram_Mux,
+            TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* Profile0_bucket0: 15|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket0, TEST_GetDbcSignal(canData, 15u, 8u, true, false));
+        /* Profile0_bucket1: 23|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket1, TEST_GetDbcSignal(canData, 23u, 8u, true, false));
+        /* Profile0_bucket2: 31|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket2, TEST_GetDbcSignal(canData, 31u, 8u, true, false));
+        /* Profile0_bucket3: 39|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket3, TEST_GetDbcSignal(canData, 39u, 8u, true, false));
+        /* Profile0_bucket4: 47|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket4, TEST_GetDbcSignal(canData, 47u, 8u, true, false));
+        /* Profile0_bucket5: 55|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket5, TEST_GetDbcSignal(canData, 55u, 8u, true, false));
+        /* Profile0_bucket6: 63|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket6, TEST_GetDbcSignal(canData, 63u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x0u);
+
+        CAN_UnpackFoxbmsProfilingHistogram(canData, &received);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_ProfilingHistogram_Mux,
+            (int64_t)received.foxBMS_ProfilingHistogram_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket0, (int64_t)received.Profile0_bucket0);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket1, (int64_t)received.Profile0_bucket1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket2, (int64_t)received.Profile0_bucket2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket3, (int64_t)received.Profile0_bucket3);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket4, (int64_t)received.Profile0_bucket4);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket5, (int64_t)received.Profile0_bucket5);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Profile0_bucket6, (int64_t)received.Profile0_bucket6);
+    }
+}
+
+void testRoundTripFoxbmsTimingViolation(void) {
+    CAN_FOXBMS_TIMING_VIOLATION_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_TIMING_VIOLATION_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_TimingViolation_Mux = (uint8_t)(round % CAN_FOXBMS_TIMING_VIOLATION_NUMBER_OF_MUX_VALUES);
+        sent.Violation0_taskId = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.Violation0_timestamp = (uint32_t)TEST_GetRandomRaw(round, 32u, false);
+        sent.Violation0_jitter = (uint16_t)TEST_GetRandomRaw(round, 16u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsTimingViolation(&sent, canData);
+
+        /* foxBMS_TimingViolation_Mux: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_TimingViolation_Mux,
+            TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* Violation0_taskId: 15|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_taskId, TEST_GetDbcSignal(canData, 15u, 8u, true, false));
+        /* Violation0_timestamp: 23|32@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_timestamp, TEST_GetDbcSignal(canData, 23u, 32u, true, false));
+        /* Violation0_jitter: 55|16@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_jitter, TEST_GetDbcSignal(canData, 55u, 16u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x0u);
+
+        CAN_UnpackFoxbmsTimingViolation(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.foxBMS_TimingViolation_Mux, (int64_t)received.foxBMS_TimingViolation_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_taskId, (int64_t)received.Violation0_taskId);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_timestamp, (int64_t)received.Violation0_timestamp);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_jitter, (int64_t)received.Violation0_jitter);
+    }
+}
+
+void testRoundTripFoxbmsTimingViolationDurations(void) {
+    CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS_s sent     = {0};
+    CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.foxBMS_TimingViolationDurations_Mux =
+            (uint8_t)(round % CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_NUMBER_OF_MUX_VALUES);
+        sent.Violation0_durationTask0 = (uint16_t)TEST_GetRandomRaw(round, 10u, false);
+        sent.Violation0_durationTask1 = (uint16_t)TEST_GetRandomRaw(round, 10u, false);
+        sent.Violation0_durationTask2 = (uint16_t)TEST_GetRandomRaw(round, 10u, false);
+        sent.Violation0_durationTask3 = (uint16_t)TEST_GetRandomRaw(round, 10u, false);
+        sent.Violation0_durationTask4 = (uint16_t)TEST_GetRandomRaw(round, 10u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackFoxbmsTimingViolationDurations(&sent, canData);
+
+        /* foxBMS_TimingViolationDurations_Mux: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_TimingViolationDurations_Mux,
+            TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* Violation0_durationTask0: 15|10@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.Violation0_durationTask0,
+            TEST_GetDbcSignal(canData, 15u, 10u, true, false));
+        /* Violation0_durationTask1: 21|10@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.Violation0_durationTask1,
+            TEST_GetDbcSignal(canData, 21u, 10u, true, false));
+        /* Violation0_durationTask2: 27|10@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.Violation0_durationTask2,
+            TEST_GetDbcSignal(canData, 27u, 10u, true, false));
+        /* Violation0_durationTask3: 33|10@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.Violation0_durationTask3,
+            TEST_GetDbcSignal(canData, 33u, 10u, true, false));
+        /* Violation0_durationTask4: 55|10@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.Violation0_durationTask4,
+            TEST_GetDbcSignal(canData, 55u, 10u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0x3F00000000000000ull);
+
+        CAN_UnpackFoxbmsTimingViolationDurations(canData, &received);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.foxBMS_TimingViolationDurations_Mux,
+            (int64_t)received.foxBMS_TimingViolationDurations_Mux);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_durationTask0, (int64_t)received.Violation0_durationTask0);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_durationTask1, (int64_t)received.Violation0_durationTask1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_durationTask2, (int64_t)received.Violation0_durationTask2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_durationTask3, (int64_t)received.Violation0_durationTask3);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.Violation0_durationTask4, (int64_t)received.Violation0_durationTask4);
+    }
+}
+
+void testRoundTripIvt0MsgResultI(void) {
+    CAN_IVT0_MSG_RESULT_I_SIGNALS_s sent     = {0};
+    CAN_IVT0_MSG_RESULT_I_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT0_Result_I_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_I_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_I_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_I_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_ID_Result_I = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT0_MsgCount_Result_I = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT0_Result_I_mA = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt0MsgResultI(&sent, canData);
+
+        /* IVT0_Result_I_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_I_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT0_Result_I_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_I_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT0_Result_I_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_I_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT0_Result_I_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_I_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT0_ID_Result_I: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_I, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT0_MsgCount_Result_I: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_I, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT0_Result_I_mA: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_I_mA, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt0MsgResultI(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_I_systemError, (int64_t)received.IVT0_Result_I_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_I_OCS, (int64_t)received.IVT0_Result_I_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_I_overallMeasError,
+            (int64_t)received.IVT0_Result_I_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_I_channelMeasError,
+            (int64_t)received.IVT0_Result_I_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_I, (int64_t)received.IVT0_ID_Result_I);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_I, (int64_t)received.IVT0_MsgCount_Result_I);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_I_mA, (int64_t)received.IVT0_Result_I_mA);
+    }
+}
+
+void testRoundTripIvt0MsgResultU1(void) {
+    CAN_IVT0_MSG_RESULT_U1_SIGNALS_s sent     = {0};
+    CAN_IVT0_MSG_RESULT_U1_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT0_Result_U1_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_U1_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_U1_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_U1_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_ID_Result_U1 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT0_MsgCount_Result_U1 = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT0_Result_U1_mV = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt0MsgResultU1(&sent, canData);
+
+        /* IVT0_Result_U1_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U1_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT0_Result_U1_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U1_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT0_Result_U1_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U1_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT0_Result_U1_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U1_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT0_ID_Result_U1: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_U1, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT0_MsgCount_Result_U1: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_MsgCount_Result_U1,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT0_Result_U1_mV: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U1_mV, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt0MsgResultU1(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U1_systemError, (int64_t)received.IVT0_Result_U1_systemError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U1_overallMeasError,
+            (int64_t)received.IVT0_Result_U1_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U1_channelMeasError,
+            (int64_t)received.IVT0_Result_U1_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U1_OCS, (int64_t)received.IVT0_Result_U1_OCS);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_U1, (int64_t)received.IVT0_ID_Result_U1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_U1, (int64_t)received.IVT0_MsgCount_Result_U1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U1_mV, (int64_t)received.IVT0_Result_U1_mV);
+    }
+}
+
+void testRoundTripIvt0MsgResultU2(void) {
+    CAN_IVT0_MSG_RESULT_U2_SIGNALS_s sent     = {0};
+    CAN_IVT0_MSG_RESULT_U2_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT0_Result_U2_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_U2_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_U2_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_U2_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_ID_Result_U2 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT0_MsgCount_Result_U2 = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT0_Result_U2_mV = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt0MsgResultU2(&sent, canData);
+
+        /* IVT0_Result_U2_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U2_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT0_Result_U2_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U2_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT0_Result_U2_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U2_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT0_Result_U2_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U2_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT0_ID_Result_U2: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_U2, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT0_MsgCount_Result_U2: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_MsgCount_Result_U2,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT0_Result_U2_mV: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U2_mV, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt0MsgResultU2(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U2_systemError, (int64_t)received.IVT0_Result_U2_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U2_OCS, (int64_t)received.IVT0_Result_U2_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U2_overallMeasError,
+            (int64_t)received.IVT0_Result_U2_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_U2_channelMeasError,
+            (int64_t)received.IVT0_Result_U2_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_U2, (int64_t)received.IVT0_ID_Result_U2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_U2, (int64_t)received.IVT0_MsgCount_Result_U2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_U2_mV, (int64_t)received.IVT0_Result_U2_mV);
+    }
+}
+
+void testRoundTripIvt0MsgResultU3(void) {
+    CAN_IVT0_MSG_RESULT_U3_SIGNALS_s sent     = {0};
+    CAN_IVT0_MSG_RESULT_U3_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT_Result_U3_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_Result_U3_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_Result_U3_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_Result_U3_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_ID_Result_U3 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT_MsgCount_Result_U3 = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT_Result_U3_mV = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt0MsgResultU3(&sent, canData);
+
+        /* IVT_Result_U3_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT_Result_U3_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT_Result_U3_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT_Result_U3_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT_ID_Result_U3: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_ID_Result_U3, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT_MsgCount_Result_U3: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_MsgCount_Result_U3, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT_Result_U3_mV: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_mV, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt0MsgResultU3(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_systemError, (int64_t)received.IVT_Result_U3_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_OCS, (int64_t)received.IVT_Result_U3_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_overallMeasError,
+            (int64_t)received.IVT_Result_U3_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_channelMeasError,
+            (int64_t)received.IVT_Result_U3_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_ID_Result_U3, (int64_t)received.IVT_ID_Result_U3);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_MsgCount_Result_U3, (int64_t)received.IVT_MsgCount_Result_U3);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_mV, (int64_t)received.IVT_Result_U3_mV);
+    }
+}
+
+void testRoundTripIvt0MsgResultT(void) {
+    CAN_IVT0_MSG_RESULT_T_SIGNALS_s sent     = {0};
+    CAN_IVT0_MSG_RESULT_T_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT0_Result_T_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_T_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_T_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_T_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_ID_Result_T = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT0_MsgCount_Result_T = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT0_Result_T_ddegC = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt0MsgResultT(&sent, canData);
+
+        /* IVT0_Result_T_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_T_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT0_Result_T_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_T_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT0_Result_T_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_T_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT0_Result_T_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_T_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT0_ID_Result_T: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_T, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT0_MsgCount_Result_T: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_T, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT0_Result_T_ddegC: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_T_ddegC, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt0MsgResultT(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_T_systemError, (int64_t)received.IVT0_Result_T_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_T_OCS, (int64_t)received.IVT0_Result_T_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_T_overallMeasError,
+            (int64_t)received.IVT0_Result_T_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_T_channelMeasError,
+            (int64_t)received.IVT0_Result_T_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_T, (int64_t)received.IVT0_ID_Result_T);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_T, (int64_t)received.IVT0_MsgCount_Result_T);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_T_ddegC, (int64_t)received.IVT0_Result_T_ddegC);
+    }
+}
+
+void testRoundTripIvt0MsgResultW(void) {
+    CAN_IVT0_MSG_RESULT_W_SIGNALS_s sent     = {0};
+    CAN_IVT0_MSG_RESULT_W_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT0_Result_W_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_W_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_W_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_W_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_W = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        sent.IVT0_MsgCount_Result_W = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT0_ID_Result_W = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt0MsgResultW(&sent, canData);
+
+        /* IVT0_Result_W_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_W_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT0_Result_W_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_W_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT0_Result_W_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_W_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT0_Result_W_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_W_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT0_Result_W: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_W, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* IVT0_MsgCount_Result_W: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_W, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT0_ID_Result_W: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_W, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt0MsgResultW(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_W_systemError, (int64_t)received.IVT0_Result_W_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_W_OCS, (int64_t)received.IVT0_Result_W_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_W_overallMeasError,
+            (int64_t)received.IVT0_Result_W_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_W_channelMeasError,
+            (int64_t)received.IVT0_Result_W_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_W, (int64_t)received.IVT0_Result_W);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_W, (int64_t)received.IVT0_MsgCount_Result_W);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_W, (int64_t)received.IVT0_ID_Result_W);
+    }
+}
+
+void testRoundTripIvt0MsgResultAs(void) {
+    CAN_IVT0_MSG_RESULT_AS_SIGNALS_s sent     = {0};
+    CAN_IVT0_MSG_RESULT_AS_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT0_Result_As_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_As_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_As_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_As_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_As = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        sent.IVT0_MsgCount_Result_As = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT0_ID_Result_As = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt0MsgResultAs(&sent, canData);
+
+        /* IVT0_Result_As_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_As_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT0_Result_As_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_As_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT0_Result_As_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_As_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT0_Result_As_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_As_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT0_Result_As: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_As, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* IVT0_MsgCount_Result_As: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_MsgCount_Result_As,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT0_ID_Result_As: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_As, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt0MsgResultAs(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_As_systemError, (int64_t)received.IVT0_Result_As_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_As_OCS, (int64_t)received.IVT0_Result_As_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_As_overallMeasError,
+            (int64_t)received.IVT0_Result_As_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_As_channelMeasError,
+            (int64_t)received.IVT0_Result_As_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_As, (int64_t)received.IVT0_Result_As);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_As, (int64_t)received.IVT0_MsgCount_Result_As);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_As, (int64_t)received.IVT0_ID_Result_As);
+    }
+}
+
+void testRoundTripIvt0MsgResultWh(void) {
+    CAN_IVT0_MSG_RESULT_WH_SIGNALS_s sent     = {0};
+    CAN_IVT0_MSG_RESULT_WH_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT0_Result_Wh_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_Wh_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_Wh_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_Wh_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT0_Result_Wh = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        sent.IVT0_MsgCount_Result_Wh = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT0_ID_Result_Wh = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt0MsgResultWh(&sent, canData);
+
+        /* IVT0_Result_Wh_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_Wh_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT0_Result_Wh_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_Wh_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT0_Result_Wh_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_Wh_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT0_Result_Wh_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_Wh_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT0_Result_Wh: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_Wh, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* IVT0_MsgCount_Result_Wh: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_MsgCount_Result_Wh,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT0_ID_Result_Wh: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_Wh, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt0MsgResultWh(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_Wh_systemError, (int64_t)received.IVT0_Result_Wh_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_Wh_OCS, (int64_t)received.IVT0_Result_Wh_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_Wh_overallMeasError,
+            (int64_t)received.IVT0_Result_Wh_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT0_Result_Wh_channelMeasError,
+            (int64_t)received.IVT0_Result_Wh_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_Result_Wh, (int64_t)received.IVT0_Result_Wh);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_MsgCount_Result_Wh, (int64_t)received.IVT0_MsgCount_Result_Wh);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT0_ID_Result_Wh, (int64_t)received.IVT0_ID_Result_Wh);
+    }
+}
+
+void testRoundTripIvt1MsgResultI(void) {
+    CAN_IVT1_MSG_RESULT_I_SIGNALS_s sent     = {0};
+    CAN_IVT1_MSG_RESULT_I_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT1_Result_I_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_I_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_I_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_I_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_ID_Result_I = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT1_MsgCount_Result_I = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT1_Result_I_mA = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt1MsgResultI(&sent, canData);
+
+        /* IVT1_Result_I_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_I_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT1_Result_I_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_I_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT1_Result_I_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_I_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT1_Result_I_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_I_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT1_ID_Result_I: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_I, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT1_MsgCount_Result_I: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_I, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT1_Result_I_mA: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_I_mA, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt1MsgResultI(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_I_systemError, (int64_t)received.IVT1_Result_I_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_I_OCS, (int64_t)received.IVT1_Result_I_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_I_overallMeasError,
+            (int64_t)received.IVT1_Result_I_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_I_channelMeasError,
+            (int64_t)received.IVT1_Result_I_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_I, (int64_t)received.IVT1_ID_Result_I);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_I, (int64_t)received.IVT1_MsgCount_Result_I);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_I_mA, (int64_t)received.IVT1_Result_I_mA);
+    }
+}
+
+void testRoundTripIvt1MsgResultU1(void) {
+    CAN_IVT1_MSG_RESULT_U1_SIGNALS_s sent     = {0};
+    CAN_IVT1_MSG_RESULT_U1_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT1_Result_U1_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_U1_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_U1_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_U1_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_ID_Result_U1 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT1_MsgCount_Result_U1 = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT1_Result_U1_mV = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt1MsgResultU1(&sent, canData);
+
+        /* IVT1_Result_U1_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U1_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT1_Result_U1_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U1_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT1_Result_U1_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U1_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT1_Result_U1_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U1_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT1_ID_Result_U1: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_U1, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT1_MsgCount_Result_U1: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_MsgCount_Result_U1,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT1_Result_U1_mV: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U1_mV, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt1MsgResultU1(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U1_systemError, (int64_t)received.IVT1_Result_U1_systemError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U1_overallMeasError,
+            (int64_t)received.IVT1_Result_U1_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U1_channelMeasError,
+            (int64_t)received.IVT1_Result_U1_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U1_OCS, (int64_t)received.IVT1_Result_U1_OCS);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_U1, (int64_t)received.IVT1_ID_Result_U1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_U1, (int64_t)received.IVT1_MsgCount_Result_U1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U1_mV, (int64_t)received.IVT1_Result_U1_mV);
+    }
+}
+
+void testRoundTripIvt1MsgResultU2(void) {
+    CAN_IVT1_MSG_RESULT_U2_SIGNALS_s sent     = {0};
+    CAN_IVT1_MSG_RESULT_U2_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT1_Result_U2_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_U2_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_U2_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_U2_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_ID_Result_U2 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT1_MsgCount_Result_U2 = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT1_Result_U2_mV = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt1MsgResultU2(&sent, canData);
+
+        /* IVT1_Result_U2_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U2_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT1_Result_U2_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U2_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT1_Result_U2_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U2_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT1_Result_U2_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U2_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT1_ID_Result_U2: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_U2, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT1_MsgCount_Result_U2: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_MsgCount_Result_U2,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT1_Result_U2_mV: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U2_mV, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt1MsgResultU2(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U2_systemError, (int64_t)received.IVT1_Result_U2_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U2_OCS, (int64_t)received.IVT1_Result_U2_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U2_overallMeasError,
+            (int64_t)received.IVT1_Result_U2_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_U2_channelMeasError,
+            (int64_t)received.IVT1_Result_U2_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_U2, (int64_t)received.IVT1_ID_Result_U2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_U2, (int64_t)received.IVT1_MsgCount_Result_U2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_U2_mV, (int64_t)received.IVT1_Result_U2_mV);
+    }
+}
+
+void testRoundTripIvt1MsgResultU3(void) {
+    CAN_IVT1_MSG_RESULT_U3_SIGNALS_s sent     = {0};
+    CAN_IVT1_MSG_RESULT_U3_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT_Result_U3_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_Result_U3_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_Result_U3_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_Result_U3_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_ID_Result_U3 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT_MsgCount_Result_U3 = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT_Result_U3_mV = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt1MsgResultU3(&sent, canData);
+
+        /* IVT_Result_U3_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT_Result_U3_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT_Result_U3_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT_Result_U3_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT_ID_Result_U3: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_ID_Result_U3, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT_MsgCount_Result_U3: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_MsgCount_Result_U3, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT_Result_U3_mV: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_mV, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt1MsgResultU3(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_systemError, (int64_t)received.IVT_Result_U3_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_OCS, (int64_t)received.IVT_Result_U3_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_overallMeasError,
+            (int64_t)received.IVT_Result_U3_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_channelMeasError,
+            (int64_t)received.IVT_Result_U3_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_ID_Result_U3, (int64_t)received.IVT_ID_Result_U3);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_MsgCount_Result_U3, (int64_t)received.IVT_MsgCount_Result_U3);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_mV, (int64_t)received.IVT_Result_U3_mV);
+    }
+}
+
+void testRoundTripIvt1MsgResultT(void) {
+    CAN_IVT1_MSG_RESULT_T_SIGNALS_s sent     = {0};
+    CAN_IVT1_MSG_RESULT_T_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT1_Result_T_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_T_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_T_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_T_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_ID_Result_T = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT1_MsgCount_Result_T = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT1_Result_T_ddegC = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt1MsgResultT(&sent, canData);
+
+        /* IVT1_Result_T_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_T_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT1_Result_T_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_T_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT1_Result_T_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_T_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT1_Result_T_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_T_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT1_ID_Result_T: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_T, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT1_MsgCount_Result_T: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_T, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT1_Result_T_ddegC: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_T_ddegC, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt1MsgResultT(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_T_systemError, (int64_t)received.IVT1_Result_T_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_T_OCS, (int64_t)received.IVT1_Result_T_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_T_overallMeasError,
+            (int64_t)received.IVT1_Result_T_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_T_channelMeasError,
+            (int64_t)received.IVT1_Result_T_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_T, (int64_t)received.IVT1_ID_Result_T);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_T, (int64_t)received.IVT1_MsgCount_Result_T);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_T_ddegC, (int64_t)received.IVT1_Result_T_ddegC);
+    }
+}
+
+void testRoundTripIvt1MsgResultW(void) {
+    CAN_IVT1_MSG_RESULT_W_SIGNALS_s sent     = {0};
+    CAN_IVT1_MSG_RESULT_W_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT1_Result_W_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_W_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_W_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_W_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_W = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        sent.IVT1_MsgCount_Result_W = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT1_ID_Result_W = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt1MsgResultW(&sent, canData);
+
+        /* IVT1_Result_W_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_W_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT1_Result_W_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_W_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT1_Result_W_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_W_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT1_Result_W_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_W_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT1_Result_W: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_W, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* IVT1_MsgCount_Result_W: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_W, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT1_ID_Result_W: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_W, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt1MsgResultW(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_W_systemError, (int64_t)received.IVT1_Result_W_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_W_OCS, (int64_t)received.IVT1_Result_W_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_W_overallMeasError,
+            (int64_t)received.IVT1_Result_W_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_W_channelMeasError,
+            (int64_t)received.IVT1_Result_W_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_W, (int64_t)received.IVT1_Result_W);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_W, (int64_t)received.IVT1_MsgCount_Result_W);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_W, (int64_t)received.IVT1_ID_Result_W);
+    }
+}
+
+void testRoundTripIvt1MsgResultAs(void) {
+    CAN_IVT1_MSG_RESULT_AS_SIGNALS_s sent     = {0};
+    CAN_IVT1_MSG_RESULT_AS_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT1_Result_As_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_As_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_As_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_As_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_As = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        sent.IVT1_MsgCount_Result_As = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT1_ID_Result_As = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt1MsgResultAs(&sent, canData);
+
+        /* IVT1_Result_As_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_As_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT1_Result_As_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_As_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT1_Result_As_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_As_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT1_Result_As_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_As_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT1_Result_As: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_As, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* IVT1_MsgCount_Result_As: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_MsgCount_Result_As,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT1_ID_Result_As: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_As, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt1MsgResultAs(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_As_systemError, (int64_t)received.IVT1_Result_As_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_As_OCS, (int64_t)received.IVT1_Result_As_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_As_overallMeasError,
+            (int64_t)received.IVT1_Result_As_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_As_channelMeasError,
+            (int64_t)received.IVT1_Result_As_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_As, (int64_t)received.IVT1_Result_As);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_As, (int64_t)received.IVT1_MsgCount_Result_As);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_As, (int64_t)received.IVT1_ID_Result_As);
+    }
+}
+
+void testRoundTripIvt1MsgResultWh(void) {
+    CAN_IVT1_MSG_RESULT_WH_SIGNALS_s sent     = {0};
+    CAN_IVT1_MSG_RESULT_WH_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT1_Result_Wh_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_Wh_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_Wh_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_Wh_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT1_Result_Wh = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        sent.IVT1_MsgCount_Result_Wh = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT1_ID_Result_Wh = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt1MsgResultWh(&sent, canData);
+
+        /* IVT1_Result_Wh_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_Wh_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT1_Result_Wh_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_Wh_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT1_Result_Wh_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_Wh_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT1_Result_Wh_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_Wh_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT1_Result_Wh: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_Wh, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* IVT1_MsgCount_Result_Wh: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_MsgCount_Result_Wh,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT1_ID_Result_Wh: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_Wh, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt1MsgResultWh(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_Wh_systemError, (int64_t)received.IVT1_Result_Wh_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_Wh_OCS, (int64_t)received.IVT1_Result_Wh_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_Wh_overallMeasError,
+            (int64_t)received.IVT1_Result_Wh_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT1_Result_Wh_channelMeasError,
+            (int64_t)received.IVT1_Result_Wh_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_Result_Wh, (int64_t)received.IVT1_Result_Wh);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_MsgCount_Result_Wh, (int64_t)received.IVT1_MsgCount_Result_Wh);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT1_ID_Result_Wh, (int64_t)received.IVT1_ID_Result_Wh);
+    }
+}
+
+void testRoundTripIvt2MsgResultI(void) {
+    CAN_IVT2_MSG_RESULT_I_SIGNALS_s sent     = {0};
+    CAN_IVT2_MSG_RESULT_I_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT2_Result_I_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_I_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_I_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_I_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_ID_Result_I = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT2_MsgCount_Result_I = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT2_Result_I_mA = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt2MsgResultI(&sent, canData);
+
+        /* IVT2_Result_I_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_I_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT2_Result_I_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_I_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT2_Result_I_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_I_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT2_Result_I_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_I_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT2_ID_Result_I: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_I, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT2_MsgCount_Result_I: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_I, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT2_Result_I_mA: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_I_mA, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt2MsgResultI(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_I_systemError, (int64_t)received.IVT2_Result_I_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_I_OCS, (int64_t)received.IVT2_Result_I_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_I_overallMeasError,
+            (int64_t)received.IVT2_Result_I_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_I_channelMeasError,
+            (int64_t)received.IVT2_Result_I_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_I, (int64_t)received.IVT2_ID_Result_I);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_I, (int64_t)received.IVT2_MsgCount_Result_I);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_I_mA, (int64_t)received.IVT2_Result_I_mA);
+    }
+}
+
+void testRoundTripIvt2MsgResultU1(void) {
+    CAN_IVT2_MSG_RESULT_U1_SIGNALS_s sent     = {0};
+    CAN_IVT2_MSG_RESULT_U1_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT2_Result_U1_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_U1_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_U1_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_U1_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_ID_Result_U1 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT2_MsgCount_Result_U1 = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT2_Result_U1_mV = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt2MsgResultU1(&sent, canData);
+
+        /* IVT2_Result_U1_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U1_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT2_Result_U1_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U1_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT2_Result_U1_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U1_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT2_Result_U1_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U1_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT2_ID_Result_U1: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_U1, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT2_MsgCount_Result_U1: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_MsgCount_Result_U1,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT2_Result_U1_mV: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U1_mV, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt2MsgResultU1(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U1_systemError, (int64_t)received.IVT2_Result_U1_systemError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U1_overallMeasError,
+            (int64_t)received.IVT2_Result_U1_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U1_channelMeasError,
+            (int64_t)received.IVT2_Result_U1_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U1_OCS, (int64_t)received.IVT2_Result_U1_OCS);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_U1, (int64_t)received.IVT2_ID_Result_U1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_U1, (int64_t)received.IVT2_MsgCount_Result_U1);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U1_mV, (int64_t)received.IVT2_Result_U1_mV);
+    }
+}
+
+void testRoundTripIvt2MsgResultU2(void) {
+    CAN_IVT2_MSG_RESULT_U2_SIGNALS_s sent     = {0};
+    CAN_IVT2_MSG_RESULT_U2_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT2_Result_U2_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_U2_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_U2_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_U2_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_ID_Result_U2 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT2_MsgCount_Result_U2 = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT2_Result_U2_mV = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt2MsgResultU2(&sent, canData);
+
+        /* IVT2_Result_U2_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U2_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT2_Result_U2_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U2_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT2_Result_U2_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U2_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT2_Result_U2_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U2_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT2_ID_Result_U2: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_U2, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT2_MsgCount_Result_U2: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_MsgCount_Result_U2,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT2_Result_U2_mV: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U2_mV, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt2MsgResultU2(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U2_systemError, (int64_t)received.IVT2_Result_U2_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U2_OCS, (int64_t)received.IVT2_Result_U2_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U2_overallMeasError,
+            (int64_t)received.IVT2_Result_U2_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_U2_channelMeasError,
+            (int64_t)received.IVT2_Result_U2_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_U2, (int64_t)received.IVT2_ID_Result_U2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_U2, (int64_t)received.IVT2_MsgCount_Result_U2);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_U2_mV, (int64_t)received.IVT2_Result_U2_mV);
+    }
+}
+
+void testRoundTripIvt2MsgResultU3(void) {
+    CAN_IVT2_MSG_RESULT_U3_SIGNALS_s sent     = {0};
+    CAN_IVT2_MSG_RESULT_U3_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT_Result_U3_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_Result_U3_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_Result_U3_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_Result_U3_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT_ID_Result_U3 = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT_MsgCount_Result_U3 = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT_Result_U3_mV = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt2MsgResultU3(&sent, canData);
+
+        /* IVT_Result_U3_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT_Result_U3_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT_Result_U3_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT_Result_U3_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT_ID_Result_U3: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_ID_Result_U3, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT_MsgCount_Result_U3: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_MsgCount_Result_U3, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT_Result_U3_mV: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_mV, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt2MsgResultU3(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_systemError, (int64_t)received.IVT_Result_U3_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_OCS, (int64_t)received.IVT_Result_U3_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_overallMeasError,
+            (int64_t)received.IVT_Result_U3_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT_Result_U3_channelMeasError,
+            (int64_t)received.IVT_Result_U3_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_ID_Result_U3, (int64_t)received.IVT_ID_Result_U3);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_MsgCount_Result_U3, (int64_t)received.IVT_MsgCount_Result_U3);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT_Result_U3_mV, (int64_t)received.IVT_Result_U3_mV);
+    }
+}
+
+void testRoundTripIvt2MsgResultT(void) {
+    CAN_IVT2_MSG_RESULT_T_SIGNALS_s sent     = {0};
+    CAN_IVT2_MSG_RESULT_T_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT2_Result_T_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_T_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_T_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_T_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_ID_Result_T = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        sent.IVT2_MsgCount_Result_T = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT2_Result_T_ddegC = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt2MsgResultT(&sent, canData);
+
+        /* IVT2_Result_T_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_T_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT2_Result_T_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_T_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT2_Result_T_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_T_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT2_Result_T_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_T_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT2_ID_Result_T: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_T, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* IVT2_MsgCount_Result_T: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_T, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT2_Result_T_ddegC: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_T_ddegC, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt2MsgResultT(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_T_systemError, (int64_t)received.IVT2_Result_T_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_T_OCS, (int64_t)received.IVT2_Result_T_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_T_overallMeasError,
+            (int64_t)received.IVT2_Result_T_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_T_channelMeasError,
+            (int64_t)received.IVT2_Result_T_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_T, (int64_t)received.IVT2_ID_Result_T);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_T, (int64_t)received.IVT2_MsgCount_Result_T);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_T_ddegC, (int64_t)received.IVT2_Result_T_ddegC);
+    }
+}
+
+void testRoundTripIvt2MsgResultW(void) {
+    CAN_IVT2_MSG_RESULT_W_SIGNALS_s sent     = {0};
+    CAN_IVT2_MSG_RESULT_W_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT2_Result_W_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_W_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_W_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_W_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_W = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        sent.IVT2_MsgCount_Result_W = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT2_ID_Result_W = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt2MsgResultW(&sent, canData);
+
+        /* IVT2_Result_W_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_W_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT2_Result_W_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_W_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT2_Result_W_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_W_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT2_Result_W_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_W_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT2_Result_W: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_W, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* IVT2_MsgCount_Result_W: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_W, TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT2_ID_Result_W: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_W, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt2MsgResultW(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_W_systemError, (int64_t)received.IVT2_Result_W_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_W_OCS, (int64_t)received.IVT2_Result_W_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_W_overallMeasError,
+            (int64_t)received.IVT2_Result_W_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_W_channelMeasError,
+            (int64_t)received.IVT2_Result_W_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_W, (int64_t)received.IVT2_Result_W);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_W, (int64_t)received.IVT2_MsgCount_Result_W);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_W, (int64_t)received.IVT2_ID_Result_W);
+    }
+}
+
+void testRoundTripIvt2MsgResultAs(void) {
+    CAN_IVT2_MSG_RESULT_AS_SIGNALS_s sent     = {0};
+    CAN_IVT2_MSG_RESULT_AS_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT2_Result_As_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_As_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_As_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_As_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_As = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        sent.IVT2_MsgCount_Result_As = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT2_ID_Result_As = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt2MsgResultAs(&sent, canData);
+
+        /* IVT2_Result_As_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_As_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT2_Result_As_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_As_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT2_Result_As_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_As_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT2_Result_As_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_As_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT2_Result_As: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_As, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* IVT2_MsgCount_Result_As: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_MsgCount_Result_As,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT2_ID_Result_As: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_As, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt2MsgResultAs(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_As_systemError, (int64_t)received.IVT2_Result_As_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_As_OCS, (int64_t)received.IVT2_Result_As_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_As_overallMeasError,
+            (int64_t)received.IVT2_Result_As_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_As_channelMeasError,
+            (int64_t)received.IVT2_Result_As_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_As, (int64_t)received.IVT2_Result_As);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_As, (int64_t)received.IVT2_MsgCount_Result_As);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_As, (int64_t)received.IVT2_ID_Result_As);
+    }
+}
+
+void testRoundTripIvt2MsgResultWh(void) {
+    CAN_IVT2_MSG_RESULT_WH_SIGNALS_s sent     = {0};
+    CAN_IVT2_MSG_RESULT_WH_SIGNALS_s received = {0};
+    uint8_t canData[8]  = {0};
+
+    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {
+        sent.IVT2_Result_Wh_systemError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_Wh_OCS = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_Wh_overallMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_Wh_channelMeasError = (uint8_t)TEST_GetRandomRaw(round, 1u, false);
+        sent.IVT2_Result_Wh = (int32_t)TEST_GetRandomRaw(round, 32u, true);
+        sent.IVT2_MsgCount_Result_Wh = (uint8_t)TEST_GetRandomRaw(round, 4u, false);
+        sent.IVT2_ID_Result_Wh = (uint8_t)TEST_GetRandomRaw(round, 8u, false);
+        for (uint8_t i = 0u; i < 8u; i++) {
+            canData[i] = 0u;
+        }
+        CAN_PackIvt2MsgResultWh(&sent, canData);
+
+        /* IVT2_Result_Wh_systemError: 15|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_Wh_systemError,
+            TEST_GetDbcSignal(canData, 15u, 1u, true, false));
+        /* IVT2_Result_Wh_OCS: 12|1@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_Wh_OCS, TEST_GetDbcSignal(canData, 12u, 1u, true, false));
+        /* IVT2_Result_Wh_overallMeasError: 14|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_Wh_overallMeasError,
+            TEST_GetDbcSignal(canData, 14u, 1u, true, false));
+        /* IVT2_Result_Wh_channelMeasError: 13|1@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_Wh_channelMeasError,
+            TEST_GetDbcSignal(canData, 13u, 1u, true, false));
+        /* IVT2_Result_Wh: 23|32@0- */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_Wh, TEST_GetDbcSignal(canData, 23u, 32u, true, true));
+        /* IVT2_MsgCount_Result_Wh: 11|4@0+ */
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_MsgCount_Result_Wh,
+            TEST_GetDbcSignal(canData, 11u, 4u, true, false));
+        /* IVT2_ID_Result_Wh: 7|8@0+ */
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_Wh, TEST_GetDbcSignal(canData, 7u, 8u, true, false));
+        /* bits that are not used by a signal stay zero */
+        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & 0xFFFF000000000000ull);
+
+        CAN_UnpackIvt2MsgResultWh(canData, &received);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_Wh_systemError, (int64_t)received.IVT2_Result_Wh_systemError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_Wh_OCS, (int64_t)received.IVT2_Result_Wh_OCS);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_Wh_overallMeasError,
+            (int64_t)received.IVT2_Result_Wh_overallMeasError);
+        TEST_ASSERT_EQUAL_INT64(
+            (int64_t)sent.IVT2_Result_Wh_channelMeasError,
+            (int64_t)received.IVT2_Result_Wh_channelMeasError);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_Result_Wh, (int64_t)received.IVT2_Result_Wh);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_MsgCount_Result_Wh, (int64_t)received.IVT2_MsgCount_Result_Wh);
+        TEST_ASSERT_EQUAL_INT64((int64_t)sent.IVT2_ID_Result_Wh, (int64_t)received.IVT2_ID_Result_Wh);
+    }
+}
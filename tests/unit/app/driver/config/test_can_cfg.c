@@ -53,14 +53,17 @@
 
 /*========== Includes =======================================================*/
 #include "unity.h"
+#include "Mockalgorithm.h"
 #include "Mockcan.h"
 #include "Mockdatabase.h"
 #include "Mockdiag.h"
 #include "Mockfoxmath.h"
 #include "Mockmpu_prototypes.h"
 #include "Mockos.h"
+#include "Mocksys_mon.h"
 
 #include "can_cfg.h"
+#include "can_codec.h"
 #include "database_cfg.h"
 
 #include "imd.h"
@@ -69,6 +72,67 @@
 
 QueueHandle_t imd_canDataQueue = NULL_PTR;
 
+ALGO_TASKS_s algo_algorithms[2] = {0};
+const uint16_t algo_length      = sizeof(algo_algorithms) / sizeof(algo_algorithms[0]);
+
+/** statistics that are returned for the algorithm with the same index */
+static ALGO_STATISTICS_s testAlgorithmStatistics[2] = {
+    {5u, 40u, 300u, 10u, 0u},
+    {70000u, 70000u, 700000u, 10u, 70000u},
+};
+
+static void TEST_ALGO_GetStatistics(uint16_t algorithmIndex, ALGO_STATISTICS_s *pStatistics, int numCalls) {
+    *pStatistics = testAlgorithmStatistics[algorithmIndex];
+}
+
+/** profile that is returned for every task and section */
+static SYSM_PROFILE_s testProfile = {
+    .minimum_us = 20u,
+    .maximum_us = 90000u,
+    .total_us   = 4000u,
+    .count      = 40u,
+    .histogram  = {10u, 20u, 0u, 0u, 0u, 0u, 10u},
+};
+
+static void TEST_SYSM_GetProfile(uint8_t profileIndex, SYSM_PROFILE_s *pProfile, int numCalls) {
+    *pProfile = testProfile;
+}
+
+/** violations that are returned by the system monitoring, newest first */
+static FRAM_SYS_MON_VIOLATION_s testViolations[2] = {
+    {5000u, 12u, 3u, {0u, 0u, 12u, 2000u, 1u}, 2u},
+    {20u, 150u, 60u, {0u, 0u, 1u, 150u, 1u}, 3u},
+};
+
+static bool TEST_SYSM_GetRecordedViolation(uint8_t age, FRAM_SYS_MON_VIOLATION_s *pViolation, int numCalls) {
+    bool isRecorded = false;
+    if (age < 2u) {
+        *pViolation = testViolations[age];
+        isRecorded  = true;
+    }
+    return isRecorded;
+}
+
+/** CAN data of the messages that are sent directly */
+static uint8_t testSentData[4][8]   = {0};
+static uint8_t testNrOfSentMessages = 0u;
+
+static STD_RETURN_TYPE_e TEST_CAN_DataSend(canBASE_t *pNode, uint32_t id, uint8 *pData, int numCalls) {
+    for (uint8_t i = 0u; i < 8u; i++) {
+        testSentData[numCalls][i] = pData[i];
+    }
+    testNrOfSentMessages = (uint8_t)(numCalls + 1);
+    return STD_OK;
+}
+
+/** copy of the current sensor table that is written to the database */
+static DATA_BLOCK_CURRENT_SENSOR_s testCurrentSensor = {0};
+
+static STD_RETURN_TYPE_e TEST_DATA_WriteCurrentSensor(void *pDataFromSender0, int numCalls) {
+    testCurrentSensor = *(DATA_BLOCK_CURRENT_SENSOR_s *)pDataFromSender0;
+    return STD_OK;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
 }
@@ -87,8 +151,13 @@ void testcan_txVolt(void) {
         pcan_voltTab->cellVoltage_mV[stringNumber][4] = 4200;
         pcan_voltTab->cellVoltage_mV[stringNumber][5] = 0;
     }
-    DATA_Read_1_DataBlock_ExpectAndReturn(pcan_voltTab, STD_OK);
-    DATA_Read_1_DataBlock_ReturnThruPtr_pDataToReceiver0(pcan_voltTab);
+    /* the cell voltages of all strings are read with the first message */
+    DATA_ReadDataBlockRange_ExpectAndReturn(
+        DATA_BLOCK_ID_CELL_VOLTAGE,
+        (void *)&pcan_voltTab->cellVoltage_mV,
+        (uint16_t)offsetof(DATA_BLOCK_CELL_VOLTAGE_s, cellVoltage_mV),
+        (uint16_t)sizeof(pcan_voltTab->cellVoltage_mV),
+        STD_OK);
     uint8_t data[8] = {0};
     TEST_CAN_TxVoltage(0x110, 8, littleEndian, data, NULL_PTR);
 
@@ -102,8 +171,168 @@ void testcan_txVolt(void) {
     TEST_ASSERT_EQUAL(7, data[7]);
 }
 
+void testcan_txVoltOfAllStrings(void) {
+    DATA_BLOCK_CELL_VOLTAGE_s *pcan_voltTab = TEST_CAN_GetCellvoltageTab();
+    for (uint8_t cell = 0u; cell < 6u; cell++) {
+        pcan_voltTab->cellVoltage_mV[0][cell]                              = 4200;
+        pcan_voltTab->cellVoltage_mV[1][cell]                              = 3000;
+        pcan_voltTab->cellVoltage_mV[BS_NR_OF_STRINGS - 1u][BS_NR_OF_BAT_CELLS - 6u + cell] = 2500;
+    }
+    uint8_t data[8] = {0};
+
+    /* the cells of the second string follow the cells of the first string */
+    TEST_CAN_TxVoltage(0x110u + (BS_NR_OF_BAT_CELLS / 6u), 8, littleEndian, data, NULL_PTR);
+    const uint8_t expected3000mV[8] = {76, 52, 209, 68, 19, 77, 52, 17};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected3000mV, data, 8u);
+
+    /* last message: last cells of the last string */
+    TEST_CAN_TxVoltage(0x110u + ((BS_NR_OF_STRINGS * BS_NR_OF_BAT_CELLS) / 6u) - 1u, 8, littleEndian, data, NULL_PTR);
+    const uint8_t expected2500mV[8] = {232, 163, 143, 62, 250, 232, 163, 15};
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected2500mV, data, 8u);
+}
+
 void testcan_rxDebug(void) {
     /* adapt this test when the callback is implemented */
     uint8_t data[8] = {0};
     TEST_ASSERT_EQUAL(0, TEST_CAN_RxDebug(0, 0, 0, data, NULL_PTR));
 }
+
+void testcan_rxCurrentSensorUsesDbcLayout(void) {
+    CAN_IVT0_MSG_RESULT_I_SIGNALS_s signals = {
+        .IVT0_ID_Result_I       = 0x0u,
+        .IVT0_MsgCount_Result_I = 0x3u,
+        .IVT0_Result_I_mA       = -123456,
+    };
+    uint8_t data[8] = {0};
+    DATA_Write_1_DataBlock_Stub(TEST_DATA_WriteCurrentSensor);
+    OS_GetTickCount_IgnoreAndReturn(0u);
+
+    /* valid measurement */
+    CAN_PackIvt0MsgResultI(&signals, data);
+    TEST_ASSERT_EQUAL(0u, TEST_CAN_RxCurrentSensor(CAN_IVT0_MSG_RESULT_I_ID, 8u, bigEndian, data, NULL_PTR));
+    TEST_ASSERT_EQUAL(-123456, testCurrentSensor.current_mA[0]);
+    TEST_ASSERT_EQUAL(0u, testCurrentSensor.invalidCurrentMeasurement[0]);
+
+    /* the status of the current sensor is read from the second byte, as defined in the DBC file */
+    signals.IVT0_Result_I_channelMeasError = 1u;
+    CAN_PackIvt0MsgResultI(&signals, data);
+    TEST_ASSERT_EQUAL_HEX8(0x23u, data[1]);
+    TEST_ASSERT_EQUAL(0u, TEST_CAN_RxCurrentSensor(CAN_IVT0_MSG_RESULT_I_ID, 8u, bigEndian, data, NULL_PTR));
+    TEST_ASSERT_EQUAL(1u, testCurrentSensor.invalidCurrentMeasurement[0]);
+    TEST_ASSERT_EQUAL(0u, testCurrentSensor.invalidPowerMeasurement[0]);
+
+    /* a system error invalidates all measurements of the sensor */
+    signals.IVT0_Result_I_channelMeasError = 0u;
+    signals.IVT0_Result_I_systemError      = 1u;
+    CAN_PackIvt0MsgResultI(&signals, data);
+    TEST_ASSERT_EQUAL(0u, TEST_CAN_RxCurrentSensor(CAN_IVT0_MSG_RESULT_I_ID, 8u, bigEndian, data, NULL_PTR));
+    TEST_ASSERT_EQUAL(1u, testCurrentSensor.invalidCurrentMeasurement[0]);
+    TEST_ASSERT_EQUAL(1u, testCurrentSensor.invalidPowerMeasurement[0]);
+}
+
+void testcan_txAlgorithmStatisticsCyclesOverAlgorithms(void) {
+    uint32_t mux                                      = 0u;
+    uint8_t data[8]                                   = {0};
+    CAN_FOXBMS_ALGORITHM_STATISTICS_SIGNALS_s signals = {0};
+    algo_algorithms[0].state                          = ALGO_READY;
+    algo_algorithms[1].state                          = ALGO_BLOCKED;
+    ALGO_GetStatistics_Stub(TEST_ALGO_GetStatistics);
+
+    TEST_ASSERT_EQUAL(
+        0u, TEST_CAN_TxAlgorithmStatistics(CAN_FOXBMS_ALGORITHM_STATISTICS_ID, 8u, bigEndian, data, &mux));
+    CAN_UnpackFoxbmsAlgorithmStatistics(data, &signals);
+    TEST_ASSERT_EQUAL(1u, mux);
+    TEST_ASSERT_EQUAL(0u, signals.foxBMS_AlgorithmStatistics_Mux);
+    TEST_ASSERT_EQUAL(30u, signals.Algorithm0_averageTime);
+    TEST_ASSERT_EQUAL(40u, signals.Algorithm0_worstTime);
+    TEST_ASSERT_EQUAL(0u, signals.Algorithm0_overruns);
+    TEST_ASSERT_EQUAL(ALGO_READY, signals.Algorithm0_state);
+
+    /* values that do not fit into the signals are limited */
+    TEST_ASSERT_EQUAL(
+        0u, TEST_CAN_TxAlgorithmStatistics(CAN_FOXBMS_ALGORITHM_STATISTICS_ID, 8u, bigEndian, data, &mux));
+    CAN_UnpackFoxbmsAlgorithmStatistics(data, &signals);
+    TEST_ASSERT_EQUAL(1u, signals.foxBMS_AlgorithmStatistics_Mux);
+    TEST_ASSERT_EQUAL(UINT16_MAX, signals.Algorithm0_averageTime);
+    TEST_ASSERT_EQUAL(UINT16_MAX, signals.Algorithm0_worstTime);
+    TEST_ASSERT_EQUAL(UINT16_MAX, signals.Algorithm0_overruns);
+    TEST_ASSERT_EQUAL(ALGO_BLOCKED, signals.Algorithm0_state);
+
+    /* the multiplexer wraps around after the last algorithm */
+    TEST_ASSERT_EQUAL(
+        0u, TEST_CAN_TxAlgorithmStatistics(CAN_FOXBMS_ALGORITHM_STATISTICS_ID, 8u, bigEndian, data, &mux));
+    CAN_UnpackFoxbmsAlgorithmStatistics(data, &signals);
+    TEST_ASSERT_EQUAL(0u, signals.foxBMS_AlgorithmStatistics_Mux);
+    TEST_ASSERT_EQUAL(1u, mux);
+}
+
+void testcan_txProfilingTimesCyclesOverProfiles(void) {
+    uint32_t mux                                 = 0u;
+    uint8_t data[8]                              = {0};
+    CAN_FOXBMS_PROFILING_TIMES_SIGNALS_s signals = {0};
+    SYSM_GetProfile_Stub(TEST_SYSM_GetProfile);
+
+    TEST_ASSERT_EQUAL(0u, TEST_CAN_TxProfilingTimes(CAN_FOXBMS_PROFILING_TIMES_ID, 8u, bigEndian, data, &mux));
+    CAN_UnpackFoxbmsProfilingTimes(data, &signals);
+    TEST_ASSERT_EQUAL(1u, mux);
+    TEST_ASSERT_EQUAL(0u, signals.foxBMS_ProfilingTimes_Mux);
+    TEST_ASSERT_EQUAL(20u, signals.Profile0_minimumTime);
+    TEST_ASSERT_EQUAL(UINT16_MAX, signals.Profile0_maximumTime);
+    TEST_ASSERT_EQUAL(100u, signals.Profile0_meanTime);
+
+    /* the multiplexer wraps around after the last profile */
+    mux = SYSM_NR_OF_PROFILES;
+    TEST_ASSERT_EQUAL(0u, TEST_CAN_TxProfilingTimes(CAN_FOXBMS_PROFILING_TIMES_ID, 8u, bigEndian, data, &mux));
+    CAN_UnpackFoxbmsProfilingTimes(data, &signals);
+    TEST_ASSERT_EQUAL(0u, signals.foxBMS_ProfilingTimes_Mux);
+    TEST_ASSERT_EQUAL(1u, mux);
+}
+
+void testcan_txProfilingHistogramInPercent(void) {
+    uint32_t mux                                     = 3u;
+    uint8_t data[8]                                  = {0};
+    CAN_FOXBMS_PROFILING_HISTOGRAM_SIGNALS_s signals = {0};
+    SYSM_GetProfile_Stub(TEST_SYSM_GetProfile);
+
+    TEST_ASSERT_EQUAL(
+        0u, TEST_CAN_TxProfilingHistogram(CAN_FOXBMS_PROFILING_HISTOGRAM_ID, 8u, bigEndian, data, &mux));
+    CAN_UnpackFoxbmsProfilingHistogram(data, &signals);
+    TEST_ASSERT_EQUAL(4u, mux);
+    TEST_ASSERT_EQUAL(3u, signals.foxBMS_ProfilingHistogram_Mux);
+    TEST_ASSERT_EQUAL(25u, signals.Profile0_bucket0);
+    TEST_ASSERT_EQUAL(50u, signals.Profile0_bucket1);
+    TEST_ASSERT_EQUAL(0u, signals.Profile0_bucket2);
+    TEST_ASSERT_EQUAL(25u, signals.Profile0_bucket6);
+}
+
+void testcan_rxDebugReadsAndClearsTimingViolations(void) {
+    uint8_t data[8]                                           = {0xB0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u};
+    CAN_FOXBMS_TIMING_VIOLATION_SIGNALS_s violation           = {0};
+    CAN_FOXBMS_TIMING_VIOLATION_DURATIONS_SIGNALS_s durations = {0};
+    SYSM_GetRecordedViolation_Stub(TEST_SYSM_GetRecordedViolation);
+    CAN_DataSend_Stub(TEST_CAN_DataSend);
+
+    /* every recorded violation is sent in two messages */
+    TEST_ASSERT_EQUAL(0u, TEST_CAN_RxDebug(0x100u, 8u, littleEndian, data, NULL_PTR));
+    TEST_ASSERT_EQUAL(4u, testNrOfSentMessages);
+    CAN_UnpackFoxbmsTimingViolation(testSentData[0], &violation);
+    TEST_ASSERT_EQUAL(0u, violation.foxBMS_TimingViolation_Mux);
+    TEST_ASSERT_EQUAL(2u, violation.Violation0_taskId);
+    TEST_ASSERT_EQUAL_UINT32(5000u, violation.Violation0_timestamp);
+    TEST_ASSERT_EQUAL(3u, violation.Violation0_jitter);
+    CAN_UnpackFoxbmsTimingViolationDurations(testSentData[1], &durations);
+    TEST_ASSERT_EQUAL(0u, durations.foxBMS_TimingViolationDurations_Mux);
+    TEST_ASSERT_EQUAL(12u, durations.Violation0_durationTask2);
+    /* durations that do not fit into the signal are limited */
+    TEST_ASSERT_EQUAL(1023u, durations.Violation0_durationTask3);
+    CAN_UnpackFoxbmsTimingViolation(testSentData[2], &violation);
+    TEST_ASSERT_EQUAL(1u, violation.foxBMS_TimingViolation_Mux);
+    TEST_ASSERT_EQUAL(3u, violation.Violation0_taskId);
+    CAN_UnpackFoxbmsTimingViolationDurations(testSentData[3], &durations);
+    TEST_ASSERT_EQUAL(1u, durations.foxBMS_TimingViolationDurations_Mux);
+    TEST_ASSERT_EQUAL(150u, durations.Violation0_durationTask3);
+
+    data[0] = 0xB1u;
+    SYSM_ClearViolationRecord_Expect();
+    TEST_ASSERT_EQUAL(0u, TEST_CAN_RxDebug(0x100u, 8u, littleEndian, data, NULL_PTR));
+}
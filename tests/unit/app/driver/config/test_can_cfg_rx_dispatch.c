@@ -0,0 +1,214 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_can_cfg_rx_dispatch.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Checks the RX dispatch table of the configured CAN messages
+ *
+ * @details The benchmark replays the CAN log of the SIL regression gate
+ *          (tests/sil/replay) through the dispatch table and through a linear
+ *          search of the RX messages on the host. It only reports the
+ *          throughput and does not fail on it, but it fails if the log is
+ *          missing.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "MockHL_can.h"
+#include "Mockalgorithm.h"
+#include "Mockcan_codec.h"
+#include "Mockdatabase.h"
+#include "Mockdiag.h"
+#include "Mockfoxmath.h"
+#include "Mockio.h"
+#include "Mockmcu.h"
+#include "Mockmpu_prototypes.h"
+#include "Mockos.h"
+#include "Mocksys_mon.h"
+
+#include "can.h"
+#include "can_cfg.h"
+#include "database_cfg.h"
+
+#include "imd.h"
+
+#include <stdio.h>
+#include <time.h>
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** CAN log of the SIL regression gate that is replayed, relative to the repository root */
+#define TEST_CAN_TRACE "tests/sil/replay/ivt_cyclic_state_requests_2h.txt"
+
+/** maximum number of frames read from the trace */
+#define TEST_CAN_MAXIMUM_TRACE_FRAMES (1024u)
+
+/** number of received frames that are dispatched in the benchmark */
+#define TEST_CAN_BENCHMARK_FRAMES (2000000u)
+
+QueueHandle_t imd_canDataQueue = NULL_PTR;
+
+ALGO_TASKS_s algo_algorithms[1] = {0};
+const uint16_t algo_length      = sizeof(algo_algorithms) / sizeof(algo_algorithms[0]);
+
+static CAN_RX_DISPATCH_TABLE_s testDispatchTable = {0};
+
+/** IDs of the frames in the trace */
+static uint32_t testTraceIds[TEST_CAN_MAXIMUM_TRACE_FRAMES] = {0u};
+
+/**
+ * @brief   Reads the IDs of the frames of a CAN log in the format of the foxBMS GUI.
+ * @details The trace is searched relative to the possible working directories
+ *          of the unit test run.
+ * @return  number of frames read, 0 if the trace was not found
+ */
+static uint16_t TEST_CAN_ReadTrace(void) {
+    const char *paths[] = {
+        TEST_CAN_TRACE,
+        "../" TEST_CAN_TRACE,
+        "../../" TEST_CAN_TRACE,
+        "../../../" TEST_CAN_TRACE,
+    };
+    FILE *pFile = NULL_PTR;
+    for (uint8_t i = 0u; (i < (sizeof(paths) / sizeof(paths[0]))) && (pFile == NULL_PTR); i++) {
+        pFile = fopen(paths[i], "r");
+    }
+    uint16_t numberOfFrames = 0u;
+    if (pFile != NULL_PTR) {
+        char line[256] = {0};
+        while ((fgets(line, sizeof(line), pFile) != NULL_PTR) && (numberOfFrames < TEST_CAN_MAXIMUM_TRACE_FRAMES)) {
+            /* columns: time in s, decimal ID, data length, data */
+            unsigned long id = 0u;
+            if (sscanf(line, "%*f %lu", &id) == 1) {
+                testTraceIds[numberOfFrames] = (uint32_t)id;
+                numberOfFrames++;
+            }
+        }
+        (void)fclose(pFile);
+    }
+    return numberOfFrames;
+}
+
+/** number of handlers of an ID found by a linear search, as done before the dispatch table */
+static uint8_t TEST_CAN_LinearSearch(uint32_t id) {
+    uint8_t numberOfHandlers = 0u;
+    for (uint8_t i = 0u; i < can_rxLength; i++) {
+        if (can_rxMessages[i].id == id) {
+            numberOfHandlers++;
+        }
+    }
+    return numberOfHandlers;
+}
+
+/** reports the throughput of a benchmark run */
+static void TEST_CAN_ReportThroughput(const char *pName, clock_t start, clock_t stop) {
+    const double duration_s      = (double)(stop - start) / (double)CLOCKS_PER_SEC;
+    const double framesPerSecond = (duration_s > 0.0) ? ((double)TEST_CAN_BENCHMARK_FRAMES / duration_s) : 0.0;
+    char message[80]             = {0};
+    (void)snprintf(message, sizeof(message), "%s: %.0f frames/s", pName, framesPerSecond);
+    TEST_MESSAGE(message);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testConfiguredRxMessagesFitDispatchTable(void) {
+    uint8_t entry = 0u;
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildRxDispatchTable(can_rxMessages, can_rxLength, &testDispatchTable));
+
+    /* every configured message is found with all handlers of its ID */
+    for (uint8_t i = 0u; i < can_rxLength; i++) {
+        const uint8_t numberOfHandlers = CAN_FindRxHandlers(&testDispatchTable, can_rxMessages[i].id, &entry);
+        TEST_ASSERT_EQUAL(TEST_CAN_LinearSearch(can_rxMessages[i].id), numberOfHandlers);
+        bool found = false;
+        for (uint8_t handler = 0u; handler < numberOfHandlers; handler++) {
+            TEST_ASSERT_EQUAL_HEX32(can_rxMessages[i].id, testDispatchTable.id[entry + handler]);
+            if (testDispatchTable.message[entry + handler] == i) {
+                found = true;
+            }
+        }
+        TEST_ASSERT_TRUE(found);
+    }
+}
+
+void testRxDispatchBenchmarkWithTrace(void) {
+    const uint16_t numberOfFrames = TEST_CAN_ReadTrace();
+    if (numberOfFrames == 0u) {
+        TEST_FAIL_MESSAGE("CAN trace " TEST_CAN_TRACE " not found");
+    }
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildRxDispatchTable(can_rxMessages, can_rxLength, &testDispatchTable));
+
+    /* both searches find the same number of handlers */
+    uint8_t entry = 0u;
+    for (uint16_t i = 0u; i < numberOfFrames; i++) {
+        TEST_ASSERT_EQUAL(
+            TEST_CAN_LinearSearch(testTraceIds[i]), CAN_FindRxHandlers(&testDispatchTable, testTraceIds[i], &entry));
+    }
+
+    /* the sums keep the compiler from removing the searches */
+    volatile uint32_t handlersLinear   = 0u;
+    volatile uint32_t handlersDispatch = 0u;
+
+    clock_t start = clock();
+    for (uint32_t i = 0u; i < TEST_CAN_BENCHMARK_FRAMES; i++) {
+        handlersLinear += TEST_CAN_LinearSearch(testTraceIds[i % numberOfFrames]);
+    }
+    TEST_CAN_ReportThroughput("linear search", start, clock());
+
+    start = clock();
+    for (uint32_t i = 0u; i < TEST_CAN_BENCHMARK_FRAMES; i++) {
+        handlersDispatch += CAN_FindRxHandlers(&testDispatchTable, testTraceIds[i % numberOfFrames], &entry);
+    }
+    TEST_CAN_ReportThroughput("dispatch table", start, clock());
+
+    TEST_ASSERT_EQUAL(handlersLinear, handlersDispatch);
+}
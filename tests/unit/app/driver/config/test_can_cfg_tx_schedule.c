@@ -0,0 +1,101 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_can_cfg_tx_schedule.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Checks the TX schedule of the configured CAN messages
+ *
+ * @details The configured periodic TX messages are checked on the host, so
+ *          that phase collisions are found before the software is flashed.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+#include "MockHL_can.h"
+#include "Mockalgorithm.h"
+#include "Mockcan_codec.h"
+#include "Mockdatabase.h"
+#include "Mockdiag.h"
+#include "Mockfoxmath.h"
+#include "Mockio.h"
+#include "Mockmcu.h"
+#include "Mockmpu_prototypes.h"
+#include "Mockos.h"
+#include "Mocksys_mon.h"
+
+#include "can.h"
+#include "can_cfg.h"
+#include "database_cfg.h"
+
+#include "imd.h"
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+
+QueueHandle_t imd_canDataQueue = NULL_PTR;
+
+ALGO_TASKS_s algo_algorithms[1] = {0};
+const uint16_t algo_length      = sizeof(algo_algorithms) / sizeof(algo_algorithms[0]);
+
+static CAN_TX_SCHEDULE_s testSchedule = {0};
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testConfiguredTxMessagesFitSchedule(void) {
+    TEST_ASSERT_EQUAL(STD_OK, CAN_BuildTxSchedule(can_txMessages, can_txLength, &testSchedule));
+    TEST_ASSERT_LESS_OR_EQUAL(CAN_TX_MAXIMUM_BITS_PER_TICK, testSchedule.maximumBitsPerSlot);
+    for (uint16_t slot = 0u; slot < CAN_TX_SCHEDULE_TICKS; slot++) {
+        TEST_ASSERT_LESS_OR_EQUAL(
+            CAN_TX_MAXIMUM_MESSAGES_PER_TICK, testSchedule.slotStart[slot + 1u] - testSchedule.slotStart[slot]);
+    }
+}
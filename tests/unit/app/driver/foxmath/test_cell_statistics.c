@@ -0,0 +1,264 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_cell_statistics.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the statistics kernel for cell measurement values
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "cell_statistics.h"
+#include "test_assert_helper.h"
+
+#include <stdlib.h>
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of modules of the random comparison */
+#define TEST_CSTAT_NR_OF_MODULES (8u)
+
+/** number of random rounds that are compared with the reference */
+#define TEST_CSTAT_NR_OF_ROUNDS (500u)
+
+static int16_t testCstat_values[TEST_CSTAT_NR_OF_MODULES][CSTAT_MAXIMUM_NR_OF_VALUES];
+static uint64_t testCstat_invalid[TEST_CSTAT_NR_OF_MODULES];
+static uint32_t testCstat_randomState = 0u;
+
+/** simple linear congruential generator to get reproducible test data */
+static uint32_t TEST_CSTAT_GetRandom(void) {
+    testCstat_randomState = (testCstat_randomState * 1103515245u) + 12345u;
+    return testCstat_randomState >> 8u;
+}
+
+/** straightforward implementation of the statistics as reference */
+static void TEST_CSTAT_GetReference(uint8_t nrOfValues, CSTAT_STATISTICS_s *pStatistics) {
+    CSTAT_InitializeStatistics(pStatistics);
+    for (uint8_t m = 0u; m < TEST_CSTAT_NR_OF_MODULES; m++) {
+        for (uint8_t c = 0u; c < nrOfValues; c++) {
+            if ((testCstat_invalid[m] & (1ull << c)) == 0u) {
+                const int16_t value = testCstat_values[m][c];
+                pStatistics->sum += value;
+                pStatistics->nrOfValidValues++;
+                if (value < pStatistics->minimum) {
+                    pStatistics->minimum      = value;
+                    pStatistics->minimumIndex = (uint16_t)((m * nrOfValues) + c);
+                }
+                if (value > pStatistics->maximum) {
+                    pStatistics->maximum      = value;
+                    pStatistics->maximumIndex = (uint16_t)((m * nrOfValues) + c);
+                }
+            }
+        }
+    }
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    testCstat_randomState = 0x5EEDu;
+    for (uint8_t m = 0u; m < TEST_CSTAT_NR_OF_MODULES; m++) {
+        testCstat_invalid[m] = 0u;
+        for (uint8_t c = 0u; c < CSTAT_MAXIMUM_NR_OF_VALUES; c++) {
+            testCstat_values[m][c] = 0;
+        }
+    }
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testCSTAT_InvalidInput(void) {
+    CSTAT_STATISTICS_s statistics = {0};
+    TEST_ASSERT_FAIL_ASSERT(CSTAT_InitializeStatistics(NULL_PTR));
+    TEST_ASSERT_FAIL_ASSERT(CSTAT_AddValues(NULL_PTR, 1u, 0u, 0u, &statistics));
+    TEST_ASSERT_FAIL_ASSERT(CSTAT_AddValues(testCstat_values[0], 1u, 0u, 0u, NULL_PTR));
+    TEST_ASSERT_FAIL_ASSERT(CSTAT_AddValues(testCstat_values[0], 65u, 0u, 0u, &statistics));
+    TEST_ASSERT_FAIL_ASSERT(CSTAT_GetOutOfRangeValues(NULL_PTR, 1u, 0u, 0, 1));
+    TEST_ASSERT_FAIL_ASSERT(CSTAT_GetOutOfRangeValues(testCstat_values[0], 65u, 0u, 0, 1));
+    TEST_ASSERT_FAIL_ASSERT(CSTAT_GetOutOfRangeValues(testCstat_values[0], 1u, 0u, 1, 0));
+    TEST_ASSERT_FAIL_ASSERT(CSTAT_CountValidValues(65u, 0u));
+}
+
+void testCSTAT_NoValidValues(void) {
+    CSTAT_STATISTICS_s statistics = {0};
+    CSTAT_InitializeStatistics(&statistics);
+    CSTAT_AddValues(testCstat_values[0], 18u, 0x3FFFFu, 0u, &statistics);
+    CSTAT_AddValues(testCstat_values[1], 0u, 0u, 18u, &statistics);
+
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, statistics.minimum);
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, statistics.maximum);
+    TEST_ASSERT_EQUAL_UINT16(0u, statistics.minimumIndex);
+    TEST_ASSERT_EQUAL_UINT16(0u, statistics.maximumIndex);
+    TEST_ASSERT_EQUAL_INT32(0, statistics.sum);
+    TEST_ASSERT_EQUAL_UINT16(0u, statistics.nrOfValidValues);
+}
+
+void testCSTAT_FirstOccurrenceOfExtremaIsStored(void) {
+    const int16_t module0[5] = {3000, 3100, 2900, 3100, 2900};
+    const int16_t module1[4] = {2900, 3100, 3000, 3000};
+    CSTAT_STATISTICS_s statistics = {0};
+    CSTAT_InitializeStatistics(&statistics);
+    CSTAT_AddValues(module0, 5u, 0u, 0u, &statistics);
+    CSTAT_AddValues(module1, 4u, 0u, 5u, &statistics);
+
+    TEST_ASSERT_EQUAL_INT16(2900, statistics.minimum);
+    TEST_ASSERT_EQUAL_INT16(3100, statistics.maximum);
+    TEST_ASSERT_EQUAL_UINT16(2u, statistics.minimumIndex);
+    TEST_ASSERT_EQUAL_UINT16(1u, statistics.maximumIndex);
+    TEST_ASSERT_EQUAL_INT32(27000, statistics.sum);
+    TEST_ASSERT_EQUAL_UINT16(9u, statistics.nrOfValidValues);
+}
+
+void testCSTAT_ExtremeValues(void) {
+    const int16_t values[3] = {INT16_MIN, INT16_MAX, -1};
+    CSTAT_STATISTICS_s statistics = {0};
+    CSTAT_InitializeStatistics(&statistics);
+    CSTAT_AddValues(values, 3u, 0u, 10u, &statistics);
+
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, statistics.minimum);
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, statistics.maximum);
+    TEST_ASSERT_EQUAL_UINT16(10u, statistics.minimumIndex);
+    TEST_ASSERT_EQUAL_UINT16(11u, statistics.maximumIndex);
+    TEST_ASSERT_EQUAL_INT32(-2, statistics.sum);
+}
+
+void testCSTAT_InvalidValuesAreSkipped(void) {
+    const int16_t values[6] = {100, -500, 200, 900, 300, 50};
+    CSTAT_STATISTICS_s statistics = {0};
+    CSTAT_InitializeStatistics(&statistics);
+    /* values 1 and 3 are invalid, bits above the number of values are ignored */
+    CSTAT_AddValues(values, 6u, 0xFF0Au, 0u, &statistics);
+
+    TEST_ASSERT_EQUAL_INT16(50, statistics.minimum);
+    TEST_ASSERT_EQUAL_INT16(300, statistics.maximum);
+    TEST_ASSERT_EQUAL_UINT16(5u, statistics.minimumIndex);
+    TEST_ASSERT_EQUAL_UINT16(4u, statistics.maximumIndex);
+    TEST_ASSERT_EQUAL_INT32(650, statistics.sum);
+    TEST_ASSERT_EQUAL_UINT16(4u, statistics.nrOfValidValues);
+}
+
+void testCSTAT_GetOutOfRangeValues(void) {
+    const int16_t values[7] = {-1, 0, 4999, 5000, 5001, INT16_MIN, INT16_MAX};
+    /* range is inclusive */
+    TEST_ASSERT_EQUAL_UINT64(0x71u, CSTAT_GetOutOfRangeValues(values, 7u, 0u, 0, 5000));
+    /* invalid values are not reported */
+    TEST_ASSERT_EQUAL_UINT64(0x60u, CSTAT_GetOutOfRangeValues(values, 7u, 0x11u, 0, 5000));
+    /* limits outside of int16_t are compared as 32-bit values */
+    TEST_ASSERT_EQUAL_UINT64(0x0u, CSTAT_GetOutOfRangeValues(values, 7u, 0u, -100000, 100000));
+    TEST_ASSERT_EQUAL_UINT64(0x7Fu, CSTAT_GetOutOfRangeValues(values, 7u, 0u, 40000, 50000));
+    /* all 64 values of a mask are supported */
+    TEST_ASSERT_EQUAL_UINT64(0u, CSTAT_GetOutOfRangeValues(testCstat_values[0], 64u, 0u, 0, 0));
+    testCstat_values[0][63] = 1;
+    TEST_ASSERT_EQUAL_UINT64(1ull << 63u, CSTAT_GetOutOfRangeValues(testCstat_values[0], 64u, 0u, 0, 0));
+}
+
+void testCSTAT_CountValidValues(void) {
+    TEST_ASSERT_EQUAL_UINT8(0u, CSTAT_CountValidValues(0u, 0u));
+    TEST_ASSERT_EQUAL_UINT8(18u, CSTAT_CountValidValues(18u, 0u));
+    TEST_ASSERT_EQUAL_UINT8(15u, CSTAT_CountValidValues(18u, 0xFFFC0007u));
+    TEST_ASSERT_EQUAL_UINT8(64u, CSTAT_CountValidValues(64u, 0u));
+    TEST_ASSERT_EQUAL_UINT8(0u, CSTAT_CountValidValues(64u, UINT64_MAX));
+}
+
+void testCSTAT_RandomValuesMatchReference(void) {
+    for (uint16_t round = 0u; round < TEST_CSTAT_NR_OF_ROUNDS; round++) {
+        /* vary the number of values per module, including odd numbers and full masks */
+        const uint8_t nrOfValues = (uint8_t)(1u + (TEST_CSTAT_GetRandom() % CSTAT_MAXIMUM_NR_OF_VALUES));
+        /* a small value range provokes ties of the minimum and maximum */
+        const int32_t valueRange = ((round % 2u) == 0u) ? 16 : 65536;
+        for (uint8_t m = 0u; m < TEST_CSTAT_NR_OF_MODULES; m++) {
+            for (uint8_t c = 0u; c < nrOfValues; c++) {
+                testCstat_values[m][c] = (int16_t)((int32_t)(TEST_CSTAT_GetRandom() % (uint32_t)valueRange) -
+                                                   (valueRange / 2));
+            }
+            /* every other module has all values valid */
+            testCstat_invalid[m] = 0u;
+            if ((TEST_CSTAT_GetRandom() % 2u) == 0u) {
+                testCstat_invalid[m] = ((uint64_t)TEST_CSTAT_GetRandom() << 32u) | TEST_CSTAT_GetRandom();
+                testCstat_invalid[m] &= ((uint64_t)TEST_CSTAT_GetRandom() << 32u) | TEST_CSTAT_GetRandom();
+            }
+        }
+
+        CSTAT_STATISTICS_s expected = {0};
+        CSTAT_STATISTICS_s actual   = {0};
+        TEST_CSTAT_GetReference(nrOfValues, &expected);
+        CSTAT_InitializeStatistics(&actual);
+        for (uint8_t m = 0u; m < TEST_CSTAT_NR_OF_MODULES; m++) {
+            CSTAT_AddValues(
+                testCstat_values[m], nrOfValues, testCstat_invalid[m], (uint16_t)(m * nrOfValues), &actual);
+        }
+        TEST_ASSERT_EQUAL_INT16(expected.minimum, actual.minimum);
+        TEST_ASSERT_EQUAL_INT16(expected.maximum, actual.maximum);
+        TEST_ASSERT_EQUAL_UINT16(expected.minimumIndex, actual.minimumIndex);
+        TEST_ASSERT_EQUAL_UINT16(expected.maximumIndex, actual.maximumIndex);
+        TEST_ASSERT_EQUAL_INT32(expected.sum, actual.sum);
+        TEST_ASSERT_EQUAL_UINT16(expected.nrOfValidValues, actual.nrOfValidValues);
+
+        /* compare the range check with the check of the plausibility module */
+        const int16_t average = (int16_t)(valueRange / 8);
+        const int16_t tolerance = (int16_t)(valueRange / 4);
+        for (uint8_t m = 0u; m < TEST_CSTAT_NR_OF_MODULES; m++) {
+            uint64_t expectedOutOfRange = 0u;
+            for (uint8_t c = 0u; c < nrOfValues; c++) {
+                if (((testCstat_invalid[m] & (1ull << c)) == 0u) &&
+                    (abs(testCstat_values[m][c] - average) > tolerance)) {
+                    expectedOutOfRange |= (1ull << c);
+                }
+            }
+            TEST_ASSERT_EQUAL_UINT64(
+                expectedOutOfRange,
+                CSTAT_GetOutOfRangeValues(
+                    testCstat_values[m],
+                    nrOfValues,
+                    testCstat_invalid[m],
+                    (int32_t)average - tolerance,
+                    (int32_t)average + tolerance));
+        }
+    }
+}
@@ -54,8 +54,10 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 #include "MockHL_spi.h"
+#include "Mockfram_journal.h"
 #include "Mockio.h"
 #include "Mockmcu.h"
+#include "Mockos.h"
 #include "Mockspi.h"
 
 #include "fram_cfg.h"
@@ -68,6 +70,19 @@
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    IO_PinSet_Ignore();
+    IO_PinReset_Ignore();
+    MCU_delay_us_Ignore();
+    SPI_DirectlyTransmitReceiveData_IgnoreAndReturn(STD_OK);
+    SPI_Unlock_Ignore();
+
+    fram_soc = (FRAM_SOC_s){0};
+    FRAM_JOURNAL_Initialize_ExpectAndReturn(0u);
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_Scan_Ignore();
+    FRAM_Initialize();
 }
 
 void tearDown(void) {
@@ -75,5 +90,137 @@ void tearDown(void) {
 
 /*========== Test Cases =====================================================*/
 
-void testDummy(void) {
+/** repeated requests are written with one transfer */
+void testRequestWriteCoalescesRequests(void) {
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    TEST_ASSERT_TRUE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOC));
+
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(false);
+    FRAM_JOURNAL_EncodeRecord_ExpectAndReturn(FRAM_BLOCK_ID_SOC, NULL_PTR, NULL_PTR, NULL_PTR, 20u);
+    FRAM_JOURNAL_EncodeRecord_IgnoreArg_pData();
+    FRAM_JOURNAL_EncodeRecord_IgnoreArg_pRecord();
+    FRAM_JOURNAL_EncodeRecord_IgnoreArg_pAddress();
+    SPI_TransmitReceiveDataDmaLocked_ExpectAndReturn(&spi_framInterface, NULL_PTR, NULL_PTR, 4u + 20u, STD_OK);
+    SPI_TransmitReceiveDataDmaLocked_IgnoreArg_pTxBuff();
+    SPI_TransmitReceiveDataDmaLocked_IgnoreArg_pRxBuff();
+    FRAM_JOURNAL_CommitRecord_Expect(FRAM_BLOCK_ID_SOC);
+    FRAM_ProcessWriteRequests();
+    TEST_ASSERT_FALSE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOC));
+
+    /* nothing left to write */
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(false);
+    FRAM_ProcessWriteRequests();
+}
+
+/** unchanged data is not written again, a due index is written first */
+void testProcessWriteRequestsSkipsUnchangedData(void) {
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(false);
+    FRAM_JOURNAL_EncodeRecord_IgnoreAndReturn(20u);
+    SPI_TransmitReceiveDataDmaLocked_IgnoreAndReturn(STD_OK);
+    FRAM_JOURNAL_CommitRecord_Expect(FRAM_BLOCK_ID_SOC);
+    FRAM_ProcessWriteRequests();
+
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(true);
+    FRAM_JOURNAL_EncodeIndex_IgnoreAndReturn(31u);
+    FRAM_JOURNAL_CommitIndex_Expect();
+    FRAM_ProcessWriteRequests();
+    TEST_ASSERT_TRUE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOC));
+
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(false);
+    FRAM_ProcessWriteRequests();
+    TEST_ASSERT_FALSE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOC));
+}
+
+/** the interface stays locked from the write enable command until the
+ *  transfer has been started, the DMA callback unlocks it */
+void testProcessWriteRequestsHoldsLockUntilTransferIsStarted(void) {
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOC);
+    SPI_Unlock_StopIgnore();
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(false);
+    FRAM_JOURNAL_EncodeRecord_IgnoreAndReturn(20u);
+    SPI_TransmitReceiveDataDmaLocked_IgnoreAndReturn(STD_OK);
+    FRAM_JOURNAL_CommitRecord_Expect(FRAM_BLOCK_ID_SOC);
+    FRAM_ProcessWriteRequests();
+    TEST_ASSERT_FALSE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOC));
+}
+
+/** a block is requested again if its transfer could not be started, the
+ *  record is not committed and the unchanged data is written again */
+void testProcessWriteRequestsRetriesFailedTransfer(void) {
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOE);
+    SPI_Unlock_StopIgnore();
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(false);
+    FRAM_JOURNAL_EncodeRecord_IgnoreAndReturn(20u);
+    SPI_TransmitReceiveDataDmaLocked_ExpectAndReturn(&spi_framInterface, NULL_PTR, NULL_PTR, 4u + 20u, STD_NOT_OK);
+    SPI_TransmitReceiveDataDmaLocked_IgnoreArg_pTxBuff();
+    SPI_TransmitReceiveDataDmaLocked_IgnoreArg_pRxBuff();
+    SPI_Unlock_Expect(SPI_Interface3);
+    FRAM_ProcessWriteRequests();
+    TEST_ASSERT_TRUE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOE));
+
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(false);
+    SPI_TransmitReceiveDataDmaLocked_ExpectAndReturn(&spi_framInterface, NULL_PTR, NULL_PTR, 4u + 20u, STD_OK);
+    SPI_TransmitReceiveDataDmaLocked_IgnoreArg_pTxBuff();
+    SPI_TransmitReceiveDataDmaLocked_IgnoreArg_pRxBuff();
+    FRAM_JOURNAL_CommitRecord_Expect(FRAM_BLOCK_ID_SOE);
+    FRAM_ProcessWriteRequests();
+    TEST_ASSERT_FALSE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOE));
+}
+
+/** a due index is not committed if its transfer could not be started */
+void testProcessWriteRequestsDoesNotCommitIndexOfFailedTransfer(void) {
+    SPI_Unlock_StopIgnore();
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(true);
+    FRAM_JOURNAL_EncodeIndex_IgnoreAndReturn(31u);
+    SPI_TransmitReceiveDataDmaLocked_IgnoreAndReturn(STD_NOT_OK);
+    SPI_Unlock_Expect(SPI_Interface3);
+    FRAM_ProcessWriteRequests();
+
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(true);
+    SPI_TransmitReceiveDataDmaLocked_IgnoreAndReturn(STD_OK);
+    FRAM_JOURNAL_CommitIndex_Expect();
+    FRAM_ProcessWriteRequests();
+}
+
+/** a request stays pending while the interface is in use */
+void testProcessWriteRequestsWaitsForInterface(void) {
+    FRAM_RequestWrite(FRAM_BLOCK_ID_SOE);
+
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_NOT_OK);
+    FRAM_ProcessWriteRequests();
+    TEST_ASSERT_TRUE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOE));
+
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_NOT_OK);
+    TEST_ASSERT_EQUAL(STD_NOT_OK, FRAM_Flush());
+    TEST_ASSERT_TRUE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOE));
+
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_EncodeRecord_IgnoreAndReturn(20u);
+    FRAM_JOURNAL_CommitRecord_Expect(FRAM_BLOCK_ID_SOE);
+    FRAM_JOURNAL_IsIndexUpdateDue_ExpectAndReturn(false);
+    TEST_ASSERT_EQUAL(STD_OK, FRAM_Flush());
+    TEST_ASSERT_FALSE(FRAM_IsWritePending(FRAM_BLOCK_ID_SOE));
+}
+
+/** without a valid record the variable keeps its value */
+void testReadWithoutRecordKeepsDefault(void) {
+    fram_soc.averageSoc_perc[0] = 50.0f;
+    SPI_Lock_ExpectAndReturn(SPI_Interface3, STD_OK);
+    FRAM_JOURNAL_ReadLatest_ExpectAndReturn(FRAM_BLOCK_ID_SOC, NULL_PTR, (uint8_t *)&fram_soc, STD_NOT_OK);
+    FRAM_JOURNAL_ReadLatest_IgnoreArg_readFunction();
+    TEST_ASSERT_EQUAL(STD_NOT_OK, FRAM_Read(FRAM_BLOCK_ID_SOC));
+    TEST_ASSERT_EQUAL_FLOAT(50.0f, fram_soc.averageSoc_perc[0]);
 }
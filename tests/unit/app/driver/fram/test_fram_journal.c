@@ -0,0 +1,297 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_fram_journal.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Tests for the record journal of the FRAM blocks
+ *
+ * @details The FRAM is simulated by a temporary file. A power loss is
+ *          simulated by a write that stops after a number of bytes, followed
+ *          by a restart, i.e., a new initialization and scan of the journal.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "fram_cfg.h"
+
+#include "fram_journal.h"
+#include "test_assert_helper.h"
+
+#include <stdio.h>
+#include <string.h>
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of simulated power losses of the fuzz test */
+#define TEST_FRAM_NUMBER_OF_POWER_CUTS (2000u)
+
+/** file that simulates the FRAM */
+static FILE *testFram_file = NULL;
+
+/** number of bytes that the journal has read from the simulated FRAM */
+static uint32_t testFram_bytesRead = 0u;
+
+/** number of bytes that can be written until the simulated power loss */
+static uint32_t testFram_writeBudget = UINT32_MAX;
+
+/** state of the pseudo random number generator of the fuzz test */
+static uint32_t testFram_random = 0x12345678u;
+
+static uint32_t TEST_FramNextRandom(void) {
+    /* 32 bit xorshift */
+    testFram_random ^= testFram_random << 13u;
+    testFram_random ^= testFram_random >> 17u;
+    testFram_random ^= testFram_random << 5u;
+    return testFram_random;
+}
+
+static void TEST_FramFileRead(uint32_t address, uint8_t *pData, uint16_t size) {
+    TEST_ASSERT_EQUAL(0, fseek(testFram_file, (long)address, SEEK_SET));
+    TEST_ASSERT_EQUAL(size, fread(pData, 1u, size, testFram_file));
+    testFram_bytesRead += size;
+}
+
+static bool TEST_FramFileWrite(uint32_t address, const uint8_t *pData, uint16_t size) {
+    const uint32_t written = (size < testFram_writeBudget) ? size : testFram_writeBudget;
+    TEST_ASSERT_EQUAL(0, fseek(testFram_file, (long)address, SEEK_SET));
+    TEST_ASSERT_EQUAL(written, fwrite(pData, 1u, written, testFram_file));
+    TEST_ASSERT_EQUAL(0, fflush(testFram_file));
+    testFram_writeBudget -= written;
+    return (written == size);
+}
+
+/** writes a block like the FRAM driver, returns false on a power loss */
+static bool TEST_FramWriteBlock(FRAM_BLOCK_ID_e blockId, const void *pData) {
+    uint8_t buffer[FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH] = {0};
+    uint32_t address                                    = 0u;
+
+    uint16_t length = FRAM_JOURNAL_EncodeRecord(blockId, (const uint8_t *)pData, buffer, &address);
+    bool isComplete = TEST_FramFileWrite(address, buffer, length);
+    if (isComplete == true) {
+        FRAM_JOURNAL_CommitRecord(blockId);
+        if (FRAM_JOURNAL_IsIndexUpdateDue() == true) {
+            length     = FRAM_JOURNAL_EncodeIndex(buffer, &address);
+            isComplete = TEST_FramFileWrite(address, buffer, length);
+            if (isComplete == true) {
+                FRAM_JOURNAL_CommitIndex();
+            }
+        }
+    }
+    return isComplete;
+}
+
+/** simulates a restart, returns the number of bytes read by the scan */
+static uint32_t TEST_FramRestart(void) {
+    testFram_writeBudget = UINT32_MAX;
+    (void)FRAM_JOURNAL_Initialize();
+    testFram_bytesRead = 0u;
+    FRAM_JOURNAL_Scan(&TEST_FramFileRead);
+    return testFram_bytesRead;
+}
+
+static void TEST_FramOverwrite(uint32_t address, uint8_t value, uint32_t size) {
+    TEST_ASSERT_EQUAL(0, fseek(testFram_file, (long)address, SEEK_SET));
+    for (uint32_t i = 0u; i < size; i++) {
+        TEST_ASSERT_EQUAL(value, fputc(value, testFram_file));
+    }
+    TEST_ASSERT_EQUAL(0, fflush(testFram_file));
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    testFram_file = tmpfile();
+    TEST_ASSERT_NOT_NULL(testFram_file);
+    /* a new FRAM is erased */
+    TEST_FramOverwrite(0u, 0u, FRAM_JOURNAL_Initialize());
+    testFram_random = 0x12345678u;
+    (void)TEST_FramRestart();
+}
+
+void tearDown(void) {
+    (void)fclose(testFram_file);
+    testFram_file = NULL;
+}
+
+/*========== Test Cases =====================================================*/
+
+void testCrcOfCheckSequence(void) {
+    /* CRC-16/CCITT-FALSE check value */
+    const uint8_t sequence[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    TEST_ASSERT_EQUAL_HEX16(0x29B1u, TEST_FRAM_JOURNAL_CalculateCrc(sequence, 9u));
+}
+
+void testEmptyFramHasNoRecords(void) {
+    FRAM_SOC_s soc = {.averageSoc_perc = {42.0f}};
+    TEST_ASSERT_EQUAL(STD_NOT_OK, FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc));
+    TEST_ASSERT_EQUAL_FLOAT(42.0f, soc.averageSoc_perc[0]);
+    TEST_ASSERT_TRUE(FRAM_JOURNAL_IsIndexUpdateDue());
+}
+
+void testNewestRecordIsFoundAfterRestart(void) {
+    FRAM_SOC_s soc = {0};
+    for (uint16_t i = 1u; i <= 20u; i++) {
+        soc.averageSoc_perc[0] = (float)i;
+        TEST_ASSERT_TRUE(TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc));
+    }
+
+    (void)TEST_FramRestart();
+    soc = (FRAM_SOC_s){0};
+    TEST_ASSERT_EQUAL(STD_OK, FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc));
+    TEST_ASSERT_EQUAL_FLOAT(20.0f, soc.averageSoc_perc[0]);
+
+    /* the journal continues after the restart */
+    soc.averageSoc_perc[0] = 21.0f;
+    TEST_ASSERT_TRUE(TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc));
+    (void)TEST_FramRestart();
+    soc = (FRAM_SOC_s){0};
+    TEST_ASSERT_EQUAL(STD_OK, FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc));
+    TEST_ASSERT_EQUAL_FLOAT(21.0f, soc.averageSoc_perc[0]);
+
+    /* other blocks are not affected */
+    FRAM_SOE_s soe = {0};
+    TEST_ASSERT_EQUAL(STD_NOT_OK, FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOE, &TEST_FramFileRead, (uint8_t *)&soe));
+}
+
+void testFailedWriteIsNotCommitted(void) {
+    uint8_t buffer[FRAM_JOURNAL_MAXIMUM_RECORD_LENGTH] = {0};
+    uint32_t failedAddress                              = 0u;
+    uint32_t address                                    = 0u;
+    FRAM_SOC_s soc                                      = {.averageSoc_perc = {1.0f}};
+    TEST_ASSERT_TRUE(TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc));
+
+    /* the transfer of the next record is not started, the driver does not
+       commit it and the FRAM keeps the previous record */
+    soc.averageSoc_perc[0] = 2.0f;
+    (void)FRAM_JOURNAL_EncodeRecord(FRAM_BLOCK_ID_SOC, (const uint8_t *)&soc, buffer, &failedAddress);
+    (void)TEST_FramRestart();
+    soc = (FRAM_SOC_s){0};
+    TEST_ASSERT_EQUAL(STD_OK, FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc));
+    TEST_ASSERT_EQUAL_FLOAT(1.0f, soc.averageSoc_perc[0]);
+
+    /* the repeated write uses the slot of the failed one */
+    soc.averageSoc_perc[0] = 3.0f;
+    (void)FRAM_JOURNAL_EncodeRecord(FRAM_BLOCK_ID_SOC, (const uint8_t *)&soc, buffer, &address);
+    TEST_ASSERT_EQUAL_UINT32(failedAddress, address);
+    TEST_ASSERT_TRUE(TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc));
+    (void)TEST_FramRestart();
+    soc = (FRAM_SOC_s){0};
+    TEST_ASSERT_EQUAL(STD_OK, FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc));
+    TEST_ASSERT_EQUAL_FLOAT(3.0f, soc.averageSoc_perc[0]);
+}
+
+void testIndexAvoidsReadingAllSlots(void) {
+    FRAM_SOC_s soc = {0};
+    FRAM_SOE_s soe = {0};
+    for (uint16_t i = 1u; i <= 30u; i++) {
+        soc.averageSoc_perc[0] = (float)i;
+        soe.averageSoe_perc[0] = (float)i;
+        TEST_ASSERT_TRUE(TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc));
+        TEST_ASSERT_TRUE(TEST_FramWriteBlock(FRAM_BLOCK_ID_SOE, &soe));
+    }
+    /* the first restart scans the blocks without records once */
+    (void)TEST_FramRestart();
+    TEST_ASSERT_TRUE(TEST_FramWriteBlock(FRAM_BLOCK_ID_SOC, &soc));
+    const uint32_t bytesReadWithIndex = TEST_FramRestart();
+
+    /* destroy both index copies */
+    TEST_FramOverwrite(0u, 0xFFu, 2u * FRAM_JOURNAL_INDEX_LENGTH);
+    const uint32_t bytesReadWithoutIndex = TEST_FramRestart();
+    TEST_ASSERT_LESS_THAN_UINT32(bytesReadWithoutIndex / 2u, bytesReadWithIndex);
+
+    soc = (FRAM_SOC_s){0};
+    TEST_ASSERT_EQUAL(STD_OK, FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOC, &TEST_FramFileRead, (uint8_t *)&soc));
+    TEST_ASSERT_EQUAL_FLOAT(30.0f, soc.averageSoc_perc[0]);
+    TEST_ASSERT_EQUAL(STD_OK, FRAM_JOURNAL_ReadLatest(FRAM_BLOCK_ID_SOE, &TEST_FramFileRead, (uint8_t *)&soe));
+    TEST_ASSERT_EQUAL_FLOAT(30.0f, soe.averageSoe_perc[0]);
+}
+
+void testPowerCutsNeverLoseTheLastCompleteRecord(void) {
+    float lastValue[FRAM_BLOCK_MAX] = {0.0f};
+    bool isStored[FRAM_BLOCK_MAX]   = {false};
+    FRAM_SOC_s data                 = {0};
+    const uint16_t recordLength     = FRAM_JOURNAL_RECORD_HEADER_LENGTH + sizeof(FRAM_SOC_s) + FRAM_JOURNAL_CRC_LENGTH;
+
+    for (uint32_t cut = 0u; cut < TEST_FRAM_NUMBER_OF_POWER_CUTS; cut++) {
+        /* SOC and SOE have the same layout */
+        const FRAM_BLOCK_ID_e blockId = ((TEST_FramNextRandom() & 1u) == 0u) ? FRAM_BLOCK_ID_SOC : FRAM_BLOCK_ID_SOE;
+        const uint32_t writes         = TEST_FramNextRandom() % 6u;
+
+        /* some complete writes, then a write that is cut anywhere in the
+           record or in a following index update */
+        for (uint32_t i = 0u; i <= writes; i++) {
+            const float value       = (float)((cut * 8u) + i + 1u);
+            data.averageSoc_perc[0] = value;
+            data.minimumSoc_perc[1] = -value;
+            if (i == writes) {
+                testFram_writeBudget = TEST_FramNextRandom() % (recordLength + FRAM_JOURNAL_INDEX_LENGTH);
+            }
+            const bool isRecordComplete = (testFram_writeBudget >= recordLength);
+            (void)TEST_FramWriteBlock(blockId, &data);
+            if (isRecordComplete == true) {
+                lastValue[blockId] = value;
+                isStored[blockId]  = true;
+            }
+        }
+
+        (void)TEST_FramRestart();
+        for (uint8_t b = 0u; b < (uint8_t)FRAM_BLOCK_MAX; b++) {
+            if ((b == (uint8_t)FRAM_BLOCK_ID_SOC) || (b == (uint8_t)FRAM_BLOCK_ID_SOE)) {
+                data = (FRAM_SOC_s){0};
+                if (isStored[b] == true) {
+                    TEST_ASSERT_EQUAL(
+                        STD_OK, FRAM_JOURNAL_ReadLatest((FRAM_BLOCK_ID_e)b, &TEST_FramFileRead, (uint8_t *)&data));
+                    TEST_ASSERT_EQUAL_FLOAT(lastValue[b], data.averageSoc_perc[0]);
+                    TEST_ASSERT_EQUAL_FLOAT(-lastValue[b], data.minimumSoc_perc[1]);
+                } else {
+                    TEST_ASSERT_EQUAL(
+                        STD_NOT_OK, FRAM_JOURNAL_ReadLatest((FRAM_BLOCK_ID_e)b, &TEST_FramFileRead, (uint8_t *)&data));
+                }
+            }
+        }
+    }
+}
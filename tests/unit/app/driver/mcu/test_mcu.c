@@ -54,6 +54,10 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 
+#include "MockHL_sys_pmu.h"
+
+#include "HL_system.h"
+
 #include "mcu.h"
 
 /*========== Definitions and Implementations for Unit Test ==================*/
@@ -70,3 +74,45 @@ void tearDown(void) {
 void testMCU_delay_us(void) {
     MCU_delay_us(1);
 }
+
+void testMCU_GetFreeRunningCount(void) {
+    MCU_RTI_CNT0_FRC0_REG = 0x12345678u;
+    TEST_ASSERT_EQUAL_HEX32(0x12345678u, MCU_GetFreeRunningCount());
+}
+
+void testMCU_ConvertFrcDifferenceToTimespan_us(void) {
+    /* FRC0 is clocked with AVCLK1 / (CPUC0 + 1) */
+    const uint32_t countsPerMicrosecond = (uint32_t)(AVCLK1_FREQ / 2.0f);
+    TEST_ASSERT_EQUAL_UINT32(0u, MCU_ConvertFrcDifferenceToTimespan_us(0u));
+    TEST_ASSERT_EQUAL_UINT32(0u, MCU_ConvertFrcDifferenceToTimespan_us(countsPerMicrosecond - 1u));
+    TEST_ASSERT_EQUAL_UINT32(4300u, MCU_ConvertFrcDifferenceToTimespan_us(4300u * countsPerMicrosecond));
+
+    /* differences are computed with unsigned arithmetic across a wrap around */
+    const uint32_t start = UINT32_MAX - countsPerMicrosecond + 1u;
+    const uint32_t stop  = countsPerMicrosecond;
+    TEST_ASSERT_EQUAL_UINT32(2u, MCU_ConvertFrcDifferenceToTimespan_us(stop - start));
+}
+
+void testMCU_InitializeCycleCounter(void) {
+    _pmuInit__Expect();
+    _pmuEnableCountersGlobal__Expect();
+    _pmuResetCycleCounter__Expect();
+    _pmuStartCounters__Expect(pmuCYCLE_COUNTER);
+    MCU_InitializeCycleCounter();
+}
+
+void testMCU_GetCycleCount(void) {
+    _pmuGetCycleCount__ExpectAndReturn(0xCAFEu);
+    TEST_ASSERT_EQUAL_HEX32(0xCAFEu, MCU_GetCycleCount());
+}
+
+void testMCU_ConvertCycleDifferenceToTimespan_us(void) {
+    /* the cycle counter is clocked with GCLK */
+    const uint32_t cyclesPerMicrosecond = (uint32_t)GCLK_FREQ;
+    TEST_ASSERT_EQUAL_UINT32(0u, MCU_ConvertCycleDifferenceToTimespan_us(cyclesPerMicrosecond - 1u));
+    TEST_ASSERT_EQUAL_UINT32(1000u, MCU_ConvertCycleDifferenceToTimespan_us(1000u * cyclesPerMicrosecond));
+
+    const uint32_t start = UINT32_MAX - cyclesPerMicrosecond + 1u;
+    const uint32_t stop  = 9u * cyclesPerMicrosecond;
+    TEST_ASSERT_EQUAL_UINT32(10u, MCU_ConvertCycleDifferenceToTimespan_us(stop - start));
+}
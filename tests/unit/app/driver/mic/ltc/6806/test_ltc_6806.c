@@ -66,6 +66,7 @@
 
 #include "ltc_6806_cfg.h"
 
+#include "cell_statistics.h"
 #include "ltc.h"
 
 TEST_FILE("ltc_6806.c")
@@ -67,6 +67,7 @@
 
 #include "ltc_6813-1_cfg.h"
 
+#include "cell_statistics.h"
 #include "ltc.h"
 
 TEST_FILE("ltc_6813-1.c")
@@ -144,3 +145,62 @@ void testLTC_Convert_MuxVoltages_to_Temperatures() {
     x = LTC_Convert_MuxVoltages_to_Temperatures(11);
     TEST_ASSERT_EQUAL_INT16(11, x);
 }
+
+void testLTC_StartTransactionListSendsFirstReadCommand(void) {
+    static LTC_STATE_s test_ltc_state                           = {0};
+    static uint16_t txBuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {0};
+    static uint16_t rxBuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {0};
+    static uint16_t command[4]                                  = {0x00u, 0x04u, 0x07u, 0xC2u};
+    uint16_t *commands[2]                                       = {command, command};
+    test_ltc_state.spiSeqPtr                                    = spi_ltcInterface;
+    test_ltc_state.ltcData.txBuffer                             = txBuffer;
+    test_ltc_state.ltcData.frameLength                          = LTC_N_BYTES_FOR_DATA_TRANSMISSION;
+
+    /* list content as queued by MIC_QueueTransaction */
+    test_ltc_state.transactionList.pSpiInterface             = spi_ltcInterface;
+    test_ltc_state.transactionList.pTxBuffer                 = txBuffer;
+    test_ltc_state.transactionList.frameLength               = LTC_N_BYTES_FOR_DATA_TRANSMISSION;
+    test_ltc_state.transactionList.transactions[0].pCommand  = command;
+    test_ltc_state.transactionList.transactions[0].pRxBuffer = rxBuffer;
+
+    MIC_ClearTransactionList_Expect(
+        &test_ltc_state.transactionList, spi_ltcInterface, txBuffer, LTC_N_BYTES_FOR_DATA_TRANSMISSION);
+    MIC_QueueTransaction_ExpectAndReturn(&test_ltc_state.transactionList, command, NULL_PTR, 0u, STD_OK);
+    MIC_QueueTransaction_IgnoreArg_pRxBuffer();
+    MIC_QueueTransaction_ExpectAndReturn(&test_ltc_state.transactionList, command, NULL_PTR, 1u, STD_OK);
+    MIC_QueueTransaction_IgnoreArg_pRxBuffer();
+    MIC_SetTransmitOngoing_Expect(&test_ltc_state);
+    SPI_TransmitReceiveDataWithDummyDma_ExpectAndReturn(
+        spi_ltcInterface,
+        LTC_SPI_WAKEUP_WAIT_TIME_US,
+        LTC_SPI_WAKEUP_VALIDITY_US,
+        txBuffer,
+        rxBuffer,
+        LTC_N_BYTES_FOR_DATA_TRANSMISSION,
+        STD_OK);
+
+    TEST_ASSERT_EQUAL(STD_OK, TEST_LTC_StartTransactionList(&test_ltc_state, commands, 2u));
+    TEST_ASSERT_EQUAL_UINT8(1u, test_ltc_state.transactionList.next);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(command, txBuffer, 4u);
+}
+
+void testLTC_CheckTransactionListCompleted(void) {
+    static LTC_STATE_s test_ltc_state = {0};
+
+    /* all read commands completed */
+    test_ltc_state.transactionList.length    = 4u;
+    test_ltc_state.transactionList.next      = 4u;
+    test_ltc_state.transactionList.completed = 4u;
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_ASSERT_EQUAL(STD_OK, TEST_LTC_CheckTransactionListCompleted(&test_ltc_state));
+
+    /* list stopped after the second read command: the remaining ones are dropped */
+    test_ltc_state.transactionList.length    = 4u;
+    test_ltc_state.transactionList.next      = 2u;
+    test_ltc_state.transactionList.completed = 1u;
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_ASSERT_EQUAL(STD_NOT_OK, TEST_LTC_CheckTransactionListCompleted(&test_ltc_state));
+    TEST_ASSERT_EQUAL_UINT8(2u, test_ltc_state.transactionList.length);
+}
@@ -57,6 +57,7 @@
 #include "Mockfassert.h"
 #include "Mockio.h"
 #include "Mockltc.h"
+#include "Mockmcu.h"
 #include "Mockspi.h"
 
 #include "ltc_cfg.h"
@@ -153,8 +154,34 @@ g_dmaCTRL mic_ltcDmaControlPacketRx = {
     .AUTOINIT  = AUTOINIT_OFF,                      /* autoinit                   */
 };
 
+static uint16_t testTxBuffer[LTC_N_BYTES_FOR_DATA_TRANSMISSION]                                          = {0};
+static uint16_t testRxBuffer[LTC_TRANSACTION_LIST_MAXIMUM_LENGTH][LTC_N_BYTES_FOR_DATA_TRANSMISSION] = {{0}};
+static uint16_t testCommands[LTC_TRANSACTION_LIST_MAXIMUM_LENGTH][4]                                 = {
+    {0x00u, 0x04u, 0x07u, 0xC2u},
+    {0x00u, 0x06u, 0x9Au, 0x94u},
+    {0x00u, 0x08u, 0x5Eu, 0x52u},
+    {0x00u, 0x0Au, 0xC3u, 0x04u},
+    {0x00u, 0x09u, 0xD5u, 0x60u},
+    {0x00u, 0x0Bu, 0x48u, 0x36u},
+};
+
+/** queues the first nrOfCommands test commands and marks the first one as being transmitted */
+static void TEST_QueueTransactions(uint8_t nrOfCommands) {
+    MIC_ClearTransactionList(
+        &ltc_stateBase.transactionList, spi_ltcInterface, testTxBuffer, LTC_N_BYTES_FOR_DATA_TRANSMISSION);
+    for (uint8_t i = 0u; i < nrOfCommands; i++) {
+        TEST_ASSERT_EQUAL(
+            STD_OK, MIC_QueueTransaction(&ltc_stateBase.transactionList, testCommands[i], testRxBuffer[i], i));
+    }
+    ltc_stateBase.transactionList.next = 1u;
+    ltc_stateBase.transmit_ongoing     = true;
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    MIC_ClearTransactionList(
+        &ltc_stateBase.transactionList, spi_ltcInterface, testTxBuffer, LTC_N_BYTES_FOR_DATA_TRANSMISSION);
+    ltc_stateBase.transmit_ongoing = false;
 }
 
 void tearDown(void) {
@@ -164,3 +191,57 @@ void tearDown(void) {
 
 void testDummy(void) {
 }
+
+void testDmaCallbackEndsSingleTransfer(void) {
+    ltc_stateBase.transmit_ongoing = true;
+
+    MIC_DmaCallback(BTC, DMA_CH1);
+
+    TEST_ASSERT_FALSE(ltc_stateBase.transmit_ongoing);
+}
+
+void testDmaCallbackTransmitsTransactionListBackToBack(void) {
+    TEST_QueueTransactions(3u);
+
+    /* first read command completed: second one is started with its own receive buffer */
+    MCU_delay_us_Expect(LTC_TRANSACTION_CS_HIGH_TIME_US);
+    SPI_TransmitReceiveDataDmaFromIsr_ExpectAndReturn(
+        spi_ltcInterface, testTxBuffer, testRxBuffer[1], LTC_N_BYTES_FOR_DATA_TRANSMISSION, STD_OK);
+    MIC_DmaCallback(BTC, DMA_CH1);
+    TEST_ASSERT_TRUE(ltc_stateBase.transmit_ongoing);
+    TEST_ASSERT_EQUAL_UINT8(1u, ltc_stateBase.transactionList.completed);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(testCommands[1], testTxBuffer, 4u);
+
+    MCU_delay_us_Expect(LTC_TRANSACTION_CS_HIGH_TIME_US);
+    SPI_TransmitReceiveDataDmaFromIsr_ExpectAndReturn(
+        spi_ltcInterface, testTxBuffer, testRxBuffer[2], LTC_N_BYTES_FOR_DATA_TRANSMISSION, STD_OK);
+    MIC_DmaCallback(BTC, DMA_CH1);
+    TEST_ASSERT_TRUE(ltc_stateBase.transmit_ongoing);
+    TEST_ASSERT_EQUAL_HEX16_ARRAY(testCommands[2], testTxBuffer, 4u);
+
+    /* last read command completed: the transmission ends */
+    MIC_DmaCallback(BTC, DMA_CH1);
+    TEST_ASSERT_FALSE(ltc_stateBase.transmit_ongoing);
+    TEST_ASSERT_EQUAL_UINT8(3u, ltc_stateBase.transactionList.completed);
+}
+
+void testDmaCallbackEndsTransactionListIfInterfaceIsBusy(void) {
+    TEST_QueueTransactions(2u);
+
+    MCU_delay_us_Expect(LTC_TRANSACTION_CS_HIGH_TIME_US);
+    SPI_TransmitReceiveDataDmaFromIsr_ExpectAndReturn(
+        spi_ltcInterface, testTxBuffer, testRxBuffer[1], LTC_N_BYTES_FOR_DATA_TRANSMISSION, STD_NOT_OK);
+    MIC_DmaCallback(BTC, DMA_CH1);
+
+    TEST_ASSERT_FALSE(ltc_stateBase.transmit_ongoing);
+    TEST_ASSERT_EQUAL_UINT8(1u, ltc_stateBase.transactionList.completed);
+    TEST_ASSERT_EQUAL_UINT8(1u, ltc_stateBase.transactionList.next);
+}
+
+void testQueueTransactionRejectsFullList(void) {
+    TEST_QueueTransactions(LTC_TRANSACTION_LIST_MAXIMUM_LENGTH);
+
+    TEST_ASSERT_EQUAL(
+        STD_NOT_OK, MIC_QueueTransaction(&ltc_stateBase.transactionList, testCommands[0], testRxBuffer[0], 0u));
+    TEST_ASSERT_EQUAL_UINT8(LTC_TRANSACTION_LIST_MAXIMUM_LENGTH, ltc_stateBase.transactionList.length);
+}
@@ -0,0 +1,144 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_ltc_pec.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TEST
+ *
+ * @brief   Test of the batched PEC calculation for LTC daisy-chain frames
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "ltc_pec.h"
+#include "test_assert_helper.h"
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of devices in the test frame, more than one bitmask word */
+#define TEST_LTC_PEC_DEVICES (40u)
+
+/** number of SPI words of the test frame */
+#define TEST_LTC_PEC_FRAME_WORDS (LTC_PEC_FRAME_HEADER_WORDS + (TEST_LTC_PEC_DEVICES * LTC_PEC_WORDS_PER_DEVICE))
+
+static uint16_t testFrame[TEST_LTC_PEC_FRAME_WORDS] = {0u};
+
+/** reference PEC of one device calculated with the byte-wise implementation */
+static uint16_t TEST_ReferencePec(const uint16_t *pFrame, uint16_t device) {
+    uint8_t data[LTC_PEC_DATA_BYTES_PER_DEVICE] = {0u};
+    for (uint8_t i = 0u; i < LTC_PEC_DATA_BYTES_PER_DEVICE; i++) {
+        data[i] = (uint8_t)pFrame[LTC_PEC_FRAME_HEADER_WORDS + (device * LTC_PEC_WORDS_PER_DEVICE) + i];
+    }
+    return LTC_pec15_calc(LTC_PEC_DATA_BYTES_PER_DEVICE, data);
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+    /* fill the data bytes of all devices with a pseudo random pattern and clear the PECs */
+    uint8_t value = 0x5Au;
+    for (uint32_t i = 0u; i < TEST_LTC_PEC_FRAME_WORDS; i++) {
+        testFrame[i] = 0u;
+    }
+    for (uint16_t device = 0u; device < TEST_LTC_PEC_DEVICES; device++) {
+        for (uint8_t i = 0u; i < LTC_PEC_DATA_BYTES_PER_DEVICE; i++) {
+            value = (uint8_t)((value * 37u) + 11u);
+
+            testFrame[LTC_PEC_FRAME_HEADER_WORDS + (device * LTC_PEC_WORDS_PER_DEVICE) + i] = value;
+        }
+    }
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testLTC_SetFramePecsMatchesByteWiseCalculation(void) {
+    LTC_SetFramePecs(testFrame, TEST_LTC_PEC_DEVICES);
+    for (uint16_t device = 0u; device < TEST_LTC_PEC_DEVICES; device++) {
+        const uint32_t offset = LTC_PEC_FRAME_HEADER_WORDS + (device * LTC_PEC_WORDS_PER_DEVICE);
+        const uint16_t pec    = TEST_ReferencePec(testFrame, device);
+        TEST_ASSERT_EQUAL_UINT16((pec >> 8u) & 0xFFu, testFrame[offset + 6u]);
+        TEST_ASSERT_EQUAL_UINT16(pec & 0xFFu, testFrame[offset + 7u]);
+    }
+}
+
+void testLTC_CheckFramePecsAllValid(void) {
+    uint32_t validMask[LTC_PEC_VALID_MASK_WORDS(TEST_LTC_PEC_DEVICES)] = {0u};
+    LTC_SetFramePecs(testFrame, TEST_LTC_PEC_DEVICES);
+
+    TEST_ASSERT_TRUE(LTC_CheckFramePecs(testFrame, TEST_LTC_PEC_DEVICES, validMask));
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFFFFu, validMask[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x000000FFu, validMask[1]);
+}
+
+void testLTC_CheckFramePecsDetectsCorruptDevices(void) {
+    uint32_t validMask[LTC_PEC_VALID_MASK_WORDS(TEST_LTC_PEC_DEVICES)] = {0u};
+    LTC_SetFramePecs(testFrame, TEST_LTC_PEC_DEVICES);
+    /* corrupt a data byte of device 3 and the PEC of device 35 */
+    testFrame[LTC_PEC_FRAME_HEADER_WORDS + (3u * LTC_PEC_WORDS_PER_DEVICE) + 2u] ^= 0x01u;
+    testFrame[LTC_PEC_FRAME_HEADER_WORDS + (35u * LTC_PEC_WORDS_PER_DEVICE) + 7u] ^= 0x80u;
+
+    TEST_ASSERT_FALSE(LTC_CheckFramePecs(testFrame, TEST_LTC_PEC_DEVICES, validMask));
+    for (uint16_t device = 0u; device < TEST_LTC_PEC_DEVICES; device++) {
+        const bool expected = (device != 3u) && (device != 35u);
+        TEST_ASSERT_EQUAL(expected, LTC_PEC_IS_DEVICE_VALID(validMask, device));
+    }
+}
+
+void testLTC_CheckFramePecsClearsStaleBits(void) {
+    uint32_t validMask[LTC_PEC_VALID_MASK_WORDS(TEST_LTC_PEC_DEVICES)] = {0xFFFFFFFFu, 0xFFFFFFFFu};
+    /* PECs have not been set, so no device can be valid */
+    TEST_ASSERT_FALSE(LTC_CheckFramePecs(testFrame, TEST_LTC_PEC_DEVICES, validMask));
+    TEST_ASSERT_EQUAL_HEX32(0u, validMask[0]);
+    TEST_ASSERT_EQUAL_HEX32(0u, validMask[1]);
+}
+
+void testLTC_FramePecsInvalidInput(void) {
+    uint32_t validMask[LTC_PEC_VALID_MASK_WORDS(TEST_LTC_PEC_DEVICES)] = {0u};
+    TEST_ASSERT_FAIL_ASSERT(LTC_SetFramePecs(NULL_PTR, TEST_LTC_PEC_DEVICES));
+    TEST_ASSERT_FAIL_ASSERT(LTC_CheckFramePecs(NULL_PTR, TEST_LTC_PEC_DEVICES, validMask));
+    TEST_ASSERT_FAIL_ASSERT(LTC_CheckFramePecs(testFrame, TEST_LTC_PEC_DEVICES, NULL_PTR));
+}
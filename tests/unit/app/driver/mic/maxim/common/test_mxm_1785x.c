@@ -147,6 +147,22 @@ void testMXM_ParseVoltagesIntoDBNullPointer(void) {
     TEST_ASSERT_FAIL_ASSERT(TEST_MXM_ParseVoltagesIntoDB(NULL_PTR));
 }
 
+void testMXM_ParseVoltagesIntoDBDecodesIntoBackBuffer(void) {
+    static DATA_BLOCK_CELL_VOLTAGE_s backBuffer = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+    mxm_instance.localVoltages.cellVoltages[0]  = 3456u;
+    mxm_instance.localVoltages.blockVoltages[0] = 40000u;
+
+    /* the voltages are decoded into the back buffer and published without a copy */
+    DATA_GetBackBuffer_ExpectAndReturn(DATA_BLOCK_ID_CELL_VOLTAGE_BASE, (void *)&backBuffer);
+    TSI_GetTemperature_IgnoreAndReturn(250);
+    DATA_CommitBackBuffer_Expect(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+    DATA_Write_1_DataBlock_IgnoreAndReturn(STD_OK);
+    TEST_ASSERT_EQUAL(STD_OK, TEST_MXM_ParseVoltagesIntoDB(&mxm_instance));
+
+    TEST_ASSERT_EQUAL(3456u, backBuffer.cellVoltage_mV[0][0]);
+    TEST_ASSERT_EQUAL(40000u, backBuffer.moduleVoltage_mV[0][0]);
+}
+
 void testTEST_MXM_MonGetVoltagesNullPointer(void) {
     TEST_ASSERT_FAIL_ASSERT(TEST_MXM_MonGetVoltages(NULL_PTR, 0u));
 }
@@ -61,6 +61,7 @@
 #include "Mockspi.h"
 
 #include "n775.h"
+#include "n775_crc.h"
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 const spiDAT1_t spi_kNxp775DataConfig = {
@@ -0,0 +1,154 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_n775_crc.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  N775
+ *
+ * @brief   Test for the NXP MC33775A CRC16 implementation.
+ *
+ * @details The benchmark test compares the run time of the implementations
+ *          on the host. It only reports the times and does not fail on them.
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "n775_crc.h"
+#include "test_assert_helper.h"
+
+#include <stdio.h>
+#include <time.h>
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** number of items of the benchmark sequence, i.e., a large daisy chain */
+#define TEST_N775_BENCHMARK_ITEMS (1024u)
+
+/** number of repetitions of the benchmark */
+#define TEST_N775_BENCHMARK_REPETITIONS (2000u)
+
+/** function pointer type of the CRC implementations */
+typedef uint16_t (*TEST_N775_CRC_FUNCTION_f)(uint16_t remainder, const uint16_t *pItems, uint16_t numberOfItems);
+
+static uint16_t testN775_benchmarkItems[TEST_N775_BENCHMARK_ITEMS];
+
+static uint16_t TEST_N775_RunBenchmark(TEST_N775_CRC_FUNCTION_f crcFunction, const char *pName) {
+    uint16_t remainder  = 0u;
+    const clock_t start = clock();
+    for (uint16_t repetition = 0u; repetition < TEST_N775_BENCHMARK_REPETITIONS; repetition++) {
+        remainder = crcFunction(remainder, testN775_benchmarkItems, TEST_N775_BENCHMARK_ITEMS);
+    }
+    const double duration_ms = ((double)(clock() - start) * 1000.0) / (double)CLOCKS_PER_SEC;
+
+    char message[80] = {0};
+    (void)snprintf(message, sizeof(message), "%s: %.2f ms", pName, duration_ms);
+    TEST_MESSAGE(message);
+    return remainder;
+}
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testN775_CrcSelfTestShouldPass(void) {
+    TEST_ASSERT_PASS_ASSERT(TEST_ASSERT_EQUAL(STD_OK, N775_CrcSelfTest()));
+}
+
+void testN775_CrcKnownSequences(void) {
+    const uint16_t testSequence1[2] = {0x1234u, 0x5678u};
+    TEST_ASSERT_EQUAL_HEX16(0xFD36u, N775_CrcAddItems(0u, testSequence1, 2u));
+
+    const uint16_t testSequence2[5] = {0x0123u, 0x4567u, 0x89ABu, 0xCDEFu, 0xFEDCu};
+    TEST_ASSERT_EQUAL_HEX16(0xBB74u, N775_CrcAddItems(0u, testSequence2, 5u));
+
+    /* adding the items one by one gives the same result */
+    uint16_t remainder = 0u;
+    for (uint8_t i = 0u; i < 5u; i++) {
+        remainder = N775_CrcAddItem(remainder, testSequence2[i]);
+    }
+    TEST_ASSERT_EQUAL_HEX16(0xBB74u, remainder);
+
+    /* no items do not change the remainder */
+    TEST_ASSERT_EQUAL_HEX16(0xABCDu, N775_CrcAddItems(0xABCDu, testSequence2, 0u));
+}
+
+void testN775_CrcImplementationsAreEquivalent(void) {
+    uint16_t items[9] = {0u};
+    uint16_t pattern  = 0xACE1u;
+    for (uint16_t run = 0u; run < 1000u; run++) {
+        /* pseudo random items from a 16 bit Fibonacci LFSR */
+        for (uint8_t i = 0u; i < 9u; i++) {
+            const uint16_t bit = ((pattern >> 0u) ^ (pattern >> 2u) ^ (pattern >> 3u) ^ (pattern >> 5u)) & 1u;
+            pattern            = (uint16_t)((pattern >> 1u) | (bit << 15u));
+            items[i]           = pattern;
+        }
+        /* odd and even numbers of items with an arbitrary start remainder */
+        const uint16_t numberOfItems = run % 10u;
+        const uint16_t reference     = TEST_N775_CrcAddItemsBitwise(items[0], items, numberOfItems);
+        TEST_ASSERT_EQUAL_HEX16(reference, TEST_N775_CrcAddItemsTable(items[0], items, numberOfItems));
+        TEST_ASSERT_EQUAL_HEX16(reference, TEST_N775_CrcAddItemsSliceBy4(items[0], items, numberOfItems));
+        TEST_ASSERT_EQUAL_HEX16(reference, N775_CrcAddItems(items[0], items, numberOfItems));
+    }
+}
+
+void testN775_CrcNullPointer(void) {
+    TEST_ASSERT_FAIL_ASSERT(TEST_N775_CrcAddItemsBitwise(0u, NULL_PTR, 1u));
+    TEST_ASSERT_FAIL_ASSERT(TEST_N775_CrcAddItemsTable(0u, NULL_PTR, 1u));
+    TEST_ASSERT_FAIL_ASSERT(TEST_N775_CrcAddItemsSliceBy4(0u, NULL_PTR, 1u));
+}
+
+void testN775_CrcBenchmark(void) {
+    for (uint16_t i = 0u; i < TEST_N775_BENCHMARK_ITEMS; i++) {
+        testN775_benchmarkItems[i] = (uint16_t)((i * 0x9E37u) ^ 0x5A5Au);
+    }
+    const uint16_t reference = TEST_N775_RunBenchmark(TEST_N775_CrcAddItemsBitwise, "bitwise");
+    TEST_ASSERT_EQUAL_HEX16(reference, TEST_N775_RunBenchmark(TEST_N775_CrcAddItemsTable, "table"));
+    TEST_ASSERT_EQUAL_HEX16(reference, TEST_N775_RunBenchmark(TEST_N775_CrcAddItemsSliceBy4, "slice-by-4"));
+}
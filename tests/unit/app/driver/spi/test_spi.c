@@ -63,6 +63,7 @@
 #include "spi_cfg.h"
 
 #include "spi.h"
+#include "test_assert_helper.h"
 
 TEST_FILE("spi.c")
 
@@ -72,8 +73,47 @@ long FSYS_RaisePrivilege(void) {
     return 0;
 }
 
+/** time after the start of the last transfer in which no wake-up is needed */
+#define TEST_WAKE_UP_VALIDITY_US (3300u)
+
+/** wait time after the wake-up byte */
+#define TEST_WAKE_UP_DELAY_US (30u)
+
+static spiBASE_t testSpiNode          = {0};
+static volatile uint32_t testGioPort  = 0u;
+static const spiDAT1_t testSpiConfig  = {0};
+static SPI_ACTIVITY_s testSpiActivity = {0};
+static uint16_t testTxBuffer[4]       = {0};
+
+/** SPI interface with tracked activity */
+static SPI_INTERFACE_CONFIG_s testSpiInterface = {
+    .channel   = SPI_Interface1,
+    .pConfig   = &testSpiConfig,
+    .pNode     = &testSpiNode,
+    .pGioPort  = &testGioPort,
+    .csPin     = 2u,
+    .pActivity = &testSpiActivity,
+};
+
+/** expects a blocking transfer and the recording of its start */
+static void TEST_ExpectTransfer(uint32_t frameLength, uint32_t tick, uint32_t count) {
+    MCU_GetFreeRunningCount_ExpectAndReturn(count);
+    OS_GetTickCount_ExpectAndReturn(tick);
+    spiTransmitData_ExpectAndReturn(&testSpiNode, (spiDAT1_t *)&testSpiConfig, frameLength, NULL_PTR, 0u);
+    spiTransmitData_IgnoreArg_srcbuff();
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
+    testSpiActivity.isValid       = false;
+    testSpiActivity.lastCount     = 0u;
+    testSpiActivity.lastTick      = 0u;
+    testSpiActivity.elidedWakeUps = 0u;
+    testSpiInterface.pActivity    = &testSpiActivity;
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    IO_PinSet_Ignore();
+    IO_PinReset_Ignore();
 }
 
 void tearDown(void) {
@@ -83,3 +123,119 @@ void tearDown(void) {
 
 void testDummyFunction() {
 }
+
+void testTransmitDataWithDummyWakesUpInactiveInterface(void) {
+    /* no transfer since startup: wake-up byte, delay and data */
+    TEST_ExpectTransfer(1u, 10u, 1000u);
+    MCU_delay_us_Expect(TEST_WAKE_UP_DELAY_US);
+    TEST_ExpectTransfer(4u, 10u, 2000u);
+
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        SPI_TransmitDataWithDummy(
+            &testSpiInterface, TEST_WAKE_UP_DELAY_US, TEST_WAKE_UP_VALIDITY_US, testTxBuffer, 4u));
+    TEST_ASSERT_TRUE(testSpiActivity.isValid);
+    TEST_ASSERT_EQUAL_UINT32(2000u, testSpiActivity.lastCount);
+    TEST_ASSERT_EQUAL_UINT32(0u, testSpiActivity.elidedWakeUps);
+}
+
+void testTransmitDataWithDummySkipsWakeUpWithinValidity(void) {
+    testSpiActivity.isValid   = true;
+    testSpiActivity.lastCount = 2000u;
+    testSpiActivity.lastTick  = 10u;
+
+    /* last transfer started shortly before: only data is sent */
+    OS_GetTickCount_ExpectAndReturn(12u);
+    MCU_GetFreeRunningCount_ExpectAndReturn(90000u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(88000u, TEST_WAKE_UP_VALIDITY_US - 1u);
+    TEST_ExpectTransfer(4u, 12u, 90000u);
+
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        SPI_TransmitDataWithDummy(
+            &testSpiInterface, TEST_WAKE_UP_DELAY_US, TEST_WAKE_UP_VALIDITY_US, testTxBuffer, 4u));
+    TEST_ASSERT_EQUAL_UINT32(1u, testSpiActivity.elidedWakeUps);
+    TEST_ASSERT_EQUAL_UINT32(90000u, testSpiActivity.lastCount);
+}
+
+void testTransmitDataWithDummyWakesUpAfterValidity(void) {
+    testSpiActivity.isValid   = true;
+    testSpiActivity.lastCount = 2000u;
+    testSpiActivity.lastTick  = 10u;
+
+    /* the validity has expired: wake-up byte, delay and data */
+    OS_GetTickCount_ExpectAndReturn(14u);
+    MCU_GetFreeRunningCount_ExpectAndReturn(200000u);
+    MCU_ConvertFrcDifferenceToTimespan_us_ExpectAndReturn(198000u, TEST_WAKE_UP_VALIDITY_US);
+    TEST_ExpectTransfer(1u, 14u, 200000u);
+    MCU_delay_us_Expect(TEST_WAKE_UP_DELAY_US);
+    TEST_ExpectTransfer(4u, 14u, 201000u);
+
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        SPI_TransmitDataWithDummy(
+            &testSpiInterface, TEST_WAKE_UP_DELAY_US, TEST_WAKE_UP_VALIDITY_US, testTxBuffer, 4u));
+    TEST_ASSERT_EQUAL_UINT32(0u, testSpiActivity.elidedWakeUps);
+}
+
+void testTransmitDataWithDummyWakesUpAfterCounterWrapAround(void) {
+    testSpiActivity.isValid   = true;
+    testSpiActivity.lastCount = 2000u;
+    testSpiActivity.lastTick  = 10u;
+
+    /* FRC0 may have wrapped around: the old activity is not evaluated */
+    OS_GetTickCount_ExpectAndReturn(200000u);
+    TEST_ExpectTransfer(1u, 200000u, 3000u);
+    MCU_delay_us_Expect(TEST_WAKE_UP_DELAY_US);
+    TEST_ExpectTransfer(4u, 200000u, 4000u);
+
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        SPI_TransmitDataWithDummy(
+            &testSpiInterface, TEST_WAKE_UP_DELAY_US, TEST_WAKE_UP_VALIDITY_US, testTxBuffer, 4u));
+}
+
+void testTransmitDataWithDummyAlwaysWakesUpUntrackedInterface(void) {
+    testSpiInterface.pActivity = NULL_PTR;
+
+    spiTransmitData_ExpectAndReturn(&testSpiNode, (spiDAT1_t *)&testSpiConfig, 1u, NULL_PTR, 0u);
+    spiTransmitData_IgnoreArg_srcbuff();
+    MCU_delay_us_Expect(TEST_WAKE_UP_DELAY_US);
+    spiTransmitData_ExpectAndReturn(&testSpiNode, (spiDAT1_t *)&testSpiConfig, 4u, NULL_PTR, 0u);
+    spiTransmitData_IgnoreArg_srcbuff();
+
+    TEST_ASSERT_EQUAL(
+        STD_OK,
+        SPI_TransmitDataWithDummy(
+            &testSpiInterface, TEST_WAKE_UP_DELAY_US, TEST_WAKE_UP_VALIDITY_US, testTxBuffer, 4u));
+}
+
+void testTransmitReceiveDataDmaFromIsrDoesNotStartDuringOngoingDmaTransfer(void) {
+    uint16_t rxBuffer[4] = {0};
+    testSpiNode.INT0     = DMAREQEN_BIT;
+
+    TEST_ASSERT_EQUAL(STD_NOT_OK, SPI_TransmitReceiveDataDmaFromIsr(&testSpiInterface, testTxBuffer, rxBuffer, 4u));
+    TEST_ASSERT_EQUAL(SPI_IDLE, *(spi_busyFlags + testSpiInterface.channel));
+    TEST_ASSERT_FALSE(testSpiActivity.isValid);
+
+    testSpiNode.INT0 = 0u;
+}
+
+void testTransmitReceiveDataDmaLockedRequiresLockedInterface(void) {
+    uint16_t rxBuffer[4] = {0};
+
+    TEST_ASSERT_FAIL_ASSERT(SPI_TransmitReceiveDataDmaLocked(&testSpiInterface, testTxBuffer, rxBuffer, 4u));
+}
+
+void testTransmitReceiveDataDmaLockedKeepsLockDuringOngoingDmaTransfer(void) {
+    uint16_t rxBuffer[4] = {0};
+    TEST_ASSERT_EQUAL(STD_OK, SPI_Lock(testSpiInterface.channel));
+    testSpiNode.INT0 = DMAREQEN_BIT;
+
+    TEST_ASSERT_EQUAL(STD_NOT_OK, SPI_TransmitReceiveDataDmaLocked(&testSpiInterface, testTxBuffer, rxBuffer, 4u));
+    TEST_ASSERT_EQUAL(SPI_BUSY, *(spi_busyFlags + testSpiInterface.channel));
+    TEST_ASSERT_FALSE(testSpiActivity.isValid);
+
+    testSpiNode.INT0 = 0u;
+    SPI_Unlock(testSpiInterface.channel);
+}
@@ -54,10 +54,12 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 
+#include "adc_table.h"
 #include "epcos_b57251v5103j060.h"
 #include "foxmath.h"
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+TEST_FILE("epcos_b57251v5103j060_adc-table.c")
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
@@ -77,3 +79,17 @@ void testTS_Epc00GetTemperatureFromLutFixedValues(void) {
 void testTS_Epc00GetTemperatureFromPolynomialFixedValues(void) {
     TEST_ASSERT_EQUAL_INT16(426, TS_Epc00GetTemperatureFromPolynomial(1000u));
 }
+
+void testTS_Epc00AdcTableMatchesLutForEveryMillivolt(void) {
+    for (uint32_t adcVoltage_mV = 0u; adcVoltage_mV <= UINT16_MAX; adcVoltage_mV++) {
+        const uint16_t voltage_mV    = (uint16_t)adcVoltage_mV;
+        const int16_t expected_ddegC = TS_Epc00GetTemperatureFromLut(voltage_mV);
+        const int16_t actual_ddegC   = TS_GetTemperatureFromAdcTable(&ts_b57251v5103j060AdcTable, voltage_mV);
+        if ((expected_ddegC == INT16_MIN) || (expected_ddegC == INT16_MAX)) {
+            /* outside of the operating range */
+            TEST_ASSERT_EQUAL_INT16(expected_ddegC, actual_ddegC);
+        } else {
+            TEST_ASSERT_INT16_WITHIN(TS_ADC_TABLE_TOLERANCE_ddegC, expected_ddegC, actual_ddegC);
+        }
+    }
+}
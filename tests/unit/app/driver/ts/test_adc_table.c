@@ -0,0 +1,103 @@
+/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from
+ *     this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer
+ * to foxBMS in your hardware, software, documentation or advertising
+ * materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+
+/**
+ * @file    test_adc_table.c
+ * @author  foxBMS Team
+ * @date    2026-10-15 (date of creation)
+ * @updated 2026-10-15 (date of last update)
+ * @ingroup UNIT_TEST_IMPLEMENTATION
+ * @prefix  TS
+ *
+ * @brief   Test of the adc_table.c module
+ *
+ */
+
+/*========== Includes =======================================================*/
+#include "unity.h"
+
+#include "adc_table.h"
+#include "test_assert_helper.h"
+
+/*========== Definitions and Implementations for Unit Test ==================*/
+/** temperatures of the test table: 10.0, 5.0, -0.5 and -8.0 deci &deg;C */
+static const int16_t testTs_temperatures[4u] = {160, 80, -8, -128};
+
+/** test table from 1000 mV to 1020 mV with a spacing of 8 mV */
+static const TS_ADC_TABLE_s testTs_table = {
+    .minimumVoltage_mV = 1000u,
+    .maximumVoltage_mV = 1020u,
+    .stepShift         = 3u,
+    .nrOfEntries       = 4u,
+    .pTemperatures     = testTs_temperatures,
+};
+
+/*========== Setup and Teardown =============================================*/
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+/*========== Test Cases =====================================================*/
+void testTS_GetTemperatureFromAdcTableInvalidInput(void) {
+    const TS_ADC_TABLE_s noTemperatures = {0};
+    TEST_ASSERT_FAIL_ASSERT(TS_GetTemperatureFromAdcTable(NULL_PTR, 1000u));
+    TEST_ASSERT_FAIL_ASSERT(TS_GetTemperatureFromAdcTable(&noTemperatures, 1000u));
+}
+
+void testTS_GetTemperatureFromAdcTableOutsideOfOperatingRange(void) {
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, TS_GetTemperatureFromAdcTable(&testTs_table, 0u));
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, TS_GetTemperatureFromAdcTable(&testTs_table, 999u));
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, TS_GetTemperatureFromAdcTable(&testTs_table, 1021u));
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, TS_GetTemperatureFromAdcTable(&testTs_table, UINT16_MAX));
+}
+
+void testTS_GetTemperatureFromAdcTableInterpolation(void) {
+    /* grid points */
+    TEST_ASSERT_EQUAL_INT16(10, TS_GetTemperatureFromAdcTable(&testTs_table, 1000u));
+    TEST_ASSERT_EQUAL_INT16(5, TS_GetTemperatureFromAdcTable(&testTs_table, 1008u));
+    TEST_ASSERT_EQUAL_INT16(0, TS_GetTemperatureFromAdcTable(&testTs_table, 1016u));
+    /* between grid points: 160 - (80 * 4) / 8 = 120 */
+    TEST_ASSERT_EQUAL_INT16(7, TS_GetTemperatureFromAdcTable(&testTs_table, 1004u));
+    /* negative temperatures are truncated towards zero: -8 - (120 * 4) / 8 = -68 */
+    TEST_ASSERT_EQUAL_INT16(-4, TS_GetTemperatureFromAdcTable(&testTs_table, 1020u));
+}
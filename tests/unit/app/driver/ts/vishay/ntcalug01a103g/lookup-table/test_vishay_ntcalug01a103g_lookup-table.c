@@ -53,6 +53,7 @@
 
 /*========== Includes =======================================================*/
 #include "unity.h"
+#include "Mockadc_table.h"
 #include "Mockvishay_ntcalug01a103g.h"
 
 #include "foxmath.h"
@@ -61,6 +62,8 @@
 TEST_FILE("vishay_ntcalug01a103g_lookup-table.c")
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+/* the sensor header is mocked, the generated table is replaced by a dummy */
+const TS_ADC_TABLE_s ts_ntcalug01a103gAdcTable = {0};
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
@@ -73,6 +76,6 @@ void tearDown(void) {
 void testTSI_GetTemperatureFromVishayNTCALUG01A103GLookupTable(void) {
     const uint8_t test_adcVoltage_mv = 5;
     const float test_temperature     = 1.0;
-    TS_Vis00GetTemperatureFromLut_ExpectAndReturn(test_adcVoltage_mv, test_temperature);
+    TS_GetTemperatureFromAdcTable_ExpectAndReturn(&ts_ntcalug01a103gAdcTable, test_adcVoltage_mv, test_temperature);
     TEST_ASSERT_EQUAL(test_temperature, TSI_GetTemperature(test_adcVoltage_mv));
 }
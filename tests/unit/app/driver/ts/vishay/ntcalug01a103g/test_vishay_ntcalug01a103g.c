@@ -54,10 +54,12 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 
+#include "adc_table.h"
 #include "foxmath.h"
 #include "vishay_ntcalug01a103g.h"
 
 /*========== Definitions and Implementations for Unit Test ==================*/
+TEST_FILE("vishay_ntcalug01a103g_adc-table.c")
 
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
@@ -76,3 +78,17 @@ void testTS_Vis00GetTemperatureFromLutFixedValues(void) {
 void testTS_Vis00GetTemperatureFromPolynomialFixedValues(void) {
     TEST_ASSERT_EQUAL_INT16(0, TS_Vis00GetTemperatureFromPolynomial(1u));
 }
+
+void testTS_Vis00AdcTableMatchesLutForEveryMillivolt(void) {
+    for (uint32_t adcVoltage_mV = 0u; adcVoltage_mV <= UINT16_MAX; adcVoltage_mV++) {
+        const uint16_t voltage_mV    = (uint16_t)adcVoltage_mV;
+        const int16_t expected_ddegC = TS_Vis00GetTemperatureFromLut(voltage_mV);
+        const int16_t actual_ddegC   = TS_GetTemperatureFromAdcTable(&ts_ntcalug01a103gAdcTable, voltage_mV);
+        if ((expected_ddegC == INT16_MIN) || (expected_ddegC == INT16_MAX)) {
+            /* outside of the operating range */
+            TEST_ASSERT_EQUAL_INT16(expected_ddegC, actual_ddegC);
+        } else {
+            TEST_ASSERT_INT16_WITHIN(TS_ADC_TABLE_TOLERANCE_ddegC, expected_ddegC, actual_ddegC);
+        }
+    }
+}
@@ -62,6 +62,7 @@
 #include "database_cfg.h"
 
 #include "database.h"
+#include "test_assert_helper.h"
 
 /*========== Definitions and Implementations for Unit Test ==================*/
 
@@ -232,3 +233,213 @@ void testDATA_DatabaseEntryUpdatedWithinInterval(void) {
 }
 
 /*========== Test Cases =====================================================*/
+
+void testDATA_SequenceLockedWriteAndRead(void) {
+    /* only the cell voltage entry is used as it is the first entry of the
+       database and therefore mapped correctly without calling DATA_Init() */
+    DATA_BLOCK_CELL_VOLTAGE_s writeEntry = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    DATA_BLOCK_CELL_VOLTAGE_s readEntry  = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    writeEntry.cellVoltage_mV[0][0]      = 3700;
+    writeEntry.header.timestamp          = 5u;
+
+    const uint32_t sequenceBefore = TEST_DATA_GetSequenceCounter(DATA_BLOCK_ID_CELL_VOLTAGE);
+    OS_GetTickCount_ExpectAndReturn(15u);
+    /* the copy and the increments of the sequence counter are one critical section */
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_DATA_WriteEntryWithSequenceLock((void *)&writeEntry);
+
+    /* timestamps of the passed struct are updated, sequence counter is even again */
+    TEST_ASSERT_EQUAL(15u, writeEntry.header.timestamp);
+    TEST_ASSERT_EQUAL(5u, writeEntry.header.previousTimestamp);
+    TEST_ASSERT_EQUAL(sequenceBefore + 2u, TEST_DATA_GetSequenceCounter(DATA_BLOCK_ID_CELL_VOLTAGE));
+
+    /* the optimistic read does not lock */
+    TEST_DATA_ReadEntryWithSequenceLock((void *)&readEntry);
+    TEST_ASSERT_EQUAL(3700, readEntry.cellVoltage_mV[0][0]);
+    TEST_ASSERT_EQUAL(15u, readEntry.header.timestamp);
+    TEST_ASSERT_EQUAL(5u, readEntry.header.previousTimestamp);
+    TEST_ASSERT_TRUE(DATA_GetMaximumNumberOfReadAttempts() >= 1u);
+}
+
+void testDATA_SequenceLockedReadLocksWhileWriteInProgress(void) {
+    DATA_BLOCK_CELL_VOLTAGE_s writeEntry = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    DATA_BLOCK_CELL_VOLTAGE_s readEntry  = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    writeEntry.cellVoltage_mV[0][0]      = 3600;
+    OS_GetTickCount_ExpectAndReturn(20u);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_DATA_WriteEntryWithSequenceLock((void *)&writeEntry);
+
+    /* an odd sequence counter marks a write access on another core, all
+       optimistic attempts fail and the entry is copied in a critical section */
+    TEST_DATA_SetSequenceCounter(DATA_BLOCK_ID_CELL_VOLTAGE, 1u);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_DATA_ReadEntryWithSequenceLock((void *)&readEntry);
+    TEST_ASSERT_EQUAL(DATA_SEQUENCE_LOCK_MAX_READ_ATTEMPTS + 1u, DATA_GetMaximumNumberOfReadAttempts());
+    TEST_ASSERT_EQUAL(DATA_BLOCK_ID_CELL_VOLTAGE, readEntry.header.uniqueId);
+    TEST_ASSERT_EQUAL(20u, readEntry.header.timestamp);
+    TEST_ASSERT_EQUAL(3600, readEntry.cellVoltage_mV[0][0]);
+
+    /* write access finished, the optimistic read succeeds again */
+    TEST_DATA_SetSequenceCounter(DATA_BLOCK_ID_CELL_VOLTAGE, 2u);
+    readEntry.cellVoltage_mV[0][0] = 0;
+    TEST_DATA_ReadEntryWithSequenceLock((void *)&readEntry);
+    TEST_ASSERT_EQUAL(3600, readEntry.cellVoltage_mV[0][0]);
+}
+
+void testDATA_SequenceLockedAccessInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(TEST_DATA_WriteEntryWithSequenceLock(NULL_PTR));
+    TEST_ASSERT_FAIL_ASSERT(TEST_DATA_ReadEntryWithSequenceLock(NULL_PTR));
+}
+
+void testDATA_ReadRangeOfDatabaseEntry(void) {
+    DATA_BLOCK_CELL_VOLTAGE_s writeEntry = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE};
+    writeEntry.cellVoltage_mV[0][0]      = 3000;
+    writeEntry.cellVoltage_mV[0][1]      = 3001;
+    writeEntry.packVoltage_mV[0]         = 123456;
+
+    OS_GetTickCount_ExpectAndReturn(20u);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_DATA_WriteEntryWithSequenceLock((void *)&writeEntry);
+
+    /* read two cell voltages of the first string with the sequence lock */
+    int16_t cellVoltages_mV[2] = {0};
+    TEST_DATA_ReadRangeWithSequenceLock(
+        DATA_BLOCK_ID_CELL_VOLTAGE,
+        (void *)cellVoltages_mV,
+        (uint16_t)offsetof(DATA_BLOCK_CELL_VOLTAGE_s, cellVoltage_mV[0][0]),
+        (uint16_t)sizeof(cellVoltages_mV));
+    TEST_ASSERT_EQUAL(3000, cellVoltages_mV[0]);
+    TEST_ASSERT_EQUAL(3001, cellVoltages_mV[1]);
+
+    /* read the pack voltage as done by the database task */
+    int32_t packVoltage_mV = 0;
+    TEST_DATA_CopyRange(
+        DATA_BLOCK_ID_CELL_VOLTAGE,
+        (void *)&packVoltage_mV,
+        (uint16_t)offsetof(DATA_BLOCK_CELL_VOLTAGE_s, packVoltage_mV[0]),
+        (uint16_t)sizeof(packVoltage_mV));
+    TEST_ASSERT_EQUAL(123456, packVoltage_mV);
+}
+
+void testDATA_ReadRangeInvalidInput(void) {
+    int16_t buffer[2] = {0};
+    /* range exceeds the database entry */
+    TEST_ASSERT_FAIL_ASSERT(TEST_DATA_ReadRangeWithSequenceLock(
+        DATA_BLOCK_ID_CELL_VOLTAGE, (void *)buffer, (uint16_t)sizeof(DATA_BLOCK_CELL_VOLTAGE_s), 1u));
+    TEST_ASSERT_FAIL_ASSERT(TEST_DATA_CopyRange(
+        DATA_BLOCK_ID_CELL_VOLTAGE, (void *)buffer, (uint16_t)sizeof(DATA_BLOCK_CELL_VOLTAGE_s), 1u));
+    TEST_ASSERT_FAIL_ASSERT(TEST_DATA_CopyRange(DATA_BLOCK_ID_CELL_VOLTAGE, NULL_PTR, 0u, 1u));
+    TEST_ASSERT_FAIL_ASSERT(DATA_ReadDataBlockRange(DATA_BLOCK_ID_MAX, (void *)buffer, 0u, 1u));
+}
+
+void testDATA_DoubleBufferedEntry(void) {
+    /* the mapping of the cell voltage base entry requires the initialization */
+    static StaticQueue_t dummyQueue;
+    MPU_xQueueGenericCreateStatic_IgnoreAndReturn((QueueHandle_t)&dummyQueue);
+    TEST_ASSERT_EQUAL(STD_OK, DATA_Init());
+
+    DATA_BLOCK_CELL_VOLTAGE_s *pBackBuffer =
+        (DATA_BLOCK_CELL_VOLTAGE_s *)DATA_GetBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+    const DATA_BLOCK_CELL_VOLTAGE_s *pFrontBuffer =
+        (const DATA_BLOCK_CELL_VOLTAGE_s *)DATA_GetFrontBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+    TEST_ASSERT_NOT_EQUAL(pFrontBuffer, pBackBuffer);
+    TEST_ASSERT_EQUAL(DATA_BLOCK_ID_CELL_VOLTAGE_BASE, pBackBuffer->header.uniqueId);
+
+    /* the driver decodes into the back buffer and commits it */
+    pBackBuffer->cellVoltage_mV[0][0] = 3300;
+    const uint32_t sequenceBefore     = TEST_DATA_GetSequenceCounter(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+    OS_GetTickCount_ExpectAndReturn(20u);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    DATA_CommitBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+
+    /* the buffers have been swapped and the timestamps updated */
+    TEST_ASSERT_EQUAL_PTR(pBackBuffer, DATA_GetFrontBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE));
+    TEST_ASSERT_EQUAL_PTR(pFrontBuffer, DATA_GetBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE));
+    TEST_ASSERT_EQUAL(20u, pBackBuffer->header.timestamp);
+    TEST_ASSERT_EQUAL(0u, pBackBuffer->header.previousTimestamp);
+    TEST_ASSERT_EQUAL(sequenceBefore + 2u, TEST_DATA_GetSequenceCounter(DATA_BLOCK_ID_CELL_VOLTAGE_BASE));
+
+    /* copying read accesses return the committed data */
+    DATA_BLOCK_CELL_VOLTAGE_s readEntry = {.header.uniqueId = DATA_BLOCK_ID_CELL_VOLTAGE_BASE};
+    TEST_DATA_ReadEntryWithSequenceLock((void *)&readEntry);
+    TEST_ASSERT_EQUAL(3300, readEntry.cellVoltage_mV[0][0]);
+    TEST_ASSERT_EQUAL(20u, readEntry.header.timestamp);
+
+    /* the second commit continues with the timestamp of the first one */
+    OS_GetTickCount_ExpectAndReturn(30u);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    DATA_CommitBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE);
+    TEST_ASSERT_EQUAL_PTR(pFrontBuffer, DATA_GetFrontBuffer(DATA_BLOCK_ID_CELL_VOLTAGE_BASE));
+    TEST_ASSERT_EQUAL(30u, pFrontBuffer->header.timestamp);
+    TEST_ASSERT_EQUAL(20u, pFrontBuffer->header.previousTimestamp);
+}
+
+void testDATA_DoubleBufferedEntryInvalidInput(void) {
+    /* the cell voltage entry is not double-buffered */
+    TEST_ASSERT_FAIL_ASSERT(DATA_GetBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE));
+    TEST_ASSERT_FAIL_ASSERT(DATA_CommitBackBuffer(DATA_BLOCK_ID_CELL_VOLTAGE));
+    TEST_ASSERT_FAIL_ASSERT(DATA_GetFrontBuffer(DATA_BLOCK_ID_CELL_VOLTAGE));
+    TEST_ASSERT_FAIL_ASSERT(DATA_GetBackBuffer(DATA_BLOCK_ID_MAX));
+    TEST_ASSERT_FAIL_ASSERT(DATA_CommitBackBuffer(DATA_BLOCK_ID_MAX));
+}
+
+/* the subscription tests are the last tests of this file, as the registered
+   subscriptions would otherwise lead to notifications in the write tests */
+void testDATA_SubscribeToDataBlock(void) {
+    static StaticTask_t dummyTasks[3];
+    TaskHandle_t taskA = (TaskHandle_t)&dummyTasks[0];
+    TaskHandle_t taskB = (TaskHandle_t)&dummyTasks[1];
+    TaskHandle_t taskC = (TaskHandle_t)&dummyTasks[2];
+
+    /* first subscription of task A */
+    MPU_xTaskGetCurrentTaskHandle_ExpectAndReturn(taskA);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_ASSERT_EQUAL(STD_OK, DATA_SubscribeToDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, 0x1u));
+
+    /* second subscription of task A is merged into the first one */
+    MPU_xTaskGetCurrentTaskHandle_ExpectAndReturn(taskA);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_ASSERT_EQUAL(STD_OK, DATA_SubscribeToDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, 0x2u));
+
+    MPU_xTaskGetCurrentTaskHandle_ExpectAndReturn(taskB);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_ASSERT_EQUAL(STD_OK, DATA_SubscribeToDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, 0x4u));
+
+    /* all subscription slots are in use */
+    MPU_xTaskGetCurrentTaskHandle_ExpectAndReturn(taskC);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    TEST_ASSERT_EQUAL(STD_NOT_OK, DATA_SubscribeToDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, 0x8u));
+
+    /* a committed write notifies both subscribed tasks */
+    MPU_xTaskGenericNotify_ExpectAndReturn(taskA, 0u, 0x3u, eSetBits, NULL_PTR, pdPASS);
+    MPU_xTaskGenericNotify_ExpectAndReturn(taskB, 0u, 0x4u, eSetBits, NULL_PTR, pdPASS);
+    TEST_DATA_NotifySubscribers(DATA_BLOCK_ID_CELL_VOLTAGE);
+
+    TEST_ASSERT_FAIL_ASSERT(DATA_SubscribeToDataBlock(DATA_BLOCK_ID_MAX, 0x1u));
+    TEST_ASSERT_FAIL_ASSERT(DATA_SubscribeToDataBlock(DATA_BLOCK_ID_CELL_VOLTAGE, 0u));
+}
+
+void testDATA_GetDataBlockUpdates(void) {
+    uint32_t notificationValue = 0x5u;
+
+    /* only the requested bits are returned */
+    MPU_xTaskGenericNotifyWait_ExpectAndReturn(0u, 0u, 0x1u, NULL_PTR, 10u, pdTRUE);
+    MPU_xTaskGenericNotifyWait_IgnoreArg_pulNotificationValue();
+    MPU_xTaskGenericNotifyWait_ReturnThruPtr_pulNotificationValue(&notificationValue);
+    TEST_ASSERT_EQUAL(0x1u, DATA_GetDataBlockUpdates(0x1u, 10u));
+
+    /* no notification within the timeout */
+    MPU_xTaskGenericNotifyWait_ExpectAndReturn(0u, 0u, 0x1u, NULL_PTR, 0u, pdFALSE);
+    MPU_xTaskGenericNotifyWait_IgnoreArg_pulNotificationValue();
+    TEST_ASSERT_EQUAL(0u, DATA_GetDataBlockUpdates(0x1u, 0u));
+}
@@ -120,3 +120,26 @@ void testDIAG_ErrorCurrentMeasurementInvalidInput(void) {
     TEST_ASSERT_FAIL_ASSERT(DIAG_ErrorCurrentMeasurement(
         DIAG_ID_CURRENT_MEASUREMENT_TIMEOUT, DIAG_EVENT_OK, &diag_kpkDatabaseShim, BS_NR_OF_STRINGS));
 }
+
+/** tests invalid input values */
+void testDIAG_ErrorCurrentOnOpenStringInvalidInput(void) {
+    TEST_ASSERT_FAIL_ASSERT(DIAG_ErrorCurrentOnOpenString(DIAG_ID_MAX, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 0u));
+    TEST_ASSERT_FAIL_ASSERT(
+        DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_MEASUREMENT_TIMEOUT, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 0u));
+    TEST_ASSERT_FAIL_ASSERT(
+        DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, 42, &diag_kpkDatabaseShim, 0u));
+    TEST_ASSERT_FAIL_ASSERT(
+        DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_OK, NULL_PTR, 0u));
+    TEST_ASSERT_FAIL_ASSERT(DIAG_ErrorCurrentOnOpenString(
+        DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_OK, &diag_kpkDatabaseShim, BS_NR_OF_STRINGS));
+}
+
+/** tests that the current on open string flag is set and reset */
+void testDIAG_ErrorCurrentOnOpenString(void) {
+    DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_NOT_OK, &diag_kpkDatabaseShim, 1u);
+    TEST_ASSERT_EQUAL(1u, test_tableErrorFlags.currentOnOpenString[1u]);
+    DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_OK, &diag_kpkDatabaseShim, 1u);
+    TEST_ASSERT_EQUAL(1u, test_tableErrorFlags.currentOnOpenString[1u]);
+    DIAG_ErrorCurrentOnOpenString(DIAG_ID_CURRENT_ON_OPEN_STRING, DIAG_EVENT_RESET, &diag_kpkDatabaseShim, 1u);
+    TEST_ASSERT_EQUAL(0u, test_tableErrorFlags.currentOnOpenString[1u]);
+}
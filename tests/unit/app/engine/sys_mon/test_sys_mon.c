@@ -54,10 +54,13 @@
 /*========== Includes =======================================================*/
 #include "unity.h"
 #include "Mockdiag.h"
+#include "Mockfram.h"
+#include "Mockmcu.h"
 #include "Mockos.h"
 #include "Mocksys_mon_cfg.h"
 
 #include "fassert.h"
+#include "fram_cfg.h"
 #include "sys_mon.h"
 #include "test_assert_helper.h"
 
@@ -92,12 +95,43 @@ SYSM_MONITORING_CFG_s sysm_ch_cfg[2] = {
      TEST_SYSM_DummyCallback_1},
 };
 
+const uint32_t sysm_profileBucketLimits_us[SYSM_PROFILE_NR_OF_BUCKETS - 1u] = {50u, 100u, 250u, 500u, 1000u, 2500u};
+
+/** simulated value of the cycle counter */
+static uint32_t testCycleCount = 0u;
+
+static uint32_t TEST_MCU_GetCycleCount(int numCalls) {
+    return testCycleCount;
+}
+
+/** the cycle counter is simulated with one cycle per microsecond */
+static uint32_t TEST_MCU_ConvertCycleDifferenceToTimespan_us(uint32_t cycles, int numCalls) {
+    return cycles;
+}
+
+/** runs a section that takes duration_us */
+static void TEST_RunSection(SYSM_SECTION_ID_e sectionId, uint32_t duration_us) {
+    SYSM_EnterSection(sectionId);
+    testCycleCount += duration_us;
+    SYSM_ExitSection(sectionId);
+}
+
 /*========== Setup and Teardown =============================================*/
 void setUp(void) {
     SYSM_NOTIFICATION_s *notifications           = TEST_SYSM_GetNotifications();
     notifications[DUMMY_TSK_ID_0].timestampEnter = 0;
     notifications[DUMMY_TSK_ID_0].timestampExit  = 0;
     notifications[DUMMY_TSK_ID_0].duration       = 0;
+
+    TEST_SYSM_ResetProfiles();
+    testCycleCount = 0u;
+
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    FRAM_RequestWrite_Expect(FRAM_BLOCK_ID_SYS_MON_RECORD);
+    SYSM_ClearViolationRecord();
+    MCU_GetCycleCount_StubWithCallback(TEST_MCU_GetCycleCount);
+    MCU_ConvertCycleDifferenceToTimespan_us_StubWithCallback(TEST_MCU_ConvertCycleDifferenceToTimespan_us);
 }
 
 void tearDown(void) {
@@ -139,9 +173,76 @@ void testSYSM_CheckNotificationsProvokeDurationViolation(void) {
     OS_GetTickCount_ExpectAndReturn(100u);
     DIAG_Handler_ExpectAndReturn(
         DIAG_ID_SYSTEMMONITORING, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, DUMMY_TSK_ID_0, DIAG_HANDLER_RETURN_OK);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    FRAM_RequestWrite_Expect(FRAM_BLOCK_ID_SYS_MON_RECORD);
     SYSM_CheckNotifications();
 }
 
+void testSYSM_CheckNotificationsRecordsViolationOnce(void) {
+    OS_GetTickCount_ExpectAndReturn(0u);
+    SYSM_CheckNotifications();
+
+    SYSM_NOTIFICATION_s *notifications           = TEST_SYSM_GetNotifications();
+    notifications[DUMMY_TSK_ID_0].timestampEnter = 0;
+    notifications[DUMMY_TSK_ID_0].timestampExit  = 70;
+    notifications[DUMMY_TSK_ID_0].duration       = 70;
+    notifications[DUMMY_TSK_ID_1].duration       = 3;
+
+    /* the violation is recorded when it is detected for the first time */
+    OS_GetTickCount_ExpectAndReturn(100u);
+    DIAG_Handler_ExpectAndReturn(
+        DIAG_ID_SYSTEMMONITORING, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, DUMMY_TSK_ID_0, DIAG_HANDLER_RETURN_OK);
+    OS_EnterTaskCritical_Expect();
+    OS_ExitTaskCritical_Expect();
+    FRAM_RequestWrite_Expect(FRAM_BLOCK_ID_SYS_MON_RECORD);
+    SYSM_CheckNotifications();
+
+    /* it is still detected in the next check, but not recorded again */
+    OS_GetTickCount_ExpectAndReturn(101u);
+    DIAG_Handler_ExpectAndReturn(
+        DIAG_ID_SYSTEMMONITORING, DIAG_EVENT_NOT_OK, DIAG_SYSTEM, DUMMY_TSK_ID_0, DIAG_HANDLER_RETURN_OK);
+    SYSM_CheckNotifications();
+
+    FRAM_SYS_MON_VIOLATION_s violation = {0};
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    TEST_ASSERT_TRUE(SYSM_GetRecordedViolation(0u, &violation));
+    TEST_ASSERT_FALSE(SYSM_GetRecordedViolation(1u, &violation));
+    TEST_ASSERT_EQUAL_UINT32(1u, fram_sysMonViolationRecord.nrOfViolations);
+    TEST_ASSERT_EQUAL(DUMMY_TSK_ID_0, violation.taskId);
+    TEST_ASSERT_EQUAL_UINT32(100u, violation.timestamp_ms);
+    TEST_ASSERT_EQUAL_UINT16(70u, violation.duration_ms);
+    TEST_ASSERT_EQUAL_UINT16(100u - DUMMY_CYCLETIME, violation.jitter_ms);
+    TEST_ASSERT_EQUAL_UINT16(70u, violation.taskDurations_ms[DUMMY_TSK_ID_0]);
+    TEST_ASSERT_EQUAL_UINT16(3u, violation.taskDurations_ms[DUMMY_TSK_ID_1]);
+}
+
+void testSYSM_GetRecordedViolationReturnsNewestFirst(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    /* ten violations have been recorded, the ring buffer keeps the last ones */
+    fram_sysMonViolationRecord.nrOfViolations = 10u;
+    for (uint8_t i = 0u; i < FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS; i++) {
+        fram_sysMonViolationRecord.violations[i].timestamp_ms = i;
+    }
+
+    FRAM_SYS_MON_VIOLATION_s violation = {0};
+    TEST_ASSERT_TRUE(SYSM_GetRecordedViolation(0u, &violation));
+    TEST_ASSERT_EQUAL_UINT32(1u, violation.timestamp_ms);
+    TEST_ASSERT_TRUE(SYSM_GetRecordedViolation(1u, &violation));
+    TEST_ASSERT_EQUAL_UINT32(0u, violation.timestamp_ms);
+    TEST_ASSERT_TRUE(SYSM_GetRecordedViolation(FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS - 1u, &violation));
+    TEST_ASSERT_EQUAL_UINT32(2u, violation.timestamp_ms);
+    TEST_ASSERT_FALSE(SYSM_GetRecordedViolation(FRAM_SYS_MON_RECORD_NR_OF_VIOLATIONS, &violation));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_GetRecordedViolation(0u, NULL_PTR));
+}
+
+void testSYSM_LoadViolationRecordReadsFram(void) {
+    FRAM_Read_ExpectAndReturn(FRAM_BLOCK_ID_SYS_MON_RECORD, STD_NOT_OK);
+    SYSM_LoadViolationRecord();
+}
+
 void testSYSM_NotifyInvalidTaskID(void) {
     /* give an invalid Task ID to Notify */
     TEST_ASSERT_PASS_ASSERT(SYSM_Notify(SYSM_TASK_ID_MAX + 1u, SYSM_NOTIFY_ENTER, 424242));
@@ -192,3 +293,53 @@ void testSYSM_NotifyHitAssertWithIllegalNotifyType(void) {
     TEST_ASSERT_NOT_EQUAL(UINT32_MAX, notifications[DUMMY_TSK_ID_0].timestampEnter);
     TEST_ASSERT_NOT_EQUAL(UINT32_MAX, notifications[DUMMY_TSK_ID_0].timestampExit);
 }
+
+void testSYSM_NotifyProfilesTaskWithCycleCounter(void) {
+    /* a task that runs shorter than one tick is measured in microseconds */
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    testCycleCount = UINT32_MAX - 99u;
+    SYSM_Notify(DUMMY_TSK_ID_0, SYSM_NOTIFY_ENTER, 7u);
+    testCycleCount += 300u;
+    SYSM_Notify(DUMMY_TSK_ID_0, SYSM_NOTIFY_EXIT, 7u);
+
+    SYSM_PROFILE_s profile = {0};
+    SYSM_GetProfile(DUMMY_TSK_ID_0, &profile);
+    TEST_ASSERT_EQUAL(0u, TEST_SYSM_GetNotifications()[DUMMY_TSK_ID_0].duration);
+    TEST_ASSERT_EQUAL_UINT32(1u, profile.count);
+    TEST_ASSERT_EQUAL_UINT32(300u, profile.minimum_us);
+    TEST_ASSERT_EQUAL_UINT32(300u, profile.maximum_us);
+    TEST_ASSERT_EQUAL_UINT32(1u, profile.histogram[3]);
+}
+
+void testSYSM_SectionProfileMinimumMaximumAndHistogram(void) {
+    OS_EnterTaskCritical_Ignore();
+    OS_ExitTaskCritical_Ignore();
+    TEST_RunSection(SYSM_SECTION_ID_BMS_TRIGGER, 120u);
+    TEST_RunSection(SYSM_SECTION_ID_BMS_TRIGGER, 49u);
+    TEST_RunSection(SYSM_SECTION_ID_BMS_TRIGGER, 50u);
+    TEST_RunSection(SYSM_SECTION_ID_BMS_TRIGGER, 4000u);
+    /* other sections are not affected */
+    TEST_RunSection(SYSM_SECTION_ID_CAN_MAIN_FUNCTION, 10u);
+
+    SYSM_PROFILE_s profile = {0};
+    SYSM_GetProfile((uint8_t)SYSM_TASK_ID_MAX + (uint8_t)SYSM_SECTION_ID_BMS_TRIGGER, &profile);
+    TEST_ASSERT_EQUAL_UINT32(4u, profile.count);
+    TEST_ASSERT_EQUAL_UINT32(49u, profile.minimum_us);
+    TEST_ASSERT_EQUAL_UINT32(4000u, profile.maximum_us);
+    TEST_ASSERT_EQUAL_UINT64(4219u, profile.total_us);
+    const uint32_t expectedHistogram[SYSM_PROFILE_NR_OF_BUCKETS] = {1u, 1u, 1u, 0u, 0u, 0u, 1u};
+    TEST_ASSERT_EQUAL_UINT32_ARRAY(expectedHistogram, profile.histogram, SYSM_PROFILE_NR_OF_BUCKETS);
+
+    SYSM_GetProfile((uint8_t)SYSM_TASK_ID_MAX + (uint8_t)SYSM_SECTION_ID_CAN_MAIN_FUNCTION, &profile);
+    TEST_ASSERT_EQUAL_UINT32(1u, profile.count);
+    TEST_ASSERT_EQUAL_UINT32(10u, profile.maximum_us);
+}
+
+void testSYSM_ProfilingInvalidArguments(void) {
+    SYSM_PROFILE_s profile = {0};
+    TEST_ASSERT_FAIL_ASSERT(SYSM_EnterSection(SYSM_SECTION_ID_MAX));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_ExitSection(SYSM_SECTION_ID_MAX));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_GetProfile(SYSM_NR_OF_PROFILES, &profile));
+    TEST_ASSERT_FAIL_ASSERT(SYSM_GetProfile(0u, NULL_PTR));
+}
@@ -0,0 +1,815 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+"""Generates the CAN signal codecs from the DBC file
+
+For every message of the DBC file a struct with the raw signal values and a
+pack and an unpack function with constant shifts and masks are generated into
+``src/app/driver/can/can_codec.[ch]``. The round trip unit test of every
+message is generated into ``tests/unit/app/driver/can/test_can_codec.c``.
+
+The generated files are part of the repository, as the unit tests need them.
+Run the script after changing the DBC file and use ``--check`` to verify that
+the generated files match the DBC file.
+"""
+
+import argparse
+import difflib
+import logging
+import os
+import re
+import sys
+from fractions import Fraction
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+REPO_ROOT = os.path.realpath(os.path.join(SCRIPT_DIR, "..", ".."))
+
+DEFAULT_DBC = os.path.join(SCRIPT_DIR, "foxbms.dbc")
+DEFAULT_SOURCE_DIR = os.path.join(REPO_ROOT, "src", "app", "driver", "can")
+DEFAULT_TEST_DIR = os.path.join(REPO_ROOT, "tests", "unit", "app", "driver", "can")
+
+FILE_DATE = "2026-10-15"
+TEST_ROUNDS = 64
+COLUMN_LIMIT = 120
+MAXIMUM_DLC = 8
+
+LICENSE = """/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+"""
+
+SECTION_WIDTH = 79
+
+RE_MESSAGE = re.compile(r"^BO_ (\d+) (\w+)\s*: (\d+) \w+")
+RE_SIGNAL = re.compile(
+    r"^\s*SG_ (\w+)\s*(M|m\d+)?\s*: (\d+)\|(\d+)@([01])([+-]) "
+    r"\(([^,]+),([^)]+)\) \[[^]]*\] \"([^\"]*)\""
+)
+
+
+def section(name):
+    """returns a section comment of the foxBMS coding guidelines"""
+    text = f"/*========== {name} "
+    return text + "=" * (SECTION_WIDTH - len(text) - 2) + "*/"
+
+
+def split_name(name):
+    """splits a DBC name into words, e.g., 'foxBMS_packCurrent' into
+    ['foxBMS', 'pack', 'Current']"""
+    words = []
+    for part in name.split("_"):
+        tokens = re.findall(r"[A-Z]+(?=[A-Z][a-z])|[A-Z]?[a-z]+|[A-Z]+|\d+", part)
+        merged = []
+        for token in tokens:
+            if merged and (token.isdigit() or (merged[-1].islower() and token.isupper())):
+                # 'IVT0' and 'foxBMS' are one word
+                merged[-1] += token
+            else:
+                merged.append(token)
+        words.extend(merged)
+    return words
+
+
+def upper_name(name):
+    """'foxBMS_PackValues' -> 'FOXBMS_PACK_VALUES'"""
+    return "_".join(word.upper() for word in split_name(name))
+
+
+def camel_name(name):
+    """'foxBMS_PackValues' -> 'FoxbmsPackValues'"""
+    return "".join(word.capitalize() for word in split_name(name))
+
+
+def c_hex(value):
+    """formats a mask as unsigned C literal"""
+    if value > 0xFFFFFFFF:
+        return f"0x{value:X}ull"
+    return f"0x{value:X}u"
+
+
+class Signal:  # pylint: disable=too-many-instance-attributes
+    """signal of a DBC message"""
+
+    def __init__(self, match):
+        self.name = match.group(1)
+        mux = match.group(2)
+        self.is_multiplexer = mux == "M"
+        self.mux_value = int(mux[1:]) if (mux and not self.is_multiplexer) else None
+        self.start = int(match.group(3))
+        self.length = int(match.group(4))
+        self.is_big_endian = match.group(5) == "0"
+        self.is_signed = match.group(6) == "-"
+        self.factor = Fraction(match.group(7)).limit_denominator(1000000)
+        self.offset = Fraction(match.group(8)).limit_denominator(1000000)
+        self.unit = match.group(9)
+        if not 0 < self.length <= 64:
+            sys.exit(f"signal {self.name}: invalid length {self.length}")
+
+    def layout(self):
+        """position of the signal in the frame"""
+        return (self.start, self.length, self.is_big_endian, self.is_signed)
+
+    def frame_bits(self):
+        """returns the bits (byte * 8 + bit) of the frame used by the signal"""
+        bits = []
+        bit = self.start
+        for _ in range(self.length):
+            bits.append(bit)
+            if self.is_big_endian:
+                bit = bit + 15 if bit % 8 == 0 else bit - 1
+            else:
+                bit += 1
+        return bits
+
+    def shift(self):
+        """shift of the signal in the little endian or big endian 64-bit
+        representation of the frame"""
+        if not self.is_big_endian:
+            return self.start
+        msb = (7 - self.start // 8) * 8 + self.start % 8
+        return msb - self.length + 1
+
+    def mask(self):
+        """mask of the signal after shifting"""
+        return (1 << self.length) - 1
+
+    def c_type(self):
+        """smallest C type that holds the raw value"""
+        for width in (8, 16, 32, 64):
+            if self.length <= width:
+                return f"int{width}_t" if self.is_signed else f"uint{width}_t"
+        return None
+
+    def is_scaled(self):
+        """whether the physical value differs from the raw value"""
+        return self.factor != 1 or self.offset != 0
+
+    def dbc_text(self):
+        """layout as in the DBC file"""
+        order = "0" if self.is_big_endian else "1"
+        sign = "-" if self.is_signed else "+"
+        return f"{self.start}|{self.length}@{order}{sign}"
+
+
+class Message:
+    """message of the DBC file"""
+
+    def __init__(self, match):
+        self.id = int(match.group(1))
+        self.name = match.group(2)
+        self.dlc = int(match.group(3))
+        self.signals = []
+
+    @property
+    def upper(self):
+        """name of the message in macros and types"""
+        return upper_name(self.name)
+
+    @property
+    def camel(self):
+        """name of the message in function names"""
+        return camel_name(self.name)
+
+    @property
+    def type_name(self):
+        """name of the struct that holds the signals"""
+        return f"CAN_{self.upper}_SIGNALS_s"
+
+    @property
+    def multiplexer(self):
+        """the multiplexer signal of the message, None if not multiplexed"""
+        for signal in self.signals:
+            if signal.is_multiplexer:
+                return signal
+        return None
+
+    def mux_values(self):
+        """sorted multiplexer values"""
+        return sorted({s.mux_value for s in self.signals if s.mux_value is not None})
+
+    def fields(self):
+        """signals that are members of the struct: all signals of not
+        multiplexed messages, the multiplexer and the signals of the first
+        multiplexer value of multiplexed messages"""
+        if self.multiplexer is None:
+            return list(self.signals)
+        first = self.mux_values()[0]
+        return [self.multiplexer] + [s for s in self.signals if s.mux_value == first]
+
+    def validate(self):
+        """checks the message for layouts the codec does not support"""
+        if not 0 <= self.dlc <= MAXIMUM_DLC:
+            sys.exit(f"{self.name}: invalid DLC {self.dlc}")
+        if self.multiplexer is not None:
+            values = self.mux_values()
+            if values != list(range(len(values))):
+                sys.exit(f"{self.name}: multiplexer values have to be 0 to n-1")
+            reference = sorted(s.layout() for s in self.signals if s.mux_value == 0)
+            for value in values:
+                layout = sorted(s.layout() for s in self.signals if s.mux_value == value)
+                if layout != reference:
+                    sys.exit(f"{self.name}: multiplexer {value} has a different layout")
+            if (1 << self.multiplexer.length) < len(values):
+                sys.exit(f"{self.name}: multiplexer too short")
+        used = set()
+        for signal in self.fields():
+            bits = set(signal.frame_bits())
+            if min(bits) < 0 or max(bits) >= self.dlc * 8:
+                sys.exit(f"{self.name}: {signal.name} exceeds the DLC")
+            if used & bits:
+                sys.exit(f"{self.name}: {signal.name} overlaps another signal")
+            used |= bits
+        names = [s.name for s in self.fields()]
+        if len(names) != len(set(names)):
+            sys.exit(f"{self.name}: duplicate signal names")
+
+    def used_mask(self):
+        """mask of all bits used by the struct members in the little endian
+        representation of the frame"""
+        mask = 0
+        for signal in self.fields():
+            for bit in signal.frame_bits():
+                mask |= 1 << bit
+        return mask
+
+
+def parse_dbc(path):
+    """reads the messages of a DBC file"""
+    messages = []
+    with open(path, "r", encoding="ascii") as f:
+        for line in f:
+            match = RE_MESSAGE.match(line)
+            if match:
+                messages.append(Message(match))
+                continue
+            match = RE_SIGNAL.match(line)
+            if match:
+                if not messages:
+                    sys.exit("signal without message")
+                messages[-1].signals.append(Signal(match))
+    messages = [m for m in messages if m.signals]
+    for message in messages:
+        message.validate()
+    return messages
+
+
+def file_header(filename, ingroup, brief, details):
+    """doxygen file header of a generated file"""
+    lines = [
+        LICENSE,
+        "/**",
+        f" * @file    {filename}",
+        " * @author  foxBMS Team",
+        f" * @date    {FILE_DATE} (date of creation)",
+        f" * @updated {FILE_DATE} (date of last update)",
+        f" * @ingroup {ingroup}",
+        f" * @prefix  {'CAN' if ingroup == 'DRIVERS' else 'TEST'}",
+        " *",
+        f" * @brief   {brief}",
+        " *",
+    ]
+    for i, line in enumerate(details):
+        lines.append((" * @details " if i == 0 else " *          ") + line)
+    lines += [" *", " */", ""]
+    return "\n".join(lines)
+
+
+def aligned(rows, indent="    "):
+    """aligns the trailing comments of declarations"""
+    width = max(len(row[0]) for row in rows)
+    return [f"{indent}{code.ljust(width)} {comment}" for code, comment in rows]
+
+
+def wrap(lines):
+    """wraps lines that exceed the column limit like clang-format: the
+    arguments of a call or declaration are put on separate lines, otherwise
+    the line is broken after the assignment"""
+    out = []
+    for line in lines:
+        stripped = line.lstrip(" ")
+        if len(line) <= COLUMN_LIMIT or stripped.startswith(("/*", "*")):
+            out.append(line)
+            continue
+        indent = " " * (len(line) - len(stripped))
+        start = line.find("(")
+        if start > 0 and (line[start - 1].isalnum() or line[start - 1] == "_"):
+            depth = 0
+            arguments = []
+            begin = start + 1
+            for i in range(start, len(line)):
+                if line[i] == "(":
+                    depth += 1
+                elif line[i] == ")":
+                    depth -= 1
+                    if depth == 0:
+                        arguments.append(line[begin:i].strip())
+                        end = i
+                        break
+                elif line[i] == "," and depth == 1:
+                    arguments.append(line[begin:i].strip())
+                    begin = i + 1
+            out.append(line[: start + 1])
+            for argument in arguments[:-1]:
+                out.append(f"{indent}    {argument},")
+            out.append(f"{indent}    {arguments[-1]}{line[end:]}")
+        elif " = " in line:
+            lhs, rhs = line.split(" = ", 1)
+            out += [f"{lhs} =", f"{indent}    {rhs}"]
+        else:
+            out.append(line)
+    return out
+
+
+def field_comment(signal):
+    """doxygen comment of a struct member"""
+    if signal.is_multiplexer:
+        text = "multiplexer"
+    else:
+        text = "raw value"
+    if signal.factor != 1:
+        text += f", factor {float(signal.factor):g}"
+    if signal.offset != 0:
+        text += f", offset {float(signal.offset):g}"
+    if signal.unit:
+        text += f", unit {signal.unit}"
+    return f"/*!< {text} */"
+
+
+def generate_header(messages):
+    """content of can_codec.h"""
+    out = [
+        file_header(
+            "can_codec.h",
+            "DRIVERS",
+            "Pack and unpack functions of the CAN messages",
+            [
+                "This file is generated from tools/dbc/foxbms.dbc by",
+                "tools/dbc/can_codec_generator.py, do not edit it.",
+                "The structs hold the raw values of the signals. The physical",
+                "value of a scaled signal is",
+                "raw * FACTOR_NUMERATOR / FACTOR_DENOMINATOR + OFFSET.",
+                "The members of multiplexed messages are named after the signals",
+                "of multiplexer value 0, all multiplexer values have the same",
+                "layout.",
+            ],
+        ),
+        "#ifndef FOXBMS__CAN_CODEC_H_",
+        "#define FOXBMS__CAN_CODEC_H_",
+        "",
+        section("Includes"),
+        '#include "general.h"',
+        "",
+        section("Macros and Definitions"),
+        "",
+    ]
+    for message in messages:
+        out.append(f"/** ID, DLC and scaling of {message.name} @{{ */")
+        out.append(f"#define CAN_{message.upper}_ID ({c_hex(message.id)})")
+        out.append(f"#define CAN_{message.upper}_DLC ({message.dlc}u)")
+        if message.multiplexer is not None:
+            out.append(f"#define CAN_{message.upper}_NUMBER_OF_MUX_VALUES ({len(message.mux_values())}u)")
+        for signal in message.fields():
+            if not signal.is_scaled():
+                continue
+            prefix = f"CAN_{message.upper}_{upper_name(signal.name)}"
+            denominator = signal.factor.denominator * signal.offset.denominator
+            out.append(f"#define {prefix}_FACTOR_NUMERATOR ({int(signal.factor * denominator)})")
+            out.append(f"#define {prefix}_FACTOR_DENOMINATOR ({denominator})")
+            out.append(f"#define {prefix}_OFFSET ({int(signal.offset * denominator)})")
+        out.append("/**@}*/")
+        out.append("")
+    for message in messages:
+        out.append(f"/** raw signal values of {message.name} */")
+        out.append(f"typedef struct CAN_{message.upper}_SIGNALS {{")
+        rows = [(f"{s.c_type()} {s.name};", field_comment(s)) for s in message.fields()]
+        out += aligned(rows)
+        out.append(f"}} {message.type_name};")
+        out.append("")
+    out += [section("Extern Constant and Variable Declarations"), "", section("Extern Function Prototypes")]
+    for message in messages:
+        out += [
+            "",
+            "/**",
+            f" * @brief   Packs the signals of {message.name} into the CAN data.",
+            " * @param[in]   pSignals    raw signal values",
+            f" * @param[out]  pCanData    CAN data, only the first {message.dlc} bytes are written",
+            " */",
+            f"extern void CAN_Pack{message.camel}(const {message.type_name} *pSignals, uint8_t *pCanData);",
+            "",
+            "/**",
+            f" * @brief   Unpacks the signals of {message.name} from the CAN data.",
+            f" * @param[in]   pCanData    CAN data, only the first {message.dlc} bytes are read",
+            " * @param[out]  pSignals    raw signal values",
+            " */",
+            f"extern void CAN_Unpack{message.camel}(const uint8_t *pCanData, {message.type_name} *pSignals);",
+        ]
+    out += [
+        "",
+        section("Externalized Static Functions Prototypes (Unit Test)"),
+        "",
+        "#endif /* FOXBMS__CAN_CODEC_H_ */",
+        "",
+    ]
+    return "\n".join(wrap(out))
+
+
+def word_name(signal):
+    """name of the 64-bit representation of the frame that holds the signal"""
+    return "messageBigEndian" if signal.is_big_endian else "messageLittleEndian"
+
+
+def generate_pack(message):
+    """pack function of a message"""
+    fields = message.fields()
+    words = sorted({word_name(s) for s in fields})
+    out = [
+        f"extern void CAN_Pack{message.camel}(const {message.type_name} *pSignals, uint8_t *pCanData) {{",
+        "    FAS_ASSERT(pSignals != NULL_PTR);",
+        "    FAS_ASSERT(pCanData != NULL_PTR);",
+    ]
+    out += aligned([(f"uint64_t {word}", "= 0u;") for word in words])
+    out.append("")
+    for signal in fields:
+        value = f"((uint64_t)pSignals->{signal.name} & {c_hex(signal.mask())})"
+        out.append(f"    /* {signal.name}: {signal.dbc_text()} */")
+        out.append(f"    {word_name(signal)} |= {value} << {signal.shift()}u;")
+    out.append("")
+    for byte in range(message.dlc):
+        parts = []
+        if "messageLittleEndian" in words:
+            parts.append(f"(messageLittleEndian >> {8 * byte}u)")
+        if "messageBigEndian" in words:
+            parts.append(f"(messageBigEndian >> {56 - 8 * byte}u)")
+        out.append(f"    pCanData[{byte}] = (uint8_t)({' | '.join(parts)});")
+    out.append("}")
+    return out
+
+
+def generate_unpack(message):
+    """unpack function of a message"""
+    fields = message.fields()
+    words = sorted({word_name(s) for s in fields})
+    out = [
+        f"extern void CAN_Unpack{message.camel}(const uint8_t *pCanData, {message.type_name} *pSignals) {{",
+        "    FAS_ASSERT(pCanData != NULL_PTR);",
+        "    FAS_ASSERT(pSignals != NULL_PTR);",
+    ]
+    rows = []
+    for word in words:
+        parts = []
+        for byte in range(message.dlc):
+            shift = 8 * byte if word == "messageLittleEndian" else 56 - 8 * byte
+            parts.append(f"((uint64_t)pCanData[{byte}] << {shift}u)")
+        rows.append((f"const uint64_t {word}", "= " + " | ".join(parts) + ";"))
+    width = max(len(code) for code, _ in rows)
+    for code, assignment in rows:
+        line = f"    {code.ljust(width)} {assignment}"
+        if len(line) <= COLUMN_LIMIT:
+            out.append(line)
+            continue
+        # one byte per line, as formatted by clang-format
+        terms = assignment[2:-1].split(" | ")
+        out.append(f"    {code} =")
+        for i, term in enumerate(terms):
+            suffix = ";" if i == len(terms) - 1 else " |"
+            out.append(f"        {term}{suffix}")
+    out.append("")
+    for signal in fields:
+        raw = f"(({word_name(signal)} >> {signal.shift()}u) & {c_hex(signal.mask())})"
+        out.append(f"    /* {signal.name}: {signal.dbc_text()} */")
+        if signal.is_signed and signal.length < 64:
+            sign = c_hex(1 << (signal.length - 1))
+            raw = f"(int64_t)(({raw} ^ {sign}) - {sign})"
+        out.append(f"    pSignals->{signal.name} = ({signal.c_type()}){raw};")
+    out.append("}")
+    return out
+
+
+def generate_source(messages):
+    """content of can_codec.c"""
+    out = [
+        file_header(
+            "can_codec.c",
+            "DRIVERS",
+            "Pack and unpack functions of the CAN messages",
+            [
+                "This file is generated from tools/dbc/foxbms.dbc by",
+                "tools/dbc/can_codec_generator.py, do not edit it.",
+                "Each signal is copied with a constant shift and mask from or to",
+                "the little endian (Intel) or big endian (Motorola)",
+                "representation of the CAN data as 64-bit value.",
+            ],
+        ),
+        section("Includes"),
+        '#include "can_codec.h"',
+        "",
+        section("Macros and Definitions"),
+        "",
+        section("Static Constant and Variable Definitions"),
+        "",
+        section("Extern Constant and Variable Definitions"),
+        "",
+        section("Static Function Prototypes"),
+        "",
+        section("Static Function Implementations"),
+        "",
+        section("Extern Function Implementations"),
+    ]
+    for message in messages:
+        out.append("")
+        out += generate_pack(message)
+        out.append("")
+        out += generate_unpack(message)
+    out += [
+        "",
+        section("Externalized Static Function Implementations (Unit Test)"),
+        "",
+    ]
+    return "\n".join(wrap(out))
+
+
+def generate_test(messages):
+    """content of test_can_codec.c"""
+    out = [
+        file_header(
+            "test_can_codec.c",
+            "UNIT_TEST_IMPLEMENTATION",
+            "Round trip tests of the CAN codecs against the DBC file",
+            [
+                "This file is generated from tools/dbc/foxbms.dbc by",
+                "tools/dbc/can_codec_generator.py, do not edit it.",
+                "Every message is packed with random raw values. Each signal is",
+                "read back from the CAN data with the bit numbering of the DBC",
+                "file, the unused bits have to stay zero and unpacking has to",
+                "return the packed values.",
+            ],
+        ),
+        section("Includes"),
+        '#include "unity.h"',
+        "",
+        '#include "can_codec.h"',
+        "",
+        section("Definitions and Implementations for Unit Test"),
+        "/** number of random values that are packed per message */",
+        f"#define TEST_ROUNDS ({TEST_ROUNDS}u)",
+        "",
+        "/** state of the pseudo random number generator */",
+        "static uint64_t testRandomState = 0u;",
+        "",
+        "/** returns a random raw value of a signal (round 0: all bits set, round 1: zero) */",
+        "static int64_t TEST_GetRandomRaw(uint8_t round, uint8_t length, bool isSigned) {",
+        "    uint64_t raw = 0u;",
+        "    if (round == 0u) {",
+        "        raw = UINT64_MAX;",
+        "    } else if (round > 1u) {",
+        "        /* xorshift64 */",
+        "        testRandomState ^= testRandomState << 13u;",
+        "        testRandomState ^= testRandomState >> 7u;",
+        "        testRandomState ^= testRandomState << 17u;",
+        "        raw = testRandomState;",
+        "    }",
+        "    if (length < 64u) {",
+        "        raw &= (1ull << length) - 1u;",
+        "        if (isSigned && (((raw >> (length - 1u)) & 1u) == 1u)) {",
+        "            raw |= UINT64_MAX << length;",
+        "        }",
+        "    }",
+        "    return (int64_t)raw;",
+        "}",
+        "",
+        "/**",
+        " * reads a signal bit by bit from the CAN data with the bit numbering of",
+        " * the DBC file: the start bit is the least significant bit of little",
+        " * endian signals and the most significant bit of big endian signals",
+        " */",
+        "static int64_t TEST_GetDbcSignal(",
+        "    const uint8_t *pCanData,",
+        "    uint8_t startBit,",
+        "    uint8_t length,",
+        "    bool isBigEndian,",
+        "    bool isSigned) {",
+        "    uint64_t raw = 0u;",
+        "    uint8_t bit  = startBit;",
+        "    for (uint8_t i = 0u; i < length; i++) {",
+        "        const uint64_t value = (pCanData[bit / 8u] >> (bit % 8u)) & 1u;",
+        "        if (isBigEndian) {",
+        "            raw = (raw << 1u) | value;",
+        "            /* continue with the most significant bit of the next byte */",
+        "            bit = ((bit % 8u) == 0u) ? (bit + 15u) : (bit - 1u);",
+        "        } else {",
+        "            raw |= value << i;",
+        "            bit++;",
+        "        }",
+        "    }",
+        "    if (isSigned && (length < 64u) && (((raw >> (length - 1u)) & 1u) == 1u)) {",
+        "        raw |= UINT64_MAX << length;",
+        "    }",
+        "    return (int64_t)raw;",
+        "}",
+        "",
+        "/** returns the CAN data as little endian 64-bit value */",
+        "static uint64_t TEST_GetFrame(const uint8_t *pCanData) {",
+        "    uint64_t frame = 0u;",
+        "    for (uint8_t i = 0u; i < 8u; i++) {",
+        "        frame |= (uint64_t)pCanData[i] << (8u * i);",
+        "    }",
+        "    return frame;",
+        "}",
+        "",
+        section("Setup and Teardown"),
+        "void setUp(void) {",
+        "    testRandomState = 0x2545F4914F6CDD1Dull;",
+        "}",
+        "",
+        "void tearDown(void) {",
+        "}",
+        "",
+        section("Test Cases"),
+    ]
+    for message in messages:
+        fields = message.fields()
+        out += [
+            f"void testRoundTrip{message.camel}(void) {{",
+            f"    {message.type_name} sent     = {{0}};",
+            f"    {message.type_name} received = {{0}};",
+            "    uint8_t canData[8]  = {0};",
+            "",
+            "    for (uint8_t round = 0u; round < TEST_ROUNDS; round++) {",
+        ]
+        for signal in fields:
+            if signal.is_multiplexer:
+                out.append(
+                    f"        sent.{signal.name} = ({signal.c_type()})(round % "
+                    f"CAN_{message.upper}_NUMBER_OF_MUX_VALUES);"
+                )
+                continue
+            sign = "true" if signal.is_signed else "false"
+            out.append(
+                f"        sent.{signal.name} = ({signal.c_type()})TEST_GetRandomRaw(round, "
+                f"{signal.length}u, {sign});"
+            )
+        out += [
+            "        for (uint8_t i = 0u; i < 8u; i++) {",
+            "            canData[i] = 0u;",
+            "        }",
+            f"        CAN_Pack{message.camel}(&sent, canData);",
+            "",
+        ]
+        for signal in fields:
+            big = "true" if signal.is_big_endian else "false"
+            sign = "true" if signal.is_signed else "false"
+            out += [
+                f"        /* {signal.name}: {signal.dbc_text()} */",
+                f"        TEST_ASSERT_EQUAL_INT64((int64_t)sent.{signal.name}, "
+                f"TEST_GetDbcSignal(canData, {signal.start}u, {signal.length}u, {big}, {sign}));",
+            ]
+        unused = ((1 << 64) - 1) & ~message.used_mask()
+        out += [
+            "        /* bits that are not used by a signal stay zero */",
+            f"        TEST_ASSERT_EQUAL_HEX64(0u, TEST_GetFrame(canData) & {c_hex(unused)});",
+            "",
+            f"        CAN_Unpack{message.camel}(canData, &received);",
+        ]
+        for signal in fields:
+            out.append(f"        TEST_ASSERT_EQUAL_INT64((int64_t)sent.{signal.name}, (int64_t)received.{signal.name});")
+        out += ["    }", "}", ""]
+    return "\n".join(wrap(out))
+
+
+def write_or_check(path, content, check):
+    """writes a generated file or checks that it is up to date"""
+    if check:
+        try:
+            with open(path, "r", encoding="ascii") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = ""
+        if current != content:
+            diff = difflib.unified_diff(
+                current.splitlines(), content.splitlines(), path, "generated", lineterm=""
+            )
+            logging.error("\n".join(list(diff)[:40]))
+            return False
+        return True
+    with open(path, "w", encoding="ascii", newline="\n") as f:
+        f.write(content)
+    logging.info("wrote %s", path)
+    return True
+
+
+def main():
+    """generates the CAN codec and its unit test from the DBC file"""
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("-i", "--dbc", default=DEFAULT_DBC, help="DBC file")
+    parser.add_argument("--source-dir", default=DEFAULT_SOURCE_DIR, help="directory of can_codec.[ch]")
+    parser.add_argument("--test-dir", default=DEFAULT_TEST_DIR, help="directory of test_can_codec.c")
+    parser.add_argument(
+        "--check",
+        action="store_true",
+        help="only check that the generated files match the DBC file",
+    )
+    parser.add_argument(
+        "-v",
+        "--verbosity",
+        dest="verbosity",
+        action="count",
+        default=0,
+        help="set verbosity level",
+    )
+    args = parser.parse_args()
+
+    if args.verbosity == 1:
+        logging.basicConfig(level=logging.INFO)
+    elif args.verbosity > 1:
+        logging.basicConfig(level=logging.DEBUG)
+    else:
+        logging.basicConfig(level=logging.ERROR)
+    logging.debug(args)
+
+    messages = parse_dbc(args.dbc)
+    files = [
+        (os.path.join(args.source_dir, "can_codec.h"), generate_header(messages)),
+        (os.path.join(args.source_dir, "can_codec.c"), generate_source(messages)),
+        (os.path.join(args.test_dir, "test_can_codec.c"), generate_test(messages)),
+    ]
+    ok = True
+    for path, content in files:
+        ok = write_or_check(path, content, args.check) and ok
+    if not ok:
+        sys.exit("generated CAN codec is outdated, run tools/dbc/can_codec_generator.py")
+
+
+if __name__ == "__main__":
+    main()
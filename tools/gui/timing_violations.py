@@ -0,0 +1,154 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+
+"""Decode the timing violations that are recorded by the system monitoring
+
+The BMS sends the recorded violations after it received the debug message
+with the command ``0xB0`` in the first byte, the command ``0xB1`` clears the
+record. Each violation is sent in the messages ``foxBMS_TimingViolation`` and
+``foxBMS_TimingViolationDurations``, the multiplexer value is the age of the
+violation, i.e., 0 for the newest one.
+
+This script reads a CAN log in the text format of the log parser
+(``<time> <id> <dlc> <byte 0> ... <byte 7>``, all values decimal) and prints
+the last received state of every recorded violation.
+"""
+
+import argparse
+import os
+import cantools
+
+__version__ = "0.0.1"
+
+TIMING_VIOLATION = "foxBMS_TimingViolation"
+TIMING_VIOLATION_DURATIONS = "foxBMS_TimingViolationDurations"
+
+TASK_NAMES = ["engine", "1ms", "10ms", "100ms", "algorithm 100ms"]
+
+
+def read_can_log(path):
+    """Yields the ID and the data of all frames of a CAN log"""
+    with open(path, "r", encoding="utf-8") as log:
+        for line in log:
+            fields = line.split()
+            if len(fields) < 3:
+                continue
+            try:
+                can_id = int(fields[1])
+                dlc = int(fields[2])
+                data = bytes(int(i) for i in fields[3 : 3 + dlc])
+            except ValueError:
+                # header or comment line
+                continue
+            yield can_id, data
+
+
+def decode_violations(frames, dbc):
+    """Decodes the timing violation messages, a later frame of the same age
+    replaces an earlier one"""
+    violation = dbc.get_message_by_name(TIMING_VIOLATION)
+    durations = dbc.get_message_by_name(TIMING_VIOLATION_DURATIONS)
+    violations = {}
+    for can_id, data in frames:
+        if can_id == violation.frame_id:
+            signals = violation.decode(data)
+            age = signals[f"{TIMING_VIOLATION}_Mux"]
+            entry = violations.setdefault(age, {"durations": {}})
+            entry["task"] = signals[f"Violation{age}_taskId"]
+            entry["timestamp"] = signals[f"Violation{age}_timestamp"]
+            entry["jitter"] = signals[f"Violation{age}_jitter"]
+        elif can_id == durations.frame_id:
+            signals = durations.decode(data)
+            age = signals[f"{TIMING_VIOLATION_DURATIONS}_Mux"]
+            entry = violations.setdefault(age, {"durations": {}})
+            for task, _ in enumerate(TASK_NAMES):
+                entry["durations"][task] = signals[f"Violation{age}_durationTask{task}"]
+    return violations
+
+
+def task_name(task):
+    """Returns the name of a task ID"""
+    if task is None:
+        return "?"
+    if task < len(TASK_NAMES):
+        return TASK_NAMES[task]
+    return str(task)
+
+
+def print_violations(violations):
+    """Prints the violations, the newest one first"""
+    if not violations:
+        print("no timing violations found")
+        return
+    header = ["age", "time (ms)", "task", "jitter (ms)"] + [
+        f"{name} (ms)" for name in TASK_NAMES
+    ]
+    print(" | ".join(header))
+    for age in sorted(violations):
+        entry = violations[age]
+        row = [
+            str(age),
+            str(entry.get("timestamp", "?")),
+            task_name(entry.get("task")),
+            str(entry.get("jitter", "?")),
+        ]
+        row += [
+            str(entry["durations"].get(task, "?")) for task, _ in enumerate(TASK_NAMES)
+        ]
+        print(" | ".join(row))
+
+
+def main():
+    """Decodes the timing violations of a CAN log"""
+    parser = argparse.ArgumentParser(description=__doc__.split("\n", 1)[0])
+    parser.add_argument("log", help="CAN log in the text format of the log parser")
+    parser.add_argument(
+        "--dbc",
+        default=os.path.join(
+            os.path.dirname(os.path.realpath(__file__)), "..", "dbc", "foxbms.dbc"
+        ),
+        help="DBC file that describes the timing violation messages",
+    )
+    args = parser.parse_args()
+
+    dbc = cantools.database.load_file(args.dbc)
+    print_violations(decode_violations(read_can_log(args.log), dbc))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,387 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+"""Generates the ADC voltage indexed temperature tables of the NTC sensors
+
+The temperature of an NTC sensor is calculated from the measured ADC voltage
+by calculating the NTC resistance of the resistor divider and interpolating
+the resistance LUT of the sensor. This script evaluates this calculation for
+uniformly spaced ADC voltages and generates a table per sensor into
+``src/app/driver/ts/<manufacturer>/<model>/<manufacturer>_<model>_adc-table.c``
+that is interpolated with integer arithmetic by ``TS_GetTemperatureFromAdcTable``.
+
+The LUT is read from ``<manufacturer>_<model>.c`` and the resistor divider
+from ``<manufacturer>_<model>.h``. The largest spacing (a power of two in mV)
+is chosen for which every millivolt of the operating range stays within
+``TS_ADC_TABLE_TOLERANCE_ddegC`` of the floating point calculation.
+
+The generated files are part of the repository. Run the script after changing
+a LUT or a resistor divider and use ``--check`` to verify that the generated
+files are up to date.
+"""
+
+import argparse
+import difflib
+import logging
+import os
+import re
+import struct
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+REPO_ROOT = os.path.realpath(os.path.join(SCRIPT_DIR, "..", ".."))
+DEFAULT_TS_DIR = os.path.join(REPO_ROOT, "src", "app", "driver", "ts")
+
+FILE_DATE = "2026-10-15"
+SECTION_WIDTH = 79
+
+#: has to match TS_ADC_TABLE_TEMPERATURE_SCALE in temperature_sensor_defs.h
+TEMPERATURE_SCALE = 16
+#: has to match TS_ADC_TABLE_TOLERANCE_ddegC in adc_table.h
+TOLERANCE_ddegC = 1
+#: largest spacing of the table entries is 2^MAXIMUM_STEP_SHIFT mV
+MAXIMUM_STEP_SHIFT = 6
+#: deviation of the floating point calculation from the exact calculation
+#: that is taken into account when checking the tolerance
+FLOAT_MARGIN_ddegC = 0.01
+ENTRIES_PER_LINE = 10
+
+#: sensors with a resistance LUT: (manufacturer, model)
+SENSORS = [
+    ("epcos", "b57251v5103j060"),
+    ("epcos", "b57861s0103f045"),
+    ("vishay", "ntcalug01a103g"),
+]
+
+LICENSE = """/**
+ *
+ * @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+ *  angewandten Forschung e.V. All rights reserved.
+ *
+ * BSD 3-Clause License
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ * 1.  Redistributions of source code must retain the above copyright notice,
+ *     this list of conditions and the following disclaimer.
+ * 2.  Redistributions in binary form must reproduce the above copyright notice,
+ *     this list of conditions and the following disclaimer in the documentation
+ *     and/or other materials provided with the distribution.
+ * 3.  Neither the name of the copyright holder nor the names of its
+ *     contributors may be used to endorse or promote products derived from this
+ *     software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ * We kindly request you to use one or more of the following phrases to refer to
+ * foxBMS in your hardware, software, documentation or advertising materials:
+ *
+ * &Prime;This product uses parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product includes parts of foxBMS&reg;&Prime;
+ *
+ * &Prime;This product is derived from foxBMS&reg;&Prime;
+ *
+ */
+"""
+
+RE_LUT = re.compile(r"TS_TEMPERATURE_SENSOR_LUT_s\s+(\w+)\[\]\s*=\s*\{(.*?)\};", re.S)
+RE_LUT_ENTRY = re.compile(r"\{\s*(-?\d+)\s*,\s*([0-9.]+)f?\s*\}")
+RE_DEFINE = re.compile(r"^#define\s+(TS_\w+)\s+\((\w+|[0-9.]+)f?\)", re.M)
+
+
+def f32(value):
+    """rounds a value to single precision like a float variable in C"""
+    return struct.unpack("f", struct.pack("f", value))[0]
+
+
+def c_div(numerator, denominator):
+    """integer division that truncates towards zero like in C"""
+    quotient = abs(numerator) // abs(denominator)
+    return quotient if (numerator >= 0) == (denominator >= 0) else -quotient
+
+
+def section(name):
+    """returns a section comment of the foxBMS coding guidelines"""
+    text = f"/*========== {name} "
+    return text + "=" * (SECTION_WIDTH - len(text) - 2) + "*/"
+
+
+class Sensor:  # pylint: disable=too-many-instance-attributes
+    """resistance LUT and resistor divider of a temperature sensor"""
+
+    def __init__(self, ts_dir, manufacturer, model):
+        self.manufacturer = manufacturer
+        self.model = model
+        self.directory = os.path.join(ts_dir, manufacturer, model)
+        self.base_name = f"{manufacturer}_{model}"
+        self.file_name = f"{self.base_name}_adc-table.c"
+        self.table_name = f"ts_{model}AdcTable"
+
+        with open(os.path.join(self.directory, f"{self.base_name}.c"), "r", encoding="utf-8") as f:
+            match = RE_LUT.search(f.read())
+        if not match:
+            sys.exit(f"could not find the LUT of {self.base_name}")
+        self.lut_name = match.group(1)
+        self.lut = [(int(t), float(r)) for t, r in RE_LUT_ENTRY.findall(match.group(2))]
+        if any(self.lut[i][1] <= self.lut[i + 1][1] for i in range(len(self.lut) - 1)):
+            sys.exit(f"LUT of {self.base_name} is not sorted by descending resistance")
+
+        with open(os.path.join(self.directory, f"{self.base_name}.h"), "r", encoding="utf-8") as f:
+            defines = dict(RE_DEFINE.findall(f.read()))
+        prefix = f"TS_{manufacturer.upper()}_{model.upper()}"
+        self.is_r_1 = defines[f"{prefix}_POSITION_IN_RESISTOR_DIVIDER_IS_R_1"] == "true"
+        self.supply_V = float(defines[f"{prefix}_RESISTOR_DIVIDER_SUPPLY_VOLTAGE_V"])
+        self.divider_Ohm = float(defines[f"{prefix}_RESISTOR_DIVIDER_RESISTANCE_R_1_R_2_Ohm"])
+        self.minimum_mV, self.maximum_mV = self.operating_range()
+
+    def operating_range(self):
+        """smallest and largest ADC voltage in mV that the floating point
+        calculation accepts (same single precision operations as the
+        TS_..._ADC_VOLTAGE_V_MIN_V/MAX_V defines)"""
+
+        def voltage(resistance_Ohm):
+            resistance_Ohm = f32(resistance_Ohm)
+            return f32(
+                f32(f32(self.supply_V) * resistance_Ohm) / f32(resistance_Ohm + f32(self.divider_Ohm))
+            )
+
+        limits = sorted((voltage(self.lut[0][1]), voltage(self.lut[-1][1])))
+        voltages = [(mV, f32(mV / 1000.0)) for mV in range(0, 65536)]
+        minimum_mV = min(mV for mV, v in voltages if v >= limits[0])
+        maximum_mV = max(mV for mV, v in voltages if v <= limits[1])
+        return minimum_mV, maximum_mV
+
+    def resistance(self, voltage_mV):
+        """NTC resistance of the resistor divider at an ADC voltage"""
+        voltage_V = voltage_mV / 1000.0
+        if self.is_r_1:
+            return self.divider_Ohm * ((self.supply_V / voltage_V) - 1.0)
+        return self.divider_Ohm * (voltage_V / (self.supply_V - voltage_V))
+
+    def temperature(self, voltage_mV):
+        """temperature in deci degree Celsius at an ADC voltage, the LUT is
+        interpolated linearly and extrapolated with the outermost segments"""
+        resistance_Ohm = self.resistance(voltage_mV)
+        segment = len(self.lut) - 2
+        for i in range(len(self.lut) - 1):
+            if resistance_Ohm >= self.lut[i + 1][1]:
+                segment = i
+                break
+        (t_high, r_high), (t_low, r_low) = self.lut[segment], self.lut[segment + 1]
+        slope = (t_low - t_high) / (r_low - r_high)
+        return t_high + slope * (resistance_Ohm - r_high)
+
+    def entries(self, step_shift):
+        """scaled temperatures at the grid points of a spacing"""
+        step = 1 << step_shift
+        count = -(-(self.maximum_mV - self.minimum_mV) // step) + 1
+        return [
+            round(self.temperature(self.minimum_mV + (i * step)) * TEMPERATURE_SCALE) for i in range(count)
+        ]
+
+    @staticmethod
+    def lookup(entries, step_shift, offset_mV):
+        """integer interpolation of TS_GetTemperatureFromAdcTable"""
+        index = offset_mV >> step_shift
+        remainder_mV = offset_mV - (index << step_shift)
+        scaled = entries[index]
+        if remainder_mV != 0:
+            scaled += c_div((entries[index + 1] - scaled) * remainder_mV, 1 << step_shift)
+        return c_div(scaled, TEMPERATURE_SCALE)
+
+    def deviation(self, entries, step_shift):
+        """largest deviation of the table from the truncated exact temperature"""
+        largest = 0
+        for voltage_mV in range(self.minimum_mV, self.maximum_mV + 1):
+            exact = self.temperature(voltage_mV)
+            result = self.lookup(entries, step_shift, voltage_mV - self.minimum_mV)
+            for reference in (exact - FLOAT_MARGIN_ddegC, exact + FLOAT_MARGIN_ddegC):
+                largest = max(largest, abs(result - int(reference)))
+        return largest
+
+    def table(self):
+        """entries and spacing of the table with the largest spacing that
+        stays within the tolerance"""
+        for step_shift in range(MAXIMUM_STEP_SHIFT, -1, -1):
+            entries = self.entries(step_shift)
+            deviation = self.deviation(entries, step_shift)
+            logging.debug("%s: step %d mV, deviation %d", self.base_name, 1 << step_shift, deviation)
+            if deviation <= TOLERANCE_ddegC:
+                return entries, step_shift
+        sys.exit(f"{self.base_name}: no table within {TOLERANCE_ddegC} ddegC")
+
+    def generate(self):
+        """content of the generated table file"""
+        entries, step_shift = self.table()
+        if any(not -32768 <= value <= 32767 for value in entries):
+            sys.exit(f"{self.base_name}: scaled temperatures do not fit into int16_t")
+        entries_name = f"{self.table_name}Temperatures"
+        lines = [
+            LICENSE,
+            "/**",
+            f" * @file    {self.file_name}",
+            " * @author  foxBMS Team",
+            f" * @date    {FILE_DATE} (date of creation)",
+            f" * @updated {FILE_DATE} (date of last update)",
+            " * @ingroup TEMPERATURE_SENSORS",
+            " * @prefix  TS",
+            " *",
+            f" * @brief   ADC voltage indexed temperature table of the {self.manufacturer} {self.model}",
+            " *",
+            f" * @details This file is generated from the LUT in {self.base_name}.c and",
+            f" *          the resistor divider in {self.base_name}.h by",
+            " *          tools/ts/ntc_table_generator.py, do not edit it.",
+            f" *          Operating range: {self.minimum_mV} mV to {self.maximum_mV} mV,"
+            f" spacing: {1 << step_shift} mV.",
+            " *",
+            " */",
+            "",
+            section("Includes"),
+            f'#include "{self.base_name}.h"',
+            "",
+            '#include "temperature_sensor_defs.h"',
+            "",
+            section("Macros and Definitions"),
+            "",
+            section("Static Constant and Variable Definitions"),
+            "",
+            "/* clang-format off */",
+            f"/** temperatures in 1/{TEMPERATURE_SCALE} deci &deg;C, spacing {1 << step_shift} mV */",
+            f"static const int16_t {entries_name}[{len(entries)}u] = {{",
+        ]
+        for i in range(0, len(entries), ENTRIES_PER_LINE):
+            chunk = entries[i : i + ENTRIES_PER_LINE]
+            lines.append("    " + " ".join(f"{value:6d}," for value in chunk))
+        lines += [
+            "};",
+            "/* clang-format on */",
+            "",
+            section("Extern Constant and Variable Definitions"),
+            f"const TS_ADC_TABLE_s {self.table_name} = {{",
+            f"    .minimumVoltage_mV = {self.minimum_mV}u,",
+            f"    .maximumVoltage_mV = {self.maximum_mV}u,",
+            f"    .stepShift         = {step_shift}u,",
+            f"    .nrOfEntries       = {len(entries)}u,",
+            f"    .pTemperatures     = {entries_name},",
+            "};",
+            "",
+            section("Static Function Prototypes"),
+            "",
+            section("Static Function Implementations"),
+            "",
+            section("Extern Function Implementations"),
+            "",
+            section("Externalized Static Function Implementations (Unit Test)"),
+            "",
+        ]
+        logging.info(
+            "%s: %d entries, spacing %d mV", self.base_name, len(entries), 1 << step_shift
+        )
+        return "\n".join(lines)
+
+
+def write_or_check(path, content, check):
+    """writes a generated file or checks that it is up to date"""
+    if check:
+        try:
+            with open(path, "r", encoding="ascii") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = ""
+        if current != content:
+            diff = difflib.unified_diff(
+                current.splitlines(), content.splitlines(), path, "generated", lineterm=""
+            )
+            logging.error("\n".join(list(diff)[:40]))
+            return False
+        return True
+    with open(path, "w", encoding="ascii", newline="\n") as f:
+        f.write(content)
+    logging.info("wrote %s", path)
+    return True
+
+
+def main():
+    """generates the ADC voltage indexed temperature tables"""
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--ts-dir", default=DEFAULT_TS_DIR, help="directory of the temperature sensors")
+    parser.add_argument(
+        "--check",
+        action="store_true",
+        help="only check that the generated tables match the LUTs",
+    )
+    parser.add_argument(
+        "-v",
+        "--verbosity",
+        dest="verbosity",
+        action="count",
+        default=0,
+        help="set verbosity level",
+    )
+    args = parser.parse_args()
+
+    if args.verbosity == 1:
+        logging.basicConfig(level=logging.INFO)
+    elif args.verbosity > 1:
+        logging.basicConfig(level=logging.DEBUG)
+    else:
+        logging.basicConfig(level=logging.ERROR)
+    logging.debug(args)
+
+    ok = True
+    for manufacturer, model in SENSORS:
+        sensor = Sensor(args.ts_dir, manufacturer, model)
+        path = os.path.join(sensor.directory, sensor.file_name)
+        ok = write_or_check(path, sensor.generate(), args.check) and ok
+    if not ok:
+        sys.exit("generated temperature tables are outdated, run tools/ts/ntc_table_generator.py")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,523 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+
+# @copyright &copy; 2010 - 2021, Fraunhofer-Gesellschaft zur Foerderung der
+#   angewandten Forschung e.V. All rights reserved.
+#
+# BSD 3-Clause License
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+# 1.  Redistributions of source code must retain the above copyright notice,
+#     this list of conditions and the following disclaimer.
+# 2.  Redistributions in binary form must reproduce the above copyright notice,
+#     this list of conditions and the following disclaimer in the documentation
+#     and/or other materials provided with the distribution.
+# 3.  Neither the name of the copyright holder nor the names of its
+#     contributors may be used to endorse or promote products derived from this
+#     software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+# We kindly request you to use one or more of the following phrases to refer to
+# foxBMS in your hardware, software, documentation or advertising materials:
+#
+# &Prime;This product uses parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product includes parts of foxBMS&reg;&Prime;
+#
+# &Prime;This product is derived from foxBMS&reg;&Prime;
+
+"""Implements a waf tool to build the software-in-the-loop (SIL) binary of
+foxBMS.
+
+The SIL binary runs the embedded application on a Linux host: FreeRTOS runs
+on its POSIX port, the HALCoGen generated hardware abstraction layer is
+replaced by the simulated peripherals in ``src/sil``. The embedded sources are
+compiled with the host gcc, therefore this tool uses its own compile and link
+tasks instead of the TI ARM CGT tasks of :py:mod:`f_ti_arm_cgt`.
+
+The CAN log replay (``src/sil/replay``) uses the same tasks, but does not need
+the POSIX port, as it replaces the FreeRTOS kernel.
+
+The micro-benchmark of the hot kernels (``src/sil/bench``) is built with the
+same tasks and compared with its baseline if ``--bench`` is passed.
+
+The stress test of the sequence locked database access (``src/sil/stress``) is
+built with the same tasks and run in every build.
+"""
+
+import json
+import os
+import subprocess
+import urllib.request
+
+from waflib import Logs, Task, TaskGen, Utils
+from waflib.Tools import c_preproc
+
+FREERTOS_POSIX_PORT = os.path.join(
+    "src", "os", "freertos", "portable", "thirdparty", "gcc", "posix"
+)
+"""location of the FreeRTOS POSIX port (FreeRTOS-Kernel V10.4.3,
+``portable/ThirdParty/GCC/Posix``) in the repository"""
+
+FREERTOS_POSIX_PORT_URL = (
+    "https://raw.githubusercontent.com/FreeRTOS/FreeRTOS-Kernel/V10.4.3/"
+    "portable/ThirdParty/GCC/Posix"
+)
+"""location from which ``--sil-fetch-port`` downloads the FreeRTOS POSIX
+port"""
+
+FREERTOS_POSIX_PORT_FILES = [
+    "port.c",
+    "portmacro.h",
+    "utils/wait_for_event.c",
+    "utils/wait_for_event.h",
+]
+"""files of the FreeRTOS POSIX port, relative to
+:py:data:`FREERTOS_POSIX_PORT_URL`"""
+
+
+class sil_c(Task.Task):  # pylint: disable=invalid-name,too-few-public-methods
+    """compiles a C source file of the SIL binary with the host compiler"""
+
+    #: str: color in which the command line is displayed in the terminal
+    color = "GREEN"
+
+    run_str = (
+        "${SIL_CC} ${SIL_CFLAGS} ${SIL_CPPPATH_ST:SIL_INCPATHS} "
+        "${SIL_DEFINES_ST:SIL_DEFINES} -c ${SRC} -o ${TGT[0].abspath()}"
+    )
+    """str: string to be interpolated to create the command line to compile
+    C sources for the SIL binary"""
+
+    #: list of str: extensions that trigger a re-build
+    ext_in = [".h"]
+
+    #: fun: function to be used as scanner method
+    scan = c_preproc.scan
+
+    def keyword(self):  # pylint: disable=no-self-use
+        """displayed keyword when C sources are compiled"""
+        return "Compiling"
+
+
+class sil_link(Task.Task):  # pylint: disable=invalid-name,too-few-public-methods
+    """links the objects of the SIL binary with the host compiler"""
+
+    #: str: color in which the command line is displayed in the terminal
+    color = "YELLOW"
+
+    run_str = (
+        "${SIL_CC} ${SIL_LINKFLAGS} ${SRC} -o ${TGT[0].abspath()} "
+        "${SIL_LIB_ST:SIL_LIB}"
+    )
+    """str: string to be interpolated to create the command line to link the
+    SIL binary"""
+
+    def keyword(self):  # pylint: disable=no-self-use
+        """displayed keyword when the SIL binary is linked"""
+        return "Linking"
+
+
+class sil_replay(Task.Task):  # pylint: disable=invalid-name
+    """replays a CAN log with the CAN log replay, checks the content of the
+    trace of the sent messages and compares it with the reference trace"""
+
+    #: str: color in which the command line is displayed in the terminal
+    color = "BLUE"
+
+    #: list: the options and the expected content change the result
+    vars = ["REPLAY_OPTIONS", "REPLAY_CELL_VOLTAGE_IDS", "REPLAY_CELL_VOLTAGE_mV"]
+
+    def check(self, trace):
+        """checks the content of the trace, so that a reference trace that was
+        updated with a broken replay is not accepted: the time has to advance,
+        the timestamps of the cell voltages and of the state estimation in the
+        state lines have to advance and the last cell voltage messages have to
+        report the expected cell voltage (10 bit per cell, 5 mV per bit,
+        offset -2500 mV)."""
+        errors = []
+        times, states, last = [], [], {}
+        for line in trace.read().splitlines():
+            if line.startswith(";   State "):
+                # ";   State <t> ms: ..., cell voltages <t> ms, SOX <t> ms"
+                fields = line.replace(",", "").split()
+                states.append((int(fields[-5]), int(fields[-2])))
+            elif line and not line.startswith(";"):
+                fields = line.split()
+                times.append(float(fields[1]))
+                last[int(fields[3], 16)] = bytes.fromhex("".join(fields[6:]))
+        if not times or times != sorted(times) or times[0] == times[-1]:
+            errors.append("the time of the messages does not advance")
+        for i, name in enumerate(("cell voltages", "state estimation")):
+            stamps = [state[i] for state in states]
+            if len(stamps) < 2 or stamps != sorted(stamps) or stamps[0] == stamps[-1]:
+                errors.append(f"the timestamp of the {name} does not advance")
+        for message_id in self.env.REPLAY_CELL_VOLTAGE_IDS:
+            data = last.get(message_id, b"")
+            raw = int.from_bytes(data, "little")
+            voltages_mV = [
+                ((raw >> (10 * i)) & 0x3FF) * 5 - 2500
+                for i in range(len(data) * 8 // 10)
+            ]
+            if not voltages_mV or any(
+                v != self.env.REPLAY_CELL_VOLTAGE_mV for v in voltages_mV
+            ):
+                errors.append(
+                    f"message 0x{message_id:03X} reports {voltages_mV} mV "
+                    f"instead of {self.env.REPLAY_CELL_VOLTAGE_mV} mV"
+                )
+        for error in errors:
+            Logs.error(f"{trace.abspath()}: {error}.")
+        return len(errors)
+
+    def run(self):
+        """runs the replay, checks the content of the trace and compares it
+        byte by byte with the reference trace, as the replay is
+        deterministic"""
+        binary, log, reference = self.inputs
+        trace = self.outputs[0]
+        cmd = [binary.abspath(), "-o", trace.abspath()]
+        cmd.extend(self.env.REPLAY_OPTIONS)
+        ret = self.exec_command(cmd + [log.abspath()])
+        if ret:
+            return ret
+        if self.check(trace):
+            return 1
+        if trace.read() != reference.read():
+            Logs.error(
+                f"The trace {trace.abspath()} of {log.relpath()} differs from "
+                f"the reference trace {reference.relpath()}."
+            )
+            return 1
+        return 0
+
+    def keyword(self):  # pylint: disable=no-self-use
+        """displayed keyword when a CAN log is replayed"""
+        return "Replaying"
+
+
+class sil_stress(Task.Task):  # pylint: disable=invalid-name
+    """runs the stress test of the sequence locked database access, which fails
+    if a read access fails or returns torn data"""
+
+    #: str: color in which the command line is displayed in the terminal
+    color = "BLUE"
+
+    run_str = "${SRC[0].abspath()} -o ${TGT[0].abspath()}"
+    """str: string to be interpolated to create the command line to run the
+    stress test"""
+
+    def keyword(self):  # pylint: disable=no-self-use
+        """displayed keyword when the stress test is run"""
+        return "Stressing"
+
+
+class sil_bench(Task.Task):  # pylint: disable=invalid-name
+    """runs the micro-benchmark and compares the median time per call of every
+    kernel with the baseline"""
+
+    #: str: color in which the command line is displayed in the terminal
+    color = "BLUE"
+
+    #: bool: the measurement depends on the host, it is repeated in every build
+    always_run = True
+
+    def measure(self, kernels=None):
+        """runs the micro-benchmark (only the given kernels, if any) and
+        returns its results"""
+        binary, results = self.inputs[0], self.outputs[0]
+        cmd = [binary.abspath(), "-o", results.abspath()]
+        if kernels:
+            cmd.extend(["-k", kernels])
+        # the table on the standard output is replaced by the comparison
+        if self.exec_command(cmd, stdout=subprocess.DEVNULL):
+            self.bld.fatal(f"The micro-benchmark {binary.relpath()} failed.")
+        return json.loads(results.read())
+
+    def run(self):
+        """runs the micro-benchmark and compares it with the baseline. A kernel
+        that is slower than allowed is measured again, up to ``--bench-runs``
+        times, and its best median is used, as single runs on a busy host
+        scatter. With ``--bench-update-baseline`` every kernel is measured
+        ``--bench-runs`` times and the best medians are the new baseline."""
+        baseline_node = self.inputs[1]
+        options = self.generator.bld.options
+        limit = 1 + options.bench_threshold / 100
+        baseline = json.loads(baseline_node.read())
+        results = self.measure()
+        kernels = results["kernels"]
+        for _ in range(1, options.bench_runs):
+            for name in list(kernels):
+                if options.bench_update_baseline or (
+                    name in baseline["kernels"]
+                    and kernels[name]["median_ns"]
+                    > baseline["kernels"][name]["median_ns"] * limit
+                ):
+                    again = self.measure(name)["kernels"]
+                    for other, value in again.items():
+                        if value["median_ns"] < kernels[other]["median_ns"]:
+                            kernels[other] = value
+        self.outputs[0].write(json.dumps(results, indent=2) + "\n")
+        if options.bench_update_baseline:
+            baseline_node.write(json.dumps(results, indent=2) + "\n")
+            Logs.warn(f"Updated the baseline {baseline_node.relpath()}.")
+            return 0
+        if baseline["host"] != results["host"]:
+            Logs.warn(
+                f"The baseline {baseline_node.relpath()} was measured on "
+                f"{baseline['host']}, this host is {results['host']}."
+            )
+        regressions = 0
+        for name, value in kernels.items():
+            if name not in baseline["kernels"]:
+                Logs.warn(f"{name} has no baseline.")
+                continue
+            reference = baseline["kernels"][name]["median_ns"]
+            change = (value["median_ns"] / reference - 1) * 100
+            message = (
+                f"{name}: {value['median_ns']:.2f} ns per call, baseline "
+                f"{reference:.2f} ns ({change:+.1f} %)"
+            )
+            if value["median_ns"] > reference * limit:
+                Logs.error(message)
+                regressions += 1
+            else:
+                Logs.info(message)
+        if regressions:
+            Logs.error(
+                f"{regressions} kernel(s) are more than {options.bench_threshold} % "
+                f"slower than the baseline {baseline_node.relpath()}."
+            )
+        return regressions
+
+    def keyword(self):  # pylint: disable=no-self-use
+        """displayed keyword when the micro-benchmark is run"""
+        return "Benchmarking"
+
+
+@TaskGen.feature("sil")
+@TaskGen.before_method("process_source")
+def add_sil_tasks(self):
+    """creates the compile tasks for all sources and the link task of the SIL
+    binary.
+
+    The sources are consumed here, as the ``.c`` extension is bound to the
+    TI ARM CGT compiler by :py:mod:`f_ti_arm_cgt`. The version information
+    file is generated by the task generator method of :py:mod:`f_ti_arm_cgt`
+    as for the target binary, unless ``version=False`` is passed (only one
+    task generator may generate it). ``defines`` are added to the defines of
+    the variant for this binary only."""
+    if getattr(self, "version", True):
+        self.create_version_file()
+    sources = self.to_nodes(getattr(self, "source", []))
+    self.source = []
+    self.env = self.env.derive()
+    self.includes_nodes = self.to_incnodes(self.to_list(getattr(self, "includes", [])))
+    self.env.SIL_INCPATHS = [i.abspath() for i in self.includes_nodes]
+    self.env.append_value("SIL_DEFINES", self.to_list(getattr(self, "defines", [])))
+    self.env.append_value("SIL_LINKFLAGS", self.to_list(getattr(self, "linkflags", [])))
+
+    objects = []
+    for source in sources:
+        obj = source.parent.find_or_declare(f"{source.name}.{self.idx}.o")
+        objects.append(self.create_task("sil_c", source, obj).outputs[0])
+    self.link_task = self.create_task(
+        "sil_link", objects, self.path.find_or_declare(self.target)
+    )
+
+
+@TaskGen.feature("sil_replay")
+def add_sil_replay_task(self):
+    """creates the task that replays the CAN log ``log`` with the replay
+    binary built by the task generator ``replay`` and the command line options
+    ``replay_options`` and compares the trace with the trace ``reference``.
+    The last messages with the identifiers ``cell_voltage_ids`` have to report
+    the cell voltage ``cell_voltage_mV``."""
+    replay = self.bld.get_tgen_by_name(self.replay)
+    replay.post()
+    log = self.path.find_resource(self.log)
+    reference = self.path.find_resource(self.reference)
+    if not log or not reference:
+        self.bld.fatal(f"Could not find {self.log} or {self.reference}.")
+    trace = self.path.find_or_declare(f"{log.name}.replay.trc")
+    self.env.REPLAY_OPTIONS = Utils.to_list(getattr(self, "replay_options", []))
+    self.env.REPLAY_CELL_VOLTAGE_IDS = list(self.cell_voltage_ids)
+    self.env.REPLAY_CELL_VOLTAGE_mV = self.cell_voltage_mV
+    self.create_task("sil_replay", [replay.link_task.outputs[0], log, reference], trace)
+
+
+@TaskGen.feature("sil_stress")
+def add_sil_stress_task(self):
+    """creates the task that runs the stress test built by the task generator
+    ``stress`` and writes its report"""
+    stress = self.bld.get_tgen_by_name(self.stress)
+    stress.post()
+    report = self.path.find_or_declare(f"{self.stress}.txt")
+    self.create_task("sil_stress", stress.link_task.outputs[0], report)
+
+
+@TaskGen.feature("sil_bench")
+def add_sil_bench_task(self):
+    """creates the task that runs the micro-benchmark built by the task
+    generator ``bench`` and compares its results with the baseline
+    ``baseline``."""
+    bench = self.bld.get_tgen_by_name(self.bench)
+    bench.post()
+    baseline = self.path.find_resource(self.baseline)
+    if not baseline:
+        self.bld.fatal(f"Could not find {self.baseline}.")
+    results = self.path.find_or_declare(f"{self.bench}.json")
+    self.create_task("sil_bench", [bench.link_task.outputs[0], baseline], results)
+
+
+def options(opt):
+    """Options of the :py:mod:`f_sil` tool. The options are
+
+    - ``--sil`` requires the SIL binary: configure fails if it cannot be
+      built, e.g., because the FreeRTOS POSIX port is missing,
+    - ``--sil-fetch-port`` downloads the FreeRTOS POSIX port if it is missing,
+    - ``--bench`` runs the micro-benchmark and compares it with the baseline,
+    - ``--bench-threshold=10`` is the allowed slow-down of a kernel in percent,
+    - ``--bench-runs=3`` is the largest number of runs of a slower kernel,
+    - ``--bench-update-baseline`` writes the results to the baseline instead
+      of comparing them.
+    """
+    opt.add_option(
+        "--sil",
+        action="store_true",
+        default=False,
+        dest="sil",
+        help="Fails the configuration if the software-in-the-loop binary "
+        "cannot be built",
+    )
+    opt.add_option(
+        "--sil-fetch-port",
+        action="store_true",
+        default=False,
+        dest="sil_fetch_port",
+        help="Downloads the FreeRTOS POSIX port if it is missing",
+    )
+    opt.add_option(
+        "--bench",
+        action="store_true",
+        default=False,
+        dest="bench",
+        help="Runs the micro-benchmark of the sil variant",
+    )
+    opt.add_option(
+        "--bench-threshold",
+        action="store",
+        type="float",
+        default=10.0,
+        dest="bench_threshold",
+        help="Allowed slow-down of a kernel against the baseline in percent",
+    )
+    opt.add_option(
+        "--bench-runs",
+        action="store",
+        type="int",
+        default=3,
+        dest="bench_runs",
+        help="Largest number of runs of a kernel that is slower than allowed",
+    )
+    opt.add_option(
+        "--bench-update-baseline",
+        action="store_true",
+        default=False,
+        dest="bench_update_baseline",
+        help="Writes the results of the micro-benchmark to the baseline",
+    )
+
+
+def fetch_freertos_posix_port(conf):
+    """downloads the files of the FreeRTOS POSIX port that are missing in
+    :py:data:`FREERTOS_POSIX_PORT`"""
+    for source in FREERTOS_POSIX_PORT_FILES:
+        node = conf.path.make_node([FREERTOS_POSIX_PORT] + source.split("/"))
+        if node.exists():
+            continue
+        url = f"{FREERTOS_POSIX_PORT_URL}/{source}"
+        with urllib.request.urlopen(url, timeout=30) as response:
+            content = response.read()
+        node.parent.mkdir()
+        node.write(content, "wb")
+
+
+def configure(conf):
+    """configuration step of the SIL waf tool:
+
+    - checks that the host is a Linux host
+    - finds the host gcc
+    - downloads the FreeRTOS POSIX port with ``--sil-fetch-port``
+    - checks that the FreeRTOS POSIX port is available, the CAN log replay,
+      the micro-benchmark and the database stress test are built without it
+
+    With ``--sil`` the configuration fails instead if the SIL binary cannot be
+    built."""
+
+    def unavailable(reason, fallback=""):
+        if conf.options.sil:
+            conf.fatal(f"The software-in-the-loop binary cannot be built: {reason}.")
+        conf.end_msg(fallback + reason, color="YELLOW")
+
+    conf.start_msg("Checking for software-in-the-loop support")
+    if Utils.unversioned_sys_platform() != "linux":
+        unavailable("not supported on this platform")
+        return
+    conf.find_program("gcc", var="SIL_CC", mandatory=False)
+    if not conf.env.SIL_CC:
+        unavailable("gcc is missing")
+        return
+    conf.env.SIL_CPPPATH_ST = "-I%s"
+    conf.env.SIL_DEFINES_ST = "-D%s"
+    conf.env.SIL_LIB_ST = "-l%s"
+    conf.env.append_unique("SIL_DEFINES", ["FOXBMS_SIL"])
+    # the DMA registers hold 32-bit addresses, therefore the binary has to be
+    # linked to a fixed address in the lower 4 GiB of the address space
+    conf.env.append_unique(
+        "SIL_CFLAGS",
+        [
+            "-std=gnu99",
+            "-O2",
+            "-g",
+            "-fno-omit-frame-pointer",
+            "-fno-pie",
+            "-pthread",
+            "-Wall",
+            "-Wno-unknown-pragmas",
+        ],
+    )
+    conf.env.append_unique("SIL_LINKFLAGS", ["-no-pie", "-pthread"])
+    conf.env.append_unique("SIL_LIB", ["m"])
+    if conf.options.sil_fetch_port:
+        try:
+            fetch_freertos_posix_port(conf)
+        except OSError as err:
+            unavailable(
+                f"the FreeRTOS POSIX port could not be downloaded ({err})",
+                fallback="only the CAN log replay, the micro-benchmark and the "
+                "database stress test, ",
+            )
+            return
+    for source in ["port.c", os.path.join("utils", "wait_for_event.c")]:
+        if not conf.path.find_node(os.path.join(FREERTOS_POSIX_PORT, source)):
+            unavailable(
+                "the FreeRTOS POSIX port is missing "
+                f"({os.path.join(FREERTOS_POSIX_PORT, source)})",
+                fallback="only the CAN log replay, the micro-benchmark and the "
+                "database stress test, ",
+            )
+            return
+    conf.env.SIL_FREERTOS_PORT = FREERTOS_POSIX_PORT
+    conf.end_msg(conf.env.get_flat("SIL_CC"))